@@ -0,0 +1,57 @@
+#version 330 core
+// bloom, one level down the pyramid: 13 bilinear taps (the filter of Jimenez, "Next Generation Post Processing in Call of Duty:
+// Advanced Warfare", SIGGRAPH 2014), wide enough that nothing between two output texels is skipped. The first level fuses the
+// prefilter into the same pass (FEATURE_BLOOM_PREFILTER): the firefly filter and the threshold run on the taps already read.
+#include "common/blocks.glsl"
+
+uniform sampler2D postSource;	// the level above, the HDR scene for the first level
+
+in vec2 vTexCoord;
+
+out vec4 FragColor;
+
+#ifdef FEATURE_BLOOM_PREFILTER
+// Karis average: every box weighted by 1 / (1 + luma), a single very bright pixel can't make the whole bloom flicker
+float karisWeight(vec3 color)
+{
+	return 1.0 / (1.0 + dot(color, vec3(0.2126, 0.7152, 0.0722)));
+}
+#endif
+
+void main()
+{
+	vec2 texel = 1.0 / vec2(textureSize(postSource, 0));
+	vec3 a = texture(postSource, vTexCoord + texel * vec2(-2.0, 2.0)).rgb;
+	vec3 b = texture(postSource, vTexCoord + texel * vec2(0.0, 2.0)).rgb;
+	vec3 c = texture(postSource, vTexCoord + texel * vec2(2.0, 2.0)).rgb;
+	vec3 d = texture(postSource, vTexCoord + texel * vec2(-2.0, 0.0)).rgb;
+	vec3 e = texture(postSource, vTexCoord).rgb;
+	vec3 f = texture(postSource, vTexCoord + texel * vec2(2.0, 0.0)).rgb;
+	vec3 g = texture(postSource, vTexCoord + texel * vec2(-2.0, -2.0)).rgb;
+	vec3 h = texture(postSource, vTexCoord + texel * vec2(0.0, -2.0)).rgb;
+	vec3 i = texture(postSource, vTexCoord + texel * vec2(2.0, -2.0)).rgb;
+	vec3 j = texture(postSource, vTexCoord + texel * vec2(-1.0, 1.0)).rgb;
+	vec3 k = texture(postSource, vTexCoord + texel * vec2(1.0, 1.0)).rgb;
+	vec3 l = texture(postSource, vTexCoord + texel * vec2(-1.0, -1.0)).rgb;
+	vec3 m = texture(postSource, vTexCoord + texel * vec2(1.0, -1.0)).rgb;
+
+	// the centre box counts half, the four overlapping corner boxes an eighth each
+	vec3 center = (j + k + l + m) * 0.25;
+	vec3 box0 = (a + b + d + e) * 0.25, box1 = (b + c + e + f) * 0.25, box2 = (d + e + g + h) * 0.25, box3 = (e + f + h + i) * 0.25;
+#ifdef FEATURE_BLOOM_PREFILTER
+	float w = 0.5 * karisWeight(center);
+	float w0 = 0.125 * karisWeight(box0), w1 = 0.125 * karisWeight(box1), w2 = 0.125 * karisWeight(box2), w3 = 0.125 * karisWeight(box3);
+	vec3 color = (center * w + box0 * w0 + box1 * w1 + box2 * w2 + box3 * w3) / (w + w0 + w1 + w2 + w3);
+#else
+	vec3 color = center * 0.5 + (box0 + box1 + box2 + box3) * 0.125;
+#endif
+
+#ifdef FEATURE_BLOOM_PREFILTER
+	// soft threshold: nothing below threshold - knee, a quadratic ramp up to threshold + knee, everything above it
+	float brightness = max(color.r, max(color.g, color.b));
+	float ramp = clamp(brightness - bloomParams.x + bloomParams.y, 0.0, 2.0 * bloomParams.y);
+	ramp = ramp * ramp / (4.0 * bloomParams.y + 1e-4);
+	color *= max(ramp, brightness - bloomParams.x) / max(brightness, 1e-4);
+#endif
+	FragColor = vec4(color, 1.0);
+}
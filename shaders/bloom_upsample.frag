@@ -0,0 +1,21 @@
+#version 330 core
+// bloom, one level up the pyramid: a 3 x 3 tent filter of the smaller level, added onto this level's downsample by the blend state
+// (GL_ONE, GL_ONE), so the levels sum up on the way back without a pass of their own
+#include "common/blocks.glsl"
+
+uniform sampler2D postSource;	// the level below, already holding the sum of every smaller level
+
+in vec2 vTexCoord;
+
+out vec4 FragColor;
+
+void main()
+{
+	vec2 texel = bloomParams.w / vec2(textureSize(postSource, 0));
+	vec3 color = texture(postSource, vTexCoord).rgb * 4.0;
+	color += (texture(postSource, vTexCoord + vec2(-texel.x, 0.0)).rgb + texture(postSource, vTexCoord + vec2(texel.x, 0.0)).rgb +
+		texture(postSource, vTexCoord + vec2(0.0, -texel.y)).rgb + texture(postSource, vTexCoord + vec2(0.0, texel.y)).rgb) * 2.0;
+	color += texture(postSource, vTexCoord - texel).rgb + texture(postSource, vTexCoord + texel).rgb +
+		texture(postSource, vTexCoord + vec2(-texel.x, texel.y)).rgb + texture(postSource, vTexCoord + vec2(texel.x, -texel.y)).rgb;
+	FragColor = vec4(color * 0.0625, 1.0);
+}
@@ -0,0 +1,69 @@
+// uniform blocks shared by every shader, must match the structs in src/uniform_buffer.h
+#pragma once
+
+layout (std140) uniform PerFrame
+{
+	float time;
+	float deltaTime;
+	vec2 resolution;
+};
+
+layout (std140) uniform PerView
+{
+	mat4 view;
+	mat4 projection;
+	mat4 viewProjection;
+};
+
+layout (std140) uniform PerDraw
+{
+	mat4 model;
+	vec4 color;
+	vec4 material;			// roughness, metalness
+};
+
+layout (std140) uniform Lighting
+{
+	uvec4 clusterGrid;		// clusters in x, y and z, number of lights
+	vec4 clusterParams;		// tile size in pixels, depth slice scale and bias
+	vec4 ambientColor;
+	vec4 sunDirection;		// view space, towards the sun
+	vec4 sunColor;
+};
+
+layout (std140) uniform Shadows
+{
+	mat4 cascadeMatrices[4];	// view space to shadow atlas coordinates and depth
+	vec4 cascadeSplits;			// view depth where each cascade ends
+	vec4 cascadeTexelSizes;		// world size of a shadow map texel per cascade
+};
+
+layout (std140) uniform Post
+{
+	vec4 bloomParams;		// threshold, soft knee, intensity, upsample filter radius in texels
+	vec4 toneParams;		// exposure, grading LUT size
+};
+
+layout (std140) uniform Temporal
+{
+	mat4 reprojection;		// this frame's clip space (unjittered) to the previous frame's
+	vec4 taaJitter;			// jitter in texture coordinates, weight of the new frame, 1 when the history is valid
+};
+
+struct ParticleEmitter
+{
+	uvec4 range;			// first slot and number of slots spawned this frame
+	vec4 positionRadius;	// centre and radius of the sphere the particles start in
+	vec4 velocitySpread;	// start velocity and the random part added to it
+	vec4 lifetime;			// shortest and longest lifetime in seconds
+};
+
+layout (std140) uniform Particles
+{
+	vec4 particleSimulation;	// time step, gravity, drag per second
+	vec4 particleRender;		// size, soft particle fade distance
+	uvec4 particleEmit;			// emitters this frame, capacity, random seed of the frame
+	vec4 particleStartColor;
+	vec4 particleEndColor;
+	ParticleEmitter particleEmitters[8];
+};
@@ -0,0 +1,52 @@
+// clustered point lights, the lists are built on the CPU every frame, see src/clustered_lighting.h
+#pragma once
+#include "common/blocks.glsl"
+#include "common/shadows.glsl"
+
+uniform usamplerBuffer clusterLists;	// per cluster: offset into lightIndices, number of lights
+uniform usamplerBuffer lightIndices;	// the clusters' lists one after another
+uniform samplerBuffer lights;			// two texels per light: view space position and radius, colour times intensity
+
+// what one light from direction l adds: Lambert diffuse and a normalised Blinn-Phong highlight whose size follows roughness, metals
+// tint the highlight with their albedo and have no diffuse part
+vec3 shadeLight(vec3 l, vec3 lightColor, vec3 viewDirection, vec3 normal, vec3 albedo, float roughness, float metalness)
+{
+	float nDotL = max(dot(normal, l), 0.0);
+	vec3 h = normalize(l + viewDirection);
+	float shininess = exp2(10.0 * (1.0 - roughness) + 1.0);
+	vec3 f0 = mix(vec3(0.04), albedo, metalness);
+	vec3 specular = f0 * ((shininess + 8.0) / 25.13) * pow(max(dot(normal, h), 0.0), shininess);	// (n + 8) / (8 pi)
+	vec3 diffuse = albedo * (1.0 - metalness);
+	return (diffuse + specular) * lightColor * nDotL;
+}
+
+vec3 shadePointLight(vec3 toLight, float radius, vec3 lightColor, vec3 viewDirection, vec3 normal, vec3 albedo, float roughness, float metalness)
+{
+	float distance = length(toLight);
+	float falloff = clamp(1.0 - distance / radius, 0.0, 1.0);	// reaches zero at the radius the clusters were built with
+	return shadeLight(toLight / max(distance, 1e-4), lightColor * (falloff * falloff), viewDirection, normal, albedo, roughness, metalness);
+}
+
+// the shadowed sun, the point lights reaching this fragment and ambient, viewNormal must be normalised
+vec3 clusteredLighting(vec3 viewPosition, vec3 viewNormal, vec3 albedo, float roughness, float metalness)
+{
+	// the cluster: screen tile from the pixel, depth slice from the view depth (exponential slices, a log and a multiply add)
+	uvec2 tile = min(uvec2(gl_FragCoord.xy / clusterParams.xy), clusterGrid.xy - 1u);
+	float slice = clamp(floor(log(-viewPosition.z) * clusterParams.z + clusterParams.w), 0.0, float(clusterGrid.z - 1u));
+	int cluster = int((uint(slice) * clusterGrid.y + tile.y) * clusterGrid.x + tile.x);
+	uvec2 list = texelFetch(clusterLists, cluster).xy;
+
+	vec3 viewDirection = normalize(-viewPosition);
+	vec3 result = albedo * ambientColor.rgb;
+	float sunLit = cascadedShadow(viewPosition, viewNormal);
+	result += shadeLight(sunDirection.xyz, sunColor.rgb * sunLit, viewDirection, viewNormal, albedo, roughness, metalness);
+	for (uint i = 0u; i < list.y; i++)
+	{
+		int light = int(texelFetch(lightIndices, int(list.x + i)).r);
+		vec4 positionRadius = texelFetch(lights, light * 2);
+		vec3 lightColor = texelFetch(lights, light * 2 + 1).rgb;
+		result += shadePointLight(positionRadius.xyz - viewPosition, positionRadius.w, lightColor, viewDirection, viewNormal, albedo,
+			roughness, metalness);
+	}
+	return result;
+}
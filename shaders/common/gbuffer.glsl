@@ -0,0 +1,38 @@
+// G-buffer packing shared by the G-buffer pass and the deferred lighting pass, layout described in src/main.cpp
+#pragma once
+
+// octahedral normal: the unit sphere folded onto the octahedron |x| + |y| + |z| = 1 and flattened to the square -1..1, two values
+// per normal with the error spread evenly over the sphere
+vec2 encodeOctahedral(vec3 n)
+{
+	n /= abs(n.x) + abs(n.y) + abs(n.z);
+	vec2 e = n.xy;
+	if (n.z < 0.0)
+	{
+		e = (1.0 - abs(n.yx)) * vec2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+	}
+	return e * 0.5 + 0.5;
+}
+
+vec3 decodeOctahedral(vec2 e)
+{
+	e = e * 2.0 - 1.0;
+	vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+	float t = max(-n.z, 0.0);
+	n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+	return normalize(n);
+}
+
+// the two 12 bit halves of an octahedral normal spread over three 8 bit channels
+vec3 packNormal(vec3 n)
+{
+	uvec2 v = uvec2(round(clamp(encodeOctahedral(n), 0.0, 1.0) * 4095.0));
+	return vec3(v.x >> 4u, ((v.x & 15u) << 4u) | (v.y >> 8u), v.y & 255u) / 255.0;
+}
+
+vec3 unpackNormal(vec3 bytes)
+{
+	uvec3 b = uvec3(round(bytes * 255.0));
+	uvec2 v = uvec2((b.x << 4u) | (b.y >> 4u), ((b.y & 15u) << 8u) | b.z);
+	return decodeOctahedral(vec2(v) / 4095.0);
+}
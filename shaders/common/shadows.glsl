@@ -0,0 +1,42 @@
+// cascaded shadow map of the sun, the cascades are fitted on the CPU every frame, see src/cascaded_shadows.h
+#pragma once
+#include "common/blocks.glsl"
+
+uniform sampler2DShadow shadowAtlas;	// the cascades' depths as a 2 x 2 atlas, compared in hardware
+
+// how much of the sun reaches this point, 0 in shadow to 1 lit, viewNormal must be normalised
+float cascadedShadow(vec3 viewPosition, vec3 viewNormal)
+{
+	float depth = -viewPosition.z;
+	if (depth >= cascadeSplits.w)
+	{
+		return 1.0;		// beyond the shadow distance
+	}
+	int cascade = 0;
+	while (cascade < 3 && depth >= cascadeSplits[cascade])
+	{
+		cascade++;
+	}
+
+	// normal offset: the lookup moves off the surface by about a texel of this cascade, which keeps a surface at a grazing angle to the
+	// sun from shadowing itself (acne) without the large constant bias that detaches shadows from their casters
+	vec3 position = viewPosition + viewNormal * (cascadeTexelSizes[cascade] * 1.5);
+	vec3 coord = (cascadeMatrices[cascade] * vec4(position, 1.0)).xyz;	// orthographic, no divide
+
+	// 2 x 2 taps half a texel apart, each a bilinear filtered comparison of 4 texels: a 3 x 3 texel footprint for 4 lookups. The taps
+	// stay inside the cascade's square, next to it is another cascade.
+	vec2 texel = 1.0 / vec2(textureSize(shadowAtlas, 0));
+	vec2 square = vec2(cascade & 1, cascade >> 1) * 0.5;
+	vec2 low = square + texel * 1.5;
+	vec2 high = square + 0.5 - texel * 1.5;
+	float lit = 0.0;
+	for (int y = 0; y < 2; y++)
+	{
+		for (int x = 0; x < 2; x++)
+		{
+			vec2 uv = clamp(coord.xy + (vec2(x, y) - 0.5) * texel, low, high);
+			lit += texture(shadowAtlas, vec3(uv, coord.z));
+		}
+	}
+	return lit * 0.25;
+}
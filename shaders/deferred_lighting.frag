@@ -0,0 +1,32 @@
+#version 330 core
+// deferred shading, second pass: every pixel lit once from the G-buffer, with the same cluster lists as the forward path
+#include "common/blocks.glsl"
+#include "common/gbuffer.glsl"
+#include "common/clustered.glsl"
+
+uniform sampler2D gbuffer0;		// albedo, metalness
+uniform sampler2D gbuffer1;		// packed normal, roughness
+uniform sampler2D gbufferDepth;
+
+out vec4 FragColor;
+
+void main()
+{
+	ivec2 pixel = ivec2(gl_FragCoord.xy);
+	float depth = texelFetch(gbufferDepth, pixel, 0).r;
+	if (depth == 1.0)
+	{
+		discard;	// nothing drawn here, the clear colour stays
+	}
+	vec4 albedoMetalness = texelFetch(gbuffer0, pixel, 0);
+	vec4 normalRoughness = texelFetch(gbuffer1, pixel, 0);
+
+	// view space position from the depth, undoing the perspective projection: z from the depth, x and y from the pixel at that z (and
+	// the temporal anti-aliasing jitter, projection[2].xy, taken out again)
+	float viewZ = -projection[3][2] / (depth * 2.0 - 1.0 + projection[2][2]);
+	vec2 ndc = gl_FragCoord.xy / resolution * 2.0 - 1.0 + projection[2].xy;
+	vec3 viewPosition = vec3(ndc.x * -viewZ / projection[0][0], ndc.y * -viewZ / projection[1][1], viewZ);
+
+	vec3 normal = unpackNormal(normalRoughness.rgb);
+	FragColor = vec4(clusteredLighting(viewPosition, normal, albedoMetalness.rgb, normalRoughness.a, albedoMetalness.a), 1.0);
+}
@@ -0,0 +1,5 @@
+#version 330 core
+// depth prepass: colour writes are masked off, only the depth test and write run
+void main()
+{
+}
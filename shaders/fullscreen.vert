@@ -0,0 +1,11 @@
+#version 330 core
+// one triangle covering the screen, no vertex buffer: the corners come from gl_VertexID (draw 3 vertices)
+
+out vec2 vTexCoord;		// 0..1 over the screen
+
+void main()
+{
+	vec2 position = vec2((gl_VertexID << 1) & 2, gl_VertexID & 2);	// (0, 0), (2, 0), (0, 2)
+	vTexCoord = position;
+	gl_Position = vec4(position * 2.0 - 1.0, 0.0, 1.0);
+}
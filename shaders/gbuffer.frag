@@ -0,0 +1,17 @@
+#version 330 core
+// deferred shading, first pass: the surface into the G-buffer instead of lighting it
+#include "common/blocks.glsl"
+#include "common/gbuffer.glsl"
+
+in vec3 vViewPosition;
+in vec3 vViewNormal;
+
+layout (location = 0) out vec4 gbufferAlbedo;	// albedo, metalness
+layout (location = 1) out vec4 gbufferNormal;	// packed view space normal, roughness
+
+void main()
+{
+	vec3 normal = normalize(gl_FrontFacing ? vViewNormal : -vViewNormal);
+	gbufferAlbedo = vec4(color.rgb, material.y);
+	gbufferNormal = vec4(packNormal(normal), material.x);
+}
@@ -0,0 +1,8 @@
+#version 330 core
+// overdraw view: every fragment adds an eighth with additive blending, white where a pixel was shaded 8 times or more
+out vec4 FragColor;
+
+void main()
+{
+	FragColor = vec4(0.125, 0.125, 0.125, 1.0);
+}
@@ -0,0 +1,27 @@
+#version 330 core
+// a round soft sprite added onto the scene, emissive (not lit) and unsorted, additive blending doesn't depend on the order
+#include "common/blocks.glsl"
+
+#ifdef FEATURE_SOFT_PARTICLES
+uniform sampler2D particleDepth;	// the scene's depth, the particles are drawn without a depth test
+#endif
+
+in vec2 vCorner;
+in vec3 vColor;
+in float vViewDepth;
+
+out vec4 FragColor;
+
+void main()
+{
+	float falloff = max(1.0 - dot(vCorner, vCorner), 0.0);
+	float alpha = falloff * falloff;
+#ifdef FEATURE_SOFT_PARTICLES
+	// fades out where the sprite is close to the surface behind it, instead of a hard line where it cuts into it. Depth test by hand too:
+	// a particle behind the surface has a negative distance
+	float depth = texelFetch(particleDepth, ivec2(gl_FragCoord.xy), 0).r;
+	float sceneDepth = projection[3][2] / (depth * 2.0 - 1.0 + projection[2][2]);
+	alpha *= clamp((sceneDepth - vViewDepth) / particleRender.y, 0.0, 1.0);
+#endif
+	FragColor = vec4(vColor * alpha, 0.0);
+}
@@ -0,0 +1,36 @@
+#version 330 core
+// particles as camera facing quads: 4 vertices of a triangle strip per instance, the particle's state comes in per instance from the
+// buffer the simulation wrote (attribute divisor 1). See src/particle_system.h.
+#include "common/blocks.glsl"
+
+layout (location = 0) in vec4 aPositionAge;
+layout (location = 1) in vec4 aVelocityLifetime;
+
+out vec2 vCorner;		// -1..1 across the quad
+out vec3 vColor;
+out float vViewDepth;	// distance in front of the camera, for the soft particle fade
+
+void main()
+{
+	float age = aPositionAge.w;
+	float lifetime = aVelocityLifetime.w;
+	if (age >= lifetime)
+	{
+		gl_Position = vec4(2.0, 2.0, 2.0, 1.0);	// dead or never spawned: outside the clip volume, the quad is culled before rasterising
+		vCorner = vec2(0.0);
+		vColor = vec3(0.0);
+		vViewDepth = 0.0;
+		return;
+	}
+
+	// 0, 1, 2, 3 -> (-1, -1), (1, -1), (-1, 1), (1, 1)
+	vCorner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1)) * 2.0 - 1.0;
+
+	// expanded in view space, so the quad always faces the camera
+	float t = age / lifetime;
+	vec4 viewPosition = view * vec4(aPositionAge.xyz, 1.0);
+	viewPosition.xy += vCorner * particleRender.x;
+	gl_Position = projection * viewPosition;
+	vColor = mix(particleStartColor.rgb, particleEndColor.rgb, t) * (1.0 - t * t);	// fades out towards the end of its life
+	vViewDepth = -viewPosition.z;
+}
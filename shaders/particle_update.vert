@@ -0,0 +1,64 @@
+#version 330 core
+// particle simulation: one vertex per particle slot, read from last frame's buffer and captured into this frame's by transform feedback.
+// Nothing is rasterised (GL_RASTERIZER_DISCARD), the outputs are the new state. See src/particle_system.h.
+#include "common/blocks.glsl"
+
+layout (location = 0) in vec4 inPositionAge;		// world position, seconds since spawned
+layout (location = 1) in vec4 inVelocityLifetime;	// world velocity, seconds it lives (0: the slot was never used)
+
+out vec4 outPositionAge;
+out vec4 outVelocityLifetime;
+
+// PCG hash: a well mixed 32 bit value from another, the random numbers of a particle come from its slot and the frame's seed
+uint hash(uint v)
+{
+	uint state = v * 747796405u + 2891336453u;
+	uint word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+	return (word >> 22u) ^ word;
+}
+
+float random01(inout uint seed)
+{
+	seed = hash(seed);
+	return float(seed >> 8u) * (1.0 / 16777216.0);
+}
+
+// a point in the unit ball, uniform by volume
+vec3 randomInBall(inout uint seed)
+{
+	float z = random01(seed) * 2.0 - 1.0;
+	float angle = random01(seed) * 6.2831853;
+	float radius = pow(random01(seed), 1.0 / 3.0);
+	return vec3(vec2(cos(angle), sin(angle)) * sqrt(1.0 - z * z), z) * radius;
+}
+
+void main()
+{
+	uint slot = uint(gl_VertexID);
+	uint capacity = particleEmit.y;
+	float dt = particleSimulation.x;
+
+	// the emitters' slot ranges of this frame are disjoint, a slot in one is overwritten by a new particle
+	for (uint i = 0u; i < particleEmit.x; i++)
+	{
+		uvec4 range = particleEmitters[i].range;
+		if ((slot + capacity - range.x) % capacity < range.y)
+		{
+			uint seed = hash(slot ^ hash(particleEmit.z));
+			ParticleEmitter emitter = particleEmitters[i];
+			vec3 position = emitter.positionRadius.xyz + randomInBall(seed) * emitter.positionRadius.w;
+			vec3 velocity = emitter.velocitySpread.xyz + randomInBall(seed) * emitter.velocitySpread.w;
+			float lifetime = mix(emitter.lifetime.x, emitter.lifetime.y, random01(seed));
+			outPositionAge = vec4(position, 0.0);
+			outVelocityLifetime = vec4(velocity, lifetime);
+			return;
+		}
+	}
+
+	// dead particles keep moving too, there is no branch to skip and they are never drawn
+	vec3 velocity = inVelocityLifetime.xyz;
+	velocity.y -= particleSimulation.y * dt;
+	velocity *= max(1.0 - particleSimulation.z * dt, 0.0);
+	outPositionAge = vec4(inPositionAge.xyz + velocity * dt, inPositionAge.w + dt);
+	outVelocityLifetime = vec4(velocity, inVelocityLifetime.w);
+}
@@ -0,0 +1,100 @@
+#version 330 core
+// temporal anti-aliasing: this frame's jittered image blended into the history of the frames before it. The history is fetched where
+// the pixel's surface was last frame (motion vector from the depth and the two frames' camera matrices) and clipped to the colours
+// around the pixel this frame, so what moved or came into view doesn't leave a ghost behind.
+#include "common/blocks.glsl"
+
+uniform sampler2D taaCurrent;	// this frame, HDR
+uniform sampler2D taaDepth;		// this frame's depth
+uniform sampler2D taaHistory;	// the previous frame's result
+
+in vec2 vTexCoord;
+
+out vec4 FragColor;
+
+// luma and two chroma axes: the neighbourhood's box fits the colours much tighter than in RGB
+vec3 toYCoCg(vec3 c)
+{
+	return vec3(dot(c, vec3(0.25, 0.5, 0.25)), dot(c, vec3(0.5, 0.0, -0.5)), dot(c, vec3(-0.25, 0.5, -0.25)));
+}
+
+vec3 fromYCoCg(vec3 c)
+{
+	return vec3(c.x + c.y - c.z, c.x + c.z, c.x - c.y - c.z);
+}
+
+// the history with a Catmull-Rom filter in 5 bilinear taps (the 4 corners of the 4 x 4 weigh next to nothing and are left out), a plain
+// bilinear fetch would blur the history a little more every frame
+vec3 sampleHistory(vec2 uv)
+{
+	vec2 size = vec2(textureSize(taaHistory, 0));
+	vec2 position = uv * size;
+	vec2 center = floor(position - 0.5) + 0.5;
+	vec2 f = position - center;
+	vec2 w0 = f * (-0.5 + f * (1.0 - 0.5 * f));
+	vec2 w1 = 1.0 + f * f * (-2.5 + 1.5 * f);
+	vec2 w2 = f * (0.5 + f * (2.0 - 1.5 * f));
+	vec2 w3 = f * f * (-0.5 + 0.5 * f);
+	vec2 w12 = w1 + w2;
+	vec2 uv0 = (center - 1.0) / size;
+	vec2 uv12 = (center + w2 / w12) / size;		// one bilinear tap between the two middle texels gives both their weights
+	vec2 uv3 = (center + 2.0) / size;
+
+	vec3 color = texture(taaHistory, vec2(uv12.x, uv0.y)).rgb * (w12.x * w0.y) +
+		texture(taaHistory, vec2(uv0.x, uv12.y)).rgb * (w0.x * w12.y) +
+		texture(taaHistory, uv12).rgb * (w12.x * w12.y) +
+		texture(taaHistory, vec2(uv3.x, uv12.y)).rgb * (w3.x * w12.y) +
+		texture(taaHistory, vec2(uv12.x, uv3.y)).rgb * (w12.x * w3.y);
+	float weight = w12.x * w0.y + w0.x * w12.y + w12.x * w12.y + w3.x * w12.y + w12.x * w3.y;
+	return max(color / weight, 0.0);	// the negative lobes can undershoot
+}
+
+// moves the colour towards the box's centre until it is inside, clamping each axis on its own would shift its hue
+vec3 clipToBox(vec3 color, vec3 low, vec3 high)
+{
+	vec3 center = 0.5 * (high + low);
+	vec3 extent = 0.5 * (high - low) + 1e-4;
+	vec3 offset = color - center;
+	vec3 units = abs(offset / extent);
+	float outside = max(units.x, max(units.y, units.z));
+	return outside > 1.0 ? center + offset / outside : color;
+}
+
+void main()
+{
+	// the 3 x 3 neighbourhood: the range of this frame's colours, and the nearest depth, whose motion keeps an edge with the surface in
+	// front of it
+	ivec2 pixel = ivec2(gl_FragCoord.xy);
+	ivec2 last = textureSize(taaCurrent, 0) - 1;
+	vec3 current = toYCoCg(texelFetch(taaCurrent, pixel, 0).rgb);
+	vec3 low = current, high = current;
+	float depth = 1.0;
+	for (int y = -1; y <= 1; y++)
+	{
+		for (int x = -1; x <= 1; x++)
+		{
+			ivec2 neighbour = clamp(pixel + ivec2(x, y), ivec2(0), last);
+			vec3 color = toYCoCg(texelFetch(taaCurrent, neighbour, 0).rgb);
+			low = min(low, color);
+			high = max(high, color);
+			depth = min(depth, texelFetch(taaDepth, neighbour, 0).r);
+		}
+	}
+
+	// the motion vector: the surface's position this frame without the jitter, and where the previous frame's camera saw it
+	vec2 uv = vTexCoord - taaJitter.xy;
+	vec4 previous = reprojection * vec4(vec3(uv, depth) * 2.0 - 1.0, 1.0);
+	vec2 motion = uv - (previous.xy / previous.w * 0.5 + 0.5);
+	vec2 historyUv = vTexCoord - motion;
+	if (taaJitter.w == 0.0 || any(notEqual(historyUv, clamp(historyUv, 0.0, 1.0))))
+	{
+		FragColor = vec4(fromYCoCg(current), 1.0);	// no history, or the surface was off screen
+		return;
+	}
+	vec3 history = clipToBox(toYCoCg(sampleHistory(historyUv)), low, high);
+
+	// weighted by 1 / (1 + luma): a single very bright sample would otherwise dominate the average and flicker as the jitter moves
+	float currentWeight = taaJitter.z / (1.0 + current.x);
+	float historyWeight = (1.0 - taaJitter.z) / (1.0 + history.x);
+	FragColor = vec4(fromYCoCg((current * currentWeight + history * historyWeight) / (currentWeight + historyWeight)), 1.0);
+}
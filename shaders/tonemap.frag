@@ -0,0 +1,45 @@
+#version 330 core
+// the end of the frame, one pass straight into the window: bloom added to the HDR scene, exposure, filmic tonemapping, sRGB encoding,
+// colour grading through a 3D lookup table and dithering. Fused, the HDR scene is read once and nothing full size is written but the
+// window.
+#include "common/blocks.glsl"
+
+uniform sampler2D postSource;	// the HDR scene
+uniform sampler2D postBloom;	// the bloom pyramid's largest level, half resolution
+uniform sampler3D gradingLut;	// sRGB in, graded sRGB out
+
+in vec2 vTexCoord;
+
+out vec4 FragColor;
+
+// the ACES filmic curve as fitted by Narkowicz: a toe for the shadows, highlights roll off to white instead of clipping
+vec3 tonemapAces(vec3 x)
+{
+	return clamp((x * (2.51 * x + 0.03)) / (x * (2.43 * x + 0.59) + 0.14), 0.0, 1.0);
+}
+
+vec3 linearToSrgb(vec3 color)
+{
+	return mix(color * 12.92, 1.055 * pow(color, vec3(1.0 / 2.4)) - 0.055, step(vec3(0.0031308), color));
+}
+
+// noise from the pixel position (Jimenez), the same every frame and without visible pattern at one step of 8 bits
+float interleavedGradientNoise(vec2 pixel)
+{
+	return fract(52.9829189 * fract(dot(pixel, vec2(0.06711056, 0.00583715))));
+}
+
+void main()
+{
+	vec3 color = texture(postSource, vTexCoord).rgb;
+	color += texture(postBloom, vTexCoord).rgb * bloomParams.z;
+	color = linearToSrgb(tonemapAces(color * toneParams.x));
+
+	// the LUT's texel centres sit at (i + 0.5) / size: scaled so 0 and 1 land on the first and last centre
+	float size = toneParams.y;
+	color = texture(gradingLut, color * ((size - 1.0) / size) + 0.5 / size).rgb;
+
+	// half a step of 8 bit noise breaks up the bands of smooth gradients
+	color += (interleavedGradientNoise(gl_FragCoord.xy) - 0.5) / 255.0;
+	FragColor = vec4(color, 1.0);
+}
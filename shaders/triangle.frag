@@ -0,0 +1,23 @@
+#version 330 core
+// basic fragment shader, the colour comes from the PerDraw uniform block
+#include "common/blocks.glsl"
+#ifdef FEATURE_CLUSTERED_LIGHTING
+#include "common/clustered.glsl"
+#endif
+
+in vec3 vViewPosition;
+in vec3 vViewNormal;
+
+out vec4 FragColor;
+
+void main()
+{
+	FragColor = color;
+#ifdef FEATURE_CLUSTERED_LIGHTING
+	vec3 normal = normalize(gl_FrontFacing ? vViewNormal : -vViewNormal);	// the triangles are lit from both sides
+	FragColor.rgb = clusteredLighting(vViewPosition, normal, color.rgb, material.x, material.y);
+#endif
+#ifdef FEATURE_PULSE
+	FragColor.rgb *= 0.75 + 0.25 * sin(time * 3.0);
+#endif
+}
@@ -0,0 +1,19 @@
+#version 330 core
+// basic vertex shader, the transforms come from the PerView and PerDraw uniform blocks
+#include "common/blocks.glsl"
+
+layout (location = 0) in vec3 aPos;
+
+out vec3 vViewPosition;	// for lighting, in view space
+out vec3 vViewNormal;
+
+// the depth prepass and the colour pass (GL_EQUAL depth test) must compute bit identical positions, invariant stops the compiler
+// from optimising this output differently per program
+invariant gl_Position;
+
+void main()
+{
+	gl_Position = viewProjection * model * vec4(aPos.x, aPos.y, aPos.z, 1.0);
+	vViewPosition = (view * model * vec4(aPos, 1.0)).xyz;
+	vViewNormal = mat3(view * model) * vec3(0.0, 0.0, 1.0);	// the triangles lie in their xy plane (uniform scale only)
+}
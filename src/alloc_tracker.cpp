@@ -0,0 +1,248 @@
+/*
+ *	Heap allocation tracking, see alloc_tracker.h
+ */
+
+#include "alloc_tracker.h"
+
+#ifdef LEARNOPENGL_TRACK_ALLOCATIONS
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#if defined(_MSC_VER) && defined(_DEBUG)
+#include <crtdbg.h>
+#define ALLOC_TRACKER_CRT_HOOK 1	// debug CRT can report every malloc, no need to replace operator new
+#endif
+
+namespace
+{
+	const int tagCount = (int)AllocTag::Count;
+
+	// all state is plain atomics with constant initialisation, operator new can be called before any constructor of this file has run
+	std::atomic<bool> installed{ false };
+	std::atomic<bool> steadyState{ false };
+	std::atomic<bool> failOnSteadyStateAlloc{ true };
+	std::atomic<unsigned int> warmupFrames{ 60 };	// the first frames create driver objects lazily, give them time to settle
+	std::atomic<unsigned long long> frameNumber{ 0 };
+	std::atomic<unsigned long long> total{ 0 };
+	std::atomic<unsigned long long> frameCount[tagCount];
+	std::atomic<unsigned long long> frameBytes[tagCount];
+
+	AllocFrameStats last;
+
+	// the warning without failing: the first offending frame in full, then at most one summary per reportInterval frames
+	const unsigned long long reportInterval = 600;
+	bool warned = false;
+	unsigned long long lastReportFrame = 0;
+	unsigned long long offendingFrames = 0;				// since the last report
+	unsigned long long offendingCount[tagCount] = {};	// since the last report, per tag
+
+	thread_local AllocTag currentTag = AllocTag::General;
+	thread_local bool frameThread = false;	// the thread between beginFrame() and endFrame(), only its allocations belong to the frame
+	thread_local bool reporting = false;	// set while printing so allocations made by the report itself are ignored
+
+	const char* const tagNames[tagCount] = { "General", "Render", "Resources", "Shaders", "Platform" };
+
+	bool isExempt(AllocTag tag)
+	{
+		return tag == AllocTag::Platform;
+	}
+
+	void recordAllocation(std::size_t size)
+	{
+		if (!installed.load(std::memory_order_relaxed) || reporting)
+		{
+			return;
+		}
+
+		const AllocTag tag = currentTag;
+		total.fetch_add(1, std::memory_order_relaxed);
+		if (!frameThread)
+		{
+			return;	// another thread (JobSystem workers, the driver's): counted in the total only
+		}
+		frameCount[(int)tag].fetch_add(1, std::memory_order_relaxed);
+		frameBytes[(int)tag].fetch_add(size, std::memory_order_relaxed);
+
+		// steady state rule, fail at the allocation itself so the call stack points at the culprit
+		if (steadyState.load(std::memory_order_relaxed) &&
+			failOnSteadyStateAlloc.load(std::memory_order_relaxed) && !isExempt(tag))
+		{
+			reporting = true;
+			std::fprintf(stderr, "ERROR::ALLOC_TRACKER::STEADY_STATE_ALLOCATION\n%zu bytes allocated under tag %s in frame %llu\n",
+				size, tagNames[(int)tag], frameNumber.load());
+			std::fflush(stderr);
+			std::abort();
+		}
+	}
+
+#ifdef ALLOC_TRACKER_CRT_HOOK
+	// called by the debug CRT for every malloc/realloc/free of this CRT instance
+	int crtAllocHook(int allocType, void*, size_t size, int blockType, long, const unsigned char*, int)
+	{
+		if (blockType != _CRT_BLOCK && (allocType == _HOOK_ALLOC || allocType == _HOOK_REALLOC))	// _CRT_BLOCK are the CRT's own bookkeeping
+		{
+			recordAllocation(size);
+		}
+		return 1;	// allow the allocation
+	}
+#endif
+}
+
+namespace AllocTracker
+{
+	void install()
+	{
+#ifdef ALLOC_TRACKER_CRT_HOOK
+		_CrtSetAllocHook(crtAllocHook);
+#endif
+		installed = true;
+	}
+
+	void setWarmupFrames(unsigned int frames)
+	{
+		warmupFrames = frames;
+	}
+
+	void setFailOnSteadyStateAlloc(bool fail)
+	{
+		failOnSteadyStateAlloc = fail;
+	}
+
+	void beginFrame()
+	{
+		for (int i = 0; i < tagCount; i++)
+		{
+			frameCount[i].store(0, std::memory_order_relaxed);
+			frameBytes[i].store(0, std::memory_order_relaxed);
+		}
+		steadyState = frameNumber.load() >= warmupFrames.load();
+		frameThread = true;
+	}
+
+	void endFrame()
+	{
+		frameThread = false;
+
+		// snapshot the frame counters (no allocation, AllocFrameStats is fixed size)
+		last.frame = frameNumber.load();
+		unsigned long long offending = 0;
+		for (int i = 0; i < tagCount; i++)
+		{
+			last.count[i] = frameCount[i].load(std::memory_order_relaxed);
+			last.bytes[i] = frameBytes[i].load(std::memory_order_relaxed);
+			if (steadyState && !isExempt((AllocTag)i))
+			{
+				offending += last.count[i];
+				offendingCount[i] += last.count[i];
+			}
+		}
+		offendingFrames += offending > 0 ? 1 : 0;
+
+		// when not failing at the allocation, say so for the first offending frame and then every reportInterval frames at most, a
+		// line per frame would bury everything else on stderr (lastFrame() has every frame's counts)
+		bool first = !warned && offending > 0;
+		if (first || (warned && offendingFrames > 0 && last.frame - lastReportFrame >= reportInterval))
+		{
+			reporting = true;
+			if (first)
+			{
+				std::fprintf(stderr, "WARNING::ALLOC_TRACKER::STEADY_STATE_ALLOCATION\nframe %llu made %llu allocations:", last.frame, offending);
+			}
+			else
+			{
+				std::fprintf(stderr, "WARNING::ALLOC_TRACKER::STEADY_STATE_ALLOCATION\n%llu of the frames since frame %llu allocated:",
+					offendingFrames, lastReportFrame);
+			}
+			for (int i = 0; i < tagCount; i++)
+			{
+				if (offendingCount[i] > 0 && first)
+				{
+					std::fprintf(stderr, " %s=%llu (%llu bytes)", tagNames[i], offendingCount[i], last.bytes[i]);
+				}
+				else if (offendingCount[i] > 0)
+				{
+					std::fprintf(stderr, " %s=%llu", tagNames[i], offendingCount[i]);
+				}
+				offendingCount[i] = 0;
+			}
+			std::fprintf(stderr, "\n");
+			reporting = false;
+			warned = true;
+			lastReportFrame = last.frame;
+			offendingFrames = 0;
+		}
+
+		frameNumber++;
+	}
+
+	const AllocFrameStats& lastFrame()
+	{
+		return last;
+	}
+
+	unsigned long long totalAllocations()
+	{
+		return total.load();
+	}
+
+	const char* tagName(AllocTag tag)
+	{
+		return tagNames[(int)tag];
+	}
+
+	AllocTag pushTag(AllocTag tag)
+	{
+		AllocTag previous = currentTag;
+		currentTag = tag;
+		return previous;
+	}
+
+	void popTag(AllocTag previous)
+	{
+		currentTag = previous;
+	}
+}
+
+#ifndef ALLOC_TRACKER_CRT_HOOK
+
+// replacement global allocation functions, all allocations made with new in the program end up here
+void* operator new(std::size_t size)
+{
+	recordAllocation(size);
+	void* p = std::malloc(size ? size : 1);
+	if (p == nullptr)
+	{
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void* operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	recordAllocation(size);
+	return std::malloc(size ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+	return operator new(size, tag);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { std::free(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { std::free(p); }
+
+#endif
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef ALLOC_TRACKER_H
+#define ALLOC_TRACKER_H
+
+/*
+ * NOTES:
+ * Heap allocation tracking for the render loop.
+ *
+ * The rule for the hot path (everything run once per frame inside the render loop) is that it should not allocate: a heap allocation
+ * is a lock inside the allocator, a possible page fault and a cache miss, and once there are hundreds of them per frame they show up as
+ * frame time spikes that are hard to find after the fact. Allocating during startup (loading shaders, creating buffers) is fine.
+ *
+ * When LEARNOPENGL_TRACK_ALLOCATIONS is defined (the Debug configurations define it, define it for benchmark builds too) every heap
+ * allocation is counted per frame and per subsystem tag:
+ *	*MSVC debug CRT: a _CrtSetAllocHook hook sees malloc/realloc and (because operator new calls malloc) new as well.
+ *	*everywhere else: the global operator new/delete are replaced. Raw malloc calls are not seen on these platforms.
+ *
+ * Once the warm-up frames have passed the tracker is in "steady state" and any allocation between beginFrame() and endFrame() that is
+ * not under an exempt tag (Platform, for GLFW and the driver which we do not control) prints the tag and size and aborts, so the debugger
+ * stops on the call stack of the offending allocation.
+ *
+ * With setFailOnSteadyStateAlloc(false) endFrame() prints the first offending frame and then a summary every 600 frames at most,
+ * lastFrame() has the counts of every frame.
+ *
+ * Only the thread that called beginFrame() (the render thread) is checked: allocations of other threads, JobSystem workers included,
+ * count in totalAllocations() but not in the frame, even when the job runs for the frame. The indices of a parallelFor() the render
+ * thread runs itself are checked, so run with LEARNOPENGL_JOBS=0 to check every job.
+ *
+ * Without LEARNOPENGL_TRACK_ALLOCATIONS everything below compiles down to empty inline functions.
+ *
+ * Usage:
+ *	AllocTracker::beginFrame();
+ *	{
+ *		AllocScope scope(AllocTag::Render);	// allocations in this block are counted under Render
+ *		...
+ *	}
+ *	AllocTracker::endFrame();
+ */
+
+#include <cstddef>
+
+// subsystem an allocation is counted under, set for the current thread with AllocScope
+enum class AllocTag
+{
+	General,		// default when no scope is active
+	Render,			// render loop: draw submission, per frame data
+	Resources,		// buffers, textures, meshes: GlResources / GpuMemory creation and PipelineCache::create tag themselves
+	Shaders,		// shader sources, compilation, reflection: ShaderCache, ProgramReflection::build and the manifest tag themselves
+	Platform,		// GLFW and driver calls (exempt from the steady state rule)
+	Count
+};
+
+// allocation counts of one frame, indexed by AllocTag
+struct AllocFrameStats
+{
+	unsigned long long frame = 0;
+	unsigned long long count[(int)AllocTag::Count] = {};
+	unsigned long long bytes[(int)AllocTag::Count] = {};
+};
+
+#ifdef LEARNOPENGL_TRACK_ALLOCATIONS
+
+namespace AllocTracker
+{
+	void install();								// start counting (called once at startup, before the first frame)
+	void setWarmupFrames(unsigned int frames);	// number of frames allowed to allocate before steady state is enforced
+	void setFailOnSteadyStateAlloc(bool fail);	// false only counts and reports in endFrame() instead of aborting
+
+	void beginFrame();							// on the render thread, the frame's counts and rule apply to this thread only
+	void endFrame();
+
+	const AllocFrameStats& lastFrame();			// counts of the last finished frame
+	unsigned long long totalAllocations();		// allocations since install()
+	const char* tagName(AllocTag tag);
+
+	AllocTag pushTag(AllocTag tag);				// used by AllocScope, returns the previous tag
+	void popTag(AllocTag previous);
+}
+
+// tags every allocation made on this thread while the scope is alive
+class AllocScope
+{
+public:
+	explicit AllocScope(AllocTag tag) : previous(AllocTracker::pushTag(tag)) {}
+	~AllocScope() { AllocTracker::popTag(previous); }
+
+	AllocScope(const AllocScope&) = delete;
+	AllocScope& operator=(const AllocScope&) = delete;
+
+private:
+	AllocTag previous;
+};
+
+#else
+
+namespace AllocTracker
+{
+	inline void install() {}
+	inline void setWarmupFrames(unsigned int) {}
+	inline void setFailOnSteadyStateAlloc(bool) {}
+	inline void beginFrame() {}
+	inline void endFrame() {}
+	inline const AllocFrameStats& lastFrame() { static const AllocFrameStats empty; return empty; }
+	inline unsigned long long totalAllocations() { return 0; }
+	inline const char* tagName(AllocTag) { return ""; }
+}
+
+class AllocScope
+{
+public:
+	explicit AllocScope(AllocTag) {}
+};
+
+#endif
+
+#endif
@@ -0,0 +1,277 @@
+/*
+ *	Cascaded shadow maps, see cascaded_shadows.h
+ */
+
+#include "cascaded_shadows.h"
+#include "gl_resources.h"
+#include "job_system.h"
+#include "transform.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+constexpr float CascadedShadows::cacheMargin;
+
+namespace
+{
+	// how far towards the sun a cascade's box reaches beyond its sphere, casters between the sun and the visible part still cast
+	const float casterDistance = 20.0f;
+
+	float snap(float value, float step)
+	{
+		return std::floor(value / step) * step;
+	}
+}
+
+CascadedShadows::~CascadedShadows()
+{
+	destroy();
+}
+
+bool CascadedShadows::create(RenderTargetPool& targets, int maxCasters)
+{
+	destroy();
+	if (maxCasters <= 0)
+	{
+		std::cout << "ERROR::CASCADED_SHADOWS::CREATE\n" << maxCasters << " casters" << std::endl;
+		return false;
+	}
+
+	// one depth texture for every cascade, sampled with hardware comparison and bilinear filtering (4 texel PCF per lookup)
+	RenderTargetDesc desc;
+	desc.width = desc.height = 2 * cascadeResolution;
+	desc.setDepthStencil(GL_DEPTH_COMPONENT24);
+	atlas = targets.create(desc);
+	if (atlas == 0)
+	{
+		std::cout << "ERROR::CASCADED_SHADOWS::ATLAS" << std::endl;
+		return false;
+	}
+	pool = &targets;
+	GLuint depth = pool->depthTexture(atlas);
+	GlResources::setTextureSampling(depth, GL_LINEAR, GL_CLAMP_TO_EDGE);
+	GlResources::setTextureCompare(depth, GL_LEQUAL);
+
+	capacity = maxCasters;
+	lightX.resize(capacity);
+	lightY.resize(capacity);
+	lightZ.resize(capacity);
+	visible.resize((size_t)capacity * cascadeCount);
+	invalidate();
+	return true;
+}
+
+void CascadedShadows::destroy()
+{
+	if (pool != nullptr && atlas != 0)
+	{
+		pool->destroy(atlas);
+	}
+	pool = nullptr;
+	atlas = 0;
+	capacity = 0;
+	lightX.clear();
+	lightY.clear();
+	lightZ.clear();
+	visible.clear();
+}
+
+void CascadedShadows::setSplits(float nearPlane, float shadowDistance, float lambda)
+{
+	// practical split scheme: a blend of the logarithmic split (same ratio of far to near in every cascade, texels per pixel stay
+	// constant) and the even split (the logarithmic one alone makes the first cascade tiny)
+	splits[0] = nearPlane;
+	for (int i = 1; i <= cascadeCount; i++)
+	{
+		float fraction = (float)i / cascadeCount;
+		float logarithmic = nearPlane * std::pow(shadowDistance / nearPlane, fraction);
+		float even = nearPlane + (shadowDistance - nearPlane) * fraction;
+		splits[i] = lambda * logarithmic + (1.0f - lambda) * even;
+	}
+	invalidate();
+}
+
+void CascadedShadows::invalidate()
+{
+	for (Cascade& cascade : cascades)
+	{
+		cascade.valid = false;
+	}
+}
+
+void CascadedShadows::update(const float* view, float fovYRadians, float aspect, const float* direction)
+{
+	// the light's view: at the origin looking along the sun's direction, the orientation never changes with the camera
+	bool lightChanged = direction[0] != sunDirection[0] || direction[1] != sunDirection[1] || direction[2] != sunDirection[2];
+	if (lightChanged)
+	{
+		std::memcpy(sunDirection, direction, sizeof(sunDirection));
+		const float origin[3] = { 0.0f, 0.0f, 0.0f };
+		const float yUp[3] = { 0.0f, 1.0f, 0.0f }, xUp[3] = { 1.0f, 0.0f, 0.0f };
+		Transform::lookAt(lightView, origin, sunDirection, std::fabs(sunDirection[1]) > 0.99f ? xUp : yUp);
+	}
+
+	float cameraToWorld[16];
+	Transform::inverseRigid(cameraToWorld, view);
+	float tanY = std::tan(fovYRadians * 0.5f);
+	float tanX = tanY * aspect;
+	float spread = tanX * tanX + tanY * tanY;	// squared distance of a slice's corner from the view axis per unit of depth
+
+	counters.frames++;
+	drawnCount = 0;
+	for (int i = 0; i < cascadeCount; i++)
+	{
+		Cascade& cascade = cascades[i];
+		cascade.drawn = false;
+		cascade.visibleCount = 0;
+
+		// the smallest sphere around the slice's 8 corners has its centre on the view axis, where the near and far corners are equally
+		// far, or at the far plane's centre when that is nearer. It only depends on the slice, turning the camera doesn't change it.
+		float nearDepth = splits[i], farDepth = splits[i + 1];
+		float centerDepth = std::min(0.5f * (farDepth + nearDepth) * (1.0f + spread), farDepth);
+		float radius = std::sqrt(farDepth * farDepth * spread + (farDepth - centerDepth) * (farDepth - centerDepth));
+		radius = std::ceil(radius * 16.0f) / 16.0f;		// float noise must not change the texel size from frame to frame
+		bool cached = i >= firstCachedCascade;
+		float boxRadius = cached ? radius * (1.0f + cacheMargin) : radius;
+
+		const float viewCenter[3] = { 0.0f, 0.0f, -centerDepth };
+		float center[3];
+		Transform::transformPoint(center, cameraToWorld, viewCenter);
+
+		if (cached && cascade.valid && !lightChanged && cascade.radius == boxRadius)
+		{
+			float dx = center[0] - cascade.center[0], dy = center[1] - cascade.center[1], dz = center[2] - cascade.center[2];
+			float limit = radius * cacheMargin;
+			if (dx * dx + dy * dy + dz * dz <= limit * limit)
+			{
+				continue;	// the slice is still inside the box drawn earlier
+			}
+		}
+
+		// move the box by whole texels only, the texels stay where they are in the world
+		float lightCenter[3];
+		Transform::transformPoint(lightCenter, lightView, center);
+		float texel = 2.0f * boxRadius / cascadeResolution;
+		float x = snap(lightCenter[0], texel), y = snap(lightCenter[1], texel), z = snap(lightCenter[2], texel);
+
+		// light space looks down -z: the box reaches from the far side of the sphere to casterDistance beyond its near side
+		Transform::orthographic(cascade.projection, x - boxRadius, x + boxRadius, y - boxRadius, y + boxRadius,
+			-(z + boxRadius + casterDistance), -(z - boxRadius));
+		Transform::multiply(cascade.viewProjection, cascade.projection, lightView);
+		std::memcpy(cascade.center, center, sizeof(center));
+		cascade.lightCenter[0] = x;
+		cascade.lightCenter[1] = y;
+		cascade.lightMinZ = z - boxRadius;
+		cascade.lightMaxZ = z + boxRadius + casterDistance;
+		cascade.radius = boxRadius;
+		cascade.valid = true;
+		cascade.drawn = true;
+		drawnList[drawnCount++] = i;
+		counters.cascadesDrawn[i]++;
+	}
+}
+
+void CascadedShadows::cull(const ShadowCaster* list, int count)
+{
+	casters = list;
+	casterCount = std::min(count, capacity);
+
+	// the casters' centres in light space once, every cascade tests against them
+	for (int i = 0; i < casterCount; i++)
+	{
+		const float* c = casters[i].center;
+		lightX[i] = lightView[0] * c[0] + lightView[4] * c[1] + lightView[8] * c[2] + lightView[12];
+		lightY[i] = lightView[1] * c[0] + lightView[5] * c[1] + lightView[9] * c[2] + lightView[13];
+		lightZ[i] = lightView[2] * c[0] + lightView[6] * c[1] + lightView[10] * c[2] + lightView[14];
+	}
+
+	JobSystem::parallelFor(drawnCount, cullCascade, this);
+	for (int i = 0; i < drawnCount; i++)
+	{
+		counters.castersDrawn += cascades[drawnList[i]].visibleCount;
+	}
+}
+
+// the casters whose sphere overlaps the cascade's box, every job writes only its cascade's list
+void CascadedShadows::cullCascade(int index, void* user)
+{
+	CascadedShadows* shadows = (CascadedShadows*)user;
+	int cascadeIndex = shadows->drawnList[index];
+	Cascade& cascade = shadows->cascades[cascadeIndex];
+	int* list = &shadows->visible[(size_t)cascadeIndex * shadows->capacity];
+
+	int count = 0;
+	for (int i = 0; i < shadows->casterCount; i++)
+	{
+		float reach = cascade.radius + shadows->casters[i].radius;
+		float z = shadows->lightZ[i];
+		float radius = shadows->casters[i].radius;
+		if (std::fabs(shadows->lightX[i] - cascade.lightCenter[0]) <= reach && std::fabs(shadows->lightY[i] - cascade.lightCenter[1]) <= reach &&
+			z + radius >= cascade.lightMinZ && z - radius <= cascade.lightMaxZ)
+		{
+			list[count++] = i;
+		}
+	}
+	cascade.visibleCount = count;
+}
+
+const int* CascadedShadows::visibleCasterIndices(int index) const
+{
+	return &visible[(size_t)index * capacity];
+}
+
+void CascadedShadows::fillView(int index, PerViewBlock* block) const
+{
+	const Cascade& cascade = cascades[index];
+	std::memcpy(block->view, lightView, sizeof(block->view));
+	std::memcpy(block->projection, cascade.projection, sizeof(block->projection));
+	std::memcpy(block->viewProjection, cascade.viewProjection, sizeof(block->viewProjection));
+}
+
+void CascadedShadows::beginCascade(int index, PipelineCache& pipelines) const
+{
+	GLint x = (index & 1) * cascadeResolution, y = (index >> 1) * cascadeResolution;
+	glViewport(x, y, cascadeResolution, cascadeResolution);
+	glEnable(GL_SCISSOR_TEST);	// the clear must stay inside the square, the other cascades may be cached
+	glScissor(x, y, cascadeResolution, cascadeResolution);
+
+	// glClear respects the depth mask, the pipeline cache opens it without reading it back, the first shadow pipeline bound closes
+	// what it doesn't write
+	pipelines.openWriteMasks();
+	glClear(GL_DEPTH_BUFFER_BIT);
+}
+
+void CascadedShadows::endCascades() const
+{
+	glDisable(GL_SCISSOR_TEST);
+}
+
+void CascadedShadows::fillBlock(ShadowBlock* block, const float* view) const
+{
+	float cameraToWorld[16];
+	Transform::inverseRigid(cameraToWorld, view);
+	for (int i = 0; i < cascadeCount; i++)
+	{
+		// clip space -1..1 to the cascade's square of the atlas (x and y) and to depth 0..1 (z)
+		float atlasBias[16];
+		Transform::identity(atlasBias);
+		atlasBias[0] = atlasBias[5] = 0.25f;
+		atlasBias[10] = 0.5f;
+		atlasBias[12] = 0.25f + 0.5f * (i & 1);
+		atlasBias[13] = 0.25f + 0.5f * (i >> 1);
+		atlasBias[14] = 0.5f;
+
+		float* matrix = block->cascadeMatrices[i];
+		Transform::multiply(matrix, cascades[i].viewProjection, cameraToWorld);
+		Transform::multiply(matrix, atlasBias, matrix);
+		block->cascadeSplits[i] = splits[i + 1];
+		block->cascadeTexelSizes[i] = 2.0f * cascades[i].radius / cascadeResolution;
+	}
+}
+
+GLuint CascadedShadows::texture() const
+{
+	return pool != nullptr ? pool->depthTexture(atlas) : 0;
+}
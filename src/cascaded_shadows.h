@@ -0,0 +1,134 @@
+#ifndef CASCADED_SHADOWS_H
+#define CASCADED_SHADOWS_H
+
+/*
+ * NOTES:
+ * Cascaded shadow maps for the sun: the view frustum split by depth, each part (cascade) gets its own shadow map.
+ *
+ * One shadow map stretched over the whole view frustum gives the nearby ground a handful of texels per metre and the horizon far more
+ * than it can show. Cascades spend the texels where the camera looks: cascade 0 covers the first few metres, each next one a longer
+ * stretch at a coarser scale, and the fragment shader picks the cascade from its view depth. The splits mix a logarithmic and an even
+ * spacing (the "practical" scheme, lambda 1 = logarithmic) up to shadowDistance, beyond it nothing is shadowed.
+ *
+ * Shimmering: a shadow map that moves and rotates with the camera samples the scene at different places every frame, the shadow edges
+ * crawl. Two things keep every texel fixed in the world:
+ *	*each cascade is fitted to the bounding sphere of its frustum slice, not the slice's box, the size never changes when the camera turns
+ *	*the light's view has a fixed orientation and the sphere's centre is snapped to whole texels in light space, so moving the camera
+ *	 shifts the map by whole texels only
+ *
+ * Caching: the far cascades cover a lot of ground and hardly change from frame to frame. From firstCachedCascade on a cascade is fitted
+ * with cacheMargin extra radius and kept until the camera moved far enough for its slice to leave the margin, the light turned or
+ * invalidate() says the casters changed. On a steady camera most frames draw only the near cascades.
+ *
+ * All cascades live in one depth texture, a 2 x 2 atlas of cascadeResolution squares (the render target pool makes 2D targets, no
+ * texture arrays): each cascade is drawn with the viewport and scissor on its square, the shader clamps its filter taps inside it. The
+ * texture compares in hardware (GL_TEXTURE_COMPARE_MODE), a sampler2DShadow lookup returns the filtered result of 4 comparisons.
+ *
+ * Every frame:
+ *	shadows.update(view, fovY, aspect, sunDirection);	// fits the cascades, decides which are drawn
+ *	shadows.cull(casters, count);						// per drawn cascade, the casters inside its box (on the JobSystem)
+ *	... per drawn cascade: fillView(), beginCascade(), draw the visibleCasters() depth only ...
+ *	shadows.fillBlock(shadowBlock, view);				// the Shadows uniform block for the lit passes
+ * update() and cull() work in arrays sized by create(), nothing is allocated per frame.
+ */
+
+#include "gl_api.h"
+#include "pipeline_state.h"
+#include "render_target.h"
+#include "uniform_buffer.h"
+
+#include <vector>
+
+// a shadow caster's bounding sphere in world space
+struct ShadowCaster
+{
+	float center[3];
+	float radius;
+};
+
+// texture unit of the shadow atlas, next to the G-buffer's units
+const GLuint shadowAtlasUnit = 3;
+
+class CascadedShadows
+{
+public:
+	static const int cascadeCount = 4;
+	static const int cascadeResolution = 1024;	// texels per side of each cascade
+	static const int firstCachedCascade = 2;	// this one and the ones after it are cached
+	static constexpr float cacheMargin = 0.25f;	// extra radius of a cached cascade, the camera moves this far before it is redrawn
+
+	CascadedShadows() = default;
+	~CascadedShadows();
+
+	CascadedShadows(const CascadedShadows&) = delete;
+	CascadedShadows& operator=(const CascadedShadows&) = delete;
+
+	// the atlas from the pool, room for maxCasters casters per cascade
+	bool create(RenderTargetPool& pool, int maxCasters);
+	void destroy();
+
+	// cascade splits between nearPlane and shadowDistance, lambda 0 spaces them evenly and 1 logarithmically
+	void setSplits(float nearPlane, float shadowDistance, float lambda = 0.8f);
+	void invalidate();	// the casters changed, the cached cascades are drawn again
+	// fits the cascades to the camera (view matrix, column major) and decides which are drawn, sunDirection points from the sun
+	void update(const float* view, float fovYRadians, float aspect, const float* sunDirection);
+	void cull(const ShadowCaster* casters, int count);	// the casters of every cascade drawn this frame, in parallel
+
+	bool drawn(int cascade) const { return cascades[cascade].drawn; }
+	int visibleCasters(int cascade) const { return cascades[cascade].visibleCount; }
+	const int* visibleCasterIndices(int cascade) const;	// visibleCasters() indices into the casters given to cull()
+	float casterDepth(int caster) const { return -lightZ[caster]; }	// distance from the light, for front to back sorting
+
+	void fillView(int cascade, PerViewBlock* block) const;		// the cascade's light view and projection, for its depth pass
+	// viewport and scissor on the cascade's square, clears its depth (the atlas must be bound, the cache opens the depth mask for it)
+	void beginCascade(int cascade, PipelineCache& pipelines) const;
+	void endCascades() const;				// scissor test off again
+	void fillBlock(ShadowBlock* block, const float* view) const;	// the Shadows uniform block, matrices from the camera's view space
+
+	RenderTargetHandle target() const { return atlas; }
+	GLuint texture() const;
+
+	struct Stats
+	{
+		int frames = 0;
+		int cascadesDrawn[cascadeCount] = {};	// frames each cascade was drawn in
+		int castersDrawn = 0;					// summed over the cascades and frames
+	};
+	const Stats& stats() const { return counters; }
+
+private:
+	struct Cascade
+	{
+		float viewProjection[16];	// light projection * light view
+		float projection[16];
+		float center[3];			// world space centre the cascade was last drawn around
+		float lightCenter[2];		// snapped centre in light space x and y
+		float lightMinZ, lightMaxZ;	// light space z of the box's far and near side
+		float radius;				// half the box's size
+		bool valid;					// drawn at least once since invalidate()
+		bool drawn;					// this frame
+		int visibleCount;
+	};
+
+	static void cullCascade(int index, void* user);
+
+	RenderTargetPool* pool = nullptr;
+	RenderTargetHandle atlas = 0;
+	int capacity = 0;
+	float splits[cascadeCount + 1] = {};	// view depths, splits[0] is the near plane
+	float lightView[16] = {};
+	float sunDirection[3] = {};
+	Cascade cascades[cascadeCount] = {};
+	int drawnList[cascadeCount] = {};
+	int drawnCount = 0;
+
+	// the frame's casters in light space, written by cull() before the jobs run
+	const ShadowCaster* casters = nullptr;
+	int casterCount = 0;
+	std::vector<float> lightX, lightY, lightZ;
+	std::vector<int> visible;	// [cascade * capacity + n]
+
+	Stats counters;
+};
+
+#endif
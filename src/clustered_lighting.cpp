@@ -0,0 +1,410 @@
+/*
+ *	Clustered forward lighting, see clustered_lighting.h
+ */
+
+#include "clustered_lighting.h"
+#include "gl_resources.h"
+#include "gpu_memory.h"
+#include "job_system.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+// SSE2 is part of x64, 32 bit MSVC builds have it with /arch:SSE2 (the default since VS 2012)
+#if defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__SSE2__)
+#define CLUSTERED_LIGHTING_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+	// the SoA arrays of the scratch are rounded up to a multiple of 4 so SIMD loads never run past a light
+	int padded(int count)
+	{
+		return (count + 3) & ~3;
+	}
+}
+
+ClusteredLights::~ClusteredLights()
+{
+	destroy();
+}
+
+bool ClusteredLights::create(int maxLights)
+{
+	destroy();
+	if (maxLights <= 0 || maxLights > 65535)	// light numbers are 16 bit in the index list
+	{
+		std::cout << "ERROR::CLUSTERED_LIGHTING::CREATE\n" << maxLights << " lights, 1 to 65535 are supported" << std::endl;
+		return false;
+	}
+
+	capacity = maxLights;
+	lightX.resize(capacity);
+	lightY.resize(capacity);
+	lightZ.resize(capacity);
+	lightRadius.resize(capacity);
+	lightData.resize((size_t)capacity * 8);
+	sliceLights.resize((size_t)depthSlices * capacity);
+	scratch.resize((size_t)depthSlices * 7 * padded(capacity));
+	droppedPerSlice.resize(depthSlices);
+
+	lightBufferSize = (GLsizeiptr)capacity * 8 * sizeof(float);
+	lightBuffer = GpuMemory::createBuffer(GpuMemoryCategory::Other, GL_TEXTURE_BUFFER, lightBufferSize, NULL, GL_STREAM_DRAW);
+	lightTexture = GlResources::createTextureBuffer(GL_RGBA32F, lightBuffer);
+	return true;
+}
+
+void ClusteredLights::destroy()
+{
+	GLuint textures[3] = { clusterTexture, indexTexture, lightTexture };
+	for (GLuint texture : textures)
+	{
+		if (texture != 0)
+		{
+			glDeleteTextures(1, &texture);
+		}
+	}
+	GLuint buffers[3] = { clusterBuffer, indexBuffer, lightBuffer };
+	for (GLuint buffer : buffers)
+	{
+		if (buffer != 0)
+		{
+			GpuMemory::deleteBuffer(buffer);
+		}
+	}
+	clusterTexture = indexTexture = lightTexture = 0;
+	clusterBuffer = indexBuffer = lightBuffer = 0;
+	clusterBufferSize = indexBufferSize = lightBufferSize = 0;
+	capacity = 0;
+	gridX = gridY = 0;
+	counters = Stats();
+}
+
+void ClusteredLights::setView(int viewWidth, int viewHeight, float fovYRadians, float nearDistance, float farDistance)
+{
+	width = std::max(viewWidth, 1);
+	height = std::max(viewHeight, 1);
+	nearPlane = nearDistance;
+	farPlane = farDistance;
+	gridX = (width + tilePixels - 1) / tilePixels;
+	gridY = (height + tilePixels - 1) / tilePixels;
+
+	// slice = floor(log(depth / near) / log(far / near) * slices), as a multiply and add on log(depth) so the shader has it cheap
+	sliceScale = depthSlices / std::log(farPlane / nearPlane);
+	sliceBias = -std::log(nearPlane) * sliceScale;
+
+	float tanY = std::tan(fovYRadians * 0.5f);
+	float tanX = tanY * width / height;
+
+	columnMin.resize((size_t)depthSlices * gridX);
+	columnMax.resize((size_t)depthSlices * gridX);
+	rowMin.resize((size_t)depthSlices * gridY);
+	rowMax.resize((size_t)depthSlices * gridY);
+
+	for (int slice = 0; slice < depthSlices; slice++)
+	{
+		float d0 = nearPlane * std::pow(farPlane / nearPlane, (float)slice / depthSlices);
+		float d1 = nearPlane * std::pow(farPlane / nearPlane, (float)(slice + 1) / depthSlices);
+		sliceNear[slice] = d0;
+		sliceFar[slice] = d1;
+
+		// a tile's side planes go through the eye, its box over d0..d1 is spanned by the corners at both depths
+		for (int x = 0; x < gridX; x++)
+		{
+			float ndc0 = (float)(x * tilePixels) / width * 2.0f - 1.0f;
+			float ndc1 = (float)std::min((x + 1) * tilePixels, width) / width * 2.0f - 1.0f;
+			columnMin[slice * gridX + x] = std::min(ndc0 * d0, ndc0 * d1) * tanX;
+			columnMax[slice * gridX + x] = std::max(ndc1 * d0, ndc1 * d1) * tanX;
+		}
+		for (int y = 0; y < gridY; y++)
+		{
+			float ndc0 = (float)(y * tilePixels) / height * 2.0f - 1.0f;
+			float ndc1 = (float)std::min((y + 1) * tilePixels, height) / height * 2.0f - 1.0f;
+			rowMin[slice * gridY + y] = std::min(ndc0 * d0, ndc0 * d1) * tanY;
+			rowMax[slice * gridY + y] = std::max(ndc1 * d0, ndc1 * d1) * tanY;
+		}
+	}
+
+	int clusters = gridX * gridY * depthSlices;
+	clusterLights.resize((size_t)clusters * maxLightsPerCluster);
+	clusterCount.resize(clusters);
+	clusterData.resize((size_t)clusters * 2);
+	indexData.resize((size_t)clusters * maxLightsPerCluster);
+
+	// the texture buffers grow with the grid and are never shrunk
+	GLsizeiptr clusterBytes = (GLsizeiptr)clusterData.size() * sizeof(unsigned int);
+	if (clusterBytes > clusterBufferSize)
+	{
+		if (clusterBuffer == 0)
+		{
+			clusterBuffer = GpuMemory::createBuffer(GpuMemoryCategory::Other, GL_TEXTURE_BUFFER, clusterBytes, NULL, GL_STREAM_DRAW);
+			clusterTexture = GlResources::createTextureBuffer(GL_RG32UI, clusterBuffer);
+		}
+		else
+		{
+			GpuMemory::resizeBuffer(clusterBuffer, GL_TEXTURE_BUFFER, clusterBytes, NULL, GL_STREAM_DRAW);
+		}
+		clusterBufferSize = clusterBytes;
+	}
+	GLsizeiptr indexBytes = (GLsizeiptr)indexData.size() * sizeof(unsigned short);
+	if (indexBytes > indexBufferSize)
+	{
+		if (indexBuffer == 0)
+		{
+			indexBuffer = GpuMemory::createBuffer(GpuMemoryCategory::Other, GL_TEXTURE_BUFFER, indexBytes, NULL, GL_STREAM_DRAW);
+			indexTexture = GlResources::createTextureBuffer(GL_R16UI, indexBuffer);
+		}
+		else
+		{
+			GpuMemory::resizeBuffer(indexBuffer, GL_TEXTURE_BUFFER, indexBytes, NULL, GL_STREAM_DRAW);
+		}
+		indexBufferSize = indexBytes;
+	}
+}
+
+int ClusteredLights::sliceOf(float depth) const
+{
+	int slice = (int)std::floor(std::log(depth) * sliceScale + sliceBias);
+	return std::min(std::max(slice, 0), depthSlices - 1);
+}
+
+void ClusteredLights::assign(const PointLight* lights, int count, const float* view)
+{
+	counters = Stats();
+	counters.lights = count;
+	counters.clusters = gridX * gridY * depthSlices;
+	if (capacity == 0 || gridX == 0)
+	{
+		return;
+	}
+
+	// 1. to view space, drop what is outside near..far, bin into the slices the sphere spans
+	std::fill(sliceLightCount, sliceLightCount + depthSlices, 0);
+	int visible = 0;
+	for (int i = 0; i < count && visible < capacity; i++)
+	{
+		const PointLight& light = lights[i];
+		const float* p = light.position;
+		float x = view[0] * p[0] + view[4] * p[1] + view[8] * p[2] + view[12];
+		float y = view[1] * p[0] + view[5] * p[1] + view[9] * p[2] + view[13];
+		float z = view[2] * p[0] + view[6] * p[1] + view[10] * p[2] + view[14];
+		float depth = -z;
+		if (depth + light.radius < nearPlane || depth - light.radius > farPlane)
+		{
+			continue;
+		}
+
+		lightX[visible] = x;
+		lightY[visible] = y;
+		lightZ[visible] = z;
+		lightRadius[visible] = light.radius;
+		float* data = &lightData[(size_t)visible * 8];
+		data[0] = x;
+		data[1] = y;
+		data[2] = z;
+		data[3] = light.radius;
+		data[4] = light.color[0] * light.intensity;
+		data[5] = light.color[1] * light.intensity;
+		data[6] = light.color[2] * light.intensity;
+		data[7] = 0.0f;
+
+		int first = sliceOf(std::max(depth - light.radius, nearPlane));
+		int last = sliceOf(std::min(depth + light.radius, farPlane));
+		for (int slice = first; slice <= last; slice++)
+		{
+			sliceLights[(size_t)slice * capacity + sliceLightCount[slice]++] = (unsigned short)visible;
+		}
+		visible++;
+	}
+	counters.visibleLights = visible;
+
+	// 2. the clusters of every slice
+	JobSystem::parallelFor(depthSlices, assignSlice, this);
+
+	// 3. pack the lists, offset and count per cluster
+	int clusters = counters.clusters;
+	int offset = 0;
+	for (int cluster = 0; cluster < clusters; cluster++)
+	{
+		int n = clusterCount[cluster];
+		clusterData[cluster * 2] = (unsigned int)offset;
+		clusterData[cluster * 2 + 1] = (unsigned int)n;
+		if (n > 0)
+		{
+			std::copy_n(&clusterLights[(size_t)cluster * maxLightsPerCluster], n, &indexData[offset]);
+			counters.occupiedClusters++;
+			counters.mostLightsInCluster = std::max(counters.mostLightsInCluster, n);
+		}
+		offset += n;
+	}
+	counters.lightIndices = offset;
+	for (int slice = 0; slice < depthSlices; slice++)
+	{
+		counters.droppedLights += droppedPerSlice[slice];
+	}
+}
+
+void ClusteredLights::assignSlice(int slice, void* user)
+{
+	ClusteredLights& self = *static_cast<ClusteredLights*>(user);
+	const int stride = padded(self.capacity);
+	float* base = &self.scratch[(size_t)slice * 7 * stride];
+	float* sliceX = base;				// the slice's candidates
+	float* sliceY = base + stride;
+	float* sliceZ = base + stride * 2;
+	float* sliceR = base + stride * 3;
+	float* rowX = base + stride * 4;	// the candidates of one tile row, light numbers as floats in rowN (exact below 2^24)
+	float* rowR = base + stride * 5;
+	float* rowN = base + stride * 6;
+
+	const unsigned short* candidates = &self.sliceLights[(size_t)slice * self.capacity];
+	int candidateCount = self.sliceLightCount[slice];
+	for (int i = 0; i < candidateCount; i++)
+	{
+		int n = candidates[i];
+		sliceX[i] = self.lightX[n];
+		sliceY[i] = self.lightY[n];
+		sliceZ[i] = self.lightZ[n];
+		sliceR[i] = self.lightRadius[n];
+	}
+
+	// the slice's depth range, as view space z (negative, maxZ is the nearer one)
+	const float minZ = -self.sliceFar[slice];
+	const float maxZ = -self.sliceNear[slice];
+	const float* columnMin = &self.columnMin[(size_t)slice * self.gridX];
+	const float* columnMax = &self.columnMax[(size_t)slice * self.gridX];
+	int dropped = 0;
+
+	for (int y = 0; y < self.gridY; y++)
+	{
+		// keep the candidates that reach this row, with the y and z part of their distance to it folded into the radius:
+		// the sphere reaches a box when dx^2 + dy^2 + dz^2 <= r^2, dy and dz are the same for every box of the row
+		float minY = self.rowMin[(size_t)slice * self.gridY + y];
+		float maxY = self.rowMax[(size_t)slice * self.gridY + y];
+		int rowCount = 0;
+		for (int i = 0; i < candidateCount; i++)
+		{
+			float dy = std::max(std::max(minY - sliceY[i], sliceY[i] - maxY), 0.0f);
+			float dz = std::max(std::max(minZ - sliceZ[i], sliceZ[i] - maxZ), 0.0f);
+			float remaining = sliceR[i] * sliceR[i] - dy * dy - dz * dz;
+			if (remaining >= 0.0f)
+			{
+				rowX[rowCount] = sliceX[i];
+				rowR[rowCount] = remaining;		// what is left of r^2 for dx^2
+				rowN[rowCount] = (float)candidates[i];
+				rowCount++;
+			}
+		}
+		if (rowCount == 0)
+		{
+			continue;
+		}
+		// pad to a multiple of 4 with lights that reach nothing
+		for (int i = rowCount; i < padded(rowCount); i++)
+		{
+			rowX[i] = 0.0f;
+			rowR[i] = -1.0f;
+			rowN[i] = 0.0f;
+		}
+
+		for (int x = 0; x < self.gridX; x++)
+		{
+			int cluster = (slice * self.gridY + y) * self.gridX + x;
+			unsigned short* list = &self.clusterLights[(size_t)cluster * maxLightsPerCluster];
+			int n = 0;
+#ifdef CLUSTERED_LIGHTING_SSE2
+			// four lights per step: dx = max(minX - x, x - maxX, 0), hit when dx^2 <= what is left of r^2
+			const __m128 boxMin = _mm_set1_ps(columnMin[x]);
+			const __m128 boxMax = _mm_set1_ps(columnMax[x]);
+			const __m128 zero = _mm_setzero_ps();
+			for (int i = 0; i < rowCount; i += 4)
+			{
+				__m128 lx = _mm_loadu_ps(rowX + i);
+				__m128 dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(boxMin, lx), _mm_sub_ps(lx, boxMax)), zero);
+				int hits = _mm_movemask_ps(_mm_cmple_ps(_mm_mul_ps(dx, dx), _mm_loadu_ps(rowR + i)));
+				while (hits != 0)
+				{
+					int lane = 0;
+					while ((hits & (1 << lane)) == 0)
+					{
+						lane++;
+					}
+					hits &= ~(1 << lane);
+					if (n < maxLightsPerCluster)
+					{
+						list[n++] = (unsigned short)rowN[i + lane];
+					}
+					else
+					{
+						dropped++;
+					}
+				}
+			}
+#else
+			for (int i = 0; i < rowCount; i++)
+			{
+				float dx = std::max(std::max(columnMin[x] - rowX[i], rowX[i] - columnMax[x]), 0.0f);
+				if (dx * dx <= rowR[i])
+				{
+					if (n < maxLightsPerCluster)
+					{
+						list[n++] = (unsigned short)rowN[i];
+					}
+					else
+					{
+						dropped++;
+					}
+				}
+			}
+#endif
+			self.clusterCount[cluster] = (unsigned short)n;
+		}
+	}
+	self.droppedPerSlice[slice] = dropped;
+}
+
+void ClusteredLights::upload()
+{
+	if (capacity == 0 || gridX == 0)
+	{
+		return;
+	}
+
+	// orphan and refill: the driver hands out fresh storage instead of waiting for the frame still reading the old contents
+	GLsizeiptr clusterBytes = (GLsizeiptr)counters.clusters * 2 * sizeof(unsigned int);
+	GlResources::bufferData(clusterBuffer, GL_TEXTURE_BUFFER, clusterBufferSize, NULL, GL_STREAM_DRAW);
+	GlResources::bufferSubData(clusterBuffer, GL_TEXTURE_BUFFER, 0, clusterBytes, clusterData.data());
+
+	GlResources::bufferData(indexBuffer, GL_TEXTURE_BUFFER, indexBufferSize, NULL, GL_STREAM_DRAW);
+	if (counters.lightIndices > 0)
+	{
+		GlResources::bufferSubData(indexBuffer, GL_TEXTURE_BUFFER, 0, (GLsizeiptr)counters.lightIndices * sizeof(unsigned short), indexData.data());
+	}
+
+	GlResources::bufferData(lightBuffer, GL_TEXTURE_BUFFER, lightBufferSize, NULL, GL_STREAM_DRAW);
+	if (counters.visibleLights > 0)
+	{
+		GlResources::bufferSubData(lightBuffer, GL_TEXTURE_BUFFER, 0, (GLsizeiptr)counters.visibleLights * 8 * sizeof(float), lightData.data());
+	}
+}
+
+void ClusteredLights::bind() const
+{
+	GlResources::bindTexture((GLuint)LightingTextureUnit::Clusters, GL_TEXTURE_BUFFER, clusterTexture);
+	GlResources::bindTexture((GLuint)LightingTextureUnit::LightIndices, GL_TEXTURE_BUFFER, indexTexture);
+	GlResources::bindTexture((GLuint)LightingTextureUnit::Lights, GL_TEXTURE_BUFFER, lightTexture);
+}
+
+void ClusteredLights::fillBlock(LightingBlock* block) const
+{
+	block->clusterGrid[0] = (unsigned int)gridX;
+	block->clusterGrid[1] = (unsigned int)gridY;
+	block->clusterGrid[2] = (unsigned int)depthSlices;
+	block->clusterGrid[3] = (unsigned int)counters.visibleLights;
+	block->clusterParams[0] = (float)tilePixels;
+	block->clusterParams[1] = (float)tilePixels;
+	block->clusterParams[2] = sliceScale;
+	block->clusterParams[3] = sliceBias;
+}
@@ -0,0 +1,126 @@
+#ifndef CLUSTERED_LIGHTING_H
+#define CLUSTERED_LIGHTING_H
+
+/*
+ * NOTES:
+ * Clustered forward lighting: thousands of point lights, each fragment only looks at the few that can reach it.
+ *
+ * Forward shading with a plain loop over every light costs every fragment every light, 1000 lights are 1000 iterations per pixel even
+ * though a light with a radius of half a metre touches a tiny part of the screen. Clustering splits the view frustum into a 3D grid:
+ *	*x and y: screen tiles of tilePixels x tilePixels pixels
+ *	*z: depthSlices slices between the near and far plane, spaced exponentially (slice k starts at near * (far / near)^(k / slices)),
+ *	 so slices are as deep as they are wide on screen instead of the distant ones being huge
+ * Each cluster gets the list of lights whose sphere overlaps its box. The fragment shader finds its cluster from gl_FragCoord and its
+ * view depth and loops over that list only, the cost follows the lights nearby instead of the lights in the scene.
+ *
+ * The lists are built on the CPU every frame by assign():
+ *	1. lights are moved to view space, the ones outside near..far dropped, and each is binned into the depth slices it spans
+ *	2. the slices run in parallel on the JobSystem. Within a slice the candidates are filtered per tile row, then tested against every
+ *	   cluster box of the row four at a time with SSE (sphere to box distance, no branches). Every slice writes only its own clusters,
+ *	   so the jobs share nothing.
+ *	3. the per cluster lists are packed into one index list (offset and count per cluster)
+ * Everything is in arrays sized by create() and setView(), assign() doesn't allocate.
+ *
+ * GL 3.3 has no shader storage buffers, the data goes to the shaders through texture buffers (glTexBuffer, GL 3.1) read with
+ * texelFetch: the clusters (offset, count as GL_RG32UI), the light indices (GL_R16UI) and the lights (two GL_RGBA32F texels each,
+ * view space position and radius, colour times intensity). The buffers are orphaned and refilled every frame. The grid and slice
+ * constants go into the Lighting uniform block (see shaders/common/clustered.glsl). GL 3.3 only promises 65536 texels per texture buffer,
+ * desktop drivers allow 2^27 and more, enough for the index list of a 4K grid.
+ *
+ * A cluster holds at most maxLightsPerCluster lights, more are dropped (and counted in the stats) rather than growing the lists.
+ */
+
+#include "gl_api.h"
+#include "uniform_buffer.h"
+
+#include <vector>
+
+// a point light in world space, its influence falls to zero at radius
+struct PointLight
+{
+	float position[3];
+	float radius;
+	float color[3];
+	float intensity;
+};
+
+// texture units of the lighting texture buffers, high enough to stay out of the way of material textures
+enum class LightingTextureUnit : GLuint
+{
+	Clusters = 8,
+	LightIndices = 9,
+	Lights = 10
+};
+
+class ClusteredLights
+{
+public:
+	static const int tilePixels = 64;
+	static const int depthSlices = 24;
+	static const int maxLightsPerCluster = 128;
+
+	ClusteredLights() = default;
+	~ClusteredLights();
+
+	ClusteredLights(const ClusteredLights&) = delete;
+	ClusteredLights& operator=(const ClusteredLights&) = delete;
+
+	bool create(int maxLights);
+	void destroy();
+
+	// the grid for a perspective projection, call again when the viewport or projection changes (allocates)
+	void setView(int width, int height, float fovYRadians, float nearPlane, float farPlane);
+	void assign(const PointLight* lights, int count, const float* view);	// view matrix, column major
+	void upload();								// the lists and lights into the texture buffers
+	void bind() const;							// the texture buffers to their LightingTextureUnit
+	void fillBlock(LightingBlock* block) const;	// the grid constants of the Lighting uniform block
+
+	struct Stats
+	{
+		int lights = 0;				// passed to assign()
+		int visibleLights = 0;		// inside near..far, uploaded
+		int clusters = 0;
+		int occupiedClusters = 0;	// clusters with at least one light
+		int lightIndices = 0;		// entries of all cluster lists
+		int mostLightsInCluster = 0;
+		int droppedLights = 0;		// did not fit maxLightsPerCluster
+	};
+	const Stats& stats() const { return counters; }
+
+private:
+	static void assignSlice(int slice, void* user);
+
+	int sliceOf(float depth) const;
+
+	int capacity = 0;					// lights
+	int gridX = 0, gridY = 0;
+	int width = 0, height = 0;
+	float nearPlane = 0.1f, farPlane = 100.0f;
+	float sliceScale = 0.0f, sliceBias = 0.0f;	// slice = log(depth) * sliceScale + sliceBias
+
+	// cluster bounds in view space: columns and rows per slice (x and y only depend on the tile and the slice's depths)
+	std::vector<float> columnMin, columnMax;	// [slice * gridX + x]
+	std::vector<float> rowMin, rowMax;			// [slice * gridY + y]
+	float sliceNear[depthSlices] = {}, sliceFar[depthSlices] = {};	// view depths (positive)
+
+	// this frame's visible lights in view space (SoA for SIMD) and as uploaded
+	std::vector<float> lightX, lightY, lightZ, lightRadius;
+	std::vector<float> lightData;				// 8 floats per light
+	std::vector<unsigned short> sliceLights;	// [slice * capacity + n], visible light numbers binned per slice
+	int sliceLightCount[depthSlices] = {};
+	std::vector<float> scratch;					// per slice: 7 SoA arrays of capacity (+ padding), for the candidates and a row's candidates
+
+	std::vector<unsigned short> clusterLights;	// [cluster * maxLightsPerCluster + n]
+	std::vector<unsigned short> clusterCount;
+	std::vector<unsigned int> clusterData;		// uploaded: offset, count per cluster
+	std::vector<unsigned short> indexData;		// uploaded: the packed lists
+	std::vector<int> droppedPerSlice;
+
+	GLuint clusterBuffer = 0, indexBuffer = 0, lightBuffer = 0;
+	GLuint clusterTexture = 0, indexTexture = 0, lightTexture = 0;
+	GLsizeiptr clusterBufferSize = 0, indexBufferSize = 0, lightBufferSize = 0;
+
+	Stats counters;
+};
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef GL_API_H
+#define GL_API_H
+
+/*
+ * NOTES:
+ * The one include for OpenGL, use it instead of <glad/glad.h>.
+ *
+ * glad keeps every function pointer (glad_glDrawArrays, ...) in a process wide global, loaded once by gladLoadGLLoader. That is fine for
+ * one context, but two contexts can come from different drivers (a software renderer next to the GPU) or support different versions, and
+ * their entry points are not interchangeable. Reloading the globals on every context switch is slow and breaks as soon as two threads
+ * render to different contexts at the same time.
+ *
+ * Defining GLAD_MULTI_CONTEXT (project wide, it changes what every gl* call compiles to) switches to per context dispatch tables:
+ *	*every context gets a GladGLContext, filled by gladLoadGLContext() while that context is current
+ *	*gladMakeContextCurrent() sets a thread local pointer to the table, next to glfwMakeContextCurrent on the same thread
+ *	*glDrawArrays(...) becomes gladCurrentContext->DrawArrays(...), the GLAD_GL_* flags come from the current table too
+ * Each call pays one extra load of a thread local, so the mode is off by default.
+ *
+ *	GladGLContext table;
+ *	glfwMakeContextCurrent(window);
+ *	gladLoadGLContext(&table, (GLADloadproc)glfwGetProcAddress);
+ *	gladMakeContextCurrent(&table);
+ *
+ * With LEARNOPENGL_GL_DEBUG_LAYER every gl* name is redirected to the error checking / tracing wrappers instead, see gl_debug.h.
+ *
+ * glad_mx.h/.c and gl_debug_layer.h/.c are generated from glad.c's function list and must be regenerated with it.
+ */
+
+#include <glad/glad.h>
+
+#include "glad_mx.h"		// empty unless GLAD_MULTI_CONTEXT is defined
+#include "gl_debug_layer.h"	// empty unless LEARNOPENGL_GL_DEBUG_LAYER is defined
+
+#endif
@@ -0,0 +1,758 @@
+/*
+ *	OpenGL call capture, see gl_capture.h
+ */
+
+#include "gl_capture.h"
+#include "gl_capture_layer.h"	// glad.h without the redirections of gl_api.h: everything here calls the driver directly, never the wrappers
+#include "gl_formats.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+
+// used by the generated wrappers (C code)
+extern "C"
+{
+	void gl_capture_record(int function, const GLcaptureArg* args, const GLcaptureArg* ret);
+	void gl_capture_before(int function, const GLcaptureArg* args);
+}
+
+namespace
+{
+	const unsigned char traceVersion = 1;
+	const size_t bufferCapacity = 4 << 20;	// written to the file when full and at the end of every frame
+
+	enum Record
+	{
+		FrameEnd = 0,
+		MappedMemory = 1,
+		FirstCall = 2	// function index + FirstCall
+	};
+
+	// how a pointer argument is stored
+	enum PointerTag
+	{
+		Null = 0,
+		Offset = 1,		// the value, an offset into a bound buffer
+		Payload = 2,	// size and the memory it points to
+		Output = 3		// client memory written by the call, the replay passes a scratch buffer
+	};
+	const long long noPayload = -1;		// size unknown, stored as Offset
+	const long long dropPointer = -2;	// stored as Null, the replay doesn't need it
+
+	std::mutex captureMutex;	// calls may come from several threads (sharing the context)
+	std::ofstream file;
+	unsigned char* buffer = nullptr;	// allocated once, capturing must not allocate inside frames (see alloc_tracker.h)
+	size_t used = 0;
+	bool active = false;
+	GlCapture::Stats counters = {};
+
+	// mapped buffers, their contents are recorded when flushed or unmapped
+	struct Mapping
+	{
+		bool named;		// key is a buffer name (glMapNamedBuffer*), otherwise the target
+		GLuint key;
+		const unsigned char* memory;
+		long long length;
+		bool write;
+		bool explicitFlush;	// GL_MAP_FLUSH_EXPLICIT_BIT, only the flushed ranges are recorded
+	};
+	const int maxMappings = 16;
+	Mapping mappings[maxMappings];
+	int mappingCount = 0;
+
+	// uniform and vertex attribute arrays (glUniform4fv, glProgramUniformMatrix3x4fv, glVertexAttrib4Nubv, ...), sized from the name
+	struct VectorRule
+	{
+		signed char countArg;		// argument holding the number of vectors, -1 for one
+		unsigned char components;	// 0: not a vector function
+		unsigned char componentSize;
+	};
+	VectorRule vectorRules[GL_CAPTURE_FUNCTION_COUNT];
+
+	void flushBuffer()
+	{
+		if (used > 0)
+		{
+			file.write((const char*)buffer, used);
+			used = 0;
+		}
+	}
+
+	void putBytes(const void* data, size_t size)
+	{
+		if (size > bufferCapacity / 2)
+		{
+			flushBuffer();							// what is buffered comes first, the payload belongs after its command
+			file.write((const char*)data, size);	// large uploads go straight to the file
+		}
+		else
+		{
+			if (used + size > bufferCapacity)
+			{
+				flushBuffer();
+			}
+			std::memcpy(buffer + used, data, size);
+			used += size;
+		}
+		counters.bytes += size;
+	}
+
+	void putByte(unsigned char value)
+	{
+		putBytes(&value, 1);
+	}
+
+	void putVarint(unsigned long long value)
+	{
+		unsigned char bytes[10];
+		int count = 0;
+		do
+		{
+			unsigned char low = value & 0x7F;
+			value >>= 7;
+			bytes[count++] = low | (value != 0 ? 0x80 : 0);
+		} while (value != 0);
+		putBytes(bytes, count);
+	}
+
+	void putSigned(long long value)
+	{
+		putVarint(((unsigned long long)value << 1) ^ (unsigned long long)(value >> 63));	// zigzag: small negative numbers stay short
+	}
+
+	GLint getInteger(GLenum name)
+	{
+		GLint value = 0;
+		(glad_capture_real_glGetIntegerv != NULL ? glad_capture_real_glGetIntegerv : glad_glGetIntegerv)(name, &value);
+		return value;
+	}
+
+	bool startsWith(const char* text, const char* prefix)
+	{
+		return std::strncmp(text, prefix, std::strlen(prefix)) == 0;
+	}
+
+	bool parseVectorRule(const GLcaptureFunction& function, VectorRule* rule)
+	{
+		const char* rest = function.name;
+		bool uniform = true;
+		if (startsWith(rest, "glProgramUniform"))
+		{
+			rest += 16;
+		}
+		else if (startsWith(rest, "glUniform"))
+		{
+			rest += 9;
+		}
+		else if (startsWith(rest, "glVertexAttrib"))
+		{
+			rest += 14;
+			uniform = false;
+			if (*rest == 'I' || *rest == 'L')
+			{
+				rest++;
+			}
+		}
+		else
+		{
+			return false;
+		}
+
+		int components;
+		if (uniform && startsWith(rest, "Matrix") && rest[6] >= '2' && rest[6] <= '4')
+		{
+			int rows = rest[6] - '0', columns = rows;
+			rest += 7;
+			if (rest[0] == 'x')
+			{
+				columns = rest[1] - '0';
+				rest += 2;
+			}
+			components = rows * columns;
+		}
+		else if (*rest >= '1' && *rest <= '4')
+		{
+			components = *rest++ - '0';
+		}
+		else
+		{
+			return false;
+		}
+		if (!uniform && *rest == 'N')
+		{
+			rest++;
+		}
+
+		static const struct { const char* suffix; int size; } types[] = {
+			{ "ui64", 8 }, { "i64", 8 }, { "ub", 1 }, { "us", 2 }, { "ui", 4 }, { "b", 1 }, { "s", 2 }, { "i", 4 }, { "f", 4 }, { "d", 8 } };
+		int size = 0;
+		for (const auto& type : types)
+		{
+			if (startsWith(rest, type.suffix))
+			{
+				size = type.size;
+				rest += std::strlen(type.suffix);
+				break;
+			}
+		}
+		if (size == 0 || *rest != 'v')
+		{
+			return false;	// the scalar versions (glUniform4f) have nothing to capture
+		}
+
+		rule->countArg = -1;
+		if (uniform)
+		{
+			const char* location = std::strchr(function.signature, 'U');
+			if (location == NULL || location[1] != 'i')
+			{
+				return false;
+			}
+			rule->countArg = (signed char)(location - function.signature + 1);	// no two character codes in these signatures
+		}
+		rule->components = (unsigned char)components;
+		rule->componentSize = (unsigned char)size;
+		return true;
+	}
+
+	// bytes read by glTexImage*/glTexSubImage* with the current unpack state, or noPayload when they come from a pixel unpack buffer
+	long long imageBytes(GLenum format, GLenum type, long long width, long long height, long long depth)
+	{
+		if (getInteger(GL_PIXEL_UNPACK_BUFFER_BINDING) != 0)
+		{
+			return noPayload;
+		}
+		if (width <= 0 || height <= 0 || depth <= 0)
+		{
+			return 0;
+		}
+		long long pixel = GlFormats::pixelBytes(format, type);
+		long long alignment = getInteger(GL_UNPACK_ALIGNMENT);
+		long long rowLength = getInteger(GL_UNPACK_ROW_LENGTH);
+		long long imageHeight = getInteger(GL_UNPACK_IMAGE_HEIGHT);
+		long long rowBytes = ((rowLength > 0 ? rowLength : width) * pixel + alignment - 1) / alignment * alignment;
+		long long imageRows = imageHeight > 0 ? imageHeight : height;
+		return rowBytes * (imageRows * (depth - 1) + height - 1) + width * pixel;	// the last row isn't padded
+	}
+
+	long long compressedBytes(long long imageSize)
+	{
+		return getInteger(GL_PIXEL_UNPACK_BUFFER_BINDING) != 0 ? noPayload : imageSize;
+	}
+
+	long long parameterBytes(GLenum name, int componentSize)
+	{
+		return (name == GL_TEXTURE_BORDER_COLOR || name == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1) * componentSize;
+	}
+
+	long long clearValueBytes(GLenum buffer)
+	{
+		return buffer == GL_COLOR ? 16 : 4;
+	}
+
+	// bytes behind input pointer argument index, noPayload when the call reads it from a buffer object (or we don't know)
+	long long payloadSize(int function, int index, const GLcaptureArg* a)
+	{
+		const VectorRule& vector = vectorRules[function];
+		if (vector.components != 0)
+		{
+			return (vector.countArg >= 0 ? a[vector.countArg].i : 1) * vector.components * vector.componentSize;
+		}
+
+		switch (function)
+		{
+		case GL_CAPTURE_glBufferData: case GL_CAPTURE_glNamedBufferData: case GL_CAPTURE_glBufferStorage: case GL_CAPTURE_glNamedBufferStorage:
+			return a[1].i;
+		case GL_CAPTURE_glBufferSubData: case GL_CAPTURE_glNamedBufferSubData:
+			return a[2].i;
+		case GL_CAPTURE_glClearBufferData: case GL_CAPTURE_glClearNamedBufferData: case GL_CAPTURE_glClearTexImage:
+			return GlFormats::pixelBytes((GLenum)a[2].u, (GLenum)a[3].u);
+		case GL_CAPTURE_glClearBufferSubData: case GL_CAPTURE_glClearNamedBufferSubData:
+			return GlFormats::pixelBytes((GLenum)a[4].u, (GLenum)a[5].u);
+		case GL_CAPTURE_glClearTexSubImage:
+			return GlFormats::pixelBytes((GLenum)a[8].u, (GLenum)a[9].u);
+
+		case GL_CAPTURE_glTexImage1D:
+			return imageBytes((GLenum)a[5].u, (GLenum)a[6].u, a[3].i, 1, 1);
+		case GL_CAPTURE_glTexImage2D:
+			return imageBytes((GLenum)a[6].u, (GLenum)a[7].u, a[3].i, a[4].i, 1);
+		case GL_CAPTURE_glTexImage3D:
+			return imageBytes((GLenum)a[7].u, (GLenum)a[8].u, a[3].i, a[4].i, a[5].i);
+		case GL_CAPTURE_glTexSubImage1D: case GL_CAPTURE_glTextureSubImage1D:
+			return imageBytes((GLenum)a[4].u, (GLenum)a[5].u, a[3].i, 1, 1);
+		case GL_CAPTURE_glTexSubImage2D: case GL_CAPTURE_glTextureSubImage2D:
+			return imageBytes((GLenum)a[6].u, (GLenum)a[7].u, a[4].i, a[5].i, 1);
+		case GL_CAPTURE_glTexSubImage3D: case GL_CAPTURE_glTextureSubImage3D:
+			return imageBytes((GLenum)a[8].u, (GLenum)a[9].u, a[5].i, a[6].i, a[7].i);
+		case GL_CAPTURE_glCompressedTexImage1D: case GL_CAPTURE_glCompressedTexImage2D: case GL_CAPTURE_glCompressedTexImage3D:
+		case GL_CAPTURE_glCompressedTexSubImage1D: case GL_CAPTURE_glCompressedTexSubImage2D: case GL_CAPTURE_glCompressedTexSubImage3D:
+		case GL_CAPTURE_glCompressedTextureSubImage1D: case GL_CAPTURE_glCompressedTextureSubImage2D: case GL_CAPTURE_glCompressedTextureSubImage3D:
+			return compressedBytes(a[index - 1].i);	// imageSize comes right before the data
+
+		case GL_CAPTURE_glTexParameterfv: case GL_CAPTURE_glTexParameteriv: case GL_CAPTURE_glTexParameterIiv: case GL_CAPTURE_glTexParameterIuiv:
+		case GL_CAPTURE_glTextureParameterfv: case GL_CAPTURE_glTextureParameteriv: case GL_CAPTURE_glTextureParameterIiv:
+		case GL_CAPTURE_glTextureParameterIuiv: case GL_CAPTURE_glSamplerParameterfv: case GL_CAPTURE_glSamplerParameteriv:
+		case GL_CAPTURE_glSamplerParameterIiv: case GL_CAPTURE_glSamplerParameterIuiv:
+			return parameterBytes((GLenum)a[1].u, 4);
+		case GL_CAPTURE_glPatchParameterfv:
+			return a[0].u == GL_PATCH_DEFAULT_OUTER_LEVEL ? 16 : 8;
+
+		case GL_CAPTURE_glClearBufferfv: case GL_CAPTURE_glClearBufferiv: case GL_CAPTURE_glClearBufferuiv:
+			return clearValueBytes((GLenum)a[0].u);
+		case GL_CAPTURE_glClearNamedFramebufferfv: case GL_CAPTURE_glClearNamedFramebufferiv: case GL_CAPTURE_glClearNamedFramebufferuiv:
+			return clearValueBytes((GLenum)a[1].u);
+		case GL_CAPTURE_glDrawBuffers:
+			return a[0].i * (long long)sizeof(GLenum);
+		case GL_CAPTURE_glNamedFramebufferDrawBuffers: case GL_CAPTURE_glInvalidateFramebuffer: case GL_CAPTURE_glInvalidateSubFramebuffer:
+		case GL_CAPTURE_glInvalidateNamedFramebufferData: case GL_CAPTURE_glInvalidateNamedFramebufferSubData:
+			return a[1].i * (long long)sizeof(GLenum);
+
+		case GL_CAPTURE_glBindBuffersRange:	// (target, first, count, buffers, offsets, sizes)
+			return a[2].i * (long long)sizeof(GLintptr);
+		case GL_CAPTURE_glBindVertexBuffers:	// (first, count, buffers, offsets, strides)
+			return a[1].i * (long long)(index == 3 ? sizeof(GLintptr) : sizeof(GLsizei));
+		case GL_CAPTURE_glVertexArrayVertexBuffers:	// (vaobj, first, count, buffers, offsets, strides)
+			return a[2].i * (long long)(index == 4 ? sizeof(GLintptr) : sizeof(GLsizei));
+		case GL_CAPTURE_glMultiDrawArrays:	// (mode, first, count, drawcount)
+			return a[3].i * (long long)sizeof(GLint);
+		case GL_CAPTURE_glMultiDrawElements:	// (mode, count, type, indices, drawcount), indices are offsets into the element buffer
+			return a[4].i * (long long)(index == 1 ? sizeof(GLsizei) : sizeof(void*));
+		case GL_CAPTURE_glMultiDrawElementsBaseVertex:	// (mode, count, type, indices, drawcount, basevertex)
+			return a[4].i * (long long)(index == 3 ? sizeof(void*) : sizeof(GLint));
+		case GL_CAPTURE_glViewportArrayv: case GL_CAPTURE_glScissorArrayv:
+			return a[1].i * 4 * (long long)sizeof(GLfloat);
+		case GL_CAPTURE_glDepthRangeArrayv:
+			return a[1].i * 2 * (long long)sizeof(GLdouble);
+		case GL_CAPTURE_glViewportIndexedfv: case GL_CAPTURE_glScissorIndexedv:
+			return 4 * sizeof(GLfloat);
+
+		case GL_CAPTURE_glProgramBinary:	// (program, binaryFormat, binary, length)
+			return a[3].i;
+		case GL_CAPTURE_glShaderBinary:		// (count, shaders, binaryFormat, binary, length)
+			return a[4].i;
+		case GL_CAPTURE_glSpecializeShader:	// (shader, entry point, count, indices, values)
+			return (long long)a[2].u * sizeof(GLuint);
+		case GL_CAPTURE_glUniformSubroutinesuiv:
+			return a[1].i * (long long)sizeof(GLuint);
+		case GL_CAPTURE_glUniformHandleui64vARB:
+			return a[1].i * (long long)sizeof(GLuint64);
+		case GL_CAPTURE_glProgramUniformHandleui64vARB:
+			return a[2].i * (long long)sizeof(GLuint64);
+		case GL_CAPTURE_glDebugMessageControl:
+			return a[3].i * (long long)sizeof(GLuint);
+
+		case GL_CAPTURE_glShaderSource:			// the lengths, the sources are stored with their own
+		case GL_CAPTURE_glDebugMessageCallback:	// our callback and its user pointer mean nothing to the replay
+			return dropPointer;
+		}
+		return noPayload;
+	}
+
+	// output pointers that are offsets into a bound buffer rather than client memory
+	bool outputToBuffer(int function)
+	{
+		switch (function)
+		{
+		case GL_CAPTURE_glReadPixels: case GL_CAPTURE_glReadnPixels: case GL_CAPTURE_glGetTexImage: case GL_CAPTURE_glGetTextureImage:
+		case GL_CAPTURE_glGetTextureSubImage: case GL_CAPTURE_glGetCompressedTexImage: case GL_CAPTURE_glGetCompressedTextureImage:
+		case GL_CAPTURE_glGetCompressedTextureSubImage:
+			return getInteger(GL_PIXEL_PACK_BUFFER_BINDING) != 0;
+		case GL_CAPTURE_glGetQueryObjectiv: case GL_CAPTURE_glGetQueryObjectuiv: case GL_CAPTURE_glGetQueryObjecti64v:
+		case GL_CAPTURE_glGetQueryObjectui64v:
+			return getInteger(GL_QUERY_BUFFER_BINDING) != 0;
+		}
+		return false;
+	}
+
+	void putInput(int function, int index, const GLcaptureArg* a)
+	{
+		if (a[index].p == NULL)
+		{
+			putByte(Null);
+			return;
+		}
+		long long size = payloadSize(function, index, a);
+		if (size == dropPointer)
+		{
+			putByte(Null);
+		}
+		else if (size < 0)
+		{
+			putByte(Offset);
+			putVarint((unsigned long long)(uintptr_t)a[index].p);
+		}
+		else
+		{
+			putByte(Payload);
+			putVarint((unsigned long long)size);
+			putBytes(a[index].p, (size_t)size);
+		}
+	}
+
+	void putOutput(int function, int index, const GLcaptureArg* a)
+	{
+		if (a[index].p == NULL)
+		{
+			putByte(Null);
+		}
+		else if (outputToBuffer(function))
+		{
+			putByte(Offset);
+			putVarint((unsigned long long)(uintptr_t)a[index].p);
+		}
+		else
+		{
+			putByte(Output);
+		}
+	}
+
+	void putString(const char* text, long long length)
+	{
+		if (length < 0)
+		{
+			length = (long long)std::strlen(text);
+		}
+		putVarint((unsigned long long)length + 1);
+		putBytes(text, (size_t)length);
+		putByte(0);	// the replay passes the string straight from the trace
+	}
+
+	void putString(int function, int index, const GLcaptureArg* a)
+	{
+		const char* text = (const char*)a[index].p;
+		if (text == NULL)
+		{
+			putByte(Null);
+			return;
+		}
+		long long length = -1;
+		switch (function)	// the ones with an explicit length (-1: null terminated) before the string
+		{
+		case GL_CAPTURE_glObjectLabel: case GL_CAPTURE_glObjectPtrLabel: case GL_CAPTURE_glPushDebugGroup: case GL_CAPTURE_glDebugMessageInsert:
+			length = a[index - 1].i;
+			break;
+		}
+		putByte(Payload);
+		putString(text, length);
+	}
+
+	void putStrings(int function, int index, const GLcaptureArg* a)
+	{
+		const char* const* strings = (const char* const*)a[index].p;
+		long long count = strings != NULL && a[index - 1].i > 0 ? a[index - 1].i : 0;
+		const GLint* lengths = function == GL_CAPTURE_glShaderSource ? (const GLint*)a[index + 1].p : NULL;
+		putVarint((unsigned long long)count);
+		for (long long i = 0; i < count; i++)
+		{
+			putString(strings[i], lengths != NULL ? lengths[i] : -1);
+		}
+	}
+
+	void putNames(int index, const GLcaptureArg* a)
+	{
+		const GLuint* names = (const GLuint*)a[index].p;
+		long long count = names != NULL && a[index - 1].i > 0 ? a[index - 1].i : 0;
+		putVarint((unsigned long long)count);
+		for (long long i = 0; i < count; i++)
+		{
+			putVarint(names[i]);
+		}
+	}
+
+	Mapping* findMapping(bool named, GLuint key)
+	{
+		for (int i = 0; i < mappingCount; i++)
+		{
+			if (mappings[i].named == named && mappings[i].key == key)
+			{
+				return &mappings[i];
+			}
+		}
+		return nullptr;
+	}
+
+	void putMappedMemory(const Mapping& mapping, long long offset, long long size)
+	{
+		if (offset < 0 || size <= 0 || offset + size > mapping.length)
+		{
+			return;
+		}
+		putVarint(MappedMemory);
+		putVarint(mapping.named ? 1 : 0);
+		putVarint(mapping.key);
+		putVarint((unsigned long long)offset);
+		putVarint((unsigned long long)size);
+		putBytes(mapping.memory + offset, (size_t)size);
+	}
+
+	void addMapping(bool named, GLuint key, const void* memory, long long length, bool write, bool explicitFlush)
+	{
+		if (memory == NULL)
+		{
+			return;
+		}
+		Mapping* mapping = findMapping(named, key);
+		if (mapping == nullptr)
+		{
+			if (mappingCount == maxMappings)
+			{
+				std::cout << "ERROR::GL_CAPTURE::TOO_MANY_MAPPINGS writes to this buffer are not captured" << std::endl;
+				return;
+			}
+			mapping = &mappings[mappingCount++];
+		}
+		mapping->named = named;
+		mapping->key = key;
+		mapping->memory = (const unsigned char*)memory;
+		mapping->length = length;
+		mapping->write = write;
+		mapping->explicitFlush = explicitFlush;
+	}
+
+	void removeMapping(bool named, GLuint key)
+	{
+		Mapping* mapping = findMapping(named, key);
+		if (mapping != nullptr)
+		{
+			*mapping = mappings[--mappingCount];
+		}
+	}
+
+	long long bufferSize(bool named, GLuint key)
+	{
+		GLint64 size = 0;
+		if (named && glad_capture_real_glGetNamedBufferParameteri64v != NULL)
+		{
+			glad_capture_real_glGetNamedBufferParameteri64v(key, GL_BUFFER_SIZE, &size);
+		}
+		else if (!named && glad_capture_real_glGetBufferParameteri64v != NULL)
+		{
+			glad_capture_real_glGetBufferParameteri64v(key, GL_BUFFER_SIZE, &size);
+		}
+		return size;
+	}
+
+	void trackMapping(int function, const GLcaptureArg* a, const GLcaptureArg* ret)
+	{
+		switch (function)
+		{
+		case GL_CAPTURE_glMapBuffer: case GL_CAPTURE_glMapNamedBuffer:
+		{
+			bool named = function == GL_CAPTURE_glMapNamedBuffer;
+			addMapping(named, (GLuint)a[0].u, ret->p, bufferSize(named, (GLuint)a[0].u), a[1].u != GL_READ_ONLY, false);
+			break;
+		}
+		case GL_CAPTURE_glMapBufferRange: case GL_CAPTURE_glMapNamedBufferRange:
+			addMapping(function == GL_CAPTURE_glMapNamedBufferRange, (GLuint)a[0].u, ret->p, a[2].i, (a[3].u & GL_MAP_WRITE_BIT) != 0,
+				(a[3].u & GL_MAP_FLUSH_EXPLICIT_BIT) != 0);
+			break;
+		case GL_CAPTURE_glUnmapBuffer: case GL_CAPTURE_glUnmapNamedBuffer:
+			removeMapping(function == GL_CAPTURE_glUnmapNamedBuffer, (GLuint)a[0].u);
+			break;
+		}
+	}
+}
+
+extern "C" void gl_capture_before(int function, const GLcaptureArg* a)
+{
+	std::lock_guard<std::mutex> lock(captureMutex);
+	if (!active)
+	{
+		return;
+	}
+
+	bool named = function == GL_CAPTURE_glFlushMappedNamedBufferRange || function == GL_CAPTURE_glUnmapNamedBuffer;
+	const Mapping* mapping = findMapping(named, (GLuint)a[0].u);
+	if (mapping == nullptr || !mapping->write)
+	{
+		return;
+	}
+	if (function == GL_CAPTURE_glFlushMappedBufferRange || function == GL_CAPTURE_glFlushMappedNamedBufferRange)
+	{
+		putMappedMemory(*mapping, a[1].i, a[2].i);	// offset relative to the start of the mapping
+	}
+	else if (!mapping->explicitFlush)
+	{
+		putMappedMemory(*mapping, 0, mapping->length);	// unmap, everything may have been written
+	}
+}
+
+extern "C" void gl_capture_record(int function, const GLcaptureArg* a, const GLcaptureArg* ret)
+{
+	std::lock_guard<std::mutex> lock(captureMutex);
+	if (!active)
+	{
+		return;
+	}
+
+	putVarint((unsigned long long)function + FirstCall);
+	const GLcaptureFunction& f = gl_capture_functions[function];
+	const char* code = f.signature;
+	for (int i = 0; i < f.argCount; i++, code++)
+	{
+		switch (*code)
+		{
+		case 'i': case 'l': case 'U':
+			putSigned(a[i].i);
+			break;
+		case 'f':
+			putBytes(&a[i].f, sizeof(float));
+			break;
+		case 'd':
+			putBytes(&a[i].d, sizeof(double));
+			break;
+		case 'Y':
+			putVarint((unsigned long long)(uintptr_t)a[i].p);	// the sync's value identifies it
+			break;
+		case 'p':
+			putInput(function, i, a);
+			break;
+		case 'o':
+			putOutput(function, i, a);
+			break;
+		case 's':
+			putString(function, i, a);
+			break;
+		case 'a':
+			putStrings(function, i, a);
+			break;
+		case '[': case ']':
+			code++;	// the kind of name, only the replay cares
+			putNames(i, a);
+			break;
+		default:	// enums, booleans, unsigned integers, object names, handles
+			putVarint(a[i].u);
+			break;
+		}
+	}
+
+	switch (f.ret)	// only returned names are needed, to remap later uses of them
+	{
+	case 'S': case 'P': case 'H':
+		putVarint(ret->u);
+		break;
+	case 'U':
+		putSigned(ret->i);
+		break;
+	case 'Y':
+		putVarint((unsigned long long)(uintptr_t)ret->p);
+		break;
+	}
+
+	trackMapping(function, a, ret);
+	counters.calls++;
+}
+
+namespace GlCapture
+{
+	bool init(int width, int height)
+	{
+		const char* path = std::getenv("LEARNOPENGL_GL_CAPTURE");
+		if (path == nullptr || path[0] == '\0')
+		{
+			return false;
+		}
+		return start(path, width, height);
+	}
+
+	bool start(const char* path, int width, int height)
+	{
+#ifdef GLAD_MULTI_CONTEXT
+		std::cout << "ERROR::GL_CAPTURE::MULTI_CONTEXT the capture wraps glad's global pointers, not available with GLAD_MULTI_CONTEXT" << std::endl;
+		return false;
+#endif
+		std::lock_guard<std::mutex> lock(captureMutex);
+		if (active)
+		{
+			return false;
+		}
+		file.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!file)
+		{
+			std::cout << "ERROR::GL_CAPTURE::FILE_NOT_OPENED " << path << std::endl;
+			return false;
+		}
+		if (buffer == nullptr)
+		{
+			buffer = new unsigned char[bufferCapacity];
+		}
+		used = 0;
+		counters = GlCapture::Stats();
+		mappingCount = 0;
+		for (int i = 0; i < GL_CAPTURE_FUNCTION_COUNT; i++)
+		{
+			vectorRules[i] = VectorRule();
+			parseVectorRule(gl_capture_functions[i], &vectorRules[i]);
+		}
+
+		GLint major = 0, minor = 0, profile = 0;
+		glad_glGetIntegerv(GL_MAJOR_VERSION, &major);
+		glad_glGetIntegerv(GL_MINOR_VERSION, &minor);
+		if (major > 3 || (major == 3 && minor >= 2))
+		{
+			glad_glGetIntegerv(GL_CONTEXT_PROFILE_MASK, &profile);
+		}
+		putBytes("GLTRACE", 7);
+		putByte(traceVersion);
+		putVarint((unsigned long long)width);
+		putVarint((unsigned long long)height);
+		putVarint((unsigned long long)major);
+		putVarint((unsigned long long)minor);
+		putVarint((unsigned long long)profile);
+		putVarint(GL_CAPTURE_FUNCTION_COUNT);	// by name, so a replayer built from a different glad still finds them
+		for (int i = 0; i < GL_CAPTURE_FUNCTION_COUNT; i++)
+		{
+			size_t length = std::strlen(gl_capture_functions[i].name);
+			putVarint(length);
+			putBytes(gl_capture_functions[i].name, length);
+		}
+
+		active = true;
+		gl_capture_layer_install(1);
+		std::cout << "GL_CAPTURE::STARTED " << path << std::endl;
+		return true;
+	}
+
+	void frame()
+	{
+		std::lock_guard<std::mutex> lock(captureMutex);
+		if (!active)
+		{
+			return;
+		}
+		putVarint(FrameEnd);
+		flushBuffer();	// whole frames on disk, if the application dies the trace is still usable
+		file.flush();
+		counters.frames++;
+	}
+
+	void stop()
+	{
+		std::lock_guard<std::mutex> lock(captureMutex);
+		if (!active)
+		{
+			return;
+		}
+		gl_capture_layer_install(0);
+		active = false;
+		flushBuffer();
+		file.close();
+		std::cout << "GL_CAPTURE::STOPPED " << counters.frames << " frames, " << counters.calls << " calls, " << counters.bytes << " bytes"
+			<< std::endl;
+	}
+
+	bool capturing()
+	{
+		return active;
+	}
+
+	Stats stats()
+	{
+		std::lock_guard<std::mutex> lock(captureMutex);
+		return counters;
+	}
+}
@@ -0,0 +1,59 @@
+#ifndef GL_CAPTURE_H
+#define GL_CAPTURE_H
+
+/*
+ * NOTES:
+ * Capture of every OpenGL call into a binary trace file, replayed by tools/gl_replay.cpp.
+ *
+ * A performance problem seen on someone else's machine is hard to reproduce: it depends on their scene, their settings, their input. The
+ * calls we send to the driver are all the GPU ever sees though, so recording those (with the data they upload) gives a file that renders
+ * the same frames without the application. The replayer runs it as fast as it can in a hidden window (it still needs a display to create
+ * the context, it is not headless) on any driver, e.g. Mesa's llvmpipe software rasterizer, which makes the numbers comparable between
+ * runs and machines.
+ *
+ * The capture sits inside glad's dispatch: start() replaces glad's function pointers (glad_glDrawArrays, ...) with generated wrappers
+ * (gl_capture_layer.h/.c) that call the driver and then record the call. Nothing else changes, and when not capturing the pointers are
+ * glad's own, so the capture is compiled into every build and costs nothing until it is started. Start it right after loading glad:
+ * objects created before start() are unknown to the replay.
+ *
+ * What is recorded per call:
+ *	*scalar arguments, integers as variable length (LEB128) integers, so most take one or two bytes
+ *	*object names (buffers, textures, programs, ...), uniform locations, syncs and bindless handles, remapped by the replayer to
+ *	 whatever its driver returns for the same glGen / glCreate / glGetUniformLocation call
+ *	*the memory behind input pointers whose size is known from the call: buffer data, texture images (with the unpack alignment and row
+ *	 length in effect), uniform arrays, shader sources, draw buffer lists, ... Other pointers are recorded as values, they are offsets into
+ *	 a bound buffer (glVertexAttribPointer, glDrawElements indices, indirect draws)
+ *	*what was written into mapped buffers, at glFlushMappedBufferRange and glUnmapBuffer
+ * Output pointers (glGet*, glReadPixels into client memory) are not stored, the replay passes a scratch buffer.
+ *
+ * Not supported: client side vertex arrays/indices (core profile has none), unpack skip rows/pixels/images, persistent coherent mappings
+ * (nothing tells us when the application wrote them), bindless handles stored inside buffers, more than one context. The debug message
+ * callback is not replayed. Like the debug layer it wraps glad's global pointers and is not available with GLAD_MULTI_CONTEXT.
+ *
+ * Trace layout (all integers LEB128 unless noted):
+ *	"GLTRACE" version(1 byte) width height glMajor glMinor profileMask functionCount {name length, name bytes}...
+ *	then records: 0 = end of frame, 1 = mapped memory {named buffer (0/1), target or buffer, offset, size, bytes},
+ *	function index + 2 = a call, its arguments follow the function's signature (see gl_capture_layer.h)
+ */
+
+namespace GlCapture
+{
+	// starts capturing to the file named by the environment variable LEARNOPENGL_GL_CAPTURE, does nothing when it is not set.
+	// width/height is the size of the default framebuffer, the replayer renders into a hidden window of that size.
+	bool init(int width, int height);
+
+	bool start(const char* path, int width, int height);	// after gladLoadGLLoader, before creating any GL object
+	void frame();											// end of a frame, call next to glfwSwapBuffers
+	void stop();											// puts glad's pointers back and closes the file
+	bool capturing();
+
+	struct Stats
+	{
+		unsigned long long calls;
+		unsigned long long frames;
+		unsigned long long bytes;	// written to the trace so far
+	};
+	Stats stats();
+}
+
+#endif
@@ -0,0 +1,2200 @@
+/*
+
+    Call capture wrappers for the OpenGL loader generated by glad 0.1.34.
+
+    APIs: gl=4.6
+    Extensions: GL_ARB_bindless_texture,GL_ARB_buffer_storage,GL_ARB_direct_state_access,GL_ARB_gl_spirv,GL_ARB_invalidate_subdata,GL_ARB_multi_draw_indirect,GL_ATI_meminfo,GL_KHR_debug,GL_KHR_parallel_shader_compile,GL_NVX_gpu_memory_info
+
+    Generated by tools/gen_gl_layers.py from the function list of src/glad.c, do not edit. After regenerating the loader:
+        python tools/gen_gl_layers.py
+    Used by gl_capture.h (recording) and tools/gl_replay.cpp (replaying).
+*/
+
+#ifndef __gl_capture_layer_h_
+#define __gl_capture_layer_h_
+
+#include <glad/glad.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* one argument or return value of a call, the member used follows the signature code */
+typedef union GLcaptureArg {
+	long long i;
+	unsigned long long u;
+	float f;
+	double d;
+	const void* p;
+} GLcaptureArg;
+
+/*
+ * signature codes, one per argument:
+ *	e enum, b boolean, i signed integer, u unsigned integer, l 64 bit signed, L 64 bit unsigned, f float, d double
+ *	B buffer, T texture, P program, S shader, V vertex array, F framebuffer, R renderbuffer, M sampler, Q query, G program pipeline,
+ *	X transform feedback, Y sync, H bindless handle, U uniform location (object names, remapped on replay)
+ *	p input pointer, o output pointer, s string, a array of strings
+ *	[ followed by a name code: array of names read by the call, ] followed by a name code: array of names written by the call
+ *	  (the length of both is the argument before)
+ * the return code uses the same letters, v for none
+ */
+/* makes the call through glad's pointer, returns 0 (and does nothing) when the driver doesn't have the function */
+typedef int (*GLcaptureReplayProc)(const GLcaptureArg* args, GLcaptureArg* ret);
+
+typedef struct GLcaptureFunction {
+	const char* name;
+	const char* signature;
+	char ret;
+	unsigned char argCount;
+	GLcaptureReplayProc replay;
+} GLcaptureFunction;
+
+enum {
+	GL_CAPTURE_glAccum = 0,
+	GL_CAPTURE_glActiveShaderProgram,
+	GL_CAPTURE_glActiveTexture,
+	GL_CAPTURE_glAlphaFunc,
+	GL_CAPTURE_glAreTexturesResident,
+	GL_CAPTURE_glArrayElement,
+	GL_CAPTURE_glAttachShader,
+	GL_CAPTURE_glBegin,
+	GL_CAPTURE_glBeginConditionalRender,
+	GL_CAPTURE_glBeginQuery,
+	GL_CAPTURE_glBeginQueryIndexed,
+	GL_CAPTURE_glBeginTransformFeedback,
+	GL_CAPTURE_glBindAttribLocation,
+	GL_CAPTURE_glBindBuffer,
+	GL_CAPTURE_glBindBufferBase,
+	GL_CAPTURE_glBindBufferRange,
+	GL_CAPTURE_glBindBuffersBase,
+	GL_CAPTURE_glBindBuffersRange,
+	GL_CAPTURE_glBindFragDataLocation,
+	GL_CAPTURE_glBindFragDataLocationIndexed,
+	GL_CAPTURE_glBindFramebuffer,
+	GL_CAPTURE_glBindImageTexture,
+	GL_CAPTURE_glBindImageTextures,
+	GL_CAPTURE_glBindProgramPipeline,
+	GL_CAPTURE_glBindRenderbuffer,
+	GL_CAPTURE_glBindSampler,
+	GL_CAPTURE_glBindSamplers,
+	GL_CAPTURE_glBindTexture,
+	GL_CAPTURE_glBindTextureUnit,
+	GL_CAPTURE_glBindTextures,
+	GL_CAPTURE_glBindTransformFeedback,
+	GL_CAPTURE_glBindVertexArray,
+	GL_CAPTURE_glBindVertexBuffer,
+	GL_CAPTURE_glBindVertexBuffers,
+	GL_CAPTURE_glBitmap,
+	GL_CAPTURE_glBlendColor,
+	GL_CAPTURE_glBlendEquation,
+	GL_CAPTURE_glBlendEquationSeparate,
+	GL_CAPTURE_glBlendEquationSeparatei,
+	GL_CAPTURE_glBlendEquationi,
+	GL_CAPTURE_glBlendFunc,
+	GL_CAPTURE_glBlendFuncSeparate,
+	GL_CAPTURE_glBlendFuncSeparatei,
+	GL_CAPTURE_glBlendFunci,
+	GL_CAPTURE_glBlitFramebuffer,
+	GL_CAPTURE_glBlitNamedFramebuffer,
+	GL_CAPTURE_glBufferData,
+	GL_CAPTURE_glBufferStorage,
+	GL_CAPTURE_glBufferSubData,
+	GL_CAPTURE_glCallList,
+	GL_CAPTURE_glCallLists,
+	GL_CAPTURE_glCheckFramebufferStatus,
+	GL_CAPTURE_glCheckNamedFramebufferStatus,
+	GL_CAPTURE_glClampColor,
+	GL_CAPTURE_glClear,
+	GL_CAPTURE_glClearAccum,
+	GL_CAPTURE_glClearBufferData,
+	GL_CAPTURE_glClearBufferSubData,
+	GL_CAPTURE_glClearBufferfi,
+	GL_CAPTURE_glClearBufferfv,
+	GL_CAPTURE_glClearBufferiv,
+	GL_CAPTURE_glClearBufferuiv,
+	GL_CAPTURE_glClearColor,
+	GL_CAPTURE_glClearDepth,
+	GL_CAPTURE_glClearDepthf,
+	GL_CAPTURE_glClearIndex,
+	GL_CAPTURE_glClearNamedBufferData,
+	GL_CAPTURE_glClearNamedBufferSubData,
+	GL_CAPTURE_glClearNamedFramebufferfi,
+	GL_CAPTURE_glClearNamedFramebufferfv,
+	GL_CAPTURE_glClearNamedFramebufferiv,
+	GL_CAPTURE_glClearNamedFramebufferuiv,
+	GL_CAPTURE_glClearStencil,
+	GL_CAPTURE_glClearTexImage,
+	GL_CAPTURE_glClearTexSubImage,
+	GL_CAPTURE_glClientActiveTexture,
+	GL_CAPTURE_glClientWaitSync,
+	GL_CAPTURE_glClipControl,
+	GL_CAPTURE_glClipPlane,
+	GL_CAPTURE_glColor3b,
+	GL_CAPTURE_glColor3bv,
+	GL_CAPTURE_glColor3d,
+	GL_CAPTURE_glColor3dv,
+	GL_CAPTURE_glColor3f,
+	GL_CAPTURE_glColor3fv,
+	GL_CAPTURE_glColor3i,
+	GL_CAPTURE_glColor3iv,
+	GL_CAPTURE_glColor3s,
+	GL_CAPTURE_glColor3sv,
+	GL_CAPTURE_glColor3ub,
+	GL_CAPTURE_glColor3ubv,
+	GL_CAPTURE_glColor3ui,
+	GL_CAPTURE_glColor3uiv,
+	GL_CAPTURE_glColor3us,
+	GL_CAPTURE_glColor3usv,
+	GL_CAPTURE_glColor4b,
+	GL_CAPTURE_glColor4bv,
+	GL_CAPTURE_glColor4d,
+	GL_CAPTURE_glColor4dv,
+	GL_CAPTURE_glColor4f,
+	GL_CAPTURE_glColor4fv,
+	GL_CAPTURE_glColor4i,
+	GL_CAPTURE_glColor4iv,
+	GL_CAPTURE_glColor4s,
+	GL_CAPTURE_glColor4sv,
+	GL_CAPTURE_glColor4ub,
+	GL_CAPTURE_glColor4ubv,
+	GL_CAPTURE_glColor4ui,
+	GL_CAPTURE_glColor4uiv,
+	GL_CAPTURE_glColor4us,
+	GL_CAPTURE_glColor4usv,
+	GL_CAPTURE_glColorMask,
+	GL_CAPTURE_glColorMaski,
+	GL_CAPTURE_glColorMaterial,
+	GL_CAPTURE_glColorP3ui,
+	GL_CAPTURE_glColorP3uiv,
+	GL_CAPTURE_glColorP4ui,
+	GL_CAPTURE_glColorP4uiv,
+	GL_CAPTURE_glColorPointer,
+	GL_CAPTURE_glCompileShader,
+	GL_CAPTURE_glCompressedTexImage1D,
+	GL_CAPTURE_glCompressedTexImage2D,
+	GL_CAPTURE_glCompressedTexImage3D,
+	GL_CAPTURE_glCompressedTexSubImage1D,
+	GL_CAPTURE_glCompressedTexSubImage2D,
+	GL_CAPTURE_glCompressedTexSubImage3D,
+	GL_CAPTURE_glCompressedTextureSubImage1D,
+	GL_CAPTURE_glCompressedTextureSubImage2D,
+	GL_CAPTURE_glCompressedTextureSubImage3D,
+	GL_CAPTURE_glCopyBufferSubData,
+	GL_CAPTURE_glCopyImageSubData,
+	GL_CAPTURE_glCopyNamedBufferSubData,
+	GL_CAPTURE_glCopyPixels,
+	GL_CAPTURE_glCopyTexImage1D,
+	GL_CAPTURE_glCopyTexImage2D,
+	GL_CAPTURE_glCopyTexSubImage1D,
+	GL_CAPTURE_glCopyTexSubImage2D,
+	GL_CAPTURE_glCopyTexSubImage3D,
+	GL_CAPTURE_glCopyTextureSubImage1D,
+	GL_CAPTURE_glCopyTextureSubImage2D,
+	GL_CAPTURE_glCopyTextureSubImage3D,
+	GL_CAPTURE_glCreateBuffers,
+	GL_CAPTURE_glCreateFramebuffers,
+	GL_CAPTURE_glCreateProgram,
+	GL_CAPTURE_glCreateProgramPipelines,
+	GL_CAPTURE_glCreateQueries,
+	GL_CAPTURE_glCreateRenderbuffers,
+	GL_CAPTURE_glCreateSamplers,
+	GL_CAPTURE_glCreateShader,
+	GL_CAPTURE_glCreateShaderProgramv,
+	GL_CAPTURE_glCreateTextures,
+	GL_CAPTURE_glCreateTransformFeedbacks,
+	GL_CAPTURE_glCreateVertexArrays,
+	GL_CAPTURE_glCullFace,
+	GL_CAPTURE_glDebugMessageCallback,
+	GL_CAPTURE_glDebugMessageControl,
+	GL_CAPTURE_glDebugMessageInsert,
+	GL_CAPTURE_glDeleteBuffers,
+	GL_CAPTURE_glDeleteFramebuffers,
+	GL_CAPTURE_glDeleteLists,
+	GL_CAPTURE_glDeleteProgram,
+	GL_CAPTURE_glDeleteProgramPipelines,
+	GL_CAPTURE_glDeleteQueries,
+	GL_CAPTURE_glDeleteRenderbuffers,
+	GL_CAPTURE_glDeleteSamplers,
+	GL_CAPTURE_glDeleteShader,
+	GL_CAPTURE_glDeleteSync,
+	GL_CAPTURE_glDeleteTextures,
+	GL_CAPTURE_glDeleteTransformFeedbacks,
+	GL_CAPTURE_glDeleteVertexArrays,
+	GL_CAPTURE_glDepthFunc,
+	GL_CAPTURE_glDepthMask,
+	GL_CAPTURE_glDepthRange,
+	GL_CAPTURE_glDepthRangeArrayv,
+	GL_CAPTURE_glDepthRangeIndexed,
+	GL_CAPTURE_glDepthRangef,
+	GL_CAPTURE_glDetachShader,
+	GL_CAPTURE_glDisable,
+	GL_CAPTURE_glDisableClientState,
+	GL_CAPTURE_glDisableVertexArrayAttrib,
+	GL_CAPTURE_glDisableVertexAttribArray,
+	GL_CAPTURE_glDisablei,
+	GL_CAPTURE_glDispatchCompute,
+	GL_CAPTURE_glDispatchComputeIndirect,
+	GL_CAPTURE_glDrawArrays,
+	GL_CAPTURE_glDrawArraysIndirect,
+	GL_CAPTURE_glDrawArraysInstanced,
+	GL_CAPTURE_glDrawArraysInstancedBaseInstance,
+	GL_CAPTURE_glDrawBuffer,
+	GL_CAPTURE_glDrawBuffers,
+	GL_CAPTURE_glDrawElements,
+	GL_CAPTURE_glDrawElementsBaseVertex,
+	GL_CAPTURE_glDrawElementsIndirect,
+	GL_CAPTURE_glDrawElementsInstanced,
+	GL_CAPTURE_glDrawElementsInstancedBaseInstance,
+	GL_CAPTURE_glDrawElementsInstancedBaseVertex,
+	GL_CAPTURE_glDrawElementsInstancedBaseVertexBaseInstance,
+	GL_CAPTURE_glDrawPixels,
+	GL_CAPTURE_glDrawRangeElements,
+	GL_CAPTURE_glDrawRangeElementsBaseVertex,
+	GL_CAPTURE_glDrawTransformFeedback,
+	GL_CAPTURE_glDrawTransformFeedbackInstanced,
+	GL_CAPTURE_glDrawTransformFeedbackStream,
+	GL_CAPTURE_glDrawTransformFeedbackStreamInstanced,
+	GL_CAPTURE_glEdgeFlag,
+	GL_CAPTURE_glEdgeFlagPointer,
+	GL_CAPTURE_glEdgeFlagv,
+	GL_CAPTURE_glEnable,
+	GL_CAPTURE_glEnableClientState,
+	GL_CAPTURE_glEnableVertexArrayAttrib,
+	GL_CAPTURE_glEnableVertexAttribArray,
+	GL_CAPTURE_glEnablei,
+	GL_CAPTURE_glEnd,
+	GL_CAPTURE_glEndConditionalRender,
+	GL_CAPTURE_glEndList,
+	GL_CAPTURE_glEndQuery,
+	GL_CAPTURE_glEndQueryIndexed,
+	GL_CAPTURE_glEndTransformFeedback,
+	GL_CAPTURE_glEvalCoord1d,
+	GL_CAPTURE_glEvalCoord1dv,
+	GL_CAPTURE_glEvalCoord1f,
+	GL_CAPTURE_glEvalCoord1fv,
+	GL_CAPTURE_glEvalCoord2d,
+	GL_CAPTURE_glEvalCoord2dv,
+	GL_CAPTURE_glEvalCoord2f,
+	GL_CAPTURE_glEvalCoord2fv,
+	GL_CAPTURE_glEvalMesh1,
+	GL_CAPTURE_glEvalMesh2,
+	GL_CAPTURE_glEvalPoint1,
+	GL_CAPTURE_glEvalPoint2,
+	GL_CAPTURE_glFeedbackBuffer,
+	GL_CAPTURE_glFenceSync,
+	GL_CAPTURE_glFinish,
+	GL_CAPTURE_glFlush,
+	GL_CAPTURE_glFlushMappedBufferRange,
+	GL_CAPTURE_glFlushMappedNamedBufferRange,
+	GL_CAPTURE_glFogCoordPointer,
+	GL_CAPTURE_glFogCoordd,
+	GL_CAPTURE_glFogCoorddv,
+	GL_CAPTURE_glFogCoordf,
+	GL_CAPTURE_glFogCoordfv,
+	GL_CAPTURE_glFogf,
+	GL_CAPTURE_glFogfv,
+	GL_CAPTURE_glFogi,
+	GL_CAPTURE_glFogiv,
+	GL_CAPTURE_glFramebufferParameteri,
+	GL_CAPTURE_glFramebufferRenderbuffer,
+	GL_CAPTURE_glFramebufferTexture,
+	GL_CAPTURE_glFramebufferTexture1D,
+	GL_CAPTURE_glFramebufferTexture2D,
+	GL_CAPTURE_glFramebufferTexture3D,
+	GL_CAPTURE_glFramebufferTextureLayer,
+	GL_CAPTURE_glFrontFace,
+	GL_CAPTURE_glFrustum,
+	GL_CAPTURE_glGenBuffers,
+	GL_CAPTURE_glGenFramebuffers,
+	GL_CAPTURE_glGenLists,
+	GL_CAPTURE_glGenProgramPipelines,
+	GL_CAPTURE_glGenQueries,
+	GL_CAPTURE_glGenRenderbuffers,
+	GL_CAPTURE_glGenSamplers,
+	GL_CAPTURE_glGenTextures,
+	GL_CAPTURE_glGenTransformFeedbacks,
+	GL_CAPTURE_glGenVertexArrays,
+	GL_CAPTURE_glGenerateMipmap,
+	GL_CAPTURE_glGenerateTextureMipmap,
+	GL_CAPTURE_glGetActiveAtomicCounterBufferiv,
+	GL_CAPTURE_glGetActiveAttrib,
+	GL_CAPTURE_glGetActiveSubroutineName,
+	GL_CAPTURE_glGetActiveSubroutineUniformName,
+	GL_CAPTURE_glGetActiveSubroutineUniformiv,
+	GL_CAPTURE_glGetActiveUniform,
+	GL_CAPTURE_glGetActiveUniformBlockName,
+	GL_CAPTURE_glGetActiveUniformBlockiv,
+	GL_CAPTURE_glGetActiveUniformName,
+	GL_CAPTURE_glGetActiveUniformsiv,
+	GL_CAPTURE_glGetAttachedShaders,
+	GL_CAPTURE_glGetAttribLocation,
+	GL_CAPTURE_glGetBooleani_v,
+	GL_CAPTURE_glGetBooleanv,
+	GL_CAPTURE_glGetBufferParameteri64v,
+	GL_CAPTURE_glGetBufferParameteriv,
+	GL_CAPTURE_glGetBufferPointerv,
+	GL_CAPTURE_glGetBufferSubData,
+	GL_CAPTURE_glGetClipPlane,
+	GL_CAPTURE_glGetCompressedTexImage,
+	GL_CAPTURE_glGetCompressedTextureImage,
+	GL_CAPTURE_glGetCompressedTextureSubImage,
+	GL_CAPTURE_glGetDebugMessageLog,
+	GL_CAPTURE_glGetDoublei_v,
+	GL_CAPTURE_glGetDoublev,
+	GL_CAPTURE_glGetError,
+	GL_CAPTURE_glGetFloati_v,
+	GL_CAPTURE_glGetFloatv,
+	GL_CAPTURE_glGetFragDataIndex,
+	GL_CAPTURE_glGetFragDataLocation,
+	GL_CAPTURE_glGetFramebufferAttachmentParameteriv,
+	GL_CAPTURE_glGetFramebufferParameteriv,
+	GL_CAPTURE_glGetGraphicsResetStatus,
+	GL_CAPTURE_glGetImageHandleARB,
+	GL_CAPTURE_glGetInteger64i_v,
+	GL_CAPTURE_glGetInteger64v,
+	GL_CAPTURE_glGetIntegeri_v,
+	GL_CAPTURE_glGetIntegerv,
+	GL_CAPTURE_glGetInternalformati64v,
+	GL_CAPTURE_glGetInternalformativ,
+	GL_CAPTURE_glGetLightfv,
+	GL_CAPTURE_glGetLightiv,
+	GL_CAPTURE_glGetMapdv,
+	GL_CAPTURE_glGetMapfv,
+	GL_CAPTURE_glGetMapiv,
+	GL_CAPTURE_glGetMaterialfv,
+	GL_CAPTURE_glGetMaterialiv,
+	GL_CAPTURE_glGetMultisamplefv,
+	GL_CAPTURE_glGetNamedBufferParameteri64v,
+	GL_CAPTURE_glGetNamedBufferParameteriv,
+	GL_CAPTURE_glGetNamedBufferPointerv,
+	GL_CAPTURE_glGetNamedBufferSubData,
+	GL_CAPTURE_glGetNamedFramebufferAttachmentParameteriv,
+	GL_CAPTURE_glGetNamedFramebufferParameteriv,
+	GL_CAPTURE_glGetNamedRenderbufferParameteriv,
+	GL_CAPTURE_glGetObjectLabel,
+	GL_CAPTURE_glGetObjectPtrLabel,
+	GL_CAPTURE_glGetPixelMapfv,
+	GL_CAPTURE_glGetPixelMapuiv,
+	GL_CAPTURE_glGetPixelMapusv,
+	GL_CAPTURE_glGetPointerv,
+	GL_CAPTURE_glGetPolygonStipple,
+	GL_CAPTURE_glGetProgramBinary,
+	GL_CAPTURE_glGetProgramInfoLog,
+	GL_CAPTURE_glGetProgramInterfaceiv,
+	GL_CAPTURE_glGetProgramPipelineInfoLog,
+	GL_CAPTURE_glGetProgramPipelineiv,
+	GL_CAPTURE_glGetProgramResourceIndex,
+	GL_CAPTURE_glGetProgramResourceLocation,
+	GL_CAPTURE_glGetProgramResourceLocationIndex,
+	GL_CAPTURE_glGetProgramResourceName,
+	GL_CAPTURE_glGetProgramResourceiv,
+	GL_CAPTURE_glGetProgramStageiv,
+	GL_CAPTURE_glGetProgramiv,
+	GL_CAPTURE_glGetQueryBufferObjecti64v,
+	GL_CAPTURE_glGetQueryBufferObjectiv,
+	GL_CAPTURE_glGetQueryBufferObjectui64v,
+	GL_CAPTURE_glGetQueryBufferObjectuiv,
+	GL_CAPTURE_glGetQueryIndexediv,
+	GL_CAPTURE_glGetQueryObjecti64v,
+	GL_CAPTURE_glGetQueryObjectiv,
+	GL_CAPTURE_glGetQueryObjectui64v,
+	GL_CAPTURE_glGetQueryObjectuiv,
+	GL_CAPTURE_glGetQueryiv,
+	GL_CAPTURE_glGetRenderbufferParameteriv,
+	GL_CAPTURE_glGetSamplerParameterIiv,
+	GL_CAPTURE_glGetSamplerParameterIuiv,
+	GL_CAPTURE_glGetSamplerParameterfv,
+	GL_CAPTURE_glGetSamplerParameteriv,
+	GL_CAPTURE_glGetShaderInfoLog,
+	GL_CAPTURE_glGetShaderPrecisionFormat,
+	GL_CAPTURE_glGetShaderSource,
+	GL_CAPTURE_glGetShaderiv,
+	GL_CAPTURE_glGetString,
+	GL_CAPTURE_glGetStringi,
+	GL_CAPTURE_glGetSubroutineIndex,
+	GL_CAPTURE_glGetSubroutineUniformLocation,
+	GL_CAPTURE_glGetSynciv,
+	GL_CAPTURE_glGetTexEnvfv,
+	GL_CAPTURE_glGetTexEnviv,
+	GL_CAPTURE_glGetTexGendv,
+	GL_CAPTURE_glGetTexGenfv,
+	GL_CAPTURE_glGetTexGeniv,
+	GL_CAPTURE_glGetTexImage,
+	GL_CAPTURE_glGetTexLevelParameterfv,
+	GL_CAPTURE_glGetTexLevelParameteriv,
+	GL_CAPTURE_glGetTexParameterIiv,
+	GL_CAPTURE_glGetTexParameterIuiv,
+	GL_CAPTURE_glGetTexParameterfv,
+	GL_CAPTURE_glGetTexParameteriv,
+	GL_CAPTURE_glGetTextureHandleARB,
+	GL_CAPTURE_glGetTextureImage,
+	GL_CAPTURE_glGetTextureLevelParameterfv,
+	GL_CAPTURE_glGetTextureLevelParameteriv,
+	GL_CAPTURE_glGetTextureParameterIiv,
+	GL_CAPTURE_glGetTextureParameterIuiv,
+	GL_CAPTURE_glGetTextureParameterfv,
+	GL_CAPTURE_glGetTextureParameteriv,
+	GL_CAPTURE_glGetTextureSamplerHandleARB,
+	GL_CAPTURE_glGetTextureSubImage,
+	GL_CAPTURE_glGetTransformFeedbackVarying,
+	GL_CAPTURE_glGetTransformFeedbacki64_v,
+	GL_CAPTURE_glGetTransformFeedbacki_v,
+	GL_CAPTURE_glGetTransformFeedbackiv,
+	GL_CAPTURE_glGetUniformBlockIndex,
+	GL_CAPTURE_glGetUniformIndices,
+	GL_CAPTURE_glGetUniformLocation,
+	GL_CAPTURE_glGetUniformSubroutineuiv,
+	GL_CAPTURE_glGetUniformdv,
+	GL_CAPTURE_glGetUniformfv,
+	GL_CAPTURE_glGetUniformiv,
+	GL_CAPTURE_glGetUniformuiv,
+	GL_CAPTURE_glGetVertexArrayIndexed64iv,
+	GL_CAPTURE_glGetVertexArrayIndexediv,
+	GL_CAPTURE_glGetVertexArrayiv,
+	GL_CAPTURE_glGetVertexAttribIiv,
+	GL_CAPTURE_glGetVertexAttribIuiv,
+	GL_CAPTURE_glGetVertexAttribLdv,
+	GL_CAPTURE_glGetVertexAttribLui64vARB,
+	GL_CAPTURE_glGetVertexAttribPointerv,
+	GL_CAPTURE_glGetVertexAttribdv,
+	GL_CAPTURE_glGetVertexAttribfv,
+	GL_CAPTURE_glGetVertexAttribiv,
+	GL_CAPTURE_glGetnColorTable,
+	GL_CAPTURE_glGetnCompressedTexImage,
+	GL_CAPTURE_glGetnConvolutionFilter,
+	GL_CAPTURE_glGetnHistogram,
+	GL_CAPTURE_glGetnMapdv,
+	GL_CAPTURE_glGetnMapfv,
+	GL_CAPTURE_glGetnMapiv,
+	GL_CAPTURE_glGetnMinmax,
+	GL_CAPTURE_glGetnPixelMapfv,
+	GL_CAPTURE_glGetnPixelMapuiv,
+	GL_CAPTURE_glGetnPixelMapusv,
+	GL_CAPTURE_glGetnPolygonStipple,
+	GL_CAPTURE_glGetnSeparableFilter,
+	GL_CAPTURE_glGetnTexImage,
+	GL_CAPTURE_glGetnUniformdv,
+	GL_CAPTURE_glGetnUniformfv,
+	GL_CAPTURE_glGetnUniformiv,
+	GL_CAPTURE_glGetnUniformuiv,
+	GL_CAPTURE_glHint,
+	GL_CAPTURE_glIndexMask,
+	GL_CAPTURE_glIndexPointer,
+	GL_CAPTURE_glIndexd,
+	GL_CAPTURE_glIndexdv,
+	GL_CAPTURE_glIndexf,
+	GL_CAPTURE_glIndexfv,
+	GL_CAPTURE_glIndexi,
+	GL_CAPTURE_glIndexiv,
+	GL_CAPTURE_glIndexs,
+	GL_CAPTURE_glIndexsv,
+	GL_CAPTURE_glIndexub,
+	GL_CAPTURE_glIndexubv,
+	GL_CAPTURE_glInitNames,
+	GL_CAPTURE_glInterleavedArrays,
+	GL_CAPTURE_glInvalidateBufferData,
+	GL_CAPTURE_glInvalidateBufferSubData,
+	GL_CAPTURE_glInvalidateFramebuffer,
+	GL_CAPTURE_glInvalidateNamedFramebufferData,
+	GL_CAPTURE_glInvalidateNamedFramebufferSubData,
+	GL_CAPTURE_glInvalidateSubFramebuffer,
+	GL_CAPTURE_glInvalidateTexImage,
+	GL_CAPTURE_glInvalidateTexSubImage,
+	GL_CAPTURE_glIsBuffer,
+	GL_CAPTURE_glIsEnabled,
+	GL_CAPTURE_glIsEnabledi,
+	GL_CAPTURE_glIsFramebuffer,
+	GL_CAPTURE_glIsImageHandleResidentARB,
+	GL_CAPTURE_glIsList,
+	GL_CAPTURE_glIsProgram,
+	GL_CAPTURE_glIsProgramPipeline,
+	GL_CAPTURE_glIsQuery,
+	GL_CAPTURE_glIsRenderbuffer,
+	GL_CAPTURE_glIsSampler,
+	GL_CAPTURE_glIsShader,
+	GL_CAPTURE_glIsSync,
+	GL_CAPTURE_glIsTexture,
+	GL_CAPTURE_glIsTextureHandleResidentARB,
+	GL_CAPTURE_glIsTransformFeedback,
+	GL_CAPTURE_glIsVertexArray,
+	GL_CAPTURE_glLightModelf,
+	GL_CAPTURE_glLightModelfv,
+	GL_CAPTURE_glLightModeli,
+	GL_CAPTURE_glLightModeliv,
+	GL_CAPTURE_glLightf,
+	GL_CAPTURE_glLightfv,
+	GL_CAPTURE_glLighti,
+	GL_CAPTURE_glLightiv,
+	GL_CAPTURE_glLineStipple,
+	GL_CAPTURE_glLineWidth,
+	GL_CAPTURE_glLinkProgram,
+	GL_CAPTURE_glListBase,
+	GL_CAPTURE_glLoadIdentity,
+	GL_CAPTURE_glLoadMatrixd,
+	GL_CAPTURE_glLoadMatrixf,
+	GL_CAPTURE_glLoadName,
+	GL_CAPTURE_glLoadTransposeMatrixd,
+	GL_CAPTURE_glLoadTransposeMatrixf,
+	GL_CAPTURE_glLogicOp,
+	GL_CAPTURE_glMakeImageHandleNonResidentARB,
+	GL_CAPTURE_glMakeImageHandleResidentARB,
+	GL_CAPTURE_glMakeTextureHandleNonResidentARB,
+	GL_CAPTURE_glMakeTextureHandleResidentARB,
+	GL_CAPTURE_glMap1d,
+	GL_CAPTURE_glMap1f,
+	GL_CAPTURE_glMap2d,
+	GL_CAPTURE_glMap2f,
+	GL_CAPTURE_glMapBuffer,
+	GL_CAPTURE_glMapBufferRange,
+	GL_CAPTURE_glMapGrid1d,
+	GL_CAPTURE_glMapGrid1f,
+	GL_CAPTURE_glMapGrid2d,
+	GL_CAPTURE_glMapGrid2f,
+	GL_CAPTURE_glMapNamedBuffer,
+	GL_CAPTURE_glMapNamedBufferRange,
+	GL_CAPTURE_glMaterialf,
+	GL_CAPTURE_glMaterialfv,
+	GL_CAPTURE_glMateriali,
+	GL_CAPTURE_glMaterialiv,
+	GL_CAPTURE_glMatrixMode,
+	GL_CAPTURE_glMaxShaderCompilerThreadsKHR,
+	GL_CAPTURE_glMemoryBarrier,
+	GL_CAPTURE_glMemoryBarrierByRegion,
+	GL_CAPTURE_glMinSampleShading,
+	GL_CAPTURE_glMultMatrixd,
+	GL_CAPTURE_glMultMatrixf,
+	GL_CAPTURE_glMultTransposeMatrixd,
+	GL_CAPTURE_glMultTransposeMatrixf,
+	GL_CAPTURE_glMultiDrawArrays,
+	GL_CAPTURE_glMultiDrawArraysIndirect,
+	GL_CAPTURE_glMultiDrawArraysIndirectCount,
+	GL_CAPTURE_glMultiDrawElements,
+	GL_CAPTURE_glMultiDrawElementsBaseVertex,
+	GL_CAPTURE_glMultiDrawElementsIndirect,
+	GL_CAPTURE_glMultiDrawElementsIndirectCount,
+	GL_CAPTURE_glMultiTexCoord1d,
+	GL_CAPTURE_glMultiTexCoord1dv,
+	GL_CAPTURE_glMultiTexCoord1f,
+	GL_CAPTURE_glMultiTexCoord1fv,
+	GL_CAPTURE_glMultiTexCoord1i,
+	GL_CAPTURE_glMultiTexCoord1iv,
+	GL_CAPTURE_glMultiTexCoord1s,
+	GL_CAPTURE_glMultiTexCoord1sv,
+	GL_CAPTURE_glMultiTexCoord2d,
+	GL_CAPTURE_glMultiTexCoord2dv,
+	GL_CAPTURE_glMultiTexCoord2f,
+	GL_CAPTURE_glMultiTexCoord2fv,
+	GL_CAPTURE_glMultiTexCoord2i,
+	GL_CAPTURE_glMultiTexCoord2iv,
+	GL_CAPTURE_glMultiTexCoord2s,
+	GL_CAPTURE_glMultiTexCoord2sv,
+	GL_CAPTURE_glMultiTexCoord3d,
+	GL_CAPTURE_glMultiTexCoord3dv,
+	GL_CAPTURE_glMultiTexCoord3f,
+	GL_CAPTURE_glMultiTexCoord3fv,
+	GL_CAPTURE_glMultiTexCoord3i,
+	GL_CAPTURE_glMultiTexCoord3iv,
+	GL_CAPTURE_glMultiTexCoord3s,
+	GL_CAPTURE_glMultiTexCoord3sv,
+	GL_CAPTURE_glMultiTexCoord4d,
+	GL_CAPTURE_glMultiTexCoord4dv,
+	GL_CAPTURE_glMultiTexCoord4f,
+	GL_CAPTURE_glMultiTexCoord4fv,
+	GL_CAPTURE_glMultiTexCoord4i,
+	GL_CAPTURE_glMultiTexCoord4iv,
+	GL_CAPTURE_glMultiTexCoord4s,
+	GL_CAPTURE_glMultiTexCoord4sv,
+	GL_CAPTURE_glMultiTexCoordP1ui,
+	GL_CAPTURE_glMultiTexCoordP1uiv,
+	GL_CAPTURE_glMultiTexCoordP2ui,
+	GL_CAPTURE_glMultiTexCoordP2uiv,
+	GL_CAPTURE_glMultiTexCoordP3ui,
+	GL_CAPTURE_glMultiTexCoordP3uiv,
+	GL_CAPTURE_glMultiTexCoordP4ui,
+	GL_CAPTURE_glMultiTexCoordP4uiv,
+	GL_CAPTURE_glNamedBufferData,
+	GL_CAPTURE_glNamedBufferStorage,
+	GL_CAPTURE_glNamedBufferStorageEXT,
+	GL_CAPTURE_glNamedBufferSubData,
+	GL_CAPTURE_glNamedFramebufferDrawBuffer,
+	GL_CAPTURE_glNamedFramebufferDrawBuffers,
+	GL_CAPTURE_glNamedFramebufferParameteri,
+	GL_CAPTURE_glNamedFramebufferReadBuffer,
+	GL_CAPTURE_glNamedFramebufferRenderbuffer,
+	GL_CAPTURE_glNamedFramebufferTexture,
+	GL_CAPTURE_glNamedFramebufferTextureLayer,
+	GL_CAPTURE_glNamedRenderbufferStorage,
+	GL_CAPTURE_glNamedRenderbufferStorageMultisample,
+	GL_CAPTURE_glNewList,
+	GL_CAPTURE_glNormal3b,
+	GL_CAPTURE_glNormal3bv,
+	GL_CAPTURE_glNormal3d,
+	GL_CAPTURE_glNormal3dv,
+	GL_CAPTURE_glNormal3f,
+	GL_CAPTURE_glNormal3fv,
+	GL_CAPTURE_glNormal3i,
+	GL_CAPTURE_glNormal3iv,
+	GL_CAPTURE_glNormal3s,
+	GL_CAPTURE_glNormal3sv,
+	GL_CAPTURE_glNormalP3ui,
+	GL_CAPTURE_glNormalP3uiv,
+	GL_CAPTURE_glNormalPointer,
+	GL_CAPTURE_glObjectLabel,
+	GL_CAPTURE_glObjectPtrLabel,
+	GL_CAPTURE_glOrtho,
+	GL_CAPTURE_glPassThrough,
+	GL_CAPTURE_glPatchParameterfv,
+	GL_CAPTURE_glPatchParameteri,
+	GL_CAPTURE_glPauseTransformFeedback,
+	GL_CAPTURE_glPixelMapfv,
+	GL_CAPTURE_glPixelMapuiv,
+	GL_CAPTURE_glPixelMapusv,
+	GL_CAPTURE_glPixelStoref,
+	GL_CAPTURE_glPixelStorei,
+	GL_CAPTURE_glPixelTransferf,
+	GL_CAPTURE_glPixelTransferi,
+	GL_CAPTURE_glPixelZoom,
+	GL_CAPTURE_glPointParameterf,
+	GL_CAPTURE_glPointParameterfv,
+	GL_CAPTURE_glPointParameteri,
+	GL_CAPTURE_glPointParameteriv,
+	GL_CAPTURE_glPointSize,
+	GL_CAPTURE_glPolygonMode,
+	GL_CAPTURE_glPolygonOffset,
+	GL_CAPTURE_glPolygonOffsetClamp,
+	GL_CAPTURE_glPolygonStipple,
+	GL_CAPTURE_glPopAttrib,
+	GL_CAPTURE_glPopClientAttrib,
+	GL_CAPTURE_glPopDebugGroup,
+	GL_CAPTURE_glPopMatrix,
+	GL_CAPTURE_glPopName,
+	GL_CAPTURE_glPrimitiveRestartIndex,
+	GL_CAPTURE_glPrioritizeTextures,
+	GL_CAPTURE_glProgramBinary,
+	GL_CAPTURE_glProgramParameteri,
+	GL_CAPTURE_glProgramUniform1d,
+	GL_CAPTURE_glProgramUniform1dv,
+	GL_CAPTURE_glProgramUniform1f,
+	GL_CAPTURE_glProgramUniform1fv,
+	GL_CAPTURE_glProgramUniform1i,
+	GL_CAPTURE_glProgramUniform1iv,
+	GL_CAPTURE_glProgramUniform1ui,
+	GL_CAPTURE_glProgramUniform1uiv,
+	GL_CAPTURE_glProgramUniform2d,
+	GL_CAPTURE_glProgramUniform2dv,
+	GL_CAPTURE_glProgramUniform2f,
+	GL_CAPTURE_glProgramUniform2fv,
+	GL_CAPTURE_glProgramUniform2i,
+	GL_CAPTURE_glProgramUniform2iv,
+	GL_CAPTURE_glProgramUniform2ui,
+	GL_CAPTURE_glProgramUniform2uiv,
+	GL_CAPTURE_glProgramUniform3d,
+	GL_CAPTURE_glProgramUniform3dv,
+	GL_CAPTURE_glProgramUniform3f,
+	GL_CAPTURE_glProgramUniform3fv,
+	GL_CAPTURE_glProgramUniform3i,
+	GL_CAPTURE_glProgramUniform3iv,
+	GL_CAPTURE_glProgramUniform3ui,
+	GL_CAPTURE_glProgramUniform3uiv,
+	GL_CAPTURE_glProgramUniform4d,
+	GL_CAPTURE_glProgramUniform4dv,
+	GL_CAPTURE_glProgramUniform4f,
+	GL_CAPTURE_glProgramUniform4fv,
+	GL_CAPTURE_glProgramUniform4i,
+	GL_CAPTURE_glProgramUniform4iv,
+	GL_CAPTURE_glProgramUniform4ui,
+	GL_CAPTURE_glProgramUniform4uiv,
+	GL_CAPTURE_glProgramUniformHandleui64ARB,
+	GL_CAPTURE_glProgramUniformHandleui64vARB,
+	GL_CAPTURE_glProgramUniformMatrix2dv,
+	GL_CAPTURE_glProgramUniformMatrix2fv,
+	GL_CAPTURE_glProgramUniformMatrix2x3dv,
+	GL_CAPTURE_glProgramUniformMatrix2x3fv,
+	GL_CAPTURE_glProgramUniformMatrix2x4dv,
+	GL_CAPTURE_glProgramUniformMatrix2x4fv,
+	GL_CAPTURE_glProgramUniformMatrix3dv,
+	GL_CAPTURE_glProgramUniformMatrix3fv,
+	GL_CAPTURE_glProgramUniformMatrix3x2dv,
+	GL_CAPTURE_glProgramUniformMatrix3x2fv,
+	GL_CAPTURE_glProgramUniformMatrix3x4dv,
+	GL_CAPTURE_glProgramUniformMatrix3x4fv,
+	GL_CAPTURE_glProgramUniformMatrix4dv,
+	GL_CAPTURE_glProgramUniformMatrix4fv,
+	GL_CAPTURE_glProgramUniformMatrix4x2dv,
+	GL_CAPTURE_glProgramUniformMatrix4x2fv,
+	GL_CAPTURE_glProgramUniformMatrix4x3dv,
+	GL_CAPTURE_glProgramUniformMatrix4x3fv,
+	GL_CAPTURE_glProvokingVertex,
+	GL_CAPTURE_glPushAttrib,
+	GL_CAPTURE_glPushClientAttrib,
+	GL_CAPTURE_glPushDebugGroup,
+	GL_CAPTURE_glPushMatrix,
+	GL_CAPTURE_glPushName,
+	GL_CAPTURE_glQueryCounter,
+	GL_CAPTURE_glRasterPos2d,
+	GL_CAPTURE_glRasterPos2dv,
+	GL_CAPTURE_glRasterPos2f,
+	GL_CAPTURE_glRasterPos2fv,
+	GL_CAPTURE_glRasterPos2i,
+	GL_CAPTURE_glRasterPos2iv,
+	GL_CAPTURE_glRasterPos2s,
+	GL_CAPTURE_glRasterPos2sv,
+	GL_CAPTURE_glRasterPos3d,
+	GL_CAPTURE_glRasterPos3dv,
+	GL_CAPTURE_glRasterPos3f,
+	GL_CAPTURE_glRasterPos3fv,
+	GL_CAPTURE_glRasterPos3i,
+	GL_CAPTURE_glRasterPos3iv,
+	GL_CAPTURE_glRasterPos3s,
+	GL_CAPTURE_glRasterPos3sv,
+	GL_CAPTURE_glRasterPos4d,
+	GL_CAPTURE_glRasterPos4dv,
+	GL_CAPTURE_glRasterPos4f,
+	GL_CAPTURE_glRasterPos4fv,
+	GL_CAPTURE_glRasterPos4i,
+	GL_CAPTURE_glRasterPos4iv,
+	GL_CAPTURE_glRasterPos4s,
+	GL_CAPTURE_glRasterPos4sv,
+	GL_CAPTURE_glReadBuffer,
+	GL_CAPTURE_glReadPixels,
+	GL_CAPTURE_glReadnPixels,
+	GL_CAPTURE_glRectd,
+	GL_CAPTURE_glRectdv,
+	GL_CAPTURE_glRectf,
+	GL_CAPTURE_glRectfv,
+	GL_CAPTURE_glRecti,
+	GL_CAPTURE_glRectiv,
+	GL_CAPTURE_glRects,
+	GL_CAPTURE_glRectsv,
+	GL_CAPTURE_glReleaseShaderCompiler,
+	GL_CAPTURE_glRenderMode,
+	GL_CAPTURE_glRenderbufferStorage,
+	GL_CAPTURE_glRenderbufferStorageMultisample,
+	GL_CAPTURE_glResumeTransformFeedback,
+	GL_CAPTURE_glRotated,
+	GL_CAPTURE_glRotatef,
+	GL_CAPTURE_glSampleCoverage,
+	GL_CAPTURE_glSampleMaski,
+	GL_CAPTURE_glSamplerParameterIiv,
+	GL_CAPTURE_glSamplerParameterIuiv,
+	GL_CAPTURE_glSamplerParameterf,
+	GL_CAPTURE_glSamplerParameterfv,
+	GL_CAPTURE_glSamplerParameteri,
+	GL_CAPTURE_glSamplerParameteriv,
+	GL_CAPTURE_glScaled,
+	GL_CAPTURE_glScalef,
+	GL_CAPTURE_glScissor,
+	GL_CAPTURE_glScissorArrayv,
+	GL_CAPTURE_glScissorIndexed,
+	GL_CAPTURE_glScissorIndexedv,
+	GL_CAPTURE_glSecondaryColor3b,
+	GL_CAPTURE_glSecondaryColor3bv,
+	GL_CAPTURE_glSecondaryColor3d,
+	GL_CAPTURE_glSecondaryColor3dv,
+	GL_CAPTURE_glSecondaryColor3f,
+	GL_CAPTURE_glSecondaryColor3fv,
+	GL_CAPTURE_glSecondaryColor3i,
+	GL_CAPTURE_glSecondaryColor3iv,
+	GL_CAPTURE_glSecondaryColor3s,
+	GL_CAPTURE_glSecondaryColor3sv,
+	GL_CAPTURE_glSecondaryColor3ub,
+	GL_CAPTURE_glSecondaryColor3ubv,
+	GL_CAPTURE_glSecondaryColor3ui,
+	GL_CAPTURE_glSecondaryColor3uiv,
+	GL_CAPTURE_glSecondaryColor3us,
+	GL_CAPTURE_glSecondaryColor3usv,
+	GL_CAPTURE_glSecondaryColorP3ui,
+	GL_CAPTURE_glSecondaryColorP3uiv,
+	GL_CAPTURE_glSecondaryColorPointer,
+	GL_CAPTURE_glSelectBuffer,
+	GL_CAPTURE_glShadeModel,
+	GL_CAPTURE_glShaderBinary,
+	GL_CAPTURE_glShaderSource,
+	GL_CAPTURE_glShaderStorageBlockBinding,
+	GL_CAPTURE_glSpecializeShader,
+	GL_CAPTURE_glSpecializeShaderARB,
+	GL_CAPTURE_glStencilFunc,
+	GL_CAPTURE_glStencilFuncSeparate,
+	GL_CAPTURE_glStencilMask,
+	GL_CAPTURE_glStencilMaskSeparate,
+	GL_CAPTURE_glStencilOp,
+	GL_CAPTURE_glStencilOpSeparate,
+	GL_CAPTURE_glTexBuffer,
+	GL_CAPTURE_glTexBufferRange,
+	GL_CAPTURE_glTexCoord1d,
+	GL_CAPTURE_glTexCoord1dv,
+	GL_CAPTURE_glTexCoord1f,
+	GL_CAPTURE_glTexCoord1fv,
+	GL_CAPTURE_glTexCoord1i,
+	GL_CAPTURE_glTexCoord1iv,
+	GL_CAPTURE_glTexCoord1s,
+	GL_CAPTURE_glTexCoord1sv,
+	GL_CAPTURE_glTexCoord2d,
+	GL_CAPTURE_glTexCoord2dv,
+	GL_CAPTURE_glTexCoord2f,
+	GL_CAPTURE_glTexCoord2fv,
+	GL_CAPTURE_glTexCoord2i,
+	GL_CAPTURE_glTexCoord2iv,
+	GL_CAPTURE_glTexCoord2s,
+	GL_CAPTURE_glTexCoord2sv,
+	GL_CAPTURE_glTexCoord3d,
+	GL_CAPTURE_glTexCoord3dv,
+	GL_CAPTURE_glTexCoord3f,
+	GL_CAPTURE_glTexCoord3fv,
+	GL_CAPTURE_glTexCoord3i,
+	GL_CAPTURE_glTexCoord3iv,
+	GL_CAPTURE_glTexCoord3s,
+	GL_CAPTURE_glTexCoord3sv,
+	GL_CAPTURE_glTexCoord4d,
+	GL_CAPTURE_glTexCoord4dv,
+	GL_CAPTURE_glTexCoord4f,
+	GL_CAPTURE_glTexCoord4fv,
+	GL_CAPTURE_glTexCoord4i,
+	GL_CAPTURE_glTexCoord4iv,
+	GL_CAPTURE_glTexCoord4s,
+	GL_CAPTURE_glTexCoord4sv,
+	GL_CAPTURE_glTexCoordP1ui,
+	GL_CAPTURE_glTexCoordP1uiv,
+	GL_CAPTURE_glTexCoordP2ui,
+	GL_CAPTURE_glTexCoordP2uiv,
+	GL_CAPTURE_glTexCoordP3ui,
+	GL_CAPTURE_glTexCoordP3uiv,
+	GL_CAPTURE_glTexCoordP4ui,
+	GL_CAPTURE_glTexCoordP4uiv,
+	GL_CAPTURE_glTexCoordPointer,
+	GL_CAPTURE_glTexEnvf,
+	GL_CAPTURE_glTexEnvfv,
+	GL_CAPTURE_glTexEnvi,
+	GL_CAPTURE_glTexEnviv,
+	GL_CAPTURE_glTexGend,
+	GL_CAPTURE_glTexGendv,
+	GL_CAPTURE_glTexGenf,
+	GL_CAPTURE_glTexGenfv,
+	GL_CAPTURE_glTexGeni,
+	GL_CAPTURE_glTexGeniv,
+	GL_CAPTURE_glTexImage1D,
+	GL_CAPTURE_glTexImage2D,
+	GL_CAPTURE_glTexImage2DMultisample,
+	GL_CAPTURE_glTexImage3D,
+	GL_CAPTURE_glTexImage3DMultisample,
+	GL_CAPTURE_glTexParameterIiv,
+	GL_CAPTURE_glTexParameterIuiv,
+	GL_CAPTURE_glTexParameterf,
+	GL_CAPTURE_glTexParameterfv,
+	GL_CAPTURE_glTexParameteri,
+	GL_CAPTURE_glTexParameteriv,
+	GL_CAPTURE_glTexStorage1D,
+	GL_CAPTURE_glTexStorage2D,
+	GL_CAPTURE_glTexStorage2DMultisample,
+	GL_CAPTURE_glTexStorage3D,
+	GL_CAPTURE_glTexStorage3DMultisample,
+	GL_CAPTURE_glTexSubImage1D,
+	GL_CAPTURE_glTexSubImage2D,
+	GL_CAPTURE_glTexSubImage3D,
+	GL_CAPTURE_glTextureBarrier,
+	GL_CAPTURE_glTextureBuffer,
+	GL_CAPTURE_glTextureBufferRange,
+	GL_CAPTURE_glTextureParameterIiv,
+	GL_CAPTURE_glTextureParameterIuiv,
+	GL_CAPTURE_glTextureParameterf,
+	GL_CAPTURE_glTextureParameterfv,
+	GL_CAPTURE_glTextureParameteri,
+	GL_CAPTURE_glTextureParameteriv,
+	GL_CAPTURE_glTextureStorage1D,
+	GL_CAPTURE_glTextureStorage2D,
+	GL_CAPTURE_glTextureStorage2DMultisample,
+	GL_CAPTURE_glTextureStorage3D,
+	GL_CAPTURE_glTextureStorage3DMultisample,
+	GL_CAPTURE_glTextureSubImage1D,
+	GL_CAPTURE_glTextureSubImage2D,
+	GL_CAPTURE_glTextureSubImage3D,
+	GL_CAPTURE_glTextureView,
+	GL_CAPTURE_glTransformFeedbackBufferBase,
+	GL_CAPTURE_glTransformFeedbackBufferRange,
+	GL_CAPTURE_glTransformFeedbackVaryings,
+	GL_CAPTURE_glTranslated,
+	GL_CAPTURE_glTranslatef,
+	GL_CAPTURE_glUniform1d,
+	GL_CAPTURE_glUniform1dv,
+	GL_CAPTURE_glUniform1f,
+	GL_CAPTURE_glUniform1fv,
+	GL_CAPTURE_glUniform1i,
+	GL_CAPTURE_glUniform1iv,
+	GL_CAPTURE_glUniform1ui,
+	GL_CAPTURE_glUniform1uiv,
+	GL_CAPTURE_glUniform2d,
+	GL_CAPTURE_glUniform2dv,
+	GL_CAPTURE_glUniform2f,
+	GL_CAPTURE_glUniform2fv,
+	GL_CAPTURE_glUniform2i,
+	GL_CAPTURE_glUniform2iv,
+	GL_CAPTURE_glUniform2ui,
+	GL_CAPTURE_glUniform2uiv,
+	GL_CAPTURE_glUniform3d,
+	GL_CAPTURE_glUniform3dv,
+	GL_CAPTURE_glUniform3f,
+	GL_CAPTURE_glUniform3fv,
+	GL_CAPTURE_glUniform3i,
+	GL_CAPTURE_glUniform3iv,
+	GL_CAPTURE_glUniform3ui,
+	GL_CAPTURE_glUniform3uiv,
+	GL_CAPTURE_glUniform4d,
+	GL_CAPTURE_glUniform4dv,
+	GL_CAPTURE_glUniform4f,
+	GL_CAPTURE_glUniform4fv,
+	GL_CAPTURE_glUniform4i,
+	GL_CAPTURE_glUniform4iv,
+	GL_CAPTURE_glUniform4ui,
+	GL_CAPTURE_glUniform4uiv,
+	GL_CAPTURE_glUniformBlockBinding,
+	GL_CAPTURE_glUniformHandleui64ARB,
+	GL_CAPTURE_glUniformHandleui64vARB,
+	GL_CAPTURE_glUniformMatrix2dv,
+	GL_CAPTURE_glUniformMatrix2fv,
+	GL_CAPTURE_glUniformMatrix2x3dv,
+	GL_CAPTURE_glUniformMatrix2x3fv,
+	GL_CAPTURE_glUniformMatrix2x4dv,
+	GL_CAPTURE_glUniformMatrix2x4fv,
+	GL_CAPTURE_glUniformMatrix3dv,
+	GL_CAPTURE_glUniformMatrix3fv,
+	GL_CAPTURE_glUniformMatrix3x2dv,
+	GL_CAPTURE_glUniformMatrix3x2fv,
+	GL_CAPTURE_glUniformMatrix3x4dv,
+	GL_CAPTURE_glUniformMatrix3x4fv,
+	GL_CAPTURE_glUniformMatrix4dv,
+	GL_CAPTURE_glUniformMatrix4fv,
+	GL_CAPTURE_glUniformMatrix4x2dv,
+	GL_CAPTURE_glUniformMatrix4x2fv,
+	GL_CAPTURE_glUniformMatrix4x3dv,
+	GL_CAPTURE_glUniformMatrix4x3fv,
+	GL_CAPTURE_glUniformSubroutinesuiv,
+	GL_CAPTURE_glUnmapBuffer,
+	GL_CAPTURE_glUnmapNamedBuffer,
+	GL_CAPTURE_glUseProgram,
+	GL_CAPTURE_glUseProgramStages,
+	GL_CAPTURE_glValidateProgram,
+	GL_CAPTURE_glValidateProgramPipeline,
+	GL_CAPTURE_glVertex2d,
+	GL_CAPTURE_glVertex2dv,
+	GL_CAPTURE_glVertex2f,
+	GL_CAPTURE_glVertex2fv,
+	GL_CAPTURE_glVertex2i,
+	GL_CAPTURE_glVertex2iv,
+	GL_CAPTURE_glVertex2s,
+	GL_CAPTURE_glVertex2sv,
+	GL_CAPTURE_glVertex3d,
+	GL_CAPTURE_glVertex3dv,
+	GL_CAPTURE_glVertex3f,
+	GL_CAPTURE_glVertex3fv,
+	GL_CAPTURE_glVertex3i,
+	GL_CAPTURE_glVertex3iv,
+	GL_CAPTURE_glVertex3s,
+	GL_CAPTURE_glVertex3sv,
+	GL_CAPTURE_glVertex4d,
+	GL_CAPTURE_glVertex4dv,
+	GL_CAPTURE_glVertex4f,
+	GL_CAPTURE_glVertex4fv,
+	GL_CAPTURE_glVertex4i,
+	GL_CAPTURE_glVertex4iv,
+	GL_CAPTURE_glVertex4s,
+	GL_CAPTURE_glVertex4sv,
+	GL_CAPTURE_glVertexArrayAttribBinding,
+	GL_CAPTURE_glVertexArrayAttribFormat,
+	GL_CAPTURE_glVertexArrayAttribIFormat,
+	GL_CAPTURE_glVertexArrayAttribLFormat,
+	GL_CAPTURE_glVertexArrayBindingDivisor,
+	GL_CAPTURE_glVertexArrayElementBuffer,
+	GL_CAPTURE_glVertexArrayVertexBuffer,
+	GL_CAPTURE_glVertexArrayVertexBuffers,
+	GL_CAPTURE_glVertexAttrib1d,
+	GL_CAPTURE_glVertexAttrib1dv,
+	GL_CAPTURE_glVertexAttrib1f,
+	GL_CAPTURE_glVertexAttrib1fv,
+	GL_CAPTURE_glVertexAttrib1s,
+	GL_CAPTURE_glVertexAttrib1sv,
+	GL_CAPTURE_glVertexAttrib2d,
+	GL_CAPTURE_glVertexAttrib2dv,
+	GL_CAPTURE_glVertexAttrib2f,
+	GL_CAPTURE_glVertexAttrib2fv,
+	GL_CAPTURE_glVertexAttrib2s,
+	GL_CAPTURE_glVertexAttrib2sv,
+	GL_CAPTURE_glVertexAttrib3d,
+	GL_CAPTURE_glVertexAttrib3dv,
+	GL_CAPTURE_glVertexAttrib3f,
+	GL_CAPTURE_glVertexAttrib3fv,
+	GL_CAPTURE_glVertexAttrib3s,
+	GL_CAPTURE_glVertexAttrib3sv,
+	GL_CAPTURE_glVertexAttrib4Nbv,
+	GL_CAPTURE_glVertexAttrib4Niv,
+	GL_CAPTURE_glVertexAttrib4Nsv,
+	GL_CAPTURE_glVertexAttrib4Nub,
+	GL_CAPTURE_glVertexAttrib4Nubv,
+	GL_CAPTURE_glVertexAttrib4Nuiv,
+	GL_CAPTURE_glVertexAttrib4Nusv,
+	GL_CAPTURE_glVertexAttrib4bv,
+	GL_CAPTURE_glVertexAttrib4d,
+	GL_CAPTURE_glVertexAttrib4dv,
+	GL_CAPTURE_glVertexAttrib4f,
+	GL_CAPTURE_glVertexAttrib4fv,
+	GL_CAPTURE_glVertexAttrib4iv,
+	GL_CAPTURE_glVertexAttrib4s,
+	GL_CAPTURE_glVertexAttrib4sv,
+	GL_CAPTURE_glVertexAttrib4ubv,
+	GL_CAPTURE_glVertexAttrib4uiv,
+	GL_CAPTURE_glVertexAttrib4usv,
+	GL_CAPTURE_glVertexAttribBinding,
+	GL_CAPTURE_glVertexAttribDivisor,
+	GL_CAPTURE_glVertexAttribFormat,
+	GL_CAPTURE_glVertexAttribI1i,
+	GL_CAPTURE_glVertexAttribI1iv,
+	GL_CAPTURE_glVertexAttribI1ui,
+	GL_CAPTURE_glVertexAttribI1uiv,
+	GL_CAPTURE_glVertexAttribI2i,
+	GL_CAPTURE_glVertexAttribI2iv,
+	GL_CAPTURE_glVertexAttribI2ui,
+	GL_CAPTURE_glVertexAttribI2uiv,
+	GL_CAPTURE_glVertexAttribI3i,
+	GL_CAPTURE_glVertexAttribI3iv,
+	GL_CAPTURE_glVertexAttribI3ui,
+	GL_CAPTURE_glVertexAttribI3uiv,
+	GL_CAPTURE_glVertexAttribI4bv,
+	GL_CAPTURE_glVertexAttribI4i,
+	GL_CAPTURE_glVertexAttribI4iv,
+	GL_CAPTURE_glVertexAttribI4sv,
+	GL_CAPTURE_glVertexAttribI4ubv,
+	GL_CAPTURE_glVertexAttribI4ui,
+	GL_CAPTURE_glVertexAttribI4uiv,
+	GL_CAPTURE_glVertexAttribI4usv,
+	GL_CAPTURE_glVertexAttribIFormat,
+	GL_CAPTURE_glVertexAttribIPointer,
+	GL_CAPTURE_glVertexAttribL1d,
+	GL_CAPTURE_glVertexAttribL1dv,
+	GL_CAPTURE_glVertexAttribL1ui64ARB,
+	GL_CAPTURE_glVertexAttribL1ui64vARB,
+	GL_CAPTURE_glVertexAttribL2d,
+	GL_CAPTURE_glVertexAttribL2dv,
+	GL_CAPTURE_glVertexAttribL3d,
+	GL_CAPTURE_glVertexAttribL3dv,
+	GL_CAPTURE_glVertexAttribL4d,
+	GL_CAPTURE_glVertexAttribL4dv,
+	GL_CAPTURE_glVertexAttribLFormat,
+	GL_CAPTURE_glVertexAttribLPointer,
+	GL_CAPTURE_glVertexAttribP1ui,
+	GL_CAPTURE_glVertexAttribP1uiv,
+	GL_CAPTURE_glVertexAttribP2ui,
+	GL_CAPTURE_glVertexAttribP2uiv,
+	GL_CAPTURE_glVertexAttribP3ui,
+	GL_CAPTURE_glVertexAttribP3uiv,
+	GL_CAPTURE_glVertexAttribP4ui,
+	GL_CAPTURE_glVertexAttribP4uiv,
+	GL_CAPTURE_glVertexAttribPointer,
+	GL_CAPTURE_glVertexBindingDivisor,
+	GL_CAPTURE_glVertexP2ui,
+	GL_CAPTURE_glVertexP2uiv,
+	GL_CAPTURE_glVertexP3ui,
+	GL_CAPTURE_glVertexP3uiv,
+	GL_CAPTURE_glVertexP4ui,
+	GL_CAPTURE_glVertexP4uiv,
+	GL_CAPTURE_glVertexPointer,
+	GL_CAPTURE_glViewport,
+	GL_CAPTURE_glViewportArrayv,
+	GL_CAPTURE_glViewportIndexedf,
+	GL_CAPTURE_glViewportIndexedfv,
+	GL_CAPTURE_glWaitSync,
+	GL_CAPTURE_glWindowPos2d,
+	GL_CAPTURE_glWindowPos2dv,
+	GL_CAPTURE_glWindowPos2f,
+	GL_CAPTURE_glWindowPos2fv,
+	GL_CAPTURE_glWindowPos2i,
+	GL_CAPTURE_glWindowPos2iv,
+	GL_CAPTURE_glWindowPos2s,
+	GL_CAPTURE_glWindowPos2sv,
+	GL_CAPTURE_glWindowPos3d,
+	GL_CAPTURE_glWindowPos3dv,
+	GL_CAPTURE_glWindowPos3f,
+	GL_CAPTURE_glWindowPos3fv,
+	GL_CAPTURE_glWindowPos3i,
+	GL_CAPTURE_glWindowPos3iv,
+	GL_CAPTURE_glWindowPos3s,
+	GL_CAPTURE_glWindowPos3sv,
+	GL_CAPTURE_FUNCTION_COUNT
+};
+
+extern const GLcaptureFunction gl_capture_functions[GL_CAPTURE_FUNCTION_COUNT];
+
+/* 1: glad's pointers are replaced by the capture wrappers, 0: the driver entry points are put back. Only loaded functions are wrapped. */
+void gl_capture_layer_install(int capture);
+
+extern PFNGLACCUMPROC glad_capture_real_glAccum;
+extern PFNGLACTIVESHADERPROGRAMPROC glad_capture_real_glActiveShaderProgram;
+extern PFNGLACTIVETEXTUREPROC glad_capture_real_glActiveTexture;
+extern PFNGLALPHAFUNCPROC glad_capture_real_glAlphaFunc;
+extern PFNGLARETEXTURESRESIDENTPROC glad_capture_real_glAreTexturesResident;
+extern PFNGLARRAYELEMENTPROC glad_capture_real_glArrayElement;
+extern PFNGLATTACHSHADERPROC glad_capture_real_glAttachShader;
+extern PFNGLBEGINPROC glad_capture_real_glBegin;
+extern PFNGLBEGINCONDITIONALRENDERPROC glad_capture_real_glBeginConditionalRender;
+extern PFNGLBEGINQUERYPROC glad_capture_real_glBeginQuery;
+extern PFNGLBEGINQUERYINDEXEDPROC glad_capture_real_glBeginQueryIndexed;
+extern PFNGLBEGINTRANSFORMFEEDBACKPROC glad_capture_real_glBeginTransformFeedback;
+extern PFNGLBINDATTRIBLOCATIONPROC glad_capture_real_glBindAttribLocation;
+extern PFNGLBINDBUFFERPROC glad_capture_real_glBindBuffer;
+extern PFNGLBINDBUFFERBASEPROC glad_capture_real_glBindBufferBase;
+extern PFNGLBINDBUFFERRANGEPROC glad_capture_real_glBindBufferRange;
+extern PFNGLBINDBUFFERSBASEPROC glad_capture_real_glBindBuffersBase;
+extern PFNGLBINDBUFFERSRANGEPROC glad_capture_real_glBindBuffersRange;
+extern PFNGLBINDFRAGDATALOCATIONPROC glad_capture_real_glBindFragDataLocation;
+extern PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_capture_real_glBindFragDataLocationIndexed;
+extern PFNGLBINDFRAMEBUFFERPROC glad_capture_real_glBindFramebuffer;
+extern PFNGLBINDIMAGETEXTUREPROC glad_capture_real_glBindImageTexture;
+extern PFNGLBINDIMAGETEXTURESPROC glad_capture_real_glBindImageTextures;
+extern PFNGLBINDPROGRAMPIPELINEPROC glad_capture_real_glBindProgramPipeline;
+extern PFNGLBINDRENDERBUFFERPROC glad_capture_real_glBindRenderbuffer;
+extern PFNGLBINDSAMPLERPROC glad_capture_real_glBindSampler;
+extern PFNGLBINDSAMPLERSPROC glad_capture_real_glBindSamplers;
+extern PFNGLBINDTEXTUREPROC glad_capture_real_glBindTexture;
+extern PFNGLBINDTEXTUREUNITPROC glad_capture_real_glBindTextureUnit;
+extern PFNGLBINDTEXTURESPROC glad_capture_real_glBindTextures;
+extern PFNGLBINDTRANSFORMFEEDBACKPROC glad_capture_real_glBindTransformFeedback;
+extern PFNGLBINDVERTEXARRAYPROC glad_capture_real_glBindVertexArray;
+extern PFNGLBINDVERTEXBUFFERPROC glad_capture_real_glBindVertexBuffer;
+extern PFNGLBINDVERTEXBUFFERSPROC glad_capture_real_glBindVertexBuffers;
+extern PFNGLBITMAPPROC glad_capture_real_glBitmap;
+extern PFNGLBLENDCOLORPROC glad_capture_real_glBlendColor;
+extern PFNGLBLENDEQUATIONPROC glad_capture_real_glBlendEquation;
+extern PFNGLBLENDEQUATIONSEPARATEPROC glad_capture_real_glBlendEquationSeparate;
+extern PFNGLBLENDEQUATIONSEPARATEIPROC glad_capture_real_glBlendEquationSeparatei;
+extern PFNGLBLENDEQUATIONIPROC glad_capture_real_glBlendEquationi;
+extern PFNGLBLENDFUNCPROC glad_capture_real_glBlendFunc;
+extern PFNGLBLENDFUNCSEPARATEPROC glad_capture_real_glBlendFuncSeparate;
+extern PFNGLBLENDFUNCSEPARATEIPROC glad_capture_real_glBlendFuncSeparatei;
+extern PFNGLBLENDFUNCIPROC glad_capture_real_glBlendFunci;
+extern PFNGLBLITFRAMEBUFFERPROC glad_capture_real_glBlitFramebuffer;
+extern PFNGLBLITNAMEDFRAMEBUFFERPROC glad_capture_real_glBlitNamedFramebuffer;
+extern PFNGLBUFFERDATAPROC glad_capture_real_glBufferData;
+extern PFNGLBUFFERSTORAGEPROC glad_capture_real_glBufferStorage;
+extern PFNGLBUFFERSUBDATAPROC glad_capture_real_glBufferSubData;
+extern PFNGLCALLLISTPROC glad_capture_real_glCallList;
+extern PFNGLCALLLISTSPROC glad_capture_real_glCallLists;
+extern PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_capture_real_glCheckFramebufferStatus;
+extern PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC glad_capture_real_glCheckNamedFramebufferStatus;
+extern PFNGLCLAMPCOLORPROC glad_capture_real_glClampColor;
+extern PFNGLCLEARPROC glad_capture_real_glClear;
+extern PFNGLCLEARACCUMPROC glad_capture_real_glClearAccum;
+extern PFNGLCLEARBUFFERDATAPROC glad_capture_real_glClearBufferData;
+extern PFNGLCLEARBUFFERSUBDATAPROC glad_capture_real_glClearBufferSubData;
+extern PFNGLCLEARBUFFERFIPROC glad_capture_real_glClearBufferfi;
+extern PFNGLCLEARBUFFERFVPROC glad_capture_real_glClearBufferfv;
+extern PFNGLCLEARBUFFERIVPROC glad_capture_real_glClearBufferiv;
+extern PFNGLCLEARBUFFERUIVPROC glad_capture_real_glClearBufferuiv;
+extern PFNGLCLEARCOLORPROC glad_capture_real_glClearColor;
+extern PFNGLCLEARDEPTHPROC glad_capture_real_glClearDepth;
+extern PFNGLCLEARDEPTHFPROC glad_capture_real_glClearDepthf;
+extern PFNGLCLEARINDEXPROC glad_capture_real_glClearIndex;
+extern PFNGLCLEARNAMEDBUFFERDATAPROC glad_capture_real_glClearNamedBufferData;
+extern PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_capture_real_glClearNamedBufferSubData;
+extern PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_capture_real_glClearNamedFramebufferfi;
+extern PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_capture_real_glClearNamedFramebufferfv;
+extern PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_capture_real_glClearNamedFramebufferiv;
+extern PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_capture_real_glClearNamedFramebufferuiv;
+extern PFNGLCLEARSTENCILPROC glad_capture_real_glClearStencil;
+extern PFNGLCLEARTEXIMAGEPROC glad_capture_real_glClearTexImage;
+extern PFNGLCLEARTEXSUBIMAGEPROC glad_capture_real_glClearTexSubImage;
+extern PFNGLCLIENTACTIVETEXTUREPROC glad_capture_real_glClientActiveTexture;
+extern PFNGLCLIENTWAITSYNCPROC glad_capture_real_glClientWaitSync;
+extern PFNGLCLIPCONTROLPROC glad_capture_real_glClipControl;
+extern PFNGLCLIPPLANEPROC glad_capture_real_glClipPlane;
+extern PFNGLCOLOR3BPROC glad_capture_real_glColor3b;
+extern PFNGLCOLOR3BVPROC glad_capture_real_glColor3bv;
+extern PFNGLCOLOR3DPROC glad_capture_real_glColor3d;
+extern PFNGLCOLOR3DVPROC glad_capture_real_glColor3dv;
+extern PFNGLCOLOR3FPROC glad_capture_real_glColor3f;
+extern PFNGLCOLOR3FVPROC glad_capture_real_glColor3fv;
+extern PFNGLCOLOR3IPROC glad_capture_real_glColor3i;
+extern PFNGLCOLOR3IVPROC glad_capture_real_glColor3iv;
+extern PFNGLCOLOR3SPROC glad_capture_real_glColor3s;
+extern PFNGLCOLOR3SVPROC glad_capture_real_glColor3sv;
+extern PFNGLCOLOR3UBPROC glad_capture_real_glColor3ub;
+extern PFNGLCOLOR3UBVPROC glad_capture_real_glColor3ubv;
+extern PFNGLCOLOR3UIPROC glad_capture_real_glColor3ui;
+extern PFNGLCOLOR3UIVPROC glad_capture_real_glColor3uiv;
+extern PFNGLCOLOR3USPROC glad_capture_real_glColor3us;
+extern PFNGLCOLOR3USVPROC glad_capture_real_glColor3usv;
+extern PFNGLCOLOR4BPROC glad_capture_real_glColor4b;
+extern PFNGLCOLOR4BVPROC glad_capture_real_glColor4bv;
+extern PFNGLCOLOR4DPROC glad_capture_real_glColor4d;
+extern PFNGLCOLOR4DVPROC glad_capture_real_glColor4dv;
+extern PFNGLCOLOR4FPROC glad_capture_real_glColor4f;
+extern PFNGLCOLOR4FVPROC glad_capture_real_glColor4fv;
+extern PFNGLCOLOR4IPROC glad_capture_real_glColor4i;
+extern PFNGLCOLOR4IVPROC glad_capture_real_glColor4iv;
+extern PFNGLCOLOR4SPROC glad_capture_real_glColor4s;
+extern PFNGLCOLOR4SVPROC glad_capture_real_glColor4sv;
+extern PFNGLCOLOR4UBPROC glad_capture_real_glColor4ub;
+extern PFNGLCOLOR4UBVPROC glad_capture_real_glColor4ubv;
+extern PFNGLCOLOR4UIPROC glad_capture_real_glColor4ui;
+extern PFNGLCOLOR4UIVPROC glad_capture_real_glColor4uiv;
+extern PFNGLCOLOR4USPROC glad_capture_real_glColor4us;
+extern PFNGLCOLOR4USVPROC glad_capture_real_glColor4usv;
+extern PFNGLCOLORMASKPROC glad_capture_real_glColorMask;
+extern PFNGLCOLORMASKIPROC glad_capture_real_glColorMaski;
+extern PFNGLCOLORMATERIALPROC glad_capture_real_glColorMaterial;
+extern PFNGLCOLORP3UIPROC glad_capture_real_glColorP3ui;
+extern PFNGLCOLORP3UIVPROC glad_capture_real_glColorP3uiv;
+extern PFNGLCOLORP4UIPROC glad_capture_real_glColorP4ui;
+extern PFNGLCOLORP4UIVPROC glad_capture_real_glColorP4uiv;
+extern PFNGLCOLORPOINTERPROC glad_capture_real_glColorPointer;
+extern PFNGLCOMPILESHADERPROC glad_capture_real_glCompileShader;
+extern PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_capture_real_glCompressedTexImage1D;
+extern PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_capture_real_glCompressedTexImage2D;
+extern PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_capture_real_glCompressedTexImage3D;
+extern PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_capture_real_glCompressedTexSubImage1D;
+extern PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_capture_real_glCompressedTexSubImage2D;
+extern PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_capture_real_glCompressedTexSubImage3D;
+extern PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_capture_real_glCompressedTextureSubImage1D;
+extern PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_capture_real_glCompressedTextureSubImage2D;
+extern PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_capture_real_glCompressedTextureSubImage3D;
+extern PFNGLCOPYBUFFERSUBDATAPROC glad_capture_real_glCopyBufferSubData;
+extern PFNGLCOPYIMAGESUBDATAPROC glad_capture_real_glCopyImageSubData;
+extern PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_capture_real_glCopyNamedBufferSubData;
+extern PFNGLCOPYPIXELSPROC glad_capture_real_glCopyPixels;
+extern PFNGLCOPYTEXIMAGE1DPROC glad_capture_real_glCopyTexImage1D;
+extern PFNGLCOPYTEXIMAGE2DPROC glad_capture_real_glCopyTexImage2D;
+extern PFNGLCOPYTEXSUBIMAGE1DPROC glad_capture_real_glCopyTexSubImage1D;
+extern PFNGLCOPYTEXSUBIMAGE2DPROC glad_capture_real_glCopyTexSubImage2D;
+extern PFNGLCOPYTEXSUBIMAGE3DPROC glad_capture_real_glCopyTexSubImage3D;
+extern PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_capture_real_glCopyTextureSubImage1D;
+extern PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_capture_real_glCopyTextureSubImage2D;
+extern PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_capture_real_glCopyTextureSubImage3D;
+extern PFNGLCREATEBUFFERSPROC glad_capture_real_glCreateBuffers;
+extern PFNGLCREATEFRAMEBUFFERSPROC glad_capture_real_glCreateFramebuffers;
+extern PFNGLCREATEPROGRAMPROC glad_capture_real_glCreateProgram;
+extern PFNGLCREATEPROGRAMPIPELINESPROC glad_capture_real_glCreateProgramPipelines;
+extern PFNGLCREATEQUERIESPROC glad_capture_real_glCreateQueries;
+extern PFNGLCREATERENDERBUFFERSPROC glad_capture_real_glCreateRenderbuffers;
+extern PFNGLCREATESAMPLERSPROC glad_capture_real_glCreateSamplers;
+extern PFNGLCREATESHADERPROC glad_capture_real_glCreateShader;
+extern PFNGLCREATESHADERPROGRAMVPROC glad_capture_real_glCreateShaderProgramv;
+extern PFNGLCREATETEXTURESPROC glad_capture_real_glCreateTextures;
+extern PFNGLCREATETRANSFORMFEEDBACKSPROC glad_capture_real_glCreateTransformFeedbacks;
+extern PFNGLCREATEVERTEXARRAYSPROC glad_capture_real_glCreateVertexArrays;
+extern PFNGLCULLFACEPROC glad_capture_real_glCullFace;
+extern PFNGLDEBUGMESSAGECALLBACKPROC glad_capture_real_glDebugMessageCallback;
+extern PFNGLDEBUGMESSAGECONTROLPROC glad_capture_real_glDebugMessageControl;
+extern PFNGLDEBUGMESSAGEINSERTPROC glad_capture_real_glDebugMessageInsert;
+extern PFNGLDELETEBUFFERSPROC glad_capture_real_glDeleteBuffers;
+extern PFNGLDELETEFRAMEBUFFERSPROC glad_capture_real_glDeleteFramebuffers;
+extern PFNGLDELETELISTSPROC glad_capture_real_glDeleteLists;
+extern PFNGLDELETEPROGRAMPROC glad_capture_real_glDeleteProgram;
+extern PFNGLDELETEPROGRAMPIPELINESPROC glad_capture_real_glDeleteProgramPipelines;
+extern PFNGLDELETEQUERIESPROC glad_capture_real_glDeleteQueries;
+extern PFNGLDELETERENDERBUFFERSPROC glad_capture_real_glDeleteRenderbuffers;
+extern PFNGLDELETESAMPLERSPROC glad_capture_real_glDeleteSamplers;
+extern PFNGLDELETESHADERPROC glad_capture_real_glDeleteShader;
+extern PFNGLDELETESYNCPROC glad_capture_real_glDeleteSync;
+extern PFNGLDELETETEXTURESPROC glad_capture_real_glDeleteTextures;
+extern PFNGLDELETETRANSFORMFEEDBACKSPROC glad_capture_real_glDeleteTransformFeedbacks;
+extern PFNGLDELETEVERTEXARRAYSPROC glad_capture_real_glDeleteVertexArrays;
+extern PFNGLDEPTHFUNCPROC glad_capture_real_glDepthFunc;
+extern PFNGLDEPTHMASKPROC glad_capture_real_glDepthMask;
+extern PFNGLDEPTHRANGEPROC glad_capture_real_glDepthRange;
+extern PFNGLDEPTHRANGEARRAYVPROC glad_capture_real_glDepthRangeArrayv;
+extern PFNGLDEPTHRANGEINDEXEDPROC glad_capture_real_glDepthRangeIndexed;
+extern PFNGLDEPTHRANGEFPROC glad_capture_real_glDepthRangef;
+extern PFNGLDETACHSHADERPROC glad_capture_real_glDetachShader;
+extern PFNGLDISABLEPROC glad_capture_real_glDisable;
+extern PFNGLDISABLECLIENTSTATEPROC glad_capture_real_glDisableClientState;
+extern PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_capture_real_glDisableVertexArrayAttrib;
+extern PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_capture_real_glDisableVertexAttribArray;
+extern PFNGLDISABLEIPROC glad_capture_real_glDisablei;
+extern PFNGLDISPATCHCOMPUTEPROC glad_capture_real_glDispatchCompute;
+extern PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_capture_real_glDispatchComputeIndirect;
+extern PFNGLDRAWARRAYSPROC glad_capture_real_glDrawArrays;
+extern PFNGLDRAWARRAYSINDIRECTPROC glad_capture_real_glDrawArraysIndirect;
+extern PFNGLDRAWARRAYSINSTANCEDPROC glad_capture_real_glDrawArraysInstanced;
+extern PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_capture_real_glDrawArraysInstancedBaseInstance;
+extern PFNGLDRAWBUFFERPROC glad_capture_real_glDrawBuffer;
+extern PFNGLDRAWBUFFERSPROC glad_capture_real_glDrawBuffers;
+extern PFNGLDRAWELEMENTSPROC glad_capture_real_glDrawElements;
+extern PFNGLDRAWELEMENTSBASEVERTEXPROC glad_capture_real_glDrawElementsBaseVertex;
+extern PFNGLDRAWELEMENTSINDIRECTPROC glad_capture_real_glDrawElementsIndirect;
+extern PFNGLDRAWELEMENTSINSTANCEDPROC glad_capture_real_glDrawElementsInstanced;
+extern PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_capture_real_glDrawElementsInstancedBaseInstance;
+extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_capture_real_glDrawElementsInstancedBaseVertex;
+extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_capture_real_glDrawElementsInstancedBaseVertexBaseInstance;
+extern PFNGLDRAWPIXELSPROC glad_capture_real_glDrawPixels;
+extern PFNGLDRAWRANGEELEMENTSPROC glad_capture_real_glDrawRangeElements;
+extern PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_capture_real_glDrawRangeElementsBaseVertex;
+extern PFNGLDRAWTRANSFORMFEEDBACKPROC glad_capture_real_glDrawTransformFeedback;
+extern PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_capture_real_glDrawTransformFeedbackInstanced;
+extern PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_capture_real_glDrawTransformFeedbackStream;
+extern PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_capture_real_glDrawTransformFeedbackStreamInstanced;
+extern PFNGLEDGEFLAGPROC glad_capture_real_glEdgeFlag;
+extern PFNGLEDGEFLAGPOINTERPROC glad_capture_real_glEdgeFlagPointer;
+extern PFNGLEDGEFLAGVPROC glad_capture_real_glEdgeFlagv;
+extern PFNGLENABLEPROC glad_capture_real_glEnable;
+extern PFNGLENABLECLIENTSTATEPROC glad_capture_real_glEnableClientState;
+extern PFNGLENABLEVERTEXARRAYATTRIBPROC glad_capture_real_glEnableVertexArrayAttrib;
+extern PFNGLENABLEVERTEXATTRIBARRAYPROC glad_capture_real_glEnableVertexAttribArray;
+extern PFNGLENABLEIPROC glad_capture_real_glEnablei;
+extern PFNGLENDPROC glad_capture_real_glEnd;
+extern PFNGLENDCONDITIONALRENDERPROC glad_capture_real_glEndConditionalRender;
+extern PFNGLENDLISTPROC glad_capture_real_glEndList;
+extern PFNGLENDQUERYPROC glad_capture_real_glEndQuery;
+extern PFNGLENDQUERYINDEXEDPROC glad_capture_real_glEndQueryIndexed;
+extern PFNGLENDTRANSFORMFEEDBACKPROC glad_capture_real_glEndTransformFeedback;
+extern PFNGLEVALCOORD1DPROC glad_capture_real_glEvalCoord1d;
+extern PFNGLEVALCOORD1DVPROC glad_capture_real_glEvalCoord1dv;
+extern PFNGLEVALCOORD1FPROC glad_capture_real_glEvalCoord1f;
+extern PFNGLEVALCOORD1FVPROC glad_capture_real_glEvalCoord1fv;
+extern PFNGLEVALCOORD2DPROC glad_capture_real_glEvalCoord2d;
+extern PFNGLEVALCOORD2DVPROC glad_capture_real_glEvalCoord2dv;
+extern PFNGLEVALCOORD2FPROC glad_capture_real_glEvalCoord2f;
+extern PFNGLEVALCOORD2FVPROC glad_capture_real_glEvalCoord2fv;
+extern PFNGLEVALMESH1PROC glad_capture_real_glEvalMesh1;
+extern PFNGLEVALMESH2PROC glad_capture_real_glEvalMesh2;
+extern PFNGLEVALPOINT1PROC glad_capture_real_glEvalPoint1;
+extern PFNGLEVALPOINT2PROC glad_capture_real_glEvalPoint2;
+extern PFNGLFEEDBACKBUFFERPROC glad_capture_real_glFeedbackBuffer;
+extern PFNGLFENCESYNCPROC glad_capture_real_glFenceSync;
+extern PFNGLFINISHPROC glad_capture_real_glFinish;
+extern PFNGLFLUSHPROC glad_capture_real_glFlush;
+extern PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_capture_real_glFlushMappedBufferRange;
+extern PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_capture_real_glFlushMappedNamedBufferRange;
+extern PFNGLFOGCOORDPOINTERPROC glad_capture_real_glFogCoordPointer;
+extern PFNGLFOGCOORDDPROC glad_capture_real_glFogCoordd;
+extern PFNGLFOGCOORDDVPROC glad_capture_real_glFogCoorddv;
+extern PFNGLFOGCOORDFPROC glad_capture_real_glFogCoordf;
+extern PFNGLFOGCOORDFVPROC glad_capture_real_glFogCoordfv;
+extern PFNGLFOGFPROC glad_capture_real_glFogf;
+extern PFNGLFOGFVPROC glad_capture_real_glFogfv;
+extern PFNGLFOGIPROC glad_capture_real_glFogi;
+extern PFNGLFOGIVPROC glad_capture_real_glFogiv;
+extern PFNGLFRAMEBUFFERPARAMETERIPROC glad_capture_real_glFramebufferParameteri;
+extern PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_capture_real_glFramebufferRenderbuffer;
+extern PFNGLFRAMEBUFFERTEXTUREPROC glad_capture_real_glFramebufferTexture;
+extern PFNGLFRAMEBUFFERTEXTURE1DPROC glad_capture_real_glFramebufferTexture1D;
+extern PFNGLFRAMEBUFFERTEXTURE2DPROC glad_capture_real_glFramebufferTexture2D;
+extern PFNGLFRAMEBUFFERTEXTURE3DPROC glad_capture_real_glFramebufferTexture3D;
+extern PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_capture_real_glFramebufferTextureLayer;
+extern PFNGLFRONTFACEPROC glad_capture_real_glFrontFace;
+extern PFNGLFRUSTUMPROC glad_capture_real_glFrustum;
+extern PFNGLGENBUFFERSPROC glad_capture_real_glGenBuffers;
+extern PFNGLGENFRAMEBUFFERSPROC glad_capture_real_glGenFramebuffers;
+extern PFNGLGENLISTSPROC glad_capture_real_glGenLists;
+extern PFNGLGENPROGRAMPIPELINESPROC glad_capture_real_glGenProgramPipelines;
+extern PFNGLGENQUERIESPROC glad_capture_real_glGenQueries;
+extern PFNGLGENRENDERBUFFERSPROC glad_capture_real_glGenRenderbuffers;
+extern PFNGLGENSAMPLERSPROC glad_capture_real_glGenSamplers;
+extern PFNGLGENTEXTURESPROC glad_capture_real_glGenTextures;
+extern PFNGLGENTRANSFORMFEEDBACKSPROC glad_capture_real_glGenTransformFeedbacks;
+extern PFNGLGENVERTEXARRAYSPROC glad_capture_real_glGenVertexArrays;
+extern PFNGLGENERATEMIPMAPPROC glad_capture_real_glGenerateMipmap;
+extern PFNGLGENERATETEXTUREMIPMAPPROC glad_capture_real_glGenerateTextureMipmap;
+extern PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_capture_real_glGetActiveAtomicCounterBufferiv;
+extern PFNGLGETACTIVEATTRIBPROC glad_capture_real_glGetActiveAttrib;
+extern PFNGLGETACTIVESUBROUTINENAMEPROC glad_capture_real_glGetActiveSubroutineName;
+extern PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_capture_real_glGetActiveSubroutineUniformName;
+extern PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_capture_real_glGetActiveSubroutineUniformiv;
+extern PFNGLGETACTIVEUNIFORMPROC glad_capture_real_glGetActiveUniform;
+extern PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_capture_real_glGetActiveUniformBlockName;
+extern PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_capture_real_glGetActiveUniformBlockiv;
+extern PFNGLGETACTIVEUNIFORMNAMEPROC glad_capture_real_glGetActiveUniformName;
+extern PFNGLGETACTIVEUNIFORMSIVPROC glad_capture_real_glGetActiveUniformsiv;
+extern PFNGLGETATTACHEDSHADERSPROC glad_capture_real_glGetAttachedShaders;
+extern PFNGLGETATTRIBLOCATIONPROC glad_capture_real_glGetAttribLocation;
+extern PFNGLGETBOOLEANI_VPROC glad_capture_real_glGetBooleani_v;
+extern PFNGLGETBOOLEANVPROC glad_capture_real_glGetBooleanv;
+extern PFNGLGETBUFFERPARAMETERI64VPROC glad_capture_real_glGetBufferParameteri64v;
+extern PFNGLGETBUFFERPARAMETERIVPROC glad_capture_real_glGetBufferParameteriv;
+extern PFNGLGETBUFFERPOINTERVPROC glad_capture_real_glGetBufferPointerv;
+extern PFNGLGETBUFFERSUBDATAPROC glad_capture_real_glGetBufferSubData;
+extern PFNGLGETCLIPPLANEPROC glad_capture_real_glGetClipPlane;
+extern PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_capture_real_glGetCompressedTexImage;
+extern PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC glad_capture_real_glGetCompressedTextureImage;
+extern PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC glad_capture_real_glGetCompressedTextureSubImage;
+extern PFNGLGETDEBUGMESSAGELOGPROC glad_capture_real_glGetDebugMessageLog;
+extern PFNGLGETDOUBLEI_VPROC glad_capture_real_glGetDoublei_v;
+extern PFNGLGETDOUBLEVPROC glad_capture_real_glGetDoublev;
+extern PFNGLGETERRORPROC glad_capture_real_glGetError;
+extern PFNGLGETFLOATI_VPROC glad_capture_real_glGetFloati_v;
+extern PFNGLGETFLOATVPROC glad_capture_real_glGetFloatv;
+extern PFNGLGETFRAGDATAINDEXPROC glad_capture_real_glGetFragDataIndex;
+extern PFNGLGETFRAGDATALOCATIONPROC glad_capture_real_glGetFragDataLocation;
+extern PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_capture_real_glGetFramebufferAttachmentParameteriv;
+extern PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_capture_real_glGetFramebufferParameteriv;
+extern PFNGLGETGRAPHICSRESETSTATUSPROC glad_capture_real_glGetGraphicsResetStatus;
+extern PFNGLGETIMAGEHANDLEARBPROC glad_capture_real_glGetImageHandleARB;
+extern PFNGLGETINTEGER64I_VPROC glad_capture_real_glGetInteger64i_v;
+extern PFNGLGETINTEGER64VPROC glad_capture_real_glGetInteger64v;
+extern PFNGLGETINTEGERI_VPROC glad_capture_real_glGetIntegeri_v;
+extern PFNGLGETINTEGERVPROC glad_capture_real_glGetIntegerv;
+extern PFNGLGETINTERNALFORMATI64VPROC glad_capture_real_glGetInternalformati64v;
+extern PFNGLGETINTERNALFORMATIVPROC glad_capture_real_glGetInternalformativ;
+extern PFNGLGETLIGHTFVPROC glad_capture_real_glGetLightfv;
+extern PFNGLGETLIGHTIVPROC glad_capture_real_glGetLightiv;
+extern PFNGLGETMAPDVPROC glad_capture_real_glGetMapdv;
+extern PFNGLGETMAPFVPROC glad_capture_real_glGetMapfv;
+extern PFNGLGETMAPIVPROC glad_capture_real_glGetMapiv;
+extern PFNGLGETMATERIALFVPROC glad_capture_real_glGetMaterialfv;
+extern PFNGLGETMATERIALIVPROC glad_capture_real_glGetMaterialiv;
+extern PFNGLGETMULTISAMPLEFVPROC glad_capture_real_glGetMultisamplefv;
+extern PFNGLGETNAMEDBUFFERPARAMETERI64VPROC glad_capture_real_glGetNamedBufferParameteri64v;
+extern PFNGLGETNAMEDBUFFERPARAMETERIVPROC glad_capture_real_glGetNamedBufferParameteriv;
+extern PFNGLGETNAMEDBUFFERPOINTERVPROC glad_capture_real_glGetNamedBufferPointerv;
+extern PFNGLGETNAMEDBUFFERSUBDATAPROC glad_capture_real_glGetNamedBufferSubData;
+extern PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_capture_real_glGetNamedFramebufferAttachmentParameteriv;
+extern PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC glad_capture_real_glGetNamedFramebufferParameteriv;
+extern PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC glad_capture_real_glGetNamedRenderbufferParameteriv;
+extern PFNGLGETOBJECTLABELPROC glad_capture_real_glGetObjectLabel;
+extern PFNGLGETOBJECTPTRLABELPROC glad_capture_real_glGetObjectPtrLabel;
+extern PFNGLGETPIXELMAPFVPROC glad_capture_real_glGetPixelMapfv;
+extern PFNGLGETPIXELMAPUIVPROC glad_capture_real_glGetPixelMapuiv;
+extern PFNGLGETPIXELMAPUSVPROC glad_capture_real_glGetPixelMapusv;
+extern PFNGLGETPOINTERVPROC glad_capture_real_glGetPointerv;
+extern PFNGLGETPOLYGONSTIPPLEPROC glad_capture_real_glGetPolygonStipple;
+extern PFNGLGETPROGRAMBINARYPROC glad_capture_real_glGetProgramBinary;
+extern PFNGLGETPROGRAMINFOLOGPROC glad_capture_real_glGetProgramInfoLog;
+extern PFNGLGETPROGRAMINTERFACEIVPROC glad_capture_real_glGetProgramInterfaceiv;
+extern PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_capture_real_glGetProgramPipelineInfoLog;
+extern PFNGLGETPROGRAMPIPELINEIVPROC glad_capture_real_glGetProgramPipelineiv;
+extern PFNGLGETPROGRAMRESOURCEINDEXPROC glad_capture_real_glGetProgramResourceIndex;
+extern PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_capture_real_glGetProgramResourceLocation;
+extern PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_capture_real_glGetProgramResourceLocationIndex;
+extern PFNGLGETPROGRAMRESOURCENAMEPROC glad_capture_real_glGetProgramResourceName;
+extern PFNGLGETPROGRAMRESOURCEIVPROC glad_capture_real_glGetProgramResourceiv;
+extern PFNGLGETPROGRAMSTAGEIVPROC glad_capture_real_glGetProgramStageiv;
+extern PFNGLGETPROGRAMIVPROC glad_capture_real_glGetProgramiv;
+extern PFNGLGETQUERYBUFFEROBJECTI64VPROC glad_capture_real_glGetQueryBufferObjecti64v;
+extern PFNGLGETQUERYBUFFEROBJECTIVPROC glad_capture_real_glGetQueryBufferObjectiv;
+extern PFNGLGETQUERYBUFFEROBJECTUI64VPROC glad_capture_real_glGetQueryBufferObjectui64v;
+extern PFNGLGETQUERYBUFFEROBJECTUIVPROC glad_capture_real_glGetQueryBufferObjectuiv;
+extern PFNGLGETQUERYINDEXEDIVPROC glad_capture_real_glGetQueryIndexediv;
+extern PFNGLGETQUERYOBJECTI64VPROC glad_capture_real_glGetQueryObjecti64v;
+extern PFNGLGETQUERYOBJECTIVPROC glad_capture_real_glGetQueryObjectiv;
+extern PFNGLGETQUERYOBJECTUI64VPROC glad_capture_real_glGetQueryObjectui64v;
+extern PFNGLGETQUERYOBJECTUIVPROC glad_capture_real_glGetQueryObjectuiv;
+extern PFNGLGETQUERYIVPROC glad_capture_real_glGetQueryiv;
+extern PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_capture_real_glGetRenderbufferParameteriv;
+extern PFNGLGETSAMPLERPARAMETERIIVPROC glad_capture_real_glGetSamplerParameterIiv;
+extern PFNGLGETSAMPLERPARAMETERIUIVPROC glad_capture_real_glGetSamplerParameterIuiv;
+extern PFNGLGETSAMPLERPARAMETERFVPROC glad_capture_real_glGetSamplerParameterfv;
+extern PFNGLGETSAMPLERPARAMETERIVPROC glad_capture_real_glGetSamplerParameteriv;
+extern PFNGLGETSHADERINFOLOGPROC glad_capture_real_glGetShaderInfoLog;
+extern PFNGLGETSHADERPRECISIONFORMATPROC glad_capture_real_glGetShaderPrecisionFormat;
+extern PFNGLGETSHADERSOURCEPROC glad_capture_real_glGetShaderSource;
+extern PFNGLGETSHADERIVPROC glad_capture_real_glGetShaderiv;
+extern PFNGLGETSTRINGPROC glad_capture_real_glGetString;
+extern PFNGLGETSTRINGIPROC glad_capture_real_glGetStringi;
+extern PFNGLGETSUBROUTINEINDEXPROC glad_capture_real_glGetSubroutineIndex;
+extern PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_capture_real_glGetSubroutineUniformLocation;
+extern PFNGLGETSYNCIVPROC glad_capture_real_glGetSynciv;
+extern PFNGLGETTEXENVFVPROC glad_capture_real_glGetTexEnvfv;
+extern PFNGLGETTEXENVIVPROC glad_capture_real_glGetTexEnviv;
+extern PFNGLGETTEXGENDVPROC glad_capture_real_glGetTexGendv;
+extern PFNGLGETTEXGENFVPROC glad_capture_real_glGetTexGenfv;
+extern PFNGLGETTEXGENIVPROC glad_capture_real_glGetTexGeniv;
+extern PFNGLGETTEXIMAGEPROC glad_capture_real_glGetTexImage;
+extern PFNGLGETTEXLEVELPARAMETERFVPROC glad_capture_real_glGetTexLevelParameterfv;
+extern PFNGLGETTEXLEVELPARAMETERIVPROC glad_capture_real_glGetTexLevelParameteriv;
+extern PFNGLGETTEXPARAMETERIIVPROC glad_capture_real_glGetTexParameterIiv;
+extern PFNGLGETTEXPARAMETERIUIVPROC glad_capture_real_glGetTexParameterIuiv;
+extern PFNGLGETTEXPARAMETERFVPROC glad_capture_real_glGetTexParameterfv;
+extern PFNGLGETTEXPARAMETERIVPROC glad_capture_real_glGetTexParameteriv;
+extern PFNGLGETTEXTUREHANDLEARBPROC glad_capture_real_glGetTextureHandleARB;
+extern PFNGLGETTEXTUREIMAGEPROC glad_capture_real_glGetTextureImage;
+extern PFNGLGETTEXTURELEVELPARAMETERFVPROC glad_capture_real_glGetTextureLevelParameterfv;
+extern PFNGLGETTEXTURELEVELPARAMETERIVPROC glad_capture_real_glGetTextureLevelParameteriv;
+extern PFNGLGETTEXTUREPARAMETERIIVPROC glad_capture_real_glGetTextureParameterIiv;
+extern PFNGLGETTEXTUREPARAMETERIUIVPROC glad_capture_real_glGetTextureParameterIuiv;
+extern PFNGLGETTEXTUREPARAMETERFVPROC glad_capture_real_glGetTextureParameterfv;
+extern PFNGLGETTEXTUREPARAMETERIVPROC glad_capture_real_glGetTextureParameteriv;
+extern PFNGLGETTEXTURESAMPLERHANDLEARBPROC glad_capture_real_glGetTextureSamplerHandleARB;
+extern PFNGLGETTEXTURESUBIMAGEPROC glad_capture_real_glGetTextureSubImage;
+extern PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_capture_real_glGetTransformFeedbackVarying;
+extern PFNGLGETTRANSFORMFEEDBACKI64_VPROC glad_capture_real_glGetTransformFeedbacki64_v;
+extern PFNGLGETTRANSFORMFEEDBACKI_VPROC glad_capture_real_glGetTransformFeedbacki_v;
+extern PFNGLGETTRANSFORMFEEDBACKIVPROC glad_capture_real_glGetTransformFeedbackiv;
+extern PFNGLGETUNIFORMBLOCKINDEXPROC glad_capture_real_glGetUniformBlockIndex;
+extern PFNGLGETUNIFORMINDICESPROC glad_capture_real_glGetUniformIndices;
+extern PFNGLGETUNIFORMLOCATIONPROC glad_capture_real_glGetUniformLocation;
+extern PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_capture_real_glGetUniformSubroutineuiv;
+extern PFNGLGETUNIFORMDVPROC glad_capture_real_glGetUniformdv;
+extern PFNGLGETUNIFORMFVPROC glad_capture_real_glGetUniformfv;
+extern PFNGLGETUNIFORMIVPROC glad_capture_real_glGetUniformiv;
+extern PFNGLGETUNIFORMUIVPROC glad_capture_real_glGetUniformuiv;
+extern PFNGLGETVERTEXARRAYINDEXED64IVPROC glad_capture_real_glGetVertexArrayIndexed64iv;
+extern PFNGLGETVERTEXARRAYINDEXEDIVPROC glad_capture_real_glGetVertexArrayIndexediv;
+extern PFNGLGETVERTEXARRAYIVPROC glad_capture_real_glGetVertexArrayiv;
+extern PFNGLGETVERTEXATTRIBIIVPROC glad_capture_real_glGetVertexAttribIiv;
+extern PFNGLGETVERTEXATTRIBIUIVPROC glad_capture_real_glGetVertexAttribIuiv;
+extern PFNGLGETVERTEXATTRIBLDVPROC glad_capture_real_glGetVertexAttribLdv;
+extern PFNGLGETVERTEXATTRIBLUI64VARBPROC glad_capture_real_glGetVertexAttribLui64vARB;
+extern PFNGLGETVERTEXATTRIBPOINTERVPROC glad_capture_real_glGetVertexAttribPointerv;
+extern PFNGLGETVERTEXATTRIBDVPROC glad_capture_real_glGetVertexAttribdv;
+extern PFNGLGETVERTEXATTRIBFVPROC glad_capture_real_glGetVertexAttribfv;
+extern PFNGLGETVERTEXATTRIBIVPROC glad_capture_real_glGetVertexAttribiv;
+extern PFNGLGETNCOLORTABLEPROC glad_capture_real_glGetnColorTable;
+extern PFNGLGETNCOMPRESSEDTEXIMAGEPROC glad_capture_real_glGetnCompressedTexImage;
+extern PFNGLGETNCONVOLUTIONFILTERPROC glad_capture_real_glGetnConvolutionFilter;
+extern PFNGLGETNHISTOGRAMPROC glad_capture_real_glGetnHistogram;
+extern PFNGLGETNMAPDVPROC glad_capture_real_glGetnMapdv;
+extern PFNGLGETNMAPFVPROC glad_capture_real_glGetnMapfv;
+extern PFNGLGETNMAPIVPROC glad_capture_real_glGetnMapiv;
+extern PFNGLGETNMINMAXPROC glad_capture_real_glGetnMinmax;
+extern PFNGLGETNPIXELMAPFVPROC glad_capture_real_glGetnPixelMapfv;
+extern PFNGLGETNPIXELMAPUIVPROC glad_capture_real_glGetnPixelMapuiv;
+extern PFNGLGETNPIXELMAPUSVPROC glad_capture_real_glGetnPixelMapusv;
+extern PFNGLGETNPOLYGONSTIPPLEPROC glad_capture_real_glGetnPolygonStipple;
+extern PFNGLGETNSEPARABLEFILTERPROC glad_capture_real_glGetnSeparableFilter;
+extern PFNGLGETNTEXIMAGEPROC glad_capture_real_glGetnTexImage;
+extern PFNGLGETNUNIFORMDVPROC glad_capture_real_glGetnUniformdv;
+extern PFNGLGETNUNIFORMFVPROC glad_capture_real_glGetnUniformfv;
+extern PFNGLGETNUNIFORMIVPROC glad_capture_real_glGetnUniformiv;
+extern PFNGLGETNUNIFORMUIVPROC glad_capture_real_glGetnUniformuiv;
+extern PFNGLHINTPROC glad_capture_real_glHint;
+extern PFNGLINDEXMASKPROC glad_capture_real_glIndexMask;
+extern PFNGLINDEXPOINTERPROC glad_capture_real_glIndexPointer;
+extern PFNGLINDEXDPROC glad_capture_real_glIndexd;
+extern PFNGLINDEXDVPROC glad_capture_real_glIndexdv;
+extern PFNGLINDEXFPROC glad_capture_real_glIndexf;
+extern PFNGLINDEXFVPROC glad_capture_real_glIndexfv;
+extern PFNGLINDEXIPROC glad_capture_real_glIndexi;
+extern PFNGLINDEXIVPROC glad_capture_real_glIndexiv;
+extern PFNGLINDEXSPROC glad_capture_real_glIndexs;
+extern PFNGLINDEXSVPROC glad_capture_real_glIndexsv;
+extern PFNGLINDEXUBPROC glad_capture_real_glIndexub;
+extern PFNGLINDEXUBVPROC glad_capture_real_glIndexubv;
+extern PFNGLINITNAMESPROC glad_capture_real_glInitNames;
+extern PFNGLINTERLEAVEDARRAYSPROC glad_capture_real_glInterleavedArrays;
+extern PFNGLINVALIDATEBUFFERDATAPROC glad_capture_real_glInvalidateBufferData;
+extern PFNGLINVALIDATEBUFFERSUBDATAPROC glad_capture_real_glInvalidateBufferSubData;
+extern PFNGLINVALIDATEFRAMEBUFFERPROC glad_capture_real_glInvalidateFramebuffer;
+extern PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_capture_real_glInvalidateNamedFramebufferData;
+extern PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_capture_real_glInvalidateNamedFramebufferSubData;
+extern PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_capture_real_glInvalidateSubFramebuffer;
+extern PFNGLINVALIDATETEXIMAGEPROC glad_capture_real_glInvalidateTexImage;
+extern PFNGLINVALIDATETEXSUBIMAGEPROC glad_capture_real_glInvalidateTexSubImage;
+extern PFNGLISBUFFERPROC glad_capture_real_glIsBuffer;
+extern PFNGLISENABLEDPROC glad_capture_real_glIsEnabled;
+extern PFNGLISENABLEDIPROC glad_capture_real_glIsEnabledi;
+extern PFNGLISFRAMEBUFFERPROC glad_capture_real_glIsFramebuffer;
+extern PFNGLISIMAGEHANDLERESIDENTARBPROC glad_capture_real_glIsImageHandleResidentARB;
+extern PFNGLISLISTPROC glad_capture_real_glIsList;
+extern PFNGLISPROGRAMPROC glad_capture_real_glIsProgram;
+extern PFNGLISPROGRAMPIPELINEPROC glad_capture_real_glIsProgramPipeline;
+extern PFNGLISQUERYPROC glad_capture_real_glIsQuery;
+extern PFNGLISRENDERBUFFERPROC glad_capture_real_glIsRenderbuffer;
+extern PFNGLISSAMPLERPROC glad_capture_real_glIsSampler;
+extern PFNGLISSHADERPROC glad_capture_real_glIsShader;
+extern PFNGLISSYNCPROC glad_capture_real_glIsSync;
+extern PFNGLISTEXTUREPROC glad_capture_real_glIsTexture;
+extern PFNGLISTEXTUREHANDLERESIDENTARBPROC glad_capture_real_glIsTextureHandleResidentARB;
+extern PFNGLISTRANSFORMFEEDBACKPROC glad_capture_real_glIsTransformFeedback;
+extern PFNGLISVERTEXARRAYPROC glad_capture_real_glIsVertexArray;
+extern PFNGLLIGHTMODELFPROC glad_capture_real_glLightModelf;
+extern PFNGLLIGHTMODELFVPROC glad_capture_real_glLightModelfv;
+extern PFNGLLIGHTMODELIPROC glad_capture_real_glLightModeli;
+extern PFNGLLIGHTMODELIVPROC glad_capture_real_glLightModeliv;
+extern PFNGLLIGHTFPROC glad_capture_real_glLightf;
+extern PFNGLLIGHTFVPROC glad_capture_real_glLightfv;
+extern PFNGLLIGHTIPROC glad_capture_real_glLighti;
+extern PFNGLLIGHTIVPROC glad_capture_real_glLightiv;
+extern PFNGLLINESTIPPLEPROC glad_capture_real_glLineStipple;
+extern PFNGLLINEWIDTHPROC glad_capture_real_glLineWidth;
+extern PFNGLLINKPROGRAMPROC glad_capture_real_glLinkProgram;
+extern PFNGLLISTBASEPROC glad_capture_real_glListBase;
+extern PFNGLLOADIDENTITYPROC glad_capture_real_glLoadIdentity;
+extern PFNGLLOADMATRIXDPROC glad_capture_real_glLoadMatrixd;
+extern PFNGLLOADMATRIXFPROC glad_capture_real_glLoadMatrixf;
+extern PFNGLLOADNAMEPROC glad_capture_real_glLoadName;
+extern PFNGLLOADTRANSPOSEMATRIXDPROC glad_capture_real_glLoadTransposeMatrixd;
+extern PFNGLLOADTRANSPOSEMATRIXFPROC glad_capture_real_glLoadTransposeMatrixf;
+extern PFNGLLOGICOPPROC glad_capture_real_glLogicOp;
+extern PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC glad_capture_real_glMakeImageHandleNonResidentARB;
+extern PFNGLMAKEIMAGEHANDLERESIDENTARBPROC glad_capture_real_glMakeImageHandleResidentARB;
+extern PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC glad_capture_real_glMakeTextureHandleNonResidentARB;
+extern PFNGLMAKETEXTUREHANDLERESIDENTARBPROC glad_capture_real_glMakeTextureHandleResidentARB;
+extern PFNGLMAP1DPROC glad_capture_real_glMap1d;
+extern PFNGLMAP1FPROC glad_capture_real_glMap1f;
+extern PFNGLMAP2DPROC glad_capture_real_glMap2d;
+extern PFNGLMAP2FPROC glad_capture_real_glMap2f;
+extern PFNGLMAPBUFFERPROC glad_capture_real_glMapBuffer;
+extern PFNGLMAPBUFFERRANGEPROC glad_capture_real_glMapBufferRange;
+extern PFNGLMAPGRID1DPROC glad_capture_real_glMapGrid1d;
+extern PFNGLMAPGRID1FPROC glad_capture_real_glMapGrid1f;
+extern PFNGLMAPGRID2DPROC glad_capture_real_glMapGrid2d;
+extern PFNGLMAPGRID2FPROC glad_capture_real_glMapGrid2f;
+extern PFNGLMAPNAMEDBUFFERPROC glad_capture_real_glMapNamedBuffer;
+extern PFNGLMAPNAMEDBUFFERRANGEPROC glad_capture_real_glMapNamedBufferRange;
+extern PFNGLMATERIALFPROC glad_capture_real_glMaterialf;
+extern PFNGLMATERIALFVPROC glad_capture_real_glMaterialfv;
+extern PFNGLMATERIALIPROC glad_capture_real_glMateriali;
+extern PFNGLMATERIALIVPROC glad_capture_real_glMaterialiv;
+extern PFNGLMATRIXMODEPROC glad_capture_real_glMatrixMode;
+extern PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_capture_real_glMaxShaderCompilerThreadsKHR;
+extern PFNGLMEMORYBARRIERPROC glad_capture_real_glMemoryBarrier;
+extern PFNGLMEMORYBARRIERBYREGIONPROC glad_capture_real_glMemoryBarrierByRegion;
+extern PFNGLMINSAMPLESHADINGPROC glad_capture_real_glMinSampleShading;
+extern PFNGLMULTMATRIXDPROC glad_capture_real_glMultMatrixd;
+extern PFNGLMULTMATRIXFPROC glad_capture_real_glMultMatrixf;
+extern PFNGLMULTTRANSPOSEMATRIXDPROC glad_capture_real_glMultTransposeMatrixd;
+extern PFNGLMULTTRANSPOSEMATRIXFPROC glad_capture_real_glMultTransposeMatrixf;
+extern PFNGLMULTIDRAWARRAYSPROC glad_capture_real_glMultiDrawArrays;
+extern PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_capture_real_glMultiDrawArraysIndirect;
+extern PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC glad_capture_real_glMultiDrawArraysIndirectCount;
+extern PFNGLMULTIDRAWELEMENTSPROC glad_capture_real_glMultiDrawElements;
+extern PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_capture_real_glMultiDrawElementsBaseVertex;
+extern PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_capture_real_glMultiDrawElementsIndirect;
+extern PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC glad_capture_real_glMultiDrawElementsIndirectCount;
+extern PFNGLMULTITEXCOORD1DPROC glad_capture_real_glMultiTexCoord1d;
+extern PFNGLMULTITEXCOORD1DVPROC glad_capture_real_glMultiTexCoord1dv;
+extern PFNGLMULTITEXCOORD1FPROC glad_capture_real_glMultiTexCoord1f;
+extern PFNGLMULTITEXCOORD1FVPROC glad_capture_real_glMultiTexCoord1fv;
+extern PFNGLMULTITEXCOORD1IPROC glad_capture_real_glMultiTexCoord1i;
+extern PFNGLMULTITEXCOORD1IVPROC glad_capture_real_glMultiTexCoord1iv;
+extern PFNGLMULTITEXCOORD1SPROC glad_capture_real_glMultiTexCoord1s;
+extern PFNGLMULTITEXCOORD1SVPROC glad_capture_real_glMultiTexCoord1sv;
+extern PFNGLMULTITEXCOORD2DPROC glad_capture_real_glMultiTexCoord2d;
+extern PFNGLMULTITEXCOORD2DVPROC glad_capture_real_glMultiTexCoord2dv;
+extern PFNGLMULTITEXCOORD2FPROC glad_capture_real_glMultiTexCoord2f;
+extern PFNGLMULTITEXCOORD2FVPROC glad_capture_real_glMultiTexCoord2fv;
+extern PFNGLMULTITEXCOORD2IPROC glad_capture_real_glMultiTexCoord2i;
+extern PFNGLMULTITEXCOORD2IVPROC glad_capture_real_glMultiTexCoord2iv;
+extern PFNGLMULTITEXCOORD2SPROC glad_capture_real_glMultiTexCoord2s;
+extern PFNGLMULTITEXCOORD2SVPROC glad_capture_real_glMultiTexCoord2sv;
+extern PFNGLMULTITEXCOORD3DPROC glad_capture_real_glMultiTexCoord3d;
+extern PFNGLMULTITEXCOORD3DVPROC glad_capture_real_glMultiTexCoord3dv;
+extern PFNGLMULTITEXCOORD3FPROC glad_capture_real_glMultiTexCoord3f;
+extern PFNGLMULTITEXCOORD3FVPROC glad_capture_real_glMultiTexCoord3fv;
+extern PFNGLMULTITEXCOORD3IPROC glad_capture_real_glMultiTexCoord3i;
+extern PFNGLMULTITEXCOORD3IVPROC glad_capture_real_glMultiTexCoord3iv;
+extern PFNGLMULTITEXCOORD3SPROC glad_capture_real_glMultiTexCoord3s;
+extern PFNGLMULTITEXCOORD3SVPROC glad_capture_real_glMultiTexCoord3sv;
+extern PFNGLMULTITEXCOORD4DPROC glad_capture_real_glMultiTexCoord4d;
+extern PFNGLMULTITEXCOORD4DVPROC glad_capture_real_glMultiTexCoord4dv;
+extern PFNGLMULTITEXCOORD4FPROC glad_capture_real_glMultiTexCoord4f;
+extern PFNGLMULTITEXCOORD4FVPROC glad_capture_real_glMultiTexCoord4fv;
+extern PFNGLMULTITEXCOORD4IPROC glad_capture_real_glMultiTexCoord4i;
+extern PFNGLMULTITEXCOORD4IVPROC glad_capture_real_glMultiTexCoord4iv;
+extern PFNGLMULTITEXCOORD4SPROC glad_capture_real_glMultiTexCoord4s;
+extern PFNGLMULTITEXCOORD4SVPROC glad_capture_real_glMultiTexCoord4sv;
+extern PFNGLMULTITEXCOORDP1UIPROC glad_capture_real_glMultiTexCoordP1ui;
+extern PFNGLMULTITEXCOORDP1UIVPROC glad_capture_real_glMultiTexCoordP1uiv;
+extern PFNGLMULTITEXCOORDP2UIPROC glad_capture_real_glMultiTexCoordP2ui;
+extern PFNGLMULTITEXCOORDP2UIVPROC glad_capture_real_glMultiTexCoordP2uiv;
+extern PFNGLMULTITEXCOORDP3UIPROC glad_capture_real_glMultiTexCoordP3ui;
+extern PFNGLMULTITEXCOORDP3UIVPROC glad_capture_real_glMultiTexCoordP3uiv;
+extern PFNGLMULTITEXCOORDP4UIPROC glad_capture_real_glMultiTexCoordP4ui;
+extern PFNGLMULTITEXCOORDP4UIVPROC glad_capture_real_glMultiTexCoordP4uiv;
+extern PFNGLNAMEDBUFFERDATAPROC glad_capture_real_glNamedBufferData;
+extern PFNGLNAMEDBUFFERSTORAGEPROC glad_capture_real_glNamedBufferStorage;
+extern PFNGLNAMEDBUFFERSTORAGEEXTPROC glad_capture_real_glNamedBufferStorageEXT;
+extern PFNGLNAMEDBUFFERSUBDATAPROC glad_capture_real_glNamedBufferSubData;
+extern PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_capture_real_glNamedFramebufferDrawBuffer;
+extern PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_capture_real_glNamedFramebufferDrawBuffers;
+extern PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_capture_real_glNamedFramebufferParameteri;
+extern PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_capture_real_glNamedFramebufferReadBuffer;
+extern PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_capture_real_glNamedFramebufferRenderbuffer;
+extern PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_capture_real_glNamedFramebufferTexture;
+extern PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_capture_real_glNamedFramebufferTextureLayer;
+extern PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_capture_real_glNamedRenderbufferStorage;
+extern PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_capture_real_glNamedRenderbufferStorageMultisample;
+extern PFNGLNEWLISTPROC glad_capture_real_glNewList;
+extern PFNGLNORMAL3BPROC glad_capture_real_glNormal3b;
+extern PFNGLNORMAL3BVPROC glad_capture_real_glNormal3bv;
+extern PFNGLNORMAL3DPROC glad_capture_real_glNormal3d;
+extern PFNGLNORMAL3DVPROC glad_capture_real_glNormal3dv;
+extern PFNGLNORMAL3FPROC glad_capture_real_glNormal3f;
+extern PFNGLNORMAL3FVPROC glad_capture_real_glNormal3fv;
+extern PFNGLNORMAL3IPROC glad_capture_real_glNormal3i;
+extern PFNGLNORMAL3IVPROC glad_capture_real_glNormal3iv;
+extern PFNGLNORMAL3SPROC glad_capture_real_glNormal3s;
+extern PFNGLNORMAL3SVPROC glad_capture_real_glNormal3sv;
+extern PFNGLNORMALP3UIPROC glad_capture_real_glNormalP3ui;
+extern PFNGLNORMALP3UIVPROC glad_capture_real_glNormalP3uiv;
+extern PFNGLNORMALPOINTERPROC glad_capture_real_glNormalPointer;
+extern PFNGLOBJECTLABELPROC glad_capture_real_glObjectLabel;
+extern PFNGLOBJECTPTRLABELPROC glad_capture_real_glObjectPtrLabel;
+extern PFNGLORTHOPROC glad_capture_real_glOrtho;
+extern PFNGLPASSTHROUGHPROC glad_capture_real_glPassThrough;
+extern PFNGLPATCHPARAMETERFVPROC glad_capture_real_glPatchParameterfv;
+extern PFNGLPATCHPARAMETERIPROC glad_capture_real_glPatchParameteri;
+extern PFNGLPAUSETRANSFORMFEEDBACKPROC glad_capture_real_glPauseTransformFeedback;
+extern PFNGLPIXELMAPFVPROC glad_capture_real_glPixelMapfv;
+extern PFNGLPIXELMAPUIVPROC glad_capture_real_glPixelMapuiv;
+extern PFNGLPIXELMAPUSVPROC glad_capture_real_glPixelMapusv;
+extern PFNGLPIXELSTOREFPROC glad_capture_real_glPixelStoref;
+extern PFNGLPIXELSTOREIPROC glad_capture_real_glPixelStorei;
+extern PFNGLPIXELTRANSFERFPROC glad_capture_real_glPixelTransferf;
+extern PFNGLPIXELTRANSFERIPROC glad_capture_real_glPixelTransferi;
+extern PFNGLPIXELZOOMPROC glad_capture_real_glPixelZoom;
+extern PFNGLPOINTPARAMETERFPROC glad_capture_real_glPointParameterf;
+extern PFNGLPOINTPARAMETERFVPROC glad_capture_real_glPointParameterfv;
+extern PFNGLPOINTPARAMETERIPROC glad_capture_real_glPointParameteri;
+extern PFNGLPOINTPARAMETERIVPROC glad_capture_real_glPointParameteriv;
+extern PFNGLPOINTSIZEPROC glad_capture_real_glPointSize;
+extern PFNGLPOLYGONMODEPROC glad_capture_real_glPolygonMode;
+extern PFNGLPOLYGONOFFSETPROC glad_capture_real_glPolygonOffset;
+extern PFNGLPOLYGONOFFSETCLAMPPROC glad_capture_real_glPolygonOffsetClamp;
+extern PFNGLPOLYGONSTIPPLEPROC glad_capture_real_glPolygonStipple;
+extern PFNGLPOPATTRIBPROC glad_capture_real_glPopAttrib;
+extern PFNGLPOPCLIENTATTRIBPROC glad_capture_real_glPopClientAttrib;
+extern PFNGLPOPDEBUGGROUPPROC glad_capture_real_glPopDebugGroup;
+extern PFNGLPOPMATRIXPROC glad_capture_real_glPopMatrix;
+extern PFNGLPOPNAMEPROC glad_capture_real_glPopName;
+extern PFNGLPRIMITIVERESTARTINDEXPROC glad_capture_real_glPrimitiveRestartIndex;
+extern PFNGLPRIORITIZETEXTURESPROC glad_capture_real_glPrioritizeTextures;
+extern PFNGLPROGRAMBINARYPROC glad_capture_real_glProgramBinary;
+extern PFNGLPROGRAMPARAMETERIPROC glad_capture_real_glProgramParameteri;
+extern PFNGLPROGRAMUNIFORM1DPROC glad_capture_real_glProgramUniform1d;
+extern PFNGLPROGRAMUNIFORM1DVPROC glad_capture_real_glProgramUniform1dv;
+extern PFNGLPROGRAMUNIFORM1FPROC glad_capture_real_glProgramUniform1f;
+extern PFNGLPROGRAMUNIFORM1FVPROC glad_capture_real_glProgramUniform1fv;
+extern PFNGLPROGRAMUNIFORM1IPROC glad_capture_real_glProgramUniform1i;
+extern PFNGLPROGRAMUNIFORM1IVPROC glad_capture_real_glProgramUniform1iv;
+extern PFNGLPROGRAMUNIFORM1UIPROC glad_capture_real_glProgramUniform1ui;
+extern PFNGLPROGRAMUNIFORM1UIVPROC glad_capture_real_glProgramUniform1uiv;
+extern PFNGLPROGRAMUNIFORM2DPROC glad_capture_real_glProgramUniform2d;
+extern PFNGLPROGRAMUNIFORM2DVPROC glad_capture_real_glProgramUniform2dv;
+extern PFNGLPROGRAMUNIFORM2FPROC glad_capture_real_glProgramUniform2f;
+extern PFNGLPROGRAMUNIFORM2FVPROC glad_capture_real_glProgramUniform2fv;
+extern PFNGLPROGRAMUNIFORM2IPROC glad_capture_real_glProgramUniform2i;
+extern PFNGLPROGRAMUNIFORM2IVPROC glad_capture_real_glProgramUniform2iv;
+extern PFNGLPROGRAMUNIFORM2UIPROC glad_capture_real_glProgramUniform2ui;
+extern PFNGLPROGRAMUNIFORM2UIVPROC glad_capture_real_glProgramUniform2uiv;
+extern PFNGLPROGRAMUNIFORM3DPROC glad_capture_real_glProgramUniform3d;
+extern PFNGLPROGRAMUNIFORM3DVPROC glad_capture_real_glProgramUniform3dv;
+extern PFNGLPROGRAMUNIFORM3FPROC glad_capture_real_glProgramUniform3f;
+extern PFNGLPROGRAMUNIFORM3FVPROC glad_capture_real_glProgramUniform3fv;
+extern PFNGLPROGRAMUNIFORM3IPROC glad_capture_real_glProgramUniform3i;
+extern PFNGLPROGRAMUNIFORM3IVPROC glad_capture_real_glProgramUniform3iv;
+extern PFNGLPROGRAMUNIFORM3UIPROC glad_capture_real_glProgramUniform3ui;
+extern PFNGLPROGRAMUNIFORM3UIVPROC glad_capture_real_glProgramUniform3uiv;
+extern PFNGLPROGRAMUNIFORM4DPROC glad_capture_real_glProgramUniform4d;
+extern PFNGLPROGRAMUNIFORM4DVPROC glad_capture_real_glProgramUniform4dv;
+extern PFNGLPROGRAMUNIFORM4FPROC glad_capture_real_glProgramUniform4f;
+extern PFNGLPROGRAMUNIFORM4FVPROC glad_capture_real_glProgramUniform4fv;
+extern PFNGLPROGRAMUNIFORM4IPROC glad_capture_real_glProgramUniform4i;
+extern PFNGLPROGRAMUNIFORM4IVPROC glad_capture_real_glProgramUniform4iv;
+extern PFNGLPROGRAMUNIFORM4UIPROC glad_capture_real_glProgramUniform4ui;
+extern PFNGLPROGRAMUNIFORM4UIVPROC glad_capture_real_glProgramUniform4uiv;
+extern PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC glad_capture_real_glProgramUniformHandleui64ARB;
+extern PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC glad_capture_real_glProgramUniformHandleui64vARB;
+extern PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_capture_real_glProgramUniformMatrix2dv;
+extern PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_capture_real_glProgramUniformMatrix2fv;
+extern PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_capture_real_glProgramUniformMatrix2x3dv;
+extern PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_capture_real_glProgramUniformMatrix2x3fv;
+extern PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_capture_real_glProgramUniformMatrix2x4dv;
+extern PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_capture_real_glProgramUniformMatrix2x4fv;
+extern PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_capture_real_glProgramUniformMatrix3dv;
+extern PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_capture_real_glProgramUniformMatrix3fv;
+extern PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_capture_real_glProgramUniformMatrix3x2dv;
+extern PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_capture_real_glProgramUniformMatrix3x2fv;
+extern PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_capture_real_glProgramUniformMatrix3x4dv;
+extern PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_capture_real_glProgramUniformMatrix3x4fv;
+extern PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_capture_real_glProgramUniformMatrix4dv;
+extern PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_capture_real_glProgramUniformMatrix4fv;
+extern PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_capture_real_glProgramUniformMatrix4x2dv;
+extern PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_capture_real_glProgramUniformMatrix4x2fv;
+extern PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_capture_real_glProgramUniformMatrix4x3dv;
+extern PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_capture_real_glProgramUniformMatrix4x3fv;
+extern PFNGLPROVOKINGVERTEXPROC glad_capture_real_glProvokingVertex;
+extern PFNGLPUSHATTRIBPROC glad_capture_real_glPushAttrib;
+extern PFNGLPUSHCLIENTATTRIBPROC glad_capture_real_glPushClientAttrib;
+extern PFNGLPUSHDEBUGGROUPPROC glad_capture_real_glPushDebugGroup;
+extern PFNGLPUSHMATRIXPROC glad_capture_real_glPushMatrix;
+extern PFNGLPUSHNAMEPROC glad_capture_real_glPushName;
+extern PFNGLQUERYCOUNTERPROC glad_capture_real_glQueryCounter;
+extern PFNGLRASTERPOS2DPROC glad_capture_real_glRasterPos2d;
+extern PFNGLRASTERPOS2DVPROC glad_capture_real_glRasterPos2dv;
+extern PFNGLRASTERPOS2FPROC glad_capture_real_glRasterPos2f;
+extern PFNGLRASTERPOS2FVPROC glad_capture_real_glRasterPos2fv;
+extern PFNGLRASTERPOS2IPROC glad_capture_real_glRasterPos2i;
+extern PFNGLRASTERPOS2IVPROC glad_capture_real_glRasterPos2iv;
+extern PFNGLRASTERPOS2SPROC glad_capture_real_glRasterPos2s;
+extern PFNGLRASTERPOS2SVPROC glad_capture_real_glRasterPos2sv;
+extern PFNGLRASTERPOS3DPROC glad_capture_real_glRasterPos3d;
+extern PFNGLRASTERPOS3DVPROC glad_capture_real_glRasterPos3dv;
+extern PFNGLRASTERPOS3FPROC glad_capture_real_glRasterPos3f;
+extern PFNGLRASTERPOS3FVPROC glad_capture_real_glRasterPos3fv;
+extern PFNGLRASTERPOS3IPROC glad_capture_real_glRasterPos3i;
+extern PFNGLRASTERPOS3IVPROC glad_capture_real_glRasterPos3iv;
+extern PFNGLRASTERPOS3SPROC glad_capture_real_glRasterPos3s;
+extern PFNGLRASTERPOS3SVPROC glad_capture_real_glRasterPos3sv;
+extern PFNGLRASTERPOS4DPROC glad_capture_real_glRasterPos4d;
+extern PFNGLRASTERPOS4DVPROC glad_capture_real_glRasterPos4dv;
+extern PFNGLRASTERPOS4FPROC glad_capture_real_glRasterPos4f;
+extern PFNGLRASTERPOS4FVPROC glad_capture_real_glRasterPos4fv;
+extern PFNGLRASTERPOS4IPROC glad_capture_real_glRasterPos4i;
+extern PFNGLRASTERPOS4IVPROC glad_capture_real_glRasterPos4iv;
+extern PFNGLRASTERPOS4SPROC glad_capture_real_glRasterPos4s;
+extern PFNGLRASTERPOS4SVPROC glad_capture_real_glRasterPos4sv;
+extern PFNGLREADBUFFERPROC glad_capture_real_glReadBuffer;
+extern PFNGLREADPIXELSPROC glad_capture_real_glReadPixels;
+extern PFNGLREADNPIXELSPROC glad_capture_real_glReadnPixels;
+extern PFNGLRECTDPROC glad_capture_real_glRectd;
+extern PFNGLRECTDVPROC glad_capture_real_glRectdv;
+extern PFNGLRECTFPROC glad_capture_real_glRectf;
+extern PFNGLRECTFVPROC glad_capture_real_glRectfv;
+extern PFNGLRECTIPROC glad_capture_real_glRecti;
+extern PFNGLRECTIVPROC glad_capture_real_glRectiv;
+extern PFNGLRECTSPROC glad_capture_real_glRects;
+extern PFNGLRECTSVPROC glad_capture_real_glRectsv;
+extern PFNGLRELEASESHADERCOMPILERPROC glad_capture_real_glReleaseShaderCompiler;
+extern PFNGLRENDERMODEPROC glad_capture_real_glRenderMode;
+extern PFNGLRENDERBUFFERSTORAGEPROC glad_capture_real_glRenderbufferStorage;
+extern PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_capture_real_glRenderbufferStorageMultisample;
+extern PFNGLRESUMETRANSFORMFEEDBACKPROC glad_capture_real_glResumeTransformFeedback;
+extern PFNGLROTATEDPROC glad_capture_real_glRotated;
+extern PFNGLROTATEFPROC glad_capture_real_glRotatef;
+extern PFNGLSAMPLECOVERAGEPROC glad_capture_real_glSampleCoverage;
+extern PFNGLSAMPLEMASKIPROC glad_capture_real_glSampleMaski;
+extern PFNGLSAMPLERPARAMETERIIVPROC glad_capture_real_glSamplerParameterIiv;
+extern PFNGLSAMPLERPARAMETERIUIVPROC glad_capture_real_glSamplerParameterIuiv;
+extern PFNGLSAMPLERPARAMETERFPROC glad_capture_real_glSamplerParameterf;
+extern PFNGLSAMPLERPARAMETERFVPROC glad_capture_real_glSamplerParameterfv;
+extern PFNGLSAMPLERPARAMETERIPROC glad_capture_real_glSamplerParameteri;
+extern PFNGLSAMPLERPARAMETERIVPROC glad_capture_real_glSamplerParameteriv;
+extern PFNGLSCALEDPROC glad_capture_real_glScaled;
+extern PFNGLSCALEFPROC glad_capture_real_glScalef;
+extern PFNGLSCISSORPROC glad_capture_real_glScissor;
+extern PFNGLSCISSORARRAYVPROC glad_capture_real_glScissorArrayv;
+extern PFNGLSCISSORINDEXEDPROC glad_capture_real_glScissorIndexed;
+extern PFNGLSCISSORINDEXEDVPROC glad_capture_real_glScissorIndexedv;
+extern PFNGLSECONDARYCOLOR3BPROC glad_capture_real_glSecondaryColor3b;
+extern PFNGLSECONDARYCOLOR3BVPROC glad_capture_real_glSecondaryColor3bv;
+extern PFNGLSECONDARYCOLOR3DPROC glad_capture_real_glSecondaryColor3d;
+extern PFNGLSECONDARYCOLOR3DVPROC glad_capture_real_glSecondaryColor3dv;
+extern PFNGLSECONDARYCOLOR3FPROC glad_capture_real_glSecondaryColor3f;
+extern PFNGLSECONDARYCOLOR3FVPROC glad_capture_real_glSecondaryColor3fv;
+extern PFNGLSECONDARYCOLOR3IPROC glad_capture_real_glSecondaryColor3i;
+extern PFNGLSECONDARYCOLOR3IVPROC glad_capture_real_glSecondaryColor3iv;
+extern PFNGLSECONDARYCOLOR3SPROC glad_capture_real_glSecondaryColor3s;
+extern PFNGLSECONDARYCOLOR3SVPROC glad_capture_real_glSecondaryColor3sv;
+extern PFNGLSECONDARYCOLOR3UBPROC glad_capture_real_glSecondaryColor3ub;
+extern PFNGLSECONDARYCOLOR3UBVPROC glad_capture_real_glSecondaryColor3ubv;
+extern PFNGLSECONDARYCOLOR3UIPROC glad_capture_real_glSecondaryColor3ui;
+extern PFNGLSECONDARYCOLOR3UIVPROC glad_capture_real_glSecondaryColor3uiv;
+extern PFNGLSECONDARYCOLOR3USPROC glad_capture_real_glSecondaryColor3us;
+extern PFNGLSECONDARYCOLOR3USVPROC glad_capture_real_glSecondaryColor3usv;
+extern PFNGLSECONDARYCOLORP3UIPROC glad_capture_real_glSecondaryColorP3ui;
+extern PFNGLSECONDARYCOLORP3UIVPROC glad_capture_real_glSecondaryColorP3uiv;
+extern PFNGLSECONDARYCOLORPOINTERPROC glad_capture_real_glSecondaryColorPointer;
+extern PFNGLSELECTBUFFERPROC glad_capture_real_glSelectBuffer;
+extern PFNGLSHADEMODELPROC glad_capture_real_glShadeModel;
+extern PFNGLSHADERBINARYPROC glad_capture_real_glShaderBinary;
+extern PFNGLSHADERSOURCEPROC glad_capture_real_glShaderSource;
+extern PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_capture_real_glShaderStorageBlockBinding;
+extern PFNGLSPECIALIZESHADERPROC glad_capture_real_glSpecializeShader;
+extern PFNGLSPECIALIZESHADERARBPROC glad_capture_real_glSpecializeShaderARB;
+extern PFNGLSTENCILFUNCPROC glad_capture_real_glStencilFunc;
+extern PFNGLSTENCILFUNCSEPARATEPROC glad_capture_real_glStencilFuncSeparate;
+extern PFNGLSTENCILMASKPROC glad_capture_real_glStencilMask;
+extern PFNGLSTENCILMASKSEPARATEPROC glad_capture_real_glStencilMaskSeparate;
+extern PFNGLSTENCILOPPROC glad_capture_real_glStencilOp;
+extern PFNGLSTENCILOPSEPARATEPROC glad_capture_real_glStencilOpSeparate;
+extern PFNGLTEXBUFFERPROC glad_capture_real_glTexBuffer;
+extern PFNGLTEXBUFFERRANGEPROC glad_capture_real_glTexBufferRange;
+extern PFNGLTEXCOORD1DPROC glad_capture_real_glTexCoord1d;
+extern PFNGLTEXCOORD1DVPROC glad_capture_real_glTexCoord1dv;
+extern PFNGLTEXCOORD1FPROC glad_capture_real_glTexCoord1f;
+extern PFNGLTEXCOORD1FVPROC glad_capture_real_glTexCoord1fv;
+extern PFNGLTEXCOORD1IPROC glad_capture_real_glTexCoord1i;
+extern PFNGLTEXCOORD1IVPROC glad_capture_real_glTexCoord1iv;
+extern PFNGLTEXCOORD1SPROC glad_capture_real_glTexCoord1s;
+extern PFNGLTEXCOORD1SVPROC glad_capture_real_glTexCoord1sv;
+extern PFNGLTEXCOORD2DPROC glad_capture_real_glTexCoord2d;
+extern PFNGLTEXCOORD2DVPROC glad_capture_real_glTexCoord2dv;
+extern PFNGLTEXCOORD2FPROC glad_capture_real_glTexCoord2f;
+extern PFNGLTEXCOORD2FVPROC glad_capture_real_glTexCoord2fv;
+extern PFNGLTEXCOORD2IPROC glad_capture_real_glTexCoord2i;
+extern PFNGLTEXCOORD2IVPROC glad_capture_real_glTexCoord2iv;
+extern PFNGLTEXCOORD2SPROC glad_capture_real_glTexCoord2s;
+extern PFNGLTEXCOORD2SVPROC glad_capture_real_glTexCoord2sv;
+extern PFNGLTEXCOORD3DPROC glad_capture_real_glTexCoord3d;
+extern PFNGLTEXCOORD3DVPROC glad_capture_real_glTexCoord3dv;
+extern PFNGLTEXCOORD3FPROC glad_capture_real_glTexCoord3f;
+extern PFNGLTEXCOORD3FVPROC glad_capture_real_glTexCoord3fv;
+extern PFNGLTEXCOORD3IPROC glad_capture_real_glTexCoord3i;
+extern PFNGLTEXCOORD3IVPROC glad_capture_real_glTexCoord3iv;
+extern PFNGLTEXCOORD3SPROC glad_capture_real_glTexCoord3s;
+extern PFNGLTEXCOORD3SVPROC glad_capture_real_glTexCoord3sv;
+extern PFNGLTEXCOORD4DPROC glad_capture_real_glTexCoord4d;
+extern PFNGLTEXCOORD4DVPROC glad_capture_real_glTexCoord4dv;
+extern PFNGLTEXCOORD4FPROC glad_capture_real_glTexCoord4f;
+extern PFNGLTEXCOORD4FVPROC glad_capture_real_glTexCoord4fv;
+extern PFNGLTEXCOORD4IPROC glad_capture_real_glTexCoord4i;
+extern PFNGLTEXCOORD4IVPROC glad_capture_real_glTexCoord4iv;
+extern PFNGLTEXCOORD4SPROC glad_capture_real_glTexCoord4s;
+extern PFNGLTEXCOORD4SVPROC glad_capture_real_glTexCoord4sv;
+extern PFNGLTEXCOORDP1UIPROC glad_capture_real_glTexCoordP1ui;
+extern PFNGLTEXCOORDP1UIVPROC glad_capture_real_glTexCoordP1uiv;
+extern PFNGLTEXCOORDP2UIPROC glad_capture_real_glTexCoordP2ui;
+extern PFNGLTEXCOORDP2UIVPROC glad_capture_real_glTexCoordP2uiv;
+extern PFNGLTEXCOORDP3UIPROC glad_capture_real_glTexCoordP3ui;
+extern PFNGLTEXCOORDP3UIVPROC glad_capture_real_glTexCoordP3uiv;
+extern PFNGLTEXCOORDP4UIPROC glad_capture_real_glTexCoordP4ui;
+extern PFNGLTEXCOORDP4UIVPROC glad_capture_real_glTexCoordP4uiv;
+extern PFNGLTEXCOORDPOINTERPROC glad_capture_real_glTexCoordPointer;
+extern PFNGLTEXENVFPROC glad_capture_real_glTexEnvf;
+extern PFNGLTEXENVFVPROC glad_capture_real_glTexEnvfv;
+extern PFNGLTEXENVIPROC glad_capture_real_glTexEnvi;
+extern PFNGLTEXENVIVPROC glad_capture_real_glTexEnviv;
+extern PFNGLTEXGENDPROC glad_capture_real_glTexGend;
+extern PFNGLTEXGENDVPROC glad_capture_real_glTexGendv;
+extern PFNGLTEXGENFPROC glad_capture_real_glTexGenf;
+extern PFNGLTEXGENFVPROC glad_capture_real_glTexGenfv;
+extern PFNGLTEXGENIPROC glad_capture_real_glTexGeni;
+extern PFNGLTEXGENIVPROC glad_capture_real_glTexGeniv;
+extern PFNGLTEXIMAGE1DPROC glad_capture_real_glTexImage1D;
+extern PFNGLTEXIMAGE2DPROC glad_capture_real_glTexImage2D;
+extern PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_capture_real_glTexImage2DMultisample;
+extern PFNGLTEXIMAGE3DPROC glad_capture_real_glTexImage3D;
+extern PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_capture_real_glTexImage3DMultisample;
+extern PFNGLTEXPARAMETERIIVPROC glad_capture_real_glTexParameterIiv;
+extern PFNGLTEXPARAMETERIUIVPROC glad_capture_real_glTexParameterIuiv;
+extern PFNGLTEXPARAMETERFPROC glad_capture_real_glTexParameterf;
+extern PFNGLTEXPARAMETERFVPROC glad_capture_real_glTexParameterfv;
+extern PFNGLTEXPARAMETERIPROC glad_capture_real_glTexParameteri;
+extern PFNGLTEXPARAMETERIVPROC glad_capture_real_glTexParameteriv;
+extern PFNGLTEXSTORAGE1DPROC glad_capture_real_glTexStorage1D;
+extern PFNGLTEXSTORAGE2DPROC glad_capture_real_glTexStorage2D;
+extern PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_capture_real_glTexStorage2DMultisample;
+extern PFNGLTEXSTORAGE3DPROC glad_capture_real_glTexStorage3D;
+extern PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_capture_real_glTexStorage3DMultisample;
+extern PFNGLTEXSUBIMAGE1DPROC glad_capture_real_glTexSubImage1D;
+extern PFNGLTEXSUBIMAGE2DPROC glad_capture_real_glTexSubImage2D;
+extern PFNGLTEXSUBIMAGE3DPROC glad_capture_real_glTexSubImage3D;
+extern PFNGLTEXTUREBARRIERPROC glad_capture_real_glTextureBarrier;
+extern PFNGLTEXTUREBUFFERPROC glad_capture_real_glTextureBuffer;
+extern PFNGLTEXTUREBUFFERRANGEPROC glad_capture_real_glTextureBufferRange;
+extern PFNGLTEXTUREPARAMETERIIVPROC glad_capture_real_glTextureParameterIiv;
+extern PFNGLTEXTUREPARAMETERIUIVPROC glad_capture_real_glTextureParameterIuiv;
+extern PFNGLTEXTUREPARAMETERFPROC glad_capture_real_glTextureParameterf;
+extern PFNGLTEXTUREPARAMETERFVPROC glad_capture_real_glTextureParameterfv;
+extern PFNGLTEXTUREPARAMETERIPROC glad_capture_real_glTextureParameteri;
+extern PFNGLTEXTUREPARAMETERIVPROC glad_capture_real_glTextureParameteriv;
+extern PFNGLTEXTURESTORAGE1DPROC glad_capture_real_glTextureStorage1D;
+extern PFNGLTEXTURESTORAGE2DPROC glad_capture_real_glTextureStorage2D;
+extern PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_capture_real_glTextureStorage2DMultisample;
+extern PFNGLTEXTURESTORAGE3DPROC glad_capture_real_glTextureStorage3D;
+extern PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_capture_real_glTextureStorage3DMultisample;
+extern PFNGLTEXTURESUBIMAGE1DPROC glad_capture_real_glTextureSubImage1D;
+extern PFNGLTEXTURESUBIMAGE2DPROC glad_capture_real_glTextureSubImage2D;
+extern PFNGLTEXTURESUBIMAGE3DPROC glad_capture_real_glTextureSubImage3D;
+extern PFNGLTEXTUREVIEWPROC glad_capture_real_glTextureView;
+extern PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_capture_real_glTransformFeedbackBufferBase;
+extern PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_capture_real_glTransformFeedbackBufferRange;
+extern PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_capture_real_glTransformFeedbackVaryings;
+extern PFNGLTRANSLATEDPROC glad_capture_real_glTranslated;
+extern PFNGLTRANSLATEFPROC glad_capture_real_glTranslatef;
+extern PFNGLUNIFORM1DPROC glad_capture_real_glUniform1d;
+extern PFNGLUNIFORM1DVPROC glad_capture_real_glUniform1dv;
+extern PFNGLUNIFORM1FPROC glad_capture_real_glUniform1f;
+extern PFNGLUNIFORM1FVPROC glad_capture_real_glUniform1fv;
+extern PFNGLUNIFORM1IPROC glad_capture_real_glUniform1i;
+extern PFNGLUNIFORM1IVPROC glad_capture_real_glUniform1iv;
+extern PFNGLUNIFORM1UIPROC glad_capture_real_glUniform1ui;
+extern PFNGLUNIFORM1UIVPROC glad_capture_real_glUniform1uiv;
+extern PFNGLUNIFORM2DPROC glad_capture_real_glUniform2d;
+extern PFNGLUNIFORM2DVPROC glad_capture_real_glUniform2dv;
+extern PFNGLUNIFORM2FPROC glad_capture_real_glUniform2f;
+extern PFNGLUNIFORM2FVPROC glad_capture_real_glUniform2fv;
+extern PFNGLUNIFORM2IPROC glad_capture_real_glUniform2i;
+extern PFNGLUNIFORM2IVPROC glad_capture_real_glUniform2iv;
+extern PFNGLUNIFORM2UIPROC glad_capture_real_glUniform2ui;
+extern PFNGLUNIFORM2UIVPROC glad_capture_real_glUniform2uiv;
+extern PFNGLUNIFORM3DPROC glad_capture_real_glUniform3d;
+extern PFNGLUNIFORM3DVPROC glad_capture_real_glUniform3dv;
+extern PFNGLUNIFORM3FPROC glad_capture_real_glUniform3f;
+extern PFNGLUNIFORM3FVPROC glad_capture_real_glUniform3fv;
+extern PFNGLUNIFORM3IPROC glad_capture_real_glUniform3i;
+extern PFNGLUNIFORM3IVPROC glad_capture_real_glUniform3iv;
+extern PFNGLUNIFORM3UIPROC glad_capture_real_glUniform3ui;
+extern PFNGLUNIFORM3UIVPROC glad_capture_real_glUniform3uiv;
+extern PFNGLUNIFORM4DPROC glad_capture_real_glUniform4d;
+extern PFNGLUNIFORM4DVPROC glad_capture_real_glUniform4dv;
+extern PFNGLUNIFORM4FPROC glad_capture_real_glUniform4f;
+extern PFNGLUNIFORM4FVPROC glad_capture_real_glUniform4fv;
+extern PFNGLUNIFORM4IPROC glad_capture_real_glUniform4i;
+extern PFNGLUNIFORM4IVPROC glad_capture_real_glUniform4iv;
+extern PFNGLUNIFORM4UIPROC glad_capture_real_glUniform4ui;
+extern PFNGLUNIFORM4UIVPROC glad_capture_real_glUniform4uiv;
+extern PFNGLUNIFORMBLOCKBINDINGPROC glad_capture_real_glUniformBlockBinding;
+extern PFNGLUNIFORMHANDLEUI64ARBPROC glad_capture_real_glUniformHandleui64ARB;
+extern PFNGLUNIFORMHANDLEUI64VARBPROC glad_capture_real_glUniformHandleui64vARB;
+extern PFNGLUNIFORMMATRIX2DVPROC glad_capture_real_glUniformMatrix2dv;
+extern PFNGLUNIFORMMATRIX2FVPROC glad_capture_real_glUniformMatrix2fv;
+extern PFNGLUNIFORMMATRIX2X3DVPROC glad_capture_real_glUniformMatrix2x3dv;
+extern PFNGLUNIFORMMATRIX2X3FVPROC glad_capture_real_glUniformMatrix2x3fv;
+extern PFNGLUNIFORMMATRIX2X4DVPROC glad_capture_real_glUniformMatrix2x4dv;
+extern PFNGLUNIFORMMATRIX2X4FVPROC glad_capture_real_glUniformMatrix2x4fv;
+extern PFNGLUNIFORMMATRIX3DVPROC glad_capture_real_glUniformMatrix3dv;
+extern PFNGLUNIFORMMATRIX3FVPROC glad_capture_real_glUniformMatrix3fv;
+extern PFNGLUNIFORMMATRIX3X2DVPROC glad_capture_real_glUniformMatrix3x2dv;
+extern PFNGLUNIFORMMATRIX3X2FVPROC glad_capture_real_glUniformMatrix3x2fv;
+extern PFNGLUNIFORMMATRIX3X4DVPROC glad_capture_real_glUniformMatrix3x4dv;
+extern PFNGLUNIFORMMATRIX3X4FVPROC glad_capture_real_glUniformMatrix3x4fv;
+extern PFNGLUNIFORMMATRIX4DVPROC glad_capture_real_glUniformMatrix4dv;
+extern PFNGLUNIFORMMATRIX4FVPROC glad_capture_real_glUniformMatrix4fv;
+extern PFNGLUNIFORMMATRIX4X2DVPROC glad_capture_real_glUniformMatrix4x2dv;
+extern PFNGLUNIFORMMATRIX4X2FVPROC glad_capture_real_glUniformMatrix4x2fv;
+extern PFNGLUNIFORMMATRIX4X3DVPROC glad_capture_real_glUniformMatrix4x3dv;
+extern PFNGLUNIFORMMATRIX4X3FVPROC glad_capture_real_glUniformMatrix4x3fv;
+extern PFNGLUNIFORMSUBROUTINESUIVPROC glad_capture_real_glUniformSubroutinesuiv;
+extern PFNGLUNMAPBUFFERPROC glad_capture_real_glUnmapBuffer;
+extern PFNGLUNMAPNAMEDBUFFERPROC glad_capture_real_glUnmapNamedBuffer;
+extern PFNGLUSEPROGRAMPROC glad_capture_real_glUseProgram;
+extern PFNGLUSEPROGRAMSTAGESPROC glad_capture_real_glUseProgramStages;
+extern PFNGLVALIDATEPROGRAMPROC glad_capture_real_glValidateProgram;
+extern PFNGLVALIDATEPROGRAMPIPELINEPROC glad_capture_real_glValidateProgramPipeline;
+extern PFNGLVERTEX2DPROC glad_capture_real_glVertex2d;
+extern PFNGLVERTEX2DVPROC glad_capture_real_glVertex2dv;
+extern PFNGLVERTEX2FPROC glad_capture_real_glVertex2f;
+extern PFNGLVERTEX2FVPROC glad_capture_real_glVertex2fv;
+extern PFNGLVERTEX2IPROC glad_capture_real_glVertex2i;
+extern PFNGLVERTEX2IVPROC glad_capture_real_glVertex2iv;
+extern PFNGLVERTEX2SPROC glad_capture_real_glVertex2s;
+extern PFNGLVERTEX2SVPROC glad_capture_real_glVertex2sv;
+extern PFNGLVERTEX3DPROC glad_capture_real_glVertex3d;
+extern PFNGLVERTEX3DVPROC glad_capture_real_glVertex3dv;
+extern PFNGLVERTEX3FPROC glad_capture_real_glVertex3f;
+extern PFNGLVERTEX3FVPROC glad_capture_real_glVertex3fv;
+extern PFNGLVERTEX3IPROC glad_capture_real_glVertex3i;
+extern PFNGLVERTEX3IVPROC glad_capture_real_glVertex3iv;
+extern PFNGLVERTEX3SPROC glad_capture_real_glVertex3s;
+extern PFNGLVERTEX3SVPROC glad_capture_real_glVertex3sv;
+extern PFNGLVERTEX4DPROC glad_capture_real_glVertex4d;
+extern PFNGLVERTEX4DVPROC glad_capture_real_glVertex4dv;
+extern PFNGLVERTEX4FPROC glad_capture_real_glVertex4f;
+extern PFNGLVERTEX4FVPROC glad_capture_real_glVertex4fv;
+extern PFNGLVERTEX4IPROC glad_capture_real_glVertex4i;
+extern PFNGLVERTEX4IVPROC glad_capture_real_glVertex4iv;
+extern PFNGLVERTEX4SPROC glad_capture_real_glVertex4s;
+extern PFNGLVERTEX4SVPROC glad_capture_real_glVertex4sv;
+extern PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_capture_real_glVertexArrayAttribBinding;
+extern PFNGLVERTEXARRAYATTRIBFORMATPROC glad_capture_real_glVertexArrayAttribFormat;
+extern PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_capture_real_glVertexArrayAttribIFormat;
+extern PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_capture_real_glVertexArrayAttribLFormat;
+extern PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_capture_real_glVertexArrayBindingDivisor;
+extern PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_capture_real_glVertexArrayElementBuffer;
+extern PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_capture_real_glVertexArrayVertexBuffer;
+extern PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_capture_real_glVertexArrayVertexBuffers;
+extern PFNGLVERTEXATTRIB1DPROC glad_capture_real_glVertexAttrib1d;
+extern PFNGLVERTEXATTRIB1DVPROC glad_capture_real_glVertexAttrib1dv;
+extern PFNGLVERTEXATTRIB1FPROC glad_capture_real_glVertexAttrib1f;
+extern PFNGLVERTEXATTRIB1FVPROC glad_capture_real_glVertexAttrib1fv;
+extern PFNGLVERTEXATTRIB1SPROC glad_capture_real_glVertexAttrib1s;
+extern PFNGLVERTEXATTRIB1SVPROC glad_capture_real_glVertexAttrib1sv;
+extern PFNGLVERTEXATTRIB2DPROC glad_capture_real_glVertexAttrib2d;
+extern PFNGLVERTEXATTRIB2DVPROC glad_capture_real_glVertexAttrib2dv;
+extern PFNGLVERTEXATTRIB2FPROC glad_capture_real_glVertexAttrib2f;
+extern PFNGLVERTEXATTRIB2FVPROC glad_capture_real_glVertexAttrib2fv;
+extern PFNGLVERTEXATTRIB2SPROC glad_capture_real_glVertexAttrib2s;
+extern PFNGLVERTEXATTRIB2SVPROC glad_capture_real_glVertexAttrib2sv;
+extern PFNGLVERTEXATTRIB3DPROC glad_capture_real_glVertexAttrib3d;
+extern PFNGLVERTEXATTRIB3DVPROC glad_capture_real_glVertexAttrib3dv;
+extern PFNGLVERTEXATTRIB3FPROC glad_capture_real_glVertexAttrib3f;
+extern PFNGLVERTEXATTRIB3FVPROC glad_capture_real_glVertexAttrib3fv;
+extern PFNGLVERTEXATTRIB3SPROC glad_capture_real_glVertexAttrib3s;
+extern PFNGLVERTEXATTRIB3SVPROC glad_capture_real_glVertexAttrib3sv;
+extern PFNGLVERTEXATTRIB4NBVPROC glad_capture_real_glVertexAttrib4Nbv;
+extern PFNGLVERTEXATTRIB4NIVPROC glad_capture_real_glVertexAttrib4Niv;
+extern PFNGLVERTEXATTRIB4NSVPROC glad_capture_real_glVertexAttrib4Nsv;
+extern PFNGLVERTEXATTRIB4NUBPROC glad_capture_real_glVertexAttrib4Nub;
+extern PFNGLVERTEXATTRIB4NUBVPROC glad_capture_real_glVertexAttrib4Nubv;
+extern PFNGLVERTEXATTRIB4NUIVPROC glad_capture_real_glVertexAttrib4Nuiv;
+extern PFNGLVERTEXATTRIB4NUSVPROC glad_capture_real_glVertexAttrib4Nusv;
+extern PFNGLVERTEXATTRIB4BVPROC glad_capture_real_glVertexAttrib4bv;
+extern PFNGLVERTEXATTRIB4DPROC glad_capture_real_glVertexAttrib4d;
+extern PFNGLVERTEXATTRIB4DVPROC glad_capture_real_glVertexAttrib4dv;
+extern PFNGLVERTEXATTRIB4FPROC glad_capture_real_glVertexAttrib4f;
+extern PFNGLVERTEXATTRIB4FVPROC glad_capture_real_glVertexAttrib4fv;
+extern PFNGLVERTEXATTRIB4IVPROC glad_capture_real_glVertexAttrib4iv;
+extern PFNGLVERTEXATTRIB4SPROC glad_capture_real_glVertexAttrib4s;
+extern PFNGLVERTEXATTRIB4SVPROC glad_capture_real_glVertexAttrib4sv;
+extern PFNGLVERTEXATTRIB4UBVPROC glad_capture_real_glVertexAttrib4ubv;
+extern PFNGLVERTEXATTRIB4UIVPROC glad_capture_real_glVertexAttrib4uiv;
+extern PFNGLVERTEXATTRIB4USVPROC glad_capture_real_glVertexAttrib4usv;
+extern PFNGLVERTEXATTRIBBINDINGPROC glad_capture_real_glVertexAttribBinding;
+extern PFNGLVERTEXATTRIBDIVISORPROC glad_capture_real_glVertexAttribDivisor;
+extern PFNGLVERTEXATTRIBFORMATPROC glad_capture_real_glVertexAttribFormat;
+extern PFNGLVERTEXATTRIBI1IPROC glad_capture_real_glVertexAttribI1i;
+extern PFNGLVERTEXATTRIBI1IVPROC glad_capture_real_glVertexAttribI1iv;
+extern PFNGLVERTEXATTRIBI1UIPROC glad_capture_real_glVertexAttribI1ui;
+extern PFNGLVERTEXATTRIBI1UIVPROC glad_capture_real_glVertexAttribI1uiv;
+extern PFNGLVERTEXATTRIBI2IPROC glad_capture_real_glVertexAttribI2i;
+extern PFNGLVERTEXATTRIBI2IVPROC glad_capture_real_glVertexAttribI2iv;
+extern PFNGLVERTEXATTRIBI2UIPROC glad_capture_real_glVertexAttribI2ui;
+extern PFNGLVERTEXATTRIBI2UIVPROC glad_capture_real_glVertexAttribI2uiv;
+extern PFNGLVERTEXATTRIBI3IPROC glad_capture_real_glVertexAttribI3i;
+extern PFNGLVERTEXATTRIBI3IVPROC glad_capture_real_glVertexAttribI3iv;
+extern PFNGLVERTEXATTRIBI3UIPROC glad_capture_real_glVertexAttribI3ui;
+extern PFNGLVERTEXATTRIBI3UIVPROC glad_capture_real_glVertexAttribI3uiv;
+extern PFNGLVERTEXATTRIBI4BVPROC glad_capture_real_glVertexAttribI4bv;
+extern PFNGLVERTEXATTRIBI4IPROC glad_capture_real_glVertexAttribI4i;
+extern PFNGLVERTEXATTRIBI4IVPROC glad_capture_real_glVertexAttribI4iv;
+extern PFNGLVERTEXATTRIBI4SVPROC glad_capture_real_glVertexAttribI4sv;
+extern PFNGLVERTEXATTRIBI4UBVPROC glad_capture_real_glVertexAttribI4ubv;
+extern PFNGLVERTEXATTRIBI4UIPROC glad_capture_real_glVertexAttribI4ui;
+extern PFNGLVERTEXATTRIBI4UIVPROC glad_capture_real_glVertexAttribI4uiv;
+extern PFNGLVERTEXATTRIBI4USVPROC glad_capture_real_glVertexAttribI4usv;
+extern PFNGLVERTEXATTRIBIFORMATPROC glad_capture_real_glVertexAttribIFormat;
+extern PFNGLVERTEXATTRIBIPOINTERPROC glad_capture_real_glVertexAttribIPointer;
+extern PFNGLVERTEXATTRIBL1DPROC glad_capture_real_glVertexAttribL1d;
+extern PFNGLVERTEXATTRIBL1DVPROC glad_capture_real_glVertexAttribL1dv;
+extern PFNGLVERTEXATTRIBL1UI64ARBPROC glad_capture_real_glVertexAttribL1ui64ARB;
+extern PFNGLVERTEXATTRIBL1UI64VARBPROC glad_capture_real_glVertexAttribL1ui64vARB;
+extern PFNGLVERTEXATTRIBL2DPROC glad_capture_real_glVertexAttribL2d;
+extern PFNGLVERTEXATTRIBL2DVPROC glad_capture_real_glVertexAttribL2dv;
+extern PFNGLVERTEXATTRIBL3DPROC glad_capture_real_glVertexAttribL3d;
+extern PFNGLVERTEXATTRIBL3DVPROC glad_capture_real_glVertexAttribL3dv;
+extern PFNGLVERTEXATTRIBL4DPROC glad_capture_real_glVertexAttribL4d;
+extern PFNGLVERTEXATTRIBL4DVPROC glad_capture_real_glVertexAttribL4dv;
+extern PFNGLVERTEXATTRIBLFORMATPROC glad_capture_real_glVertexAttribLFormat;
+extern PFNGLVERTEXATTRIBLPOINTERPROC glad_capture_real_glVertexAttribLPointer;
+extern PFNGLVERTEXATTRIBP1UIPROC glad_capture_real_glVertexAttribP1ui;
+extern PFNGLVERTEXATTRIBP1UIVPROC glad_capture_real_glVertexAttribP1uiv;
+extern PFNGLVERTEXATTRIBP2UIPROC glad_capture_real_glVertexAttribP2ui;
+extern PFNGLVERTEXATTRIBP2UIVPROC glad_capture_real_glVertexAttribP2uiv;
+extern PFNGLVERTEXATTRIBP3UIPROC glad_capture_real_glVertexAttribP3ui;
+extern PFNGLVERTEXATTRIBP3UIVPROC glad_capture_real_glVertexAttribP3uiv;
+extern PFNGLVERTEXATTRIBP4UIPROC glad_capture_real_glVertexAttribP4ui;
+extern PFNGLVERTEXATTRIBP4UIVPROC glad_capture_real_glVertexAttribP4uiv;
+extern PFNGLVERTEXATTRIBPOINTERPROC glad_capture_real_glVertexAttribPointer;
+extern PFNGLVERTEXBINDINGDIVISORPROC glad_capture_real_glVertexBindingDivisor;
+extern PFNGLVERTEXP2UIPROC glad_capture_real_glVertexP2ui;
+extern PFNGLVERTEXP2UIVPROC glad_capture_real_glVertexP2uiv;
+extern PFNGLVERTEXP3UIPROC glad_capture_real_glVertexP3ui;
+extern PFNGLVERTEXP3UIVPROC glad_capture_real_glVertexP3uiv;
+extern PFNGLVERTEXP4UIPROC glad_capture_real_glVertexP4ui;
+extern PFNGLVERTEXP4UIVPROC glad_capture_real_glVertexP4uiv;
+extern PFNGLVERTEXPOINTERPROC glad_capture_real_glVertexPointer;
+extern PFNGLVIEWPORTPROC glad_capture_real_glViewport;
+extern PFNGLVIEWPORTARRAYVPROC glad_capture_real_glViewportArrayv;
+extern PFNGLVIEWPORTINDEXEDFPROC glad_capture_real_glViewportIndexedf;
+extern PFNGLVIEWPORTINDEXEDFVPROC glad_capture_real_glViewportIndexedfv;
+extern PFNGLWAITSYNCPROC glad_capture_real_glWaitSync;
+extern PFNGLWINDOWPOS2DPROC glad_capture_real_glWindowPos2d;
+extern PFNGLWINDOWPOS2DVPROC glad_capture_real_glWindowPos2dv;
+extern PFNGLWINDOWPOS2FPROC glad_capture_real_glWindowPos2f;
+extern PFNGLWINDOWPOS2FVPROC glad_capture_real_glWindowPos2fv;
+extern PFNGLWINDOWPOS2IPROC glad_capture_real_glWindowPos2i;
+extern PFNGLWINDOWPOS2IVPROC glad_capture_real_glWindowPos2iv;
+extern PFNGLWINDOWPOS2SPROC glad_capture_real_glWindowPos2s;
+extern PFNGLWINDOWPOS2SVPROC glad_capture_real_glWindowPos2sv;
+extern PFNGLWINDOWPOS3DPROC glad_capture_real_glWindowPos3d;
+extern PFNGLWINDOWPOS3DVPROC glad_capture_real_glWindowPos3dv;
+extern PFNGLWINDOWPOS3FPROC glad_capture_real_glWindowPos3f;
+extern PFNGLWINDOWPOS3FVPROC glad_capture_real_glWindowPos3fv;
+extern PFNGLWINDOWPOS3IPROC glad_capture_real_glWindowPos3i;
+extern PFNGLWINDOWPOS3IVPROC glad_capture_real_glWindowPos3iv;
+extern PFNGLWINDOWPOS3SPROC glad_capture_real_glWindowPos3s;
+extern PFNGLWINDOWPOS3SVPROC glad_capture_real_glWindowPos3sv;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
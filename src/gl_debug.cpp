@@ -0,0 +1,174 @@
+/*
+ *	OpenGL error checking and call tracing, see gl_debug.h
+ */
+
+#include "gl_api.h"
+#include "gl_debug.h"
+
+#ifdef LEARNOPENGL_GL_DEBUG_LAYER
+
+#if defined(GLAD_MULTI_CONTEXT)
+#error "LEARNOPENGL_GL_DEBUG_LAYER wraps the process wide glad pointers, it can't be combined with GLAD_MULTI_CONTEXT"
+#endif
+
+#include <chrono>
+#include <cstdarg>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#define GL_DEBUG_BREAK() __debugbreak()
+#else
+#include <csignal>
+#define GL_DEBUG_BREAK() std::raise(SIGTRAP)
+#endif
+
+// used by the generated wrappers (C code)
+extern "C"
+{
+	int gl_debug_tracing = 0;
+	void gl_debug_trace_call(const char* name, const char* signature, ...);
+	void gl_debug_check_error(const char* name);
+}
+
+namespace
+{
+	GlDebugMode currentMode = GlDebugMode::Off;
+	std::FILE* traceOutput = nullptr;
+	bool breakOnError = false;
+	unsigned long long errors = 0;
+	std::chrono::steady_clock::time_point start;
+	bool checking = false;	// the wrappers check glGetError, false in Off so a stray wrapper call does nothing extra
+	// the driver's glGetError: the capture and stats layers replace glad's pointer with their wrappers, the checks must not show up
+	// in their counts and traces
+	PFNGLGETERRORPROC driverGetError = nullptr;
+}
+
+extern "C" void gl_debug_trace_call(const char* name, const char* signature, ...)
+{
+	std::FILE* out = traceOutput != nullptr ? traceOutput : stderr;
+	long long micros = (long long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+	std::fprintf(out, "%10lld %s(", micros, name);
+
+	va_list args;
+	va_start(args, signature);
+	for (const char* c = signature; *c != '\0'; c++)
+	{
+		if (c != signature)
+		{
+			std::fputs(", ", out);
+		}
+		switch (*c)
+		{
+		case 'e': std::fprintf(out, "0x%04X", va_arg(args, unsigned int)); break;						// GLenum
+		case 'b': std::fputs(va_arg(args, int) ? "GL_TRUE" : "GL_FALSE", out); break;					// GLboolean
+		case 'i': std::fprintf(out, "%d", va_arg(args, int)); break;
+		case 'u': std::fprintf(out, "%u", va_arg(args, unsigned int)); break;
+		case 'f': std::fprintf(out, "%g", va_arg(args, double)); break;
+		case 'l': std::fprintf(out, "%lld", va_arg(args, long long)); break;
+		case 'L': std::fprintf(out, "%llu", va_arg(args, unsigned long long)); break;
+		case 'p': std::fprintf(out, "%p", va_arg(args, const void*)); break;
+		}
+	}
+	va_end(args);
+	std::fputs(")\n", out);
+}
+
+extern "C" void gl_debug_check_error(const char* name)
+{
+	if (!checking)
+	{
+		return;
+	}
+	// several errors can be pending (one flag per kind in some drivers), read until GL_NO_ERROR
+	for (GLenum error = driverGetError(); error != GL_NO_ERROR; error = driverGetError())
+	{
+		errors++;
+		std::cout << "ERROR::GL::" << GlDebug::errorName(error) << " after " << name << std::endl;
+		if (gl_debug_tracing)
+		{
+			std::fprintf(traceOutput != nullptr ? traceOutput : stderr, "           ^ %s\n", GlDebug::errorName(error));
+		}
+		if (breakOnError)
+		{
+			GL_DEBUG_BREAK();
+		}
+	}
+}
+
+namespace GlDebug
+{
+	void saveDriverEntryPoints()
+	{
+		driverGetError = glad_glGetError;
+	}
+
+	void init()
+	{
+		if (driverGetError == nullptr)
+		{
+			saveDriverEntryPoints();	// nothing wrapped it yet, hopefully
+		}
+		start = std::chrono::steady_clock::now();
+		GlDebugMode initial = GlDebugMode::Errors;
+		const char* setting = std::getenv("LEARNOPENGL_GL_DEBUG");
+		if (setting != nullptr)
+		{
+			if (std::strcmp(setting, "off") == 0)			initial = GlDebugMode::Off;
+			else if (std::strcmp(setting, "trace") == 0)	initial = GlDebugMode::Trace;
+		}
+		setMode(initial);
+	}
+
+	void setMode(GlDebugMode mode)
+	{
+		currentMode = mode;
+		checking = mode != GlDebugMode::Off;
+		gl_debug_tracing = mode == GlDebugMode::Trace ? 1 : 0;
+		gl_debug_layer_install(checking ? 1 : 0);	// Off: the gl* pointers go straight to the driver again
+		if (checking)
+		{
+			while (driverGetError() != GL_NO_ERROR) {}	// errors from before are not ours to report
+		}
+	}
+
+	GlDebugMode mode()
+	{
+		return currentMode;
+	}
+
+	void setTraceOutput(std::FILE* file)
+	{
+		traceOutput = file;
+	}
+
+	void setBreakOnError(bool enabled)
+	{
+		breakOnError = enabled;
+	}
+
+	unsigned long long errorCount()
+	{
+		return errors;
+	}
+
+	const char* errorName(unsigned int error)
+	{
+		switch (error)
+		{
+		case GL_NO_ERROR:						return "GL_NO_ERROR";
+		case GL_INVALID_ENUM:					return "GL_INVALID_ENUM";
+		case GL_INVALID_VALUE:					return "GL_INVALID_VALUE";
+		case GL_INVALID_OPERATION:				return "GL_INVALID_OPERATION";
+		case GL_INVALID_FRAMEBUFFER_OPERATION:	return "GL_INVALID_FRAMEBUFFER_OPERATION";
+		case GL_OUT_OF_MEMORY:					return "GL_OUT_OF_MEMORY";
+		case GL_STACK_UNDERFLOW:				return "GL_STACK_UNDERFLOW";
+		case GL_STACK_OVERFLOW:					return "GL_STACK_OVERFLOW";
+		default:								return "unknown GL error";
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,66 @@
+#ifndef GL_DEBUG_H
+#define GL_DEBUG_H
+
+/*
+ * NOTES:
+ * OpenGL error checking and call tracing, compiled out unless LEARNOPENGL_GL_DEBUG_LAYER is defined (Debug configurations).
+ *
+ * OpenGL reports errors by setting a flag that glGetError() returns and clears, nothing happens unless someone asks. Asking after every
+ * call finds the call that failed, but glGetError waits for the driver to process everything before it, done everywhere in a release
+ * build that costs half the frame rate.
+ *
+ * So it is done by a generated layer (gl_debug_layer.h/.c) between our code and glad: every gl* name is redirected to a wrapper that
+ * calls the driver, optionally traces the call and then checks glGetError. Which happens is chosen while running:
+ *	*Off		the redirected pointers point straight at glad's driver entry points, calls cost the same as without the layer
+ *	*Errors		glGetError after every call, errors are printed with the name of the call that caused them
+ *	*Trace		Errors plus every call with its arguments and a timestamp (microseconds since init) written to the trace output
+ *
+ * The mode comes from the environment variable LEARNOPENGL_GL_DEBUG (off, errors or trace, errors when not set) at init(), or setMode().
+ * Without LEARNOPENGL_GL_DEBUG_LAYER the layer is not compiled at all and everything below is an empty inline function: release builds
+ * call the driver through glad exactly as before.
+ *
+ * The layer wraps glad's global pointers and can't be combined with GLAD_MULTI_CONTEXT (see gl_api.h). It sits above the capture and
+ * stats layers (gl_capture.h, gl_stats.h): a call goes through those too, but the glGetError after it goes straight to the driver
+ * entry point saved by saveDriverEntryPoints(), so the checks are neither counted nor recorded.
+ */
+
+#include <cstdio>
+
+enum class GlDebugMode
+{
+	Off,
+	Errors,
+	Trace
+};
+
+#ifdef LEARNOPENGL_GL_DEBUG_LAYER
+
+namespace GlDebug
+{
+	void saveDriverEntryPoints();				// right after gladLoadGLLoader, before any other layer wraps glad's pointers
+	void init();								// after gladLoadGLLoader, picks the mode from LEARNOPENGL_GL_DEBUG
+	void setMode(GlDebugMode mode);
+	GlDebugMode mode();
+	void setTraceOutput(std::FILE* file);		// stderr by default, not closed by us
+	void setBreakOnError(bool enabled);			// stop in the debugger at the failing call
+	unsigned long long errorCount();			// errors seen since init
+	const char* errorName(unsigned int error);	// "GL_INVALID_ENUM", ...
+}
+
+#else
+
+namespace GlDebug
+{
+	inline void saveDriverEntryPoints() {}
+	inline void init() {}
+	inline void setMode(GlDebugMode) {}
+	inline GlDebugMode mode() { return GlDebugMode::Off; }
+	inline void setTraceOutput(std::FILE*) {}
+	inline void setBreakOnError(bool) {}
+	inline unsigned long long errorCount() { return 0; }
+	inline const char* errorName(unsigned int) { return ""; }
+}
+
+#endif
+
+#endif
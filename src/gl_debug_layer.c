@@ -0,0 +1,7596 @@
+/*
+
+    Error checking and call tracing wrappers for the OpenGL loader generated by glad 0.1.34, see gl_debug_layer.h.
+
+    APIs: gl=4.6
+    Extensions: GL_ARB_bindless_texture,GL_ARB_buffer_storage,GL_ARB_direct_state_access,GL_ARB_gl_spirv,GL_ARB_invalidate_subdata,GL_ARB_multi_draw_indirect,GL_ATI_meminfo,GL_KHR_debug,GL_KHR_parallel_shader_compile,GL_NVX_gpu_memory_info
+
+    Generated by tools/gen_gl_layers.py from the function list of src/glad.c, do not edit. After regenerating the loader:
+        python tools/gen_gl_layers.py
+*/
+
+#ifdef LEARNOPENGL_GL_DEBUG_LAYER
+
+#include <glad/glad.h>
+#include "gl_debug_layer.h"
+
+/* in gl_debug.cpp */
+extern int gl_debug_tracing;
+void gl_debug_trace_call(const char* name, const char* signature, ...);
+void gl_debug_check_error(const char* name);
+
+static void APIENTRY glad_debug_impl_glAccum(GLenum arg0, GLfloat arg1) {
+	glad_glAccum(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glAccum", "ef", (unsigned int)arg0, (double)arg1);
+	gl_debug_check_error("glAccum");
+}
+PFNGLACCUMPROC glad_debug_glAccum = glad_debug_impl_glAccum;
+static void APIENTRY glad_debug_impl_glActiveShaderProgram(GLuint arg0, GLuint arg1) {
+	glad_glActiveShaderProgram(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glActiveShaderProgram", "uu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glActiveShaderProgram");
+}
+PFNGLACTIVESHADERPROGRAMPROC glad_debug_glActiveShaderProgram = glad_debug_impl_glActiveShaderProgram;
+static void APIENTRY glad_debug_impl_glActiveTexture(GLenum arg0) {
+	glad_glActiveTexture(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glActiveTexture", "e", (unsigned int)arg0);
+	gl_debug_check_error("glActiveTexture");
+}
+PFNGLACTIVETEXTUREPROC glad_debug_glActiveTexture = glad_debug_impl_glActiveTexture;
+static void APIENTRY glad_debug_impl_glAlphaFunc(GLenum arg0, GLclampf arg1) {
+	glad_glAlphaFunc(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glAlphaFunc", "ef", (unsigned int)arg0, (double)arg1);
+	gl_debug_check_error("glAlphaFunc");
+}
+PFNGLALPHAFUNCPROC glad_debug_glAlphaFunc = glad_debug_impl_glAlphaFunc;
+static GLboolean APIENTRY glad_debug_impl_glAreTexturesResident(GLsizei arg0, const GLuint * arg1, GLboolean * arg2) {
+	GLboolean ret;
+	ret = glad_glAreTexturesResident(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glAreTexturesResident", "ipp", (int)arg0, (const void*)arg1, (const void*)arg2);
+	gl_debug_check_error("glAreTexturesResident");
+	return ret;
+}
+PFNGLARETEXTURESRESIDENTPROC glad_debug_glAreTexturesResident = glad_debug_impl_glAreTexturesResident;
+static void APIENTRY glad_debug_impl_glArrayElement(GLint arg0) {
+	glad_glArrayElement(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glArrayElement", "i", (int)arg0);
+	gl_debug_check_error("glArrayElement");
+}
+PFNGLARRAYELEMENTPROC glad_debug_glArrayElement = glad_debug_impl_glArrayElement;
+static void APIENTRY glad_debug_impl_glAttachShader(GLuint arg0, GLuint arg1) {
+	glad_glAttachShader(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glAttachShader", "uu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glAttachShader");
+}
+PFNGLATTACHSHADERPROC glad_debug_glAttachShader = glad_debug_impl_glAttachShader;
+static void APIENTRY glad_debug_impl_glBegin(GLenum arg0) {
+	glad_glBegin(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glBegin", "e", (unsigned int)arg0);
+	gl_debug_check_error("glBegin");
+}
+PFNGLBEGINPROC glad_debug_glBegin = glad_debug_impl_glBegin;
+static void APIENTRY glad_debug_impl_glBeginConditionalRender(GLuint arg0, GLenum arg1) {
+	glad_glBeginConditionalRender(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glBeginConditionalRender", "ue", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glBeginConditionalRender");
+}
+PFNGLBEGINCONDITIONALRENDERPROC glad_debug_glBeginConditionalRender = glad_debug_impl_glBeginConditionalRender;
+static void APIENTRY glad_debug_impl_glBeginQuery(GLenum arg0, GLuint arg1) {
+	glad_glBeginQuery(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glBeginQuery", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glBeginQuery");
+}
+PFNGLBEGINQUERYPROC glad_debug_glBeginQuery = glad_debug_impl_glBeginQuery;
+static void APIENTRY glad_debug_impl_glBeginQueryIndexed(GLenum arg0, GLuint arg1, GLuint arg2) {
+	glad_glBeginQueryIndexed(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glBeginQueryIndexed", "euu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glBeginQueryIndexed");
+}
+PFNGLBEGINQUERYINDEXEDPROC glad_debug_glBeginQueryIndexed = glad_debug_impl_glBeginQueryIndexed;
+static void APIENTRY glad_debug_impl_glBeginTransformFeedback(GLenum arg0) {
+	glad_glBeginTransformFeedback(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glBeginTransformFeedback", "e", (unsigned int)arg0);
+	gl_debug_check_error("glBeginTransformFeedback");
+}
+PFNGLBEGINTRANSFORMFEEDBACKPROC glad_debug_glBeginTransformFeedback = glad_debug_impl_glBeginTransformFeedback;
+static void APIENTRY glad_debug_impl_glBindAttribLocation(GLuint arg0, GLuint arg1, const GLchar * arg2) {
+	glad_glBindAttribLocation(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindAttribLocation", "uup", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glBindAttribLocation");
+}
+PFNGLBINDATTRIBLOCATIONPROC glad_debug_glBindAttribLocation = glad_debug_impl_glBindAttribLocation;
+static void APIENTRY glad_debug_impl_glBindBuffer(GLenum arg0, GLuint arg1) {
+	glad_glBindBuffer(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindBuffer", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glBindBuffer");
+}
+PFNGLBINDBUFFERPROC glad_debug_glBindBuffer = glad_debug_impl_glBindBuffer;
+static void APIENTRY glad_debug_impl_glBindBufferBase(GLenum arg0, GLuint arg1, GLuint arg2) {
+	glad_glBindBufferBase(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindBufferBase", "euu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glBindBufferBase");
+}
+PFNGLBINDBUFFERBASEPROC glad_debug_glBindBufferBase = glad_debug_impl_glBindBufferBase;
+static void APIENTRY glad_debug_impl_glBindBufferRange(GLenum arg0, GLuint arg1, GLuint arg2, GLintptr arg3, GLsizeiptr arg4) {
+	glad_glBindBufferRange(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindBufferRange", "euull", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (long long)arg3, (long long)arg4);
+	gl_debug_check_error("glBindBufferRange");
+}
+PFNGLBINDBUFFERRANGEPROC glad_debug_glBindBufferRange = glad_debug_impl_glBindBufferRange;
+static void APIENTRY glad_debug_impl_glBindBuffersBase(GLenum arg0, GLuint arg1, GLsizei arg2, const GLuint * arg3) {
+	glad_glBindBuffersBase(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindBuffersBase", "euip", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glBindBuffersBase");
+}
+PFNGLBINDBUFFERSBASEPROC glad_debug_glBindBuffersBase = glad_debug_impl_glBindBuffersBase;
+static void APIENTRY glad_debug_impl_glBindBuffersRange(GLenum arg0, GLuint arg1, GLsizei arg2, const GLuint * arg3, const GLintptr * arg4, const GLsizeiptr * arg5) {
+	glad_glBindBuffersRange(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindBuffersRange", "euippp", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3, (const void*)arg4, (const void*)arg5);
+	gl_debug_check_error("glBindBuffersRange");
+}
+PFNGLBINDBUFFERSRANGEPROC glad_debug_glBindBuffersRange = glad_debug_impl_glBindBuffersRange;
+static void APIENTRY glad_debug_impl_glBindFragDataLocation(GLuint arg0, GLuint arg1, const GLchar * arg2) {
+	glad_glBindFragDataLocation(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindFragDataLocation", "uup", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glBindFragDataLocation");
+}
+PFNGLBINDFRAGDATALOCATIONPROC glad_debug_glBindFragDataLocation = glad_debug_impl_glBindFragDataLocation;
+static void APIENTRY glad_debug_impl_glBindFragDataLocationIndexed(GLuint arg0, GLuint arg1, GLuint arg2, const GLchar * arg3) {
+	glad_glBindFragDataLocationIndexed(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindFragDataLocationIndexed", "uuup", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (const void*)arg3);
+	gl_debug_check_error("glBindFragDataLocationIndexed");
+}
+PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_debug_glBindFragDataLocationIndexed = glad_debug_impl_glBindFragDataLocationIndexed;
+static void APIENTRY glad_debug_impl_glBindFramebuffer(GLenum arg0, GLuint arg1) {
+	glad_glBindFramebuffer(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindFramebuffer", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glBindFramebuffer");
+}
+PFNGLBINDFRAMEBUFFERPROC glad_debug_glBindFramebuffer = glad_debug_impl_glBindFramebuffer;
+static void APIENTRY glad_debug_impl_glBindImageTexture(GLuint arg0, GLuint arg1, GLint arg2, GLboolean arg3, GLint arg4, GLenum arg5, GLenum arg6) {
+	glad_glBindImageTexture(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindImageTexture", "uuibiee", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (int)arg3, (int)arg4, (unsigned int)arg5, (unsigned int)arg6);
+	gl_debug_check_error("glBindImageTexture");
+}
+PFNGLBINDIMAGETEXTUREPROC glad_debug_glBindImageTexture = glad_debug_impl_glBindImageTexture;
+static void APIENTRY glad_debug_impl_glBindImageTextures(GLuint arg0, GLsizei arg1, const GLuint * arg2) {
+	glad_glBindImageTextures(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindImageTextures", "uip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glBindImageTextures");
+}
+PFNGLBINDIMAGETEXTURESPROC glad_debug_glBindImageTextures = glad_debug_impl_glBindImageTextures;
+static void APIENTRY glad_debug_impl_glBindProgramPipeline(GLuint arg0) {
+	glad_glBindProgramPipeline(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindProgramPipeline", "u", (unsigned int)arg0);
+	gl_debug_check_error("glBindProgramPipeline");
+}
+PFNGLBINDPROGRAMPIPELINEPROC glad_debug_glBindProgramPipeline = glad_debug_impl_glBindProgramPipeline;
+static void APIENTRY glad_debug_impl_glBindRenderbuffer(GLenum arg0, GLuint arg1) {
+	glad_glBindRenderbuffer(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindRenderbuffer", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glBindRenderbuffer");
+}
+PFNGLBINDRENDERBUFFERPROC glad_debug_glBindRenderbuffer = glad_debug_impl_glBindRenderbuffer;
+static void APIENTRY glad_debug_impl_glBindSampler(GLuint arg0, GLuint arg1) {
+	glad_glBindSampler(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindSampler", "uu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glBindSampler");
+}
+PFNGLBINDSAMPLERPROC glad_debug_glBindSampler = glad_debug_impl_glBindSampler;
+static void APIENTRY glad_debug_impl_glBindSamplers(GLuint arg0, GLsizei arg1, const GLuint * arg2) {
+	glad_glBindSamplers(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindSamplers", "uip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glBindSamplers");
+}
+PFNGLBINDSAMPLERSPROC glad_debug_glBindSamplers = glad_debug_impl_glBindSamplers;
+static void APIENTRY glad_debug_impl_glBindTexture(GLenum arg0, GLuint arg1) {
+	glad_glBindTexture(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindTexture", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glBindTexture");
+}
+PFNGLBINDTEXTUREPROC glad_debug_glBindTexture = glad_debug_impl_glBindTexture;
+static void APIENTRY glad_debug_impl_glBindTextureUnit(GLuint arg0, GLuint arg1) {
+	glad_glBindTextureUnit(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindTextureUnit", "uu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glBindTextureUnit");
+}
+PFNGLBINDTEXTUREUNITPROC glad_debug_glBindTextureUnit = glad_debug_impl_glBindTextureUnit;
+static void APIENTRY glad_debug_impl_glBindTextures(GLuint arg0, GLsizei arg1, const GLuint * arg2) {
+	glad_glBindTextures(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindTextures", "uip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glBindTextures");
+}
+PFNGLBINDTEXTURESPROC glad_debug_glBindTextures = glad_debug_impl_glBindTextures;
+static void APIENTRY glad_debug_impl_glBindTransformFeedback(GLenum arg0, GLuint arg1) {
+	glad_glBindTransformFeedback(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindTransformFeedback", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glBindTransformFeedback");
+}
+PFNGLBINDTRANSFORMFEEDBACKPROC glad_debug_glBindTransformFeedback = glad_debug_impl_glBindTransformFeedback;
+static void APIENTRY glad_debug_impl_glBindVertexArray(GLuint arg0) {
+	glad_glBindVertexArray(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindVertexArray", "u", (unsigned int)arg0);
+	gl_debug_check_error("glBindVertexArray");
+}
+PFNGLBINDVERTEXARRAYPROC glad_debug_glBindVertexArray = glad_debug_impl_glBindVertexArray;
+static void APIENTRY glad_debug_impl_glBindVertexBuffer(GLuint arg0, GLuint arg1, GLintptr arg2, GLsizei arg3) {
+	glad_glBindVertexBuffer(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindVertexBuffer", "uuli", (unsigned int)arg0, (unsigned int)arg1, (long long)arg2, (int)arg3);
+	gl_debug_check_error("glBindVertexBuffer");
+}
+PFNGLBINDVERTEXBUFFERPROC glad_debug_glBindVertexBuffer = glad_debug_impl_glBindVertexBuffer;
+static void APIENTRY glad_debug_impl_glBindVertexBuffers(GLuint arg0, GLsizei arg1, const GLuint * arg2, const GLintptr * arg3, const GLsizei * arg4) {
+	glad_glBindVertexBuffers(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glBindVertexBuffers", "uippp", (unsigned int)arg0, (int)arg1, (const void*)arg2, (const void*)arg3, (const void*)arg4);
+	gl_debug_check_error("glBindVertexBuffers");
+}
+PFNGLBINDVERTEXBUFFERSPROC glad_debug_glBindVertexBuffers = glad_debug_impl_glBindVertexBuffers;
+static void APIENTRY glad_debug_impl_glBitmap(GLsizei arg0, GLsizei arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4, GLfloat arg5, const GLubyte * arg6) {
+	glad_glBitmap(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glBitmap", "iiffffp", (int)arg0, (int)arg1, (double)arg2, (double)arg3, (double)arg4, (double)arg5, (const void*)arg6);
+	gl_debug_check_error("glBitmap");
+}
+PFNGLBITMAPPROC glad_debug_glBitmap = glad_debug_impl_glBitmap;
+static void APIENTRY glad_debug_impl_glBlendColor(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	glad_glBlendColor(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glBlendColor", "ffff", (double)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glBlendColor");
+}
+PFNGLBLENDCOLORPROC glad_debug_glBlendColor = glad_debug_impl_glBlendColor;
+static void APIENTRY glad_debug_impl_glBlendEquation(GLenum arg0) {
+	glad_glBlendEquation(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glBlendEquation", "e", (unsigned int)arg0);
+	gl_debug_check_error("glBlendEquation");
+}
+PFNGLBLENDEQUATIONPROC glad_debug_glBlendEquation = glad_debug_impl_glBlendEquation;
+static void APIENTRY glad_debug_impl_glBlendEquationSeparate(GLenum arg0, GLenum arg1) {
+	glad_glBlendEquationSeparate(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glBlendEquationSeparate", "ee", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glBlendEquationSeparate");
+}
+PFNGLBLENDEQUATIONSEPARATEPROC glad_debug_glBlendEquationSeparate = glad_debug_impl_glBlendEquationSeparate;
+static void APIENTRY glad_debug_impl_glBlendEquationSeparatei(GLuint arg0, GLenum arg1, GLenum arg2) {
+	glad_glBlendEquationSeparatei(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glBlendEquationSeparatei", "uee", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glBlendEquationSeparatei");
+}
+PFNGLBLENDEQUATIONSEPARATEIPROC glad_debug_glBlendEquationSeparatei = glad_debug_impl_glBlendEquationSeparatei;
+static void APIENTRY glad_debug_impl_glBlendEquationi(GLuint arg0, GLenum arg1) {
+	glad_glBlendEquationi(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glBlendEquationi", "ue", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glBlendEquationi");
+}
+PFNGLBLENDEQUATIONIPROC glad_debug_glBlendEquationi = glad_debug_impl_glBlendEquationi;
+static void APIENTRY glad_debug_impl_glBlendFunc(GLenum arg0, GLenum arg1) {
+	glad_glBlendFunc(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glBlendFunc", "ee", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glBlendFunc");
+}
+PFNGLBLENDFUNCPROC glad_debug_glBlendFunc = glad_debug_impl_glBlendFunc;
+static void APIENTRY glad_debug_impl_glBlendFuncSeparate(GLenum arg0, GLenum arg1, GLenum arg2, GLenum arg3) {
+	glad_glBlendFuncSeparate(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glBlendFuncSeparate", "eeee", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glBlendFuncSeparate");
+}
+PFNGLBLENDFUNCSEPARATEPROC glad_debug_glBlendFuncSeparate = glad_debug_impl_glBlendFuncSeparate;
+static void APIENTRY glad_debug_impl_glBlendFuncSeparatei(GLuint arg0, GLenum arg1, GLenum arg2, GLenum arg3, GLenum arg4) {
+	glad_glBlendFuncSeparatei(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glBlendFuncSeparatei", "ueeee", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (unsigned int)arg3, (unsigned int)arg4);
+	gl_debug_check_error("glBlendFuncSeparatei");
+}
+PFNGLBLENDFUNCSEPARATEIPROC glad_debug_glBlendFuncSeparatei = glad_debug_impl_glBlendFuncSeparatei;
+static void APIENTRY glad_debug_impl_glBlendFunci(GLuint arg0, GLenum arg1, GLenum arg2) {
+	glad_glBlendFunci(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glBlendFunci", "uee", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glBlendFunci");
+}
+PFNGLBLENDFUNCIPROC glad_debug_glBlendFunci = glad_debug_impl_glBlendFunci;
+static void APIENTRY glad_debug_impl_glBlitFramebuffer(GLint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLint arg7, GLbitfield arg8, GLenum arg9) {
+	glad_glBlitFramebuffer(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+	if (gl_debug_tracing) gl_debug_trace_call("glBlitFramebuffer", "iiiiiiiiue", (int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6, (int)arg7, (unsigned int)arg8, (unsigned int)arg9);
+	gl_debug_check_error("glBlitFramebuffer");
+}
+PFNGLBLITFRAMEBUFFERPROC glad_debug_glBlitFramebuffer = glad_debug_impl_glBlitFramebuffer;
+static void APIENTRY glad_debug_impl_glBlitNamedFramebuffer(GLuint arg0, GLuint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLint arg7, GLint arg8, GLint arg9, GLbitfield arg10, GLenum arg11) {
+	glad_glBlitNamedFramebuffer(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11);
+	if (gl_debug_tracing) gl_debug_trace_call("glBlitNamedFramebuffer", "uuiiiiiiiiue", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6, (int)arg7, (int)arg8, (int)arg9, (unsigned int)arg10, (unsigned int)arg11);
+	gl_debug_check_error("glBlitNamedFramebuffer");
+}
+PFNGLBLITNAMEDFRAMEBUFFERPROC glad_debug_glBlitNamedFramebuffer = glad_debug_impl_glBlitNamedFramebuffer;
+static void APIENTRY glad_debug_impl_glBufferData(GLenum arg0, GLsizeiptr arg1, const void * arg2, GLenum arg3) {
+	glad_glBufferData(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glBufferData", "elpe", (unsigned int)arg0, (long long)arg1, (const void*)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glBufferData");
+}
+PFNGLBUFFERDATAPROC glad_debug_glBufferData = glad_debug_impl_glBufferData;
+static void APIENTRY glad_debug_impl_glBufferStorage(GLenum arg0, GLsizeiptr arg1, const void * arg2, GLbitfield arg3) {
+	glad_glBufferStorage(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glBufferStorage", "elpu", (unsigned int)arg0, (long long)arg1, (const void*)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glBufferStorage");
+}
+PFNGLBUFFERSTORAGEPROC glad_debug_glBufferStorage = glad_debug_impl_glBufferStorage;
+static void APIENTRY glad_debug_impl_glBufferSubData(GLenum arg0, GLintptr arg1, GLsizeiptr arg2, const void * arg3) {
+	glad_glBufferSubData(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glBufferSubData", "ellp", (unsigned int)arg0, (long long)arg1, (long long)arg2, (const void*)arg3);
+	gl_debug_check_error("glBufferSubData");
+}
+PFNGLBUFFERSUBDATAPROC glad_debug_glBufferSubData = glad_debug_impl_glBufferSubData;
+static void APIENTRY glad_debug_impl_glCallList(GLuint arg0) {
+	glad_glCallList(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glCallList", "u", (unsigned int)arg0);
+	gl_debug_check_error("glCallList");
+}
+PFNGLCALLLISTPROC glad_debug_glCallList = glad_debug_impl_glCallList;
+static void APIENTRY glad_debug_impl_glCallLists(GLsizei arg0, GLenum arg1, const void * arg2) {
+	glad_glCallLists(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glCallLists", "iep", (int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glCallLists");
+}
+PFNGLCALLLISTSPROC glad_debug_glCallLists = glad_debug_impl_glCallLists;
+static GLenum APIENTRY glad_debug_impl_glCheckFramebufferStatus(GLenum arg0) {
+	GLenum ret;
+	ret = glad_glCheckFramebufferStatus(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glCheckFramebufferStatus", "e", (unsigned int)arg0);
+	gl_debug_check_error("glCheckFramebufferStatus");
+	return ret;
+}
+PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_debug_glCheckFramebufferStatus = glad_debug_impl_glCheckFramebufferStatus;
+static GLenum APIENTRY glad_debug_impl_glCheckNamedFramebufferStatus(GLuint arg0, GLenum arg1) {
+	GLenum ret;
+	ret = glad_glCheckNamedFramebufferStatus(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glCheckNamedFramebufferStatus", "ue", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glCheckNamedFramebufferStatus");
+	return ret;
+}
+PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC glad_debug_glCheckNamedFramebufferStatus = glad_debug_impl_glCheckNamedFramebufferStatus;
+static void APIENTRY glad_debug_impl_glClampColor(GLenum arg0, GLenum arg1) {
+	glad_glClampColor(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glClampColor", "ee", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glClampColor");
+}
+PFNGLCLAMPCOLORPROC glad_debug_glClampColor = glad_debug_impl_glClampColor;
+static void APIENTRY glad_debug_impl_glClear(GLbitfield arg0) {
+	glad_glClear(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glClear", "u", (unsigned int)arg0);
+	gl_debug_check_error("glClear");
+}
+PFNGLCLEARPROC glad_debug_glClear = glad_debug_impl_glClear;
+static void APIENTRY glad_debug_impl_glClearAccum(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	glad_glClearAccum(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearAccum", "ffff", (double)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glClearAccum");
+}
+PFNGLCLEARACCUMPROC glad_debug_glClearAccum = glad_debug_impl_glClearAccum;
+static void APIENTRY glad_debug_impl_glClearBufferData(GLenum arg0, GLenum arg1, GLenum arg2, GLenum arg3, const void * arg4) {
+	glad_glClearBufferData(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearBufferData", "eeeep", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (unsigned int)arg3, (const void*)arg4);
+	gl_debug_check_error("glClearBufferData");
+}
+PFNGLCLEARBUFFERDATAPROC glad_debug_glClearBufferData = glad_debug_impl_glClearBufferData;
+static void APIENTRY glad_debug_impl_glClearBufferSubData(GLenum arg0, GLenum arg1, GLintptr arg2, GLsizeiptr arg3, GLenum arg4, GLenum arg5, const void * arg6) {
+	glad_glClearBufferSubData(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearBufferSubData", "eelleep", (unsigned int)arg0, (unsigned int)arg1, (long long)arg2, (long long)arg3, (unsigned int)arg4, (unsigned int)arg5, (const void*)arg6);
+	gl_debug_check_error("glClearBufferSubData");
+}
+PFNGLCLEARBUFFERSUBDATAPROC glad_debug_glClearBufferSubData = glad_debug_impl_glClearBufferSubData;
+static void APIENTRY glad_debug_impl_glClearBufferfi(GLenum arg0, GLint arg1, GLfloat arg2, GLint arg3) {
+	glad_glClearBufferfi(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearBufferfi", "eifi", (unsigned int)arg0, (int)arg1, (double)arg2, (int)arg3);
+	gl_debug_check_error("glClearBufferfi");
+}
+PFNGLCLEARBUFFERFIPROC glad_debug_glClearBufferfi = glad_debug_impl_glClearBufferfi;
+static void APIENTRY glad_debug_impl_glClearBufferfv(GLenum arg0, GLint arg1, const GLfloat * arg2) {
+	glad_glClearBufferfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearBufferfv", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glClearBufferfv");
+}
+PFNGLCLEARBUFFERFVPROC glad_debug_glClearBufferfv = glad_debug_impl_glClearBufferfv;
+static void APIENTRY glad_debug_impl_glClearBufferiv(GLenum arg0, GLint arg1, const GLint * arg2) {
+	glad_glClearBufferiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearBufferiv", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glClearBufferiv");
+}
+PFNGLCLEARBUFFERIVPROC glad_debug_glClearBufferiv = glad_debug_impl_glClearBufferiv;
+static void APIENTRY glad_debug_impl_glClearBufferuiv(GLenum arg0, GLint arg1, const GLuint * arg2) {
+	glad_glClearBufferuiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearBufferuiv", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glClearBufferuiv");
+}
+PFNGLCLEARBUFFERUIVPROC glad_debug_glClearBufferuiv = glad_debug_impl_glClearBufferuiv;
+static void APIENTRY glad_debug_impl_glClearColor(GLclampf arg0, GLclampf arg1, GLclampf arg2, GLclampf arg3) {
+	glad_glClearColor(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearColor", "ffff", (double)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glClearColor");
+}
+PFNGLCLEARCOLORPROC glad_debug_glClearColor = glad_debug_impl_glClearColor;
+static void APIENTRY glad_debug_impl_glClearDepth(GLclampd arg0) {
+	glad_glClearDepth(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearDepth", "f", (double)arg0);
+	gl_debug_check_error("glClearDepth");
+}
+PFNGLCLEARDEPTHPROC glad_debug_glClearDepth = glad_debug_impl_glClearDepth;
+static void APIENTRY glad_debug_impl_glClearDepthf(GLfloat arg0) {
+	glad_glClearDepthf(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearDepthf", "f", (double)arg0);
+	gl_debug_check_error("glClearDepthf");
+}
+PFNGLCLEARDEPTHFPROC glad_debug_glClearDepthf = glad_debug_impl_glClearDepthf;
+static void APIENTRY glad_debug_impl_glClearIndex(GLfloat arg0) {
+	glad_glClearIndex(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearIndex", "f", (double)arg0);
+	gl_debug_check_error("glClearIndex");
+}
+PFNGLCLEARINDEXPROC glad_debug_glClearIndex = glad_debug_impl_glClearIndex;
+static void APIENTRY glad_debug_impl_glClearNamedBufferData(GLuint arg0, GLenum arg1, GLenum arg2, GLenum arg3, const void * arg4) {
+	glad_glClearNamedBufferData(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearNamedBufferData", "ueeep", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (unsigned int)arg3, (const void*)arg4);
+	gl_debug_check_error("glClearNamedBufferData");
+}
+PFNGLCLEARNAMEDBUFFERDATAPROC glad_debug_glClearNamedBufferData = glad_debug_impl_glClearNamedBufferData;
+static void APIENTRY glad_debug_impl_glClearNamedBufferSubData(GLuint arg0, GLenum arg1, GLintptr arg2, GLsizeiptr arg3, GLenum arg4, GLenum arg5, const void * arg6) {
+	glad_glClearNamedBufferSubData(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearNamedBufferSubData", "uelleep", (unsigned int)arg0, (unsigned int)arg1, (long long)arg2, (long long)arg3, (unsigned int)arg4, (unsigned int)arg5, (const void*)arg6);
+	gl_debug_check_error("glClearNamedBufferSubData");
+}
+PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_debug_glClearNamedBufferSubData = glad_debug_impl_glClearNamedBufferSubData;
+static void APIENTRY glad_debug_impl_glClearNamedFramebufferfi(GLuint arg0, GLenum arg1, GLint arg2, GLfloat arg3, GLint arg4) {
+	glad_glClearNamedFramebufferfi(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearNamedFramebufferfi", "ueifi", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (double)arg3, (int)arg4);
+	gl_debug_check_error("glClearNamedFramebufferfi");
+}
+PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_debug_glClearNamedFramebufferfi = glad_debug_impl_glClearNamedFramebufferfi;
+static void APIENTRY glad_debug_impl_glClearNamedFramebufferfv(GLuint arg0, GLenum arg1, GLint arg2, const GLfloat * arg3) {
+	glad_glClearNamedFramebufferfv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearNamedFramebufferfv", "ueip", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glClearNamedFramebufferfv");
+}
+PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_debug_glClearNamedFramebufferfv = glad_debug_impl_glClearNamedFramebufferfv;
+static void APIENTRY glad_debug_impl_glClearNamedFramebufferiv(GLuint arg0, GLenum arg1, GLint arg2, const GLint * arg3) {
+	glad_glClearNamedFramebufferiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearNamedFramebufferiv", "ueip", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glClearNamedFramebufferiv");
+}
+PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_debug_glClearNamedFramebufferiv = glad_debug_impl_glClearNamedFramebufferiv;
+static void APIENTRY glad_debug_impl_glClearNamedFramebufferuiv(GLuint arg0, GLenum arg1, GLint arg2, const GLuint * arg3) {
+	glad_glClearNamedFramebufferuiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearNamedFramebufferuiv", "ueip", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glClearNamedFramebufferuiv");
+}
+PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_debug_glClearNamedFramebufferuiv = glad_debug_impl_glClearNamedFramebufferuiv;
+static void APIENTRY glad_debug_impl_glClearStencil(GLint arg0) {
+	glad_glClearStencil(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearStencil", "i", (int)arg0);
+	gl_debug_check_error("glClearStencil");
+}
+PFNGLCLEARSTENCILPROC glad_debug_glClearStencil = glad_debug_impl_glClearStencil;
+static void APIENTRY glad_debug_impl_glClearTexImage(GLuint arg0, GLint arg1, GLenum arg2, GLenum arg3, const void * arg4) {
+	glad_glClearTexImage(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearTexImage", "uieep", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (unsigned int)arg3, (const void*)arg4);
+	gl_debug_check_error("glClearTexImage");
+}
+PFNGLCLEARTEXIMAGEPROC glad_debug_glClearTexImage = glad_debug_impl_glClearTexImage;
+static void APIENTRY glad_debug_impl_glClearTexSubImage(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLenum arg9, const void * arg10) {
+	glad_glClearTexSubImage(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+	if (gl_debug_tracing) gl_debug_trace_call("glClearTexSubImage", "uiiiiiiieep", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6, (int)arg7, (unsigned int)arg8, (unsigned int)arg9, (const void*)arg10);
+	gl_debug_check_error("glClearTexSubImage");
+}
+PFNGLCLEARTEXSUBIMAGEPROC glad_debug_glClearTexSubImage = glad_debug_impl_glClearTexSubImage;
+static void APIENTRY glad_debug_impl_glClientActiveTexture(GLenum arg0) {
+	glad_glClientActiveTexture(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glClientActiveTexture", "e", (unsigned int)arg0);
+	gl_debug_check_error("glClientActiveTexture");
+}
+PFNGLCLIENTACTIVETEXTUREPROC glad_debug_glClientActiveTexture = glad_debug_impl_glClientActiveTexture;
+static GLenum APIENTRY glad_debug_impl_glClientWaitSync(GLsync arg0, GLbitfield arg1, GLuint64 arg2) {
+	GLenum ret;
+	ret = glad_glClientWaitSync(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glClientWaitSync", "puL", (const void*)arg0, (unsigned int)arg1, (unsigned long long)arg2);
+	gl_debug_check_error("glClientWaitSync");
+	return ret;
+}
+PFNGLCLIENTWAITSYNCPROC glad_debug_glClientWaitSync = glad_debug_impl_glClientWaitSync;
+static void APIENTRY glad_debug_impl_glClipControl(GLenum arg0, GLenum arg1) {
+	glad_glClipControl(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glClipControl", "ee", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glClipControl");
+}
+PFNGLCLIPCONTROLPROC glad_debug_glClipControl = glad_debug_impl_glClipControl;
+static void APIENTRY glad_debug_impl_glClipPlane(GLenum arg0, const GLdouble * arg1) {
+	glad_glClipPlane(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glClipPlane", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glClipPlane");
+}
+PFNGLCLIPPLANEPROC glad_debug_glClipPlane = glad_debug_impl_glClipPlane;
+static void APIENTRY glad_debug_impl_glColor3b(GLbyte arg0, GLbyte arg1, GLbyte arg2) {
+	glad_glColor3b(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor3b", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glColor3b");
+}
+PFNGLCOLOR3BPROC glad_debug_glColor3b = glad_debug_impl_glColor3b;
+static void APIENTRY glad_debug_impl_glColor3bv(const GLbyte * arg0) {
+	glad_glColor3bv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor3bv", "p", (const void*)arg0);
+	gl_debug_check_error("glColor3bv");
+}
+PFNGLCOLOR3BVPROC glad_debug_glColor3bv = glad_debug_impl_glColor3bv;
+static void APIENTRY glad_debug_impl_glColor3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	glad_glColor3d(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor3d", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glColor3d");
+}
+PFNGLCOLOR3DPROC glad_debug_glColor3d = glad_debug_impl_glColor3d;
+static void APIENTRY glad_debug_impl_glColor3dv(const GLdouble * arg0) {
+	glad_glColor3dv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor3dv", "p", (const void*)arg0);
+	gl_debug_check_error("glColor3dv");
+}
+PFNGLCOLOR3DVPROC glad_debug_glColor3dv = glad_debug_impl_glColor3dv;
+static void APIENTRY glad_debug_impl_glColor3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	glad_glColor3f(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor3f", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glColor3f");
+}
+PFNGLCOLOR3FPROC glad_debug_glColor3f = glad_debug_impl_glColor3f;
+static void APIENTRY glad_debug_impl_glColor3fv(const GLfloat * arg0) {
+	glad_glColor3fv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor3fv", "p", (const void*)arg0);
+	gl_debug_check_error("glColor3fv");
+}
+PFNGLCOLOR3FVPROC glad_debug_glColor3fv = glad_debug_impl_glColor3fv;
+static void APIENTRY glad_debug_impl_glColor3i(GLint arg0, GLint arg1, GLint arg2) {
+	glad_glColor3i(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor3i", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glColor3i");
+}
+PFNGLCOLOR3IPROC glad_debug_glColor3i = glad_debug_impl_glColor3i;
+static void APIENTRY glad_debug_impl_glColor3iv(const GLint * arg0) {
+	glad_glColor3iv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor3iv", "p", (const void*)arg0);
+	gl_debug_check_error("glColor3iv");
+}
+PFNGLCOLOR3IVPROC glad_debug_glColor3iv = glad_debug_impl_glColor3iv;
+static void APIENTRY glad_debug_impl_glColor3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	glad_glColor3s(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor3s", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glColor3s");
+}
+PFNGLCOLOR3SPROC glad_debug_glColor3s = glad_debug_impl_glColor3s;
+static void APIENTRY glad_debug_impl_glColor3sv(const GLshort * arg0) {
+	glad_glColor3sv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor3sv", "p", (const void*)arg0);
+	gl_debug_check_error("glColor3sv");
+}
+PFNGLCOLOR3SVPROC glad_debug_glColor3sv = glad_debug_impl_glColor3sv;
+static void APIENTRY glad_debug_impl_glColor3ub(GLubyte arg0, GLubyte arg1, GLubyte arg2) {
+	glad_glColor3ub(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor3ub", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glColor3ub");
+}
+PFNGLCOLOR3UBPROC glad_debug_glColor3ub = glad_debug_impl_glColor3ub;
+static void APIENTRY glad_debug_impl_glColor3ubv(const GLubyte * arg0) {
+	glad_glColor3ubv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor3ubv", "p", (const void*)arg0);
+	gl_debug_check_error("glColor3ubv");
+}
+PFNGLCOLOR3UBVPROC glad_debug_glColor3ubv = glad_debug_impl_glColor3ubv;
+static void APIENTRY glad_debug_impl_glColor3ui(GLuint arg0, GLuint arg1, GLuint arg2) {
+	glad_glColor3ui(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor3ui", "uuu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glColor3ui");
+}
+PFNGLCOLOR3UIPROC glad_debug_glColor3ui = glad_debug_impl_glColor3ui;
+static void APIENTRY glad_debug_impl_glColor3uiv(const GLuint * arg0) {
+	glad_glColor3uiv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor3uiv", "p", (const void*)arg0);
+	gl_debug_check_error("glColor3uiv");
+}
+PFNGLCOLOR3UIVPROC glad_debug_glColor3uiv = glad_debug_impl_glColor3uiv;
+static void APIENTRY glad_debug_impl_glColor3us(GLushort arg0, GLushort arg1, GLushort arg2) {
+	glad_glColor3us(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor3us", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glColor3us");
+}
+PFNGLCOLOR3USPROC glad_debug_glColor3us = glad_debug_impl_glColor3us;
+static void APIENTRY glad_debug_impl_glColor3usv(const GLushort * arg0) {
+	glad_glColor3usv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor3usv", "p", (const void*)arg0);
+	gl_debug_check_error("glColor3usv");
+}
+PFNGLCOLOR3USVPROC glad_debug_glColor3usv = glad_debug_impl_glColor3usv;
+static void APIENTRY glad_debug_impl_glColor4b(GLbyte arg0, GLbyte arg1, GLbyte arg2, GLbyte arg3) {
+	glad_glColor4b(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor4b", "iiii", (int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glColor4b");
+}
+PFNGLCOLOR4BPROC glad_debug_glColor4b = glad_debug_impl_glColor4b;
+static void APIENTRY glad_debug_impl_glColor4bv(const GLbyte * arg0) {
+	glad_glColor4bv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor4bv", "p", (const void*)arg0);
+	gl_debug_check_error("glColor4bv");
+}
+PFNGLCOLOR4BVPROC glad_debug_glColor4bv = glad_debug_impl_glColor4bv;
+static void APIENTRY glad_debug_impl_glColor4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	glad_glColor4d(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor4d", "ffff", (double)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glColor4d");
+}
+PFNGLCOLOR4DPROC glad_debug_glColor4d = glad_debug_impl_glColor4d;
+static void APIENTRY glad_debug_impl_glColor4dv(const GLdouble * arg0) {
+	glad_glColor4dv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor4dv", "p", (const void*)arg0);
+	gl_debug_check_error("glColor4dv");
+}
+PFNGLCOLOR4DVPROC glad_debug_glColor4dv = glad_debug_impl_glColor4dv;
+static void APIENTRY glad_debug_impl_glColor4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	glad_glColor4f(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor4f", "ffff", (double)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glColor4f");
+}
+PFNGLCOLOR4FPROC glad_debug_glColor4f = glad_debug_impl_glColor4f;
+static void APIENTRY glad_debug_impl_glColor4fv(const GLfloat * arg0) {
+	glad_glColor4fv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor4fv", "p", (const void*)arg0);
+	gl_debug_check_error("glColor4fv");
+}
+PFNGLCOLOR4FVPROC glad_debug_glColor4fv = glad_debug_impl_glColor4fv;
+static void APIENTRY glad_debug_impl_glColor4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	glad_glColor4i(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor4i", "iiii", (int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glColor4i");
+}
+PFNGLCOLOR4IPROC glad_debug_glColor4i = glad_debug_impl_glColor4i;
+static void APIENTRY glad_debug_impl_glColor4iv(const GLint * arg0) {
+	glad_glColor4iv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor4iv", "p", (const void*)arg0);
+	gl_debug_check_error("glColor4iv");
+}
+PFNGLCOLOR4IVPROC glad_debug_glColor4iv = glad_debug_impl_glColor4iv;
+static void APIENTRY glad_debug_impl_glColor4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	glad_glColor4s(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor4s", "iiii", (int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glColor4s");
+}
+PFNGLCOLOR4SPROC glad_debug_glColor4s = glad_debug_impl_glColor4s;
+static void APIENTRY glad_debug_impl_glColor4sv(const GLshort * arg0) {
+	glad_glColor4sv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor4sv", "p", (const void*)arg0);
+	gl_debug_check_error("glColor4sv");
+}
+PFNGLCOLOR4SVPROC glad_debug_glColor4sv = glad_debug_impl_glColor4sv;
+static void APIENTRY glad_debug_impl_glColor4ub(GLubyte arg0, GLubyte arg1, GLubyte arg2, GLubyte arg3) {
+	glad_glColor4ub(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor4ub", "iiii", (int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glColor4ub");
+}
+PFNGLCOLOR4UBPROC glad_debug_glColor4ub = glad_debug_impl_glColor4ub;
+static void APIENTRY glad_debug_impl_glColor4ubv(const GLubyte * arg0) {
+	glad_glColor4ubv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor4ubv", "p", (const void*)arg0);
+	gl_debug_check_error("glColor4ubv");
+}
+PFNGLCOLOR4UBVPROC glad_debug_glColor4ubv = glad_debug_impl_glColor4ubv;
+static void APIENTRY glad_debug_impl_glColor4ui(GLuint arg0, GLuint arg1, GLuint arg2, GLuint arg3) {
+	glad_glColor4ui(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor4ui", "uuuu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glColor4ui");
+}
+PFNGLCOLOR4UIPROC glad_debug_glColor4ui = glad_debug_impl_glColor4ui;
+static void APIENTRY glad_debug_impl_glColor4uiv(const GLuint * arg0) {
+	glad_glColor4uiv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor4uiv", "p", (const void*)arg0);
+	gl_debug_check_error("glColor4uiv");
+}
+PFNGLCOLOR4UIVPROC glad_debug_glColor4uiv = glad_debug_impl_glColor4uiv;
+static void APIENTRY glad_debug_impl_glColor4us(GLushort arg0, GLushort arg1, GLushort arg2, GLushort arg3) {
+	glad_glColor4us(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor4us", "iiii", (int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glColor4us");
+}
+PFNGLCOLOR4USPROC glad_debug_glColor4us = glad_debug_impl_glColor4us;
+static void APIENTRY glad_debug_impl_glColor4usv(const GLushort * arg0) {
+	glad_glColor4usv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glColor4usv", "p", (const void*)arg0);
+	gl_debug_check_error("glColor4usv");
+}
+PFNGLCOLOR4USVPROC glad_debug_glColor4usv = glad_debug_impl_glColor4usv;
+static void APIENTRY glad_debug_impl_glColorMask(GLboolean arg0, GLboolean arg1, GLboolean arg2, GLboolean arg3) {
+	glad_glColorMask(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glColorMask", "bbbb", (int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glColorMask");
+}
+PFNGLCOLORMASKPROC glad_debug_glColorMask = glad_debug_impl_glColorMask;
+static void APIENTRY glad_debug_impl_glColorMaski(GLuint arg0, GLboolean arg1, GLboolean arg2, GLboolean arg3, GLboolean arg4) {
+	glad_glColorMaski(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glColorMaski", "ubbbb", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4);
+	gl_debug_check_error("glColorMaski");
+}
+PFNGLCOLORMASKIPROC glad_debug_glColorMaski = glad_debug_impl_glColorMaski;
+static void APIENTRY glad_debug_impl_glColorMaterial(GLenum arg0, GLenum arg1) {
+	glad_glColorMaterial(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glColorMaterial", "ee", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glColorMaterial");
+}
+PFNGLCOLORMATERIALPROC glad_debug_glColorMaterial = glad_debug_impl_glColorMaterial;
+static void APIENTRY glad_debug_impl_glColorP3ui(GLenum arg0, GLuint arg1) {
+	glad_glColorP3ui(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glColorP3ui", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glColorP3ui");
+}
+PFNGLCOLORP3UIPROC glad_debug_glColorP3ui = glad_debug_impl_glColorP3ui;
+static void APIENTRY glad_debug_impl_glColorP3uiv(GLenum arg0, const GLuint * arg1) {
+	glad_glColorP3uiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glColorP3uiv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glColorP3uiv");
+}
+PFNGLCOLORP3UIVPROC glad_debug_glColorP3uiv = glad_debug_impl_glColorP3uiv;
+static void APIENTRY glad_debug_impl_glColorP4ui(GLenum arg0, GLuint arg1) {
+	glad_glColorP4ui(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glColorP4ui", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glColorP4ui");
+}
+PFNGLCOLORP4UIPROC glad_debug_glColorP4ui = glad_debug_impl_glColorP4ui;
+static void APIENTRY glad_debug_impl_glColorP4uiv(GLenum arg0, const GLuint * arg1) {
+	glad_glColorP4uiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glColorP4uiv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glColorP4uiv");
+}
+PFNGLCOLORP4UIVPROC glad_debug_glColorP4uiv = glad_debug_impl_glColorP4uiv;
+static void APIENTRY glad_debug_impl_glColorPointer(GLint arg0, GLenum arg1, GLsizei arg2, const void * arg3) {
+	glad_glColorPointer(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glColorPointer", "ieip", (int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glColorPointer");
+}
+PFNGLCOLORPOINTERPROC glad_debug_glColorPointer = glad_debug_impl_glColorPointer;
+static void APIENTRY glad_debug_impl_glCompileShader(GLuint arg0) {
+	glad_glCompileShader(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glCompileShader", "u", (unsigned int)arg0);
+	gl_debug_check_error("glCompileShader");
+}
+PFNGLCOMPILESHADERPROC glad_debug_glCompileShader = glad_debug_impl_glCompileShader;
+static void APIENTRY glad_debug_impl_glCompressedTexImage1D(GLenum arg0, GLint arg1, GLenum arg2, GLsizei arg3, GLint arg4, GLsizei arg5, const void * arg6) {
+	glad_glCompressedTexImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glCompressedTexImage1D", "eieiiip", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4, (int)arg5, (const void*)arg6);
+	gl_debug_check_error("glCompressedTexImage1D");
+}
+PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_debug_glCompressedTexImage1D = glad_debug_impl_glCompressedTexImage1D;
+static void APIENTRY glad_debug_impl_glCompressedTexImage2D(GLenum arg0, GLint arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLint arg5, GLsizei arg6, const void * arg7) {
+	glad_glCompressedTexImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+	if (gl_debug_tracing) gl_debug_trace_call("glCompressedTexImage2D", "eieiiiip", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6, (const void*)arg7);
+	gl_debug_check_error("glCompressedTexImage2D");
+}
+PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_debug_glCompressedTexImage2D = glad_debug_impl_glCompressedTexImage2D;
+static void APIENTRY glad_debug_impl_glCompressedTexImage3D(GLenum arg0, GLint arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLint arg6, GLsizei arg7, const void * arg8) {
+	glad_glCompressedTexImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+	if (gl_debug_tracing) gl_debug_trace_call("glCompressedTexImage3D", "eieiiiiip", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6, (int)arg7, (const void*)arg8);
+	gl_debug_check_error("glCompressedTexImage3D");
+}
+PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_debug_glCompressedTexImage3D = glad_debug_impl_glCompressedTexImage3D;
+static void APIENTRY glad_debug_impl_glCompressedTexSubImage1D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLsizei arg5, const void * arg6) {
+	glad_glCompressedTexSubImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glCompressedTexSubImage1D", "eiiieip", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (unsigned int)arg4, (int)arg5, (const void*)arg6);
+	gl_debug_check_error("glCompressedTexSubImage1D");
+}
+PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_debug_glCompressedTexSubImage1D = glad_debug_impl_glCompressedTexSubImage1D;
+static void APIENTRY glad_debug_impl_glCompressedTexSubImage2D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLsizei arg7, const void * arg8) {
+	glad_glCompressedTexSubImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+	if (gl_debug_tracing) gl_debug_trace_call("glCompressedTexSubImage2D", "eiiiiieip", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (unsigned int)arg6, (int)arg7, (const void*)arg8);
+	gl_debug_check_error("glCompressedTexSubImage2D");
+}
+PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_debug_glCompressedTexSubImage2D = glad_debug_impl_glCompressedTexSubImage2D;
+static void APIENTRY glad_debug_impl_glCompressedTexSubImage3D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLsizei arg9, const void * arg10) {
+	glad_glCompressedTexSubImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+	if (gl_debug_tracing) gl_debug_trace_call("glCompressedTexSubImage3D", "eiiiiiiieip", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6, (int)arg7, (unsigned int)arg8, (int)arg9, (const void*)arg10);
+	gl_debug_check_error("glCompressedTexSubImage3D");
+}
+PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_debug_glCompressedTexSubImage3D = glad_debug_impl_glCompressedTexSubImage3D;
+static void APIENTRY glad_debug_impl_glCompressedTextureSubImage1D(GLuint arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLsizei arg5, const void * arg6) {
+	glad_glCompressedTextureSubImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glCompressedTextureSubImage1D", "uiiieip", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (unsigned int)arg4, (int)arg5, (const void*)arg6);
+	gl_debug_check_error("glCompressedTextureSubImage1D");
+}
+PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_debug_glCompressedTextureSubImage1D = glad_debug_impl_glCompressedTextureSubImage1D;
+static void APIENTRY glad_debug_impl_glCompressedTextureSubImage2D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLsizei arg7, const void * arg8) {
+	glad_glCompressedTextureSubImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+	if (gl_debug_tracing) gl_debug_trace_call("glCompressedTextureSubImage2D", "uiiiiieip", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (unsigned int)arg6, (int)arg7, (const void*)arg8);
+	gl_debug_check_error("glCompressedTextureSubImage2D");
+}
+PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_debug_glCompressedTextureSubImage2D = glad_debug_impl_glCompressedTextureSubImage2D;
+static void APIENTRY glad_debug_impl_glCompressedTextureSubImage3D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLsizei arg9, const void * arg10) {
+	glad_glCompressedTextureSubImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+	if (gl_debug_tracing) gl_debug_trace_call("glCompressedTextureSubImage3D", "uiiiiiiieip", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6, (int)arg7, (unsigned int)arg8, (int)arg9, (const void*)arg10);
+	gl_debug_check_error("glCompressedTextureSubImage3D");
+}
+PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_debug_glCompressedTextureSubImage3D = glad_debug_impl_glCompressedTextureSubImage3D;
+static void APIENTRY glad_debug_impl_glCopyBufferSubData(GLenum arg0, GLenum arg1, GLintptr arg2, GLintptr arg3, GLsizeiptr arg4) {
+	glad_glCopyBufferSubData(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glCopyBufferSubData", "eelll", (unsigned int)arg0, (unsigned int)arg1, (long long)arg2, (long long)arg3, (long long)arg4);
+	gl_debug_check_error("glCopyBufferSubData");
+}
+PFNGLCOPYBUFFERSUBDATAPROC glad_debug_glCopyBufferSubData = glad_debug_impl_glCopyBufferSubData;
+static void APIENTRY glad_debug_impl_glCopyImageSubData(GLuint arg0, GLenum arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLuint arg6, GLenum arg7, GLint arg8, GLint arg9, GLint arg10, GLint arg11, GLsizei arg12, GLsizei arg13, GLsizei arg14) {
+	glad_glCopyImageSubData(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14);
+	if (gl_debug_tracing) gl_debug_trace_call("glCopyImageSubData", "ueiiiiueiiiiiii", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (unsigned int)arg6, (unsigned int)arg7, (int)arg8, (int)arg9, (int)arg10, (int)arg11, (int)arg12, (int)arg13, (int)arg14);
+	gl_debug_check_error("glCopyImageSubData");
+}
+PFNGLCOPYIMAGESUBDATAPROC glad_debug_glCopyImageSubData = glad_debug_impl_glCopyImageSubData;
+static void APIENTRY glad_debug_impl_glCopyNamedBufferSubData(GLuint arg0, GLuint arg1, GLintptr arg2, GLintptr arg3, GLsizeiptr arg4) {
+	glad_glCopyNamedBufferSubData(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glCopyNamedBufferSubData", "uulll", (unsigned int)arg0, (unsigned int)arg1, (long long)arg2, (long long)arg3, (long long)arg4);
+	gl_debug_check_error("glCopyNamedBufferSubData");
+}
+PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_debug_glCopyNamedBufferSubData = glad_debug_impl_glCopyNamedBufferSubData;
+static void APIENTRY glad_debug_impl_glCopyPixels(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLenum arg4) {
+	glad_glCopyPixels(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glCopyPixels", "iiiie", (int)arg0, (int)arg1, (int)arg2, (int)arg3, (unsigned int)arg4);
+	gl_debug_check_error("glCopyPixels");
+}
+PFNGLCOPYPIXELSPROC glad_debug_glCopyPixels = glad_debug_impl_glCopyPixels;
+static void APIENTRY glad_debug_impl_glCopyTexImage1D(GLenum arg0, GLint arg1, GLenum arg2, GLint arg3, GLint arg4, GLsizei arg5, GLint arg6) {
+	glad_glCopyTexImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glCopyTexImage1D", "eieiiii", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6);
+	gl_debug_check_error("glCopyTexImage1D");
+}
+PFNGLCOPYTEXIMAGE1DPROC glad_debug_glCopyTexImage1D = glad_debug_impl_glCopyTexImage1D;
+static void APIENTRY glad_debug_impl_glCopyTexImage2D(GLenum arg0, GLint arg1, GLenum arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLint arg7) {
+	glad_glCopyTexImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+	if (gl_debug_tracing) gl_debug_trace_call("glCopyTexImage2D", "eieiiiii", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6, (int)arg7);
+	gl_debug_check_error("glCopyTexImage2D");
+}
+PFNGLCOPYTEXIMAGE2DPROC glad_debug_glCopyTexImage2D = glad_debug_impl_glCopyTexImage2D;
+static void APIENTRY glad_debug_impl_glCopyTexSubImage1D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5) {
+	glad_glCopyTexSubImage1D(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glCopyTexSubImage1D", "eiiiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5);
+	gl_debug_check_error("glCopyTexSubImage1D");
+}
+PFNGLCOPYTEXSUBIMAGE1DPROC glad_debug_glCopyTexSubImage1D = glad_debug_impl_glCopyTexSubImage1D;
+static void APIENTRY glad_debug_impl_glCopyTexSubImage2D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLsizei arg6, GLsizei arg7) {
+	glad_glCopyTexSubImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+	if (gl_debug_tracing) gl_debug_trace_call("glCopyTexSubImage2D", "eiiiiiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6, (int)arg7);
+	gl_debug_check_error("glCopyTexSubImage2D");
+}
+PFNGLCOPYTEXSUBIMAGE2DPROC glad_debug_glCopyTexSubImage2D = glad_debug_impl_glCopyTexSubImage2D;
+static void APIENTRY glad_debug_impl_glCopyTexSubImage3D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLsizei arg7, GLsizei arg8) {
+	glad_glCopyTexSubImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+	if (gl_debug_tracing) gl_debug_trace_call("glCopyTexSubImage3D", "eiiiiiiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6, (int)arg7, (int)arg8);
+	gl_debug_check_error("glCopyTexSubImage3D");
+}
+PFNGLCOPYTEXSUBIMAGE3DPROC glad_debug_glCopyTexSubImage3D = glad_debug_impl_glCopyTexSubImage3D;
+static void APIENTRY glad_debug_impl_glCopyTextureSubImage1D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5) {
+	glad_glCopyTextureSubImage1D(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glCopyTextureSubImage1D", "uiiiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5);
+	gl_debug_check_error("glCopyTextureSubImage1D");
+}
+PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_debug_glCopyTextureSubImage1D = glad_debug_impl_glCopyTextureSubImage1D;
+static void APIENTRY glad_debug_impl_glCopyTextureSubImage2D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLsizei arg6, GLsizei arg7) {
+	glad_glCopyTextureSubImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+	if (gl_debug_tracing) gl_debug_trace_call("glCopyTextureSubImage2D", "uiiiiiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6, (int)arg7);
+	gl_debug_check_error("glCopyTextureSubImage2D");
+}
+PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_debug_glCopyTextureSubImage2D = glad_debug_impl_glCopyTextureSubImage2D;
+static void APIENTRY glad_debug_impl_glCopyTextureSubImage3D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLsizei arg7, GLsizei arg8) {
+	glad_glCopyTextureSubImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+	if (gl_debug_tracing) gl_debug_trace_call("glCopyTextureSubImage3D", "uiiiiiiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6, (int)arg7, (int)arg8);
+	gl_debug_check_error("glCopyTextureSubImage3D");
+}
+PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_debug_glCopyTextureSubImage3D = glad_debug_impl_glCopyTextureSubImage3D;
+static void APIENTRY glad_debug_impl_glCreateBuffers(GLsizei arg0, GLuint * arg1) {
+	glad_glCreateBuffers(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glCreateBuffers", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glCreateBuffers");
+}
+PFNGLCREATEBUFFERSPROC glad_debug_glCreateBuffers = glad_debug_impl_glCreateBuffers;
+static void APIENTRY glad_debug_impl_glCreateFramebuffers(GLsizei arg0, GLuint * arg1) {
+	glad_glCreateFramebuffers(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glCreateFramebuffers", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glCreateFramebuffers");
+}
+PFNGLCREATEFRAMEBUFFERSPROC glad_debug_glCreateFramebuffers = glad_debug_impl_glCreateFramebuffers;
+static GLuint APIENTRY glad_debug_impl_glCreateProgram(void) {
+	GLuint ret;
+	ret = glad_glCreateProgram();
+	if (gl_debug_tracing) gl_debug_trace_call("glCreateProgram", "");
+	gl_debug_check_error("glCreateProgram");
+	return ret;
+}
+PFNGLCREATEPROGRAMPROC glad_debug_glCreateProgram = glad_debug_impl_glCreateProgram;
+static void APIENTRY glad_debug_impl_glCreateProgramPipelines(GLsizei arg0, GLuint * arg1) {
+	glad_glCreateProgramPipelines(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glCreateProgramPipelines", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glCreateProgramPipelines");
+}
+PFNGLCREATEPROGRAMPIPELINESPROC glad_debug_glCreateProgramPipelines = glad_debug_impl_glCreateProgramPipelines;
+static void APIENTRY glad_debug_impl_glCreateQueries(GLenum arg0, GLsizei arg1, GLuint * arg2) {
+	glad_glCreateQueries(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glCreateQueries", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glCreateQueries");
+}
+PFNGLCREATEQUERIESPROC glad_debug_glCreateQueries = glad_debug_impl_glCreateQueries;
+static void APIENTRY glad_debug_impl_glCreateRenderbuffers(GLsizei arg0, GLuint * arg1) {
+	glad_glCreateRenderbuffers(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glCreateRenderbuffers", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glCreateRenderbuffers");
+}
+PFNGLCREATERENDERBUFFERSPROC glad_debug_glCreateRenderbuffers = glad_debug_impl_glCreateRenderbuffers;
+static void APIENTRY glad_debug_impl_glCreateSamplers(GLsizei arg0, GLuint * arg1) {
+	glad_glCreateSamplers(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glCreateSamplers", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glCreateSamplers");
+}
+PFNGLCREATESAMPLERSPROC glad_debug_glCreateSamplers = glad_debug_impl_glCreateSamplers;
+static GLuint APIENTRY glad_debug_impl_glCreateShader(GLenum arg0) {
+	GLuint ret;
+	ret = glad_glCreateShader(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glCreateShader", "e", (unsigned int)arg0);
+	gl_debug_check_error("glCreateShader");
+	return ret;
+}
+PFNGLCREATESHADERPROC glad_debug_glCreateShader = glad_debug_impl_glCreateShader;
+static GLuint APIENTRY glad_debug_impl_glCreateShaderProgramv(GLenum arg0, GLsizei arg1, const GLchar *const * arg2) {
+	GLuint ret;
+	ret = glad_glCreateShaderProgramv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glCreateShaderProgramv", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glCreateShaderProgramv");
+	return ret;
+}
+PFNGLCREATESHADERPROGRAMVPROC glad_debug_glCreateShaderProgramv = glad_debug_impl_glCreateShaderProgramv;
+static void APIENTRY glad_debug_impl_glCreateTextures(GLenum arg0, GLsizei arg1, GLuint * arg2) {
+	glad_glCreateTextures(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glCreateTextures", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glCreateTextures");
+}
+PFNGLCREATETEXTURESPROC glad_debug_glCreateTextures = glad_debug_impl_glCreateTextures;
+static void APIENTRY glad_debug_impl_glCreateTransformFeedbacks(GLsizei arg0, GLuint * arg1) {
+	glad_glCreateTransformFeedbacks(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glCreateTransformFeedbacks", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glCreateTransformFeedbacks");
+}
+PFNGLCREATETRANSFORMFEEDBACKSPROC glad_debug_glCreateTransformFeedbacks = glad_debug_impl_glCreateTransformFeedbacks;
+static void APIENTRY glad_debug_impl_glCreateVertexArrays(GLsizei arg0, GLuint * arg1) {
+	glad_glCreateVertexArrays(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glCreateVertexArrays", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glCreateVertexArrays");
+}
+PFNGLCREATEVERTEXARRAYSPROC glad_debug_glCreateVertexArrays = glad_debug_impl_glCreateVertexArrays;
+static void APIENTRY glad_debug_impl_glCullFace(GLenum arg0) {
+	glad_glCullFace(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glCullFace", "e", (unsigned int)arg0);
+	gl_debug_check_error("glCullFace");
+}
+PFNGLCULLFACEPROC glad_debug_glCullFace = glad_debug_impl_glCullFace;
+static void APIENTRY glad_debug_impl_glDebugMessageCallback(GLDEBUGPROC arg0, const void * arg1) {
+	glad_glDebugMessageCallback(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDebugMessageCallback", "pp", (const void*)arg0, (const void*)arg1);
+	gl_debug_check_error("glDebugMessageCallback");
+}
+PFNGLDEBUGMESSAGECALLBACKPROC glad_debug_glDebugMessageCallback = glad_debug_impl_glDebugMessageCallback;
+static void APIENTRY glad_debug_impl_glDebugMessageControl(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, const GLuint * arg4, GLboolean arg5) {
+	glad_glDebugMessageControl(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glDebugMessageControl", "eeeipb", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (int)arg3, (const void*)arg4, (int)arg5);
+	gl_debug_check_error("glDebugMessageControl");
+}
+PFNGLDEBUGMESSAGECONTROLPROC glad_debug_glDebugMessageControl = glad_debug_impl_glDebugMessageControl;
+static void APIENTRY glad_debug_impl_glDebugMessageInsert(GLenum arg0, GLenum arg1, GLuint arg2, GLenum arg3, GLsizei arg4, const GLchar * arg5) {
+	glad_glDebugMessageInsert(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glDebugMessageInsert", "eeueip", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (unsigned int)arg3, (int)arg4, (const void*)arg5);
+	gl_debug_check_error("glDebugMessageInsert");
+}
+PFNGLDEBUGMESSAGEINSERTPROC glad_debug_glDebugMessageInsert = glad_debug_impl_glDebugMessageInsert;
+static void APIENTRY glad_debug_impl_glDeleteBuffers(GLsizei arg0, const GLuint * arg1) {
+	glad_glDeleteBuffers(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDeleteBuffers", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glDeleteBuffers");
+}
+PFNGLDELETEBUFFERSPROC glad_debug_glDeleteBuffers = glad_debug_impl_glDeleteBuffers;
+static void APIENTRY glad_debug_impl_glDeleteFramebuffers(GLsizei arg0, const GLuint * arg1) {
+	glad_glDeleteFramebuffers(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDeleteFramebuffers", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glDeleteFramebuffers");
+}
+PFNGLDELETEFRAMEBUFFERSPROC glad_debug_glDeleteFramebuffers = glad_debug_impl_glDeleteFramebuffers;
+static void APIENTRY glad_debug_impl_glDeleteLists(GLuint arg0, GLsizei arg1) {
+	glad_glDeleteLists(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDeleteLists", "ui", (unsigned int)arg0, (int)arg1);
+	gl_debug_check_error("glDeleteLists");
+}
+PFNGLDELETELISTSPROC glad_debug_glDeleteLists = glad_debug_impl_glDeleteLists;
+static void APIENTRY glad_debug_impl_glDeleteProgram(GLuint arg0) {
+	glad_glDeleteProgram(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glDeleteProgram", "u", (unsigned int)arg0);
+	gl_debug_check_error("glDeleteProgram");
+}
+PFNGLDELETEPROGRAMPROC glad_debug_glDeleteProgram = glad_debug_impl_glDeleteProgram;
+static void APIENTRY glad_debug_impl_glDeleteProgramPipelines(GLsizei arg0, const GLuint * arg1) {
+	glad_glDeleteProgramPipelines(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDeleteProgramPipelines", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glDeleteProgramPipelines");
+}
+PFNGLDELETEPROGRAMPIPELINESPROC glad_debug_glDeleteProgramPipelines = glad_debug_impl_glDeleteProgramPipelines;
+static void APIENTRY glad_debug_impl_glDeleteQueries(GLsizei arg0, const GLuint * arg1) {
+	glad_glDeleteQueries(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDeleteQueries", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glDeleteQueries");
+}
+PFNGLDELETEQUERIESPROC glad_debug_glDeleteQueries = glad_debug_impl_glDeleteQueries;
+static void APIENTRY glad_debug_impl_glDeleteRenderbuffers(GLsizei arg0, const GLuint * arg1) {
+	glad_glDeleteRenderbuffers(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDeleteRenderbuffers", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glDeleteRenderbuffers");
+}
+PFNGLDELETERENDERBUFFERSPROC glad_debug_glDeleteRenderbuffers = glad_debug_impl_glDeleteRenderbuffers;
+static void APIENTRY glad_debug_impl_glDeleteSamplers(GLsizei arg0, const GLuint * arg1) {
+	glad_glDeleteSamplers(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDeleteSamplers", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glDeleteSamplers");
+}
+PFNGLDELETESAMPLERSPROC glad_debug_glDeleteSamplers = glad_debug_impl_glDeleteSamplers;
+static void APIENTRY glad_debug_impl_glDeleteShader(GLuint arg0) {
+	glad_glDeleteShader(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glDeleteShader", "u", (unsigned int)arg0);
+	gl_debug_check_error("glDeleteShader");
+}
+PFNGLDELETESHADERPROC glad_debug_glDeleteShader = glad_debug_impl_glDeleteShader;
+static void APIENTRY glad_debug_impl_glDeleteSync(GLsync arg0) {
+	glad_glDeleteSync(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glDeleteSync", "p", (const void*)arg0);
+	gl_debug_check_error("glDeleteSync");
+}
+PFNGLDELETESYNCPROC glad_debug_glDeleteSync = glad_debug_impl_glDeleteSync;
+static void APIENTRY glad_debug_impl_glDeleteTextures(GLsizei arg0, const GLuint * arg1) {
+	glad_glDeleteTextures(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDeleteTextures", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glDeleteTextures");
+}
+PFNGLDELETETEXTURESPROC glad_debug_glDeleteTextures = glad_debug_impl_glDeleteTextures;
+static void APIENTRY glad_debug_impl_glDeleteTransformFeedbacks(GLsizei arg0, const GLuint * arg1) {
+	glad_glDeleteTransformFeedbacks(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDeleteTransformFeedbacks", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glDeleteTransformFeedbacks");
+}
+PFNGLDELETETRANSFORMFEEDBACKSPROC glad_debug_glDeleteTransformFeedbacks = glad_debug_impl_glDeleteTransformFeedbacks;
+static void APIENTRY glad_debug_impl_glDeleteVertexArrays(GLsizei arg0, const GLuint * arg1) {
+	glad_glDeleteVertexArrays(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDeleteVertexArrays", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glDeleteVertexArrays");
+}
+PFNGLDELETEVERTEXARRAYSPROC glad_debug_glDeleteVertexArrays = glad_debug_impl_glDeleteVertexArrays;
+static void APIENTRY glad_debug_impl_glDepthFunc(GLenum arg0) {
+	glad_glDepthFunc(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glDepthFunc", "e", (unsigned int)arg0);
+	gl_debug_check_error("glDepthFunc");
+}
+PFNGLDEPTHFUNCPROC glad_debug_glDepthFunc = glad_debug_impl_glDepthFunc;
+static void APIENTRY glad_debug_impl_glDepthMask(GLboolean arg0) {
+	glad_glDepthMask(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glDepthMask", "b", (int)arg0);
+	gl_debug_check_error("glDepthMask");
+}
+PFNGLDEPTHMASKPROC glad_debug_glDepthMask = glad_debug_impl_glDepthMask;
+static void APIENTRY glad_debug_impl_glDepthRange(GLclampd arg0, GLclampd arg1) {
+	glad_glDepthRange(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDepthRange", "ff", (double)arg0, (double)arg1);
+	gl_debug_check_error("glDepthRange");
+}
+PFNGLDEPTHRANGEPROC glad_debug_glDepthRange = glad_debug_impl_glDepthRange;
+static void APIENTRY glad_debug_impl_glDepthRangeArrayv(GLuint arg0, GLsizei arg1, const GLdouble * arg2) {
+	glad_glDepthRangeArrayv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glDepthRangeArrayv", "uip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glDepthRangeArrayv");
+}
+PFNGLDEPTHRANGEARRAYVPROC glad_debug_glDepthRangeArrayv = glad_debug_impl_glDepthRangeArrayv;
+static void APIENTRY glad_debug_impl_glDepthRangeIndexed(GLuint arg0, GLdouble arg1, GLdouble arg2) {
+	glad_glDepthRangeIndexed(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glDepthRangeIndexed", "uff", (unsigned int)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glDepthRangeIndexed");
+}
+PFNGLDEPTHRANGEINDEXEDPROC glad_debug_glDepthRangeIndexed = glad_debug_impl_glDepthRangeIndexed;
+static void APIENTRY glad_debug_impl_glDepthRangef(GLfloat arg0, GLfloat arg1) {
+	glad_glDepthRangef(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDepthRangef", "ff", (double)arg0, (double)arg1);
+	gl_debug_check_error("glDepthRangef");
+}
+PFNGLDEPTHRANGEFPROC glad_debug_glDepthRangef = glad_debug_impl_glDepthRangef;
+static void APIENTRY glad_debug_impl_glDetachShader(GLuint arg0, GLuint arg1) {
+	glad_glDetachShader(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDetachShader", "uu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glDetachShader");
+}
+PFNGLDETACHSHADERPROC glad_debug_glDetachShader = glad_debug_impl_glDetachShader;
+static void APIENTRY glad_debug_impl_glDisable(GLenum arg0) {
+	glad_glDisable(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glDisable", "e", (unsigned int)arg0);
+	gl_debug_check_error("glDisable");
+}
+PFNGLDISABLEPROC glad_debug_glDisable = glad_debug_impl_glDisable;
+static void APIENTRY glad_debug_impl_glDisableClientState(GLenum arg0) {
+	glad_glDisableClientState(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glDisableClientState", "e", (unsigned int)arg0);
+	gl_debug_check_error("glDisableClientState");
+}
+PFNGLDISABLECLIENTSTATEPROC glad_debug_glDisableClientState = glad_debug_impl_glDisableClientState;
+static void APIENTRY glad_debug_impl_glDisableVertexArrayAttrib(GLuint arg0, GLuint arg1) {
+	glad_glDisableVertexArrayAttrib(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDisableVertexArrayAttrib", "uu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glDisableVertexArrayAttrib");
+}
+PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_debug_glDisableVertexArrayAttrib = glad_debug_impl_glDisableVertexArrayAttrib;
+static void APIENTRY glad_debug_impl_glDisableVertexAttribArray(GLuint arg0) {
+	glad_glDisableVertexAttribArray(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glDisableVertexAttribArray", "u", (unsigned int)arg0);
+	gl_debug_check_error("glDisableVertexAttribArray");
+}
+PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_debug_glDisableVertexAttribArray = glad_debug_impl_glDisableVertexAttribArray;
+static void APIENTRY glad_debug_impl_glDisablei(GLenum arg0, GLuint arg1) {
+	glad_glDisablei(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDisablei", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glDisablei");
+}
+PFNGLDISABLEIPROC glad_debug_glDisablei = glad_debug_impl_glDisablei;
+static void APIENTRY glad_debug_impl_glDispatchCompute(GLuint arg0, GLuint arg1, GLuint arg2) {
+	glad_glDispatchCompute(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glDispatchCompute", "uuu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glDispatchCompute");
+}
+PFNGLDISPATCHCOMPUTEPROC glad_debug_glDispatchCompute = glad_debug_impl_glDispatchCompute;
+static void APIENTRY glad_debug_impl_glDispatchComputeIndirect(GLintptr arg0) {
+	glad_glDispatchComputeIndirect(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glDispatchComputeIndirect", "l", (long long)arg0);
+	gl_debug_check_error("glDispatchComputeIndirect");
+}
+PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_debug_glDispatchComputeIndirect = glad_debug_impl_glDispatchComputeIndirect;
+static void APIENTRY glad_debug_impl_glDrawArrays(GLenum arg0, GLint arg1, GLsizei arg2) {
+	glad_glDrawArrays(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawArrays", "eii", (unsigned int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glDrawArrays");
+}
+PFNGLDRAWARRAYSPROC glad_debug_glDrawArrays = glad_debug_impl_glDrawArrays;
+static void APIENTRY glad_debug_impl_glDrawArraysIndirect(GLenum arg0, const void * arg1) {
+	glad_glDrawArraysIndirect(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawArraysIndirect", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glDrawArraysIndirect");
+}
+PFNGLDRAWARRAYSINDIRECTPROC glad_debug_glDrawArraysIndirect = glad_debug_impl_glDrawArraysIndirect;
+static void APIENTRY glad_debug_impl_glDrawArraysInstanced(GLenum arg0, GLint arg1, GLsizei arg2, GLsizei arg3) {
+	glad_glDrawArraysInstanced(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawArraysInstanced", "eiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glDrawArraysInstanced");
+}
+PFNGLDRAWARRAYSINSTANCEDPROC glad_debug_glDrawArraysInstanced = glad_debug_impl_glDrawArraysInstanced;
+static void APIENTRY glad_debug_impl_glDrawArraysInstancedBaseInstance(GLenum arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLuint arg4) {
+	glad_glDrawArraysInstancedBaseInstance(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawArraysInstancedBaseInstance", "eiiiu", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (unsigned int)arg4);
+	gl_debug_check_error("glDrawArraysInstancedBaseInstance");
+}
+PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_debug_glDrawArraysInstancedBaseInstance = glad_debug_impl_glDrawArraysInstancedBaseInstance;
+static void APIENTRY glad_debug_impl_glDrawBuffer(GLenum arg0) {
+	glad_glDrawBuffer(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawBuffer", "e", (unsigned int)arg0);
+	gl_debug_check_error("glDrawBuffer");
+}
+PFNGLDRAWBUFFERPROC glad_debug_glDrawBuffer = glad_debug_impl_glDrawBuffer;
+static void APIENTRY glad_debug_impl_glDrawBuffers(GLsizei arg0, const GLenum * arg1) {
+	glad_glDrawBuffers(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawBuffers", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glDrawBuffers");
+}
+PFNGLDRAWBUFFERSPROC glad_debug_glDrawBuffers = glad_debug_impl_glDrawBuffers;
+static void APIENTRY glad_debug_impl_glDrawElements(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3) {
+	glad_glDrawElements(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawElements", "eiep", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (const void*)arg3);
+	gl_debug_check_error("glDrawElements");
+}
+PFNGLDRAWELEMENTSPROC glad_debug_glDrawElements = glad_debug_impl_glDrawElements;
+static void APIENTRY glad_debug_impl_glDrawElementsBaseVertex(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLint arg4) {
+	glad_glDrawElementsBaseVertex(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawElementsBaseVertex", "eiepi", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (const void*)arg3, (int)arg4);
+	gl_debug_check_error("glDrawElementsBaseVertex");
+}
+PFNGLDRAWELEMENTSBASEVERTEXPROC glad_debug_glDrawElementsBaseVertex = glad_debug_impl_glDrawElementsBaseVertex;
+static void APIENTRY glad_debug_impl_glDrawElementsIndirect(GLenum arg0, GLenum arg1, const void * arg2) {
+	glad_glDrawElementsIndirect(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawElementsIndirect", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glDrawElementsIndirect");
+}
+PFNGLDRAWELEMENTSINDIRECTPROC glad_debug_glDrawElementsIndirect = glad_debug_impl_glDrawElementsIndirect;
+static void APIENTRY glad_debug_impl_glDrawElementsInstanced(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4) {
+	glad_glDrawElementsInstanced(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawElementsInstanced", "eiepi", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (const void*)arg3, (int)arg4);
+	gl_debug_check_error("glDrawElementsInstanced");
+}
+PFNGLDRAWELEMENTSINSTANCEDPROC glad_debug_glDrawElementsInstanced = glad_debug_impl_glDrawElementsInstanced;
+static void APIENTRY glad_debug_impl_glDrawElementsInstancedBaseInstance(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4, GLuint arg5) {
+	glad_glDrawElementsInstancedBaseInstance(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawElementsInstancedBaseInstance", "eiepiu", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (const void*)arg3, (int)arg4, (unsigned int)arg5);
+	gl_debug_check_error("glDrawElementsInstancedBaseInstance");
+}
+PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_debug_glDrawElementsInstancedBaseInstance = glad_debug_impl_glDrawElementsInstancedBaseInstance;
+static void APIENTRY glad_debug_impl_glDrawElementsInstancedBaseVertex(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4, GLint arg5) {
+	glad_glDrawElementsInstancedBaseVertex(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawElementsInstancedBaseVertex", "eiepii", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (const void*)arg3, (int)arg4, (int)arg5);
+	gl_debug_check_error("glDrawElementsInstancedBaseVertex");
+}
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_debug_glDrawElementsInstancedBaseVertex = glad_debug_impl_glDrawElementsInstancedBaseVertex;
+static void APIENTRY glad_debug_impl_glDrawElementsInstancedBaseVertexBaseInstance(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4, GLint arg5, GLuint arg6) {
+	glad_glDrawElementsInstancedBaseVertexBaseInstance(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawElementsInstancedBaseVertexBaseInstance", "eiepiiu", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (const void*)arg3, (int)arg4, (int)arg5, (unsigned int)arg6);
+	gl_debug_check_error("glDrawElementsInstancedBaseVertexBaseInstance");
+}
+PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_debug_glDrawElementsInstancedBaseVertexBaseInstance = glad_debug_impl_glDrawElementsInstancedBaseVertexBaseInstance;
+static void APIENTRY glad_debug_impl_glDrawPixels(GLsizei arg0, GLsizei arg1, GLenum arg2, GLenum arg3, const void * arg4) {
+	glad_glDrawPixels(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawPixels", "iieep", (int)arg0, (int)arg1, (unsigned int)arg2, (unsigned int)arg3, (const void*)arg4);
+	gl_debug_check_error("glDrawPixels");
+}
+PFNGLDRAWPIXELSPROC glad_debug_glDrawPixels = glad_debug_impl_glDrawPixels;
+static void APIENTRY glad_debug_impl_glDrawRangeElements(GLenum arg0, GLuint arg1, GLuint arg2, GLsizei arg3, GLenum arg4, const void * arg5) {
+	glad_glDrawRangeElements(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawRangeElements", "euuiep", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (int)arg3, (unsigned int)arg4, (const void*)arg5);
+	gl_debug_check_error("glDrawRangeElements");
+}
+PFNGLDRAWRANGEELEMENTSPROC glad_debug_glDrawRangeElements = glad_debug_impl_glDrawRangeElements;
+static void APIENTRY glad_debug_impl_glDrawRangeElementsBaseVertex(GLenum arg0, GLuint arg1, GLuint arg2, GLsizei arg3, GLenum arg4, const void * arg5, GLint arg6) {
+	glad_glDrawRangeElementsBaseVertex(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawRangeElementsBaseVertex", "euuiepi", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (int)arg3, (unsigned int)arg4, (const void*)arg5, (int)arg6);
+	gl_debug_check_error("glDrawRangeElementsBaseVertex");
+}
+PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_debug_glDrawRangeElementsBaseVertex = glad_debug_impl_glDrawRangeElementsBaseVertex;
+static void APIENTRY glad_debug_impl_glDrawTransformFeedback(GLenum arg0, GLuint arg1) {
+	glad_glDrawTransformFeedback(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawTransformFeedback", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glDrawTransformFeedback");
+}
+PFNGLDRAWTRANSFORMFEEDBACKPROC glad_debug_glDrawTransformFeedback = glad_debug_impl_glDrawTransformFeedback;
+static void APIENTRY glad_debug_impl_glDrawTransformFeedbackInstanced(GLenum arg0, GLuint arg1, GLsizei arg2) {
+	glad_glDrawTransformFeedbackInstanced(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawTransformFeedbackInstanced", "eui", (unsigned int)arg0, (unsigned int)arg1, (int)arg2);
+	gl_debug_check_error("glDrawTransformFeedbackInstanced");
+}
+PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_debug_glDrawTransformFeedbackInstanced = glad_debug_impl_glDrawTransformFeedbackInstanced;
+static void APIENTRY glad_debug_impl_glDrawTransformFeedbackStream(GLenum arg0, GLuint arg1, GLuint arg2) {
+	glad_glDrawTransformFeedbackStream(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawTransformFeedbackStream", "euu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glDrawTransformFeedbackStream");
+}
+PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_debug_glDrawTransformFeedbackStream = glad_debug_impl_glDrawTransformFeedbackStream;
+static void APIENTRY glad_debug_impl_glDrawTransformFeedbackStreamInstanced(GLenum arg0, GLuint arg1, GLuint arg2, GLsizei arg3) {
+	glad_glDrawTransformFeedbackStreamInstanced(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glDrawTransformFeedbackStreamInstanced", "euui", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (int)arg3);
+	gl_debug_check_error("glDrawTransformFeedbackStreamInstanced");
+}
+PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_debug_glDrawTransformFeedbackStreamInstanced = glad_debug_impl_glDrawTransformFeedbackStreamInstanced;
+static void APIENTRY glad_debug_impl_glEdgeFlag(GLboolean arg0) {
+	glad_glEdgeFlag(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glEdgeFlag", "b", (int)arg0);
+	gl_debug_check_error("glEdgeFlag");
+}
+PFNGLEDGEFLAGPROC glad_debug_glEdgeFlag = glad_debug_impl_glEdgeFlag;
+static void APIENTRY glad_debug_impl_glEdgeFlagPointer(GLsizei arg0, const void * arg1) {
+	glad_glEdgeFlagPointer(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glEdgeFlagPointer", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glEdgeFlagPointer");
+}
+PFNGLEDGEFLAGPOINTERPROC glad_debug_glEdgeFlagPointer = glad_debug_impl_glEdgeFlagPointer;
+static void APIENTRY glad_debug_impl_glEdgeFlagv(const GLboolean * arg0) {
+	glad_glEdgeFlagv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glEdgeFlagv", "p", (const void*)arg0);
+	gl_debug_check_error("glEdgeFlagv");
+}
+PFNGLEDGEFLAGVPROC glad_debug_glEdgeFlagv = glad_debug_impl_glEdgeFlagv;
+static void APIENTRY glad_debug_impl_glEnable(GLenum arg0) {
+	glad_glEnable(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glEnable", "e", (unsigned int)arg0);
+	gl_debug_check_error("glEnable");
+}
+PFNGLENABLEPROC glad_debug_glEnable = glad_debug_impl_glEnable;
+static void APIENTRY glad_debug_impl_glEnableClientState(GLenum arg0) {
+	glad_glEnableClientState(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glEnableClientState", "e", (unsigned int)arg0);
+	gl_debug_check_error("glEnableClientState");
+}
+PFNGLENABLECLIENTSTATEPROC glad_debug_glEnableClientState = glad_debug_impl_glEnableClientState;
+static void APIENTRY glad_debug_impl_glEnableVertexArrayAttrib(GLuint arg0, GLuint arg1) {
+	glad_glEnableVertexArrayAttrib(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glEnableVertexArrayAttrib", "uu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glEnableVertexArrayAttrib");
+}
+PFNGLENABLEVERTEXARRAYATTRIBPROC glad_debug_glEnableVertexArrayAttrib = glad_debug_impl_glEnableVertexArrayAttrib;
+static void APIENTRY glad_debug_impl_glEnableVertexAttribArray(GLuint arg0) {
+	glad_glEnableVertexAttribArray(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glEnableVertexAttribArray", "u", (unsigned int)arg0);
+	gl_debug_check_error("glEnableVertexAttribArray");
+}
+PFNGLENABLEVERTEXATTRIBARRAYPROC glad_debug_glEnableVertexAttribArray = glad_debug_impl_glEnableVertexAttribArray;
+static void APIENTRY glad_debug_impl_glEnablei(GLenum arg0, GLuint arg1) {
+	glad_glEnablei(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glEnablei", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glEnablei");
+}
+PFNGLENABLEIPROC glad_debug_glEnablei = glad_debug_impl_glEnablei;
+static void APIENTRY glad_debug_impl_glEnd(void) {
+	glad_glEnd();
+	if (gl_debug_tracing) gl_debug_trace_call("glEnd", "");
+	gl_debug_check_error("glEnd");
+}
+PFNGLENDPROC glad_debug_glEnd = glad_debug_impl_glEnd;
+static void APIENTRY glad_debug_impl_glEndConditionalRender(void) {
+	glad_glEndConditionalRender();
+	if (gl_debug_tracing) gl_debug_trace_call("glEndConditionalRender", "");
+	gl_debug_check_error("glEndConditionalRender");
+}
+PFNGLENDCONDITIONALRENDERPROC glad_debug_glEndConditionalRender = glad_debug_impl_glEndConditionalRender;
+static void APIENTRY glad_debug_impl_glEndList(void) {
+	glad_glEndList();
+	if (gl_debug_tracing) gl_debug_trace_call("glEndList", "");
+	gl_debug_check_error("glEndList");
+}
+PFNGLENDLISTPROC glad_debug_glEndList = glad_debug_impl_glEndList;
+static void APIENTRY glad_debug_impl_glEndQuery(GLenum arg0) {
+	glad_glEndQuery(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glEndQuery", "e", (unsigned int)arg0);
+	gl_debug_check_error("glEndQuery");
+}
+PFNGLENDQUERYPROC glad_debug_glEndQuery = glad_debug_impl_glEndQuery;
+static void APIENTRY glad_debug_impl_glEndQueryIndexed(GLenum arg0, GLuint arg1) {
+	glad_glEndQueryIndexed(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glEndQueryIndexed", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glEndQueryIndexed");
+}
+PFNGLENDQUERYINDEXEDPROC glad_debug_glEndQueryIndexed = glad_debug_impl_glEndQueryIndexed;
+static void APIENTRY glad_debug_impl_glEndTransformFeedback(void) {
+	glad_glEndTransformFeedback();
+	if (gl_debug_tracing) gl_debug_trace_call("glEndTransformFeedback", "");
+	gl_debug_check_error("glEndTransformFeedback");
+}
+PFNGLENDTRANSFORMFEEDBACKPROC glad_debug_glEndTransformFeedback = glad_debug_impl_glEndTransformFeedback;
+static void APIENTRY glad_debug_impl_glEvalCoord1d(GLdouble arg0) {
+	glad_glEvalCoord1d(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glEvalCoord1d", "f", (double)arg0);
+	gl_debug_check_error("glEvalCoord1d");
+}
+PFNGLEVALCOORD1DPROC glad_debug_glEvalCoord1d = glad_debug_impl_glEvalCoord1d;
+static void APIENTRY glad_debug_impl_glEvalCoord1dv(const GLdouble * arg0) {
+	glad_glEvalCoord1dv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glEvalCoord1dv", "p", (const void*)arg0);
+	gl_debug_check_error("glEvalCoord1dv");
+}
+PFNGLEVALCOORD1DVPROC glad_debug_glEvalCoord1dv = glad_debug_impl_glEvalCoord1dv;
+static void APIENTRY glad_debug_impl_glEvalCoord1f(GLfloat arg0) {
+	glad_glEvalCoord1f(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glEvalCoord1f", "f", (double)arg0);
+	gl_debug_check_error("glEvalCoord1f");
+}
+PFNGLEVALCOORD1FPROC glad_debug_glEvalCoord1f = glad_debug_impl_glEvalCoord1f;
+static void APIENTRY glad_debug_impl_glEvalCoord1fv(const GLfloat * arg0) {
+	glad_glEvalCoord1fv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glEvalCoord1fv", "p", (const void*)arg0);
+	gl_debug_check_error("glEvalCoord1fv");
+}
+PFNGLEVALCOORD1FVPROC glad_debug_glEvalCoord1fv = glad_debug_impl_glEvalCoord1fv;
+static void APIENTRY glad_debug_impl_glEvalCoord2d(GLdouble arg0, GLdouble arg1) {
+	glad_glEvalCoord2d(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glEvalCoord2d", "ff", (double)arg0, (double)arg1);
+	gl_debug_check_error("glEvalCoord2d");
+}
+PFNGLEVALCOORD2DPROC glad_debug_glEvalCoord2d = glad_debug_impl_glEvalCoord2d;
+static void APIENTRY glad_debug_impl_glEvalCoord2dv(const GLdouble * arg0) {
+	glad_glEvalCoord2dv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glEvalCoord2dv", "p", (const void*)arg0);
+	gl_debug_check_error("glEvalCoord2dv");
+}
+PFNGLEVALCOORD2DVPROC glad_debug_glEvalCoord2dv = glad_debug_impl_glEvalCoord2dv;
+static void APIENTRY glad_debug_impl_glEvalCoord2f(GLfloat arg0, GLfloat arg1) {
+	glad_glEvalCoord2f(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glEvalCoord2f", "ff", (double)arg0, (double)arg1);
+	gl_debug_check_error("glEvalCoord2f");
+}
+PFNGLEVALCOORD2FPROC glad_debug_glEvalCoord2f = glad_debug_impl_glEvalCoord2f;
+static void APIENTRY glad_debug_impl_glEvalCoord2fv(const GLfloat * arg0) {
+	glad_glEvalCoord2fv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glEvalCoord2fv", "p", (const void*)arg0);
+	gl_debug_check_error("glEvalCoord2fv");
+}
+PFNGLEVALCOORD2FVPROC glad_debug_glEvalCoord2fv = glad_debug_impl_glEvalCoord2fv;
+static void APIENTRY glad_debug_impl_glEvalMesh1(GLenum arg0, GLint arg1, GLint arg2) {
+	glad_glEvalMesh1(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glEvalMesh1", "eii", (unsigned int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glEvalMesh1");
+}
+PFNGLEVALMESH1PROC glad_debug_glEvalMesh1 = glad_debug_impl_glEvalMesh1;
+static void APIENTRY glad_debug_impl_glEvalMesh2(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	glad_glEvalMesh2(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glEvalMesh2", "eiiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4);
+	gl_debug_check_error("glEvalMesh2");
+}
+PFNGLEVALMESH2PROC glad_debug_glEvalMesh2 = glad_debug_impl_glEvalMesh2;
+static void APIENTRY glad_debug_impl_glEvalPoint1(GLint arg0) {
+	glad_glEvalPoint1(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glEvalPoint1", "i", (int)arg0);
+	gl_debug_check_error("glEvalPoint1");
+}
+PFNGLEVALPOINT1PROC glad_debug_glEvalPoint1 = glad_debug_impl_glEvalPoint1;
+static void APIENTRY glad_debug_impl_glEvalPoint2(GLint arg0, GLint arg1) {
+	glad_glEvalPoint2(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glEvalPoint2", "ii", (int)arg0, (int)arg1);
+	gl_debug_check_error("glEvalPoint2");
+}
+PFNGLEVALPOINT2PROC glad_debug_glEvalPoint2 = glad_debug_impl_glEvalPoint2;
+static void APIENTRY glad_debug_impl_glFeedbackBuffer(GLsizei arg0, GLenum arg1, GLfloat * arg2) {
+	glad_glFeedbackBuffer(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glFeedbackBuffer", "iep", (int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glFeedbackBuffer");
+}
+PFNGLFEEDBACKBUFFERPROC glad_debug_glFeedbackBuffer = glad_debug_impl_glFeedbackBuffer;
+static GLsync APIENTRY glad_debug_impl_glFenceSync(GLenum arg0, GLbitfield arg1) {
+	GLsync ret;
+	ret = glad_glFenceSync(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glFenceSync", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glFenceSync");
+	return ret;
+}
+PFNGLFENCESYNCPROC glad_debug_glFenceSync = glad_debug_impl_glFenceSync;
+static void APIENTRY glad_debug_impl_glFinish(void) {
+	glad_glFinish();
+	if (gl_debug_tracing) gl_debug_trace_call("glFinish", "");
+	gl_debug_check_error("glFinish");
+}
+PFNGLFINISHPROC glad_debug_glFinish = glad_debug_impl_glFinish;
+static void APIENTRY glad_debug_impl_glFlush(void) {
+	glad_glFlush();
+	if (gl_debug_tracing) gl_debug_trace_call("glFlush", "");
+	gl_debug_check_error("glFlush");
+}
+PFNGLFLUSHPROC glad_debug_glFlush = glad_debug_impl_glFlush;
+static void APIENTRY glad_debug_impl_glFlushMappedBufferRange(GLenum arg0, GLintptr arg1, GLsizeiptr arg2) {
+	glad_glFlushMappedBufferRange(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glFlushMappedBufferRange", "ell", (unsigned int)arg0, (long long)arg1, (long long)arg2);
+	gl_debug_check_error("glFlushMappedBufferRange");
+}
+PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_debug_glFlushMappedBufferRange = glad_debug_impl_glFlushMappedBufferRange;
+static void APIENTRY glad_debug_impl_glFlushMappedNamedBufferRange(GLuint arg0, GLintptr arg1, GLsizeiptr arg2) {
+	glad_glFlushMappedNamedBufferRange(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glFlushMappedNamedBufferRange", "ull", (unsigned int)arg0, (long long)arg1, (long long)arg2);
+	gl_debug_check_error("glFlushMappedNamedBufferRange");
+}
+PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_debug_glFlushMappedNamedBufferRange = glad_debug_impl_glFlushMappedNamedBufferRange;
+static void APIENTRY glad_debug_impl_glFogCoordPointer(GLenum arg0, GLsizei arg1, const void * arg2) {
+	glad_glFogCoordPointer(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glFogCoordPointer", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glFogCoordPointer");
+}
+PFNGLFOGCOORDPOINTERPROC glad_debug_glFogCoordPointer = glad_debug_impl_glFogCoordPointer;
+static void APIENTRY glad_debug_impl_glFogCoordd(GLdouble arg0) {
+	glad_glFogCoordd(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glFogCoordd", "f", (double)arg0);
+	gl_debug_check_error("glFogCoordd");
+}
+PFNGLFOGCOORDDPROC glad_debug_glFogCoordd = glad_debug_impl_glFogCoordd;
+static void APIENTRY glad_debug_impl_glFogCoorddv(const GLdouble * arg0) {
+	glad_glFogCoorddv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glFogCoorddv", "p", (const void*)arg0);
+	gl_debug_check_error("glFogCoorddv");
+}
+PFNGLFOGCOORDDVPROC glad_debug_glFogCoorddv = glad_debug_impl_glFogCoorddv;
+static void APIENTRY glad_debug_impl_glFogCoordf(GLfloat arg0) {
+	glad_glFogCoordf(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glFogCoordf", "f", (double)arg0);
+	gl_debug_check_error("glFogCoordf");
+}
+PFNGLFOGCOORDFPROC glad_debug_glFogCoordf = glad_debug_impl_glFogCoordf;
+static void APIENTRY glad_debug_impl_glFogCoordfv(const GLfloat * arg0) {
+	glad_glFogCoordfv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glFogCoordfv", "p", (const void*)arg0);
+	gl_debug_check_error("glFogCoordfv");
+}
+PFNGLFOGCOORDFVPROC glad_debug_glFogCoordfv = glad_debug_impl_glFogCoordfv;
+static void APIENTRY glad_debug_impl_glFogf(GLenum arg0, GLfloat arg1) {
+	glad_glFogf(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glFogf", "ef", (unsigned int)arg0, (double)arg1);
+	gl_debug_check_error("glFogf");
+}
+PFNGLFOGFPROC glad_debug_glFogf = glad_debug_impl_glFogf;
+static void APIENTRY glad_debug_impl_glFogfv(GLenum arg0, const GLfloat * arg1) {
+	glad_glFogfv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glFogfv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glFogfv");
+}
+PFNGLFOGFVPROC glad_debug_glFogfv = glad_debug_impl_glFogfv;
+static void APIENTRY glad_debug_impl_glFogi(GLenum arg0, GLint arg1) {
+	glad_glFogi(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glFogi", "ei", (unsigned int)arg0, (int)arg1);
+	gl_debug_check_error("glFogi");
+}
+PFNGLFOGIPROC glad_debug_glFogi = glad_debug_impl_glFogi;
+static void APIENTRY glad_debug_impl_glFogiv(GLenum arg0, const GLint * arg1) {
+	glad_glFogiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glFogiv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glFogiv");
+}
+PFNGLFOGIVPROC glad_debug_glFogiv = glad_debug_impl_glFogiv;
+static void APIENTRY glad_debug_impl_glFramebufferParameteri(GLenum arg0, GLenum arg1, GLint arg2) {
+	glad_glFramebufferParameteri(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glFramebufferParameteri", "eei", (unsigned int)arg0, (unsigned int)arg1, (int)arg2);
+	gl_debug_check_error("glFramebufferParameteri");
+}
+PFNGLFRAMEBUFFERPARAMETERIPROC glad_debug_glFramebufferParameteri = glad_debug_impl_glFramebufferParameteri;
+static void APIENTRY glad_debug_impl_glFramebufferRenderbuffer(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3) {
+	glad_glFramebufferRenderbuffer(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glFramebufferRenderbuffer", "eeeu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glFramebufferRenderbuffer");
+}
+PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_debug_glFramebufferRenderbuffer = glad_debug_impl_glFramebufferRenderbuffer;
+static void APIENTRY glad_debug_impl_glFramebufferTexture(GLenum arg0, GLenum arg1, GLuint arg2, GLint arg3) {
+	glad_glFramebufferTexture(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glFramebufferTexture", "eeui", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (int)arg3);
+	gl_debug_check_error("glFramebufferTexture");
+}
+PFNGLFRAMEBUFFERTEXTUREPROC glad_debug_glFramebufferTexture = glad_debug_impl_glFramebufferTexture;
+static void APIENTRY glad_debug_impl_glFramebufferTexture1D(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3, GLint arg4) {
+	glad_glFramebufferTexture1D(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glFramebufferTexture1D", "eeeui", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (unsigned int)arg3, (int)arg4);
+	gl_debug_check_error("glFramebufferTexture1D");
+}
+PFNGLFRAMEBUFFERTEXTURE1DPROC glad_debug_glFramebufferTexture1D = glad_debug_impl_glFramebufferTexture1D;
+static void APIENTRY glad_debug_impl_glFramebufferTexture2D(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3, GLint arg4) {
+	glad_glFramebufferTexture2D(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glFramebufferTexture2D", "eeeui", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (unsigned int)arg3, (int)arg4);
+	gl_debug_check_error("glFramebufferTexture2D");
+}
+PFNGLFRAMEBUFFERTEXTURE2DPROC glad_debug_glFramebufferTexture2D = glad_debug_impl_glFramebufferTexture2D;
+static void APIENTRY glad_debug_impl_glFramebufferTexture3D(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3, GLint arg4, GLint arg5) {
+	glad_glFramebufferTexture3D(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glFramebufferTexture3D", "eeeuii", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (unsigned int)arg3, (int)arg4, (int)arg5);
+	gl_debug_check_error("glFramebufferTexture3D");
+}
+PFNGLFRAMEBUFFERTEXTURE3DPROC glad_debug_glFramebufferTexture3D = glad_debug_impl_glFramebufferTexture3D;
+static void APIENTRY glad_debug_impl_glFramebufferTextureLayer(GLenum arg0, GLenum arg1, GLuint arg2, GLint arg3, GLint arg4) {
+	glad_glFramebufferTextureLayer(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glFramebufferTextureLayer", "eeuii", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4);
+	gl_debug_check_error("glFramebufferTextureLayer");
+}
+PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_debug_glFramebufferTextureLayer = glad_debug_impl_glFramebufferTextureLayer;
+static void APIENTRY glad_debug_impl_glFrontFace(GLenum arg0) {
+	glad_glFrontFace(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glFrontFace", "e", (unsigned int)arg0);
+	gl_debug_check_error("glFrontFace");
+}
+PFNGLFRONTFACEPROC glad_debug_glFrontFace = glad_debug_impl_glFrontFace;
+static void APIENTRY glad_debug_impl_glFrustum(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4, GLdouble arg5) {
+	glad_glFrustum(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glFrustum", "ffffff", (double)arg0, (double)arg1, (double)arg2, (double)arg3, (double)arg4, (double)arg5);
+	gl_debug_check_error("glFrustum");
+}
+PFNGLFRUSTUMPROC glad_debug_glFrustum = glad_debug_impl_glFrustum;
+static void APIENTRY glad_debug_impl_glGenBuffers(GLsizei arg0, GLuint * arg1) {
+	glad_glGenBuffers(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGenBuffers", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGenBuffers");
+}
+PFNGLGENBUFFERSPROC glad_debug_glGenBuffers = glad_debug_impl_glGenBuffers;
+static void APIENTRY glad_debug_impl_glGenFramebuffers(GLsizei arg0, GLuint * arg1) {
+	glad_glGenFramebuffers(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGenFramebuffers", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGenFramebuffers");
+}
+PFNGLGENFRAMEBUFFERSPROC glad_debug_glGenFramebuffers = glad_debug_impl_glGenFramebuffers;
+static GLuint APIENTRY glad_debug_impl_glGenLists(GLsizei arg0) {
+	GLuint ret;
+	ret = glad_glGenLists(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glGenLists", "i", (int)arg0);
+	gl_debug_check_error("glGenLists");
+	return ret;
+}
+PFNGLGENLISTSPROC glad_debug_glGenLists = glad_debug_impl_glGenLists;
+static void APIENTRY glad_debug_impl_glGenProgramPipelines(GLsizei arg0, GLuint * arg1) {
+	glad_glGenProgramPipelines(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGenProgramPipelines", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGenProgramPipelines");
+}
+PFNGLGENPROGRAMPIPELINESPROC glad_debug_glGenProgramPipelines = glad_debug_impl_glGenProgramPipelines;
+static void APIENTRY glad_debug_impl_glGenQueries(GLsizei arg0, GLuint * arg1) {
+	glad_glGenQueries(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGenQueries", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGenQueries");
+}
+PFNGLGENQUERIESPROC glad_debug_glGenQueries = glad_debug_impl_glGenQueries;
+static void APIENTRY glad_debug_impl_glGenRenderbuffers(GLsizei arg0, GLuint * arg1) {
+	glad_glGenRenderbuffers(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGenRenderbuffers", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGenRenderbuffers");
+}
+PFNGLGENRENDERBUFFERSPROC glad_debug_glGenRenderbuffers = glad_debug_impl_glGenRenderbuffers;
+static void APIENTRY glad_debug_impl_glGenSamplers(GLsizei arg0, GLuint * arg1) {
+	glad_glGenSamplers(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGenSamplers", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGenSamplers");
+}
+PFNGLGENSAMPLERSPROC glad_debug_glGenSamplers = glad_debug_impl_glGenSamplers;
+static void APIENTRY glad_debug_impl_glGenTextures(GLsizei arg0, GLuint * arg1) {
+	glad_glGenTextures(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGenTextures", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGenTextures");
+}
+PFNGLGENTEXTURESPROC glad_debug_glGenTextures = glad_debug_impl_glGenTextures;
+static void APIENTRY glad_debug_impl_glGenTransformFeedbacks(GLsizei arg0, GLuint * arg1) {
+	glad_glGenTransformFeedbacks(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGenTransformFeedbacks", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGenTransformFeedbacks");
+}
+PFNGLGENTRANSFORMFEEDBACKSPROC glad_debug_glGenTransformFeedbacks = glad_debug_impl_glGenTransformFeedbacks;
+static void APIENTRY glad_debug_impl_glGenVertexArrays(GLsizei arg0, GLuint * arg1) {
+	glad_glGenVertexArrays(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGenVertexArrays", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGenVertexArrays");
+}
+PFNGLGENVERTEXARRAYSPROC glad_debug_glGenVertexArrays = glad_debug_impl_glGenVertexArrays;
+static void APIENTRY glad_debug_impl_glGenerateMipmap(GLenum arg0) {
+	glad_glGenerateMipmap(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glGenerateMipmap", "e", (unsigned int)arg0);
+	gl_debug_check_error("glGenerateMipmap");
+}
+PFNGLGENERATEMIPMAPPROC glad_debug_glGenerateMipmap = glad_debug_impl_glGenerateMipmap;
+static void APIENTRY glad_debug_impl_glGenerateTextureMipmap(GLuint arg0) {
+	glad_glGenerateTextureMipmap(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glGenerateTextureMipmap", "u", (unsigned int)arg0);
+	gl_debug_check_error("glGenerateTextureMipmap");
+}
+PFNGLGENERATETEXTUREMIPMAPPROC glad_debug_glGenerateTextureMipmap = glad_debug_impl_glGenerateTextureMipmap;
+static void APIENTRY glad_debug_impl_glGetActiveAtomicCounterBufferiv(GLuint arg0, GLuint arg1, GLenum arg2, GLint * arg3) {
+	glad_glGetActiveAtomicCounterBufferiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetActiveAtomicCounterBufferiv", "uuep", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetActiveAtomicCounterBufferiv");
+}
+PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_debug_glGetActiveAtomicCounterBufferiv = glad_debug_impl_glGetActiveAtomicCounterBufferiv;
+static void APIENTRY glad_debug_impl_glGetActiveAttrib(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLint * arg4, GLenum * arg5, GLchar * arg6) {
+	glad_glGetActiveAttrib(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetActiveAttrib", "uuipppp", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3, (const void*)arg4, (const void*)arg5, (const void*)arg6);
+	gl_debug_check_error("glGetActiveAttrib");
+}
+PFNGLGETACTIVEATTRIBPROC glad_debug_glGetActiveAttrib = glad_debug_impl_glGetActiveAttrib;
+static void APIENTRY glad_debug_impl_glGetActiveSubroutineName(GLuint arg0, GLenum arg1, GLuint arg2, GLsizei arg3, GLsizei * arg4, GLchar * arg5) {
+	glad_glGetActiveSubroutineName(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetActiveSubroutineName", "ueuipp", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (int)arg3, (const void*)arg4, (const void*)arg5);
+	gl_debug_check_error("glGetActiveSubroutineName");
+}
+PFNGLGETACTIVESUBROUTINENAMEPROC glad_debug_glGetActiveSubroutineName = glad_debug_impl_glGetActiveSubroutineName;
+static void APIENTRY glad_debug_impl_glGetActiveSubroutineUniformName(GLuint arg0, GLenum arg1, GLuint arg2, GLsizei arg3, GLsizei * arg4, GLchar * arg5) {
+	glad_glGetActiveSubroutineUniformName(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetActiveSubroutineUniformName", "ueuipp", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (int)arg3, (const void*)arg4, (const void*)arg5);
+	gl_debug_check_error("glGetActiveSubroutineUniformName");
+}
+PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_debug_glGetActiveSubroutineUniformName = glad_debug_impl_glGetActiveSubroutineUniformName;
+static void APIENTRY glad_debug_impl_glGetActiveSubroutineUniformiv(GLuint arg0, GLenum arg1, GLuint arg2, GLenum arg3, GLint * arg4) {
+	glad_glGetActiveSubroutineUniformiv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetActiveSubroutineUniformiv", "ueuep", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (unsigned int)arg3, (const void*)arg4);
+	gl_debug_check_error("glGetActiveSubroutineUniformiv");
+}
+PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_debug_glGetActiveSubroutineUniformiv = glad_debug_impl_glGetActiveSubroutineUniformiv;
+static void APIENTRY glad_debug_impl_glGetActiveUniform(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLint * arg4, GLenum * arg5, GLchar * arg6) {
+	glad_glGetActiveUniform(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetActiveUniform", "uuipppp", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3, (const void*)arg4, (const void*)arg5, (const void*)arg6);
+	gl_debug_check_error("glGetActiveUniform");
+}
+PFNGLGETACTIVEUNIFORMPROC glad_debug_glGetActiveUniform = glad_debug_impl_glGetActiveUniform;
+static void APIENTRY glad_debug_impl_glGetActiveUniformBlockName(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLchar * arg4) {
+	glad_glGetActiveUniformBlockName(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetActiveUniformBlockName", "uuipp", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3, (const void*)arg4);
+	gl_debug_check_error("glGetActiveUniformBlockName");
+}
+PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_debug_glGetActiveUniformBlockName = glad_debug_impl_glGetActiveUniformBlockName;
+static void APIENTRY glad_debug_impl_glGetActiveUniformBlockiv(GLuint arg0, GLuint arg1, GLenum arg2, GLint * arg3) {
+	glad_glGetActiveUniformBlockiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetActiveUniformBlockiv", "uuep", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetActiveUniformBlockiv");
+}
+PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_debug_glGetActiveUniformBlockiv = glad_debug_impl_glGetActiveUniformBlockiv;
+static void APIENTRY glad_debug_impl_glGetActiveUniformName(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLchar * arg4) {
+	glad_glGetActiveUniformName(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetActiveUniformName", "uuipp", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3, (const void*)arg4);
+	gl_debug_check_error("glGetActiveUniformName");
+}
+PFNGLGETACTIVEUNIFORMNAMEPROC glad_debug_glGetActiveUniformName = glad_debug_impl_glGetActiveUniformName;
+static void APIENTRY glad_debug_impl_glGetActiveUniformsiv(GLuint arg0, GLsizei arg1, const GLuint * arg2, GLenum arg3, GLint * arg4) {
+	glad_glGetActiveUniformsiv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetActiveUniformsiv", "uipep", (unsigned int)arg0, (int)arg1, (const void*)arg2, (unsigned int)arg3, (const void*)arg4);
+	gl_debug_check_error("glGetActiveUniformsiv");
+}
+PFNGLGETACTIVEUNIFORMSIVPROC glad_debug_glGetActiveUniformsiv = glad_debug_impl_glGetActiveUniformsiv;
+static void APIENTRY glad_debug_impl_glGetAttachedShaders(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLuint * arg3) {
+	glad_glGetAttachedShaders(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetAttachedShaders", "uipp", (unsigned int)arg0, (int)arg1, (const void*)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetAttachedShaders");
+}
+PFNGLGETATTACHEDSHADERSPROC glad_debug_glGetAttachedShaders = glad_debug_impl_glGetAttachedShaders;
+static GLint APIENTRY glad_debug_impl_glGetAttribLocation(GLuint arg0, const GLchar * arg1) {
+	GLint ret;
+	ret = glad_glGetAttribLocation(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetAttribLocation", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGetAttribLocation");
+	return ret;
+}
+PFNGLGETATTRIBLOCATIONPROC glad_debug_glGetAttribLocation = glad_debug_impl_glGetAttribLocation;
+static void APIENTRY glad_debug_impl_glGetBooleani_v(GLenum arg0, GLuint arg1, GLboolean * arg2) {
+	glad_glGetBooleani_v(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetBooleani_v", "eup", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetBooleani_v");
+}
+PFNGLGETBOOLEANI_VPROC glad_debug_glGetBooleani_v = glad_debug_impl_glGetBooleani_v;
+static void APIENTRY glad_debug_impl_glGetBooleanv(GLenum arg0, GLboolean * arg1) {
+	glad_glGetBooleanv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetBooleanv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGetBooleanv");
+}
+PFNGLGETBOOLEANVPROC glad_debug_glGetBooleanv = glad_debug_impl_glGetBooleanv;
+static void APIENTRY glad_debug_impl_glGetBufferParameteri64v(GLenum arg0, GLenum arg1, GLint64 * arg2) {
+	glad_glGetBufferParameteri64v(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetBufferParameteri64v", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetBufferParameteri64v");
+}
+PFNGLGETBUFFERPARAMETERI64VPROC glad_debug_glGetBufferParameteri64v = glad_debug_impl_glGetBufferParameteri64v;
+static void APIENTRY glad_debug_impl_glGetBufferParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetBufferParameteriv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetBufferParameteriv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetBufferParameteriv");
+}
+PFNGLGETBUFFERPARAMETERIVPROC glad_debug_glGetBufferParameteriv = glad_debug_impl_glGetBufferParameteriv;
+static void APIENTRY glad_debug_impl_glGetBufferPointerv(GLenum arg0, GLenum arg1, void * * arg2) {
+	glad_glGetBufferPointerv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetBufferPointerv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetBufferPointerv");
+}
+PFNGLGETBUFFERPOINTERVPROC glad_debug_glGetBufferPointerv = glad_debug_impl_glGetBufferPointerv;
+static void APIENTRY glad_debug_impl_glGetBufferSubData(GLenum arg0, GLintptr arg1, GLsizeiptr arg2, void * arg3) {
+	glad_glGetBufferSubData(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetBufferSubData", "ellp", (unsigned int)arg0, (long long)arg1, (long long)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetBufferSubData");
+}
+PFNGLGETBUFFERSUBDATAPROC glad_debug_glGetBufferSubData = glad_debug_impl_glGetBufferSubData;
+static void APIENTRY glad_debug_impl_glGetClipPlane(GLenum arg0, GLdouble * arg1) {
+	glad_glGetClipPlane(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetClipPlane", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGetClipPlane");
+}
+PFNGLGETCLIPPLANEPROC glad_debug_glGetClipPlane = glad_debug_impl_glGetClipPlane;
+static void APIENTRY glad_debug_impl_glGetCompressedTexImage(GLenum arg0, GLint arg1, void * arg2) {
+	glad_glGetCompressedTexImage(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetCompressedTexImage", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetCompressedTexImage");
+}
+PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_debug_glGetCompressedTexImage = glad_debug_impl_glGetCompressedTexImage;
+static void APIENTRY glad_debug_impl_glGetCompressedTextureImage(GLuint arg0, GLint arg1, GLsizei arg2, void * arg3) {
+	glad_glGetCompressedTextureImage(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetCompressedTextureImage", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetCompressedTextureImage");
+}
+PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC glad_debug_glGetCompressedTextureImage = glad_debug_impl_glGetCompressedTextureImage;
+static void APIENTRY glad_debug_impl_glGetCompressedTextureSubImage(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLsizei arg8, void * arg9) {
+	glad_glGetCompressedTextureSubImage(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetCompressedTextureSubImage", "uiiiiiiiip", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6, (int)arg7, (int)arg8, (const void*)arg9);
+	gl_debug_check_error("glGetCompressedTextureSubImage");
+}
+PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC glad_debug_glGetCompressedTextureSubImage = glad_debug_impl_glGetCompressedTextureSubImage;
+static GLuint APIENTRY glad_debug_impl_glGetDebugMessageLog(GLuint arg0, GLsizei arg1, GLenum * arg2, GLenum * arg3, GLuint * arg4, GLenum * arg5, GLsizei * arg6, GLchar * arg7) {
+	GLuint ret;
+	ret = glad_glGetDebugMessageLog(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetDebugMessageLog", "uipppppp", (unsigned int)arg0, (int)arg1, (const void*)arg2, (const void*)arg3, (const void*)arg4, (const void*)arg5, (const void*)arg6, (const void*)arg7);
+	gl_debug_check_error("glGetDebugMessageLog");
+	return ret;
+}
+PFNGLGETDEBUGMESSAGELOGPROC glad_debug_glGetDebugMessageLog = glad_debug_impl_glGetDebugMessageLog;
+static void APIENTRY glad_debug_impl_glGetDoublei_v(GLenum arg0, GLuint arg1, GLdouble * arg2) {
+	glad_glGetDoublei_v(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetDoublei_v", "eup", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetDoublei_v");
+}
+PFNGLGETDOUBLEI_VPROC glad_debug_glGetDoublei_v = glad_debug_impl_glGetDoublei_v;
+static void APIENTRY glad_debug_impl_glGetDoublev(GLenum arg0, GLdouble * arg1) {
+	glad_glGetDoublev(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetDoublev", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGetDoublev");
+}
+PFNGLGETDOUBLEVPROC glad_debug_glGetDoublev = glad_debug_impl_glGetDoublev;
+static GLenum APIENTRY glad_debug_impl_glGetError(void) {
+	GLenum ret;
+	ret = glad_glGetError();
+	if (gl_debug_tracing) gl_debug_trace_call("glGetError", "");
+	return ret;
+}
+PFNGLGETERRORPROC glad_debug_glGetError = glad_debug_impl_glGetError;
+static void APIENTRY glad_debug_impl_glGetFloati_v(GLenum arg0, GLuint arg1, GLfloat * arg2) {
+	glad_glGetFloati_v(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetFloati_v", "eup", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetFloati_v");
+}
+PFNGLGETFLOATI_VPROC glad_debug_glGetFloati_v = glad_debug_impl_glGetFloati_v;
+static void APIENTRY glad_debug_impl_glGetFloatv(GLenum arg0, GLfloat * arg1) {
+	glad_glGetFloatv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetFloatv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGetFloatv");
+}
+PFNGLGETFLOATVPROC glad_debug_glGetFloatv = glad_debug_impl_glGetFloatv;
+static GLint APIENTRY glad_debug_impl_glGetFragDataIndex(GLuint arg0, const GLchar * arg1) {
+	GLint ret;
+	ret = glad_glGetFragDataIndex(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetFragDataIndex", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGetFragDataIndex");
+	return ret;
+}
+PFNGLGETFRAGDATAINDEXPROC glad_debug_glGetFragDataIndex = glad_debug_impl_glGetFragDataIndex;
+static GLint APIENTRY glad_debug_impl_glGetFragDataLocation(GLuint arg0, const GLchar * arg1) {
+	GLint ret;
+	ret = glad_glGetFragDataLocation(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetFragDataLocation", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGetFragDataLocation");
+	return ret;
+}
+PFNGLGETFRAGDATALOCATIONPROC glad_debug_glGetFragDataLocation = glad_debug_impl_glGetFragDataLocation;
+static void APIENTRY glad_debug_impl_glGetFramebufferAttachmentParameteriv(GLenum arg0, GLenum arg1, GLenum arg2, GLint * arg3) {
+	glad_glGetFramebufferAttachmentParameteriv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetFramebufferAttachmentParameteriv", "eeep", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetFramebufferAttachmentParameteriv");
+}
+PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_debug_glGetFramebufferAttachmentParameteriv = glad_debug_impl_glGetFramebufferAttachmentParameteriv;
+static void APIENTRY glad_debug_impl_glGetFramebufferParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetFramebufferParameteriv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetFramebufferParameteriv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetFramebufferParameteriv");
+}
+PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_debug_glGetFramebufferParameteriv = glad_debug_impl_glGetFramebufferParameteriv;
+static GLenum APIENTRY glad_debug_impl_glGetGraphicsResetStatus(void) {
+	GLenum ret;
+	ret = glad_glGetGraphicsResetStatus();
+	if (gl_debug_tracing) gl_debug_trace_call("glGetGraphicsResetStatus", "");
+	gl_debug_check_error("glGetGraphicsResetStatus");
+	return ret;
+}
+PFNGLGETGRAPHICSRESETSTATUSPROC glad_debug_glGetGraphicsResetStatus = glad_debug_impl_glGetGraphicsResetStatus;
+static GLuint64 APIENTRY glad_debug_impl_glGetImageHandleARB(GLuint arg0, GLint arg1, GLboolean arg2, GLint arg3, GLenum arg4) {
+	GLuint64 ret;
+	ret = glad_glGetImageHandleARB(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetImageHandleARB", "uibie", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (unsigned int)arg4);
+	gl_debug_check_error("glGetImageHandleARB");
+	return ret;
+}
+PFNGLGETIMAGEHANDLEARBPROC glad_debug_glGetImageHandleARB = glad_debug_impl_glGetImageHandleARB;
+static void APIENTRY glad_debug_impl_glGetInteger64i_v(GLenum arg0, GLuint arg1, GLint64 * arg2) {
+	glad_glGetInteger64i_v(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetInteger64i_v", "eup", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetInteger64i_v");
+}
+PFNGLGETINTEGER64I_VPROC glad_debug_glGetInteger64i_v = glad_debug_impl_glGetInteger64i_v;
+static void APIENTRY glad_debug_impl_glGetInteger64v(GLenum arg0, GLint64 * arg1) {
+	glad_glGetInteger64v(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetInteger64v", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGetInteger64v");
+}
+PFNGLGETINTEGER64VPROC glad_debug_glGetInteger64v = glad_debug_impl_glGetInteger64v;
+static void APIENTRY glad_debug_impl_glGetIntegeri_v(GLenum arg0, GLuint arg1, GLint * arg2) {
+	glad_glGetIntegeri_v(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetIntegeri_v", "eup", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetIntegeri_v");
+}
+PFNGLGETINTEGERI_VPROC glad_debug_glGetIntegeri_v = glad_debug_impl_glGetIntegeri_v;
+static void APIENTRY glad_debug_impl_glGetIntegerv(GLenum arg0, GLint * arg1) {
+	glad_glGetIntegerv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetIntegerv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGetIntegerv");
+}
+PFNGLGETINTEGERVPROC glad_debug_glGetIntegerv = glad_debug_impl_glGetIntegerv;
+static void APIENTRY glad_debug_impl_glGetInternalformati64v(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, GLint64 * arg4) {
+	glad_glGetInternalformati64v(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetInternalformati64v", "eeeip", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glGetInternalformati64v");
+}
+PFNGLGETINTERNALFORMATI64VPROC glad_debug_glGetInternalformati64v = glad_debug_impl_glGetInternalformati64v;
+static void APIENTRY glad_debug_impl_glGetInternalformativ(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, GLint * arg4) {
+	glad_glGetInternalformativ(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetInternalformativ", "eeeip", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glGetInternalformativ");
+}
+PFNGLGETINTERNALFORMATIVPROC glad_debug_glGetInternalformativ = glad_debug_impl_glGetInternalformativ;
+static void APIENTRY glad_debug_impl_glGetLightfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	glad_glGetLightfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetLightfv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetLightfv");
+}
+PFNGLGETLIGHTFVPROC glad_debug_glGetLightfv = glad_debug_impl_glGetLightfv;
+static void APIENTRY glad_debug_impl_glGetLightiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetLightiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetLightiv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetLightiv");
+}
+PFNGLGETLIGHTIVPROC glad_debug_glGetLightiv = glad_debug_impl_glGetLightiv;
+static void APIENTRY glad_debug_impl_glGetMapdv(GLenum arg0, GLenum arg1, GLdouble * arg2) {
+	glad_glGetMapdv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetMapdv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetMapdv");
+}
+PFNGLGETMAPDVPROC glad_debug_glGetMapdv = glad_debug_impl_glGetMapdv;
+static void APIENTRY glad_debug_impl_glGetMapfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	glad_glGetMapfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetMapfv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetMapfv");
+}
+PFNGLGETMAPFVPROC glad_debug_glGetMapfv = glad_debug_impl_glGetMapfv;
+static void APIENTRY glad_debug_impl_glGetMapiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetMapiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetMapiv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetMapiv");
+}
+PFNGLGETMAPIVPROC glad_debug_glGetMapiv = glad_debug_impl_glGetMapiv;
+static void APIENTRY glad_debug_impl_glGetMaterialfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	glad_glGetMaterialfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetMaterialfv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetMaterialfv");
+}
+PFNGLGETMATERIALFVPROC glad_debug_glGetMaterialfv = glad_debug_impl_glGetMaterialfv;
+static void APIENTRY glad_debug_impl_glGetMaterialiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetMaterialiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetMaterialiv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetMaterialiv");
+}
+PFNGLGETMATERIALIVPROC glad_debug_glGetMaterialiv = glad_debug_impl_glGetMaterialiv;
+static void APIENTRY glad_debug_impl_glGetMultisamplefv(GLenum arg0, GLuint arg1, GLfloat * arg2) {
+	glad_glGetMultisamplefv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetMultisamplefv", "eup", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetMultisamplefv");
+}
+PFNGLGETMULTISAMPLEFVPROC glad_debug_glGetMultisamplefv = glad_debug_impl_glGetMultisamplefv;
+static void APIENTRY glad_debug_impl_glGetNamedBufferParameteri64v(GLuint arg0, GLenum arg1, GLint64 * arg2) {
+	glad_glGetNamedBufferParameteri64v(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetNamedBufferParameteri64v", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetNamedBufferParameteri64v");
+}
+PFNGLGETNAMEDBUFFERPARAMETERI64VPROC glad_debug_glGetNamedBufferParameteri64v = glad_debug_impl_glGetNamedBufferParameteri64v;
+static void APIENTRY glad_debug_impl_glGetNamedBufferParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetNamedBufferParameteriv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetNamedBufferParameteriv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetNamedBufferParameteriv");
+}
+PFNGLGETNAMEDBUFFERPARAMETERIVPROC glad_debug_glGetNamedBufferParameteriv = glad_debug_impl_glGetNamedBufferParameteriv;
+static void APIENTRY glad_debug_impl_glGetNamedBufferPointerv(GLuint arg0, GLenum arg1, void * * arg2) {
+	glad_glGetNamedBufferPointerv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetNamedBufferPointerv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetNamedBufferPointerv");
+}
+PFNGLGETNAMEDBUFFERPOINTERVPROC glad_debug_glGetNamedBufferPointerv = glad_debug_impl_glGetNamedBufferPointerv;
+static void APIENTRY glad_debug_impl_glGetNamedBufferSubData(GLuint arg0, GLintptr arg1, GLsizeiptr arg2, void * arg3) {
+	glad_glGetNamedBufferSubData(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetNamedBufferSubData", "ullp", (unsigned int)arg0, (long long)arg1, (long long)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetNamedBufferSubData");
+}
+PFNGLGETNAMEDBUFFERSUBDATAPROC glad_debug_glGetNamedBufferSubData = glad_debug_impl_glGetNamedBufferSubData;
+static void APIENTRY glad_debug_impl_glGetNamedFramebufferAttachmentParameteriv(GLuint arg0, GLenum arg1, GLenum arg2, GLint * arg3) {
+	glad_glGetNamedFramebufferAttachmentParameteriv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetNamedFramebufferAttachmentParameteriv", "ueep", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetNamedFramebufferAttachmentParameteriv");
+}
+PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_debug_glGetNamedFramebufferAttachmentParameteriv = glad_debug_impl_glGetNamedFramebufferAttachmentParameteriv;
+static void APIENTRY glad_debug_impl_glGetNamedFramebufferParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetNamedFramebufferParameteriv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetNamedFramebufferParameteriv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetNamedFramebufferParameteriv");
+}
+PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC glad_debug_glGetNamedFramebufferParameteriv = glad_debug_impl_glGetNamedFramebufferParameteriv;
+static void APIENTRY glad_debug_impl_glGetNamedRenderbufferParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetNamedRenderbufferParameteriv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetNamedRenderbufferParameteriv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetNamedRenderbufferParameteriv");
+}
+PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC glad_debug_glGetNamedRenderbufferParameteriv = glad_debug_impl_glGetNamedRenderbufferParameteriv;
+static void APIENTRY glad_debug_impl_glGetObjectLabel(GLenum arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLchar * arg4) {
+	glad_glGetObjectLabel(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetObjectLabel", "euipp", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3, (const void*)arg4);
+	gl_debug_check_error("glGetObjectLabel");
+}
+PFNGLGETOBJECTLABELPROC glad_debug_glGetObjectLabel = glad_debug_impl_glGetObjectLabel;
+static void APIENTRY glad_debug_impl_glGetObjectPtrLabel(const void * arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	glad_glGetObjectPtrLabel(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetObjectPtrLabel", "pipp", (const void*)arg0, (int)arg1, (const void*)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetObjectPtrLabel");
+}
+PFNGLGETOBJECTPTRLABELPROC glad_debug_glGetObjectPtrLabel = glad_debug_impl_glGetObjectPtrLabel;
+static void APIENTRY glad_debug_impl_glGetPixelMapfv(GLenum arg0, GLfloat * arg1) {
+	glad_glGetPixelMapfv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetPixelMapfv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGetPixelMapfv");
+}
+PFNGLGETPIXELMAPFVPROC glad_debug_glGetPixelMapfv = glad_debug_impl_glGetPixelMapfv;
+static void APIENTRY glad_debug_impl_glGetPixelMapuiv(GLenum arg0, GLuint * arg1) {
+	glad_glGetPixelMapuiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetPixelMapuiv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGetPixelMapuiv");
+}
+PFNGLGETPIXELMAPUIVPROC glad_debug_glGetPixelMapuiv = glad_debug_impl_glGetPixelMapuiv;
+static void APIENTRY glad_debug_impl_glGetPixelMapusv(GLenum arg0, GLushort * arg1) {
+	glad_glGetPixelMapusv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetPixelMapusv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGetPixelMapusv");
+}
+PFNGLGETPIXELMAPUSVPROC glad_debug_glGetPixelMapusv = glad_debug_impl_glGetPixelMapusv;
+static void APIENTRY glad_debug_impl_glGetPointerv(GLenum arg0, void * * arg1) {
+	glad_glGetPointerv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetPointerv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGetPointerv");
+}
+PFNGLGETPOINTERVPROC glad_debug_glGetPointerv = glad_debug_impl_glGetPointerv;
+static void APIENTRY glad_debug_impl_glGetPolygonStipple(GLubyte * arg0) {
+	glad_glGetPolygonStipple(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetPolygonStipple", "p", (const void*)arg0);
+	gl_debug_check_error("glGetPolygonStipple");
+}
+PFNGLGETPOLYGONSTIPPLEPROC glad_debug_glGetPolygonStipple = glad_debug_impl_glGetPolygonStipple;
+static void APIENTRY glad_debug_impl_glGetProgramBinary(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLenum * arg3, void * arg4) {
+	glad_glGetProgramBinary(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetProgramBinary", "uippp", (unsigned int)arg0, (int)arg1, (const void*)arg2, (const void*)arg3, (const void*)arg4);
+	gl_debug_check_error("glGetProgramBinary");
+}
+PFNGLGETPROGRAMBINARYPROC glad_debug_glGetProgramBinary = glad_debug_impl_glGetProgramBinary;
+static void APIENTRY glad_debug_impl_glGetProgramInfoLog(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	glad_glGetProgramInfoLog(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetProgramInfoLog", "uipp", (unsigned int)arg0, (int)arg1, (const void*)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetProgramInfoLog");
+}
+PFNGLGETPROGRAMINFOLOGPROC glad_debug_glGetProgramInfoLog = glad_debug_impl_glGetProgramInfoLog;
+static void APIENTRY glad_debug_impl_glGetProgramInterfaceiv(GLuint arg0, GLenum arg1, GLenum arg2, GLint * arg3) {
+	glad_glGetProgramInterfaceiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetProgramInterfaceiv", "ueep", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetProgramInterfaceiv");
+}
+PFNGLGETPROGRAMINTERFACEIVPROC glad_debug_glGetProgramInterfaceiv = glad_debug_impl_glGetProgramInterfaceiv;
+static void APIENTRY glad_debug_impl_glGetProgramPipelineInfoLog(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	glad_glGetProgramPipelineInfoLog(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetProgramPipelineInfoLog", "uipp", (unsigned int)arg0, (int)arg1, (const void*)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetProgramPipelineInfoLog");
+}
+PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_debug_glGetProgramPipelineInfoLog = glad_debug_impl_glGetProgramPipelineInfoLog;
+static void APIENTRY glad_debug_impl_glGetProgramPipelineiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetProgramPipelineiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetProgramPipelineiv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetProgramPipelineiv");
+}
+PFNGLGETPROGRAMPIPELINEIVPROC glad_debug_glGetProgramPipelineiv = glad_debug_impl_glGetProgramPipelineiv;
+static GLuint APIENTRY glad_debug_impl_glGetProgramResourceIndex(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	GLuint ret;
+	ret = glad_glGetProgramResourceIndex(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetProgramResourceIndex", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetProgramResourceIndex");
+	return ret;
+}
+PFNGLGETPROGRAMRESOURCEINDEXPROC glad_debug_glGetProgramResourceIndex = glad_debug_impl_glGetProgramResourceIndex;
+static GLint APIENTRY glad_debug_impl_glGetProgramResourceLocation(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	GLint ret;
+	ret = glad_glGetProgramResourceLocation(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetProgramResourceLocation", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetProgramResourceLocation");
+	return ret;
+}
+PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_debug_glGetProgramResourceLocation = glad_debug_impl_glGetProgramResourceLocation;
+static GLint APIENTRY glad_debug_impl_glGetProgramResourceLocationIndex(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	GLint ret;
+	ret = glad_glGetProgramResourceLocationIndex(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetProgramResourceLocationIndex", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetProgramResourceLocationIndex");
+	return ret;
+}
+PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_debug_glGetProgramResourceLocationIndex = glad_debug_impl_glGetProgramResourceLocationIndex;
+static void APIENTRY glad_debug_impl_glGetProgramResourceName(GLuint arg0, GLenum arg1, GLuint arg2, GLsizei arg3, GLsizei * arg4, GLchar * arg5) {
+	glad_glGetProgramResourceName(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetProgramResourceName", "ueuipp", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (int)arg3, (const void*)arg4, (const void*)arg5);
+	gl_debug_check_error("glGetProgramResourceName");
+}
+PFNGLGETPROGRAMRESOURCENAMEPROC glad_debug_glGetProgramResourceName = glad_debug_impl_glGetProgramResourceName;
+static void APIENTRY glad_debug_impl_glGetProgramResourceiv(GLuint arg0, GLenum arg1, GLuint arg2, GLsizei arg3, const GLenum * arg4, GLsizei arg5, GLsizei * arg6, GLint * arg7) {
+	glad_glGetProgramResourceiv(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetProgramResourceiv", "ueuipipp", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (int)arg3, (const void*)arg4, (int)arg5, (const void*)arg6, (const void*)arg7);
+	gl_debug_check_error("glGetProgramResourceiv");
+}
+PFNGLGETPROGRAMRESOURCEIVPROC glad_debug_glGetProgramResourceiv = glad_debug_impl_glGetProgramResourceiv;
+static void APIENTRY glad_debug_impl_glGetProgramStageiv(GLuint arg0, GLenum arg1, GLenum arg2, GLint * arg3) {
+	glad_glGetProgramStageiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetProgramStageiv", "ueep", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetProgramStageiv");
+}
+PFNGLGETPROGRAMSTAGEIVPROC glad_debug_glGetProgramStageiv = glad_debug_impl_glGetProgramStageiv;
+static void APIENTRY glad_debug_impl_glGetProgramiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetProgramiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetProgramiv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetProgramiv");
+}
+PFNGLGETPROGRAMIVPROC glad_debug_glGetProgramiv = glad_debug_impl_glGetProgramiv;
+static void APIENTRY glad_debug_impl_glGetQueryBufferObjecti64v(GLuint arg0, GLuint arg1, GLenum arg2, GLintptr arg3) {
+	glad_glGetQueryBufferObjecti64v(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetQueryBufferObjecti64v", "uuel", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (long long)arg3);
+	gl_debug_check_error("glGetQueryBufferObjecti64v");
+}
+PFNGLGETQUERYBUFFEROBJECTI64VPROC glad_debug_glGetQueryBufferObjecti64v = glad_debug_impl_glGetQueryBufferObjecti64v;
+static void APIENTRY glad_debug_impl_glGetQueryBufferObjectiv(GLuint arg0, GLuint arg1, GLenum arg2, GLintptr arg3) {
+	glad_glGetQueryBufferObjectiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetQueryBufferObjectiv", "uuel", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (long long)arg3);
+	gl_debug_check_error("glGetQueryBufferObjectiv");
+}
+PFNGLGETQUERYBUFFEROBJECTIVPROC glad_debug_glGetQueryBufferObjectiv = glad_debug_impl_glGetQueryBufferObjectiv;
+static void APIENTRY glad_debug_impl_glGetQueryBufferObjectui64v(GLuint arg0, GLuint arg1, GLenum arg2, GLintptr arg3) {
+	glad_glGetQueryBufferObjectui64v(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetQueryBufferObjectui64v", "uuel", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (long long)arg3);
+	gl_debug_check_error("glGetQueryBufferObjectui64v");
+}
+PFNGLGETQUERYBUFFEROBJECTUI64VPROC glad_debug_glGetQueryBufferObjectui64v = glad_debug_impl_glGetQueryBufferObjectui64v;
+static void APIENTRY glad_debug_impl_glGetQueryBufferObjectuiv(GLuint arg0, GLuint arg1, GLenum arg2, GLintptr arg3) {
+	glad_glGetQueryBufferObjectuiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetQueryBufferObjectuiv", "uuel", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (long long)arg3);
+	gl_debug_check_error("glGetQueryBufferObjectuiv");
+}
+PFNGLGETQUERYBUFFEROBJECTUIVPROC glad_debug_glGetQueryBufferObjectuiv = glad_debug_impl_glGetQueryBufferObjectuiv;
+static void APIENTRY glad_debug_impl_glGetQueryIndexediv(GLenum arg0, GLuint arg1, GLenum arg2, GLint * arg3) {
+	glad_glGetQueryIndexediv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetQueryIndexediv", "euep", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetQueryIndexediv");
+}
+PFNGLGETQUERYINDEXEDIVPROC glad_debug_glGetQueryIndexediv = glad_debug_impl_glGetQueryIndexediv;
+static void APIENTRY glad_debug_impl_glGetQueryObjecti64v(GLuint arg0, GLenum arg1, GLint64 * arg2) {
+	glad_glGetQueryObjecti64v(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetQueryObjecti64v", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetQueryObjecti64v");
+}
+PFNGLGETQUERYOBJECTI64VPROC glad_debug_glGetQueryObjecti64v = glad_debug_impl_glGetQueryObjecti64v;
+static void APIENTRY glad_debug_impl_glGetQueryObjectiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetQueryObjectiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetQueryObjectiv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetQueryObjectiv");
+}
+PFNGLGETQUERYOBJECTIVPROC glad_debug_glGetQueryObjectiv = glad_debug_impl_glGetQueryObjectiv;
+static void APIENTRY glad_debug_impl_glGetQueryObjectui64v(GLuint arg0, GLenum arg1, GLuint64 * arg2) {
+	glad_glGetQueryObjectui64v(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetQueryObjectui64v", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetQueryObjectui64v");
+}
+PFNGLGETQUERYOBJECTUI64VPROC glad_debug_glGetQueryObjectui64v = glad_debug_impl_glGetQueryObjectui64v;
+static void APIENTRY glad_debug_impl_glGetQueryObjectuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+	glad_glGetQueryObjectuiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetQueryObjectuiv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetQueryObjectuiv");
+}
+PFNGLGETQUERYOBJECTUIVPROC glad_debug_glGetQueryObjectuiv = glad_debug_impl_glGetQueryObjectuiv;
+static void APIENTRY glad_debug_impl_glGetQueryiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetQueryiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetQueryiv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetQueryiv");
+}
+PFNGLGETQUERYIVPROC glad_debug_glGetQueryiv = glad_debug_impl_glGetQueryiv;
+static void APIENTRY glad_debug_impl_glGetRenderbufferParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetRenderbufferParameteriv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetRenderbufferParameteriv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetRenderbufferParameteriv");
+}
+PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_debug_glGetRenderbufferParameteriv = glad_debug_impl_glGetRenderbufferParameteriv;
+static void APIENTRY glad_debug_impl_glGetSamplerParameterIiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetSamplerParameterIiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetSamplerParameterIiv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetSamplerParameterIiv");
+}
+PFNGLGETSAMPLERPARAMETERIIVPROC glad_debug_glGetSamplerParameterIiv = glad_debug_impl_glGetSamplerParameterIiv;
+static void APIENTRY glad_debug_impl_glGetSamplerParameterIuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+	glad_glGetSamplerParameterIuiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetSamplerParameterIuiv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetSamplerParameterIuiv");
+}
+PFNGLGETSAMPLERPARAMETERIUIVPROC glad_debug_glGetSamplerParameterIuiv = glad_debug_impl_glGetSamplerParameterIuiv;
+static void APIENTRY glad_debug_impl_glGetSamplerParameterfv(GLuint arg0, GLenum arg1, GLfloat * arg2) {
+	glad_glGetSamplerParameterfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetSamplerParameterfv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetSamplerParameterfv");
+}
+PFNGLGETSAMPLERPARAMETERFVPROC glad_debug_glGetSamplerParameterfv = glad_debug_impl_glGetSamplerParameterfv;
+static void APIENTRY glad_debug_impl_glGetSamplerParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetSamplerParameteriv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetSamplerParameteriv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetSamplerParameteriv");
+}
+PFNGLGETSAMPLERPARAMETERIVPROC glad_debug_glGetSamplerParameteriv = glad_debug_impl_glGetSamplerParameteriv;
+static void APIENTRY glad_debug_impl_glGetShaderInfoLog(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	glad_glGetShaderInfoLog(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetShaderInfoLog", "uipp", (unsigned int)arg0, (int)arg1, (const void*)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetShaderInfoLog");
+}
+PFNGLGETSHADERINFOLOGPROC glad_debug_glGetShaderInfoLog = glad_debug_impl_glGetShaderInfoLog;
+static void APIENTRY glad_debug_impl_glGetShaderPrecisionFormat(GLenum arg0, GLenum arg1, GLint * arg2, GLint * arg3) {
+	glad_glGetShaderPrecisionFormat(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetShaderPrecisionFormat", "eepp", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetShaderPrecisionFormat");
+}
+PFNGLGETSHADERPRECISIONFORMATPROC glad_debug_glGetShaderPrecisionFormat = glad_debug_impl_glGetShaderPrecisionFormat;
+static void APIENTRY glad_debug_impl_glGetShaderSource(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	glad_glGetShaderSource(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetShaderSource", "uipp", (unsigned int)arg0, (int)arg1, (const void*)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetShaderSource");
+}
+PFNGLGETSHADERSOURCEPROC glad_debug_glGetShaderSource = glad_debug_impl_glGetShaderSource;
+static void APIENTRY glad_debug_impl_glGetShaderiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetShaderiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetShaderiv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetShaderiv");
+}
+PFNGLGETSHADERIVPROC glad_debug_glGetShaderiv = glad_debug_impl_glGetShaderiv;
+static const GLubyte * APIENTRY glad_debug_impl_glGetString(GLenum arg0) {
+	const GLubyte * ret;
+	ret = glad_glGetString(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetString", "e", (unsigned int)arg0);
+	gl_debug_check_error("glGetString");
+	return ret;
+}
+PFNGLGETSTRINGPROC glad_debug_glGetString = glad_debug_impl_glGetString;
+static const GLubyte * APIENTRY glad_debug_impl_glGetStringi(GLenum arg0, GLuint arg1) {
+	const GLubyte * ret;
+	ret = glad_glGetStringi(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetStringi", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glGetStringi");
+	return ret;
+}
+PFNGLGETSTRINGIPROC glad_debug_glGetStringi = glad_debug_impl_glGetStringi;
+static GLuint APIENTRY glad_debug_impl_glGetSubroutineIndex(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	GLuint ret;
+	ret = glad_glGetSubroutineIndex(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetSubroutineIndex", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetSubroutineIndex");
+	return ret;
+}
+PFNGLGETSUBROUTINEINDEXPROC glad_debug_glGetSubroutineIndex = glad_debug_impl_glGetSubroutineIndex;
+static GLint APIENTRY glad_debug_impl_glGetSubroutineUniformLocation(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	GLint ret;
+	ret = glad_glGetSubroutineUniformLocation(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetSubroutineUniformLocation", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetSubroutineUniformLocation");
+	return ret;
+}
+PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_debug_glGetSubroutineUniformLocation = glad_debug_impl_glGetSubroutineUniformLocation;
+static void APIENTRY glad_debug_impl_glGetSynciv(GLsync arg0, GLenum arg1, GLsizei arg2, GLsizei * arg3, GLint * arg4) {
+	glad_glGetSynciv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetSynciv", "peipp", (const void*)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3, (const void*)arg4);
+	gl_debug_check_error("glGetSynciv");
+}
+PFNGLGETSYNCIVPROC glad_debug_glGetSynciv = glad_debug_impl_glGetSynciv;
+static void APIENTRY glad_debug_impl_glGetTexEnvfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	glad_glGetTexEnvfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTexEnvfv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetTexEnvfv");
+}
+PFNGLGETTEXENVFVPROC glad_debug_glGetTexEnvfv = glad_debug_impl_glGetTexEnvfv;
+static void APIENTRY glad_debug_impl_glGetTexEnviv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetTexEnviv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTexEnviv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetTexEnviv");
+}
+PFNGLGETTEXENVIVPROC glad_debug_glGetTexEnviv = glad_debug_impl_glGetTexEnviv;
+static void APIENTRY glad_debug_impl_glGetTexGendv(GLenum arg0, GLenum arg1, GLdouble * arg2) {
+	glad_glGetTexGendv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTexGendv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetTexGendv");
+}
+PFNGLGETTEXGENDVPROC glad_debug_glGetTexGendv = glad_debug_impl_glGetTexGendv;
+static void APIENTRY glad_debug_impl_glGetTexGenfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	glad_glGetTexGenfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTexGenfv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetTexGenfv");
+}
+PFNGLGETTEXGENFVPROC glad_debug_glGetTexGenfv = glad_debug_impl_glGetTexGenfv;
+static void APIENTRY glad_debug_impl_glGetTexGeniv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetTexGeniv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTexGeniv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetTexGeniv");
+}
+PFNGLGETTEXGENIVPROC glad_debug_glGetTexGeniv = glad_debug_impl_glGetTexGeniv;
+static void APIENTRY glad_debug_impl_glGetTexImage(GLenum arg0, GLint arg1, GLenum arg2, GLenum arg3, void * arg4) {
+	glad_glGetTexImage(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTexImage", "eieep", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (unsigned int)arg3, (const void*)arg4);
+	gl_debug_check_error("glGetTexImage");
+}
+PFNGLGETTEXIMAGEPROC glad_debug_glGetTexImage = glad_debug_impl_glGetTexImage;
+static void APIENTRY glad_debug_impl_glGetTexLevelParameterfv(GLenum arg0, GLint arg1, GLenum arg2, GLfloat * arg3) {
+	glad_glGetTexLevelParameterfv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTexLevelParameterfv", "eiep", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetTexLevelParameterfv");
+}
+PFNGLGETTEXLEVELPARAMETERFVPROC glad_debug_glGetTexLevelParameterfv = glad_debug_impl_glGetTexLevelParameterfv;
+static void APIENTRY glad_debug_impl_glGetTexLevelParameteriv(GLenum arg0, GLint arg1, GLenum arg2, GLint * arg3) {
+	glad_glGetTexLevelParameteriv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTexLevelParameteriv", "eiep", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetTexLevelParameteriv");
+}
+PFNGLGETTEXLEVELPARAMETERIVPROC glad_debug_glGetTexLevelParameteriv = glad_debug_impl_glGetTexLevelParameteriv;
+static void APIENTRY glad_debug_impl_glGetTexParameterIiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetTexParameterIiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTexParameterIiv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetTexParameterIiv");
+}
+PFNGLGETTEXPARAMETERIIVPROC glad_debug_glGetTexParameterIiv = glad_debug_impl_glGetTexParameterIiv;
+static void APIENTRY glad_debug_impl_glGetTexParameterIuiv(GLenum arg0, GLenum arg1, GLuint * arg2) {
+	glad_glGetTexParameterIuiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTexParameterIuiv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetTexParameterIuiv");
+}
+PFNGLGETTEXPARAMETERIUIVPROC glad_debug_glGetTexParameterIuiv = glad_debug_impl_glGetTexParameterIuiv;
+static void APIENTRY glad_debug_impl_glGetTexParameterfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	glad_glGetTexParameterfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTexParameterfv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetTexParameterfv");
+}
+PFNGLGETTEXPARAMETERFVPROC glad_debug_glGetTexParameterfv = glad_debug_impl_glGetTexParameterfv;
+static void APIENTRY glad_debug_impl_glGetTexParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetTexParameteriv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTexParameteriv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetTexParameteriv");
+}
+PFNGLGETTEXPARAMETERIVPROC glad_debug_glGetTexParameteriv = glad_debug_impl_glGetTexParameteriv;
+static GLuint64 APIENTRY glad_debug_impl_glGetTextureHandleARB(GLuint arg0) {
+	GLuint64 ret;
+	ret = glad_glGetTextureHandleARB(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTextureHandleARB", "u", (unsigned int)arg0);
+	gl_debug_check_error("glGetTextureHandleARB");
+	return ret;
+}
+PFNGLGETTEXTUREHANDLEARBPROC glad_debug_glGetTextureHandleARB = glad_debug_impl_glGetTextureHandleARB;
+static void APIENTRY glad_debug_impl_glGetTextureImage(GLuint arg0, GLint arg1, GLenum arg2, GLenum arg3, GLsizei arg4, void * arg5) {
+	glad_glGetTextureImage(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTextureImage", "uieeip", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (unsigned int)arg3, (int)arg4, (const void*)arg5);
+	gl_debug_check_error("glGetTextureImage");
+}
+PFNGLGETTEXTUREIMAGEPROC glad_debug_glGetTextureImage = glad_debug_impl_glGetTextureImage;
+static void APIENTRY glad_debug_impl_glGetTextureLevelParameterfv(GLuint arg0, GLint arg1, GLenum arg2, GLfloat * arg3) {
+	glad_glGetTextureLevelParameterfv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTextureLevelParameterfv", "uiep", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetTextureLevelParameterfv");
+}
+PFNGLGETTEXTURELEVELPARAMETERFVPROC glad_debug_glGetTextureLevelParameterfv = glad_debug_impl_glGetTextureLevelParameterfv;
+static void APIENTRY glad_debug_impl_glGetTextureLevelParameteriv(GLuint arg0, GLint arg1, GLenum arg2, GLint * arg3) {
+	glad_glGetTextureLevelParameteriv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTextureLevelParameteriv", "uiep", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetTextureLevelParameteriv");
+}
+PFNGLGETTEXTURELEVELPARAMETERIVPROC glad_debug_glGetTextureLevelParameteriv = glad_debug_impl_glGetTextureLevelParameteriv;
+static void APIENTRY glad_debug_impl_glGetTextureParameterIiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetTextureParameterIiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTextureParameterIiv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetTextureParameterIiv");
+}
+PFNGLGETTEXTUREPARAMETERIIVPROC glad_debug_glGetTextureParameterIiv = glad_debug_impl_glGetTextureParameterIiv;
+static void APIENTRY glad_debug_impl_glGetTextureParameterIuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+	glad_glGetTextureParameterIuiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTextureParameterIuiv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetTextureParameterIuiv");
+}
+PFNGLGETTEXTUREPARAMETERIUIVPROC glad_debug_glGetTextureParameterIuiv = glad_debug_impl_glGetTextureParameterIuiv;
+static void APIENTRY glad_debug_impl_glGetTextureParameterfv(GLuint arg0, GLenum arg1, GLfloat * arg2) {
+	glad_glGetTextureParameterfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTextureParameterfv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetTextureParameterfv");
+}
+PFNGLGETTEXTUREPARAMETERFVPROC glad_debug_glGetTextureParameterfv = glad_debug_impl_glGetTextureParameterfv;
+static void APIENTRY glad_debug_impl_glGetTextureParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetTextureParameteriv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTextureParameteriv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetTextureParameteriv");
+}
+PFNGLGETTEXTUREPARAMETERIVPROC glad_debug_glGetTextureParameteriv = glad_debug_impl_glGetTextureParameteriv;
+static GLuint64 APIENTRY glad_debug_impl_glGetTextureSamplerHandleARB(GLuint arg0, GLuint arg1) {
+	GLuint64 ret;
+	ret = glad_glGetTextureSamplerHandleARB(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTextureSamplerHandleARB", "uu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glGetTextureSamplerHandleARB");
+	return ret;
+}
+PFNGLGETTEXTURESAMPLERHANDLEARBPROC glad_debug_glGetTextureSamplerHandleARB = glad_debug_impl_glGetTextureSamplerHandleARB;
+static void APIENTRY glad_debug_impl_glGetTextureSubImage(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLenum arg9, GLsizei arg10, void * arg11) {
+	glad_glGetTextureSubImage(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTextureSubImage", "uiiiiiiieeip", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6, (int)arg7, (unsigned int)arg8, (unsigned int)arg9, (int)arg10, (const void*)arg11);
+	gl_debug_check_error("glGetTextureSubImage");
+}
+PFNGLGETTEXTURESUBIMAGEPROC glad_debug_glGetTextureSubImage = glad_debug_impl_glGetTextureSubImage;
+static void APIENTRY glad_debug_impl_glGetTransformFeedbackVarying(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLsizei * arg4, GLenum * arg5, GLchar * arg6) {
+	glad_glGetTransformFeedbackVarying(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTransformFeedbackVarying", "uuipppp", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3, (const void*)arg4, (const void*)arg5, (const void*)arg6);
+	gl_debug_check_error("glGetTransformFeedbackVarying");
+}
+PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_debug_glGetTransformFeedbackVarying = glad_debug_impl_glGetTransformFeedbackVarying;
+static void APIENTRY glad_debug_impl_glGetTransformFeedbacki64_v(GLuint arg0, GLenum arg1, GLuint arg2, GLint64 * arg3) {
+	glad_glGetTransformFeedbacki64_v(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTransformFeedbacki64_v", "ueup", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetTransformFeedbacki64_v");
+}
+PFNGLGETTRANSFORMFEEDBACKI64_VPROC glad_debug_glGetTransformFeedbacki64_v = glad_debug_impl_glGetTransformFeedbacki64_v;
+static void APIENTRY glad_debug_impl_glGetTransformFeedbacki_v(GLuint arg0, GLenum arg1, GLuint arg2, GLint * arg3) {
+	glad_glGetTransformFeedbacki_v(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTransformFeedbacki_v", "ueup", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetTransformFeedbacki_v");
+}
+PFNGLGETTRANSFORMFEEDBACKI_VPROC glad_debug_glGetTransformFeedbacki_v = glad_debug_impl_glGetTransformFeedbacki_v;
+static void APIENTRY glad_debug_impl_glGetTransformFeedbackiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetTransformFeedbackiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetTransformFeedbackiv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetTransformFeedbackiv");
+}
+PFNGLGETTRANSFORMFEEDBACKIVPROC glad_debug_glGetTransformFeedbackiv = glad_debug_impl_glGetTransformFeedbackiv;
+static GLuint APIENTRY glad_debug_impl_glGetUniformBlockIndex(GLuint arg0, const GLchar * arg1) {
+	GLuint ret;
+	ret = glad_glGetUniformBlockIndex(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetUniformBlockIndex", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGetUniformBlockIndex");
+	return ret;
+}
+PFNGLGETUNIFORMBLOCKINDEXPROC glad_debug_glGetUniformBlockIndex = glad_debug_impl_glGetUniformBlockIndex;
+static void APIENTRY glad_debug_impl_glGetUniformIndices(GLuint arg0, GLsizei arg1, const GLchar *const * arg2, GLuint * arg3) {
+	glad_glGetUniformIndices(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetUniformIndices", "uipp", (unsigned int)arg0, (int)arg1, (const void*)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetUniformIndices");
+}
+PFNGLGETUNIFORMINDICESPROC glad_debug_glGetUniformIndices = glad_debug_impl_glGetUniformIndices;
+static GLint APIENTRY glad_debug_impl_glGetUniformLocation(GLuint arg0, const GLchar * arg1) {
+	GLint ret;
+	ret = glad_glGetUniformLocation(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetUniformLocation", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGetUniformLocation");
+	return ret;
+}
+PFNGLGETUNIFORMLOCATIONPROC glad_debug_glGetUniformLocation = glad_debug_impl_glGetUniformLocation;
+static void APIENTRY glad_debug_impl_glGetUniformSubroutineuiv(GLenum arg0, GLint arg1, GLuint * arg2) {
+	glad_glGetUniformSubroutineuiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetUniformSubroutineuiv", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetUniformSubroutineuiv");
+}
+PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_debug_glGetUniformSubroutineuiv = glad_debug_impl_glGetUniformSubroutineuiv;
+static void APIENTRY glad_debug_impl_glGetUniformdv(GLuint arg0, GLint arg1, GLdouble * arg2) {
+	glad_glGetUniformdv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetUniformdv", "uip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetUniformdv");
+}
+PFNGLGETUNIFORMDVPROC glad_debug_glGetUniformdv = glad_debug_impl_glGetUniformdv;
+static void APIENTRY glad_debug_impl_glGetUniformfv(GLuint arg0, GLint arg1, GLfloat * arg2) {
+	glad_glGetUniformfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetUniformfv", "uip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetUniformfv");
+}
+PFNGLGETUNIFORMFVPROC glad_debug_glGetUniformfv = glad_debug_impl_glGetUniformfv;
+static void APIENTRY glad_debug_impl_glGetUniformiv(GLuint arg0, GLint arg1, GLint * arg2) {
+	glad_glGetUniformiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetUniformiv", "uip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetUniformiv");
+}
+PFNGLGETUNIFORMIVPROC glad_debug_glGetUniformiv = glad_debug_impl_glGetUniformiv;
+static void APIENTRY glad_debug_impl_glGetUniformuiv(GLuint arg0, GLint arg1, GLuint * arg2) {
+	glad_glGetUniformuiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetUniformuiv", "uip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetUniformuiv");
+}
+PFNGLGETUNIFORMUIVPROC glad_debug_glGetUniformuiv = glad_debug_impl_glGetUniformuiv;
+static void APIENTRY glad_debug_impl_glGetVertexArrayIndexed64iv(GLuint arg0, GLuint arg1, GLenum arg2, GLint64 * arg3) {
+	glad_glGetVertexArrayIndexed64iv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetVertexArrayIndexed64iv", "uuep", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetVertexArrayIndexed64iv");
+}
+PFNGLGETVERTEXARRAYINDEXED64IVPROC glad_debug_glGetVertexArrayIndexed64iv = glad_debug_impl_glGetVertexArrayIndexed64iv;
+static void APIENTRY glad_debug_impl_glGetVertexArrayIndexediv(GLuint arg0, GLuint arg1, GLenum arg2, GLint * arg3) {
+	glad_glGetVertexArrayIndexediv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetVertexArrayIndexediv", "uuep", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetVertexArrayIndexediv");
+}
+PFNGLGETVERTEXARRAYINDEXEDIVPROC glad_debug_glGetVertexArrayIndexediv = glad_debug_impl_glGetVertexArrayIndexediv;
+static void APIENTRY glad_debug_impl_glGetVertexArrayiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetVertexArrayiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetVertexArrayiv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetVertexArrayiv");
+}
+PFNGLGETVERTEXARRAYIVPROC glad_debug_glGetVertexArrayiv = glad_debug_impl_glGetVertexArrayiv;
+static void APIENTRY glad_debug_impl_glGetVertexAttribIiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetVertexAttribIiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetVertexAttribIiv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetVertexAttribIiv");
+}
+PFNGLGETVERTEXATTRIBIIVPROC glad_debug_glGetVertexAttribIiv = glad_debug_impl_glGetVertexAttribIiv;
+static void APIENTRY glad_debug_impl_glGetVertexAttribIuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+	glad_glGetVertexAttribIuiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetVertexAttribIuiv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetVertexAttribIuiv");
+}
+PFNGLGETVERTEXATTRIBIUIVPROC glad_debug_glGetVertexAttribIuiv = glad_debug_impl_glGetVertexAttribIuiv;
+static void APIENTRY glad_debug_impl_glGetVertexAttribLdv(GLuint arg0, GLenum arg1, GLdouble * arg2) {
+	glad_glGetVertexAttribLdv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetVertexAttribLdv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetVertexAttribLdv");
+}
+PFNGLGETVERTEXATTRIBLDVPROC glad_debug_glGetVertexAttribLdv = glad_debug_impl_glGetVertexAttribLdv;
+static void APIENTRY glad_debug_impl_glGetVertexAttribLui64vARB(GLuint arg0, GLenum arg1, GLuint64EXT * arg2) {
+	glad_glGetVertexAttribLui64vARB(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetVertexAttribLui64vARB", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetVertexAttribLui64vARB");
+}
+PFNGLGETVERTEXATTRIBLUI64VARBPROC glad_debug_glGetVertexAttribLui64vARB = glad_debug_impl_glGetVertexAttribLui64vARB;
+static void APIENTRY glad_debug_impl_glGetVertexAttribPointerv(GLuint arg0, GLenum arg1, void * * arg2) {
+	glad_glGetVertexAttribPointerv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetVertexAttribPointerv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetVertexAttribPointerv");
+}
+PFNGLGETVERTEXATTRIBPOINTERVPROC glad_debug_glGetVertexAttribPointerv = glad_debug_impl_glGetVertexAttribPointerv;
+static void APIENTRY glad_debug_impl_glGetVertexAttribdv(GLuint arg0, GLenum arg1, GLdouble * arg2) {
+	glad_glGetVertexAttribdv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetVertexAttribdv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetVertexAttribdv");
+}
+PFNGLGETVERTEXATTRIBDVPROC glad_debug_glGetVertexAttribdv = glad_debug_impl_glGetVertexAttribdv;
+static void APIENTRY glad_debug_impl_glGetVertexAttribfv(GLuint arg0, GLenum arg1, GLfloat * arg2) {
+	glad_glGetVertexAttribfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetVertexAttribfv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetVertexAttribfv");
+}
+PFNGLGETVERTEXATTRIBFVPROC glad_debug_glGetVertexAttribfv = glad_debug_impl_glGetVertexAttribfv;
+static void APIENTRY glad_debug_impl_glGetVertexAttribiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	glad_glGetVertexAttribiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetVertexAttribiv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetVertexAttribiv");
+}
+PFNGLGETVERTEXATTRIBIVPROC glad_debug_glGetVertexAttribiv = glad_debug_impl_glGetVertexAttribiv;
+static void APIENTRY glad_debug_impl_glGetnColorTable(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, void * arg4) {
+	glad_glGetnColorTable(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetnColorTable", "eeeip", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glGetnColorTable");
+}
+PFNGLGETNCOLORTABLEPROC glad_debug_glGetnColorTable = glad_debug_impl_glGetnColorTable;
+static void APIENTRY glad_debug_impl_glGetnCompressedTexImage(GLenum arg0, GLint arg1, GLsizei arg2, void * arg3) {
+	glad_glGetnCompressedTexImage(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetnCompressedTexImage", "eiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetnCompressedTexImage");
+}
+PFNGLGETNCOMPRESSEDTEXIMAGEPROC glad_debug_glGetnCompressedTexImage = glad_debug_impl_glGetnCompressedTexImage;
+static void APIENTRY glad_debug_impl_glGetnConvolutionFilter(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, void * arg4) {
+	glad_glGetnConvolutionFilter(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetnConvolutionFilter", "eeeip", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glGetnConvolutionFilter");
+}
+PFNGLGETNCONVOLUTIONFILTERPROC glad_debug_glGetnConvolutionFilter = glad_debug_impl_glGetnConvolutionFilter;
+static void APIENTRY glad_debug_impl_glGetnHistogram(GLenum arg0, GLboolean arg1, GLenum arg2, GLenum arg3, GLsizei arg4, void * arg5) {
+	glad_glGetnHistogram(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetnHistogram", "ebeeip", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (unsigned int)arg3, (int)arg4, (const void*)arg5);
+	gl_debug_check_error("glGetnHistogram");
+}
+PFNGLGETNHISTOGRAMPROC glad_debug_glGetnHistogram = glad_debug_impl_glGetnHistogram;
+static void APIENTRY glad_debug_impl_glGetnMapdv(GLenum arg0, GLenum arg1, GLsizei arg2, GLdouble * arg3) {
+	glad_glGetnMapdv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetnMapdv", "eeip", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetnMapdv");
+}
+PFNGLGETNMAPDVPROC glad_debug_glGetnMapdv = glad_debug_impl_glGetnMapdv;
+static void APIENTRY glad_debug_impl_glGetnMapfv(GLenum arg0, GLenum arg1, GLsizei arg2, GLfloat * arg3) {
+	glad_glGetnMapfv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetnMapfv", "eeip", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetnMapfv");
+}
+PFNGLGETNMAPFVPROC glad_debug_glGetnMapfv = glad_debug_impl_glGetnMapfv;
+static void APIENTRY glad_debug_impl_glGetnMapiv(GLenum arg0, GLenum arg1, GLsizei arg2, GLint * arg3) {
+	glad_glGetnMapiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetnMapiv", "eeip", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetnMapiv");
+}
+PFNGLGETNMAPIVPROC glad_debug_glGetnMapiv = glad_debug_impl_glGetnMapiv;
+static void APIENTRY glad_debug_impl_glGetnMinmax(GLenum arg0, GLboolean arg1, GLenum arg2, GLenum arg3, GLsizei arg4, void * arg5) {
+	glad_glGetnMinmax(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetnMinmax", "ebeeip", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (unsigned int)arg3, (int)arg4, (const void*)arg5);
+	gl_debug_check_error("glGetnMinmax");
+}
+PFNGLGETNMINMAXPROC glad_debug_glGetnMinmax = glad_debug_impl_glGetnMinmax;
+static void APIENTRY glad_debug_impl_glGetnPixelMapfv(GLenum arg0, GLsizei arg1, GLfloat * arg2) {
+	glad_glGetnPixelMapfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetnPixelMapfv", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetnPixelMapfv");
+}
+PFNGLGETNPIXELMAPFVPROC glad_debug_glGetnPixelMapfv = glad_debug_impl_glGetnPixelMapfv;
+static void APIENTRY glad_debug_impl_glGetnPixelMapuiv(GLenum arg0, GLsizei arg1, GLuint * arg2) {
+	glad_glGetnPixelMapuiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetnPixelMapuiv", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetnPixelMapuiv");
+}
+PFNGLGETNPIXELMAPUIVPROC glad_debug_glGetnPixelMapuiv = glad_debug_impl_glGetnPixelMapuiv;
+static void APIENTRY glad_debug_impl_glGetnPixelMapusv(GLenum arg0, GLsizei arg1, GLushort * arg2) {
+	glad_glGetnPixelMapusv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetnPixelMapusv", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glGetnPixelMapusv");
+}
+PFNGLGETNPIXELMAPUSVPROC glad_debug_glGetnPixelMapusv = glad_debug_impl_glGetnPixelMapusv;
+static void APIENTRY glad_debug_impl_glGetnPolygonStipple(GLsizei arg0, GLubyte * arg1) {
+	glad_glGetnPolygonStipple(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetnPolygonStipple", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glGetnPolygonStipple");
+}
+PFNGLGETNPOLYGONSTIPPLEPROC glad_debug_glGetnPolygonStipple = glad_debug_impl_glGetnPolygonStipple;
+static void APIENTRY glad_debug_impl_glGetnSeparableFilter(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, void * arg4, GLsizei arg5, void * arg6, void * arg7) {
+	glad_glGetnSeparableFilter(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetnSeparableFilter", "eeeipipp", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (int)arg3, (const void*)arg4, (int)arg5, (const void*)arg6, (const void*)arg7);
+	gl_debug_check_error("glGetnSeparableFilter");
+}
+PFNGLGETNSEPARABLEFILTERPROC glad_debug_glGetnSeparableFilter = glad_debug_impl_glGetnSeparableFilter;
+static void APIENTRY glad_debug_impl_glGetnTexImage(GLenum arg0, GLint arg1, GLenum arg2, GLenum arg3, GLsizei arg4, void * arg5) {
+	glad_glGetnTexImage(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetnTexImage", "eieeip", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (unsigned int)arg3, (int)arg4, (const void*)arg5);
+	gl_debug_check_error("glGetnTexImage");
+}
+PFNGLGETNTEXIMAGEPROC glad_debug_glGetnTexImage = glad_debug_impl_glGetnTexImage;
+static void APIENTRY glad_debug_impl_glGetnUniformdv(GLuint arg0, GLint arg1, GLsizei arg2, GLdouble * arg3) {
+	glad_glGetnUniformdv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetnUniformdv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetnUniformdv");
+}
+PFNGLGETNUNIFORMDVPROC glad_debug_glGetnUniformdv = glad_debug_impl_glGetnUniformdv;
+static void APIENTRY glad_debug_impl_glGetnUniformfv(GLuint arg0, GLint arg1, GLsizei arg2, GLfloat * arg3) {
+	glad_glGetnUniformfv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetnUniformfv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetnUniformfv");
+}
+PFNGLGETNUNIFORMFVPROC glad_debug_glGetnUniformfv = glad_debug_impl_glGetnUniformfv;
+static void APIENTRY glad_debug_impl_glGetnUniformiv(GLuint arg0, GLint arg1, GLsizei arg2, GLint * arg3) {
+	glad_glGetnUniformiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetnUniformiv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetnUniformiv");
+}
+PFNGLGETNUNIFORMIVPROC glad_debug_glGetnUniformiv = glad_debug_impl_glGetnUniformiv;
+static void APIENTRY glad_debug_impl_glGetnUniformuiv(GLuint arg0, GLint arg1, GLsizei arg2, GLuint * arg3) {
+	glad_glGetnUniformuiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glGetnUniformuiv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glGetnUniformuiv");
+}
+PFNGLGETNUNIFORMUIVPROC glad_debug_glGetnUniformuiv = glad_debug_impl_glGetnUniformuiv;
+static void APIENTRY glad_debug_impl_glHint(GLenum arg0, GLenum arg1) {
+	glad_glHint(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glHint", "ee", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glHint");
+}
+PFNGLHINTPROC glad_debug_glHint = glad_debug_impl_glHint;
+static void APIENTRY glad_debug_impl_glIndexMask(GLuint arg0) {
+	glad_glIndexMask(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIndexMask", "u", (unsigned int)arg0);
+	gl_debug_check_error("glIndexMask");
+}
+PFNGLINDEXMASKPROC glad_debug_glIndexMask = glad_debug_impl_glIndexMask;
+static void APIENTRY glad_debug_impl_glIndexPointer(GLenum arg0, GLsizei arg1, const void * arg2) {
+	glad_glIndexPointer(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glIndexPointer", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glIndexPointer");
+}
+PFNGLINDEXPOINTERPROC glad_debug_glIndexPointer = glad_debug_impl_glIndexPointer;
+static void APIENTRY glad_debug_impl_glIndexd(GLdouble arg0) {
+	glad_glIndexd(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIndexd", "f", (double)arg0);
+	gl_debug_check_error("glIndexd");
+}
+PFNGLINDEXDPROC glad_debug_glIndexd = glad_debug_impl_glIndexd;
+static void APIENTRY glad_debug_impl_glIndexdv(const GLdouble * arg0) {
+	glad_glIndexdv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIndexdv", "p", (const void*)arg0);
+	gl_debug_check_error("glIndexdv");
+}
+PFNGLINDEXDVPROC glad_debug_glIndexdv = glad_debug_impl_glIndexdv;
+static void APIENTRY glad_debug_impl_glIndexf(GLfloat arg0) {
+	glad_glIndexf(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIndexf", "f", (double)arg0);
+	gl_debug_check_error("glIndexf");
+}
+PFNGLINDEXFPROC glad_debug_glIndexf = glad_debug_impl_glIndexf;
+static void APIENTRY glad_debug_impl_glIndexfv(const GLfloat * arg0) {
+	glad_glIndexfv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIndexfv", "p", (const void*)arg0);
+	gl_debug_check_error("glIndexfv");
+}
+PFNGLINDEXFVPROC glad_debug_glIndexfv = glad_debug_impl_glIndexfv;
+static void APIENTRY glad_debug_impl_glIndexi(GLint arg0) {
+	glad_glIndexi(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIndexi", "i", (int)arg0);
+	gl_debug_check_error("glIndexi");
+}
+PFNGLINDEXIPROC glad_debug_glIndexi = glad_debug_impl_glIndexi;
+static void APIENTRY glad_debug_impl_glIndexiv(const GLint * arg0) {
+	glad_glIndexiv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIndexiv", "p", (const void*)arg0);
+	gl_debug_check_error("glIndexiv");
+}
+PFNGLINDEXIVPROC glad_debug_glIndexiv = glad_debug_impl_glIndexiv;
+static void APIENTRY glad_debug_impl_glIndexs(GLshort arg0) {
+	glad_glIndexs(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIndexs", "i", (int)arg0);
+	gl_debug_check_error("glIndexs");
+}
+PFNGLINDEXSPROC glad_debug_glIndexs = glad_debug_impl_glIndexs;
+static void APIENTRY glad_debug_impl_glIndexsv(const GLshort * arg0) {
+	glad_glIndexsv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIndexsv", "p", (const void*)arg0);
+	gl_debug_check_error("glIndexsv");
+}
+PFNGLINDEXSVPROC glad_debug_glIndexsv = glad_debug_impl_glIndexsv;
+static void APIENTRY glad_debug_impl_glIndexub(GLubyte arg0) {
+	glad_glIndexub(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIndexub", "i", (int)arg0);
+	gl_debug_check_error("glIndexub");
+}
+PFNGLINDEXUBPROC glad_debug_glIndexub = glad_debug_impl_glIndexub;
+static void APIENTRY glad_debug_impl_glIndexubv(const GLubyte * arg0) {
+	glad_glIndexubv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIndexubv", "p", (const void*)arg0);
+	gl_debug_check_error("glIndexubv");
+}
+PFNGLINDEXUBVPROC glad_debug_glIndexubv = glad_debug_impl_glIndexubv;
+static void APIENTRY glad_debug_impl_glInitNames(void) {
+	glad_glInitNames();
+	if (gl_debug_tracing) gl_debug_trace_call("glInitNames", "");
+	gl_debug_check_error("glInitNames");
+}
+PFNGLINITNAMESPROC glad_debug_glInitNames = glad_debug_impl_glInitNames;
+static void APIENTRY glad_debug_impl_glInterleavedArrays(GLenum arg0, GLsizei arg1, const void * arg2) {
+	glad_glInterleavedArrays(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glInterleavedArrays", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glInterleavedArrays");
+}
+PFNGLINTERLEAVEDARRAYSPROC glad_debug_glInterleavedArrays = glad_debug_impl_glInterleavedArrays;
+static void APIENTRY glad_debug_impl_glInvalidateBufferData(GLuint arg0) {
+	glad_glInvalidateBufferData(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glInvalidateBufferData", "u", (unsigned int)arg0);
+	gl_debug_check_error("glInvalidateBufferData");
+}
+PFNGLINVALIDATEBUFFERDATAPROC glad_debug_glInvalidateBufferData = glad_debug_impl_glInvalidateBufferData;
+static void APIENTRY glad_debug_impl_glInvalidateBufferSubData(GLuint arg0, GLintptr arg1, GLsizeiptr arg2) {
+	glad_glInvalidateBufferSubData(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glInvalidateBufferSubData", "ull", (unsigned int)arg0, (long long)arg1, (long long)arg2);
+	gl_debug_check_error("glInvalidateBufferSubData");
+}
+PFNGLINVALIDATEBUFFERSUBDATAPROC glad_debug_glInvalidateBufferSubData = glad_debug_impl_glInvalidateBufferSubData;
+static void APIENTRY glad_debug_impl_glInvalidateFramebuffer(GLenum arg0, GLsizei arg1, const GLenum * arg2) {
+	glad_glInvalidateFramebuffer(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glInvalidateFramebuffer", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glInvalidateFramebuffer");
+}
+PFNGLINVALIDATEFRAMEBUFFERPROC glad_debug_glInvalidateFramebuffer = glad_debug_impl_glInvalidateFramebuffer;
+static void APIENTRY glad_debug_impl_glInvalidateNamedFramebufferData(GLuint arg0, GLsizei arg1, const GLenum * arg2) {
+	glad_glInvalidateNamedFramebufferData(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glInvalidateNamedFramebufferData", "uip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glInvalidateNamedFramebufferData");
+}
+PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_debug_glInvalidateNamedFramebufferData = glad_debug_impl_glInvalidateNamedFramebufferData;
+static void APIENTRY glad_debug_impl_glInvalidateNamedFramebufferSubData(GLuint arg0, GLsizei arg1, const GLenum * arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6) {
+	glad_glInvalidateNamedFramebufferSubData(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glInvalidateNamedFramebufferSubData", "uipiiii", (unsigned int)arg0, (int)arg1, (const void*)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6);
+	gl_debug_check_error("glInvalidateNamedFramebufferSubData");
+}
+PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_debug_glInvalidateNamedFramebufferSubData = glad_debug_impl_glInvalidateNamedFramebufferSubData;
+static void APIENTRY glad_debug_impl_glInvalidateSubFramebuffer(GLenum arg0, GLsizei arg1, const GLenum * arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6) {
+	glad_glInvalidateSubFramebuffer(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glInvalidateSubFramebuffer", "eipiiii", (unsigned int)arg0, (int)arg1, (const void*)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6);
+	gl_debug_check_error("glInvalidateSubFramebuffer");
+}
+PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_debug_glInvalidateSubFramebuffer = glad_debug_impl_glInvalidateSubFramebuffer;
+static void APIENTRY glad_debug_impl_glInvalidateTexImage(GLuint arg0, GLint arg1) {
+	glad_glInvalidateTexImage(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glInvalidateTexImage", "ui", (unsigned int)arg0, (int)arg1);
+	gl_debug_check_error("glInvalidateTexImage");
+}
+PFNGLINVALIDATETEXIMAGEPROC glad_debug_glInvalidateTexImage = glad_debug_impl_glInvalidateTexImage;
+static void APIENTRY glad_debug_impl_glInvalidateTexSubImage(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7) {
+	glad_glInvalidateTexSubImage(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+	if (gl_debug_tracing) gl_debug_trace_call("glInvalidateTexSubImage", "uiiiiiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6, (int)arg7);
+	gl_debug_check_error("glInvalidateTexSubImage");
+}
+PFNGLINVALIDATETEXSUBIMAGEPROC glad_debug_glInvalidateTexSubImage = glad_debug_impl_glInvalidateTexSubImage;
+static GLboolean APIENTRY glad_debug_impl_glIsBuffer(GLuint arg0) {
+	GLboolean ret;
+	ret = glad_glIsBuffer(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIsBuffer", "u", (unsigned int)arg0);
+	gl_debug_check_error("glIsBuffer");
+	return ret;
+}
+PFNGLISBUFFERPROC glad_debug_glIsBuffer = glad_debug_impl_glIsBuffer;
+static GLboolean APIENTRY glad_debug_impl_glIsEnabled(GLenum arg0) {
+	GLboolean ret;
+	ret = glad_glIsEnabled(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIsEnabled", "e", (unsigned int)arg0);
+	gl_debug_check_error("glIsEnabled");
+	return ret;
+}
+PFNGLISENABLEDPROC glad_debug_glIsEnabled = glad_debug_impl_glIsEnabled;
+static GLboolean APIENTRY glad_debug_impl_glIsEnabledi(GLenum arg0, GLuint arg1) {
+	GLboolean ret;
+	ret = glad_glIsEnabledi(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glIsEnabledi", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glIsEnabledi");
+	return ret;
+}
+PFNGLISENABLEDIPROC glad_debug_glIsEnabledi = glad_debug_impl_glIsEnabledi;
+static GLboolean APIENTRY glad_debug_impl_glIsFramebuffer(GLuint arg0) {
+	GLboolean ret;
+	ret = glad_glIsFramebuffer(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIsFramebuffer", "u", (unsigned int)arg0);
+	gl_debug_check_error("glIsFramebuffer");
+	return ret;
+}
+PFNGLISFRAMEBUFFERPROC glad_debug_glIsFramebuffer = glad_debug_impl_glIsFramebuffer;
+static GLboolean APIENTRY glad_debug_impl_glIsImageHandleResidentARB(GLuint64 arg0) {
+	GLboolean ret;
+	ret = glad_glIsImageHandleResidentARB(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIsImageHandleResidentARB", "L", (unsigned long long)arg0);
+	gl_debug_check_error("glIsImageHandleResidentARB");
+	return ret;
+}
+PFNGLISIMAGEHANDLERESIDENTARBPROC glad_debug_glIsImageHandleResidentARB = glad_debug_impl_glIsImageHandleResidentARB;
+static GLboolean APIENTRY glad_debug_impl_glIsList(GLuint arg0) {
+	GLboolean ret;
+	ret = glad_glIsList(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIsList", "u", (unsigned int)arg0);
+	gl_debug_check_error("glIsList");
+	return ret;
+}
+PFNGLISLISTPROC glad_debug_glIsList = glad_debug_impl_glIsList;
+static GLboolean APIENTRY glad_debug_impl_glIsProgram(GLuint arg0) {
+	GLboolean ret;
+	ret = glad_glIsProgram(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIsProgram", "u", (unsigned int)arg0);
+	gl_debug_check_error("glIsProgram");
+	return ret;
+}
+PFNGLISPROGRAMPROC glad_debug_glIsProgram = glad_debug_impl_glIsProgram;
+static GLboolean APIENTRY glad_debug_impl_glIsProgramPipeline(GLuint arg0) {
+	GLboolean ret;
+	ret = glad_glIsProgramPipeline(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIsProgramPipeline", "u", (unsigned int)arg0);
+	gl_debug_check_error("glIsProgramPipeline");
+	return ret;
+}
+PFNGLISPROGRAMPIPELINEPROC glad_debug_glIsProgramPipeline = glad_debug_impl_glIsProgramPipeline;
+static GLboolean APIENTRY glad_debug_impl_glIsQuery(GLuint arg0) {
+	GLboolean ret;
+	ret = glad_glIsQuery(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIsQuery", "u", (unsigned int)arg0);
+	gl_debug_check_error("glIsQuery");
+	return ret;
+}
+PFNGLISQUERYPROC glad_debug_glIsQuery = glad_debug_impl_glIsQuery;
+static GLboolean APIENTRY glad_debug_impl_glIsRenderbuffer(GLuint arg0) {
+	GLboolean ret;
+	ret = glad_glIsRenderbuffer(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIsRenderbuffer", "u", (unsigned int)arg0);
+	gl_debug_check_error("glIsRenderbuffer");
+	return ret;
+}
+PFNGLISRENDERBUFFERPROC glad_debug_glIsRenderbuffer = glad_debug_impl_glIsRenderbuffer;
+static GLboolean APIENTRY glad_debug_impl_glIsSampler(GLuint arg0) {
+	GLboolean ret;
+	ret = glad_glIsSampler(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIsSampler", "u", (unsigned int)arg0);
+	gl_debug_check_error("glIsSampler");
+	return ret;
+}
+PFNGLISSAMPLERPROC glad_debug_glIsSampler = glad_debug_impl_glIsSampler;
+static GLboolean APIENTRY glad_debug_impl_glIsShader(GLuint arg0) {
+	GLboolean ret;
+	ret = glad_glIsShader(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIsShader", "u", (unsigned int)arg0);
+	gl_debug_check_error("glIsShader");
+	return ret;
+}
+PFNGLISSHADERPROC glad_debug_glIsShader = glad_debug_impl_glIsShader;
+static GLboolean APIENTRY glad_debug_impl_glIsSync(GLsync arg0) {
+	GLboolean ret;
+	ret = glad_glIsSync(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIsSync", "p", (const void*)arg0);
+	gl_debug_check_error("glIsSync");
+	return ret;
+}
+PFNGLISSYNCPROC glad_debug_glIsSync = glad_debug_impl_glIsSync;
+static GLboolean APIENTRY glad_debug_impl_glIsTexture(GLuint arg0) {
+	GLboolean ret;
+	ret = glad_glIsTexture(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIsTexture", "u", (unsigned int)arg0);
+	gl_debug_check_error("glIsTexture");
+	return ret;
+}
+PFNGLISTEXTUREPROC glad_debug_glIsTexture = glad_debug_impl_glIsTexture;
+static GLboolean APIENTRY glad_debug_impl_glIsTextureHandleResidentARB(GLuint64 arg0) {
+	GLboolean ret;
+	ret = glad_glIsTextureHandleResidentARB(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIsTextureHandleResidentARB", "L", (unsigned long long)arg0);
+	gl_debug_check_error("glIsTextureHandleResidentARB");
+	return ret;
+}
+PFNGLISTEXTUREHANDLERESIDENTARBPROC glad_debug_glIsTextureHandleResidentARB = glad_debug_impl_glIsTextureHandleResidentARB;
+static GLboolean APIENTRY glad_debug_impl_glIsTransformFeedback(GLuint arg0) {
+	GLboolean ret;
+	ret = glad_glIsTransformFeedback(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIsTransformFeedback", "u", (unsigned int)arg0);
+	gl_debug_check_error("glIsTransformFeedback");
+	return ret;
+}
+PFNGLISTRANSFORMFEEDBACKPROC glad_debug_glIsTransformFeedback = glad_debug_impl_glIsTransformFeedback;
+static GLboolean APIENTRY glad_debug_impl_glIsVertexArray(GLuint arg0) {
+	GLboolean ret;
+	ret = glad_glIsVertexArray(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glIsVertexArray", "u", (unsigned int)arg0);
+	gl_debug_check_error("glIsVertexArray");
+	return ret;
+}
+PFNGLISVERTEXARRAYPROC glad_debug_glIsVertexArray = glad_debug_impl_glIsVertexArray;
+static void APIENTRY glad_debug_impl_glLightModelf(GLenum arg0, GLfloat arg1) {
+	glad_glLightModelf(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glLightModelf", "ef", (unsigned int)arg0, (double)arg1);
+	gl_debug_check_error("glLightModelf");
+}
+PFNGLLIGHTMODELFPROC glad_debug_glLightModelf = glad_debug_impl_glLightModelf;
+static void APIENTRY glad_debug_impl_glLightModelfv(GLenum arg0, const GLfloat * arg1) {
+	glad_glLightModelfv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glLightModelfv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glLightModelfv");
+}
+PFNGLLIGHTMODELFVPROC glad_debug_glLightModelfv = glad_debug_impl_glLightModelfv;
+static void APIENTRY glad_debug_impl_glLightModeli(GLenum arg0, GLint arg1) {
+	glad_glLightModeli(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glLightModeli", "ei", (unsigned int)arg0, (int)arg1);
+	gl_debug_check_error("glLightModeli");
+}
+PFNGLLIGHTMODELIPROC glad_debug_glLightModeli = glad_debug_impl_glLightModeli;
+static void APIENTRY glad_debug_impl_glLightModeliv(GLenum arg0, const GLint * arg1) {
+	glad_glLightModeliv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glLightModeliv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glLightModeliv");
+}
+PFNGLLIGHTMODELIVPROC glad_debug_glLightModeliv = glad_debug_impl_glLightModeliv;
+static void APIENTRY glad_debug_impl_glLightf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	glad_glLightf(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glLightf", "eef", (unsigned int)arg0, (unsigned int)arg1, (double)arg2);
+	gl_debug_check_error("glLightf");
+}
+PFNGLLIGHTFPROC glad_debug_glLightf = glad_debug_impl_glLightf;
+static void APIENTRY glad_debug_impl_glLightfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	glad_glLightfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glLightfv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glLightfv");
+}
+PFNGLLIGHTFVPROC glad_debug_glLightfv = glad_debug_impl_glLightfv;
+static void APIENTRY glad_debug_impl_glLighti(GLenum arg0, GLenum arg1, GLint arg2) {
+	glad_glLighti(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glLighti", "eei", (unsigned int)arg0, (unsigned int)arg1, (int)arg2);
+	gl_debug_check_error("glLighti");
+}
+PFNGLLIGHTIPROC glad_debug_glLighti = glad_debug_impl_glLighti;
+static void APIENTRY glad_debug_impl_glLightiv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	glad_glLightiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glLightiv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glLightiv");
+}
+PFNGLLIGHTIVPROC glad_debug_glLightiv = glad_debug_impl_glLightiv;
+static void APIENTRY glad_debug_impl_glLineStipple(GLint arg0, GLushort arg1) {
+	glad_glLineStipple(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glLineStipple", "ii", (int)arg0, (int)arg1);
+	gl_debug_check_error("glLineStipple");
+}
+PFNGLLINESTIPPLEPROC glad_debug_glLineStipple = glad_debug_impl_glLineStipple;
+static void APIENTRY glad_debug_impl_glLineWidth(GLfloat arg0) {
+	glad_glLineWidth(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glLineWidth", "f", (double)arg0);
+	gl_debug_check_error("glLineWidth");
+}
+PFNGLLINEWIDTHPROC glad_debug_glLineWidth = glad_debug_impl_glLineWidth;
+static void APIENTRY glad_debug_impl_glLinkProgram(GLuint arg0) {
+	glad_glLinkProgram(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glLinkProgram", "u", (unsigned int)arg0);
+	gl_debug_check_error("glLinkProgram");
+}
+PFNGLLINKPROGRAMPROC glad_debug_glLinkProgram = glad_debug_impl_glLinkProgram;
+static void APIENTRY glad_debug_impl_glListBase(GLuint arg0) {
+	glad_glListBase(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glListBase", "u", (unsigned int)arg0);
+	gl_debug_check_error("glListBase");
+}
+PFNGLLISTBASEPROC glad_debug_glListBase = glad_debug_impl_glListBase;
+static void APIENTRY glad_debug_impl_glLoadIdentity(void) {
+	glad_glLoadIdentity();
+	if (gl_debug_tracing) gl_debug_trace_call("glLoadIdentity", "");
+	gl_debug_check_error("glLoadIdentity");
+}
+PFNGLLOADIDENTITYPROC glad_debug_glLoadIdentity = glad_debug_impl_glLoadIdentity;
+static void APIENTRY glad_debug_impl_glLoadMatrixd(const GLdouble * arg0) {
+	glad_glLoadMatrixd(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glLoadMatrixd", "p", (const void*)arg0);
+	gl_debug_check_error("glLoadMatrixd");
+}
+PFNGLLOADMATRIXDPROC glad_debug_glLoadMatrixd = glad_debug_impl_glLoadMatrixd;
+static void APIENTRY glad_debug_impl_glLoadMatrixf(const GLfloat * arg0) {
+	glad_glLoadMatrixf(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glLoadMatrixf", "p", (const void*)arg0);
+	gl_debug_check_error("glLoadMatrixf");
+}
+PFNGLLOADMATRIXFPROC glad_debug_glLoadMatrixf = glad_debug_impl_glLoadMatrixf;
+static void APIENTRY glad_debug_impl_glLoadName(GLuint arg0) {
+	glad_glLoadName(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glLoadName", "u", (unsigned int)arg0);
+	gl_debug_check_error("glLoadName");
+}
+PFNGLLOADNAMEPROC glad_debug_glLoadName = glad_debug_impl_glLoadName;
+static void APIENTRY glad_debug_impl_glLoadTransposeMatrixd(const GLdouble * arg0) {
+	glad_glLoadTransposeMatrixd(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glLoadTransposeMatrixd", "p", (const void*)arg0);
+	gl_debug_check_error("glLoadTransposeMatrixd");
+}
+PFNGLLOADTRANSPOSEMATRIXDPROC glad_debug_glLoadTransposeMatrixd = glad_debug_impl_glLoadTransposeMatrixd;
+static void APIENTRY glad_debug_impl_glLoadTransposeMatrixf(const GLfloat * arg0) {
+	glad_glLoadTransposeMatrixf(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glLoadTransposeMatrixf", "p", (const void*)arg0);
+	gl_debug_check_error("glLoadTransposeMatrixf");
+}
+PFNGLLOADTRANSPOSEMATRIXFPROC glad_debug_glLoadTransposeMatrixf = glad_debug_impl_glLoadTransposeMatrixf;
+static void APIENTRY glad_debug_impl_glLogicOp(GLenum arg0) {
+	glad_glLogicOp(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glLogicOp", "e", (unsigned int)arg0);
+	gl_debug_check_error("glLogicOp");
+}
+PFNGLLOGICOPPROC glad_debug_glLogicOp = glad_debug_impl_glLogicOp;
+static void APIENTRY glad_debug_impl_glMakeImageHandleNonResidentARB(GLuint64 arg0) {
+	glad_glMakeImageHandleNonResidentARB(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glMakeImageHandleNonResidentARB", "L", (unsigned long long)arg0);
+	gl_debug_check_error("glMakeImageHandleNonResidentARB");
+}
+PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC glad_debug_glMakeImageHandleNonResidentARB = glad_debug_impl_glMakeImageHandleNonResidentARB;
+static void APIENTRY glad_debug_impl_glMakeImageHandleResidentARB(GLuint64 arg0, GLenum arg1) {
+	glad_glMakeImageHandleResidentARB(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMakeImageHandleResidentARB", "Le", (unsigned long long)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glMakeImageHandleResidentARB");
+}
+PFNGLMAKEIMAGEHANDLERESIDENTARBPROC glad_debug_glMakeImageHandleResidentARB = glad_debug_impl_glMakeImageHandleResidentARB;
+static void APIENTRY glad_debug_impl_glMakeTextureHandleNonResidentARB(GLuint64 arg0) {
+	glad_glMakeTextureHandleNonResidentARB(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glMakeTextureHandleNonResidentARB", "L", (unsigned long long)arg0);
+	gl_debug_check_error("glMakeTextureHandleNonResidentARB");
+}
+PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC glad_debug_glMakeTextureHandleNonResidentARB = glad_debug_impl_glMakeTextureHandleNonResidentARB;
+static void APIENTRY glad_debug_impl_glMakeTextureHandleResidentARB(GLuint64 arg0) {
+	glad_glMakeTextureHandleResidentARB(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glMakeTextureHandleResidentARB", "L", (unsigned long long)arg0);
+	gl_debug_check_error("glMakeTextureHandleResidentARB");
+}
+PFNGLMAKETEXTUREHANDLERESIDENTARBPROC glad_debug_glMakeTextureHandleResidentARB = glad_debug_impl_glMakeTextureHandleResidentARB;
+static void APIENTRY glad_debug_impl_glMap1d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLint arg3, GLint arg4, const GLdouble * arg5) {
+	glad_glMap1d(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glMap1d", "effiip", (unsigned int)arg0, (double)arg1, (double)arg2, (int)arg3, (int)arg4, (const void*)arg5);
+	gl_debug_check_error("glMap1d");
+}
+PFNGLMAP1DPROC glad_debug_glMap1d = glad_debug_impl_glMap1d;
+static void APIENTRY glad_debug_impl_glMap1f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLint arg3, GLint arg4, const GLfloat * arg5) {
+	glad_glMap1f(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glMap1f", "effiip", (unsigned int)arg0, (double)arg1, (double)arg2, (int)arg3, (int)arg4, (const void*)arg5);
+	gl_debug_check_error("glMap1f");
+}
+PFNGLMAP1FPROC glad_debug_glMap1f = glad_debug_impl_glMap1f;
+static void APIENTRY glad_debug_impl_glMap2d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLint arg3, GLint arg4, GLdouble arg5, GLdouble arg6, GLint arg7, GLint arg8, const GLdouble * arg9) {
+	glad_glMap2d(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+	if (gl_debug_tracing) gl_debug_trace_call("glMap2d", "effiiffiip", (unsigned int)arg0, (double)arg1, (double)arg2, (int)arg3, (int)arg4, (double)arg5, (double)arg6, (int)arg7, (int)arg8, (const void*)arg9);
+	gl_debug_check_error("glMap2d");
+}
+PFNGLMAP2DPROC glad_debug_glMap2d = glad_debug_impl_glMap2d;
+static void APIENTRY glad_debug_impl_glMap2f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLint arg3, GLint arg4, GLfloat arg5, GLfloat arg6, GLint arg7, GLint arg8, const GLfloat * arg9) {
+	glad_glMap2f(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+	if (gl_debug_tracing) gl_debug_trace_call("glMap2f", "effiiffiip", (unsigned int)arg0, (double)arg1, (double)arg2, (int)arg3, (int)arg4, (double)arg5, (double)arg6, (int)arg7, (int)arg8, (const void*)arg9);
+	gl_debug_check_error("glMap2f");
+}
+PFNGLMAP2FPROC glad_debug_glMap2f = glad_debug_impl_glMap2f;
+static void * APIENTRY glad_debug_impl_glMapBuffer(GLenum arg0, GLenum arg1) {
+	void * ret;
+	ret = glad_glMapBuffer(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMapBuffer", "ee", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glMapBuffer");
+	return ret;
+}
+PFNGLMAPBUFFERPROC glad_debug_glMapBuffer = glad_debug_impl_glMapBuffer;
+static void * APIENTRY glad_debug_impl_glMapBufferRange(GLenum arg0, GLintptr arg1, GLsizeiptr arg2, GLbitfield arg3) {
+	void * ret;
+	ret = glad_glMapBufferRange(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glMapBufferRange", "ellu", (unsigned int)arg0, (long long)arg1, (long long)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glMapBufferRange");
+	return ret;
+}
+PFNGLMAPBUFFERRANGEPROC glad_debug_glMapBufferRange = glad_debug_impl_glMapBufferRange;
+static void APIENTRY glad_debug_impl_glMapGrid1d(GLint arg0, GLdouble arg1, GLdouble arg2) {
+	glad_glMapGrid1d(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glMapGrid1d", "iff", (int)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glMapGrid1d");
+}
+PFNGLMAPGRID1DPROC glad_debug_glMapGrid1d = glad_debug_impl_glMapGrid1d;
+static void APIENTRY glad_debug_impl_glMapGrid1f(GLint arg0, GLfloat arg1, GLfloat arg2) {
+	glad_glMapGrid1f(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glMapGrid1f", "iff", (int)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glMapGrid1f");
+}
+PFNGLMAPGRID1FPROC glad_debug_glMapGrid1f = glad_debug_impl_glMapGrid1f;
+static void APIENTRY glad_debug_impl_glMapGrid2d(GLint arg0, GLdouble arg1, GLdouble arg2, GLint arg3, GLdouble arg4, GLdouble arg5) {
+	glad_glMapGrid2d(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glMapGrid2d", "iffiff", (int)arg0, (double)arg1, (double)arg2, (int)arg3, (double)arg4, (double)arg5);
+	gl_debug_check_error("glMapGrid2d");
+}
+PFNGLMAPGRID2DPROC glad_debug_glMapGrid2d = glad_debug_impl_glMapGrid2d;
+static void APIENTRY glad_debug_impl_glMapGrid2f(GLint arg0, GLfloat arg1, GLfloat arg2, GLint arg3, GLfloat arg4, GLfloat arg5) {
+	glad_glMapGrid2f(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glMapGrid2f", "iffiff", (int)arg0, (double)arg1, (double)arg2, (int)arg3, (double)arg4, (double)arg5);
+	gl_debug_check_error("glMapGrid2f");
+}
+PFNGLMAPGRID2FPROC glad_debug_glMapGrid2f = glad_debug_impl_glMapGrid2f;
+static void * APIENTRY glad_debug_impl_glMapNamedBuffer(GLuint arg0, GLenum arg1) {
+	void * ret;
+	ret = glad_glMapNamedBuffer(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMapNamedBuffer", "ue", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glMapNamedBuffer");
+	return ret;
+}
+PFNGLMAPNAMEDBUFFERPROC glad_debug_glMapNamedBuffer = glad_debug_impl_glMapNamedBuffer;
+static void * APIENTRY glad_debug_impl_glMapNamedBufferRange(GLuint arg0, GLintptr arg1, GLsizeiptr arg2, GLbitfield arg3) {
+	void * ret;
+	ret = glad_glMapNamedBufferRange(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glMapNamedBufferRange", "ullu", (unsigned int)arg0, (long long)arg1, (long long)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glMapNamedBufferRange");
+	return ret;
+}
+PFNGLMAPNAMEDBUFFERRANGEPROC glad_debug_glMapNamedBufferRange = glad_debug_impl_glMapNamedBufferRange;
+static void APIENTRY glad_debug_impl_glMaterialf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	glad_glMaterialf(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glMaterialf", "eef", (unsigned int)arg0, (unsigned int)arg1, (double)arg2);
+	gl_debug_check_error("glMaterialf");
+}
+PFNGLMATERIALFPROC glad_debug_glMaterialf = glad_debug_impl_glMaterialf;
+static void APIENTRY glad_debug_impl_glMaterialfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	glad_glMaterialfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glMaterialfv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glMaterialfv");
+}
+PFNGLMATERIALFVPROC glad_debug_glMaterialfv = glad_debug_impl_glMaterialfv;
+static void APIENTRY glad_debug_impl_glMateriali(GLenum arg0, GLenum arg1, GLint arg2) {
+	glad_glMateriali(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glMateriali", "eei", (unsigned int)arg0, (unsigned int)arg1, (int)arg2);
+	gl_debug_check_error("glMateriali");
+}
+PFNGLMATERIALIPROC glad_debug_glMateriali = glad_debug_impl_glMateriali;
+static void APIENTRY glad_debug_impl_glMaterialiv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	glad_glMaterialiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glMaterialiv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glMaterialiv");
+}
+PFNGLMATERIALIVPROC glad_debug_glMaterialiv = glad_debug_impl_glMaterialiv;
+static void APIENTRY glad_debug_impl_glMatrixMode(GLenum arg0) {
+	glad_glMatrixMode(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glMatrixMode", "e", (unsigned int)arg0);
+	gl_debug_check_error("glMatrixMode");
+}
+PFNGLMATRIXMODEPROC glad_debug_glMatrixMode = glad_debug_impl_glMatrixMode;
+static void APIENTRY glad_debug_impl_glMaxShaderCompilerThreadsKHR(GLuint arg0) {
+	glad_glMaxShaderCompilerThreadsKHR(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glMaxShaderCompilerThreadsKHR", "u", (unsigned int)arg0);
+	gl_debug_check_error("glMaxShaderCompilerThreadsKHR");
+}
+PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_debug_glMaxShaderCompilerThreadsKHR = glad_debug_impl_glMaxShaderCompilerThreadsKHR;
+static void APIENTRY glad_debug_impl_glMemoryBarrier(GLbitfield arg0) {
+	glad_glMemoryBarrier(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glMemoryBarrier", "u", (unsigned int)arg0);
+	gl_debug_check_error("glMemoryBarrier");
+}
+PFNGLMEMORYBARRIERPROC glad_debug_glMemoryBarrier = glad_debug_impl_glMemoryBarrier;
+static void APIENTRY glad_debug_impl_glMemoryBarrierByRegion(GLbitfield arg0) {
+	glad_glMemoryBarrierByRegion(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glMemoryBarrierByRegion", "u", (unsigned int)arg0);
+	gl_debug_check_error("glMemoryBarrierByRegion");
+}
+PFNGLMEMORYBARRIERBYREGIONPROC glad_debug_glMemoryBarrierByRegion = glad_debug_impl_glMemoryBarrierByRegion;
+static void APIENTRY glad_debug_impl_glMinSampleShading(GLfloat arg0) {
+	glad_glMinSampleShading(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glMinSampleShading", "f", (double)arg0);
+	gl_debug_check_error("glMinSampleShading");
+}
+PFNGLMINSAMPLESHADINGPROC glad_debug_glMinSampleShading = glad_debug_impl_glMinSampleShading;
+static void APIENTRY glad_debug_impl_glMultMatrixd(const GLdouble * arg0) {
+	glad_glMultMatrixd(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultMatrixd", "p", (const void*)arg0);
+	gl_debug_check_error("glMultMatrixd");
+}
+PFNGLMULTMATRIXDPROC glad_debug_glMultMatrixd = glad_debug_impl_glMultMatrixd;
+static void APIENTRY glad_debug_impl_glMultMatrixf(const GLfloat * arg0) {
+	glad_glMultMatrixf(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultMatrixf", "p", (const void*)arg0);
+	gl_debug_check_error("glMultMatrixf");
+}
+PFNGLMULTMATRIXFPROC glad_debug_glMultMatrixf = glad_debug_impl_glMultMatrixf;
+static void APIENTRY glad_debug_impl_glMultTransposeMatrixd(const GLdouble * arg0) {
+	glad_glMultTransposeMatrixd(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultTransposeMatrixd", "p", (const void*)arg0);
+	gl_debug_check_error("glMultTransposeMatrixd");
+}
+PFNGLMULTTRANSPOSEMATRIXDPROC glad_debug_glMultTransposeMatrixd = glad_debug_impl_glMultTransposeMatrixd;
+static void APIENTRY glad_debug_impl_glMultTransposeMatrixf(const GLfloat * arg0) {
+	glad_glMultTransposeMatrixf(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultTransposeMatrixf", "p", (const void*)arg0);
+	gl_debug_check_error("glMultTransposeMatrixf");
+}
+PFNGLMULTTRANSPOSEMATRIXFPROC glad_debug_glMultTransposeMatrixf = glad_debug_impl_glMultTransposeMatrixf;
+static void APIENTRY glad_debug_impl_glMultiDrawArrays(GLenum arg0, const GLint * arg1, const GLsizei * arg2, GLsizei arg3) {
+	glad_glMultiDrawArrays(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiDrawArrays", "eppi", (unsigned int)arg0, (const void*)arg1, (const void*)arg2, (int)arg3);
+	gl_debug_check_error("glMultiDrawArrays");
+}
+PFNGLMULTIDRAWARRAYSPROC glad_debug_glMultiDrawArrays = glad_debug_impl_glMultiDrawArrays;
+static void APIENTRY glad_debug_impl_glMultiDrawArraysIndirect(GLenum arg0, const void * arg1, GLsizei arg2, GLsizei arg3) {
+	glad_glMultiDrawArraysIndirect(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiDrawArraysIndirect", "epii", (unsigned int)arg0, (const void*)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glMultiDrawArraysIndirect");
+}
+PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_debug_glMultiDrawArraysIndirect = glad_debug_impl_glMultiDrawArraysIndirect;
+static void APIENTRY glad_debug_impl_glMultiDrawArraysIndirectCount(GLenum arg0, const void * arg1, GLintptr arg2, GLsizei arg3, GLsizei arg4) {
+	glad_glMultiDrawArraysIndirectCount(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiDrawArraysIndirectCount", "eplii", (unsigned int)arg0, (const void*)arg1, (long long)arg2, (int)arg3, (int)arg4);
+	gl_debug_check_error("glMultiDrawArraysIndirectCount");
+}
+PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC glad_debug_glMultiDrawArraysIndirectCount = glad_debug_impl_glMultiDrawArraysIndirectCount;
+static void APIENTRY glad_debug_impl_glMultiDrawElements(GLenum arg0, const GLsizei * arg1, GLenum arg2, const void *const * arg3, GLsizei arg4) {
+	glad_glMultiDrawElements(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiDrawElements", "epepi", (unsigned int)arg0, (const void*)arg1, (unsigned int)arg2, (const void*)arg3, (int)arg4);
+	gl_debug_check_error("glMultiDrawElements");
+}
+PFNGLMULTIDRAWELEMENTSPROC glad_debug_glMultiDrawElements = glad_debug_impl_glMultiDrawElements;
+static void APIENTRY glad_debug_impl_glMultiDrawElementsBaseVertex(GLenum arg0, const GLsizei * arg1, GLenum arg2, const void *const * arg3, GLsizei arg4, const GLint * arg5) {
+	glad_glMultiDrawElementsBaseVertex(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiDrawElementsBaseVertex", "epepip", (unsigned int)arg0, (const void*)arg1, (unsigned int)arg2, (const void*)arg3, (int)arg4, (const void*)arg5);
+	gl_debug_check_error("glMultiDrawElementsBaseVertex");
+}
+PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_debug_glMultiDrawElementsBaseVertex = glad_debug_impl_glMultiDrawElementsBaseVertex;
+static void APIENTRY glad_debug_impl_glMultiDrawElementsIndirect(GLenum arg0, GLenum arg1, const void * arg2, GLsizei arg3, GLsizei arg4) {
+	glad_glMultiDrawElementsIndirect(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiDrawElementsIndirect", "eepii", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2, (int)arg3, (int)arg4);
+	gl_debug_check_error("glMultiDrawElementsIndirect");
+}
+PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_debug_glMultiDrawElementsIndirect = glad_debug_impl_glMultiDrawElementsIndirect;
+static void APIENTRY glad_debug_impl_glMultiDrawElementsIndirectCount(GLenum arg0, GLenum arg1, const void * arg2, GLintptr arg3, GLsizei arg4, GLsizei arg5) {
+	glad_glMultiDrawElementsIndirectCount(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiDrawElementsIndirectCount", "eeplii", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2, (long long)arg3, (int)arg4, (int)arg5);
+	gl_debug_check_error("glMultiDrawElementsIndirectCount");
+}
+PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC glad_debug_glMultiDrawElementsIndirectCount = glad_debug_impl_glMultiDrawElementsIndirectCount;
+static void APIENTRY glad_debug_impl_glMultiTexCoord1d(GLenum arg0, GLdouble arg1) {
+	glad_glMultiTexCoord1d(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord1d", "ef", (unsigned int)arg0, (double)arg1);
+	gl_debug_check_error("glMultiTexCoord1d");
+}
+PFNGLMULTITEXCOORD1DPROC glad_debug_glMultiTexCoord1d = glad_debug_impl_glMultiTexCoord1d;
+static void APIENTRY glad_debug_impl_glMultiTexCoord1dv(GLenum arg0, const GLdouble * arg1) {
+	glad_glMultiTexCoord1dv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord1dv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glMultiTexCoord1dv");
+}
+PFNGLMULTITEXCOORD1DVPROC glad_debug_glMultiTexCoord1dv = glad_debug_impl_glMultiTexCoord1dv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord1f(GLenum arg0, GLfloat arg1) {
+	glad_glMultiTexCoord1f(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord1f", "ef", (unsigned int)arg0, (double)arg1);
+	gl_debug_check_error("glMultiTexCoord1f");
+}
+PFNGLMULTITEXCOORD1FPROC glad_debug_glMultiTexCoord1f = glad_debug_impl_glMultiTexCoord1f;
+static void APIENTRY glad_debug_impl_glMultiTexCoord1fv(GLenum arg0, const GLfloat * arg1) {
+	glad_glMultiTexCoord1fv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord1fv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glMultiTexCoord1fv");
+}
+PFNGLMULTITEXCOORD1FVPROC glad_debug_glMultiTexCoord1fv = glad_debug_impl_glMultiTexCoord1fv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord1i(GLenum arg0, GLint arg1) {
+	glad_glMultiTexCoord1i(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord1i", "ei", (unsigned int)arg0, (int)arg1);
+	gl_debug_check_error("glMultiTexCoord1i");
+}
+PFNGLMULTITEXCOORD1IPROC glad_debug_glMultiTexCoord1i = glad_debug_impl_glMultiTexCoord1i;
+static void APIENTRY glad_debug_impl_glMultiTexCoord1iv(GLenum arg0, const GLint * arg1) {
+	glad_glMultiTexCoord1iv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord1iv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glMultiTexCoord1iv");
+}
+PFNGLMULTITEXCOORD1IVPROC glad_debug_glMultiTexCoord1iv = glad_debug_impl_glMultiTexCoord1iv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord1s(GLenum arg0, GLshort arg1) {
+	glad_glMultiTexCoord1s(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord1s", "ei", (unsigned int)arg0, (int)arg1);
+	gl_debug_check_error("glMultiTexCoord1s");
+}
+PFNGLMULTITEXCOORD1SPROC glad_debug_glMultiTexCoord1s = glad_debug_impl_glMultiTexCoord1s;
+static void APIENTRY glad_debug_impl_glMultiTexCoord1sv(GLenum arg0, const GLshort * arg1) {
+	glad_glMultiTexCoord1sv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord1sv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glMultiTexCoord1sv");
+}
+PFNGLMULTITEXCOORD1SVPROC glad_debug_glMultiTexCoord1sv = glad_debug_impl_glMultiTexCoord1sv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord2d(GLenum arg0, GLdouble arg1, GLdouble arg2) {
+	glad_glMultiTexCoord2d(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord2d", "eff", (unsigned int)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glMultiTexCoord2d");
+}
+PFNGLMULTITEXCOORD2DPROC glad_debug_glMultiTexCoord2d = glad_debug_impl_glMultiTexCoord2d;
+static void APIENTRY glad_debug_impl_glMultiTexCoord2dv(GLenum arg0, const GLdouble * arg1) {
+	glad_glMultiTexCoord2dv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord2dv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glMultiTexCoord2dv");
+}
+PFNGLMULTITEXCOORD2DVPROC glad_debug_glMultiTexCoord2dv = glad_debug_impl_glMultiTexCoord2dv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord2f(GLenum arg0, GLfloat arg1, GLfloat arg2) {
+	glad_glMultiTexCoord2f(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord2f", "eff", (unsigned int)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glMultiTexCoord2f");
+}
+PFNGLMULTITEXCOORD2FPROC glad_debug_glMultiTexCoord2f = glad_debug_impl_glMultiTexCoord2f;
+static void APIENTRY glad_debug_impl_glMultiTexCoord2fv(GLenum arg0, const GLfloat * arg1) {
+	glad_glMultiTexCoord2fv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord2fv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glMultiTexCoord2fv");
+}
+PFNGLMULTITEXCOORD2FVPROC glad_debug_glMultiTexCoord2fv = glad_debug_impl_glMultiTexCoord2fv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord2i(GLenum arg0, GLint arg1, GLint arg2) {
+	glad_glMultiTexCoord2i(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord2i", "eii", (unsigned int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glMultiTexCoord2i");
+}
+PFNGLMULTITEXCOORD2IPROC glad_debug_glMultiTexCoord2i = glad_debug_impl_glMultiTexCoord2i;
+static void APIENTRY glad_debug_impl_glMultiTexCoord2iv(GLenum arg0, const GLint * arg1) {
+	glad_glMultiTexCoord2iv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord2iv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glMultiTexCoord2iv");
+}
+PFNGLMULTITEXCOORD2IVPROC glad_debug_glMultiTexCoord2iv = glad_debug_impl_glMultiTexCoord2iv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord2s(GLenum arg0, GLshort arg1, GLshort arg2) {
+	glad_glMultiTexCoord2s(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord2s", "eii", (unsigned int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glMultiTexCoord2s");
+}
+PFNGLMULTITEXCOORD2SPROC glad_debug_glMultiTexCoord2s = glad_debug_impl_glMultiTexCoord2s;
+static void APIENTRY glad_debug_impl_glMultiTexCoord2sv(GLenum arg0, const GLshort * arg1) {
+	glad_glMultiTexCoord2sv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord2sv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glMultiTexCoord2sv");
+}
+PFNGLMULTITEXCOORD2SVPROC glad_debug_glMultiTexCoord2sv = glad_debug_impl_glMultiTexCoord2sv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord3d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	glad_glMultiTexCoord3d(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord3d", "efff", (unsigned int)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glMultiTexCoord3d");
+}
+PFNGLMULTITEXCOORD3DPROC glad_debug_glMultiTexCoord3d = glad_debug_impl_glMultiTexCoord3d;
+static void APIENTRY glad_debug_impl_glMultiTexCoord3dv(GLenum arg0, const GLdouble * arg1) {
+	glad_glMultiTexCoord3dv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord3dv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glMultiTexCoord3dv");
+}
+PFNGLMULTITEXCOORD3DVPROC glad_debug_glMultiTexCoord3dv = glad_debug_impl_glMultiTexCoord3dv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord3f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	glad_glMultiTexCoord3f(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord3f", "efff", (unsigned int)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glMultiTexCoord3f");
+}
+PFNGLMULTITEXCOORD3FPROC glad_debug_glMultiTexCoord3f = glad_debug_impl_glMultiTexCoord3f;
+static void APIENTRY glad_debug_impl_glMultiTexCoord3fv(GLenum arg0, const GLfloat * arg1) {
+	glad_glMultiTexCoord3fv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord3fv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glMultiTexCoord3fv");
+}
+PFNGLMULTITEXCOORD3FVPROC glad_debug_glMultiTexCoord3fv = glad_debug_impl_glMultiTexCoord3fv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord3i(GLenum arg0, GLint arg1, GLint arg2, GLint arg3) {
+	glad_glMultiTexCoord3i(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord3i", "eiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glMultiTexCoord3i");
+}
+PFNGLMULTITEXCOORD3IPROC glad_debug_glMultiTexCoord3i = glad_debug_impl_glMultiTexCoord3i;
+static void APIENTRY glad_debug_impl_glMultiTexCoord3iv(GLenum arg0, const GLint * arg1) {
+	glad_glMultiTexCoord3iv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord3iv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glMultiTexCoord3iv");
+}
+PFNGLMULTITEXCOORD3IVPROC glad_debug_glMultiTexCoord3iv = glad_debug_impl_glMultiTexCoord3iv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord3s(GLenum arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	glad_glMultiTexCoord3s(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord3s", "eiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glMultiTexCoord3s");
+}
+PFNGLMULTITEXCOORD3SPROC glad_debug_glMultiTexCoord3s = glad_debug_impl_glMultiTexCoord3s;
+static void APIENTRY glad_debug_impl_glMultiTexCoord3sv(GLenum arg0, const GLshort * arg1) {
+	glad_glMultiTexCoord3sv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord3sv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glMultiTexCoord3sv");
+}
+PFNGLMULTITEXCOORD3SVPROC glad_debug_glMultiTexCoord3sv = glad_debug_impl_glMultiTexCoord3sv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord4d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	glad_glMultiTexCoord4d(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord4d", "effff", (unsigned int)arg0, (double)arg1, (double)arg2, (double)arg3, (double)arg4);
+	gl_debug_check_error("glMultiTexCoord4d");
+}
+PFNGLMULTITEXCOORD4DPROC glad_debug_glMultiTexCoord4d = glad_debug_impl_glMultiTexCoord4d;
+static void APIENTRY glad_debug_impl_glMultiTexCoord4dv(GLenum arg0, const GLdouble * arg1) {
+	glad_glMultiTexCoord4dv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord4dv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glMultiTexCoord4dv");
+}
+PFNGLMULTITEXCOORD4DVPROC glad_debug_glMultiTexCoord4dv = glad_debug_impl_glMultiTexCoord4dv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord4f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	glad_glMultiTexCoord4f(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord4f", "effff", (unsigned int)arg0, (double)arg1, (double)arg2, (double)arg3, (double)arg4);
+	gl_debug_check_error("glMultiTexCoord4f");
+}
+PFNGLMULTITEXCOORD4FPROC glad_debug_glMultiTexCoord4f = glad_debug_impl_glMultiTexCoord4f;
+static void APIENTRY glad_debug_impl_glMultiTexCoord4fv(GLenum arg0, const GLfloat * arg1) {
+	glad_glMultiTexCoord4fv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord4fv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glMultiTexCoord4fv");
+}
+PFNGLMULTITEXCOORD4FVPROC glad_debug_glMultiTexCoord4fv = glad_debug_impl_glMultiTexCoord4fv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord4i(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	glad_glMultiTexCoord4i(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord4i", "eiiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4);
+	gl_debug_check_error("glMultiTexCoord4i");
+}
+PFNGLMULTITEXCOORD4IPROC glad_debug_glMultiTexCoord4i = glad_debug_impl_glMultiTexCoord4i;
+static void APIENTRY glad_debug_impl_glMultiTexCoord4iv(GLenum arg0, const GLint * arg1) {
+	glad_glMultiTexCoord4iv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord4iv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glMultiTexCoord4iv");
+}
+PFNGLMULTITEXCOORD4IVPROC glad_debug_glMultiTexCoord4iv = glad_debug_impl_glMultiTexCoord4iv;
+static void APIENTRY glad_debug_impl_glMultiTexCoord4s(GLenum arg0, GLshort arg1, GLshort arg2, GLshort arg3, GLshort arg4) {
+	glad_glMultiTexCoord4s(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord4s", "eiiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4);
+	gl_debug_check_error("glMultiTexCoord4s");
+}
+PFNGLMULTITEXCOORD4SPROC glad_debug_glMultiTexCoord4s = glad_debug_impl_glMultiTexCoord4s;
+static void APIENTRY glad_debug_impl_glMultiTexCoord4sv(GLenum arg0, const GLshort * arg1) {
+	glad_glMultiTexCoord4sv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoord4sv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glMultiTexCoord4sv");
+}
+PFNGLMULTITEXCOORD4SVPROC glad_debug_glMultiTexCoord4sv = glad_debug_impl_glMultiTexCoord4sv;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP1ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+	glad_glMultiTexCoordP1ui(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoordP1ui", "eeu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glMultiTexCoordP1ui");
+}
+PFNGLMULTITEXCOORDP1UIPROC glad_debug_glMultiTexCoordP1ui = glad_debug_impl_glMultiTexCoordP1ui;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP1uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	glad_glMultiTexCoordP1uiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoordP1uiv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glMultiTexCoordP1uiv");
+}
+PFNGLMULTITEXCOORDP1UIVPROC glad_debug_glMultiTexCoordP1uiv = glad_debug_impl_glMultiTexCoordP1uiv;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP2ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+	glad_glMultiTexCoordP2ui(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoordP2ui", "eeu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glMultiTexCoordP2ui");
+}
+PFNGLMULTITEXCOORDP2UIPROC glad_debug_glMultiTexCoordP2ui = glad_debug_impl_glMultiTexCoordP2ui;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP2uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	glad_glMultiTexCoordP2uiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoordP2uiv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glMultiTexCoordP2uiv");
+}
+PFNGLMULTITEXCOORDP2UIVPROC glad_debug_glMultiTexCoordP2uiv = glad_debug_impl_glMultiTexCoordP2uiv;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP3ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+	glad_glMultiTexCoordP3ui(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoordP3ui", "eeu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glMultiTexCoordP3ui");
+}
+PFNGLMULTITEXCOORDP3UIPROC glad_debug_glMultiTexCoordP3ui = glad_debug_impl_glMultiTexCoordP3ui;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP3uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	glad_glMultiTexCoordP3uiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoordP3uiv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glMultiTexCoordP3uiv");
+}
+PFNGLMULTITEXCOORDP3UIVPROC glad_debug_glMultiTexCoordP3uiv = glad_debug_impl_glMultiTexCoordP3uiv;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP4ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+	glad_glMultiTexCoordP4ui(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoordP4ui", "eeu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glMultiTexCoordP4ui");
+}
+PFNGLMULTITEXCOORDP4UIPROC glad_debug_glMultiTexCoordP4ui = glad_debug_impl_glMultiTexCoordP4ui;
+static void APIENTRY glad_debug_impl_glMultiTexCoordP4uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	glad_glMultiTexCoordP4uiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glMultiTexCoordP4uiv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glMultiTexCoordP4uiv");
+}
+PFNGLMULTITEXCOORDP4UIVPROC glad_debug_glMultiTexCoordP4uiv = glad_debug_impl_glMultiTexCoordP4uiv;
+static void APIENTRY glad_debug_impl_glNamedBufferData(GLuint arg0, GLsizeiptr arg1, const void * arg2, GLenum arg3) {
+	glad_glNamedBufferData(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glNamedBufferData", "ulpe", (unsigned int)arg0, (long long)arg1, (const void*)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glNamedBufferData");
+}
+PFNGLNAMEDBUFFERDATAPROC glad_debug_glNamedBufferData = glad_debug_impl_glNamedBufferData;
+static void APIENTRY glad_debug_impl_glNamedBufferStorage(GLuint arg0, GLsizeiptr arg1, const void * arg2, GLbitfield arg3) {
+	glad_glNamedBufferStorage(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glNamedBufferStorage", "ulpu", (unsigned int)arg0, (long long)arg1, (const void*)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glNamedBufferStorage");
+}
+PFNGLNAMEDBUFFERSTORAGEPROC glad_debug_glNamedBufferStorage = glad_debug_impl_glNamedBufferStorage;
+static void APIENTRY glad_debug_impl_glNamedBufferStorageEXT(GLuint arg0, GLsizeiptr arg1, const void * arg2, GLbitfield arg3) {
+	glad_glNamedBufferStorageEXT(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glNamedBufferStorageEXT", "ulpu", (unsigned int)arg0, (long long)arg1, (const void*)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glNamedBufferStorageEXT");
+}
+PFNGLNAMEDBUFFERSTORAGEEXTPROC glad_debug_glNamedBufferStorageEXT = glad_debug_impl_glNamedBufferStorageEXT;
+static void APIENTRY glad_debug_impl_glNamedBufferSubData(GLuint arg0, GLintptr arg1, GLsizeiptr arg2, const void * arg3) {
+	glad_glNamedBufferSubData(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glNamedBufferSubData", "ullp", (unsigned int)arg0, (long long)arg1, (long long)arg2, (const void*)arg3);
+	gl_debug_check_error("glNamedBufferSubData");
+}
+PFNGLNAMEDBUFFERSUBDATAPROC glad_debug_glNamedBufferSubData = glad_debug_impl_glNamedBufferSubData;
+static void APIENTRY glad_debug_impl_glNamedFramebufferDrawBuffer(GLuint arg0, GLenum arg1) {
+	glad_glNamedFramebufferDrawBuffer(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glNamedFramebufferDrawBuffer", "ue", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glNamedFramebufferDrawBuffer");
+}
+PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_debug_glNamedFramebufferDrawBuffer = glad_debug_impl_glNamedFramebufferDrawBuffer;
+static void APIENTRY glad_debug_impl_glNamedFramebufferDrawBuffers(GLuint arg0, GLsizei arg1, const GLenum * arg2) {
+	glad_glNamedFramebufferDrawBuffers(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glNamedFramebufferDrawBuffers", "uip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glNamedFramebufferDrawBuffers");
+}
+PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_debug_glNamedFramebufferDrawBuffers = glad_debug_impl_glNamedFramebufferDrawBuffers;
+static void APIENTRY glad_debug_impl_glNamedFramebufferParameteri(GLuint arg0, GLenum arg1, GLint arg2) {
+	glad_glNamedFramebufferParameteri(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glNamedFramebufferParameteri", "uei", (unsigned int)arg0, (unsigned int)arg1, (int)arg2);
+	gl_debug_check_error("glNamedFramebufferParameteri");
+}
+PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_debug_glNamedFramebufferParameteri = glad_debug_impl_glNamedFramebufferParameteri;
+static void APIENTRY glad_debug_impl_glNamedFramebufferReadBuffer(GLuint arg0, GLenum arg1) {
+	glad_glNamedFramebufferReadBuffer(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glNamedFramebufferReadBuffer", "ue", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glNamedFramebufferReadBuffer");
+}
+PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_debug_glNamedFramebufferReadBuffer = glad_debug_impl_glNamedFramebufferReadBuffer;
+static void APIENTRY glad_debug_impl_glNamedFramebufferRenderbuffer(GLuint arg0, GLenum arg1, GLenum arg2, GLuint arg3) {
+	glad_glNamedFramebufferRenderbuffer(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glNamedFramebufferRenderbuffer", "ueeu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glNamedFramebufferRenderbuffer");
+}
+PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_debug_glNamedFramebufferRenderbuffer = glad_debug_impl_glNamedFramebufferRenderbuffer;
+static void APIENTRY glad_debug_impl_glNamedFramebufferTexture(GLuint arg0, GLenum arg1, GLuint arg2, GLint arg3) {
+	glad_glNamedFramebufferTexture(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glNamedFramebufferTexture", "ueui", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (int)arg3);
+	gl_debug_check_error("glNamedFramebufferTexture");
+}
+PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_debug_glNamedFramebufferTexture = glad_debug_impl_glNamedFramebufferTexture;
+static void APIENTRY glad_debug_impl_glNamedFramebufferTextureLayer(GLuint arg0, GLenum arg1, GLuint arg2, GLint arg3, GLint arg4) {
+	glad_glNamedFramebufferTextureLayer(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glNamedFramebufferTextureLayer", "ueuii", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4);
+	gl_debug_check_error("glNamedFramebufferTextureLayer");
+}
+PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_debug_glNamedFramebufferTextureLayer = glad_debug_impl_glNamedFramebufferTextureLayer;
+static void APIENTRY glad_debug_impl_glNamedRenderbufferStorage(GLuint arg0, GLenum arg1, GLsizei arg2, GLsizei arg3) {
+	glad_glNamedRenderbufferStorage(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glNamedRenderbufferStorage", "ueii", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glNamedRenderbufferStorage");
+}
+PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_debug_glNamedRenderbufferStorage = glad_debug_impl_glNamedRenderbufferStorage;
+static void APIENTRY glad_debug_impl_glNamedRenderbufferStorageMultisample(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4) {
+	glad_glNamedRenderbufferStorageMultisample(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glNamedRenderbufferStorageMultisample", "uieii", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4);
+	gl_debug_check_error("glNamedRenderbufferStorageMultisample");
+}
+PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_debug_glNamedRenderbufferStorageMultisample = glad_debug_impl_glNamedRenderbufferStorageMultisample;
+static void APIENTRY glad_debug_impl_glNewList(GLuint arg0, GLenum arg1) {
+	glad_glNewList(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glNewList", "ue", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glNewList");
+}
+PFNGLNEWLISTPROC glad_debug_glNewList = glad_debug_impl_glNewList;
+static void APIENTRY glad_debug_impl_glNormal3b(GLbyte arg0, GLbyte arg1, GLbyte arg2) {
+	glad_glNormal3b(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glNormal3b", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glNormal3b");
+}
+PFNGLNORMAL3BPROC glad_debug_glNormal3b = glad_debug_impl_glNormal3b;
+static void APIENTRY glad_debug_impl_glNormal3bv(const GLbyte * arg0) {
+	glad_glNormal3bv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glNormal3bv", "p", (const void*)arg0);
+	gl_debug_check_error("glNormal3bv");
+}
+PFNGLNORMAL3BVPROC glad_debug_glNormal3bv = glad_debug_impl_glNormal3bv;
+static void APIENTRY glad_debug_impl_glNormal3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	glad_glNormal3d(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glNormal3d", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glNormal3d");
+}
+PFNGLNORMAL3DPROC glad_debug_glNormal3d = glad_debug_impl_glNormal3d;
+static void APIENTRY glad_debug_impl_glNormal3dv(const GLdouble * arg0) {
+	glad_glNormal3dv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glNormal3dv", "p", (const void*)arg0);
+	gl_debug_check_error("glNormal3dv");
+}
+PFNGLNORMAL3DVPROC glad_debug_glNormal3dv = glad_debug_impl_glNormal3dv;
+static void APIENTRY glad_debug_impl_glNormal3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	glad_glNormal3f(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glNormal3f", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glNormal3f");
+}
+PFNGLNORMAL3FPROC glad_debug_glNormal3f = glad_debug_impl_glNormal3f;
+static void APIENTRY glad_debug_impl_glNormal3fv(const GLfloat * arg0) {
+	glad_glNormal3fv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glNormal3fv", "p", (const void*)arg0);
+	gl_debug_check_error("glNormal3fv");
+}
+PFNGLNORMAL3FVPROC glad_debug_glNormal3fv = glad_debug_impl_glNormal3fv;
+static void APIENTRY glad_debug_impl_glNormal3i(GLint arg0, GLint arg1, GLint arg2) {
+	glad_glNormal3i(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glNormal3i", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glNormal3i");
+}
+PFNGLNORMAL3IPROC glad_debug_glNormal3i = glad_debug_impl_glNormal3i;
+static void APIENTRY glad_debug_impl_glNormal3iv(const GLint * arg0) {
+	glad_glNormal3iv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glNormal3iv", "p", (const void*)arg0);
+	gl_debug_check_error("glNormal3iv");
+}
+PFNGLNORMAL3IVPROC glad_debug_glNormal3iv = glad_debug_impl_glNormal3iv;
+static void APIENTRY glad_debug_impl_glNormal3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	glad_glNormal3s(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glNormal3s", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glNormal3s");
+}
+PFNGLNORMAL3SPROC glad_debug_glNormal3s = glad_debug_impl_glNormal3s;
+static void APIENTRY glad_debug_impl_glNormal3sv(const GLshort * arg0) {
+	glad_glNormal3sv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glNormal3sv", "p", (const void*)arg0);
+	gl_debug_check_error("glNormal3sv");
+}
+PFNGLNORMAL3SVPROC glad_debug_glNormal3sv = glad_debug_impl_glNormal3sv;
+static void APIENTRY glad_debug_impl_glNormalP3ui(GLenum arg0, GLuint arg1) {
+	glad_glNormalP3ui(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glNormalP3ui", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glNormalP3ui");
+}
+PFNGLNORMALP3UIPROC glad_debug_glNormalP3ui = glad_debug_impl_glNormalP3ui;
+static void APIENTRY glad_debug_impl_glNormalP3uiv(GLenum arg0, const GLuint * arg1) {
+	glad_glNormalP3uiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glNormalP3uiv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glNormalP3uiv");
+}
+PFNGLNORMALP3UIVPROC glad_debug_glNormalP3uiv = glad_debug_impl_glNormalP3uiv;
+static void APIENTRY glad_debug_impl_glNormalPointer(GLenum arg0, GLsizei arg1, const void * arg2) {
+	glad_glNormalPointer(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glNormalPointer", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glNormalPointer");
+}
+PFNGLNORMALPOINTERPROC glad_debug_glNormalPointer = glad_debug_impl_glNormalPointer;
+static void APIENTRY glad_debug_impl_glObjectLabel(GLenum arg0, GLuint arg1, GLsizei arg2, const GLchar * arg3) {
+	glad_glObjectLabel(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glObjectLabel", "euip", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glObjectLabel");
+}
+PFNGLOBJECTLABELPROC glad_debug_glObjectLabel = glad_debug_impl_glObjectLabel;
+static void APIENTRY glad_debug_impl_glObjectPtrLabel(const void * arg0, GLsizei arg1, const GLchar * arg2) {
+	glad_glObjectPtrLabel(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glObjectPtrLabel", "pip", (const void*)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glObjectPtrLabel");
+}
+PFNGLOBJECTPTRLABELPROC glad_debug_glObjectPtrLabel = glad_debug_impl_glObjectPtrLabel;
+static void APIENTRY glad_debug_impl_glOrtho(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4, GLdouble arg5) {
+	glad_glOrtho(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glOrtho", "ffffff", (double)arg0, (double)arg1, (double)arg2, (double)arg3, (double)arg4, (double)arg5);
+	gl_debug_check_error("glOrtho");
+}
+PFNGLORTHOPROC glad_debug_glOrtho = glad_debug_impl_glOrtho;
+static void APIENTRY glad_debug_impl_glPassThrough(GLfloat arg0) {
+	glad_glPassThrough(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glPassThrough", "f", (double)arg0);
+	gl_debug_check_error("glPassThrough");
+}
+PFNGLPASSTHROUGHPROC glad_debug_glPassThrough = glad_debug_impl_glPassThrough;
+static void APIENTRY glad_debug_impl_glPatchParameterfv(GLenum arg0, const GLfloat * arg1) {
+	glad_glPatchParameterfv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glPatchParameterfv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glPatchParameterfv");
+}
+PFNGLPATCHPARAMETERFVPROC glad_debug_glPatchParameterfv = glad_debug_impl_glPatchParameterfv;
+static void APIENTRY glad_debug_impl_glPatchParameteri(GLenum arg0, GLint arg1) {
+	glad_glPatchParameteri(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glPatchParameteri", "ei", (unsigned int)arg0, (int)arg1);
+	gl_debug_check_error("glPatchParameteri");
+}
+PFNGLPATCHPARAMETERIPROC glad_debug_glPatchParameteri = glad_debug_impl_glPatchParameteri;
+static void APIENTRY glad_debug_impl_glPauseTransformFeedback(void) {
+	glad_glPauseTransformFeedback();
+	if (gl_debug_tracing) gl_debug_trace_call("glPauseTransformFeedback", "");
+	gl_debug_check_error("glPauseTransformFeedback");
+}
+PFNGLPAUSETRANSFORMFEEDBACKPROC glad_debug_glPauseTransformFeedback = glad_debug_impl_glPauseTransformFeedback;
+static void APIENTRY glad_debug_impl_glPixelMapfv(GLenum arg0, GLsizei arg1, const GLfloat * arg2) {
+	glad_glPixelMapfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glPixelMapfv", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glPixelMapfv");
+}
+PFNGLPIXELMAPFVPROC glad_debug_glPixelMapfv = glad_debug_impl_glPixelMapfv;
+static void APIENTRY glad_debug_impl_glPixelMapuiv(GLenum arg0, GLsizei arg1, const GLuint * arg2) {
+	glad_glPixelMapuiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glPixelMapuiv", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glPixelMapuiv");
+}
+PFNGLPIXELMAPUIVPROC glad_debug_glPixelMapuiv = glad_debug_impl_glPixelMapuiv;
+static void APIENTRY glad_debug_impl_glPixelMapusv(GLenum arg0, GLsizei arg1, const GLushort * arg2) {
+	glad_glPixelMapusv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glPixelMapusv", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glPixelMapusv");
+}
+PFNGLPIXELMAPUSVPROC glad_debug_glPixelMapusv = glad_debug_impl_glPixelMapusv;
+static void APIENTRY glad_debug_impl_glPixelStoref(GLenum arg0, GLfloat arg1) {
+	glad_glPixelStoref(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glPixelStoref", "ef", (unsigned int)arg0, (double)arg1);
+	gl_debug_check_error("glPixelStoref");
+}
+PFNGLPIXELSTOREFPROC glad_debug_glPixelStoref = glad_debug_impl_glPixelStoref;
+static void APIENTRY glad_debug_impl_glPixelStorei(GLenum arg0, GLint arg1) {
+	glad_glPixelStorei(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glPixelStorei", "ei", (unsigned int)arg0, (int)arg1);
+	gl_debug_check_error("glPixelStorei");
+}
+PFNGLPIXELSTOREIPROC glad_debug_glPixelStorei = glad_debug_impl_glPixelStorei;
+static void APIENTRY glad_debug_impl_glPixelTransferf(GLenum arg0, GLfloat arg1) {
+	glad_glPixelTransferf(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glPixelTransferf", "ef", (unsigned int)arg0, (double)arg1);
+	gl_debug_check_error("glPixelTransferf");
+}
+PFNGLPIXELTRANSFERFPROC glad_debug_glPixelTransferf = glad_debug_impl_glPixelTransferf;
+static void APIENTRY glad_debug_impl_glPixelTransferi(GLenum arg0, GLint arg1) {
+	glad_glPixelTransferi(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glPixelTransferi", "ei", (unsigned int)arg0, (int)arg1);
+	gl_debug_check_error("glPixelTransferi");
+}
+PFNGLPIXELTRANSFERIPROC glad_debug_glPixelTransferi = glad_debug_impl_glPixelTransferi;
+static void APIENTRY glad_debug_impl_glPixelZoom(GLfloat arg0, GLfloat arg1) {
+	glad_glPixelZoom(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glPixelZoom", "ff", (double)arg0, (double)arg1);
+	gl_debug_check_error("glPixelZoom");
+}
+PFNGLPIXELZOOMPROC glad_debug_glPixelZoom = glad_debug_impl_glPixelZoom;
+static void APIENTRY glad_debug_impl_glPointParameterf(GLenum arg0, GLfloat arg1) {
+	glad_glPointParameterf(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glPointParameterf", "ef", (unsigned int)arg0, (double)arg1);
+	gl_debug_check_error("glPointParameterf");
+}
+PFNGLPOINTPARAMETERFPROC glad_debug_glPointParameterf = glad_debug_impl_glPointParameterf;
+static void APIENTRY glad_debug_impl_glPointParameterfv(GLenum arg0, const GLfloat * arg1) {
+	glad_glPointParameterfv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glPointParameterfv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glPointParameterfv");
+}
+PFNGLPOINTPARAMETERFVPROC glad_debug_glPointParameterfv = glad_debug_impl_glPointParameterfv;
+static void APIENTRY glad_debug_impl_glPointParameteri(GLenum arg0, GLint arg1) {
+	glad_glPointParameteri(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glPointParameteri", "ei", (unsigned int)arg0, (int)arg1);
+	gl_debug_check_error("glPointParameteri");
+}
+PFNGLPOINTPARAMETERIPROC glad_debug_glPointParameteri = glad_debug_impl_glPointParameteri;
+static void APIENTRY glad_debug_impl_glPointParameteriv(GLenum arg0, const GLint * arg1) {
+	glad_glPointParameteriv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glPointParameteriv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glPointParameteriv");
+}
+PFNGLPOINTPARAMETERIVPROC glad_debug_glPointParameteriv = glad_debug_impl_glPointParameteriv;
+static void APIENTRY glad_debug_impl_glPointSize(GLfloat arg0) {
+	glad_glPointSize(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glPointSize", "f", (double)arg0);
+	gl_debug_check_error("glPointSize");
+}
+PFNGLPOINTSIZEPROC glad_debug_glPointSize = glad_debug_impl_glPointSize;
+static void APIENTRY glad_debug_impl_glPolygonMode(GLenum arg0, GLenum arg1) {
+	glad_glPolygonMode(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glPolygonMode", "ee", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glPolygonMode");
+}
+PFNGLPOLYGONMODEPROC glad_debug_glPolygonMode = glad_debug_impl_glPolygonMode;
+static void APIENTRY glad_debug_impl_glPolygonOffset(GLfloat arg0, GLfloat arg1) {
+	glad_glPolygonOffset(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glPolygonOffset", "ff", (double)arg0, (double)arg1);
+	gl_debug_check_error("glPolygonOffset");
+}
+PFNGLPOLYGONOFFSETPROC glad_debug_glPolygonOffset = glad_debug_impl_glPolygonOffset;
+static void APIENTRY glad_debug_impl_glPolygonOffsetClamp(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	glad_glPolygonOffsetClamp(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glPolygonOffsetClamp", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glPolygonOffsetClamp");
+}
+PFNGLPOLYGONOFFSETCLAMPPROC glad_debug_glPolygonOffsetClamp = glad_debug_impl_glPolygonOffsetClamp;
+static void APIENTRY glad_debug_impl_glPolygonStipple(const GLubyte * arg0) {
+	glad_glPolygonStipple(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glPolygonStipple", "p", (const void*)arg0);
+	gl_debug_check_error("glPolygonStipple");
+}
+PFNGLPOLYGONSTIPPLEPROC glad_debug_glPolygonStipple = glad_debug_impl_glPolygonStipple;
+static void APIENTRY glad_debug_impl_glPopAttrib(void) {
+	glad_glPopAttrib();
+	if (gl_debug_tracing) gl_debug_trace_call("glPopAttrib", "");
+	gl_debug_check_error("glPopAttrib");
+}
+PFNGLPOPATTRIBPROC glad_debug_glPopAttrib = glad_debug_impl_glPopAttrib;
+static void APIENTRY glad_debug_impl_glPopClientAttrib(void) {
+	glad_glPopClientAttrib();
+	if (gl_debug_tracing) gl_debug_trace_call("glPopClientAttrib", "");
+	gl_debug_check_error("glPopClientAttrib");
+}
+PFNGLPOPCLIENTATTRIBPROC glad_debug_glPopClientAttrib = glad_debug_impl_glPopClientAttrib;
+static void APIENTRY glad_debug_impl_glPopDebugGroup(void) {
+	glad_glPopDebugGroup();
+	if (gl_debug_tracing) gl_debug_trace_call("glPopDebugGroup", "");
+	gl_debug_check_error("glPopDebugGroup");
+}
+PFNGLPOPDEBUGGROUPPROC glad_debug_glPopDebugGroup = glad_debug_impl_glPopDebugGroup;
+static void APIENTRY glad_debug_impl_glPopMatrix(void) {
+	glad_glPopMatrix();
+	if (gl_debug_tracing) gl_debug_trace_call("glPopMatrix", "");
+	gl_debug_check_error("glPopMatrix");
+}
+PFNGLPOPMATRIXPROC glad_debug_glPopMatrix = glad_debug_impl_glPopMatrix;
+static void APIENTRY glad_debug_impl_glPopName(void) {
+	glad_glPopName();
+	if (gl_debug_tracing) gl_debug_trace_call("glPopName", "");
+	gl_debug_check_error("glPopName");
+}
+PFNGLPOPNAMEPROC glad_debug_glPopName = glad_debug_impl_glPopName;
+static void APIENTRY glad_debug_impl_glPrimitiveRestartIndex(GLuint arg0) {
+	glad_glPrimitiveRestartIndex(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glPrimitiveRestartIndex", "u", (unsigned int)arg0);
+	gl_debug_check_error("glPrimitiveRestartIndex");
+}
+PFNGLPRIMITIVERESTARTINDEXPROC glad_debug_glPrimitiveRestartIndex = glad_debug_impl_glPrimitiveRestartIndex;
+static void APIENTRY glad_debug_impl_glPrioritizeTextures(GLsizei arg0, const GLuint * arg1, const GLclampf * arg2) {
+	glad_glPrioritizeTextures(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glPrioritizeTextures", "ipp", (int)arg0, (const void*)arg1, (const void*)arg2);
+	gl_debug_check_error("glPrioritizeTextures");
+}
+PFNGLPRIORITIZETEXTURESPROC glad_debug_glPrioritizeTextures = glad_debug_impl_glPrioritizeTextures;
+static void APIENTRY glad_debug_impl_glProgramBinary(GLuint arg0, GLenum arg1, const void * arg2, GLsizei arg3) {
+	glad_glProgramBinary(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramBinary", "uepi", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2, (int)arg3);
+	gl_debug_check_error("glProgramBinary");
+}
+PFNGLPROGRAMBINARYPROC glad_debug_glProgramBinary = glad_debug_impl_glProgramBinary;
+static void APIENTRY glad_debug_impl_glProgramParameteri(GLuint arg0, GLenum arg1, GLint arg2) {
+	glad_glProgramParameteri(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramParameteri", "uei", (unsigned int)arg0, (unsigned int)arg1, (int)arg2);
+	gl_debug_check_error("glProgramParameteri");
+}
+PFNGLPROGRAMPARAMETERIPROC glad_debug_glProgramParameteri = glad_debug_impl_glProgramParameteri;
+static void APIENTRY glad_debug_impl_glProgramUniform1d(GLuint arg0, GLint arg1, GLdouble arg2) {
+	glad_glProgramUniform1d(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform1d", "uif", (unsigned int)arg0, (int)arg1, (double)arg2);
+	gl_debug_check_error("glProgramUniform1d");
+}
+PFNGLPROGRAMUNIFORM1DPROC glad_debug_glProgramUniform1d = glad_debug_impl_glProgramUniform1d;
+static void APIENTRY glad_debug_impl_glProgramUniform1dv(GLuint arg0, GLint arg1, GLsizei arg2, const GLdouble * arg3) {
+	glad_glProgramUniform1dv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform1dv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glProgramUniform1dv");
+}
+PFNGLPROGRAMUNIFORM1DVPROC glad_debug_glProgramUniform1dv = glad_debug_impl_glProgramUniform1dv;
+static void APIENTRY glad_debug_impl_glProgramUniform1f(GLuint arg0, GLint arg1, GLfloat arg2) {
+	glad_glProgramUniform1f(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform1f", "uif", (unsigned int)arg0, (int)arg1, (double)arg2);
+	gl_debug_check_error("glProgramUniform1f");
+}
+PFNGLPROGRAMUNIFORM1FPROC glad_debug_glProgramUniform1f = glad_debug_impl_glProgramUniform1f;
+static void APIENTRY glad_debug_impl_glProgramUniform1fv(GLuint arg0, GLint arg1, GLsizei arg2, const GLfloat * arg3) {
+	glad_glProgramUniform1fv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform1fv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glProgramUniform1fv");
+}
+PFNGLPROGRAMUNIFORM1FVPROC glad_debug_glProgramUniform1fv = glad_debug_impl_glProgramUniform1fv;
+static void APIENTRY glad_debug_impl_glProgramUniform1i(GLuint arg0, GLint arg1, GLint arg2) {
+	glad_glProgramUniform1i(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform1i", "uii", (unsigned int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glProgramUniform1i");
+}
+PFNGLPROGRAMUNIFORM1IPROC glad_debug_glProgramUniform1i = glad_debug_impl_glProgramUniform1i;
+static void APIENTRY glad_debug_impl_glProgramUniform1iv(GLuint arg0, GLint arg1, GLsizei arg2, const GLint * arg3) {
+	glad_glProgramUniform1iv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform1iv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glProgramUniform1iv");
+}
+PFNGLPROGRAMUNIFORM1IVPROC glad_debug_glProgramUniform1iv = glad_debug_impl_glProgramUniform1iv;
+static void APIENTRY glad_debug_impl_glProgramUniform1ui(GLuint arg0, GLint arg1, GLuint arg2) {
+	glad_glProgramUniform1ui(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform1ui", "uiu", (unsigned int)arg0, (int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glProgramUniform1ui");
+}
+PFNGLPROGRAMUNIFORM1UIPROC glad_debug_glProgramUniform1ui = glad_debug_impl_glProgramUniform1ui;
+static void APIENTRY glad_debug_impl_glProgramUniform1uiv(GLuint arg0, GLint arg1, GLsizei arg2, const GLuint * arg3) {
+	glad_glProgramUniform1uiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform1uiv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glProgramUniform1uiv");
+}
+PFNGLPROGRAMUNIFORM1UIVPROC glad_debug_glProgramUniform1uiv = glad_debug_impl_glProgramUniform1uiv;
+static void APIENTRY glad_debug_impl_glProgramUniform2d(GLuint arg0, GLint arg1, GLdouble arg2, GLdouble arg3) {
+	glad_glProgramUniform2d(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform2d", "uiff", (unsigned int)arg0, (int)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glProgramUniform2d");
+}
+PFNGLPROGRAMUNIFORM2DPROC glad_debug_glProgramUniform2d = glad_debug_impl_glProgramUniform2d;
+static void APIENTRY glad_debug_impl_glProgramUniform2dv(GLuint arg0, GLint arg1, GLsizei arg2, const GLdouble * arg3) {
+	glad_glProgramUniform2dv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform2dv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glProgramUniform2dv");
+}
+PFNGLPROGRAMUNIFORM2DVPROC glad_debug_glProgramUniform2dv = glad_debug_impl_glProgramUniform2dv;
+static void APIENTRY glad_debug_impl_glProgramUniform2f(GLuint arg0, GLint arg1, GLfloat arg2, GLfloat arg3) {
+	glad_glProgramUniform2f(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform2f", "uiff", (unsigned int)arg0, (int)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glProgramUniform2f");
+}
+PFNGLPROGRAMUNIFORM2FPROC glad_debug_glProgramUniform2f = glad_debug_impl_glProgramUniform2f;
+static void APIENTRY glad_debug_impl_glProgramUniform2fv(GLuint arg0, GLint arg1, GLsizei arg2, const GLfloat * arg3) {
+	glad_glProgramUniform2fv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform2fv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glProgramUniform2fv");
+}
+PFNGLPROGRAMUNIFORM2FVPROC glad_debug_glProgramUniform2fv = glad_debug_impl_glProgramUniform2fv;
+static void APIENTRY glad_debug_impl_glProgramUniform2i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	glad_glProgramUniform2i(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform2i", "uiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glProgramUniform2i");
+}
+PFNGLPROGRAMUNIFORM2IPROC glad_debug_glProgramUniform2i = glad_debug_impl_glProgramUniform2i;
+static void APIENTRY glad_debug_impl_glProgramUniform2iv(GLuint arg0, GLint arg1, GLsizei arg2, const GLint * arg3) {
+	glad_glProgramUniform2iv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform2iv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glProgramUniform2iv");
+}
+PFNGLPROGRAMUNIFORM2IVPROC glad_debug_glProgramUniform2iv = glad_debug_impl_glProgramUniform2iv;
+static void APIENTRY glad_debug_impl_glProgramUniform2ui(GLuint arg0, GLint arg1, GLuint arg2, GLuint arg3) {
+	glad_glProgramUniform2ui(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform2ui", "uiuu", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glProgramUniform2ui");
+}
+PFNGLPROGRAMUNIFORM2UIPROC glad_debug_glProgramUniform2ui = glad_debug_impl_glProgramUniform2ui;
+static void APIENTRY glad_debug_impl_glProgramUniform2uiv(GLuint arg0, GLint arg1, GLsizei arg2, const GLuint * arg3) {
+	glad_glProgramUniform2uiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform2uiv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glProgramUniform2uiv");
+}
+PFNGLPROGRAMUNIFORM2UIVPROC glad_debug_glProgramUniform2uiv = glad_debug_impl_glProgramUniform2uiv;
+static void APIENTRY glad_debug_impl_glProgramUniform3d(GLuint arg0, GLint arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	glad_glProgramUniform3d(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform3d", "uifff", (unsigned int)arg0, (int)arg1, (double)arg2, (double)arg3, (double)arg4);
+	gl_debug_check_error("glProgramUniform3d");
+}
+PFNGLPROGRAMUNIFORM3DPROC glad_debug_glProgramUniform3d = glad_debug_impl_glProgramUniform3d;
+static void APIENTRY glad_debug_impl_glProgramUniform3dv(GLuint arg0, GLint arg1, GLsizei arg2, const GLdouble * arg3) {
+	glad_glProgramUniform3dv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform3dv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glProgramUniform3dv");
+}
+PFNGLPROGRAMUNIFORM3DVPROC glad_debug_glProgramUniform3dv = glad_debug_impl_glProgramUniform3dv;
+static void APIENTRY glad_debug_impl_glProgramUniform3f(GLuint arg0, GLint arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	glad_glProgramUniform3f(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform3f", "uifff", (unsigned int)arg0, (int)arg1, (double)arg2, (double)arg3, (double)arg4);
+	gl_debug_check_error("glProgramUniform3f");
+}
+PFNGLPROGRAMUNIFORM3FPROC glad_debug_glProgramUniform3f = glad_debug_impl_glProgramUniform3f;
+static void APIENTRY glad_debug_impl_glProgramUniform3fv(GLuint arg0, GLint arg1, GLsizei arg2, const GLfloat * arg3) {
+	glad_glProgramUniform3fv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform3fv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glProgramUniform3fv");
+}
+PFNGLPROGRAMUNIFORM3FVPROC glad_debug_glProgramUniform3fv = glad_debug_impl_glProgramUniform3fv;
+static void APIENTRY glad_debug_impl_glProgramUniform3i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	glad_glProgramUniform3i(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform3i", "uiiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4);
+	gl_debug_check_error("glProgramUniform3i");
+}
+PFNGLPROGRAMUNIFORM3IPROC glad_debug_glProgramUniform3i = glad_debug_impl_glProgramUniform3i;
+static void APIENTRY glad_debug_impl_glProgramUniform3iv(GLuint arg0, GLint arg1, GLsizei arg2, const GLint * arg3) {
+	glad_glProgramUniform3iv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform3iv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glProgramUniform3iv");
+}
+PFNGLPROGRAMUNIFORM3IVPROC glad_debug_glProgramUniform3iv = glad_debug_impl_glProgramUniform3iv;
+static void APIENTRY glad_debug_impl_glProgramUniform3ui(GLuint arg0, GLint arg1, GLuint arg2, GLuint arg3, GLuint arg4) {
+	glad_glProgramUniform3ui(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform3ui", "uiuuu", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (unsigned int)arg3, (unsigned int)arg4);
+	gl_debug_check_error("glProgramUniform3ui");
+}
+PFNGLPROGRAMUNIFORM3UIPROC glad_debug_glProgramUniform3ui = glad_debug_impl_glProgramUniform3ui;
+static void APIENTRY glad_debug_impl_glProgramUniform3uiv(GLuint arg0, GLint arg1, GLsizei arg2, const GLuint * arg3) {
+	glad_glProgramUniform3uiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform3uiv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glProgramUniform3uiv");
+}
+PFNGLPROGRAMUNIFORM3UIVPROC glad_debug_glProgramUniform3uiv = glad_debug_impl_glProgramUniform3uiv;
+static void APIENTRY glad_debug_impl_glProgramUniform4d(GLuint arg0, GLint arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4, GLdouble arg5) {
+	glad_glProgramUniform4d(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform4d", "uiffff", (unsigned int)arg0, (int)arg1, (double)arg2, (double)arg3, (double)arg4, (double)arg5);
+	gl_debug_check_error("glProgramUniform4d");
+}
+PFNGLPROGRAMUNIFORM4DPROC glad_debug_glProgramUniform4d = glad_debug_impl_glProgramUniform4d;
+static void APIENTRY glad_debug_impl_glProgramUniform4dv(GLuint arg0, GLint arg1, GLsizei arg2, const GLdouble * arg3) {
+	glad_glProgramUniform4dv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform4dv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glProgramUniform4dv");
+}
+PFNGLPROGRAMUNIFORM4DVPROC glad_debug_glProgramUniform4dv = glad_debug_impl_glProgramUniform4dv;
+static void APIENTRY glad_debug_impl_glProgramUniform4f(GLuint arg0, GLint arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4, GLfloat arg5) {
+	glad_glProgramUniform4f(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform4f", "uiffff", (unsigned int)arg0, (int)arg1, (double)arg2, (double)arg3, (double)arg4, (double)arg5);
+	gl_debug_check_error("glProgramUniform4f");
+}
+PFNGLPROGRAMUNIFORM4FPROC glad_debug_glProgramUniform4f = glad_debug_impl_glProgramUniform4f;
+static void APIENTRY glad_debug_impl_glProgramUniform4fv(GLuint arg0, GLint arg1, GLsizei arg2, const GLfloat * arg3) {
+	glad_glProgramUniform4fv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform4fv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glProgramUniform4fv");
+}
+PFNGLPROGRAMUNIFORM4FVPROC glad_debug_glProgramUniform4fv = glad_debug_impl_glProgramUniform4fv;
+static void APIENTRY glad_debug_impl_glProgramUniform4i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5) {
+	glad_glProgramUniform4i(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform4i", "uiiiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5);
+	gl_debug_check_error("glProgramUniform4i");
+}
+PFNGLPROGRAMUNIFORM4IPROC glad_debug_glProgramUniform4i = glad_debug_impl_glProgramUniform4i;
+static void APIENTRY glad_debug_impl_glProgramUniform4iv(GLuint arg0, GLint arg1, GLsizei arg2, const GLint * arg3) {
+	glad_glProgramUniform4iv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform4iv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glProgramUniform4iv");
+}
+PFNGLPROGRAMUNIFORM4IVPROC glad_debug_glProgramUniform4iv = glad_debug_impl_glProgramUniform4iv;
+static void APIENTRY glad_debug_impl_glProgramUniform4ui(GLuint arg0, GLint arg1, GLuint arg2, GLuint arg3, GLuint arg4, GLuint arg5) {
+	glad_glProgramUniform4ui(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform4ui", "uiuuuu", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (unsigned int)arg3, (unsigned int)arg4, (unsigned int)arg5);
+	gl_debug_check_error("glProgramUniform4ui");
+}
+PFNGLPROGRAMUNIFORM4UIPROC glad_debug_glProgramUniform4ui = glad_debug_impl_glProgramUniform4ui;
+static void APIENTRY glad_debug_impl_glProgramUniform4uiv(GLuint arg0, GLint arg1, GLsizei arg2, const GLuint * arg3) {
+	glad_glProgramUniform4uiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniform4uiv", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glProgramUniform4uiv");
+}
+PFNGLPROGRAMUNIFORM4UIVPROC glad_debug_glProgramUniform4uiv = glad_debug_impl_glProgramUniform4uiv;
+static void APIENTRY glad_debug_impl_glProgramUniformHandleui64ARB(GLuint arg0, GLint arg1, GLuint64 arg2) {
+	glad_glProgramUniformHandleui64ARB(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformHandleui64ARB", "uiL", (unsigned int)arg0, (int)arg1, (unsigned long long)arg2);
+	gl_debug_check_error("glProgramUniformHandleui64ARB");
+}
+PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC glad_debug_glProgramUniformHandleui64ARB = glad_debug_impl_glProgramUniformHandleui64ARB;
+static void APIENTRY glad_debug_impl_glProgramUniformHandleui64vARB(GLuint arg0, GLint arg1, GLsizei arg2, const GLuint64 * arg3) {
+	glad_glProgramUniformHandleui64vARB(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformHandleui64vARB", "uiip", (unsigned int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glProgramUniformHandleui64vARB");
+}
+PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC glad_debug_glProgramUniformHandleui64vARB = glad_debug_impl_glProgramUniformHandleui64vARB;
+static void APIENTRY glad_debug_impl_glProgramUniformMatrix2dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	glad_glProgramUniformMatrix2dv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformMatrix2dv", "uiibp", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glProgramUniformMatrix2dv");
+}
+PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_debug_glProgramUniformMatrix2dv = glad_debug_impl_glProgramUniformMatrix2dv;
+static void APIENTRY glad_debug_impl_glProgramUniformMatrix2fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	glad_glProgramUniformMatrix2fv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformMatrix2fv", "uiibp", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glProgramUniformMatrix2fv");
+}
+PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_debug_glProgramUniformMatrix2fv = glad_debug_impl_glProgramUniformMatrix2fv;
+static void APIENTRY glad_debug_impl_glProgramUniformMatrix2x3dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	glad_glProgramUniformMatrix2x3dv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformMatrix2x3dv", "uiibp", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glProgramUniformMatrix2x3dv");
+}
+PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_debug_glProgramUniformMatrix2x3dv = glad_debug_impl_glProgramUniformMatrix2x3dv;
+static void APIENTRY glad_debug_impl_glProgramUniformMatrix2x3fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	glad_glProgramUniformMatrix2x3fv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformMatrix2x3fv", "uiibp", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glProgramUniformMatrix2x3fv");
+}
+PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_debug_glProgramUniformMatrix2x3fv = glad_debug_impl_glProgramUniformMatrix2x3fv;
+static void APIENTRY glad_debug_impl_glProgramUniformMatrix2x4dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	glad_glProgramUniformMatrix2x4dv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformMatrix2x4dv", "uiibp", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glProgramUniformMatrix2x4dv");
+}
+PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_debug_glProgramUniformMatrix2x4dv = glad_debug_impl_glProgramUniformMatrix2x4dv;
+static void APIENTRY glad_debug_impl_glProgramUniformMatrix2x4fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	glad_glProgramUniformMatrix2x4fv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformMatrix2x4fv", "uiibp", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glProgramUniformMatrix2x4fv");
+}
+PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_debug_glProgramUniformMatrix2x4fv = glad_debug_impl_glProgramUniformMatrix2x4fv;
+static void APIENTRY glad_debug_impl_glProgramUniformMatrix3dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	glad_glProgramUniformMatrix3dv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformMatrix3dv", "uiibp", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glProgramUniformMatrix3dv");
+}
+PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_debug_glProgramUniformMatrix3dv = glad_debug_impl_glProgramUniformMatrix3dv;
+static void APIENTRY glad_debug_impl_glProgramUniformMatrix3fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	glad_glProgramUniformMatrix3fv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformMatrix3fv", "uiibp", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glProgramUniformMatrix3fv");
+}
+PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_debug_glProgramUniformMatrix3fv = glad_debug_impl_glProgramUniformMatrix3fv;
+static void APIENTRY glad_debug_impl_glProgramUniformMatrix3x2dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	glad_glProgramUniformMatrix3x2dv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformMatrix3x2dv", "uiibp", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glProgramUniformMatrix3x2dv");
+}
+PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_debug_glProgramUniformMatrix3x2dv = glad_debug_impl_glProgramUniformMatrix3x2dv;
+static void APIENTRY glad_debug_impl_glProgramUniformMatrix3x2fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	glad_glProgramUniformMatrix3x2fv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformMatrix3x2fv", "uiibp", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glProgramUniformMatrix3x2fv");
+}
+PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_debug_glProgramUniformMatrix3x2fv = glad_debug_impl_glProgramUniformMatrix3x2fv;
+static void APIENTRY glad_debug_impl_glProgramUniformMatrix3x4dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	glad_glProgramUniformMatrix3x4dv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformMatrix3x4dv", "uiibp", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glProgramUniformMatrix3x4dv");
+}
+PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_debug_glProgramUniformMatrix3x4dv = glad_debug_impl_glProgramUniformMatrix3x4dv;
+static void APIENTRY glad_debug_impl_glProgramUniformMatrix3x4fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	glad_glProgramUniformMatrix3x4fv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformMatrix3x4fv", "uiibp", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glProgramUniformMatrix3x4fv");
+}
+PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_debug_glProgramUniformMatrix3x4fv = glad_debug_impl_glProgramUniformMatrix3x4fv;
+static void APIENTRY glad_debug_impl_glProgramUniformMatrix4dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	glad_glProgramUniformMatrix4dv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformMatrix4dv", "uiibp", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glProgramUniformMatrix4dv");
+}
+PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_debug_glProgramUniformMatrix4dv = glad_debug_impl_glProgramUniformMatrix4dv;
+static void APIENTRY glad_debug_impl_glProgramUniformMatrix4fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	glad_glProgramUniformMatrix4fv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformMatrix4fv", "uiibp", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glProgramUniformMatrix4fv");
+}
+PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_debug_glProgramUniformMatrix4fv = glad_debug_impl_glProgramUniformMatrix4fv;
+static void APIENTRY glad_debug_impl_glProgramUniformMatrix4x2dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	glad_glProgramUniformMatrix4x2dv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformMatrix4x2dv", "uiibp", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glProgramUniformMatrix4x2dv");
+}
+PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_debug_glProgramUniformMatrix4x2dv = glad_debug_impl_glProgramUniformMatrix4x2dv;
+static void APIENTRY glad_debug_impl_glProgramUniformMatrix4x2fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	glad_glProgramUniformMatrix4x2fv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformMatrix4x2fv", "uiibp", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glProgramUniformMatrix4x2fv");
+}
+PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_debug_glProgramUniformMatrix4x2fv = glad_debug_impl_glProgramUniformMatrix4x2fv;
+static void APIENTRY glad_debug_impl_glProgramUniformMatrix4x3dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	glad_glProgramUniformMatrix4x3dv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformMatrix4x3dv", "uiibp", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glProgramUniformMatrix4x3dv");
+}
+PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_debug_glProgramUniformMatrix4x3dv = glad_debug_impl_glProgramUniformMatrix4x3dv;
+static void APIENTRY glad_debug_impl_glProgramUniformMatrix4x3fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	glad_glProgramUniformMatrix4x3fv(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glProgramUniformMatrix4x3fv", "uiibp", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glProgramUniformMatrix4x3fv");
+}
+PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_debug_glProgramUniformMatrix4x3fv = glad_debug_impl_glProgramUniformMatrix4x3fv;
+static void APIENTRY glad_debug_impl_glProvokingVertex(GLenum arg0) {
+	glad_glProvokingVertex(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glProvokingVertex", "e", (unsigned int)arg0);
+	gl_debug_check_error("glProvokingVertex");
+}
+PFNGLPROVOKINGVERTEXPROC glad_debug_glProvokingVertex = glad_debug_impl_glProvokingVertex;
+static void APIENTRY glad_debug_impl_glPushAttrib(GLbitfield arg0) {
+	glad_glPushAttrib(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glPushAttrib", "u", (unsigned int)arg0);
+	gl_debug_check_error("glPushAttrib");
+}
+PFNGLPUSHATTRIBPROC glad_debug_glPushAttrib = glad_debug_impl_glPushAttrib;
+static void APIENTRY glad_debug_impl_glPushClientAttrib(GLbitfield arg0) {
+	glad_glPushClientAttrib(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glPushClientAttrib", "u", (unsigned int)arg0);
+	gl_debug_check_error("glPushClientAttrib");
+}
+PFNGLPUSHCLIENTATTRIBPROC glad_debug_glPushClientAttrib = glad_debug_impl_glPushClientAttrib;
+static void APIENTRY glad_debug_impl_glPushDebugGroup(GLenum arg0, GLuint arg1, GLsizei arg2, const GLchar * arg3) {
+	glad_glPushDebugGroup(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glPushDebugGroup", "euip", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glPushDebugGroup");
+}
+PFNGLPUSHDEBUGGROUPPROC glad_debug_glPushDebugGroup = glad_debug_impl_glPushDebugGroup;
+static void APIENTRY glad_debug_impl_glPushMatrix(void) {
+	glad_glPushMatrix();
+	if (gl_debug_tracing) gl_debug_trace_call("glPushMatrix", "");
+	gl_debug_check_error("glPushMatrix");
+}
+PFNGLPUSHMATRIXPROC glad_debug_glPushMatrix = glad_debug_impl_glPushMatrix;
+static void APIENTRY glad_debug_impl_glPushName(GLuint arg0) {
+	glad_glPushName(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glPushName", "u", (unsigned int)arg0);
+	gl_debug_check_error("glPushName");
+}
+PFNGLPUSHNAMEPROC glad_debug_glPushName = glad_debug_impl_glPushName;
+static void APIENTRY glad_debug_impl_glQueryCounter(GLuint arg0, GLenum arg1) {
+	glad_glQueryCounter(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glQueryCounter", "ue", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glQueryCounter");
+}
+PFNGLQUERYCOUNTERPROC glad_debug_glQueryCounter = glad_debug_impl_glQueryCounter;
+static void APIENTRY glad_debug_impl_glRasterPos2d(GLdouble arg0, GLdouble arg1) {
+	glad_glRasterPos2d(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos2d", "ff", (double)arg0, (double)arg1);
+	gl_debug_check_error("glRasterPos2d");
+}
+PFNGLRASTERPOS2DPROC glad_debug_glRasterPos2d = glad_debug_impl_glRasterPos2d;
+static void APIENTRY glad_debug_impl_glRasterPos2dv(const GLdouble * arg0) {
+	glad_glRasterPos2dv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos2dv", "p", (const void*)arg0);
+	gl_debug_check_error("glRasterPos2dv");
+}
+PFNGLRASTERPOS2DVPROC glad_debug_glRasterPos2dv = glad_debug_impl_glRasterPos2dv;
+static void APIENTRY glad_debug_impl_glRasterPos2f(GLfloat arg0, GLfloat arg1) {
+	glad_glRasterPos2f(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos2f", "ff", (double)arg0, (double)arg1);
+	gl_debug_check_error("glRasterPos2f");
+}
+PFNGLRASTERPOS2FPROC glad_debug_glRasterPos2f = glad_debug_impl_glRasterPos2f;
+static void APIENTRY glad_debug_impl_glRasterPos2fv(const GLfloat * arg0) {
+	glad_glRasterPos2fv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos2fv", "p", (const void*)arg0);
+	gl_debug_check_error("glRasterPos2fv");
+}
+PFNGLRASTERPOS2FVPROC glad_debug_glRasterPos2fv = glad_debug_impl_glRasterPos2fv;
+static void APIENTRY glad_debug_impl_glRasterPos2i(GLint arg0, GLint arg1) {
+	glad_glRasterPos2i(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos2i", "ii", (int)arg0, (int)arg1);
+	gl_debug_check_error("glRasterPos2i");
+}
+PFNGLRASTERPOS2IPROC glad_debug_glRasterPos2i = glad_debug_impl_glRasterPos2i;
+static void APIENTRY glad_debug_impl_glRasterPos2iv(const GLint * arg0) {
+	glad_glRasterPos2iv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos2iv", "p", (const void*)arg0);
+	gl_debug_check_error("glRasterPos2iv");
+}
+PFNGLRASTERPOS2IVPROC glad_debug_glRasterPos2iv = glad_debug_impl_glRasterPos2iv;
+static void APIENTRY glad_debug_impl_glRasterPos2s(GLshort arg0, GLshort arg1) {
+	glad_glRasterPos2s(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos2s", "ii", (int)arg0, (int)arg1);
+	gl_debug_check_error("glRasterPos2s");
+}
+PFNGLRASTERPOS2SPROC glad_debug_glRasterPos2s = glad_debug_impl_glRasterPos2s;
+static void APIENTRY glad_debug_impl_glRasterPos2sv(const GLshort * arg0) {
+	glad_glRasterPos2sv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos2sv", "p", (const void*)arg0);
+	gl_debug_check_error("glRasterPos2sv");
+}
+PFNGLRASTERPOS2SVPROC glad_debug_glRasterPos2sv = glad_debug_impl_glRasterPos2sv;
+static void APIENTRY glad_debug_impl_glRasterPos3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	glad_glRasterPos3d(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos3d", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glRasterPos3d");
+}
+PFNGLRASTERPOS3DPROC glad_debug_glRasterPos3d = glad_debug_impl_glRasterPos3d;
+static void APIENTRY glad_debug_impl_glRasterPos3dv(const GLdouble * arg0) {
+	glad_glRasterPos3dv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos3dv", "p", (const void*)arg0);
+	gl_debug_check_error("glRasterPos3dv");
+}
+PFNGLRASTERPOS3DVPROC glad_debug_glRasterPos3dv = glad_debug_impl_glRasterPos3dv;
+static void APIENTRY glad_debug_impl_glRasterPos3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	glad_glRasterPos3f(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos3f", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glRasterPos3f");
+}
+PFNGLRASTERPOS3FPROC glad_debug_glRasterPos3f = glad_debug_impl_glRasterPos3f;
+static void APIENTRY glad_debug_impl_glRasterPos3fv(const GLfloat * arg0) {
+	glad_glRasterPos3fv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos3fv", "p", (const void*)arg0);
+	gl_debug_check_error("glRasterPos3fv");
+}
+PFNGLRASTERPOS3FVPROC glad_debug_glRasterPos3fv = glad_debug_impl_glRasterPos3fv;
+static void APIENTRY glad_debug_impl_glRasterPos3i(GLint arg0, GLint arg1, GLint arg2) {
+	glad_glRasterPos3i(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos3i", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glRasterPos3i");
+}
+PFNGLRASTERPOS3IPROC glad_debug_glRasterPos3i = glad_debug_impl_glRasterPos3i;
+static void APIENTRY glad_debug_impl_glRasterPos3iv(const GLint * arg0) {
+	glad_glRasterPos3iv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos3iv", "p", (const void*)arg0);
+	gl_debug_check_error("glRasterPos3iv");
+}
+PFNGLRASTERPOS3IVPROC glad_debug_glRasterPos3iv = glad_debug_impl_glRasterPos3iv;
+static void APIENTRY glad_debug_impl_glRasterPos3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	glad_glRasterPos3s(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos3s", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glRasterPos3s");
+}
+PFNGLRASTERPOS3SPROC glad_debug_glRasterPos3s = glad_debug_impl_glRasterPos3s;
+static void APIENTRY glad_debug_impl_glRasterPos3sv(const GLshort * arg0) {
+	glad_glRasterPos3sv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos3sv", "p", (const void*)arg0);
+	gl_debug_check_error("glRasterPos3sv");
+}
+PFNGLRASTERPOS3SVPROC glad_debug_glRasterPos3sv = glad_debug_impl_glRasterPos3sv;
+static void APIENTRY glad_debug_impl_glRasterPos4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	glad_glRasterPos4d(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos4d", "ffff", (double)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glRasterPos4d");
+}
+PFNGLRASTERPOS4DPROC glad_debug_glRasterPos4d = glad_debug_impl_glRasterPos4d;
+static void APIENTRY glad_debug_impl_glRasterPos4dv(const GLdouble * arg0) {
+	glad_glRasterPos4dv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos4dv", "p", (const void*)arg0);
+	gl_debug_check_error("glRasterPos4dv");
+}
+PFNGLRASTERPOS4DVPROC glad_debug_glRasterPos4dv = glad_debug_impl_glRasterPos4dv;
+static void APIENTRY glad_debug_impl_glRasterPos4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	glad_glRasterPos4f(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos4f", "ffff", (double)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glRasterPos4f");
+}
+PFNGLRASTERPOS4FPROC glad_debug_glRasterPos4f = glad_debug_impl_glRasterPos4f;
+static void APIENTRY glad_debug_impl_glRasterPos4fv(const GLfloat * arg0) {
+	glad_glRasterPos4fv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos4fv", "p", (const void*)arg0);
+	gl_debug_check_error("glRasterPos4fv");
+}
+PFNGLRASTERPOS4FVPROC glad_debug_glRasterPos4fv = glad_debug_impl_glRasterPos4fv;
+static void APIENTRY glad_debug_impl_glRasterPos4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	glad_glRasterPos4i(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos4i", "iiii", (int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glRasterPos4i");
+}
+PFNGLRASTERPOS4IPROC glad_debug_glRasterPos4i = glad_debug_impl_glRasterPos4i;
+static void APIENTRY glad_debug_impl_glRasterPos4iv(const GLint * arg0) {
+	glad_glRasterPos4iv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos4iv", "p", (const void*)arg0);
+	gl_debug_check_error("glRasterPos4iv");
+}
+PFNGLRASTERPOS4IVPROC glad_debug_glRasterPos4iv = glad_debug_impl_glRasterPos4iv;
+static void APIENTRY glad_debug_impl_glRasterPos4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	glad_glRasterPos4s(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos4s", "iiii", (int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glRasterPos4s");
+}
+PFNGLRASTERPOS4SPROC glad_debug_glRasterPos4s = glad_debug_impl_glRasterPos4s;
+static void APIENTRY glad_debug_impl_glRasterPos4sv(const GLshort * arg0) {
+	glad_glRasterPos4sv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glRasterPos4sv", "p", (const void*)arg0);
+	gl_debug_check_error("glRasterPos4sv");
+}
+PFNGLRASTERPOS4SVPROC glad_debug_glRasterPos4sv = glad_debug_impl_glRasterPos4sv;
+static void APIENTRY glad_debug_impl_glReadBuffer(GLenum arg0) {
+	glad_glReadBuffer(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glReadBuffer", "e", (unsigned int)arg0);
+	gl_debug_check_error("glReadBuffer");
+}
+PFNGLREADBUFFERPROC glad_debug_glReadBuffer = glad_debug_impl_glReadBuffer;
+static void APIENTRY glad_debug_impl_glReadPixels(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLenum arg4, GLenum arg5, void * arg6) {
+	glad_glReadPixels(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glReadPixels", "iiiieep", (int)arg0, (int)arg1, (int)arg2, (int)arg3, (unsigned int)arg4, (unsigned int)arg5, (const void*)arg6);
+	gl_debug_check_error("glReadPixels");
+}
+PFNGLREADPIXELSPROC glad_debug_glReadPixels = glad_debug_impl_glReadPixels;
+static void APIENTRY glad_debug_impl_glReadnPixels(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLenum arg4, GLenum arg5, GLsizei arg6, void * arg7) {
+	glad_glReadnPixels(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+	if (gl_debug_tracing) gl_debug_trace_call("glReadnPixels", "iiiieeip", (int)arg0, (int)arg1, (int)arg2, (int)arg3, (unsigned int)arg4, (unsigned int)arg5, (int)arg6, (const void*)arg7);
+	gl_debug_check_error("glReadnPixels");
+}
+PFNGLREADNPIXELSPROC glad_debug_glReadnPixels = glad_debug_impl_glReadnPixels;
+static void APIENTRY glad_debug_impl_glRectd(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	glad_glRectd(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glRectd", "ffff", (double)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glRectd");
+}
+PFNGLRECTDPROC glad_debug_glRectd = glad_debug_impl_glRectd;
+static void APIENTRY glad_debug_impl_glRectdv(const GLdouble * arg0, const GLdouble * arg1) {
+	glad_glRectdv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glRectdv", "pp", (const void*)arg0, (const void*)arg1);
+	gl_debug_check_error("glRectdv");
+}
+PFNGLRECTDVPROC glad_debug_glRectdv = glad_debug_impl_glRectdv;
+static void APIENTRY glad_debug_impl_glRectf(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	glad_glRectf(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glRectf", "ffff", (double)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glRectf");
+}
+PFNGLRECTFPROC glad_debug_glRectf = glad_debug_impl_glRectf;
+static void APIENTRY glad_debug_impl_glRectfv(const GLfloat * arg0, const GLfloat * arg1) {
+	glad_glRectfv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glRectfv", "pp", (const void*)arg0, (const void*)arg1);
+	gl_debug_check_error("glRectfv");
+}
+PFNGLRECTFVPROC glad_debug_glRectfv = glad_debug_impl_glRectfv;
+static void APIENTRY glad_debug_impl_glRecti(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	glad_glRecti(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glRecti", "iiii", (int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glRecti");
+}
+PFNGLRECTIPROC glad_debug_glRecti = glad_debug_impl_glRecti;
+static void APIENTRY glad_debug_impl_glRectiv(const GLint * arg0, const GLint * arg1) {
+	glad_glRectiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glRectiv", "pp", (const void*)arg0, (const void*)arg1);
+	gl_debug_check_error("glRectiv");
+}
+PFNGLRECTIVPROC glad_debug_glRectiv = glad_debug_impl_glRectiv;
+static void APIENTRY glad_debug_impl_glRects(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	glad_glRects(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glRects", "iiii", (int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glRects");
+}
+PFNGLRECTSPROC glad_debug_glRects = glad_debug_impl_glRects;
+static void APIENTRY glad_debug_impl_glRectsv(const GLshort * arg0, const GLshort * arg1) {
+	glad_glRectsv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glRectsv", "pp", (const void*)arg0, (const void*)arg1);
+	gl_debug_check_error("glRectsv");
+}
+PFNGLRECTSVPROC glad_debug_glRectsv = glad_debug_impl_glRectsv;
+static void APIENTRY glad_debug_impl_glReleaseShaderCompiler(void) {
+	glad_glReleaseShaderCompiler();
+	if (gl_debug_tracing) gl_debug_trace_call("glReleaseShaderCompiler", "");
+	gl_debug_check_error("glReleaseShaderCompiler");
+}
+PFNGLRELEASESHADERCOMPILERPROC glad_debug_glReleaseShaderCompiler = glad_debug_impl_glReleaseShaderCompiler;
+static GLint APIENTRY glad_debug_impl_glRenderMode(GLenum arg0) {
+	GLint ret;
+	ret = glad_glRenderMode(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glRenderMode", "e", (unsigned int)arg0);
+	gl_debug_check_error("glRenderMode");
+	return ret;
+}
+PFNGLRENDERMODEPROC glad_debug_glRenderMode = glad_debug_impl_glRenderMode;
+static void APIENTRY glad_debug_impl_glRenderbufferStorage(GLenum arg0, GLenum arg1, GLsizei arg2, GLsizei arg3) {
+	glad_glRenderbufferStorage(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glRenderbufferStorage", "eeii", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glRenderbufferStorage");
+}
+PFNGLRENDERBUFFERSTORAGEPROC glad_debug_glRenderbufferStorage = glad_debug_impl_glRenderbufferStorage;
+static void APIENTRY glad_debug_impl_glRenderbufferStorageMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4) {
+	glad_glRenderbufferStorageMultisample(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glRenderbufferStorageMultisample", "eieii", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4);
+	gl_debug_check_error("glRenderbufferStorageMultisample");
+}
+PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_debug_glRenderbufferStorageMultisample = glad_debug_impl_glRenderbufferStorageMultisample;
+static void APIENTRY glad_debug_impl_glResumeTransformFeedback(void) {
+	glad_glResumeTransformFeedback();
+	if (gl_debug_tracing) gl_debug_trace_call("glResumeTransformFeedback", "");
+	gl_debug_check_error("glResumeTransformFeedback");
+}
+PFNGLRESUMETRANSFORMFEEDBACKPROC glad_debug_glResumeTransformFeedback = glad_debug_impl_glResumeTransformFeedback;
+static void APIENTRY glad_debug_impl_glRotated(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	glad_glRotated(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glRotated", "ffff", (double)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glRotated");
+}
+PFNGLROTATEDPROC glad_debug_glRotated = glad_debug_impl_glRotated;
+static void APIENTRY glad_debug_impl_glRotatef(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	glad_glRotatef(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glRotatef", "ffff", (double)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glRotatef");
+}
+PFNGLROTATEFPROC glad_debug_glRotatef = glad_debug_impl_glRotatef;
+static void APIENTRY glad_debug_impl_glSampleCoverage(GLfloat arg0, GLboolean arg1) {
+	glad_glSampleCoverage(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glSampleCoverage", "fb", (double)arg0, (int)arg1);
+	gl_debug_check_error("glSampleCoverage");
+}
+PFNGLSAMPLECOVERAGEPROC glad_debug_glSampleCoverage = glad_debug_impl_glSampleCoverage;
+static void APIENTRY glad_debug_impl_glSampleMaski(GLuint arg0, GLbitfield arg1) {
+	glad_glSampleMaski(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glSampleMaski", "uu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glSampleMaski");
+}
+PFNGLSAMPLEMASKIPROC glad_debug_glSampleMaski = glad_debug_impl_glSampleMaski;
+static void APIENTRY glad_debug_impl_glSamplerParameterIiv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+	glad_glSamplerParameterIiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glSamplerParameterIiv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glSamplerParameterIiv");
+}
+PFNGLSAMPLERPARAMETERIIVPROC glad_debug_glSamplerParameterIiv = glad_debug_impl_glSamplerParameterIiv;
+static void APIENTRY glad_debug_impl_glSamplerParameterIuiv(GLuint arg0, GLenum arg1, const GLuint * arg2) {
+	glad_glSamplerParameterIuiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glSamplerParameterIuiv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glSamplerParameterIuiv");
+}
+PFNGLSAMPLERPARAMETERIUIVPROC glad_debug_glSamplerParameterIuiv = glad_debug_impl_glSamplerParameterIuiv;
+static void APIENTRY glad_debug_impl_glSamplerParameterf(GLuint arg0, GLenum arg1, GLfloat arg2) {
+	glad_glSamplerParameterf(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glSamplerParameterf", "uef", (unsigned int)arg0, (unsigned int)arg1, (double)arg2);
+	gl_debug_check_error("glSamplerParameterf");
+}
+PFNGLSAMPLERPARAMETERFPROC glad_debug_glSamplerParameterf = glad_debug_impl_glSamplerParameterf;
+static void APIENTRY glad_debug_impl_glSamplerParameterfv(GLuint arg0, GLenum arg1, const GLfloat * arg2) {
+	glad_glSamplerParameterfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glSamplerParameterfv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glSamplerParameterfv");
+}
+PFNGLSAMPLERPARAMETERFVPROC glad_debug_glSamplerParameterfv = glad_debug_impl_glSamplerParameterfv;
+static void APIENTRY glad_debug_impl_glSamplerParameteri(GLuint arg0, GLenum arg1, GLint arg2) {
+	glad_glSamplerParameteri(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glSamplerParameteri", "uei", (unsigned int)arg0, (unsigned int)arg1, (int)arg2);
+	gl_debug_check_error("glSamplerParameteri");
+}
+PFNGLSAMPLERPARAMETERIPROC glad_debug_glSamplerParameteri = glad_debug_impl_glSamplerParameteri;
+static void APIENTRY glad_debug_impl_glSamplerParameteriv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+	glad_glSamplerParameteriv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glSamplerParameteriv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glSamplerParameteriv");
+}
+PFNGLSAMPLERPARAMETERIVPROC glad_debug_glSamplerParameteriv = glad_debug_impl_glSamplerParameteriv;
+static void APIENTRY glad_debug_impl_glScaled(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	glad_glScaled(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glScaled", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glScaled");
+}
+PFNGLSCALEDPROC glad_debug_glScaled = glad_debug_impl_glScaled;
+static void APIENTRY glad_debug_impl_glScalef(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	glad_glScalef(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glScalef", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glScalef");
+}
+PFNGLSCALEFPROC glad_debug_glScalef = glad_debug_impl_glScalef;
+static void APIENTRY glad_debug_impl_glScissor(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3) {
+	glad_glScissor(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glScissor", "iiii", (int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glScissor");
+}
+PFNGLSCISSORPROC glad_debug_glScissor = glad_debug_impl_glScissor;
+static void APIENTRY glad_debug_impl_glScissorArrayv(GLuint arg0, GLsizei arg1, const GLint * arg2) {
+	glad_glScissorArrayv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glScissorArrayv", "uip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glScissorArrayv");
+}
+PFNGLSCISSORARRAYVPROC glad_debug_glScissorArrayv = glad_debug_impl_glScissorArrayv;
+static void APIENTRY glad_debug_impl_glScissorIndexed(GLuint arg0, GLint arg1, GLint arg2, GLsizei arg3, GLsizei arg4) {
+	glad_glScissorIndexed(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glScissorIndexed", "uiiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4);
+	gl_debug_check_error("glScissorIndexed");
+}
+PFNGLSCISSORINDEXEDPROC glad_debug_glScissorIndexed = glad_debug_impl_glScissorIndexed;
+static void APIENTRY glad_debug_impl_glScissorIndexedv(GLuint arg0, const GLint * arg1) {
+	glad_glScissorIndexedv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glScissorIndexedv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glScissorIndexedv");
+}
+PFNGLSCISSORINDEXEDVPROC glad_debug_glScissorIndexedv = glad_debug_impl_glScissorIndexedv;
+static void APIENTRY glad_debug_impl_glSecondaryColor3b(GLbyte arg0, GLbyte arg1, GLbyte arg2) {
+	glad_glSecondaryColor3b(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColor3b", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glSecondaryColor3b");
+}
+PFNGLSECONDARYCOLOR3BPROC glad_debug_glSecondaryColor3b = glad_debug_impl_glSecondaryColor3b;
+static void APIENTRY glad_debug_impl_glSecondaryColor3bv(const GLbyte * arg0) {
+	glad_glSecondaryColor3bv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColor3bv", "p", (const void*)arg0);
+	gl_debug_check_error("glSecondaryColor3bv");
+}
+PFNGLSECONDARYCOLOR3BVPROC glad_debug_glSecondaryColor3bv = glad_debug_impl_glSecondaryColor3bv;
+static void APIENTRY glad_debug_impl_glSecondaryColor3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	glad_glSecondaryColor3d(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColor3d", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glSecondaryColor3d");
+}
+PFNGLSECONDARYCOLOR3DPROC glad_debug_glSecondaryColor3d = glad_debug_impl_glSecondaryColor3d;
+static void APIENTRY glad_debug_impl_glSecondaryColor3dv(const GLdouble * arg0) {
+	glad_glSecondaryColor3dv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColor3dv", "p", (const void*)arg0);
+	gl_debug_check_error("glSecondaryColor3dv");
+}
+PFNGLSECONDARYCOLOR3DVPROC glad_debug_glSecondaryColor3dv = glad_debug_impl_glSecondaryColor3dv;
+static void APIENTRY glad_debug_impl_glSecondaryColor3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	glad_glSecondaryColor3f(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColor3f", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glSecondaryColor3f");
+}
+PFNGLSECONDARYCOLOR3FPROC glad_debug_glSecondaryColor3f = glad_debug_impl_glSecondaryColor3f;
+static void APIENTRY glad_debug_impl_glSecondaryColor3fv(const GLfloat * arg0) {
+	glad_glSecondaryColor3fv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColor3fv", "p", (const void*)arg0);
+	gl_debug_check_error("glSecondaryColor3fv");
+}
+PFNGLSECONDARYCOLOR3FVPROC glad_debug_glSecondaryColor3fv = glad_debug_impl_glSecondaryColor3fv;
+static void APIENTRY glad_debug_impl_glSecondaryColor3i(GLint arg0, GLint arg1, GLint arg2) {
+	glad_glSecondaryColor3i(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColor3i", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glSecondaryColor3i");
+}
+PFNGLSECONDARYCOLOR3IPROC glad_debug_glSecondaryColor3i = glad_debug_impl_glSecondaryColor3i;
+static void APIENTRY glad_debug_impl_glSecondaryColor3iv(const GLint * arg0) {
+	glad_glSecondaryColor3iv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColor3iv", "p", (const void*)arg0);
+	gl_debug_check_error("glSecondaryColor3iv");
+}
+PFNGLSECONDARYCOLOR3IVPROC glad_debug_glSecondaryColor3iv = glad_debug_impl_glSecondaryColor3iv;
+static void APIENTRY glad_debug_impl_glSecondaryColor3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	glad_glSecondaryColor3s(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColor3s", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glSecondaryColor3s");
+}
+PFNGLSECONDARYCOLOR3SPROC glad_debug_glSecondaryColor3s = glad_debug_impl_glSecondaryColor3s;
+static void APIENTRY glad_debug_impl_glSecondaryColor3sv(const GLshort * arg0) {
+	glad_glSecondaryColor3sv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColor3sv", "p", (const void*)arg0);
+	gl_debug_check_error("glSecondaryColor3sv");
+}
+PFNGLSECONDARYCOLOR3SVPROC glad_debug_glSecondaryColor3sv = glad_debug_impl_glSecondaryColor3sv;
+static void APIENTRY glad_debug_impl_glSecondaryColor3ub(GLubyte arg0, GLubyte arg1, GLubyte arg2) {
+	glad_glSecondaryColor3ub(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColor3ub", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glSecondaryColor3ub");
+}
+PFNGLSECONDARYCOLOR3UBPROC glad_debug_glSecondaryColor3ub = glad_debug_impl_glSecondaryColor3ub;
+static void APIENTRY glad_debug_impl_glSecondaryColor3ubv(const GLubyte * arg0) {
+	glad_glSecondaryColor3ubv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColor3ubv", "p", (const void*)arg0);
+	gl_debug_check_error("glSecondaryColor3ubv");
+}
+PFNGLSECONDARYCOLOR3UBVPROC glad_debug_glSecondaryColor3ubv = glad_debug_impl_glSecondaryColor3ubv;
+static void APIENTRY glad_debug_impl_glSecondaryColor3ui(GLuint arg0, GLuint arg1, GLuint arg2) {
+	glad_glSecondaryColor3ui(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColor3ui", "uuu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glSecondaryColor3ui");
+}
+PFNGLSECONDARYCOLOR3UIPROC glad_debug_glSecondaryColor3ui = glad_debug_impl_glSecondaryColor3ui;
+static void APIENTRY glad_debug_impl_glSecondaryColor3uiv(const GLuint * arg0) {
+	glad_glSecondaryColor3uiv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColor3uiv", "p", (const void*)arg0);
+	gl_debug_check_error("glSecondaryColor3uiv");
+}
+PFNGLSECONDARYCOLOR3UIVPROC glad_debug_glSecondaryColor3uiv = glad_debug_impl_glSecondaryColor3uiv;
+static void APIENTRY glad_debug_impl_glSecondaryColor3us(GLushort arg0, GLushort arg1, GLushort arg2) {
+	glad_glSecondaryColor3us(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColor3us", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glSecondaryColor3us");
+}
+PFNGLSECONDARYCOLOR3USPROC glad_debug_glSecondaryColor3us = glad_debug_impl_glSecondaryColor3us;
+static void APIENTRY glad_debug_impl_glSecondaryColor3usv(const GLushort * arg0) {
+	glad_glSecondaryColor3usv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColor3usv", "p", (const void*)arg0);
+	gl_debug_check_error("glSecondaryColor3usv");
+}
+PFNGLSECONDARYCOLOR3USVPROC glad_debug_glSecondaryColor3usv = glad_debug_impl_glSecondaryColor3usv;
+static void APIENTRY glad_debug_impl_glSecondaryColorP3ui(GLenum arg0, GLuint arg1) {
+	glad_glSecondaryColorP3ui(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColorP3ui", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glSecondaryColorP3ui");
+}
+PFNGLSECONDARYCOLORP3UIPROC glad_debug_glSecondaryColorP3ui = glad_debug_impl_glSecondaryColorP3ui;
+static void APIENTRY glad_debug_impl_glSecondaryColorP3uiv(GLenum arg0, const GLuint * arg1) {
+	glad_glSecondaryColorP3uiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColorP3uiv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glSecondaryColorP3uiv");
+}
+PFNGLSECONDARYCOLORP3UIVPROC glad_debug_glSecondaryColorP3uiv = glad_debug_impl_glSecondaryColorP3uiv;
+static void APIENTRY glad_debug_impl_glSecondaryColorPointer(GLint arg0, GLenum arg1, GLsizei arg2, const void * arg3) {
+	glad_glSecondaryColorPointer(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glSecondaryColorPointer", "ieip", (int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glSecondaryColorPointer");
+}
+PFNGLSECONDARYCOLORPOINTERPROC glad_debug_glSecondaryColorPointer = glad_debug_impl_glSecondaryColorPointer;
+static void APIENTRY glad_debug_impl_glSelectBuffer(GLsizei arg0, GLuint * arg1) {
+	glad_glSelectBuffer(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glSelectBuffer", "ip", (int)arg0, (const void*)arg1);
+	gl_debug_check_error("glSelectBuffer");
+}
+PFNGLSELECTBUFFERPROC glad_debug_glSelectBuffer = glad_debug_impl_glSelectBuffer;
+static void APIENTRY glad_debug_impl_glShadeModel(GLenum arg0) {
+	glad_glShadeModel(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glShadeModel", "e", (unsigned int)arg0);
+	gl_debug_check_error("glShadeModel");
+}
+PFNGLSHADEMODELPROC glad_debug_glShadeModel = glad_debug_impl_glShadeModel;
+static void APIENTRY glad_debug_impl_glShaderBinary(GLsizei arg0, const GLuint * arg1, GLenum arg2, const void * arg3, GLsizei arg4) {
+	glad_glShaderBinary(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glShaderBinary", "ipepi", (int)arg0, (const void*)arg1, (unsigned int)arg2, (const void*)arg3, (int)arg4);
+	gl_debug_check_error("glShaderBinary");
+}
+PFNGLSHADERBINARYPROC glad_debug_glShaderBinary = glad_debug_impl_glShaderBinary;
+static void APIENTRY glad_debug_impl_glShaderSource(GLuint arg0, GLsizei arg1, const GLchar *const * arg2, const GLint * arg3) {
+	glad_glShaderSource(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glShaderSource", "uipp", (unsigned int)arg0, (int)arg1, (const void*)arg2, (const void*)arg3);
+	gl_debug_check_error("glShaderSource");
+}
+PFNGLSHADERSOURCEPROC glad_debug_glShaderSource = glad_debug_impl_glShaderSource;
+static void APIENTRY glad_debug_impl_glShaderStorageBlockBinding(GLuint arg0, GLuint arg1, GLuint arg2) {
+	glad_glShaderStorageBlockBinding(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glShaderStorageBlockBinding", "uuu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glShaderStorageBlockBinding");
+}
+PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_debug_glShaderStorageBlockBinding = glad_debug_impl_glShaderStorageBlockBinding;
+static void APIENTRY glad_debug_impl_glSpecializeShader(GLuint arg0, const GLchar * arg1, GLuint arg2, const GLuint * arg3, const GLuint * arg4) {
+	glad_glSpecializeShader(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glSpecializeShader", "upupp", (unsigned int)arg0, (const void*)arg1, (unsigned int)arg2, (const void*)arg3, (const void*)arg4);
+	gl_debug_check_error("glSpecializeShader");
+}
+PFNGLSPECIALIZESHADERPROC glad_debug_glSpecializeShader = glad_debug_impl_glSpecializeShader;
+static void APIENTRY glad_debug_impl_glSpecializeShaderARB(GLuint arg0, const GLchar * arg1, GLuint arg2, const GLuint * arg3, const GLuint * arg4) {
+	glad_glSpecializeShaderARB(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glSpecializeShaderARB", "upupp", (unsigned int)arg0, (const void*)arg1, (unsigned int)arg2, (const void*)arg3, (const void*)arg4);
+	gl_debug_check_error("glSpecializeShaderARB");
+}
+PFNGLSPECIALIZESHADERARBPROC glad_debug_glSpecializeShaderARB = glad_debug_impl_glSpecializeShaderARB;
+static void APIENTRY glad_debug_impl_glStencilFunc(GLenum arg0, GLint arg1, GLuint arg2) {
+	glad_glStencilFunc(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glStencilFunc", "eiu", (unsigned int)arg0, (int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glStencilFunc");
+}
+PFNGLSTENCILFUNCPROC glad_debug_glStencilFunc = glad_debug_impl_glStencilFunc;
+static void APIENTRY glad_debug_impl_glStencilFuncSeparate(GLenum arg0, GLenum arg1, GLint arg2, GLuint arg3) {
+	glad_glStencilFuncSeparate(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glStencilFuncSeparate", "eeiu", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glStencilFuncSeparate");
+}
+PFNGLSTENCILFUNCSEPARATEPROC glad_debug_glStencilFuncSeparate = glad_debug_impl_glStencilFuncSeparate;
+static void APIENTRY glad_debug_impl_glStencilMask(GLuint arg0) {
+	glad_glStencilMask(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glStencilMask", "u", (unsigned int)arg0);
+	gl_debug_check_error("glStencilMask");
+}
+PFNGLSTENCILMASKPROC glad_debug_glStencilMask = glad_debug_impl_glStencilMask;
+static void APIENTRY glad_debug_impl_glStencilMaskSeparate(GLenum arg0, GLuint arg1) {
+	glad_glStencilMaskSeparate(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glStencilMaskSeparate", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glStencilMaskSeparate");
+}
+PFNGLSTENCILMASKSEPARATEPROC glad_debug_glStencilMaskSeparate = glad_debug_impl_glStencilMaskSeparate;
+static void APIENTRY glad_debug_impl_glStencilOp(GLenum arg0, GLenum arg1, GLenum arg2) {
+	glad_glStencilOp(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glStencilOp", "eee", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glStencilOp");
+}
+PFNGLSTENCILOPPROC glad_debug_glStencilOp = glad_debug_impl_glStencilOp;
+static void APIENTRY glad_debug_impl_glStencilOpSeparate(GLenum arg0, GLenum arg1, GLenum arg2, GLenum arg3) {
+	glad_glStencilOpSeparate(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glStencilOpSeparate", "eeee", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glStencilOpSeparate");
+}
+PFNGLSTENCILOPSEPARATEPROC glad_debug_glStencilOpSeparate = glad_debug_impl_glStencilOpSeparate;
+static void APIENTRY glad_debug_impl_glTexBuffer(GLenum arg0, GLenum arg1, GLuint arg2) {
+	glad_glTexBuffer(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexBuffer", "eeu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glTexBuffer");
+}
+PFNGLTEXBUFFERPROC glad_debug_glTexBuffer = glad_debug_impl_glTexBuffer;
+static void APIENTRY glad_debug_impl_glTexBufferRange(GLenum arg0, GLenum arg1, GLuint arg2, GLintptr arg3, GLsizeiptr arg4) {
+	glad_glTexBufferRange(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexBufferRange", "eeull", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (long long)arg3, (long long)arg4);
+	gl_debug_check_error("glTexBufferRange");
+}
+PFNGLTEXBUFFERRANGEPROC glad_debug_glTexBufferRange = glad_debug_impl_glTexBufferRange;
+static void APIENTRY glad_debug_impl_glTexCoord1d(GLdouble arg0) {
+	glad_glTexCoord1d(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord1d", "f", (double)arg0);
+	gl_debug_check_error("glTexCoord1d");
+}
+PFNGLTEXCOORD1DPROC glad_debug_glTexCoord1d = glad_debug_impl_glTexCoord1d;
+static void APIENTRY glad_debug_impl_glTexCoord1dv(const GLdouble * arg0) {
+	glad_glTexCoord1dv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord1dv", "p", (const void*)arg0);
+	gl_debug_check_error("glTexCoord1dv");
+}
+PFNGLTEXCOORD1DVPROC glad_debug_glTexCoord1dv = glad_debug_impl_glTexCoord1dv;
+static void APIENTRY glad_debug_impl_glTexCoord1f(GLfloat arg0) {
+	glad_glTexCoord1f(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord1f", "f", (double)arg0);
+	gl_debug_check_error("glTexCoord1f");
+}
+PFNGLTEXCOORD1FPROC glad_debug_glTexCoord1f = glad_debug_impl_glTexCoord1f;
+static void APIENTRY glad_debug_impl_glTexCoord1fv(const GLfloat * arg0) {
+	glad_glTexCoord1fv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord1fv", "p", (const void*)arg0);
+	gl_debug_check_error("glTexCoord1fv");
+}
+PFNGLTEXCOORD1FVPROC glad_debug_glTexCoord1fv = glad_debug_impl_glTexCoord1fv;
+static void APIENTRY glad_debug_impl_glTexCoord1i(GLint arg0) {
+	glad_glTexCoord1i(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord1i", "i", (int)arg0);
+	gl_debug_check_error("glTexCoord1i");
+}
+PFNGLTEXCOORD1IPROC glad_debug_glTexCoord1i = glad_debug_impl_glTexCoord1i;
+static void APIENTRY glad_debug_impl_glTexCoord1iv(const GLint * arg0) {
+	glad_glTexCoord1iv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord1iv", "p", (const void*)arg0);
+	gl_debug_check_error("glTexCoord1iv");
+}
+PFNGLTEXCOORD1IVPROC glad_debug_glTexCoord1iv = glad_debug_impl_glTexCoord1iv;
+static void APIENTRY glad_debug_impl_glTexCoord1s(GLshort arg0) {
+	glad_glTexCoord1s(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord1s", "i", (int)arg0);
+	gl_debug_check_error("glTexCoord1s");
+}
+PFNGLTEXCOORD1SPROC glad_debug_glTexCoord1s = glad_debug_impl_glTexCoord1s;
+static void APIENTRY glad_debug_impl_glTexCoord1sv(const GLshort * arg0) {
+	glad_glTexCoord1sv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord1sv", "p", (const void*)arg0);
+	gl_debug_check_error("glTexCoord1sv");
+}
+PFNGLTEXCOORD1SVPROC glad_debug_glTexCoord1sv = glad_debug_impl_glTexCoord1sv;
+static void APIENTRY glad_debug_impl_glTexCoord2d(GLdouble arg0, GLdouble arg1) {
+	glad_glTexCoord2d(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord2d", "ff", (double)arg0, (double)arg1);
+	gl_debug_check_error("glTexCoord2d");
+}
+PFNGLTEXCOORD2DPROC glad_debug_glTexCoord2d = glad_debug_impl_glTexCoord2d;
+static void APIENTRY glad_debug_impl_glTexCoord2dv(const GLdouble * arg0) {
+	glad_glTexCoord2dv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord2dv", "p", (const void*)arg0);
+	gl_debug_check_error("glTexCoord2dv");
+}
+PFNGLTEXCOORD2DVPROC glad_debug_glTexCoord2dv = glad_debug_impl_glTexCoord2dv;
+static void APIENTRY glad_debug_impl_glTexCoord2f(GLfloat arg0, GLfloat arg1) {
+	glad_glTexCoord2f(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord2f", "ff", (double)arg0, (double)arg1);
+	gl_debug_check_error("glTexCoord2f");
+}
+PFNGLTEXCOORD2FPROC glad_debug_glTexCoord2f = glad_debug_impl_glTexCoord2f;
+static void APIENTRY glad_debug_impl_glTexCoord2fv(const GLfloat * arg0) {
+	glad_glTexCoord2fv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord2fv", "p", (const void*)arg0);
+	gl_debug_check_error("glTexCoord2fv");
+}
+PFNGLTEXCOORD2FVPROC glad_debug_glTexCoord2fv = glad_debug_impl_glTexCoord2fv;
+static void APIENTRY glad_debug_impl_glTexCoord2i(GLint arg0, GLint arg1) {
+	glad_glTexCoord2i(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord2i", "ii", (int)arg0, (int)arg1);
+	gl_debug_check_error("glTexCoord2i");
+}
+PFNGLTEXCOORD2IPROC glad_debug_glTexCoord2i = glad_debug_impl_glTexCoord2i;
+static void APIENTRY glad_debug_impl_glTexCoord2iv(const GLint * arg0) {
+	glad_glTexCoord2iv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord2iv", "p", (const void*)arg0);
+	gl_debug_check_error("glTexCoord2iv");
+}
+PFNGLTEXCOORD2IVPROC glad_debug_glTexCoord2iv = glad_debug_impl_glTexCoord2iv;
+static void APIENTRY glad_debug_impl_glTexCoord2s(GLshort arg0, GLshort arg1) {
+	glad_glTexCoord2s(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord2s", "ii", (int)arg0, (int)arg1);
+	gl_debug_check_error("glTexCoord2s");
+}
+PFNGLTEXCOORD2SPROC glad_debug_glTexCoord2s = glad_debug_impl_glTexCoord2s;
+static void APIENTRY glad_debug_impl_glTexCoord2sv(const GLshort * arg0) {
+	glad_glTexCoord2sv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord2sv", "p", (const void*)arg0);
+	gl_debug_check_error("glTexCoord2sv");
+}
+PFNGLTEXCOORD2SVPROC glad_debug_glTexCoord2sv = glad_debug_impl_glTexCoord2sv;
+static void APIENTRY glad_debug_impl_glTexCoord3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	glad_glTexCoord3d(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord3d", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glTexCoord3d");
+}
+PFNGLTEXCOORD3DPROC glad_debug_glTexCoord3d = glad_debug_impl_glTexCoord3d;
+static void APIENTRY glad_debug_impl_glTexCoord3dv(const GLdouble * arg0) {
+	glad_glTexCoord3dv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord3dv", "p", (const void*)arg0);
+	gl_debug_check_error("glTexCoord3dv");
+}
+PFNGLTEXCOORD3DVPROC glad_debug_glTexCoord3dv = glad_debug_impl_glTexCoord3dv;
+static void APIENTRY glad_debug_impl_glTexCoord3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	glad_glTexCoord3f(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord3f", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glTexCoord3f");
+}
+PFNGLTEXCOORD3FPROC glad_debug_glTexCoord3f = glad_debug_impl_glTexCoord3f;
+static void APIENTRY glad_debug_impl_glTexCoord3fv(const GLfloat * arg0) {
+	glad_glTexCoord3fv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord3fv", "p", (const void*)arg0);
+	gl_debug_check_error("glTexCoord3fv");
+}
+PFNGLTEXCOORD3FVPROC glad_debug_glTexCoord3fv = glad_debug_impl_glTexCoord3fv;
+static void APIENTRY glad_debug_impl_glTexCoord3i(GLint arg0, GLint arg1, GLint arg2) {
+	glad_glTexCoord3i(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord3i", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glTexCoord3i");
+}
+PFNGLTEXCOORD3IPROC glad_debug_glTexCoord3i = glad_debug_impl_glTexCoord3i;
+static void APIENTRY glad_debug_impl_glTexCoord3iv(const GLint * arg0) {
+	glad_glTexCoord3iv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord3iv", "p", (const void*)arg0);
+	gl_debug_check_error("glTexCoord3iv");
+}
+PFNGLTEXCOORD3IVPROC glad_debug_glTexCoord3iv = glad_debug_impl_glTexCoord3iv;
+static void APIENTRY glad_debug_impl_glTexCoord3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	glad_glTexCoord3s(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord3s", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glTexCoord3s");
+}
+PFNGLTEXCOORD3SPROC glad_debug_glTexCoord3s = glad_debug_impl_glTexCoord3s;
+static void APIENTRY glad_debug_impl_glTexCoord3sv(const GLshort * arg0) {
+	glad_glTexCoord3sv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord3sv", "p", (const void*)arg0);
+	gl_debug_check_error("glTexCoord3sv");
+}
+PFNGLTEXCOORD3SVPROC glad_debug_glTexCoord3sv = glad_debug_impl_glTexCoord3sv;
+static void APIENTRY glad_debug_impl_glTexCoord4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	glad_glTexCoord4d(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord4d", "ffff", (double)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glTexCoord4d");
+}
+PFNGLTEXCOORD4DPROC glad_debug_glTexCoord4d = glad_debug_impl_glTexCoord4d;
+static void APIENTRY glad_debug_impl_glTexCoord4dv(const GLdouble * arg0) {
+	glad_glTexCoord4dv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord4dv", "p", (const void*)arg0);
+	gl_debug_check_error("glTexCoord4dv");
+}
+PFNGLTEXCOORD4DVPROC glad_debug_glTexCoord4dv = glad_debug_impl_glTexCoord4dv;
+static void APIENTRY glad_debug_impl_glTexCoord4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	glad_glTexCoord4f(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord4f", "ffff", (double)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glTexCoord4f");
+}
+PFNGLTEXCOORD4FPROC glad_debug_glTexCoord4f = glad_debug_impl_glTexCoord4f;
+static void APIENTRY glad_debug_impl_glTexCoord4fv(const GLfloat * arg0) {
+	glad_glTexCoord4fv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord4fv", "p", (const void*)arg0);
+	gl_debug_check_error("glTexCoord4fv");
+}
+PFNGLTEXCOORD4FVPROC glad_debug_glTexCoord4fv = glad_debug_impl_glTexCoord4fv;
+static void APIENTRY glad_debug_impl_glTexCoord4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	glad_glTexCoord4i(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord4i", "iiii", (int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glTexCoord4i");
+}
+PFNGLTEXCOORD4IPROC glad_debug_glTexCoord4i = glad_debug_impl_glTexCoord4i;
+static void APIENTRY glad_debug_impl_glTexCoord4iv(const GLint * arg0) {
+	glad_glTexCoord4iv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord4iv", "p", (const void*)arg0);
+	gl_debug_check_error("glTexCoord4iv");
+}
+PFNGLTEXCOORD4IVPROC glad_debug_glTexCoord4iv = glad_debug_impl_glTexCoord4iv;
+static void APIENTRY glad_debug_impl_glTexCoord4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	glad_glTexCoord4s(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord4s", "iiii", (int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glTexCoord4s");
+}
+PFNGLTEXCOORD4SPROC glad_debug_glTexCoord4s = glad_debug_impl_glTexCoord4s;
+static void APIENTRY glad_debug_impl_glTexCoord4sv(const GLshort * arg0) {
+	glad_glTexCoord4sv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoord4sv", "p", (const void*)arg0);
+	gl_debug_check_error("glTexCoord4sv");
+}
+PFNGLTEXCOORD4SVPROC glad_debug_glTexCoord4sv = glad_debug_impl_glTexCoord4sv;
+static void APIENTRY glad_debug_impl_glTexCoordP1ui(GLenum arg0, GLuint arg1) {
+	glad_glTexCoordP1ui(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoordP1ui", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glTexCoordP1ui");
+}
+PFNGLTEXCOORDP1UIPROC glad_debug_glTexCoordP1ui = glad_debug_impl_glTexCoordP1ui;
+static void APIENTRY glad_debug_impl_glTexCoordP1uiv(GLenum arg0, const GLuint * arg1) {
+	glad_glTexCoordP1uiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoordP1uiv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glTexCoordP1uiv");
+}
+PFNGLTEXCOORDP1UIVPROC glad_debug_glTexCoordP1uiv = glad_debug_impl_glTexCoordP1uiv;
+static void APIENTRY glad_debug_impl_glTexCoordP2ui(GLenum arg0, GLuint arg1) {
+	glad_glTexCoordP2ui(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoordP2ui", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glTexCoordP2ui");
+}
+PFNGLTEXCOORDP2UIPROC glad_debug_glTexCoordP2ui = glad_debug_impl_glTexCoordP2ui;
+static void APIENTRY glad_debug_impl_glTexCoordP2uiv(GLenum arg0, const GLuint * arg1) {
+	glad_glTexCoordP2uiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoordP2uiv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glTexCoordP2uiv");
+}
+PFNGLTEXCOORDP2UIVPROC glad_debug_glTexCoordP2uiv = glad_debug_impl_glTexCoordP2uiv;
+static void APIENTRY glad_debug_impl_glTexCoordP3ui(GLenum arg0, GLuint arg1) {
+	glad_glTexCoordP3ui(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoordP3ui", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glTexCoordP3ui");
+}
+PFNGLTEXCOORDP3UIPROC glad_debug_glTexCoordP3ui = glad_debug_impl_glTexCoordP3ui;
+static void APIENTRY glad_debug_impl_glTexCoordP3uiv(GLenum arg0, const GLuint * arg1) {
+	glad_glTexCoordP3uiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoordP3uiv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glTexCoordP3uiv");
+}
+PFNGLTEXCOORDP3UIVPROC glad_debug_glTexCoordP3uiv = glad_debug_impl_glTexCoordP3uiv;
+static void APIENTRY glad_debug_impl_glTexCoordP4ui(GLenum arg0, GLuint arg1) {
+	glad_glTexCoordP4ui(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoordP4ui", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glTexCoordP4ui");
+}
+PFNGLTEXCOORDP4UIPROC glad_debug_glTexCoordP4ui = glad_debug_impl_glTexCoordP4ui;
+static void APIENTRY glad_debug_impl_glTexCoordP4uiv(GLenum arg0, const GLuint * arg1) {
+	glad_glTexCoordP4uiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoordP4uiv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glTexCoordP4uiv");
+}
+PFNGLTEXCOORDP4UIVPROC glad_debug_glTexCoordP4uiv = glad_debug_impl_glTexCoordP4uiv;
+static void APIENTRY glad_debug_impl_glTexCoordPointer(GLint arg0, GLenum arg1, GLsizei arg2, const void * arg3) {
+	glad_glTexCoordPointer(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexCoordPointer", "ieip", (int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glTexCoordPointer");
+}
+PFNGLTEXCOORDPOINTERPROC glad_debug_glTexCoordPointer = glad_debug_impl_glTexCoordPointer;
+static void APIENTRY glad_debug_impl_glTexEnvf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	glad_glTexEnvf(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexEnvf", "eef", (unsigned int)arg0, (unsigned int)arg1, (double)arg2);
+	gl_debug_check_error("glTexEnvf");
+}
+PFNGLTEXENVFPROC glad_debug_glTexEnvf = glad_debug_impl_glTexEnvf;
+static void APIENTRY glad_debug_impl_glTexEnvfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	glad_glTexEnvfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexEnvfv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glTexEnvfv");
+}
+PFNGLTEXENVFVPROC glad_debug_glTexEnvfv = glad_debug_impl_glTexEnvfv;
+static void APIENTRY glad_debug_impl_glTexEnvi(GLenum arg0, GLenum arg1, GLint arg2) {
+	glad_glTexEnvi(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexEnvi", "eei", (unsigned int)arg0, (unsigned int)arg1, (int)arg2);
+	gl_debug_check_error("glTexEnvi");
+}
+PFNGLTEXENVIPROC glad_debug_glTexEnvi = glad_debug_impl_glTexEnvi;
+static void APIENTRY glad_debug_impl_glTexEnviv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	glad_glTexEnviv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexEnviv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glTexEnviv");
+}
+PFNGLTEXENVIVPROC glad_debug_glTexEnviv = glad_debug_impl_glTexEnviv;
+static void APIENTRY glad_debug_impl_glTexGend(GLenum arg0, GLenum arg1, GLdouble arg2) {
+	glad_glTexGend(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexGend", "eef", (unsigned int)arg0, (unsigned int)arg1, (double)arg2);
+	gl_debug_check_error("glTexGend");
+}
+PFNGLTEXGENDPROC glad_debug_glTexGend = glad_debug_impl_glTexGend;
+static void APIENTRY glad_debug_impl_glTexGendv(GLenum arg0, GLenum arg1, const GLdouble * arg2) {
+	glad_glTexGendv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexGendv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glTexGendv");
+}
+PFNGLTEXGENDVPROC glad_debug_glTexGendv = glad_debug_impl_glTexGendv;
+static void APIENTRY glad_debug_impl_glTexGenf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	glad_glTexGenf(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexGenf", "eef", (unsigned int)arg0, (unsigned int)arg1, (double)arg2);
+	gl_debug_check_error("glTexGenf");
+}
+PFNGLTEXGENFPROC glad_debug_glTexGenf = glad_debug_impl_glTexGenf;
+static void APIENTRY glad_debug_impl_glTexGenfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	glad_glTexGenfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexGenfv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glTexGenfv");
+}
+PFNGLTEXGENFVPROC glad_debug_glTexGenfv = glad_debug_impl_glTexGenfv;
+static void APIENTRY glad_debug_impl_glTexGeni(GLenum arg0, GLenum arg1, GLint arg2) {
+	glad_glTexGeni(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexGeni", "eei", (unsigned int)arg0, (unsigned int)arg1, (int)arg2);
+	gl_debug_check_error("glTexGeni");
+}
+PFNGLTEXGENIPROC glad_debug_glTexGeni = glad_debug_impl_glTexGeni;
+static void APIENTRY glad_debug_impl_glTexGeniv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	glad_glTexGeniv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexGeniv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glTexGeniv");
+}
+PFNGLTEXGENIVPROC glad_debug_glTexGeniv = glad_debug_impl_glTexGeniv;
+static void APIENTRY glad_debug_impl_glTexImage1D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLint arg4, GLenum arg5, GLenum arg6, const void * arg7) {
+	glad_glTexImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexImage1D", "eiiiieep", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (unsigned int)arg5, (unsigned int)arg6, (const void*)arg7);
+	gl_debug_check_error("glTexImage1D");
+}
+PFNGLTEXIMAGE1DPROC glad_debug_glTexImage1D = glad_debug_impl_glTexImage1D;
+static void APIENTRY glad_debug_impl_glTexImage2D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLsizei arg4, GLint arg5, GLenum arg6, GLenum arg7, const void * arg8) {
+	glad_glTexImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexImage2D", "eiiiiieep", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (unsigned int)arg6, (unsigned int)arg7, (const void*)arg8);
+	gl_debug_check_error("glTexImage2D");
+}
+PFNGLTEXIMAGE2DPROC glad_debug_glTexImage2D = glad_debug_impl_glTexImage2D;
+static void APIENTRY glad_debug_impl_glTexImage2DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLboolean arg5) {
+	glad_glTexImage2DMultisample(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexImage2DMultisample", "eieiib", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4, (int)arg5);
+	gl_debug_check_error("glTexImage2DMultisample");
+}
+PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_debug_glTexImage2DMultisample = glad_debug_impl_glTexImage2DMultisample;
+static void APIENTRY glad_debug_impl_glTexImage3D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLint arg6, GLenum arg7, GLenum arg8, const void * arg9) {
+	glad_glTexImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexImage3D", "eiiiiiieep", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6, (unsigned int)arg7, (unsigned int)arg8, (const void*)arg9);
+	gl_debug_check_error("glTexImage3D");
+}
+PFNGLTEXIMAGE3DPROC glad_debug_glTexImage3D = glad_debug_impl_glTexImage3D;
+static void APIENTRY glad_debug_impl_glTexImage3DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLboolean arg6) {
+	glad_glTexImage3DMultisample(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexImage3DMultisample", "eieiiib", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6);
+	gl_debug_check_error("glTexImage3DMultisample");
+}
+PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_debug_glTexImage3DMultisample = glad_debug_impl_glTexImage3DMultisample;
+static void APIENTRY glad_debug_impl_glTexParameterIiv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	glad_glTexParameterIiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexParameterIiv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glTexParameterIiv");
+}
+PFNGLTEXPARAMETERIIVPROC glad_debug_glTexParameterIiv = glad_debug_impl_glTexParameterIiv;
+static void APIENTRY glad_debug_impl_glTexParameterIuiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	glad_glTexParameterIuiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexParameterIuiv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glTexParameterIuiv");
+}
+PFNGLTEXPARAMETERIUIVPROC glad_debug_glTexParameterIuiv = glad_debug_impl_glTexParameterIuiv;
+static void APIENTRY glad_debug_impl_glTexParameterf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	glad_glTexParameterf(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexParameterf", "eef", (unsigned int)arg0, (unsigned int)arg1, (double)arg2);
+	gl_debug_check_error("glTexParameterf");
+}
+PFNGLTEXPARAMETERFPROC glad_debug_glTexParameterf = glad_debug_impl_glTexParameterf;
+static void APIENTRY glad_debug_impl_glTexParameterfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	glad_glTexParameterfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexParameterfv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glTexParameterfv");
+}
+PFNGLTEXPARAMETERFVPROC glad_debug_glTexParameterfv = glad_debug_impl_glTexParameterfv;
+static void APIENTRY glad_debug_impl_glTexParameteri(GLenum arg0, GLenum arg1, GLint arg2) {
+	glad_glTexParameteri(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexParameteri", "eei", (unsigned int)arg0, (unsigned int)arg1, (int)arg2);
+	gl_debug_check_error("glTexParameteri");
+}
+PFNGLTEXPARAMETERIPROC glad_debug_glTexParameteri = glad_debug_impl_glTexParameteri;
+static void APIENTRY glad_debug_impl_glTexParameteriv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	glad_glTexParameteriv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexParameteriv", "eep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glTexParameteriv");
+}
+PFNGLTEXPARAMETERIVPROC glad_debug_glTexParameteriv = glad_debug_impl_glTexParameteriv;
+static void APIENTRY glad_debug_impl_glTexStorage1D(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3) {
+	glad_glTexStorage1D(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexStorage1D", "eiei", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3);
+	gl_debug_check_error("glTexStorage1D");
+}
+PFNGLTEXSTORAGE1DPROC glad_debug_glTexStorage1D = glad_debug_impl_glTexStorage1D;
+static void APIENTRY glad_debug_impl_glTexStorage2D(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4) {
+	glad_glTexStorage2D(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexStorage2D", "eieii", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4);
+	gl_debug_check_error("glTexStorage2D");
+}
+PFNGLTEXSTORAGE2DPROC glad_debug_glTexStorage2D = glad_debug_impl_glTexStorage2D;
+static void APIENTRY glad_debug_impl_glTexStorage2DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLboolean arg5) {
+	glad_glTexStorage2DMultisample(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexStorage2DMultisample", "eieiib", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4, (int)arg5);
+	gl_debug_check_error("glTexStorage2DMultisample");
+}
+PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_debug_glTexStorage2DMultisample = glad_debug_impl_glTexStorage2DMultisample;
+static void APIENTRY glad_debug_impl_glTexStorage3D(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5) {
+	glad_glTexStorage3D(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexStorage3D", "eieiii", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4, (int)arg5);
+	gl_debug_check_error("glTexStorage3D");
+}
+PFNGLTEXSTORAGE3DPROC glad_debug_glTexStorage3D = glad_debug_impl_glTexStorage3D;
+static void APIENTRY glad_debug_impl_glTexStorage3DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLboolean arg6) {
+	glad_glTexStorage3DMultisample(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexStorage3DMultisample", "eieiiib", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6);
+	gl_debug_check_error("glTexStorage3DMultisample");
+}
+PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_debug_glTexStorage3DMultisample = glad_debug_impl_glTexStorage3DMultisample;
+static void APIENTRY glad_debug_impl_glTexSubImage1D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLenum arg5, const void * arg6) {
+	glad_glTexSubImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexSubImage1D", "eiiieep", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (unsigned int)arg4, (unsigned int)arg5, (const void*)arg6);
+	gl_debug_check_error("glTexSubImage1D");
+}
+PFNGLTEXSUBIMAGE1DPROC glad_debug_glTexSubImage1D = glad_debug_impl_glTexSubImage1D;
+static void APIENTRY glad_debug_impl_glTexSubImage2D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLenum arg7, const void * arg8) {
+	glad_glTexSubImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexSubImage2D", "eiiiiieep", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (unsigned int)arg6, (unsigned int)arg7, (const void*)arg8);
+	gl_debug_check_error("glTexSubImage2D");
+}
+PFNGLTEXSUBIMAGE2DPROC glad_debug_glTexSubImage2D = glad_debug_impl_glTexSubImage2D;
+static void APIENTRY glad_debug_impl_glTexSubImage3D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLenum arg9, const void * arg10) {
+	glad_glTexSubImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+	if (gl_debug_tracing) gl_debug_trace_call("glTexSubImage3D", "eiiiiiiieep", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6, (int)arg7, (unsigned int)arg8, (unsigned int)arg9, (const void*)arg10);
+	gl_debug_check_error("glTexSubImage3D");
+}
+PFNGLTEXSUBIMAGE3DPROC glad_debug_glTexSubImage3D = glad_debug_impl_glTexSubImage3D;
+static void APIENTRY glad_debug_impl_glTextureBarrier(void) {
+	glad_glTextureBarrier();
+	if (gl_debug_tracing) gl_debug_trace_call("glTextureBarrier", "");
+	gl_debug_check_error("glTextureBarrier");
+}
+PFNGLTEXTUREBARRIERPROC glad_debug_glTextureBarrier = glad_debug_impl_glTextureBarrier;
+static void APIENTRY glad_debug_impl_glTextureBuffer(GLuint arg0, GLenum arg1, GLuint arg2) {
+	glad_glTextureBuffer(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTextureBuffer", "ueu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glTextureBuffer");
+}
+PFNGLTEXTUREBUFFERPROC glad_debug_glTextureBuffer = glad_debug_impl_glTextureBuffer;
+static void APIENTRY glad_debug_impl_glTextureBufferRange(GLuint arg0, GLenum arg1, GLuint arg2, GLintptr arg3, GLsizeiptr arg4) {
+	glad_glTextureBufferRange(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glTextureBufferRange", "ueull", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (long long)arg3, (long long)arg4);
+	gl_debug_check_error("glTextureBufferRange");
+}
+PFNGLTEXTUREBUFFERRANGEPROC glad_debug_glTextureBufferRange = glad_debug_impl_glTextureBufferRange;
+static void APIENTRY glad_debug_impl_glTextureParameterIiv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+	glad_glTextureParameterIiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTextureParameterIiv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glTextureParameterIiv");
+}
+PFNGLTEXTUREPARAMETERIIVPROC glad_debug_glTextureParameterIiv = glad_debug_impl_glTextureParameterIiv;
+static void APIENTRY glad_debug_impl_glTextureParameterIuiv(GLuint arg0, GLenum arg1, const GLuint * arg2) {
+	glad_glTextureParameterIuiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTextureParameterIuiv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glTextureParameterIuiv");
+}
+PFNGLTEXTUREPARAMETERIUIVPROC glad_debug_glTextureParameterIuiv = glad_debug_impl_glTextureParameterIuiv;
+static void APIENTRY glad_debug_impl_glTextureParameterf(GLuint arg0, GLenum arg1, GLfloat arg2) {
+	glad_glTextureParameterf(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTextureParameterf", "uef", (unsigned int)arg0, (unsigned int)arg1, (double)arg2);
+	gl_debug_check_error("glTextureParameterf");
+}
+PFNGLTEXTUREPARAMETERFPROC glad_debug_glTextureParameterf = glad_debug_impl_glTextureParameterf;
+static void APIENTRY glad_debug_impl_glTextureParameterfv(GLuint arg0, GLenum arg1, const GLfloat * arg2) {
+	glad_glTextureParameterfv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTextureParameterfv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glTextureParameterfv");
+}
+PFNGLTEXTUREPARAMETERFVPROC glad_debug_glTextureParameterfv = glad_debug_impl_glTextureParameterfv;
+static void APIENTRY glad_debug_impl_glTextureParameteri(GLuint arg0, GLenum arg1, GLint arg2) {
+	glad_glTextureParameteri(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTextureParameteri", "uei", (unsigned int)arg0, (unsigned int)arg1, (int)arg2);
+	gl_debug_check_error("glTextureParameteri");
+}
+PFNGLTEXTUREPARAMETERIPROC glad_debug_glTextureParameteri = glad_debug_impl_glTextureParameteri;
+static void APIENTRY glad_debug_impl_glTextureParameteriv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+	glad_glTextureParameteriv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTextureParameteriv", "uep", (unsigned int)arg0, (unsigned int)arg1, (const void*)arg2);
+	gl_debug_check_error("glTextureParameteriv");
+}
+PFNGLTEXTUREPARAMETERIVPROC glad_debug_glTextureParameteriv = glad_debug_impl_glTextureParameteriv;
+static void APIENTRY glad_debug_impl_glTextureStorage1D(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3) {
+	glad_glTextureStorage1D(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glTextureStorage1D", "uiei", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3);
+	gl_debug_check_error("glTextureStorage1D");
+}
+PFNGLTEXTURESTORAGE1DPROC glad_debug_glTextureStorage1D = glad_debug_impl_glTextureStorage1D;
+static void APIENTRY glad_debug_impl_glTextureStorage2D(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4) {
+	glad_glTextureStorage2D(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glTextureStorage2D", "uieii", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4);
+	gl_debug_check_error("glTextureStorage2D");
+}
+PFNGLTEXTURESTORAGE2DPROC glad_debug_glTextureStorage2D = glad_debug_impl_glTextureStorage2D;
+static void APIENTRY glad_debug_impl_glTextureStorage2DMultisample(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLboolean arg5) {
+	glad_glTextureStorage2DMultisample(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glTextureStorage2DMultisample", "uieiib", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4, (int)arg5);
+	gl_debug_check_error("glTextureStorage2DMultisample");
+}
+PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_debug_glTextureStorage2DMultisample = glad_debug_impl_glTextureStorage2DMultisample;
+static void APIENTRY glad_debug_impl_glTextureStorage3D(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5) {
+	glad_glTextureStorage3D(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glTextureStorage3D", "uieiii", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4, (int)arg5);
+	gl_debug_check_error("glTextureStorage3D");
+}
+PFNGLTEXTURESTORAGE3DPROC glad_debug_glTextureStorage3D = glad_debug_impl_glTextureStorage3D;
+static void APIENTRY glad_debug_impl_glTextureStorage3DMultisample(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLboolean arg6) {
+	glad_glTextureStorage3DMultisample(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glTextureStorage3DMultisample", "uieiiib", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6);
+	gl_debug_check_error("glTextureStorage3DMultisample");
+}
+PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_debug_glTextureStorage3DMultisample = glad_debug_impl_glTextureStorage3DMultisample;
+static void APIENTRY glad_debug_impl_glTextureSubImage1D(GLuint arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLenum arg5, const void * arg6) {
+	glad_glTextureSubImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+	if (gl_debug_tracing) gl_debug_trace_call("glTextureSubImage1D", "uiiieep", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (unsigned int)arg4, (unsigned int)arg5, (const void*)arg6);
+	gl_debug_check_error("glTextureSubImage1D");
+}
+PFNGLTEXTURESUBIMAGE1DPROC glad_debug_glTextureSubImage1D = glad_debug_impl_glTextureSubImage1D;
+static void APIENTRY glad_debug_impl_glTextureSubImage2D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLenum arg7, const void * arg8) {
+	glad_glTextureSubImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+	if (gl_debug_tracing) gl_debug_trace_call("glTextureSubImage2D", "uiiiiieep", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (unsigned int)arg6, (unsigned int)arg7, (const void*)arg8);
+	gl_debug_check_error("glTextureSubImage2D");
+}
+PFNGLTEXTURESUBIMAGE2DPROC glad_debug_glTextureSubImage2D = glad_debug_impl_glTextureSubImage2D;
+static void APIENTRY glad_debug_impl_glTextureSubImage3D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLenum arg9, const void * arg10) {
+	glad_glTextureSubImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+	if (gl_debug_tracing) gl_debug_trace_call("glTextureSubImage3D", "uiiiiiiieep", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4, (int)arg5, (int)arg6, (int)arg7, (unsigned int)arg8, (unsigned int)arg9, (const void*)arg10);
+	gl_debug_check_error("glTextureSubImage3D");
+}
+PFNGLTEXTURESUBIMAGE3DPROC glad_debug_glTextureSubImage3D = glad_debug_impl_glTextureSubImage3D;
+static void APIENTRY glad_debug_impl_glTextureView(GLuint arg0, GLenum arg1, GLuint arg2, GLenum arg3, GLuint arg4, GLuint arg5, GLuint arg6, GLuint arg7) {
+	glad_glTextureView(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+	if (gl_debug_tracing) gl_debug_trace_call("glTextureView", "ueueuuuu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (unsigned int)arg3, (unsigned int)arg4, (unsigned int)arg5, (unsigned int)arg6, (unsigned int)arg7);
+	gl_debug_check_error("glTextureView");
+}
+PFNGLTEXTUREVIEWPROC glad_debug_glTextureView = glad_debug_impl_glTextureView;
+static void APIENTRY glad_debug_impl_glTransformFeedbackBufferBase(GLuint arg0, GLuint arg1, GLuint arg2) {
+	glad_glTransformFeedbackBufferBase(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTransformFeedbackBufferBase", "uuu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glTransformFeedbackBufferBase");
+}
+PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_debug_glTransformFeedbackBufferBase = glad_debug_impl_glTransformFeedbackBufferBase;
+static void APIENTRY glad_debug_impl_glTransformFeedbackBufferRange(GLuint arg0, GLuint arg1, GLuint arg2, GLintptr arg3, GLsizeiptr arg4) {
+	glad_glTransformFeedbackBufferRange(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glTransformFeedbackBufferRange", "uuull", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (long long)arg3, (long long)arg4);
+	gl_debug_check_error("glTransformFeedbackBufferRange");
+}
+PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_debug_glTransformFeedbackBufferRange = glad_debug_impl_glTransformFeedbackBufferRange;
+static void APIENTRY glad_debug_impl_glTransformFeedbackVaryings(GLuint arg0, GLsizei arg1, const GLchar *const * arg2, GLenum arg3) {
+	glad_glTransformFeedbackVaryings(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glTransformFeedbackVaryings", "uipe", (unsigned int)arg0, (int)arg1, (const void*)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glTransformFeedbackVaryings");
+}
+PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_debug_glTransformFeedbackVaryings = glad_debug_impl_glTransformFeedbackVaryings;
+static void APIENTRY glad_debug_impl_glTranslated(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	glad_glTranslated(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTranslated", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glTranslated");
+}
+PFNGLTRANSLATEDPROC glad_debug_glTranslated = glad_debug_impl_glTranslated;
+static void APIENTRY glad_debug_impl_glTranslatef(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	glad_glTranslatef(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glTranslatef", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glTranslatef");
+}
+PFNGLTRANSLATEFPROC glad_debug_glTranslatef = glad_debug_impl_glTranslatef;
+static void APIENTRY glad_debug_impl_glUniform1d(GLint arg0, GLdouble arg1) {
+	glad_glUniform1d(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform1d", "if", (int)arg0, (double)arg1);
+	gl_debug_check_error("glUniform1d");
+}
+PFNGLUNIFORM1DPROC glad_debug_glUniform1d = glad_debug_impl_glUniform1d;
+static void APIENTRY glad_debug_impl_glUniform1dv(GLint arg0, GLsizei arg1, const GLdouble * arg2) {
+	glad_glUniform1dv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform1dv", "iip", (int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glUniform1dv");
+}
+PFNGLUNIFORM1DVPROC glad_debug_glUniform1dv = glad_debug_impl_glUniform1dv;
+static void APIENTRY glad_debug_impl_glUniform1f(GLint arg0, GLfloat arg1) {
+	glad_glUniform1f(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform1f", "if", (int)arg0, (double)arg1);
+	gl_debug_check_error("glUniform1f");
+}
+PFNGLUNIFORM1FPROC glad_debug_glUniform1f = glad_debug_impl_glUniform1f;
+static void APIENTRY glad_debug_impl_glUniform1fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+	glad_glUniform1fv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform1fv", "iip", (int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glUniform1fv");
+}
+PFNGLUNIFORM1FVPROC glad_debug_glUniform1fv = glad_debug_impl_glUniform1fv;
+static void APIENTRY glad_debug_impl_glUniform1i(GLint arg0, GLint arg1) {
+	glad_glUniform1i(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform1i", "ii", (int)arg0, (int)arg1);
+	gl_debug_check_error("glUniform1i");
+}
+PFNGLUNIFORM1IPROC glad_debug_glUniform1i = glad_debug_impl_glUniform1i;
+static void APIENTRY glad_debug_impl_glUniform1iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+	glad_glUniform1iv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform1iv", "iip", (int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glUniform1iv");
+}
+PFNGLUNIFORM1IVPROC glad_debug_glUniform1iv = glad_debug_impl_glUniform1iv;
+static void APIENTRY glad_debug_impl_glUniform1ui(GLint arg0, GLuint arg1) {
+	glad_glUniform1ui(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform1ui", "iu", (int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glUniform1ui");
+}
+PFNGLUNIFORM1UIPROC glad_debug_glUniform1ui = glad_debug_impl_glUniform1ui;
+static void APIENTRY glad_debug_impl_glUniform1uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+	glad_glUniform1uiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform1uiv", "iip", (int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glUniform1uiv");
+}
+PFNGLUNIFORM1UIVPROC glad_debug_glUniform1uiv = glad_debug_impl_glUniform1uiv;
+static void APIENTRY glad_debug_impl_glUniform2d(GLint arg0, GLdouble arg1, GLdouble arg2) {
+	glad_glUniform2d(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform2d", "iff", (int)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glUniform2d");
+}
+PFNGLUNIFORM2DPROC glad_debug_glUniform2d = glad_debug_impl_glUniform2d;
+static void APIENTRY glad_debug_impl_glUniform2dv(GLint arg0, GLsizei arg1, const GLdouble * arg2) {
+	glad_glUniform2dv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform2dv", "iip", (int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glUniform2dv");
+}
+PFNGLUNIFORM2DVPROC glad_debug_glUniform2dv = glad_debug_impl_glUniform2dv;
+static void APIENTRY glad_debug_impl_glUniform2f(GLint arg0, GLfloat arg1, GLfloat arg2) {
+	glad_glUniform2f(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform2f", "iff", (int)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glUniform2f");
+}
+PFNGLUNIFORM2FPROC glad_debug_glUniform2f = glad_debug_impl_glUniform2f;
+static void APIENTRY glad_debug_impl_glUniform2fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+	glad_glUniform2fv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform2fv", "iip", (int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glUniform2fv");
+}
+PFNGLUNIFORM2FVPROC glad_debug_glUniform2fv = glad_debug_impl_glUniform2fv;
+static void APIENTRY glad_debug_impl_glUniform2i(GLint arg0, GLint arg1, GLint arg2) {
+	glad_glUniform2i(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform2i", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glUniform2i");
+}
+PFNGLUNIFORM2IPROC glad_debug_glUniform2i = glad_debug_impl_glUniform2i;
+static void APIENTRY glad_debug_impl_glUniform2iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+	glad_glUniform2iv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform2iv", "iip", (int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glUniform2iv");
+}
+PFNGLUNIFORM2IVPROC glad_debug_glUniform2iv = glad_debug_impl_glUniform2iv;
+static void APIENTRY glad_debug_impl_glUniform2ui(GLint arg0, GLuint arg1, GLuint arg2) {
+	glad_glUniform2ui(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform2ui", "iuu", (int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glUniform2ui");
+}
+PFNGLUNIFORM2UIPROC glad_debug_glUniform2ui = glad_debug_impl_glUniform2ui;
+static void APIENTRY glad_debug_impl_glUniform2uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+	glad_glUniform2uiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform2uiv", "iip", (int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glUniform2uiv");
+}
+PFNGLUNIFORM2UIVPROC glad_debug_glUniform2uiv = glad_debug_impl_glUniform2uiv;
+static void APIENTRY glad_debug_impl_glUniform3d(GLint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	glad_glUniform3d(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform3d", "ifff", (int)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glUniform3d");
+}
+PFNGLUNIFORM3DPROC glad_debug_glUniform3d = glad_debug_impl_glUniform3d;
+static void APIENTRY glad_debug_impl_glUniform3dv(GLint arg0, GLsizei arg1, const GLdouble * arg2) {
+	glad_glUniform3dv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform3dv", "iip", (int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glUniform3dv");
+}
+PFNGLUNIFORM3DVPROC glad_debug_glUniform3dv = glad_debug_impl_glUniform3dv;
+static void APIENTRY glad_debug_impl_glUniform3f(GLint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	glad_glUniform3f(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform3f", "ifff", (int)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glUniform3f");
+}
+PFNGLUNIFORM3FPROC glad_debug_glUniform3f = glad_debug_impl_glUniform3f;
+static void APIENTRY glad_debug_impl_glUniform3fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+	glad_glUniform3fv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform3fv", "iip", (int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glUniform3fv");
+}
+PFNGLUNIFORM3FVPROC glad_debug_glUniform3fv = glad_debug_impl_glUniform3fv;
+static void APIENTRY glad_debug_impl_glUniform3i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	glad_glUniform3i(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform3i", "iiii", (int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glUniform3i");
+}
+PFNGLUNIFORM3IPROC glad_debug_glUniform3i = glad_debug_impl_glUniform3i;
+static void APIENTRY glad_debug_impl_glUniform3iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+	glad_glUniform3iv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform3iv", "iip", (int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glUniform3iv");
+}
+PFNGLUNIFORM3IVPROC glad_debug_glUniform3iv = glad_debug_impl_glUniform3iv;
+static void APIENTRY glad_debug_impl_glUniform3ui(GLint arg0, GLuint arg1, GLuint arg2, GLuint arg3) {
+	glad_glUniform3ui(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform3ui", "iuuu", (int)arg0, (unsigned int)arg1, (unsigned int)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glUniform3ui");
+}
+PFNGLUNIFORM3UIPROC glad_debug_glUniform3ui = glad_debug_impl_glUniform3ui;
+static void APIENTRY glad_debug_impl_glUniform3uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+	glad_glUniform3uiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform3uiv", "iip", (int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glUniform3uiv");
+}
+PFNGLUNIFORM3UIVPROC glad_debug_glUniform3uiv = glad_debug_impl_glUniform3uiv;
+static void APIENTRY glad_debug_impl_glUniform4d(GLint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	glad_glUniform4d(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform4d", "iffff", (int)arg0, (double)arg1, (double)arg2, (double)arg3, (double)arg4);
+	gl_debug_check_error("glUniform4d");
+}
+PFNGLUNIFORM4DPROC glad_debug_glUniform4d = glad_debug_impl_glUniform4d;
+static void APIENTRY glad_debug_impl_glUniform4dv(GLint arg0, GLsizei arg1, const GLdouble * arg2) {
+	glad_glUniform4dv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform4dv", "iip", (int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glUniform4dv");
+}
+PFNGLUNIFORM4DVPROC glad_debug_glUniform4dv = glad_debug_impl_glUniform4dv;
+static void APIENTRY glad_debug_impl_glUniform4f(GLint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	glad_glUniform4f(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform4f", "iffff", (int)arg0, (double)arg1, (double)arg2, (double)arg3, (double)arg4);
+	gl_debug_check_error("glUniform4f");
+}
+PFNGLUNIFORM4FPROC glad_debug_glUniform4f = glad_debug_impl_glUniform4f;
+static void APIENTRY glad_debug_impl_glUniform4fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+	glad_glUniform4fv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform4fv", "iip", (int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glUniform4fv");
+}
+PFNGLUNIFORM4FVPROC glad_debug_glUniform4fv = glad_debug_impl_glUniform4fv;
+static void APIENTRY glad_debug_impl_glUniform4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	glad_glUniform4i(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform4i", "iiiii", (int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4);
+	gl_debug_check_error("glUniform4i");
+}
+PFNGLUNIFORM4IPROC glad_debug_glUniform4i = glad_debug_impl_glUniform4i;
+static void APIENTRY glad_debug_impl_glUniform4iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+	glad_glUniform4iv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform4iv", "iip", (int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glUniform4iv");
+}
+PFNGLUNIFORM4IVPROC glad_debug_glUniform4iv = glad_debug_impl_glUniform4iv;
+static void APIENTRY glad_debug_impl_glUniform4ui(GLint arg0, GLuint arg1, GLuint arg2, GLuint arg3, GLuint arg4) {
+	glad_glUniform4ui(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform4ui", "iuuuu", (int)arg0, (unsigned int)arg1, (unsigned int)arg2, (unsigned int)arg3, (unsigned int)arg4);
+	gl_debug_check_error("glUniform4ui");
+}
+PFNGLUNIFORM4UIPROC glad_debug_glUniform4ui = glad_debug_impl_glUniform4ui;
+static void APIENTRY glad_debug_impl_glUniform4uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+	glad_glUniform4uiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniform4uiv", "iip", (int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glUniform4uiv");
+}
+PFNGLUNIFORM4UIVPROC glad_debug_glUniform4uiv = glad_debug_impl_glUniform4uiv;
+static void APIENTRY glad_debug_impl_glUniformBlockBinding(GLuint arg0, GLuint arg1, GLuint arg2) {
+	glad_glUniformBlockBinding(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformBlockBinding", "uuu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glUniformBlockBinding");
+}
+PFNGLUNIFORMBLOCKBINDINGPROC glad_debug_glUniformBlockBinding = glad_debug_impl_glUniformBlockBinding;
+static void APIENTRY glad_debug_impl_glUniformHandleui64ARB(GLint arg0, GLuint64 arg1) {
+	glad_glUniformHandleui64ARB(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformHandleui64ARB", "iL", (int)arg0, (unsigned long long)arg1);
+	gl_debug_check_error("glUniformHandleui64ARB");
+}
+PFNGLUNIFORMHANDLEUI64ARBPROC glad_debug_glUniformHandleui64ARB = glad_debug_impl_glUniformHandleui64ARB;
+static void APIENTRY glad_debug_impl_glUniformHandleui64vARB(GLint arg0, GLsizei arg1, const GLuint64 * arg2) {
+	glad_glUniformHandleui64vARB(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformHandleui64vARB", "iip", (int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glUniformHandleui64vARB");
+}
+PFNGLUNIFORMHANDLEUI64VARBPROC glad_debug_glUniformHandleui64vARB = glad_debug_impl_glUniformHandleui64vARB;
+static void APIENTRY glad_debug_impl_glUniformMatrix2dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	glad_glUniformMatrix2dv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformMatrix2dv", "iibp", (int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glUniformMatrix2dv");
+}
+PFNGLUNIFORMMATRIX2DVPROC glad_debug_glUniformMatrix2dv = glad_debug_impl_glUniformMatrix2dv;
+static void APIENTRY glad_debug_impl_glUniformMatrix2fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	glad_glUniformMatrix2fv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformMatrix2fv", "iibp", (int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glUniformMatrix2fv");
+}
+PFNGLUNIFORMMATRIX2FVPROC glad_debug_glUniformMatrix2fv = glad_debug_impl_glUniformMatrix2fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix2x3dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	glad_glUniformMatrix2x3dv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformMatrix2x3dv", "iibp", (int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glUniformMatrix2x3dv");
+}
+PFNGLUNIFORMMATRIX2X3DVPROC glad_debug_glUniformMatrix2x3dv = glad_debug_impl_glUniformMatrix2x3dv;
+static void APIENTRY glad_debug_impl_glUniformMatrix2x3fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	glad_glUniformMatrix2x3fv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformMatrix2x3fv", "iibp", (int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glUniformMatrix2x3fv");
+}
+PFNGLUNIFORMMATRIX2X3FVPROC glad_debug_glUniformMatrix2x3fv = glad_debug_impl_glUniformMatrix2x3fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix2x4dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	glad_glUniformMatrix2x4dv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformMatrix2x4dv", "iibp", (int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glUniformMatrix2x4dv");
+}
+PFNGLUNIFORMMATRIX2X4DVPROC glad_debug_glUniformMatrix2x4dv = glad_debug_impl_glUniformMatrix2x4dv;
+static void APIENTRY glad_debug_impl_glUniformMatrix2x4fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	glad_glUniformMatrix2x4fv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformMatrix2x4fv", "iibp", (int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glUniformMatrix2x4fv");
+}
+PFNGLUNIFORMMATRIX2X4FVPROC glad_debug_glUniformMatrix2x4fv = glad_debug_impl_glUniformMatrix2x4fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix3dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	glad_glUniformMatrix3dv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformMatrix3dv", "iibp", (int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glUniformMatrix3dv");
+}
+PFNGLUNIFORMMATRIX3DVPROC glad_debug_glUniformMatrix3dv = glad_debug_impl_glUniformMatrix3dv;
+static void APIENTRY glad_debug_impl_glUniformMatrix3fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	glad_glUniformMatrix3fv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformMatrix3fv", "iibp", (int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glUniformMatrix3fv");
+}
+PFNGLUNIFORMMATRIX3FVPROC glad_debug_glUniformMatrix3fv = glad_debug_impl_glUniformMatrix3fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix3x2dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	glad_glUniformMatrix3x2dv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformMatrix3x2dv", "iibp", (int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glUniformMatrix3x2dv");
+}
+PFNGLUNIFORMMATRIX3X2DVPROC glad_debug_glUniformMatrix3x2dv = glad_debug_impl_glUniformMatrix3x2dv;
+static void APIENTRY glad_debug_impl_glUniformMatrix3x2fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	glad_glUniformMatrix3x2fv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformMatrix3x2fv", "iibp", (int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glUniformMatrix3x2fv");
+}
+PFNGLUNIFORMMATRIX3X2FVPROC glad_debug_glUniformMatrix3x2fv = glad_debug_impl_glUniformMatrix3x2fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix3x4dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	glad_glUniformMatrix3x4dv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformMatrix3x4dv", "iibp", (int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glUniformMatrix3x4dv");
+}
+PFNGLUNIFORMMATRIX3X4DVPROC glad_debug_glUniformMatrix3x4dv = glad_debug_impl_glUniformMatrix3x4dv;
+static void APIENTRY glad_debug_impl_glUniformMatrix3x4fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	glad_glUniformMatrix3x4fv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformMatrix3x4fv", "iibp", (int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glUniformMatrix3x4fv");
+}
+PFNGLUNIFORMMATRIX3X4FVPROC glad_debug_glUniformMatrix3x4fv = glad_debug_impl_glUniformMatrix3x4fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix4dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	glad_glUniformMatrix4dv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformMatrix4dv", "iibp", (int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glUniformMatrix4dv");
+}
+PFNGLUNIFORMMATRIX4DVPROC glad_debug_glUniformMatrix4dv = glad_debug_impl_glUniformMatrix4dv;
+static void APIENTRY glad_debug_impl_glUniformMatrix4fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	glad_glUniformMatrix4fv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformMatrix4fv", "iibp", (int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glUniformMatrix4fv");
+}
+PFNGLUNIFORMMATRIX4FVPROC glad_debug_glUniformMatrix4fv = glad_debug_impl_glUniformMatrix4fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix4x2dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	glad_glUniformMatrix4x2dv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformMatrix4x2dv", "iibp", (int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glUniformMatrix4x2dv");
+}
+PFNGLUNIFORMMATRIX4X2DVPROC glad_debug_glUniformMatrix4x2dv = glad_debug_impl_glUniformMatrix4x2dv;
+static void APIENTRY glad_debug_impl_glUniformMatrix4x2fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	glad_glUniformMatrix4x2fv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformMatrix4x2fv", "iibp", (int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glUniformMatrix4x2fv");
+}
+PFNGLUNIFORMMATRIX4X2FVPROC glad_debug_glUniformMatrix4x2fv = glad_debug_impl_glUniformMatrix4x2fv;
+static void APIENTRY glad_debug_impl_glUniformMatrix4x3dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	glad_glUniformMatrix4x3dv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformMatrix4x3dv", "iibp", (int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glUniformMatrix4x3dv");
+}
+PFNGLUNIFORMMATRIX4X3DVPROC glad_debug_glUniformMatrix4x3dv = glad_debug_impl_glUniformMatrix4x3dv;
+static void APIENTRY glad_debug_impl_glUniformMatrix4x3fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	glad_glUniformMatrix4x3fv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformMatrix4x3fv", "iibp", (int)arg0, (int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glUniformMatrix4x3fv");
+}
+PFNGLUNIFORMMATRIX4X3FVPROC glad_debug_glUniformMatrix4x3fv = glad_debug_impl_glUniformMatrix4x3fv;
+static void APIENTRY glad_debug_impl_glUniformSubroutinesuiv(GLenum arg0, GLsizei arg1, const GLuint * arg2) {
+	glad_glUniformSubroutinesuiv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUniformSubroutinesuiv", "eip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glUniformSubroutinesuiv");
+}
+PFNGLUNIFORMSUBROUTINESUIVPROC glad_debug_glUniformSubroutinesuiv = glad_debug_impl_glUniformSubroutinesuiv;
+static GLboolean APIENTRY glad_debug_impl_glUnmapBuffer(GLenum arg0) {
+	GLboolean ret;
+	ret = glad_glUnmapBuffer(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glUnmapBuffer", "e", (unsigned int)arg0);
+	gl_debug_check_error("glUnmapBuffer");
+	return ret;
+}
+PFNGLUNMAPBUFFERPROC glad_debug_glUnmapBuffer = glad_debug_impl_glUnmapBuffer;
+static GLboolean APIENTRY glad_debug_impl_glUnmapNamedBuffer(GLuint arg0) {
+	GLboolean ret;
+	ret = glad_glUnmapNamedBuffer(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glUnmapNamedBuffer", "u", (unsigned int)arg0);
+	gl_debug_check_error("glUnmapNamedBuffer");
+	return ret;
+}
+PFNGLUNMAPNAMEDBUFFERPROC glad_debug_glUnmapNamedBuffer = glad_debug_impl_glUnmapNamedBuffer;
+static void APIENTRY glad_debug_impl_glUseProgram(GLuint arg0) {
+	glad_glUseProgram(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glUseProgram", "u", (unsigned int)arg0);
+	gl_debug_check_error("glUseProgram");
+}
+PFNGLUSEPROGRAMPROC glad_debug_glUseProgram = glad_debug_impl_glUseProgram;
+static void APIENTRY glad_debug_impl_glUseProgramStages(GLuint arg0, GLbitfield arg1, GLuint arg2) {
+	glad_glUseProgramStages(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glUseProgramStages", "uuu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glUseProgramStages");
+}
+PFNGLUSEPROGRAMSTAGESPROC glad_debug_glUseProgramStages = glad_debug_impl_glUseProgramStages;
+static void APIENTRY glad_debug_impl_glValidateProgram(GLuint arg0) {
+	glad_glValidateProgram(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glValidateProgram", "u", (unsigned int)arg0);
+	gl_debug_check_error("glValidateProgram");
+}
+PFNGLVALIDATEPROGRAMPROC glad_debug_glValidateProgram = glad_debug_impl_glValidateProgram;
+static void APIENTRY glad_debug_impl_glValidateProgramPipeline(GLuint arg0) {
+	glad_glValidateProgramPipeline(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glValidateProgramPipeline", "u", (unsigned int)arg0);
+	gl_debug_check_error("glValidateProgramPipeline");
+}
+PFNGLVALIDATEPROGRAMPIPELINEPROC glad_debug_glValidateProgramPipeline = glad_debug_impl_glValidateProgramPipeline;
+static void APIENTRY glad_debug_impl_glVertex2d(GLdouble arg0, GLdouble arg1) {
+	glad_glVertex2d(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex2d", "ff", (double)arg0, (double)arg1);
+	gl_debug_check_error("glVertex2d");
+}
+PFNGLVERTEX2DPROC glad_debug_glVertex2d = glad_debug_impl_glVertex2d;
+static void APIENTRY glad_debug_impl_glVertex2dv(const GLdouble * arg0) {
+	glad_glVertex2dv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex2dv", "p", (const void*)arg0);
+	gl_debug_check_error("glVertex2dv");
+}
+PFNGLVERTEX2DVPROC glad_debug_glVertex2dv = glad_debug_impl_glVertex2dv;
+static void APIENTRY glad_debug_impl_glVertex2f(GLfloat arg0, GLfloat arg1) {
+	glad_glVertex2f(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex2f", "ff", (double)arg0, (double)arg1);
+	gl_debug_check_error("glVertex2f");
+}
+PFNGLVERTEX2FPROC glad_debug_glVertex2f = glad_debug_impl_glVertex2f;
+static void APIENTRY glad_debug_impl_glVertex2fv(const GLfloat * arg0) {
+	glad_glVertex2fv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex2fv", "p", (const void*)arg0);
+	gl_debug_check_error("glVertex2fv");
+}
+PFNGLVERTEX2FVPROC glad_debug_glVertex2fv = glad_debug_impl_glVertex2fv;
+static void APIENTRY glad_debug_impl_glVertex2i(GLint arg0, GLint arg1) {
+	glad_glVertex2i(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex2i", "ii", (int)arg0, (int)arg1);
+	gl_debug_check_error("glVertex2i");
+}
+PFNGLVERTEX2IPROC glad_debug_glVertex2i = glad_debug_impl_glVertex2i;
+static void APIENTRY glad_debug_impl_glVertex2iv(const GLint * arg0) {
+	glad_glVertex2iv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex2iv", "p", (const void*)arg0);
+	gl_debug_check_error("glVertex2iv");
+}
+PFNGLVERTEX2IVPROC glad_debug_glVertex2iv = glad_debug_impl_glVertex2iv;
+static void APIENTRY glad_debug_impl_glVertex2s(GLshort arg0, GLshort arg1) {
+	glad_glVertex2s(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex2s", "ii", (int)arg0, (int)arg1);
+	gl_debug_check_error("glVertex2s");
+}
+PFNGLVERTEX2SPROC glad_debug_glVertex2s = glad_debug_impl_glVertex2s;
+static void APIENTRY glad_debug_impl_glVertex2sv(const GLshort * arg0) {
+	glad_glVertex2sv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex2sv", "p", (const void*)arg0);
+	gl_debug_check_error("glVertex2sv");
+}
+PFNGLVERTEX2SVPROC glad_debug_glVertex2sv = glad_debug_impl_glVertex2sv;
+static void APIENTRY glad_debug_impl_glVertex3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	glad_glVertex3d(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex3d", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glVertex3d");
+}
+PFNGLVERTEX3DPROC glad_debug_glVertex3d = glad_debug_impl_glVertex3d;
+static void APIENTRY glad_debug_impl_glVertex3dv(const GLdouble * arg0) {
+	glad_glVertex3dv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex3dv", "p", (const void*)arg0);
+	gl_debug_check_error("glVertex3dv");
+}
+PFNGLVERTEX3DVPROC glad_debug_glVertex3dv = glad_debug_impl_glVertex3dv;
+static void APIENTRY glad_debug_impl_glVertex3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	glad_glVertex3f(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex3f", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glVertex3f");
+}
+PFNGLVERTEX3FPROC glad_debug_glVertex3f = glad_debug_impl_glVertex3f;
+static void APIENTRY glad_debug_impl_glVertex3fv(const GLfloat * arg0) {
+	glad_glVertex3fv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex3fv", "p", (const void*)arg0);
+	gl_debug_check_error("glVertex3fv");
+}
+PFNGLVERTEX3FVPROC glad_debug_glVertex3fv = glad_debug_impl_glVertex3fv;
+static void APIENTRY glad_debug_impl_glVertex3i(GLint arg0, GLint arg1, GLint arg2) {
+	glad_glVertex3i(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex3i", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glVertex3i");
+}
+PFNGLVERTEX3IPROC glad_debug_glVertex3i = glad_debug_impl_glVertex3i;
+static void APIENTRY glad_debug_impl_glVertex3iv(const GLint * arg0) {
+	glad_glVertex3iv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex3iv", "p", (const void*)arg0);
+	gl_debug_check_error("glVertex3iv");
+}
+PFNGLVERTEX3IVPROC glad_debug_glVertex3iv = glad_debug_impl_glVertex3iv;
+static void APIENTRY glad_debug_impl_glVertex3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	glad_glVertex3s(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex3s", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glVertex3s");
+}
+PFNGLVERTEX3SPROC glad_debug_glVertex3s = glad_debug_impl_glVertex3s;
+static void APIENTRY glad_debug_impl_glVertex3sv(const GLshort * arg0) {
+	glad_glVertex3sv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex3sv", "p", (const void*)arg0);
+	gl_debug_check_error("glVertex3sv");
+}
+PFNGLVERTEX3SVPROC glad_debug_glVertex3sv = glad_debug_impl_glVertex3sv;
+static void APIENTRY glad_debug_impl_glVertex4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	glad_glVertex4d(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex4d", "ffff", (double)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glVertex4d");
+}
+PFNGLVERTEX4DPROC glad_debug_glVertex4d = glad_debug_impl_glVertex4d;
+static void APIENTRY glad_debug_impl_glVertex4dv(const GLdouble * arg0) {
+	glad_glVertex4dv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex4dv", "p", (const void*)arg0);
+	gl_debug_check_error("glVertex4dv");
+}
+PFNGLVERTEX4DVPROC glad_debug_glVertex4dv = glad_debug_impl_glVertex4dv;
+static void APIENTRY glad_debug_impl_glVertex4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	glad_glVertex4f(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex4f", "ffff", (double)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glVertex4f");
+}
+PFNGLVERTEX4FPROC glad_debug_glVertex4f = glad_debug_impl_glVertex4f;
+static void APIENTRY glad_debug_impl_glVertex4fv(const GLfloat * arg0) {
+	glad_glVertex4fv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex4fv", "p", (const void*)arg0);
+	gl_debug_check_error("glVertex4fv");
+}
+PFNGLVERTEX4FVPROC glad_debug_glVertex4fv = glad_debug_impl_glVertex4fv;
+static void APIENTRY glad_debug_impl_glVertex4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	glad_glVertex4i(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex4i", "iiii", (int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glVertex4i");
+}
+PFNGLVERTEX4IPROC glad_debug_glVertex4i = glad_debug_impl_glVertex4i;
+static void APIENTRY glad_debug_impl_glVertex4iv(const GLint * arg0) {
+	glad_glVertex4iv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex4iv", "p", (const void*)arg0);
+	gl_debug_check_error("glVertex4iv");
+}
+PFNGLVERTEX4IVPROC glad_debug_glVertex4iv = glad_debug_impl_glVertex4iv;
+static void APIENTRY glad_debug_impl_glVertex4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	glad_glVertex4s(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex4s", "iiii", (int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glVertex4s");
+}
+PFNGLVERTEX4SPROC glad_debug_glVertex4s = glad_debug_impl_glVertex4s;
+static void APIENTRY glad_debug_impl_glVertex4sv(const GLshort * arg0) {
+	glad_glVertex4sv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertex4sv", "p", (const void*)arg0);
+	gl_debug_check_error("glVertex4sv");
+}
+PFNGLVERTEX4SVPROC glad_debug_glVertex4sv = glad_debug_impl_glVertex4sv;
+static void APIENTRY glad_debug_impl_glVertexArrayAttribBinding(GLuint arg0, GLuint arg1, GLuint arg2) {
+	glad_glVertexArrayAttribBinding(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexArrayAttribBinding", "uuu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glVertexArrayAttribBinding");
+}
+PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_debug_glVertexArrayAttribBinding = glad_debug_impl_glVertexArrayAttribBinding;
+static void APIENTRY glad_debug_impl_glVertexArrayAttribFormat(GLuint arg0, GLuint arg1, GLint arg2, GLenum arg3, GLboolean arg4, GLuint arg5) {
+	glad_glVertexArrayAttribFormat(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexArrayAttribFormat", "uuiebu", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (unsigned int)arg3, (int)arg4, (unsigned int)arg5);
+	gl_debug_check_error("glVertexArrayAttribFormat");
+}
+PFNGLVERTEXARRAYATTRIBFORMATPROC glad_debug_glVertexArrayAttribFormat = glad_debug_impl_glVertexArrayAttribFormat;
+static void APIENTRY glad_debug_impl_glVertexArrayAttribIFormat(GLuint arg0, GLuint arg1, GLint arg2, GLenum arg3, GLuint arg4) {
+	glad_glVertexArrayAttribIFormat(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexArrayAttribIFormat", "uuieu", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (unsigned int)arg3, (unsigned int)arg4);
+	gl_debug_check_error("glVertexArrayAttribIFormat");
+}
+PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_debug_glVertexArrayAttribIFormat = glad_debug_impl_glVertexArrayAttribIFormat;
+static void APIENTRY glad_debug_impl_glVertexArrayAttribLFormat(GLuint arg0, GLuint arg1, GLint arg2, GLenum arg3, GLuint arg4) {
+	glad_glVertexArrayAttribLFormat(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexArrayAttribLFormat", "uuieu", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (unsigned int)arg3, (unsigned int)arg4);
+	gl_debug_check_error("glVertexArrayAttribLFormat");
+}
+PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_debug_glVertexArrayAttribLFormat = glad_debug_impl_glVertexArrayAttribLFormat;
+static void APIENTRY glad_debug_impl_glVertexArrayBindingDivisor(GLuint arg0, GLuint arg1, GLuint arg2) {
+	glad_glVertexArrayBindingDivisor(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexArrayBindingDivisor", "uuu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glVertexArrayBindingDivisor");
+}
+PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_debug_glVertexArrayBindingDivisor = glad_debug_impl_glVertexArrayBindingDivisor;
+static void APIENTRY glad_debug_impl_glVertexArrayElementBuffer(GLuint arg0, GLuint arg1) {
+	glad_glVertexArrayElementBuffer(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexArrayElementBuffer", "uu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glVertexArrayElementBuffer");
+}
+PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_debug_glVertexArrayElementBuffer = glad_debug_impl_glVertexArrayElementBuffer;
+static void APIENTRY glad_debug_impl_glVertexArrayVertexBuffer(GLuint arg0, GLuint arg1, GLuint arg2, GLintptr arg3, GLsizei arg4) {
+	glad_glVertexArrayVertexBuffer(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexArrayVertexBuffer", "uuuli", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (long long)arg3, (int)arg4);
+	gl_debug_check_error("glVertexArrayVertexBuffer");
+}
+PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_debug_glVertexArrayVertexBuffer = glad_debug_impl_glVertexArrayVertexBuffer;
+static void APIENTRY glad_debug_impl_glVertexArrayVertexBuffers(GLuint arg0, GLuint arg1, GLsizei arg2, const GLuint * arg3, const GLintptr * arg4, const GLsizei * arg5) {
+	glad_glVertexArrayVertexBuffers(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexArrayVertexBuffers", "uuippp", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3, (const void*)arg4, (const void*)arg5);
+	gl_debug_check_error("glVertexArrayVertexBuffers");
+}
+PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_debug_glVertexArrayVertexBuffers = glad_debug_impl_glVertexArrayVertexBuffers;
+static void APIENTRY glad_debug_impl_glVertexAttrib1d(GLuint arg0, GLdouble arg1) {
+	glad_glVertexAttrib1d(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib1d", "uf", (unsigned int)arg0, (double)arg1);
+	gl_debug_check_error("glVertexAttrib1d");
+}
+PFNGLVERTEXATTRIB1DPROC glad_debug_glVertexAttrib1d = glad_debug_impl_glVertexAttrib1d;
+static void APIENTRY glad_debug_impl_glVertexAttrib1dv(GLuint arg0, const GLdouble * arg1) {
+	glad_glVertexAttrib1dv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib1dv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib1dv");
+}
+PFNGLVERTEXATTRIB1DVPROC glad_debug_glVertexAttrib1dv = glad_debug_impl_glVertexAttrib1dv;
+static void APIENTRY glad_debug_impl_glVertexAttrib1f(GLuint arg0, GLfloat arg1) {
+	glad_glVertexAttrib1f(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib1f", "uf", (unsigned int)arg0, (double)arg1);
+	gl_debug_check_error("glVertexAttrib1f");
+}
+PFNGLVERTEXATTRIB1FPROC glad_debug_glVertexAttrib1f = glad_debug_impl_glVertexAttrib1f;
+static void APIENTRY glad_debug_impl_glVertexAttrib1fv(GLuint arg0, const GLfloat * arg1) {
+	glad_glVertexAttrib1fv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib1fv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib1fv");
+}
+PFNGLVERTEXATTRIB1FVPROC glad_debug_glVertexAttrib1fv = glad_debug_impl_glVertexAttrib1fv;
+static void APIENTRY glad_debug_impl_glVertexAttrib1s(GLuint arg0, GLshort arg1) {
+	glad_glVertexAttrib1s(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib1s", "ui", (unsigned int)arg0, (int)arg1);
+	gl_debug_check_error("glVertexAttrib1s");
+}
+PFNGLVERTEXATTRIB1SPROC glad_debug_glVertexAttrib1s = glad_debug_impl_glVertexAttrib1s;
+static void APIENTRY glad_debug_impl_glVertexAttrib1sv(GLuint arg0, const GLshort * arg1) {
+	glad_glVertexAttrib1sv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib1sv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib1sv");
+}
+PFNGLVERTEXATTRIB1SVPROC glad_debug_glVertexAttrib1sv = glad_debug_impl_glVertexAttrib1sv;
+static void APIENTRY glad_debug_impl_glVertexAttrib2d(GLuint arg0, GLdouble arg1, GLdouble arg2) {
+	glad_glVertexAttrib2d(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib2d", "uff", (unsigned int)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glVertexAttrib2d");
+}
+PFNGLVERTEXATTRIB2DPROC glad_debug_glVertexAttrib2d = glad_debug_impl_glVertexAttrib2d;
+static void APIENTRY glad_debug_impl_glVertexAttrib2dv(GLuint arg0, const GLdouble * arg1) {
+	glad_glVertexAttrib2dv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib2dv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib2dv");
+}
+PFNGLVERTEXATTRIB2DVPROC glad_debug_glVertexAttrib2dv = glad_debug_impl_glVertexAttrib2dv;
+static void APIENTRY glad_debug_impl_glVertexAttrib2f(GLuint arg0, GLfloat arg1, GLfloat arg2) {
+	glad_glVertexAttrib2f(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib2f", "uff", (unsigned int)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glVertexAttrib2f");
+}
+PFNGLVERTEXATTRIB2FPROC glad_debug_glVertexAttrib2f = glad_debug_impl_glVertexAttrib2f;
+static void APIENTRY glad_debug_impl_glVertexAttrib2fv(GLuint arg0, const GLfloat * arg1) {
+	glad_glVertexAttrib2fv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib2fv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib2fv");
+}
+PFNGLVERTEXATTRIB2FVPROC glad_debug_glVertexAttrib2fv = glad_debug_impl_glVertexAttrib2fv;
+static void APIENTRY glad_debug_impl_glVertexAttrib2s(GLuint arg0, GLshort arg1, GLshort arg2) {
+	glad_glVertexAttrib2s(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib2s", "uii", (unsigned int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glVertexAttrib2s");
+}
+PFNGLVERTEXATTRIB2SPROC glad_debug_glVertexAttrib2s = glad_debug_impl_glVertexAttrib2s;
+static void APIENTRY glad_debug_impl_glVertexAttrib2sv(GLuint arg0, const GLshort * arg1) {
+	glad_glVertexAttrib2sv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib2sv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib2sv");
+}
+PFNGLVERTEXATTRIB2SVPROC glad_debug_glVertexAttrib2sv = glad_debug_impl_glVertexAttrib2sv;
+static void APIENTRY glad_debug_impl_glVertexAttrib3d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	glad_glVertexAttrib3d(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib3d", "ufff", (unsigned int)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glVertexAttrib3d");
+}
+PFNGLVERTEXATTRIB3DPROC glad_debug_glVertexAttrib3d = glad_debug_impl_glVertexAttrib3d;
+static void APIENTRY glad_debug_impl_glVertexAttrib3dv(GLuint arg0, const GLdouble * arg1) {
+	glad_glVertexAttrib3dv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib3dv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib3dv");
+}
+PFNGLVERTEXATTRIB3DVPROC glad_debug_glVertexAttrib3dv = glad_debug_impl_glVertexAttrib3dv;
+static void APIENTRY glad_debug_impl_glVertexAttrib3f(GLuint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	glad_glVertexAttrib3f(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib3f", "ufff", (unsigned int)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glVertexAttrib3f");
+}
+PFNGLVERTEXATTRIB3FPROC glad_debug_glVertexAttrib3f = glad_debug_impl_glVertexAttrib3f;
+static void APIENTRY glad_debug_impl_glVertexAttrib3fv(GLuint arg0, const GLfloat * arg1) {
+	glad_glVertexAttrib3fv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib3fv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib3fv");
+}
+PFNGLVERTEXATTRIB3FVPROC glad_debug_glVertexAttrib3fv = glad_debug_impl_glVertexAttrib3fv;
+static void APIENTRY glad_debug_impl_glVertexAttrib3s(GLuint arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	glad_glVertexAttrib3s(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib3s", "uiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glVertexAttrib3s");
+}
+PFNGLVERTEXATTRIB3SPROC glad_debug_glVertexAttrib3s = glad_debug_impl_glVertexAttrib3s;
+static void APIENTRY glad_debug_impl_glVertexAttrib3sv(GLuint arg0, const GLshort * arg1) {
+	glad_glVertexAttrib3sv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib3sv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib3sv");
+}
+PFNGLVERTEXATTRIB3SVPROC glad_debug_glVertexAttrib3sv = glad_debug_impl_glVertexAttrib3sv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nbv(GLuint arg0, const GLbyte * arg1) {
+	glad_glVertexAttrib4Nbv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib4Nbv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib4Nbv");
+}
+PFNGLVERTEXATTRIB4NBVPROC glad_debug_glVertexAttrib4Nbv = glad_debug_impl_glVertexAttrib4Nbv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Niv(GLuint arg0, const GLint * arg1) {
+	glad_glVertexAttrib4Niv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib4Niv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib4Niv");
+}
+PFNGLVERTEXATTRIB4NIVPROC glad_debug_glVertexAttrib4Niv = glad_debug_impl_glVertexAttrib4Niv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nsv(GLuint arg0, const GLshort * arg1) {
+	glad_glVertexAttrib4Nsv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib4Nsv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib4Nsv");
+}
+PFNGLVERTEXATTRIB4NSVPROC glad_debug_glVertexAttrib4Nsv = glad_debug_impl_glVertexAttrib4Nsv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nub(GLuint arg0, GLubyte arg1, GLubyte arg2, GLubyte arg3, GLubyte arg4) {
+	glad_glVertexAttrib4Nub(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib4Nub", "uiiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4);
+	gl_debug_check_error("glVertexAttrib4Nub");
+}
+PFNGLVERTEXATTRIB4NUBPROC glad_debug_glVertexAttrib4Nub = glad_debug_impl_glVertexAttrib4Nub;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nubv(GLuint arg0, const GLubyte * arg1) {
+	glad_glVertexAttrib4Nubv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib4Nubv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib4Nubv");
+}
+PFNGLVERTEXATTRIB4NUBVPROC glad_debug_glVertexAttrib4Nubv = glad_debug_impl_glVertexAttrib4Nubv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nuiv(GLuint arg0, const GLuint * arg1) {
+	glad_glVertexAttrib4Nuiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib4Nuiv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib4Nuiv");
+}
+PFNGLVERTEXATTRIB4NUIVPROC glad_debug_glVertexAttrib4Nuiv = glad_debug_impl_glVertexAttrib4Nuiv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4Nusv(GLuint arg0, const GLushort * arg1) {
+	glad_glVertexAttrib4Nusv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib4Nusv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib4Nusv");
+}
+PFNGLVERTEXATTRIB4NUSVPROC glad_debug_glVertexAttrib4Nusv = glad_debug_impl_glVertexAttrib4Nusv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4bv(GLuint arg0, const GLbyte * arg1) {
+	glad_glVertexAttrib4bv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib4bv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib4bv");
+}
+PFNGLVERTEXATTRIB4BVPROC glad_debug_glVertexAttrib4bv = glad_debug_impl_glVertexAttrib4bv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	glad_glVertexAttrib4d(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib4d", "uffff", (unsigned int)arg0, (double)arg1, (double)arg2, (double)arg3, (double)arg4);
+	gl_debug_check_error("glVertexAttrib4d");
+}
+PFNGLVERTEXATTRIB4DPROC glad_debug_glVertexAttrib4d = glad_debug_impl_glVertexAttrib4d;
+static void APIENTRY glad_debug_impl_glVertexAttrib4dv(GLuint arg0, const GLdouble * arg1) {
+	glad_glVertexAttrib4dv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib4dv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib4dv");
+}
+PFNGLVERTEXATTRIB4DVPROC glad_debug_glVertexAttrib4dv = glad_debug_impl_glVertexAttrib4dv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4f(GLuint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	glad_glVertexAttrib4f(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib4f", "uffff", (unsigned int)arg0, (double)arg1, (double)arg2, (double)arg3, (double)arg4);
+	gl_debug_check_error("glVertexAttrib4f");
+}
+PFNGLVERTEXATTRIB4FPROC glad_debug_glVertexAttrib4f = glad_debug_impl_glVertexAttrib4f;
+static void APIENTRY glad_debug_impl_glVertexAttrib4fv(GLuint arg0, const GLfloat * arg1) {
+	glad_glVertexAttrib4fv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib4fv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib4fv");
+}
+PFNGLVERTEXATTRIB4FVPROC glad_debug_glVertexAttrib4fv = glad_debug_impl_glVertexAttrib4fv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4iv(GLuint arg0, const GLint * arg1) {
+	glad_glVertexAttrib4iv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib4iv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib4iv");
+}
+PFNGLVERTEXATTRIB4IVPROC glad_debug_glVertexAttrib4iv = glad_debug_impl_glVertexAttrib4iv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4s(GLuint arg0, GLshort arg1, GLshort arg2, GLshort arg3, GLshort arg4) {
+	glad_glVertexAttrib4s(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib4s", "uiiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4);
+	gl_debug_check_error("glVertexAttrib4s");
+}
+PFNGLVERTEXATTRIB4SPROC glad_debug_glVertexAttrib4s = glad_debug_impl_glVertexAttrib4s;
+static void APIENTRY glad_debug_impl_glVertexAttrib4sv(GLuint arg0, const GLshort * arg1) {
+	glad_glVertexAttrib4sv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib4sv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib4sv");
+}
+PFNGLVERTEXATTRIB4SVPROC glad_debug_glVertexAttrib4sv = glad_debug_impl_glVertexAttrib4sv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4ubv(GLuint arg0, const GLubyte * arg1) {
+	glad_glVertexAttrib4ubv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib4ubv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib4ubv");
+}
+PFNGLVERTEXATTRIB4UBVPROC glad_debug_glVertexAttrib4ubv = glad_debug_impl_glVertexAttrib4ubv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4uiv(GLuint arg0, const GLuint * arg1) {
+	glad_glVertexAttrib4uiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib4uiv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib4uiv");
+}
+PFNGLVERTEXATTRIB4UIVPROC glad_debug_glVertexAttrib4uiv = glad_debug_impl_glVertexAttrib4uiv;
+static void APIENTRY glad_debug_impl_glVertexAttrib4usv(GLuint arg0, const GLushort * arg1) {
+	glad_glVertexAttrib4usv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttrib4usv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttrib4usv");
+}
+PFNGLVERTEXATTRIB4USVPROC glad_debug_glVertexAttrib4usv = glad_debug_impl_glVertexAttrib4usv;
+static void APIENTRY glad_debug_impl_glVertexAttribBinding(GLuint arg0, GLuint arg1) {
+	glad_glVertexAttribBinding(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribBinding", "uu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glVertexAttribBinding");
+}
+PFNGLVERTEXATTRIBBINDINGPROC glad_debug_glVertexAttribBinding = glad_debug_impl_glVertexAttribBinding;
+static void APIENTRY glad_debug_impl_glVertexAttribDivisor(GLuint arg0, GLuint arg1) {
+	glad_glVertexAttribDivisor(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribDivisor", "uu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glVertexAttribDivisor");
+}
+PFNGLVERTEXATTRIBDIVISORPROC glad_debug_glVertexAttribDivisor = glad_debug_impl_glVertexAttribDivisor;
+static void APIENTRY glad_debug_impl_glVertexAttribFormat(GLuint arg0, GLint arg1, GLenum arg2, GLboolean arg3, GLuint arg4) {
+	glad_glVertexAttribFormat(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribFormat", "uiebu", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (unsigned int)arg4);
+	gl_debug_check_error("glVertexAttribFormat");
+}
+PFNGLVERTEXATTRIBFORMATPROC glad_debug_glVertexAttribFormat = glad_debug_impl_glVertexAttribFormat;
+static void APIENTRY glad_debug_impl_glVertexAttribI1i(GLuint arg0, GLint arg1) {
+	glad_glVertexAttribI1i(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI1i", "ui", (unsigned int)arg0, (int)arg1);
+	gl_debug_check_error("glVertexAttribI1i");
+}
+PFNGLVERTEXATTRIBI1IPROC glad_debug_glVertexAttribI1i = glad_debug_impl_glVertexAttribI1i;
+static void APIENTRY glad_debug_impl_glVertexAttribI1iv(GLuint arg0, const GLint * arg1) {
+	glad_glVertexAttribI1iv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI1iv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttribI1iv");
+}
+PFNGLVERTEXATTRIBI1IVPROC glad_debug_glVertexAttribI1iv = glad_debug_impl_glVertexAttribI1iv;
+static void APIENTRY glad_debug_impl_glVertexAttribI1ui(GLuint arg0, GLuint arg1) {
+	glad_glVertexAttribI1ui(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI1ui", "uu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glVertexAttribI1ui");
+}
+PFNGLVERTEXATTRIBI1UIPROC glad_debug_glVertexAttribI1ui = glad_debug_impl_glVertexAttribI1ui;
+static void APIENTRY glad_debug_impl_glVertexAttribI1uiv(GLuint arg0, const GLuint * arg1) {
+	glad_glVertexAttribI1uiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI1uiv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttribI1uiv");
+}
+PFNGLVERTEXATTRIBI1UIVPROC glad_debug_glVertexAttribI1uiv = glad_debug_impl_glVertexAttribI1uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribI2i(GLuint arg0, GLint arg1, GLint arg2) {
+	glad_glVertexAttribI2i(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI2i", "uii", (unsigned int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glVertexAttribI2i");
+}
+PFNGLVERTEXATTRIBI2IPROC glad_debug_glVertexAttribI2i = glad_debug_impl_glVertexAttribI2i;
+static void APIENTRY glad_debug_impl_glVertexAttribI2iv(GLuint arg0, const GLint * arg1) {
+	glad_glVertexAttribI2iv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI2iv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttribI2iv");
+}
+PFNGLVERTEXATTRIBI2IVPROC glad_debug_glVertexAttribI2iv = glad_debug_impl_glVertexAttribI2iv;
+static void APIENTRY glad_debug_impl_glVertexAttribI2ui(GLuint arg0, GLuint arg1, GLuint arg2) {
+	glad_glVertexAttribI2ui(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI2ui", "uuu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2);
+	gl_debug_check_error("glVertexAttribI2ui");
+}
+PFNGLVERTEXATTRIBI2UIPROC glad_debug_glVertexAttribI2ui = glad_debug_impl_glVertexAttribI2ui;
+static void APIENTRY glad_debug_impl_glVertexAttribI2uiv(GLuint arg0, const GLuint * arg1) {
+	glad_glVertexAttribI2uiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI2uiv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttribI2uiv");
+}
+PFNGLVERTEXATTRIBI2UIVPROC glad_debug_glVertexAttribI2uiv = glad_debug_impl_glVertexAttribI2uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribI3i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	glad_glVertexAttribI3i(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI3i", "uiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glVertexAttribI3i");
+}
+PFNGLVERTEXATTRIBI3IPROC glad_debug_glVertexAttribI3i = glad_debug_impl_glVertexAttribI3i;
+static void APIENTRY glad_debug_impl_glVertexAttribI3iv(GLuint arg0, const GLint * arg1) {
+	glad_glVertexAttribI3iv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI3iv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttribI3iv");
+}
+PFNGLVERTEXATTRIBI3IVPROC glad_debug_glVertexAttribI3iv = glad_debug_impl_glVertexAttribI3iv;
+static void APIENTRY glad_debug_impl_glVertexAttribI3ui(GLuint arg0, GLuint arg1, GLuint arg2, GLuint arg3) {
+	glad_glVertexAttribI3ui(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI3ui", "uuuu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glVertexAttribI3ui");
+}
+PFNGLVERTEXATTRIBI3UIPROC glad_debug_glVertexAttribI3ui = glad_debug_impl_glVertexAttribI3ui;
+static void APIENTRY glad_debug_impl_glVertexAttribI3uiv(GLuint arg0, const GLuint * arg1) {
+	glad_glVertexAttribI3uiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI3uiv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttribI3uiv");
+}
+PFNGLVERTEXATTRIBI3UIVPROC glad_debug_glVertexAttribI3uiv = glad_debug_impl_glVertexAttribI3uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribI4bv(GLuint arg0, const GLbyte * arg1) {
+	glad_glVertexAttribI4bv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI4bv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttribI4bv");
+}
+PFNGLVERTEXATTRIBI4BVPROC glad_debug_glVertexAttribI4bv = glad_debug_impl_glVertexAttribI4bv;
+static void APIENTRY glad_debug_impl_glVertexAttribI4i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	glad_glVertexAttribI4i(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI4i", "uiiii", (unsigned int)arg0, (int)arg1, (int)arg2, (int)arg3, (int)arg4);
+	gl_debug_check_error("glVertexAttribI4i");
+}
+PFNGLVERTEXATTRIBI4IPROC glad_debug_glVertexAttribI4i = glad_debug_impl_glVertexAttribI4i;
+static void APIENTRY glad_debug_impl_glVertexAttribI4iv(GLuint arg0, const GLint * arg1) {
+	glad_glVertexAttribI4iv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI4iv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttribI4iv");
+}
+PFNGLVERTEXATTRIBI4IVPROC glad_debug_glVertexAttribI4iv = glad_debug_impl_glVertexAttribI4iv;
+static void APIENTRY glad_debug_impl_glVertexAttribI4sv(GLuint arg0, const GLshort * arg1) {
+	glad_glVertexAttribI4sv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI4sv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttribI4sv");
+}
+PFNGLVERTEXATTRIBI4SVPROC glad_debug_glVertexAttribI4sv = glad_debug_impl_glVertexAttribI4sv;
+static void APIENTRY glad_debug_impl_glVertexAttribI4ubv(GLuint arg0, const GLubyte * arg1) {
+	glad_glVertexAttribI4ubv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI4ubv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttribI4ubv");
+}
+PFNGLVERTEXATTRIBI4UBVPROC glad_debug_glVertexAttribI4ubv = glad_debug_impl_glVertexAttribI4ubv;
+static void APIENTRY glad_debug_impl_glVertexAttribI4ui(GLuint arg0, GLuint arg1, GLuint arg2, GLuint arg3, GLuint arg4) {
+	glad_glVertexAttribI4ui(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI4ui", "uuuuu", (unsigned int)arg0, (unsigned int)arg1, (unsigned int)arg2, (unsigned int)arg3, (unsigned int)arg4);
+	gl_debug_check_error("glVertexAttribI4ui");
+}
+PFNGLVERTEXATTRIBI4UIPROC glad_debug_glVertexAttribI4ui = glad_debug_impl_glVertexAttribI4ui;
+static void APIENTRY glad_debug_impl_glVertexAttribI4uiv(GLuint arg0, const GLuint * arg1) {
+	glad_glVertexAttribI4uiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI4uiv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttribI4uiv");
+}
+PFNGLVERTEXATTRIBI4UIVPROC glad_debug_glVertexAttribI4uiv = glad_debug_impl_glVertexAttribI4uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribI4usv(GLuint arg0, const GLushort * arg1) {
+	glad_glVertexAttribI4usv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribI4usv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttribI4usv");
+}
+PFNGLVERTEXATTRIBI4USVPROC glad_debug_glVertexAttribI4usv = glad_debug_impl_glVertexAttribI4usv;
+static void APIENTRY glad_debug_impl_glVertexAttribIFormat(GLuint arg0, GLint arg1, GLenum arg2, GLuint arg3) {
+	glad_glVertexAttribIFormat(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribIFormat", "uieu", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glVertexAttribIFormat");
+}
+PFNGLVERTEXATTRIBIFORMATPROC glad_debug_glVertexAttribIFormat = glad_debug_impl_glVertexAttribIFormat;
+static void APIENTRY glad_debug_impl_glVertexAttribIPointer(GLuint arg0, GLint arg1, GLenum arg2, GLsizei arg3, const void * arg4) {
+	glad_glVertexAttribIPointer(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribIPointer", "uieip", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glVertexAttribIPointer");
+}
+PFNGLVERTEXATTRIBIPOINTERPROC glad_debug_glVertexAttribIPointer = glad_debug_impl_glVertexAttribIPointer;
+static void APIENTRY glad_debug_impl_glVertexAttribL1d(GLuint arg0, GLdouble arg1) {
+	glad_glVertexAttribL1d(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribL1d", "uf", (unsigned int)arg0, (double)arg1);
+	gl_debug_check_error("glVertexAttribL1d");
+}
+PFNGLVERTEXATTRIBL1DPROC glad_debug_glVertexAttribL1d = glad_debug_impl_glVertexAttribL1d;
+static void APIENTRY glad_debug_impl_glVertexAttribL1dv(GLuint arg0, const GLdouble * arg1) {
+	glad_glVertexAttribL1dv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribL1dv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttribL1dv");
+}
+PFNGLVERTEXATTRIBL1DVPROC glad_debug_glVertexAttribL1dv = glad_debug_impl_glVertexAttribL1dv;
+static void APIENTRY glad_debug_impl_glVertexAttribL1ui64ARB(GLuint arg0, GLuint64EXT arg1) {
+	glad_glVertexAttribL1ui64ARB(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribL1ui64ARB", "uL", (unsigned int)arg0, (unsigned long long)arg1);
+	gl_debug_check_error("glVertexAttribL1ui64ARB");
+}
+PFNGLVERTEXATTRIBL1UI64ARBPROC glad_debug_glVertexAttribL1ui64ARB = glad_debug_impl_glVertexAttribL1ui64ARB;
+static void APIENTRY glad_debug_impl_glVertexAttribL1ui64vARB(GLuint arg0, const GLuint64EXT * arg1) {
+	glad_glVertexAttribL1ui64vARB(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribL1ui64vARB", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttribL1ui64vARB");
+}
+PFNGLVERTEXATTRIBL1UI64VARBPROC glad_debug_glVertexAttribL1ui64vARB = glad_debug_impl_glVertexAttribL1ui64vARB;
+static void APIENTRY glad_debug_impl_glVertexAttribL2d(GLuint arg0, GLdouble arg1, GLdouble arg2) {
+	glad_glVertexAttribL2d(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribL2d", "uff", (unsigned int)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glVertexAttribL2d");
+}
+PFNGLVERTEXATTRIBL2DPROC glad_debug_glVertexAttribL2d = glad_debug_impl_glVertexAttribL2d;
+static void APIENTRY glad_debug_impl_glVertexAttribL2dv(GLuint arg0, const GLdouble * arg1) {
+	glad_glVertexAttribL2dv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribL2dv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttribL2dv");
+}
+PFNGLVERTEXATTRIBL2DVPROC glad_debug_glVertexAttribL2dv = glad_debug_impl_glVertexAttribL2dv;
+static void APIENTRY glad_debug_impl_glVertexAttribL3d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	glad_glVertexAttribL3d(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribL3d", "ufff", (unsigned int)arg0, (double)arg1, (double)arg2, (double)arg3);
+	gl_debug_check_error("glVertexAttribL3d");
+}
+PFNGLVERTEXATTRIBL3DPROC glad_debug_glVertexAttribL3d = glad_debug_impl_glVertexAttribL3d;
+static void APIENTRY glad_debug_impl_glVertexAttribL3dv(GLuint arg0, const GLdouble * arg1) {
+	glad_glVertexAttribL3dv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribL3dv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttribL3dv");
+}
+PFNGLVERTEXATTRIBL3DVPROC glad_debug_glVertexAttribL3dv = glad_debug_impl_glVertexAttribL3dv;
+static void APIENTRY glad_debug_impl_glVertexAttribL4d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	glad_glVertexAttribL4d(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribL4d", "uffff", (unsigned int)arg0, (double)arg1, (double)arg2, (double)arg3, (double)arg4);
+	gl_debug_check_error("glVertexAttribL4d");
+}
+PFNGLVERTEXATTRIBL4DPROC glad_debug_glVertexAttribL4d = glad_debug_impl_glVertexAttribL4d;
+static void APIENTRY glad_debug_impl_glVertexAttribL4dv(GLuint arg0, const GLdouble * arg1) {
+	glad_glVertexAttribL4dv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribL4dv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexAttribL4dv");
+}
+PFNGLVERTEXATTRIBL4DVPROC glad_debug_glVertexAttribL4dv = glad_debug_impl_glVertexAttribL4dv;
+static void APIENTRY glad_debug_impl_glVertexAttribLFormat(GLuint arg0, GLint arg1, GLenum arg2, GLuint arg3) {
+	glad_glVertexAttribLFormat(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribLFormat", "uieu", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glVertexAttribLFormat");
+}
+PFNGLVERTEXATTRIBLFORMATPROC glad_debug_glVertexAttribLFormat = glad_debug_impl_glVertexAttribLFormat;
+static void APIENTRY glad_debug_impl_glVertexAttribLPointer(GLuint arg0, GLint arg1, GLenum arg2, GLsizei arg3, const void * arg4) {
+	glad_glVertexAttribLPointer(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribLPointer", "uieip", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (const void*)arg4);
+	gl_debug_check_error("glVertexAttribLPointer");
+}
+PFNGLVERTEXATTRIBLPOINTERPROC glad_debug_glVertexAttribLPointer = glad_debug_impl_glVertexAttribLPointer;
+static void APIENTRY glad_debug_impl_glVertexAttribP1ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+	glad_glVertexAttribP1ui(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribP1ui", "uebu", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glVertexAttribP1ui");
+}
+PFNGLVERTEXATTRIBP1UIPROC glad_debug_glVertexAttribP1ui = glad_debug_impl_glVertexAttribP1ui;
+static void APIENTRY glad_debug_impl_glVertexAttribP1uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+	glad_glVertexAttribP1uiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribP1uiv", "uebp", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glVertexAttribP1uiv");
+}
+PFNGLVERTEXATTRIBP1UIVPROC glad_debug_glVertexAttribP1uiv = glad_debug_impl_glVertexAttribP1uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribP2ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+	glad_glVertexAttribP2ui(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribP2ui", "uebu", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glVertexAttribP2ui");
+}
+PFNGLVERTEXATTRIBP2UIPROC glad_debug_glVertexAttribP2ui = glad_debug_impl_glVertexAttribP2ui;
+static void APIENTRY glad_debug_impl_glVertexAttribP2uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+	glad_glVertexAttribP2uiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribP2uiv", "uebp", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glVertexAttribP2uiv");
+}
+PFNGLVERTEXATTRIBP2UIVPROC glad_debug_glVertexAttribP2uiv = glad_debug_impl_glVertexAttribP2uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribP3ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+	glad_glVertexAttribP3ui(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribP3ui", "uebu", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glVertexAttribP3ui");
+}
+PFNGLVERTEXATTRIBP3UIPROC glad_debug_glVertexAttribP3ui = glad_debug_impl_glVertexAttribP3ui;
+static void APIENTRY glad_debug_impl_glVertexAttribP3uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+	glad_glVertexAttribP3uiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribP3uiv", "uebp", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glVertexAttribP3uiv");
+}
+PFNGLVERTEXATTRIBP3UIVPROC glad_debug_glVertexAttribP3uiv = glad_debug_impl_glVertexAttribP3uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribP4ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+	glad_glVertexAttribP4ui(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribP4ui", "uebu", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (unsigned int)arg3);
+	gl_debug_check_error("glVertexAttribP4ui");
+}
+PFNGLVERTEXATTRIBP4UIPROC glad_debug_glVertexAttribP4ui = glad_debug_impl_glVertexAttribP4ui;
+static void APIENTRY glad_debug_impl_glVertexAttribP4uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+	glad_glVertexAttribP4uiv(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribP4uiv", "uebp", (unsigned int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glVertexAttribP4uiv");
+}
+PFNGLVERTEXATTRIBP4UIVPROC glad_debug_glVertexAttribP4uiv = glad_debug_impl_glVertexAttribP4uiv;
+static void APIENTRY glad_debug_impl_glVertexAttribPointer(GLuint arg0, GLint arg1, GLenum arg2, GLboolean arg3, GLsizei arg4, const void * arg5) {
+	glad_glVertexAttribPointer(arg0, arg1, arg2, arg3, arg4, arg5);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexAttribPointer", "uiebip", (unsigned int)arg0, (int)arg1, (unsigned int)arg2, (int)arg3, (int)arg4, (const void*)arg5);
+	gl_debug_check_error("glVertexAttribPointer");
+}
+PFNGLVERTEXATTRIBPOINTERPROC glad_debug_glVertexAttribPointer = glad_debug_impl_glVertexAttribPointer;
+static void APIENTRY glad_debug_impl_glVertexBindingDivisor(GLuint arg0, GLuint arg1) {
+	glad_glVertexBindingDivisor(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexBindingDivisor", "uu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glVertexBindingDivisor");
+}
+PFNGLVERTEXBINDINGDIVISORPROC glad_debug_glVertexBindingDivisor = glad_debug_impl_glVertexBindingDivisor;
+static void APIENTRY glad_debug_impl_glVertexP2ui(GLenum arg0, GLuint arg1) {
+	glad_glVertexP2ui(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexP2ui", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glVertexP2ui");
+}
+PFNGLVERTEXP2UIPROC glad_debug_glVertexP2ui = glad_debug_impl_glVertexP2ui;
+static void APIENTRY glad_debug_impl_glVertexP2uiv(GLenum arg0, const GLuint * arg1) {
+	glad_glVertexP2uiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexP2uiv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexP2uiv");
+}
+PFNGLVERTEXP2UIVPROC glad_debug_glVertexP2uiv = glad_debug_impl_glVertexP2uiv;
+static void APIENTRY glad_debug_impl_glVertexP3ui(GLenum arg0, GLuint arg1) {
+	glad_glVertexP3ui(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexP3ui", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glVertexP3ui");
+}
+PFNGLVERTEXP3UIPROC glad_debug_glVertexP3ui = glad_debug_impl_glVertexP3ui;
+static void APIENTRY glad_debug_impl_glVertexP3uiv(GLenum arg0, const GLuint * arg1) {
+	glad_glVertexP3uiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexP3uiv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexP3uiv");
+}
+PFNGLVERTEXP3UIVPROC glad_debug_glVertexP3uiv = glad_debug_impl_glVertexP3uiv;
+static void APIENTRY glad_debug_impl_glVertexP4ui(GLenum arg0, GLuint arg1) {
+	glad_glVertexP4ui(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexP4ui", "eu", (unsigned int)arg0, (unsigned int)arg1);
+	gl_debug_check_error("glVertexP4ui");
+}
+PFNGLVERTEXP4UIPROC glad_debug_glVertexP4ui = glad_debug_impl_glVertexP4ui;
+static void APIENTRY glad_debug_impl_glVertexP4uiv(GLenum arg0, const GLuint * arg1) {
+	glad_glVertexP4uiv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexP4uiv", "ep", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glVertexP4uiv");
+}
+PFNGLVERTEXP4UIVPROC glad_debug_glVertexP4uiv = glad_debug_impl_glVertexP4uiv;
+static void APIENTRY glad_debug_impl_glVertexPointer(GLint arg0, GLenum arg1, GLsizei arg2, const void * arg3) {
+	glad_glVertexPointer(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glVertexPointer", "ieip", (int)arg0, (unsigned int)arg1, (int)arg2, (const void*)arg3);
+	gl_debug_check_error("glVertexPointer");
+}
+PFNGLVERTEXPOINTERPROC glad_debug_glVertexPointer = glad_debug_impl_glVertexPointer;
+static void APIENTRY glad_debug_impl_glViewport(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3) {
+	glad_glViewport(arg0, arg1, arg2, arg3);
+	if (gl_debug_tracing) gl_debug_trace_call("glViewport", "iiii", (int)arg0, (int)arg1, (int)arg2, (int)arg3);
+	gl_debug_check_error("glViewport");
+}
+PFNGLVIEWPORTPROC glad_debug_glViewport = glad_debug_impl_glViewport;
+static void APIENTRY glad_debug_impl_glViewportArrayv(GLuint arg0, GLsizei arg1, const GLfloat * arg2) {
+	glad_glViewportArrayv(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glViewportArrayv", "uip", (unsigned int)arg0, (int)arg1, (const void*)arg2);
+	gl_debug_check_error("glViewportArrayv");
+}
+PFNGLVIEWPORTARRAYVPROC glad_debug_glViewportArrayv = glad_debug_impl_glViewportArrayv;
+static void APIENTRY glad_debug_impl_glViewportIndexedf(GLuint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	glad_glViewportIndexedf(arg0, arg1, arg2, arg3, arg4);
+	if (gl_debug_tracing) gl_debug_trace_call("glViewportIndexedf", "uffff", (unsigned int)arg0, (double)arg1, (double)arg2, (double)arg3, (double)arg4);
+	gl_debug_check_error("glViewportIndexedf");
+}
+PFNGLVIEWPORTINDEXEDFPROC glad_debug_glViewportIndexedf = glad_debug_impl_glViewportIndexedf;
+static void APIENTRY glad_debug_impl_glViewportIndexedfv(GLuint arg0, const GLfloat * arg1) {
+	glad_glViewportIndexedfv(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glViewportIndexedfv", "up", (unsigned int)arg0, (const void*)arg1);
+	gl_debug_check_error("glViewportIndexedfv");
+}
+PFNGLVIEWPORTINDEXEDFVPROC glad_debug_glViewportIndexedfv = glad_debug_impl_glViewportIndexedfv;
+static void APIENTRY glad_debug_impl_glWaitSync(GLsync arg0, GLbitfield arg1, GLuint64 arg2) {
+	glad_glWaitSync(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glWaitSync", "puL", (const void*)arg0, (unsigned int)arg1, (unsigned long long)arg2);
+	gl_debug_check_error("glWaitSync");
+}
+PFNGLWAITSYNCPROC glad_debug_glWaitSync = glad_debug_impl_glWaitSync;
+static void APIENTRY glad_debug_impl_glWindowPos2d(GLdouble arg0, GLdouble arg1) {
+	glad_glWindowPos2d(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glWindowPos2d", "ff", (double)arg0, (double)arg1);
+	gl_debug_check_error("glWindowPos2d");
+}
+PFNGLWINDOWPOS2DPROC glad_debug_glWindowPos2d = glad_debug_impl_glWindowPos2d;
+static void APIENTRY glad_debug_impl_glWindowPos2dv(const GLdouble * arg0) {
+	glad_glWindowPos2dv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glWindowPos2dv", "p", (const void*)arg0);
+	gl_debug_check_error("glWindowPos2dv");
+}
+PFNGLWINDOWPOS2DVPROC glad_debug_glWindowPos2dv = glad_debug_impl_glWindowPos2dv;
+static void APIENTRY glad_debug_impl_glWindowPos2f(GLfloat arg0, GLfloat arg1) {
+	glad_glWindowPos2f(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glWindowPos2f", "ff", (double)arg0, (double)arg1);
+	gl_debug_check_error("glWindowPos2f");
+}
+PFNGLWINDOWPOS2FPROC glad_debug_glWindowPos2f = glad_debug_impl_glWindowPos2f;
+static void APIENTRY glad_debug_impl_glWindowPos2fv(const GLfloat * arg0) {
+	glad_glWindowPos2fv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glWindowPos2fv", "p", (const void*)arg0);
+	gl_debug_check_error("glWindowPos2fv");
+}
+PFNGLWINDOWPOS2FVPROC glad_debug_glWindowPos2fv = glad_debug_impl_glWindowPos2fv;
+static void APIENTRY glad_debug_impl_glWindowPos2i(GLint arg0, GLint arg1) {
+	glad_glWindowPos2i(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glWindowPos2i", "ii", (int)arg0, (int)arg1);
+	gl_debug_check_error("glWindowPos2i");
+}
+PFNGLWINDOWPOS2IPROC glad_debug_glWindowPos2i = glad_debug_impl_glWindowPos2i;
+static void APIENTRY glad_debug_impl_glWindowPos2iv(const GLint * arg0) {
+	glad_glWindowPos2iv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glWindowPos2iv", "p", (const void*)arg0);
+	gl_debug_check_error("glWindowPos2iv");
+}
+PFNGLWINDOWPOS2IVPROC glad_debug_glWindowPos2iv = glad_debug_impl_glWindowPos2iv;
+static void APIENTRY glad_debug_impl_glWindowPos2s(GLshort arg0, GLshort arg1) {
+	glad_glWindowPos2s(arg0, arg1);
+	if (gl_debug_tracing) gl_debug_trace_call("glWindowPos2s", "ii", (int)arg0, (int)arg1);
+	gl_debug_check_error("glWindowPos2s");
+}
+PFNGLWINDOWPOS2SPROC glad_debug_glWindowPos2s = glad_debug_impl_glWindowPos2s;
+static void APIENTRY glad_debug_impl_glWindowPos2sv(const GLshort * arg0) {
+	glad_glWindowPos2sv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glWindowPos2sv", "p", (const void*)arg0);
+	gl_debug_check_error("glWindowPos2sv");
+}
+PFNGLWINDOWPOS2SVPROC glad_debug_glWindowPos2sv = glad_debug_impl_glWindowPos2sv;
+static void APIENTRY glad_debug_impl_glWindowPos3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	glad_glWindowPos3d(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glWindowPos3d", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glWindowPos3d");
+}
+PFNGLWINDOWPOS3DPROC glad_debug_glWindowPos3d = glad_debug_impl_glWindowPos3d;
+static void APIENTRY glad_debug_impl_glWindowPos3dv(const GLdouble * arg0) {
+	glad_glWindowPos3dv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glWindowPos3dv", "p", (const void*)arg0);
+	gl_debug_check_error("glWindowPos3dv");
+}
+PFNGLWINDOWPOS3DVPROC glad_debug_glWindowPos3dv = glad_debug_impl_glWindowPos3dv;
+static void APIENTRY glad_debug_impl_glWindowPos3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	glad_glWindowPos3f(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glWindowPos3f", "fff", (double)arg0, (double)arg1, (double)arg2);
+	gl_debug_check_error("glWindowPos3f");
+}
+PFNGLWINDOWPOS3FPROC glad_debug_glWindowPos3f = glad_debug_impl_glWindowPos3f;
+static void APIENTRY glad_debug_impl_glWindowPos3fv(const GLfloat * arg0) {
+	glad_glWindowPos3fv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glWindowPos3fv", "p", (const void*)arg0);
+	gl_debug_check_error("glWindowPos3fv");
+}
+PFNGLWINDOWPOS3FVPROC glad_debug_glWindowPos3fv = glad_debug_impl_glWindowPos3fv;
+static void APIENTRY glad_debug_impl_glWindowPos3i(GLint arg0, GLint arg1, GLint arg2) {
+	glad_glWindowPos3i(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glWindowPos3i", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glWindowPos3i");
+}
+PFNGLWINDOWPOS3IPROC glad_debug_glWindowPos3i = glad_debug_impl_glWindowPos3i;
+static void APIENTRY glad_debug_impl_glWindowPos3iv(const GLint * arg0) {
+	glad_glWindowPos3iv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glWindowPos3iv", "p", (const void*)arg0);
+	gl_debug_check_error("glWindowPos3iv");
+}
+PFNGLWINDOWPOS3IVPROC glad_debug_glWindowPos3iv = glad_debug_impl_glWindowPos3iv;
+static void APIENTRY glad_debug_impl_glWindowPos3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	glad_glWindowPos3s(arg0, arg1, arg2);
+	if (gl_debug_tracing) gl_debug_trace_call("glWindowPos3s", "iii", (int)arg0, (int)arg1, (int)arg2);
+	gl_debug_check_error("glWindowPos3s");
+}
+PFNGLWINDOWPOS3SPROC glad_debug_glWindowPos3s = glad_debug_impl_glWindowPos3s;
+static void APIENTRY glad_debug_impl_glWindowPos3sv(const GLshort * arg0) {
+	glad_glWindowPos3sv(arg0);
+	if (gl_debug_tracing) gl_debug_trace_call("glWindowPos3sv", "p", (const void*)arg0);
+	gl_debug_check_error("glWindowPos3sv");
+}
+PFNGLWINDOWPOS3SVPROC glad_debug_glWindowPos3sv = glad_debug_impl_glWindowPos3sv;
+
+void gl_debug_layer_install(int wrap) {
+	glad_debug_glAccum = wrap ? glad_debug_impl_glAccum : glad_glAccum;
+	glad_debug_glActiveShaderProgram = wrap ? glad_debug_impl_glActiveShaderProgram : glad_glActiveShaderProgram;
+	glad_debug_glActiveTexture = wrap ? glad_debug_impl_glActiveTexture : glad_glActiveTexture;
+	glad_debug_glAlphaFunc = wrap ? glad_debug_impl_glAlphaFunc : glad_glAlphaFunc;
+	glad_debug_glAreTexturesResident = wrap ? glad_debug_impl_glAreTexturesResident : glad_glAreTexturesResident;
+	glad_debug_glArrayElement = wrap ? glad_debug_impl_glArrayElement : glad_glArrayElement;
+	glad_debug_glAttachShader = wrap ? glad_debug_impl_glAttachShader : glad_glAttachShader;
+	glad_debug_glBegin = wrap ? glad_debug_impl_glBegin : glad_glBegin;
+	glad_debug_glBeginConditionalRender = wrap ? glad_debug_impl_glBeginConditionalRender : glad_glBeginConditionalRender;
+	glad_debug_glBeginQuery = wrap ? glad_debug_impl_glBeginQuery : glad_glBeginQuery;
+	glad_debug_glBeginQueryIndexed = wrap ? glad_debug_impl_glBeginQueryIndexed : glad_glBeginQueryIndexed;
+	glad_debug_glBeginTransformFeedback = wrap ? glad_debug_impl_glBeginTransformFeedback : glad_glBeginTransformFeedback;
+	glad_debug_glBindAttribLocation = wrap ? glad_debug_impl_glBindAttribLocation : glad_glBindAttribLocation;
+	glad_debug_glBindBuffer = wrap ? glad_debug_impl_glBindBuffer : glad_glBindBuffer;
+	glad_debug_glBindBufferBase = wrap ? glad_debug_impl_glBindBufferBase : glad_glBindBufferBase;
+	glad_debug_glBindBufferRange = wrap ? glad_debug_impl_glBindBufferRange : glad_glBindBufferRange;
+	glad_debug_glBindBuffersBase = wrap ? glad_debug_impl_glBindBuffersBase : glad_glBindBuffersBase;
+	glad_debug_glBindBuffersRange = wrap ? glad_debug_impl_glBindBuffersRange : glad_glBindBuffersRange;
+	glad_debug_glBindFragDataLocation = wrap ? glad_debug_impl_glBindFragDataLocation : glad_glBindFragDataLocation;
+	glad_debug_glBindFragDataLocationIndexed = wrap ? glad_debug_impl_glBindFragDataLocationIndexed : glad_glBindFragDataLocationIndexed;
+	glad_debug_glBindFramebuffer = wrap ? glad_debug_impl_glBindFramebuffer : glad_glBindFramebuffer;
+	glad_debug_glBindImageTexture = wrap ? glad_debug_impl_glBindImageTexture : glad_glBindImageTexture;
+	glad_debug_glBindImageTextures = wrap ? glad_debug_impl_glBindImageTextures : glad_glBindImageTextures;
+	glad_debug_glBindProgramPipeline = wrap ? glad_debug_impl_glBindProgramPipeline : glad_glBindProgramPipeline;
+	glad_debug_glBindRenderbuffer = wrap ? glad_debug_impl_glBindRenderbuffer : glad_glBindRenderbuffer;
+	glad_debug_glBindSampler = wrap ? glad_debug_impl_glBindSampler : glad_glBindSampler;
+	glad_debug_glBindSamplers = wrap ? glad_debug_impl_glBindSamplers : glad_glBindSamplers;
+	glad_debug_glBindTexture = wrap ? glad_debug_impl_glBindTexture : glad_glBindTexture;
+	glad_debug_glBindTextureUnit = wrap ? glad_debug_impl_glBindTextureUnit : glad_glBindTextureUnit;
+	glad_debug_glBindTextures = wrap ? glad_debug_impl_glBindTextures : glad_glBindTextures;
+	glad_debug_glBindTransformFeedback = wrap ? glad_debug_impl_glBindTransformFeedback : glad_glBindTransformFeedback;
+	glad_debug_glBindVertexArray = wrap ? glad_debug_impl_glBindVertexArray : glad_glBindVertexArray;
+	glad_debug_glBindVertexBuffer = wrap ? glad_debug_impl_glBindVertexBuffer : glad_glBindVertexBuffer;
+	glad_debug_glBindVertexBuffers = wrap ? glad_debug_impl_glBindVertexBuffers : glad_glBindVertexBuffers;
+	glad_debug_glBitmap = wrap ? glad_debug_impl_glBitmap : glad_glBitmap;
+	glad_debug_glBlendColor = wrap ? glad_debug_impl_glBlendColor : glad_glBlendColor;
+	glad_debug_glBlendEquation = wrap ? glad_debug_impl_glBlendEquation : glad_glBlendEquation;
+	glad_debug_glBlendEquationSeparate = wrap ? glad_debug_impl_glBlendEquationSeparate : glad_glBlendEquationSeparate;
+	glad_debug_glBlendEquationSeparatei = wrap ? glad_debug_impl_glBlendEquationSeparatei : glad_glBlendEquationSeparatei;
+	glad_debug_glBlendEquationi = wrap ? glad_debug_impl_glBlendEquationi : glad_glBlendEquationi;
+	glad_debug_glBlendFunc = wrap ? glad_debug_impl_glBlendFunc : glad_glBlendFunc;
+	glad_debug_glBlendFuncSeparate = wrap ? glad_debug_impl_glBlendFuncSeparate : glad_glBlendFuncSeparate;
+	glad_debug_glBlendFuncSeparatei = wrap ? glad_debug_impl_glBlendFuncSeparatei : glad_glBlendFuncSeparatei;
+	glad_debug_glBlendFunci = wrap ? glad_debug_impl_glBlendFunci : glad_glBlendFunci;
+	glad_debug_glBlitFramebuffer = wrap ? glad_debug_impl_glBlitFramebuffer : glad_glBlitFramebuffer;
+	glad_debug_glBlitNamedFramebuffer = wrap ? glad_debug_impl_glBlitNamedFramebuffer : glad_glBlitNamedFramebuffer;
+	glad_debug_glBufferData = wrap ? glad_debug_impl_glBufferData : glad_glBufferData;
+	glad_debug_glBufferStorage = wrap ? glad_debug_impl_glBufferStorage : glad_glBufferStorage;
+	glad_debug_glBufferSubData = wrap ? glad_debug_impl_glBufferSubData : glad_glBufferSubData;
+	glad_debug_glCallList = wrap ? glad_debug_impl_glCallList : glad_glCallList;
+	glad_debug_glCallLists = wrap ? glad_debug_impl_glCallLists : glad_glCallLists;
+	glad_debug_glCheckFramebufferStatus = wrap ? glad_debug_impl_glCheckFramebufferStatus : glad_glCheckFramebufferStatus;
+	glad_debug_glCheckNamedFramebufferStatus = wrap ? glad_debug_impl_glCheckNamedFramebufferStatus : glad_glCheckNamedFramebufferStatus;
+	glad_debug_glClampColor = wrap ? glad_debug_impl_glClampColor : glad_glClampColor;
+	glad_debug_glClear = wrap ? glad_debug_impl_glClear : glad_glClear;
+	glad_debug_glClearAccum = wrap ? glad_debug_impl_glClearAccum : glad_glClearAccum;
+	glad_debug_glClearBufferData = wrap ? glad_debug_impl_glClearBufferData : glad_glClearBufferData;
+	glad_debug_glClearBufferSubData = wrap ? glad_debug_impl_glClearBufferSubData : glad_glClearBufferSubData;
+	glad_debug_glClearBufferfi = wrap ? glad_debug_impl_glClearBufferfi : glad_glClearBufferfi;
+	glad_debug_glClearBufferfv = wrap ? glad_debug_impl_glClearBufferfv : glad_glClearBufferfv;
+	glad_debug_glClearBufferiv = wrap ? glad_debug_impl_glClearBufferiv : glad_glClearBufferiv;
+	glad_debug_glClearBufferuiv = wrap ? glad_debug_impl_glClearBufferuiv : glad_glClearBufferuiv;
+	glad_debug_glClearColor = wrap ? glad_debug_impl_glClearColor : glad_glClearColor;
+	glad_debug_glClearDepth = wrap ? glad_debug_impl_glClearDepth : glad_glClearDepth;
+	glad_debug_glClearDepthf = wrap ? glad_debug_impl_glClearDepthf : glad_glClearDepthf;
+	glad_debug_glClearIndex = wrap ? glad_debug_impl_glClearIndex : glad_glClearIndex;
+	glad_debug_glClearNamedBufferData = wrap ? glad_debug_impl_glClearNamedBufferData : glad_glClearNamedBufferData;
+	glad_debug_glClearNamedBufferSubData = wrap ? glad_debug_impl_glClearNamedBufferSubData : glad_glClearNamedBufferSubData;
+	glad_debug_glClearNamedFramebufferfi = wrap ? glad_debug_impl_glClearNamedFramebufferfi : glad_glClearNamedFramebufferfi;
+	glad_debug_glClearNamedFramebufferfv = wrap ? glad_debug_impl_glClearNamedFramebufferfv : glad_glClearNamedFramebufferfv;
+	glad_debug_glClearNamedFramebufferiv = wrap ? glad_debug_impl_glClearNamedFramebufferiv : glad_glClearNamedFramebufferiv;
+	glad_debug_glClearNamedFramebufferuiv = wrap ? glad_debug_impl_glClearNamedFramebufferuiv : glad_glClearNamedFramebufferuiv;
+	glad_debug_glClearStencil = wrap ? glad_debug_impl_glClearStencil : glad_glClearStencil;
+	glad_debug_glClearTexImage = wrap ? glad_debug_impl_glClearTexImage : glad_glClearTexImage;
+	glad_debug_glClearTexSubImage = wrap ? glad_debug_impl_glClearTexSubImage : glad_glClearTexSubImage;
+	glad_debug_glClientActiveTexture = wrap ? glad_debug_impl_glClientActiveTexture : glad_glClientActiveTexture;
+	glad_debug_glClientWaitSync = wrap ? glad_debug_impl_glClientWaitSync : glad_glClientWaitSync;
+	glad_debug_glClipControl = wrap ? glad_debug_impl_glClipControl : glad_glClipControl;
+	glad_debug_glClipPlane = wrap ? glad_debug_impl_glClipPlane : glad_glClipPlane;
+	glad_debug_glColor3b = wrap ? glad_debug_impl_glColor3b : glad_glColor3b;
+	glad_debug_glColor3bv = wrap ? glad_debug_impl_glColor3bv : glad_glColor3bv;
+	glad_debug_glColor3d = wrap ? glad_debug_impl_glColor3d : glad_glColor3d;
+	glad_debug_glColor3dv = wrap ? glad_debug_impl_glColor3dv : glad_glColor3dv;
+	glad_debug_glColor3f = wrap ? glad_debug_impl_glColor3f : glad_glColor3f;
+	glad_debug_glColor3fv = wrap ? glad_debug_impl_glColor3fv : glad_glColor3fv;
+	glad_debug_glColor3i = wrap ? glad_debug_impl_glColor3i : glad_glColor3i;
+	glad_debug_glColor3iv = wrap ? glad_debug_impl_glColor3iv : glad_glColor3iv;
+	glad_debug_glColor3s = wrap ? glad_debug_impl_glColor3s : glad_glColor3s;
+	glad_debug_glColor3sv = wrap ? glad_debug_impl_glColor3sv : glad_glColor3sv;
+	glad_debug_glColor3ub = wrap ? glad_debug_impl_glColor3ub : glad_glColor3ub;
+	glad_debug_glColor3ubv = wrap ? glad_debug_impl_glColor3ubv : glad_glColor3ubv;
+	glad_debug_glColor3ui = wrap ? glad_debug_impl_glColor3ui : glad_glColor3ui;
+	glad_debug_glColor3uiv = wrap ? glad_debug_impl_glColor3uiv : glad_glColor3uiv;
+	glad_debug_glColor3us = wrap ? glad_debug_impl_glColor3us : glad_glColor3us;
+	glad_debug_glColor3usv = wrap ? glad_debug_impl_glColor3usv : glad_glColor3usv;
+	glad_debug_glColor4b = wrap ? glad_debug_impl_glColor4b : glad_glColor4b;
+	glad_debug_glColor4bv = wrap ? glad_debug_impl_glColor4bv : glad_glColor4bv;
+	glad_debug_glColor4d = wrap ? glad_debug_impl_glColor4d : glad_glColor4d;
+	glad_debug_glColor4dv = wrap ? glad_debug_impl_glColor4dv : glad_glColor4dv;
+	glad_debug_glColor4f = wrap ? glad_debug_impl_glColor4f : glad_glColor4f;
+	glad_debug_glColor4fv = wrap ? glad_debug_impl_glColor4fv : glad_glColor4fv;
+	glad_debug_glColor4i = wrap ? glad_debug_impl_glColor4i : glad_glColor4i;
+	glad_debug_glColor4iv = wrap ? glad_debug_impl_glColor4iv : glad_glColor4iv;
+	glad_debug_glColor4s = wrap ? glad_debug_impl_glColor4s : glad_glColor4s;
+	glad_debug_glColor4sv = wrap ? glad_debug_impl_glColor4sv : glad_glColor4sv;
+	glad_debug_glColor4ub = wrap ? glad_debug_impl_glColor4ub : glad_glColor4ub;
+	glad_debug_glColor4ubv = wrap ? glad_debug_impl_glColor4ubv : glad_glColor4ubv;
+	glad_debug_glColor4ui = wrap ? glad_debug_impl_glColor4ui : glad_glColor4ui;
+	glad_debug_glColor4uiv = wrap ? glad_debug_impl_glColor4uiv : glad_glColor4uiv;
+	glad_debug_glColor4us = wrap ? glad_debug_impl_glColor4us : glad_glColor4us;
+	glad_debug_glColor4usv = wrap ? glad_debug_impl_glColor4usv : glad_glColor4usv;
+	glad_debug_glColorMask = wrap ? glad_debug_impl_glColorMask : glad_glColorMask;
+	glad_debug_glColorMaski = wrap ? glad_debug_impl_glColorMaski : glad_glColorMaski;
+	glad_debug_glColorMaterial = wrap ? glad_debug_impl_glColorMaterial : glad_glColorMaterial;
+	glad_debug_glColorP3ui = wrap ? glad_debug_impl_glColorP3ui : glad_glColorP3ui;
+	glad_debug_glColorP3uiv = wrap ? glad_debug_impl_glColorP3uiv : glad_glColorP3uiv;
+	glad_debug_glColorP4ui = wrap ? glad_debug_impl_glColorP4ui : glad_glColorP4ui;
+	glad_debug_glColorP4uiv = wrap ? glad_debug_impl_glColorP4uiv : glad_glColorP4uiv;
+	glad_debug_glColorPointer = wrap ? glad_debug_impl_glColorPointer : glad_glColorPointer;
+	glad_debug_glCompileShader = wrap ? glad_debug_impl_glCompileShader : glad_glCompileShader;
+	glad_debug_glCompressedTexImage1D = wrap ? glad_debug_impl_glCompressedTexImage1D : glad_glCompressedTexImage1D;
+	glad_debug_glCompressedTexImage2D = wrap ? glad_debug_impl_glCompressedTexImage2D : glad_glCompressedTexImage2D;
+	glad_debug_glCompressedTexImage3D = wrap ? glad_debug_impl_glCompressedTexImage3D : glad_glCompressedTexImage3D;
+	glad_debug_glCompressedTexSubImage1D = wrap ? glad_debug_impl_glCompressedTexSubImage1D : glad_glCompressedTexSubImage1D;
+	glad_debug_glCompressedTexSubImage2D = wrap ? glad_debug_impl_glCompressedTexSubImage2D : glad_glCompressedTexSubImage2D;
+	glad_debug_glCompressedTexSubImage3D = wrap ? glad_debug_impl_glCompressedTexSubImage3D : glad_glCompressedTexSubImage3D;
+	glad_debug_glCompressedTextureSubImage1D = wrap ? glad_debug_impl_glCompressedTextureSubImage1D : glad_glCompressedTextureSubImage1D;
+	glad_debug_glCompressedTextureSubImage2D = wrap ? glad_debug_impl_glCompressedTextureSubImage2D : glad_glCompressedTextureSubImage2D;
+	glad_debug_glCompressedTextureSubImage3D = wrap ? glad_debug_impl_glCompressedTextureSubImage3D : glad_glCompressedTextureSubImage3D;
+	glad_debug_glCopyBufferSubData = wrap ? glad_debug_impl_glCopyBufferSubData : glad_glCopyBufferSubData;
+	glad_debug_glCopyImageSubData = wrap ? glad_debug_impl_glCopyImageSubData : glad_glCopyImageSubData;
+	glad_debug_glCopyNamedBufferSubData = wrap ? glad_debug_impl_glCopyNamedBufferSubData : glad_glCopyNamedBufferSubData;
+	glad_debug_glCopyPixels = wrap ? glad_debug_impl_glCopyPixels : glad_glCopyPixels;
+	glad_debug_glCopyTexImage1D = wrap ? glad_debug_impl_glCopyTexImage1D : glad_glCopyTexImage1D;
+	glad_debug_glCopyTexImage2D = wrap ? glad_debug_impl_glCopyTexImage2D : glad_glCopyTexImage2D;
+	glad_debug_glCopyTexSubImage1D = wrap ? glad_debug_impl_glCopyTexSubImage1D : glad_glCopyTexSubImage1D;
+	glad_debug_glCopyTexSubImage2D = wrap ? glad_debug_impl_glCopyTexSubImage2D : glad_glCopyTexSubImage2D;
+	glad_debug_glCopyTexSubImage3D = wrap ? glad_debug_impl_glCopyTexSubImage3D : glad_glCopyTexSubImage3D;
+	glad_debug_glCopyTextureSubImage1D = wrap ? glad_debug_impl_glCopyTextureSubImage1D : glad_glCopyTextureSubImage1D;
+	glad_debug_glCopyTextureSubImage2D = wrap ? glad_debug_impl_glCopyTextureSubImage2D : glad_glCopyTextureSubImage2D;
+	glad_debug_glCopyTextureSubImage3D = wrap ? glad_debug_impl_glCopyTextureSubImage3D : glad_glCopyTextureSubImage3D;
+	glad_debug_glCreateBuffers = wrap ? glad_debug_impl_glCreateBuffers : glad_glCreateBuffers;
+	glad_debug_glCreateFramebuffers = wrap ? glad_debug_impl_glCreateFramebuffers : glad_glCreateFramebuffers;
+	glad_debug_glCreateProgram = wrap ? glad_debug_impl_glCreateProgram : glad_glCreateProgram;
+	glad_debug_glCreateProgramPipelines = wrap ? glad_debug_impl_glCreateProgramPipelines : glad_glCreateProgramPipelines;
+	glad_debug_glCreateQueries = wrap ? glad_debug_impl_glCreateQueries : glad_glCreateQueries;
+	glad_debug_glCreateRenderbuffers = wrap ? glad_debug_impl_glCreateRenderbuffers : glad_glCreateRenderbuffers;
+	glad_debug_glCreateSamplers = wrap ? glad_debug_impl_glCreateSamplers : glad_glCreateSamplers;
+	glad_debug_glCreateShader = wrap ? glad_debug_impl_glCreateShader : glad_glCreateShader;
+	glad_debug_glCreateShaderProgramv = wrap ? glad_debug_impl_glCreateShaderProgramv : glad_glCreateShaderProgramv;
+	glad_debug_glCreateTextures = wrap ? glad_debug_impl_glCreateTextures : glad_glCreateTextures;
+	glad_debug_glCreateTransformFeedbacks = wrap ? glad_debug_impl_glCreateTransformFeedbacks : glad_glCreateTransformFeedbacks;
+	glad_debug_glCreateVertexArrays = wrap ? glad_debug_impl_glCreateVertexArrays : glad_glCreateVertexArrays;
+	glad_debug_glCullFace = wrap ? glad_debug_impl_glCullFace : glad_glCullFace;
+	glad_debug_glDebugMessageCallback = wrap ? glad_debug_impl_glDebugMessageCallback : glad_glDebugMessageCallback;
+	glad_debug_glDebugMessageControl = wrap ? glad_debug_impl_glDebugMessageControl : glad_glDebugMessageControl;
+	glad_debug_glDebugMessageInsert = wrap ? glad_debug_impl_glDebugMessageInsert : glad_glDebugMessageInsert;
+	glad_debug_glDeleteBuffers = wrap ? glad_debug_impl_glDeleteBuffers : glad_glDeleteBuffers;
+	glad_debug_glDeleteFramebuffers = wrap ? glad_debug_impl_glDeleteFramebuffers : glad_glDeleteFramebuffers;
+	glad_debug_glDeleteLists = wrap ? glad_debug_impl_glDeleteLists : glad_glDeleteLists;
+	glad_debug_glDeleteProgram = wrap ? glad_debug_impl_glDeleteProgram : glad_glDeleteProgram;
+	glad_debug_glDeleteProgramPipelines = wrap ? glad_debug_impl_glDeleteProgramPipelines : glad_glDeleteProgramPipelines;
+	glad_debug_glDeleteQueries = wrap ? glad_debug_impl_glDeleteQueries : glad_glDeleteQueries;
+	glad_debug_glDeleteRenderbuffers = wrap ? glad_debug_impl_glDeleteRenderbuffers : glad_glDeleteRenderbuffers;
+	glad_debug_glDeleteSamplers = wrap ? glad_debug_impl_glDeleteSamplers : glad_glDeleteSamplers;
+	glad_debug_glDeleteShader = wrap ? glad_debug_impl_glDeleteShader : glad_glDeleteShader;
+	glad_debug_glDeleteSync = wrap ? glad_debug_impl_glDeleteSync : glad_glDeleteSync;
+	glad_debug_glDeleteTextures = wrap ? glad_debug_impl_glDeleteTextures : glad_glDeleteTextures;
+	glad_debug_glDeleteTransformFeedbacks = wrap ? glad_debug_impl_glDeleteTransformFeedbacks : glad_glDeleteTransformFeedbacks;
+	glad_debug_glDeleteVertexArrays = wrap ? glad_debug_impl_glDeleteVertexArrays : glad_glDeleteVertexArrays;
+	glad_debug_glDepthFunc = wrap ? glad_debug_impl_glDepthFunc : glad_glDepthFunc;
+	glad_debug_glDepthMask = wrap ? glad_debug_impl_glDepthMask : glad_glDepthMask;
+	glad_debug_glDepthRange = wrap ? glad_debug_impl_glDepthRange : glad_glDepthRange;
+	glad_debug_glDepthRangeArrayv = wrap ? glad_debug_impl_glDepthRangeArrayv : glad_glDepthRangeArrayv;
+	glad_debug_glDepthRangeIndexed = wrap ? glad_debug_impl_glDepthRangeIndexed : glad_glDepthRangeIndexed;
+	glad_debug_glDepthRangef = wrap ? glad_debug_impl_glDepthRangef : glad_glDepthRangef;
+	glad_debug_glDetachShader = wrap ? glad_debug_impl_glDetachShader : glad_glDetachShader;
+	glad_debug_glDisable = wrap ? glad_debug_impl_glDisable : glad_glDisable;
+	glad_debug_glDisableClientState = wrap ? glad_debug_impl_glDisableClientState : glad_glDisableClientState;
+	glad_debug_glDisableVertexArrayAttrib = wrap ? glad_debug_impl_glDisableVertexArrayAttrib : glad_glDisableVertexArrayAttrib;
+	glad_debug_glDisableVertexAttribArray = wrap ? glad_debug_impl_glDisableVertexAttribArray : glad_glDisableVertexAttribArray;
+	glad_debug_glDisablei = wrap ? glad_debug_impl_glDisablei : glad_glDisablei;
+	glad_debug_glDispatchCompute = wrap ? glad_debug_impl_glDispatchCompute : glad_glDispatchCompute;
+	glad_debug_glDispatchComputeIndirect = wrap ? glad_debug_impl_glDispatchComputeIndirect : glad_glDispatchComputeIndirect;
+	glad_debug_glDrawArrays = wrap ? glad_debug_impl_glDrawArrays : glad_glDrawArrays;
+	glad_debug_glDrawArraysIndirect = wrap ? glad_debug_impl_glDrawArraysIndirect : glad_glDrawArraysIndirect;
+	glad_debug_glDrawArraysInstanced = wrap ? glad_debug_impl_glDrawArraysInstanced : glad_glDrawArraysInstanced;
+	glad_debug_glDrawArraysInstancedBaseInstance = wrap ? glad_debug_impl_glDrawArraysInstancedBaseInstance : glad_glDrawArraysInstancedBaseInstance;
+	glad_debug_glDrawBuffer = wrap ? glad_debug_impl_glDrawBuffer : glad_glDrawBuffer;
+	glad_debug_glDrawBuffers = wrap ? glad_debug_impl_glDrawBuffers : glad_glDrawBuffers;
+	glad_debug_glDrawElements = wrap ? glad_debug_impl_glDrawElements : glad_glDrawElements;
+	glad_debug_glDrawElementsBaseVertex = wrap ? glad_debug_impl_glDrawElementsBaseVertex : glad_glDrawElementsBaseVertex;
+	glad_debug_glDrawElementsIndirect = wrap ? glad_debug_impl_glDrawElementsIndirect : glad_glDrawElementsIndirect;
+	glad_debug_glDrawElementsInstanced = wrap ? glad_debug_impl_glDrawElementsInstanced : glad_glDrawElementsInstanced;
+	glad_debug_glDrawElementsInstancedBaseInstance = wrap ? glad_debug_impl_glDrawElementsInstancedBaseInstance : glad_glDrawElementsInstancedBaseInstance;
+	glad_debug_glDrawElementsInstancedBaseVertex = wrap ? glad_debug_impl_glDrawElementsInstancedBaseVertex : glad_glDrawElementsInstancedBaseVertex;
+	glad_debug_glDrawElementsInstancedBaseVertexBaseInstance = wrap ? glad_debug_impl_glDrawElementsInstancedBaseVertexBaseInstance : glad_glDrawElementsInstancedBaseVertexBaseInstance;
+	glad_debug_glDrawPixels = wrap ? glad_debug_impl_glDrawPixels : glad_glDrawPixels;
+	glad_debug_glDrawRangeElements = wrap ? glad_debug_impl_glDrawRangeElements : glad_glDrawRangeElements;
+	glad_debug_glDrawRangeElementsBaseVertex = wrap ? glad_debug_impl_glDrawRangeElementsBaseVertex : glad_glDrawRangeElementsBaseVertex;
+	glad_debug_glDrawTransformFeedback = wrap ? glad_debug_impl_glDrawTransformFeedback : glad_glDrawTransformFeedback;
+	glad_debug_glDrawTransformFeedbackInstanced = wrap ? glad_debug_impl_glDrawTransformFeedbackInstanced : glad_glDrawTransformFeedbackInstanced;
+	glad_debug_glDrawTransformFeedbackStream = wrap ? glad_debug_impl_glDrawTransformFeedbackStream : glad_glDrawTransformFeedbackStream;
+	glad_debug_glDrawTransformFeedbackStreamInstanced = wrap ? glad_debug_impl_glDrawTransformFeedbackStreamInstanced : glad_glDrawTransformFeedbackStreamInstanced;
+	glad_debug_glEdgeFlag = wrap ? glad_debug_impl_glEdgeFlag : glad_glEdgeFlag;
+	glad_debug_glEdgeFlagPointer = wrap ? glad_debug_impl_glEdgeFlagPointer : glad_glEdgeFlagPointer;
+	glad_debug_glEdgeFlagv = wrap ? glad_debug_impl_glEdgeFlagv : glad_glEdgeFlagv;
+	glad_debug_glEnable = wrap ? glad_debug_impl_glEnable : glad_glEnable;
+	glad_debug_glEnableClientState = wrap ? glad_debug_impl_glEnableClientState : glad_glEnableClientState;
+	glad_debug_glEnableVertexArrayAttrib = wrap ? glad_debug_impl_glEnableVertexArrayAttrib : glad_glEnableVertexArrayAttrib;
+	glad_debug_glEnableVertexAttribArray = wrap ? glad_debug_impl_glEnableVertexAttribArray : glad_glEnableVertexAttribArray;
+	glad_debug_glEnablei = wrap ? glad_debug_impl_glEnablei : glad_glEnablei;
+	glad_debug_glEnd = wrap ? glad_debug_impl_glEnd : glad_glEnd;
+	glad_debug_glEndConditionalRender = wrap ? glad_debug_impl_glEndConditionalRender : glad_glEndConditionalRender;
+	glad_debug_glEndList = wrap ? glad_debug_impl_glEndList : glad_glEndList;
+	glad_debug_glEndQuery = wrap ? glad_debug_impl_glEndQuery : glad_glEndQuery;
+	glad_debug_glEndQueryIndexed = wrap ? glad_debug_impl_glEndQueryIndexed : glad_glEndQueryIndexed;
+	glad_debug_glEndTransformFeedback = wrap ? glad_debug_impl_glEndTransformFeedback : glad_glEndTransformFeedback;
+	glad_debug_glEvalCoord1d = wrap ? glad_debug_impl_glEvalCoord1d : glad_glEvalCoord1d;
+	glad_debug_glEvalCoord1dv = wrap ? glad_debug_impl_glEvalCoord1dv : glad_glEvalCoord1dv;
+	glad_debug_glEvalCoord1f = wrap ? glad_debug_impl_glEvalCoord1f : glad_glEvalCoord1f;
+	glad_debug_glEvalCoord1fv = wrap ? glad_debug_impl_glEvalCoord1fv : glad_glEvalCoord1fv;
+	glad_debug_glEvalCoord2d = wrap ? glad_debug_impl_glEvalCoord2d : glad_glEvalCoord2d;
+	glad_debug_glEvalCoord2dv = wrap ? glad_debug_impl_glEvalCoord2dv : glad_glEvalCoord2dv;
+	glad_debug_glEvalCoord2f = wrap ? glad_debug_impl_glEvalCoord2f : glad_glEvalCoord2f;
+	glad_debug_glEvalCoord2fv = wrap ? glad_debug_impl_glEvalCoord2fv : glad_glEvalCoord2fv;
+	glad_debug_glEvalMesh1 = wrap ? glad_debug_impl_glEvalMesh1 : glad_glEvalMesh1;
+	glad_debug_glEvalMesh2 = wrap ? glad_debug_impl_glEvalMesh2 : glad_glEvalMesh2;
+	glad_debug_glEvalPoint1 = wrap ? glad_debug_impl_glEvalPoint1 : glad_glEvalPoint1;
+	glad_debug_glEvalPoint2 = wrap ? glad_debug_impl_glEvalPoint2 : glad_glEvalPoint2;
+	glad_debug_glFeedbackBuffer = wrap ? glad_debug_impl_glFeedbackBuffer : glad_glFeedbackBuffer;
+	glad_debug_glFenceSync = wrap ? glad_debug_impl_glFenceSync : glad_glFenceSync;
+	glad_debug_glFinish = wrap ? glad_debug_impl_glFinish : glad_glFinish;
+	glad_debug_glFlush = wrap ? glad_debug_impl_glFlush : glad_glFlush;
+	glad_debug_glFlushMappedBufferRange = wrap ? glad_debug_impl_glFlushMappedBufferRange : glad_glFlushMappedBufferRange;
+	glad_debug_glFlushMappedNamedBufferRange = wrap ? glad_debug_impl_glFlushMappedNamedBufferRange : glad_glFlushMappedNamedBufferRange;
+	glad_debug_glFogCoordPointer = wrap ? glad_debug_impl_glFogCoordPointer : glad_glFogCoordPointer;
+	glad_debug_glFogCoordd = wrap ? glad_debug_impl_glFogCoordd : glad_glFogCoordd;
+	glad_debug_glFogCoorddv = wrap ? glad_debug_impl_glFogCoorddv : glad_glFogCoorddv;
+	glad_debug_glFogCoordf = wrap ? glad_debug_impl_glFogCoordf : glad_glFogCoordf;
+	glad_debug_glFogCoordfv = wrap ? glad_debug_impl_glFogCoordfv : glad_glFogCoordfv;
+	glad_debug_glFogf = wrap ? glad_debug_impl_glFogf : glad_glFogf;
+	glad_debug_glFogfv = wrap ? glad_debug_impl_glFogfv : glad_glFogfv;
+	glad_debug_glFogi = wrap ? glad_debug_impl_glFogi : glad_glFogi;
+	glad_debug_glFogiv = wrap ? glad_debug_impl_glFogiv : glad_glFogiv;
+	glad_debug_glFramebufferParameteri = wrap ? glad_debug_impl_glFramebufferParameteri : glad_glFramebufferParameteri;
+	glad_debug_glFramebufferRenderbuffer = wrap ? glad_debug_impl_glFramebufferRenderbuffer : glad_glFramebufferRenderbuffer;
+	glad_debug_glFramebufferTexture = wrap ? glad_debug_impl_glFramebufferTexture : glad_glFramebufferTexture;
+	glad_debug_glFramebufferTexture1D = wrap ? glad_debug_impl_glFramebufferTexture1D : glad_glFramebufferTexture1D;
+	glad_debug_glFramebufferTexture2D = wrap ? glad_debug_impl_glFramebufferTexture2D : glad_glFramebufferTexture2D;
+	glad_debug_glFramebufferTexture3D = wrap ? glad_debug_impl_glFramebufferTexture3D : glad_glFramebufferTexture3D;
+	glad_debug_glFramebufferTextureLayer = wrap ? glad_debug_impl_glFramebufferTextureLayer : glad_glFramebufferTextureLayer;
+	glad_debug_glFrontFace = wrap ? glad_debug_impl_glFrontFace : glad_glFrontFace;
+	glad_debug_glFrustum = wrap ? glad_debug_impl_glFrustum : glad_glFrustum;
+	glad_debug_glGenBuffers = wrap ? glad_debug_impl_glGenBuffers : glad_glGenBuffers;
+	glad_debug_glGenFramebuffers = wrap ? glad_debug_impl_glGenFramebuffers : glad_glGenFramebuffers;
+	glad_debug_glGenLists = wrap ? glad_debug_impl_glGenLists : glad_glGenLists;
+	glad_debug_glGenProgramPipelines = wrap ? glad_debug_impl_glGenProgramPipelines : glad_glGenProgramPipelines;
+	glad_debug_glGenQueries = wrap ? glad_debug_impl_glGenQueries : glad_glGenQueries;
+	glad_debug_glGenRenderbuffers = wrap ? glad_debug_impl_glGenRenderbuffers : glad_glGenRenderbuffers;
+	glad_debug_glGenSamplers = wrap ? glad_debug_impl_glGenSamplers : glad_glGenSamplers;
+	glad_debug_glGenTextures = wrap ? glad_debug_impl_glGenTextures : glad_glGenTextures;
+	glad_debug_glGenTransformFeedbacks = wrap ? glad_debug_impl_glGenTransformFeedbacks : glad_glGenTransformFeedbacks;
+	glad_debug_glGenVertexArrays = wrap ? glad_debug_impl_glGenVertexArrays : glad_glGenVertexArrays;
+	glad_debug_glGenerateMipmap = wrap ? glad_debug_impl_glGenerateMipmap : glad_glGenerateMipmap;
+	glad_debug_glGenerateTextureMipmap = wrap ? glad_debug_impl_glGenerateTextureMipmap : glad_glGenerateTextureMipmap;
+	glad_debug_glGetActiveAtomicCounterBufferiv = wrap ? glad_debug_impl_glGetActiveAtomicCounterBufferiv : glad_glGetActiveAtomicCounterBufferiv;
+	glad_debug_glGetActiveAttrib = wrap ? glad_debug_impl_glGetActiveAttrib : glad_glGetActiveAttrib;
+	glad_debug_glGetActiveSubroutineName = wrap ? glad_debug_impl_glGetActiveSubroutineName : glad_glGetActiveSubroutineName;
+	glad_debug_glGetActiveSubroutineUniformName = wrap ? glad_debug_impl_glGetActiveSubroutineUniformName : glad_glGetActiveSubroutineUniformName;
+	glad_debug_glGetActiveSubroutineUniformiv = wrap ? glad_debug_impl_glGetActiveSubroutineUniformiv : glad_glGetActiveSubroutineUniformiv;
+	glad_debug_glGetActiveUniform = wrap ? glad_debug_impl_glGetActiveUniform : glad_glGetActiveUniform;
+	glad_debug_glGetActiveUniformBlockName = wrap ? glad_debug_impl_glGetActiveUniformBlockName : glad_glGetActiveUniformBlockName;
+	glad_debug_glGetActiveUniformBlockiv = wrap ? glad_debug_impl_glGetActiveUniformBlockiv : glad_glGetActiveUniformBlockiv;
+	glad_debug_glGetActiveUniformName = wrap ? glad_debug_impl_glGetActiveUniformName : glad_glGetActiveUniformName;
+	glad_debug_glGetActiveUniformsiv = wrap ? glad_debug_impl_glGetActiveUniformsiv : glad_glGetActiveUniformsiv;
+	glad_debug_glGetAttachedShaders = wrap ? glad_debug_impl_glGetAttachedShaders : glad_glGetAttachedShaders;
+	glad_debug_glGetAttribLocation = wrap ? glad_debug_impl_glGetAttribLocation : glad_glGetAttribLocation;
+	glad_debug_glGetBooleani_v = wrap ? glad_debug_impl_glGetBooleani_v : glad_glGetBooleani_v;
+	glad_debug_glGetBooleanv = wrap ? glad_debug_impl_glGetBooleanv : glad_glGetBooleanv;
+	glad_debug_glGetBufferParameteri64v = wrap ? glad_debug_impl_glGetBufferParameteri64v : glad_glGetBufferParameteri64v;
+	glad_debug_glGetBufferParameteriv = wrap ? glad_debug_impl_glGetBufferParameteriv : glad_glGetBufferParameteriv;
+	glad_debug_glGetBufferPointerv = wrap ? glad_debug_impl_glGetBufferPointerv : glad_glGetBufferPointerv;
+	glad_debug_glGetBufferSubData = wrap ? glad_debug_impl_glGetBufferSubData : glad_glGetBufferSubData;
+	glad_debug_glGetClipPlane = wrap ? glad_debug_impl_glGetClipPlane : glad_glGetClipPlane;
+	glad_debug_glGetCompressedTexImage = wrap ? glad_debug_impl_glGetCompressedTexImage : glad_glGetCompressedTexImage;
+	glad_debug_glGetCompressedTextureImage = wrap ? glad_debug_impl_glGetCompressedTextureImage : glad_glGetCompressedTextureImage;
+	glad_debug_glGetCompressedTextureSubImage = wrap ? glad_debug_impl_glGetCompressedTextureSubImage : glad_glGetCompressedTextureSubImage;
+	glad_debug_glGetDebugMessageLog = wrap ? glad_debug_impl_glGetDebugMessageLog : glad_glGetDebugMessageLog;
+	glad_debug_glGetDoublei_v = wrap ? glad_debug_impl_glGetDoublei_v : glad_glGetDoublei_v;
+	glad_debug_glGetDoublev = wrap ? glad_debug_impl_glGetDoublev : glad_glGetDoublev;
+	glad_debug_glGetError = wrap ? glad_debug_impl_glGetError : glad_glGetError;
+	glad_debug_glGetFloati_v = wrap ? glad_debug_impl_glGetFloati_v : glad_glGetFloati_v;
+	glad_debug_glGetFloatv = wrap ? glad_debug_impl_glGetFloatv : glad_glGetFloatv;
+	glad_debug_glGetFragDataIndex = wrap ? glad_debug_impl_glGetFragDataIndex : glad_glGetFragDataIndex;
+	glad_debug_glGetFragDataLocation = wrap ? glad_debug_impl_glGetFragDataLocation : glad_glGetFragDataLocation;
+	glad_debug_glGetFramebufferAttachmentParameteriv = wrap ? glad_debug_impl_glGetFramebufferAttachmentParameteriv : glad_glGetFramebufferAttachmentParameteriv;
+	glad_debug_glGetFramebufferParameteriv = wrap ? glad_debug_impl_glGetFramebufferParameteriv : glad_glGetFramebufferParameteriv;
+	glad_debug_glGetGraphicsResetStatus = wrap ? glad_debug_impl_glGetGraphicsResetStatus : glad_glGetGraphicsResetStatus;
+	glad_debug_glGetImageHandleARB = wrap ? glad_debug_impl_glGetImageHandleARB : glad_glGetImageHandleARB;
+	glad_debug_glGetInteger64i_v = wrap ? glad_debug_impl_glGetInteger64i_v : glad_glGetInteger64i_v;
+	glad_debug_glGetInteger64v = wrap ? glad_debug_impl_glGetInteger64v : glad_glGetInteger64v;
+	glad_debug_glGetIntegeri_v = wrap ? glad_debug_impl_glGetIntegeri_v : glad_glGetIntegeri_v;
+	glad_debug_glGetIntegerv = wrap ? glad_debug_impl_glGetIntegerv : glad_glGetIntegerv;
+	glad_debug_glGetInternalformati64v = wrap ? glad_debug_impl_glGetInternalformati64v : glad_glGetInternalformati64v;
+	glad_debug_glGetInternalformativ = wrap ? glad_debug_impl_glGetInternalformativ : glad_glGetInternalformativ;
+	glad_debug_glGetLightfv = wrap ? glad_debug_impl_glGetLightfv : glad_glGetLightfv;
+	glad_debug_glGetLightiv = wrap ? glad_debug_impl_glGetLightiv : glad_glGetLightiv;
+	glad_debug_glGetMapdv = wrap ? glad_debug_impl_glGetMapdv : glad_glGetMapdv;
+	glad_debug_glGetMapfv = wrap ? glad_debug_impl_glGetMapfv : glad_glGetMapfv;
+	glad_debug_glGetMapiv = wrap ? glad_debug_impl_glGetMapiv : glad_glGetMapiv;
+	glad_debug_glGetMaterialfv = wrap ? glad_debug_impl_glGetMaterialfv : glad_glGetMaterialfv;
+	glad_debug_glGetMaterialiv = wrap ? glad_debug_impl_glGetMaterialiv : glad_glGetMaterialiv;
+	glad_debug_glGetMultisamplefv = wrap ? glad_debug_impl_glGetMultisamplefv : glad_glGetMultisamplefv;
+	glad_debug_glGetNamedBufferParameteri64v = wrap ? glad_debug_impl_glGetNamedBufferParameteri64v : glad_glGetNamedBufferParameteri64v;
+	glad_debug_glGetNamedBufferParameteriv = wrap ? glad_debug_impl_glGetNamedBufferParameteriv : glad_glGetNamedBufferParameteriv;
+	glad_debug_glGetNamedBufferPointerv = wrap ? glad_debug_impl_glGetNamedBufferPointerv : glad_glGetNamedBufferPointerv;
+	glad_debug_glGetNamedBufferSubData = wrap ? glad_debug_impl_glGetNamedBufferSubData : glad_glGetNamedBufferSubData;
+	glad_debug_glGetNamedFramebufferAttachmentParameteriv = wrap ? glad_debug_impl_glGetNamedFramebufferAttachmentParameteriv : glad_glGetNamedFramebufferAttachmentParameteriv;
+	glad_debug_glGetNamedFramebufferParameteriv = wrap ? glad_debug_impl_glGetNamedFramebufferParameteriv : glad_glGetNamedFramebufferParameteriv;
+	glad_debug_glGetNamedRenderbufferParameteriv = wrap ? glad_debug_impl_glGetNamedRenderbufferParameteriv : glad_glGetNamedRenderbufferParameteriv;
+	glad_debug_glGetObjectLabel = wrap ? glad_debug_impl_glGetObjectLabel : glad_glGetObjectLabel;
+	glad_debug_glGetObjectPtrLabel = wrap ? glad_debug_impl_glGetObjectPtrLabel : glad_glGetObjectPtrLabel;
+	glad_debug_glGetPixelMapfv = wrap ? glad_debug_impl_glGetPixelMapfv : glad_glGetPixelMapfv;
+	glad_debug_glGetPixelMapuiv = wrap ? glad_debug_impl_glGetPixelMapuiv : glad_glGetPixelMapuiv;
+	glad_debug_glGetPixelMapusv = wrap ? glad_debug_impl_glGetPixelMapusv : glad_glGetPixelMapusv;
+	glad_debug_glGetPointerv = wrap ? glad_debug_impl_glGetPointerv : glad_glGetPointerv;
+	glad_debug_glGetPolygonStipple = wrap ? glad_debug_impl_glGetPolygonStipple : glad_glGetPolygonStipple;
+	glad_debug_glGetProgramBinary = wrap ? glad_debug_impl_glGetProgramBinary : glad_glGetProgramBinary;
+	glad_debug_glGetProgramInfoLog = wrap ? glad_debug_impl_glGetProgramInfoLog : glad_glGetProgramInfoLog;
+	glad_debug_glGetProgramInterfaceiv = wrap ? glad_debug_impl_glGetProgramInterfaceiv : glad_glGetProgramInterfaceiv;
+	glad_debug_glGetProgramPipelineInfoLog = wrap ? glad_debug_impl_glGetProgramPipelineInfoLog : glad_glGetProgramPipelineInfoLog;
+	glad_debug_glGetProgramPipelineiv = wrap ? glad_debug_impl_glGetProgramPipelineiv : glad_glGetProgramPipelineiv;
+	glad_debug_glGetProgramResourceIndex = wrap ? glad_debug_impl_glGetProgramResourceIndex : glad_glGetProgramResourceIndex;
+	glad_debug_glGetProgramResourceLocation = wrap ? glad_debug_impl_glGetProgramResourceLocation : glad_glGetProgramResourceLocation;
+	glad_debug_glGetProgramResourceLocationIndex = wrap ? glad_debug_impl_glGetProgramResourceLocationIndex : glad_glGetProgramResourceLocationIndex;
+	glad_debug_glGetProgramResourceName = wrap ? glad_debug_impl_glGetProgramResourceName : glad_glGetProgramResourceName;
+	glad_debug_glGetProgramResourceiv = wrap ? glad_debug_impl_glGetProgramResourceiv : glad_glGetProgramResourceiv;
+	glad_debug_glGetProgramStageiv = wrap ? glad_debug_impl_glGetProgramStageiv : glad_glGetProgramStageiv;
+	glad_debug_glGetProgramiv = wrap ? glad_debug_impl_glGetProgramiv : glad_glGetProgramiv;
+	glad_debug_glGetQueryBufferObjecti64v = wrap ? glad_debug_impl_glGetQueryBufferObjecti64v : glad_glGetQueryBufferObjecti64v;
+	glad_debug_glGetQueryBufferObjectiv = wrap ? glad_debug_impl_glGetQueryBufferObjectiv : glad_glGetQueryBufferObjectiv;
+	glad_debug_glGetQueryBufferObjectui64v = wrap ? glad_debug_impl_glGetQueryBufferObjectui64v : glad_glGetQueryBufferObjectui64v;
+	glad_debug_glGetQueryBufferObjectuiv = wrap ? glad_debug_impl_glGetQueryBufferObjectuiv : glad_glGetQueryBufferObjectuiv;
+	glad_debug_glGetQueryIndexediv = wrap ? glad_debug_impl_glGetQueryIndexediv : glad_glGetQueryIndexediv;
+	glad_debug_glGetQueryObjecti64v = wrap ? glad_debug_impl_glGetQueryObjecti64v : glad_glGetQueryObjecti64v;
+	glad_debug_glGetQueryObjectiv = wrap ? glad_debug_impl_glGetQueryObjectiv : glad_glGetQueryObjectiv;
+	glad_debug_glGetQueryObjectui64v = wrap ? glad_debug_impl_glGetQueryObjectui64v : glad_glGetQueryObjectui64v;
+	glad_debug_glGetQueryObjectuiv = wrap ? glad_debug_impl_glGetQueryObjectuiv : glad_glGetQueryObjectuiv;
+	glad_debug_glGetQueryiv = wrap ? glad_debug_impl_glGetQueryiv : glad_glGetQueryiv;
+	glad_debug_glGetRenderbufferParameteriv = wrap ? glad_debug_impl_glGetRenderbufferParameteriv : glad_glGetRenderbufferParameteriv;
+	glad_debug_glGetSamplerParameterIiv = wrap ? glad_debug_impl_glGetSamplerParameterIiv : glad_glGetSamplerParameterIiv;
+	glad_debug_glGetSamplerParameterIuiv = wrap ? glad_debug_impl_glGetSamplerParameterIuiv : glad_glGetSamplerParameterIuiv;
+	glad_debug_glGetSamplerParameterfv = wrap ? glad_debug_impl_glGetSamplerParameterfv : glad_glGetSamplerParameterfv;
+	glad_debug_glGetSamplerParameteriv = wrap ? glad_debug_impl_glGetSamplerParameteriv : glad_glGetSamplerParameteriv;
+	glad_debug_glGetShaderInfoLog = wrap ? glad_debug_impl_glGetShaderInfoLog : glad_glGetShaderInfoLog;
+	glad_debug_glGetShaderPrecisionFormat = wrap ? glad_debug_impl_glGetShaderPrecisionFormat : glad_glGetShaderPrecisionFormat;
+	glad_debug_glGetShaderSource = wrap ? glad_debug_impl_glGetShaderSource : glad_glGetShaderSource;
+	glad_debug_glGetShaderiv = wrap ? glad_debug_impl_glGetShaderiv : glad_glGetShaderiv;
+	glad_debug_glGetString = wrap ? glad_debug_impl_glGetString : glad_glGetString;
+	glad_debug_glGetStringi = wrap ? glad_debug_impl_glGetStringi : glad_glGetStringi;
+	glad_debug_glGetSubroutineIndex = wrap ? glad_debug_impl_glGetSubroutineIndex : glad_glGetSubroutineIndex;
+	glad_debug_glGetSubroutineUniformLocation = wrap ? glad_debug_impl_glGetSubroutineUniformLocation : glad_glGetSubroutineUniformLocation;
+	glad_debug_glGetSynciv = wrap ? glad_debug_impl_glGetSynciv : glad_glGetSynciv;
+	glad_debug_glGetTexEnvfv = wrap ? glad_debug_impl_glGetTexEnvfv : glad_glGetTexEnvfv;
+	glad_debug_glGetTexEnviv = wrap ? glad_debug_impl_glGetTexEnviv : glad_glGetTexEnviv;
+	glad_debug_glGetTexGendv = wrap ? glad_debug_impl_glGetTexGendv : glad_glGetTexGendv;
+	glad_debug_glGetTexGenfv = wrap ? glad_debug_impl_glGetTexGenfv : glad_glGetTexGenfv;
+	glad_debug_glGetTexGeniv = wrap ? glad_debug_impl_glGetTexGeniv : glad_glGetTexGeniv;
+	glad_debug_glGetTexImage = wrap ? glad_debug_impl_glGetTexImage : glad_glGetTexImage;
+	glad_debug_glGetTexLevelParameterfv = wrap ? glad_debug_impl_glGetTexLevelParameterfv : glad_glGetTexLevelParameterfv;
+	glad_debug_glGetTexLevelParameteriv = wrap ? glad_debug_impl_glGetTexLevelParameteriv : glad_glGetTexLevelParameteriv;
+	glad_debug_glGetTexParameterIiv = wrap ? glad_debug_impl_glGetTexParameterIiv : glad_glGetTexParameterIiv;
+	glad_debug_glGetTexParameterIuiv = wrap ? glad_debug_impl_glGetTexParameterIuiv : glad_glGetTexParameterIuiv;
+	glad_debug_glGetTexParameterfv = wrap ? glad_debug_impl_glGetTexParameterfv : glad_glGetTexParameterfv;
+	glad_debug_glGetTexParameteriv = wrap ? glad_debug_impl_glGetTexParameteriv : glad_glGetTexParameteriv;
+	glad_debug_glGetTextureHandleARB = wrap ? glad_debug_impl_glGetTextureHandleARB : glad_glGetTextureHandleARB;
+	glad_debug_glGetTextureImage = wrap ? glad_debug_impl_glGetTextureImage : glad_glGetTextureImage;
+	glad_debug_glGetTextureLevelParameterfv = wrap ? glad_debug_impl_glGetTextureLevelParameterfv : glad_glGetTextureLevelParameterfv;
+	glad_debug_glGetTextureLevelParameteriv = wrap ? glad_debug_impl_glGetTextureLevelParameteriv : glad_glGetTextureLevelParameteriv;
+	glad_debug_glGetTextureParameterIiv = wrap ? glad_debug_impl_glGetTextureParameterIiv : glad_glGetTextureParameterIiv;
+	glad_debug_glGetTextureParameterIuiv = wrap ? glad_debug_impl_glGetTextureParameterIuiv : glad_glGetTextureParameterIuiv;
+	glad_debug_glGetTextureParameterfv = wrap ? glad_debug_impl_glGetTextureParameterfv : glad_glGetTextureParameterfv;
+	glad_debug_glGetTextureParameteriv = wrap ? glad_debug_impl_glGetTextureParameteriv : glad_glGetTextureParameteriv;
+	glad_debug_glGetTextureSamplerHandleARB = wrap ? glad_debug_impl_glGetTextureSamplerHandleARB : glad_glGetTextureSamplerHandleARB;
+	glad_debug_glGetTextureSubImage = wrap ? glad_debug_impl_glGetTextureSubImage : glad_glGetTextureSubImage;
+	glad_debug_glGetTransformFeedbackVarying = wrap ? glad_debug_impl_glGetTransformFeedbackVarying : glad_glGetTransformFeedbackVarying;
+	glad_debug_glGetTransformFeedbacki64_v = wrap ? glad_debug_impl_glGetTransformFeedbacki64_v : glad_glGetTransformFeedbacki64_v;
+	glad_debug_glGetTransformFeedbacki_v = wrap ? glad_debug_impl_glGetTransformFeedbacki_v : glad_glGetTransformFeedbacki_v;
+	glad_debug_glGetTransformFeedbackiv = wrap ? glad_debug_impl_glGetTransformFeedbackiv : glad_glGetTransformFeedbackiv;
+	glad_debug_glGetUniformBlockIndex = wrap ? glad_debug_impl_glGetUniformBlockIndex : glad_glGetUniformBlockIndex;
+	glad_debug_glGetUniformIndices = wrap ? glad_debug_impl_glGetUniformIndices : glad_glGetUniformIndices;
+	glad_debug_glGetUniformLocation = wrap ? glad_debug_impl_glGetUniformLocation : glad_glGetUniformLocation;
+	glad_debug_glGetUniformSubroutineuiv = wrap ? glad_debug_impl_glGetUniformSubroutineuiv : glad_glGetUniformSubroutineuiv;
+	glad_debug_glGetUniformdv = wrap ? glad_debug_impl_glGetUniformdv : glad_glGetUniformdv;
+	glad_debug_glGetUniformfv = wrap ? glad_debug_impl_glGetUniformfv : glad_glGetUniformfv;
+	glad_debug_glGetUniformiv = wrap ? glad_debug_impl_glGetUniformiv : glad_glGetUniformiv;
+	glad_debug_glGetUniformuiv = wrap ? glad_debug_impl_glGetUniformuiv : glad_glGetUniformuiv;
+	glad_debug_glGetVertexArrayIndexed64iv = wrap ? glad_debug_impl_glGetVertexArrayIndexed64iv : glad_glGetVertexArrayIndexed64iv;
+	glad_debug_glGetVertexArrayIndexediv = wrap ? glad_debug_impl_glGetVertexArrayIndexediv : glad_glGetVertexArrayIndexediv;
+	glad_debug_glGetVertexArrayiv = wrap ? glad_debug_impl_glGetVertexArrayiv : glad_glGetVertexArrayiv;
+	glad_debug_glGetVertexAttribIiv = wrap ? glad_debug_impl_glGetVertexAttribIiv : glad_glGetVertexAttribIiv;
+	glad_debug_glGetVertexAttribIuiv = wrap ? glad_debug_impl_glGetVertexAttribIuiv : glad_glGetVertexAttribIuiv;
+	glad_debug_glGetVertexAttribLdv = wrap ? glad_debug_impl_glGetVertexAttribLdv : glad_glGetVertexAttribLdv;
+	glad_debug_glGetVertexAttribLui64vARB = wrap ? glad_debug_impl_glGetVertexAttribLui64vARB : glad_glGetVertexAttribLui64vARB;
+	glad_debug_glGetVertexAttribPointerv = wrap ? glad_debug_impl_glGetVertexAttribPointerv : glad_glGetVertexAttribPointerv;
+	glad_debug_glGetVertexAttribdv = wrap ? glad_debug_impl_glGetVertexAttribdv : glad_glGetVertexAttribdv;
+	glad_debug_glGetVertexAttribfv = wrap ? glad_debug_impl_glGetVertexAttribfv : glad_glGetVertexAttribfv;
+	glad_debug_glGetVertexAttribiv = wrap ? glad_debug_impl_glGetVertexAttribiv : glad_glGetVertexAttribiv;
+	glad_debug_glGetnColorTable = wrap ? glad_debug_impl_glGetnColorTable : glad_glGetnColorTable;
+	glad_debug_glGetnCompressedTexImage = wrap ? glad_debug_impl_glGetnCompressedTexImage : glad_glGetnCompressedTexImage;
+	glad_debug_glGetnConvolutionFilter = wrap ? glad_debug_impl_glGetnConvolutionFilter : glad_glGetnConvolutionFilter;
+	glad_debug_glGetnHistogram = wrap ? glad_debug_impl_glGetnHistogram : glad_glGetnHistogram;
+	glad_debug_glGetnMapdv = wrap ? glad_debug_impl_glGetnMapdv : glad_glGetnMapdv;
+	glad_debug_glGetnMapfv = wrap ? glad_debug_impl_glGetnMapfv : glad_glGetnMapfv;
+	glad_debug_glGetnMapiv = wrap ? glad_debug_impl_glGetnMapiv : glad_glGetnMapiv;
+	glad_debug_glGetnMinmax = wrap ? glad_debug_impl_glGetnMinmax : glad_glGetnMinmax;
+	glad_debug_glGetnPixelMapfv = wrap ? glad_debug_impl_glGetnPixelMapfv : glad_glGetnPixelMapfv;
+	glad_debug_glGetnPixelMapuiv = wrap ? glad_debug_impl_glGetnPixelMapuiv : glad_glGetnPixelMapuiv;
+	glad_debug_glGetnPixelMapusv = wrap ? glad_debug_impl_glGetnPixelMapusv : glad_glGetnPixelMapusv;
+	glad_debug_glGetnPolygonStipple = wrap ? glad_debug_impl_glGetnPolygonStipple : glad_glGetnPolygonStipple;
+	glad_debug_glGetnSeparableFilter = wrap ? glad_debug_impl_glGetnSeparableFilter : glad_glGetnSeparableFilter;
+	glad_debug_glGetnTexImage = wrap ? glad_debug_impl_glGetnTexImage : glad_glGetnTexImage;
+	glad_debug_glGetnUniformdv = wrap ? glad_debug_impl_glGetnUniformdv : glad_glGetnUniformdv;
+	glad_debug_glGetnUniformfv = wrap ? glad_debug_impl_glGetnUniformfv : glad_glGetnUniformfv;
+	glad_debug_glGetnUniformiv = wrap ? glad_debug_impl_glGetnUniformiv : glad_glGetnUniformiv;
+	glad_debug_glGetnUniformuiv = wrap ? glad_debug_impl_glGetnUniformuiv : glad_glGetnUniformuiv;
+	glad_debug_glHint = wrap ? glad_debug_impl_glHint : glad_glHint;
+	glad_debug_glIndexMask = wrap ? glad_debug_impl_glIndexMask : glad_glIndexMask;
+	glad_debug_glIndexPointer = wrap ? glad_debug_impl_glIndexPointer : glad_glIndexPointer;
+	glad_debug_glIndexd = wrap ? glad_debug_impl_glIndexd : glad_glIndexd;
+	glad_debug_glIndexdv = wrap ? glad_debug_impl_glIndexdv : glad_glIndexdv;
+	glad_debug_glIndexf = wrap ? glad_debug_impl_glIndexf : glad_glIndexf;
+	glad_debug_glIndexfv = wrap ? glad_debug_impl_glIndexfv : glad_glIndexfv;
+	glad_debug_glIndexi = wrap ? glad_debug_impl_glIndexi : glad_glIndexi;
+	glad_debug_glIndexiv = wrap ? glad_debug_impl_glIndexiv : glad_glIndexiv;
+	glad_debug_glIndexs = wrap ? glad_debug_impl_glIndexs : glad_glIndexs;
+	glad_debug_glIndexsv = wrap ? glad_debug_impl_glIndexsv : glad_glIndexsv;
+	glad_debug_glIndexub = wrap ? glad_debug_impl_glIndexub : glad_glIndexub;
+	glad_debug_glIndexubv = wrap ? glad_debug_impl_glIndexubv : glad_glIndexubv;
+	glad_debug_glInitNames = wrap ? glad_debug_impl_glInitNames : glad_glInitNames;
+	glad_debug_glInterleavedArrays = wrap ? glad_debug_impl_glInterleavedArrays : glad_glInterleavedArrays;
+	glad_debug_glInvalidateBufferData = wrap ? glad_debug_impl_glInvalidateBufferData : glad_glInvalidateBufferData;
+	glad_debug_glInvalidateBufferSubData = wrap ? glad_debug_impl_glInvalidateBufferSubData : glad_glInvalidateBufferSubData;
+	glad_debug_glInvalidateFramebuffer = wrap ? glad_debug_impl_glInvalidateFramebuffer : glad_glInvalidateFramebuffer;
+	glad_debug_glInvalidateNamedFramebufferData = wrap ? glad_debug_impl_glInvalidateNamedFramebufferData : glad_glInvalidateNamedFramebufferData;
+	glad_debug_glInvalidateNamedFramebufferSubData = wrap ? glad_debug_impl_glInvalidateNamedFramebufferSubData : glad_glInvalidateNamedFramebufferSubData;
+	glad_debug_glInvalidateSubFramebuffer = wrap ? glad_debug_impl_glInvalidateSubFramebuffer : glad_glInvalidateSubFramebuffer;
+	glad_debug_glInvalidateTexImage = wrap ? glad_debug_impl_glInvalidateTexImage : glad_glInvalidateTexImage;
+	glad_debug_glInvalidateTexSubImage = wrap ? glad_debug_impl_glInvalidateTexSubImage : glad_glInvalidateTexSubImage;
+	glad_debug_glIsBuffer = wrap ? glad_debug_impl_glIsBuffer : glad_glIsBuffer;
+	glad_debug_glIsEnabled = wrap ? glad_debug_impl_glIsEnabled : glad_glIsEnabled;
+	glad_debug_glIsEnabledi = wrap ? glad_debug_impl_glIsEnabledi : glad_glIsEnabledi;
+	glad_debug_glIsFramebuffer = wrap ? glad_debug_impl_glIsFramebuffer : glad_glIsFramebuffer;
+	glad_debug_glIsImageHandleResidentARB = wrap ? glad_debug_impl_glIsImageHandleResidentARB : glad_glIsImageHandleResidentARB;
+	glad_debug_glIsList = wrap ? glad_debug_impl_glIsList : glad_glIsList;
+	glad_debug_glIsProgram = wrap ? glad_debug_impl_glIsProgram : glad_glIsProgram;
+	glad_debug_glIsProgramPipeline = wrap ? glad_debug_impl_glIsProgramPipeline : glad_glIsProgramPipeline;
+	glad_debug_glIsQuery = wrap ? glad_debug_impl_glIsQuery : glad_glIsQuery;
+	glad_debug_glIsRenderbuffer = wrap ? glad_debug_impl_glIsRenderbuffer : glad_glIsRenderbuffer;
+	glad_debug_glIsSampler = wrap ? glad_debug_impl_glIsSampler : glad_glIsSampler;
+	glad_debug_glIsShader = wrap ? glad_debug_impl_glIsShader : glad_glIsShader;
+	glad_debug_glIsSync = wrap ? glad_debug_impl_glIsSync : glad_glIsSync;
+	glad_debug_glIsTexture = wrap ? glad_debug_impl_glIsTexture : glad_glIsTexture;
+	glad_debug_glIsTextureHandleResidentARB = wrap ? glad_debug_impl_glIsTextureHandleResidentARB : glad_glIsTextureHandleResidentARB;
+	glad_debug_glIsTransformFeedback = wrap ? glad_debug_impl_glIsTransformFeedback : glad_glIsTransformFeedback;
+	glad_debug_glIsVertexArray = wrap ? glad_debug_impl_glIsVertexArray : glad_glIsVertexArray;
+	glad_debug_glLightModelf = wrap ? glad_debug_impl_glLightModelf : glad_glLightModelf;
+	glad_debug_glLightModelfv = wrap ? glad_debug_impl_glLightModelfv : glad_glLightModelfv;
+	glad_debug_glLightModeli = wrap ? glad_debug_impl_glLightModeli : glad_glLightModeli;
+	glad_debug_glLightModeliv = wrap ? glad_debug_impl_glLightModeliv : glad_glLightModeliv;
+	glad_debug_glLightf = wrap ? glad_debug_impl_glLightf : glad_glLightf;
+	glad_debug_glLightfv = wrap ? glad_debug_impl_glLightfv : glad_glLightfv;
+	glad_debug_glLighti = wrap ? glad_debug_impl_glLighti : glad_glLighti;
+	glad_debug_glLightiv = wrap ? glad_debug_impl_glLightiv : glad_glLightiv;
+	glad_debug_glLineStipple = wrap ? glad_debug_impl_glLineStipple : glad_glLineStipple;
+	glad_debug_glLineWidth = wrap ? glad_debug_impl_glLineWidth : glad_glLineWidth;
+	glad_debug_glLinkProgram = wrap ? glad_debug_impl_glLinkProgram : glad_glLinkProgram;
+	glad_debug_glListBase = wrap ? glad_debug_impl_glListBase : glad_glListBase;
+	glad_debug_glLoadIdentity = wrap ? glad_debug_impl_glLoadIdentity : glad_glLoadIdentity;
+	glad_debug_glLoadMatrixd = wrap ? glad_debug_impl_glLoadMatrixd : glad_glLoadMatrixd;
+	glad_debug_glLoadMatrixf = wrap ? glad_debug_impl_glLoadMatrixf : glad_glLoadMatrixf;
+	glad_debug_glLoadName = wrap ? glad_debug_impl_glLoadName : glad_glLoadName;
+	glad_debug_glLoadTransposeMatrixd = wrap ? glad_debug_impl_glLoadTransposeMatrixd : glad_glLoadTransposeMatrixd;
+	glad_debug_glLoadTransposeMatrixf = wrap ? glad_debug_impl_glLoadTransposeMatrixf : glad_glLoadTransposeMatrixf;
+	glad_debug_glLogicOp = wrap ? glad_debug_impl_glLogicOp : glad_glLogicOp;
+	glad_debug_glMakeImageHandleNonResidentARB = wrap ? glad_debug_impl_glMakeImageHandleNonResidentARB : glad_glMakeImageHandleNonResidentARB;
+	glad_debug_glMakeImageHandleResidentARB = wrap ? glad_debug_impl_glMakeImageHandleResidentARB : glad_glMakeImageHandleResidentARB;
+	glad_debug_glMakeTextureHandleNonResidentARB = wrap ? glad_debug_impl_glMakeTextureHandleNonResidentARB : glad_glMakeTextureHandleNonResidentARB;
+	glad_debug_glMakeTextureHandleResidentARB = wrap ? glad_debug_impl_glMakeTextureHandleResidentARB : glad_glMakeTextureHandleResidentARB;
+	glad_debug_glMap1d = wrap ? glad_debug_impl_glMap1d : glad_glMap1d;
+	glad_debug_glMap1f = wrap ? glad_debug_impl_glMap1f : glad_glMap1f;
+	glad_debug_glMap2d = wrap ? glad_debug_impl_glMap2d : glad_glMap2d;
+	glad_debug_glMap2f = wrap ? glad_debug_impl_glMap2f : glad_glMap2f;
+	glad_debug_glMapBuffer = wrap ? glad_debug_impl_glMapBuffer : glad_glMapBuffer;
+	glad_debug_glMapBufferRange = wrap ? glad_debug_impl_glMapBufferRange : glad_glMapBufferRange;
+	glad_debug_glMapGrid1d = wrap ? glad_debug_impl_glMapGrid1d : glad_glMapGrid1d;
+	glad_debug_glMapGrid1f = wrap ? glad_debug_impl_glMapGrid1f : glad_glMapGrid1f;
+	glad_debug_glMapGrid2d = wrap ? glad_debug_impl_glMapGrid2d : glad_glMapGrid2d;
+	glad_debug_glMapGrid2f = wrap ? glad_debug_impl_glMapGrid2f : glad_glMapGrid2f;
+	glad_debug_glMapNamedBuffer = wrap ? glad_debug_impl_glMapNamedBuffer : glad_glMapNamedBuffer;
+	glad_debug_glMapNamedBufferRange = wrap ? glad_debug_impl_glMapNamedBufferRange : glad_glMapNamedBufferRange;
+	glad_debug_glMaterialf = wrap ? glad_debug_impl_glMaterialf : glad_glMaterialf;
+	glad_debug_glMaterialfv = wrap ? glad_debug_impl_glMaterialfv : glad_glMaterialfv;
+	glad_debug_glMateriali = wrap ? glad_debug_impl_glMateriali : glad_glMateriali;
+	glad_debug_glMaterialiv = wrap ? glad_debug_impl_glMaterialiv : glad_glMaterialiv;
+	glad_debug_glMatrixMode = wrap ? glad_debug_impl_glMatrixMode : glad_glMatrixMode;
+	glad_debug_glMaxShaderCompilerThreadsKHR = wrap ? glad_debug_impl_glMaxShaderCompilerThreadsKHR : glad_glMaxShaderCompilerThreadsKHR;
+	glad_debug_glMemoryBarrier = wrap ? glad_debug_impl_glMemoryBarrier : glad_glMemoryBarrier;
+	glad_debug_glMemoryBarrierByRegion = wrap ? glad_debug_impl_glMemoryBarrierByRegion : glad_glMemoryBarrierByRegion;
+	glad_debug_glMinSampleShading = wrap ? glad_debug_impl_glMinSampleShading : glad_glMinSampleShading;
+	glad_debug_glMultMatrixd = wrap ? glad_debug_impl_glMultMatrixd : glad_glMultMatrixd;
+	glad_debug_glMultMatrixf = wrap ? glad_debug_impl_glMultMatrixf : glad_glMultMatrixf;
+	glad_debug_glMultTransposeMatrixd = wrap ? glad_debug_impl_glMultTransposeMatrixd : glad_glMultTransposeMatrixd;
+	glad_debug_glMultTransposeMatrixf = wrap ? glad_debug_impl_glMultTransposeMatrixf : glad_glMultTransposeMatrixf;
+	glad_debug_glMultiDrawArrays = wrap ? glad_debug_impl_glMultiDrawArrays : glad_glMultiDrawArrays;
+	glad_debug_glMultiDrawArraysIndirect = wrap ? glad_debug_impl_glMultiDrawArraysIndirect : glad_glMultiDrawArraysIndirect;
+	glad_debug_glMultiDrawArraysIndirectCount = wrap ? glad_debug_impl_glMultiDrawArraysIndirectCount : glad_glMultiDrawArraysIndirectCount;
+	glad_debug_glMultiDrawElements = wrap ? glad_debug_impl_glMultiDrawElements : glad_glMultiDrawElements;
+	glad_debug_glMultiDrawElementsBaseVertex = wrap ? glad_debug_impl_glMultiDrawElementsBaseVertex : glad_glMultiDrawElementsBaseVertex;
+	glad_debug_glMultiDrawElementsIndirect = wrap ? glad_debug_impl_glMultiDrawElementsIndirect : glad_glMultiDrawElementsIndirect;
+	glad_debug_glMultiDrawElementsIndirectCount = wrap ? glad_debug_impl_glMultiDrawElementsIndirectCount : glad_glMultiDrawElementsIndirectCount;
+	glad_debug_glMultiTexCoord1d = wrap ? glad_debug_impl_glMultiTexCoord1d : glad_glMultiTexCoord1d;
+	glad_debug_glMultiTexCoord1dv = wrap ? glad_debug_impl_glMultiTexCoord1dv : glad_glMultiTexCoord1dv;
+	glad_debug_glMultiTexCoord1f = wrap ? glad_debug_impl_glMultiTexCoord1f : glad_glMultiTexCoord1f;
+	glad_debug_glMultiTexCoord1fv = wrap ? glad_debug_impl_glMultiTexCoord1fv : glad_glMultiTexCoord1fv;
+	glad_debug_glMultiTexCoord1i = wrap ? glad_debug_impl_glMultiTexCoord1i : glad_glMultiTexCoord1i;
+	glad_debug_glMultiTexCoord1iv = wrap ? glad_debug_impl_glMultiTexCoord1iv : glad_glMultiTexCoord1iv;
+	glad_debug_glMultiTexCoord1s = wrap ? glad_debug_impl_glMultiTexCoord1s : glad_glMultiTexCoord1s;
+	glad_debug_glMultiTexCoord1sv = wrap ? glad_debug_impl_glMultiTexCoord1sv : glad_glMultiTexCoord1sv;
+	glad_debug_glMultiTexCoord2d = wrap ? glad_debug_impl_glMultiTexCoord2d : glad_glMultiTexCoord2d;
+	glad_debug_glMultiTexCoord2dv = wrap ? glad_debug_impl_glMultiTexCoord2dv : glad_glMultiTexCoord2dv;
+	glad_debug_glMultiTexCoord2f = wrap ? glad_debug_impl_glMultiTexCoord2f : glad_glMultiTexCoord2f;
+	glad_debug_glMultiTexCoord2fv = wrap ? glad_debug_impl_glMultiTexCoord2fv : glad_glMultiTexCoord2fv;
+	glad_debug_glMultiTexCoord2i = wrap ? glad_debug_impl_glMultiTexCoord2i : glad_glMultiTexCoord2i;
+	glad_debug_glMultiTexCoord2iv = wrap ? glad_debug_impl_glMultiTexCoord2iv : glad_glMultiTexCoord2iv;
+	glad_debug_glMultiTexCoord2s = wrap ? glad_debug_impl_glMultiTexCoord2s : glad_glMultiTexCoord2s;
+	glad_debug_glMultiTexCoord2sv = wrap ? glad_debug_impl_glMultiTexCoord2sv : glad_glMultiTexCoord2sv;
+	glad_debug_glMultiTexCoord3d = wrap ? glad_debug_impl_glMultiTexCoord3d : glad_glMultiTexCoord3d;
+	glad_debug_glMultiTexCoord3dv = wrap ? glad_debug_impl_glMultiTexCoord3dv : glad_glMultiTexCoord3dv;
+	glad_debug_glMultiTexCoord3f = wrap ? glad_debug_impl_glMultiTexCoord3f : glad_glMultiTexCoord3f;
+	glad_debug_glMultiTexCoord3fv = wrap ? glad_debug_impl_glMultiTexCoord3fv : glad_glMultiTexCoord3fv;
+	glad_debug_glMultiTexCoord3i = wrap ? glad_debug_impl_glMultiTexCoord3i : glad_glMultiTexCoord3i;
+	glad_debug_glMultiTexCoord3iv = wrap ? glad_debug_impl_glMultiTexCoord3iv : glad_glMultiTexCoord3iv;
+	glad_debug_glMultiTexCoord3s = wrap ? glad_debug_impl_glMultiTexCoord3s : glad_glMultiTexCoord3s;
+	glad_debug_glMultiTexCoord3sv = wrap ? glad_debug_impl_glMultiTexCoord3sv : glad_glMultiTexCoord3sv;
+	glad_debug_glMultiTexCoord4d = wrap ? glad_debug_impl_glMultiTexCoord4d : glad_glMultiTexCoord4d;
+	glad_debug_glMultiTexCoord4dv = wrap ? glad_debug_impl_glMultiTexCoord4dv : glad_glMultiTexCoord4dv;
+	glad_debug_glMultiTexCoord4f = wrap ? glad_debug_impl_glMultiTexCoord4f : glad_glMultiTexCoord4f;
+	glad_debug_glMultiTexCoord4fv = wrap ? glad_debug_impl_glMultiTexCoord4fv : glad_glMultiTexCoord4fv;
+	glad_debug_glMultiTexCoord4i = wrap ? glad_debug_impl_glMultiTexCoord4i : glad_glMultiTexCoord4i;
+	glad_debug_glMultiTexCoord4iv = wrap ? glad_debug_impl_glMultiTexCoord4iv : glad_glMultiTexCoord4iv;
+	glad_debug_glMultiTexCoord4s = wrap ? glad_debug_impl_glMultiTexCoord4s : glad_glMultiTexCoord4s;
+	glad_debug_glMultiTexCoord4sv = wrap ? glad_debug_impl_glMultiTexCoord4sv : glad_glMultiTexCoord4sv;
+	glad_debug_glMultiTexCoordP1ui = wrap ? glad_debug_impl_glMultiTexCoordP1ui : glad_glMultiTexCoordP1ui;
+	glad_debug_glMultiTexCoordP1uiv = wrap ? glad_debug_impl_glMultiTexCoordP1uiv : glad_glMultiTexCoordP1uiv;
+	glad_debug_glMultiTexCoordP2ui = wrap ? glad_debug_impl_glMultiTexCoordP2ui : glad_glMultiTexCoordP2ui;
+	glad_debug_glMultiTexCoordP2uiv = wrap ? glad_debug_impl_glMultiTexCoordP2uiv : glad_glMultiTexCoordP2uiv;
+	glad_debug_glMultiTexCoordP3ui = wrap ? glad_debug_impl_glMultiTexCoordP3ui : glad_glMultiTexCoordP3ui;
+	glad_debug_glMultiTexCoordP3uiv = wrap ? glad_debug_impl_glMultiTexCoordP3uiv : glad_glMultiTexCoordP3uiv;
+	glad_debug_glMultiTexCoordP4ui = wrap ? glad_debug_impl_glMultiTexCoordP4ui : glad_glMultiTexCoordP4ui;
+	glad_debug_glMultiTexCoordP4uiv = wrap ? glad_debug_impl_glMultiTexCoordP4uiv : glad_glMultiTexCoordP4uiv;
+	glad_debug_glNamedBufferData = wrap ? glad_debug_impl_glNamedBufferData : glad_glNamedBufferData;
+	glad_debug_glNamedBufferStorage = wrap ? glad_debug_impl_glNamedBufferStorage : glad_glNamedBufferStorage;
+	glad_debug_glNamedBufferStorageEXT = wrap ? glad_debug_impl_glNamedBufferStorageEXT : glad_glNamedBufferStorageEXT;
+	glad_debug_glNamedBufferSubData = wrap ? glad_debug_impl_glNamedBufferSubData : glad_glNamedBufferSubData;
+	glad_debug_glNamedFramebufferDrawBuffer = wrap ? glad_debug_impl_glNamedFramebufferDrawBuffer : glad_glNamedFramebufferDrawBuffer;
+	glad_debug_glNamedFramebufferDrawBuffers = wrap ? glad_debug_impl_glNamedFramebufferDrawBuffers : glad_glNamedFramebufferDrawBuffers;
+	glad_debug_glNamedFramebufferParameteri = wrap ? glad_debug_impl_glNamedFramebufferParameteri : glad_glNamedFramebufferParameteri;
+	glad_debug_glNamedFramebufferReadBuffer = wrap ? glad_debug_impl_glNamedFramebufferReadBuffer : glad_glNamedFramebufferReadBuffer;
+	glad_debug_glNamedFramebufferRenderbuffer = wrap ? glad_debug_impl_glNamedFramebufferRenderbuffer : glad_glNamedFramebufferRenderbuffer;
+	glad_debug_glNamedFramebufferTexture = wrap ? glad_debug_impl_glNamedFramebufferTexture : glad_glNamedFramebufferTexture;
+	glad_debug_glNamedFramebufferTextureLayer = wrap ? glad_debug_impl_glNamedFramebufferTextureLayer : glad_glNamedFramebufferTextureLayer;
+	glad_debug_glNamedRenderbufferStorage = wrap ? glad_debug_impl_glNamedRenderbufferStorage : glad_glNamedRenderbufferStorage;
+	glad_debug_glNamedRenderbufferStorageMultisample = wrap ? glad_debug_impl_glNamedRenderbufferStorageMultisample : glad_glNamedRenderbufferStorageMultisample;
+	glad_debug_glNewList = wrap ? glad_debug_impl_glNewList : glad_glNewList;
+	glad_debug_glNormal3b = wrap ? glad_debug_impl_glNormal3b : glad_glNormal3b;
+	glad_debug_glNormal3bv = wrap ? glad_debug_impl_glNormal3bv : glad_glNormal3bv;
+	glad_debug_glNormal3d = wrap ? glad_debug_impl_glNormal3d : glad_glNormal3d;
+	glad_debug_glNormal3dv = wrap ? glad_debug_impl_glNormal3dv : glad_glNormal3dv;
+	glad_debug_glNormal3f = wrap ? glad_debug_impl_glNormal3f : glad_glNormal3f;
+	glad_debug_glNormal3fv = wrap ? glad_debug_impl_glNormal3fv : glad_glNormal3fv;
+	glad_debug_glNormal3i = wrap ? glad_debug_impl_glNormal3i : glad_glNormal3i;
+	glad_debug_glNormal3iv = wrap ? glad_debug_impl_glNormal3iv : glad_glNormal3iv;
+	glad_debug_glNormal3s = wrap ? glad_debug_impl_glNormal3s : glad_glNormal3s;
+	glad_debug_glNormal3sv = wrap ? glad_debug_impl_glNormal3sv : glad_glNormal3sv;
+	glad_debug_glNormalP3ui = wrap ? glad_debug_impl_glNormalP3ui : glad_glNormalP3ui;
+	glad_debug_glNormalP3uiv = wrap ? glad_debug_impl_glNormalP3uiv : glad_glNormalP3uiv;
+	glad_debug_glNormalPointer = wrap ? glad_debug_impl_glNormalPointer : glad_glNormalPointer;
+	glad_debug_glObjectLabel = wrap ? glad_debug_impl_glObjectLabel : glad_glObjectLabel;
+	glad_debug_glObjectPtrLabel = wrap ? glad_debug_impl_glObjectPtrLabel : glad_glObjectPtrLabel;
+	glad_debug_glOrtho = wrap ? glad_debug_impl_glOrtho : glad_glOrtho;
+	glad_debug_glPassThrough = wrap ? glad_debug_impl_glPassThrough : glad_glPassThrough;
+	glad_debug_glPatchParameterfv = wrap ? glad_debug_impl_glPatchParameterfv : glad_glPatchParameterfv;
+	glad_debug_glPatchParameteri = wrap ? glad_debug_impl_glPatchParameteri : glad_glPatchParameteri;
+	glad_debug_glPauseTransformFeedback = wrap ? glad_debug_impl_glPauseTransformFeedback : glad_glPauseTransformFeedback;
+	glad_debug_glPixelMapfv = wrap ? glad_debug_impl_glPixelMapfv : glad_glPixelMapfv;
+	glad_debug_glPixelMapuiv = wrap ? glad_debug_impl_glPixelMapuiv : glad_glPixelMapuiv;
+	glad_debug_glPixelMapusv = wrap ? glad_debug_impl_glPixelMapusv : glad_glPixelMapusv;
+	glad_debug_glPixelStoref = wrap ? glad_debug_impl_glPixelStoref : glad_glPixelStoref;
+	glad_debug_glPixelStorei = wrap ? glad_debug_impl_glPixelStorei : glad_glPixelStorei;
+	glad_debug_glPixelTransferf = wrap ? glad_debug_impl_glPixelTransferf : glad_glPixelTransferf;
+	glad_debug_glPixelTransferi = wrap ? glad_debug_impl_glPixelTransferi : glad_glPixelTransferi;
+	glad_debug_glPixelZoom = wrap ? glad_debug_impl_glPixelZoom : glad_glPixelZoom;
+	glad_debug_glPointParameterf = wrap ? glad_debug_impl_glPointParameterf : glad_glPointParameterf;
+	glad_debug_glPointParameterfv = wrap ? glad_debug_impl_glPointParameterfv : glad_glPointParameterfv;
+	glad_debug_glPointParameteri = wrap ? glad_debug_impl_glPointParameteri : glad_glPointParameteri;
+	glad_debug_glPointParameteriv = wrap ? glad_debug_impl_glPointParameteriv : glad_glPointParameteriv;
+	glad_debug_glPointSize = wrap ? glad_debug_impl_glPointSize : glad_glPointSize;
+	glad_debug_glPolygonMode = wrap ? glad_debug_impl_glPolygonMode : glad_glPolygonMode;
+	glad_debug_glPolygonOffset = wrap ? glad_debug_impl_glPolygonOffset : glad_glPolygonOffset;
+	glad_debug_glPolygonOffsetClamp = wrap ? glad_debug_impl_glPolygonOffsetClamp : glad_glPolygonOffsetClamp;
+	glad_debug_glPolygonStipple = wrap ? glad_debug_impl_glPolygonStipple : glad_glPolygonStipple;
+	glad_debug_glPopAttrib = wrap ? glad_debug_impl_glPopAttrib : glad_glPopAttrib;
+	glad_debug_glPopClientAttrib = wrap ? glad_debug_impl_glPopClientAttrib : glad_glPopClientAttrib;
+	glad_debug_glPopDebugGroup = wrap ? glad_debug_impl_glPopDebugGroup : glad_glPopDebugGroup;
+	glad_debug_glPopMatrix = wrap ? glad_debug_impl_glPopMatrix : glad_glPopMatrix;
+	glad_debug_glPopName = wrap ? glad_debug_impl_glPopName : glad_glPopName;
+	glad_debug_glPrimitiveRestartIndex = wrap ? glad_debug_impl_glPrimitiveRestartIndex : glad_glPrimitiveRestartIndex;
+	glad_debug_glPrioritizeTextures = wrap ? glad_debug_impl_glPrioritizeTextures : glad_glPrioritizeTextures;
+	glad_debug_glProgramBinary = wrap ? glad_debug_impl_glProgramBinary : glad_glProgramBinary;
+	glad_debug_glProgramParameteri = wrap ? glad_debug_impl_glProgramParameteri : glad_glProgramParameteri;
+	glad_debug_glProgramUniform1d = wrap ? glad_debug_impl_glProgramUniform1d : glad_glProgramUniform1d;
+	glad_debug_glProgramUniform1dv = wrap ? glad_debug_impl_glProgramUniform1dv : glad_glProgramUniform1dv;
+	glad_debug_glProgramUniform1f = wrap ? glad_debug_impl_glProgramUniform1f : glad_glProgramUniform1f;
+	glad_debug_glProgramUniform1fv = wrap ? glad_debug_impl_glProgramUniform1fv : glad_glProgramUniform1fv;
+	glad_debug_glProgramUniform1i = wrap ? glad_debug_impl_glProgramUniform1i : glad_glProgramUniform1i;
+	glad_debug_glProgramUniform1iv = wrap ? glad_debug_impl_glProgramUniform1iv : glad_glProgramUniform1iv;
+	glad_debug_glProgramUniform1ui = wrap ? glad_debug_impl_glProgramUniform1ui : glad_glProgramUniform1ui;
+	glad_debug_glProgramUniform1uiv = wrap ? glad_debug_impl_glProgramUniform1uiv : glad_glProgramUniform1uiv;
+	glad_debug_glProgramUniform2d = wrap ? glad_debug_impl_glProgramUniform2d : glad_glProgramUniform2d;
+	glad_debug_glProgramUniform2dv = wrap ? glad_debug_impl_glProgramUniform2dv : glad_glProgramUniform2dv;
+	glad_debug_glProgramUniform2f = wrap ? glad_debug_impl_glProgramUniform2f : glad_glProgramUniform2f;
+	glad_debug_glProgramUniform2fv = wrap ? glad_debug_impl_glProgramUniform2fv : glad_glProgramUniform2fv;
+	glad_debug_glProgramUniform2i = wrap ? glad_debug_impl_glProgramUniform2i : glad_glProgramUniform2i;
+	glad_debug_glProgramUniform2iv = wrap ? glad_debug_impl_glProgramUniform2iv : glad_glProgramUniform2iv;
+	glad_debug_glProgramUniform2ui = wrap ? glad_debug_impl_glProgramUniform2ui : glad_glProgramUniform2ui;
+	glad_debug_glProgramUniform2uiv = wrap ? glad_debug_impl_glProgramUniform2uiv : glad_glProgramUniform2uiv;
+	glad_debug_glProgramUniform3d = wrap ? glad_debug_impl_glProgramUniform3d : glad_glProgramUniform3d;
+	glad_debug_glProgramUniform3dv = wrap ? glad_debug_impl_glProgramUniform3dv : glad_glProgramUniform3dv;
+	glad_debug_glProgramUniform3f = wrap ? glad_debug_impl_glProgramUniform3f : glad_glProgramUniform3f;
+	glad_debug_glProgramUniform3fv = wrap ? glad_debug_impl_glProgramUniform3fv : glad_glProgramUniform3fv;
+	glad_debug_glProgramUniform3i = wrap ? glad_debug_impl_glProgramUniform3i : glad_glProgramUniform3i;
+	glad_debug_glProgramUniform3iv = wrap ? glad_debug_impl_glProgramUniform3iv : glad_glProgramUniform3iv;
+	glad_debug_glProgramUniform3ui = wrap ? glad_debug_impl_glProgramUniform3ui : glad_glProgramUniform3ui;
+	glad_debug_glProgramUniform3uiv = wrap ? glad_debug_impl_glProgramUniform3uiv : glad_glProgramUniform3uiv;
+	glad_debug_glProgramUniform4d = wrap ? glad_debug_impl_glProgramUniform4d : glad_glProgramUniform4d;
+	glad_debug_glProgramUniform4dv = wrap ? glad_debug_impl_glProgramUniform4dv : glad_glProgramUniform4dv;
+	glad_debug_glProgramUniform4f = wrap ? glad_debug_impl_glProgramUniform4f : glad_glProgramUniform4f;
+	glad_debug_glProgramUniform4fv = wrap ? glad_debug_impl_glProgramUniform4fv : glad_glProgramUniform4fv;
+	glad_debug_glProgramUniform4i = wrap ? glad_debug_impl_glProgramUniform4i : glad_glProgramUniform4i;
+	glad_debug_glProgramUniform4iv = wrap ? glad_debug_impl_glProgramUniform4iv : glad_glProgramUniform4iv;
+	glad_debug_glProgramUniform4ui = wrap ? glad_debug_impl_glProgramUniform4ui : glad_glProgramUniform4ui;
+	glad_debug_glProgramUniform4uiv = wrap ? glad_debug_impl_glProgramUniform4uiv : glad_glProgramUniform4uiv;
+	glad_debug_glProgramUniformHandleui64ARB = wrap ? glad_debug_impl_glProgramUniformHandleui64ARB : glad_glProgramUniformHandleui64ARB;
+	glad_debug_glProgramUniformHandleui64vARB = wrap ? glad_debug_impl_glProgramUniformHandleui64vARB : glad_glProgramUniformHandleui64vARB;
+	glad_debug_glProgramUniformMatrix2dv = wrap ? glad_debug_impl_glProgramUniformMatrix2dv : glad_glProgramUniformMatrix2dv;
+	glad_debug_glProgramUniformMatrix2fv = wrap ? glad_debug_impl_glProgramUniformMatrix2fv : glad_glProgramUniformMatrix2fv;
+	glad_debug_glProgramUniformMatrix2x3dv = wrap ? glad_debug_impl_glProgramUniformMatrix2x3dv : glad_glProgramUniformMatrix2x3dv;
+	glad_debug_glProgramUniformMatrix2x3fv = wrap ? glad_debug_impl_glProgramUniformMatrix2x3fv : glad_glProgramUniformMatrix2x3fv;
+	glad_debug_glProgramUniformMatrix2x4dv = wrap ? glad_debug_impl_glProgramUniformMatrix2x4dv : glad_glProgramUniformMatrix2x4dv;
+	glad_debug_glProgramUniformMatrix2x4fv = wrap ? glad_debug_impl_glProgramUniformMatrix2x4fv : glad_glProgramUniformMatrix2x4fv;
+	glad_debug_glProgramUniformMatrix3dv = wrap ? glad_debug_impl_glProgramUniformMatrix3dv : glad_glProgramUniformMatrix3dv;
+	glad_debug_glProgramUniformMatrix3fv = wrap ? glad_debug_impl_glProgramUniformMatrix3fv : glad_glProgramUniformMatrix3fv;
+	glad_debug_glProgramUniformMatrix3x2dv = wrap ? glad_debug_impl_glProgramUniformMatrix3x2dv : glad_glProgramUniformMatrix3x2dv;
+	glad_debug_glProgramUniformMatrix3x2fv = wrap ? glad_debug_impl_glProgramUniformMatrix3x2fv : glad_glProgramUniformMatrix3x2fv;
+	glad_debug_glProgramUniformMatrix3x4dv = wrap ? glad_debug_impl_glProgramUniformMatrix3x4dv : glad_glProgramUniformMatrix3x4dv;
+	glad_debug_glProgramUniformMatrix3x4fv = wrap ? glad_debug_impl_glProgramUniformMatrix3x4fv : glad_glProgramUniformMatrix3x4fv;
+	glad_debug_glProgramUniformMatrix4dv = wrap ? glad_debug_impl_glProgramUniformMatrix4dv : glad_glProgramUniformMatrix4dv;
+	glad_debug_glProgramUniformMatrix4fv = wrap ? glad_debug_impl_glProgramUniformMatrix4fv : glad_glProgramUniformMatrix4fv;
+	glad_debug_glProgramUniformMatrix4x2dv = wrap ? glad_debug_impl_glProgramUniformMatrix4x2dv : glad_glProgramUniformMatrix4x2dv;
+	glad_debug_glProgramUniformMatrix4x2fv = wrap ? glad_debug_impl_glProgramUniformMatrix4x2fv : glad_glProgramUniformMatrix4x2fv;
+	glad_debug_glProgramUniformMatrix4x3dv = wrap ? glad_debug_impl_glProgramUniformMatrix4x3dv : glad_glProgramUniformMatrix4x3dv;
+	glad_debug_glProgramUniformMatrix4x3fv = wrap ? glad_debug_impl_glProgramUniformMatrix4x3fv : glad_glProgramUniformMatrix4x3fv;
+	glad_debug_glProvokingVertex = wrap ? glad_debug_impl_glProvokingVertex : glad_glProvokingVertex;
+	glad_debug_glPushAttrib = wrap ? glad_debug_impl_glPushAttrib : glad_glPushAttrib;
+	glad_debug_glPushClientAttrib = wrap ? glad_debug_impl_glPushClientAttrib : glad_glPushClientAttrib;
+	glad_debug_glPushDebugGroup = wrap ? glad_debug_impl_glPushDebugGroup : glad_glPushDebugGroup;
+	glad_debug_glPushMatrix = wrap ? glad_debug_impl_glPushMatrix : glad_glPushMatrix;
+	glad_debug_glPushName = wrap ? glad_debug_impl_glPushName : glad_glPushName;
+	glad_debug_glQueryCounter = wrap ? glad_debug_impl_glQueryCounter : glad_glQueryCounter;
+	glad_debug_glRasterPos2d = wrap ? glad_debug_impl_glRasterPos2d : glad_glRasterPos2d;
+	glad_debug_glRasterPos2dv = wrap ? glad_debug_impl_glRasterPos2dv : glad_glRasterPos2dv;
+	glad_debug_glRasterPos2f = wrap ? glad_debug_impl_glRasterPos2f : glad_glRasterPos2f;
+	glad_debug_glRasterPos2fv = wrap ? glad_debug_impl_glRasterPos2fv : glad_glRasterPos2fv;
+	glad_debug_glRasterPos2i = wrap ? glad_debug_impl_glRasterPos2i : glad_glRasterPos2i;
+	glad_debug_glRasterPos2iv = wrap ? glad_debug_impl_glRasterPos2iv : glad_glRasterPos2iv;
+	glad_debug_glRasterPos2s = wrap ? glad_debug_impl_glRasterPos2s : glad_glRasterPos2s;
+	glad_debug_glRasterPos2sv = wrap ? glad_debug_impl_glRasterPos2sv : glad_glRasterPos2sv;
+	glad_debug_glRasterPos3d = wrap ? glad_debug_impl_glRasterPos3d : glad_glRasterPos3d;
+	glad_debug_glRasterPos3dv = wrap ? glad_debug_impl_glRasterPos3dv : glad_glRasterPos3dv;
+	glad_debug_glRasterPos3f = wrap ? glad_debug_impl_glRasterPos3f : glad_glRasterPos3f;
+	glad_debug_glRasterPos3fv = wrap ? glad_debug_impl_glRasterPos3fv : glad_glRasterPos3fv;
+	glad_debug_glRasterPos3i = wrap ? glad_debug_impl_glRasterPos3i : glad_glRasterPos3i;
+	glad_debug_glRasterPos3iv = wrap ? glad_debug_impl_glRasterPos3iv : glad_glRasterPos3iv;
+	glad_debug_glRasterPos3s = wrap ? glad_debug_impl_glRasterPos3s : glad_glRasterPos3s;
+	glad_debug_glRasterPos3sv = wrap ? glad_debug_impl_glRasterPos3sv : glad_glRasterPos3sv;
+	glad_debug_glRasterPos4d = wrap ? glad_debug_impl_glRasterPos4d : glad_glRasterPos4d;
+	glad_debug_glRasterPos4dv = wrap ? glad_debug_impl_glRasterPos4dv : glad_glRasterPos4dv;
+	glad_debug_glRasterPos4f = wrap ? glad_debug_impl_glRasterPos4f : glad_glRasterPos4f;
+	glad_debug_glRasterPos4fv = wrap ? glad_debug_impl_glRasterPos4fv : glad_glRasterPos4fv;
+	glad_debug_glRasterPos4i = wrap ? glad_debug_impl_glRasterPos4i : glad_glRasterPos4i;
+	glad_debug_glRasterPos4iv = wrap ? glad_debug_impl_glRasterPos4iv : glad_glRasterPos4iv;
+	glad_debug_glRasterPos4s = wrap ? glad_debug_impl_glRasterPos4s : glad_glRasterPos4s;
+	glad_debug_glRasterPos4sv = wrap ? glad_debug_impl_glRasterPos4sv : glad_glRasterPos4sv;
+	glad_debug_glReadBuffer = wrap ? glad_debug_impl_glReadBuffer : glad_glReadBuffer;
+	glad_debug_glReadPixels = wrap ? glad_debug_impl_glReadPixels : glad_glReadPixels;
+	glad_debug_glReadnPixels = wrap ? glad_debug_impl_glReadnPixels : glad_glReadnPixels;
+	glad_debug_glRectd = wrap ? glad_debug_impl_glRectd : glad_glRectd;
+	glad_debug_glRectdv = wrap ? glad_debug_impl_glRectdv : glad_glRectdv;
+	glad_debug_glRectf = wrap ? glad_debug_impl_glRectf : glad_glRectf;
+	glad_debug_glRectfv = wrap ? glad_debug_impl_glRectfv : glad_glRectfv;
+	glad_debug_glRecti = wrap ? glad_debug_impl_glRecti : glad_glRecti;
+	glad_debug_glRectiv = wrap ? glad_debug_impl_glRectiv : glad_glRectiv;
+	glad_debug_glRects = wrap ? glad_debug_impl_glRects : glad_glRects;
+	glad_debug_glRectsv = wrap ? glad_debug_impl_glRectsv : glad_glRectsv;
+	glad_debug_glReleaseShaderCompiler = wrap ? glad_debug_impl_glReleaseShaderCompiler : glad_glReleaseShaderCompiler;
+	glad_debug_glRenderMode = wrap ? glad_debug_impl_glRenderMode : glad_glRenderMode;
+	glad_debug_glRenderbufferStorage = wrap ? glad_debug_impl_glRenderbufferStorage : glad_glRenderbufferStorage;
+	glad_debug_glRenderbufferStorageMultisample = wrap ? glad_debug_impl_glRenderbufferStorageMultisample : glad_glRenderbufferStorageMultisample;
+	glad_debug_glResumeTransformFeedback = wrap ? glad_debug_impl_glResumeTransformFeedback : glad_glResumeTransformFeedback;
+	glad_debug_glRotated = wrap ? glad_debug_impl_glRotated : glad_glRotated;
+	glad_debug_glRotatef = wrap ? glad_debug_impl_glRotatef : glad_glRotatef;
+	glad_debug_glSampleCoverage = wrap ? glad_debug_impl_glSampleCoverage : glad_glSampleCoverage;
+	glad_debug_glSampleMaski = wrap ? glad_debug_impl_glSampleMaski : glad_glSampleMaski;
+	glad_debug_glSamplerParameterIiv = wrap ? glad_debug_impl_glSamplerParameterIiv : glad_glSamplerParameterIiv;
+	glad_debug_glSamplerParameterIuiv = wrap ? glad_debug_impl_glSamplerParameterIuiv : glad_glSamplerParameterIuiv;
+	glad_debug_glSamplerParameterf = wrap ? glad_debug_impl_glSamplerParameterf : glad_glSamplerParameterf;
+	glad_debug_glSamplerParameterfv = wrap ? glad_debug_impl_glSamplerParameterfv : glad_glSamplerParameterfv;
+	glad_debug_glSamplerParameteri = wrap ? glad_debug_impl_glSamplerParameteri : glad_glSamplerParameteri;
+	glad_debug_glSamplerParameteriv = wrap ? glad_debug_impl_glSamplerParameteriv : glad_glSamplerParameteriv;
+	glad_debug_glScaled = wrap ? glad_debug_impl_glScaled : glad_glScaled;
+	glad_debug_glScalef = wrap ? glad_debug_impl_glScalef : glad_glScalef;
+	glad_debug_glScissor = wrap ? glad_debug_impl_glScissor : glad_glScissor;
+	glad_debug_glScissorArrayv = wrap ? glad_debug_impl_glScissorArrayv : glad_glScissorArrayv;
+	glad_debug_glScissorIndexed = wrap ? glad_debug_impl_glScissorIndexed : glad_glScissorIndexed;
+	glad_debug_glScissorIndexedv = wrap ? glad_debug_impl_glScissorIndexedv : glad_glScissorIndexedv;
+	glad_debug_glSecondaryColor3b = wrap ? glad_debug_impl_glSecondaryColor3b : glad_glSecondaryColor3b;
+	glad_debug_glSecondaryColor3bv = wrap ? glad_debug_impl_glSecondaryColor3bv : glad_glSecondaryColor3bv;
+	glad_debug_glSecondaryColor3d = wrap ? glad_debug_impl_glSecondaryColor3d : glad_glSecondaryColor3d;
+	glad_debug_glSecondaryColor3dv = wrap ? glad_debug_impl_glSecondaryColor3dv : glad_glSecondaryColor3dv;
+	glad_debug_glSecondaryColor3f = wrap ? glad_debug_impl_glSecondaryColor3f : glad_glSecondaryColor3f;
+	glad_debug_glSecondaryColor3fv = wrap ? glad_debug_impl_glSecondaryColor3fv : glad_glSecondaryColor3fv;
+	glad_debug_glSecondaryColor3i = wrap ? glad_debug_impl_glSecondaryColor3i : glad_glSecondaryColor3i;
+	glad_debug_glSecondaryColor3iv = wrap ? glad_debug_impl_glSecondaryColor3iv : glad_glSecondaryColor3iv;
+	glad_debug_glSecondaryColor3s = wrap ? glad_debug_impl_glSecondaryColor3s : glad_glSecondaryColor3s;
+	glad_debug_glSecondaryColor3sv = wrap ? glad_debug_impl_glSecondaryColor3sv : glad_glSecondaryColor3sv;
+	glad_debug_glSecondaryColor3ub = wrap ? glad_debug_impl_glSecondaryColor3ub : glad_glSecondaryColor3ub;
+	glad_debug_glSecondaryColor3ubv = wrap ? glad_debug_impl_glSecondaryColor3ubv : glad_glSecondaryColor3ubv;
+	glad_debug_glSecondaryColor3ui = wrap ? glad_debug_impl_glSecondaryColor3ui : glad_glSecondaryColor3ui;
+	glad_debug_glSecondaryColor3uiv = wrap ? glad_debug_impl_glSecondaryColor3uiv : glad_glSecondaryColor3uiv;
+	glad_debug_glSecondaryColor3us = wrap ? glad_debug_impl_glSecondaryColor3us : glad_glSecondaryColor3us;
+	glad_debug_glSecondaryColor3usv = wrap ? glad_debug_impl_glSecondaryColor3usv : glad_glSecondaryColor3usv;
+	glad_debug_glSecondaryColorP3ui = wrap ? glad_debug_impl_glSecondaryColorP3ui : glad_glSecondaryColorP3ui;
+	glad_debug_glSecondaryColorP3uiv = wrap ? glad_debug_impl_glSecondaryColorP3uiv : glad_glSecondaryColorP3uiv;
+	glad_debug_glSecondaryColorPointer = wrap ? glad_debug_impl_glSecondaryColorPointer : glad_glSecondaryColorPointer;
+	glad_debug_glSelectBuffer = wrap ? glad_debug_impl_glSelectBuffer : glad_glSelectBuffer;
+	glad_debug_glShadeModel = wrap ? glad_debug_impl_glShadeModel : glad_glShadeModel;
+	glad_debug_glShaderBinary = wrap ? glad_debug_impl_glShaderBinary : glad_glShaderBinary;
+	glad_debug_glShaderSource = wrap ? glad_debug_impl_glShaderSource : glad_glShaderSource;
+	glad_debug_glShaderStorageBlockBinding = wrap ? glad_debug_impl_glShaderStorageBlockBinding : glad_glShaderStorageBlockBinding;
+	glad_debug_glSpecializeShader = wrap ? glad_debug_impl_glSpecializeShader : glad_glSpecializeShader;
+	glad_debug_glSpecializeShaderARB = wrap ? glad_debug_impl_glSpecializeShaderARB : glad_glSpecializeShaderARB;
+	glad_debug_glStencilFunc = wrap ? glad_debug_impl_glStencilFunc : glad_glStencilFunc;
+	glad_debug_glStencilFuncSeparate = wrap ? glad_debug_impl_glStencilFuncSeparate : glad_glStencilFuncSeparate;
+	glad_debug_glStencilMask = wrap ? glad_debug_impl_glStencilMask : glad_glStencilMask;
+	glad_debug_glStencilMaskSeparate = wrap ? glad_debug_impl_glStencilMaskSeparate : glad_glStencilMaskSeparate;
+	glad_debug_glStencilOp = wrap ? glad_debug_impl_glStencilOp : glad_glStencilOp;
+	glad_debug_glStencilOpSeparate = wrap ? glad_debug_impl_glStencilOpSeparate : glad_glStencilOpSeparate;
+	glad_debug_glTexBuffer = wrap ? glad_debug_impl_glTexBuffer : glad_glTexBuffer;
+	glad_debug_glTexBufferRange = wrap ? glad_debug_impl_glTexBufferRange : glad_glTexBufferRange;
+	glad_debug_glTexCoord1d = wrap ? glad_debug_impl_glTexCoord1d : glad_glTexCoord1d;
+	glad_debug_glTexCoord1dv = wrap ? glad_debug_impl_glTexCoord1dv : glad_glTexCoord1dv;
+	glad_debug_glTexCoord1f = wrap ? glad_debug_impl_glTexCoord1f : glad_glTexCoord1f;
+	glad_debug_glTexCoord1fv = wrap ? glad_debug_impl_glTexCoord1fv : glad_glTexCoord1fv;
+	glad_debug_glTexCoord1i = wrap ? glad_debug_impl_glTexCoord1i : glad_glTexCoord1i;
+	glad_debug_glTexCoord1iv = wrap ? glad_debug_impl_glTexCoord1iv : glad_glTexCoord1iv;
+	glad_debug_glTexCoord1s = wrap ? glad_debug_impl_glTexCoord1s : glad_glTexCoord1s;
+	glad_debug_glTexCoord1sv = wrap ? glad_debug_impl_glTexCoord1sv : glad_glTexCoord1sv;
+	glad_debug_glTexCoord2d = wrap ? glad_debug_impl_glTexCoord2d : glad_glTexCoord2d;
+	glad_debug_glTexCoord2dv = wrap ? glad_debug_impl_glTexCoord2dv : glad_glTexCoord2dv;
+	glad_debug_glTexCoord2f = wrap ? glad_debug_impl_glTexCoord2f : glad_glTexCoord2f;
+	glad_debug_glTexCoord2fv = wrap ? glad_debug_impl_glTexCoord2fv : glad_glTexCoord2fv;
+	glad_debug_glTexCoord2i = wrap ? glad_debug_impl_glTexCoord2i : glad_glTexCoord2i;
+	glad_debug_glTexCoord2iv = wrap ? glad_debug_impl_glTexCoord2iv : glad_glTexCoord2iv;
+	glad_debug_glTexCoord2s = wrap ? glad_debug_impl_glTexCoord2s : glad_glTexCoord2s;
+	glad_debug_glTexCoord2sv = wrap ? glad_debug_impl_glTexCoord2sv : glad_glTexCoord2sv;
+	glad_debug_glTexCoord3d = wrap ? glad_debug_impl_glTexCoord3d : glad_glTexCoord3d;
+	glad_debug_glTexCoord3dv = wrap ? glad_debug_impl_glTexCoord3dv : glad_glTexCoord3dv;
+	glad_debug_glTexCoord3f = wrap ? glad_debug_impl_glTexCoord3f : glad_glTexCoord3f;
+	glad_debug_glTexCoord3fv = wrap ? glad_debug_impl_glTexCoord3fv : glad_glTexCoord3fv;
+	glad_debug_glTexCoord3i = wrap ? glad_debug_impl_glTexCoord3i : glad_glTexCoord3i;
+	glad_debug_glTexCoord3iv = wrap ? glad_debug_impl_glTexCoord3iv : glad_glTexCoord3iv;
+	glad_debug_glTexCoord3s = wrap ? glad_debug_impl_glTexCoord3s : glad_glTexCoord3s;
+	glad_debug_glTexCoord3sv = wrap ? glad_debug_impl_glTexCoord3sv : glad_glTexCoord3sv;
+	glad_debug_glTexCoord4d = wrap ? glad_debug_impl_glTexCoord4d : glad_glTexCoord4d;
+	glad_debug_glTexCoord4dv = wrap ? glad_debug_impl_glTexCoord4dv : glad_glTexCoord4dv;
+	glad_debug_glTexCoord4f = wrap ? glad_debug_impl_glTexCoord4f : glad_glTexCoord4f;
+	glad_debug_glTexCoord4fv = wrap ? glad_debug_impl_glTexCoord4fv : glad_glTexCoord4fv;
+	glad_debug_glTexCoord4i = wrap ? glad_debug_impl_glTexCoord4i : glad_glTexCoord4i;
+	glad_debug_glTexCoord4iv = wrap ? glad_debug_impl_glTexCoord4iv : glad_glTexCoord4iv;
+	glad_debug_glTexCoord4s = wrap ? glad_debug_impl_glTexCoord4s : glad_glTexCoord4s;
+	glad_debug_glTexCoord4sv = wrap ? glad_debug_impl_glTexCoord4sv : glad_glTexCoord4sv;
+	glad_debug_glTexCoordP1ui = wrap ? glad_debug_impl_glTexCoordP1ui : glad_glTexCoordP1ui;
+	glad_debug_glTexCoordP1uiv = wrap ? glad_debug_impl_glTexCoordP1uiv : glad_glTexCoordP1uiv;
+	glad_debug_glTexCoordP2ui = wrap ? glad_debug_impl_glTexCoordP2ui : glad_glTexCoordP2ui;
+	glad_debug_glTexCoordP2uiv = wrap ? glad_debug_impl_glTexCoordP2uiv : glad_glTexCoordP2uiv;
+	glad_debug_glTexCoordP3ui = wrap ? glad_debug_impl_glTexCoordP3ui : glad_glTexCoordP3ui;
+	glad_debug_glTexCoordP3uiv = wrap ? glad_debug_impl_glTexCoordP3uiv : glad_glTexCoordP3uiv;
+	glad_debug_glTexCoordP4ui = wrap ? glad_debug_impl_glTexCoordP4ui : glad_glTexCoordP4ui;
+	glad_debug_glTexCoordP4uiv = wrap ? glad_debug_impl_glTexCoordP4uiv : glad_glTexCoordP4uiv;
+	glad_debug_glTexCoordPointer = wrap ? glad_debug_impl_glTexCoordPointer : glad_glTexCoordPointer;
+	glad_debug_glTexEnvf = wrap ? glad_debug_impl_glTexEnvf : glad_glTexEnvf;
+	glad_debug_glTexEnvfv = wrap ? glad_debug_impl_glTexEnvfv : glad_glTexEnvfv;
+	glad_debug_glTexEnvi = wrap ? glad_debug_impl_glTexEnvi : glad_glTexEnvi;
+	glad_debug_glTexEnviv = wrap ? glad_debug_impl_glTexEnviv : glad_glTexEnviv;
+	glad_debug_glTexGend = wrap ? glad_debug_impl_glTexGend : glad_glTexGend;
+	glad_debug_glTexGendv = wrap ? glad_debug_impl_glTexGendv : glad_glTexGendv;
+	glad_debug_glTexGenf = wrap ? glad_debug_impl_glTexGenf : glad_glTexGenf;
+	glad_debug_glTexGenfv = wrap ? glad_debug_impl_glTexGenfv : glad_glTexGenfv;
+	glad_debug_glTexGeni = wrap ? glad_debug_impl_glTexGeni : glad_glTexGeni;
+	glad_debug_glTexGeniv = wrap ? glad_debug_impl_glTexGeniv : glad_glTexGeniv;
+	glad_debug_glTexImage1D = wrap ? glad_debug_impl_glTexImage1D : glad_glTexImage1D;
+	glad_debug_glTexImage2D = wrap ? glad_debug_impl_glTexImage2D : glad_glTexImage2D;
+	glad_debug_glTexImage2DMultisample = wrap ? glad_debug_impl_glTexImage2DMultisample : glad_glTexImage2DMultisample;
+	glad_debug_glTexImage3D = wrap ? glad_debug_impl_glTexImage3D : glad_glTexImage3D;
+	glad_debug_glTexImage3DMultisample = wrap ? glad_debug_impl_glTexImage3DMultisample : glad_glTexImage3DMultisample;
+	glad_debug_glTexParameterIiv = wrap ? glad_debug_impl_glTexParameterIiv : glad_glTexParameterIiv;
+	glad_debug_glTexParameterIuiv = wrap ? glad_debug_impl_glTexParameterIuiv : glad_glTexParameterIuiv;
+	glad_debug_glTexParameterf = wrap ? glad_debug_impl_glTexParameterf : glad_glTexParameterf;
+	glad_debug_glTexParameterfv = wrap ? glad_debug_impl_glTexParameterfv : glad_glTexParameterfv;
+	glad_debug_glTexParameteri = wrap ? glad_debug_impl_glTexParameteri : glad_glTexParameteri;
+	glad_debug_glTexParameteriv = wrap ? glad_debug_impl_glTexParameteriv : glad_glTexParameteriv;
+	glad_debug_glTexStorage1D = wrap ? glad_debug_impl_glTexStorage1D : glad_glTexStorage1D;
+	glad_debug_glTexStorage2D = wrap ? glad_debug_impl_glTexStorage2D : glad_glTexStorage2D;
+	glad_debug_glTexStorage2DMultisample = wrap ? glad_debug_impl_glTexStorage2DMultisample : glad_glTexStorage2DMultisample;
+	glad_debug_glTexStorage3D = wrap ? glad_debug_impl_glTexStorage3D : glad_glTexStorage3D;
+	glad_debug_glTexStorage3DMultisample = wrap ? glad_debug_impl_glTexStorage3DMultisample : glad_glTexStorage3DMultisample;
+	glad_debug_glTexSubImage1D = wrap ? glad_debug_impl_glTexSubImage1D : glad_glTexSubImage1D;
+	glad_debug_glTexSubImage2D = wrap ? glad_debug_impl_glTexSubImage2D : glad_glTexSubImage2D;
+	glad_debug_glTexSubImage3D = wrap ? glad_debug_impl_glTexSubImage3D : glad_glTexSubImage3D;
+	glad_debug_glTextureBarrier = wrap ? glad_debug_impl_glTextureBarrier : glad_glTextureBarrier;
+	glad_debug_glTextureBuffer = wrap ? glad_debug_impl_glTextureBuffer : glad_glTextureBuffer;
+	glad_debug_glTextureBufferRange = wrap ? glad_debug_impl_glTextureBufferRange : glad_glTextureBufferRange;
+	glad_debug_glTextureParameterIiv = wrap ? glad_debug_impl_glTextureParameterIiv : glad_glTextureParameterIiv;
+	glad_debug_glTextureParameterIuiv = wrap ? glad_debug_impl_glTextureParameterIuiv : glad_glTextureParameterIuiv;
+	glad_debug_glTextureParameterf = wrap ? glad_debug_impl_glTextureParameterf : glad_glTextureParameterf;
+	glad_debug_glTextureParameterfv = wrap ? glad_debug_impl_glTextureParameterfv : glad_glTextureParameterfv;
+	glad_debug_glTextureParameteri = wrap ? glad_debug_impl_glTextureParameteri : glad_glTextureParameteri;
+	glad_debug_glTextureParameteriv = wrap ? glad_debug_impl_glTextureParameteriv : glad_glTextureParameteriv;
+	glad_debug_glTextureStorage1D = wrap ? glad_debug_impl_glTextureStorage1D : glad_glTextureStorage1D;
+	glad_debug_glTextureStorage2D = wrap ? glad_debug_impl_glTextureStorage2D : glad_glTextureStorage2D;
+	glad_debug_glTextureStorage2DMultisample = wrap ? glad_debug_impl_glTextureStorage2DMultisample : glad_glTextureStorage2DMultisample;
+	glad_debug_glTextureStorage3D = wrap ? glad_debug_impl_glTextureStorage3D : glad_glTextureStorage3D;
+	glad_debug_glTextureStorage3DMultisample = wrap ? glad_debug_impl_glTextureStorage3DMultisample : glad_glTextureStorage3DMultisample;
+	glad_debug_glTextureSubImage1D = wrap ? glad_debug_impl_glTextureSubImage1D : glad_glTextureSubImage1D;
+	glad_debug_glTextureSubImage2D = wrap ? glad_debug_impl_glTextureSubImage2D : glad_glTextureSubImage2D;
+	glad_debug_glTextureSubImage3D = wrap ? glad_debug_impl_glTextureSubImage3D : glad_glTextureSubImage3D;
+	glad_debug_glTextureView = wrap ? glad_debug_impl_glTextureView : glad_glTextureView;
+	glad_debug_glTransformFeedbackBufferBase = wrap ? glad_debug_impl_glTransformFeedbackBufferBase : glad_glTransformFeedbackBufferBase;
+	glad_debug_glTransformFeedbackBufferRange = wrap ? glad_debug_impl_glTransformFeedbackBufferRange : glad_glTransformFeedbackBufferRange;
+	glad_debug_glTransformFeedbackVaryings = wrap ? glad_debug_impl_glTransformFeedbackVaryings : glad_glTransformFeedbackVaryings;
+	glad_debug_glTranslated = wrap ? glad_debug_impl_glTranslated : glad_glTranslated;
+	glad_debug_glTranslatef = wrap ? glad_debug_impl_glTranslatef : glad_glTranslatef;
+	glad_debug_glUniform1d = wrap ? glad_debug_impl_glUniform1d : glad_glUniform1d;
+	glad_debug_glUniform1dv = wrap ? glad_debug_impl_glUniform1dv : glad_glUniform1dv;
+	glad_debug_glUniform1f = wrap ? glad_debug_impl_glUniform1f : glad_glUniform1f;
+	glad_debug_glUniform1fv = wrap ? glad_debug_impl_glUniform1fv : glad_glUniform1fv;
+	glad_debug_glUniform1i = wrap ? glad_debug_impl_glUniform1i : glad_glUniform1i;
+	glad_debug_glUniform1iv = wrap ? glad_debug_impl_glUniform1iv : glad_glUniform1iv;
+	glad_debug_glUniform1ui = wrap ? glad_debug_impl_glUniform1ui : glad_glUniform1ui;
+	glad_debug_glUniform1uiv = wrap ? glad_debug_impl_glUniform1uiv : glad_glUniform1uiv;
+	glad_debug_glUniform2d = wrap ? glad_debug_impl_glUniform2d : glad_glUniform2d;
+	glad_debug_glUniform2dv = wrap ? glad_debug_impl_glUniform2dv : glad_glUniform2dv;
+	glad_debug_glUniform2f = wrap ? glad_debug_impl_glUniform2f : glad_glUniform2f;
+	glad_debug_glUniform2fv = wrap ? glad_debug_impl_glUniform2fv : glad_glUniform2fv;
+	glad_debug_glUniform2i = wrap ? glad_debug_impl_glUniform2i : glad_glUniform2i;
+	glad_debug_glUniform2iv = wrap ? glad_debug_impl_glUniform2iv : glad_glUniform2iv;
+	glad_debug_glUniform2ui = wrap ? glad_debug_impl_glUniform2ui : glad_glUniform2ui;
+	glad_debug_glUniform2uiv = wrap ? glad_debug_impl_glUniform2uiv : glad_glUniform2uiv;
+	glad_debug_glUniform3d = wrap ? glad_debug_impl_glUniform3d : glad_glUniform3d;
+	glad_debug_glUniform3dv = wrap ? glad_debug_impl_glUniform3dv : glad_glUniform3dv;
+	glad_debug_glUniform3f = wrap ? glad_debug_impl_glUniform3f : glad_glUniform3f;
+	glad_debug_glUniform3fv = wrap ? glad_debug_impl_glUniform3fv : glad_glUniform3fv;
+	glad_debug_glUniform3i = wrap ? glad_debug_impl_glUniform3i : glad_glUniform3i;
+	glad_debug_glUniform3iv = wrap ? glad_debug_impl_glUniform3iv : glad_glUniform3iv;
+	glad_debug_glUniform3ui = wrap ? glad_debug_impl_glUniform3ui : glad_glUniform3ui;
+	glad_debug_glUniform3uiv = wrap ? glad_debug_impl_glUniform3uiv : glad_glUniform3uiv;
+	glad_debug_glUniform4d = wrap ? glad_debug_impl_glUniform4d : glad_glUniform4d;
+	glad_debug_glUniform4dv = wrap ? glad_debug_impl_glUniform4dv : glad_glUniform4dv;
+	glad_debug_glUniform4f = wrap ? glad_debug_impl_glUniform4f : glad_glUniform4f;
+	glad_debug_glUniform4fv = wrap ? glad_debug_impl_glUniform4fv : glad_glUniform4fv;
+	glad_debug_glUniform4i = wrap ? glad_debug_impl_glUniform4i : glad_glUniform4i;
+	glad_debug_glUniform4iv = wrap ? glad_debug_impl_glUniform4iv : glad_glUniform4iv;
+	glad_debug_glUniform4ui = wrap ? glad_debug_impl_glUniform4ui : glad_glUniform4ui;
+	glad_debug_glUniform4uiv = wrap ? glad_debug_impl_glUniform4uiv : glad_glUniform4uiv;
+	glad_debug_glUniformBlockBinding = wrap ? glad_debug_impl_glUniformBlockBinding : glad_glUniformBlockBinding;
+	glad_debug_glUniformHandleui64ARB = wrap ? glad_debug_impl_glUniformHandleui64ARB : glad_glUniformHandleui64ARB;
+	glad_debug_glUniformHandleui64vARB = wrap ? glad_debug_impl_glUniformHandleui64vARB : glad_glUniformHandleui64vARB;
+	glad_debug_glUniformMatrix2dv = wrap ? glad_debug_impl_glUniformMatrix2dv : glad_glUniformMatrix2dv;
+	glad_debug_glUniformMatrix2fv = wrap ? glad_debug_impl_glUniformMatrix2fv : glad_glUniformMatrix2fv;
+	glad_debug_glUniformMatrix2x3dv = wrap ? glad_debug_impl_glUniformMatrix2x3dv : glad_glUniformMatrix2x3dv;
+	glad_debug_glUniformMatrix2x3fv = wrap ? glad_debug_impl_glUniformMatrix2x3fv : glad_glUniformMatrix2x3fv;
+	glad_debug_glUniformMatrix2x4dv = wrap ? glad_debug_impl_glUniformMatrix2x4dv : glad_glUniformMatrix2x4dv;
+	glad_debug_glUniformMatrix2x4fv = wrap ? glad_debug_impl_glUniformMatrix2x4fv : glad_glUniformMatrix2x4fv;
+	glad_debug_glUniformMatrix3dv = wrap ? glad_debug_impl_glUniformMatrix3dv : glad_glUniformMatrix3dv;
+	glad_debug_glUniformMatrix3fv = wrap ? glad_debug_impl_glUniformMatrix3fv : glad_glUniformMatrix3fv;
+	glad_debug_glUniformMatrix3x2dv = wrap ? glad_debug_impl_glUniformMatrix3x2dv : glad_glUniformMatrix3x2dv;
+	glad_debug_glUniformMatrix3x2fv = wrap ? glad_debug_impl_glUniformMatrix3x2fv : glad_glUniformMatrix3x2fv;
+	glad_debug_glUniformMatrix3x4dv = wrap ? glad_debug_impl_glUniformMatrix3x4dv : glad_glUniformMatrix3x4dv;
+	glad_debug_glUniformMatrix3x4fv = wrap ? glad_debug_impl_glUniformMatrix3x4fv : glad_glUniformMatrix3x4fv;
+	glad_debug_glUniformMatrix4dv = wrap ? glad_debug_impl_glUniformMatrix4dv : glad_glUniformMatrix4dv;
+	glad_debug_glUniformMatrix4fv = wrap ? glad_debug_impl_glUniformMatrix4fv : glad_glUniformMatrix4fv;
+	glad_debug_glUniformMatrix4x2dv = wrap ? glad_debug_impl_glUniformMatrix4x2dv : glad_glUniformMatrix4x2dv;
+	glad_debug_glUniformMatrix4x2fv = wrap ? glad_debug_impl_glUniformMatrix4x2fv : glad_glUniformMatrix4x2fv;
+	glad_debug_glUniformMatrix4x3dv = wrap ? glad_debug_impl_glUniformMatrix4x3dv : glad_glUniformMatrix4x3dv;
+	glad_debug_glUniformMatrix4x3fv = wrap ? glad_debug_impl_glUniformMatrix4x3fv : glad_glUniformMatrix4x3fv;
+	glad_debug_glUniformSubroutinesuiv = wrap ? glad_debug_impl_glUniformSubroutinesuiv : glad_glUniformSubroutinesuiv;
+	glad_debug_glUnmapBuffer = wrap ? glad_debug_impl_glUnmapBuffer : glad_glUnmapBuffer;
+	glad_debug_glUnmapNamedBuffer = wrap ? glad_debug_impl_glUnmapNamedBuffer : glad_glUnmapNamedBuffer;
+	glad_debug_glUseProgram = wrap ? glad_debug_impl_glUseProgram : glad_glUseProgram;
+	glad_debug_glUseProgramStages = wrap ? glad_debug_impl_glUseProgramStages : glad_glUseProgramStages;
+	glad_debug_glValidateProgram = wrap ? glad_debug_impl_glValidateProgram : glad_glValidateProgram;
+	glad_debug_glValidateProgramPipeline = wrap ? glad_debug_impl_glValidateProgramPipeline : glad_glValidateProgramPipeline;
+	glad_debug_glVertex2d = wrap ? glad_debug_impl_glVertex2d : glad_glVertex2d;
+	glad_debug_glVertex2dv = wrap ? glad_debug_impl_glVertex2dv : glad_glVertex2dv;
+	glad_debug_glVertex2f = wrap ? glad_debug_impl_glVertex2f : glad_glVertex2f;
+	glad_debug_glVertex2fv = wrap ? glad_debug_impl_glVertex2fv : glad_glVertex2fv;
+	glad_debug_glVertex2i = wrap ? glad_debug_impl_glVertex2i : glad_glVertex2i;
+	glad_debug_glVertex2iv = wrap ? glad_debug_impl_glVertex2iv : glad_glVertex2iv;
+	glad_debug_glVertex2s = wrap ? glad_debug_impl_glVertex2s : glad_glVertex2s;
+	glad_debug_glVertex2sv = wrap ? glad_debug_impl_glVertex2sv : glad_glVertex2sv;
+	glad_debug_glVertex3d = wrap ? glad_debug_impl_glVertex3d : glad_glVertex3d;
+	glad_debug_glVertex3dv = wrap ? glad_debug_impl_glVertex3dv : glad_glVertex3dv;
+	glad_debug_glVertex3f = wrap ? glad_debug_impl_glVertex3f : glad_glVertex3f;
+	glad_debug_glVertex3fv = wrap ? glad_debug_impl_glVertex3fv : glad_glVertex3fv;
+	glad_debug_glVertex3i = wrap ? glad_debug_impl_glVertex3i : glad_glVertex3i;
+	glad_debug_glVertex3iv = wrap ? glad_debug_impl_glVertex3iv : glad_glVertex3iv;
+	glad_debug_glVertex3s = wrap ? glad_debug_impl_glVertex3s : glad_glVertex3s;
+	glad_debug_glVertex3sv = wrap ? glad_debug_impl_glVertex3sv : glad_glVertex3sv;
+	glad_debug_glVertex4d = wrap ? glad_debug_impl_glVertex4d : glad_glVertex4d;
+	glad_debug_glVertex4dv = wrap ? glad_debug_impl_glVertex4dv : glad_glVertex4dv;
+	glad_debug_glVertex4f = wrap ? glad_debug_impl_glVertex4f : glad_glVertex4f;
+	glad_debug_glVertex4fv = wrap ? glad_debug_impl_glVertex4fv : glad_glVertex4fv;
+	glad_debug_glVertex4i = wrap ? glad_debug_impl_glVertex4i : glad_glVertex4i;
+	glad_debug_glVertex4iv = wrap ? glad_debug_impl_glVertex4iv : glad_glVertex4iv;
+	glad_debug_glVertex4s = wrap ? glad_debug_impl_glVertex4s : glad_glVertex4s;
+	glad_debug_glVertex4sv = wrap ? glad_debug_impl_glVertex4sv : glad_glVertex4sv;
+	glad_debug_glVertexArrayAttribBinding = wrap ? glad_debug_impl_glVertexArrayAttribBinding : glad_glVertexArrayAttribBinding;
+	glad_debug_glVertexArrayAttribFormat = wrap ? glad_debug_impl_glVertexArrayAttribFormat : glad_glVertexArrayAttribFormat;
+	glad_debug_glVertexArrayAttribIFormat = wrap ? glad_debug_impl_glVertexArrayAttribIFormat : glad_glVertexArrayAttribIFormat;
+	glad_debug_glVertexArrayAttribLFormat = wrap ? glad_debug_impl_glVertexArrayAttribLFormat : glad_glVertexArrayAttribLFormat;
+	glad_debug_glVertexArrayBindingDivisor = wrap ? glad_debug_impl_glVertexArrayBindingDivisor : glad_glVertexArrayBindingDivisor;
+	glad_debug_glVertexArrayElementBuffer = wrap ? glad_debug_impl_glVertexArrayElementBuffer : glad_glVertexArrayElementBuffer;
+	glad_debug_glVertexArrayVertexBuffer = wrap ? glad_debug_impl_glVertexArrayVertexBuffer : glad_glVertexArrayVertexBuffer;
+	glad_debug_glVertexArrayVertexBuffers = wrap ? glad_debug_impl_glVertexArrayVertexBuffers : glad_glVertexArrayVertexBuffers;
+	glad_debug_glVertexAttrib1d = wrap ? glad_debug_impl_glVertexAttrib1d : glad_glVertexAttrib1d;
+	glad_debug_glVertexAttrib1dv = wrap ? glad_debug_impl_glVertexAttrib1dv : glad_glVertexAttrib1dv;
+	glad_debug_glVertexAttrib1f = wrap ? glad_debug_impl_glVertexAttrib1f : glad_glVertexAttrib1f;
+	glad_debug_glVertexAttrib1fv = wrap ? glad_debug_impl_glVertexAttrib1fv : glad_glVertexAttrib1fv;
+	glad_debug_glVertexAttrib1s = wrap ? glad_debug_impl_glVertexAttrib1s : glad_glVertexAttrib1s;
+	glad_debug_glVertexAttrib1sv = wrap ? glad_debug_impl_glVertexAttrib1sv : glad_glVertexAttrib1sv;
+	glad_debug_glVertexAttrib2d = wrap ? glad_debug_impl_glVertexAttrib2d : glad_glVertexAttrib2d;
+	glad_debug_glVertexAttrib2dv = wrap ? glad_debug_impl_glVertexAttrib2dv : glad_glVertexAttrib2dv;
+	glad_debug_glVertexAttrib2f = wrap ? glad_debug_impl_glVertexAttrib2f : glad_glVertexAttrib2f;
+	glad_debug_glVertexAttrib2fv = wrap ? glad_debug_impl_glVertexAttrib2fv : glad_glVertexAttrib2fv;
+	glad_debug_glVertexAttrib2s = wrap ? glad_debug_impl_glVertexAttrib2s : glad_glVertexAttrib2s;
+	glad_debug_glVertexAttrib2sv = wrap ? glad_debug_impl_glVertexAttrib2sv : glad_glVertexAttrib2sv;
+	glad_debug_glVertexAttrib3d = wrap ? glad_debug_impl_glVertexAttrib3d : glad_glVertexAttrib3d;
+	glad_debug_glVertexAttrib3dv = wrap ? glad_debug_impl_glVertexAttrib3dv : glad_glVertexAttrib3dv;
+	glad_debug_glVertexAttrib3f = wrap ? glad_debug_impl_glVertexAttrib3f : glad_glVertexAttrib3f;
+	glad_debug_glVertexAttrib3fv = wrap ? glad_debug_impl_glVertexAttrib3fv : glad_glVertexAttrib3fv;
+	glad_debug_glVertexAttrib3s = wrap ? glad_debug_impl_glVertexAttrib3s : glad_glVertexAttrib3s;
+	glad_debug_glVertexAttrib3sv = wrap ? glad_debug_impl_glVertexAttrib3sv : glad_glVertexAttrib3sv;
+	glad_debug_glVertexAttrib4Nbv = wrap ? glad_debug_impl_glVertexAttrib4Nbv : glad_glVertexAttrib4Nbv;
+	glad_debug_glVertexAttrib4Niv = wrap ? glad_debug_impl_glVertexAttrib4Niv : glad_glVertexAttrib4Niv;
+	glad_debug_glVertexAttrib4Nsv = wrap ? glad_debug_impl_glVertexAttrib4Nsv : glad_glVertexAttrib4Nsv;
+	glad_debug_glVertexAttrib4Nub = wrap ? glad_debug_impl_glVertexAttrib4Nub : glad_glVertexAttrib4Nub;
+	glad_debug_glVertexAttrib4Nubv = wrap ? glad_debug_impl_glVertexAttrib4Nubv : glad_glVertexAttrib4Nubv;
+	glad_debug_glVertexAttrib4Nuiv = wrap ? glad_debug_impl_glVertexAttrib4Nuiv : glad_glVertexAttrib4Nuiv;
+	glad_debug_glVertexAttrib4Nusv = wrap ? glad_debug_impl_glVertexAttrib4Nusv : glad_glVertexAttrib4Nusv;
+	glad_debug_glVertexAttrib4bv = wrap ? glad_debug_impl_glVertexAttrib4bv : glad_glVertexAttrib4bv;
+	glad_debug_glVertexAttrib4d = wrap ? glad_debug_impl_glVertexAttrib4d : glad_glVertexAttrib4d;
+	glad_debug_glVertexAttrib4dv = wrap ? glad_debug_impl_glVertexAttrib4dv : glad_glVertexAttrib4dv;
+	glad_debug_glVertexAttrib4f = wrap ? glad_debug_impl_glVertexAttrib4f : glad_glVertexAttrib4f;
+	glad_debug_glVertexAttrib4fv = wrap ? glad_debug_impl_glVertexAttrib4fv : glad_glVertexAttrib4fv;
+	glad_debug_glVertexAttrib4iv = wrap ? glad_debug_impl_glVertexAttrib4iv : glad_glVertexAttrib4iv;
+	glad_debug_glVertexAttrib4s = wrap ? glad_debug_impl_glVertexAttrib4s : glad_glVertexAttrib4s;
+	glad_debug_glVertexAttrib4sv = wrap ? glad_debug_impl_glVertexAttrib4sv : glad_glVertexAttrib4sv;
+	glad_debug_glVertexAttrib4ubv = wrap ? glad_debug_impl_glVertexAttrib4ubv : glad_glVertexAttrib4ubv;
+	glad_debug_glVertexAttrib4uiv = wrap ? glad_debug_impl_glVertexAttrib4uiv : glad_glVertexAttrib4uiv;
+	glad_debug_glVertexAttrib4usv = wrap ? glad_debug_impl_glVertexAttrib4usv : glad_glVertexAttrib4usv;
+	glad_debug_glVertexAttribBinding = wrap ? glad_debug_impl_glVertexAttribBinding : glad_glVertexAttribBinding;
+	glad_debug_glVertexAttribDivisor = wrap ? glad_debug_impl_glVertexAttribDivisor : glad_glVertexAttribDivisor;
+	glad_debug_glVertexAttribFormat = wrap ? glad_debug_impl_glVertexAttribFormat : glad_glVertexAttribFormat;
+	glad_debug_glVertexAttribI1i = wrap ? glad_debug_impl_glVertexAttribI1i : glad_glVertexAttribI1i;
+	glad_debug_glVertexAttribI1iv = wrap ? glad_debug_impl_glVertexAttribI1iv : glad_glVertexAttribI1iv;
+	glad_debug_glVertexAttribI1ui = wrap ? glad_debug_impl_glVertexAttribI1ui : glad_glVertexAttribI1ui;
+	glad_debug_glVertexAttribI1uiv = wrap ? glad_debug_impl_glVertexAttribI1uiv : glad_glVertexAttribI1uiv;
+	glad_debug_glVertexAttribI2i = wrap ? glad_debug_impl_glVertexAttribI2i : glad_glVertexAttribI2i;
+	glad_debug_glVertexAttribI2iv = wrap ? glad_debug_impl_glVertexAttribI2iv : glad_glVertexAttribI2iv;
+	glad_debug_glVertexAttribI2ui = wrap ? glad_debug_impl_glVertexAttribI2ui : glad_glVertexAttribI2ui;
+	glad_debug_glVertexAttribI2uiv = wrap ? glad_debug_impl_glVertexAttribI2uiv : glad_glVertexAttribI2uiv;
+	glad_debug_glVertexAttribI3i = wrap ? glad_debug_impl_glVertexAttribI3i : glad_glVertexAttribI3i;
+	glad_debug_glVertexAttribI3iv = wrap ? glad_debug_impl_glVertexAttribI3iv : glad_glVertexAttribI3iv;
+	glad_debug_glVertexAttribI3ui = wrap ? glad_debug_impl_glVertexAttribI3ui : glad_glVertexAttribI3ui;
+	glad_debug_glVertexAttribI3uiv = wrap ? glad_debug_impl_glVertexAttribI3uiv : glad_glVertexAttribI3uiv;
+	glad_debug_glVertexAttribI4bv = wrap ? glad_debug_impl_glVertexAttribI4bv : glad_glVertexAttribI4bv;
+	glad_debug_glVertexAttribI4i = wrap ? glad_debug_impl_glVertexAttribI4i : glad_glVertexAttribI4i;
+	glad_debug_glVertexAttribI4iv = wrap ? glad_debug_impl_glVertexAttribI4iv : glad_glVertexAttribI4iv;
+	glad_debug_glVertexAttribI4sv = wrap ? glad_debug_impl_glVertexAttribI4sv : glad_glVertexAttribI4sv;
+	glad_debug_glVertexAttribI4ubv = wrap ? glad_debug_impl_glVertexAttribI4ubv : glad_glVertexAttribI4ubv;
+	glad_debug_glVertexAttribI4ui = wrap ? glad_debug_impl_glVertexAttribI4ui : glad_glVertexAttribI4ui;
+	glad_debug_glVertexAttribI4uiv = wrap ? glad_debug_impl_glVertexAttribI4uiv : glad_glVertexAttribI4uiv;
+	glad_debug_glVertexAttribI4usv = wrap ? glad_debug_impl_glVertexAttribI4usv : glad_glVertexAttribI4usv;
+	glad_debug_glVertexAttribIFormat = wrap ? glad_debug_impl_glVertexAttribIFormat : glad_glVertexAttribIFormat;
+	glad_debug_glVertexAttribIPointer = wrap ? glad_debug_impl_glVertexAttribIPointer : glad_glVertexAttribIPointer;
+	glad_debug_glVertexAttribL1d = wrap ? glad_debug_impl_glVertexAttribL1d : glad_glVertexAttribL1d;
+	glad_debug_glVertexAttribL1dv = wrap ? glad_debug_impl_glVertexAttribL1dv : glad_glVertexAttribL1dv;
+	glad_debug_glVertexAttribL1ui64ARB = wrap ? glad_debug_impl_glVertexAttribL1ui64ARB : glad_glVertexAttribL1ui64ARB;
+	glad_debug_glVertexAttribL1ui64vARB = wrap ? glad_debug_impl_glVertexAttribL1ui64vARB : glad_glVertexAttribL1ui64vARB;
+	glad_debug_glVertexAttribL2d = wrap ? glad_debug_impl_glVertexAttribL2d : glad_glVertexAttribL2d;
+	glad_debug_glVertexAttribL2dv = wrap ? glad_debug_impl_glVertexAttribL2dv : glad_glVertexAttribL2dv;
+	glad_debug_glVertexAttribL3d = wrap ? glad_debug_impl_glVertexAttribL3d : glad_glVertexAttribL3d;
+	glad_debug_glVertexAttribL3dv = wrap ? glad_debug_impl_glVertexAttribL3dv : glad_glVertexAttribL3dv;
+	glad_debug_glVertexAttribL4d = wrap ? glad_debug_impl_glVertexAttribL4d : glad_glVertexAttribL4d;
+	glad_debug_glVertexAttribL4dv = wrap ? glad_debug_impl_glVertexAttribL4dv : glad_glVertexAttribL4dv;
+	glad_debug_glVertexAttribLFormat = wrap ? glad_debug_impl_glVertexAttribLFormat : glad_glVertexAttribLFormat;
+	glad_debug_glVertexAttribLPointer = wrap ? glad_debug_impl_glVertexAttribLPointer : glad_glVertexAttribLPointer;
+	glad_debug_glVertexAttribP1ui = wrap ? glad_debug_impl_glVertexAttribP1ui : glad_glVertexAttribP1ui;
+	glad_debug_glVertexAttribP1uiv = wrap ? glad_debug_impl_glVertexAttribP1uiv : glad_glVertexAttribP1uiv;
+	glad_debug_glVertexAttribP2ui = wrap ? glad_debug_impl_glVertexAttribP2ui : glad_glVertexAttribP2ui;
+	glad_debug_glVertexAttribP2uiv = wrap ? glad_debug_impl_glVertexAttribP2uiv : glad_glVertexAttribP2uiv;
+	glad_debug_glVertexAttribP3ui = wrap ? glad_debug_impl_glVertexAttribP3ui : glad_glVertexAttribP3ui;
+	glad_debug_glVertexAttribP3uiv = wrap ? glad_debug_impl_glVertexAttribP3uiv : glad_glVertexAttribP3uiv;
+	glad_debug_glVertexAttribP4ui = wrap ? glad_debug_impl_glVertexAttribP4ui : glad_glVertexAttribP4ui;
+	glad_debug_glVertexAttribP4uiv = wrap ? glad_debug_impl_glVertexAttribP4uiv : glad_glVertexAttribP4uiv;
+	glad_debug_glVertexAttribPointer = wrap ? glad_debug_impl_glVertexAttribPointer : glad_glVertexAttribPointer;
+	glad_debug_glVertexBindingDivisor = wrap ? glad_debug_impl_glVertexBindingDivisor : glad_glVertexBindingDivisor;
+	glad_debug_glVertexP2ui = wrap ? glad_debug_impl_glVertexP2ui : glad_glVertexP2ui;
+	glad_debug_glVertexP2uiv = wrap ? glad_debug_impl_glVertexP2uiv : glad_glVertexP2uiv;
+	glad_debug_glVertexP3ui = wrap ? glad_debug_impl_glVertexP3ui : glad_glVertexP3ui;
+	glad_debug_glVertexP3uiv = wrap ? glad_debug_impl_glVertexP3uiv : glad_glVertexP3uiv;
+	glad_debug_glVertexP4ui = wrap ? glad_debug_impl_glVertexP4ui : glad_glVertexP4ui;
+	glad_debug_glVertexP4uiv = wrap ? glad_debug_impl_glVertexP4uiv : glad_glVertexP4uiv;
+	glad_debug_glVertexPointer = wrap ? glad_debug_impl_glVertexPointer : glad_glVertexPointer;
+	glad_debug_glViewport = wrap ? glad_debug_impl_glViewport : glad_glViewport;
+	glad_debug_glViewportArrayv = wrap ? glad_debug_impl_glViewportArrayv : glad_glViewportArrayv;
+	glad_debug_glViewportIndexedf = wrap ? glad_debug_impl_glViewportIndexedf : glad_glViewportIndexedf;
+	glad_debug_glViewportIndexedfv = wrap ? glad_debug_impl_glViewportIndexedfv : glad_glViewportIndexedfv;
+	glad_debug_glWaitSync = wrap ? glad_debug_impl_glWaitSync : glad_glWaitSync;
+	glad_debug_glWindowPos2d = wrap ? glad_debug_impl_glWindowPos2d : glad_glWindowPos2d;
+	glad_debug_glWindowPos2dv = wrap ? glad_debug_impl_glWindowPos2dv : glad_glWindowPos2dv;
+	glad_debug_glWindowPos2f = wrap ? glad_debug_impl_glWindowPos2f : glad_glWindowPos2f;
+	glad_debug_glWindowPos2fv = wrap ? glad_debug_impl_glWindowPos2fv : glad_glWindowPos2fv;
+	glad_debug_glWindowPos2i = wrap ? glad_debug_impl_glWindowPos2i : glad_glWindowPos2i;
+	glad_debug_glWindowPos2iv = wrap ? glad_debug_impl_glWindowPos2iv : glad_glWindowPos2iv;
+	glad_debug_glWindowPos2s = wrap ? glad_debug_impl_glWindowPos2s : glad_glWindowPos2s;
+	glad_debug_glWindowPos2sv = wrap ? glad_debug_impl_glWindowPos2sv : glad_glWindowPos2sv;
+	glad_debug_glWindowPos3d = wrap ? glad_debug_impl_glWindowPos3d : glad_glWindowPos3d;
+	glad_debug_glWindowPos3dv = wrap ? glad_debug_impl_glWindowPos3dv : glad_glWindowPos3dv;
+	glad_debug_glWindowPos3f = wrap ? glad_debug_impl_glWindowPos3f : glad_glWindowPos3f;
+	glad_debug_glWindowPos3fv = wrap ? glad_debug_impl_glWindowPos3fv : glad_glWindowPos3fv;
+	glad_debug_glWindowPos3i = wrap ? glad_debug_impl_glWindowPos3i : glad_glWindowPos3i;
+	glad_debug_glWindowPos3iv = wrap ? glad_debug_impl_glWindowPos3iv : glad_glWindowPos3iv;
+	glad_debug_glWindowPos3s = wrap ? glad_debug_impl_glWindowPos3s : glad_glWindowPos3s;
+	glad_debug_glWindowPos3sv = wrap ? glad_debug_impl_glWindowPos3sv : glad_glWindowPos3sv;
+}
+
+#endif /* LEARNOPENGL_GL_DEBUG_LAYER */
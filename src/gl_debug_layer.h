@@ -0,0 +1,3234 @@
+/*
+
+    Error checking and call tracing wrappers for the OpenGL loader generated by glad 0.1.34.
+
+    APIs: gl=4.6
+    Extensions: GL_ARB_bindless_texture,GL_ARB_buffer_storage,GL_ARB_direct_state_access,GL_ARB_gl_spirv,GL_ARB_invalidate_subdata,GL_ARB_multi_draw_indirect,GL_ATI_meminfo,GL_KHR_debug,GL_KHR_parallel_shader_compile,GL_NVX_gpu_memory_info
+
+    Generated by tools/gen_gl_layers.py from the function list of src/glad.c, do not edit. After regenerating the loader:
+        python tools/gen_gl_layers.py
+    Only used when LEARNOPENGL_GL_DEBUG_LAYER is defined, see gl_debug.h.
+*/
+
+#ifndef __gl_debug_layer_h_
+#define __gl_debug_layer_h_
+
+#ifdef LEARNOPENGL_GL_DEBUG_LAYER
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 1: every gl* call goes through its wrapper, 0: straight to the driver entry point (same cost as without the layer) */
+void gl_debug_layer_install(int wrap);
+
+extern PFNGLACCUMPROC glad_debug_glAccum;
+extern PFNGLACTIVESHADERPROGRAMPROC glad_debug_glActiveShaderProgram;
+extern PFNGLACTIVETEXTUREPROC glad_debug_glActiveTexture;
+extern PFNGLALPHAFUNCPROC glad_debug_glAlphaFunc;
+extern PFNGLARETEXTURESRESIDENTPROC glad_debug_glAreTexturesResident;
+extern PFNGLARRAYELEMENTPROC glad_debug_glArrayElement;
+extern PFNGLATTACHSHADERPROC glad_debug_glAttachShader;
+extern PFNGLBEGINPROC glad_debug_glBegin;
+extern PFNGLBEGINCONDITIONALRENDERPROC glad_debug_glBeginConditionalRender;
+extern PFNGLBEGINQUERYPROC glad_debug_glBeginQuery;
+extern PFNGLBEGINQUERYINDEXEDPROC glad_debug_glBeginQueryIndexed;
+extern PFNGLBEGINTRANSFORMFEEDBACKPROC glad_debug_glBeginTransformFeedback;
+extern PFNGLBINDATTRIBLOCATIONPROC glad_debug_glBindAttribLocation;
+extern PFNGLBINDBUFFERPROC glad_debug_glBindBuffer;
+extern PFNGLBINDBUFFERBASEPROC glad_debug_glBindBufferBase;
+extern PFNGLBINDBUFFERRANGEPROC glad_debug_glBindBufferRange;
+extern PFNGLBINDBUFFERSBASEPROC glad_debug_glBindBuffersBase;
+extern PFNGLBINDBUFFERSRANGEPROC glad_debug_glBindBuffersRange;
+extern PFNGLBINDFRAGDATALOCATIONPROC glad_debug_glBindFragDataLocation;
+extern PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_debug_glBindFragDataLocationIndexed;
+extern PFNGLBINDFRAMEBUFFERPROC glad_debug_glBindFramebuffer;
+extern PFNGLBINDIMAGETEXTUREPROC glad_debug_glBindImageTexture;
+extern PFNGLBINDIMAGETEXTURESPROC glad_debug_glBindImageTextures;
+extern PFNGLBINDPROGRAMPIPELINEPROC glad_debug_glBindProgramPipeline;
+extern PFNGLBINDRENDERBUFFERPROC glad_debug_glBindRenderbuffer;
+extern PFNGLBINDSAMPLERPROC glad_debug_glBindSampler;
+extern PFNGLBINDSAMPLERSPROC glad_debug_glBindSamplers;
+extern PFNGLBINDTEXTUREPROC glad_debug_glBindTexture;
+extern PFNGLBINDTEXTUREUNITPROC glad_debug_glBindTextureUnit;
+extern PFNGLBINDTEXTURESPROC glad_debug_glBindTextures;
+extern PFNGLBINDTRANSFORMFEEDBACKPROC glad_debug_glBindTransformFeedback;
+extern PFNGLBINDVERTEXARRAYPROC glad_debug_glBindVertexArray;
+extern PFNGLBINDVERTEXBUFFERPROC glad_debug_glBindVertexBuffer;
+extern PFNGLBINDVERTEXBUFFERSPROC glad_debug_glBindVertexBuffers;
+extern PFNGLBITMAPPROC glad_debug_glBitmap;
+extern PFNGLBLENDCOLORPROC glad_debug_glBlendColor;
+extern PFNGLBLENDEQUATIONPROC glad_debug_glBlendEquation;
+extern PFNGLBLENDEQUATIONSEPARATEPROC glad_debug_glBlendEquationSeparate;
+extern PFNGLBLENDEQUATIONSEPARATEIPROC glad_debug_glBlendEquationSeparatei;
+extern PFNGLBLENDEQUATIONIPROC glad_debug_glBlendEquationi;
+extern PFNGLBLENDFUNCPROC glad_debug_glBlendFunc;
+extern PFNGLBLENDFUNCSEPARATEPROC glad_debug_glBlendFuncSeparate;
+extern PFNGLBLENDFUNCSEPARATEIPROC glad_debug_glBlendFuncSeparatei;
+extern PFNGLBLENDFUNCIPROC glad_debug_glBlendFunci;
+extern PFNGLBLITFRAMEBUFFERPROC glad_debug_glBlitFramebuffer;
+extern PFNGLBLITNAMEDFRAMEBUFFERPROC glad_debug_glBlitNamedFramebuffer;
+extern PFNGLBUFFERDATAPROC glad_debug_glBufferData;
+extern PFNGLBUFFERSTORAGEPROC glad_debug_glBufferStorage;
+extern PFNGLBUFFERSUBDATAPROC glad_debug_glBufferSubData;
+extern PFNGLCALLLISTPROC glad_debug_glCallList;
+extern PFNGLCALLLISTSPROC glad_debug_glCallLists;
+extern PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_debug_glCheckFramebufferStatus;
+extern PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC glad_debug_glCheckNamedFramebufferStatus;
+extern PFNGLCLAMPCOLORPROC glad_debug_glClampColor;
+extern PFNGLCLEARPROC glad_debug_glClear;
+extern PFNGLCLEARACCUMPROC glad_debug_glClearAccum;
+extern PFNGLCLEARBUFFERDATAPROC glad_debug_glClearBufferData;
+extern PFNGLCLEARBUFFERSUBDATAPROC glad_debug_glClearBufferSubData;
+extern PFNGLCLEARBUFFERFIPROC glad_debug_glClearBufferfi;
+extern PFNGLCLEARBUFFERFVPROC glad_debug_glClearBufferfv;
+extern PFNGLCLEARBUFFERIVPROC glad_debug_glClearBufferiv;
+extern PFNGLCLEARBUFFERUIVPROC glad_debug_glClearBufferuiv;
+extern PFNGLCLEARCOLORPROC glad_debug_glClearColor;
+extern PFNGLCLEARDEPTHPROC glad_debug_glClearDepth;
+extern PFNGLCLEARDEPTHFPROC glad_debug_glClearDepthf;
+extern PFNGLCLEARINDEXPROC glad_debug_glClearIndex;
+extern PFNGLCLEARNAMEDBUFFERDATAPROC glad_debug_glClearNamedBufferData;
+extern PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_debug_glClearNamedBufferSubData;
+extern PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_debug_glClearNamedFramebufferfi;
+extern PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_debug_glClearNamedFramebufferfv;
+extern PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_debug_glClearNamedFramebufferiv;
+extern PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_debug_glClearNamedFramebufferuiv;
+extern PFNGLCLEARSTENCILPROC glad_debug_glClearStencil;
+extern PFNGLCLEARTEXIMAGEPROC glad_debug_glClearTexImage;
+extern PFNGLCLEARTEXSUBIMAGEPROC glad_debug_glClearTexSubImage;
+extern PFNGLCLIENTACTIVETEXTUREPROC glad_debug_glClientActiveTexture;
+extern PFNGLCLIENTWAITSYNCPROC glad_debug_glClientWaitSync;
+extern PFNGLCLIPCONTROLPROC glad_debug_glClipControl;
+extern PFNGLCLIPPLANEPROC glad_debug_glClipPlane;
+extern PFNGLCOLOR3BPROC glad_debug_glColor3b;
+extern PFNGLCOLOR3BVPROC glad_debug_glColor3bv;
+extern PFNGLCOLOR3DPROC glad_debug_glColor3d;
+extern PFNGLCOLOR3DVPROC glad_debug_glColor3dv;
+extern PFNGLCOLOR3FPROC glad_debug_glColor3f;
+extern PFNGLCOLOR3FVPROC glad_debug_glColor3fv;
+extern PFNGLCOLOR3IPROC glad_debug_glColor3i;
+extern PFNGLCOLOR3IVPROC glad_debug_glColor3iv;
+extern PFNGLCOLOR3SPROC glad_debug_glColor3s;
+extern PFNGLCOLOR3SVPROC glad_debug_glColor3sv;
+extern PFNGLCOLOR3UBPROC glad_debug_glColor3ub;
+extern PFNGLCOLOR3UBVPROC glad_debug_glColor3ubv;
+extern PFNGLCOLOR3UIPROC glad_debug_glColor3ui;
+extern PFNGLCOLOR3UIVPROC glad_debug_glColor3uiv;
+extern PFNGLCOLOR3USPROC glad_debug_glColor3us;
+extern PFNGLCOLOR3USVPROC glad_debug_glColor3usv;
+extern PFNGLCOLOR4BPROC glad_debug_glColor4b;
+extern PFNGLCOLOR4BVPROC glad_debug_glColor4bv;
+extern PFNGLCOLOR4DPROC glad_debug_glColor4d;
+extern PFNGLCOLOR4DVPROC glad_debug_glColor4dv;
+extern PFNGLCOLOR4FPROC glad_debug_glColor4f;
+extern PFNGLCOLOR4FVPROC glad_debug_glColor4fv;
+extern PFNGLCOLOR4IPROC glad_debug_glColor4i;
+extern PFNGLCOLOR4IVPROC glad_debug_glColor4iv;
+extern PFNGLCOLOR4SPROC glad_debug_glColor4s;
+extern PFNGLCOLOR4SVPROC glad_debug_glColor4sv;
+extern PFNGLCOLOR4UBPROC glad_debug_glColor4ub;
+extern PFNGLCOLOR4UBVPROC glad_debug_glColor4ubv;
+extern PFNGLCOLOR4UIPROC glad_debug_glColor4ui;
+extern PFNGLCOLOR4UIVPROC glad_debug_glColor4uiv;
+extern PFNGLCOLOR4USPROC glad_debug_glColor4us;
+extern PFNGLCOLOR4USVPROC glad_debug_glColor4usv;
+extern PFNGLCOLORMASKPROC glad_debug_glColorMask;
+extern PFNGLCOLORMASKIPROC glad_debug_glColorMaski;
+extern PFNGLCOLORMATERIALPROC glad_debug_glColorMaterial;
+extern PFNGLCOLORP3UIPROC glad_debug_glColorP3ui;
+extern PFNGLCOLORP3UIVPROC glad_debug_glColorP3uiv;
+extern PFNGLCOLORP4UIPROC glad_debug_glColorP4ui;
+extern PFNGLCOLORP4UIVPROC glad_debug_glColorP4uiv;
+extern PFNGLCOLORPOINTERPROC glad_debug_glColorPointer;
+extern PFNGLCOMPILESHADERPROC glad_debug_glCompileShader;
+extern PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_debug_glCompressedTexImage1D;
+extern PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_debug_glCompressedTexImage2D;
+extern PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_debug_glCompressedTexImage3D;
+extern PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_debug_glCompressedTexSubImage1D;
+extern PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_debug_glCompressedTexSubImage2D;
+extern PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_debug_glCompressedTexSubImage3D;
+extern PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_debug_glCompressedTextureSubImage1D;
+extern PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_debug_glCompressedTextureSubImage2D;
+extern PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_debug_glCompressedTextureSubImage3D;
+extern PFNGLCOPYBUFFERSUBDATAPROC glad_debug_glCopyBufferSubData;
+extern PFNGLCOPYIMAGESUBDATAPROC glad_debug_glCopyImageSubData;
+extern PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_debug_glCopyNamedBufferSubData;
+extern PFNGLCOPYPIXELSPROC glad_debug_glCopyPixels;
+extern PFNGLCOPYTEXIMAGE1DPROC glad_debug_glCopyTexImage1D;
+extern PFNGLCOPYTEXIMAGE2DPROC glad_debug_glCopyTexImage2D;
+extern PFNGLCOPYTEXSUBIMAGE1DPROC glad_debug_glCopyTexSubImage1D;
+extern PFNGLCOPYTEXSUBIMAGE2DPROC glad_debug_glCopyTexSubImage2D;
+extern PFNGLCOPYTEXSUBIMAGE3DPROC glad_debug_glCopyTexSubImage3D;
+extern PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_debug_glCopyTextureSubImage1D;
+extern PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_debug_glCopyTextureSubImage2D;
+extern PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_debug_glCopyTextureSubImage3D;
+extern PFNGLCREATEBUFFERSPROC glad_debug_glCreateBuffers;
+extern PFNGLCREATEFRAMEBUFFERSPROC glad_debug_glCreateFramebuffers;
+extern PFNGLCREATEPROGRAMPROC glad_debug_glCreateProgram;
+extern PFNGLCREATEPROGRAMPIPELINESPROC glad_debug_glCreateProgramPipelines;
+extern PFNGLCREATEQUERIESPROC glad_debug_glCreateQueries;
+extern PFNGLCREATERENDERBUFFERSPROC glad_debug_glCreateRenderbuffers;
+extern PFNGLCREATESAMPLERSPROC glad_debug_glCreateSamplers;
+extern PFNGLCREATESHADERPROC glad_debug_glCreateShader;
+extern PFNGLCREATESHADERPROGRAMVPROC glad_debug_glCreateShaderProgramv;
+extern PFNGLCREATETEXTURESPROC glad_debug_glCreateTextures;
+extern PFNGLCREATETRANSFORMFEEDBACKSPROC glad_debug_glCreateTransformFeedbacks;
+extern PFNGLCREATEVERTEXARRAYSPROC glad_debug_glCreateVertexArrays;
+extern PFNGLCULLFACEPROC glad_debug_glCullFace;
+extern PFNGLDEBUGMESSAGECALLBACKPROC glad_debug_glDebugMessageCallback;
+extern PFNGLDEBUGMESSAGECONTROLPROC glad_debug_glDebugMessageControl;
+extern PFNGLDEBUGMESSAGEINSERTPROC glad_debug_glDebugMessageInsert;
+extern PFNGLDELETEBUFFERSPROC glad_debug_glDeleteBuffers;
+extern PFNGLDELETEFRAMEBUFFERSPROC glad_debug_glDeleteFramebuffers;
+extern PFNGLDELETELISTSPROC glad_debug_glDeleteLists;
+extern PFNGLDELETEPROGRAMPROC glad_debug_glDeleteProgram;
+extern PFNGLDELETEPROGRAMPIPELINESPROC glad_debug_glDeleteProgramPipelines;
+extern PFNGLDELETEQUERIESPROC glad_debug_glDeleteQueries;
+extern PFNGLDELETERENDERBUFFERSPROC glad_debug_glDeleteRenderbuffers;
+extern PFNGLDELETESAMPLERSPROC glad_debug_glDeleteSamplers;
+extern PFNGLDELETESHADERPROC glad_debug_glDeleteShader;
+extern PFNGLDELETESYNCPROC glad_debug_glDeleteSync;
+extern PFNGLDELETETEXTURESPROC glad_debug_glDeleteTextures;
+extern PFNGLDELETETRANSFORMFEEDBACKSPROC glad_debug_glDeleteTransformFeedbacks;
+extern PFNGLDELETEVERTEXARRAYSPROC glad_debug_glDeleteVertexArrays;
+extern PFNGLDEPTHFUNCPROC glad_debug_glDepthFunc;
+extern PFNGLDEPTHMASKPROC glad_debug_glDepthMask;
+extern PFNGLDEPTHRANGEPROC glad_debug_glDepthRange;
+extern PFNGLDEPTHRANGEARRAYVPROC glad_debug_glDepthRangeArrayv;
+extern PFNGLDEPTHRANGEINDEXEDPROC glad_debug_glDepthRangeIndexed;
+extern PFNGLDEPTHRANGEFPROC glad_debug_glDepthRangef;
+extern PFNGLDETACHSHADERPROC glad_debug_glDetachShader;
+extern PFNGLDISABLEPROC glad_debug_glDisable;
+extern PFNGLDISABLECLIENTSTATEPROC glad_debug_glDisableClientState;
+extern PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_debug_glDisableVertexArrayAttrib;
+extern PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_debug_glDisableVertexAttribArray;
+extern PFNGLDISABLEIPROC glad_debug_glDisablei;
+extern PFNGLDISPATCHCOMPUTEPROC glad_debug_glDispatchCompute;
+extern PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_debug_glDispatchComputeIndirect;
+extern PFNGLDRAWARRAYSPROC glad_debug_glDrawArrays;
+extern PFNGLDRAWARRAYSINDIRECTPROC glad_debug_glDrawArraysIndirect;
+extern PFNGLDRAWARRAYSINSTANCEDPROC glad_debug_glDrawArraysInstanced;
+extern PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_debug_glDrawArraysInstancedBaseInstance;
+extern PFNGLDRAWBUFFERPROC glad_debug_glDrawBuffer;
+extern PFNGLDRAWBUFFERSPROC glad_debug_glDrawBuffers;
+extern PFNGLDRAWELEMENTSPROC glad_debug_glDrawElements;
+extern PFNGLDRAWELEMENTSBASEVERTEXPROC glad_debug_glDrawElementsBaseVertex;
+extern PFNGLDRAWELEMENTSINDIRECTPROC glad_debug_glDrawElementsIndirect;
+extern PFNGLDRAWELEMENTSINSTANCEDPROC glad_debug_glDrawElementsInstanced;
+extern PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_debug_glDrawElementsInstancedBaseInstance;
+extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_debug_glDrawElementsInstancedBaseVertex;
+extern PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_debug_glDrawElementsInstancedBaseVertexBaseInstance;
+extern PFNGLDRAWPIXELSPROC glad_debug_glDrawPixels;
+extern PFNGLDRAWRANGEELEMENTSPROC glad_debug_glDrawRangeElements;
+extern PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_debug_glDrawRangeElementsBaseVertex;
+extern PFNGLDRAWTRANSFORMFEEDBACKPROC glad_debug_glDrawTransformFeedback;
+extern PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_debug_glDrawTransformFeedbackInstanced;
+extern PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_debug_glDrawTransformFeedbackStream;
+extern PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_debug_glDrawTransformFeedbackStreamInstanced;
+extern PFNGLEDGEFLAGPROC glad_debug_glEdgeFlag;
+extern PFNGLEDGEFLAGPOINTERPROC glad_debug_glEdgeFlagPointer;
+extern PFNGLEDGEFLAGVPROC glad_debug_glEdgeFlagv;
+extern PFNGLENABLEPROC glad_debug_glEnable;
+extern PFNGLENABLECLIENTSTATEPROC glad_debug_glEnableClientState;
+extern PFNGLENABLEVERTEXARRAYATTRIBPROC glad_debug_glEnableVertexArrayAttrib;
+extern PFNGLENABLEVERTEXATTRIBARRAYPROC glad_debug_glEnableVertexAttribArray;
+extern PFNGLENABLEIPROC glad_debug_glEnablei;
+extern PFNGLENDPROC glad_debug_glEnd;
+extern PFNGLENDCONDITIONALRENDERPROC glad_debug_glEndConditionalRender;
+extern PFNGLENDLISTPROC glad_debug_glEndList;
+extern PFNGLENDQUERYPROC glad_debug_glEndQuery;
+extern PFNGLENDQUERYINDEXEDPROC glad_debug_glEndQueryIndexed;
+extern PFNGLENDTRANSFORMFEEDBACKPROC glad_debug_glEndTransformFeedback;
+extern PFNGLEVALCOORD1DPROC glad_debug_glEvalCoord1d;
+extern PFNGLEVALCOORD1DVPROC glad_debug_glEvalCoord1dv;
+extern PFNGLEVALCOORD1FPROC glad_debug_glEvalCoord1f;
+extern PFNGLEVALCOORD1FVPROC glad_debug_glEvalCoord1fv;
+extern PFNGLEVALCOORD2DPROC glad_debug_glEvalCoord2d;
+extern PFNGLEVALCOORD2DVPROC glad_debug_glEvalCoord2dv;
+extern PFNGLEVALCOORD2FPROC glad_debug_glEvalCoord2f;
+extern PFNGLEVALCOORD2FVPROC glad_debug_glEvalCoord2fv;
+extern PFNGLEVALMESH1PROC glad_debug_glEvalMesh1;
+extern PFNGLEVALMESH2PROC glad_debug_glEvalMesh2;
+extern PFNGLEVALPOINT1PROC glad_debug_glEvalPoint1;
+extern PFNGLEVALPOINT2PROC glad_debug_glEvalPoint2;
+extern PFNGLFEEDBACKBUFFERPROC glad_debug_glFeedbackBuffer;
+extern PFNGLFENCESYNCPROC glad_debug_glFenceSync;
+extern PFNGLFINISHPROC glad_debug_glFinish;
+extern PFNGLFLUSHPROC glad_debug_glFlush;
+extern PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_debug_glFlushMappedBufferRange;
+extern PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_debug_glFlushMappedNamedBufferRange;
+extern PFNGLFOGCOORDPOINTERPROC glad_debug_glFogCoordPointer;
+extern PFNGLFOGCOORDDPROC glad_debug_glFogCoordd;
+extern PFNGLFOGCOORDDVPROC glad_debug_glFogCoorddv;
+extern PFNGLFOGCOORDFPROC glad_debug_glFogCoordf;
+extern PFNGLFOGCOORDFVPROC glad_debug_glFogCoordfv;
+extern PFNGLFOGFPROC glad_debug_glFogf;
+extern PFNGLFOGFVPROC glad_debug_glFogfv;
+extern PFNGLFOGIPROC glad_debug_glFogi;
+extern PFNGLFOGIVPROC glad_debug_glFogiv;
+extern PFNGLFRAMEBUFFERPARAMETERIPROC glad_debug_glFramebufferParameteri;
+extern PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_debug_glFramebufferRenderbuffer;
+extern PFNGLFRAMEBUFFERTEXTUREPROC glad_debug_glFramebufferTexture;
+extern PFNGLFRAMEBUFFERTEXTURE1DPROC glad_debug_glFramebufferTexture1D;
+extern PFNGLFRAMEBUFFERTEXTURE2DPROC glad_debug_glFramebufferTexture2D;
+extern PFNGLFRAMEBUFFERTEXTURE3DPROC glad_debug_glFramebufferTexture3D;
+extern PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_debug_glFramebufferTextureLayer;
+extern PFNGLFRONTFACEPROC glad_debug_glFrontFace;
+extern PFNGLFRUSTUMPROC glad_debug_glFrustum;
+extern PFNGLGENBUFFERSPROC glad_debug_glGenBuffers;
+extern PFNGLGENFRAMEBUFFERSPROC glad_debug_glGenFramebuffers;
+extern PFNGLGENLISTSPROC glad_debug_glGenLists;
+extern PFNGLGENPROGRAMPIPELINESPROC glad_debug_glGenProgramPipelines;
+extern PFNGLGENQUERIESPROC glad_debug_glGenQueries;
+extern PFNGLGENRENDERBUFFERSPROC glad_debug_glGenRenderbuffers;
+extern PFNGLGENSAMPLERSPROC glad_debug_glGenSamplers;
+extern PFNGLGENTEXTURESPROC glad_debug_glGenTextures;
+extern PFNGLGENTRANSFORMFEEDBACKSPROC glad_debug_glGenTransformFeedbacks;
+extern PFNGLGENVERTEXARRAYSPROC glad_debug_glGenVertexArrays;
+extern PFNGLGENERATEMIPMAPPROC glad_debug_glGenerateMipmap;
+extern PFNGLGENERATETEXTUREMIPMAPPROC glad_debug_glGenerateTextureMipmap;
+extern PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_debug_glGetActiveAtomicCounterBufferiv;
+extern PFNGLGETACTIVEATTRIBPROC glad_debug_glGetActiveAttrib;
+extern PFNGLGETACTIVESUBROUTINENAMEPROC glad_debug_glGetActiveSubroutineName;
+extern PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_debug_glGetActiveSubroutineUniformName;
+extern PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_debug_glGetActiveSubroutineUniformiv;
+extern PFNGLGETACTIVEUNIFORMPROC glad_debug_glGetActiveUniform;
+extern PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_debug_glGetActiveUniformBlockName;
+extern PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_debug_glGetActiveUniformBlockiv;
+extern PFNGLGETACTIVEUNIFORMNAMEPROC glad_debug_glGetActiveUniformName;
+extern PFNGLGETACTIVEUNIFORMSIVPROC glad_debug_glGetActiveUniformsiv;
+extern PFNGLGETATTACHEDSHADERSPROC glad_debug_glGetAttachedShaders;
+extern PFNGLGETATTRIBLOCATIONPROC glad_debug_glGetAttribLocation;
+extern PFNGLGETBOOLEANI_VPROC glad_debug_glGetBooleani_v;
+extern PFNGLGETBOOLEANVPROC glad_debug_glGetBooleanv;
+extern PFNGLGETBUFFERPARAMETERI64VPROC glad_debug_glGetBufferParameteri64v;
+extern PFNGLGETBUFFERPARAMETERIVPROC glad_debug_glGetBufferParameteriv;
+extern PFNGLGETBUFFERPOINTERVPROC glad_debug_glGetBufferPointerv;
+extern PFNGLGETBUFFERSUBDATAPROC glad_debug_glGetBufferSubData;
+extern PFNGLGETCLIPPLANEPROC glad_debug_glGetClipPlane;
+extern PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_debug_glGetCompressedTexImage;
+extern PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC glad_debug_glGetCompressedTextureImage;
+extern PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC glad_debug_glGetCompressedTextureSubImage;
+extern PFNGLGETDEBUGMESSAGELOGPROC glad_debug_glGetDebugMessageLog;
+extern PFNGLGETDOUBLEI_VPROC glad_debug_glGetDoublei_v;
+extern PFNGLGETDOUBLEVPROC glad_debug_glGetDoublev;
+extern PFNGLGETERRORPROC glad_debug_glGetError;
+extern PFNGLGETFLOATI_VPROC glad_debug_glGetFloati_v;
+extern PFNGLGETFLOATVPROC glad_debug_glGetFloatv;
+extern PFNGLGETFRAGDATAINDEXPROC glad_debug_glGetFragDataIndex;
+extern PFNGLGETFRAGDATALOCATIONPROC glad_debug_glGetFragDataLocation;
+extern PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_debug_glGetFramebufferAttachmentParameteriv;
+extern PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_debug_glGetFramebufferParameteriv;
+extern PFNGLGETGRAPHICSRESETSTATUSPROC glad_debug_glGetGraphicsResetStatus;
+extern PFNGLGETIMAGEHANDLEARBPROC glad_debug_glGetImageHandleARB;
+extern PFNGLGETINTEGER64I_VPROC glad_debug_glGetInteger64i_v;
+extern PFNGLGETINTEGER64VPROC glad_debug_glGetInteger64v;
+extern PFNGLGETINTEGERI_VPROC glad_debug_glGetIntegeri_v;
+extern PFNGLGETINTEGERVPROC glad_debug_glGetIntegerv;
+extern PFNGLGETINTERNALFORMATI64VPROC glad_debug_glGetInternalformati64v;
+extern PFNGLGETINTERNALFORMATIVPROC glad_debug_glGetInternalformativ;
+extern PFNGLGETLIGHTFVPROC glad_debug_glGetLightfv;
+extern PFNGLGETLIGHTIVPROC glad_debug_glGetLightiv;
+extern PFNGLGETMAPDVPROC glad_debug_glGetMapdv;
+extern PFNGLGETMAPFVPROC glad_debug_glGetMapfv;
+extern PFNGLGETMAPIVPROC glad_debug_glGetMapiv;
+extern PFNGLGETMATERIALFVPROC glad_debug_glGetMaterialfv;
+extern PFNGLGETMATERIALIVPROC glad_debug_glGetMaterialiv;
+extern PFNGLGETMULTISAMPLEFVPROC glad_debug_glGetMultisamplefv;
+extern PFNGLGETNAMEDBUFFERPARAMETERI64VPROC glad_debug_glGetNamedBufferParameteri64v;
+extern PFNGLGETNAMEDBUFFERPARAMETERIVPROC glad_debug_glGetNamedBufferParameteriv;
+extern PFNGLGETNAMEDBUFFERPOINTERVPROC glad_debug_glGetNamedBufferPointerv;
+extern PFNGLGETNAMEDBUFFERSUBDATAPROC glad_debug_glGetNamedBufferSubData;
+extern PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_debug_glGetNamedFramebufferAttachmentParameteriv;
+extern PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC glad_debug_glGetNamedFramebufferParameteriv;
+extern PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC glad_debug_glGetNamedRenderbufferParameteriv;
+extern PFNGLGETOBJECTLABELPROC glad_debug_glGetObjectLabel;
+extern PFNGLGETOBJECTPTRLABELPROC glad_debug_glGetObjectPtrLabel;
+extern PFNGLGETPIXELMAPFVPROC glad_debug_glGetPixelMapfv;
+extern PFNGLGETPIXELMAPUIVPROC glad_debug_glGetPixelMapuiv;
+extern PFNGLGETPIXELMAPUSVPROC glad_debug_glGetPixelMapusv;
+extern PFNGLGETPOINTERVPROC glad_debug_glGetPointerv;
+extern PFNGLGETPOLYGONSTIPPLEPROC glad_debug_glGetPolygonStipple;
+extern PFNGLGETPROGRAMBINARYPROC glad_debug_glGetProgramBinary;
+extern PFNGLGETPROGRAMINFOLOGPROC glad_debug_glGetProgramInfoLog;
+extern PFNGLGETPROGRAMINTERFACEIVPROC glad_debug_glGetProgramInterfaceiv;
+extern PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_debug_glGetProgramPipelineInfoLog;
+extern PFNGLGETPROGRAMPIPELINEIVPROC glad_debug_glGetProgramPipelineiv;
+extern PFNGLGETPROGRAMRESOURCEINDEXPROC glad_debug_glGetProgramResourceIndex;
+extern PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_debug_glGetProgramResourceLocation;
+extern PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_debug_glGetProgramResourceLocationIndex;
+extern PFNGLGETPROGRAMRESOURCENAMEPROC glad_debug_glGetProgramResourceName;
+extern PFNGLGETPROGRAMRESOURCEIVPROC glad_debug_glGetProgramResourceiv;
+extern PFNGLGETPROGRAMSTAGEIVPROC glad_debug_glGetProgramStageiv;
+extern PFNGLGETPROGRAMIVPROC glad_debug_glGetProgramiv;
+extern PFNGLGETQUERYBUFFEROBJECTI64VPROC glad_debug_glGetQueryBufferObjecti64v;
+extern PFNGLGETQUERYBUFFEROBJECTIVPROC glad_debug_glGetQueryBufferObjectiv;
+extern PFNGLGETQUERYBUFFEROBJECTUI64VPROC glad_debug_glGetQueryBufferObjectui64v;
+extern PFNGLGETQUERYBUFFEROBJECTUIVPROC glad_debug_glGetQueryBufferObjectuiv;
+extern PFNGLGETQUERYINDEXEDIVPROC glad_debug_glGetQueryIndexediv;
+extern PFNGLGETQUERYOBJECTI64VPROC glad_debug_glGetQueryObjecti64v;
+extern PFNGLGETQUERYOBJECTIVPROC glad_debug_glGetQueryObjectiv;
+extern PFNGLGETQUERYOBJECTUI64VPROC glad_debug_glGetQueryObjectui64v;
+extern PFNGLGETQUERYOBJECTUIVPROC glad_debug_glGetQueryObjectuiv;
+extern PFNGLGETQUERYIVPROC glad_debug_glGetQueryiv;
+extern PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_debug_glGetRenderbufferParameteriv;
+extern PFNGLGETSAMPLERPARAMETERIIVPROC glad_debug_glGetSamplerParameterIiv;
+extern PFNGLGETSAMPLERPARAMETERIUIVPROC glad_debug_glGetSamplerParameterIuiv;
+extern PFNGLGETSAMPLERPARAMETERFVPROC glad_debug_glGetSamplerParameterfv;
+extern PFNGLGETSAMPLERPARAMETERIVPROC glad_debug_glGetSamplerParameteriv;
+extern PFNGLGETSHADERINFOLOGPROC glad_debug_glGetShaderInfoLog;
+extern PFNGLGETSHADERPRECISIONFORMATPROC glad_debug_glGetShaderPrecisionFormat;
+extern PFNGLGETSHADERSOURCEPROC glad_debug_glGetShaderSource;
+extern PFNGLGETSHADERIVPROC glad_debug_glGetShaderiv;
+extern PFNGLGETSTRINGPROC glad_debug_glGetString;
+extern PFNGLGETSTRINGIPROC glad_debug_glGetStringi;
+extern PFNGLGETSUBROUTINEINDEXPROC glad_debug_glGetSubroutineIndex;
+extern PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_debug_glGetSubroutineUniformLocation;
+extern PFNGLGETSYNCIVPROC glad_debug_glGetSynciv;
+extern PFNGLGETTEXENVFVPROC glad_debug_glGetTexEnvfv;
+extern PFNGLGETTEXENVIVPROC glad_debug_glGetTexEnviv;
+extern PFNGLGETTEXGENDVPROC glad_debug_glGetTexGendv;
+extern PFNGLGETTEXGENFVPROC glad_debug_glGetTexGenfv;
+extern PFNGLGETTEXGENIVPROC glad_debug_glGetTexGeniv;
+extern PFNGLGETTEXIMAGEPROC glad_debug_glGetTexImage;
+extern PFNGLGETTEXLEVELPARAMETERFVPROC glad_debug_glGetTexLevelParameterfv;
+extern PFNGLGETTEXLEVELPARAMETERIVPROC glad_debug_glGetTexLevelParameteriv;
+extern PFNGLGETTEXPARAMETERIIVPROC glad_debug_glGetTexParameterIiv;
+extern PFNGLGETTEXPARAMETERIUIVPROC glad_debug_glGetTexParameterIuiv;
+extern PFNGLGETTEXPARAMETERFVPROC glad_debug_glGetTexParameterfv;
+extern PFNGLGETTEXPARAMETERIVPROC glad_debug_glGetTexParameteriv;
+extern PFNGLGETTEXTUREHANDLEARBPROC glad_debug_glGetTextureHandleARB;
+extern PFNGLGETTEXTUREIMAGEPROC glad_debug_glGetTextureImage;
+extern PFNGLGETTEXTURELEVELPARAMETERFVPROC glad_debug_glGetTextureLevelParameterfv;
+extern PFNGLGETTEXTURELEVELPARAMETERIVPROC glad_debug_glGetTextureLevelParameteriv;
+extern PFNGLGETTEXTUREPARAMETERIIVPROC glad_debug_glGetTextureParameterIiv;
+extern PFNGLGETTEXTUREPARAMETERIUIVPROC glad_debug_glGetTextureParameterIuiv;
+extern PFNGLGETTEXTUREPARAMETERFVPROC glad_debug_glGetTextureParameterfv;
+extern PFNGLGETTEXTUREPARAMETERIVPROC glad_debug_glGetTextureParameteriv;
+extern PFNGLGETTEXTURESAMPLERHANDLEARBPROC glad_debug_glGetTextureSamplerHandleARB;
+extern PFNGLGETTEXTURESUBIMAGEPROC glad_debug_glGetTextureSubImage;
+extern PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_debug_glGetTransformFeedbackVarying;
+extern PFNGLGETTRANSFORMFEEDBACKI64_VPROC glad_debug_glGetTransformFeedbacki64_v;
+extern PFNGLGETTRANSFORMFEEDBACKI_VPROC glad_debug_glGetTransformFeedbacki_v;
+extern PFNGLGETTRANSFORMFEEDBACKIVPROC glad_debug_glGetTransformFeedbackiv;
+extern PFNGLGETUNIFORMBLOCKINDEXPROC glad_debug_glGetUniformBlockIndex;
+extern PFNGLGETUNIFORMINDICESPROC glad_debug_glGetUniformIndices;
+extern PFNGLGETUNIFORMLOCATIONPROC glad_debug_glGetUniformLocation;
+extern PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_debug_glGetUniformSubroutineuiv;
+extern PFNGLGETUNIFORMDVPROC glad_debug_glGetUniformdv;
+extern PFNGLGETUNIFORMFVPROC glad_debug_glGetUniformfv;
+extern PFNGLGETUNIFORMIVPROC glad_debug_glGetUniformiv;
+extern PFNGLGETUNIFORMUIVPROC glad_debug_glGetUniformuiv;
+extern PFNGLGETVERTEXARRAYINDEXED64IVPROC glad_debug_glGetVertexArrayIndexed64iv;
+extern PFNGLGETVERTEXARRAYINDEXEDIVPROC glad_debug_glGetVertexArrayIndexediv;
+extern PFNGLGETVERTEXARRAYIVPROC glad_debug_glGetVertexArrayiv;
+extern PFNGLGETVERTEXATTRIBIIVPROC glad_debug_glGetVertexAttribIiv;
+extern PFNGLGETVERTEXATTRIBIUIVPROC glad_debug_glGetVertexAttribIuiv;
+extern PFNGLGETVERTEXATTRIBLDVPROC glad_debug_glGetVertexAttribLdv;
+extern PFNGLGETVERTEXATTRIBLUI64VARBPROC glad_debug_glGetVertexAttribLui64vARB;
+extern PFNGLGETVERTEXATTRIBPOINTERVPROC glad_debug_glGetVertexAttribPointerv;
+extern PFNGLGETVERTEXATTRIBDVPROC glad_debug_glGetVertexAttribdv;
+extern PFNGLGETVERTEXATTRIBFVPROC glad_debug_glGetVertexAttribfv;
+extern PFNGLGETVERTEXATTRIBIVPROC glad_debug_glGetVertexAttribiv;
+extern PFNGLGETNCOLORTABLEPROC glad_debug_glGetnColorTable;
+extern PFNGLGETNCOMPRESSEDTEXIMAGEPROC glad_debug_glGetnCompressedTexImage;
+extern PFNGLGETNCONVOLUTIONFILTERPROC glad_debug_glGetnConvolutionFilter;
+extern PFNGLGETNHISTOGRAMPROC glad_debug_glGetnHistogram;
+extern PFNGLGETNMAPDVPROC glad_debug_glGetnMapdv;
+extern PFNGLGETNMAPFVPROC glad_debug_glGetnMapfv;
+extern PFNGLGETNMAPIVPROC glad_debug_glGetnMapiv;
+extern PFNGLGETNMINMAXPROC glad_debug_glGetnMinmax;
+extern PFNGLGETNPIXELMAPFVPROC glad_debug_glGetnPixelMapfv;
+extern PFNGLGETNPIXELMAPUIVPROC glad_debug_glGetnPixelMapuiv;
+extern PFNGLGETNPIXELMAPUSVPROC glad_debug_glGetnPixelMapusv;
+extern PFNGLGETNPOLYGONSTIPPLEPROC glad_debug_glGetnPolygonStipple;
+extern PFNGLGETNSEPARABLEFILTERPROC glad_debug_glGetnSeparableFilter;
+extern PFNGLGETNTEXIMAGEPROC glad_debug_glGetnTexImage;
+extern PFNGLGETNUNIFORMDVPROC glad_debug_glGetnUniformdv;
+extern PFNGLGETNUNIFORMFVPROC glad_debug_glGetnUniformfv;
+extern PFNGLGETNUNIFORMIVPROC glad_debug_glGetnUniformiv;
+extern PFNGLGETNUNIFORMUIVPROC glad_debug_glGetnUniformuiv;
+extern PFNGLHINTPROC glad_debug_glHint;
+extern PFNGLINDEXMASKPROC glad_debug_glIndexMask;
+extern PFNGLINDEXPOINTERPROC glad_debug_glIndexPointer;
+extern PFNGLINDEXDPROC glad_debug_glIndexd;
+extern PFNGLINDEXDVPROC glad_debug_glIndexdv;
+extern PFNGLINDEXFPROC glad_debug_glIndexf;
+extern PFNGLINDEXFVPROC glad_debug_glIndexfv;
+extern PFNGLINDEXIPROC glad_debug_glIndexi;
+extern PFNGLINDEXIVPROC glad_debug_glIndexiv;
+extern PFNGLINDEXSPROC glad_debug_glIndexs;
+extern PFNGLINDEXSVPROC glad_debug_glIndexsv;
+extern PFNGLINDEXUBPROC glad_debug_glIndexub;
+extern PFNGLINDEXUBVPROC glad_debug_glIndexubv;
+extern PFNGLINITNAMESPROC glad_debug_glInitNames;
+extern PFNGLINTERLEAVEDARRAYSPROC glad_debug_glInterleavedArrays;
+extern PFNGLINVALIDATEBUFFERDATAPROC glad_debug_glInvalidateBufferData;
+extern PFNGLINVALIDATEBUFFERSUBDATAPROC glad_debug_glInvalidateBufferSubData;
+extern PFNGLINVALIDATEFRAMEBUFFERPROC glad_debug_glInvalidateFramebuffer;
+extern PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_debug_glInvalidateNamedFramebufferData;
+extern PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_debug_glInvalidateNamedFramebufferSubData;
+extern PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_debug_glInvalidateSubFramebuffer;
+extern PFNGLINVALIDATETEXIMAGEPROC glad_debug_glInvalidateTexImage;
+extern PFNGLINVALIDATETEXSUBIMAGEPROC glad_debug_glInvalidateTexSubImage;
+extern PFNGLISBUFFERPROC glad_debug_glIsBuffer;
+extern PFNGLISENABLEDPROC glad_debug_glIsEnabled;
+extern PFNGLISENABLEDIPROC glad_debug_glIsEnabledi;
+extern PFNGLISFRAMEBUFFERPROC glad_debug_glIsFramebuffer;
+extern PFNGLISIMAGEHANDLERESIDENTARBPROC glad_debug_glIsImageHandleResidentARB;
+extern PFNGLISLISTPROC glad_debug_glIsList;
+extern PFNGLISPROGRAMPROC glad_debug_glIsProgram;
+extern PFNGLISPROGRAMPIPELINEPROC glad_debug_glIsProgramPipeline;
+extern PFNGLISQUERYPROC glad_debug_glIsQuery;
+extern PFNGLISRENDERBUFFERPROC glad_debug_glIsRenderbuffer;
+extern PFNGLISSAMPLERPROC glad_debug_glIsSampler;
+extern PFNGLISSHADERPROC glad_debug_glIsShader;
+extern PFNGLISSYNCPROC glad_debug_glIsSync;
+extern PFNGLISTEXTUREPROC glad_debug_glIsTexture;
+extern PFNGLISTEXTUREHANDLERESIDENTARBPROC glad_debug_glIsTextureHandleResidentARB;
+extern PFNGLISTRANSFORMFEEDBACKPROC glad_debug_glIsTransformFeedback;
+extern PFNGLISVERTEXARRAYPROC glad_debug_glIsVertexArray;
+extern PFNGLLIGHTMODELFPROC glad_debug_glLightModelf;
+extern PFNGLLIGHTMODELFVPROC glad_debug_glLightModelfv;
+extern PFNGLLIGHTMODELIPROC glad_debug_glLightModeli;
+extern PFNGLLIGHTMODELIVPROC glad_debug_glLightModeliv;
+extern PFNGLLIGHTFPROC glad_debug_glLightf;
+extern PFNGLLIGHTFVPROC glad_debug_glLightfv;
+extern PFNGLLIGHTIPROC glad_debug_glLighti;
+extern PFNGLLIGHTIVPROC glad_debug_glLightiv;
+extern PFNGLLINESTIPPLEPROC glad_debug_glLineStipple;
+extern PFNGLLINEWIDTHPROC glad_debug_glLineWidth;
+extern PFNGLLINKPROGRAMPROC glad_debug_glLinkProgram;
+extern PFNGLLISTBASEPROC glad_debug_glListBase;
+extern PFNGLLOADIDENTITYPROC glad_debug_glLoadIdentity;
+extern PFNGLLOADMATRIXDPROC glad_debug_glLoadMatrixd;
+extern PFNGLLOADMATRIXFPROC glad_debug_glLoadMatrixf;
+extern PFNGLLOADNAMEPROC glad_debug_glLoadName;
+extern PFNGLLOADTRANSPOSEMATRIXDPROC glad_debug_glLoadTransposeMatrixd;
+extern PFNGLLOADTRANSPOSEMATRIXFPROC glad_debug_glLoadTransposeMatrixf;
+extern PFNGLLOGICOPPROC glad_debug_glLogicOp;
+extern PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC glad_debug_glMakeImageHandleNonResidentARB;
+extern PFNGLMAKEIMAGEHANDLERESIDENTARBPROC glad_debug_glMakeImageHandleResidentARB;
+extern PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC glad_debug_glMakeTextureHandleNonResidentARB;
+extern PFNGLMAKETEXTUREHANDLERESIDENTARBPROC glad_debug_glMakeTextureHandleResidentARB;
+extern PFNGLMAP1DPROC glad_debug_glMap1d;
+extern PFNGLMAP1FPROC glad_debug_glMap1f;
+extern PFNGLMAP2DPROC glad_debug_glMap2d;
+extern PFNGLMAP2FPROC glad_debug_glMap2f;
+extern PFNGLMAPBUFFERPROC glad_debug_glMapBuffer;
+extern PFNGLMAPBUFFERRANGEPROC glad_debug_glMapBufferRange;
+extern PFNGLMAPGRID1DPROC glad_debug_glMapGrid1d;
+extern PFNGLMAPGRID1FPROC glad_debug_glMapGrid1f;
+extern PFNGLMAPGRID2DPROC glad_debug_glMapGrid2d;
+extern PFNGLMAPGRID2FPROC glad_debug_glMapGrid2f;
+extern PFNGLMAPNAMEDBUFFERPROC glad_debug_glMapNamedBuffer;
+extern PFNGLMAPNAMEDBUFFERRANGEPROC glad_debug_glMapNamedBufferRange;
+extern PFNGLMATERIALFPROC glad_debug_glMaterialf;
+extern PFNGLMATERIALFVPROC glad_debug_glMaterialfv;
+extern PFNGLMATERIALIPROC glad_debug_glMateriali;
+extern PFNGLMATERIALIVPROC glad_debug_glMaterialiv;
+extern PFNGLMATRIXMODEPROC glad_debug_glMatrixMode;
+extern PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_debug_glMaxShaderCompilerThreadsKHR;
+extern PFNGLMEMORYBARRIERPROC glad_debug_glMemoryBarrier;
+extern PFNGLMEMORYBARRIERBYREGIONPROC glad_debug_glMemoryBarrierByRegion;
+extern PFNGLMINSAMPLESHADINGPROC glad_debug_glMinSampleShading;
+extern PFNGLMULTMATRIXDPROC glad_debug_glMultMatrixd;
+extern PFNGLMULTMATRIXFPROC glad_debug_glMultMatrixf;
+extern PFNGLMULTTRANSPOSEMATRIXDPROC glad_debug_glMultTransposeMatrixd;
+extern PFNGLMULTTRANSPOSEMATRIXFPROC glad_debug_glMultTransposeMatrixf;
+extern PFNGLMULTIDRAWARRAYSPROC glad_debug_glMultiDrawArrays;
+extern PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_debug_glMultiDrawArraysIndirect;
+extern PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC glad_debug_glMultiDrawArraysIndirectCount;
+extern PFNGLMULTIDRAWELEMENTSPROC glad_debug_glMultiDrawElements;
+extern PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_debug_glMultiDrawElementsBaseVertex;
+extern PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_debug_glMultiDrawElementsIndirect;
+extern PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC glad_debug_glMultiDrawElementsIndirectCount;
+extern PFNGLMULTITEXCOORD1DPROC glad_debug_glMultiTexCoord1d;
+extern PFNGLMULTITEXCOORD1DVPROC glad_debug_glMultiTexCoord1dv;
+extern PFNGLMULTITEXCOORD1FPROC glad_debug_glMultiTexCoord1f;
+extern PFNGLMULTITEXCOORD1FVPROC glad_debug_glMultiTexCoord1fv;
+extern PFNGLMULTITEXCOORD1IPROC glad_debug_glMultiTexCoord1i;
+extern PFNGLMULTITEXCOORD1IVPROC glad_debug_glMultiTexCoord1iv;
+extern PFNGLMULTITEXCOORD1SPROC glad_debug_glMultiTexCoord1s;
+extern PFNGLMULTITEXCOORD1SVPROC glad_debug_glMultiTexCoord1sv;
+extern PFNGLMULTITEXCOORD2DPROC glad_debug_glMultiTexCoord2d;
+extern PFNGLMULTITEXCOORD2DVPROC glad_debug_glMultiTexCoord2dv;
+extern PFNGLMULTITEXCOORD2FPROC glad_debug_glMultiTexCoord2f;
+extern PFNGLMULTITEXCOORD2FVPROC glad_debug_glMultiTexCoord2fv;
+extern PFNGLMULTITEXCOORD2IPROC glad_debug_glMultiTexCoord2i;
+extern PFNGLMULTITEXCOORD2IVPROC glad_debug_glMultiTexCoord2iv;
+extern PFNGLMULTITEXCOORD2SPROC glad_debug_glMultiTexCoord2s;
+extern PFNGLMULTITEXCOORD2SVPROC glad_debug_glMultiTexCoord2sv;
+extern PFNGLMULTITEXCOORD3DPROC glad_debug_glMultiTexCoord3d;
+extern PFNGLMULTITEXCOORD3DVPROC glad_debug_glMultiTexCoord3dv;
+extern PFNGLMULTITEXCOORD3FPROC glad_debug_glMultiTexCoord3f;
+extern PFNGLMULTITEXCOORD3FVPROC glad_debug_glMultiTexCoord3fv;
+extern PFNGLMULTITEXCOORD3IPROC glad_debug_glMultiTexCoord3i;
+extern PFNGLMULTITEXCOORD3IVPROC glad_debug_glMultiTexCoord3iv;
+extern PFNGLMULTITEXCOORD3SPROC glad_debug_glMultiTexCoord3s;
+extern PFNGLMULTITEXCOORD3SVPROC glad_debug_glMultiTexCoord3sv;
+extern PFNGLMULTITEXCOORD4DPROC glad_debug_glMultiTexCoord4d;
+extern PFNGLMULTITEXCOORD4DVPROC glad_debug_glMultiTexCoord4dv;
+extern PFNGLMULTITEXCOORD4FPROC glad_debug_glMultiTexCoord4f;
+extern PFNGLMULTITEXCOORD4FVPROC glad_debug_glMultiTexCoord4fv;
+extern PFNGLMULTITEXCOORD4IPROC glad_debug_glMultiTexCoord4i;
+extern PFNGLMULTITEXCOORD4IVPROC glad_debug_glMultiTexCoord4iv;
+extern PFNGLMULTITEXCOORD4SPROC glad_debug_glMultiTexCoord4s;
+extern PFNGLMULTITEXCOORD4SVPROC glad_debug_glMultiTexCoord4sv;
+extern PFNGLMULTITEXCOORDP1UIPROC glad_debug_glMultiTexCoordP1ui;
+extern PFNGLMULTITEXCOORDP1UIVPROC glad_debug_glMultiTexCoordP1uiv;
+extern PFNGLMULTITEXCOORDP2UIPROC glad_debug_glMultiTexCoordP2ui;
+extern PFNGLMULTITEXCOORDP2UIVPROC glad_debug_glMultiTexCoordP2uiv;
+extern PFNGLMULTITEXCOORDP3UIPROC glad_debug_glMultiTexCoordP3ui;
+extern PFNGLMULTITEXCOORDP3UIVPROC glad_debug_glMultiTexCoordP3uiv;
+extern PFNGLMULTITEXCOORDP4UIPROC glad_debug_glMultiTexCoordP4ui;
+extern PFNGLMULTITEXCOORDP4UIVPROC glad_debug_glMultiTexCoordP4uiv;
+extern PFNGLNAMEDBUFFERDATAPROC glad_debug_glNamedBufferData;
+extern PFNGLNAMEDBUFFERSTORAGEPROC glad_debug_glNamedBufferStorage;
+extern PFNGLNAMEDBUFFERSTORAGEEXTPROC glad_debug_glNamedBufferStorageEXT;
+extern PFNGLNAMEDBUFFERSUBDATAPROC glad_debug_glNamedBufferSubData;
+extern PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_debug_glNamedFramebufferDrawBuffer;
+extern PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_debug_glNamedFramebufferDrawBuffers;
+extern PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_debug_glNamedFramebufferParameteri;
+extern PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_debug_glNamedFramebufferReadBuffer;
+extern PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_debug_glNamedFramebufferRenderbuffer;
+extern PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_debug_glNamedFramebufferTexture;
+extern PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_debug_glNamedFramebufferTextureLayer;
+extern PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_debug_glNamedRenderbufferStorage;
+extern PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_debug_glNamedRenderbufferStorageMultisample;
+extern PFNGLNEWLISTPROC glad_debug_glNewList;
+extern PFNGLNORMAL3BPROC glad_debug_glNormal3b;
+extern PFNGLNORMAL3BVPROC glad_debug_glNormal3bv;
+extern PFNGLNORMAL3DPROC glad_debug_glNormal3d;
+extern PFNGLNORMAL3DVPROC glad_debug_glNormal3dv;
+extern PFNGLNORMAL3FPROC glad_debug_glNormal3f;
+extern PFNGLNORMAL3FVPROC glad_debug_glNormal3fv;
+extern PFNGLNORMAL3IPROC glad_debug_glNormal3i;
+extern PFNGLNORMAL3IVPROC glad_debug_glNormal3iv;
+extern PFNGLNORMAL3SPROC glad_debug_glNormal3s;
+extern PFNGLNORMAL3SVPROC glad_debug_glNormal3sv;
+extern PFNGLNORMALP3UIPROC glad_debug_glNormalP3ui;
+extern PFNGLNORMALP3UIVPROC glad_debug_glNormalP3uiv;
+extern PFNGLNORMALPOINTERPROC glad_debug_glNormalPointer;
+extern PFNGLOBJECTLABELPROC glad_debug_glObjectLabel;
+extern PFNGLOBJECTPTRLABELPROC glad_debug_glObjectPtrLabel;
+extern PFNGLORTHOPROC glad_debug_glOrtho;
+extern PFNGLPASSTHROUGHPROC glad_debug_glPassThrough;
+extern PFNGLPATCHPARAMETERFVPROC glad_debug_glPatchParameterfv;
+extern PFNGLPATCHPARAMETERIPROC glad_debug_glPatchParameteri;
+extern PFNGLPAUSETRANSFORMFEEDBACKPROC glad_debug_glPauseTransformFeedback;
+extern PFNGLPIXELMAPFVPROC glad_debug_glPixelMapfv;
+extern PFNGLPIXELMAPUIVPROC glad_debug_glPixelMapuiv;
+extern PFNGLPIXELMAPUSVPROC glad_debug_glPixelMapusv;
+extern PFNGLPIXELSTOREFPROC glad_debug_glPixelStoref;
+extern PFNGLPIXELSTOREIPROC glad_debug_glPixelStorei;
+extern PFNGLPIXELTRANSFERFPROC glad_debug_glPixelTransferf;
+extern PFNGLPIXELTRANSFERIPROC glad_debug_glPixelTransferi;
+extern PFNGLPIXELZOOMPROC glad_debug_glPixelZoom;
+extern PFNGLPOINTPARAMETERFPROC glad_debug_glPointParameterf;
+extern PFNGLPOINTPARAMETERFVPROC glad_debug_glPointParameterfv;
+extern PFNGLPOINTPARAMETERIPROC glad_debug_glPointParameteri;
+extern PFNGLPOINTPARAMETERIVPROC glad_debug_glPointParameteriv;
+extern PFNGLPOINTSIZEPROC glad_debug_glPointSize;
+extern PFNGLPOLYGONMODEPROC glad_debug_glPolygonMode;
+extern PFNGLPOLYGONOFFSETPROC glad_debug_glPolygonOffset;
+extern PFNGLPOLYGONOFFSETCLAMPPROC glad_debug_glPolygonOffsetClamp;
+extern PFNGLPOLYGONSTIPPLEPROC glad_debug_glPolygonStipple;
+extern PFNGLPOPATTRIBPROC glad_debug_glPopAttrib;
+extern PFNGLPOPCLIENTATTRIBPROC glad_debug_glPopClientAttrib;
+extern PFNGLPOPDEBUGGROUPPROC glad_debug_glPopDebugGroup;
+extern PFNGLPOPMATRIXPROC glad_debug_glPopMatrix;
+extern PFNGLPOPNAMEPROC glad_debug_glPopName;
+extern PFNGLPRIMITIVERESTARTINDEXPROC glad_debug_glPrimitiveRestartIndex;
+extern PFNGLPRIORITIZETEXTURESPROC glad_debug_glPrioritizeTextures;
+extern PFNGLPROGRAMBINARYPROC glad_debug_glProgramBinary;
+extern PFNGLPROGRAMPARAMETERIPROC glad_debug_glProgramParameteri;
+extern PFNGLPROGRAMUNIFORM1DPROC glad_debug_glProgramUniform1d;
+extern PFNGLPROGRAMUNIFORM1DVPROC glad_debug_glProgramUniform1dv;
+extern PFNGLPROGRAMUNIFORM1FPROC glad_debug_glProgramUniform1f;
+extern PFNGLPROGRAMUNIFORM1FVPROC glad_debug_glProgramUniform1fv;
+extern PFNGLPROGRAMUNIFORM1IPROC glad_debug_glProgramUniform1i;
+extern PFNGLPROGRAMUNIFORM1IVPROC glad_debug_glProgramUniform1iv;
+extern PFNGLPROGRAMUNIFORM1UIPROC glad_debug_glProgramUniform1ui;
+extern PFNGLPROGRAMUNIFORM1UIVPROC glad_debug_glProgramUniform1uiv;
+extern PFNGLPROGRAMUNIFORM2DPROC glad_debug_glProgramUniform2d;
+extern PFNGLPROGRAMUNIFORM2DVPROC glad_debug_glProgramUniform2dv;
+extern PFNGLPROGRAMUNIFORM2FPROC glad_debug_glProgramUniform2f;
+extern PFNGLPROGRAMUNIFORM2FVPROC glad_debug_glProgramUniform2fv;
+extern PFNGLPROGRAMUNIFORM2IPROC glad_debug_glProgramUniform2i;
+extern PFNGLPROGRAMUNIFORM2IVPROC glad_debug_glProgramUniform2iv;
+extern PFNGLPROGRAMUNIFORM2UIPROC glad_debug_glProgramUniform2ui;
+extern PFNGLPROGRAMUNIFORM2UIVPROC glad_debug_glProgramUniform2uiv;
+extern PFNGLPROGRAMUNIFORM3DPROC glad_debug_glProgramUniform3d;
+extern PFNGLPROGRAMUNIFORM3DVPROC glad_debug_glProgramUniform3dv;
+extern PFNGLPROGRAMUNIFORM3FPROC glad_debug_glProgramUniform3f;
+extern PFNGLPROGRAMUNIFORM3FVPROC glad_debug_glProgramUniform3fv;
+extern PFNGLPROGRAMUNIFORM3IPROC glad_debug_glProgramUniform3i;
+extern PFNGLPROGRAMUNIFORM3IVPROC glad_debug_glProgramUniform3iv;
+extern PFNGLPROGRAMUNIFORM3UIPROC glad_debug_glProgramUniform3ui;
+extern PFNGLPROGRAMUNIFORM3UIVPROC glad_debug_glProgramUniform3uiv;
+extern PFNGLPROGRAMUNIFORM4DPROC glad_debug_glProgramUniform4d;
+extern PFNGLPROGRAMUNIFORM4DVPROC glad_debug_glProgramUniform4dv;
+extern PFNGLPROGRAMUNIFORM4FPROC glad_debug_glProgramUniform4f;
+extern PFNGLPROGRAMUNIFORM4FVPROC glad_debug_glProgramUniform4fv;
+extern PFNGLPROGRAMUNIFORM4IPROC glad_debug_glProgramUniform4i;
+extern PFNGLPROGRAMUNIFORM4IVPROC glad_debug_glProgramUniform4iv;
+extern PFNGLPROGRAMUNIFORM4UIPROC glad_debug_glProgramUniform4ui;
+extern PFNGLPROGRAMUNIFORM4UIVPROC glad_debug_glProgramUniform4uiv;
+extern PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC glad_debug_glProgramUniformHandleui64ARB;
+extern PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC glad_debug_glProgramUniformHandleui64vARB;
+extern PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_debug_glProgramUniformMatrix2dv;
+extern PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_debug_glProgramUniformMatrix2fv;
+extern PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_debug_glProgramUniformMatrix2x3dv;
+extern PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_debug_glProgramUniformMatrix2x3fv;
+extern PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_debug_glProgramUniformMatrix2x4dv;
+extern PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_debug_glProgramUniformMatrix2x4fv;
+extern PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_debug_glProgramUniformMatrix3dv;
+extern PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_debug_glProgramUniformMatrix3fv;
+extern PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_debug_glProgramUniformMatrix3x2dv;
+extern PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_debug_glProgramUniformMatrix3x2fv;
+extern PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_debug_glProgramUniformMatrix3x4dv;
+extern PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_debug_glProgramUniformMatrix3x4fv;
+extern PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_debug_glProgramUniformMatrix4dv;
+extern PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_debug_glProgramUniformMatrix4fv;
+extern PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_debug_glProgramUniformMatrix4x2dv;
+extern PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_debug_glProgramUniformMatrix4x2fv;
+extern PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_debug_glProgramUniformMatrix4x3dv;
+extern PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_debug_glProgramUniformMatrix4x3fv;
+extern PFNGLPROVOKINGVERTEXPROC glad_debug_glProvokingVertex;
+extern PFNGLPUSHATTRIBPROC glad_debug_glPushAttrib;
+extern PFNGLPUSHCLIENTATTRIBPROC glad_debug_glPushClientAttrib;
+extern PFNGLPUSHDEBUGGROUPPROC glad_debug_glPushDebugGroup;
+extern PFNGLPUSHMATRIXPROC glad_debug_glPushMatrix;
+extern PFNGLPUSHNAMEPROC glad_debug_glPushName;
+extern PFNGLQUERYCOUNTERPROC glad_debug_glQueryCounter;
+extern PFNGLRASTERPOS2DPROC glad_debug_glRasterPos2d;
+extern PFNGLRASTERPOS2DVPROC glad_debug_glRasterPos2dv;
+extern PFNGLRASTERPOS2FPROC glad_debug_glRasterPos2f;
+extern PFNGLRASTERPOS2FVPROC glad_debug_glRasterPos2fv;
+extern PFNGLRASTERPOS2IPROC glad_debug_glRasterPos2i;
+extern PFNGLRASTERPOS2IVPROC glad_debug_glRasterPos2iv;
+extern PFNGLRASTERPOS2SPROC glad_debug_glRasterPos2s;
+extern PFNGLRASTERPOS2SVPROC glad_debug_glRasterPos2sv;
+extern PFNGLRASTERPOS3DPROC glad_debug_glRasterPos3d;
+extern PFNGLRASTERPOS3DVPROC glad_debug_glRasterPos3dv;
+extern PFNGLRASTERPOS3FPROC glad_debug_glRasterPos3f;
+extern PFNGLRASTERPOS3FVPROC glad_debug_glRasterPos3fv;
+extern PFNGLRASTERPOS3IPROC glad_debug_glRasterPos3i;
+extern PFNGLRASTERPOS3IVPROC glad_debug_glRasterPos3iv;
+extern PFNGLRASTERPOS3SPROC glad_debug_glRasterPos3s;
+extern PFNGLRASTERPOS3SVPROC glad_debug_glRasterPos3sv;
+extern PFNGLRASTERPOS4DPROC glad_debug_glRasterPos4d;
+extern PFNGLRASTERPOS4DVPROC glad_debug_glRasterPos4dv;
+extern PFNGLRASTERPOS4FPROC glad_debug_glRasterPos4f;
+extern PFNGLRASTERPOS4FVPROC glad_debug_glRasterPos4fv;
+extern PFNGLRASTERPOS4IPROC glad_debug_glRasterPos4i;
+extern PFNGLRASTERPOS4IVPROC glad_debug_glRasterPos4iv;
+extern PFNGLRASTERPOS4SPROC glad_debug_glRasterPos4s;
+extern PFNGLRASTERPOS4SVPROC glad_debug_glRasterPos4sv;
+extern PFNGLREADBUFFERPROC glad_debug_glReadBuffer;
+extern PFNGLREADPIXELSPROC glad_debug_glReadPixels;
+extern PFNGLREADNPIXELSPROC glad_debug_glReadnPixels;
+extern PFNGLRECTDPROC glad_debug_glRectd;
+extern PFNGLRECTDVPROC glad_debug_glRectdv;
+extern PFNGLRECTFPROC glad_debug_glRectf;
+extern PFNGLRECTFVPROC glad_debug_glRectfv;
+extern PFNGLRECTIPROC glad_debug_glRecti;
+extern PFNGLRECTIVPROC glad_debug_glRectiv;
+extern PFNGLRECTSPROC glad_debug_glRects;
+extern PFNGLRECTSVPROC glad_debug_glRectsv;
+extern PFNGLRELEASESHADERCOMPILERPROC glad_debug_glReleaseShaderCompiler;
+extern PFNGLRENDERMODEPROC glad_debug_glRenderMode;
+extern PFNGLRENDERBUFFERSTORAGEPROC glad_debug_glRenderbufferStorage;
+extern PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_debug_glRenderbufferStorageMultisample;
+extern PFNGLRESUMETRANSFORMFEEDBACKPROC glad_debug_glResumeTransformFeedback;
+extern PFNGLROTATEDPROC glad_debug_glRotated;
+extern PFNGLROTATEFPROC glad_debug_glRotatef;
+extern PFNGLSAMPLECOVERAGEPROC glad_debug_glSampleCoverage;
+extern PFNGLSAMPLEMASKIPROC glad_debug_glSampleMaski;
+extern PFNGLSAMPLERPARAMETERIIVPROC glad_debug_glSamplerParameterIiv;
+extern PFNGLSAMPLERPARAMETERIUIVPROC glad_debug_glSamplerParameterIuiv;
+extern PFNGLSAMPLERPARAMETERFPROC glad_debug_glSamplerParameterf;
+extern PFNGLSAMPLERPARAMETERFVPROC glad_debug_glSamplerParameterfv;
+extern PFNGLSAMPLERPARAMETERIPROC glad_debug_glSamplerParameteri;
+extern PFNGLSAMPLERPARAMETERIVPROC glad_debug_glSamplerParameteriv;
+extern PFNGLSCALEDPROC glad_debug_glScaled;
+extern PFNGLSCALEFPROC glad_debug_glScalef;
+extern PFNGLSCISSORPROC glad_debug_glScissor;
+extern PFNGLSCISSORARRAYVPROC glad_debug_glScissorArrayv;
+extern PFNGLSCISSORINDEXEDPROC glad_debug_glScissorIndexed;
+extern PFNGLSCISSORINDEXEDVPROC glad_debug_glScissorIndexedv;
+extern PFNGLSECONDARYCOLOR3BPROC glad_debug_glSecondaryColor3b;
+extern PFNGLSECONDARYCOLOR3BVPROC glad_debug_glSecondaryColor3bv;
+extern PFNGLSECONDARYCOLOR3DPROC glad_debug_glSecondaryColor3d;
+extern PFNGLSECONDARYCOLOR3DVPROC glad_debug_glSecondaryColor3dv;
+extern PFNGLSECONDARYCOLOR3FPROC glad_debug_glSecondaryColor3f;
+extern PFNGLSECONDARYCOLOR3FVPROC glad_debug_glSecondaryColor3fv;
+extern PFNGLSECONDARYCOLOR3IPROC glad_debug_glSecondaryColor3i;
+extern PFNGLSECONDARYCOLOR3IVPROC glad_debug_glSecondaryColor3iv;
+extern PFNGLSECONDARYCOLOR3SPROC glad_debug_glSecondaryColor3s;
+extern PFNGLSECONDARYCOLOR3SVPROC glad_debug_glSecondaryColor3sv;
+extern PFNGLSECONDARYCOLOR3UBPROC glad_debug_glSecondaryColor3ub;
+extern PFNGLSECONDARYCOLOR3UBVPROC glad_debug_glSecondaryColor3ubv;
+extern PFNGLSECONDARYCOLOR3UIPROC glad_debug_glSecondaryColor3ui;
+extern PFNGLSECONDARYCOLOR3UIVPROC glad_debug_glSecondaryColor3uiv;
+extern PFNGLSECONDARYCOLOR3USPROC glad_debug_glSecondaryColor3us;
+extern PFNGLSECONDARYCOLOR3USVPROC glad_debug_glSecondaryColor3usv;
+extern PFNGLSECONDARYCOLORP3UIPROC glad_debug_glSecondaryColorP3ui;
+extern PFNGLSECONDARYCOLORP3UIVPROC glad_debug_glSecondaryColorP3uiv;
+extern PFNGLSECONDARYCOLORPOINTERPROC glad_debug_glSecondaryColorPointer;
+extern PFNGLSELECTBUFFERPROC glad_debug_glSelectBuffer;
+extern PFNGLSHADEMODELPROC glad_debug_glShadeModel;
+extern PFNGLSHADERBINARYPROC glad_debug_glShaderBinary;
+extern PFNGLSHADERSOURCEPROC glad_debug_glShaderSource;
+extern PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_debug_glShaderStorageBlockBinding;
+extern PFNGLSPECIALIZESHADERPROC glad_debug_glSpecializeShader;
+extern PFNGLSPECIALIZESHADERARBPROC glad_debug_glSpecializeShaderARB;
+extern PFNGLSTENCILFUNCPROC glad_debug_glStencilFunc;
+extern PFNGLSTENCILFUNCSEPARATEPROC glad_debug_glStencilFuncSeparate;
+extern PFNGLSTENCILMASKPROC glad_debug_glStencilMask;
+extern PFNGLSTENCILMASKSEPARATEPROC glad_debug_glStencilMaskSeparate;
+extern PFNGLSTENCILOPPROC glad_debug_glStencilOp;
+extern PFNGLSTENCILOPSEPARATEPROC glad_debug_glStencilOpSeparate;
+extern PFNGLTEXBUFFERPROC glad_debug_glTexBuffer;
+extern PFNGLTEXBUFFERRANGEPROC glad_debug_glTexBufferRange;
+extern PFNGLTEXCOORD1DPROC glad_debug_glTexCoord1d;
+extern PFNGLTEXCOORD1DVPROC glad_debug_glTexCoord1dv;
+extern PFNGLTEXCOORD1FPROC glad_debug_glTexCoord1f;
+extern PFNGLTEXCOORD1FVPROC glad_debug_glTexCoord1fv;
+extern PFNGLTEXCOORD1IPROC glad_debug_glTexCoord1i;
+extern PFNGLTEXCOORD1IVPROC glad_debug_glTexCoord1iv;
+extern PFNGLTEXCOORD1SPROC glad_debug_glTexCoord1s;
+extern PFNGLTEXCOORD1SVPROC glad_debug_glTexCoord1sv;
+extern PFNGLTEXCOORD2DPROC glad_debug_glTexCoord2d;
+extern PFNGLTEXCOORD2DVPROC glad_debug_glTexCoord2dv;
+extern PFNGLTEXCOORD2FPROC glad_debug_glTexCoord2f;
+extern PFNGLTEXCOORD2FVPROC glad_debug_glTexCoord2fv;
+extern PFNGLTEXCOORD2IPROC glad_debug_glTexCoord2i;
+extern PFNGLTEXCOORD2IVPROC glad_debug_glTexCoord2iv;
+extern PFNGLTEXCOORD2SPROC glad_debug_glTexCoord2s;
+extern PFNGLTEXCOORD2SVPROC glad_debug_glTexCoord2sv;
+extern PFNGLTEXCOORD3DPROC glad_debug_glTexCoord3d;
+extern PFNGLTEXCOORD3DVPROC glad_debug_glTexCoord3dv;
+extern PFNGLTEXCOORD3FPROC glad_debug_glTexCoord3f;
+extern PFNGLTEXCOORD3FVPROC glad_debug_glTexCoord3fv;
+extern PFNGLTEXCOORD3IPROC glad_debug_glTexCoord3i;
+extern PFNGLTEXCOORD3IVPROC glad_debug_glTexCoord3iv;
+extern PFNGLTEXCOORD3SPROC glad_debug_glTexCoord3s;
+extern PFNGLTEXCOORD3SVPROC glad_debug_glTexCoord3sv;
+extern PFNGLTEXCOORD4DPROC glad_debug_glTexCoord4d;
+extern PFNGLTEXCOORD4DVPROC glad_debug_glTexCoord4dv;
+extern PFNGLTEXCOORD4FPROC glad_debug_glTexCoord4f;
+extern PFNGLTEXCOORD4FVPROC glad_debug_glTexCoord4fv;
+extern PFNGLTEXCOORD4IPROC glad_debug_glTexCoord4i;
+extern PFNGLTEXCOORD4IVPROC glad_debug_glTexCoord4iv;
+extern PFNGLTEXCOORD4SPROC glad_debug_glTexCoord4s;
+extern PFNGLTEXCOORD4SVPROC glad_debug_glTexCoord4sv;
+extern PFNGLTEXCOORDP1UIPROC glad_debug_glTexCoordP1ui;
+extern PFNGLTEXCOORDP1UIVPROC glad_debug_glTexCoordP1uiv;
+extern PFNGLTEXCOORDP2UIPROC glad_debug_glTexCoordP2ui;
+extern PFNGLTEXCOORDP2UIVPROC glad_debug_glTexCoordP2uiv;
+extern PFNGLTEXCOORDP3UIPROC glad_debug_glTexCoordP3ui;
+extern PFNGLTEXCOORDP3UIVPROC glad_debug_glTexCoordP3uiv;
+extern PFNGLTEXCOORDP4UIPROC glad_debug_glTexCoordP4ui;
+extern PFNGLTEXCOORDP4UIVPROC glad_debug_glTexCoordP4uiv;
+extern PFNGLTEXCOORDPOINTERPROC glad_debug_glTexCoordPointer;
+extern PFNGLTEXENVFPROC glad_debug_glTexEnvf;
+extern PFNGLTEXENVFVPROC glad_debug_glTexEnvfv;
+extern PFNGLTEXENVIPROC glad_debug_glTexEnvi;
+extern PFNGLTEXENVIVPROC glad_debug_glTexEnviv;
+extern PFNGLTEXGENDPROC glad_debug_glTexGend;
+extern PFNGLTEXGENDVPROC glad_debug_glTexGendv;
+extern PFNGLTEXGENFPROC glad_debug_glTexGenf;
+extern PFNGLTEXGENFVPROC glad_debug_glTexGenfv;
+extern PFNGLTEXGENIPROC glad_debug_glTexGeni;
+extern PFNGLTEXGENIVPROC glad_debug_glTexGeniv;
+extern PFNGLTEXIMAGE1DPROC glad_debug_glTexImage1D;
+extern PFNGLTEXIMAGE2DPROC glad_debug_glTexImage2D;
+extern PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_debug_glTexImage2DMultisample;
+extern PFNGLTEXIMAGE3DPROC glad_debug_glTexImage3D;
+extern PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_debug_glTexImage3DMultisample;
+extern PFNGLTEXPARAMETERIIVPROC glad_debug_glTexParameterIiv;
+extern PFNGLTEXPARAMETERIUIVPROC glad_debug_glTexParameterIuiv;
+extern PFNGLTEXPARAMETERFPROC glad_debug_glTexParameterf;
+extern PFNGLTEXPARAMETERFVPROC glad_debug_glTexParameterfv;
+extern PFNGLTEXPARAMETERIPROC glad_debug_glTexParameteri;
+extern PFNGLTEXPARAMETERIVPROC glad_debug_glTexParameteriv;
+extern PFNGLTEXSTORAGE1DPROC glad_debug_glTexStorage1D;
+extern PFNGLTEXSTORAGE2DPROC glad_debug_glTexStorage2D;
+extern PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_debug_glTexStorage2DMultisample;
+extern PFNGLTEXSTORAGE3DPROC glad_debug_glTexStorage3D;
+extern PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_debug_glTexStorage3DMultisample;
+extern PFNGLTEXSUBIMAGE1DPROC glad_debug_glTexSubImage1D;
+extern PFNGLTEXSUBIMAGE2DPROC glad_debug_glTexSubImage2D;
+extern PFNGLTEXSUBIMAGE3DPROC glad_debug_glTexSubImage3D;
+extern PFNGLTEXTUREBARRIERPROC glad_debug_glTextureBarrier;
+extern PFNGLTEXTUREBUFFERPROC glad_debug_glTextureBuffer;
+extern PFNGLTEXTUREBUFFERRANGEPROC glad_debug_glTextureBufferRange;
+extern PFNGLTEXTUREPARAMETERIIVPROC glad_debug_glTextureParameterIiv;
+extern PFNGLTEXTUREPARAMETERIUIVPROC glad_debug_glTextureParameterIuiv;
+extern PFNGLTEXTUREPARAMETERFPROC glad_debug_glTextureParameterf;
+extern PFNGLTEXTUREPARAMETERFVPROC glad_debug_glTextureParameterfv;
+extern PFNGLTEXTUREPARAMETERIPROC glad_debug_glTextureParameteri;
+extern PFNGLTEXTUREPARAMETERIVPROC glad_debug_glTextureParameteriv;
+extern PFNGLTEXTURESTORAGE1DPROC glad_debug_glTextureStorage1D;
+extern PFNGLTEXTURESTORAGE2DPROC glad_debug_glTextureStorage2D;
+extern PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_debug_glTextureStorage2DMultisample;
+extern PFNGLTEXTURESTORAGE3DPROC glad_debug_glTextureStorage3D;
+extern PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_debug_glTextureStorage3DMultisample;
+extern PFNGLTEXTURESUBIMAGE1DPROC glad_debug_glTextureSubImage1D;
+extern PFNGLTEXTURESUBIMAGE2DPROC glad_debug_glTextureSubImage2D;
+extern PFNGLTEXTURESUBIMAGE3DPROC glad_debug_glTextureSubImage3D;
+extern PFNGLTEXTUREVIEWPROC glad_debug_glTextureView;
+extern PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_debug_glTransformFeedbackBufferBase;
+extern PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_debug_glTransformFeedbackBufferRange;
+extern PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_debug_glTransformFeedbackVaryings;
+extern PFNGLTRANSLATEDPROC glad_debug_glTranslated;
+extern PFNGLTRANSLATEFPROC glad_debug_glTranslatef;
+extern PFNGLUNIFORM1DPROC glad_debug_glUniform1d;
+extern PFNGLUNIFORM1DVPROC glad_debug_glUniform1dv;
+extern PFNGLUNIFORM1FPROC glad_debug_glUniform1f;
+extern PFNGLUNIFORM1FVPROC glad_debug_glUniform1fv;
+extern PFNGLUNIFORM1IPROC glad_debug_glUniform1i;
+extern PFNGLUNIFORM1IVPROC glad_debug_glUniform1iv;
+extern PFNGLUNIFORM1UIPROC glad_debug_glUniform1ui;
+extern PFNGLUNIFORM1UIVPROC glad_debug_glUniform1uiv;
+extern PFNGLUNIFORM2DPROC glad_debug_glUniform2d;
+extern PFNGLUNIFORM2DVPROC glad_debug_glUniform2dv;
+extern PFNGLUNIFORM2FPROC glad_debug_glUniform2f;
+extern PFNGLUNIFORM2FVPROC glad_debug_glUniform2fv;
+extern PFNGLUNIFORM2IPROC glad_debug_glUniform2i;
+extern PFNGLUNIFORM2IVPROC glad_debug_glUniform2iv;
+extern PFNGLUNIFORM2UIPROC glad_debug_glUniform2ui;
+extern PFNGLUNIFORM2UIVPROC glad_debug_glUniform2uiv;
+extern PFNGLUNIFORM3DPROC glad_debug_glUniform3d;
+extern PFNGLUNIFORM3DVPROC glad_debug_glUniform3dv;
+extern PFNGLUNIFORM3FPROC glad_debug_glUniform3f;
+extern PFNGLUNIFORM3FVPROC glad_debug_glUniform3fv;
+extern PFNGLUNIFORM3IPROC glad_debug_glUniform3i;
+extern PFNGLUNIFORM3IVPROC glad_debug_glUniform3iv;
+extern PFNGLUNIFORM3UIPROC glad_debug_glUniform3ui;
+extern PFNGLUNIFORM3UIVPROC glad_debug_glUniform3uiv;
+extern PFNGLUNIFORM4DPROC glad_debug_glUniform4d;
+extern PFNGLUNIFORM4DVPROC glad_debug_glUniform4dv;
+extern PFNGLUNIFORM4FPROC glad_debug_glUniform4f;
+extern PFNGLUNIFORM4FVPROC glad_debug_glUniform4fv;
+extern PFNGLUNIFORM4IPROC glad_debug_glUniform4i;
+extern PFNGLUNIFORM4IVPROC glad_debug_glUniform4iv;
+extern PFNGLUNIFORM4UIPROC glad_debug_glUniform4ui;
+extern PFNGLUNIFORM4UIVPROC glad_debug_glUniform4uiv;
+extern PFNGLUNIFORMBLOCKBINDINGPROC glad_debug_glUniformBlockBinding;
+extern PFNGLUNIFORMHANDLEUI64ARBPROC glad_debug_glUniformHandleui64ARB;
+extern PFNGLUNIFORMHANDLEUI64VARBPROC glad_debug_glUniformHandleui64vARB;
+extern PFNGLUNIFORMMATRIX2DVPROC glad_debug_glUniformMatrix2dv;
+extern PFNGLUNIFORMMATRIX2FVPROC glad_debug_glUniformMatrix2fv;
+extern PFNGLUNIFORMMATRIX2X3DVPROC glad_debug_glUniformMatrix2x3dv;
+extern PFNGLUNIFORMMATRIX2X3FVPROC glad_debug_glUniformMatrix2x3fv;
+extern PFNGLUNIFORMMATRIX2X4DVPROC glad_debug_glUniformMatrix2x4dv;
+extern PFNGLUNIFORMMATRIX2X4FVPROC glad_debug_glUniformMatrix2x4fv;
+extern PFNGLUNIFORMMATRIX3DVPROC glad_debug_glUniformMatrix3dv;
+extern PFNGLUNIFORMMATRIX3FVPROC glad_debug_glUniformMatrix3fv;
+extern PFNGLUNIFORMMATRIX3X2DVPROC glad_debug_glUniformMatrix3x2dv;
+extern PFNGLUNIFORMMATRIX3X2FVPROC glad_debug_glUniformMatrix3x2fv;
+extern PFNGLUNIFORMMATRIX3X4DVPROC glad_debug_glUniformMatrix3x4dv;
+extern PFNGLUNIFORMMATRIX3X4FVPROC glad_debug_glUniformMatrix3x4fv;
+extern PFNGLUNIFORMMATRIX4DVPROC glad_debug_glUniformMatrix4dv;
+extern PFNGLUNIFORMMATRIX4FVPROC glad_debug_glUniformMatrix4fv;
+extern PFNGLUNIFORMMATRIX4X2DVPROC glad_debug_glUniformMatrix4x2dv;
+extern PFNGLUNIFORMMATRIX4X2FVPROC glad_debug_glUniformMatrix4x2fv;
+extern PFNGLUNIFORMMATRIX4X3DVPROC glad_debug_glUniformMatrix4x3dv;
+extern PFNGLUNIFORMMATRIX4X3FVPROC glad_debug_glUniformMatrix4x3fv;
+extern PFNGLUNIFORMSUBROUTINESUIVPROC glad_debug_glUniformSubroutinesuiv;
+extern PFNGLUNMAPBUFFERPROC glad_debug_glUnmapBuffer;
+extern PFNGLUNMAPNAMEDBUFFERPROC glad_debug_glUnmapNamedBuffer;
+extern PFNGLUSEPROGRAMPROC glad_debug_glUseProgram;
+extern PFNGLUSEPROGRAMSTAGESPROC glad_debug_glUseProgramStages;
+extern PFNGLVALIDATEPROGRAMPROC glad_debug_glValidateProgram;
+extern PFNGLVALIDATEPROGRAMPIPELINEPROC glad_debug_glValidateProgramPipeline;
+extern PFNGLVERTEX2DPROC glad_debug_glVertex2d;
+extern PFNGLVERTEX2DVPROC glad_debug_glVertex2dv;
+extern PFNGLVERTEX2FPROC glad_debug_glVertex2f;
+extern PFNGLVERTEX2FVPROC glad_debug_glVertex2fv;
+extern PFNGLVERTEX2IPROC glad_debug_glVertex2i;
+extern PFNGLVERTEX2IVPROC glad_debug_glVertex2iv;
+extern PFNGLVERTEX2SPROC glad_debug_glVertex2s;
+extern PFNGLVERTEX2SVPROC glad_debug_glVertex2sv;
+extern PFNGLVERTEX3DPROC glad_debug_glVertex3d;
+extern PFNGLVERTEX3DVPROC glad_debug_glVertex3dv;
+extern PFNGLVERTEX3FPROC glad_debug_glVertex3f;
+extern PFNGLVERTEX3FVPROC glad_debug_glVertex3fv;
+extern PFNGLVERTEX3IPROC glad_debug_glVertex3i;
+extern PFNGLVERTEX3IVPROC glad_debug_glVertex3iv;
+extern PFNGLVERTEX3SPROC glad_debug_glVertex3s;
+extern PFNGLVERTEX3SVPROC glad_debug_glVertex3sv;
+extern PFNGLVERTEX4DPROC glad_debug_glVertex4d;
+extern PFNGLVERTEX4DVPROC glad_debug_glVertex4dv;
+extern PFNGLVERTEX4FPROC glad_debug_glVertex4f;
+extern PFNGLVERTEX4FVPROC glad_debug_glVertex4fv;
+extern PFNGLVERTEX4IPROC glad_debug_glVertex4i;
+extern PFNGLVERTEX4IVPROC glad_debug_glVertex4iv;
+extern PFNGLVERTEX4SPROC glad_debug_glVertex4s;
+extern PFNGLVERTEX4SVPROC glad_debug_glVertex4sv;
+extern PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_debug_glVertexArrayAttribBinding;
+extern PFNGLVERTEXARRAYATTRIBFORMATPROC glad_debug_glVertexArrayAttribFormat;
+extern PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_debug_glVertexArrayAttribIFormat;
+extern PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_debug_glVertexArrayAttribLFormat;
+extern PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_debug_glVertexArrayBindingDivisor;
+extern PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_debug_glVertexArrayElementBuffer;
+extern PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_debug_glVertexArrayVertexBuffer;
+extern PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_debug_glVertexArrayVertexBuffers;
+extern PFNGLVERTEXATTRIB1DPROC glad_debug_glVertexAttrib1d;
+extern PFNGLVERTEXATTRIB1DVPROC glad_debug_glVertexAttrib1dv;
+extern PFNGLVERTEXATTRIB1FPROC glad_debug_glVertexAttrib1f;
+extern PFNGLVERTEXATTRIB1FVPROC glad_debug_glVertexAttrib1fv;
+extern PFNGLVERTEXATTRIB1SPROC glad_debug_glVertexAttrib1s;
+extern PFNGLVERTEXATTRIB1SVPROC glad_debug_glVertexAttrib1sv;
+extern PFNGLVERTEXATTRIB2DPROC glad_debug_glVertexAttrib2d;
+extern PFNGLVERTEXATTRIB2DVPROC glad_debug_glVertexAttrib2dv;
+extern PFNGLVERTEXATTRIB2FPROC glad_debug_glVertexAttrib2f;
+extern PFNGLVERTEXATTRIB2FVPROC glad_debug_glVertexAttrib2fv;
+extern PFNGLVERTEXATTRIB2SPROC glad_debug_glVertexAttrib2s;
+extern PFNGLVERTEXATTRIB2SVPROC glad_debug_glVertexAttrib2sv;
+extern PFNGLVERTEXATTRIB3DPROC glad_debug_glVertexAttrib3d;
+extern PFNGLVERTEXATTRIB3DVPROC glad_debug_glVertexAttrib3dv;
+extern PFNGLVERTEXATTRIB3FPROC glad_debug_glVertexAttrib3f;
+extern PFNGLVERTEXATTRIB3FVPROC glad_debug_glVertexAttrib3fv;
+extern PFNGLVERTEXATTRIB3SPROC glad_debug_glVertexAttrib3s;
+extern PFNGLVERTEXATTRIB3SVPROC glad_debug_glVertexAttrib3sv;
+extern PFNGLVERTEXATTRIB4NBVPROC glad_debug_glVertexAttrib4Nbv;
+extern PFNGLVERTEXATTRIB4NIVPROC glad_debug_glVertexAttrib4Niv;
+extern PFNGLVERTEXATTRIB4NSVPROC glad_debug_glVertexAttrib4Nsv;
+extern PFNGLVERTEXATTRIB4NUBPROC glad_debug_glVertexAttrib4Nub;
+extern PFNGLVERTEXATTRIB4NUBVPROC glad_debug_glVertexAttrib4Nubv;
+extern PFNGLVERTEXATTRIB4NUIVPROC glad_debug_glVertexAttrib4Nuiv;
+extern PFNGLVERTEXATTRIB4NUSVPROC glad_debug_glVertexAttrib4Nusv;
+extern PFNGLVERTEXATTRIB4BVPROC glad_debug_glVertexAttrib4bv;
+extern PFNGLVERTEXATTRIB4DPROC glad_debug_glVertexAttrib4d;
+extern PFNGLVERTEXATTRIB4DVPROC glad_debug_glVertexAttrib4dv;
+extern PFNGLVERTEXATTRIB4FPROC glad_debug_glVertexAttrib4f;
+extern PFNGLVERTEXATTRIB4FVPROC glad_debug_glVertexAttrib4fv;
+extern PFNGLVERTEXATTRIB4IVPROC glad_debug_glVertexAttrib4iv;
+extern PFNGLVERTEXATTRIB4SPROC glad_debug_glVertexAttrib4s;
+extern PFNGLVERTEXATTRIB4SVPROC glad_debug_glVertexAttrib4sv;
+extern PFNGLVERTEXATTRIB4UBVPROC glad_debug_glVertexAttrib4ubv;
+extern PFNGLVERTEXATTRIB4UIVPROC glad_debug_glVertexAttrib4uiv;
+extern PFNGLVERTEXATTRIB4USVPROC glad_debug_glVertexAttrib4usv;
+extern PFNGLVERTEXATTRIBBINDINGPROC glad_debug_glVertexAttribBinding;
+extern PFNGLVERTEXATTRIBDIVISORPROC glad_debug_glVertexAttribDivisor;
+extern PFNGLVERTEXATTRIBFORMATPROC glad_debug_glVertexAttribFormat;
+extern PFNGLVERTEXATTRIBI1IPROC glad_debug_glVertexAttribI1i;
+extern PFNGLVERTEXATTRIBI1IVPROC glad_debug_glVertexAttribI1iv;
+extern PFNGLVERTEXATTRIBI1UIPROC glad_debug_glVertexAttribI1ui;
+extern PFNGLVERTEXATTRIBI1UIVPROC glad_debug_glVertexAttribI1uiv;
+extern PFNGLVERTEXATTRIBI2IPROC glad_debug_glVertexAttribI2i;
+extern PFNGLVERTEXATTRIBI2IVPROC glad_debug_glVertexAttribI2iv;
+extern PFNGLVERTEXATTRIBI2UIPROC glad_debug_glVertexAttribI2ui;
+extern PFNGLVERTEXATTRIBI2UIVPROC glad_debug_glVertexAttribI2uiv;
+extern PFNGLVERTEXATTRIBI3IPROC glad_debug_glVertexAttribI3i;
+extern PFNGLVERTEXATTRIBI3IVPROC glad_debug_glVertexAttribI3iv;
+extern PFNGLVERTEXATTRIBI3UIPROC glad_debug_glVertexAttribI3ui;
+extern PFNGLVERTEXATTRIBI3UIVPROC glad_debug_glVertexAttribI3uiv;
+extern PFNGLVERTEXATTRIBI4BVPROC glad_debug_glVertexAttribI4bv;
+extern PFNGLVERTEXATTRIBI4IPROC glad_debug_glVertexAttribI4i;
+extern PFNGLVERTEXATTRIBI4IVPROC glad_debug_glVertexAttribI4iv;
+extern PFNGLVERTEXATTRIBI4SVPROC glad_debug_glVertexAttribI4sv;
+extern PFNGLVERTEXATTRIBI4UBVPROC glad_debug_glVertexAttribI4ubv;
+extern PFNGLVERTEXATTRIBI4UIPROC glad_debug_glVertexAttribI4ui;
+extern PFNGLVERTEXATTRIBI4UIVPROC glad_debug_glVertexAttribI4uiv;
+extern PFNGLVERTEXATTRIBI4USVPROC glad_debug_glVertexAttribI4usv;
+extern PFNGLVERTEXATTRIBIFORMATPROC glad_debug_glVertexAttribIFormat;
+extern PFNGLVERTEXATTRIBIPOINTERPROC glad_debug_glVertexAttribIPointer;
+extern PFNGLVERTEXATTRIBL1DPROC glad_debug_glVertexAttribL1d;
+extern PFNGLVERTEXATTRIBL1DVPROC glad_debug_glVertexAttribL1dv;
+extern PFNGLVERTEXATTRIBL1UI64ARBPROC glad_debug_glVertexAttribL1ui64ARB;
+extern PFNGLVERTEXATTRIBL1UI64VARBPROC glad_debug_glVertexAttribL1ui64vARB;
+extern PFNGLVERTEXATTRIBL2DPROC glad_debug_glVertexAttribL2d;
+extern PFNGLVERTEXATTRIBL2DVPROC glad_debug_glVertexAttribL2dv;
+extern PFNGLVERTEXATTRIBL3DPROC glad_debug_glVertexAttribL3d;
+extern PFNGLVERTEXATTRIBL3DVPROC glad_debug_glVertexAttribL3dv;
+extern PFNGLVERTEXATTRIBL4DPROC glad_debug_glVertexAttribL4d;
+extern PFNGLVERTEXATTRIBL4DVPROC glad_debug_glVertexAttribL4dv;
+extern PFNGLVERTEXATTRIBLFORMATPROC glad_debug_glVertexAttribLFormat;
+extern PFNGLVERTEXATTRIBLPOINTERPROC glad_debug_glVertexAttribLPointer;
+extern PFNGLVERTEXATTRIBP1UIPROC glad_debug_glVertexAttribP1ui;
+extern PFNGLVERTEXATTRIBP1UIVPROC glad_debug_glVertexAttribP1uiv;
+extern PFNGLVERTEXATTRIBP2UIPROC glad_debug_glVertexAttribP2ui;
+extern PFNGLVERTEXATTRIBP2UIVPROC glad_debug_glVertexAttribP2uiv;
+extern PFNGLVERTEXATTRIBP3UIPROC glad_debug_glVertexAttribP3ui;
+extern PFNGLVERTEXATTRIBP3UIVPROC glad_debug_glVertexAttribP3uiv;
+extern PFNGLVERTEXATTRIBP4UIPROC glad_debug_glVertexAttribP4ui;
+extern PFNGLVERTEXATTRIBP4UIVPROC glad_debug_glVertexAttribP4uiv;
+extern PFNGLVERTEXATTRIBPOINTERPROC glad_debug_glVertexAttribPointer;
+extern PFNGLVERTEXBINDINGDIVISORPROC glad_debug_glVertexBindingDivisor;
+extern PFNGLVERTEXP2UIPROC glad_debug_glVertexP2ui;
+extern PFNGLVERTEXP2UIVPROC glad_debug_glVertexP2uiv;
+extern PFNGLVERTEXP3UIPROC glad_debug_glVertexP3ui;
+extern PFNGLVERTEXP3UIVPROC glad_debug_glVertexP3uiv;
+extern PFNGLVERTEXP4UIPROC glad_debug_glVertexP4ui;
+extern PFNGLVERTEXP4UIVPROC glad_debug_glVertexP4uiv;
+extern PFNGLVERTEXPOINTERPROC glad_debug_glVertexPointer;
+extern PFNGLVIEWPORTPROC glad_debug_glViewport;
+extern PFNGLVIEWPORTARRAYVPROC glad_debug_glViewportArrayv;
+extern PFNGLVIEWPORTINDEXEDFPROC glad_debug_glViewportIndexedf;
+extern PFNGLVIEWPORTINDEXEDFVPROC glad_debug_glViewportIndexedfv;
+extern PFNGLWAITSYNCPROC glad_debug_glWaitSync;
+extern PFNGLWINDOWPOS2DPROC glad_debug_glWindowPos2d;
+extern PFNGLWINDOWPOS2DVPROC glad_debug_glWindowPos2dv;
+extern PFNGLWINDOWPOS2FPROC glad_debug_glWindowPos2f;
+extern PFNGLWINDOWPOS2FVPROC glad_debug_glWindowPos2fv;
+extern PFNGLWINDOWPOS2IPROC glad_debug_glWindowPos2i;
+extern PFNGLWINDOWPOS2IVPROC glad_debug_glWindowPos2iv;
+extern PFNGLWINDOWPOS2SPROC glad_debug_glWindowPos2s;
+extern PFNGLWINDOWPOS2SVPROC glad_debug_glWindowPos2sv;
+extern PFNGLWINDOWPOS3DPROC glad_debug_glWindowPos3d;
+extern PFNGLWINDOWPOS3DVPROC glad_debug_glWindowPos3dv;
+extern PFNGLWINDOWPOS3FPROC glad_debug_glWindowPos3f;
+extern PFNGLWINDOWPOS3FVPROC glad_debug_glWindowPos3fv;
+extern PFNGLWINDOWPOS3IPROC glad_debug_glWindowPos3i;
+extern PFNGLWINDOWPOS3IVPROC glad_debug_glWindowPos3iv;
+extern PFNGLWINDOWPOS3SPROC glad_debug_glWindowPos3s;
+extern PFNGLWINDOWPOS3SVPROC glad_debug_glWindowPos3sv;
+
+#ifdef __cplusplus
+}
+#endif
+
+#undef glAccum
+#define glAccum glad_debug_glAccum
+#undef glActiveShaderProgram
+#define glActiveShaderProgram glad_debug_glActiveShaderProgram
+#undef glActiveTexture
+#define glActiveTexture glad_debug_glActiveTexture
+#undef glAlphaFunc
+#define glAlphaFunc glad_debug_glAlphaFunc
+#undef glAreTexturesResident
+#define glAreTexturesResident glad_debug_glAreTexturesResident
+#undef glArrayElement
+#define glArrayElement glad_debug_glArrayElement
+#undef glAttachShader
+#define glAttachShader glad_debug_glAttachShader
+#undef glBegin
+#define glBegin glad_debug_glBegin
+#undef glBeginConditionalRender
+#define glBeginConditionalRender glad_debug_glBeginConditionalRender
+#undef glBeginQuery
+#define glBeginQuery glad_debug_glBeginQuery
+#undef glBeginQueryIndexed
+#define glBeginQueryIndexed glad_debug_glBeginQueryIndexed
+#undef glBeginTransformFeedback
+#define glBeginTransformFeedback glad_debug_glBeginTransformFeedback
+#undef glBindAttribLocation
+#define glBindAttribLocation glad_debug_glBindAttribLocation
+#undef glBindBuffer
+#define glBindBuffer glad_debug_glBindBuffer
+#undef glBindBufferBase
+#define glBindBufferBase glad_debug_glBindBufferBase
+#undef glBindBufferRange
+#define glBindBufferRange glad_debug_glBindBufferRange
+#undef glBindBuffersBase
+#define glBindBuffersBase glad_debug_glBindBuffersBase
+#undef glBindBuffersRange
+#define glBindBuffersRange glad_debug_glBindBuffersRange
+#undef glBindFragDataLocation
+#define glBindFragDataLocation glad_debug_glBindFragDataLocation
+#undef glBindFragDataLocationIndexed
+#define glBindFragDataLocationIndexed glad_debug_glBindFragDataLocationIndexed
+#undef glBindFramebuffer
+#define glBindFramebuffer glad_debug_glBindFramebuffer
+#undef glBindImageTexture
+#define glBindImageTexture glad_debug_glBindImageTexture
+#undef glBindImageTextures
+#define glBindImageTextures glad_debug_glBindImageTextures
+#undef glBindProgramPipeline
+#define glBindProgramPipeline glad_debug_glBindProgramPipeline
+#undef glBindRenderbuffer
+#define glBindRenderbuffer glad_debug_glBindRenderbuffer
+#undef glBindSampler
+#define glBindSampler glad_debug_glBindSampler
+#undef glBindSamplers
+#define glBindSamplers glad_debug_glBindSamplers
+#undef glBindTexture
+#define glBindTexture glad_debug_glBindTexture
+#undef glBindTextureUnit
+#define glBindTextureUnit glad_debug_glBindTextureUnit
+#undef glBindTextures
+#define glBindTextures glad_debug_glBindTextures
+#undef glBindTransformFeedback
+#define glBindTransformFeedback glad_debug_glBindTransformFeedback
+#undef glBindVertexArray
+#define glBindVertexArray glad_debug_glBindVertexArray
+#undef glBindVertexBuffer
+#define glBindVertexBuffer glad_debug_glBindVertexBuffer
+#undef glBindVertexBuffers
+#define glBindVertexBuffers glad_debug_glBindVertexBuffers
+#undef glBitmap
+#define glBitmap glad_debug_glBitmap
+#undef glBlendColor
+#define glBlendColor glad_debug_glBlendColor
+#undef glBlendEquation
+#define glBlendEquation glad_debug_glBlendEquation
+#undef glBlendEquationSeparate
+#define glBlendEquationSeparate glad_debug_glBlendEquationSeparate
+#undef glBlendEquationSeparatei
+#define glBlendEquationSeparatei glad_debug_glBlendEquationSeparatei
+#undef glBlendEquationi
+#define glBlendEquationi glad_debug_glBlendEquationi
+#undef glBlendFunc
+#define glBlendFunc glad_debug_glBlendFunc
+#undef glBlendFuncSeparate
+#define glBlendFuncSeparate glad_debug_glBlendFuncSeparate
+#undef glBlendFuncSeparatei
+#define glBlendFuncSeparatei glad_debug_glBlendFuncSeparatei
+#undef glBlendFunci
+#define glBlendFunci glad_debug_glBlendFunci
+#undef glBlitFramebuffer
+#define glBlitFramebuffer glad_debug_glBlitFramebuffer
+#undef glBlitNamedFramebuffer
+#define glBlitNamedFramebuffer glad_debug_glBlitNamedFramebuffer
+#undef glBufferData
+#define glBufferData glad_debug_glBufferData
+#undef glBufferStorage
+#define glBufferStorage glad_debug_glBufferStorage
+#undef glBufferSubData
+#define glBufferSubData glad_debug_glBufferSubData
+#undef glCallList
+#define glCallList glad_debug_glCallList
+#undef glCallLists
+#define glCallLists glad_debug_glCallLists
+#undef glCheckFramebufferStatus
+#define glCheckFramebufferStatus glad_debug_glCheckFramebufferStatus
+#undef glCheckNamedFramebufferStatus
+#define glCheckNamedFramebufferStatus glad_debug_glCheckNamedFramebufferStatus
+#undef glClampColor
+#define glClampColor glad_debug_glClampColor
+#undef glClear
+#define glClear glad_debug_glClear
+#undef glClearAccum
+#define glClearAccum glad_debug_glClearAccum
+#undef glClearBufferData
+#define glClearBufferData glad_debug_glClearBufferData
+#undef glClearBufferSubData
+#define glClearBufferSubData glad_debug_glClearBufferSubData
+#undef glClearBufferfi
+#define glClearBufferfi glad_debug_glClearBufferfi
+#undef glClearBufferfv
+#define glClearBufferfv glad_debug_glClearBufferfv
+#undef glClearBufferiv
+#define glClearBufferiv glad_debug_glClearBufferiv
+#undef glClearBufferuiv
+#define glClearBufferuiv glad_debug_glClearBufferuiv
+#undef glClearColor
+#define glClearColor glad_debug_glClearColor
+#undef glClearDepth
+#define glClearDepth glad_debug_glClearDepth
+#undef glClearDepthf
+#define glClearDepthf glad_debug_glClearDepthf
+#undef glClearIndex
+#define glClearIndex glad_debug_glClearIndex
+#undef glClearNamedBufferData
+#define glClearNamedBufferData glad_debug_glClearNamedBufferData
+#undef glClearNamedBufferSubData
+#define glClearNamedBufferSubData glad_debug_glClearNamedBufferSubData
+#undef glClearNamedFramebufferfi
+#define glClearNamedFramebufferfi glad_debug_glClearNamedFramebufferfi
+#undef glClearNamedFramebufferfv
+#define glClearNamedFramebufferfv glad_debug_glClearNamedFramebufferfv
+#undef glClearNamedFramebufferiv
+#define glClearNamedFramebufferiv glad_debug_glClearNamedFramebufferiv
+#undef glClearNamedFramebufferuiv
+#define glClearNamedFramebufferuiv glad_debug_glClearNamedFramebufferuiv
+#undef glClearStencil
+#define glClearStencil glad_debug_glClearStencil
+#undef glClearTexImage
+#define glClearTexImage glad_debug_glClearTexImage
+#undef glClearTexSubImage
+#define glClearTexSubImage glad_debug_glClearTexSubImage
+#undef glClientActiveTexture
+#define glClientActiveTexture glad_debug_glClientActiveTexture
+#undef glClientWaitSync
+#define glClientWaitSync glad_debug_glClientWaitSync
+#undef glClipControl
+#define glClipControl glad_debug_glClipControl
+#undef glClipPlane
+#define glClipPlane glad_debug_glClipPlane
+#undef glColor3b
+#define glColor3b glad_debug_glColor3b
+#undef glColor3bv
+#define glColor3bv glad_debug_glColor3bv
+#undef glColor3d
+#define glColor3d glad_debug_glColor3d
+#undef glColor3dv
+#define glColor3dv glad_debug_glColor3dv
+#undef glColor3f
+#define glColor3f glad_debug_glColor3f
+#undef glColor3fv
+#define glColor3fv glad_debug_glColor3fv
+#undef glColor3i
+#define glColor3i glad_debug_glColor3i
+#undef glColor3iv
+#define glColor3iv glad_debug_glColor3iv
+#undef glColor3s
+#define glColor3s glad_debug_glColor3s
+#undef glColor3sv
+#define glColor3sv glad_debug_glColor3sv
+#undef glColor3ub
+#define glColor3ub glad_debug_glColor3ub
+#undef glColor3ubv
+#define glColor3ubv glad_debug_glColor3ubv
+#undef glColor3ui
+#define glColor3ui glad_debug_glColor3ui
+#undef glColor3uiv
+#define glColor3uiv glad_debug_glColor3uiv
+#undef glColor3us
+#define glColor3us glad_debug_glColor3us
+#undef glColor3usv
+#define glColor3usv glad_debug_glColor3usv
+#undef glColor4b
+#define glColor4b glad_debug_glColor4b
+#undef glColor4bv
+#define glColor4bv glad_debug_glColor4bv
+#undef glColor4d
+#define glColor4d glad_debug_glColor4d
+#undef glColor4dv
+#define glColor4dv glad_debug_glColor4dv
+#undef glColor4f
+#define glColor4f glad_debug_glColor4f
+#undef glColor4fv
+#define glColor4fv glad_debug_glColor4fv
+#undef glColor4i
+#define glColor4i glad_debug_glColor4i
+#undef glColor4iv
+#define glColor4iv glad_debug_glColor4iv
+#undef glColor4s
+#define glColor4s glad_debug_glColor4s
+#undef glColor4sv
+#define glColor4sv glad_debug_glColor4sv
+#undef glColor4ub
+#define glColor4ub glad_debug_glColor4ub
+#undef glColor4ubv
+#define glColor4ubv glad_debug_glColor4ubv
+#undef glColor4ui
+#define glColor4ui glad_debug_glColor4ui
+#undef glColor4uiv
+#define glColor4uiv glad_debug_glColor4uiv
+#undef glColor4us
+#define glColor4us glad_debug_glColor4us
+#undef glColor4usv
+#define glColor4usv glad_debug_glColor4usv
+#undef glColorMask
+#define glColorMask glad_debug_glColorMask
+#undef glColorMaski
+#define glColorMaski glad_debug_glColorMaski
+#undef glColorMaterial
+#define glColorMaterial glad_debug_glColorMaterial
+#undef glColorP3ui
+#define glColorP3ui glad_debug_glColorP3ui
+#undef glColorP3uiv
+#define glColorP3uiv glad_debug_glColorP3uiv
+#undef glColorP4ui
+#define glColorP4ui glad_debug_glColorP4ui
+#undef glColorP4uiv
+#define glColorP4uiv glad_debug_glColorP4uiv
+#undef glColorPointer
+#define glColorPointer glad_debug_glColorPointer
+#undef glCompileShader
+#define glCompileShader glad_debug_glCompileShader
+#undef glCompressedTexImage1D
+#define glCompressedTexImage1D glad_debug_glCompressedTexImage1D
+#undef glCompressedTexImage2D
+#define glCompressedTexImage2D glad_debug_glCompressedTexImage2D
+#undef glCompressedTexImage3D
+#define glCompressedTexImage3D glad_debug_glCompressedTexImage3D
+#undef glCompressedTexSubImage1D
+#define glCompressedTexSubImage1D glad_debug_glCompressedTexSubImage1D
+#undef glCompressedTexSubImage2D
+#define glCompressedTexSubImage2D glad_debug_glCompressedTexSubImage2D
+#undef glCompressedTexSubImage3D
+#define glCompressedTexSubImage3D glad_debug_glCompressedTexSubImage3D
+#undef glCompressedTextureSubImage1D
+#define glCompressedTextureSubImage1D glad_debug_glCompressedTextureSubImage1D
+#undef glCompressedTextureSubImage2D
+#define glCompressedTextureSubImage2D glad_debug_glCompressedTextureSubImage2D
+#undef glCompressedTextureSubImage3D
+#define glCompressedTextureSubImage3D glad_debug_glCompressedTextureSubImage3D
+#undef glCopyBufferSubData
+#define glCopyBufferSubData glad_debug_glCopyBufferSubData
+#undef glCopyImageSubData
+#define glCopyImageSubData glad_debug_glCopyImageSubData
+#undef glCopyNamedBufferSubData
+#define glCopyNamedBufferSubData glad_debug_glCopyNamedBufferSubData
+#undef glCopyPixels
+#define glCopyPixels glad_debug_glCopyPixels
+#undef glCopyTexImage1D
+#define glCopyTexImage1D glad_debug_glCopyTexImage1D
+#undef glCopyTexImage2D
+#define glCopyTexImage2D glad_debug_glCopyTexImage2D
+#undef glCopyTexSubImage1D
+#define glCopyTexSubImage1D glad_debug_glCopyTexSubImage1D
+#undef glCopyTexSubImage2D
+#define glCopyTexSubImage2D glad_debug_glCopyTexSubImage2D
+#undef glCopyTexSubImage3D
+#define glCopyTexSubImage3D glad_debug_glCopyTexSubImage3D
+#undef glCopyTextureSubImage1D
+#define glCopyTextureSubImage1D glad_debug_glCopyTextureSubImage1D
+#undef glCopyTextureSubImage2D
+#define glCopyTextureSubImage2D glad_debug_glCopyTextureSubImage2D
+#undef glCopyTextureSubImage3D
+#define glCopyTextureSubImage3D glad_debug_glCopyTextureSubImage3D
+#undef glCreateBuffers
+#define glCreateBuffers glad_debug_glCreateBuffers
+#undef glCreateFramebuffers
+#define glCreateFramebuffers glad_debug_glCreateFramebuffers
+#undef glCreateProgram
+#define glCreateProgram glad_debug_glCreateProgram
+#undef glCreateProgramPipelines
+#define glCreateProgramPipelines glad_debug_glCreateProgramPipelines
+#undef glCreateQueries
+#define glCreateQueries glad_debug_glCreateQueries
+#undef glCreateRenderbuffers
+#define glCreateRenderbuffers glad_debug_glCreateRenderbuffers
+#undef glCreateSamplers
+#define glCreateSamplers glad_debug_glCreateSamplers
+#undef glCreateShader
+#define glCreateShader glad_debug_glCreateShader
+#undef glCreateShaderProgramv
+#define glCreateShaderProgramv glad_debug_glCreateShaderProgramv
+#undef glCreateTextures
+#define glCreateTextures glad_debug_glCreateTextures
+#undef glCreateTransformFeedbacks
+#define glCreateTransformFeedbacks glad_debug_glCreateTransformFeedbacks
+#undef glCreateVertexArrays
+#define glCreateVertexArrays glad_debug_glCreateVertexArrays
+#undef glCullFace
+#define glCullFace glad_debug_glCullFace
+#undef glDebugMessageCallback
+#define glDebugMessageCallback glad_debug_glDebugMessageCallback
+#undef glDebugMessageControl
+#define glDebugMessageControl glad_debug_glDebugMessageControl
+#undef glDebugMessageInsert
+#define glDebugMessageInsert glad_debug_glDebugMessageInsert
+#undef glDeleteBuffers
+#define glDeleteBuffers glad_debug_glDeleteBuffers
+#undef glDeleteFramebuffers
+#define glDeleteFramebuffers glad_debug_glDeleteFramebuffers
+#undef glDeleteLists
+#define glDeleteLists glad_debug_glDeleteLists
+#undef glDeleteProgram
+#define glDeleteProgram glad_debug_glDeleteProgram
+#undef glDeleteProgramPipelines
+#define glDeleteProgramPipelines glad_debug_glDeleteProgramPipelines
+#undef glDeleteQueries
+#define glDeleteQueries glad_debug_glDeleteQueries
+#undef glDeleteRenderbuffers
+#define glDeleteRenderbuffers glad_debug_glDeleteRenderbuffers
+#undef glDeleteSamplers
+#define glDeleteSamplers glad_debug_glDeleteSamplers
+#undef glDeleteShader
+#define glDeleteShader glad_debug_glDeleteShader
+#undef glDeleteSync
+#define glDeleteSync glad_debug_glDeleteSync
+#undef glDeleteTextures
+#define glDeleteTextures glad_debug_glDeleteTextures
+#undef glDeleteTransformFeedbacks
+#define glDeleteTransformFeedbacks glad_debug_glDeleteTransformFeedbacks
+#undef glDeleteVertexArrays
+#define glDeleteVertexArrays glad_debug_glDeleteVertexArrays
+#undef glDepthFunc
+#define glDepthFunc glad_debug_glDepthFunc
+#undef glDepthMask
+#define glDepthMask glad_debug_glDepthMask
+#undef glDepthRange
+#define glDepthRange glad_debug_glDepthRange
+#undef glDepthRangeArrayv
+#define glDepthRangeArrayv glad_debug_glDepthRangeArrayv
+#undef glDepthRangeIndexed
+#define glDepthRangeIndexed glad_debug_glDepthRangeIndexed
+#undef glDepthRangef
+#define glDepthRangef glad_debug_glDepthRangef
+#undef glDetachShader
+#define glDetachShader glad_debug_glDetachShader
+#undef glDisable
+#define glDisable glad_debug_glDisable
+#undef glDisableClientState
+#define glDisableClientState glad_debug_glDisableClientState
+#undef glDisableVertexArrayAttrib
+#define glDisableVertexArrayAttrib glad_debug_glDisableVertexArrayAttrib
+#undef glDisableVertexAttribArray
+#define glDisableVertexAttribArray glad_debug_glDisableVertexAttribArray
+#undef glDisablei
+#define glDisablei glad_debug_glDisablei
+#undef glDispatchCompute
+#define glDispatchCompute glad_debug_glDispatchCompute
+#undef glDispatchComputeIndirect
+#define glDispatchComputeIndirect glad_debug_glDispatchComputeIndirect
+#undef glDrawArrays
+#define glDrawArrays glad_debug_glDrawArrays
+#undef glDrawArraysIndirect
+#define glDrawArraysIndirect glad_debug_glDrawArraysIndirect
+#undef glDrawArraysInstanced
+#define glDrawArraysInstanced glad_debug_glDrawArraysInstanced
+#undef glDrawArraysInstancedBaseInstance
+#define glDrawArraysInstancedBaseInstance glad_debug_glDrawArraysInstancedBaseInstance
+#undef glDrawBuffer
+#define glDrawBuffer glad_debug_glDrawBuffer
+#undef glDrawBuffers
+#define glDrawBuffers glad_debug_glDrawBuffers
+#undef glDrawElements
+#define glDrawElements glad_debug_glDrawElements
+#undef glDrawElementsBaseVertex
+#define glDrawElementsBaseVertex glad_debug_glDrawElementsBaseVertex
+#undef glDrawElementsIndirect
+#define glDrawElementsIndirect glad_debug_glDrawElementsIndirect
+#undef glDrawElementsInstanced
+#define glDrawElementsInstanced glad_debug_glDrawElementsInstanced
+#undef glDrawElementsInstancedBaseInstance
+#define glDrawElementsInstancedBaseInstance glad_debug_glDrawElementsInstancedBaseInstance
+#undef glDrawElementsInstancedBaseVertex
+#define glDrawElementsInstancedBaseVertex glad_debug_glDrawElementsInstancedBaseVertex
+#undef glDrawElementsInstancedBaseVertexBaseInstance
+#define glDrawElementsInstancedBaseVertexBaseInstance glad_debug_glDrawElementsInstancedBaseVertexBaseInstance
+#undef glDrawPixels
+#define glDrawPixels glad_debug_glDrawPixels
+#undef glDrawRangeElements
+#define glDrawRangeElements glad_debug_glDrawRangeElements
+#undef glDrawRangeElementsBaseVertex
+#define glDrawRangeElementsBaseVertex glad_debug_glDrawRangeElementsBaseVertex
+#undef glDrawTransformFeedback
+#define glDrawTransformFeedback glad_debug_glDrawTransformFeedback
+#undef glDrawTransformFeedbackInstanced
+#define glDrawTransformFeedbackInstanced glad_debug_glDrawTransformFeedbackInstanced
+#undef glDrawTransformFeedbackStream
+#define glDrawTransformFeedbackStream glad_debug_glDrawTransformFeedbackStream
+#undef glDrawTransformFeedbackStreamInstanced
+#define glDrawTransformFeedbackStreamInstanced glad_debug_glDrawTransformFeedbackStreamInstanced
+#undef glEdgeFlag
+#define glEdgeFlag glad_debug_glEdgeFlag
+#undef glEdgeFlagPointer
+#define glEdgeFlagPointer glad_debug_glEdgeFlagPointer
+#undef glEdgeFlagv
+#define glEdgeFlagv glad_debug_glEdgeFlagv
+#undef glEnable
+#define glEnable glad_debug_glEnable
+#undef glEnableClientState
+#define glEnableClientState glad_debug_glEnableClientState
+#undef glEnableVertexArrayAttrib
+#define glEnableVertexArrayAttrib glad_debug_glEnableVertexArrayAttrib
+#undef glEnableVertexAttribArray
+#define glEnableVertexAttribArray glad_debug_glEnableVertexAttribArray
+#undef glEnablei
+#define glEnablei glad_debug_glEnablei
+#undef glEnd
+#define glEnd glad_debug_glEnd
+#undef glEndConditionalRender
+#define glEndConditionalRender glad_debug_glEndConditionalRender
+#undef glEndList
+#define glEndList glad_debug_glEndList
+#undef glEndQuery
+#define glEndQuery glad_debug_glEndQuery
+#undef glEndQueryIndexed
+#define glEndQueryIndexed glad_debug_glEndQueryIndexed
+#undef glEndTransformFeedback
+#define glEndTransformFeedback glad_debug_glEndTransformFeedback
+#undef glEvalCoord1d
+#define glEvalCoord1d glad_debug_glEvalCoord1d
+#undef glEvalCoord1dv
+#define glEvalCoord1dv glad_debug_glEvalCoord1dv
+#undef glEvalCoord1f
+#define glEvalCoord1f glad_debug_glEvalCoord1f
+#undef glEvalCoord1fv
+#define glEvalCoord1fv glad_debug_glEvalCoord1fv
+#undef glEvalCoord2d
+#define glEvalCoord2d glad_debug_glEvalCoord2d
+#undef glEvalCoord2dv
+#define glEvalCoord2dv glad_debug_glEvalCoord2dv
+#undef glEvalCoord2f
+#define glEvalCoord2f glad_debug_glEvalCoord2f
+#undef glEvalCoord2fv
+#define glEvalCoord2fv glad_debug_glEvalCoord2fv
+#undef glEvalMesh1
+#define glEvalMesh1 glad_debug_glEvalMesh1
+#undef glEvalMesh2
+#define glEvalMesh2 glad_debug_glEvalMesh2
+#undef glEvalPoint1
+#define glEvalPoint1 glad_debug_glEvalPoint1
+#undef glEvalPoint2
+#define glEvalPoint2 glad_debug_glEvalPoint2
+#undef glFeedbackBuffer
+#define glFeedbackBuffer glad_debug_glFeedbackBuffer
+#undef glFenceSync
+#define glFenceSync glad_debug_glFenceSync
+#undef glFinish
+#define glFinish glad_debug_glFinish
+#undef glFlush
+#define glFlush glad_debug_glFlush
+#undef glFlushMappedBufferRange
+#define glFlushMappedBufferRange glad_debug_glFlushMappedBufferRange
+#undef glFlushMappedNamedBufferRange
+#define glFlushMappedNamedBufferRange glad_debug_glFlushMappedNamedBufferRange
+#undef glFogCoordPointer
+#define glFogCoordPointer glad_debug_glFogCoordPointer
+#undef glFogCoordd
+#define glFogCoordd glad_debug_glFogCoordd
+#undef glFogCoorddv
+#define glFogCoorddv glad_debug_glFogCoorddv
+#undef glFogCoordf
+#define glFogCoordf glad_debug_glFogCoordf
+#undef glFogCoordfv
+#define glFogCoordfv glad_debug_glFogCoordfv
+#undef glFogf
+#define glFogf glad_debug_glFogf
+#undef glFogfv
+#define glFogfv glad_debug_glFogfv
+#undef glFogi
+#define glFogi glad_debug_glFogi
+#undef glFogiv
+#define glFogiv glad_debug_glFogiv
+#undef glFramebufferParameteri
+#define glFramebufferParameteri glad_debug_glFramebufferParameteri
+#undef glFramebufferRenderbuffer
+#define glFramebufferRenderbuffer glad_debug_glFramebufferRenderbuffer
+#undef glFramebufferTexture
+#define glFramebufferTexture glad_debug_glFramebufferTexture
+#undef glFramebufferTexture1D
+#define glFramebufferTexture1D glad_debug_glFramebufferTexture1D
+#undef glFramebufferTexture2D
+#define glFramebufferTexture2D glad_debug_glFramebufferTexture2D
+#undef glFramebufferTexture3D
+#define glFramebufferTexture3D glad_debug_glFramebufferTexture3D
+#undef glFramebufferTextureLayer
+#define glFramebufferTextureLayer glad_debug_glFramebufferTextureLayer
+#undef glFrontFace
+#define glFrontFace glad_debug_glFrontFace
+#undef glFrustum
+#define glFrustum glad_debug_glFrustum
+#undef glGenBuffers
+#define glGenBuffers glad_debug_glGenBuffers
+#undef glGenFramebuffers
+#define glGenFramebuffers glad_debug_glGenFramebuffers
+#undef glGenLists
+#define glGenLists glad_debug_glGenLists
+#undef glGenProgramPipelines
+#define glGenProgramPipelines glad_debug_glGenProgramPipelines
+#undef glGenQueries
+#define glGenQueries glad_debug_glGenQueries
+#undef glGenRenderbuffers
+#define glGenRenderbuffers glad_debug_glGenRenderbuffers
+#undef glGenSamplers
+#define glGenSamplers glad_debug_glGenSamplers
+#undef glGenTextures
+#define glGenTextures glad_debug_glGenTextures
+#undef glGenTransformFeedbacks
+#define glGenTransformFeedbacks glad_debug_glGenTransformFeedbacks
+#undef glGenVertexArrays
+#define glGenVertexArrays glad_debug_glGenVertexArrays
+#undef glGenerateMipmap
+#define glGenerateMipmap glad_debug_glGenerateMipmap
+#undef glGenerateTextureMipmap
+#define glGenerateTextureMipmap glad_debug_glGenerateTextureMipmap
+#undef glGetActiveAtomicCounterBufferiv
+#define glGetActiveAtomicCounterBufferiv glad_debug_glGetActiveAtomicCounterBufferiv
+#undef glGetActiveAttrib
+#define glGetActiveAttrib glad_debug_glGetActiveAttrib
+#undef glGetActiveSubroutineName
+#define glGetActiveSubroutineName glad_debug_glGetActiveSubroutineName
+#undef glGetActiveSubroutineUniformName
+#define glGetActiveSubroutineUniformName glad_debug_glGetActiveSubroutineUniformName
+#undef glGetActiveSubroutineUniformiv
+#define glGetActiveSubroutineUniformiv glad_debug_glGetActiveSubroutineUniformiv
+#undef glGetActiveUniform
+#define glGetActiveUniform glad_debug_glGetActiveUniform
+#undef glGetActiveUniformBlockName
+#define glGetActiveUniformBlockName glad_debug_glGetActiveUniformBlockName
+#undef glGetActiveUniformBlockiv
+#define glGetActiveUniformBlockiv glad_debug_glGetActiveUniformBlockiv
+#undef glGetActiveUniformName
+#define glGetActiveUniformName glad_debug_glGetActiveUniformName
+#undef glGetActiveUniformsiv
+#define glGetActiveUniformsiv glad_debug_glGetActiveUniformsiv
+#undef glGetAttachedShaders
+#define glGetAttachedShaders glad_debug_glGetAttachedShaders
+#undef glGetAttribLocation
+#define glGetAttribLocation glad_debug_glGetAttribLocation
+#undef glGetBooleani_v
+#define glGetBooleani_v glad_debug_glGetBooleani_v
+#undef glGetBooleanv
+#define glGetBooleanv glad_debug_glGetBooleanv
+#undef glGetBufferParameteri64v
+#define glGetBufferParameteri64v glad_debug_glGetBufferParameteri64v
+#undef glGetBufferParameteriv
+#define glGetBufferParameteriv glad_debug_glGetBufferParameteriv
+#undef glGetBufferPointerv
+#define glGetBufferPointerv glad_debug_glGetBufferPointerv
+#undef glGetBufferSubData
+#define glGetBufferSubData glad_debug_glGetBufferSubData
+#undef glGetClipPlane
+#define glGetClipPlane glad_debug_glGetClipPlane
+#undef glGetCompressedTexImage
+#define glGetCompressedTexImage glad_debug_glGetCompressedTexImage
+#undef glGetCompressedTextureImage
+#define glGetCompressedTextureImage glad_debug_glGetCompressedTextureImage
+#undef glGetCompressedTextureSubImage
+#define glGetCompressedTextureSubImage glad_debug_glGetCompressedTextureSubImage
+#undef glGetDebugMessageLog
+#define glGetDebugMessageLog glad_debug_glGetDebugMessageLog
+#undef glGetDoublei_v
+#define glGetDoublei_v glad_debug_glGetDoublei_v
+#undef glGetDoublev
+#define glGetDoublev glad_debug_glGetDoublev
+#undef glGetError
+#define glGetError glad_debug_glGetError
+#undef glGetFloati_v
+#define glGetFloati_v glad_debug_glGetFloati_v
+#undef glGetFloatv
+#define glGetFloatv glad_debug_glGetFloatv
+#undef glGetFragDataIndex
+#define glGetFragDataIndex glad_debug_glGetFragDataIndex
+#undef glGetFragDataLocation
+#define glGetFragDataLocation glad_debug_glGetFragDataLocation
+#undef glGetFramebufferAttachmentParameteriv
+#define glGetFramebufferAttachmentParameteriv glad_debug_glGetFramebufferAttachmentParameteriv
+#undef glGetFramebufferParameteriv
+#define glGetFramebufferParameteriv glad_debug_glGetFramebufferParameteriv
+#undef glGetGraphicsResetStatus
+#define glGetGraphicsResetStatus glad_debug_glGetGraphicsResetStatus
+#undef glGetImageHandleARB
+#define glGetImageHandleARB glad_debug_glGetImageHandleARB
+#undef glGetInteger64i_v
+#define glGetInteger64i_v glad_debug_glGetInteger64i_v
+#undef glGetInteger64v
+#define glGetInteger64v glad_debug_glGetInteger64v
+#undef glGetIntegeri_v
+#define glGetIntegeri_v glad_debug_glGetIntegeri_v
+#undef glGetIntegerv
+#define glGetIntegerv glad_debug_glGetIntegerv
+#undef glGetInternalformati64v
+#define glGetInternalformati64v glad_debug_glGetInternalformati64v
+#undef glGetInternalformativ
+#define glGetInternalformativ glad_debug_glGetInternalformativ
+#undef glGetLightfv
+#define glGetLightfv glad_debug_glGetLightfv
+#undef glGetLightiv
+#define glGetLightiv glad_debug_glGetLightiv
+#undef glGetMapdv
+#define glGetMapdv glad_debug_glGetMapdv
+#undef glGetMapfv
+#define glGetMapfv glad_debug_glGetMapfv
+#undef glGetMapiv
+#define glGetMapiv glad_debug_glGetMapiv
+#undef glGetMaterialfv
+#define glGetMaterialfv glad_debug_glGetMaterialfv
+#undef glGetMaterialiv
+#define glGetMaterialiv glad_debug_glGetMaterialiv
+#undef glGetMultisamplefv
+#define glGetMultisamplefv glad_debug_glGetMultisamplefv
+#undef glGetNamedBufferParameteri64v
+#define glGetNamedBufferParameteri64v glad_debug_glGetNamedBufferParameteri64v
+#undef glGetNamedBufferParameteriv
+#define glGetNamedBufferParameteriv glad_debug_glGetNamedBufferParameteriv
+#undef glGetNamedBufferPointerv
+#define glGetNamedBufferPointerv glad_debug_glGetNamedBufferPointerv
+#undef glGetNamedBufferSubData
+#define glGetNamedBufferSubData glad_debug_glGetNamedBufferSubData
+#undef glGetNamedFramebufferAttachmentParameteriv
+#define glGetNamedFramebufferAttachmentParameteriv glad_debug_glGetNamedFramebufferAttachmentParameteriv
+#undef glGetNamedFramebufferParameteriv
+#define glGetNamedFramebufferParameteriv glad_debug_glGetNamedFramebufferParameteriv
+#undef glGetNamedRenderbufferParameteriv
+#define glGetNamedRenderbufferParameteriv glad_debug_glGetNamedRenderbufferParameteriv
+#undef glGetObjectLabel
+#define glGetObjectLabel glad_debug_glGetObjectLabel
+#undef glGetObjectPtrLabel
+#define glGetObjectPtrLabel glad_debug_glGetObjectPtrLabel
+#undef glGetPixelMapfv
+#define glGetPixelMapfv glad_debug_glGetPixelMapfv
+#undef glGetPixelMapuiv
+#define glGetPixelMapuiv glad_debug_glGetPixelMapuiv
+#undef glGetPixelMapusv
+#define glGetPixelMapusv glad_debug_glGetPixelMapusv
+#undef glGetPointerv
+#define glGetPointerv glad_debug_glGetPointerv
+#undef glGetPolygonStipple
+#define glGetPolygonStipple glad_debug_glGetPolygonStipple
+#undef glGetProgramBinary
+#define glGetProgramBinary glad_debug_glGetProgramBinary
+#undef glGetProgramInfoLog
+#define glGetProgramInfoLog glad_debug_glGetProgramInfoLog
+#undef glGetProgramInterfaceiv
+#define glGetProgramInterfaceiv glad_debug_glGetProgramInterfaceiv
+#undef glGetProgramPipelineInfoLog
+#define glGetProgramPipelineInfoLog glad_debug_glGetProgramPipelineInfoLog
+#undef glGetProgramPipelineiv
+#define glGetProgramPipelineiv glad_debug_glGetProgramPipelineiv
+#undef glGetProgramResourceIndex
+#define glGetProgramResourceIndex glad_debug_glGetProgramResourceIndex
+#undef glGetProgramResourceLocation
+#define glGetProgramResourceLocation glad_debug_glGetProgramResourceLocation
+#undef glGetProgramResourceLocationIndex
+#define glGetProgramResourceLocationIndex glad_debug_glGetProgramResourceLocationIndex
+#undef glGetProgramResourceName
+#define glGetProgramResourceName glad_debug_glGetProgramResourceName
+#undef glGetProgramResourceiv
+#define glGetProgramResourceiv glad_debug_glGetProgramResourceiv
+#undef glGetProgramStageiv
+#define glGetProgramStageiv glad_debug_glGetProgramStageiv
+#undef glGetProgramiv
+#define glGetProgramiv glad_debug_glGetProgramiv
+#undef glGetQueryBufferObjecti64v
+#define glGetQueryBufferObjecti64v glad_debug_glGetQueryBufferObjecti64v
+#undef glGetQueryBufferObjectiv
+#define glGetQueryBufferObjectiv glad_debug_glGetQueryBufferObjectiv
+#undef glGetQueryBufferObjectui64v
+#define glGetQueryBufferObjectui64v glad_debug_glGetQueryBufferObjectui64v
+#undef glGetQueryBufferObjectuiv
+#define glGetQueryBufferObjectuiv glad_debug_glGetQueryBufferObjectuiv
+#undef glGetQueryIndexediv
+#define glGetQueryIndexediv glad_debug_glGetQueryIndexediv
+#undef glGetQueryObjecti64v
+#define glGetQueryObjecti64v glad_debug_glGetQueryObjecti64v
+#undef glGetQueryObjectiv
+#define glGetQueryObjectiv glad_debug_glGetQueryObjectiv
+#undef glGetQueryObjectui64v
+#define glGetQueryObjectui64v glad_debug_glGetQueryObjectui64v
+#undef glGetQueryObjectuiv
+#define glGetQueryObjectuiv glad_debug_glGetQueryObjectuiv
+#undef glGetQueryiv
+#define glGetQueryiv glad_debug_glGetQueryiv
+#undef glGetRenderbufferParameteriv
+#define glGetRenderbufferParameteriv glad_debug_glGetRenderbufferParameteriv
+#undef glGetSamplerParameterIiv
+#define glGetSamplerParameterIiv glad_debug_glGetSamplerParameterIiv
+#undef glGetSamplerParameterIuiv
+#define glGetSamplerParameterIuiv glad_debug_glGetSamplerParameterIuiv
+#undef glGetSamplerParameterfv
+#define glGetSamplerParameterfv glad_debug_glGetSamplerParameterfv
+#undef glGetSamplerParameteriv
+#define glGetSamplerParameteriv glad_debug_glGetSamplerParameteriv
+#undef glGetShaderInfoLog
+#define glGetShaderInfoLog glad_debug_glGetShaderInfoLog
+#undef glGetShaderPrecisionFormat
+#define glGetShaderPrecisionFormat glad_debug_glGetShaderPrecisionFormat
+#undef glGetShaderSource
+#define glGetShaderSource glad_debug_glGetShaderSource
+#undef glGetShaderiv
+#define glGetShaderiv glad_debug_glGetShaderiv
+#undef glGetString
+#define glGetString glad_debug_glGetString
+#undef glGetStringi
+#define glGetStringi glad_debug_glGetStringi
+#undef glGetSubroutineIndex
+#define glGetSubroutineIndex glad_debug_glGetSubroutineIndex
+#undef glGetSubroutineUniformLocation
+#define glGetSubroutineUniformLocation glad_debug_glGetSubroutineUniformLocation
+#undef glGetSynciv
+#define glGetSynciv glad_debug_glGetSynciv
+#undef glGetTexEnvfv
+#define glGetTexEnvfv glad_debug_glGetTexEnvfv
+#undef glGetTexEnviv
+#define glGetTexEnviv glad_debug_glGetTexEnviv
+#undef glGetTexGendv
+#define glGetTexGendv glad_debug_glGetTexGendv
+#undef glGetTexGenfv
+#define glGetTexGenfv glad_debug_glGetTexGenfv
+#undef glGetTexGeniv
+#define glGetTexGeniv glad_debug_glGetTexGeniv
+#undef glGetTexImage
+#define glGetTexImage glad_debug_glGetTexImage
+#undef glGetTexLevelParameterfv
+#define glGetTexLevelParameterfv glad_debug_glGetTexLevelParameterfv
+#undef glGetTexLevelParameteriv
+#define glGetTexLevelParameteriv glad_debug_glGetTexLevelParameteriv
+#undef glGetTexParameterIiv
+#define glGetTexParameterIiv glad_debug_glGetTexParameterIiv
+#undef glGetTexParameterIuiv
+#define glGetTexParameterIuiv glad_debug_glGetTexParameterIuiv
+#undef glGetTexParameterfv
+#define glGetTexParameterfv glad_debug_glGetTexParameterfv
+#undef glGetTexParameteriv
+#define glGetTexParameteriv glad_debug_glGetTexParameteriv
+#undef glGetTextureHandleARB
+#define glGetTextureHandleARB glad_debug_glGetTextureHandleARB
+#undef glGetTextureImage
+#define glGetTextureImage glad_debug_glGetTextureImage
+#undef glGetTextureLevelParameterfv
+#define glGetTextureLevelParameterfv glad_debug_glGetTextureLevelParameterfv
+#undef glGetTextureLevelParameteriv
+#define glGetTextureLevelParameteriv glad_debug_glGetTextureLevelParameteriv
+#undef glGetTextureParameterIiv
+#define glGetTextureParameterIiv glad_debug_glGetTextureParameterIiv
+#undef glGetTextureParameterIuiv
+#define glGetTextureParameterIuiv glad_debug_glGetTextureParameterIuiv
+#undef glGetTextureParameterfv
+#define glGetTextureParameterfv glad_debug_glGetTextureParameterfv
+#undef glGetTextureParameteriv
+#define glGetTextureParameteriv glad_debug_glGetTextureParameteriv
+#undef glGetTextureSamplerHandleARB
+#define glGetTextureSamplerHandleARB glad_debug_glGetTextureSamplerHandleARB
+#undef glGetTextureSubImage
+#define glGetTextureSubImage glad_debug_glGetTextureSubImage
+#undef glGetTransformFeedbackVarying
+#define glGetTransformFeedbackVarying glad_debug_glGetTransformFeedbackVarying
+#undef glGetTransformFeedbacki64_v
+#define glGetTransformFeedbacki64_v glad_debug_glGetTransformFeedbacki64_v
+#undef glGetTransformFeedbacki_v
+#define glGetTransformFeedbacki_v glad_debug_glGetTransformFeedbacki_v
+#undef glGetTransformFeedbackiv
+#define glGetTransformFeedbackiv glad_debug_glGetTransformFeedbackiv
+#undef glGetUniformBlockIndex
+#define glGetUniformBlockIndex glad_debug_glGetUniformBlockIndex
+#undef glGetUniformIndices
+#define glGetUniformIndices glad_debug_glGetUniformIndices
+#undef glGetUniformLocation
+#define glGetUniformLocation glad_debug_glGetUniformLocation
+#undef glGetUniformSubroutineuiv
+#define glGetUniformSubroutineuiv glad_debug_glGetUniformSubroutineuiv
+#undef glGetUniformdv
+#define glGetUniformdv glad_debug_glGetUniformdv
+#undef glGetUniformfv
+#define glGetUniformfv glad_debug_glGetUniformfv
+#undef glGetUniformiv
+#define glGetUniformiv glad_debug_glGetUniformiv
+#undef glGetUniformuiv
+#define glGetUniformuiv glad_debug_glGetUniformuiv
+#undef glGetVertexArrayIndexed64iv
+#define glGetVertexArrayIndexed64iv glad_debug_glGetVertexArrayIndexed64iv
+#undef glGetVertexArrayIndexediv
+#define glGetVertexArrayIndexediv glad_debug_glGetVertexArrayIndexediv
+#undef glGetVertexArrayiv
+#define glGetVertexArrayiv glad_debug_glGetVertexArrayiv
+#undef glGetVertexAttribIiv
+#define glGetVertexAttribIiv glad_debug_glGetVertexAttribIiv
+#undef glGetVertexAttribIuiv
+#define glGetVertexAttribIuiv glad_debug_glGetVertexAttribIuiv
+#undef glGetVertexAttribLdv
+#define glGetVertexAttribLdv glad_debug_glGetVertexAttribLdv
+#undef glGetVertexAttribLui64vARB
+#define glGetVertexAttribLui64vARB glad_debug_glGetVertexAttribLui64vARB
+#undef glGetVertexAttribPointerv
+#define glGetVertexAttribPointerv glad_debug_glGetVertexAttribPointerv
+#undef glGetVertexAttribdv
+#define glGetVertexAttribdv glad_debug_glGetVertexAttribdv
+#undef glGetVertexAttribfv
+#define glGetVertexAttribfv glad_debug_glGetVertexAttribfv
+#undef glGetVertexAttribiv
+#define glGetVertexAttribiv glad_debug_glGetVertexAttribiv
+#undef glGetnColorTable
+#define glGetnColorTable glad_debug_glGetnColorTable
+#undef glGetnCompressedTexImage
+#define glGetnCompressedTexImage glad_debug_glGetnCompressedTexImage
+#undef glGetnConvolutionFilter
+#define glGetnConvolutionFilter glad_debug_glGetnConvolutionFilter
+#undef glGetnHistogram
+#define glGetnHistogram glad_debug_glGetnHistogram
+#undef glGetnMapdv
+#define glGetnMapdv glad_debug_glGetnMapdv
+#undef glGetnMapfv
+#define glGetnMapfv glad_debug_glGetnMapfv
+#undef glGetnMapiv
+#define glGetnMapiv glad_debug_glGetnMapiv
+#undef glGetnMinmax
+#define glGetnMinmax glad_debug_glGetnMinmax
+#undef glGetnPixelMapfv
+#define glGetnPixelMapfv glad_debug_glGetnPixelMapfv
+#undef glGetnPixelMapuiv
+#define glGetnPixelMapuiv glad_debug_glGetnPixelMapuiv
+#undef glGetnPixelMapusv
+#define glGetnPixelMapusv glad_debug_glGetnPixelMapusv
+#undef glGetnPolygonStipple
+#define glGetnPolygonStipple glad_debug_glGetnPolygonStipple
+#undef glGetnSeparableFilter
+#define glGetnSeparableFilter glad_debug_glGetnSeparableFilter
+#undef glGetnTexImage
+#define glGetnTexImage glad_debug_glGetnTexImage
+#undef glGetnUniformdv
+#define glGetnUniformdv glad_debug_glGetnUniformdv
+#undef glGetnUniformfv
+#define glGetnUniformfv glad_debug_glGetnUniformfv
+#undef glGetnUniformiv
+#define glGetnUniformiv glad_debug_glGetnUniformiv
+#undef glGetnUniformuiv
+#define glGetnUniformuiv glad_debug_glGetnUniformuiv
+#undef glHint
+#define glHint glad_debug_glHint
+#undef glIndexMask
+#define glIndexMask glad_debug_glIndexMask
+#undef glIndexPointer
+#define glIndexPointer glad_debug_glIndexPointer
+#undef glIndexd
+#define glIndexd glad_debug_glIndexd
+#undef glIndexdv
+#define glIndexdv glad_debug_glIndexdv
+#undef glIndexf
+#define glIndexf glad_debug_glIndexf
+#undef glIndexfv
+#define glIndexfv glad_debug_glIndexfv
+#undef glIndexi
+#define glIndexi glad_debug_glIndexi
+#undef glIndexiv
+#define glIndexiv glad_debug_glIndexiv
+#undef glIndexs
+#define glIndexs glad_debug_glIndexs
+#undef glIndexsv
+#define glIndexsv glad_debug_glIndexsv
+#undef glIndexub
+#define glIndexub glad_debug_glIndexub
+#undef glIndexubv
+#define glIndexubv glad_debug_glIndexubv
+#undef glInitNames
+#define glInitNames glad_debug_glInitNames
+#undef glInterleavedArrays
+#define glInterleavedArrays glad_debug_glInterleavedArrays
+#undef glInvalidateBufferData
+#define glInvalidateBufferData glad_debug_glInvalidateBufferData
+#undef glInvalidateBufferSubData
+#define glInvalidateBufferSubData glad_debug_glInvalidateBufferSubData
+#undef glInvalidateFramebuffer
+#define glInvalidateFramebuffer glad_debug_glInvalidateFramebuffer
+#undef glInvalidateNamedFramebufferData
+#define glInvalidateNamedFramebufferData glad_debug_glInvalidateNamedFramebufferData
+#undef glInvalidateNamedFramebufferSubData
+#define glInvalidateNamedFramebufferSubData glad_debug_glInvalidateNamedFramebufferSubData
+#undef glInvalidateSubFramebuffer
+#define glInvalidateSubFramebuffer glad_debug_glInvalidateSubFramebuffer
+#undef glInvalidateTexImage
+#define glInvalidateTexImage glad_debug_glInvalidateTexImage
+#undef glInvalidateTexSubImage
+#define glInvalidateTexSubImage glad_debug_glInvalidateTexSubImage
+#undef glIsBuffer
+#define glIsBuffer glad_debug_glIsBuffer
+#undef glIsEnabled
+#define glIsEnabled glad_debug_glIsEnabled
+#undef glIsEnabledi
+#define glIsEnabledi glad_debug_glIsEnabledi
+#undef glIsFramebuffer
+#define glIsFramebuffer glad_debug_glIsFramebuffer
+#undef glIsImageHandleResidentARB
+#define glIsImageHandleResidentARB glad_debug_glIsImageHandleResidentARB
+#undef glIsList
+#define glIsList glad_debug_glIsList
+#undef glIsProgram
+#define glIsProgram glad_debug_glIsProgram
+#undef glIsProgramPipeline
+#define glIsProgramPipeline glad_debug_glIsProgramPipeline
+#undef glIsQuery
+#define glIsQuery glad_debug_glIsQuery
+#undef glIsRenderbuffer
+#define glIsRenderbuffer glad_debug_glIsRenderbuffer
+#undef glIsSampler
+#define glIsSampler glad_debug_glIsSampler
+#undef glIsShader
+#define glIsShader glad_debug_glIsShader
+#undef glIsSync
+#define glIsSync glad_debug_glIsSync
+#undef glIsTexture
+#define glIsTexture glad_debug_glIsTexture
+#undef glIsTextureHandleResidentARB
+#define glIsTextureHandleResidentARB glad_debug_glIsTextureHandleResidentARB
+#undef glIsTransformFeedback
+#define glIsTransformFeedback glad_debug_glIsTransformFeedback
+#undef glIsVertexArray
+#define glIsVertexArray glad_debug_glIsVertexArray
+#undef glLightModelf
+#define glLightModelf glad_debug_glLightModelf
+#undef glLightModelfv
+#define glLightModelfv glad_debug_glLightModelfv
+#undef glLightModeli
+#define glLightModeli glad_debug_glLightModeli
+#undef glLightModeliv
+#define glLightModeliv glad_debug_glLightModeliv
+#undef glLightf
+#define glLightf glad_debug_glLightf
+#undef glLightfv
+#define glLightfv glad_debug_glLightfv
+#undef glLighti
+#define glLighti glad_debug_glLighti
+#undef glLightiv
+#define glLightiv glad_debug_glLightiv
+#undef glLineStipple
+#define glLineStipple glad_debug_glLineStipple
+#undef glLineWidth
+#define glLineWidth glad_debug_glLineWidth
+#undef glLinkProgram
+#define glLinkProgram glad_debug_glLinkProgram
+#undef glListBase
+#define glListBase glad_debug_glListBase
+#undef glLoadIdentity
+#define glLoadIdentity glad_debug_glLoadIdentity
+#undef glLoadMatrixd
+#define glLoadMatrixd glad_debug_glLoadMatrixd
+#undef glLoadMatrixf
+#define glLoadMatrixf glad_debug_glLoadMatrixf
+#undef glLoadName
+#define glLoadName glad_debug_glLoadName
+#undef glLoadTransposeMatrixd
+#define glLoadTransposeMatrixd glad_debug_glLoadTransposeMatrixd
+#undef glLoadTransposeMatrixf
+#define glLoadTransposeMatrixf glad_debug_glLoadTransposeMatrixf
+#undef glLogicOp
+#define glLogicOp glad_debug_glLogicOp
+#undef glMakeImageHandleNonResidentARB
+#define glMakeImageHandleNonResidentARB glad_debug_glMakeImageHandleNonResidentARB
+#undef glMakeImageHandleResidentARB
+#define glMakeImageHandleResidentARB glad_debug_glMakeImageHandleResidentARB
+#undef glMakeTextureHandleNonResidentARB
+#define glMakeTextureHandleNonResidentARB glad_debug_glMakeTextureHandleNonResidentARB
+#undef glMakeTextureHandleResidentARB
+#define glMakeTextureHandleResidentARB glad_debug_glMakeTextureHandleResidentARB
+#undef glMap1d
+#define glMap1d glad_debug_glMap1d
+#undef glMap1f
+#define glMap1f glad_debug_glMap1f
+#undef glMap2d
+#define glMap2d glad_debug_glMap2d
+#undef glMap2f
+#define glMap2f glad_debug_glMap2f
+#undef glMapBuffer
+#define glMapBuffer glad_debug_glMapBuffer
+#undef glMapBufferRange
+#define glMapBufferRange glad_debug_glMapBufferRange
+#undef glMapGrid1d
+#define glMapGrid1d glad_debug_glMapGrid1d
+#undef glMapGrid1f
+#define glMapGrid1f glad_debug_glMapGrid1f
+#undef glMapGrid2d
+#define glMapGrid2d glad_debug_glMapGrid2d
+#undef glMapGrid2f
+#define glMapGrid2f glad_debug_glMapGrid2f
+#undef glMapNamedBuffer
+#define glMapNamedBuffer glad_debug_glMapNamedBuffer
+#undef glMapNamedBufferRange
+#define glMapNamedBufferRange glad_debug_glMapNamedBufferRange
+#undef glMaterialf
+#define glMaterialf glad_debug_glMaterialf
+#undef glMaterialfv
+#define glMaterialfv glad_debug_glMaterialfv
+#undef glMateriali
+#define glMateriali glad_debug_glMateriali
+#undef glMaterialiv
+#define glMaterialiv glad_debug_glMaterialiv
+#undef glMatrixMode
+#define glMatrixMode glad_debug_glMatrixMode
+#undef glMaxShaderCompilerThreadsKHR
+#define glMaxShaderCompilerThreadsKHR glad_debug_glMaxShaderCompilerThreadsKHR
+#undef glMemoryBarrier
+#define glMemoryBarrier glad_debug_glMemoryBarrier
+#undef glMemoryBarrierByRegion
+#define glMemoryBarrierByRegion glad_debug_glMemoryBarrierByRegion
+#undef glMinSampleShading
+#define glMinSampleShading glad_debug_glMinSampleShading
+#undef glMultMatrixd
+#define glMultMatrixd glad_debug_glMultMatrixd
+#undef glMultMatrixf
+#define glMultMatrixf glad_debug_glMultMatrixf
+#undef glMultTransposeMatrixd
+#define glMultTransposeMatrixd glad_debug_glMultTransposeMatrixd
+#undef glMultTransposeMatrixf
+#define glMultTransposeMatrixf glad_debug_glMultTransposeMatrixf
+#undef glMultiDrawArrays
+#define glMultiDrawArrays glad_debug_glMultiDrawArrays
+#undef glMultiDrawArraysIndirect
+#define glMultiDrawArraysIndirect glad_debug_glMultiDrawArraysIndirect
+#undef glMultiDrawArraysIndirectCount
+#define glMultiDrawArraysIndirectCount glad_debug_glMultiDrawArraysIndirectCount
+#undef glMultiDrawElements
+#define glMultiDrawElements glad_debug_glMultiDrawElements
+#undef glMultiDrawElementsBaseVertex
+#define glMultiDrawElementsBaseVertex glad_debug_glMultiDrawElementsBaseVertex
+#undef glMultiDrawElementsIndirect
+#define glMultiDrawElementsIndirect glad_debug_glMultiDrawElementsIndirect
+#undef glMultiDrawElementsIndirectCount
+#define glMultiDrawElementsIndirectCount glad_debug_glMultiDrawElementsIndirectCount
+#undef glMultiTexCoord1d
+#define glMultiTexCoord1d glad_debug_glMultiTexCoord1d
+#undef glMultiTexCoord1dv
+#define glMultiTexCoord1dv glad_debug_glMultiTexCoord1dv
+#undef glMultiTexCoord1f
+#define glMultiTexCoord1f glad_debug_glMultiTexCoord1f
+#undef glMultiTexCoord1fv
+#define glMultiTexCoord1fv glad_debug_glMultiTexCoord1fv
+#undef glMultiTexCoord1i
+#define glMultiTexCoord1i glad_debug_glMultiTexCoord1i
+#undef glMultiTexCoord1iv
+#define glMultiTexCoord1iv glad_debug_glMultiTexCoord1iv
+#undef glMultiTexCoord1s
+#define glMultiTexCoord1s glad_debug_glMultiTexCoord1s
+#undef glMultiTexCoord1sv
+#define glMultiTexCoord1sv glad_debug_glMultiTexCoord1sv
+#undef glMultiTexCoord2d
+#define glMultiTexCoord2d glad_debug_glMultiTexCoord2d
+#undef glMultiTexCoord2dv
+#define glMultiTexCoord2dv glad_debug_glMultiTexCoord2dv
+#undef glMultiTexCoord2f
+#define glMultiTexCoord2f glad_debug_glMultiTexCoord2f
+#undef glMultiTexCoord2fv
+#define glMultiTexCoord2fv glad_debug_glMultiTexCoord2fv
+#undef glMultiTexCoord2i
+#define glMultiTexCoord2i glad_debug_glMultiTexCoord2i
+#undef glMultiTexCoord2iv
+#define glMultiTexCoord2iv glad_debug_glMultiTexCoord2iv
+#undef glMultiTexCoord2s
+#define glMultiTexCoord2s glad_debug_glMultiTexCoord2s
+#undef glMultiTexCoord2sv
+#define glMultiTexCoord2sv glad_debug_glMultiTexCoord2sv
+#undef glMultiTexCoord3d
+#define glMultiTexCoord3d glad_debug_glMultiTexCoord3d
+#undef glMultiTexCoord3dv
+#define glMultiTexCoord3dv glad_debug_glMultiTexCoord3dv
+#undef glMultiTexCoord3f
+#define glMultiTexCoord3f glad_debug_glMultiTexCoord3f
+#undef glMultiTexCoord3fv
+#define glMultiTexCoord3fv glad_debug_glMultiTexCoord3fv
+#undef glMultiTexCoord3i
+#define glMultiTexCoord3i glad_debug_glMultiTexCoord3i
+#undef glMultiTexCoord3iv
+#define glMultiTexCoord3iv glad_debug_glMultiTexCoord3iv
+#undef glMultiTexCoord3s
+#define glMultiTexCoord3s glad_debug_glMultiTexCoord3s
+#undef glMultiTexCoord3sv
+#define glMultiTexCoord3sv glad_debug_glMultiTexCoord3sv
+#undef glMultiTexCoord4d
+#define glMultiTexCoord4d glad_debug_glMultiTexCoord4d
+#undef glMultiTexCoord4dv
+#define glMultiTexCoord4dv glad_debug_glMultiTexCoord4dv
+#undef glMultiTexCoord4f
+#define glMultiTexCoord4f glad_debug_glMultiTexCoord4f
+#undef glMultiTexCoord4fv
+#define glMultiTexCoord4fv glad_debug_glMultiTexCoord4fv
+#undef glMultiTexCoord4i
+#define glMultiTexCoord4i glad_debug_glMultiTexCoord4i
+#undef glMultiTexCoord4iv
+#define glMultiTexCoord4iv glad_debug_glMultiTexCoord4iv
+#undef glMultiTexCoord4s
+#define glMultiTexCoord4s glad_debug_glMultiTexCoord4s
+#undef glMultiTexCoord4sv
+#define glMultiTexCoord4sv glad_debug_glMultiTexCoord4sv
+#undef glMultiTexCoordP1ui
+#define glMultiTexCoordP1ui glad_debug_glMultiTexCoordP1ui
+#undef glMultiTexCoordP1uiv
+#define glMultiTexCoordP1uiv glad_debug_glMultiTexCoordP1uiv
+#undef glMultiTexCoordP2ui
+#define glMultiTexCoordP2ui glad_debug_glMultiTexCoordP2ui
+#undef glMultiTexCoordP2uiv
+#define glMultiTexCoordP2uiv glad_debug_glMultiTexCoordP2uiv
+#undef glMultiTexCoordP3ui
+#define glMultiTexCoordP3ui glad_debug_glMultiTexCoordP3ui
+#undef glMultiTexCoordP3uiv
+#define glMultiTexCoordP3uiv glad_debug_glMultiTexCoordP3uiv
+#undef glMultiTexCoordP4ui
+#define glMultiTexCoordP4ui glad_debug_glMultiTexCoordP4ui
+#undef glMultiTexCoordP4uiv
+#define glMultiTexCoordP4uiv glad_debug_glMultiTexCoordP4uiv
+#undef glNamedBufferData
+#define glNamedBufferData glad_debug_glNamedBufferData
+#undef glNamedBufferStorage
+#define glNamedBufferStorage glad_debug_glNamedBufferStorage
+#undef glNamedBufferStorageEXT
+#define glNamedBufferStorageEXT glad_debug_glNamedBufferStorageEXT
+#undef glNamedBufferSubData
+#define glNamedBufferSubData glad_debug_glNamedBufferSubData
+#undef glNamedFramebufferDrawBuffer
+#define glNamedFramebufferDrawBuffer glad_debug_glNamedFramebufferDrawBuffer
+#undef glNamedFramebufferDrawBuffers
+#define glNamedFramebufferDrawBuffers glad_debug_glNamedFramebufferDrawBuffers
+#undef glNamedFramebufferParameteri
+#define glNamedFramebufferParameteri glad_debug_glNamedFramebufferParameteri
+#undef glNamedFramebufferReadBuffer
+#define glNamedFramebufferReadBuffer glad_debug_glNamedFramebufferReadBuffer
+#undef glNamedFramebufferRenderbuffer
+#define glNamedFramebufferRenderbuffer glad_debug_glNamedFramebufferRenderbuffer
+#undef glNamedFramebufferTexture
+#define glNamedFramebufferTexture glad_debug_glNamedFramebufferTexture
+#undef glNamedFramebufferTextureLayer
+#define glNamedFramebufferTextureLayer glad_debug_glNamedFramebufferTextureLayer
+#undef glNamedRenderbufferStorage
+#define glNamedRenderbufferStorage glad_debug_glNamedRenderbufferStorage
+#undef glNamedRenderbufferStorageMultisample
+#define glNamedRenderbufferStorageMultisample glad_debug_glNamedRenderbufferStorageMultisample
+#undef glNewList
+#define glNewList glad_debug_glNewList
+#undef glNormal3b
+#define glNormal3b glad_debug_glNormal3b
+#undef glNormal3bv
+#define glNormal3bv glad_debug_glNormal3bv
+#undef glNormal3d
+#define glNormal3d glad_debug_glNormal3d
+#undef glNormal3dv
+#define glNormal3dv glad_debug_glNormal3dv
+#undef glNormal3f
+#define glNormal3f glad_debug_glNormal3f
+#undef glNormal3fv
+#define glNormal3fv glad_debug_glNormal3fv
+#undef glNormal3i
+#define glNormal3i glad_debug_glNormal3i
+#undef glNormal3iv
+#define glNormal3iv glad_debug_glNormal3iv
+#undef glNormal3s
+#define glNormal3s glad_debug_glNormal3s
+#undef glNormal3sv
+#define glNormal3sv glad_debug_glNormal3sv
+#undef glNormalP3ui
+#define glNormalP3ui glad_debug_glNormalP3ui
+#undef glNormalP3uiv
+#define glNormalP3uiv glad_debug_glNormalP3uiv
+#undef glNormalPointer
+#define glNormalPointer glad_debug_glNormalPointer
+#undef glObjectLabel
+#define glObjectLabel glad_debug_glObjectLabel
+#undef glObjectPtrLabel
+#define glObjectPtrLabel glad_debug_glObjectPtrLabel
+#undef glOrtho
+#define glOrtho glad_debug_glOrtho
+#undef glPassThrough
+#define glPassThrough glad_debug_glPassThrough
+#undef glPatchParameterfv
+#define glPatchParameterfv glad_debug_glPatchParameterfv
+#undef glPatchParameteri
+#define glPatchParameteri glad_debug_glPatchParameteri
+#undef glPauseTransformFeedback
+#define glPauseTransformFeedback glad_debug_glPauseTransformFeedback
+#undef glPixelMapfv
+#define glPixelMapfv glad_debug_glPixelMapfv
+#undef glPixelMapuiv
+#define glPixelMapuiv glad_debug_glPixelMapuiv
+#undef glPixelMapusv
+#define glPixelMapusv glad_debug_glPixelMapusv
+#undef glPixelStoref
+#define glPixelStoref glad_debug_glPixelStoref
+#undef glPixelStorei
+#define glPixelStorei glad_debug_glPixelStorei
+#undef glPixelTransferf
+#define glPixelTransferf glad_debug_glPixelTransferf
+#undef glPixelTransferi
+#define glPixelTransferi glad_debug_glPixelTransferi
+#undef glPixelZoom
+#define glPixelZoom glad_debug_glPixelZoom
+#undef glPointParameterf
+#define glPointParameterf glad_debug_glPointParameterf
+#undef glPointParameterfv
+#define glPointParameterfv glad_debug_glPointParameterfv
+#undef glPointParameteri
+#define glPointParameteri glad_debug_glPointParameteri
+#undef glPointParameteriv
+#define glPointParameteriv glad_debug_glPointParameteriv
+#undef glPointSize
+#define glPointSize glad_debug_glPointSize
+#undef glPolygonMode
+#define glPolygonMode glad_debug_glPolygonMode
+#undef glPolygonOffset
+#define glPolygonOffset glad_debug_glPolygonOffset
+#undef glPolygonOffsetClamp
+#define glPolygonOffsetClamp glad_debug_glPolygonOffsetClamp
+#undef glPolygonStipple
+#define glPolygonStipple glad_debug_glPolygonStipple
+#undef glPopAttrib
+#define glPopAttrib glad_debug_glPopAttrib
+#undef glPopClientAttrib
+#define glPopClientAttrib glad_debug_glPopClientAttrib
+#undef glPopDebugGroup
+#define glPopDebugGroup glad_debug_glPopDebugGroup
+#undef glPopMatrix
+#define glPopMatrix glad_debug_glPopMatrix
+#undef glPopName
+#define glPopName glad_debug_glPopName
+#undef glPrimitiveRestartIndex
+#define glPrimitiveRestartIndex glad_debug_glPrimitiveRestartIndex
+#undef glPrioritizeTextures
+#define glPrioritizeTextures glad_debug_glPrioritizeTextures
+#undef glProgramBinary
+#define glProgramBinary glad_debug_glProgramBinary
+#undef glProgramParameteri
+#define glProgramParameteri glad_debug_glProgramParameteri
+#undef glProgramUniform1d
+#define glProgramUniform1d glad_debug_glProgramUniform1d
+#undef glProgramUniform1dv
+#define glProgramUniform1dv glad_debug_glProgramUniform1dv
+#undef glProgramUniform1f
+#define glProgramUniform1f glad_debug_glProgramUniform1f
+#undef glProgramUniform1fv
+#define glProgramUniform1fv glad_debug_glProgramUniform1fv
+#undef glProgramUniform1i
+#define glProgramUniform1i glad_debug_glProgramUniform1i
+#undef glProgramUniform1iv
+#define glProgramUniform1iv glad_debug_glProgramUniform1iv
+#undef glProgramUniform1ui
+#define glProgramUniform1ui glad_debug_glProgramUniform1ui
+#undef glProgramUniform1uiv
+#define glProgramUniform1uiv glad_debug_glProgramUniform1uiv
+#undef glProgramUniform2d
+#define glProgramUniform2d glad_debug_glProgramUniform2d
+#undef glProgramUniform2dv
+#define glProgramUniform2dv glad_debug_glProgramUniform2dv
+#undef glProgramUniform2f
+#define glProgramUniform2f glad_debug_glProgramUniform2f
+#undef glProgramUniform2fv
+#define glProgramUniform2fv glad_debug_glProgramUniform2fv
+#undef glProgramUniform2i
+#define glProgramUniform2i glad_debug_glProgramUniform2i
+#undef glProgramUniform2iv
+#define glProgramUniform2iv glad_debug_glProgramUniform2iv
+#undef glProgramUniform2ui
+#define glProgramUniform2ui glad_debug_glProgramUniform2ui
+#undef glProgramUniform2uiv
+#define glProgramUniform2uiv glad_debug_glProgramUniform2uiv
+#undef glProgramUniform3d
+#define glProgramUniform3d glad_debug_glProgramUniform3d
+#undef glProgramUniform3dv
+#define glProgramUniform3dv glad_debug_glProgramUniform3dv
+#undef glProgramUniform3f
+#define glProgramUniform3f glad_debug_glProgramUniform3f
+#undef glProgramUniform3fv
+#define glProgramUniform3fv glad_debug_glProgramUniform3fv
+#undef glProgramUniform3i
+#define glProgramUniform3i glad_debug_glProgramUniform3i
+#undef glProgramUniform3iv
+#define glProgramUniform3iv glad_debug_glProgramUniform3iv
+#undef glProgramUniform3ui
+#define glProgramUniform3ui glad_debug_glProgramUniform3ui
+#undef glProgramUniform3uiv
+#define glProgramUniform3uiv glad_debug_glProgramUniform3uiv
+#undef glProgramUniform4d
+#define glProgramUniform4d glad_debug_glProgramUniform4d
+#undef glProgramUniform4dv
+#define glProgramUniform4dv glad_debug_glProgramUniform4dv
+#undef glProgramUniform4f
+#define glProgramUniform4f glad_debug_glProgramUniform4f
+#undef glProgramUniform4fv
+#define glProgramUniform4fv glad_debug_glProgramUniform4fv
+#undef glProgramUniform4i
+#define glProgramUniform4i glad_debug_glProgramUniform4i
+#undef glProgramUniform4iv
+#define glProgramUniform4iv glad_debug_glProgramUniform4iv
+#undef glProgramUniform4ui
+#define glProgramUniform4ui glad_debug_glProgramUniform4ui
+#undef glProgramUniform4uiv
+#define glProgramUniform4uiv glad_debug_glProgramUniform4uiv
+#undef glProgramUniformHandleui64ARB
+#define glProgramUniformHandleui64ARB glad_debug_glProgramUniformHandleui64ARB
+#undef glProgramUniformHandleui64vARB
+#define glProgramUniformHandleui64vARB glad_debug_glProgramUniformHandleui64vARB
+#undef glProgramUniformMatrix2dv
+#define glProgramUniformMatrix2dv glad_debug_glProgramUniformMatrix2dv
+#undef glProgramUniformMatrix2fv
+#define glProgramUniformMatrix2fv glad_debug_glProgramUniformMatrix2fv
+#undef glProgramUniformMatrix2x3dv
+#define glProgramUniformMatrix2x3dv glad_debug_glProgramUniformMatrix2x3dv
+#undef glProgramUniformMatrix2x3fv
+#define glProgramUniformMatrix2x3fv glad_debug_glProgramUniformMatrix2x3fv
+#undef glProgramUniformMatrix2x4dv
+#define glProgramUniformMatrix2x4dv glad_debug_glProgramUniformMatrix2x4dv
+#undef glProgramUniformMatrix2x4fv
+#define glProgramUniformMatrix2x4fv glad_debug_glProgramUniformMatrix2x4fv
+#undef glProgramUniformMatrix3dv
+#define glProgramUniformMatrix3dv glad_debug_glProgramUniformMatrix3dv
+#undef glProgramUniformMatrix3fv
+#define glProgramUniformMatrix3fv glad_debug_glProgramUniformMatrix3fv
+#undef glProgramUniformMatrix3x2dv
+#define glProgramUniformMatrix3x2dv glad_debug_glProgramUniformMatrix3x2dv
+#undef glProgramUniformMatrix3x2fv
+#define glProgramUniformMatrix3x2fv glad_debug_glProgramUniformMatrix3x2fv
+#undef glProgramUniformMatrix3x4dv
+#define glProgramUniformMatrix3x4dv glad_debug_glProgramUniformMatrix3x4dv
+#undef glProgramUniformMatrix3x4fv
+#define glProgramUniformMatrix3x4fv glad_debug_glProgramUniformMatrix3x4fv
+#undef glProgramUniformMatrix4dv
+#define glProgramUniformMatrix4dv glad_debug_glProgramUniformMatrix4dv
+#undef glProgramUniformMatrix4fv
+#define glProgramUniformMatrix4fv glad_debug_glProgramUniformMatrix4fv
+#undef glProgramUniformMatrix4x2dv
+#define glProgramUniformMatrix4x2dv glad_debug_glProgramUniformMatrix4x2dv
+#undef glProgramUniformMatrix4x2fv
+#define glProgramUniformMatrix4x2fv glad_debug_glProgramUniformMatrix4x2fv
+#undef glProgramUniformMatrix4x3dv
+#define glProgramUniformMatrix4x3dv glad_debug_glProgramUniformMatrix4x3dv
+#undef glProgramUniformMatrix4x3fv
+#define glProgramUniformMatrix4x3fv glad_debug_glProgramUniformMatrix4x3fv
+#undef glProvokingVertex
+#define glProvokingVertex glad_debug_glProvokingVertex
+#undef glPushAttrib
+#define glPushAttrib glad_debug_glPushAttrib
+#undef glPushClientAttrib
+#define glPushClientAttrib glad_debug_glPushClientAttrib
+#undef glPushDebugGroup
+#define glPushDebugGroup glad_debug_glPushDebugGroup
+#undef glPushMatrix
+#define glPushMatrix glad_debug_glPushMatrix
+#undef glPushName
+#define glPushName glad_debug_glPushName
+#undef glQueryCounter
+#define glQueryCounter glad_debug_glQueryCounter
+#undef glRasterPos2d
+#define glRasterPos2d glad_debug_glRasterPos2d
+#undef glRasterPos2dv
+#define glRasterPos2dv glad_debug_glRasterPos2dv
+#undef glRasterPos2f
+#define glRasterPos2f glad_debug_glRasterPos2f
+#undef glRasterPos2fv
+#define glRasterPos2fv glad_debug_glRasterPos2fv
+#undef glRasterPos2i
+#define glRasterPos2i glad_debug_glRasterPos2i
+#undef glRasterPos2iv
+#define glRasterPos2iv glad_debug_glRasterPos2iv
+#undef glRasterPos2s
+#define glRasterPos2s glad_debug_glRasterPos2s
+#undef glRasterPos2sv
+#define glRasterPos2sv glad_debug_glRasterPos2sv
+#undef glRasterPos3d
+#define glRasterPos3d glad_debug_glRasterPos3d
+#undef glRasterPos3dv
+#define glRasterPos3dv glad_debug_glRasterPos3dv
+#undef glRasterPos3f
+#define glRasterPos3f glad_debug_glRasterPos3f
+#undef glRasterPos3fv
+#define glRasterPos3fv glad_debug_glRasterPos3fv
+#undef glRasterPos3i
+#define glRasterPos3i glad_debug_glRasterPos3i
+#undef glRasterPos3iv
+#define glRasterPos3iv glad_debug_glRasterPos3iv
+#undef glRasterPos3s
+#define glRasterPos3s glad_debug_glRasterPos3s
+#undef glRasterPos3sv
+#define glRasterPos3sv glad_debug_glRasterPos3sv
+#undef glRasterPos4d
+#define glRasterPos4d glad_debug_glRasterPos4d
+#undef glRasterPos4dv
+#define glRasterPos4dv glad_debug_glRasterPos4dv
+#undef glRasterPos4f
+#define glRasterPos4f glad_debug_glRasterPos4f
+#undef glRasterPos4fv
+#define glRasterPos4fv glad_debug_glRasterPos4fv
+#undef glRasterPos4i
+#define glRasterPos4i glad_debug_glRasterPos4i
+#undef glRasterPos4iv
+#define glRasterPos4iv glad_debug_glRasterPos4iv
+#undef glRasterPos4s
+#define glRasterPos4s glad_debug_glRasterPos4s
+#undef glRasterPos4sv
+#define glRasterPos4sv glad_debug_glRasterPos4sv
+#undef glReadBuffer
+#define glReadBuffer glad_debug_glReadBuffer
+#undef glReadPixels
+#define glReadPixels glad_debug_glReadPixels
+#undef glReadnPixels
+#define glReadnPixels glad_debug_glReadnPixels
+#undef glRectd
+#define glRectd glad_debug_glRectd
+#undef glRectdv
+#define glRectdv glad_debug_glRectdv
+#undef glRectf
+#define glRectf glad_debug_glRectf
+#undef glRectfv
+#define glRectfv glad_debug_glRectfv
+#undef glRecti
+#define glRecti glad_debug_glRecti
+#undef glRectiv
+#define glRectiv glad_debug_glRectiv
+#undef glRects
+#define glRects glad_debug_glRects
+#undef glRectsv
+#define glRectsv glad_debug_glRectsv
+#undef glReleaseShaderCompiler
+#define glReleaseShaderCompiler glad_debug_glReleaseShaderCompiler
+#undef glRenderMode
+#define glRenderMode glad_debug_glRenderMode
+#undef glRenderbufferStorage
+#define glRenderbufferStorage glad_debug_glRenderbufferStorage
+#undef glRenderbufferStorageMultisample
+#define glRenderbufferStorageMultisample glad_debug_glRenderbufferStorageMultisample
+#undef glResumeTransformFeedback
+#define glResumeTransformFeedback glad_debug_glResumeTransformFeedback
+#undef glRotated
+#define glRotated glad_debug_glRotated
+#undef glRotatef
+#define glRotatef glad_debug_glRotatef
+#undef glSampleCoverage
+#define glSampleCoverage glad_debug_glSampleCoverage
+#undef glSampleMaski
+#define glSampleMaski glad_debug_glSampleMaski
+#undef glSamplerParameterIiv
+#define glSamplerParameterIiv glad_debug_glSamplerParameterIiv
+#undef glSamplerParameterIuiv
+#define glSamplerParameterIuiv glad_debug_glSamplerParameterIuiv
+#undef glSamplerParameterf
+#define glSamplerParameterf glad_debug_glSamplerParameterf
+#undef glSamplerParameterfv
+#define glSamplerParameterfv glad_debug_glSamplerParameterfv
+#undef glSamplerParameteri
+#define glSamplerParameteri glad_debug_glSamplerParameteri
+#undef glSamplerParameteriv
+#define glSamplerParameteriv glad_debug_glSamplerParameteriv
+#undef glScaled
+#define glScaled glad_debug_glScaled
+#undef glScalef
+#define glScalef glad_debug_glScalef
+#undef glScissor
+#define glScissor glad_debug_glScissor
+#undef glScissorArrayv
+#define glScissorArrayv glad_debug_glScissorArrayv
+#undef glScissorIndexed
+#define glScissorIndexed glad_debug_glScissorIndexed
+#undef glScissorIndexedv
+#define glScissorIndexedv glad_debug_glScissorIndexedv
+#undef glSecondaryColor3b
+#define glSecondaryColor3b glad_debug_glSecondaryColor3b
+#undef glSecondaryColor3bv
+#define glSecondaryColor3bv glad_debug_glSecondaryColor3bv
+#undef glSecondaryColor3d
+#define glSecondaryColor3d glad_debug_glSecondaryColor3d
+#undef glSecondaryColor3dv
+#define glSecondaryColor3dv glad_debug_glSecondaryColor3dv
+#undef glSecondaryColor3f
+#define glSecondaryColor3f glad_debug_glSecondaryColor3f
+#undef glSecondaryColor3fv
+#define glSecondaryColor3fv glad_debug_glSecondaryColor3fv
+#undef glSecondaryColor3i
+#define glSecondaryColor3i glad_debug_glSecondaryColor3i
+#undef glSecondaryColor3iv
+#define glSecondaryColor3iv glad_debug_glSecondaryColor3iv
+#undef glSecondaryColor3s
+#define glSecondaryColor3s glad_debug_glSecondaryColor3s
+#undef glSecondaryColor3sv
+#define glSecondaryColor3sv glad_debug_glSecondaryColor3sv
+#undef glSecondaryColor3ub
+#define glSecondaryColor3ub glad_debug_glSecondaryColor3ub
+#undef glSecondaryColor3ubv
+#define glSecondaryColor3ubv glad_debug_glSecondaryColor3ubv
+#undef glSecondaryColor3ui
+#define glSecondaryColor3ui glad_debug_glSecondaryColor3ui
+#undef glSecondaryColor3uiv
+#define glSecondaryColor3uiv glad_debug_glSecondaryColor3uiv
+#undef glSecondaryColor3us
+#define glSecondaryColor3us glad_debug_glSecondaryColor3us
+#undef glSecondaryColor3usv
+#define glSecondaryColor3usv glad_debug_glSecondaryColor3usv
+#undef glSecondaryColorP3ui
+#define glSecondaryColorP3ui glad_debug_glSecondaryColorP3ui
+#undef glSecondaryColorP3uiv
+#define glSecondaryColorP3uiv glad_debug_glSecondaryColorP3uiv
+#undef glSecondaryColorPointer
+#define glSecondaryColorPointer glad_debug_glSecondaryColorPointer
+#undef glSelectBuffer
+#define glSelectBuffer glad_debug_glSelectBuffer
+#undef glShadeModel
+#define glShadeModel glad_debug_glShadeModel
+#undef glShaderBinary
+#define glShaderBinary glad_debug_glShaderBinary
+#undef glShaderSource
+#define glShaderSource glad_debug_glShaderSource
+#undef glShaderStorageBlockBinding
+#define glShaderStorageBlockBinding glad_debug_glShaderStorageBlockBinding
+#undef glSpecializeShader
+#define glSpecializeShader glad_debug_glSpecializeShader
+#undef glSpecializeShaderARB
+#define glSpecializeShaderARB glad_debug_glSpecializeShaderARB
+#undef glStencilFunc
+#define glStencilFunc glad_debug_glStencilFunc
+#undef glStencilFuncSeparate
+#define glStencilFuncSeparate glad_debug_glStencilFuncSeparate
+#undef glStencilMask
+#define glStencilMask glad_debug_glStencilMask
+#undef glStencilMaskSeparate
+#define glStencilMaskSeparate glad_debug_glStencilMaskSeparate
+#undef glStencilOp
+#define glStencilOp glad_debug_glStencilOp
+#undef glStencilOpSeparate
+#define glStencilOpSeparate glad_debug_glStencilOpSeparate
+#undef glTexBuffer
+#define glTexBuffer glad_debug_glTexBuffer
+#undef glTexBufferRange
+#define glTexBufferRange glad_debug_glTexBufferRange
+#undef glTexCoord1d
+#define glTexCoord1d glad_debug_glTexCoord1d
+#undef glTexCoord1dv
+#define glTexCoord1dv glad_debug_glTexCoord1dv
+#undef glTexCoord1f
+#define glTexCoord1f glad_debug_glTexCoord1f
+#undef glTexCoord1fv
+#define glTexCoord1fv glad_debug_glTexCoord1fv
+#undef glTexCoord1i
+#define glTexCoord1i glad_debug_glTexCoord1i
+#undef glTexCoord1iv
+#define glTexCoord1iv glad_debug_glTexCoord1iv
+#undef glTexCoord1s
+#define glTexCoord1s glad_debug_glTexCoord1s
+#undef glTexCoord1sv
+#define glTexCoord1sv glad_debug_glTexCoord1sv
+#undef glTexCoord2d
+#define glTexCoord2d glad_debug_glTexCoord2d
+#undef glTexCoord2dv
+#define glTexCoord2dv glad_debug_glTexCoord2dv
+#undef glTexCoord2f
+#define glTexCoord2f glad_debug_glTexCoord2f
+#undef glTexCoord2fv
+#define glTexCoord2fv glad_debug_glTexCoord2fv
+#undef glTexCoord2i
+#define glTexCoord2i glad_debug_glTexCoord2i
+#undef glTexCoord2iv
+#define glTexCoord2iv glad_debug_glTexCoord2iv
+#undef glTexCoord2s
+#define glTexCoord2s glad_debug_glTexCoord2s
+#undef glTexCoord2sv
+#define glTexCoord2sv glad_debug_glTexCoord2sv
+#undef glTexCoord3d
+#define glTexCoord3d glad_debug_glTexCoord3d
+#undef glTexCoord3dv
+#define glTexCoord3dv glad_debug_glTexCoord3dv
+#undef glTexCoord3f
+#define glTexCoord3f glad_debug_glTexCoord3f
+#undef glTexCoord3fv
+#define glTexCoord3fv glad_debug_glTexCoord3fv
+#undef glTexCoord3i
+#define glTexCoord3i glad_debug_glTexCoord3i
+#undef glTexCoord3iv
+#define glTexCoord3iv glad_debug_glTexCoord3iv
+#undef glTexCoord3s
+#define glTexCoord3s glad_debug_glTexCoord3s
+#undef glTexCoord3sv
+#define glTexCoord3sv glad_debug_glTexCoord3sv
+#undef glTexCoord4d
+#define glTexCoord4d glad_debug_glTexCoord4d
+#undef glTexCoord4dv
+#define glTexCoord4dv glad_debug_glTexCoord4dv
+#undef glTexCoord4f
+#define glTexCoord4f glad_debug_glTexCoord4f
+#undef glTexCoord4fv
+#define glTexCoord4fv glad_debug_glTexCoord4fv
+#undef glTexCoord4i
+#define glTexCoord4i glad_debug_glTexCoord4i
+#undef glTexCoord4iv
+#define glTexCoord4iv glad_debug_glTexCoord4iv
+#undef glTexCoord4s
+#define glTexCoord4s glad_debug_glTexCoord4s
+#undef glTexCoord4sv
+#define glTexCoord4sv glad_debug_glTexCoord4sv
+#undef glTexCoordP1ui
+#define glTexCoordP1ui glad_debug_glTexCoordP1ui
+#undef glTexCoordP1uiv
+#define glTexCoordP1uiv glad_debug_glTexCoordP1uiv
+#undef glTexCoordP2ui
+#define glTexCoordP2ui glad_debug_glTexCoordP2ui
+#undef glTexCoordP2uiv
+#define glTexCoordP2uiv glad_debug_glTexCoordP2uiv
+#undef glTexCoordP3ui
+#define glTexCoordP3ui glad_debug_glTexCoordP3ui
+#undef glTexCoordP3uiv
+#define glTexCoordP3uiv glad_debug_glTexCoordP3uiv
+#undef glTexCoordP4ui
+#define glTexCoordP4ui glad_debug_glTexCoordP4ui
+#undef glTexCoordP4uiv
+#define glTexCoordP4uiv glad_debug_glTexCoordP4uiv
+#undef glTexCoordPointer
+#define glTexCoordPointer glad_debug_glTexCoordPointer
+#undef glTexEnvf
+#define glTexEnvf glad_debug_glTexEnvf
+#undef glTexEnvfv
+#define glTexEnvfv glad_debug_glTexEnvfv
+#undef glTexEnvi
+#define glTexEnvi glad_debug_glTexEnvi
+#undef glTexEnviv
+#define glTexEnviv glad_debug_glTexEnviv
+#undef glTexGend
+#define glTexGend glad_debug_glTexGend
+#undef glTexGendv
+#define glTexGendv glad_debug_glTexGendv
+#undef glTexGenf
+#define glTexGenf glad_debug_glTexGenf
+#undef glTexGenfv
+#define glTexGenfv glad_debug_glTexGenfv
+#undef glTexGeni
+#define glTexGeni glad_debug_glTexGeni
+#undef glTexGeniv
+#define glTexGeniv glad_debug_glTexGeniv
+#undef glTexImage1D
+#define glTexImage1D glad_debug_glTexImage1D
+#undef glTexImage2D
+#define glTexImage2D glad_debug_glTexImage2D
+#undef glTexImage2DMultisample
+#define glTexImage2DMultisample glad_debug_glTexImage2DMultisample
+#undef glTexImage3D
+#define glTexImage3D glad_debug_glTexImage3D
+#undef glTexImage3DMultisample
+#define glTexImage3DMultisample glad_debug_glTexImage3DMultisample
+#undef glTexParameterIiv
+#define glTexParameterIiv glad_debug_glTexParameterIiv
+#undef glTexParameterIuiv
+#define glTexParameterIuiv glad_debug_glTexParameterIuiv
+#undef glTexParameterf
+#define glTexParameterf glad_debug_glTexParameterf
+#undef glTexParameterfv
+#define glTexParameterfv glad_debug_glTexParameterfv
+#undef glTexParameteri
+#define glTexParameteri glad_debug_glTexParameteri
+#undef glTexParameteriv
+#define glTexParameteriv glad_debug_glTexParameteriv
+#undef glTexStorage1D
+#define glTexStorage1D glad_debug_glTexStorage1D
+#undef glTexStorage2D
+#define glTexStorage2D glad_debug_glTexStorage2D
+#undef glTexStorage2DMultisample
+#define glTexStorage2DMultisample glad_debug_glTexStorage2DMultisample
+#undef glTexStorage3D
+#define glTexStorage3D glad_debug_glTexStorage3D
+#undef glTexStorage3DMultisample
+#define glTexStorage3DMultisample glad_debug_glTexStorage3DMultisample
+#undef glTexSubImage1D
+#define glTexSubImage1D glad_debug_glTexSubImage1D
+#undef glTexSubImage2D
+#define glTexSubImage2D glad_debug_glTexSubImage2D
+#undef glTexSubImage3D
+#define glTexSubImage3D glad_debug_glTexSubImage3D
+#undef glTextureBarrier
+#define glTextureBarrier glad_debug_glTextureBarrier
+#undef glTextureBuffer
+#define glTextureBuffer glad_debug_glTextureBuffer
+#undef glTextureBufferRange
+#define glTextureBufferRange glad_debug_glTextureBufferRange
+#undef glTextureParameterIiv
+#define glTextureParameterIiv glad_debug_glTextureParameterIiv
+#undef glTextureParameterIuiv
+#define glTextureParameterIuiv glad_debug_glTextureParameterIuiv
+#undef glTextureParameterf
+#define glTextureParameterf glad_debug_glTextureParameterf
+#undef glTextureParameterfv
+#define glTextureParameterfv glad_debug_glTextureParameterfv
+#undef glTextureParameteri
+#define glTextureParameteri glad_debug_glTextureParameteri
+#undef glTextureParameteriv
+#define glTextureParameteriv glad_debug_glTextureParameteriv
+#undef glTextureStorage1D
+#define glTextureStorage1D glad_debug_glTextureStorage1D
+#undef glTextureStorage2D
+#define glTextureStorage2D glad_debug_glTextureStorage2D
+#undef glTextureStorage2DMultisample
+#define glTextureStorage2DMultisample glad_debug_glTextureStorage2DMultisample
+#undef glTextureStorage3D
+#define glTextureStorage3D glad_debug_glTextureStorage3D
+#undef glTextureStorage3DMultisample
+#define glTextureStorage3DMultisample glad_debug_glTextureStorage3DMultisample
+#undef glTextureSubImage1D
+#define glTextureSubImage1D glad_debug_glTextureSubImage1D
+#undef glTextureSubImage2D
+#define glTextureSubImage2D glad_debug_glTextureSubImage2D
+#undef glTextureSubImage3D
+#define glTextureSubImage3D glad_debug_glTextureSubImage3D
+#undef glTextureView
+#define glTextureView glad_debug_glTextureView
+#undef glTransformFeedbackBufferBase
+#define glTransformFeedbackBufferBase glad_debug_glTransformFeedbackBufferBase
+#undef glTransformFeedbackBufferRange
+#define glTransformFeedbackBufferRange glad_debug_glTransformFeedbackBufferRange
+#undef glTransformFeedbackVaryings
+#define glTransformFeedbackVaryings glad_debug_glTransformFeedbackVaryings
+#undef glTranslated
+#define glTranslated glad_debug_glTranslated
+#undef glTranslatef
+#define glTranslatef glad_debug_glTranslatef
+#undef glUniform1d
+#define glUniform1d glad_debug_glUniform1d
+#undef glUniform1dv
+#define glUniform1dv glad_debug_glUniform1dv
+#undef glUniform1f
+#define glUniform1f glad_debug_glUniform1f
+#undef glUniform1fv
+#define glUniform1fv glad_debug_glUniform1fv
+#undef glUniform1i
+#define glUniform1i glad_debug_glUniform1i
+#undef glUniform1iv
+#define glUniform1iv glad_debug_glUniform1iv
+#undef glUniform1ui
+#define glUniform1ui glad_debug_glUniform1ui
+#undef glUniform1uiv
+#define glUniform1uiv glad_debug_glUniform1uiv
+#undef glUniform2d
+#define glUniform2d glad_debug_glUniform2d
+#undef glUniform2dv
+#define glUniform2dv glad_debug_glUniform2dv
+#undef glUniform2f
+#define glUniform2f glad_debug_glUniform2f
+#undef glUniform2fv
+#define glUniform2fv glad_debug_glUniform2fv
+#undef glUniform2i
+#define glUniform2i glad_debug_glUniform2i
+#undef glUniform2iv
+#define glUniform2iv glad_debug_glUniform2iv
+#undef glUniform2ui
+#define glUniform2ui glad_debug_glUniform2ui
+#undef glUniform2uiv
+#define glUniform2uiv glad_debug_glUniform2uiv
+#undef glUniform3d
+#define glUniform3d glad_debug_glUniform3d
+#undef glUniform3dv
+#define glUniform3dv glad_debug_glUniform3dv
+#undef glUniform3f
+#define glUniform3f glad_debug_glUniform3f
+#undef glUniform3fv
+#define glUniform3fv glad_debug_glUniform3fv
+#undef glUniform3i
+#define glUniform3i glad_debug_glUniform3i
+#undef glUniform3iv
+#define glUniform3iv glad_debug_glUniform3iv
+#undef glUniform3ui
+#define glUniform3ui glad_debug_glUniform3ui
+#undef glUniform3uiv
+#define glUniform3uiv glad_debug_glUniform3uiv
+#undef glUniform4d
+#define glUniform4d glad_debug_glUniform4d
+#undef glUniform4dv
+#define glUniform4dv glad_debug_glUniform4dv
+#undef glUniform4f
+#define glUniform4f glad_debug_glUniform4f
+#undef glUniform4fv
+#define glUniform4fv glad_debug_glUniform4fv
+#undef glUniform4i
+#define glUniform4i glad_debug_glUniform4i
+#undef glUniform4iv
+#define glUniform4iv glad_debug_glUniform4iv
+#undef glUniform4ui
+#define glUniform4ui glad_debug_glUniform4ui
+#undef glUniform4uiv
+#define glUniform4uiv glad_debug_glUniform4uiv
+#undef glUniformBlockBinding
+#define glUniformBlockBinding glad_debug_glUniformBlockBinding
+#undef glUniformHandleui64ARB
+#define glUniformHandleui64ARB glad_debug_glUniformHandleui64ARB
+#undef glUniformHandleui64vARB
+#define glUniformHandleui64vARB glad_debug_glUniformHandleui64vARB
+#undef glUniformMatrix2dv
+#define glUniformMatrix2dv glad_debug_glUniformMatrix2dv
+#undef glUniformMatrix2fv
+#define glUniformMatrix2fv glad_debug_glUniformMatrix2fv
+#undef glUniformMatrix2x3dv
+#define glUniformMatrix2x3dv glad_debug_glUniformMatrix2x3dv
+#undef glUniformMatrix2x3fv
+#define glUniformMatrix2x3fv glad_debug_glUniformMatrix2x3fv
+#undef glUniformMatrix2x4dv
+#define glUniformMatrix2x4dv glad_debug_glUniformMatrix2x4dv
+#undef glUniformMatrix2x4fv
+#define glUniformMatrix2x4fv glad_debug_glUniformMatrix2x4fv
+#undef glUniformMatrix3dv
+#define glUniformMatrix3dv glad_debug_glUniformMatrix3dv
+#undef glUniformMatrix3fv
+#define glUniformMatrix3fv glad_debug_glUniformMatrix3fv
+#undef glUniformMatrix3x2dv
+#define glUniformMatrix3x2dv glad_debug_glUniformMatrix3x2dv
+#undef glUniformMatrix3x2fv
+#define glUniformMatrix3x2fv glad_debug_glUniformMatrix3x2fv
+#undef glUniformMatrix3x4dv
+#define glUniformMatrix3x4dv glad_debug_glUniformMatrix3x4dv
+#undef glUniformMatrix3x4fv
+#define glUniformMatrix3x4fv glad_debug_glUniformMatrix3x4fv
+#undef glUniformMatrix4dv
+#define glUniformMatrix4dv glad_debug_glUniformMatrix4dv
+#undef glUniformMatrix4fv
+#define glUniformMatrix4fv glad_debug_glUniformMatrix4fv
+#undef glUniformMatrix4x2dv
+#define glUniformMatrix4x2dv glad_debug_glUniformMatrix4x2dv
+#undef glUniformMatrix4x2fv
+#define glUniformMatrix4x2fv glad_debug_glUniformMatrix4x2fv
+#undef glUniformMatrix4x3dv
+#define glUniformMatrix4x3dv glad_debug_glUniformMatrix4x3dv
+#undef glUniformMatrix4x3fv
+#define glUniformMatrix4x3fv glad_debug_glUniformMatrix4x3fv
+#undef glUniformSubroutinesuiv
+#define glUniformSubroutinesuiv glad_debug_glUniformSubroutinesuiv
+#undef glUnmapBuffer
+#define glUnmapBuffer glad_debug_glUnmapBuffer
+#undef glUnmapNamedBuffer
+#define glUnmapNamedBuffer glad_debug_glUnmapNamedBuffer
+#undef glUseProgram
+#define glUseProgram glad_debug_glUseProgram
+#undef glUseProgramStages
+#define glUseProgramStages glad_debug_glUseProgramStages
+#undef glValidateProgram
+#define glValidateProgram glad_debug_glValidateProgram
+#undef glValidateProgramPipeline
+#define glValidateProgramPipeline glad_debug_glValidateProgramPipeline
+#undef glVertex2d
+#define glVertex2d glad_debug_glVertex2d
+#undef glVertex2dv
+#define glVertex2dv glad_debug_glVertex2dv
+#undef glVertex2f
+#define glVertex2f glad_debug_glVertex2f
+#undef glVertex2fv
+#define glVertex2fv glad_debug_glVertex2fv
+#undef glVertex2i
+#define glVertex2i glad_debug_glVertex2i
+#undef glVertex2iv
+#define glVertex2iv glad_debug_glVertex2iv
+#undef glVertex2s
+#define glVertex2s glad_debug_glVertex2s
+#undef glVertex2sv
+#define glVertex2sv glad_debug_glVertex2sv
+#undef glVertex3d
+#define glVertex3d glad_debug_glVertex3d
+#undef glVertex3dv
+#define glVertex3dv glad_debug_glVertex3dv
+#undef glVertex3f
+#define glVertex3f glad_debug_glVertex3f
+#undef glVertex3fv
+#define glVertex3fv glad_debug_glVertex3fv
+#undef glVertex3i
+#define glVertex3i glad_debug_glVertex3i
+#undef glVertex3iv
+#define glVertex3iv glad_debug_glVertex3iv
+#undef glVertex3s
+#define glVertex3s glad_debug_glVertex3s
+#undef glVertex3sv
+#define glVertex3sv glad_debug_glVertex3sv
+#undef glVertex4d
+#define glVertex4d glad_debug_glVertex4d
+#undef glVertex4dv
+#define glVertex4dv glad_debug_glVertex4dv
+#undef glVertex4f
+#define glVertex4f glad_debug_glVertex4f
+#undef glVertex4fv
+#define glVertex4fv glad_debug_glVertex4fv
+#undef glVertex4i
+#define glVertex4i glad_debug_glVertex4i
+#undef glVertex4iv
+#define glVertex4iv glad_debug_glVertex4iv
+#undef glVertex4s
+#define glVertex4s glad_debug_glVertex4s
+#undef glVertex4sv
+#define glVertex4sv glad_debug_glVertex4sv
+#undef glVertexArrayAttribBinding
+#define glVertexArrayAttribBinding glad_debug_glVertexArrayAttribBinding
+#undef glVertexArrayAttribFormat
+#define glVertexArrayAttribFormat glad_debug_glVertexArrayAttribFormat
+#undef glVertexArrayAttribIFormat
+#define glVertexArrayAttribIFormat glad_debug_glVertexArrayAttribIFormat
+#undef glVertexArrayAttribLFormat
+#define glVertexArrayAttribLFormat glad_debug_glVertexArrayAttribLFormat
+#undef glVertexArrayBindingDivisor
+#define glVertexArrayBindingDivisor glad_debug_glVertexArrayBindingDivisor
+#undef glVertexArrayElementBuffer
+#define glVertexArrayElementBuffer glad_debug_glVertexArrayElementBuffer
+#undef glVertexArrayVertexBuffer
+#define glVertexArrayVertexBuffer glad_debug_glVertexArrayVertexBuffer
+#undef glVertexArrayVertexBuffers
+#define glVertexArrayVertexBuffers glad_debug_glVertexArrayVertexBuffers
+#undef glVertexAttrib1d
+#define glVertexAttrib1d glad_debug_glVertexAttrib1d
+#undef glVertexAttrib1dv
+#define glVertexAttrib1dv glad_debug_glVertexAttrib1dv
+#undef glVertexAttrib1f
+#define glVertexAttrib1f glad_debug_glVertexAttrib1f
+#undef glVertexAttrib1fv
+#define glVertexAttrib1fv glad_debug_glVertexAttrib1fv
+#undef glVertexAttrib1s
+#define glVertexAttrib1s glad_debug_glVertexAttrib1s
+#undef glVertexAttrib1sv
+#define glVertexAttrib1sv glad_debug_glVertexAttrib1sv
+#undef glVertexAttrib2d
+#define glVertexAttrib2d glad_debug_glVertexAttrib2d
+#undef glVertexAttrib2dv
+#define glVertexAttrib2dv glad_debug_glVertexAttrib2dv
+#undef glVertexAttrib2f
+#define glVertexAttrib2f glad_debug_glVertexAttrib2f
+#undef glVertexAttrib2fv
+#define glVertexAttrib2fv glad_debug_glVertexAttrib2fv
+#undef glVertexAttrib2s
+#define glVertexAttrib2s glad_debug_glVertexAttrib2s
+#undef glVertexAttrib2sv
+#define glVertexAttrib2sv glad_debug_glVertexAttrib2sv
+#undef glVertexAttrib3d
+#define glVertexAttrib3d glad_debug_glVertexAttrib3d
+#undef glVertexAttrib3dv
+#define glVertexAttrib3dv glad_debug_glVertexAttrib3dv
+#undef glVertexAttrib3f
+#define glVertexAttrib3f glad_debug_glVertexAttrib3f
+#undef glVertexAttrib3fv
+#define glVertexAttrib3fv glad_debug_glVertexAttrib3fv
+#undef glVertexAttrib3s
+#define glVertexAttrib3s glad_debug_glVertexAttrib3s
+#undef glVertexAttrib3sv
+#define glVertexAttrib3sv glad_debug_glVertexAttrib3sv
+#undef glVertexAttrib4Nbv
+#define glVertexAttrib4Nbv glad_debug_glVertexAttrib4Nbv
+#undef glVertexAttrib4Niv
+#define glVertexAttrib4Niv glad_debug_glVertexAttrib4Niv
+#undef glVertexAttrib4Nsv
+#define glVertexAttrib4Nsv glad_debug_glVertexAttrib4Nsv
+#undef glVertexAttrib4Nub
+#define glVertexAttrib4Nub glad_debug_glVertexAttrib4Nub
+#undef glVertexAttrib4Nubv
+#define glVertexAttrib4Nubv glad_debug_glVertexAttrib4Nubv
+#undef glVertexAttrib4Nuiv
+#define glVertexAttrib4Nuiv glad_debug_glVertexAttrib4Nuiv
+#undef glVertexAttrib4Nusv
+#define glVertexAttrib4Nusv glad_debug_glVertexAttrib4Nusv
+#undef glVertexAttrib4bv
+#define glVertexAttrib4bv glad_debug_glVertexAttrib4bv
+#undef glVertexAttrib4d
+#define glVertexAttrib4d glad_debug_glVertexAttrib4d
+#undef glVertexAttrib4dv
+#define glVertexAttrib4dv glad_debug_glVertexAttrib4dv
+#undef glVertexAttrib4f
+#define glVertexAttrib4f glad_debug_glVertexAttrib4f
+#undef glVertexAttrib4fv
+#define glVertexAttrib4fv glad_debug_glVertexAttrib4fv
+#undef glVertexAttrib4iv
+#define glVertexAttrib4iv glad_debug_glVertexAttrib4iv
+#undef glVertexAttrib4s
+#define glVertexAttrib4s glad_debug_glVertexAttrib4s
+#undef glVertexAttrib4sv
+#define glVertexAttrib4sv glad_debug_glVertexAttrib4sv
+#undef glVertexAttrib4ubv
+#define glVertexAttrib4ubv glad_debug_glVertexAttrib4ubv
+#undef glVertexAttrib4uiv
+#define glVertexAttrib4uiv glad_debug_glVertexAttrib4uiv
+#undef glVertexAttrib4usv
+#define glVertexAttrib4usv glad_debug_glVertexAttrib4usv
+#undef glVertexAttribBinding
+#define glVertexAttribBinding glad_debug_glVertexAttribBinding
+#undef glVertexAttribDivisor
+#define glVertexAttribDivisor glad_debug_glVertexAttribDivisor
+#undef glVertexAttribFormat
+#define glVertexAttribFormat glad_debug_glVertexAttribFormat
+#undef glVertexAttribI1i
+#define glVertexAttribI1i glad_debug_glVertexAttribI1i
+#undef glVertexAttribI1iv
+#define glVertexAttribI1iv glad_debug_glVertexAttribI1iv
+#undef glVertexAttribI1ui
+#define glVertexAttribI1ui glad_debug_glVertexAttribI1ui
+#undef glVertexAttribI1uiv
+#define glVertexAttribI1uiv glad_debug_glVertexAttribI1uiv
+#undef glVertexAttribI2i
+#define glVertexAttribI2i glad_debug_glVertexAttribI2i
+#undef glVertexAttribI2iv
+#define glVertexAttribI2iv glad_debug_glVertexAttribI2iv
+#undef glVertexAttribI2ui
+#define glVertexAttribI2ui glad_debug_glVertexAttribI2ui
+#undef glVertexAttribI2uiv
+#define glVertexAttribI2uiv glad_debug_glVertexAttribI2uiv
+#undef glVertexAttribI3i
+#define glVertexAttribI3i glad_debug_glVertexAttribI3i
+#undef glVertexAttribI3iv
+#define glVertexAttribI3iv glad_debug_glVertexAttribI3iv
+#undef glVertexAttribI3ui
+#define glVertexAttribI3ui glad_debug_glVertexAttribI3ui
+#undef glVertexAttribI3uiv
+#define glVertexAttribI3uiv glad_debug_glVertexAttribI3uiv
+#undef glVertexAttribI4bv
+#define glVertexAttribI4bv glad_debug_glVertexAttribI4bv
+#undef glVertexAttribI4i
+#define glVertexAttribI4i glad_debug_glVertexAttribI4i
+#undef glVertexAttribI4iv
+#define glVertexAttribI4iv glad_debug_glVertexAttribI4iv
+#undef glVertexAttribI4sv
+#define glVertexAttribI4sv glad_debug_glVertexAttribI4sv
+#undef glVertexAttribI4ubv
+#define glVertexAttribI4ubv glad_debug_glVertexAttribI4ubv
+#undef glVertexAttribI4ui
+#define glVertexAttribI4ui glad_debug_glVertexAttribI4ui
+#undef glVertexAttribI4uiv
+#define glVertexAttribI4uiv glad_debug_glVertexAttribI4uiv
+#undef glVertexAttribI4usv
+#define glVertexAttribI4usv glad_debug_glVertexAttribI4usv
+#undef glVertexAttribIFormat
+#define glVertexAttribIFormat glad_debug_glVertexAttribIFormat
+#undef glVertexAttribIPointer
+#define glVertexAttribIPointer glad_debug_glVertexAttribIPointer
+#undef glVertexAttribL1d
+#define glVertexAttribL1d glad_debug_glVertexAttribL1d
+#undef glVertexAttribL1dv
+#define glVertexAttribL1dv glad_debug_glVertexAttribL1dv
+#undef glVertexAttribL1ui64ARB
+#define glVertexAttribL1ui64ARB glad_debug_glVertexAttribL1ui64ARB
+#undef glVertexAttribL1ui64vARB
+#define glVertexAttribL1ui64vARB glad_debug_glVertexAttribL1ui64vARB
+#undef glVertexAttribL2d
+#define glVertexAttribL2d glad_debug_glVertexAttribL2d
+#undef glVertexAttribL2dv
+#define glVertexAttribL2dv glad_debug_glVertexAttribL2dv
+#undef glVertexAttribL3d
+#define glVertexAttribL3d glad_debug_glVertexAttribL3d
+#undef glVertexAttribL3dv
+#define glVertexAttribL3dv glad_debug_glVertexAttribL3dv
+#undef glVertexAttribL4d
+#define glVertexAttribL4d glad_debug_glVertexAttribL4d
+#undef glVertexAttribL4dv
+#define glVertexAttribL4dv glad_debug_glVertexAttribL4dv
+#undef glVertexAttribLFormat
+#define glVertexAttribLFormat glad_debug_glVertexAttribLFormat
+#undef glVertexAttribLPointer
+#define glVertexAttribLPointer glad_debug_glVertexAttribLPointer
+#undef glVertexAttribP1ui
+#define glVertexAttribP1ui glad_debug_glVertexAttribP1ui
+#undef glVertexAttribP1uiv
+#define glVertexAttribP1uiv glad_debug_glVertexAttribP1uiv
+#undef glVertexAttribP2ui
+#define glVertexAttribP2ui glad_debug_glVertexAttribP2ui
+#undef glVertexAttribP2uiv
+#define glVertexAttribP2uiv glad_debug_glVertexAttribP2uiv
+#undef glVertexAttribP3ui
+#define glVertexAttribP3ui glad_debug_glVertexAttribP3ui
+#undef glVertexAttribP3uiv
+#define glVertexAttribP3uiv glad_debug_glVertexAttribP3uiv
+#undef glVertexAttribP4ui
+#define glVertexAttribP4ui glad_debug_glVertexAttribP4ui
+#undef glVertexAttribP4uiv
+#define glVertexAttribP4uiv glad_debug_glVertexAttribP4uiv
+#undef glVertexAttribPointer
+#define glVertexAttribPointer glad_debug_glVertexAttribPointer
+#undef glVertexBindingDivisor
+#define glVertexBindingDivisor glad_debug_glVertexBindingDivisor
+#undef glVertexP2ui
+#define glVertexP2ui glad_debug_glVertexP2ui
+#undef glVertexP2uiv
+#define glVertexP2uiv glad_debug_glVertexP2uiv
+#undef glVertexP3ui
+#define glVertexP3ui glad_debug_glVertexP3ui
+#undef glVertexP3uiv
+#define glVertexP3uiv glad_debug_glVertexP3uiv
+#undef glVertexP4ui
+#define glVertexP4ui glad_debug_glVertexP4ui
+#undef glVertexP4uiv
+#define glVertexP4uiv glad_debug_glVertexP4uiv
+#undef glVertexPointer
+#define glVertexPointer glad_debug_glVertexPointer
+#undef glViewport
+#define glViewport glad_debug_glViewport
+#undef glViewportArrayv
+#define glViewportArrayv glad_debug_glViewportArrayv
+#undef glViewportIndexedf
+#define glViewportIndexedf glad_debug_glViewportIndexedf
+#undef glViewportIndexedfv
+#define glViewportIndexedfv glad_debug_glViewportIndexedfv
+#undef glWaitSync
+#define glWaitSync glad_debug_glWaitSync
+#undef glWindowPos2d
+#define glWindowPos2d glad_debug_glWindowPos2d
+#undef glWindowPos2dv
+#define glWindowPos2dv glad_debug_glWindowPos2dv
+#undef glWindowPos2f
+#define glWindowPos2f glad_debug_glWindowPos2f
+#undef glWindowPos2fv
+#define glWindowPos2fv glad_debug_glWindowPos2fv
+#undef glWindowPos2i
+#define glWindowPos2i glad_debug_glWindowPos2i
+#undef glWindowPos2iv
+#define glWindowPos2iv glad_debug_glWindowPos2iv
+#undef glWindowPos2s
+#define glWindowPos2s glad_debug_glWindowPos2s
+#undef glWindowPos2sv
+#define glWindowPos2sv glad_debug_glWindowPos2sv
+#undef glWindowPos3d
+#define glWindowPos3d glad_debug_glWindowPos3d
+#undef glWindowPos3dv
+#define glWindowPos3dv glad_debug_glWindowPos3dv
+#undef glWindowPos3f
+#define glWindowPos3f glad_debug_glWindowPos3f
+#undef glWindowPos3fv
+#define glWindowPos3fv glad_debug_glWindowPos3fv
+#undef glWindowPos3i
+#define glWindowPos3i glad_debug_glWindowPos3i
+#undef glWindowPos3iv
+#define glWindowPos3iv glad_debug_glWindowPos3iv
+#undef glWindowPos3s
+#define glWindowPos3s glad_debug_glWindowPos3s
+#undef glWindowPos3sv
+#define glWindowPos3sv glad_debug_glWindowPos3sv
+
+#endif /* LEARNOPENGL_GL_DEBUG_LAYER */
+
+#endif
@@ -0,0 +1,306 @@
+/*
+ *	KHR_debug message log, see gl_debug_output.h
+ */
+
+#include "gl_debug_output.h"
+#include "profiler.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+namespace
+{
+	// bounded multi-producer queue (one consumer): every slot carries a sequence number telling whether it is free for the producer at
+	// position pos (sequence == pos) or holds the message written at pos (sequence == pos + 1)
+	const unsigned int queueSize = 256;	// power of two
+
+	struct Slot
+	{
+		std::atomic<unsigned long long> sequence;
+		GlDebugMessage message;
+	};
+	Slot queue[queueSize];
+	std::atomic<unsigned long long> enqueuePosition(0);
+	unsigned long long dequeuePosition = 0;	// only flush() touches it
+
+	// rate limiting, per message id the number kept in the current one second window
+	const unsigned int rateSlots = 256;	// power of two
+	struct RateSlot
+	{
+		std::atomic<unsigned int> key;		// message id + 1, 0 = unused
+		std::atomic<unsigned int> window;
+		std::atomic<unsigned int> count;
+	};
+	RateSlot rates[rateSlots];
+	std::chrono::steady_clock::time_point start;
+
+	std::atomic<unsigned int> sourceFilter(~0u);
+	std::atomic<unsigned int> typeFilter(~0u);
+	std::atomic<int> minimumRank(0);
+	std::atomic<unsigned int> ratePerSecond(10);
+
+	std::atomic<unsigned long long> received(0), filtered(0), rateLimited(0), overflowed(0), performance(0);
+	bool installed = false;
+
+	int severityRank(GLenum severity)
+	{
+		switch (severity)
+		{
+		case GL_DEBUG_SEVERITY_HIGH:	return 3;
+		case GL_DEBUG_SEVERITY_MEDIUM:	return 2;
+		case GL_DEBUG_SEVERITY_LOW:		return 1;
+		default:						return 0;	// GL_DEBUG_SEVERITY_NOTIFICATION
+		}
+	}
+
+	bool withinRate(GLuint id)
+	{
+		unsigned int key = id + 1;
+		unsigned int window = (unsigned int)std::chrono::duration_cast<std::chrono::seconds>(std::chrono::steady_clock::now() - start).count();
+		for (unsigned int probe = 0; probe < 8; probe++)
+		{
+			RateSlot& slot = rates[(id * 2654435761u + probe) & (rateSlots - 1)];
+			unsigned int existing = slot.key.load(std::memory_order_relaxed);
+			if (existing == 0 && slot.key.compare_exchange_strong(existing, key))
+			{
+				existing = key;
+				slot.window.store(window);
+				slot.count.store(0);
+			}
+			if (existing != key)
+			{
+				continue;
+			}
+
+			unsigned int seen = slot.window.load();
+			if (seen != window && slot.window.compare_exchange_strong(seen, window))
+			{
+				slot.count.store(0);	// new second, start counting again
+			}
+			return slot.count.fetch_add(1) < ratePerSecond.load(std::memory_order_relaxed);
+		}
+		return true;	// table full, don't lose messages because of it
+	}
+
+	bool enqueue(const GlDebugMessage& message)
+	{
+		unsigned long long position = enqueuePosition.load(std::memory_order_relaxed);
+		Slot* slot;
+		while (true)
+		{
+			slot = &queue[position & (queueSize - 1)];
+			unsigned long long sequence = slot->sequence.load(std::memory_order_acquire);
+			long long difference = (long long)sequence - (long long)position;
+			if (difference == 0)
+			{
+				if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+				{
+					break;	// the slot is ours
+				}
+			}
+			else if (difference < 0)
+			{
+				return false;	// full, flush() hasn't caught up
+			}
+			else
+			{
+				position = enqueuePosition.load(std::memory_order_relaxed);
+			}
+		}
+		slot->message = message;
+		slot->sequence.store(position + 1, std::memory_order_release);
+		return true;
+	}
+
+	void APIENTRY callback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* text, const void* /*user*/)
+	{
+		received.fetch_add(1, std::memory_order_relaxed);
+		if ((sourceFilter.load(std::memory_order_relaxed) & GlDebugOutput::sourceBit(source)) == 0 ||
+			(typeFilter.load(std::memory_order_relaxed) & GlDebugOutput::typeBit(type)) == 0 ||
+			severityRank(severity) < minimumRank.load(std::memory_order_relaxed))
+		{
+			filtered.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		if (!withinRate(id))
+		{
+			rateLimited.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		GlDebugMessage message;
+		message.source = source;
+		message.type = type;
+		message.id = id;
+		message.severity = severity;
+		message.scope = Profiler::currentScope();	// only meaningful with synchronous output, see install()
+		size_t count = length >= 0 ? (size_t)length : std::strlen(text);
+		if (count >= sizeof(message.text))
+		{
+			count = sizeof(message.text) - 1;
+		}
+		std::memcpy(message.text, text, count);
+		message.text[count] = '\0';
+
+		if (!enqueue(message))
+		{
+			overflowed.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		if (type == GL_DEBUG_TYPE_PERFORMANCE)
+		{
+			performance.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+namespace GlDebugOutput
+{
+	bool install(bool synchronous)
+	{
+		if (!GLAD_GL_VERSION_4_3 && !GLAD_GL_KHR_debug)
+		{
+			return false;
+		}
+
+		start = std::chrono::steady_clock::now();
+		for (unsigned int i = 0; i < queueSize; i++)
+		{
+			queue[i].sequence.store(i);
+		}
+		enqueuePosition.store(0);
+		dequeuePosition = 0;
+
+		glEnable(GL_DEBUG_OUTPUT);
+		if (synchronous)
+		{
+			glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);	// callback inside the offending call, on its thread
+		}
+		else
+		{
+			glDisable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+		}
+		glDebugMessageCallback(callback, NULL);
+		glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DONT_CARE, 0, NULL, GL_TRUE);	// everything, we filter ourselves
+		installed = true;
+		return true;
+	}
+
+	void uninstall()
+	{
+		if (installed)
+		{
+			glDebugMessageCallback(NULL, NULL);
+			glDisable(GL_DEBUG_OUTPUT);
+			installed = false;
+		}
+	}
+
+	void setFilter(unsigned int sources, unsigned int types, GLenum minimumSeverity)
+	{
+		sourceFilter.store(sources);
+		typeFilter.store(types);
+		minimumRank.store(severityRank(minimumSeverity));
+	}
+
+	unsigned int sourceBit(GLenum source)
+	{
+		return source >= GL_DEBUG_SOURCE_API && source <= GL_DEBUG_SOURCE_OTHER ? 1u << (source - GL_DEBUG_SOURCE_API) : 1u << 5;
+	}
+
+	unsigned int typeBit(GLenum type)
+	{
+		if (type >= GL_DEBUG_TYPE_ERROR && type <= GL_DEBUG_TYPE_OTHER)
+		{
+			return 1u << (type - GL_DEBUG_TYPE_ERROR);
+		}
+		if (type >= GL_DEBUG_TYPE_MARKER && type <= GL_DEBUG_TYPE_POP_GROUP)
+		{
+			return 1u << (6 + type - GL_DEBUG_TYPE_MARKER);
+		}
+		return 1u << 5;	// as GL_DEBUG_TYPE_OTHER
+	}
+
+	void setRateLimit(unsigned int perSecond)
+	{
+		ratePerSecond.store(perSecond);
+	}
+
+	int flush(std::ostream& out)
+	{
+		int count = 0;
+		while (true)
+		{
+			Slot& slot = queue[dequeuePosition & (queueSize - 1)];
+			if (slot.sequence.load(std::memory_order_acquire) != dequeuePosition + 1)
+			{
+				break;	// empty (or the producer is still writing it)
+			}
+			const GlDebugMessage& message = slot.message;
+			out << "GL::" << typeName(message.type) << "::" << severityName(message.severity) << " (" << sourceName(message.source)
+				<< ", id " << message.id << ")";
+			if (message.scope[0] != '\0')
+			{
+				out << " in " << message.scope;
+			}
+			out << ": " << message.text << "\n";
+
+			slot.sequence.store(dequeuePosition + queueSize, std::memory_order_release);	// free for the next round
+			dequeuePosition++;
+			count++;
+		}
+		return count;
+	}
+
+	Stats stats()
+	{
+		Stats result;
+		result.received = received.load();
+		result.filtered = filtered.load();
+		result.rateLimited = rateLimited.load();
+		result.overflowed = overflowed.load();
+		result.performance = performance.load();
+		return result;
+	}
+
+	const char* sourceName(GLenum source)
+	{
+		switch (source)
+		{
+		case GL_DEBUG_SOURCE_API:				return "API";
+		case GL_DEBUG_SOURCE_WINDOW_SYSTEM:		return "WINDOW_SYSTEM";
+		case GL_DEBUG_SOURCE_SHADER_COMPILER:	return "SHADER_COMPILER";
+		case GL_DEBUG_SOURCE_THIRD_PARTY:		return "THIRD_PARTY";
+		case GL_DEBUG_SOURCE_APPLICATION:		return "APPLICATION";
+		default:								return "OTHER";
+		}
+	}
+
+	const char* typeName(GLenum type)
+	{
+		switch (type)
+		{
+		case GL_DEBUG_TYPE_ERROR:				return "ERROR";
+		case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR:	return "DEPRECATED";
+		case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR:	return "UNDEFINED";
+		case GL_DEBUG_TYPE_PORTABILITY:			return "PORTABILITY";
+		case GL_DEBUG_TYPE_PERFORMANCE:			return "PERFORMANCE";
+		case GL_DEBUG_TYPE_MARKER:				return "MARKER";
+		case GL_DEBUG_TYPE_PUSH_GROUP:			return "PUSH_GROUP";
+		case GL_DEBUG_TYPE_POP_GROUP:			return "POP_GROUP";
+		default:								return "OTHER";
+		}
+	}
+
+	const char* severityName(GLenum severity)
+	{
+		switch (severity)
+		{
+		case GL_DEBUG_SEVERITY_HIGH:	return "HIGH";
+		case GL_DEBUG_SEVERITY_MEDIUM:	return "MEDIUM";
+		case GL_DEBUG_SEVERITY_LOW:		return "LOW";
+		default:						return "NOTIFICATION";
+		}
+	}
+}
@@ -0,0 +1,69 @@
+#ifndef GL_DEBUG_OUTPUT_H
+#define GL_DEBUG_OUTPUT_H
+
+/*
+ * NOTES:
+ * Messages from the driver through KHR_debug (core in GL 4.3).
+ *
+ * Besides errors, drivers describe things they do behind our back: a buffer being reallocated or moved to system memory, a shader
+ * recompiled because some state changed, a glReadPixels or map that waits for the GPU (implicit sync). Nobody sees these unless a debug
+ * message callback is installed with glDebugMessageCallback. Many drivers only send the performance messages in a debug context
+ * (glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE)).
+ *
+ * The callback runs inside the GL call that caused the message and must be cheap, it:
+ *	*drops what the filters exclude (sources, types, minimum severity)
+ *	*rate limits: each message id is kept at most ratePerSecond times per second, repeats are only counted (a warning every draw call
+ *	 would otherwise flood the log and cost more than the problem it reports)
+ *	*tags the message with Profiler::currentScope(), the CPU scope that made the call. For performance messages that is the part of the
+ *	 frame where the driver stalls or does extra work
+ *	*pushes it into a fixed size lock-free queue, several threads may call into GL at the same time
+ * Once a frame flush() prints what was queued, from the main thread.
+ *
+ * Tagging needs the callback on the thread that made the call, which GL only guarantees with GL_DEBUG_OUTPUT_SYNCHRONOUS. That is the
+ * default, install(false) lets the driver call back later from its own threads (cheaper, the scope is then unknown).
+ */
+
+#include "gl_api.h"
+
+#include <ostream>
+
+struct GlDebugMessage
+{
+	GLenum source;
+	GLenum type;
+	GLuint id;
+	GLenum severity;
+	const char* scope;	// profiler scope active when the message was sent, "" if unknown
+	char text[240];		// truncated
+};
+
+namespace GlDebugOutput
+{
+	// glDebugMessageCallback when GL 4.3 or GL_KHR_debug is there, false otherwise
+	bool install(bool synchronous = true);
+	void uninstall();
+
+	// bit masks over the message sources / types (bit n = n-th value in the GL_DEBUG_SOURCE_* / GL_DEBUG_TYPE_* list, see sourceBit/typeBit)
+	void setFilter(unsigned int sources, unsigned int types, GLenum minimumSeverity);
+	unsigned int sourceBit(GLenum source);
+	unsigned int typeBit(GLenum type);
+	void setRateLimit(unsigned int perSecond);
+
+	int flush(std::ostream& out);	// prints and removes the queued messages, returns how many
+
+	struct Stats
+	{
+		unsigned long long received;	// callbacks
+		unsigned long long filtered;	// excluded by the filters
+		unsigned long long rateLimited;	// dropped by the rate limit
+		unsigned long long overflowed;	// dropped because the queue was full
+		unsigned long long performance;	// GL_DEBUG_TYPE_PERFORMANCE messages queued
+	};
+	Stats stats();
+
+	const char* sourceName(GLenum source);
+	const char* typeName(GLenum type);
+	const char* severityName(GLenum severity);
+}
+
+#endif
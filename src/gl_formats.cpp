@@ -0,0 +1,52 @@
+/*
+ *	Sizes of OpenGL pixel formats, see gl_formats.h
+ */
+
+#include "gl_formats.h"
+
+namespace GlFormats
+{
+	int pixelBytes(GLenum format, GLenum type)
+	{
+		switch (type)	// packed types give the size of the whole pixel
+		{
+		case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV:
+			return 1;
+		case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV: case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+		case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+			return 2;
+		case GL_UNSIGNED_INT_8_8_8_8: case GL_UNSIGNED_INT_8_8_8_8_REV: case GL_UNSIGNED_INT_10_10_10_2: case GL_UNSIGNED_INT_2_10_10_10_REV:
+		case GL_UNSIGNED_INT_24_8: case GL_UNSIGNED_INT_10F_11F_11F_REV: case GL_UNSIGNED_INT_5_9_9_9_REV:
+			return 4;
+		case GL_FLOAT_32_UNSIGNED_INT_24_8_REV:
+			return 8;
+		}
+
+		int components;
+		switch (format)
+		{
+		case GL_RG: case GL_RG_INTEGER:
+			components = 2;
+			break;
+		case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+			components = 3;
+			break;
+		case GL_RGBA: case GL_BGRA: case GL_RGBA_INTEGER: case GL_BGRA_INTEGER:
+			components = 4;
+			break;
+		default:	// GL_RED, GL_DEPTH_COMPONENT, GL_STENCIL_INDEX, ...
+			components = 1;
+			break;
+		}
+
+		switch (type)
+		{
+		case GL_BYTE: case GL_UNSIGNED_BYTE:
+			return components;
+		case GL_SHORT: case GL_UNSIGNED_SHORT: case GL_HALF_FLOAT:
+			return components * 2;
+		default:
+			return components * 4;
+		}
+	}
+}
@@ -0,0 +1,18 @@
+#ifndef GL_FORMATS_H
+#define GL_FORMATS_H
+
+/*
+ * NOTES:
+ * Sizes of the client side pixel data OpenGL reads and writes, shared by the layers that account for uploads without calling the driver
+ * (gl_stats.cpp counts the bytes, gl_capture.cpp copies them into the trace). Only constants of glad.h are used, so the header can be
+ * included with or without the redirections of gl_api.h.
+ */
+
+#include <glad/glad.h>
+
+namespace GlFormats
+{
+	int pixelBytes(GLenum format, GLenum type);	// bytes of one pixel of format (GL_RGBA, ...) and type (GL_UNSIGNED_BYTE, ...)
+}
+
+#endif
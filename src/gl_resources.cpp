@@ -0,0 +1,515 @@
+/*
+ *	Object creation with direct state access or bind-to-edit, see gl_resources.h
+ */
+
+#include "gl_resources.h"
+#include "alloc_tracker.h"
+
+#include <cstddef>
+
+namespace
+{
+	bool useDirectStateAccess = false;
+	bool useBufferStorage = false;
+	bool useInvalidateSubdata = false;
+
+	// what is bound to each buffer target and to the two framebuffer targets, as far as GlResources knows: every bind goes through it
+	// (bindBuffer, bindFramebuffer, the edits below), so an edit of what is already bound skips the bind instead of querying and restoring
+	const int bufferTargetCount = 8;
+	GLuint boundBuffers[bufferTargetCount] = {};
+	GLuint boundReadFramebuffer = 0;
+	GLuint boundDrawFramebuffer = 0;
+
+	// the slot of target in boundBuffers, -1 for targets that are not cached (GL_ELEMENT_ARRAY_BUFFER belongs to the bound VAO)
+	int bufferSlot(GLenum target)
+	{
+		switch (target)
+		{
+		case GL_ARRAY_BUFFER:				return 0;
+		case GL_COPY_READ_BUFFER:			return 1;
+		case GL_COPY_WRITE_BUFFER:			return 2;
+		case GL_PIXEL_PACK_BUFFER:			return 3;
+		case GL_PIXEL_UNPACK_BUFFER:		return 4;
+		case GL_TEXTURE_BUFFER:				return 5;
+		case GL_TRANSFORM_FEEDBACK_BUFFER:	return 6;
+		case GL_UNIFORM_BUFFER:				return 7;
+		default:							return -1;
+		}
+	}
+
+	// without DSA every edit goes through a binding point and leaves the buffer bound there. Index buffers (the binding is part of
+	// the bound VAO) and pixel buffers (a bound one is the source or destination of every pixel transfer) are edited through
+	// GL_COPY_WRITE_BUFFER instead, only copies read that binding
+	GLenum editTarget(GLenum target)
+	{
+		switch (target)
+		{
+		case GL_ELEMENT_ARRAY_BUFFER: case GL_PIXEL_PACK_BUFFER: case GL_PIXEL_UNPACK_BUFFER:
+			return GL_COPY_WRITE_BUFFER;
+		default:
+			return target;
+		}
+	}
+
+	// binds buffer to the target it is edited through and returns that target
+	GLenum bindForEdit(GLenum target, GLuint buffer)
+	{
+		target = editTarget(target);
+		GlResources::bindBuffer(target, buffer);
+		return target;
+	}
+
+	// edits go through GL_READ_FRAMEBUFFER, which only reads (glReadPixels, blits) depend on, except for the draw buffers
+	void bindReadFramebuffer(GLuint framebuffer)
+	{
+		GlResources::bindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+	}
+
+	// the glBufferData usage hint closest to what immutable storage flags describe
+	GLenum usageFor(GLbitfield flags)
+	{
+		return (flags & (GL_DYNAMIC_STORAGE_BIT | GL_MAP_WRITE_BIT)) != 0 ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW;
+	}
+}
+
+namespace GlResources
+{
+	void init(bool allowDirectStateAccess)
+	{
+		useDirectStateAccess = allowDirectStateAccess && (GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access);
+		useBufferStorage = GLAD_GL_VERSION_4_4 || GLAD_GL_ARB_buffer_storage;
+		useInvalidateSubdata = GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_invalidate_subdata;
+		for (int i = 0; i < bufferTargetCount; i++)
+		{
+			boundBuffers[i] = 0;	// a new context has nothing bound
+		}
+		boundReadFramebuffer = 0;
+		boundDrawFramebuffer = 0;
+	}
+
+	bool directStateAccess()
+	{
+		return useDirectStateAccess;
+	}
+
+	bool bufferStorage()
+	{
+		return useBufferStorage;
+	}
+
+	bool invalidateSubdata()
+	{
+		return useInvalidateSubdata;
+	}
+
+	GLuint createBuffer(GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+	{
+		AllocScope scope(AllocTag::Resources);	// what the driver allocates for a new object is counted under Resources, also when created in a frame
+		GLuint buffer;
+		if (useDirectStateAccess)
+		{
+			glCreateBuffers(1, &buffer);
+			glNamedBufferData(buffer, size, data, usage);
+			return buffer;
+		}
+
+		glGenBuffers(1, &buffer);
+		target = bindForEdit(target, buffer);
+		glBufferData(target, size, data, usage);
+		return buffer;
+	}
+
+	GLuint createImmutableBuffer(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags)
+	{
+		AllocScope scope(AllocTag::Resources);
+		GLuint buffer;
+		if (useDirectStateAccess)
+		{
+			glCreateBuffers(1, &buffer);
+			glNamedBufferStorage(buffer, size, data, flags);
+			return buffer;
+		}
+
+		glGenBuffers(1, &buffer);
+		target = bindForEdit(target, buffer);
+		if (useBufferStorage)
+		{
+			glBufferStorage(target, size, data, flags);
+		}
+		else
+		{
+			glBufferData(target, size, data, usageFor(flags));
+		}
+		return buffer;
+	}
+
+	void bufferData(GLuint buffer, GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+	{
+		if (useDirectStateAccess)
+		{
+			glNamedBufferData(buffer, size, data, usage);
+			return;
+		}
+		target = bindForEdit(target, buffer);
+		glBufferData(target, size, data, usage);
+	}
+
+	void bufferSubData(GLuint buffer, GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
+	{
+		if (useDirectStateAccess)
+		{
+			glNamedBufferSubData(buffer, offset, size, data);
+			return;
+		}
+		target = bindForEdit(target, buffer);
+		glBufferSubData(target, offset, size, data);
+	}
+
+	void* mapBufferRange(GLuint buffer, GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access)
+	{
+		if (useDirectStateAccess)
+		{
+			return glMapNamedBufferRange(buffer, offset, length, access);
+		}
+		target = bindForEdit(target, buffer);
+		return glMapBufferRange(target, offset, length, access);
+	}
+
+	bool unmapBuffer(GLuint buffer, GLenum target)
+	{
+		if (useDirectStateAccess)
+		{
+			return glUnmapNamedBuffer(buffer) == GL_TRUE;
+		}
+		return glUnmapBuffer(editTarget(target)) == GL_TRUE;	// still bound from mapBufferRange
+	}
+
+	GLuint createTexture2D(GLenum internalFormat, int width, int height, int levels, GLenum format, GLenum type, const void* data)
+	{
+		AllocScope scope(AllocTag::Resources);
+		GLuint texture;
+		if (useDirectStateAccess)
+		{
+			// immutable storage for every level at once, the texture is complete without setting GL_TEXTURE_MAX_LEVEL
+			glCreateTextures(GL_TEXTURE_2D, 1, &texture);
+			glTextureStorage2D(texture, levels, internalFormat, width, height);
+			if (data != NULL)
+			{
+				glTextureSubImage2D(texture, 0, 0, 0, width, height, format, type, data);
+			}
+			return texture;
+		}
+
+		GLint previous = 0;
+		glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+		glGenTextures(1, &texture);
+		glBindTexture(GL_TEXTURE_2D, texture);
+
+		// allocate every mip level, each level is half the size of the previous one (at least 1 texel)
+		int w = width, h = height;
+		for (int level = 0; level < levels; level++)
+		{
+			glTexImage2D(GL_TEXTURE_2D, level, (GLint)internalFormat, w, h, 0, format, type, level == 0 ? data : NULL);
+			w = w > 1 ? w / 2 : 1;
+			h = h > 1 ? h / 2 : 1;
+		}
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levels - 1);	// otherwise the texture is incomplete without all 1+log2 levels
+		glBindTexture(GL_TEXTURE_2D, (GLuint)previous);
+		return texture;
+	}
+
+	GLuint createTexture3D(GLenum internalFormat, int width, int height, int depth, GLenum format, GLenum type, const void* data)
+	{
+		AllocScope scope(AllocTag::Resources);
+		GLuint texture;
+		const GLenum parameters[] = { GL_TEXTURE_MIN_FILTER, GL_LINEAR, GL_TEXTURE_MAG_FILTER, GL_LINEAR,
+			GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE };
+		if (useDirectStateAccess)
+		{
+			glCreateTextures(GL_TEXTURE_3D, 1, &texture);
+			glTextureStorage3D(texture, 1, internalFormat, width, height, depth);
+			if (data != NULL)
+			{
+				glTextureSubImage3D(texture, 0, 0, 0, 0, width, height, depth, format, type, data);
+			}
+			for (int i = 0; i < 10; i += 2)
+			{
+				glTextureParameteri(texture, parameters[i], (GLint)parameters[i + 1]);
+			}
+			return texture;
+		}
+
+		GLint previous = 0;
+		glGetIntegerv(GL_TEXTURE_BINDING_3D, &previous);
+		glGenTextures(1, &texture);
+		glBindTexture(GL_TEXTURE_3D, texture);
+		glTexImage3D(GL_TEXTURE_3D, 0, (GLint)internalFormat, width, height, depth, 0, format, type, data);
+		glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAX_LEVEL, 0);
+		for (int i = 0; i < 10; i += 2)
+		{
+			glTexParameteri(GL_TEXTURE_3D, parameters[i], (GLint)parameters[i + 1]);
+		}
+		glBindTexture(GL_TEXTURE_3D, (GLuint)previous);
+		return texture;
+	}
+
+	GLuint createTextureBuffer(GLenum internalFormat, GLuint buffer)
+	{
+		AllocScope scope(AllocTag::Resources);
+		GLuint texture;
+		if (useDirectStateAccess)
+		{
+			glCreateTextures(GL_TEXTURE_BUFFER, 1, &texture);
+			glTextureBuffer(texture, internalFormat, buffer);
+			return texture;
+		}
+
+		GLint previous = 0;
+		glGetIntegerv(GL_TEXTURE_BINDING_BUFFER, &previous);
+		glGenTextures(1, &texture);
+		glBindTexture(GL_TEXTURE_BUFFER, texture);
+		glTexBuffer(GL_TEXTURE_BUFFER, internalFormat, buffer);
+		glBindTexture(GL_TEXTURE_BUFFER, (GLuint)previous);
+		return texture;
+	}
+
+	void bindTexture(GLuint unit, GLenum target, GLuint texture)
+	{
+		if (useDirectStateAccess)
+		{
+			glBindTextureUnit(unit, texture);
+			return;
+		}
+		glActiveTexture(GL_TEXTURE0 + unit);
+		glBindTexture(target, texture);
+		glActiveTexture(GL_TEXTURE0);
+	}
+
+	GLuint createRenderbuffer(GLenum internalFormat, int width, int height, int samples)
+	{
+		AllocScope scope(AllocTag::Resources);
+		GLuint renderbuffer;
+		if (useDirectStateAccess)
+		{
+			glCreateRenderbuffers(1, &renderbuffer);
+			glNamedRenderbufferStorageMultisample(renderbuffer, samples > 0 ? samples : 0, internalFormat, width, height);
+			return renderbuffer;
+		}
+
+		GLint previous = 0;
+		glGetIntegerv(GL_RENDERBUFFER_BINDING, &previous);
+		glGenRenderbuffers(1, &renderbuffer);
+		glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+		if (samples > 0)
+		{
+			glRenderbufferStorageMultisample(GL_RENDERBUFFER, samples, internalFormat, width, height);
+		}
+		else
+		{
+			glRenderbufferStorage(GL_RENDERBUFFER, internalFormat, width, height);
+		}
+		glBindRenderbuffer(GL_RENDERBUFFER, (GLuint)previous);
+		return renderbuffer;
+	}
+
+	void setTextureSampling(GLuint texture, GLenum filter, GLenum wrap)
+	{
+		if (useDirectStateAccess)
+		{
+			glTextureParameteri(texture, GL_TEXTURE_MIN_FILTER, (GLint)filter);
+			glTextureParameteri(texture, GL_TEXTURE_MAG_FILTER, (GLint)filter);
+			glTextureParameteri(texture, GL_TEXTURE_WRAP_S, (GLint)wrap);
+			glTextureParameteri(texture, GL_TEXTURE_WRAP_T, (GLint)wrap);
+			return;
+		}
+
+		GLint previous = 0;
+		glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+		glBindTexture(GL_TEXTURE_2D, texture);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (GLint)filter);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, (GLint)filter);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, (GLint)wrap);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, (GLint)wrap);
+		glBindTexture(GL_TEXTURE_2D, (GLuint)previous);
+	}
+
+	void setTextureCompare(GLuint texture, GLenum compare)
+	{
+		if (useDirectStateAccess)
+		{
+			glTextureParameteri(texture, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+			glTextureParameteri(texture, GL_TEXTURE_COMPARE_FUNC, (GLint)compare);
+			return;
+		}
+
+		GLint previous = 0;
+		glGetIntegerv(GL_TEXTURE_BINDING_2D, &previous);
+		glBindTexture(GL_TEXTURE_2D, texture);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_COMPARE_FUNC, (GLint)compare);
+		glBindTexture(GL_TEXTURE_2D, (GLuint)previous);
+	}
+
+	GLuint createFramebuffer()
+	{
+		AllocScope scope(AllocTag::Resources);
+		GLuint framebuffer;
+		if (useDirectStateAccess)
+		{
+			glCreateFramebuffers(1, &framebuffer);
+		}
+		else
+		{
+			glGenFramebuffers(1, &framebuffer);	// the object is created at its first bind, which every edit below does
+		}
+		return framebuffer;
+	}
+
+	void framebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture)
+	{
+		if (useDirectStateAccess)
+		{
+			glNamedFramebufferTexture(framebuffer, attachment, texture, 0);
+			return;
+		}
+		bindReadFramebuffer(framebuffer);
+		glFramebufferTexture2D(GL_READ_FRAMEBUFFER, attachment, GL_TEXTURE_2D, texture, 0);
+	}
+
+	void framebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLuint renderbuffer)
+	{
+		if (useDirectStateAccess)
+		{
+			glNamedFramebufferRenderbuffer(framebuffer, attachment, GL_RENDERBUFFER, renderbuffer);
+			return;
+		}
+		bindReadFramebuffer(framebuffer);
+		glFramebufferRenderbuffer(GL_READ_FRAMEBUFFER, attachment, GL_RENDERBUFFER, renderbuffer);
+	}
+
+	void framebufferDrawBuffers(GLuint framebuffer, GLsizei count, const GLenum* buffers)
+	{
+		if (useDirectStateAccess)
+		{
+			glNamedFramebufferDrawBuffers(framebuffer, count, buffers);
+			return;
+		}
+		bindFramebuffer(GL_DRAW_FRAMEBUFFER, framebuffer);	// glDrawBuffers only sets those of the draw framebuffer
+		glDrawBuffers(count, buffers);
+	}
+
+	void framebufferReadBuffer(GLuint framebuffer, GLenum buffer)
+	{
+		if (useDirectStateAccess)
+		{
+			glNamedFramebufferReadBuffer(framebuffer, buffer);
+			return;
+		}
+		bindReadFramebuffer(framebuffer);
+		glReadBuffer(buffer);
+	}
+
+	GLenum checkFramebuffer(GLuint framebuffer)
+	{
+		if (useDirectStateAccess)
+		{
+			return glCheckNamedFramebufferStatus(framebuffer, GL_DRAW_FRAMEBUFFER);
+		}
+		bindReadFramebuffer(framebuffer);
+		return glCheckFramebufferStatus(GL_READ_FRAMEBUFFER);
+	}
+
+	void blitFramebuffer(GLuint read, GLuint draw, int readWidth, int readHeight, int drawWidth, int drawHeight, GLbitfield mask, GLenum filter)
+	{
+		if (useDirectStateAccess)
+		{
+			glBlitNamedFramebuffer(read, draw, 0, 0, readWidth, readHeight, 0, 0, drawWidth, drawHeight, mask, filter);
+			return;
+		}
+		bindReadFramebuffer(read);
+		bindFramebuffer(GL_DRAW_FRAMEBUFFER, draw);
+		glBlitFramebuffer(0, 0, readWidth, readHeight, 0, 0, drawWidth, drawHeight, mask, filter);
+	}
+
+	bool invalidateFramebuffer(GLuint framebuffer, GLsizei count, const GLenum* attachments)
+	{
+		if (!useInvalidateSubdata || count == 0)
+		{
+			return false;
+		}
+		if (useDirectStateAccess)
+		{
+			glInvalidateNamedFramebufferData(framebuffer, count, attachments);
+			return true;
+		}
+		bindReadFramebuffer(framebuffer);
+		glInvalidateFramebuffer(GL_READ_FRAMEBUFFER, count, attachments);
+		return true;
+	}
+
+	void bindBuffer(GLenum target, GLuint buffer)
+	{
+		int slot = bufferSlot(target);
+		if (slot >= 0 && boundBuffers[slot] == buffer)
+		{
+			return;
+		}
+		glBindBuffer(target, buffer);
+		if (slot >= 0)
+		{
+			boundBuffers[slot] = buffer;
+		}
+	}
+
+	void bindBufferBase(GLenum target, GLuint index, GLuint buffer)
+	{
+		glBindBufferBase(target, index, buffer);
+		int slot = bufferSlot(target);
+		if (slot >= 0)
+		{
+			boundBuffers[slot] = buffer;	// binding an index binds the target as well
+		}
+	}
+
+	void bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+	{
+		glBindBufferRange(target, index, buffer, offset, size);
+		int slot = bufferSlot(target);
+		if (slot >= 0)
+		{
+			boundBuffers[slot] = buffer;
+		}
+	}
+
+	void bindFramebuffer(GLenum target, GLuint framebuffer)
+	{
+		bool read = target != GL_DRAW_FRAMEBUFFER && boundReadFramebuffer != framebuffer;
+		bool draw = target != GL_READ_FRAMEBUFFER && boundDrawFramebuffer != framebuffer;
+		if (read && draw)
+		{
+			glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+		}
+		else if (read || draw)
+		{
+			glBindFramebuffer(read ? GL_READ_FRAMEBUFFER : GL_DRAW_FRAMEBUFFER, framebuffer);
+		}
+		boundReadFramebuffer = read ? framebuffer : boundReadFramebuffer;
+		boundDrawFramebuffer = draw ? framebuffer : boundDrawFramebuffer;
+	}
+
+	void deleteBuffer(GLuint buffer)
+	{
+		glDeleteBuffers(1, &buffer);
+		for (int i = 0; i < bufferTargetCount; i++)
+		{
+			boundBuffers[i] = boundBuffers[i] == buffer ? 0 : boundBuffers[i];	// deleting unbinds it, the name may come back
+		}
+	}
+
+	void deleteFramebuffer(GLuint framebuffer)
+	{
+		glDeleteFramebuffers(1, &framebuffer);
+		boundReadFramebuffer = boundReadFramebuffer == framebuffer ? 0 : boundReadFramebuffer;
+		boundDrawFramebuffer = boundDrawFramebuffer == framebuffer ? 0 : boundDrawFramebuffer;
+	}
+}
@@ -0,0 +1,96 @@
+#ifndef GL_RESOURCES_H
+#define GL_RESOURCES_H
+
+/*
+ * NOTES:
+ * Creating and editing OpenGL objects, with direct state access (DSA) when the driver has it.
+ *
+ * Classic OpenGL edits an object through a binding point (bind-to-edit):
+ *
+ *	glGenBuffers(1, &VBO);
+ *	glBindBuffer(GL_ARRAY_BUFFER, VBO);							// make it the "current" array buffer
+ *	glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);	// edits whatever is current
+ *	glBindBuffer(GL_ARRAY_BUFFER, previous);					// put back what was bound, other code may rely on it
+ *
+ * Every edit changes global state and the driver validates each bind, even though nothing is drawn. GL 4.5 (or GL_ARB_direct_state_access
+ * on older contexts) edits objects by name instead:
+ *
+ *	glCreateBuffers(1, &VBO);					// creates the object right away (glGen only reserves a name)
+ *	glNamedBufferStorage(VBO, size, data, 0);	// no binding involved
+ *
+ * The functions below use the DSA form when it is available and fall back to bind-to-edit otherwise, so the rest of the code doesn't
+ * care which one runs. init() decides once, after glad has loaded the functions.
+ *
+ * Bind-to-edit doesn't query and restore the previous binding (a glGet and two binds per edit, every frame for streamed buffers): it
+ * leaves the edited object bound and remembers what is bound to each target, so editing what is already bound binds nothing. This only
+ * holds when every bind of a buffer or framebuffer goes through bindBuffer / bindBufferBase / bindBufferRange / bindFramebuffer and every
+ * delete through deleteBuffer / deleteFramebuffer, and code must bind what it draws into or reads from right before using it.
+ * Framebuffer edits go through GL_READ_FRAMEBUFFER, so only framebufferDrawBuffers and blitFramebuffer change the draw framebuffer.
+ *
+ * Immutable storage (glBufferStorage / glNamedBufferStorage, GL 4.4) fixes a buffer's size and how it may be used at creation time, the
+ * driver can place it better and skip checks later. Without GL 4.4 the same call falls back to glBufferData with a matching usage hint.
+ *
+ * Framebuffers get the same treatment (glNamedFramebufferTexture instead of binding to GL_DRAW_FRAMEBUFFER). invalidateFramebuffer() tells
+ * the driver that attachments hold nothing worth keeping (GL 4.3 or GL_ARB_invalidate_subdata), without it the call does nothing.
+ *
+ * GpuMemory builds on these (and counts the memory), vertex array setup for pipelines lives in pipeline_state.cpp, render targets in
+ * render_target.cpp.
+ */
+
+#include "gl_api.h"
+
+namespace GlResources
+{
+	void init(bool allowDirectStateAccess = true);	// after gladLoadGLLoader, false forces the bind-to-edit path (for testing it)
+	bool directStateAccess();						// GL 4.5 or GL_ARB_direct_state_access, and allowed
+	bool bufferStorage();							// immutable buffer storage (GL 4.4 or GL_ARB_buffer_storage)
+	bool invalidateSubdata();						// glInvalidateFramebuffer and friends (GL 4.3 or GL_ARB_invalidate_subdata)
+
+	// mutable buffer (glBufferData), data may be NULL
+	GLuint createBuffer(GLenum target, GLsizeiptr size, const void* data, GLenum usage);
+	// immutable buffer, flags are GL_DYNAMIC_STORAGE_BIT (glBufferSubData allowed), GL_MAP_READ_BIT, GL_MAP_WRITE_BIT, ...
+	GLuint createImmutableBuffer(GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+	void bufferData(GLuint buffer, GLenum target, GLsizeiptr size, const void* data, GLenum usage);	// mutable buffers only
+	void bufferSubData(GLuint buffer, GLenum target, GLintptr offset, GLsizeiptr size, const void* data);
+
+	// target is only used without DSA, the buffer stays bound to it until unmapBuffer
+	void* mapBufferRange(GLuint buffer, GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access);
+	bool unmapBuffer(GLuint buffer, GLenum target);
+
+	// 2D texture with levels mip levels and level 0 uploaded (data may be NULL), internalFormat must be a sized format (GL_RGBA8, ...)
+	GLuint createTexture2D(GLenum internalFormat, int width, int height, int levels, GLenum format, GLenum type, const void* data);
+	// 3D texture of one level, filtered linearly and clamped in s, t and r (colour lookup tables)
+	GLuint createTexture3D(GLenum internalFormat, int width, int height, int depth, GLenum format, GLenum type, const void* data);
+	// renderbuffer, multisampled when samples > 0
+	GLuint createRenderbuffer(GLenum internalFormat, int width, int height, int samples);
+	void setTextureSampling(GLuint texture, GLenum filter, GLenum wrap);	// 2D texture: min and mag filter, wrap in s and t
+	// 2D depth texture: sampled through a shadow sampler, texture() returns the comparison of the reference with the stored depth
+	void setTextureCompare(GLuint texture, GLenum compare);
+	// buffer texture (GL_TEXTURE_BUFFER) reading the whole buffer as texels of internalFormat (GL_R32F, GL_RGBA32F, GL_RG32UI, ...)
+	GLuint createTextureBuffer(GLenum internalFormat, GLuint buffer);
+	// binds texture to texture unit (not GL_TEXTURE0 + unit), target is the texture's type, GL_TEXTURE0 is active afterwards
+	void bindTexture(GLuint unit, GLenum target, GLuint texture);
+
+	// framebuffers, attachment is GL_COLOR_ATTACHMENTi, GL_DEPTH_ATTACHMENT, GL_STENCIL_ATTACHMENT or GL_DEPTH_STENCIL_ATTACHMENT
+	GLuint createFramebuffer();
+	void framebufferTexture(GLuint framebuffer, GLenum attachment, GLuint texture);	// level 0 of a 2D texture
+	void framebufferRenderbuffer(GLuint framebuffer, GLenum attachment, GLuint renderbuffer);
+	void framebufferDrawBuffers(GLuint framebuffer, GLsizei count, const GLenum* buffers);
+	void framebufferReadBuffer(GLuint framebuffer, GLenum buffer);
+	GLenum checkFramebuffer(GLuint framebuffer);	// GL_FRAMEBUFFER_COMPLETE or what is wrong
+	// copies the whole read framebuffer onto the whole draw framebuffer (0 is the default framebuffer), resolves multisampling
+	void blitFramebuffer(GLuint read, GLuint draw, int readWidth, int readHeight, int drawWidth, int drawHeight, GLbitfield mask, GLenum filter);
+	// the attachments' contents are not needed anymore, false (and nothing done) without GL 4.3 / GL_ARB_invalidate_subdata
+	bool invalidateFramebuffer(GLuint framebuffer, GLsizei count, const GLenum* attachments);
+
+	// binds through the cache above, skipped when already bound (the indexed binds also bind target, they always run)
+	void bindBuffer(GLenum target, GLuint buffer);
+	void bindBufferBase(GLenum target, GLuint index, GLuint buffer);
+	void bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+	void bindFramebuffer(GLenum target, GLuint framebuffer);	// GL_FRAMEBUFFER binds both read and draw
+	// deleting unbinds the object from every target, the cache has to forget it since the name can be handed out again
+	void deleteBuffer(GLuint buffer);
+	void deleteFramebuffer(GLuint framebuffer);
+}
+
+#endif
@@ -0,0 +1,269 @@
+/*
+ *	Per frame GL call statistics, see gl_stats.h
+ */
+
+#include "gl_stats.h"
+#include "gl_api.h"
+#include "gl_formats.h"
+#include "gl_stats_layer.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+static_assert((int)GlCallCategory::Count == GL_STATS_CATEGORY_COUNT, "GlCallCategory and gl_stats_layer.h disagree");
+
+namespace
+{
+	// one more than maxThreads: the block shared by every thread after those
+	GLstatsCounters counters[GlStats::maxThreads + 1];
+	GLstatsCounters previous[GlStats::maxThreads + 1];	// what endFrame() saw last time
+	std::atomic<int> attached(0);
+
+	unsigned int frameCalls[GL_STATS_FUNCTION_COUNT];	// per function, last frame
+	GlFrameStats last;
+	unsigned long long frameIndex = 0;
+	bool active = false;
+
+	GlStatsOverlay overlayMode = GlStatsOverlay::Off;
+	int overlayInterval = 60;
+	bool due = false;
+	char summaryLine[256] = "";
+
+	const char* categoryNames[(int)GlCallCategory::Count] = {
+		"draw", "dispatch", "clear", "state", "bind", "upload", "uniform", "query", "object", "sync", "other"
+	};
+
+	void formatSummary()
+	{
+		const GlFrameStats& s = last;
+		std::snprintf(summaryLine, sizeof(summaryLine),
+			"GL frame %llu: %u calls, %llu draws, %llu vertices, %u state, %u binds, %u uniforms, %u queries, %.1f kB uploaded, %.1f kB mapped",
+			s.frame, s.calls, s.draws, s.vertices, s.categories[(int)GlCallCategory::State], s.categories[(int)GlCallCategory::Bind],
+			s.categories[(int)GlCallCategory::Uniform], s.categories[(int)GlCallCategory::Query], s.uploadBytes / 1024.0, s.mappedBytes / 1024.0);
+	}
+}
+
+// called by the generated wrappers (gl_stats_layer.c)
+extern "C" GLstatsCounters* gl_stats_attach_thread(void)
+{
+	int slot = attached.fetch_add(1);
+	return &counters[slot < GlStats::maxThreads ? slot : GlStats::maxThreads];
+}
+
+extern "C" unsigned long long gl_stats_image_bytes(GLenum format, GLenum type, GLsizei width, GLsizei height, GLsizei depth)
+{
+	if (width <= 0 || height <= 0 || depth <= 0)
+	{
+		return 0;
+	}
+	return (unsigned long long)GlFormats::pixelBytes(format, type) * (unsigned long long)width * (unsigned long long)height * (unsigned long long)depth;
+}
+
+namespace GlStats
+{
+	bool init()
+	{
+		const char* mode = std::getenv("LEARNOPENGL_GL_STATS");
+		if (mode == nullptr || mode[0] == '\0' || std::strcmp(mode, "off") == 0)
+		{
+			return false;
+		}
+		if (std::strcmp(mode, "stdout") == 0)
+		{
+			setOverlay(GlStatsOverlay::Stdout, overlayInterval);
+		}
+		else if (std::strcmp(mode, "title") == 0)
+		{
+			setOverlay(GlStatsOverlay::Title, overlayInterval);
+		}
+		else if (std::strcmp(mode, "on") != 0)
+		{
+			std::cout << "ERROR::GL_STATS::UNKNOWN_MODE " << mode << " (off, on, stdout or title)" << std::endl;
+			return false;
+		}
+		return start();
+	}
+
+	bool start()
+	{
+#ifdef GLAD_MULTI_CONTEXT
+		std::cout << "ERROR::GL_STATS::MULTI_CONTEXT the counters wrap glad's global pointers, not available with GLAD_MULTI_CONTEXT" << std::endl;
+		return false;
+#endif
+		if (active)
+		{
+			return false;
+		}
+		gl_stats_layer_install(1);
+		active = true;
+		return true;
+	}
+
+	void stop()
+	{
+		if (active)
+		{
+			gl_stats_layer_install(0);
+			active = false;
+		}
+	}
+
+	bool counting()
+	{
+		return active;
+	}
+
+	void endFrame()
+	{
+		GlFrameStats stats;
+		stats.frame = frameIndex++;
+		std::memset(frameCalls, 0, sizeof(frameCalls));
+
+		int used = attached.load();
+		int slots = used <= maxThreads ? used : maxThreads + 1;
+		for (int t = 0; t < slots; t++)
+		{
+			const GLstatsCounters& now = counters[t];
+			GLstatsCounters& before = previous[t];
+			unsigned int threadCalls = 0;
+			for (int f = 0; f < GL_STATS_FUNCTION_COUNT; f++)
+			{
+				unsigned int calls = now.calls[f] - before.calls[f];	// wraps around correctly
+				if (calls != 0)
+				{
+					before.calls[f] += calls;
+					frameCalls[f] += calls;
+					stats.categories[gl_stats_function_categories[f]] += calls;
+					threadCalls += calls;
+				}
+			}
+			if (threadCalls != 0)
+			{
+				stats.threads++;
+				stats.calls += threadCalls;
+			}
+
+			unsigned long long draws = now.draws, vertices = now.vertices, uploadBytes = now.uploadBytes, mappedBytes = now.mappedBytes;
+			stats.draws += draws - before.draws;
+			stats.vertices += vertices - before.vertices;
+			stats.uploadBytes += uploadBytes - before.uploadBytes;
+			stats.mappedBytes += mappedBytes - before.mappedBytes;
+			before.draws = draws;
+			before.vertices = vertices;
+			before.uploadBytes = uploadBytes;
+			before.mappedBytes = mappedBytes;
+		}
+		last = stats;
+
+		due = active && overlayMode != GlStatsOverlay::Off && stats.frame % overlayInterval == 0;
+		if (due)
+		{
+			formatSummary();
+			if (overlayMode == GlStatsOverlay::Stdout)
+			{
+				std::cout << summaryLine << "\n";
+			}
+		}
+	}
+
+	const GlFrameStats& lastFrame()
+	{
+		return last;
+	}
+
+	unsigned int lastFrameCalls(const char* function)
+	{
+		for (int f = 0; f < GL_STATS_FUNCTION_COUNT; f++)
+		{
+			if (std::strcmp(gl_stats_function_names[f], function) == 0)
+			{
+				return frameCalls[f];
+			}
+		}
+		return 0;
+	}
+
+	int topFunctions(int count, const char** names, unsigned int* calls)
+	{
+		// insertion into the short sorted output, the table is scanned once
+		if (count <= 0)
+		{
+			return 0;
+		}
+		int written = 0;
+		for (int f = 0; f < GL_STATS_FUNCTION_COUNT; f++)
+		{
+			unsigned int value = frameCalls[f];
+			if (value == 0 || (written == count && value <= calls[count - 1]))
+			{
+				continue;
+			}
+			int i = written < count ? written++ : count - 1;
+			for (; i > 0 && calls[i - 1] < value; i--)
+			{
+				names[i] = names[i - 1];
+				calls[i] = calls[i - 1];
+			}
+			names[i] = gl_stats_function_names[f];
+			calls[i] = value;
+		}
+		return written;
+	}
+
+	void setOverlay(GlStatsOverlay overlay, int interval)
+	{
+		overlayMode = overlay;
+		overlayInterval = interval > 0 ? interval : 1;
+	}
+
+	GlStatsOverlay overlay()
+	{
+		return overlayMode;
+	}
+
+	bool overlayDue()
+	{
+		return due;
+	}
+
+	const char* summary()
+	{
+		formatSummary();
+		return summaryLine;
+	}
+
+	void report(std::ostream& out)
+	{
+		if (!active)
+		{
+			return;
+		}
+		out << "GL calls (frame " << last.frame << "): " << last.calls << " calls from " << last.threads << " thread(s), " << last.draws
+			<< " draws, " << last.vertices << " vertices, " << last.uploadBytes / 1024 << " kB uploaded, " << last.mappedBytes / 1024
+			<< " kB mapped\n";
+		for (int i = 0; i < (int)GlCallCategory::Count; i++)
+		{
+			if (last.categories[i] > 0)
+			{
+				out << "\t" << categoryNames[i] << ": " << last.categories[i] << "\n";
+			}
+		}
+
+		const int topCount = 10;
+		const char* names[topCount];
+		unsigned int calls[topCount];
+		int count = topFunctions(topCount, names, calls);
+		for (int i = 0; i < count; i++)
+		{
+			out << "\t\t" << names[i] << " " << calls[i] << "\n";
+		}
+	}
+
+	const char* categoryName(GlCallCategory category)
+	{
+		return categoryNames[(int)category];
+	}
+}
@@ -0,0 +1,97 @@
+#ifndef GL_STATS_H
+#define GL_STATS_H
+
+/*
+ * NOTES:
+ * Per frame statistics of the OpenGL calls we make: how many of every function, grouped into draws, state changes, binds, uploads, ...
+ *
+ * Frame time is a late and noisy signal, a change that doubles the binds or uploads the same buffer twice often costs nothing measurable
+ * on a fast machine and shows up months later on a slow one. Call counts are exact and the same on every run of the same scene, so a
+ * regression is visible in them the moment it is made.
+ *
+ * The counting sits in glad's dispatch like the capture (gl_capture.h): start() replaces glad's function pointers with generated wrappers
+ * (gl_stats_layer.h/.c) that increment a counter and call on. Every thread making GL calls gets its own block of counters on its first
+ * call (a thread local pointer, no locks or atomics per call), endFrame() sums the blocks into a GlFrameStats. Besides the call counts:
+ *	*draws		draw commands, a glMultiDraw* counts every draw it makes (unless the count comes from a buffer)
+ *	*vertices	vertices (or indices) of direct draws times their instances, indirect draws are not counted
+ *	*upload		bytes of buffer data and texture images handed to the driver, tightly packed (the unpack row length is ignored)
+ *	*mapped		bytes of buffer ranges mapped for writing
+ *
+ * The counters of other threads are read while those threads keep calling, a call made during endFrame() may land in the next frame.
+ * Blocks are never freed, a thread that ends keeps its slot, after maxThreads threads the rest share one block.
+ *
+ * Start it right after loading glad, after GlCapture::init() and before GlDebug::init() (which copies glad's pointers): then every call
+ * of ours is counted once, and so are the glGetError calls of the debug layer. Wrapping layers stack, stop them in the reverse order.
+ * Not available with GLAD_MULTI_CONTEXT.
+ *
+ * The environment variable LEARNOPENGL_GL_STATS picks what init() does:
+ *	*off (or not set)	nothing, glad's pointers stay untouched
+ *	*on					count, see lastFrame() and report()
+ *	*stdout				count and print a summary line every overlayInterval frames
+ *	*title				count and show the summary in the window title (the caller sets it, see overlayDue())
+ */
+
+#include <ostream>
+
+// what a call does, every GL function belongs to one category
+enum class GlCallCategory
+{
+	Draw,		// glDraw*, glMultiDraw*
+	Dispatch,	// glDispatchCompute*
+	Clear,		// glClear*, glInvalidate*, glBlitFramebuffer
+	State,		// fixed function state, texture/sampler parameters, vertex formats, framebuffer attachments
+	Bind,		// glBind*, glUseProgram, glActiveTexture
+	Upload,		// buffer and texture data, maps, copies
+	Uniform,	// glUniform*, glProgramUniform*
+	Query,		// glGet*, glIs*, query objects, glReadPixels
+	Object,		// glGen*, glCreate*, glDelete*, storage allocation
+	Sync,		// glFinish, glFlush, fences, memory barriers
+	Other,		// shader compilation, debug labels, legacy immediate mode, ...
+	Count
+};
+
+enum class GlStatsOverlay
+{
+	Off,
+	Stdout,
+	Title
+};
+
+// the calls of one frame
+struct GlFrameStats
+{
+	unsigned long long frame = 0;
+	unsigned int calls = 0;
+	unsigned int categories[(int)GlCallCategory::Count] = {};
+	unsigned long long draws = 0;
+	unsigned long long vertices = 0;
+	unsigned long long uploadBytes = 0;
+	unsigned long long mappedBytes = 0;
+	int threads = 0;	// threads that made GL calls during the frame
+};
+
+namespace GlStats
+{
+	const int maxThreads = 16;	// with their own counters, more share one block
+
+	bool init();				// after gladLoadGLLoader and GlCapture::init(), before GlDebug::init(), reads LEARNOPENGL_GL_STATS
+	bool start();
+	void stop();				// puts the previous pointers back
+	bool counting();
+
+	void endFrame();			// the calls since the last endFrame() become lastFrame()
+	const GlFrameStats& lastFrame();
+	unsigned int lastFrameCalls(const char* function);	// calls of one function ("glBindBuffer") in the last frame
+	// the most called functions of the last frame, most first, returns how many were written (at most count)
+	int topFunctions(int count, const char** names, unsigned int* calls);
+
+	void setOverlay(GlStatsOverlay overlay, int interval);	// every interval frames
+	GlStatsOverlay overlay();
+	bool overlayDue();			// the last endFrame() refreshed the overlay
+	const char* summary();		// one line for the last frame, valid until the next endFrame()
+
+	void report(std::ostream& out);	// the last frame per category and its most called functions
+	const char* categoryName(GlCallCategory category);
+}
+
+#endif
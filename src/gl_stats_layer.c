@@ -0,0 +1,10778 @@
+/*
+
+    Per thread call counters for the OpenGL loader generated by glad 0.1.34, see gl_stats_layer.h.
+
+    APIs: gl=4.6
+    Extensions: GL_ARB_bindless_texture,GL_ARB_buffer_storage,GL_ARB_direct_state_access,GL_ARB_gl_spirv,GL_ARB_invalidate_subdata,GL_ARB_multi_draw_indirect,GL_ATI_meminfo,GL_KHR_debug,GL_KHR_parallel_shader_compile,GL_NVX_gpu_memory_info
+
+    Generated by tools/gen_gl_layers.py from the function list of src/glad.c, do not edit. After regenerating the loader:
+        python tools/gen_gl_layers.py
+*/
+
+#include "gl_stats_layer.h"
+
+#if defined(_MSC_VER)
+#define GL_STATS_THREAD_LOCAL __declspec(thread)
+#else
+#define GL_STATS_THREAD_LOCAL _Thread_local
+#endif
+
+/* in gl_stats.cpp: counters for the calling thread, called once per thread on its first GL call */
+GLstatsCounters* gl_stats_attach_thread(void);
+/* in gl_stats.cpp: size of an image read by glTexImage / glTexSubImage, tightly packed */
+unsigned long long gl_stats_image_bytes(GLenum format, GLenum type, GLsizei width, GLsizei height, GLsizei depth);
+
+static GL_STATS_THREAD_LOCAL GLstatsCounters* gl_stats_thread = 0;
+
+static GLstatsCounters* gl_stats_counters(void) {
+	GLstatsCounters* c = gl_stats_thread;
+	if (c == 0) {
+		c = gl_stats_thread = gl_stats_attach_thread();
+	}
+	return c;
+}
+
+static PFNGLACCUMPROC glad_stats_real_glAccum = 0;
+static void APIENTRY glad_stats_impl_glAccum(GLenum arg0, GLfloat arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glAccum]++;
+	glad_stats_real_glAccum(arg0, arg1);
+}
+static PFNGLACTIVESHADERPROGRAMPROC glad_stats_real_glActiveShaderProgram = 0;
+static void APIENTRY glad_stats_impl_glActiveShaderProgram(GLuint arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glActiveShaderProgram]++;
+	glad_stats_real_glActiveShaderProgram(arg0, arg1);
+}
+static PFNGLACTIVETEXTUREPROC glad_stats_real_glActiveTexture = 0;
+static void APIENTRY glad_stats_impl_glActiveTexture(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glActiveTexture]++;
+	glad_stats_real_glActiveTexture(arg0);
+}
+static PFNGLALPHAFUNCPROC glad_stats_real_glAlphaFunc = 0;
+static void APIENTRY glad_stats_impl_glAlphaFunc(GLenum arg0, GLclampf arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glAlphaFunc]++;
+	glad_stats_real_glAlphaFunc(arg0, arg1);
+}
+static PFNGLARETEXTURESRESIDENTPROC glad_stats_real_glAreTexturesResident = 0;
+static GLboolean APIENTRY glad_stats_impl_glAreTexturesResident(GLsizei arg0, const GLuint * arg1, GLboolean * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glAreTexturesResident]++;
+	return glad_stats_real_glAreTexturesResident(arg0, arg1, arg2);
+}
+static PFNGLARRAYELEMENTPROC glad_stats_real_glArrayElement = 0;
+static void APIENTRY glad_stats_impl_glArrayElement(GLint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glArrayElement]++;
+	glad_stats_real_glArrayElement(arg0);
+}
+static PFNGLATTACHSHADERPROC glad_stats_real_glAttachShader = 0;
+static void APIENTRY glad_stats_impl_glAttachShader(GLuint arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glAttachShader]++;
+	glad_stats_real_glAttachShader(arg0, arg1);
+}
+static PFNGLBEGINPROC glad_stats_real_glBegin = 0;
+static void APIENTRY glad_stats_impl_glBegin(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBegin]++;
+	glad_stats_real_glBegin(arg0);
+}
+static PFNGLBEGINCONDITIONALRENDERPROC glad_stats_real_glBeginConditionalRender = 0;
+static void APIENTRY glad_stats_impl_glBeginConditionalRender(GLuint arg0, GLenum arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBeginConditionalRender]++;
+	glad_stats_real_glBeginConditionalRender(arg0, arg1);
+}
+static PFNGLBEGINQUERYPROC glad_stats_real_glBeginQuery = 0;
+static void APIENTRY glad_stats_impl_glBeginQuery(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBeginQuery]++;
+	glad_stats_real_glBeginQuery(arg0, arg1);
+}
+static PFNGLBEGINQUERYINDEXEDPROC glad_stats_real_glBeginQueryIndexed = 0;
+static void APIENTRY glad_stats_impl_glBeginQueryIndexed(GLenum arg0, GLuint arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBeginQueryIndexed]++;
+	glad_stats_real_glBeginQueryIndexed(arg0, arg1, arg2);
+}
+static PFNGLBEGINTRANSFORMFEEDBACKPROC glad_stats_real_glBeginTransformFeedback = 0;
+static void APIENTRY glad_stats_impl_glBeginTransformFeedback(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBeginTransformFeedback]++;
+	glad_stats_real_glBeginTransformFeedback(arg0);
+}
+static PFNGLBINDATTRIBLOCATIONPROC glad_stats_real_glBindAttribLocation = 0;
+static void APIENTRY glad_stats_impl_glBindAttribLocation(GLuint arg0, GLuint arg1, const GLchar * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindAttribLocation]++;
+	glad_stats_real_glBindAttribLocation(arg0, arg1, arg2);
+}
+static PFNGLBINDBUFFERPROC glad_stats_real_glBindBuffer = 0;
+static void APIENTRY glad_stats_impl_glBindBuffer(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindBuffer]++;
+	glad_stats_real_glBindBuffer(arg0, arg1);
+}
+static PFNGLBINDBUFFERBASEPROC glad_stats_real_glBindBufferBase = 0;
+static void APIENTRY glad_stats_impl_glBindBufferBase(GLenum arg0, GLuint arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindBufferBase]++;
+	glad_stats_real_glBindBufferBase(arg0, arg1, arg2);
+}
+static PFNGLBINDBUFFERRANGEPROC glad_stats_real_glBindBufferRange = 0;
+static void APIENTRY glad_stats_impl_glBindBufferRange(GLenum arg0, GLuint arg1, GLuint arg2, GLintptr arg3, GLsizeiptr arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindBufferRange]++;
+	glad_stats_real_glBindBufferRange(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLBINDBUFFERSBASEPROC glad_stats_real_glBindBuffersBase = 0;
+static void APIENTRY glad_stats_impl_glBindBuffersBase(GLenum arg0, GLuint arg1, GLsizei arg2, const GLuint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindBuffersBase]++;
+	glad_stats_real_glBindBuffersBase(arg0, arg1, arg2, arg3);
+}
+static PFNGLBINDBUFFERSRANGEPROC glad_stats_real_glBindBuffersRange = 0;
+static void APIENTRY glad_stats_impl_glBindBuffersRange(GLenum arg0, GLuint arg1, GLsizei arg2, const GLuint * arg3, const GLintptr * arg4, const GLsizeiptr * arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindBuffersRange]++;
+	glad_stats_real_glBindBuffersRange(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLBINDFRAGDATALOCATIONPROC glad_stats_real_glBindFragDataLocation = 0;
+static void APIENTRY glad_stats_impl_glBindFragDataLocation(GLuint arg0, GLuint arg1, const GLchar * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindFragDataLocation]++;
+	glad_stats_real_glBindFragDataLocation(arg0, arg1, arg2);
+}
+static PFNGLBINDFRAGDATALOCATIONINDEXEDPROC glad_stats_real_glBindFragDataLocationIndexed = 0;
+static void APIENTRY glad_stats_impl_glBindFragDataLocationIndexed(GLuint arg0, GLuint arg1, GLuint arg2, const GLchar * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindFragDataLocationIndexed]++;
+	glad_stats_real_glBindFragDataLocationIndexed(arg0, arg1, arg2, arg3);
+}
+static PFNGLBINDFRAMEBUFFERPROC glad_stats_real_glBindFramebuffer = 0;
+static void APIENTRY glad_stats_impl_glBindFramebuffer(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindFramebuffer]++;
+	glad_stats_real_glBindFramebuffer(arg0, arg1);
+}
+static PFNGLBINDIMAGETEXTUREPROC glad_stats_real_glBindImageTexture = 0;
+static void APIENTRY glad_stats_impl_glBindImageTexture(GLuint arg0, GLuint arg1, GLint arg2, GLboolean arg3, GLint arg4, GLenum arg5, GLenum arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindImageTexture]++;
+	glad_stats_real_glBindImageTexture(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLBINDIMAGETEXTURESPROC glad_stats_real_glBindImageTextures = 0;
+static void APIENTRY glad_stats_impl_glBindImageTextures(GLuint arg0, GLsizei arg1, const GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindImageTextures]++;
+	glad_stats_real_glBindImageTextures(arg0, arg1, arg2);
+}
+static PFNGLBINDPROGRAMPIPELINEPROC glad_stats_real_glBindProgramPipeline = 0;
+static void APIENTRY glad_stats_impl_glBindProgramPipeline(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindProgramPipeline]++;
+	glad_stats_real_glBindProgramPipeline(arg0);
+}
+static PFNGLBINDRENDERBUFFERPROC glad_stats_real_glBindRenderbuffer = 0;
+static void APIENTRY glad_stats_impl_glBindRenderbuffer(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindRenderbuffer]++;
+	glad_stats_real_glBindRenderbuffer(arg0, arg1);
+}
+static PFNGLBINDSAMPLERPROC glad_stats_real_glBindSampler = 0;
+static void APIENTRY glad_stats_impl_glBindSampler(GLuint arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindSampler]++;
+	glad_stats_real_glBindSampler(arg0, arg1);
+}
+static PFNGLBINDSAMPLERSPROC glad_stats_real_glBindSamplers = 0;
+static void APIENTRY glad_stats_impl_glBindSamplers(GLuint arg0, GLsizei arg1, const GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindSamplers]++;
+	glad_stats_real_glBindSamplers(arg0, arg1, arg2);
+}
+static PFNGLBINDTEXTUREPROC glad_stats_real_glBindTexture = 0;
+static void APIENTRY glad_stats_impl_glBindTexture(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindTexture]++;
+	glad_stats_real_glBindTexture(arg0, arg1);
+}
+static PFNGLBINDTEXTUREUNITPROC glad_stats_real_glBindTextureUnit = 0;
+static void APIENTRY glad_stats_impl_glBindTextureUnit(GLuint arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindTextureUnit]++;
+	glad_stats_real_glBindTextureUnit(arg0, arg1);
+}
+static PFNGLBINDTEXTURESPROC glad_stats_real_glBindTextures = 0;
+static void APIENTRY glad_stats_impl_glBindTextures(GLuint arg0, GLsizei arg1, const GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindTextures]++;
+	glad_stats_real_glBindTextures(arg0, arg1, arg2);
+}
+static PFNGLBINDTRANSFORMFEEDBACKPROC glad_stats_real_glBindTransformFeedback = 0;
+static void APIENTRY glad_stats_impl_glBindTransformFeedback(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindTransformFeedback]++;
+	glad_stats_real_glBindTransformFeedback(arg0, arg1);
+}
+static PFNGLBINDVERTEXARRAYPROC glad_stats_real_glBindVertexArray = 0;
+static void APIENTRY glad_stats_impl_glBindVertexArray(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindVertexArray]++;
+	glad_stats_real_glBindVertexArray(arg0);
+}
+static PFNGLBINDVERTEXBUFFERPROC glad_stats_real_glBindVertexBuffer = 0;
+static void APIENTRY glad_stats_impl_glBindVertexBuffer(GLuint arg0, GLuint arg1, GLintptr arg2, GLsizei arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindVertexBuffer]++;
+	glad_stats_real_glBindVertexBuffer(arg0, arg1, arg2, arg3);
+}
+static PFNGLBINDVERTEXBUFFERSPROC glad_stats_real_glBindVertexBuffers = 0;
+static void APIENTRY glad_stats_impl_glBindVertexBuffers(GLuint arg0, GLsizei arg1, const GLuint * arg2, const GLintptr * arg3, const GLsizei * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBindVertexBuffers]++;
+	glad_stats_real_glBindVertexBuffers(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLBITMAPPROC glad_stats_real_glBitmap = 0;
+static void APIENTRY glad_stats_impl_glBitmap(GLsizei arg0, GLsizei arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4, GLfloat arg5, const GLubyte * arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBitmap]++;
+	glad_stats_real_glBitmap(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLBLENDCOLORPROC glad_stats_real_glBlendColor = 0;
+static void APIENTRY glad_stats_impl_glBlendColor(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBlendColor]++;
+	glad_stats_real_glBlendColor(arg0, arg1, arg2, arg3);
+}
+static PFNGLBLENDEQUATIONPROC glad_stats_real_glBlendEquation = 0;
+static void APIENTRY glad_stats_impl_glBlendEquation(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBlendEquation]++;
+	glad_stats_real_glBlendEquation(arg0);
+}
+static PFNGLBLENDEQUATIONSEPARATEPROC glad_stats_real_glBlendEquationSeparate = 0;
+static void APIENTRY glad_stats_impl_glBlendEquationSeparate(GLenum arg0, GLenum arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBlendEquationSeparate]++;
+	glad_stats_real_glBlendEquationSeparate(arg0, arg1);
+}
+static PFNGLBLENDEQUATIONSEPARATEIPROC glad_stats_real_glBlendEquationSeparatei = 0;
+static void APIENTRY glad_stats_impl_glBlendEquationSeparatei(GLuint arg0, GLenum arg1, GLenum arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBlendEquationSeparatei]++;
+	glad_stats_real_glBlendEquationSeparatei(arg0, arg1, arg2);
+}
+static PFNGLBLENDEQUATIONIPROC glad_stats_real_glBlendEquationi = 0;
+static void APIENTRY glad_stats_impl_glBlendEquationi(GLuint arg0, GLenum arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBlendEquationi]++;
+	glad_stats_real_glBlendEquationi(arg0, arg1);
+}
+static PFNGLBLENDFUNCPROC glad_stats_real_glBlendFunc = 0;
+static void APIENTRY glad_stats_impl_glBlendFunc(GLenum arg0, GLenum arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBlendFunc]++;
+	glad_stats_real_glBlendFunc(arg0, arg1);
+}
+static PFNGLBLENDFUNCSEPARATEPROC glad_stats_real_glBlendFuncSeparate = 0;
+static void APIENTRY glad_stats_impl_glBlendFuncSeparate(GLenum arg0, GLenum arg1, GLenum arg2, GLenum arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBlendFuncSeparate]++;
+	glad_stats_real_glBlendFuncSeparate(arg0, arg1, arg2, arg3);
+}
+static PFNGLBLENDFUNCSEPARATEIPROC glad_stats_real_glBlendFuncSeparatei = 0;
+static void APIENTRY glad_stats_impl_glBlendFuncSeparatei(GLuint arg0, GLenum arg1, GLenum arg2, GLenum arg3, GLenum arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBlendFuncSeparatei]++;
+	glad_stats_real_glBlendFuncSeparatei(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLBLENDFUNCIPROC glad_stats_real_glBlendFunci = 0;
+static void APIENTRY glad_stats_impl_glBlendFunci(GLuint arg0, GLenum arg1, GLenum arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBlendFunci]++;
+	glad_stats_real_glBlendFunci(arg0, arg1, arg2);
+}
+static PFNGLBLITFRAMEBUFFERPROC glad_stats_real_glBlitFramebuffer = 0;
+static void APIENTRY glad_stats_impl_glBlitFramebuffer(GLint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLint arg7, GLbitfield arg8, GLenum arg9) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBlitFramebuffer]++;
+	glad_stats_real_glBlitFramebuffer(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+static PFNGLBLITNAMEDFRAMEBUFFERPROC glad_stats_real_glBlitNamedFramebuffer = 0;
+static void APIENTRY glad_stats_impl_glBlitNamedFramebuffer(GLuint arg0, GLuint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLint arg7, GLint arg8, GLint arg9, GLbitfield arg10, GLenum arg11) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBlitNamedFramebuffer]++;
+	glad_stats_real_glBlitNamedFramebuffer(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11);
+}
+static PFNGLBUFFERDATAPROC glad_stats_real_glBufferData = 0;
+static void APIENTRY glad_stats_impl_glBufferData(GLenum arg0, GLsizeiptr arg1, const void * arg2, GLenum arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBufferData]++;
+	if (arg2) c->uploadBytes += (unsigned long long)arg1;
+	glad_stats_real_glBufferData(arg0, arg1, arg2, arg3);
+}
+static PFNGLBUFFERSTORAGEPROC glad_stats_real_glBufferStorage = 0;
+static void APIENTRY glad_stats_impl_glBufferStorage(GLenum arg0, GLsizeiptr arg1, const void * arg2, GLbitfield arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBufferStorage]++;
+	if (arg2) c->uploadBytes += (unsigned long long)arg1;
+	glad_stats_real_glBufferStorage(arg0, arg1, arg2, arg3);
+}
+static PFNGLBUFFERSUBDATAPROC glad_stats_real_glBufferSubData = 0;
+static void APIENTRY glad_stats_impl_glBufferSubData(GLenum arg0, GLintptr arg1, GLsizeiptr arg2, const void * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glBufferSubData]++;
+	c->uploadBytes += (unsigned long long)arg2;
+	glad_stats_real_glBufferSubData(arg0, arg1, arg2, arg3);
+}
+static PFNGLCALLLISTPROC glad_stats_real_glCallList = 0;
+static void APIENTRY glad_stats_impl_glCallList(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCallList]++;
+	glad_stats_real_glCallList(arg0);
+}
+static PFNGLCALLLISTSPROC glad_stats_real_glCallLists = 0;
+static void APIENTRY glad_stats_impl_glCallLists(GLsizei arg0, GLenum arg1, const void * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCallLists]++;
+	glad_stats_real_glCallLists(arg0, arg1, arg2);
+}
+static PFNGLCHECKFRAMEBUFFERSTATUSPROC glad_stats_real_glCheckFramebufferStatus = 0;
+static GLenum APIENTRY glad_stats_impl_glCheckFramebufferStatus(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCheckFramebufferStatus]++;
+	return glad_stats_real_glCheckFramebufferStatus(arg0);
+}
+static PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC glad_stats_real_glCheckNamedFramebufferStatus = 0;
+static GLenum APIENTRY glad_stats_impl_glCheckNamedFramebufferStatus(GLuint arg0, GLenum arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCheckNamedFramebufferStatus]++;
+	return glad_stats_real_glCheckNamedFramebufferStatus(arg0, arg1);
+}
+static PFNGLCLAMPCOLORPROC glad_stats_real_glClampColor = 0;
+static void APIENTRY glad_stats_impl_glClampColor(GLenum arg0, GLenum arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClampColor]++;
+	glad_stats_real_glClampColor(arg0, arg1);
+}
+static PFNGLCLEARPROC glad_stats_real_glClear = 0;
+static void APIENTRY glad_stats_impl_glClear(GLbitfield arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClear]++;
+	glad_stats_real_glClear(arg0);
+}
+static PFNGLCLEARACCUMPROC glad_stats_real_glClearAccum = 0;
+static void APIENTRY glad_stats_impl_glClearAccum(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearAccum]++;
+	glad_stats_real_glClearAccum(arg0, arg1, arg2, arg3);
+}
+static PFNGLCLEARBUFFERDATAPROC glad_stats_real_glClearBufferData = 0;
+static void APIENTRY glad_stats_impl_glClearBufferData(GLenum arg0, GLenum arg1, GLenum arg2, GLenum arg3, const void * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearBufferData]++;
+	glad_stats_real_glClearBufferData(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLCLEARBUFFERSUBDATAPROC glad_stats_real_glClearBufferSubData = 0;
+static void APIENTRY glad_stats_impl_glClearBufferSubData(GLenum arg0, GLenum arg1, GLintptr arg2, GLsizeiptr arg3, GLenum arg4, GLenum arg5, const void * arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearBufferSubData]++;
+	glad_stats_real_glClearBufferSubData(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLCLEARBUFFERFIPROC glad_stats_real_glClearBufferfi = 0;
+static void APIENTRY glad_stats_impl_glClearBufferfi(GLenum arg0, GLint arg1, GLfloat arg2, GLint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearBufferfi]++;
+	glad_stats_real_glClearBufferfi(arg0, arg1, arg2, arg3);
+}
+static PFNGLCLEARBUFFERFVPROC glad_stats_real_glClearBufferfv = 0;
+static void APIENTRY glad_stats_impl_glClearBufferfv(GLenum arg0, GLint arg1, const GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearBufferfv]++;
+	glad_stats_real_glClearBufferfv(arg0, arg1, arg2);
+}
+static PFNGLCLEARBUFFERIVPROC glad_stats_real_glClearBufferiv = 0;
+static void APIENTRY glad_stats_impl_glClearBufferiv(GLenum arg0, GLint arg1, const GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearBufferiv]++;
+	glad_stats_real_glClearBufferiv(arg0, arg1, arg2);
+}
+static PFNGLCLEARBUFFERUIVPROC glad_stats_real_glClearBufferuiv = 0;
+static void APIENTRY glad_stats_impl_glClearBufferuiv(GLenum arg0, GLint arg1, const GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearBufferuiv]++;
+	glad_stats_real_glClearBufferuiv(arg0, arg1, arg2);
+}
+static PFNGLCLEARCOLORPROC glad_stats_real_glClearColor = 0;
+static void APIENTRY glad_stats_impl_glClearColor(GLclampf arg0, GLclampf arg1, GLclampf arg2, GLclampf arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearColor]++;
+	glad_stats_real_glClearColor(arg0, arg1, arg2, arg3);
+}
+static PFNGLCLEARDEPTHPROC glad_stats_real_glClearDepth = 0;
+static void APIENTRY glad_stats_impl_glClearDepth(GLclampd arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearDepth]++;
+	glad_stats_real_glClearDepth(arg0);
+}
+static PFNGLCLEARDEPTHFPROC glad_stats_real_glClearDepthf = 0;
+static void APIENTRY glad_stats_impl_glClearDepthf(GLfloat arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearDepthf]++;
+	glad_stats_real_glClearDepthf(arg0);
+}
+static PFNGLCLEARINDEXPROC glad_stats_real_glClearIndex = 0;
+static void APIENTRY glad_stats_impl_glClearIndex(GLfloat arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearIndex]++;
+	glad_stats_real_glClearIndex(arg0);
+}
+static PFNGLCLEARNAMEDBUFFERDATAPROC glad_stats_real_glClearNamedBufferData = 0;
+static void APIENTRY glad_stats_impl_glClearNamedBufferData(GLuint arg0, GLenum arg1, GLenum arg2, GLenum arg3, const void * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearNamedBufferData]++;
+	glad_stats_real_glClearNamedBufferData(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLCLEARNAMEDBUFFERSUBDATAPROC glad_stats_real_glClearNamedBufferSubData = 0;
+static void APIENTRY glad_stats_impl_glClearNamedBufferSubData(GLuint arg0, GLenum arg1, GLintptr arg2, GLsizeiptr arg3, GLenum arg4, GLenum arg5, const void * arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearNamedBufferSubData]++;
+	glad_stats_real_glClearNamedBufferSubData(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERFIPROC glad_stats_real_glClearNamedFramebufferfi = 0;
+static void APIENTRY glad_stats_impl_glClearNamedFramebufferfi(GLuint arg0, GLenum arg1, GLint arg2, GLfloat arg3, GLint arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearNamedFramebufferfi]++;
+	glad_stats_real_glClearNamedFramebufferfi(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERFVPROC glad_stats_real_glClearNamedFramebufferfv = 0;
+static void APIENTRY glad_stats_impl_glClearNamedFramebufferfv(GLuint arg0, GLenum arg1, GLint arg2, const GLfloat * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearNamedFramebufferfv]++;
+	glad_stats_real_glClearNamedFramebufferfv(arg0, arg1, arg2, arg3);
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERIVPROC glad_stats_real_glClearNamedFramebufferiv = 0;
+static void APIENTRY glad_stats_impl_glClearNamedFramebufferiv(GLuint arg0, GLenum arg1, GLint arg2, const GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearNamedFramebufferiv]++;
+	glad_stats_real_glClearNamedFramebufferiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC glad_stats_real_glClearNamedFramebufferuiv = 0;
+static void APIENTRY glad_stats_impl_glClearNamedFramebufferuiv(GLuint arg0, GLenum arg1, GLint arg2, const GLuint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearNamedFramebufferuiv]++;
+	glad_stats_real_glClearNamedFramebufferuiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLCLEARSTENCILPROC glad_stats_real_glClearStencil = 0;
+static void APIENTRY glad_stats_impl_glClearStencil(GLint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearStencil]++;
+	glad_stats_real_glClearStencil(arg0);
+}
+static PFNGLCLEARTEXIMAGEPROC glad_stats_real_glClearTexImage = 0;
+static void APIENTRY glad_stats_impl_glClearTexImage(GLuint arg0, GLint arg1, GLenum arg2, GLenum arg3, const void * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearTexImage]++;
+	glad_stats_real_glClearTexImage(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLCLEARTEXSUBIMAGEPROC glad_stats_real_glClearTexSubImage = 0;
+static void APIENTRY glad_stats_impl_glClearTexSubImage(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLenum arg9, const void * arg10) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClearTexSubImage]++;
+	glad_stats_real_glClearTexSubImage(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+static PFNGLCLIENTACTIVETEXTUREPROC glad_stats_real_glClientActiveTexture = 0;
+static void APIENTRY glad_stats_impl_glClientActiveTexture(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClientActiveTexture]++;
+	glad_stats_real_glClientActiveTexture(arg0);
+}
+static PFNGLCLIENTWAITSYNCPROC glad_stats_real_glClientWaitSync = 0;
+static GLenum APIENTRY glad_stats_impl_glClientWaitSync(GLsync arg0, GLbitfield arg1, GLuint64 arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClientWaitSync]++;
+	return glad_stats_real_glClientWaitSync(arg0, arg1, arg2);
+}
+static PFNGLCLIPCONTROLPROC glad_stats_real_glClipControl = 0;
+static void APIENTRY glad_stats_impl_glClipControl(GLenum arg0, GLenum arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClipControl]++;
+	glad_stats_real_glClipControl(arg0, arg1);
+}
+static PFNGLCLIPPLANEPROC glad_stats_real_glClipPlane = 0;
+static void APIENTRY glad_stats_impl_glClipPlane(GLenum arg0, const GLdouble * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glClipPlane]++;
+	glad_stats_real_glClipPlane(arg0, arg1);
+}
+static PFNGLCOLOR3BPROC glad_stats_real_glColor3b = 0;
+static void APIENTRY glad_stats_impl_glColor3b(GLbyte arg0, GLbyte arg1, GLbyte arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor3b]++;
+	glad_stats_real_glColor3b(arg0, arg1, arg2);
+}
+static PFNGLCOLOR3BVPROC glad_stats_real_glColor3bv = 0;
+static void APIENTRY glad_stats_impl_glColor3bv(const GLbyte * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor3bv]++;
+	glad_stats_real_glColor3bv(arg0);
+}
+static PFNGLCOLOR3DPROC glad_stats_real_glColor3d = 0;
+static void APIENTRY glad_stats_impl_glColor3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor3d]++;
+	glad_stats_real_glColor3d(arg0, arg1, arg2);
+}
+static PFNGLCOLOR3DVPROC glad_stats_real_glColor3dv = 0;
+static void APIENTRY glad_stats_impl_glColor3dv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor3dv]++;
+	glad_stats_real_glColor3dv(arg0);
+}
+static PFNGLCOLOR3FPROC glad_stats_real_glColor3f = 0;
+static void APIENTRY glad_stats_impl_glColor3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor3f]++;
+	glad_stats_real_glColor3f(arg0, arg1, arg2);
+}
+static PFNGLCOLOR3FVPROC glad_stats_real_glColor3fv = 0;
+static void APIENTRY glad_stats_impl_glColor3fv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor3fv]++;
+	glad_stats_real_glColor3fv(arg0);
+}
+static PFNGLCOLOR3IPROC glad_stats_real_glColor3i = 0;
+static void APIENTRY glad_stats_impl_glColor3i(GLint arg0, GLint arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor3i]++;
+	glad_stats_real_glColor3i(arg0, arg1, arg2);
+}
+static PFNGLCOLOR3IVPROC glad_stats_real_glColor3iv = 0;
+static void APIENTRY glad_stats_impl_glColor3iv(const GLint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor3iv]++;
+	glad_stats_real_glColor3iv(arg0);
+}
+static PFNGLCOLOR3SPROC glad_stats_real_glColor3s = 0;
+static void APIENTRY glad_stats_impl_glColor3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor3s]++;
+	glad_stats_real_glColor3s(arg0, arg1, arg2);
+}
+static PFNGLCOLOR3SVPROC glad_stats_real_glColor3sv = 0;
+static void APIENTRY glad_stats_impl_glColor3sv(const GLshort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor3sv]++;
+	glad_stats_real_glColor3sv(arg0);
+}
+static PFNGLCOLOR3UBPROC glad_stats_real_glColor3ub = 0;
+static void APIENTRY glad_stats_impl_glColor3ub(GLubyte arg0, GLubyte arg1, GLubyte arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor3ub]++;
+	glad_stats_real_glColor3ub(arg0, arg1, arg2);
+}
+static PFNGLCOLOR3UBVPROC glad_stats_real_glColor3ubv = 0;
+static void APIENTRY glad_stats_impl_glColor3ubv(const GLubyte * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor3ubv]++;
+	glad_stats_real_glColor3ubv(arg0);
+}
+static PFNGLCOLOR3UIPROC glad_stats_real_glColor3ui = 0;
+static void APIENTRY glad_stats_impl_glColor3ui(GLuint arg0, GLuint arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor3ui]++;
+	glad_stats_real_glColor3ui(arg0, arg1, arg2);
+}
+static PFNGLCOLOR3UIVPROC glad_stats_real_glColor3uiv = 0;
+static void APIENTRY glad_stats_impl_glColor3uiv(const GLuint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor3uiv]++;
+	glad_stats_real_glColor3uiv(arg0);
+}
+static PFNGLCOLOR3USPROC glad_stats_real_glColor3us = 0;
+static void APIENTRY glad_stats_impl_glColor3us(GLushort arg0, GLushort arg1, GLushort arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor3us]++;
+	glad_stats_real_glColor3us(arg0, arg1, arg2);
+}
+static PFNGLCOLOR3USVPROC glad_stats_real_glColor3usv = 0;
+static void APIENTRY glad_stats_impl_glColor3usv(const GLushort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor3usv]++;
+	glad_stats_real_glColor3usv(arg0);
+}
+static PFNGLCOLOR4BPROC glad_stats_real_glColor4b = 0;
+static void APIENTRY glad_stats_impl_glColor4b(GLbyte arg0, GLbyte arg1, GLbyte arg2, GLbyte arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor4b]++;
+	glad_stats_real_glColor4b(arg0, arg1, arg2, arg3);
+}
+static PFNGLCOLOR4BVPROC glad_stats_real_glColor4bv = 0;
+static void APIENTRY glad_stats_impl_glColor4bv(const GLbyte * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor4bv]++;
+	glad_stats_real_glColor4bv(arg0);
+}
+static PFNGLCOLOR4DPROC glad_stats_real_glColor4d = 0;
+static void APIENTRY glad_stats_impl_glColor4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor4d]++;
+	glad_stats_real_glColor4d(arg0, arg1, arg2, arg3);
+}
+static PFNGLCOLOR4DVPROC glad_stats_real_glColor4dv = 0;
+static void APIENTRY glad_stats_impl_glColor4dv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor4dv]++;
+	glad_stats_real_glColor4dv(arg0);
+}
+static PFNGLCOLOR4FPROC glad_stats_real_glColor4f = 0;
+static void APIENTRY glad_stats_impl_glColor4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor4f]++;
+	glad_stats_real_glColor4f(arg0, arg1, arg2, arg3);
+}
+static PFNGLCOLOR4FVPROC glad_stats_real_glColor4fv = 0;
+static void APIENTRY glad_stats_impl_glColor4fv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor4fv]++;
+	glad_stats_real_glColor4fv(arg0);
+}
+static PFNGLCOLOR4IPROC glad_stats_real_glColor4i = 0;
+static void APIENTRY glad_stats_impl_glColor4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor4i]++;
+	glad_stats_real_glColor4i(arg0, arg1, arg2, arg3);
+}
+static PFNGLCOLOR4IVPROC glad_stats_real_glColor4iv = 0;
+static void APIENTRY glad_stats_impl_glColor4iv(const GLint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor4iv]++;
+	glad_stats_real_glColor4iv(arg0);
+}
+static PFNGLCOLOR4SPROC glad_stats_real_glColor4s = 0;
+static void APIENTRY glad_stats_impl_glColor4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor4s]++;
+	glad_stats_real_glColor4s(arg0, arg1, arg2, arg3);
+}
+static PFNGLCOLOR4SVPROC glad_stats_real_glColor4sv = 0;
+static void APIENTRY glad_stats_impl_glColor4sv(const GLshort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor4sv]++;
+	glad_stats_real_glColor4sv(arg0);
+}
+static PFNGLCOLOR4UBPROC glad_stats_real_glColor4ub = 0;
+static void APIENTRY glad_stats_impl_glColor4ub(GLubyte arg0, GLubyte arg1, GLubyte arg2, GLubyte arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor4ub]++;
+	glad_stats_real_glColor4ub(arg0, arg1, arg2, arg3);
+}
+static PFNGLCOLOR4UBVPROC glad_stats_real_glColor4ubv = 0;
+static void APIENTRY glad_stats_impl_glColor4ubv(const GLubyte * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor4ubv]++;
+	glad_stats_real_glColor4ubv(arg0);
+}
+static PFNGLCOLOR4UIPROC glad_stats_real_glColor4ui = 0;
+static void APIENTRY glad_stats_impl_glColor4ui(GLuint arg0, GLuint arg1, GLuint arg2, GLuint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor4ui]++;
+	glad_stats_real_glColor4ui(arg0, arg1, arg2, arg3);
+}
+static PFNGLCOLOR4UIVPROC glad_stats_real_glColor4uiv = 0;
+static void APIENTRY glad_stats_impl_glColor4uiv(const GLuint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor4uiv]++;
+	glad_stats_real_glColor4uiv(arg0);
+}
+static PFNGLCOLOR4USPROC glad_stats_real_glColor4us = 0;
+static void APIENTRY glad_stats_impl_glColor4us(GLushort arg0, GLushort arg1, GLushort arg2, GLushort arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor4us]++;
+	glad_stats_real_glColor4us(arg0, arg1, arg2, arg3);
+}
+static PFNGLCOLOR4USVPROC glad_stats_real_glColor4usv = 0;
+static void APIENTRY glad_stats_impl_glColor4usv(const GLushort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColor4usv]++;
+	glad_stats_real_glColor4usv(arg0);
+}
+static PFNGLCOLORMASKPROC glad_stats_real_glColorMask = 0;
+static void APIENTRY glad_stats_impl_glColorMask(GLboolean arg0, GLboolean arg1, GLboolean arg2, GLboolean arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColorMask]++;
+	glad_stats_real_glColorMask(arg0, arg1, arg2, arg3);
+}
+static PFNGLCOLORMASKIPROC glad_stats_real_glColorMaski = 0;
+static void APIENTRY glad_stats_impl_glColorMaski(GLuint arg0, GLboolean arg1, GLboolean arg2, GLboolean arg3, GLboolean arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColorMaski]++;
+	glad_stats_real_glColorMaski(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLCOLORMATERIALPROC glad_stats_real_glColorMaterial = 0;
+static void APIENTRY glad_stats_impl_glColorMaterial(GLenum arg0, GLenum arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColorMaterial]++;
+	glad_stats_real_glColorMaterial(arg0, arg1);
+}
+static PFNGLCOLORP3UIPROC glad_stats_real_glColorP3ui = 0;
+static void APIENTRY glad_stats_impl_glColorP3ui(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColorP3ui]++;
+	glad_stats_real_glColorP3ui(arg0, arg1);
+}
+static PFNGLCOLORP3UIVPROC glad_stats_real_glColorP3uiv = 0;
+static void APIENTRY glad_stats_impl_glColorP3uiv(GLenum arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColorP3uiv]++;
+	glad_stats_real_glColorP3uiv(arg0, arg1);
+}
+static PFNGLCOLORP4UIPROC glad_stats_real_glColorP4ui = 0;
+static void APIENTRY glad_stats_impl_glColorP4ui(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColorP4ui]++;
+	glad_stats_real_glColorP4ui(arg0, arg1);
+}
+static PFNGLCOLORP4UIVPROC glad_stats_real_glColorP4uiv = 0;
+static void APIENTRY glad_stats_impl_glColorP4uiv(GLenum arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColorP4uiv]++;
+	glad_stats_real_glColorP4uiv(arg0, arg1);
+}
+static PFNGLCOLORPOINTERPROC glad_stats_real_glColorPointer = 0;
+static void APIENTRY glad_stats_impl_glColorPointer(GLint arg0, GLenum arg1, GLsizei arg2, const void * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glColorPointer]++;
+	glad_stats_real_glColorPointer(arg0, arg1, arg2, arg3);
+}
+static PFNGLCOMPILESHADERPROC glad_stats_real_glCompileShader = 0;
+static void APIENTRY glad_stats_impl_glCompileShader(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCompileShader]++;
+	glad_stats_real_glCompileShader(arg0);
+}
+static PFNGLCOMPRESSEDTEXIMAGE1DPROC glad_stats_real_glCompressedTexImage1D = 0;
+static void APIENTRY glad_stats_impl_glCompressedTexImage1D(GLenum arg0, GLint arg1, GLenum arg2, GLsizei arg3, GLint arg4, GLsizei arg5, const void * arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCompressedTexImage1D]++;
+	c->uploadBytes += (unsigned long long)arg5;
+	glad_stats_real_glCompressedTexImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLCOMPRESSEDTEXIMAGE2DPROC glad_stats_real_glCompressedTexImage2D = 0;
+static void APIENTRY glad_stats_impl_glCompressedTexImage2D(GLenum arg0, GLint arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLint arg5, GLsizei arg6, const void * arg7) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCompressedTexImage2D]++;
+	c->uploadBytes += (unsigned long long)arg6;
+	glad_stats_real_glCompressedTexImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static PFNGLCOMPRESSEDTEXIMAGE3DPROC glad_stats_real_glCompressedTexImage3D = 0;
+static void APIENTRY glad_stats_impl_glCompressedTexImage3D(GLenum arg0, GLint arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLint arg6, GLsizei arg7, const void * arg8) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCompressedTexImage3D]++;
+	c->uploadBytes += (unsigned long long)arg7;
+	glad_stats_real_glCompressedTexImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC glad_stats_real_glCompressedTexSubImage1D = 0;
+static void APIENTRY glad_stats_impl_glCompressedTexSubImage1D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLsizei arg5, const void * arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCompressedTexSubImage1D]++;
+	c->uploadBytes += (unsigned long long)arg5;
+	glad_stats_real_glCompressedTexSubImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC glad_stats_real_glCompressedTexSubImage2D = 0;
+static void APIENTRY glad_stats_impl_glCompressedTexSubImage2D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLsizei arg7, const void * arg8) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCompressedTexSubImage2D]++;
+	c->uploadBytes += (unsigned long long)arg7;
+	glad_stats_real_glCompressedTexSubImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC glad_stats_real_glCompressedTexSubImage3D = 0;
+static void APIENTRY glad_stats_impl_glCompressedTexSubImage3D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLsizei arg9, const void * arg10) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCompressedTexSubImage3D]++;
+	c->uploadBytes += (unsigned long long)arg9;
+	glad_stats_real_glCompressedTexSubImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC glad_stats_real_glCompressedTextureSubImage1D = 0;
+static void APIENTRY glad_stats_impl_glCompressedTextureSubImage1D(GLuint arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLsizei arg5, const void * arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCompressedTextureSubImage1D]++;
+	c->uploadBytes += (unsigned long long)arg5;
+	glad_stats_real_glCompressedTextureSubImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC glad_stats_real_glCompressedTextureSubImage2D = 0;
+static void APIENTRY glad_stats_impl_glCompressedTextureSubImage2D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLsizei arg7, const void * arg8) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCompressedTextureSubImage2D]++;
+	c->uploadBytes += (unsigned long long)arg7;
+	glad_stats_real_glCompressedTextureSubImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC glad_stats_real_glCompressedTextureSubImage3D = 0;
+static void APIENTRY glad_stats_impl_glCompressedTextureSubImage3D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLsizei arg9, const void * arg10) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCompressedTextureSubImage3D]++;
+	c->uploadBytes += (unsigned long long)arg9;
+	glad_stats_real_glCompressedTextureSubImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+static PFNGLCOPYBUFFERSUBDATAPROC glad_stats_real_glCopyBufferSubData = 0;
+static void APIENTRY glad_stats_impl_glCopyBufferSubData(GLenum arg0, GLenum arg1, GLintptr arg2, GLintptr arg3, GLsizeiptr arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCopyBufferSubData]++;
+	glad_stats_real_glCopyBufferSubData(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLCOPYIMAGESUBDATAPROC glad_stats_real_glCopyImageSubData = 0;
+static void APIENTRY glad_stats_impl_glCopyImageSubData(GLuint arg0, GLenum arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLuint arg6, GLenum arg7, GLint arg8, GLint arg9, GLint arg10, GLint arg11, GLsizei arg12, GLsizei arg13, GLsizei arg14) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCopyImageSubData]++;
+	glad_stats_real_glCopyImageSubData(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13, arg14);
+}
+static PFNGLCOPYNAMEDBUFFERSUBDATAPROC glad_stats_real_glCopyNamedBufferSubData = 0;
+static void APIENTRY glad_stats_impl_glCopyNamedBufferSubData(GLuint arg0, GLuint arg1, GLintptr arg2, GLintptr arg3, GLsizeiptr arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCopyNamedBufferSubData]++;
+	glad_stats_real_glCopyNamedBufferSubData(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLCOPYPIXELSPROC glad_stats_real_glCopyPixels = 0;
+static void APIENTRY glad_stats_impl_glCopyPixels(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLenum arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCopyPixels]++;
+	glad_stats_real_glCopyPixels(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLCOPYTEXIMAGE1DPROC glad_stats_real_glCopyTexImage1D = 0;
+static void APIENTRY glad_stats_impl_glCopyTexImage1D(GLenum arg0, GLint arg1, GLenum arg2, GLint arg3, GLint arg4, GLsizei arg5, GLint arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCopyTexImage1D]++;
+	glad_stats_real_glCopyTexImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLCOPYTEXIMAGE2DPROC glad_stats_real_glCopyTexImage2D = 0;
+static void APIENTRY glad_stats_impl_glCopyTexImage2D(GLenum arg0, GLint arg1, GLenum arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLint arg7) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCopyTexImage2D]++;
+	glad_stats_real_glCopyTexImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static PFNGLCOPYTEXSUBIMAGE1DPROC glad_stats_real_glCopyTexSubImage1D = 0;
+static void APIENTRY glad_stats_impl_glCopyTexSubImage1D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCopyTexSubImage1D]++;
+	glad_stats_real_glCopyTexSubImage1D(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLCOPYTEXSUBIMAGE2DPROC glad_stats_real_glCopyTexSubImage2D = 0;
+static void APIENTRY glad_stats_impl_glCopyTexSubImage2D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLsizei arg6, GLsizei arg7) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCopyTexSubImage2D]++;
+	glad_stats_real_glCopyTexSubImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static PFNGLCOPYTEXSUBIMAGE3DPROC glad_stats_real_glCopyTexSubImage3D = 0;
+static void APIENTRY glad_stats_impl_glCopyTexSubImage3D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLsizei arg7, GLsizei arg8) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCopyTexSubImage3D]++;
+	glad_stats_real_glCopyTexSubImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static PFNGLCOPYTEXTURESUBIMAGE1DPROC glad_stats_real_glCopyTextureSubImage1D = 0;
+static void APIENTRY glad_stats_impl_glCopyTextureSubImage1D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCopyTextureSubImage1D]++;
+	glad_stats_real_glCopyTextureSubImage1D(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLCOPYTEXTURESUBIMAGE2DPROC glad_stats_real_glCopyTextureSubImage2D = 0;
+static void APIENTRY glad_stats_impl_glCopyTextureSubImage2D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLsizei arg6, GLsizei arg7) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCopyTextureSubImage2D]++;
+	glad_stats_real_glCopyTextureSubImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static PFNGLCOPYTEXTURESUBIMAGE3DPROC glad_stats_real_glCopyTextureSubImage3D = 0;
+static void APIENTRY glad_stats_impl_glCopyTextureSubImage3D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5, GLint arg6, GLsizei arg7, GLsizei arg8) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCopyTextureSubImage3D]++;
+	glad_stats_real_glCopyTextureSubImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static PFNGLCREATEBUFFERSPROC glad_stats_real_glCreateBuffers = 0;
+static void APIENTRY glad_stats_impl_glCreateBuffers(GLsizei arg0, GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCreateBuffers]++;
+	glad_stats_real_glCreateBuffers(arg0, arg1);
+}
+static PFNGLCREATEFRAMEBUFFERSPROC glad_stats_real_glCreateFramebuffers = 0;
+static void APIENTRY glad_stats_impl_glCreateFramebuffers(GLsizei arg0, GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCreateFramebuffers]++;
+	glad_stats_real_glCreateFramebuffers(arg0, arg1);
+}
+static PFNGLCREATEPROGRAMPROC glad_stats_real_glCreateProgram = 0;
+static GLuint APIENTRY glad_stats_impl_glCreateProgram(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCreateProgram]++;
+	return glad_stats_real_glCreateProgram();
+}
+static PFNGLCREATEPROGRAMPIPELINESPROC glad_stats_real_glCreateProgramPipelines = 0;
+static void APIENTRY glad_stats_impl_glCreateProgramPipelines(GLsizei arg0, GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCreateProgramPipelines]++;
+	glad_stats_real_glCreateProgramPipelines(arg0, arg1);
+}
+static PFNGLCREATEQUERIESPROC glad_stats_real_glCreateQueries = 0;
+static void APIENTRY glad_stats_impl_glCreateQueries(GLenum arg0, GLsizei arg1, GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCreateQueries]++;
+	glad_stats_real_glCreateQueries(arg0, arg1, arg2);
+}
+static PFNGLCREATERENDERBUFFERSPROC glad_stats_real_glCreateRenderbuffers = 0;
+static void APIENTRY glad_stats_impl_glCreateRenderbuffers(GLsizei arg0, GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCreateRenderbuffers]++;
+	glad_stats_real_glCreateRenderbuffers(arg0, arg1);
+}
+static PFNGLCREATESAMPLERSPROC glad_stats_real_glCreateSamplers = 0;
+static void APIENTRY glad_stats_impl_glCreateSamplers(GLsizei arg0, GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCreateSamplers]++;
+	glad_stats_real_glCreateSamplers(arg0, arg1);
+}
+static PFNGLCREATESHADERPROC glad_stats_real_glCreateShader = 0;
+static GLuint APIENTRY glad_stats_impl_glCreateShader(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCreateShader]++;
+	return glad_stats_real_glCreateShader(arg0);
+}
+static PFNGLCREATESHADERPROGRAMVPROC glad_stats_real_glCreateShaderProgramv = 0;
+static GLuint APIENTRY glad_stats_impl_glCreateShaderProgramv(GLenum arg0, GLsizei arg1, const GLchar *const * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCreateShaderProgramv]++;
+	return glad_stats_real_glCreateShaderProgramv(arg0, arg1, arg2);
+}
+static PFNGLCREATETEXTURESPROC glad_stats_real_glCreateTextures = 0;
+static void APIENTRY glad_stats_impl_glCreateTextures(GLenum arg0, GLsizei arg1, GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCreateTextures]++;
+	glad_stats_real_glCreateTextures(arg0, arg1, arg2);
+}
+static PFNGLCREATETRANSFORMFEEDBACKSPROC glad_stats_real_glCreateTransformFeedbacks = 0;
+static void APIENTRY glad_stats_impl_glCreateTransformFeedbacks(GLsizei arg0, GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCreateTransformFeedbacks]++;
+	glad_stats_real_glCreateTransformFeedbacks(arg0, arg1);
+}
+static PFNGLCREATEVERTEXARRAYSPROC glad_stats_real_glCreateVertexArrays = 0;
+static void APIENTRY glad_stats_impl_glCreateVertexArrays(GLsizei arg0, GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCreateVertexArrays]++;
+	glad_stats_real_glCreateVertexArrays(arg0, arg1);
+}
+static PFNGLCULLFACEPROC glad_stats_real_glCullFace = 0;
+static void APIENTRY glad_stats_impl_glCullFace(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glCullFace]++;
+	glad_stats_real_glCullFace(arg0);
+}
+static PFNGLDEBUGMESSAGECALLBACKPROC glad_stats_real_glDebugMessageCallback = 0;
+static void APIENTRY glad_stats_impl_glDebugMessageCallback(GLDEBUGPROC arg0, const void * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDebugMessageCallback]++;
+	glad_stats_real_glDebugMessageCallback(arg0, arg1);
+}
+static PFNGLDEBUGMESSAGECONTROLPROC glad_stats_real_glDebugMessageControl = 0;
+static void APIENTRY glad_stats_impl_glDebugMessageControl(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, const GLuint * arg4, GLboolean arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDebugMessageControl]++;
+	glad_stats_real_glDebugMessageControl(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLDEBUGMESSAGEINSERTPROC glad_stats_real_glDebugMessageInsert = 0;
+static void APIENTRY glad_stats_impl_glDebugMessageInsert(GLenum arg0, GLenum arg1, GLuint arg2, GLenum arg3, GLsizei arg4, const GLchar * arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDebugMessageInsert]++;
+	glad_stats_real_glDebugMessageInsert(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLDELETEBUFFERSPROC glad_stats_real_glDeleteBuffers = 0;
+static void APIENTRY glad_stats_impl_glDeleteBuffers(GLsizei arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDeleteBuffers]++;
+	glad_stats_real_glDeleteBuffers(arg0, arg1);
+}
+static PFNGLDELETEFRAMEBUFFERSPROC glad_stats_real_glDeleteFramebuffers = 0;
+static void APIENTRY glad_stats_impl_glDeleteFramebuffers(GLsizei arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDeleteFramebuffers]++;
+	glad_stats_real_glDeleteFramebuffers(arg0, arg1);
+}
+static PFNGLDELETELISTSPROC glad_stats_real_glDeleteLists = 0;
+static void APIENTRY glad_stats_impl_glDeleteLists(GLuint arg0, GLsizei arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDeleteLists]++;
+	glad_stats_real_glDeleteLists(arg0, arg1);
+}
+static PFNGLDELETEPROGRAMPROC glad_stats_real_glDeleteProgram = 0;
+static void APIENTRY glad_stats_impl_glDeleteProgram(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDeleteProgram]++;
+	glad_stats_real_glDeleteProgram(arg0);
+}
+static PFNGLDELETEPROGRAMPIPELINESPROC glad_stats_real_glDeleteProgramPipelines = 0;
+static void APIENTRY glad_stats_impl_glDeleteProgramPipelines(GLsizei arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDeleteProgramPipelines]++;
+	glad_stats_real_glDeleteProgramPipelines(arg0, arg1);
+}
+static PFNGLDELETEQUERIESPROC glad_stats_real_glDeleteQueries = 0;
+static void APIENTRY glad_stats_impl_glDeleteQueries(GLsizei arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDeleteQueries]++;
+	glad_stats_real_glDeleteQueries(arg0, arg1);
+}
+static PFNGLDELETERENDERBUFFERSPROC glad_stats_real_glDeleteRenderbuffers = 0;
+static void APIENTRY glad_stats_impl_glDeleteRenderbuffers(GLsizei arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDeleteRenderbuffers]++;
+	glad_stats_real_glDeleteRenderbuffers(arg0, arg1);
+}
+static PFNGLDELETESAMPLERSPROC glad_stats_real_glDeleteSamplers = 0;
+static void APIENTRY glad_stats_impl_glDeleteSamplers(GLsizei arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDeleteSamplers]++;
+	glad_stats_real_glDeleteSamplers(arg0, arg1);
+}
+static PFNGLDELETESHADERPROC glad_stats_real_glDeleteShader = 0;
+static void APIENTRY glad_stats_impl_glDeleteShader(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDeleteShader]++;
+	glad_stats_real_glDeleteShader(arg0);
+}
+static PFNGLDELETESYNCPROC glad_stats_real_glDeleteSync = 0;
+static void APIENTRY glad_stats_impl_glDeleteSync(GLsync arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDeleteSync]++;
+	glad_stats_real_glDeleteSync(arg0);
+}
+static PFNGLDELETETEXTURESPROC glad_stats_real_glDeleteTextures = 0;
+static void APIENTRY glad_stats_impl_glDeleteTextures(GLsizei arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDeleteTextures]++;
+	glad_stats_real_glDeleteTextures(arg0, arg1);
+}
+static PFNGLDELETETRANSFORMFEEDBACKSPROC glad_stats_real_glDeleteTransformFeedbacks = 0;
+static void APIENTRY glad_stats_impl_glDeleteTransformFeedbacks(GLsizei arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDeleteTransformFeedbacks]++;
+	glad_stats_real_glDeleteTransformFeedbacks(arg0, arg1);
+}
+static PFNGLDELETEVERTEXARRAYSPROC glad_stats_real_glDeleteVertexArrays = 0;
+static void APIENTRY glad_stats_impl_glDeleteVertexArrays(GLsizei arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDeleteVertexArrays]++;
+	glad_stats_real_glDeleteVertexArrays(arg0, arg1);
+}
+static PFNGLDEPTHFUNCPROC glad_stats_real_glDepthFunc = 0;
+static void APIENTRY glad_stats_impl_glDepthFunc(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDepthFunc]++;
+	glad_stats_real_glDepthFunc(arg0);
+}
+static PFNGLDEPTHMASKPROC glad_stats_real_glDepthMask = 0;
+static void APIENTRY glad_stats_impl_glDepthMask(GLboolean arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDepthMask]++;
+	glad_stats_real_glDepthMask(arg0);
+}
+static PFNGLDEPTHRANGEPROC glad_stats_real_glDepthRange = 0;
+static void APIENTRY glad_stats_impl_glDepthRange(GLclampd arg0, GLclampd arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDepthRange]++;
+	glad_stats_real_glDepthRange(arg0, arg1);
+}
+static PFNGLDEPTHRANGEARRAYVPROC glad_stats_real_glDepthRangeArrayv = 0;
+static void APIENTRY glad_stats_impl_glDepthRangeArrayv(GLuint arg0, GLsizei arg1, const GLdouble * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDepthRangeArrayv]++;
+	glad_stats_real_glDepthRangeArrayv(arg0, arg1, arg2);
+}
+static PFNGLDEPTHRANGEINDEXEDPROC glad_stats_real_glDepthRangeIndexed = 0;
+static void APIENTRY glad_stats_impl_glDepthRangeIndexed(GLuint arg0, GLdouble arg1, GLdouble arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDepthRangeIndexed]++;
+	glad_stats_real_glDepthRangeIndexed(arg0, arg1, arg2);
+}
+static PFNGLDEPTHRANGEFPROC glad_stats_real_glDepthRangef = 0;
+static void APIENTRY glad_stats_impl_glDepthRangef(GLfloat arg0, GLfloat arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDepthRangef]++;
+	glad_stats_real_glDepthRangef(arg0, arg1);
+}
+static PFNGLDETACHSHADERPROC glad_stats_real_glDetachShader = 0;
+static void APIENTRY glad_stats_impl_glDetachShader(GLuint arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDetachShader]++;
+	glad_stats_real_glDetachShader(arg0, arg1);
+}
+static PFNGLDISABLEPROC glad_stats_real_glDisable = 0;
+static void APIENTRY glad_stats_impl_glDisable(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDisable]++;
+	glad_stats_real_glDisable(arg0);
+}
+static PFNGLDISABLECLIENTSTATEPROC glad_stats_real_glDisableClientState = 0;
+static void APIENTRY glad_stats_impl_glDisableClientState(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDisableClientState]++;
+	glad_stats_real_glDisableClientState(arg0);
+}
+static PFNGLDISABLEVERTEXARRAYATTRIBPROC glad_stats_real_glDisableVertexArrayAttrib = 0;
+static void APIENTRY glad_stats_impl_glDisableVertexArrayAttrib(GLuint arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDisableVertexArrayAttrib]++;
+	glad_stats_real_glDisableVertexArrayAttrib(arg0, arg1);
+}
+static PFNGLDISABLEVERTEXATTRIBARRAYPROC glad_stats_real_glDisableVertexAttribArray = 0;
+static void APIENTRY glad_stats_impl_glDisableVertexAttribArray(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDisableVertexAttribArray]++;
+	glad_stats_real_glDisableVertexAttribArray(arg0);
+}
+static PFNGLDISABLEIPROC glad_stats_real_glDisablei = 0;
+static void APIENTRY glad_stats_impl_glDisablei(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDisablei]++;
+	glad_stats_real_glDisablei(arg0, arg1);
+}
+static PFNGLDISPATCHCOMPUTEPROC glad_stats_real_glDispatchCompute = 0;
+static void APIENTRY glad_stats_impl_glDispatchCompute(GLuint arg0, GLuint arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDispatchCompute]++;
+	glad_stats_real_glDispatchCompute(arg0, arg1, arg2);
+}
+static PFNGLDISPATCHCOMPUTEINDIRECTPROC glad_stats_real_glDispatchComputeIndirect = 0;
+static void APIENTRY glad_stats_impl_glDispatchComputeIndirect(GLintptr arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDispatchComputeIndirect]++;
+	glad_stats_real_glDispatchComputeIndirect(arg0);
+}
+static PFNGLDRAWARRAYSPROC glad_stats_real_glDrawArrays = 0;
+static void APIENTRY glad_stats_impl_glDrawArrays(GLenum arg0, GLint arg1, GLsizei arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawArrays]++;
+	c->draws++;
+	c->vertices += (unsigned long long)arg2;
+	glad_stats_real_glDrawArrays(arg0, arg1, arg2);
+}
+static PFNGLDRAWARRAYSINDIRECTPROC glad_stats_real_glDrawArraysIndirect = 0;
+static void APIENTRY glad_stats_impl_glDrawArraysIndirect(GLenum arg0, const void * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawArraysIndirect]++;
+	c->draws++;
+	glad_stats_real_glDrawArraysIndirect(arg0, arg1);
+}
+static PFNGLDRAWARRAYSINSTANCEDPROC glad_stats_real_glDrawArraysInstanced = 0;
+static void APIENTRY glad_stats_impl_glDrawArraysInstanced(GLenum arg0, GLint arg1, GLsizei arg2, GLsizei arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawArraysInstanced]++;
+	c->draws++;
+	c->vertices += (unsigned long long)arg2 * (unsigned long long)arg3;
+	glad_stats_real_glDrawArraysInstanced(arg0, arg1, arg2, arg3);
+}
+static PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC glad_stats_real_glDrawArraysInstancedBaseInstance = 0;
+static void APIENTRY glad_stats_impl_glDrawArraysInstancedBaseInstance(GLenum arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLuint arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawArraysInstancedBaseInstance]++;
+	c->draws++;
+	c->vertices += (unsigned long long)arg2 * (unsigned long long)arg3;
+	glad_stats_real_glDrawArraysInstancedBaseInstance(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLDRAWBUFFERPROC glad_stats_real_glDrawBuffer = 0;
+static void APIENTRY glad_stats_impl_glDrawBuffer(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawBuffer]++;
+	glad_stats_real_glDrawBuffer(arg0);
+}
+static PFNGLDRAWBUFFERSPROC glad_stats_real_glDrawBuffers = 0;
+static void APIENTRY glad_stats_impl_glDrawBuffers(GLsizei arg0, const GLenum * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawBuffers]++;
+	glad_stats_real_glDrawBuffers(arg0, arg1);
+}
+static PFNGLDRAWELEMENTSPROC glad_stats_real_glDrawElements = 0;
+static void APIENTRY glad_stats_impl_glDrawElements(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawElements]++;
+	c->draws++;
+	c->vertices += (unsigned long long)arg1;
+	glad_stats_real_glDrawElements(arg0, arg1, arg2, arg3);
+}
+static PFNGLDRAWELEMENTSBASEVERTEXPROC glad_stats_real_glDrawElementsBaseVertex = 0;
+static void APIENTRY glad_stats_impl_glDrawElementsBaseVertex(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLint arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawElementsBaseVertex]++;
+	c->draws++;
+	c->vertices += (unsigned long long)arg1;
+	glad_stats_real_glDrawElementsBaseVertex(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLDRAWELEMENTSINDIRECTPROC glad_stats_real_glDrawElementsIndirect = 0;
+static void APIENTRY glad_stats_impl_glDrawElementsIndirect(GLenum arg0, GLenum arg1, const void * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawElementsIndirect]++;
+	c->draws++;
+	glad_stats_real_glDrawElementsIndirect(arg0, arg1, arg2);
+}
+static PFNGLDRAWELEMENTSINSTANCEDPROC glad_stats_real_glDrawElementsInstanced = 0;
+static void APIENTRY glad_stats_impl_glDrawElementsInstanced(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawElementsInstanced]++;
+	c->draws++;
+	c->vertices += (unsigned long long)arg1 * (unsigned long long)arg4;
+	glad_stats_real_glDrawElementsInstanced(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC glad_stats_real_glDrawElementsInstancedBaseInstance = 0;
+static void APIENTRY glad_stats_impl_glDrawElementsInstancedBaseInstance(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4, GLuint arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawElementsInstancedBaseInstance]++;
+	c->draws++;
+	c->vertices += (unsigned long long)arg1 * (unsigned long long)arg4;
+	glad_stats_real_glDrawElementsInstancedBaseInstance(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC glad_stats_real_glDrawElementsInstancedBaseVertex = 0;
+static void APIENTRY glad_stats_impl_glDrawElementsInstancedBaseVertex(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4, GLint arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawElementsInstancedBaseVertex]++;
+	c->draws++;
+	c->vertices += (unsigned long long)arg1 * (unsigned long long)arg4;
+	glad_stats_real_glDrawElementsInstancedBaseVertex(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC glad_stats_real_glDrawElementsInstancedBaseVertexBaseInstance = 0;
+static void APIENTRY glad_stats_impl_glDrawElementsInstancedBaseVertexBaseInstance(GLenum arg0, GLsizei arg1, GLenum arg2, const void * arg3, GLsizei arg4, GLint arg5, GLuint arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawElementsInstancedBaseVertexBaseInstance]++;
+	c->draws++;
+	c->vertices += (unsigned long long)arg1 * (unsigned long long)arg4;
+	glad_stats_real_glDrawElementsInstancedBaseVertexBaseInstance(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLDRAWPIXELSPROC glad_stats_real_glDrawPixels = 0;
+static void APIENTRY glad_stats_impl_glDrawPixels(GLsizei arg0, GLsizei arg1, GLenum arg2, GLenum arg3, const void * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawPixels]++;
+	glad_stats_real_glDrawPixels(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLDRAWRANGEELEMENTSPROC glad_stats_real_glDrawRangeElements = 0;
+static void APIENTRY glad_stats_impl_glDrawRangeElements(GLenum arg0, GLuint arg1, GLuint arg2, GLsizei arg3, GLenum arg4, const void * arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawRangeElements]++;
+	c->draws++;
+	c->vertices += (unsigned long long)arg3;
+	glad_stats_real_glDrawRangeElements(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC glad_stats_real_glDrawRangeElementsBaseVertex = 0;
+static void APIENTRY glad_stats_impl_glDrawRangeElementsBaseVertex(GLenum arg0, GLuint arg1, GLuint arg2, GLsizei arg3, GLenum arg4, const void * arg5, GLint arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawRangeElementsBaseVertex]++;
+	c->draws++;
+	c->vertices += (unsigned long long)arg3;
+	glad_stats_real_glDrawRangeElementsBaseVertex(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLDRAWTRANSFORMFEEDBACKPROC glad_stats_real_glDrawTransformFeedback = 0;
+static void APIENTRY glad_stats_impl_glDrawTransformFeedback(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawTransformFeedback]++;
+	c->draws++;
+	glad_stats_real_glDrawTransformFeedback(arg0, arg1);
+}
+static PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC glad_stats_real_glDrawTransformFeedbackInstanced = 0;
+static void APIENTRY glad_stats_impl_glDrawTransformFeedbackInstanced(GLenum arg0, GLuint arg1, GLsizei arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawTransformFeedbackInstanced]++;
+	c->draws++;
+	glad_stats_real_glDrawTransformFeedbackInstanced(arg0, arg1, arg2);
+}
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC glad_stats_real_glDrawTransformFeedbackStream = 0;
+static void APIENTRY glad_stats_impl_glDrawTransformFeedbackStream(GLenum arg0, GLuint arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawTransformFeedbackStream]++;
+	c->draws++;
+	glad_stats_real_glDrawTransformFeedbackStream(arg0, arg1, arg2);
+}
+static PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC glad_stats_real_glDrawTransformFeedbackStreamInstanced = 0;
+static void APIENTRY glad_stats_impl_glDrawTransformFeedbackStreamInstanced(GLenum arg0, GLuint arg1, GLuint arg2, GLsizei arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glDrawTransformFeedbackStreamInstanced]++;
+	c->draws++;
+	glad_stats_real_glDrawTransformFeedbackStreamInstanced(arg0, arg1, arg2, arg3);
+}
+static PFNGLEDGEFLAGPROC glad_stats_real_glEdgeFlag = 0;
+static void APIENTRY glad_stats_impl_glEdgeFlag(GLboolean arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEdgeFlag]++;
+	glad_stats_real_glEdgeFlag(arg0);
+}
+static PFNGLEDGEFLAGPOINTERPROC glad_stats_real_glEdgeFlagPointer = 0;
+static void APIENTRY glad_stats_impl_glEdgeFlagPointer(GLsizei arg0, const void * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEdgeFlagPointer]++;
+	glad_stats_real_glEdgeFlagPointer(arg0, arg1);
+}
+static PFNGLEDGEFLAGVPROC glad_stats_real_glEdgeFlagv = 0;
+static void APIENTRY glad_stats_impl_glEdgeFlagv(const GLboolean * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEdgeFlagv]++;
+	glad_stats_real_glEdgeFlagv(arg0);
+}
+static PFNGLENABLEPROC glad_stats_real_glEnable = 0;
+static void APIENTRY glad_stats_impl_glEnable(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEnable]++;
+	glad_stats_real_glEnable(arg0);
+}
+static PFNGLENABLECLIENTSTATEPROC glad_stats_real_glEnableClientState = 0;
+static void APIENTRY glad_stats_impl_glEnableClientState(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEnableClientState]++;
+	glad_stats_real_glEnableClientState(arg0);
+}
+static PFNGLENABLEVERTEXARRAYATTRIBPROC glad_stats_real_glEnableVertexArrayAttrib = 0;
+static void APIENTRY glad_stats_impl_glEnableVertexArrayAttrib(GLuint arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEnableVertexArrayAttrib]++;
+	glad_stats_real_glEnableVertexArrayAttrib(arg0, arg1);
+}
+static PFNGLENABLEVERTEXATTRIBARRAYPROC glad_stats_real_glEnableVertexAttribArray = 0;
+static void APIENTRY glad_stats_impl_glEnableVertexAttribArray(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEnableVertexAttribArray]++;
+	glad_stats_real_glEnableVertexAttribArray(arg0);
+}
+static PFNGLENABLEIPROC glad_stats_real_glEnablei = 0;
+static void APIENTRY glad_stats_impl_glEnablei(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEnablei]++;
+	glad_stats_real_glEnablei(arg0, arg1);
+}
+static PFNGLENDPROC glad_stats_real_glEnd = 0;
+static void APIENTRY glad_stats_impl_glEnd(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEnd]++;
+	glad_stats_real_glEnd();
+}
+static PFNGLENDCONDITIONALRENDERPROC glad_stats_real_glEndConditionalRender = 0;
+static void APIENTRY glad_stats_impl_glEndConditionalRender(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEndConditionalRender]++;
+	glad_stats_real_glEndConditionalRender();
+}
+static PFNGLENDLISTPROC glad_stats_real_glEndList = 0;
+static void APIENTRY glad_stats_impl_glEndList(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEndList]++;
+	glad_stats_real_glEndList();
+}
+static PFNGLENDQUERYPROC glad_stats_real_glEndQuery = 0;
+static void APIENTRY glad_stats_impl_glEndQuery(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEndQuery]++;
+	glad_stats_real_glEndQuery(arg0);
+}
+static PFNGLENDQUERYINDEXEDPROC glad_stats_real_glEndQueryIndexed = 0;
+static void APIENTRY glad_stats_impl_glEndQueryIndexed(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEndQueryIndexed]++;
+	glad_stats_real_glEndQueryIndexed(arg0, arg1);
+}
+static PFNGLENDTRANSFORMFEEDBACKPROC glad_stats_real_glEndTransformFeedback = 0;
+static void APIENTRY glad_stats_impl_glEndTransformFeedback(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEndTransformFeedback]++;
+	glad_stats_real_glEndTransformFeedback();
+}
+static PFNGLEVALCOORD1DPROC glad_stats_real_glEvalCoord1d = 0;
+static void APIENTRY glad_stats_impl_glEvalCoord1d(GLdouble arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEvalCoord1d]++;
+	glad_stats_real_glEvalCoord1d(arg0);
+}
+static PFNGLEVALCOORD1DVPROC glad_stats_real_glEvalCoord1dv = 0;
+static void APIENTRY glad_stats_impl_glEvalCoord1dv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEvalCoord1dv]++;
+	glad_stats_real_glEvalCoord1dv(arg0);
+}
+static PFNGLEVALCOORD1FPROC glad_stats_real_glEvalCoord1f = 0;
+static void APIENTRY glad_stats_impl_glEvalCoord1f(GLfloat arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEvalCoord1f]++;
+	glad_stats_real_glEvalCoord1f(arg0);
+}
+static PFNGLEVALCOORD1FVPROC glad_stats_real_glEvalCoord1fv = 0;
+static void APIENTRY glad_stats_impl_glEvalCoord1fv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEvalCoord1fv]++;
+	glad_stats_real_glEvalCoord1fv(arg0);
+}
+static PFNGLEVALCOORD2DPROC glad_stats_real_glEvalCoord2d = 0;
+static void APIENTRY glad_stats_impl_glEvalCoord2d(GLdouble arg0, GLdouble arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEvalCoord2d]++;
+	glad_stats_real_glEvalCoord2d(arg0, arg1);
+}
+static PFNGLEVALCOORD2DVPROC glad_stats_real_glEvalCoord2dv = 0;
+static void APIENTRY glad_stats_impl_glEvalCoord2dv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEvalCoord2dv]++;
+	glad_stats_real_glEvalCoord2dv(arg0);
+}
+static PFNGLEVALCOORD2FPROC glad_stats_real_glEvalCoord2f = 0;
+static void APIENTRY glad_stats_impl_glEvalCoord2f(GLfloat arg0, GLfloat arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEvalCoord2f]++;
+	glad_stats_real_glEvalCoord2f(arg0, arg1);
+}
+static PFNGLEVALCOORD2FVPROC glad_stats_real_glEvalCoord2fv = 0;
+static void APIENTRY glad_stats_impl_glEvalCoord2fv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEvalCoord2fv]++;
+	glad_stats_real_glEvalCoord2fv(arg0);
+}
+static PFNGLEVALMESH1PROC glad_stats_real_glEvalMesh1 = 0;
+static void APIENTRY glad_stats_impl_glEvalMesh1(GLenum arg0, GLint arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEvalMesh1]++;
+	glad_stats_real_glEvalMesh1(arg0, arg1, arg2);
+}
+static PFNGLEVALMESH2PROC glad_stats_real_glEvalMesh2 = 0;
+static void APIENTRY glad_stats_impl_glEvalMesh2(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEvalMesh2]++;
+	glad_stats_real_glEvalMesh2(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLEVALPOINT1PROC glad_stats_real_glEvalPoint1 = 0;
+static void APIENTRY glad_stats_impl_glEvalPoint1(GLint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEvalPoint1]++;
+	glad_stats_real_glEvalPoint1(arg0);
+}
+static PFNGLEVALPOINT2PROC glad_stats_real_glEvalPoint2 = 0;
+static void APIENTRY glad_stats_impl_glEvalPoint2(GLint arg0, GLint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glEvalPoint2]++;
+	glad_stats_real_glEvalPoint2(arg0, arg1);
+}
+static PFNGLFEEDBACKBUFFERPROC glad_stats_real_glFeedbackBuffer = 0;
+static void APIENTRY glad_stats_impl_glFeedbackBuffer(GLsizei arg0, GLenum arg1, GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFeedbackBuffer]++;
+	glad_stats_real_glFeedbackBuffer(arg0, arg1, arg2);
+}
+static PFNGLFENCESYNCPROC glad_stats_real_glFenceSync = 0;
+static GLsync APIENTRY glad_stats_impl_glFenceSync(GLenum arg0, GLbitfield arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFenceSync]++;
+	return glad_stats_real_glFenceSync(arg0, arg1);
+}
+static PFNGLFINISHPROC glad_stats_real_glFinish = 0;
+static void APIENTRY glad_stats_impl_glFinish(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFinish]++;
+	glad_stats_real_glFinish();
+}
+static PFNGLFLUSHPROC glad_stats_real_glFlush = 0;
+static void APIENTRY glad_stats_impl_glFlush(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFlush]++;
+	glad_stats_real_glFlush();
+}
+static PFNGLFLUSHMAPPEDBUFFERRANGEPROC glad_stats_real_glFlushMappedBufferRange = 0;
+static void APIENTRY glad_stats_impl_glFlushMappedBufferRange(GLenum arg0, GLintptr arg1, GLsizeiptr arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFlushMappedBufferRange]++;
+	glad_stats_real_glFlushMappedBufferRange(arg0, arg1, arg2);
+}
+static PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC glad_stats_real_glFlushMappedNamedBufferRange = 0;
+static void APIENTRY glad_stats_impl_glFlushMappedNamedBufferRange(GLuint arg0, GLintptr arg1, GLsizeiptr arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFlushMappedNamedBufferRange]++;
+	glad_stats_real_glFlushMappedNamedBufferRange(arg0, arg1, arg2);
+}
+static PFNGLFOGCOORDPOINTERPROC glad_stats_real_glFogCoordPointer = 0;
+static void APIENTRY glad_stats_impl_glFogCoordPointer(GLenum arg0, GLsizei arg1, const void * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFogCoordPointer]++;
+	glad_stats_real_glFogCoordPointer(arg0, arg1, arg2);
+}
+static PFNGLFOGCOORDDPROC glad_stats_real_glFogCoordd = 0;
+static void APIENTRY glad_stats_impl_glFogCoordd(GLdouble arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFogCoordd]++;
+	glad_stats_real_glFogCoordd(arg0);
+}
+static PFNGLFOGCOORDDVPROC glad_stats_real_glFogCoorddv = 0;
+static void APIENTRY glad_stats_impl_glFogCoorddv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFogCoorddv]++;
+	glad_stats_real_glFogCoorddv(arg0);
+}
+static PFNGLFOGCOORDFPROC glad_stats_real_glFogCoordf = 0;
+static void APIENTRY glad_stats_impl_glFogCoordf(GLfloat arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFogCoordf]++;
+	glad_stats_real_glFogCoordf(arg0);
+}
+static PFNGLFOGCOORDFVPROC glad_stats_real_glFogCoordfv = 0;
+static void APIENTRY glad_stats_impl_glFogCoordfv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFogCoordfv]++;
+	glad_stats_real_glFogCoordfv(arg0);
+}
+static PFNGLFOGFPROC glad_stats_real_glFogf = 0;
+static void APIENTRY glad_stats_impl_glFogf(GLenum arg0, GLfloat arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFogf]++;
+	glad_stats_real_glFogf(arg0, arg1);
+}
+static PFNGLFOGFVPROC glad_stats_real_glFogfv = 0;
+static void APIENTRY glad_stats_impl_glFogfv(GLenum arg0, const GLfloat * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFogfv]++;
+	glad_stats_real_glFogfv(arg0, arg1);
+}
+static PFNGLFOGIPROC glad_stats_real_glFogi = 0;
+static void APIENTRY glad_stats_impl_glFogi(GLenum arg0, GLint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFogi]++;
+	glad_stats_real_glFogi(arg0, arg1);
+}
+static PFNGLFOGIVPROC glad_stats_real_glFogiv = 0;
+static void APIENTRY glad_stats_impl_glFogiv(GLenum arg0, const GLint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFogiv]++;
+	glad_stats_real_glFogiv(arg0, arg1);
+}
+static PFNGLFRAMEBUFFERPARAMETERIPROC glad_stats_real_glFramebufferParameteri = 0;
+static void APIENTRY glad_stats_impl_glFramebufferParameteri(GLenum arg0, GLenum arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFramebufferParameteri]++;
+	glad_stats_real_glFramebufferParameteri(arg0, arg1, arg2);
+}
+static PFNGLFRAMEBUFFERRENDERBUFFERPROC glad_stats_real_glFramebufferRenderbuffer = 0;
+static void APIENTRY glad_stats_impl_glFramebufferRenderbuffer(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFramebufferRenderbuffer]++;
+	glad_stats_real_glFramebufferRenderbuffer(arg0, arg1, arg2, arg3);
+}
+static PFNGLFRAMEBUFFERTEXTUREPROC glad_stats_real_glFramebufferTexture = 0;
+static void APIENTRY glad_stats_impl_glFramebufferTexture(GLenum arg0, GLenum arg1, GLuint arg2, GLint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFramebufferTexture]++;
+	glad_stats_real_glFramebufferTexture(arg0, arg1, arg2, arg3);
+}
+static PFNGLFRAMEBUFFERTEXTURE1DPROC glad_stats_real_glFramebufferTexture1D = 0;
+static void APIENTRY glad_stats_impl_glFramebufferTexture1D(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3, GLint arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFramebufferTexture1D]++;
+	glad_stats_real_glFramebufferTexture1D(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLFRAMEBUFFERTEXTURE2DPROC glad_stats_real_glFramebufferTexture2D = 0;
+static void APIENTRY glad_stats_impl_glFramebufferTexture2D(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3, GLint arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFramebufferTexture2D]++;
+	glad_stats_real_glFramebufferTexture2D(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLFRAMEBUFFERTEXTURE3DPROC glad_stats_real_glFramebufferTexture3D = 0;
+static void APIENTRY glad_stats_impl_glFramebufferTexture3D(GLenum arg0, GLenum arg1, GLenum arg2, GLuint arg3, GLint arg4, GLint arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFramebufferTexture3D]++;
+	glad_stats_real_glFramebufferTexture3D(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLFRAMEBUFFERTEXTURELAYERPROC glad_stats_real_glFramebufferTextureLayer = 0;
+static void APIENTRY glad_stats_impl_glFramebufferTextureLayer(GLenum arg0, GLenum arg1, GLuint arg2, GLint arg3, GLint arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFramebufferTextureLayer]++;
+	glad_stats_real_glFramebufferTextureLayer(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLFRONTFACEPROC glad_stats_real_glFrontFace = 0;
+static void APIENTRY glad_stats_impl_glFrontFace(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFrontFace]++;
+	glad_stats_real_glFrontFace(arg0);
+}
+static PFNGLFRUSTUMPROC glad_stats_real_glFrustum = 0;
+static void APIENTRY glad_stats_impl_glFrustum(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4, GLdouble arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glFrustum]++;
+	glad_stats_real_glFrustum(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLGENBUFFERSPROC glad_stats_real_glGenBuffers = 0;
+static void APIENTRY glad_stats_impl_glGenBuffers(GLsizei arg0, GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGenBuffers]++;
+	glad_stats_real_glGenBuffers(arg0, arg1);
+}
+static PFNGLGENFRAMEBUFFERSPROC glad_stats_real_glGenFramebuffers = 0;
+static void APIENTRY glad_stats_impl_glGenFramebuffers(GLsizei arg0, GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGenFramebuffers]++;
+	glad_stats_real_glGenFramebuffers(arg0, arg1);
+}
+static PFNGLGENLISTSPROC glad_stats_real_glGenLists = 0;
+static GLuint APIENTRY glad_stats_impl_glGenLists(GLsizei arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGenLists]++;
+	return glad_stats_real_glGenLists(arg0);
+}
+static PFNGLGENPROGRAMPIPELINESPROC glad_stats_real_glGenProgramPipelines = 0;
+static void APIENTRY glad_stats_impl_glGenProgramPipelines(GLsizei arg0, GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGenProgramPipelines]++;
+	glad_stats_real_glGenProgramPipelines(arg0, arg1);
+}
+static PFNGLGENQUERIESPROC glad_stats_real_glGenQueries = 0;
+static void APIENTRY glad_stats_impl_glGenQueries(GLsizei arg0, GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGenQueries]++;
+	glad_stats_real_glGenQueries(arg0, arg1);
+}
+static PFNGLGENRENDERBUFFERSPROC glad_stats_real_glGenRenderbuffers = 0;
+static void APIENTRY glad_stats_impl_glGenRenderbuffers(GLsizei arg0, GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGenRenderbuffers]++;
+	glad_stats_real_glGenRenderbuffers(arg0, arg1);
+}
+static PFNGLGENSAMPLERSPROC glad_stats_real_glGenSamplers = 0;
+static void APIENTRY glad_stats_impl_glGenSamplers(GLsizei arg0, GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGenSamplers]++;
+	glad_stats_real_glGenSamplers(arg0, arg1);
+}
+static PFNGLGENTEXTURESPROC glad_stats_real_glGenTextures = 0;
+static void APIENTRY glad_stats_impl_glGenTextures(GLsizei arg0, GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGenTextures]++;
+	glad_stats_real_glGenTextures(arg0, arg1);
+}
+static PFNGLGENTRANSFORMFEEDBACKSPROC glad_stats_real_glGenTransformFeedbacks = 0;
+static void APIENTRY glad_stats_impl_glGenTransformFeedbacks(GLsizei arg0, GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGenTransformFeedbacks]++;
+	glad_stats_real_glGenTransformFeedbacks(arg0, arg1);
+}
+static PFNGLGENVERTEXARRAYSPROC glad_stats_real_glGenVertexArrays = 0;
+static void APIENTRY glad_stats_impl_glGenVertexArrays(GLsizei arg0, GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGenVertexArrays]++;
+	glad_stats_real_glGenVertexArrays(arg0, arg1);
+}
+static PFNGLGENERATEMIPMAPPROC glad_stats_real_glGenerateMipmap = 0;
+static void APIENTRY glad_stats_impl_glGenerateMipmap(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGenerateMipmap]++;
+	glad_stats_real_glGenerateMipmap(arg0);
+}
+static PFNGLGENERATETEXTUREMIPMAPPROC glad_stats_real_glGenerateTextureMipmap = 0;
+static void APIENTRY glad_stats_impl_glGenerateTextureMipmap(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGenerateTextureMipmap]++;
+	glad_stats_real_glGenerateTextureMipmap(arg0);
+}
+static PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC glad_stats_real_glGetActiveAtomicCounterBufferiv = 0;
+static void APIENTRY glad_stats_impl_glGetActiveAtomicCounterBufferiv(GLuint arg0, GLuint arg1, GLenum arg2, GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetActiveAtomicCounterBufferiv]++;
+	glad_stats_real_glGetActiveAtomicCounterBufferiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETACTIVEATTRIBPROC glad_stats_real_glGetActiveAttrib = 0;
+static void APIENTRY glad_stats_impl_glGetActiveAttrib(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLint * arg4, GLenum * arg5, GLchar * arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetActiveAttrib]++;
+	glad_stats_real_glGetActiveAttrib(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLGETACTIVESUBROUTINENAMEPROC glad_stats_real_glGetActiveSubroutineName = 0;
+static void APIENTRY glad_stats_impl_glGetActiveSubroutineName(GLuint arg0, GLenum arg1, GLuint arg2, GLsizei arg3, GLsizei * arg4, GLchar * arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetActiveSubroutineName]++;
+	glad_stats_real_glGetActiveSubroutineName(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC glad_stats_real_glGetActiveSubroutineUniformName = 0;
+static void APIENTRY glad_stats_impl_glGetActiveSubroutineUniformName(GLuint arg0, GLenum arg1, GLuint arg2, GLsizei arg3, GLsizei * arg4, GLchar * arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetActiveSubroutineUniformName]++;
+	glad_stats_real_glGetActiveSubroutineUniformName(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC glad_stats_real_glGetActiveSubroutineUniformiv = 0;
+static void APIENTRY glad_stats_impl_glGetActiveSubroutineUniformiv(GLuint arg0, GLenum arg1, GLuint arg2, GLenum arg3, GLint * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetActiveSubroutineUniformiv]++;
+	glad_stats_real_glGetActiveSubroutineUniformiv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLGETACTIVEUNIFORMPROC glad_stats_real_glGetActiveUniform = 0;
+static void APIENTRY glad_stats_impl_glGetActiveUniform(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLint * arg4, GLenum * arg5, GLchar * arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetActiveUniform]++;
+	glad_stats_real_glGetActiveUniform(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC glad_stats_real_glGetActiveUniformBlockName = 0;
+static void APIENTRY glad_stats_impl_glGetActiveUniformBlockName(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLchar * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetActiveUniformBlockName]++;
+	glad_stats_real_glGetActiveUniformBlockName(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLGETACTIVEUNIFORMBLOCKIVPROC glad_stats_real_glGetActiveUniformBlockiv = 0;
+static void APIENTRY glad_stats_impl_glGetActiveUniformBlockiv(GLuint arg0, GLuint arg1, GLenum arg2, GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetActiveUniformBlockiv]++;
+	glad_stats_real_glGetActiveUniformBlockiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETACTIVEUNIFORMNAMEPROC glad_stats_real_glGetActiveUniformName = 0;
+static void APIENTRY glad_stats_impl_glGetActiveUniformName(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLchar * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetActiveUniformName]++;
+	glad_stats_real_glGetActiveUniformName(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLGETACTIVEUNIFORMSIVPROC glad_stats_real_glGetActiveUniformsiv = 0;
+static void APIENTRY glad_stats_impl_glGetActiveUniformsiv(GLuint arg0, GLsizei arg1, const GLuint * arg2, GLenum arg3, GLint * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetActiveUniformsiv]++;
+	glad_stats_real_glGetActiveUniformsiv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLGETATTACHEDSHADERSPROC glad_stats_real_glGetAttachedShaders = 0;
+static void APIENTRY glad_stats_impl_glGetAttachedShaders(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLuint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetAttachedShaders]++;
+	glad_stats_real_glGetAttachedShaders(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETATTRIBLOCATIONPROC glad_stats_real_glGetAttribLocation = 0;
+static GLint APIENTRY glad_stats_impl_glGetAttribLocation(GLuint arg0, const GLchar * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetAttribLocation]++;
+	return glad_stats_real_glGetAttribLocation(arg0, arg1);
+}
+static PFNGLGETBOOLEANI_VPROC glad_stats_real_glGetBooleani_v = 0;
+static void APIENTRY glad_stats_impl_glGetBooleani_v(GLenum arg0, GLuint arg1, GLboolean * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetBooleani_v]++;
+	glad_stats_real_glGetBooleani_v(arg0, arg1, arg2);
+}
+static PFNGLGETBOOLEANVPROC glad_stats_real_glGetBooleanv = 0;
+static void APIENTRY glad_stats_impl_glGetBooleanv(GLenum arg0, GLboolean * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetBooleanv]++;
+	glad_stats_real_glGetBooleanv(arg0, arg1);
+}
+static PFNGLGETBUFFERPARAMETERI64VPROC glad_stats_real_glGetBufferParameteri64v = 0;
+static void APIENTRY glad_stats_impl_glGetBufferParameteri64v(GLenum arg0, GLenum arg1, GLint64 * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetBufferParameteri64v]++;
+	glad_stats_real_glGetBufferParameteri64v(arg0, arg1, arg2);
+}
+static PFNGLGETBUFFERPARAMETERIVPROC glad_stats_real_glGetBufferParameteriv = 0;
+static void APIENTRY glad_stats_impl_glGetBufferParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetBufferParameteriv]++;
+	glad_stats_real_glGetBufferParameteriv(arg0, arg1, arg2);
+}
+static PFNGLGETBUFFERPOINTERVPROC glad_stats_real_glGetBufferPointerv = 0;
+static void APIENTRY glad_stats_impl_glGetBufferPointerv(GLenum arg0, GLenum arg1, void * * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetBufferPointerv]++;
+	glad_stats_real_glGetBufferPointerv(arg0, arg1, arg2);
+}
+static PFNGLGETBUFFERSUBDATAPROC glad_stats_real_glGetBufferSubData = 0;
+static void APIENTRY glad_stats_impl_glGetBufferSubData(GLenum arg0, GLintptr arg1, GLsizeiptr arg2, void * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetBufferSubData]++;
+	glad_stats_real_glGetBufferSubData(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETCLIPPLANEPROC glad_stats_real_glGetClipPlane = 0;
+static void APIENTRY glad_stats_impl_glGetClipPlane(GLenum arg0, GLdouble * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetClipPlane]++;
+	glad_stats_real_glGetClipPlane(arg0, arg1);
+}
+static PFNGLGETCOMPRESSEDTEXIMAGEPROC glad_stats_real_glGetCompressedTexImage = 0;
+static void APIENTRY glad_stats_impl_glGetCompressedTexImage(GLenum arg0, GLint arg1, void * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetCompressedTexImage]++;
+	glad_stats_real_glGetCompressedTexImage(arg0, arg1, arg2);
+}
+static PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC glad_stats_real_glGetCompressedTextureImage = 0;
+static void APIENTRY glad_stats_impl_glGetCompressedTextureImage(GLuint arg0, GLint arg1, GLsizei arg2, void * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetCompressedTextureImage]++;
+	glad_stats_real_glGetCompressedTextureImage(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC glad_stats_real_glGetCompressedTextureSubImage = 0;
+static void APIENTRY glad_stats_impl_glGetCompressedTextureSubImage(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLsizei arg8, void * arg9) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetCompressedTextureSubImage]++;
+	glad_stats_real_glGetCompressedTextureSubImage(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+static PFNGLGETDEBUGMESSAGELOGPROC glad_stats_real_glGetDebugMessageLog = 0;
+static GLuint APIENTRY glad_stats_impl_glGetDebugMessageLog(GLuint arg0, GLsizei arg1, GLenum * arg2, GLenum * arg3, GLuint * arg4, GLenum * arg5, GLsizei * arg6, GLchar * arg7) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetDebugMessageLog]++;
+	return glad_stats_real_glGetDebugMessageLog(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static PFNGLGETDOUBLEI_VPROC glad_stats_real_glGetDoublei_v = 0;
+static void APIENTRY glad_stats_impl_glGetDoublei_v(GLenum arg0, GLuint arg1, GLdouble * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetDoublei_v]++;
+	glad_stats_real_glGetDoublei_v(arg0, arg1, arg2);
+}
+static PFNGLGETDOUBLEVPROC glad_stats_real_glGetDoublev = 0;
+static void APIENTRY glad_stats_impl_glGetDoublev(GLenum arg0, GLdouble * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetDoublev]++;
+	glad_stats_real_glGetDoublev(arg0, arg1);
+}
+static PFNGLGETERRORPROC glad_stats_real_glGetError = 0;
+static GLenum APIENTRY glad_stats_impl_glGetError(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetError]++;
+	return glad_stats_real_glGetError();
+}
+static PFNGLGETFLOATI_VPROC glad_stats_real_glGetFloati_v = 0;
+static void APIENTRY glad_stats_impl_glGetFloati_v(GLenum arg0, GLuint arg1, GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetFloati_v]++;
+	glad_stats_real_glGetFloati_v(arg0, arg1, arg2);
+}
+static PFNGLGETFLOATVPROC glad_stats_real_glGetFloatv = 0;
+static void APIENTRY glad_stats_impl_glGetFloatv(GLenum arg0, GLfloat * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetFloatv]++;
+	glad_stats_real_glGetFloatv(arg0, arg1);
+}
+static PFNGLGETFRAGDATAINDEXPROC glad_stats_real_glGetFragDataIndex = 0;
+static GLint APIENTRY glad_stats_impl_glGetFragDataIndex(GLuint arg0, const GLchar * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetFragDataIndex]++;
+	return glad_stats_real_glGetFragDataIndex(arg0, arg1);
+}
+static PFNGLGETFRAGDATALOCATIONPROC glad_stats_real_glGetFragDataLocation = 0;
+static GLint APIENTRY glad_stats_impl_glGetFragDataLocation(GLuint arg0, const GLchar * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetFragDataLocation]++;
+	return glad_stats_real_glGetFragDataLocation(arg0, arg1);
+}
+static PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_stats_real_glGetFramebufferAttachmentParameteriv = 0;
+static void APIENTRY glad_stats_impl_glGetFramebufferAttachmentParameteriv(GLenum arg0, GLenum arg1, GLenum arg2, GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetFramebufferAttachmentParameteriv]++;
+	glad_stats_real_glGetFramebufferAttachmentParameteriv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETFRAMEBUFFERPARAMETERIVPROC glad_stats_real_glGetFramebufferParameteriv = 0;
+static void APIENTRY glad_stats_impl_glGetFramebufferParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetFramebufferParameteriv]++;
+	glad_stats_real_glGetFramebufferParameteriv(arg0, arg1, arg2);
+}
+static PFNGLGETGRAPHICSRESETSTATUSPROC glad_stats_real_glGetGraphicsResetStatus = 0;
+static GLenum APIENTRY glad_stats_impl_glGetGraphicsResetStatus(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetGraphicsResetStatus]++;
+	return glad_stats_real_glGetGraphicsResetStatus();
+}
+static PFNGLGETIMAGEHANDLEARBPROC glad_stats_real_glGetImageHandleARB = 0;
+static GLuint64 APIENTRY glad_stats_impl_glGetImageHandleARB(GLuint arg0, GLint arg1, GLboolean arg2, GLint arg3, GLenum arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetImageHandleARB]++;
+	return glad_stats_real_glGetImageHandleARB(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLGETINTEGER64I_VPROC glad_stats_real_glGetInteger64i_v = 0;
+static void APIENTRY glad_stats_impl_glGetInteger64i_v(GLenum arg0, GLuint arg1, GLint64 * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetInteger64i_v]++;
+	glad_stats_real_glGetInteger64i_v(arg0, arg1, arg2);
+}
+static PFNGLGETINTEGER64VPROC glad_stats_real_glGetInteger64v = 0;
+static void APIENTRY glad_stats_impl_glGetInteger64v(GLenum arg0, GLint64 * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetInteger64v]++;
+	glad_stats_real_glGetInteger64v(arg0, arg1);
+}
+static PFNGLGETINTEGERI_VPROC glad_stats_real_glGetIntegeri_v = 0;
+static void APIENTRY glad_stats_impl_glGetIntegeri_v(GLenum arg0, GLuint arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetIntegeri_v]++;
+	glad_stats_real_glGetIntegeri_v(arg0, arg1, arg2);
+}
+static PFNGLGETINTEGERVPROC glad_stats_real_glGetIntegerv = 0;
+static void APIENTRY glad_stats_impl_glGetIntegerv(GLenum arg0, GLint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetIntegerv]++;
+	glad_stats_real_glGetIntegerv(arg0, arg1);
+}
+static PFNGLGETINTERNALFORMATI64VPROC glad_stats_real_glGetInternalformati64v = 0;
+static void APIENTRY glad_stats_impl_glGetInternalformati64v(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, GLint64 * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetInternalformati64v]++;
+	glad_stats_real_glGetInternalformati64v(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLGETINTERNALFORMATIVPROC glad_stats_real_glGetInternalformativ = 0;
+static void APIENTRY glad_stats_impl_glGetInternalformativ(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, GLint * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetInternalformativ]++;
+	glad_stats_real_glGetInternalformativ(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLGETLIGHTFVPROC glad_stats_real_glGetLightfv = 0;
+static void APIENTRY glad_stats_impl_glGetLightfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetLightfv]++;
+	glad_stats_real_glGetLightfv(arg0, arg1, arg2);
+}
+static PFNGLGETLIGHTIVPROC glad_stats_real_glGetLightiv = 0;
+static void APIENTRY glad_stats_impl_glGetLightiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetLightiv]++;
+	glad_stats_real_glGetLightiv(arg0, arg1, arg2);
+}
+static PFNGLGETMAPDVPROC glad_stats_real_glGetMapdv = 0;
+static void APIENTRY glad_stats_impl_glGetMapdv(GLenum arg0, GLenum arg1, GLdouble * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetMapdv]++;
+	glad_stats_real_glGetMapdv(arg0, arg1, arg2);
+}
+static PFNGLGETMAPFVPROC glad_stats_real_glGetMapfv = 0;
+static void APIENTRY glad_stats_impl_glGetMapfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetMapfv]++;
+	glad_stats_real_glGetMapfv(arg0, arg1, arg2);
+}
+static PFNGLGETMAPIVPROC glad_stats_real_glGetMapiv = 0;
+static void APIENTRY glad_stats_impl_glGetMapiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetMapiv]++;
+	glad_stats_real_glGetMapiv(arg0, arg1, arg2);
+}
+static PFNGLGETMATERIALFVPROC glad_stats_real_glGetMaterialfv = 0;
+static void APIENTRY glad_stats_impl_glGetMaterialfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetMaterialfv]++;
+	glad_stats_real_glGetMaterialfv(arg0, arg1, arg2);
+}
+static PFNGLGETMATERIALIVPROC glad_stats_real_glGetMaterialiv = 0;
+static void APIENTRY glad_stats_impl_glGetMaterialiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetMaterialiv]++;
+	glad_stats_real_glGetMaterialiv(arg0, arg1, arg2);
+}
+static PFNGLGETMULTISAMPLEFVPROC glad_stats_real_glGetMultisamplefv = 0;
+static void APIENTRY glad_stats_impl_glGetMultisamplefv(GLenum arg0, GLuint arg1, GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetMultisamplefv]++;
+	glad_stats_real_glGetMultisamplefv(arg0, arg1, arg2);
+}
+static PFNGLGETNAMEDBUFFERPARAMETERI64VPROC glad_stats_real_glGetNamedBufferParameteri64v = 0;
+static void APIENTRY glad_stats_impl_glGetNamedBufferParameteri64v(GLuint arg0, GLenum arg1, GLint64 * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetNamedBufferParameteri64v]++;
+	glad_stats_real_glGetNamedBufferParameteri64v(arg0, arg1, arg2);
+}
+static PFNGLGETNAMEDBUFFERPARAMETERIVPROC glad_stats_real_glGetNamedBufferParameteriv = 0;
+static void APIENTRY glad_stats_impl_glGetNamedBufferParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetNamedBufferParameteriv]++;
+	glad_stats_real_glGetNamedBufferParameteriv(arg0, arg1, arg2);
+}
+static PFNGLGETNAMEDBUFFERPOINTERVPROC glad_stats_real_glGetNamedBufferPointerv = 0;
+static void APIENTRY glad_stats_impl_glGetNamedBufferPointerv(GLuint arg0, GLenum arg1, void * * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetNamedBufferPointerv]++;
+	glad_stats_real_glGetNamedBufferPointerv(arg0, arg1, arg2);
+}
+static PFNGLGETNAMEDBUFFERSUBDATAPROC glad_stats_real_glGetNamedBufferSubData = 0;
+static void APIENTRY glad_stats_impl_glGetNamedBufferSubData(GLuint arg0, GLintptr arg1, GLsizeiptr arg2, void * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetNamedBufferSubData]++;
+	glad_stats_real_glGetNamedBufferSubData(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC glad_stats_real_glGetNamedFramebufferAttachmentParameteriv = 0;
+static void APIENTRY glad_stats_impl_glGetNamedFramebufferAttachmentParameteriv(GLuint arg0, GLenum arg1, GLenum arg2, GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetNamedFramebufferAttachmentParameteriv]++;
+	glad_stats_real_glGetNamedFramebufferAttachmentParameteriv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC glad_stats_real_glGetNamedFramebufferParameteriv = 0;
+static void APIENTRY glad_stats_impl_glGetNamedFramebufferParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetNamedFramebufferParameteriv]++;
+	glad_stats_real_glGetNamedFramebufferParameteriv(arg0, arg1, arg2);
+}
+static PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC glad_stats_real_glGetNamedRenderbufferParameteriv = 0;
+static void APIENTRY glad_stats_impl_glGetNamedRenderbufferParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetNamedRenderbufferParameteriv]++;
+	glad_stats_real_glGetNamedRenderbufferParameteriv(arg0, arg1, arg2);
+}
+static PFNGLGETOBJECTLABELPROC glad_stats_real_glGetObjectLabel = 0;
+static void APIENTRY glad_stats_impl_glGetObjectLabel(GLenum arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLchar * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetObjectLabel]++;
+	glad_stats_real_glGetObjectLabel(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLGETOBJECTPTRLABELPROC glad_stats_real_glGetObjectPtrLabel = 0;
+static void APIENTRY glad_stats_impl_glGetObjectPtrLabel(const void * arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetObjectPtrLabel]++;
+	glad_stats_real_glGetObjectPtrLabel(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETPIXELMAPFVPROC glad_stats_real_glGetPixelMapfv = 0;
+static void APIENTRY glad_stats_impl_glGetPixelMapfv(GLenum arg0, GLfloat * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetPixelMapfv]++;
+	glad_stats_real_glGetPixelMapfv(arg0, arg1);
+}
+static PFNGLGETPIXELMAPUIVPROC glad_stats_real_glGetPixelMapuiv = 0;
+static void APIENTRY glad_stats_impl_glGetPixelMapuiv(GLenum arg0, GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetPixelMapuiv]++;
+	glad_stats_real_glGetPixelMapuiv(arg0, arg1);
+}
+static PFNGLGETPIXELMAPUSVPROC glad_stats_real_glGetPixelMapusv = 0;
+static void APIENTRY glad_stats_impl_glGetPixelMapusv(GLenum arg0, GLushort * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetPixelMapusv]++;
+	glad_stats_real_glGetPixelMapusv(arg0, arg1);
+}
+static PFNGLGETPOINTERVPROC glad_stats_real_glGetPointerv = 0;
+static void APIENTRY glad_stats_impl_glGetPointerv(GLenum arg0, void * * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetPointerv]++;
+	glad_stats_real_glGetPointerv(arg0, arg1);
+}
+static PFNGLGETPOLYGONSTIPPLEPROC glad_stats_real_glGetPolygonStipple = 0;
+static void APIENTRY glad_stats_impl_glGetPolygonStipple(GLubyte * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetPolygonStipple]++;
+	glad_stats_real_glGetPolygonStipple(arg0);
+}
+static PFNGLGETPROGRAMBINARYPROC glad_stats_real_glGetProgramBinary = 0;
+static void APIENTRY glad_stats_impl_glGetProgramBinary(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLenum * arg3, void * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetProgramBinary]++;
+	glad_stats_real_glGetProgramBinary(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLGETPROGRAMINFOLOGPROC glad_stats_real_glGetProgramInfoLog = 0;
+static void APIENTRY glad_stats_impl_glGetProgramInfoLog(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetProgramInfoLog]++;
+	glad_stats_real_glGetProgramInfoLog(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETPROGRAMINTERFACEIVPROC glad_stats_real_glGetProgramInterfaceiv = 0;
+static void APIENTRY glad_stats_impl_glGetProgramInterfaceiv(GLuint arg0, GLenum arg1, GLenum arg2, GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetProgramInterfaceiv]++;
+	glad_stats_real_glGetProgramInterfaceiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETPROGRAMPIPELINEINFOLOGPROC glad_stats_real_glGetProgramPipelineInfoLog = 0;
+static void APIENTRY glad_stats_impl_glGetProgramPipelineInfoLog(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetProgramPipelineInfoLog]++;
+	glad_stats_real_glGetProgramPipelineInfoLog(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETPROGRAMPIPELINEIVPROC glad_stats_real_glGetProgramPipelineiv = 0;
+static void APIENTRY glad_stats_impl_glGetProgramPipelineiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetProgramPipelineiv]++;
+	glad_stats_real_glGetProgramPipelineiv(arg0, arg1, arg2);
+}
+static PFNGLGETPROGRAMRESOURCEINDEXPROC glad_stats_real_glGetProgramResourceIndex = 0;
+static GLuint APIENTRY glad_stats_impl_glGetProgramResourceIndex(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetProgramResourceIndex]++;
+	return glad_stats_real_glGetProgramResourceIndex(arg0, arg1, arg2);
+}
+static PFNGLGETPROGRAMRESOURCELOCATIONPROC glad_stats_real_glGetProgramResourceLocation = 0;
+static GLint APIENTRY glad_stats_impl_glGetProgramResourceLocation(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetProgramResourceLocation]++;
+	return glad_stats_real_glGetProgramResourceLocation(arg0, arg1, arg2);
+}
+static PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC glad_stats_real_glGetProgramResourceLocationIndex = 0;
+static GLint APIENTRY glad_stats_impl_glGetProgramResourceLocationIndex(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetProgramResourceLocationIndex]++;
+	return glad_stats_real_glGetProgramResourceLocationIndex(arg0, arg1, arg2);
+}
+static PFNGLGETPROGRAMRESOURCENAMEPROC glad_stats_real_glGetProgramResourceName = 0;
+static void APIENTRY glad_stats_impl_glGetProgramResourceName(GLuint arg0, GLenum arg1, GLuint arg2, GLsizei arg3, GLsizei * arg4, GLchar * arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetProgramResourceName]++;
+	glad_stats_real_glGetProgramResourceName(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLGETPROGRAMRESOURCEIVPROC glad_stats_real_glGetProgramResourceiv = 0;
+static void APIENTRY glad_stats_impl_glGetProgramResourceiv(GLuint arg0, GLenum arg1, GLuint arg2, GLsizei arg3, const GLenum * arg4, GLsizei arg5, GLsizei * arg6, GLint * arg7) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetProgramResourceiv]++;
+	glad_stats_real_glGetProgramResourceiv(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static PFNGLGETPROGRAMSTAGEIVPROC glad_stats_real_glGetProgramStageiv = 0;
+static void APIENTRY glad_stats_impl_glGetProgramStageiv(GLuint arg0, GLenum arg1, GLenum arg2, GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetProgramStageiv]++;
+	glad_stats_real_glGetProgramStageiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETPROGRAMIVPROC glad_stats_real_glGetProgramiv = 0;
+static void APIENTRY glad_stats_impl_glGetProgramiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetProgramiv]++;
+	glad_stats_real_glGetProgramiv(arg0, arg1, arg2);
+}
+static PFNGLGETQUERYBUFFEROBJECTI64VPROC glad_stats_real_glGetQueryBufferObjecti64v = 0;
+static void APIENTRY glad_stats_impl_glGetQueryBufferObjecti64v(GLuint arg0, GLuint arg1, GLenum arg2, GLintptr arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetQueryBufferObjecti64v]++;
+	glad_stats_real_glGetQueryBufferObjecti64v(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETQUERYBUFFEROBJECTIVPROC glad_stats_real_glGetQueryBufferObjectiv = 0;
+static void APIENTRY glad_stats_impl_glGetQueryBufferObjectiv(GLuint arg0, GLuint arg1, GLenum arg2, GLintptr arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetQueryBufferObjectiv]++;
+	glad_stats_real_glGetQueryBufferObjectiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETQUERYBUFFEROBJECTUI64VPROC glad_stats_real_glGetQueryBufferObjectui64v = 0;
+static void APIENTRY glad_stats_impl_glGetQueryBufferObjectui64v(GLuint arg0, GLuint arg1, GLenum arg2, GLintptr arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetQueryBufferObjectui64v]++;
+	glad_stats_real_glGetQueryBufferObjectui64v(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETQUERYBUFFEROBJECTUIVPROC glad_stats_real_glGetQueryBufferObjectuiv = 0;
+static void APIENTRY glad_stats_impl_glGetQueryBufferObjectuiv(GLuint arg0, GLuint arg1, GLenum arg2, GLintptr arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetQueryBufferObjectuiv]++;
+	glad_stats_real_glGetQueryBufferObjectuiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETQUERYINDEXEDIVPROC glad_stats_real_glGetQueryIndexediv = 0;
+static void APIENTRY glad_stats_impl_glGetQueryIndexediv(GLenum arg0, GLuint arg1, GLenum arg2, GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetQueryIndexediv]++;
+	glad_stats_real_glGetQueryIndexediv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETQUERYOBJECTI64VPROC glad_stats_real_glGetQueryObjecti64v = 0;
+static void APIENTRY glad_stats_impl_glGetQueryObjecti64v(GLuint arg0, GLenum arg1, GLint64 * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetQueryObjecti64v]++;
+	glad_stats_real_glGetQueryObjecti64v(arg0, arg1, arg2);
+}
+static PFNGLGETQUERYOBJECTIVPROC glad_stats_real_glGetQueryObjectiv = 0;
+static void APIENTRY glad_stats_impl_glGetQueryObjectiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetQueryObjectiv]++;
+	glad_stats_real_glGetQueryObjectiv(arg0, arg1, arg2);
+}
+static PFNGLGETQUERYOBJECTUI64VPROC glad_stats_real_glGetQueryObjectui64v = 0;
+static void APIENTRY glad_stats_impl_glGetQueryObjectui64v(GLuint arg0, GLenum arg1, GLuint64 * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetQueryObjectui64v]++;
+	glad_stats_real_glGetQueryObjectui64v(arg0, arg1, arg2);
+}
+static PFNGLGETQUERYOBJECTUIVPROC glad_stats_real_glGetQueryObjectuiv = 0;
+static void APIENTRY glad_stats_impl_glGetQueryObjectuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetQueryObjectuiv]++;
+	glad_stats_real_glGetQueryObjectuiv(arg0, arg1, arg2);
+}
+static PFNGLGETQUERYIVPROC glad_stats_real_glGetQueryiv = 0;
+static void APIENTRY glad_stats_impl_glGetQueryiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetQueryiv]++;
+	glad_stats_real_glGetQueryiv(arg0, arg1, arg2);
+}
+static PFNGLGETRENDERBUFFERPARAMETERIVPROC glad_stats_real_glGetRenderbufferParameteriv = 0;
+static void APIENTRY glad_stats_impl_glGetRenderbufferParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetRenderbufferParameteriv]++;
+	glad_stats_real_glGetRenderbufferParameteriv(arg0, arg1, arg2);
+}
+static PFNGLGETSAMPLERPARAMETERIIVPROC glad_stats_real_glGetSamplerParameterIiv = 0;
+static void APIENTRY glad_stats_impl_glGetSamplerParameterIiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetSamplerParameterIiv]++;
+	glad_stats_real_glGetSamplerParameterIiv(arg0, arg1, arg2);
+}
+static PFNGLGETSAMPLERPARAMETERIUIVPROC glad_stats_real_glGetSamplerParameterIuiv = 0;
+static void APIENTRY glad_stats_impl_glGetSamplerParameterIuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetSamplerParameterIuiv]++;
+	glad_stats_real_glGetSamplerParameterIuiv(arg0, arg1, arg2);
+}
+static PFNGLGETSAMPLERPARAMETERFVPROC glad_stats_real_glGetSamplerParameterfv = 0;
+static void APIENTRY glad_stats_impl_glGetSamplerParameterfv(GLuint arg0, GLenum arg1, GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetSamplerParameterfv]++;
+	glad_stats_real_glGetSamplerParameterfv(arg0, arg1, arg2);
+}
+static PFNGLGETSAMPLERPARAMETERIVPROC glad_stats_real_glGetSamplerParameteriv = 0;
+static void APIENTRY glad_stats_impl_glGetSamplerParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetSamplerParameteriv]++;
+	glad_stats_real_glGetSamplerParameteriv(arg0, arg1, arg2);
+}
+static PFNGLGETSHADERINFOLOGPROC glad_stats_real_glGetShaderInfoLog = 0;
+static void APIENTRY glad_stats_impl_glGetShaderInfoLog(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetShaderInfoLog]++;
+	glad_stats_real_glGetShaderInfoLog(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETSHADERPRECISIONFORMATPROC glad_stats_real_glGetShaderPrecisionFormat = 0;
+static void APIENTRY glad_stats_impl_glGetShaderPrecisionFormat(GLenum arg0, GLenum arg1, GLint * arg2, GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetShaderPrecisionFormat]++;
+	glad_stats_real_glGetShaderPrecisionFormat(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETSHADERSOURCEPROC glad_stats_real_glGetShaderSource = 0;
+static void APIENTRY glad_stats_impl_glGetShaderSource(GLuint arg0, GLsizei arg1, GLsizei * arg2, GLchar * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetShaderSource]++;
+	glad_stats_real_glGetShaderSource(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETSHADERIVPROC glad_stats_real_glGetShaderiv = 0;
+static void APIENTRY glad_stats_impl_glGetShaderiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetShaderiv]++;
+	glad_stats_real_glGetShaderiv(arg0, arg1, arg2);
+}
+static PFNGLGETSTRINGPROC glad_stats_real_glGetString = 0;
+static const GLubyte * APIENTRY glad_stats_impl_glGetString(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetString]++;
+	return glad_stats_real_glGetString(arg0);
+}
+static PFNGLGETSTRINGIPROC glad_stats_real_glGetStringi = 0;
+static const GLubyte * APIENTRY glad_stats_impl_glGetStringi(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetStringi]++;
+	return glad_stats_real_glGetStringi(arg0, arg1);
+}
+static PFNGLGETSUBROUTINEINDEXPROC glad_stats_real_glGetSubroutineIndex = 0;
+static GLuint APIENTRY glad_stats_impl_glGetSubroutineIndex(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetSubroutineIndex]++;
+	return glad_stats_real_glGetSubroutineIndex(arg0, arg1, arg2);
+}
+static PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC glad_stats_real_glGetSubroutineUniformLocation = 0;
+static GLint APIENTRY glad_stats_impl_glGetSubroutineUniformLocation(GLuint arg0, GLenum arg1, const GLchar * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetSubroutineUniformLocation]++;
+	return glad_stats_real_glGetSubroutineUniformLocation(arg0, arg1, arg2);
+}
+static PFNGLGETSYNCIVPROC glad_stats_real_glGetSynciv = 0;
+static void APIENTRY glad_stats_impl_glGetSynciv(GLsync arg0, GLenum arg1, GLsizei arg2, GLsizei * arg3, GLint * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetSynciv]++;
+	glad_stats_real_glGetSynciv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLGETTEXENVFVPROC glad_stats_real_glGetTexEnvfv = 0;
+static void APIENTRY glad_stats_impl_glGetTexEnvfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTexEnvfv]++;
+	glad_stats_real_glGetTexEnvfv(arg0, arg1, arg2);
+}
+static PFNGLGETTEXENVIVPROC glad_stats_real_glGetTexEnviv = 0;
+static void APIENTRY glad_stats_impl_glGetTexEnviv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTexEnviv]++;
+	glad_stats_real_glGetTexEnviv(arg0, arg1, arg2);
+}
+static PFNGLGETTEXGENDVPROC glad_stats_real_glGetTexGendv = 0;
+static void APIENTRY glad_stats_impl_glGetTexGendv(GLenum arg0, GLenum arg1, GLdouble * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTexGendv]++;
+	glad_stats_real_glGetTexGendv(arg0, arg1, arg2);
+}
+static PFNGLGETTEXGENFVPROC glad_stats_real_glGetTexGenfv = 0;
+static void APIENTRY glad_stats_impl_glGetTexGenfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTexGenfv]++;
+	glad_stats_real_glGetTexGenfv(arg0, arg1, arg2);
+}
+static PFNGLGETTEXGENIVPROC glad_stats_real_glGetTexGeniv = 0;
+static void APIENTRY glad_stats_impl_glGetTexGeniv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTexGeniv]++;
+	glad_stats_real_glGetTexGeniv(arg0, arg1, arg2);
+}
+static PFNGLGETTEXIMAGEPROC glad_stats_real_glGetTexImage = 0;
+static void APIENTRY glad_stats_impl_glGetTexImage(GLenum arg0, GLint arg1, GLenum arg2, GLenum arg3, void * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTexImage]++;
+	glad_stats_real_glGetTexImage(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLGETTEXLEVELPARAMETERFVPROC glad_stats_real_glGetTexLevelParameterfv = 0;
+static void APIENTRY glad_stats_impl_glGetTexLevelParameterfv(GLenum arg0, GLint arg1, GLenum arg2, GLfloat * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTexLevelParameterfv]++;
+	glad_stats_real_glGetTexLevelParameterfv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETTEXLEVELPARAMETERIVPROC glad_stats_real_glGetTexLevelParameteriv = 0;
+static void APIENTRY glad_stats_impl_glGetTexLevelParameteriv(GLenum arg0, GLint arg1, GLenum arg2, GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTexLevelParameteriv]++;
+	glad_stats_real_glGetTexLevelParameteriv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETTEXPARAMETERIIVPROC glad_stats_real_glGetTexParameterIiv = 0;
+static void APIENTRY glad_stats_impl_glGetTexParameterIiv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTexParameterIiv]++;
+	glad_stats_real_glGetTexParameterIiv(arg0, arg1, arg2);
+}
+static PFNGLGETTEXPARAMETERIUIVPROC glad_stats_real_glGetTexParameterIuiv = 0;
+static void APIENTRY glad_stats_impl_glGetTexParameterIuiv(GLenum arg0, GLenum arg1, GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTexParameterIuiv]++;
+	glad_stats_real_glGetTexParameterIuiv(arg0, arg1, arg2);
+}
+static PFNGLGETTEXPARAMETERFVPROC glad_stats_real_glGetTexParameterfv = 0;
+static void APIENTRY glad_stats_impl_glGetTexParameterfv(GLenum arg0, GLenum arg1, GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTexParameterfv]++;
+	glad_stats_real_glGetTexParameterfv(arg0, arg1, arg2);
+}
+static PFNGLGETTEXPARAMETERIVPROC glad_stats_real_glGetTexParameteriv = 0;
+static void APIENTRY glad_stats_impl_glGetTexParameteriv(GLenum arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTexParameteriv]++;
+	glad_stats_real_glGetTexParameteriv(arg0, arg1, arg2);
+}
+static PFNGLGETTEXTUREHANDLEARBPROC glad_stats_real_glGetTextureHandleARB = 0;
+static GLuint64 APIENTRY glad_stats_impl_glGetTextureHandleARB(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTextureHandleARB]++;
+	return glad_stats_real_glGetTextureHandleARB(arg0);
+}
+static PFNGLGETTEXTUREIMAGEPROC glad_stats_real_glGetTextureImage = 0;
+static void APIENTRY glad_stats_impl_glGetTextureImage(GLuint arg0, GLint arg1, GLenum arg2, GLenum arg3, GLsizei arg4, void * arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTextureImage]++;
+	glad_stats_real_glGetTextureImage(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLGETTEXTURELEVELPARAMETERFVPROC glad_stats_real_glGetTextureLevelParameterfv = 0;
+static void APIENTRY glad_stats_impl_glGetTextureLevelParameterfv(GLuint arg0, GLint arg1, GLenum arg2, GLfloat * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTextureLevelParameterfv]++;
+	glad_stats_real_glGetTextureLevelParameterfv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETTEXTURELEVELPARAMETERIVPROC glad_stats_real_glGetTextureLevelParameteriv = 0;
+static void APIENTRY glad_stats_impl_glGetTextureLevelParameteriv(GLuint arg0, GLint arg1, GLenum arg2, GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTextureLevelParameteriv]++;
+	glad_stats_real_glGetTextureLevelParameteriv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETTEXTUREPARAMETERIIVPROC glad_stats_real_glGetTextureParameterIiv = 0;
+static void APIENTRY glad_stats_impl_glGetTextureParameterIiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTextureParameterIiv]++;
+	glad_stats_real_glGetTextureParameterIiv(arg0, arg1, arg2);
+}
+static PFNGLGETTEXTUREPARAMETERIUIVPROC glad_stats_real_glGetTextureParameterIuiv = 0;
+static void APIENTRY glad_stats_impl_glGetTextureParameterIuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTextureParameterIuiv]++;
+	glad_stats_real_glGetTextureParameterIuiv(arg0, arg1, arg2);
+}
+static PFNGLGETTEXTUREPARAMETERFVPROC glad_stats_real_glGetTextureParameterfv = 0;
+static void APIENTRY glad_stats_impl_glGetTextureParameterfv(GLuint arg0, GLenum arg1, GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTextureParameterfv]++;
+	glad_stats_real_glGetTextureParameterfv(arg0, arg1, arg2);
+}
+static PFNGLGETTEXTUREPARAMETERIVPROC glad_stats_real_glGetTextureParameteriv = 0;
+static void APIENTRY glad_stats_impl_glGetTextureParameteriv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTextureParameteriv]++;
+	glad_stats_real_glGetTextureParameteriv(arg0, arg1, arg2);
+}
+static PFNGLGETTEXTURESAMPLERHANDLEARBPROC glad_stats_real_glGetTextureSamplerHandleARB = 0;
+static GLuint64 APIENTRY glad_stats_impl_glGetTextureSamplerHandleARB(GLuint arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTextureSamplerHandleARB]++;
+	return glad_stats_real_glGetTextureSamplerHandleARB(arg0, arg1);
+}
+static PFNGLGETTEXTURESUBIMAGEPROC glad_stats_real_glGetTextureSubImage = 0;
+static void APIENTRY glad_stats_impl_glGetTextureSubImage(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLenum arg9, GLsizei arg10, void * arg11) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTextureSubImage]++;
+	glad_stats_real_glGetTextureSubImage(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11);
+}
+static PFNGLGETTRANSFORMFEEDBACKVARYINGPROC glad_stats_real_glGetTransformFeedbackVarying = 0;
+static void APIENTRY glad_stats_impl_glGetTransformFeedbackVarying(GLuint arg0, GLuint arg1, GLsizei arg2, GLsizei * arg3, GLsizei * arg4, GLenum * arg5, GLchar * arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTransformFeedbackVarying]++;
+	glad_stats_real_glGetTransformFeedbackVarying(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLGETTRANSFORMFEEDBACKI64_VPROC glad_stats_real_glGetTransformFeedbacki64_v = 0;
+static void APIENTRY glad_stats_impl_glGetTransformFeedbacki64_v(GLuint arg0, GLenum arg1, GLuint arg2, GLint64 * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTransformFeedbacki64_v]++;
+	glad_stats_real_glGetTransformFeedbacki64_v(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETTRANSFORMFEEDBACKI_VPROC glad_stats_real_glGetTransformFeedbacki_v = 0;
+static void APIENTRY glad_stats_impl_glGetTransformFeedbacki_v(GLuint arg0, GLenum arg1, GLuint arg2, GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTransformFeedbacki_v]++;
+	glad_stats_real_glGetTransformFeedbacki_v(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETTRANSFORMFEEDBACKIVPROC glad_stats_real_glGetTransformFeedbackiv = 0;
+static void APIENTRY glad_stats_impl_glGetTransformFeedbackiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetTransformFeedbackiv]++;
+	glad_stats_real_glGetTransformFeedbackiv(arg0, arg1, arg2);
+}
+static PFNGLGETUNIFORMBLOCKINDEXPROC glad_stats_real_glGetUniformBlockIndex = 0;
+static GLuint APIENTRY glad_stats_impl_glGetUniformBlockIndex(GLuint arg0, const GLchar * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetUniformBlockIndex]++;
+	return glad_stats_real_glGetUniformBlockIndex(arg0, arg1);
+}
+static PFNGLGETUNIFORMINDICESPROC glad_stats_real_glGetUniformIndices = 0;
+static void APIENTRY glad_stats_impl_glGetUniformIndices(GLuint arg0, GLsizei arg1, const GLchar *const * arg2, GLuint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetUniformIndices]++;
+	glad_stats_real_glGetUniformIndices(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETUNIFORMLOCATIONPROC glad_stats_real_glGetUniformLocation = 0;
+static GLint APIENTRY glad_stats_impl_glGetUniformLocation(GLuint arg0, const GLchar * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetUniformLocation]++;
+	return glad_stats_real_glGetUniformLocation(arg0, arg1);
+}
+static PFNGLGETUNIFORMSUBROUTINEUIVPROC glad_stats_real_glGetUniformSubroutineuiv = 0;
+static void APIENTRY glad_stats_impl_glGetUniformSubroutineuiv(GLenum arg0, GLint arg1, GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetUniformSubroutineuiv]++;
+	glad_stats_real_glGetUniformSubroutineuiv(arg0, arg1, arg2);
+}
+static PFNGLGETUNIFORMDVPROC glad_stats_real_glGetUniformdv = 0;
+static void APIENTRY glad_stats_impl_glGetUniformdv(GLuint arg0, GLint arg1, GLdouble * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetUniformdv]++;
+	glad_stats_real_glGetUniformdv(arg0, arg1, arg2);
+}
+static PFNGLGETUNIFORMFVPROC glad_stats_real_glGetUniformfv = 0;
+static void APIENTRY glad_stats_impl_glGetUniformfv(GLuint arg0, GLint arg1, GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetUniformfv]++;
+	glad_stats_real_glGetUniformfv(arg0, arg1, arg2);
+}
+static PFNGLGETUNIFORMIVPROC glad_stats_real_glGetUniformiv = 0;
+static void APIENTRY glad_stats_impl_glGetUniformiv(GLuint arg0, GLint arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetUniformiv]++;
+	glad_stats_real_glGetUniformiv(arg0, arg1, arg2);
+}
+static PFNGLGETUNIFORMUIVPROC glad_stats_real_glGetUniformuiv = 0;
+static void APIENTRY glad_stats_impl_glGetUniformuiv(GLuint arg0, GLint arg1, GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetUniformuiv]++;
+	glad_stats_real_glGetUniformuiv(arg0, arg1, arg2);
+}
+static PFNGLGETVERTEXARRAYINDEXED64IVPROC glad_stats_real_glGetVertexArrayIndexed64iv = 0;
+static void APIENTRY glad_stats_impl_glGetVertexArrayIndexed64iv(GLuint arg0, GLuint arg1, GLenum arg2, GLint64 * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetVertexArrayIndexed64iv]++;
+	glad_stats_real_glGetVertexArrayIndexed64iv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETVERTEXARRAYINDEXEDIVPROC glad_stats_real_glGetVertexArrayIndexediv = 0;
+static void APIENTRY glad_stats_impl_glGetVertexArrayIndexediv(GLuint arg0, GLuint arg1, GLenum arg2, GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetVertexArrayIndexediv]++;
+	glad_stats_real_glGetVertexArrayIndexediv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETVERTEXARRAYIVPROC glad_stats_real_glGetVertexArrayiv = 0;
+static void APIENTRY glad_stats_impl_glGetVertexArrayiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetVertexArrayiv]++;
+	glad_stats_real_glGetVertexArrayiv(arg0, arg1, arg2);
+}
+static PFNGLGETVERTEXATTRIBIIVPROC glad_stats_real_glGetVertexAttribIiv = 0;
+static void APIENTRY glad_stats_impl_glGetVertexAttribIiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetVertexAttribIiv]++;
+	glad_stats_real_glGetVertexAttribIiv(arg0, arg1, arg2);
+}
+static PFNGLGETVERTEXATTRIBIUIVPROC glad_stats_real_glGetVertexAttribIuiv = 0;
+static void APIENTRY glad_stats_impl_glGetVertexAttribIuiv(GLuint arg0, GLenum arg1, GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetVertexAttribIuiv]++;
+	glad_stats_real_glGetVertexAttribIuiv(arg0, arg1, arg2);
+}
+static PFNGLGETVERTEXATTRIBLDVPROC glad_stats_real_glGetVertexAttribLdv = 0;
+static void APIENTRY glad_stats_impl_glGetVertexAttribLdv(GLuint arg0, GLenum arg1, GLdouble * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetVertexAttribLdv]++;
+	glad_stats_real_glGetVertexAttribLdv(arg0, arg1, arg2);
+}
+static PFNGLGETVERTEXATTRIBLUI64VARBPROC glad_stats_real_glGetVertexAttribLui64vARB = 0;
+static void APIENTRY glad_stats_impl_glGetVertexAttribLui64vARB(GLuint arg0, GLenum arg1, GLuint64EXT * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetVertexAttribLui64vARB]++;
+	glad_stats_real_glGetVertexAttribLui64vARB(arg0, arg1, arg2);
+}
+static PFNGLGETVERTEXATTRIBPOINTERVPROC glad_stats_real_glGetVertexAttribPointerv = 0;
+static void APIENTRY glad_stats_impl_glGetVertexAttribPointerv(GLuint arg0, GLenum arg1, void * * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetVertexAttribPointerv]++;
+	glad_stats_real_glGetVertexAttribPointerv(arg0, arg1, arg2);
+}
+static PFNGLGETVERTEXATTRIBDVPROC glad_stats_real_glGetVertexAttribdv = 0;
+static void APIENTRY glad_stats_impl_glGetVertexAttribdv(GLuint arg0, GLenum arg1, GLdouble * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetVertexAttribdv]++;
+	glad_stats_real_glGetVertexAttribdv(arg0, arg1, arg2);
+}
+static PFNGLGETVERTEXATTRIBFVPROC glad_stats_real_glGetVertexAttribfv = 0;
+static void APIENTRY glad_stats_impl_glGetVertexAttribfv(GLuint arg0, GLenum arg1, GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetVertexAttribfv]++;
+	glad_stats_real_glGetVertexAttribfv(arg0, arg1, arg2);
+}
+static PFNGLGETVERTEXATTRIBIVPROC glad_stats_real_glGetVertexAttribiv = 0;
+static void APIENTRY glad_stats_impl_glGetVertexAttribiv(GLuint arg0, GLenum arg1, GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetVertexAttribiv]++;
+	glad_stats_real_glGetVertexAttribiv(arg0, arg1, arg2);
+}
+static PFNGLGETNCOLORTABLEPROC glad_stats_real_glGetnColorTable = 0;
+static void APIENTRY glad_stats_impl_glGetnColorTable(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, void * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetnColorTable]++;
+	glad_stats_real_glGetnColorTable(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLGETNCOMPRESSEDTEXIMAGEPROC glad_stats_real_glGetnCompressedTexImage = 0;
+static void APIENTRY glad_stats_impl_glGetnCompressedTexImage(GLenum arg0, GLint arg1, GLsizei arg2, void * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetnCompressedTexImage]++;
+	glad_stats_real_glGetnCompressedTexImage(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETNCONVOLUTIONFILTERPROC glad_stats_real_glGetnConvolutionFilter = 0;
+static void APIENTRY glad_stats_impl_glGetnConvolutionFilter(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, void * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetnConvolutionFilter]++;
+	glad_stats_real_glGetnConvolutionFilter(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLGETNHISTOGRAMPROC glad_stats_real_glGetnHistogram = 0;
+static void APIENTRY glad_stats_impl_glGetnHistogram(GLenum arg0, GLboolean arg1, GLenum arg2, GLenum arg3, GLsizei arg4, void * arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetnHistogram]++;
+	glad_stats_real_glGetnHistogram(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLGETNMAPDVPROC glad_stats_real_glGetnMapdv = 0;
+static void APIENTRY glad_stats_impl_glGetnMapdv(GLenum arg0, GLenum arg1, GLsizei arg2, GLdouble * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetnMapdv]++;
+	glad_stats_real_glGetnMapdv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETNMAPFVPROC glad_stats_real_glGetnMapfv = 0;
+static void APIENTRY glad_stats_impl_glGetnMapfv(GLenum arg0, GLenum arg1, GLsizei arg2, GLfloat * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetnMapfv]++;
+	glad_stats_real_glGetnMapfv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETNMAPIVPROC glad_stats_real_glGetnMapiv = 0;
+static void APIENTRY glad_stats_impl_glGetnMapiv(GLenum arg0, GLenum arg1, GLsizei arg2, GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetnMapiv]++;
+	glad_stats_real_glGetnMapiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETNMINMAXPROC glad_stats_real_glGetnMinmax = 0;
+static void APIENTRY glad_stats_impl_glGetnMinmax(GLenum arg0, GLboolean arg1, GLenum arg2, GLenum arg3, GLsizei arg4, void * arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetnMinmax]++;
+	glad_stats_real_glGetnMinmax(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLGETNPIXELMAPFVPROC glad_stats_real_glGetnPixelMapfv = 0;
+static void APIENTRY glad_stats_impl_glGetnPixelMapfv(GLenum arg0, GLsizei arg1, GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetnPixelMapfv]++;
+	glad_stats_real_glGetnPixelMapfv(arg0, arg1, arg2);
+}
+static PFNGLGETNPIXELMAPUIVPROC glad_stats_real_glGetnPixelMapuiv = 0;
+static void APIENTRY glad_stats_impl_glGetnPixelMapuiv(GLenum arg0, GLsizei arg1, GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetnPixelMapuiv]++;
+	glad_stats_real_glGetnPixelMapuiv(arg0, arg1, arg2);
+}
+static PFNGLGETNPIXELMAPUSVPROC glad_stats_real_glGetnPixelMapusv = 0;
+static void APIENTRY glad_stats_impl_glGetnPixelMapusv(GLenum arg0, GLsizei arg1, GLushort * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetnPixelMapusv]++;
+	glad_stats_real_glGetnPixelMapusv(arg0, arg1, arg2);
+}
+static PFNGLGETNPOLYGONSTIPPLEPROC glad_stats_real_glGetnPolygonStipple = 0;
+static void APIENTRY glad_stats_impl_glGetnPolygonStipple(GLsizei arg0, GLubyte * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetnPolygonStipple]++;
+	glad_stats_real_glGetnPolygonStipple(arg0, arg1);
+}
+static PFNGLGETNSEPARABLEFILTERPROC glad_stats_real_glGetnSeparableFilter = 0;
+static void APIENTRY glad_stats_impl_glGetnSeparableFilter(GLenum arg0, GLenum arg1, GLenum arg2, GLsizei arg3, void * arg4, GLsizei arg5, void * arg6, void * arg7) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetnSeparableFilter]++;
+	glad_stats_real_glGetnSeparableFilter(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static PFNGLGETNTEXIMAGEPROC glad_stats_real_glGetnTexImage = 0;
+static void APIENTRY glad_stats_impl_glGetnTexImage(GLenum arg0, GLint arg1, GLenum arg2, GLenum arg3, GLsizei arg4, void * arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetnTexImage]++;
+	glad_stats_real_glGetnTexImage(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLGETNUNIFORMDVPROC glad_stats_real_glGetnUniformdv = 0;
+static void APIENTRY glad_stats_impl_glGetnUniformdv(GLuint arg0, GLint arg1, GLsizei arg2, GLdouble * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetnUniformdv]++;
+	glad_stats_real_glGetnUniformdv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETNUNIFORMFVPROC glad_stats_real_glGetnUniformfv = 0;
+static void APIENTRY glad_stats_impl_glGetnUniformfv(GLuint arg0, GLint arg1, GLsizei arg2, GLfloat * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetnUniformfv]++;
+	glad_stats_real_glGetnUniformfv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETNUNIFORMIVPROC glad_stats_real_glGetnUniformiv = 0;
+static void APIENTRY glad_stats_impl_glGetnUniformiv(GLuint arg0, GLint arg1, GLsizei arg2, GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetnUniformiv]++;
+	glad_stats_real_glGetnUniformiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLGETNUNIFORMUIVPROC glad_stats_real_glGetnUniformuiv = 0;
+static void APIENTRY glad_stats_impl_glGetnUniformuiv(GLuint arg0, GLint arg1, GLsizei arg2, GLuint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glGetnUniformuiv]++;
+	glad_stats_real_glGetnUniformuiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLHINTPROC glad_stats_real_glHint = 0;
+static void APIENTRY glad_stats_impl_glHint(GLenum arg0, GLenum arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glHint]++;
+	glad_stats_real_glHint(arg0, arg1);
+}
+static PFNGLINDEXMASKPROC glad_stats_real_glIndexMask = 0;
+static void APIENTRY glad_stats_impl_glIndexMask(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIndexMask]++;
+	glad_stats_real_glIndexMask(arg0);
+}
+static PFNGLINDEXPOINTERPROC glad_stats_real_glIndexPointer = 0;
+static void APIENTRY glad_stats_impl_glIndexPointer(GLenum arg0, GLsizei arg1, const void * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIndexPointer]++;
+	glad_stats_real_glIndexPointer(arg0, arg1, arg2);
+}
+static PFNGLINDEXDPROC glad_stats_real_glIndexd = 0;
+static void APIENTRY glad_stats_impl_glIndexd(GLdouble arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIndexd]++;
+	glad_stats_real_glIndexd(arg0);
+}
+static PFNGLINDEXDVPROC glad_stats_real_glIndexdv = 0;
+static void APIENTRY glad_stats_impl_glIndexdv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIndexdv]++;
+	glad_stats_real_glIndexdv(arg0);
+}
+static PFNGLINDEXFPROC glad_stats_real_glIndexf = 0;
+static void APIENTRY glad_stats_impl_glIndexf(GLfloat arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIndexf]++;
+	glad_stats_real_glIndexf(arg0);
+}
+static PFNGLINDEXFVPROC glad_stats_real_glIndexfv = 0;
+static void APIENTRY glad_stats_impl_glIndexfv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIndexfv]++;
+	glad_stats_real_glIndexfv(arg0);
+}
+static PFNGLINDEXIPROC glad_stats_real_glIndexi = 0;
+static void APIENTRY glad_stats_impl_glIndexi(GLint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIndexi]++;
+	glad_stats_real_glIndexi(arg0);
+}
+static PFNGLINDEXIVPROC glad_stats_real_glIndexiv = 0;
+static void APIENTRY glad_stats_impl_glIndexiv(const GLint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIndexiv]++;
+	glad_stats_real_glIndexiv(arg0);
+}
+static PFNGLINDEXSPROC glad_stats_real_glIndexs = 0;
+static void APIENTRY glad_stats_impl_glIndexs(GLshort arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIndexs]++;
+	glad_stats_real_glIndexs(arg0);
+}
+static PFNGLINDEXSVPROC glad_stats_real_glIndexsv = 0;
+static void APIENTRY glad_stats_impl_glIndexsv(const GLshort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIndexsv]++;
+	glad_stats_real_glIndexsv(arg0);
+}
+static PFNGLINDEXUBPROC glad_stats_real_glIndexub = 0;
+static void APIENTRY glad_stats_impl_glIndexub(GLubyte arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIndexub]++;
+	glad_stats_real_glIndexub(arg0);
+}
+static PFNGLINDEXUBVPROC glad_stats_real_glIndexubv = 0;
+static void APIENTRY glad_stats_impl_glIndexubv(const GLubyte * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIndexubv]++;
+	glad_stats_real_glIndexubv(arg0);
+}
+static PFNGLINITNAMESPROC glad_stats_real_glInitNames = 0;
+static void APIENTRY glad_stats_impl_glInitNames(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glInitNames]++;
+	glad_stats_real_glInitNames();
+}
+static PFNGLINTERLEAVEDARRAYSPROC glad_stats_real_glInterleavedArrays = 0;
+static void APIENTRY glad_stats_impl_glInterleavedArrays(GLenum arg0, GLsizei arg1, const void * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glInterleavedArrays]++;
+	glad_stats_real_glInterleavedArrays(arg0, arg1, arg2);
+}
+static PFNGLINVALIDATEBUFFERDATAPROC glad_stats_real_glInvalidateBufferData = 0;
+static void APIENTRY glad_stats_impl_glInvalidateBufferData(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glInvalidateBufferData]++;
+	glad_stats_real_glInvalidateBufferData(arg0);
+}
+static PFNGLINVALIDATEBUFFERSUBDATAPROC glad_stats_real_glInvalidateBufferSubData = 0;
+static void APIENTRY glad_stats_impl_glInvalidateBufferSubData(GLuint arg0, GLintptr arg1, GLsizeiptr arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glInvalidateBufferSubData]++;
+	glad_stats_real_glInvalidateBufferSubData(arg0, arg1, arg2);
+}
+static PFNGLINVALIDATEFRAMEBUFFERPROC glad_stats_real_glInvalidateFramebuffer = 0;
+static void APIENTRY glad_stats_impl_glInvalidateFramebuffer(GLenum arg0, GLsizei arg1, const GLenum * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glInvalidateFramebuffer]++;
+	glad_stats_real_glInvalidateFramebuffer(arg0, arg1, arg2);
+}
+static PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC glad_stats_real_glInvalidateNamedFramebufferData = 0;
+static void APIENTRY glad_stats_impl_glInvalidateNamedFramebufferData(GLuint arg0, GLsizei arg1, const GLenum * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glInvalidateNamedFramebufferData]++;
+	glad_stats_real_glInvalidateNamedFramebufferData(arg0, arg1, arg2);
+}
+static PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC glad_stats_real_glInvalidateNamedFramebufferSubData = 0;
+static void APIENTRY glad_stats_impl_glInvalidateNamedFramebufferSubData(GLuint arg0, GLsizei arg1, const GLenum * arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glInvalidateNamedFramebufferSubData]++;
+	glad_stats_real_glInvalidateNamedFramebufferSubData(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLINVALIDATESUBFRAMEBUFFERPROC glad_stats_real_glInvalidateSubFramebuffer = 0;
+static void APIENTRY glad_stats_impl_glInvalidateSubFramebuffer(GLenum arg0, GLsizei arg1, const GLenum * arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glInvalidateSubFramebuffer]++;
+	glad_stats_real_glInvalidateSubFramebuffer(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLINVALIDATETEXIMAGEPROC glad_stats_real_glInvalidateTexImage = 0;
+static void APIENTRY glad_stats_impl_glInvalidateTexImage(GLuint arg0, GLint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glInvalidateTexImage]++;
+	glad_stats_real_glInvalidateTexImage(arg0, arg1);
+}
+static PFNGLINVALIDATETEXSUBIMAGEPROC glad_stats_real_glInvalidateTexSubImage = 0;
+static void APIENTRY glad_stats_impl_glInvalidateTexSubImage(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glInvalidateTexSubImage]++;
+	glad_stats_real_glInvalidateTexSubImage(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static PFNGLISBUFFERPROC glad_stats_real_glIsBuffer = 0;
+static GLboolean APIENTRY glad_stats_impl_glIsBuffer(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIsBuffer]++;
+	return glad_stats_real_glIsBuffer(arg0);
+}
+static PFNGLISENABLEDPROC glad_stats_real_glIsEnabled = 0;
+static GLboolean APIENTRY glad_stats_impl_glIsEnabled(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIsEnabled]++;
+	return glad_stats_real_glIsEnabled(arg0);
+}
+static PFNGLISENABLEDIPROC glad_stats_real_glIsEnabledi = 0;
+static GLboolean APIENTRY glad_stats_impl_glIsEnabledi(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIsEnabledi]++;
+	return glad_stats_real_glIsEnabledi(arg0, arg1);
+}
+static PFNGLISFRAMEBUFFERPROC glad_stats_real_glIsFramebuffer = 0;
+static GLboolean APIENTRY glad_stats_impl_glIsFramebuffer(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIsFramebuffer]++;
+	return glad_stats_real_glIsFramebuffer(arg0);
+}
+static PFNGLISIMAGEHANDLERESIDENTARBPROC glad_stats_real_glIsImageHandleResidentARB = 0;
+static GLboolean APIENTRY glad_stats_impl_glIsImageHandleResidentARB(GLuint64 arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIsImageHandleResidentARB]++;
+	return glad_stats_real_glIsImageHandleResidentARB(arg0);
+}
+static PFNGLISLISTPROC glad_stats_real_glIsList = 0;
+static GLboolean APIENTRY glad_stats_impl_glIsList(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIsList]++;
+	return glad_stats_real_glIsList(arg0);
+}
+static PFNGLISPROGRAMPROC glad_stats_real_glIsProgram = 0;
+static GLboolean APIENTRY glad_stats_impl_glIsProgram(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIsProgram]++;
+	return glad_stats_real_glIsProgram(arg0);
+}
+static PFNGLISPROGRAMPIPELINEPROC glad_stats_real_glIsProgramPipeline = 0;
+static GLboolean APIENTRY glad_stats_impl_glIsProgramPipeline(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIsProgramPipeline]++;
+	return glad_stats_real_glIsProgramPipeline(arg0);
+}
+static PFNGLISQUERYPROC glad_stats_real_glIsQuery = 0;
+static GLboolean APIENTRY glad_stats_impl_glIsQuery(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIsQuery]++;
+	return glad_stats_real_glIsQuery(arg0);
+}
+static PFNGLISRENDERBUFFERPROC glad_stats_real_glIsRenderbuffer = 0;
+static GLboolean APIENTRY glad_stats_impl_glIsRenderbuffer(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIsRenderbuffer]++;
+	return glad_stats_real_glIsRenderbuffer(arg0);
+}
+static PFNGLISSAMPLERPROC glad_stats_real_glIsSampler = 0;
+static GLboolean APIENTRY glad_stats_impl_glIsSampler(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIsSampler]++;
+	return glad_stats_real_glIsSampler(arg0);
+}
+static PFNGLISSHADERPROC glad_stats_real_glIsShader = 0;
+static GLboolean APIENTRY glad_stats_impl_glIsShader(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIsShader]++;
+	return glad_stats_real_glIsShader(arg0);
+}
+static PFNGLISSYNCPROC glad_stats_real_glIsSync = 0;
+static GLboolean APIENTRY glad_stats_impl_glIsSync(GLsync arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIsSync]++;
+	return glad_stats_real_glIsSync(arg0);
+}
+static PFNGLISTEXTUREPROC glad_stats_real_glIsTexture = 0;
+static GLboolean APIENTRY glad_stats_impl_glIsTexture(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIsTexture]++;
+	return glad_stats_real_glIsTexture(arg0);
+}
+static PFNGLISTEXTUREHANDLERESIDENTARBPROC glad_stats_real_glIsTextureHandleResidentARB = 0;
+static GLboolean APIENTRY glad_stats_impl_glIsTextureHandleResidentARB(GLuint64 arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIsTextureHandleResidentARB]++;
+	return glad_stats_real_glIsTextureHandleResidentARB(arg0);
+}
+static PFNGLISTRANSFORMFEEDBACKPROC glad_stats_real_glIsTransformFeedback = 0;
+static GLboolean APIENTRY glad_stats_impl_glIsTransformFeedback(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIsTransformFeedback]++;
+	return glad_stats_real_glIsTransformFeedback(arg0);
+}
+static PFNGLISVERTEXARRAYPROC glad_stats_real_glIsVertexArray = 0;
+static GLboolean APIENTRY glad_stats_impl_glIsVertexArray(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glIsVertexArray]++;
+	return glad_stats_real_glIsVertexArray(arg0);
+}
+static PFNGLLIGHTMODELFPROC glad_stats_real_glLightModelf = 0;
+static void APIENTRY glad_stats_impl_glLightModelf(GLenum arg0, GLfloat arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glLightModelf]++;
+	glad_stats_real_glLightModelf(arg0, arg1);
+}
+static PFNGLLIGHTMODELFVPROC glad_stats_real_glLightModelfv = 0;
+static void APIENTRY glad_stats_impl_glLightModelfv(GLenum arg0, const GLfloat * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glLightModelfv]++;
+	glad_stats_real_glLightModelfv(arg0, arg1);
+}
+static PFNGLLIGHTMODELIPROC glad_stats_real_glLightModeli = 0;
+static void APIENTRY glad_stats_impl_glLightModeli(GLenum arg0, GLint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glLightModeli]++;
+	glad_stats_real_glLightModeli(arg0, arg1);
+}
+static PFNGLLIGHTMODELIVPROC glad_stats_real_glLightModeliv = 0;
+static void APIENTRY glad_stats_impl_glLightModeliv(GLenum arg0, const GLint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glLightModeliv]++;
+	glad_stats_real_glLightModeliv(arg0, arg1);
+}
+static PFNGLLIGHTFPROC glad_stats_real_glLightf = 0;
+static void APIENTRY glad_stats_impl_glLightf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glLightf]++;
+	glad_stats_real_glLightf(arg0, arg1, arg2);
+}
+static PFNGLLIGHTFVPROC glad_stats_real_glLightfv = 0;
+static void APIENTRY glad_stats_impl_glLightfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glLightfv]++;
+	glad_stats_real_glLightfv(arg0, arg1, arg2);
+}
+static PFNGLLIGHTIPROC glad_stats_real_glLighti = 0;
+static void APIENTRY glad_stats_impl_glLighti(GLenum arg0, GLenum arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glLighti]++;
+	glad_stats_real_glLighti(arg0, arg1, arg2);
+}
+static PFNGLLIGHTIVPROC glad_stats_real_glLightiv = 0;
+static void APIENTRY glad_stats_impl_glLightiv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glLightiv]++;
+	glad_stats_real_glLightiv(arg0, arg1, arg2);
+}
+static PFNGLLINESTIPPLEPROC glad_stats_real_glLineStipple = 0;
+static void APIENTRY glad_stats_impl_glLineStipple(GLint arg0, GLushort arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glLineStipple]++;
+	glad_stats_real_glLineStipple(arg0, arg1);
+}
+static PFNGLLINEWIDTHPROC glad_stats_real_glLineWidth = 0;
+static void APIENTRY glad_stats_impl_glLineWidth(GLfloat arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glLineWidth]++;
+	glad_stats_real_glLineWidth(arg0);
+}
+static PFNGLLINKPROGRAMPROC glad_stats_real_glLinkProgram = 0;
+static void APIENTRY glad_stats_impl_glLinkProgram(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glLinkProgram]++;
+	glad_stats_real_glLinkProgram(arg0);
+}
+static PFNGLLISTBASEPROC glad_stats_real_glListBase = 0;
+static void APIENTRY glad_stats_impl_glListBase(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glListBase]++;
+	glad_stats_real_glListBase(arg0);
+}
+static PFNGLLOADIDENTITYPROC glad_stats_real_glLoadIdentity = 0;
+static void APIENTRY glad_stats_impl_glLoadIdentity(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glLoadIdentity]++;
+	glad_stats_real_glLoadIdentity();
+}
+static PFNGLLOADMATRIXDPROC glad_stats_real_glLoadMatrixd = 0;
+static void APIENTRY glad_stats_impl_glLoadMatrixd(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glLoadMatrixd]++;
+	glad_stats_real_glLoadMatrixd(arg0);
+}
+static PFNGLLOADMATRIXFPROC glad_stats_real_glLoadMatrixf = 0;
+static void APIENTRY glad_stats_impl_glLoadMatrixf(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glLoadMatrixf]++;
+	glad_stats_real_glLoadMatrixf(arg0);
+}
+static PFNGLLOADNAMEPROC glad_stats_real_glLoadName = 0;
+static void APIENTRY glad_stats_impl_glLoadName(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glLoadName]++;
+	glad_stats_real_glLoadName(arg0);
+}
+static PFNGLLOADTRANSPOSEMATRIXDPROC glad_stats_real_glLoadTransposeMatrixd = 0;
+static void APIENTRY glad_stats_impl_glLoadTransposeMatrixd(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glLoadTransposeMatrixd]++;
+	glad_stats_real_glLoadTransposeMatrixd(arg0);
+}
+static PFNGLLOADTRANSPOSEMATRIXFPROC glad_stats_real_glLoadTransposeMatrixf = 0;
+static void APIENTRY glad_stats_impl_glLoadTransposeMatrixf(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glLoadTransposeMatrixf]++;
+	glad_stats_real_glLoadTransposeMatrixf(arg0);
+}
+static PFNGLLOGICOPPROC glad_stats_real_glLogicOp = 0;
+static void APIENTRY glad_stats_impl_glLogicOp(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glLogicOp]++;
+	glad_stats_real_glLogicOp(arg0);
+}
+static PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC glad_stats_real_glMakeImageHandleNonResidentARB = 0;
+static void APIENTRY glad_stats_impl_glMakeImageHandleNonResidentARB(GLuint64 arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMakeImageHandleNonResidentARB]++;
+	glad_stats_real_glMakeImageHandleNonResidentARB(arg0);
+}
+static PFNGLMAKEIMAGEHANDLERESIDENTARBPROC glad_stats_real_glMakeImageHandleResidentARB = 0;
+static void APIENTRY glad_stats_impl_glMakeImageHandleResidentARB(GLuint64 arg0, GLenum arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMakeImageHandleResidentARB]++;
+	glad_stats_real_glMakeImageHandleResidentARB(arg0, arg1);
+}
+static PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC glad_stats_real_glMakeTextureHandleNonResidentARB = 0;
+static void APIENTRY glad_stats_impl_glMakeTextureHandleNonResidentARB(GLuint64 arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMakeTextureHandleNonResidentARB]++;
+	glad_stats_real_glMakeTextureHandleNonResidentARB(arg0);
+}
+static PFNGLMAKETEXTUREHANDLERESIDENTARBPROC glad_stats_real_glMakeTextureHandleResidentARB = 0;
+static void APIENTRY glad_stats_impl_glMakeTextureHandleResidentARB(GLuint64 arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMakeTextureHandleResidentARB]++;
+	glad_stats_real_glMakeTextureHandleResidentARB(arg0);
+}
+static PFNGLMAP1DPROC glad_stats_real_glMap1d = 0;
+static void APIENTRY glad_stats_impl_glMap1d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLint arg3, GLint arg4, const GLdouble * arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMap1d]++;
+	glad_stats_real_glMap1d(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLMAP1FPROC glad_stats_real_glMap1f = 0;
+static void APIENTRY glad_stats_impl_glMap1f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLint arg3, GLint arg4, const GLfloat * arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMap1f]++;
+	glad_stats_real_glMap1f(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLMAP2DPROC glad_stats_real_glMap2d = 0;
+static void APIENTRY glad_stats_impl_glMap2d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLint arg3, GLint arg4, GLdouble arg5, GLdouble arg6, GLint arg7, GLint arg8, const GLdouble * arg9) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMap2d]++;
+	glad_stats_real_glMap2d(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+static PFNGLMAP2FPROC glad_stats_real_glMap2f = 0;
+static void APIENTRY glad_stats_impl_glMap2f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLint arg3, GLint arg4, GLfloat arg5, GLfloat arg6, GLint arg7, GLint arg8, const GLfloat * arg9) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMap2f]++;
+	glad_stats_real_glMap2f(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+static PFNGLMAPBUFFERPROC glad_stats_real_glMapBuffer = 0;
+static void * APIENTRY glad_stats_impl_glMapBuffer(GLenum arg0, GLenum arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMapBuffer]++;
+	return glad_stats_real_glMapBuffer(arg0, arg1);
+}
+static PFNGLMAPBUFFERRANGEPROC glad_stats_real_glMapBufferRange = 0;
+static void * APIENTRY glad_stats_impl_glMapBufferRange(GLenum arg0, GLintptr arg1, GLsizeiptr arg2, GLbitfield arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMapBufferRange]++;
+	if (arg3 & GL_MAP_WRITE_BIT) c->mappedBytes += (unsigned long long)arg2;
+	return glad_stats_real_glMapBufferRange(arg0, arg1, arg2, arg3);
+}
+static PFNGLMAPGRID1DPROC glad_stats_real_glMapGrid1d = 0;
+static void APIENTRY glad_stats_impl_glMapGrid1d(GLint arg0, GLdouble arg1, GLdouble arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMapGrid1d]++;
+	glad_stats_real_glMapGrid1d(arg0, arg1, arg2);
+}
+static PFNGLMAPGRID1FPROC glad_stats_real_glMapGrid1f = 0;
+static void APIENTRY glad_stats_impl_glMapGrid1f(GLint arg0, GLfloat arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMapGrid1f]++;
+	glad_stats_real_glMapGrid1f(arg0, arg1, arg2);
+}
+static PFNGLMAPGRID2DPROC glad_stats_real_glMapGrid2d = 0;
+static void APIENTRY glad_stats_impl_glMapGrid2d(GLint arg0, GLdouble arg1, GLdouble arg2, GLint arg3, GLdouble arg4, GLdouble arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMapGrid2d]++;
+	glad_stats_real_glMapGrid2d(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLMAPGRID2FPROC glad_stats_real_glMapGrid2f = 0;
+static void APIENTRY glad_stats_impl_glMapGrid2f(GLint arg0, GLfloat arg1, GLfloat arg2, GLint arg3, GLfloat arg4, GLfloat arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMapGrid2f]++;
+	glad_stats_real_glMapGrid2f(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLMAPNAMEDBUFFERPROC glad_stats_real_glMapNamedBuffer = 0;
+static void * APIENTRY glad_stats_impl_glMapNamedBuffer(GLuint arg0, GLenum arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMapNamedBuffer]++;
+	return glad_stats_real_glMapNamedBuffer(arg0, arg1);
+}
+static PFNGLMAPNAMEDBUFFERRANGEPROC glad_stats_real_glMapNamedBufferRange = 0;
+static void * APIENTRY glad_stats_impl_glMapNamedBufferRange(GLuint arg0, GLintptr arg1, GLsizeiptr arg2, GLbitfield arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMapNamedBufferRange]++;
+	if (arg3 & GL_MAP_WRITE_BIT) c->mappedBytes += (unsigned long long)arg2;
+	return glad_stats_real_glMapNamedBufferRange(arg0, arg1, arg2, arg3);
+}
+static PFNGLMATERIALFPROC glad_stats_real_glMaterialf = 0;
+static void APIENTRY glad_stats_impl_glMaterialf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMaterialf]++;
+	glad_stats_real_glMaterialf(arg0, arg1, arg2);
+}
+static PFNGLMATERIALFVPROC glad_stats_real_glMaterialfv = 0;
+static void APIENTRY glad_stats_impl_glMaterialfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMaterialfv]++;
+	glad_stats_real_glMaterialfv(arg0, arg1, arg2);
+}
+static PFNGLMATERIALIPROC glad_stats_real_glMateriali = 0;
+static void APIENTRY glad_stats_impl_glMateriali(GLenum arg0, GLenum arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMateriali]++;
+	glad_stats_real_glMateriali(arg0, arg1, arg2);
+}
+static PFNGLMATERIALIVPROC glad_stats_real_glMaterialiv = 0;
+static void APIENTRY glad_stats_impl_glMaterialiv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMaterialiv]++;
+	glad_stats_real_glMaterialiv(arg0, arg1, arg2);
+}
+static PFNGLMATRIXMODEPROC glad_stats_real_glMatrixMode = 0;
+static void APIENTRY glad_stats_impl_glMatrixMode(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMatrixMode]++;
+	glad_stats_real_glMatrixMode(arg0);
+}
+static PFNGLMAXSHADERCOMPILERTHREADSKHRPROC glad_stats_real_glMaxShaderCompilerThreadsKHR = 0;
+static void APIENTRY glad_stats_impl_glMaxShaderCompilerThreadsKHR(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMaxShaderCompilerThreadsKHR]++;
+	glad_stats_real_glMaxShaderCompilerThreadsKHR(arg0);
+}
+static PFNGLMEMORYBARRIERPROC glad_stats_real_glMemoryBarrier = 0;
+static void APIENTRY glad_stats_impl_glMemoryBarrier(GLbitfield arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMemoryBarrier]++;
+	glad_stats_real_glMemoryBarrier(arg0);
+}
+static PFNGLMEMORYBARRIERBYREGIONPROC glad_stats_real_glMemoryBarrierByRegion = 0;
+static void APIENTRY glad_stats_impl_glMemoryBarrierByRegion(GLbitfield arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMemoryBarrierByRegion]++;
+	glad_stats_real_glMemoryBarrierByRegion(arg0);
+}
+static PFNGLMINSAMPLESHADINGPROC glad_stats_real_glMinSampleShading = 0;
+static void APIENTRY glad_stats_impl_glMinSampleShading(GLfloat arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMinSampleShading]++;
+	glad_stats_real_glMinSampleShading(arg0);
+}
+static PFNGLMULTMATRIXDPROC glad_stats_real_glMultMatrixd = 0;
+static void APIENTRY glad_stats_impl_glMultMatrixd(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultMatrixd]++;
+	glad_stats_real_glMultMatrixd(arg0);
+}
+static PFNGLMULTMATRIXFPROC glad_stats_real_glMultMatrixf = 0;
+static void APIENTRY glad_stats_impl_glMultMatrixf(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultMatrixf]++;
+	glad_stats_real_glMultMatrixf(arg0);
+}
+static PFNGLMULTTRANSPOSEMATRIXDPROC glad_stats_real_glMultTransposeMatrixd = 0;
+static void APIENTRY glad_stats_impl_glMultTransposeMatrixd(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultTransposeMatrixd]++;
+	glad_stats_real_glMultTransposeMatrixd(arg0);
+}
+static PFNGLMULTTRANSPOSEMATRIXFPROC glad_stats_real_glMultTransposeMatrixf = 0;
+static void APIENTRY glad_stats_impl_glMultTransposeMatrixf(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultTransposeMatrixf]++;
+	glad_stats_real_glMultTransposeMatrixf(arg0);
+}
+static PFNGLMULTIDRAWARRAYSPROC glad_stats_real_glMultiDrawArrays = 0;
+static void APIENTRY glad_stats_impl_glMultiDrawArrays(GLenum arg0, const GLint * arg1, const GLsizei * arg2, GLsizei arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiDrawArrays]++;
+	c->draws += (unsigned long long)arg3;
+	{ GLsizei i; for (i = 0; i < arg3; i++) c->vertices += (unsigned long long)arg2[i]; }
+	glad_stats_real_glMultiDrawArrays(arg0, arg1, arg2, arg3);
+}
+static PFNGLMULTIDRAWARRAYSINDIRECTPROC glad_stats_real_glMultiDrawArraysIndirect = 0;
+static void APIENTRY glad_stats_impl_glMultiDrawArraysIndirect(GLenum arg0, const void * arg1, GLsizei arg2, GLsizei arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiDrawArraysIndirect]++;
+	c->draws += (unsigned long long)arg2;
+	glad_stats_real_glMultiDrawArraysIndirect(arg0, arg1, arg2, arg3);
+}
+static PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC glad_stats_real_glMultiDrawArraysIndirectCount = 0;
+static void APIENTRY glad_stats_impl_glMultiDrawArraysIndirectCount(GLenum arg0, const void * arg1, GLintptr arg2, GLsizei arg3, GLsizei arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiDrawArraysIndirectCount]++;
+	c->draws++;
+	glad_stats_real_glMultiDrawArraysIndirectCount(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLMULTIDRAWELEMENTSPROC glad_stats_real_glMultiDrawElements = 0;
+static void APIENTRY glad_stats_impl_glMultiDrawElements(GLenum arg0, const GLsizei * arg1, GLenum arg2, const void *const * arg3, GLsizei arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiDrawElements]++;
+	c->draws += (unsigned long long)arg4;
+	{ GLsizei i; for (i = 0; i < arg4; i++) c->vertices += (unsigned long long)arg1[i]; }
+	glad_stats_real_glMultiDrawElements(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC glad_stats_real_glMultiDrawElementsBaseVertex = 0;
+static void APIENTRY glad_stats_impl_glMultiDrawElementsBaseVertex(GLenum arg0, const GLsizei * arg1, GLenum arg2, const void *const * arg3, GLsizei arg4, const GLint * arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiDrawElementsBaseVertex]++;
+	c->draws += (unsigned long long)arg4;
+	{ GLsizei i; for (i = 0; i < arg4; i++) c->vertices += (unsigned long long)arg1[i]; }
+	glad_stats_real_glMultiDrawElementsBaseVertex(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLMULTIDRAWELEMENTSINDIRECTPROC glad_stats_real_glMultiDrawElementsIndirect = 0;
+static void APIENTRY glad_stats_impl_glMultiDrawElementsIndirect(GLenum arg0, GLenum arg1, const void * arg2, GLsizei arg3, GLsizei arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiDrawElementsIndirect]++;
+	c->draws += (unsigned long long)arg3;
+	glad_stats_real_glMultiDrawElementsIndirect(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC glad_stats_real_glMultiDrawElementsIndirectCount = 0;
+static void APIENTRY glad_stats_impl_glMultiDrawElementsIndirectCount(GLenum arg0, GLenum arg1, const void * arg2, GLintptr arg3, GLsizei arg4, GLsizei arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiDrawElementsIndirectCount]++;
+	c->draws++;
+	glad_stats_real_glMultiDrawElementsIndirectCount(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLMULTITEXCOORD1DPROC glad_stats_real_glMultiTexCoord1d = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord1d(GLenum arg0, GLdouble arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord1d]++;
+	glad_stats_real_glMultiTexCoord1d(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD1DVPROC glad_stats_real_glMultiTexCoord1dv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord1dv(GLenum arg0, const GLdouble * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord1dv]++;
+	glad_stats_real_glMultiTexCoord1dv(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD1FPROC glad_stats_real_glMultiTexCoord1f = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord1f(GLenum arg0, GLfloat arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord1f]++;
+	glad_stats_real_glMultiTexCoord1f(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD1FVPROC glad_stats_real_glMultiTexCoord1fv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord1fv(GLenum arg0, const GLfloat * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord1fv]++;
+	glad_stats_real_glMultiTexCoord1fv(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD1IPROC glad_stats_real_glMultiTexCoord1i = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord1i(GLenum arg0, GLint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord1i]++;
+	glad_stats_real_glMultiTexCoord1i(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD1IVPROC glad_stats_real_glMultiTexCoord1iv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord1iv(GLenum arg0, const GLint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord1iv]++;
+	glad_stats_real_glMultiTexCoord1iv(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD1SPROC glad_stats_real_glMultiTexCoord1s = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord1s(GLenum arg0, GLshort arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord1s]++;
+	glad_stats_real_glMultiTexCoord1s(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD1SVPROC glad_stats_real_glMultiTexCoord1sv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord1sv(GLenum arg0, const GLshort * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord1sv]++;
+	glad_stats_real_glMultiTexCoord1sv(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD2DPROC glad_stats_real_glMultiTexCoord2d = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord2d(GLenum arg0, GLdouble arg1, GLdouble arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord2d]++;
+	glad_stats_real_glMultiTexCoord2d(arg0, arg1, arg2);
+}
+static PFNGLMULTITEXCOORD2DVPROC glad_stats_real_glMultiTexCoord2dv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord2dv(GLenum arg0, const GLdouble * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord2dv]++;
+	glad_stats_real_glMultiTexCoord2dv(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD2FPROC glad_stats_real_glMultiTexCoord2f = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord2f(GLenum arg0, GLfloat arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord2f]++;
+	glad_stats_real_glMultiTexCoord2f(arg0, arg1, arg2);
+}
+static PFNGLMULTITEXCOORD2FVPROC glad_stats_real_glMultiTexCoord2fv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord2fv(GLenum arg0, const GLfloat * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord2fv]++;
+	glad_stats_real_glMultiTexCoord2fv(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD2IPROC glad_stats_real_glMultiTexCoord2i = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord2i(GLenum arg0, GLint arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord2i]++;
+	glad_stats_real_glMultiTexCoord2i(arg0, arg1, arg2);
+}
+static PFNGLMULTITEXCOORD2IVPROC glad_stats_real_glMultiTexCoord2iv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord2iv(GLenum arg0, const GLint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord2iv]++;
+	glad_stats_real_glMultiTexCoord2iv(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD2SPROC glad_stats_real_glMultiTexCoord2s = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord2s(GLenum arg0, GLshort arg1, GLshort arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord2s]++;
+	glad_stats_real_glMultiTexCoord2s(arg0, arg1, arg2);
+}
+static PFNGLMULTITEXCOORD2SVPROC glad_stats_real_glMultiTexCoord2sv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord2sv(GLenum arg0, const GLshort * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord2sv]++;
+	glad_stats_real_glMultiTexCoord2sv(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD3DPROC glad_stats_real_glMultiTexCoord3d = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord3d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord3d]++;
+	glad_stats_real_glMultiTexCoord3d(arg0, arg1, arg2, arg3);
+}
+static PFNGLMULTITEXCOORD3DVPROC glad_stats_real_glMultiTexCoord3dv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord3dv(GLenum arg0, const GLdouble * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord3dv]++;
+	glad_stats_real_glMultiTexCoord3dv(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD3FPROC glad_stats_real_glMultiTexCoord3f = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord3f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord3f]++;
+	glad_stats_real_glMultiTexCoord3f(arg0, arg1, arg2, arg3);
+}
+static PFNGLMULTITEXCOORD3FVPROC glad_stats_real_glMultiTexCoord3fv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord3fv(GLenum arg0, const GLfloat * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord3fv]++;
+	glad_stats_real_glMultiTexCoord3fv(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD3IPROC glad_stats_real_glMultiTexCoord3i = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord3i(GLenum arg0, GLint arg1, GLint arg2, GLint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord3i]++;
+	glad_stats_real_glMultiTexCoord3i(arg0, arg1, arg2, arg3);
+}
+static PFNGLMULTITEXCOORD3IVPROC glad_stats_real_glMultiTexCoord3iv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord3iv(GLenum arg0, const GLint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord3iv]++;
+	glad_stats_real_glMultiTexCoord3iv(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD3SPROC glad_stats_real_glMultiTexCoord3s = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord3s(GLenum arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord3s]++;
+	glad_stats_real_glMultiTexCoord3s(arg0, arg1, arg2, arg3);
+}
+static PFNGLMULTITEXCOORD3SVPROC glad_stats_real_glMultiTexCoord3sv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord3sv(GLenum arg0, const GLshort * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord3sv]++;
+	glad_stats_real_glMultiTexCoord3sv(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD4DPROC glad_stats_real_glMultiTexCoord4d = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord4d(GLenum arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord4d]++;
+	glad_stats_real_glMultiTexCoord4d(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLMULTITEXCOORD4DVPROC glad_stats_real_glMultiTexCoord4dv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord4dv(GLenum arg0, const GLdouble * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord4dv]++;
+	glad_stats_real_glMultiTexCoord4dv(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD4FPROC glad_stats_real_glMultiTexCoord4f = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord4f(GLenum arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord4f]++;
+	glad_stats_real_glMultiTexCoord4f(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLMULTITEXCOORD4FVPROC glad_stats_real_glMultiTexCoord4fv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord4fv(GLenum arg0, const GLfloat * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord4fv]++;
+	glad_stats_real_glMultiTexCoord4fv(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD4IPROC glad_stats_real_glMultiTexCoord4i = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord4i(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord4i]++;
+	glad_stats_real_glMultiTexCoord4i(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLMULTITEXCOORD4IVPROC glad_stats_real_glMultiTexCoord4iv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord4iv(GLenum arg0, const GLint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord4iv]++;
+	glad_stats_real_glMultiTexCoord4iv(arg0, arg1);
+}
+static PFNGLMULTITEXCOORD4SPROC glad_stats_real_glMultiTexCoord4s = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord4s(GLenum arg0, GLshort arg1, GLshort arg2, GLshort arg3, GLshort arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord4s]++;
+	glad_stats_real_glMultiTexCoord4s(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLMULTITEXCOORD4SVPROC glad_stats_real_glMultiTexCoord4sv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoord4sv(GLenum arg0, const GLshort * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoord4sv]++;
+	glad_stats_real_glMultiTexCoord4sv(arg0, arg1);
+}
+static PFNGLMULTITEXCOORDP1UIPROC glad_stats_real_glMultiTexCoordP1ui = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoordP1ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoordP1ui]++;
+	glad_stats_real_glMultiTexCoordP1ui(arg0, arg1, arg2);
+}
+static PFNGLMULTITEXCOORDP1UIVPROC glad_stats_real_glMultiTexCoordP1uiv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoordP1uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoordP1uiv]++;
+	glad_stats_real_glMultiTexCoordP1uiv(arg0, arg1, arg2);
+}
+static PFNGLMULTITEXCOORDP2UIPROC glad_stats_real_glMultiTexCoordP2ui = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoordP2ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoordP2ui]++;
+	glad_stats_real_glMultiTexCoordP2ui(arg0, arg1, arg2);
+}
+static PFNGLMULTITEXCOORDP2UIVPROC glad_stats_real_glMultiTexCoordP2uiv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoordP2uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoordP2uiv]++;
+	glad_stats_real_glMultiTexCoordP2uiv(arg0, arg1, arg2);
+}
+static PFNGLMULTITEXCOORDP3UIPROC glad_stats_real_glMultiTexCoordP3ui = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoordP3ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoordP3ui]++;
+	glad_stats_real_glMultiTexCoordP3ui(arg0, arg1, arg2);
+}
+static PFNGLMULTITEXCOORDP3UIVPROC glad_stats_real_glMultiTexCoordP3uiv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoordP3uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoordP3uiv]++;
+	glad_stats_real_glMultiTexCoordP3uiv(arg0, arg1, arg2);
+}
+static PFNGLMULTITEXCOORDP4UIPROC glad_stats_real_glMultiTexCoordP4ui = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoordP4ui(GLenum arg0, GLenum arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoordP4ui]++;
+	glad_stats_real_glMultiTexCoordP4ui(arg0, arg1, arg2);
+}
+static PFNGLMULTITEXCOORDP4UIVPROC glad_stats_real_glMultiTexCoordP4uiv = 0;
+static void APIENTRY glad_stats_impl_glMultiTexCoordP4uiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glMultiTexCoordP4uiv]++;
+	glad_stats_real_glMultiTexCoordP4uiv(arg0, arg1, arg2);
+}
+static PFNGLNAMEDBUFFERDATAPROC glad_stats_real_glNamedBufferData = 0;
+static void APIENTRY glad_stats_impl_glNamedBufferData(GLuint arg0, GLsizeiptr arg1, const void * arg2, GLenum arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNamedBufferData]++;
+	if (arg2) c->uploadBytes += (unsigned long long)arg1;
+	glad_stats_real_glNamedBufferData(arg0, arg1, arg2, arg3);
+}
+static PFNGLNAMEDBUFFERSTORAGEPROC glad_stats_real_glNamedBufferStorage = 0;
+static void APIENTRY glad_stats_impl_glNamedBufferStorage(GLuint arg0, GLsizeiptr arg1, const void * arg2, GLbitfield arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNamedBufferStorage]++;
+	if (arg2) c->uploadBytes += (unsigned long long)arg1;
+	glad_stats_real_glNamedBufferStorage(arg0, arg1, arg2, arg3);
+}
+static PFNGLNAMEDBUFFERSTORAGEEXTPROC glad_stats_real_glNamedBufferStorageEXT = 0;
+static void APIENTRY glad_stats_impl_glNamedBufferStorageEXT(GLuint arg0, GLsizeiptr arg1, const void * arg2, GLbitfield arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNamedBufferStorageEXT]++;
+	if (arg2) c->uploadBytes += (unsigned long long)arg1;
+	glad_stats_real_glNamedBufferStorageEXT(arg0, arg1, arg2, arg3);
+}
+static PFNGLNAMEDBUFFERSUBDATAPROC glad_stats_real_glNamedBufferSubData = 0;
+static void APIENTRY glad_stats_impl_glNamedBufferSubData(GLuint arg0, GLintptr arg1, GLsizeiptr arg2, const void * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNamedBufferSubData]++;
+	c->uploadBytes += (unsigned long long)arg2;
+	glad_stats_real_glNamedBufferSubData(arg0, arg1, arg2, arg3);
+}
+static PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC glad_stats_real_glNamedFramebufferDrawBuffer = 0;
+static void APIENTRY glad_stats_impl_glNamedFramebufferDrawBuffer(GLuint arg0, GLenum arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNamedFramebufferDrawBuffer]++;
+	glad_stats_real_glNamedFramebufferDrawBuffer(arg0, arg1);
+}
+static PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC glad_stats_real_glNamedFramebufferDrawBuffers = 0;
+static void APIENTRY glad_stats_impl_glNamedFramebufferDrawBuffers(GLuint arg0, GLsizei arg1, const GLenum * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNamedFramebufferDrawBuffers]++;
+	glad_stats_real_glNamedFramebufferDrawBuffers(arg0, arg1, arg2);
+}
+static PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC glad_stats_real_glNamedFramebufferParameteri = 0;
+static void APIENTRY glad_stats_impl_glNamedFramebufferParameteri(GLuint arg0, GLenum arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNamedFramebufferParameteri]++;
+	glad_stats_real_glNamedFramebufferParameteri(arg0, arg1, arg2);
+}
+static PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC glad_stats_real_glNamedFramebufferReadBuffer = 0;
+static void APIENTRY glad_stats_impl_glNamedFramebufferReadBuffer(GLuint arg0, GLenum arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNamedFramebufferReadBuffer]++;
+	glad_stats_real_glNamedFramebufferReadBuffer(arg0, arg1);
+}
+static PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC glad_stats_real_glNamedFramebufferRenderbuffer = 0;
+static void APIENTRY glad_stats_impl_glNamedFramebufferRenderbuffer(GLuint arg0, GLenum arg1, GLenum arg2, GLuint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNamedFramebufferRenderbuffer]++;
+	glad_stats_real_glNamedFramebufferRenderbuffer(arg0, arg1, arg2, arg3);
+}
+static PFNGLNAMEDFRAMEBUFFERTEXTUREPROC glad_stats_real_glNamedFramebufferTexture = 0;
+static void APIENTRY glad_stats_impl_glNamedFramebufferTexture(GLuint arg0, GLenum arg1, GLuint arg2, GLint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNamedFramebufferTexture]++;
+	glad_stats_real_glNamedFramebufferTexture(arg0, arg1, arg2, arg3);
+}
+static PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC glad_stats_real_glNamedFramebufferTextureLayer = 0;
+static void APIENTRY glad_stats_impl_glNamedFramebufferTextureLayer(GLuint arg0, GLenum arg1, GLuint arg2, GLint arg3, GLint arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNamedFramebufferTextureLayer]++;
+	glad_stats_real_glNamedFramebufferTextureLayer(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLNAMEDRENDERBUFFERSTORAGEPROC glad_stats_real_glNamedRenderbufferStorage = 0;
+static void APIENTRY glad_stats_impl_glNamedRenderbufferStorage(GLuint arg0, GLenum arg1, GLsizei arg2, GLsizei arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNamedRenderbufferStorage]++;
+	glad_stats_real_glNamedRenderbufferStorage(arg0, arg1, arg2, arg3);
+}
+static PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_stats_real_glNamedRenderbufferStorageMultisample = 0;
+static void APIENTRY glad_stats_impl_glNamedRenderbufferStorageMultisample(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNamedRenderbufferStorageMultisample]++;
+	glad_stats_real_glNamedRenderbufferStorageMultisample(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLNEWLISTPROC glad_stats_real_glNewList = 0;
+static void APIENTRY glad_stats_impl_glNewList(GLuint arg0, GLenum arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNewList]++;
+	glad_stats_real_glNewList(arg0, arg1);
+}
+static PFNGLNORMAL3BPROC glad_stats_real_glNormal3b = 0;
+static void APIENTRY glad_stats_impl_glNormal3b(GLbyte arg0, GLbyte arg1, GLbyte arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNormal3b]++;
+	glad_stats_real_glNormal3b(arg0, arg1, arg2);
+}
+static PFNGLNORMAL3BVPROC glad_stats_real_glNormal3bv = 0;
+static void APIENTRY glad_stats_impl_glNormal3bv(const GLbyte * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNormal3bv]++;
+	glad_stats_real_glNormal3bv(arg0);
+}
+static PFNGLNORMAL3DPROC glad_stats_real_glNormal3d = 0;
+static void APIENTRY glad_stats_impl_glNormal3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNormal3d]++;
+	glad_stats_real_glNormal3d(arg0, arg1, arg2);
+}
+static PFNGLNORMAL3DVPROC glad_stats_real_glNormal3dv = 0;
+static void APIENTRY glad_stats_impl_glNormal3dv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNormal3dv]++;
+	glad_stats_real_glNormal3dv(arg0);
+}
+static PFNGLNORMAL3FPROC glad_stats_real_glNormal3f = 0;
+static void APIENTRY glad_stats_impl_glNormal3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNormal3f]++;
+	glad_stats_real_glNormal3f(arg0, arg1, arg2);
+}
+static PFNGLNORMAL3FVPROC glad_stats_real_glNormal3fv = 0;
+static void APIENTRY glad_stats_impl_glNormal3fv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNormal3fv]++;
+	glad_stats_real_glNormal3fv(arg0);
+}
+static PFNGLNORMAL3IPROC glad_stats_real_glNormal3i = 0;
+static void APIENTRY glad_stats_impl_glNormal3i(GLint arg0, GLint arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNormal3i]++;
+	glad_stats_real_glNormal3i(arg0, arg1, arg2);
+}
+static PFNGLNORMAL3IVPROC glad_stats_real_glNormal3iv = 0;
+static void APIENTRY glad_stats_impl_glNormal3iv(const GLint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNormal3iv]++;
+	glad_stats_real_glNormal3iv(arg0);
+}
+static PFNGLNORMAL3SPROC glad_stats_real_glNormal3s = 0;
+static void APIENTRY glad_stats_impl_glNormal3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNormal3s]++;
+	glad_stats_real_glNormal3s(arg0, arg1, arg2);
+}
+static PFNGLNORMAL3SVPROC glad_stats_real_glNormal3sv = 0;
+static void APIENTRY glad_stats_impl_glNormal3sv(const GLshort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNormal3sv]++;
+	glad_stats_real_glNormal3sv(arg0);
+}
+static PFNGLNORMALP3UIPROC glad_stats_real_glNormalP3ui = 0;
+static void APIENTRY glad_stats_impl_glNormalP3ui(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNormalP3ui]++;
+	glad_stats_real_glNormalP3ui(arg0, arg1);
+}
+static PFNGLNORMALP3UIVPROC glad_stats_real_glNormalP3uiv = 0;
+static void APIENTRY glad_stats_impl_glNormalP3uiv(GLenum arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNormalP3uiv]++;
+	glad_stats_real_glNormalP3uiv(arg0, arg1);
+}
+static PFNGLNORMALPOINTERPROC glad_stats_real_glNormalPointer = 0;
+static void APIENTRY glad_stats_impl_glNormalPointer(GLenum arg0, GLsizei arg1, const void * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glNormalPointer]++;
+	glad_stats_real_glNormalPointer(arg0, arg1, arg2);
+}
+static PFNGLOBJECTLABELPROC glad_stats_real_glObjectLabel = 0;
+static void APIENTRY glad_stats_impl_glObjectLabel(GLenum arg0, GLuint arg1, GLsizei arg2, const GLchar * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glObjectLabel]++;
+	glad_stats_real_glObjectLabel(arg0, arg1, arg2, arg3);
+}
+static PFNGLOBJECTPTRLABELPROC glad_stats_real_glObjectPtrLabel = 0;
+static void APIENTRY glad_stats_impl_glObjectPtrLabel(const void * arg0, GLsizei arg1, const GLchar * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glObjectPtrLabel]++;
+	glad_stats_real_glObjectPtrLabel(arg0, arg1, arg2);
+}
+static PFNGLORTHOPROC glad_stats_real_glOrtho = 0;
+static void APIENTRY glad_stats_impl_glOrtho(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4, GLdouble arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glOrtho]++;
+	glad_stats_real_glOrtho(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLPASSTHROUGHPROC glad_stats_real_glPassThrough = 0;
+static void APIENTRY glad_stats_impl_glPassThrough(GLfloat arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPassThrough]++;
+	glad_stats_real_glPassThrough(arg0);
+}
+static PFNGLPATCHPARAMETERFVPROC glad_stats_real_glPatchParameterfv = 0;
+static void APIENTRY glad_stats_impl_glPatchParameterfv(GLenum arg0, const GLfloat * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPatchParameterfv]++;
+	glad_stats_real_glPatchParameterfv(arg0, arg1);
+}
+static PFNGLPATCHPARAMETERIPROC glad_stats_real_glPatchParameteri = 0;
+static void APIENTRY glad_stats_impl_glPatchParameteri(GLenum arg0, GLint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPatchParameteri]++;
+	glad_stats_real_glPatchParameteri(arg0, arg1);
+}
+static PFNGLPAUSETRANSFORMFEEDBACKPROC glad_stats_real_glPauseTransformFeedback = 0;
+static void APIENTRY glad_stats_impl_glPauseTransformFeedback(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPauseTransformFeedback]++;
+	glad_stats_real_glPauseTransformFeedback();
+}
+static PFNGLPIXELMAPFVPROC glad_stats_real_glPixelMapfv = 0;
+static void APIENTRY glad_stats_impl_glPixelMapfv(GLenum arg0, GLsizei arg1, const GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPixelMapfv]++;
+	glad_stats_real_glPixelMapfv(arg0, arg1, arg2);
+}
+static PFNGLPIXELMAPUIVPROC glad_stats_real_glPixelMapuiv = 0;
+static void APIENTRY glad_stats_impl_glPixelMapuiv(GLenum arg0, GLsizei arg1, const GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPixelMapuiv]++;
+	glad_stats_real_glPixelMapuiv(arg0, arg1, arg2);
+}
+static PFNGLPIXELMAPUSVPROC glad_stats_real_glPixelMapusv = 0;
+static void APIENTRY glad_stats_impl_glPixelMapusv(GLenum arg0, GLsizei arg1, const GLushort * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPixelMapusv]++;
+	glad_stats_real_glPixelMapusv(arg0, arg1, arg2);
+}
+static PFNGLPIXELSTOREFPROC glad_stats_real_glPixelStoref = 0;
+static void APIENTRY glad_stats_impl_glPixelStoref(GLenum arg0, GLfloat arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPixelStoref]++;
+	glad_stats_real_glPixelStoref(arg0, arg1);
+}
+static PFNGLPIXELSTOREIPROC glad_stats_real_glPixelStorei = 0;
+static void APIENTRY glad_stats_impl_glPixelStorei(GLenum arg0, GLint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPixelStorei]++;
+	glad_stats_real_glPixelStorei(arg0, arg1);
+}
+static PFNGLPIXELTRANSFERFPROC glad_stats_real_glPixelTransferf = 0;
+static void APIENTRY glad_stats_impl_glPixelTransferf(GLenum arg0, GLfloat arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPixelTransferf]++;
+	glad_stats_real_glPixelTransferf(arg0, arg1);
+}
+static PFNGLPIXELTRANSFERIPROC glad_stats_real_glPixelTransferi = 0;
+static void APIENTRY glad_stats_impl_glPixelTransferi(GLenum arg0, GLint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPixelTransferi]++;
+	glad_stats_real_glPixelTransferi(arg0, arg1);
+}
+static PFNGLPIXELZOOMPROC glad_stats_real_glPixelZoom = 0;
+static void APIENTRY glad_stats_impl_glPixelZoom(GLfloat arg0, GLfloat arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPixelZoom]++;
+	glad_stats_real_glPixelZoom(arg0, arg1);
+}
+static PFNGLPOINTPARAMETERFPROC glad_stats_real_glPointParameterf = 0;
+static void APIENTRY glad_stats_impl_glPointParameterf(GLenum arg0, GLfloat arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPointParameterf]++;
+	glad_stats_real_glPointParameterf(arg0, arg1);
+}
+static PFNGLPOINTPARAMETERFVPROC glad_stats_real_glPointParameterfv = 0;
+static void APIENTRY glad_stats_impl_glPointParameterfv(GLenum arg0, const GLfloat * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPointParameterfv]++;
+	glad_stats_real_glPointParameterfv(arg0, arg1);
+}
+static PFNGLPOINTPARAMETERIPROC glad_stats_real_glPointParameteri = 0;
+static void APIENTRY glad_stats_impl_glPointParameteri(GLenum arg0, GLint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPointParameteri]++;
+	glad_stats_real_glPointParameteri(arg0, arg1);
+}
+static PFNGLPOINTPARAMETERIVPROC glad_stats_real_glPointParameteriv = 0;
+static void APIENTRY glad_stats_impl_glPointParameteriv(GLenum arg0, const GLint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPointParameteriv]++;
+	glad_stats_real_glPointParameteriv(arg0, arg1);
+}
+static PFNGLPOINTSIZEPROC glad_stats_real_glPointSize = 0;
+static void APIENTRY glad_stats_impl_glPointSize(GLfloat arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPointSize]++;
+	glad_stats_real_glPointSize(arg0);
+}
+static PFNGLPOLYGONMODEPROC glad_stats_real_glPolygonMode = 0;
+static void APIENTRY glad_stats_impl_glPolygonMode(GLenum arg0, GLenum arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPolygonMode]++;
+	glad_stats_real_glPolygonMode(arg0, arg1);
+}
+static PFNGLPOLYGONOFFSETPROC glad_stats_real_glPolygonOffset = 0;
+static void APIENTRY glad_stats_impl_glPolygonOffset(GLfloat arg0, GLfloat arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPolygonOffset]++;
+	glad_stats_real_glPolygonOffset(arg0, arg1);
+}
+static PFNGLPOLYGONOFFSETCLAMPPROC glad_stats_real_glPolygonOffsetClamp = 0;
+static void APIENTRY glad_stats_impl_glPolygonOffsetClamp(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPolygonOffsetClamp]++;
+	glad_stats_real_glPolygonOffsetClamp(arg0, arg1, arg2);
+}
+static PFNGLPOLYGONSTIPPLEPROC glad_stats_real_glPolygonStipple = 0;
+static void APIENTRY glad_stats_impl_glPolygonStipple(const GLubyte * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPolygonStipple]++;
+	glad_stats_real_glPolygonStipple(arg0);
+}
+static PFNGLPOPATTRIBPROC glad_stats_real_glPopAttrib = 0;
+static void APIENTRY glad_stats_impl_glPopAttrib(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPopAttrib]++;
+	glad_stats_real_glPopAttrib();
+}
+static PFNGLPOPCLIENTATTRIBPROC glad_stats_real_glPopClientAttrib = 0;
+static void APIENTRY glad_stats_impl_glPopClientAttrib(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPopClientAttrib]++;
+	glad_stats_real_glPopClientAttrib();
+}
+static PFNGLPOPDEBUGGROUPPROC glad_stats_real_glPopDebugGroup = 0;
+static void APIENTRY glad_stats_impl_glPopDebugGroup(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPopDebugGroup]++;
+	glad_stats_real_glPopDebugGroup();
+}
+static PFNGLPOPMATRIXPROC glad_stats_real_glPopMatrix = 0;
+static void APIENTRY glad_stats_impl_glPopMatrix(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPopMatrix]++;
+	glad_stats_real_glPopMatrix();
+}
+static PFNGLPOPNAMEPROC glad_stats_real_glPopName = 0;
+static void APIENTRY glad_stats_impl_glPopName(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPopName]++;
+	glad_stats_real_glPopName();
+}
+static PFNGLPRIMITIVERESTARTINDEXPROC glad_stats_real_glPrimitiveRestartIndex = 0;
+static void APIENTRY glad_stats_impl_glPrimitiveRestartIndex(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPrimitiveRestartIndex]++;
+	glad_stats_real_glPrimitiveRestartIndex(arg0);
+}
+static PFNGLPRIORITIZETEXTURESPROC glad_stats_real_glPrioritizeTextures = 0;
+static void APIENTRY glad_stats_impl_glPrioritizeTextures(GLsizei arg0, const GLuint * arg1, const GLclampf * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPrioritizeTextures]++;
+	glad_stats_real_glPrioritizeTextures(arg0, arg1, arg2);
+}
+static PFNGLPROGRAMBINARYPROC glad_stats_real_glProgramBinary = 0;
+static void APIENTRY glad_stats_impl_glProgramBinary(GLuint arg0, GLenum arg1, const void * arg2, GLsizei arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramBinary]++;
+	glad_stats_real_glProgramBinary(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMPARAMETERIPROC glad_stats_real_glProgramParameteri = 0;
+static void APIENTRY glad_stats_impl_glProgramParameteri(GLuint arg0, GLenum arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramParameteri]++;
+	glad_stats_real_glProgramParameteri(arg0, arg1, arg2);
+}
+static PFNGLPROGRAMUNIFORM1DPROC glad_stats_real_glProgramUniform1d = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform1d(GLuint arg0, GLint arg1, GLdouble arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform1d]++;
+	glad_stats_real_glProgramUniform1d(arg0, arg1, arg2);
+}
+static PFNGLPROGRAMUNIFORM1DVPROC glad_stats_real_glProgramUniform1dv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform1dv(GLuint arg0, GLint arg1, GLsizei arg2, const GLdouble * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform1dv]++;
+	glad_stats_real_glProgramUniform1dv(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM1FPROC glad_stats_real_glProgramUniform1f = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform1f(GLuint arg0, GLint arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform1f]++;
+	glad_stats_real_glProgramUniform1f(arg0, arg1, arg2);
+}
+static PFNGLPROGRAMUNIFORM1FVPROC glad_stats_real_glProgramUniform1fv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform1fv(GLuint arg0, GLint arg1, GLsizei arg2, const GLfloat * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform1fv]++;
+	glad_stats_real_glProgramUniform1fv(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM1IPROC glad_stats_real_glProgramUniform1i = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform1i(GLuint arg0, GLint arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform1i]++;
+	glad_stats_real_glProgramUniform1i(arg0, arg1, arg2);
+}
+static PFNGLPROGRAMUNIFORM1IVPROC glad_stats_real_glProgramUniform1iv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform1iv(GLuint arg0, GLint arg1, GLsizei arg2, const GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform1iv]++;
+	glad_stats_real_glProgramUniform1iv(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM1UIPROC glad_stats_real_glProgramUniform1ui = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform1ui(GLuint arg0, GLint arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform1ui]++;
+	glad_stats_real_glProgramUniform1ui(arg0, arg1, arg2);
+}
+static PFNGLPROGRAMUNIFORM1UIVPROC glad_stats_real_glProgramUniform1uiv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform1uiv(GLuint arg0, GLint arg1, GLsizei arg2, const GLuint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform1uiv]++;
+	glad_stats_real_glProgramUniform1uiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM2DPROC glad_stats_real_glProgramUniform2d = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform2d(GLuint arg0, GLint arg1, GLdouble arg2, GLdouble arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform2d]++;
+	glad_stats_real_glProgramUniform2d(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM2DVPROC glad_stats_real_glProgramUniform2dv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform2dv(GLuint arg0, GLint arg1, GLsizei arg2, const GLdouble * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform2dv]++;
+	glad_stats_real_glProgramUniform2dv(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM2FPROC glad_stats_real_glProgramUniform2f = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform2f(GLuint arg0, GLint arg1, GLfloat arg2, GLfloat arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform2f]++;
+	glad_stats_real_glProgramUniform2f(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM2FVPROC glad_stats_real_glProgramUniform2fv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform2fv(GLuint arg0, GLint arg1, GLsizei arg2, const GLfloat * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform2fv]++;
+	glad_stats_real_glProgramUniform2fv(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM2IPROC glad_stats_real_glProgramUniform2i = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform2i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform2i]++;
+	glad_stats_real_glProgramUniform2i(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM2IVPROC glad_stats_real_glProgramUniform2iv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform2iv(GLuint arg0, GLint arg1, GLsizei arg2, const GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform2iv]++;
+	glad_stats_real_glProgramUniform2iv(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM2UIPROC glad_stats_real_glProgramUniform2ui = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform2ui(GLuint arg0, GLint arg1, GLuint arg2, GLuint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform2ui]++;
+	glad_stats_real_glProgramUniform2ui(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM2UIVPROC glad_stats_real_glProgramUniform2uiv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform2uiv(GLuint arg0, GLint arg1, GLsizei arg2, const GLuint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform2uiv]++;
+	glad_stats_real_glProgramUniform2uiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM3DPROC glad_stats_real_glProgramUniform3d = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform3d(GLuint arg0, GLint arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform3d]++;
+	glad_stats_real_glProgramUniform3d(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORM3DVPROC glad_stats_real_glProgramUniform3dv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform3dv(GLuint arg0, GLint arg1, GLsizei arg2, const GLdouble * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform3dv]++;
+	glad_stats_real_glProgramUniform3dv(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM3FPROC glad_stats_real_glProgramUniform3f = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform3f(GLuint arg0, GLint arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform3f]++;
+	glad_stats_real_glProgramUniform3f(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORM3FVPROC glad_stats_real_glProgramUniform3fv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform3fv(GLuint arg0, GLint arg1, GLsizei arg2, const GLfloat * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform3fv]++;
+	glad_stats_real_glProgramUniform3fv(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM3IPROC glad_stats_real_glProgramUniform3i = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform3i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform3i]++;
+	glad_stats_real_glProgramUniform3i(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORM3IVPROC glad_stats_real_glProgramUniform3iv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform3iv(GLuint arg0, GLint arg1, GLsizei arg2, const GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform3iv]++;
+	glad_stats_real_glProgramUniform3iv(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM3UIPROC glad_stats_real_glProgramUniform3ui = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform3ui(GLuint arg0, GLint arg1, GLuint arg2, GLuint arg3, GLuint arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform3ui]++;
+	glad_stats_real_glProgramUniform3ui(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORM3UIVPROC glad_stats_real_glProgramUniform3uiv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform3uiv(GLuint arg0, GLint arg1, GLsizei arg2, const GLuint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform3uiv]++;
+	glad_stats_real_glProgramUniform3uiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM4DPROC glad_stats_real_glProgramUniform4d = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform4d(GLuint arg0, GLint arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4, GLdouble arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform4d]++;
+	glad_stats_real_glProgramUniform4d(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLPROGRAMUNIFORM4DVPROC glad_stats_real_glProgramUniform4dv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform4dv(GLuint arg0, GLint arg1, GLsizei arg2, const GLdouble * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform4dv]++;
+	glad_stats_real_glProgramUniform4dv(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM4FPROC glad_stats_real_glProgramUniform4f = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform4f(GLuint arg0, GLint arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4, GLfloat arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform4f]++;
+	glad_stats_real_glProgramUniform4f(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLPROGRAMUNIFORM4FVPROC glad_stats_real_glProgramUniform4fv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform4fv(GLuint arg0, GLint arg1, GLsizei arg2, const GLfloat * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform4fv]++;
+	glad_stats_real_glProgramUniform4fv(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM4IPROC glad_stats_real_glProgramUniform4i = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform4i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLint arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform4i]++;
+	glad_stats_real_glProgramUniform4i(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLPROGRAMUNIFORM4IVPROC glad_stats_real_glProgramUniform4iv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform4iv(GLuint arg0, GLint arg1, GLsizei arg2, const GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform4iv]++;
+	glad_stats_real_glProgramUniform4iv(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORM4UIPROC glad_stats_real_glProgramUniform4ui = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform4ui(GLuint arg0, GLint arg1, GLuint arg2, GLuint arg3, GLuint arg4, GLuint arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform4ui]++;
+	glad_stats_real_glProgramUniform4ui(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLPROGRAMUNIFORM4UIVPROC glad_stats_real_glProgramUniform4uiv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniform4uiv(GLuint arg0, GLint arg1, GLsizei arg2, const GLuint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniform4uiv]++;
+	glad_stats_real_glProgramUniform4uiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC glad_stats_real_glProgramUniformHandleui64ARB = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformHandleui64ARB(GLuint arg0, GLint arg1, GLuint64 arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformHandleui64ARB]++;
+	glad_stats_real_glProgramUniformHandleui64ARB(arg0, arg1, arg2);
+}
+static PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC glad_stats_real_glProgramUniformHandleui64vARB = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformHandleui64vARB(GLuint arg0, GLint arg1, GLsizei arg2, const GLuint64 * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformHandleui64vARB]++;
+	glad_stats_real_glProgramUniformHandleui64vARB(arg0, arg1, arg2, arg3);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2DVPROC glad_stats_real_glProgramUniformMatrix2dv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformMatrix2dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformMatrix2dv]++;
+	glad_stats_real_glProgramUniformMatrix2dv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2FVPROC glad_stats_real_glProgramUniformMatrix2fv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformMatrix2fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformMatrix2fv]++;
+	glad_stats_real_glProgramUniformMatrix2fv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC glad_stats_real_glProgramUniformMatrix2x3dv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformMatrix2x3dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformMatrix2x3dv]++;
+	glad_stats_real_glProgramUniformMatrix2x3dv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC glad_stats_real_glProgramUniformMatrix2x3fv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformMatrix2x3fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformMatrix2x3fv]++;
+	glad_stats_real_glProgramUniformMatrix2x3fv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC glad_stats_real_glProgramUniformMatrix2x4dv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformMatrix2x4dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformMatrix2x4dv]++;
+	glad_stats_real_glProgramUniformMatrix2x4dv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC glad_stats_real_glProgramUniformMatrix2x4fv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformMatrix2x4fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformMatrix2x4fv]++;
+	glad_stats_real_glProgramUniformMatrix2x4fv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3DVPROC glad_stats_real_glProgramUniformMatrix3dv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformMatrix3dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformMatrix3dv]++;
+	glad_stats_real_glProgramUniformMatrix3dv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3FVPROC glad_stats_real_glProgramUniformMatrix3fv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformMatrix3fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformMatrix3fv]++;
+	glad_stats_real_glProgramUniformMatrix3fv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC glad_stats_real_glProgramUniformMatrix3x2dv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformMatrix3x2dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformMatrix3x2dv]++;
+	glad_stats_real_glProgramUniformMatrix3x2dv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC glad_stats_real_glProgramUniformMatrix3x2fv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformMatrix3x2fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformMatrix3x2fv]++;
+	glad_stats_real_glProgramUniformMatrix3x2fv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC glad_stats_real_glProgramUniformMatrix3x4dv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformMatrix3x4dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformMatrix3x4dv]++;
+	glad_stats_real_glProgramUniformMatrix3x4dv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC glad_stats_real_glProgramUniformMatrix3x4fv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformMatrix3x4fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformMatrix3x4fv]++;
+	glad_stats_real_glProgramUniformMatrix3x4fv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4DVPROC glad_stats_real_glProgramUniformMatrix4dv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformMatrix4dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformMatrix4dv]++;
+	glad_stats_real_glProgramUniformMatrix4dv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4FVPROC glad_stats_real_glProgramUniformMatrix4fv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformMatrix4fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformMatrix4fv]++;
+	glad_stats_real_glProgramUniformMatrix4fv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC glad_stats_real_glProgramUniformMatrix4x2dv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformMatrix4x2dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformMatrix4x2dv]++;
+	glad_stats_real_glProgramUniformMatrix4x2dv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC glad_stats_real_glProgramUniformMatrix4x2fv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformMatrix4x2fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformMatrix4x2fv]++;
+	glad_stats_real_glProgramUniformMatrix4x2fv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC glad_stats_real_glProgramUniformMatrix4x3dv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformMatrix4x3dv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLdouble * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformMatrix4x3dv]++;
+	glad_stats_real_glProgramUniformMatrix4x3dv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC glad_stats_real_glProgramUniformMatrix4x3fv = 0;
+static void APIENTRY glad_stats_impl_glProgramUniformMatrix4x3fv(GLuint arg0, GLint arg1, GLsizei arg2, GLboolean arg3, const GLfloat * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProgramUniformMatrix4x3fv]++;
+	glad_stats_real_glProgramUniformMatrix4x3fv(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLPROVOKINGVERTEXPROC glad_stats_real_glProvokingVertex = 0;
+static void APIENTRY glad_stats_impl_glProvokingVertex(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glProvokingVertex]++;
+	glad_stats_real_glProvokingVertex(arg0);
+}
+static PFNGLPUSHATTRIBPROC glad_stats_real_glPushAttrib = 0;
+static void APIENTRY glad_stats_impl_glPushAttrib(GLbitfield arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPushAttrib]++;
+	glad_stats_real_glPushAttrib(arg0);
+}
+static PFNGLPUSHCLIENTATTRIBPROC glad_stats_real_glPushClientAttrib = 0;
+static void APIENTRY glad_stats_impl_glPushClientAttrib(GLbitfield arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPushClientAttrib]++;
+	glad_stats_real_glPushClientAttrib(arg0);
+}
+static PFNGLPUSHDEBUGGROUPPROC glad_stats_real_glPushDebugGroup = 0;
+static void APIENTRY glad_stats_impl_glPushDebugGroup(GLenum arg0, GLuint arg1, GLsizei arg2, const GLchar * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPushDebugGroup]++;
+	glad_stats_real_glPushDebugGroup(arg0, arg1, arg2, arg3);
+}
+static PFNGLPUSHMATRIXPROC glad_stats_real_glPushMatrix = 0;
+static void APIENTRY glad_stats_impl_glPushMatrix(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPushMatrix]++;
+	glad_stats_real_glPushMatrix();
+}
+static PFNGLPUSHNAMEPROC glad_stats_real_glPushName = 0;
+static void APIENTRY glad_stats_impl_glPushName(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glPushName]++;
+	glad_stats_real_glPushName(arg0);
+}
+static PFNGLQUERYCOUNTERPROC glad_stats_real_glQueryCounter = 0;
+static void APIENTRY glad_stats_impl_glQueryCounter(GLuint arg0, GLenum arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glQueryCounter]++;
+	glad_stats_real_glQueryCounter(arg0, arg1);
+}
+static PFNGLRASTERPOS2DPROC glad_stats_real_glRasterPos2d = 0;
+static void APIENTRY glad_stats_impl_glRasterPos2d(GLdouble arg0, GLdouble arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos2d]++;
+	glad_stats_real_glRasterPos2d(arg0, arg1);
+}
+static PFNGLRASTERPOS2DVPROC glad_stats_real_glRasterPos2dv = 0;
+static void APIENTRY glad_stats_impl_glRasterPos2dv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos2dv]++;
+	glad_stats_real_glRasterPos2dv(arg0);
+}
+static PFNGLRASTERPOS2FPROC glad_stats_real_glRasterPos2f = 0;
+static void APIENTRY glad_stats_impl_glRasterPos2f(GLfloat arg0, GLfloat arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos2f]++;
+	glad_stats_real_glRasterPos2f(arg0, arg1);
+}
+static PFNGLRASTERPOS2FVPROC glad_stats_real_glRasterPos2fv = 0;
+static void APIENTRY glad_stats_impl_glRasterPos2fv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos2fv]++;
+	glad_stats_real_glRasterPos2fv(arg0);
+}
+static PFNGLRASTERPOS2IPROC glad_stats_real_glRasterPos2i = 0;
+static void APIENTRY glad_stats_impl_glRasterPos2i(GLint arg0, GLint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos2i]++;
+	glad_stats_real_glRasterPos2i(arg0, arg1);
+}
+static PFNGLRASTERPOS2IVPROC glad_stats_real_glRasterPos2iv = 0;
+static void APIENTRY glad_stats_impl_glRasterPos2iv(const GLint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos2iv]++;
+	glad_stats_real_glRasterPos2iv(arg0);
+}
+static PFNGLRASTERPOS2SPROC glad_stats_real_glRasterPos2s = 0;
+static void APIENTRY glad_stats_impl_glRasterPos2s(GLshort arg0, GLshort arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos2s]++;
+	glad_stats_real_glRasterPos2s(arg0, arg1);
+}
+static PFNGLRASTERPOS2SVPROC glad_stats_real_glRasterPos2sv = 0;
+static void APIENTRY glad_stats_impl_glRasterPos2sv(const GLshort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos2sv]++;
+	glad_stats_real_glRasterPos2sv(arg0);
+}
+static PFNGLRASTERPOS3DPROC glad_stats_real_glRasterPos3d = 0;
+static void APIENTRY glad_stats_impl_glRasterPos3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos3d]++;
+	glad_stats_real_glRasterPos3d(arg0, arg1, arg2);
+}
+static PFNGLRASTERPOS3DVPROC glad_stats_real_glRasterPos3dv = 0;
+static void APIENTRY glad_stats_impl_glRasterPos3dv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos3dv]++;
+	glad_stats_real_glRasterPos3dv(arg0);
+}
+static PFNGLRASTERPOS3FPROC glad_stats_real_glRasterPos3f = 0;
+static void APIENTRY glad_stats_impl_glRasterPos3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos3f]++;
+	glad_stats_real_glRasterPos3f(arg0, arg1, arg2);
+}
+static PFNGLRASTERPOS3FVPROC glad_stats_real_glRasterPos3fv = 0;
+static void APIENTRY glad_stats_impl_glRasterPos3fv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos3fv]++;
+	glad_stats_real_glRasterPos3fv(arg0);
+}
+static PFNGLRASTERPOS3IPROC glad_stats_real_glRasterPos3i = 0;
+static void APIENTRY glad_stats_impl_glRasterPos3i(GLint arg0, GLint arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos3i]++;
+	glad_stats_real_glRasterPos3i(arg0, arg1, arg2);
+}
+static PFNGLRASTERPOS3IVPROC glad_stats_real_glRasterPos3iv = 0;
+static void APIENTRY glad_stats_impl_glRasterPos3iv(const GLint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos3iv]++;
+	glad_stats_real_glRasterPos3iv(arg0);
+}
+static PFNGLRASTERPOS3SPROC glad_stats_real_glRasterPos3s = 0;
+static void APIENTRY glad_stats_impl_glRasterPos3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos3s]++;
+	glad_stats_real_glRasterPos3s(arg0, arg1, arg2);
+}
+static PFNGLRASTERPOS3SVPROC glad_stats_real_glRasterPos3sv = 0;
+static void APIENTRY glad_stats_impl_glRasterPos3sv(const GLshort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos3sv]++;
+	glad_stats_real_glRasterPos3sv(arg0);
+}
+static PFNGLRASTERPOS4DPROC glad_stats_real_glRasterPos4d = 0;
+static void APIENTRY glad_stats_impl_glRasterPos4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos4d]++;
+	glad_stats_real_glRasterPos4d(arg0, arg1, arg2, arg3);
+}
+static PFNGLRASTERPOS4DVPROC glad_stats_real_glRasterPos4dv = 0;
+static void APIENTRY glad_stats_impl_glRasterPos4dv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos4dv]++;
+	glad_stats_real_glRasterPos4dv(arg0);
+}
+static PFNGLRASTERPOS4FPROC glad_stats_real_glRasterPos4f = 0;
+static void APIENTRY glad_stats_impl_glRasterPos4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos4f]++;
+	glad_stats_real_glRasterPos4f(arg0, arg1, arg2, arg3);
+}
+static PFNGLRASTERPOS4FVPROC glad_stats_real_glRasterPos4fv = 0;
+static void APIENTRY glad_stats_impl_glRasterPos4fv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos4fv]++;
+	glad_stats_real_glRasterPos4fv(arg0);
+}
+static PFNGLRASTERPOS4IPROC glad_stats_real_glRasterPos4i = 0;
+static void APIENTRY glad_stats_impl_glRasterPos4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos4i]++;
+	glad_stats_real_glRasterPos4i(arg0, arg1, arg2, arg3);
+}
+static PFNGLRASTERPOS4IVPROC glad_stats_real_glRasterPos4iv = 0;
+static void APIENTRY glad_stats_impl_glRasterPos4iv(const GLint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos4iv]++;
+	glad_stats_real_glRasterPos4iv(arg0);
+}
+static PFNGLRASTERPOS4SPROC glad_stats_real_glRasterPos4s = 0;
+static void APIENTRY glad_stats_impl_glRasterPos4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos4s]++;
+	glad_stats_real_glRasterPos4s(arg0, arg1, arg2, arg3);
+}
+static PFNGLRASTERPOS4SVPROC glad_stats_real_glRasterPos4sv = 0;
+static void APIENTRY glad_stats_impl_glRasterPos4sv(const GLshort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRasterPos4sv]++;
+	glad_stats_real_glRasterPos4sv(arg0);
+}
+static PFNGLREADBUFFERPROC glad_stats_real_glReadBuffer = 0;
+static void APIENTRY glad_stats_impl_glReadBuffer(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glReadBuffer]++;
+	glad_stats_real_glReadBuffer(arg0);
+}
+static PFNGLREADPIXELSPROC glad_stats_real_glReadPixels = 0;
+static void APIENTRY glad_stats_impl_glReadPixels(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLenum arg4, GLenum arg5, void * arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glReadPixels]++;
+	glad_stats_real_glReadPixels(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLREADNPIXELSPROC glad_stats_real_glReadnPixels = 0;
+static void APIENTRY glad_stats_impl_glReadnPixels(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3, GLenum arg4, GLenum arg5, GLsizei arg6, void * arg7) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glReadnPixels]++;
+	glad_stats_real_glReadnPixels(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static PFNGLRECTDPROC glad_stats_real_glRectd = 0;
+static void APIENTRY glad_stats_impl_glRectd(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRectd]++;
+	glad_stats_real_glRectd(arg0, arg1, arg2, arg3);
+}
+static PFNGLRECTDVPROC glad_stats_real_glRectdv = 0;
+static void APIENTRY glad_stats_impl_glRectdv(const GLdouble * arg0, const GLdouble * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRectdv]++;
+	glad_stats_real_glRectdv(arg0, arg1);
+}
+static PFNGLRECTFPROC glad_stats_real_glRectf = 0;
+static void APIENTRY glad_stats_impl_glRectf(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRectf]++;
+	glad_stats_real_glRectf(arg0, arg1, arg2, arg3);
+}
+static PFNGLRECTFVPROC glad_stats_real_glRectfv = 0;
+static void APIENTRY glad_stats_impl_glRectfv(const GLfloat * arg0, const GLfloat * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRectfv]++;
+	glad_stats_real_glRectfv(arg0, arg1);
+}
+static PFNGLRECTIPROC glad_stats_real_glRecti = 0;
+static void APIENTRY glad_stats_impl_glRecti(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRecti]++;
+	glad_stats_real_glRecti(arg0, arg1, arg2, arg3);
+}
+static PFNGLRECTIVPROC glad_stats_real_glRectiv = 0;
+static void APIENTRY glad_stats_impl_glRectiv(const GLint * arg0, const GLint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRectiv]++;
+	glad_stats_real_glRectiv(arg0, arg1);
+}
+static PFNGLRECTSPROC glad_stats_real_glRects = 0;
+static void APIENTRY glad_stats_impl_glRects(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRects]++;
+	glad_stats_real_glRects(arg0, arg1, arg2, arg3);
+}
+static PFNGLRECTSVPROC glad_stats_real_glRectsv = 0;
+static void APIENTRY glad_stats_impl_glRectsv(const GLshort * arg0, const GLshort * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRectsv]++;
+	glad_stats_real_glRectsv(arg0, arg1);
+}
+static PFNGLRELEASESHADERCOMPILERPROC glad_stats_real_glReleaseShaderCompiler = 0;
+static void APIENTRY glad_stats_impl_glReleaseShaderCompiler(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glReleaseShaderCompiler]++;
+	glad_stats_real_glReleaseShaderCompiler();
+}
+static PFNGLRENDERMODEPROC glad_stats_real_glRenderMode = 0;
+static GLint APIENTRY glad_stats_impl_glRenderMode(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRenderMode]++;
+	return glad_stats_real_glRenderMode(arg0);
+}
+static PFNGLRENDERBUFFERSTORAGEPROC glad_stats_real_glRenderbufferStorage = 0;
+static void APIENTRY glad_stats_impl_glRenderbufferStorage(GLenum arg0, GLenum arg1, GLsizei arg2, GLsizei arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRenderbufferStorage]++;
+	glad_stats_real_glRenderbufferStorage(arg0, arg1, arg2, arg3);
+}
+static PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC glad_stats_real_glRenderbufferStorageMultisample = 0;
+static void APIENTRY glad_stats_impl_glRenderbufferStorageMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRenderbufferStorageMultisample]++;
+	glad_stats_real_glRenderbufferStorageMultisample(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLRESUMETRANSFORMFEEDBACKPROC glad_stats_real_glResumeTransformFeedback = 0;
+static void APIENTRY glad_stats_impl_glResumeTransformFeedback(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glResumeTransformFeedback]++;
+	glad_stats_real_glResumeTransformFeedback();
+}
+static PFNGLROTATEDPROC glad_stats_real_glRotated = 0;
+static void APIENTRY glad_stats_impl_glRotated(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRotated]++;
+	glad_stats_real_glRotated(arg0, arg1, arg2, arg3);
+}
+static PFNGLROTATEFPROC glad_stats_real_glRotatef = 0;
+static void APIENTRY glad_stats_impl_glRotatef(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glRotatef]++;
+	glad_stats_real_glRotatef(arg0, arg1, arg2, arg3);
+}
+static PFNGLSAMPLECOVERAGEPROC glad_stats_real_glSampleCoverage = 0;
+static void APIENTRY glad_stats_impl_glSampleCoverage(GLfloat arg0, GLboolean arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSampleCoverage]++;
+	glad_stats_real_glSampleCoverage(arg0, arg1);
+}
+static PFNGLSAMPLEMASKIPROC glad_stats_real_glSampleMaski = 0;
+static void APIENTRY glad_stats_impl_glSampleMaski(GLuint arg0, GLbitfield arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSampleMaski]++;
+	glad_stats_real_glSampleMaski(arg0, arg1);
+}
+static PFNGLSAMPLERPARAMETERIIVPROC glad_stats_real_glSamplerParameterIiv = 0;
+static void APIENTRY glad_stats_impl_glSamplerParameterIiv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSamplerParameterIiv]++;
+	glad_stats_real_glSamplerParameterIiv(arg0, arg1, arg2);
+}
+static PFNGLSAMPLERPARAMETERIUIVPROC glad_stats_real_glSamplerParameterIuiv = 0;
+static void APIENTRY glad_stats_impl_glSamplerParameterIuiv(GLuint arg0, GLenum arg1, const GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSamplerParameterIuiv]++;
+	glad_stats_real_glSamplerParameterIuiv(arg0, arg1, arg2);
+}
+static PFNGLSAMPLERPARAMETERFPROC glad_stats_real_glSamplerParameterf = 0;
+static void APIENTRY glad_stats_impl_glSamplerParameterf(GLuint arg0, GLenum arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSamplerParameterf]++;
+	glad_stats_real_glSamplerParameterf(arg0, arg1, arg2);
+}
+static PFNGLSAMPLERPARAMETERFVPROC glad_stats_real_glSamplerParameterfv = 0;
+static void APIENTRY glad_stats_impl_glSamplerParameterfv(GLuint arg0, GLenum arg1, const GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSamplerParameterfv]++;
+	glad_stats_real_glSamplerParameterfv(arg0, arg1, arg2);
+}
+static PFNGLSAMPLERPARAMETERIPROC glad_stats_real_glSamplerParameteri = 0;
+static void APIENTRY glad_stats_impl_glSamplerParameteri(GLuint arg0, GLenum arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSamplerParameteri]++;
+	glad_stats_real_glSamplerParameteri(arg0, arg1, arg2);
+}
+static PFNGLSAMPLERPARAMETERIVPROC glad_stats_real_glSamplerParameteriv = 0;
+static void APIENTRY glad_stats_impl_glSamplerParameteriv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSamplerParameteriv]++;
+	glad_stats_real_glSamplerParameteriv(arg0, arg1, arg2);
+}
+static PFNGLSCALEDPROC glad_stats_real_glScaled = 0;
+static void APIENTRY glad_stats_impl_glScaled(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glScaled]++;
+	glad_stats_real_glScaled(arg0, arg1, arg2);
+}
+static PFNGLSCALEFPROC glad_stats_real_glScalef = 0;
+static void APIENTRY glad_stats_impl_glScalef(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glScalef]++;
+	glad_stats_real_glScalef(arg0, arg1, arg2);
+}
+static PFNGLSCISSORPROC glad_stats_real_glScissor = 0;
+static void APIENTRY glad_stats_impl_glScissor(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glScissor]++;
+	glad_stats_real_glScissor(arg0, arg1, arg2, arg3);
+}
+static PFNGLSCISSORARRAYVPROC glad_stats_real_glScissorArrayv = 0;
+static void APIENTRY glad_stats_impl_glScissorArrayv(GLuint arg0, GLsizei arg1, const GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glScissorArrayv]++;
+	glad_stats_real_glScissorArrayv(arg0, arg1, arg2);
+}
+static PFNGLSCISSORINDEXEDPROC glad_stats_real_glScissorIndexed = 0;
+static void APIENTRY glad_stats_impl_glScissorIndexed(GLuint arg0, GLint arg1, GLint arg2, GLsizei arg3, GLsizei arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glScissorIndexed]++;
+	glad_stats_real_glScissorIndexed(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLSCISSORINDEXEDVPROC glad_stats_real_glScissorIndexedv = 0;
+static void APIENTRY glad_stats_impl_glScissorIndexedv(GLuint arg0, const GLint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glScissorIndexedv]++;
+	glad_stats_real_glScissorIndexedv(arg0, arg1);
+}
+static PFNGLSECONDARYCOLOR3BPROC glad_stats_real_glSecondaryColor3b = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColor3b(GLbyte arg0, GLbyte arg1, GLbyte arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColor3b]++;
+	glad_stats_real_glSecondaryColor3b(arg0, arg1, arg2);
+}
+static PFNGLSECONDARYCOLOR3BVPROC glad_stats_real_glSecondaryColor3bv = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColor3bv(const GLbyte * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColor3bv]++;
+	glad_stats_real_glSecondaryColor3bv(arg0);
+}
+static PFNGLSECONDARYCOLOR3DPROC glad_stats_real_glSecondaryColor3d = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColor3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColor3d]++;
+	glad_stats_real_glSecondaryColor3d(arg0, arg1, arg2);
+}
+static PFNGLSECONDARYCOLOR3DVPROC glad_stats_real_glSecondaryColor3dv = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColor3dv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColor3dv]++;
+	glad_stats_real_glSecondaryColor3dv(arg0);
+}
+static PFNGLSECONDARYCOLOR3FPROC glad_stats_real_glSecondaryColor3f = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColor3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColor3f]++;
+	glad_stats_real_glSecondaryColor3f(arg0, arg1, arg2);
+}
+static PFNGLSECONDARYCOLOR3FVPROC glad_stats_real_glSecondaryColor3fv = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColor3fv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColor3fv]++;
+	glad_stats_real_glSecondaryColor3fv(arg0);
+}
+static PFNGLSECONDARYCOLOR3IPROC glad_stats_real_glSecondaryColor3i = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColor3i(GLint arg0, GLint arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColor3i]++;
+	glad_stats_real_glSecondaryColor3i(arg0, arg1, arg2);
+}
+static PFNGLSECONDARYCOLOR3IVPROC glad_stats_real_glSecondaryColor3iv = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColor3iv(const GLint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColor3iv]++;
+	glad_stats_real_glSecondaryColor3iv(arg0);
+}
+static PFNGLSECONDARYCOLOR3SPROC glad_stats_real_glSecondaryColor3s = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColor3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColor3s]++;
+	glad_stats_real_glSecondaryColor3s(arg0, arg1, arg2);
+}
+static PFNGLSECONDARYCOLOR3SVPROC glad_stats_real_glSecondaryColor3sv = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColor3sv(const GLshort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColor3sv]++;
+	glad_stats_real_glSecondaryColor3sv(arg0);
+}
+static PFNGLSECONDARYCOLOR3UBPROC glad_stats_real_glSecondaryColor3ub = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColor3ub(GLubyte arg0, GLubyte arg1, GLubyte arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColor3ub]++;
+	glad_stats_real_glSecondaryColor3ub(arg0, arg1, arg2);
+}
+static PFNGLSECONDARYCOLOR3UBVPROC glad_stats_real_glSecondaryColor3ubv = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColor3ubv(const GLubyte * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColor3ubv]++;
+	glad_stats_real_glSecondaryColor3ubv(arg0);
+}
+static PFNGLSECONDARYCOLOR3UIPROC glad_stats_real_glSecondaryColor3ui = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColor3ui(GLuint arg0, GLuint arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColor3ui]++;
+	glad_stats_real_glSecondaryColor3ui(arg0, arg1, arg2);
+}
+static PFNGLSECONDARYCOLOR3UIVPROC glad_stats_real_glSecondaryColor3uiv = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColor3uiv(const GLuint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColor3uiv]++;
+	glad_stats_real_glSecondaryColor3uiv(arg0);
+}
+static PFNGLSECONDARYCOLOR3USPROC glad_stats_real_glSecondaryColor3us = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColor3us(GLushort arg0, GLushort arg1, GLushort arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColor3us]++;
+	glad_stats_real_glSecondaryColor3us(arg0, arg1, arg2);
+}
+static PFNGLSECONDARYCOLOR3USVPROC glad_stats_real_glSecondaryColor3usv = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColor3usv(const GLushort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColor3usv]++;
+	glad_stats_real_glSecondaryColor3usv(arg0);
+}
+static PFNGLSECONDARYCOLORP3UIPROC glad_stats_real_glSecondaryColorP3ui = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColorP3ui(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColorP3ui]++;
+	glad_stats_real_glSecondaryColorP3ui(arg0, arg1);
+}
+static PFNGLSECONDARYCOLORP3UIVPROC glad_stats_real_glSecondaryColorP3uiv = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColorP3uiv(GLenum arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColorP3uiv]++;
+	glad_stats_real_glSecondaryColorP3uiv(arg0, arg1);
+}
+static PFNGLSECONDARYCOLORPOINTERPROC glad_stats_real_glSecondaryColorPointer = 0;
+static void APIENTRY glad_stats_impl_glSecondaryColorPointer(GLint arg0, GLenum arg1, GLsizei arg2, const void * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSecondaryColorPointer]++;
+	glad_stats_real_glSecondaryColorPointer(arg0, arg1, arg2, arg3);
+}
+static PFNGLSELECTBUFFERPROC glad_stats_real_glSelectBuffer = 0;
+static void APIENTRY glad_stats_impl_glSelectBuffer(GLsizei arg0, GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSelectBuffer]++;
+	glad_stats_real_glSelectBuffer(arg0, arg1);
+}
+static PFNGLSHADEMODELPROC glad_stats_real_glShadeModel = 0;
+static void APIENTRY glad_stats_impl_glShadeModel(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glShadeModel]++;
+	glad_stats_real_glShadeModel(arg0);
+}
+static PFNGLSHADERBINARYPROC glad_stats_real_glShaderBinary = 0;
+static void APIENTRY glad_stats_impl_glShaderBinary(GLsizei arg0, const GLuint * arg1, GLenum arg2, const void * arg3, GLsizei arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glShaderBinary]++;
+	glad_stats_real_glShaderBinary(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLSHADERSOURCEPROC glad_stats_real_glShaderSource = 0;
+static void APIENTRY glad_stats_impl_glShaderSource(GLuint arg0, GLsizei arg1, const GLchar *const * arg2, const GLint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glShaderSource]++;
+	glad_stats_real_glShaderSource(arg0, arg1, arg2, arg3);
+}
+static PFNGLSHADERSTORAGEBLOCKBINDINGPROC glad_stats_real_glShaderStorageBlockBinding = 0;
+static void APIENTRY glad_stats_impl_glShaderStorageBlockBinding(GLuint arg0, GLuint arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glShaderStorageBlockBinding]++;
+	glad_stats_real_glShaderStorageBlockBinding(arg0, arg1, arg2);
+}
+static PFNGLSPECIALIZESHADERPROC glad_stats_real_glSpecializeShader = 0;
+static void APIENTRY glad_stats_impl_glSpecializeShader(GLuint arg0, const GLchar * arg1, GLuint arg2, const GLuint * arg3, const GLuint * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSpecializeShader]++;
+	glad_stats_real_glSpecializeShader(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLSPECIALIZESHADERARBPROC glad_stats_real_glSpecializeShaderARB = 0;
+static void APIENTRY glad_stats_impl_glSpecializeShaderARB(GLuint arg0, const GLchar * arg1, GLuint arg2, const GLuint * arg3, const GLuint * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glSpecializeShaderARB]++;
+	glad_stats_real_glSpecializeShaderARB(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLSTENCILFUNCPROC glad_stats_real_glStencilFunc = 0;
+static void APIENTRY glad_stats_impl_glStencilFunc(GLenum arg0, GLint arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glStencilFunc]++;
+	glad_stats_real_glStencilFunc(arg0, arg1, arg2);
+}
+static PFNGLSTENCILFUNCSEPARATEPROC glad_stats_real_glStencilFuncSeparate = 0;
+static void APIENTRY glad_stats_impl_glStencilFuncSeparate(GLenum arg0, GLenum arg1, GLint arg2, GLuint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glStencilFuncSeparate]++;
+	glad_stats_real_glStencilFuncSeparate(arg0, arg1, arg2, arg3);
+}
+static PFNGLSTENCILMASKPROC glad_stats_real_glStencilMask = 0;
+static void APIENTRY glad_stats_impl_glStencilMask(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glStencilMask]++;
+	glad_stats_real_glStencilMask(arg0);
+}
+static PFNGLSTENCILMASKSEPARATEPROC glad_stats_real_glStencilMaskSeparate = 0;
+static void APIENTRY glad_stats_impl_glStencilMaskSeparate(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glStencilMaskSeparate]++;
+	glad_stats_real_glStencilMaskSeparate(arg0, arg1);
+}
+static PFNGLSTENCILOPPROC glad_stats_real_glStencilOp = 0;
+static void APIENTRY glad_stats_impl_glStencilOp(GLenum arg0, GLenum arg1, GLenum arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glStencilOp]++;
+	glad_stats_real_glStencilOp(arg0, arg1, arg2);
+}
+static PFNGLSTENCILOPSEPARATEPROC glad_stats_real_glStencilOpSeparate = 0;
+static void APIENTRY glad_stats_impl_glStencilOpSeparate(GLenum arg0, GLenum arg1, GLenum arg2, GLenum arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glStencilOpSeparate]++;
+	glad_stats_real_glStencilOpSeparate(arg0, arg1, arg2, arg3);
+}
+static PFNGLTEXBUFFERPROC glad_stats_real_glTexBuffer = 0;
+static void APIENTRY glad_stats_impl_glTexBuffer(GLenum arg0, GLenum arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexBuffer]++;
+	glad_stats_real_glTexBuffer(arg0, arg1, arg2);
+}
+static PFNGLTEXBUFFERRANGEPROC glad_stats_real_glTexBufferRange = 0;
+static void APIENTRY glad_stats_impl_glTexBufferRange(GLenum arg0, GLenum arg1, GLuint arg2, GLintptr arg3, GLsizeiptr arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexBufferRange]++;
+	glad_stats_real_glTexBufferRange(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLTEXCOORD1DPROC glad_stats_real_glTexCoord1d = 0;
+static void APIENTRY glad_stats_impl_glTexCoord1d(GLdouble arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord1d]++;
+	glad_stats_real_glTexCoord1d(arg0);
+}
+static PFNGLTEXCOORD1DVPROC glad_stats_real_glTexCoord1dv = 0;
+static void APIENTRY glad_stats_impl_glTexCoord1dv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord1dv]++;
+	glad_stats_real_glTexCoord1dv(arg0);
+}
+static PFNGLTEXCOORD1FPROC glad_stats_real_glTexCoord1f = 0;
+static void APIENTRY glad_stats_impl_glTexCoord1f(GLfloat arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord1f]++;
+	glad_stats_real_glTexCoord1f(arg0);
+}
+static PFNGLTEXCOORD1FVPROC glad_stats_real_glTexCoord1fv = 0;
+static void APIENTRY glad_stats_impl_glTexCoord1fv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord1fv]++;
+	glad_stats_real_glTexCoord1fv(arg0);
+}
+static PFNGLTEXCOORD1IPROC glad_stats_real_glTexCoord1i = 0;
+static void APIENTRY glad_stats_impl_glTexCoord1i(GLint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord1i]++;
+	glad_stats_real_glTexCoord1i(arg0);
+}
+static PFNGLTEXCOORD1IVPROC glad_stats_real_glTexCoord1iv = 0;
+static void APIENTRY glad_stats_impl_glTexCoord1iv(const GLint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord1iv]++;
+	glad_stats_real_glTexCoord1iv(arg0);
+}
+static PFNGLTEXCOORD1SPROC glad_stats_real_glTexCoord1s = 0;
+static void APIENTRY glad_stats_impl_glTexCoord1s(GLshort arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord1s]++;
+	glad_stats_real_glTexCoord1s(arg0);
+}
+static PFNGLTEXCOORD1SVPROC glad_stats_real_glTexCoord1sv = 0;
+static void APIENTRY glad_stats_impl_glTexCoord1sv(const GLshort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord1sv]++;
+	glad_stats_real_glTexCoord1sv(arg0);
+}
+static PFNGLTEXCOORD2DPROC glad_stats_real_glTexCoord2d = 0;
+static void APIENTRY glad_stats_impl_glTexCoord2d(GLdouble arg0, GLdouble arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord2d]++;
+	glad_stats_real_glTexCoord2d(arg0, arg1);
+}
+static PFNGLTEXCOORD2DVPROC glad_stats_real_glTexCoord2dv = 0;
+static void APIENTRY glad_stats_impl_glTexCoord2dv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord2dv]++;
+	glad_stats_real_glTexCoord2dv(arg0);
+}
+static PFNGLTEXCOORD2FPROC glad_stats_real_glTexCoord2f = 0;
+static void APIENTRY glad_stats_impl_glTexCoord2f(GLfloat arg0, GLfloat arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord2f]++;
+	glad_stats_real_glTexCoord2f(arg0, arg1);
+}
+static PFNGLTEXCOORD2FVPROC glad_stats_real_glTexCoord2fv = 0;
+static void APIENTRY glad_stats_impl_glTexCoord2fv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord2fv]++;
+	glad_stats_real_glTexCoord2fv(arg0);
+}
+static PFNGLTEXCOORD2IPROC glad_stats_real_glTexCoord2i = 0;
+static void APIENTRY glad_stats_impl_glTexCoord2i(GLint arg0, GLint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord2i]++;
+	glad_stats_real_glTexCoord2i(arg0, arg1);
+}
+static PFNGLTEXCOORD2IVPROC glad_stats_real_glTexCoord2iv = 0;
+static void APIENTRY glad_stats_impl_glTexCoord2iv(const GLint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord2iv]++;
+	glad_stats_real_glTexCoord2iv(arg0);
+}
+static PFNGLTEXCOORD2SPROC glad_stats_real_glTexCoord2s = 0;
+static void APIENTRY glad_stats_impl_glTexCoord2s(GLshort arg0, GLshort arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord2s]++;
+	glad_stats_real_glTexCoord2s(arg0, arg1);
+}
+static PFNGLTEXCOORD2SVPROC glad_stats_real_glTexCoord2sv = 0;
+static void APIENTRY glad_stats_impl_glTexCoord2sv(const GLshort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord2sv]++;
+	glad_stats_real_glTexCoord2sv(arg0);
+}
+static PFNGLTEXCOORD3DPROC glad_stats_real_glTexCoord3d = 0;
+static void APIENTRY glad_stats_impl_glTexCoord3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord3d]++;
+	glad_stats_real_glTexCoord3d(arg0, arg1, arg2);
+}
+static PFNGLTEXCOORD3DVPROC glad_stats_real_glTexCoord3dv = 0;
+static void APIENTRY glad_stats_impl_glTexCoord3dv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord3dv]++;
+	glad_stats_real_glTexCoord3dv(arg0);
+}
+static PFNGLTEXCOORD3FPROC glad_stats_real_glTexCoord3f = 0;
+static void APIENTRY glad_stats_impl_glTexCoord3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord3f]++;
+	glad_stats_real_glTexCoord3f(arg0, arg1, arg2);
+}
+static PFNGLTEXCOORD3FVPROC glad_stats_real_glTexCoord3fv = 0;
+static void APIENTRY glad_stats_impl_glTexCoord3fv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord3fv]++;
+	glad_stats_real_glTexCoord3fv(arg0);
+}
+static PFNGLTEXCOORD3IPROC glad_stats_real_glTexCoord3i = 0;
+static void APIENTRY glad_stats_impl_glTexCoord3i(GLint arg0, GLint arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord3i]++;
+	glad_stats_real_glTexCoord3i(arg0, arg1, arg2);
+}
+static PFNGLTEXCOORD3IVPROC glad_stats_real_glTexCoord3iv = 0;
+static void APIENTRY glad_stats_impl_glTexCoord3iv(const GLint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord3iv]++;
+	glad_stats_real_glTexCoord3iv(arg0);
+}
+static PFNGLTEXCOORD3SPROC glad_stats_real_glTexCoord3s = 0;
+static void APIENTRY glad_stats_impl_glTexCoord3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord3s]++;
+	glad_stats_real_glTexCoord3s(arg0, arg1, arg2);
+}
+static PFNGLTEXCOORD3SVPROC glad_stats_real_glTexCoord3sv = 0;
+static void APIENTRY glad_stats_impl_glTexCoord3sv(const GLshort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord3sv]++;
+	glad_stats_real_glTexCoord3sv(arg0);
+}
+static PFNGLTEXCOORD4DPROC glad_stats_real_glTexCoord4d = 0;
+static void APIENTRY glad_stats_impl_glTexCoord4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord4d]++;
+	glad_stats_real_glTexCoord4d(arg0, arg1, arg2, arg3);
+}
+static PFNGLTEXCOORD4DVPROC glad_stats_real_glTexCoord4dv = 0;
+static void APIENTRY glad_stats_impl_glTexCoord4dv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord4dv]++;
+	glad_stats_real_glTexCoord4dv(arg0);
+}
+static PFNGLTEXCOORD4FPROC glad_stats_real_glTexCoord4f = 0;
+static void APIENTRY glad_stats_impl_glTexCoord4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord4f]++;
+	glad_stats_real_glTexCoord4f(arg0, arg1, arg2, arg3);
+}
+static PFNGLTEXCOORD4FVPROC glad_stats_real_glTexCoord4fv = 0;
+static void APIENTRY glad_stats_impl_glTexCoord4fv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord4fv]++;
+	glad_stats_real_glTexCoord4fv(arg0);
+}
+static PFNGLTEXCOORD4IPROC glad_stats_real_glTexCoord4i = 0;
+static void APIENTRY glad_stats_impl_glTexCoord4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord4i]++;
+	glad_stats_real_glTexCoord4i(arg0, arg1, arg2, arg3);
+}
+static PFNGLTEXCOORD4IVPROC glad_stats_real_glTexCoord4iv = 0;
+static void APIENTRY glad_stats_impl_glTexCoord4iv(const GLint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord4iv]++;
+	glad_stats_real_glTexCoord4iv(arg0);
+}
+static PFNGLTEXCOORD4SPROC glad_stats_real_glTexCoord4s = 0;
+static void APIENTRY glad_stats_impl_glTexCoord4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord4s]++;
+	glad_stats_real_glTexCoord4s(arg0, arg1, arg2, arg3);
+}
+static PFNGLTEXCOORD4SVPROC glad_stats_real_glTexCoord4sv = 0;
+static void APIENTRY glad_stats_impl_glTexCoord4sv(const GLshort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoord4sv]++;
+	glad_stats_real_glTexCoord4sv(arg0);
+}
+static PFNGLTEXCOORDP1UIPROC glad_stats_real_glTexCoordP1ui = 0;
+static void APIENTRY glad_stats_impl_glTexCoordP1ui(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoordP1ui]++;
+	glad_stats_real_glTexCoordP1ui(arg0, arg1);
+}
+static PFNGLTEXCOORDP1UIVPROC glad_stats_real_glTexCoordP1uiv = 0;
+static void APIENTRY glad_stats_impl_glTexCoordP1uiv(GLenum arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoordP1uiv]++;
+	glad_stats_real_glTexCoordP1uiv(arg0, arg1);
+}
+static PFNGLTEXCOORDP2UIPROC glad_stats_real_glTexCoordP2ui = 0;
+static void APIENTRY glad_stats_impl_glTexCoordP2ui(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoordP2ui]++;
+	glad_stats_real_glTexCoordP2ui(arg0, arg1);
+}
+static PFNGLTEXCOORDP2UIVPROC glad_stats_real_glTexCoordP2uiv = 0;
+static void APIENTRY glad_stats_impl_glTexCoordP2uiv(GLenum arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoordP2uiv]++;
+	glad_stats_real_glTexCoordP2uiv(arg0, arg1);
+}
+static PFNGLTEXCOORDP3UIPROC glad_stats_real_glTexCoordP3ui = 0;
+static void APIENTRY glad_stats_impl_glTexCoordP3ui(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoordP3ui]++;
+	glad_stats_real_glTexCoordP3ui(arg0, arg1);
+}
+static PFNGLTEXCOORDP3UIVPROC glad_stats_real_glTexCoordP3uiv = 0;
+static void APIENTRY glad_stats_impl_glTexCoordP3uiv(GLenum arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoordP3uiv]++;
+	glad_stats_real_glTexCoordP3uiv(arg0, arg1);
+}
+static PFNGLTEXCOORDP4UIPROC glad_stats_real_glTexCoordP4ui = 0;
+static void APIENTRY glad_stats_impl_glTexCoordP4ui(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoordP4ui]++;
+	glad_stats_real_glTexCoordP4ui(arg0, arg1);
+}
+static PFNGLTEXCOORDP4UIVPROC glad_stats_real_glTexCoordP4uiv = 0;
+static void APIENTRY glad_stats_impl_glTexCoordP4uiv(GLenum arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoordP4uiv]++;
+	glad_stats_real_glTexCoordP4uiv(arg0, arg1);
+}
+static PFNGLTEXCOORDPOINTERPROC glad_stats_real_glTexCoordPointer = 0;
+static void APIENTRY glad_stats_impl_glTexCoordPointer(GLint arg0, GLenum arg1, GLsizei arg2, const void * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexCoordPointer]++;
+	glad_stats_real_glTexCoordPointer(arg0, arg1, arg2, arg3);
+}
+static PFNGLTEXENVFPROC glad_stats_real_glTexEnvf = 0;
+static void APIENTRY glad_stats_impl_glTexEnvf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexEnvf]++;
+	glad_stats_real_glTexEnvf(arg0, arg1, arg2);
+}
+static PFNGLTEXENVFVPROC glad_stats_real_glTexEnvfv = 0;
+static void APIENTRY glad_stats_impl_glTexEnvfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexEnvfv]++;
+	glad_stats_real_glTexEnvfv(arg0, arg1, arg2);
+}
+static PFNGLTEXENVIPROC glad_stats_real_glTexEnvi = 0;
+static void APIENTRY glad_stats_impl_glTexEnvi(GLenum arg0, GLenum arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexEnvi]++;
+	glad_stats_real_glTexEnvi(arg0, arg1, arg2);
+}
+static PFNGLTEXENVIVPROC glad_stats_real_glTexEnviv = 0;
+static void APIENTRY glad_stats_impl_glTexEnviv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexEnviv]++;
+	glad_stats_real_glTexEnviv(arg0, arg1, arg2);
+}
+static PFNGLTEXGENDPROC glad_stats_real_glTexGend = 0;
+static void APIENTRY glad_stats_impl_glTexGend(GLenum arg0, GLenum arg1, GLdouble arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexGend]++;
+	glad_stats_real_glTexGend(arg0, arg1, arg2);
+}
+static PFNGLTEXGENDVPROC glad_stats_real_glTexGendv = 0;
+static void APIENTRY glad_stats_impl_glTexGendv(GLenum arg0, GLenum arg1, const GLdouble * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexGendv]++;
+	glad_stats_real_glTexGendv(arg0, arg1, arg2);
+}
+static PFNGLTEXGENFPROC glad_stats_real_glTexGenf = 0;
+static void APIENTRY glad_stats_impl_glTexGenf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexGenf]++;
+	glad_stats_real_glTexGenf(arg0, arg1, arg2);
+}
+static PFNGLTEXGENFVPROC glad_stats_real_glTexGenfv = 0;
+static void APIENTRY glad_stats_impl_glTexGenfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexGenfv]++;
+	glad_stats_real_glTexGenfv(arg0, arg1, arg2);
+}
+static PFNGLTEXGENIPROC glad_stats_real_glTexGeni = 0;
+static void APIENTRY glad_stats_impl_glTexGeni(GLenum arg0, GLenum arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexGeni]++;
+	glad_stats_real_glTexGeni(arg0, arg1, arg2);
+}
+static PFNGLTEXGENIVPROC glad_stats_real_glTexGeniv = 0;
+static void APIENTRY glad_stats_impl_glTexGeniv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexGeniv]++;
+	glad_stats_real_glTexGeniv(arg0, arg1, arg2);
+}
+static PFNGLTEXIMAGE1DPROC glad_stats_real_glTexImage1D = 0;
+static void APIENTRY glad_stats_impl_glTexImage1D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLint arg4, GLenum arg5, GLenum arg6, const void * arg7) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexImage1D]++;
+	if (arg7) c->uploadBytes += gl_stats_image_bytes(arg5, arg6, arg3, 1, 1);
+	glad_stats_real_glTexImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static PFNGLTEXIMAGE2DPROC glad_stats_real_glTexImage2D = 0;
+static void APIENTRY glad_stats_impl_glTexImage2D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLsizei arg4, GLint arg5, GLenum arg6, GLenum arg7, const void * arg8) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexImage2D]++;
+	if (arg8) c->uploadBytes += gl_stats_image_bytes(arg6, arg7, arg3, arg4, 1);
+	glad_stats_real_glTexImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static PFNGLTEXIMAGE2DMULTISAMPLEPROC glad_stats_real_glTexImage2DMultisample = 0;
+static void APIENTRY glad_stats_impl_glTexImage2DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLboolean arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexImage2DMultisample]++;
+	glad_stats_real_glTexImage2DMultisample(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLTEXIMAGE3DPROC glad_stats_real_glTexImage3D = 0;
+static void APIENTRY glad_stats_impl_glTexImage3D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLint arg6, GLenum arg7, GLenum arg8, const void * arg9) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexImage3D]++;
+	if (arg9) c->uploadBytes += gl_stats_image_bytes(arg7, arg8, arg3, arg4, arg5);
+	glad_stats_real_glTexImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9);
+}
+static PFNGLTEXIMAGE3DMULTISAMPLEPROC glad_stats_real_glTexImage3DMultisample = 0;
+static void APIENTRY glad_stats_impl_glTexImage3DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLboolean arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexImage3DMultisample]++;
+	glad_stats_real_glTexImage3DMultisample(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLTEXPARAMETERIIVPROC glad_stats_real_glTexParameterIiv = 0;
+static void APIENTRY glad_stats_impl_glTexParameterIiv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexParameterIiv]++;
+	glad_stats_real_glTexParameterIiv(arg0, arg1, arg2);
+}
+static PFNGLTEXPARAMETERIUIVPROC glad_stats_real_glTexParameterIuiv = 0;
+static void APIENTRY glad_stats_impl_glTexParameterIuiv(GLenum arg0, GLenum arg1, const GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexParameterIuiv]++;
+	glad_stats_real_glTexParameterIuiv(arg0, arg1, arg2);
+}
+static PFNGLTEXPARAMETERFPROC glad_stats_real_glTexParameterf = 0;
+static void APIENTRY glad_stats_impl_glTexParameterf(GLenum arg0, GLenum arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexParameterf]++;
+	glad_stats_real_glTexParameterf(arg0, arg1, arg2);
+}
+static PFNGLTEXPARAMETERFVPROC glad_stats_real_glTexParameterfv = 0;
+static void APIENTRY glad_stats_impl_glTexParameterfv(GLenum arg0, GLenum arg1, const GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexParameterfv]++;
+	glad_stats_real_glTexParameterfv(arg0, arg1, arg2);
+}
+static PFNGLTEXPARAMETERIPROC glad_stats_real_glTexParameteri = 0;
+static void APIENTRY glad_stats_impl_glTexParameteri(GLenum arg0, GLenum arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexParameteri]++;
+	glad_stats_real_glTexParameteri(arg0, arg1, arg2);
+}
+static PFNGLTEXPARAMETERIVPROC glad_stats_real_glTexParameteriv = 0;
+static void APIENTRY glad_stats_impl_glTexParameteriv(GLenum arg0, GLenum arg1, const GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexParameteriv]++;
+	glad_stats_real_glTexParameteriv(arg0, arg1, arg2);
+}
+static PFNGLTEXSTORAGE1DPROC glad_stats_real_glTexStorage1D = 0;
+static void APIENTRY glad_stats_impl_glTexStorage1D(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexStorage1D]++;
+	glad_stats_real_glTexStorage1D(arg0, arg1, arg2, arg3);
+}
+static PFNGLTEXSTORAGE2DPROC glad_stats_real_glTexStorage2D = 0;
+static void APIENTRY glad_stats_impl_glTexStorage2D(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexStorage2D]++;
+	glad_stats_real_glTexStorage2D(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLTEXSTORAGE2DMULTISAMPLEPROC glad_stats_real_glTexStorage2DMultisample = 0;
+static void APIENTRY glad_stats_impl_glTexStorage2DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLboolean arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexStorage2DMultisample]++;
+	glad_stats_real_glTexStorage2DMultisample(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLTEXSTORAGE3DPROC glad_stats_real_glTexStorage3D = 0;
+static void APIENTRY glad_stats_impl_glTexStorage3D(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexStorage3D]++;
+	glad_stats_real_glTexStorage3D(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLTEXSTORAGE3DMULTISAMPLEPROC glad_stats_real_glTexStorage3DMultisample = 0;
+static void APIENTRY glad_stats_impl_glTexStorage3DMultisample(GLenum arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLboolean arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexStorage3DMultisample]++;
+	glad_stats_real_glTexStorage3DMultisample(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLTEXSUBIMAGE1DPROC glad_stats_real_glTexSubImage1D = 0;
+static void APIENTRY glad_stats_impl_glTexSubImage1D(GLenum arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLenum arg5, const void * arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexSubImage1D]++;
+	c->uploadBytes += gl_stats_image_bytes(arg4, arg5, arg3, 1, 1);
+	glad_stats_real_glTexSubImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLTEXSUBIMAGE2DPROC glad_stats_real_glTexSubImage2D = 0;
+static void APIENTRY glad_stats_impl_glTexSubImage2D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLenum arg7, const void * arg8) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexSubImage2D]++;
+	c->uploadBytes += gl_stats_image_bytes(arg6, arg7, arg4, arg5, 1);
+	glad_stats_real_glTexSubImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static PFNGLTEXSUBIMAGE3DPROC glad_stats_real_glTexSubImage3D = 0;
+static void APIENTRY glad_stats_impl_glTexSubImage3D(GLenum arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLenum arg9, const void * arg10) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTexSubImage3D]++;
+	c->uploadBytes += gl_stats_image_bytes(arg8, arg9, arg5, arg6, arg7);
+	glad_stats_real_glTexSubImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+static PFNGLTEXTUREBARRIERPROC glad_stats_real_glTextureBarrier = 0;
+static void APIENTRY glad_stats_impl_glTextureBarrier(void) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTextureBarrier]++;
+	glad_stats_real_glTextureBarrier();
+}
+static PFNGLTEXTUREBUFFERPROC glad_stats_real_glTextureBuffer = 0;
+static void APIENTRY glad_stats_impl_glTextureBuffer(GLuint arg0, GLenum arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTextureBuffer]++;
+	glad_stats_real_glTextureBuffer(arg0, arg1, arg2);
+}
+static PFNGLTEXTUREBUFFERRANGEPROC glad_stats_real_glTextureBufferRange = 0;
+static void APIENTRY glad_stats_impl_glTextureBufferRange(GLuint arg0, GLenum arg1, GLuint arg2, GLintptr arg3, GLsizeiptr arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTextureBufferRange]++;
+	glad_stats_real_glTextureBufferRange(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLTEXTUREPARAMETERIIVPROC glad_stats_real_glTextureParameterIiv = 0;
+static void APIENTRY glad_stats_impl_glTextureParameterIiv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTextureParameterIiv]++;
+	glad_stats_real_glTextureParameterIiv(arg0, arg1, arg2);
+}
+static PFNGLTEXTUREPARAMETERIUIVPROC glad_stats_real_glTextureParameterIuiv = 0;
+static void APIENTRY glad_stats_impl_glTextureParameterIuiv(GLuint arg0, GLenum arg1, const GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTextureParameterIuiv]++;
+	glad_stats_real_glTextureParameterIuiv(arg0, arg1, arg2);
+}
+static PFNGLTEXTUREPARAMETERFPROC glad_stats_real_glTextureParameterf = 0;
+static void APIENTRY glad_stats_impl_glTextureParameterf(GLuint arg0, GLenum arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTextureParameterf]++;
+	glad_stats_real_glTextureParameterf(arg0, arg1, arg2);
+}
+static PFNGLTEXTUREPARAMETERFVPROC glad_stats_real_glTextureParameterfv = 0;
+static void APIENTRY glad_stats_impl_glTextureParameterfv(GLuint arg0, GLenum arg1, const GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTextureParameterfv]++;
+	glad_stats_real_glTextureParameterfv(arg0, arg1, arg2);
+}
+static PFNGLTEXTUREPARAMETERIPROC glad_stats_real_glTextureParameteri = 0;
+static void APIENTRY glad_stats_impl_glTextureParameteri(GLuint arg0, GLenum arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTextureParameteri]++;
+	glad_stats_real_glTextureParameteri(arg0, arg1, arg2);
+}
+static PFNGLTEXTUREPARAMETERIVPROC glad_stats_real_glTextureParameteriv = 0;
+static void APIENTRY glad_stats_impl_glTextureParameteriv(GLuint arg0, GLenum arg1, const GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTextureParameteriv]++;
+	glad_stats_real_glTextureParameteriv(arg0, arg1, arg2);
+}
+static PFNGLTEXTURESTORAGE1DPROC glad_stats_real_glTextureStorage1D = 0;
+static void APIENTRY glad_stats_impl_glTextureStorage1D(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTextureStorage1D]++;
+	glad_stats_real_glTextureStorage1D(arg0, arg1, arg2, arg3);
+}
+static PFNGLTEXTURESTORAGE2DPROC glad_stats_real_glTextureStorage2D = 0;
+static void APIENTRY glad_stats_impl_glTextureStorage2D(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTextureStorage2D]++;
+	glad_stats_real_glTextureStorage2D(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC glad_stats_real_glTextureStorage2DMultisample = 0;
+static void APIENTRY glad_stats_impl_glTextureStorage2DMultisample(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLboolean arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTextureStorage2DMultisample]++;
+	glad_stats_real_glTextureStorage2DMultisample(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLTEXTURESTORAGE3DPROC glad_stats_real_glTextureStorage3D = 0;
+static void APIENTRY glad_stats_impl_glTextureStorage3D(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTextureStorage3D]++;
+	glad_stats_real_glTextureStorage3D(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC glad_stats_real_glTextureStorage3DMultisample = 0;
+static void APIENTRY glad_stats_impl_glTextureStorage3DMultisample(GLuint arg0, GLsizei arg1, GLenum arg2, GLsizei arg3, GLsizei arg4, GLsizei arg5, GLboolean arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTextureStorage3DMultisample]++;
+	glad_stats_real_glTextureStorage3DMultisample(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLTEXTURESUBIMAGE1DPROC glad_stats_real_glTextureSubImage1D = 0;
+static void APIENTRY glad_stats_impl_glTextureSubImage1D(GLuint arg0, GLint arg1, GLint arg2, GLsizei arg3, GLenum arg4, GLenum arg5, const void * arg6) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTextureSubImage1D]++;
+	c->uploadBytes += gl_stats_image_bytes(arg4, arg5, arg3, 1, 1);
+	glad_stats_real_glTextureSubImage1D(arg0, arg1, arg2, arg3, arg4, arg5, arg6);
+}
+static PFNGLTEXTURESUBIMAGE2DPROC glad_stats_real_glTextureSubImage2D = 0;
+static void APIENTRY glad_stats_impl_glTextureSubImage2D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLsizei arg4, GLsizei arg5, GLenum arg6, GLenum arg7, const void * arg8) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTextureSubImage2D]++;
+	c->uploadBytes += gl_stats_image_bytes(arg6, arg7, arg4, arg5, 1);
+	glad_stats_real_glTextureSubImage2D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8);
+}
+static PFNGLTEXTURESUBIMAGE3DPROC glad_stats_real_glTextureSubImage3D = 0;
+static void APIENTRY glad_stats_impl_glTextureSubImage3D(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4, GLsizei arg5, GLsizei arg6, GLsizei arg7, GLenum arg8, GLenum arg9, const void * arg10) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTextureSubImage3D]++;
+	c->uploadBytes += gl_stats_image_bytes(arg8, arg9, arg5, arg6, arg7);
+	glad_stats_real_glTextureSubImage3D(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10);
+}
+static PFNGLTEXTUREVIEWPROC glad_stats_real_glTextureView = 0;
+static void APIENTRY glad_stats_impl_glTextureView(GLuint arg0, GLenum arg1, GLuint arg2, GLenum arg3, GLuint arg4, GLuint arg5, GLuint arg6, GLuint arg7) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTextureView]++;
+	glad_stats_real_glTextureView(arg0, arg1, arg2, arg3, arg4, arg5, arg6, arg7);
+}
+static PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC glad_stats_real_glTransformFeedbackBufferBase = 0;
+static void APIENTRY glad_stats_impl_glTransformFeedbackBufferBase(GLuint arg0, GLuint arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTransformFeedbackBufferBase]++;
+	glad_stats_real_glTransformFeedbackBufferBase(arg0, arg1, arg2);
+}
+static PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC glad_stats_real_glTransformFeedbackBufferRange = 0;
+static void APIENTRY glad_stats_impl_glTransformFeedbackBufferRange(GLuint arg0, GLuint arg1, GLuint arg2, GLintptr arg3, GLsizeiptr arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTransformFeedbackBufferRange]++;
+	glad_stats_real_glTransformFeedbackBufferRange(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLTRANSFORMFEEDBACKVARYINGSPROC glad_stats_real_glTransformFeedbackVaryings = 0;
+static void APIENTRY glad_stats_impl_glTransformFeedbackVaryings(GLuint arg0, GLsizei arg1, const GLchar *const * arg2, GLenum arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTransformFeedbackVaryings]++;
+	glad_stats_real_glTransformFeedbackVaryings(arg0, arg1, arg2, arg3);
+}
+static PFNGLTRANSLATEDPROC glad_stats_real_glTranslated = 0;
+static void APIENTRY glad_stats_impl_glTranslated(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTranslated]++;
+	glad_stats_real_glTranslated(arg0, arg1, arg2);
+}
+static PFNGLTRANSLATEFPROC glad_stats_real_glTranslatef = 0;
+static void APIENTRY glad_stats_impl_glTranslatef(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glTranslatef]++;
+	glad_stats_real_glTranslatef(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM1DPROC glad_stats_real_glUniform1d = 0;
+static void APIENTRY glad_stats_impl_glUniform1d(GLint arg0, GLdouble arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform1d]++;
+	glad_stats_real_glUniform1d(arg0, arg1);
+}
+static PFNGLUNIFORM1DVPROC glad_stats_real_glUniform1dv = 0;
+static void APIENTRY glad_stats_impl_glUniform1dv(GLint arg0, GLsizei arg1, const GLdouble * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform1dv]++;
+	glad_stats_real_glUniform1dv(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM1FPROC glad_stats_real_glUniform1f = 0;
+static void APIENTRY glad_stats_impl_glUniform1f(GLint arg0, GLfloat arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform1f]++;
+	glad_stats_real_glUniform1f(arg0, arg1);
+}
+static PFNGLUNIFORM1FVPROC glad_stats_real_glUniform1fv = 0;
+static void APIENTRY glad_stats_impl_glUniform1fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform1fv]++;
+	glad_stats_real_glUniform1fv(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM1IPROC glad_stats_real_glUniform1i = 0;
+static void APIENTRY glad_stats_impl_glUniform1i(GLint arg0, GLint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform1i]++;
+	glad_stats_real_glUniform1i(arg0, arg1);
+}
+static PFNGLUNIFORM1IVPROC glad_stats_real_glUniform1iv = 0;
+static void APIENTRY glad_stats_impl_glUniform1iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform1iv]++;
+	glad_stats_real_glUniform1iv(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM1UIPROC glad_stats_real_glUniform1ui = 0;
+static void APIENTRY glad_stats_impl_glUniform1ui(GLint arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform1ui]++;
+	glad_stats_real_glUniform1ui(arg0, arg1);
+}
+static PFNGLUNIFORM1UIVPROC glad_stats_real_glUniform1uiv = 0;
+static void APIENTRY glad_stats_impl_glUniform1uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform1uiv]++;
+	glad_stats_real_glUniform1uiv(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM2DPROC glad_stats_real_glUniform2d = 0;
+static void APIENTRY glad_stats_impl_glUniform2d(GLint arg0, GLdouble arg1, GLdouble arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform2d]++;
+	glad_stats_real_glUniform2d(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM2DVPROC glad_stats_real_glUniform2dv = 0;
+static void APIENTRY glad_stats_impl_glUniform2dv(GLint arg0, GLsizei arg1, const GLdouble * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform2dv]++;
+	glad_stats_real_glUniform2dv(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM2FPROC glad_stats_real_glUniform2f = 0;
+static void APIENTRY glad_stats_impl_glUniform2f(GLint arg0, GLfloat arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform2f]++;
+	glad_stats_real_glUniform2f(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM2FVPROC glad_stats_real_glUniform2fv = 0;
+static void APIENTRY glad_stats_impl_glUniform2fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform2fv]++;
+	glad_stats_real_glUniform2fv(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM2IPROC glad_stats_real_glUniform2i = 0;
+static void APIENTRY glad_stats_impl_glUniform2i(GLint arg0, GLint arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform2i]++;
+	glad_stats_real_glUniform2i(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM2IVPROC glad_stats_real_glUniform2iv = 0;
+static void APIENTRY glad_stats_impl_glUniform2iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform2iv]++;
+	glad_stats_real_glUniform2iv(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM2UIPROC glad_stats_real_glUniform2ui = 0;
+static void APIENTRY glad_stats_impl_glUniform2ui(GLint arg0, GLuint arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform2ui]++;
+	glad_stats_real_glUniform2ui(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM2UIVPROC glad_stats_real_glUniform2uiv = 0;
+static void APIENTRY glad_stats_impl_glUniform2uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform2uiv]++;
+	glad_stats_real_glUniform2uiv(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM3DPROC glad_stats_real_glUniform3d = 0;
+static void APIENTRY glad_stats_impl_glUniform3d(GLint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform3d]++;
+	glad_stats_real_glUniform3d(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORM3DVPROC glad_stats_real_glUniform3dv = 0;
+static void APIENTRY glad_stats_impl_glUniform3dv(GLint arg0, GLsizei arg1, const GLdouble * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform3dv]++;
+	glad_stats_real_glUniform3dv(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM3FPROC glad_stats_real_glUniform3f = 0;
+static void APIENTRY glad_stats_impl_glUniform3f(GLint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform3f]++;
+	glad_stats_real_glUniform3f(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORM3FVPROC glad_stats_real_glUniform3fv = 0;
+static void APIENTRY glad_stats_impl_glUniform3fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform3fv]++;
+	glad_stats_real_glUniform3fv(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM3IPROC glad_stats_real_glUniform3i = 0;
+static void APIENTRY glad_stats_impl_glUniform3i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform3i]++;
+	glad_stats_real_glUniform3i(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORM3IVPROC glad_stats_real_glUniform3iv = 0;
+static void APIENTRY glad_stats_impl_glUniform3iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform3iv]++;
+	glad_stats_real_glUniform3iv(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM3UIPROC glad_stats_real_glUniform3ui = 0;
+static void APIENTRY glad_stats_impl_glUniform3ui(GLint arg0, GLuint arg1, GLuint arg2, GLuint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform3ui]++;
+	glad_stats_real_glUniform3ui(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORM3UIVPROC glad_stats_real_glUniform3uiv = 0;
+static void APIENTRY glad_stats_impl_glUniform3uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform3uiv]++;
+	glad_stats_real_glUniform3uiv(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM4DPROC glad_stats_real_glUniform4d = 0;
+static void APIENTRY glad_stats_impl_glUniform4d(GLint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform4d]++;
+	glad_stats_real_glUniform4d(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLUNIFORM4DVPROC glad_stats_real_glUniform4dv = 0;
+static void APIENTRY glad_stats_impl_glUniform4dv(GLint arg0, GLsizei arg1, const GLdouble * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform4dv]++;
+	glad_stats_real_glUniform4dv(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM4FPROC glad_stats_real_glUniform4f = 0;
+static void APIENTRY glad_stats_impl_glUniform4f(GLint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform4f]++;
+	glad_stats_real_glUniform4f(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLUNIFORM4FVPROC glad_stats_real_glUniform4fv = 0;
+static void APIENTRY glad_stats_impl_glUniform4fv(GLint arg0, GLsizei arg1, const GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform4fv]++;
+	glad_stats_real_glUniform4fv(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM4IPROC glad_stats_real_glUniform4i = 0;
+static void APIENTRY glad_stats_impl_glUniform4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform4i]++;
+	glad_stats_real_glUniform4i(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLUNIFORM4IVPROC glad_stats_real_glUniform4iv = 0;
+static void APIENTRY glad_stats_impl_glUniform4iv(GLint arg0, GLsizei arg1, const GLint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform4iv]++;
+	glad_stats_real_glUniform4iv(arg0, arg1, arg2);
+}
+static PFNGLUNIFORM4UIPROC glad_stats_real_glUniform4ui = 0;
+static void APIENTRY glad_stats_impl_glUniform4ui(GLint arg0, GLuint arg1, GLuint arg2, GLuint arg3, GLuint arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform4ui]++;
+	glad_stats_real_glUniform4ui(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLUNIFORM4UIVPROC glad_stats_real_glUniform4uiv = 0;
+static void APIENTRY glad_stats_impl_glUniform4uiv(GLint arg0, GLsizei arg1, const GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniform4uiv]++;
+	glad_stats_real_glUniform4uiv(arg0, arg1, arg2);
+}
+static PFNGLUNIFORMBLOCKBINDINGPROC glad_stats_real_glUniformBlockBinding = 0;
+static void APIENTRY glad_stats_impl_glUniformBlockBinding(GLuint arg0, GLuint arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformBlockBinding]++;
+	glad_stats_real_glUniformBlockBinding(arg0, arg1, arg2);
+}
+static PFNGLUNIFORMHANDLEUI64ARBPROC glad_stats_real_glUniformHandleui64ARB = 0;
+static void APIENTRY glad_stats_impl_glUniformHandleui64ARB(GLint arg0, GLuint64 arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformHandleui64ARB]++;
+	glad_stats_real_glUniformHandleui64ARB(arg0, arg1);
+}
+static PFNGLUNIFORMHANDLEUI64VARBPROC glad_stats_real_glUniformHandleui64vARB = 0;
+static void APIENTRY glad_stats_impl_glUniformHandleui64vARB(GLint arg0, GLsizei arg1, const GLuint64 * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformHandleui64vARB]++;
+	glad_stats_real_glUniformHandleui64vARB(arg0, arg1, arg2);
+}
+static PFNGLUNIFORMMATRIX2DVPROC glad_stats_real_glUniformMatrix2dv = 0;
+static void APIENTRY glad_stats_impl_glUniformMatrix2dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformMatrix2dv]++;
+	glad_stats_real_glUniformMatrix2dv(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORMMATRIX2FVPROC glad_stats_real_glUniformMatrix2fv = 0;
+static void APIENTRY glad_stats_impl_glUniformMatrix2fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformMatrix2fv]++;
+	glad_stats_real_glUniformMatrix2fv(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORMMATRIX2X3DVPROC glad_stats_real_glUniformMatrix2x3dv = 0;
+static void APIENTRY glad_stats_impl_glUniformMatrix2x3dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformMatrix2x3dv]++;
+	glad_stats_real_glUniformMatrix2x3dv(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORMMATRIX2X3FVPROC glad_stats_real_glUniformMatrix2x3fv = 0;
+static void APIENTRY glad_stats_impl_glUniformMatrix2x3fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformMatrix2x3fv]++;
+	glad_stats_real_glUniformMatrix2x3fv(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORMMATRIX2X4DVPROC glad_stats_real_glUniformMatrix2x4dv = 0;
+static void APIENTRY glad_stats_impl_glUniformMatrix2x4dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformMatrix2x4dv]++;
+	glad_stats_real_glUniformMatrix2x4dv(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORMMATRIX2X4FVPROC glad_stats_real_glUniformMatrix2x4fv = 0;
+static void APIENTRY glad_stats_impl_glUniformMatrix2x4fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformMatrix2x4fv]++;
+	glad_stats_real_glUniformMatrix2x4fv(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORMMATRIX3DVPROC glad_stats_real_glUniformMatrix3dv = 0;
+static void APIENTRY glad_stats_impl_glUniformMatrix3dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformMatrix3dv]++;
+	glad_stats_real_glUniformMatrix3dv(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORMMATRIX3FVPROC glad_stats_real_glUniformMatrix3fv = 0;
+static void APIENTRY glad_stats_impl_glUniformMatrix3fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformMatrix3fv]++;
+	glad_stats_real_glUniformMatrix3fv(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORMMATRIX3X2DVPROC glad_stats_real_glUniformMatrix3x2dv = 0;
+static void APIENTRY glad_stats_impl_glUniformMatrix3x2dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformMatrix3x2dv]++;
+	glad_stats_real_glUniformMatrix3x2dv(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORMMATRIX3X2FVPROC glad_stats_real_glUniformMatrix3x2fv = 0;
+static void APIENTRY glad_stats_impl_glUniformMatrix3x2fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformMatrix3x2fv]++;
+	glad_stats_real_glUniformMatrix3x2fv(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORMMATRIX3X4DVPROC glad_stats_real_glUniformMatrix3x4dv = 0;
+static void APIENTRY glad_stats_impl_glUniformMatrix3x4dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformMatrix3x4dv]++;
+	glad_stats_real_glUniformMatrix3x4dv(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORMMATRIX3X4FVPROC glad_stats_real_glUniformMatrix3x4fv = 0;
+static void APIENTRY glad_stats_impl_glUniformMatrix3x4fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformMatrix3x4fv]++;
+	glad_stats_real_glUniformMatrix3x4fv(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORMMATRIX4DVPROC glad_stats_real_glUniformMatrix4dv = 0;
+static void APIENTRY glad_stats_impl_glUniformMatrix4dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformMatrix4dv]++;
+	glad_stats_real_glUniformMatrix4dv(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORMMATRIX4FVPROC glad_stats_real_glUniformMatrix4fv = 0;
+static void APIENTRY glad_stats_impl_glUniformMatrix4fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformMatrix4fv]++;
+	glad_stats_real_glUniformMatrix4fv(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORMMATRIX4X2DVPROC glad_stats_real_glUniformMatrix4x2dv = 0;
+static void APIENTRY glad_stats_impl_glUniformMatrix4x2dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformMatrix4x2dv]++;
+	glad_stats_real_glUniformMatrix4x2dv(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORMMATRIX4X2FVPROC glad_stats_real_glUniformMatrix4x2fv = 0;
+static void APIENTRY glad_stats_impl_glUniformMatrix4x2fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformMatrix4x2fv]++;
+	glad_stats_real_glUniformMatrix4x2fv(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORMMATRIX4X3DVPROC glad_stats_real_glUniformMatrix4x3dv = 0;
+static void APIENTRY glad_stats_impl_glUniformMatrix4x3dv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLdouble * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformMatrix4x3dv]++;
+	glad_stats_real_glUniformMatrix4x3dv(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORMMATRIX4X3FVPROC glad_stats_real_glUniformMatrix4x3fv = 0;
+static void APIENTRY glad_stats_impl_glUniformMatrix4x3fv(GLint arg0, GLsizei arg1, GLboolean arg2, const GLfloat * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformMatrix4x3fv]++;
+	glad_stats_real_glUniformMatrix4x3fv(arg0, arg1, arg2, arg3);
+}
+static PFNGLUNIFORMSUBROUTINESUIVPROC glad_stats_real_glUniformSubroutinesuiv = 0;
+static void APIENTRY glad_stats_impl_glUniformSubroutinesuiv(GLenum arg0, GLsizei arg1, const GLuint * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUniformSubroutinesuiv]++;
+	glad_stats_real_glUniformSubroutinesuiv(arg0, arg1, arg2);
+}
+static PFNGLUNMAPBUFFERPROC glad_stats_real_glUnmapBuffer = 0;
+static GLboolean APIENTRY glad_stats_impl_glUnmapBuffer(GLenum arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUnmapBuffer]++;
+	return glad_stats_real_glUnmapBuffer(arg0);
+}
+static PFNGLUNMAPNAMEDBUFFERPROC glad_stats_real_glUnmapNamedBuffer = 0;
+static GLboolean APIENTRY glad_stats_impl_glUnmapNamedBuffer(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUnmapNamedBuffer]++;
+	return glad_stats_real_glUnmapNamedBuffer(arg0);
+}
+static PFNGLUSEPROGRAMPROC glad_stats_real_glUseProgram = 0;
+static void APIENTRY glad_stats_impl_glUseProgram(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUseProgram]++;
+	glad_stats_real_glUseProgram(arg0);
+}
+static PFNGLUSEPROGRAMSTAGESPROC glad_stats_real_glUseProgramStages = 0;
+static void APIENTRY glad_stats_impl_glUseProgramStages(GLuint arg0, GLbitfield arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glUseProgramStages]++;
+	glad_stats_real_glUseProgramStages(arg0, arg1, arg2);
+}
+static PFNGLVALIDATEPROGRAMPROC glad_stats_real_glValidateProgram = 0;
+static void APIENTRY glad_stats_impl_glValidateProgram(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glValidateProgram]++;
+	glad_stats_real_glValidateProgram(arg0);
+}
+static PFNGLVALIDATEPROGRAMPIPELINEPROC glad_stats_real_glValidateProgramPipeline = 0;
+static void APIENTRY glad_stats_impl_glValidateProgramPipeline(GLuint arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glValidateProgramPipeline]++;
+	glad_stats_real_glValidateProgramPipeline(arg0);
+}
+static PFNGLVERTEX2DPROC glad_stats_real_glVertex2d = 0;
+static void APIENTRY glad_stats_impl_glVertex2d(GLdouble arg0, GLdouble arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex2d]++;
+	glad_stats_real_glVertex2d(arg0, arg1);
+}
+static PFNGLVERTEX2DVPROC glad_stats_real_glVertex2dv = 0;
+static void APIENTRY glad_stats_impl_glVertex2dv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex2dv]++;
+	glad_stats_real_glVertex2dv(arg0);
+}
+static PFNGLVERTEX2FPROC glad_stats_real_glVertex2f = 0;
+static void APIENTRY glad_stats_impl_glVertex2f(GLfloat arg0, GLfloat arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex2f]++;
+	glad_stats_real_glVertex2f(arg0, arg1);
+}
+static PFNGLVERTEX2FVPROC glad_stats_real_glVertex2fv = 0;
+static void APIENTRY glad_stats_impl_glVertex2fv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex2fv]++;
+	glad_stats_real_glVertex2fv(arg0);
+}
+static PFNGLVERTEX2IPROC glad_stats_real_glVertex2i = 0;
+static void APIENTRY glad_stats_impl_glVertex2i(GLint arg0, GLint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex2i]++;
+	glad_stats_real_glVertex2i(arg0, arg1);
+}
+static PFNGLVERTEX2IVPROC glad_stats_real_glVertex2iv = 0;
+static void APIENTRY glad_stats_impl_glVertex2iv(const GLint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex2iv]++;
+	glad_stats_real_glVertex2iv(arg0);
+}
+static PFNGLVERTEX2SPROC glad_stats_real_glVertex2s = 0;
+static void APIENTRY glad_stats_impl_glVertex2s(GLshort arg0, GLshort arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex2s]++;
+	glad_stats_real_glVertex2s(arg0, arg1);
+}
+static PFNGLVERTEX2SVPROC glad_stats_real_glVertex2sv = 0;
+static void APIENTRY glad_stats_impl_glVertex2sv(const GLshort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex2sv]++;
+	glad_stats_real_glVertex2sv(arg0);
+}
+static PFNGLVERTEX3DPROC glad_stats_real_glVertex3d = 0;
+static void APIENTRY glad_stats_impl_glVertex3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex3d]++;
+	glad_stats_real_glVertex3d(arg0, arg1, arg2);
+}
+static PFNGLVERTEX3DVPROC glad_stats_real_glVertex3dv = 0;
+static void APIENTRY glad_stats_impl_glVertex3dv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex3dv]++;
+	glad_stats_real_glVertex3dv(arg0);
+}
+static PFNGLVERTEX3FPROC glad_stats_real_glVertex3f = 0;
+static void APIENTRY glad_stats_impl_glVertex3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex3f]++;
+	glad_stats_real_glVertex3f(arg0, arg1, arg2);
+}
+static PFNGLVERTEX3FVPROC glad_stats_real_glVertex3fv = 0;
+static void APIENTRY glad_stats_impl_glVertex3fv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex3fv]++;
+	glad_stats_real_glVertex3fv(arg0);
+}
+static PFNGLVERTEX3IPROC glad_stats_real_glVertex3i = 0;
+static void APIENTRY glad_stats_impl_glVertex3i(GLint arg0, GLint arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex3i]++;
+	glad_stats_real_glVertex3i(arg0, arg1, arg2);
+}
+static PFNGLVERTEX3IVPROC glad_stats_real_glVertex3iv = 0;
+static void APIENTRY glad_stats_impl_glVertex3iv(const GLint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex3iv]++;
+	glad_stats_real_glVertex3iv(arg0);
+}
+static PFNGLVERTEX3SPROC glad_stats_real_glVertex3s = 0;
+static void APIENTRY glad_stats_impl_glVertex3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex3s]++;
+	glad_stats_real_glVertex3s(arg0, arg1, arg2);
+}
+static PFNGLVERTEX3SVPROC glad_stats_real_glVertex3sv = 0;
+static void APIENTRY glad_stats_impl_glVertex3sv(const GLshort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex3sv]++;
+	glad_stats_real_glVertex3sv(arg0);
+}
+static PFNGLVERTEX4DPROC glad_stats_real_glVertex4d = 0;
+static void APIENTRY glad_stats_impl_glVertex4d(GLdouble arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex4d]++;
+	glad_stats_real_glVertex4d(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEX4DVPROC glad_stats_real_glVertex4dv = 0;
+static void APIENTRY glad_stats_impl_glVertex4dv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex4dv]++;
+	glad_stats_real_glVertex4dv(arg0);
+}
+static PFNGLVERTEX4FPROC glad_stats_real_glVertex4f = 0;
+static void APIENTRY glad_stats_impl_glVertex4f(GLfloat arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex4f]++;
+	glad_stats_real_glVertex4f(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEX4FVPROC glad_stats_real_glVertex4fv = 0;
+static void APIENTRY glad_stats_impl_glVertex4fv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex4fv]++;
+	glad_stats_real_glVertex4fv(arg0);
+}
+static PFNGLVERTEX4IPROC glad_stats_real_glVertex4i = 0;
+static void APIENTRY glad_stats_impl_glVertex4i(GLint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex4i]++;
+	glad_stats_real_glVertex4i(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEX4IVPROC glad_stats_real_glVertex4iv = 0;
+static void APIENTRY glad_stats_impl_glVertex4iv(const GLint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex4iv]++;
+	glad_stats_real_glVertex4iv(arg0);
+}
+static PFNGLVERTEX4SPROC glad_stats_real_glVertex4s = 0;
+static void APIENTRY glad_stats_impl_glVertex4s(GLshort arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex4s]++;
+	glad_stats_real_glVertex4s(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEX4SVPROC glad_stats_real_glVertex4sv = 0;
+static void APIENTRY glad_stats_impl_glVertex4sv(const GLshort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertex4sv]++;
+	glad_stats_real_glVertex4sv(arg0);
+}
+static PFNGLVERTEXARRAYATTRIBBINDINGPROC glad_stats_real_glVertexArrayAttribBinding = 0;
+static void APIENTRY glad_stats_impl_glVertexArrayAttribBinding(GLuint arg0, GLuint arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexArrayAttribBinding]++;
+	glad_stats_real_glVertexArrayAttribBinding(arg0, arg1, arg2);
+}
+static PFNGLVERTEXARRAYATTRIBFORMATPROC glad_stats_real_glVertexArrayAttribFormat = 0;
+static void APIENTRY glad_stats_impl_glVertexArrayAttribFormat(GLuint arg0, GLuint arg1, GLint arg2, GLenum arg3, GLboolean arg4, GLuint arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexArrayAttribFormat]++;
+	glad_stats_real_glVertexArrayAttribFormat(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLVERTEXARRAYATTRIBIFORMATPROC glad_stats_real_glVertexArrayAttribIFormat = 0;
+static void APIENTRY glad_stats_impl_glVertexArrayAttribIFormat(GLuint arg0, GLuint arg1, GLint arg2, GLenum arg3, GLuint arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexArrayAttribIFormat]++;
+	glad_stats_real_glVertexArrayAttribIFormat(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLVERTEXARRAYATTRIBLFORMATPROC glad_stats_real_glVertexArrayAttribLFormat = 0;
+static void APIENTRY glad_stats_impl_glVertexArrayAttribLFormat(GLuint arg0, GLuint arg1, GLint arg2, GLenum arg3, GLuint arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexArrayAttribLFormat]++;
+	glad_stats_real_glVertexArrayAttribLFormat(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLVERTEXARRAYBINDINGDIVISORPROC glad_stats_real_glVertexArrayBindingDivisor = 0;
+static void APIENTRY glad_stats_impl_glVertexArrayBindingDivisor(GLuint arg0, GLuint arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexArrayBindingDivisor]++;
+	glad_stats_real_glVertexArrayBindingDivisor(arg0, arg1, arg2);
+}
+static PFNGLVERTEXARRAYELEMENTBUFFERPROC glad_stats_real_glVertexArrayElementBuffer = 0;
+static void APIENTRY glad_stats_impl_glVertexArrayElementBuffer(GLuint arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexArrayElementBuffer]++;
+	glad_stats_real_glVertexArrayElementBuffer(arg0, arg1);
+}
+static PFNGLVERTEXARRAYVERTEXBUFFERPROC glad_stats_real_glVertexArrayVertexBuffer = 0;
+static void APIENTRY glad_stats_impl_glVertexArrayVertexBuffer(GLuint arg0, GLuint arg1, GLuint arg2, GLintptr arg3, GLsizei arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexArrayVertexBuffer]++;
+	glad_stats_real_glVertexArrayVertexBuffer(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLVERTEXARRAYVERTEXBUFFERSPROC glad_stats_real_glVertexArrayVertexBuffers = 0;
+static void APIENTRY glad_stats_impl_glVertexArrayVertexBuffers(GLuint arg0, GLuint arg1, GLsizei arg2, const GLuint * arg3, const GLintptr * arg4, const GLsizei * arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexArrayVertexBuffers]++;
+	glad_stats_real_glVertexArrayVertexBuffers(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLVERTEXATTRIB1DPROC glad_stats_real_glVertexAttrib1d = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib1d(GLuint arg0, GLdouble arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib1d]++;
+	glad_stats_real_glVertexAttrib1d(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB1DVPROC glad_stats_real_glVertexAttrib1dv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib1dv(GLuint arg0, const GLdouble * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib1dv]++;
+	glad_stats_real_glVertexAttrib1dv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB1FPROC glad_stats_real_glVertexAttrib1f = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib1f(GLuint arg0, GLfloat arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib1f]++;
+	glad_stats_real_glVertexAttrib1f(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB1FVPROC glad_stats_real_glVertexAttrib1fv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib1fv(GLuint arg0, const GLfloat * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib1fv]++;
+	glad_stats_real_glVertexAttrib1fv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB1SPROC glad_stats_real_glVertexAttrib1s = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib1s(GLuint arg0, GLshort arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib1s]++;
+	glad_stats_real_glVertexAttrib1s(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB1SVPROC glad_stats_real_glVertexAttrib1sv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib1sv(GLuint arg0, const GLshort * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib1sv]++;
+	glad_stats_real_glVertexAttrib1sv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB2DPROC glad_stats_real_glVertexAttrib2d = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib2d(GLuint arg0, GLdouble arg1, GLdouble arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib2d]++;
+	glad_stats_real_glVertexAttrib2d(arg0, arg1, arg2);
+}
+static PFNGLVERTEXATTRIB2DVPROC glad_stats_real_glVertexAttrib2dv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib2dv(GLuint arg0, const GLdouble * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib2dv]++;
+	glad_stats_real_glVertexAttrib2dv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB2FPROC glad_stats_real_glVertexAttrib2f = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib2f(GLuint arg0, GLfloat arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib2f]++;
+	glad_stats_real_glVertexAttrib2f(arg0, arg1, arg2);
+}
+static PFNGLVERTEXATTRIB2FVPROC glad_stats_real_glVertexAttrib2fv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib2fv(GLuint arg0, const GLfloat * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib2fv]++;
+	glad_stats_real_glVertexAttrib2fv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB2SPROC glad_stats_real_glVertexAttrib2s = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib2s(GLuint arg0, GLshort arg1, GLshort arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib2s]++;
+	glad_stats_real_glVertexAttrib2s(arg0, arg1, arg2);
+}
+static PFNGLVERTEXATTRIB2SVPROC glad_stats_real_glVertexAttrib2sv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib2sv(GLuint arg0, const GLshort * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib2sv]++;
+	glad_stats_real_glVertexAttrib2sv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB3DPROC glad_stats_real_glVertexAttrib3d = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib3d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib3d]++;
+	glad_stats_real_glVertexAttrib3d(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEXATTRIB3DVPROC glad_stats_real_glVertexAttrib3dv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib3dv(GLuint arg0, const GLdouble * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib3dv]++;
+	glad_stats_real_glVertexAttrib3dv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB3FPROC glad_stats_real_glVertexAttrib3f = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib3f(GLuint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib3f]++;
+	glad_stats_real_glVertexAttrib3f(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEXATTRIB3FVPROC glad_stats_real_glVertexAttrib3fv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib3fv(GLuint arg0, const GLfloat * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib3fv]++;
+	glad_stats_real_glVertexAttrib3fv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB3SPROC glad_stats_real_glVertexAttrib3s = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib3s(GLuint arg0, GLshort arg1, GLshort arg2, GLshort arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib3s]++;
+	glad_stats_real_glVertexAttrib3s(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEXATTRIB3SVPROC glad_stats_real_glVertexAttrib3sv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib3sv(GLuint arg0, const GLshort * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib3sv]++;
+	glad_stats_real_glVertexAttrib3sv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB4NBVPROC glad_stats_real_glVertexAttrib4Nbv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib4Nbv(GLuint arg0, const GLbyte * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib4Nbv]++;
+	glad_stats_real_glVertexAttrib4Nbv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB4NIVPROC glad_stats_real_glVertexAttrib4Niv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib4Niv(GLuint arg0, const GLint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib4Niv]++;
+	glad_stats_real_glVertexAttrib4Niv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB4NSVPROC glad_stats_real_glVertexAttrib4Nsv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib4Nsv(GLuint arg0, const GLshort * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib4Nsv]++;
+	glad_stats_real_glVertexAttrib4Nsv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB4NUBPROC glad_stats_real_glVertexAttrib4Nub = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib4Nub(GLuint arg0, GLubyte arg1, GLubyte arg2, GLubyte arg3, GLubyte arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib4Nub]++;
+	glad_stats_real_glVertexAttrib4Nub(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLVERTEXATTRIB4NUBVPROC glad_stats_real_glVertexAttrib4Nubv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib4Nubv(GLuint arg0, const GLubyte * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib4Nubv]++;
+	glad_stats_real_glVertexAttrib4Nubv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB4NUIVPROC glad_stats_real_glVertexAttrib4Nuiv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib4Nuiv(GLuint arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib4Nuiv]++;
+	glad_stats_real_glVertexAttrib4Nuiv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB4NUSVPROC glad_stats_real_glVertexAttrib4Nusv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib4Nusv(GLuint arg0, const GLushort * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib4Nusv]++;
+	glad_stats_real_glVertexAttrib4Nusv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB4BVPROC glad_stats_real_glVertexAttrib4bv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib4bv(GLuint arg0, const GLbyte * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib4bv]++;
+	glad_stats_real_glVertexAttrib4bv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB4DPROC glad_stats_real_glVertexAttrib4d = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib4d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib4d]++;
+	glad_stats_real_glVertexAttrib4d(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLVERTEXATTRIB4DVPROC glad_stats_real_glVertexAttrib4dv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib4dv(GLuint arg0, const GLdouble * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib4dv]++;
+	glad_stats_real_glVertexAttrib4dv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB4FPROC glad_stats_real_glVertexAttrib4f = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib4f(GLuint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib4f]++;
+	glad_stats_real_glVertexAttrib4f(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLVERTEXATTRIB4FVPROC glad_stats_real_glVertexAttrib4fv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib4fv(GLuint arg0, const GLfloat * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib4fv]++;
+	glad_stats_real_glVertexAttrib4fv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB4IVPROC glad_stats_real_glVertexAttrib4iv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib4iv(GLuint arg0, const GLint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib4iv]++;
+	glad_stats_real_glVertexAttrib4iv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB4SPROC glad_stats_real_glVertexAttrib4s = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib4s(GLuint arg0, GLshort arg1, GLshort arg2, GLshort arg3, GLshort arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib4s]++;
+	glad_stats_real_glVertexAttrib4s(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLVERTEXATTRIB4SVPROC glad_stats_real_glVertexAttrib4sv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib4sv(GLuint arg0, const GLshort * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib4sv]++;
+	glad_stats_real_glVertexAttrib4sv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB4UBVPROC glad_stats_real_glVertexAttrib4ubv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib4ubv(GLuint arg0, const GLubyte * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib4ubv]++;
+	glad_stats_real_glVertexAttrib4ubv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB4UIVPROC glad_stats_real_glVertexAttrib4uiv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib4uiv(GLuint arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib4uiv]++;
+	glad_stats_real_glVertexAttrib4uiv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIB4USVPROC glad_stats_real_glVertexAttrib4usv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttrib4usv(GLuint arg0, const GLushort * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttrib4usv]++;
+	glad_stats_real_glVertexAttrib4usv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBBINDINGPROC glad_stats_real_glVertexAttribBinding = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribBinding(GLuint arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribBinding]++;
+	glad_stats_real_glVertexAttribBinding(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBDIVISORPROC glad_stats_real_glVertexAttribDivisor = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribDivisor(GLuint arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribDivisor]++;
+	glad_stats_real_glVertexAttribDivisor(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBFORMATPROC glad_stats_real_glVertexAttribFormat = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribFormat(GLuint arg0, GLint arg1, GLenum arg2, GLboolean arg3, GLuint arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribFormat]++;
+	glad_stats_real_glVertexAttribFormat(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLVERTEXATTRIBI1IPROC glad_stats_real_glVertexAttribI1i = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI1i(GLuint arg0, GLint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI1i]++;
+	glad_stats_real_glVertexAttribI1i(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBI1IVPROC glad_stats_real_glVertexAttribI1iv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI1iv(GLuint arg0, const GLint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI1iv]++;
+	glad_stats_real_glVertexAttribI1iv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBI1UIPROC glad_stats_real_glVertexAttribI1ui = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI1ui(GLuint arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI1ui]++;
+	glad_stats_real_glVertexAttribI1ui(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBI1UIVPROC glad_stats_real_glVertexAttribI1uiv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI1uiv(GLuint arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI1uiv]++;
+	glad_stats_real_glVertexAttribI1uiv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBI2IPROC glad_stats_real_glVertexAttribI2i = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI2i(GLuint arg0, GLint arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI2i]++;
+	glad_stats_real_glVertexAttribI2i(arg0, arg1, arg2);
+}
+static PFNGLVERTEXATTRIBI2IVPROC glad_stats_real_glVertexAttribI2iv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI2iv(GLuint arg0, const GLint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI2iv]++;
+	glad_stats_real_glVertexAttribI2iv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBI2UIPROC glad_stats_real_glVertexAttribI2ui = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI2ui(GLuint arg0, GLuint arg1, GLuint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI2ui]++;
+	glad_stats_real_glVertexAttribI2ui(arg0, arg1, arg2);
+}
+static PFNGLVERTEXATTRIBI2UIVPROC glad_stats_real_glVertexAttribI2uiv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI2uiv(GLuint arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI2uiv]++;
+	glad_stats_real_glVertexAttribI2uiv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBI3IPROC glad_stats_real_glVertexAttribI3i = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI3i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI3i]++;
+	glad_stats_real_glVertexAttribI3i(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEXATTRIBI3IVPROC glad_stats_real_glVertexAttribI3iv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI3iv(GLuint arg0, const GLint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI3iv]++;
+	glad_stats_real_glVertexAttribI3iv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBI3UIPROC glad_stats_real_glVertexAttribI3ui = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI3ui(GLuint arg0, GLuint arg1, GLuint arg2, GLuint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI3ui]++;
+	glad_stats_real_glVertexAttribI3ui(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEXATTRIBI3UIVPROC glad_stats_real_glVertexAttribI3uiv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI3uiv(GLuint arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI3uiv]++;
+	glad_stats_real_glVertexAttribI3uiv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBI4BVPROC glad_stats_real_glVertexAttribI4bv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI4bv(GLuint arg0, const GLbyte * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI4bv]++;
+	glad_stats_real_glVertexAttribI4bv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBI4IPROC glad_stats_real_glVertexAttribI4i = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI4i(GLuint arg0, GLint arg1, GLint arg2, GLint arg3, GLint arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI4i]++;
+	glad_stats_real_glVertexAttribI4i(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLVERTEXATTRIBI4IVPROC glad_stats_real_glVertexAttribI4iv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI4iv(GLuint arg0, const GLint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI4iv]++;
+	glad_stats_real_glVertexAttribI4iv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBI4SVPROC glad_stats_real_glVertexAttribI4sv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI4sv(GLuint arg0, const GLshort * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI4sv]++;
+	glad_stats_real_glVertexAttribI4sv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBI4UBVPROC glad_stats_real_glVertexAttribI4ubv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI4ubv(GLuint arg0, const GLubyte * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI4ubv]++;
+	glad_stats_real_glVertexAttribI4ubv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBI4UIPROC glad_stats_real_glVertexAttribI4ui = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI4ui(GLuint arg0, GLuint arg1, GLuint arg2, GLuint arg3, GLuint arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI4ui]++;
+	glad_stats_real_glVertexAttribI4ui(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLVERTEXATTRIBI4UIVPROC glad_stats_real_glVertexAttribI4uiv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI4uiv(GLuint arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI4uiv]++;
+	glad_stats_real_glVertexAttribI4uiv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBI4USVPROC glad_stats_real_glVertexAttribI4usv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribI4usv(GLuint arg0, const GLushort * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribI4usv]++;
+	glad_stats_real_glVertexAttribI4usv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBIFORMATPROC glad_stats_real_glVertexAttribIFormat = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribIFormat(GLuint arg0, GLint arg1, GLenum arg2, GLuint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribIFormat]++;
+	glad_stats_real_glVertexAttribIFormat(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEXATTRIBIPOINTERPROC glad_stats_real_glVertexAttribIPointer = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribIPointer(GLuint arg0, GLint arg1, GLenum arg2, GLsizei arg3, const void * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribIPointer]++;
+	glad_stats_real_glVertexAttribIPointer(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLVERTEXATTRIBL1DPROC glad_stats_real_glVertexAttribL1d = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribL1d(GLuint arg0, GLdouble arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribL1d]++;
+	glad_stats_real_glVertexAttribL1d(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBL1DVPROC glad_stats_real_glVertexAttribL1dv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribL1dv(GLuint arg0, const GLdouble * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribL1dv]++;
+	glad_stats_real_glVertexAttribL1dv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBL1UI64ARBPROC glad_stats_real_glVertexAttribL1ui64ARB = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribL1ui64ARB(GLuint arg0, GLuint64EXT arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribL1ui64ARB]++;
+	glad_stats_real_glVertexAttribL1ui64ARB(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBL1UI64VARBPROC glad_stats_real_glVertexAttribL1ui64vARB = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribL1ui64vARB(GLuint arg0, const GLuint64EXT * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribL1ui64vARB]++;
+	glad_stats_real_glVertexAttribL1ui64vARB(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBL2DPROC glad_stats_real_glVertexAttribL2d = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribL2d(GLuint arg0, GLdouble arg1, GLdouble arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribL2d]++;
+	glad_stats_real_glVertexAttribL2d(arg0, arg1, arg2);
+}
+static PFNGLVERTEXATTRIBL2DVPROC glad_stats_real_glVertexAttribL2dv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribL2dv(GLuint arg0, const GLdouble * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribL2dv]++;
+	glad_stats_real_glVertexAttribL2dv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBL3DPROC glad_stats_real_glVertexAttribL3d = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribL3d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribL3d]++;
+	glad_stats_real_glVertexAttribL3d(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEXATTRIBL3DVPROC glad_stats_real_glVertexAttribL3dv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribL3dv(GLuint arg0, const GLdouble * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribL3dv]++;
+	glad_stats_real_glVertexAttribL3dv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBL4DPROC glad_stats_real_glVertexAttribL4d = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribL4d(GLuint arg0, GLdouble arg1, GLdouble arg2, GLdouble arg3, GLdouble arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribL4d]++;
+	glad_stats_real_glVertexAttribL4d(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLVERTEXATTRIBL4DVPROC glad_stats_real_glVertexAttribL4dv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribL4dv(GLuint arg0, const GLdouble * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribL4dv]++;
+	glad_stats_real_glVertexAttribL4dv(arg0, arg1);
+}
+static PFNGLVERTEXATTRIBLFORMATPROC glad_stats_real_glVertexAttribLFormat = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribLFormat(GLuint arg0, GLint arg1, GLenum arg2, GLuint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribLFormat]++;
+	glad_stats_real_glVertexAttribLFormat(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEXATTRIBLPOINTERPROC glad_stats_real_glVertexAttribLPointer = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribLPointer(GLuint arg0, GLint arg1, GLenum arg2, GLsizei arg3, const void * arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribLPointer]++;
+	glad_stats_real_glVertexAttribLPointer(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLVERTEXATTRIBP1UIPROC glad_stats_real_glVertexAttribP1ui = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribP1ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribP1ui]++;
+	glad_stats_real_glVertexAttribP1ui(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEXATTRIBP1UIVPROC glad_stats_real_glVertexAttribP1uiv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribP1uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribP1uiv]++;
+	glad_stats_real_glVertexAttribP1uiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEXATTRIBP2UIPROC glad_stats_real_glVertexAttribP2ui = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribP2ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribP2ui]++;
+	glad_stats_real_glVertexAttribP2ui(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEXATTRIBP2UIVPROC glad_stats_real_glVertexAttribP2uiv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribP2uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribP2uiv]++;
+	glad_stats_real_glVertexAttribP2uiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEXATTRIBP3UIPROC glad_stats_real_glVertexAttribP3ui = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribP3ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribP3ui]++;
+	glad_stats_real_glVertexAttribP3ui(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEXATTRIBP3UIVPROC glad_stats_real_glVertexAttribP3uiv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribP3uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribP3uiv]++;
+	glad_stats_real_glVertexAttribP3uiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEXATTRIBP4UIPROC glad_stats_real_glVertexAttribP4ui = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribP4ui(GLuint arg0, GLenum arg1, GLboolean arg2, GLuint arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribP4ui]++;
+	glad_stats_real_glVertexAttribP4ui(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEXATTRIBP4UIVPROC glad_stats_real_glVertexAttribP4uiv = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribP4uiv(GLuint arg0, GLenum arg1, GLboolean arg2, const GLuint * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribP4uiv]++;
+	glad_stats_real_glVertexAttribP4uiv(arg0, arg1, arg2, arg3);
+}
+static PFNGLVERTEXATTRIBPOINTERPROC glad_stats_real_glVertexAttribPointer = 0;
+static void APIENTRY glad_stats_impl_glVertexAttribPointer(GLuint arg0, GLint arg1, GLenum arg2, GLboolean arg3, GLsizei arg4, const void * arg5) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexAttribPointer]++;
+	glad_stats_real_glVertexAttribPointer(arg0, arg1, arg2, arg3, arg4, arg5);
+}
+static PFNGLVERTEXBINDINGDIVISORPROC glad_stats_real_glVertexBindingDivisor = 0;
+static void APIENTRY glad_stats_impl_glVertexBindingDivisor(GLuint arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexBindingDivisor]++;
+	glad_stats_real_glVertexBindingDivisor(arg0, arg1);
+}
+static PFNGLVERTEXP2UIPROC glad_stats_real_glVertexP2ui = 0;
+static void APIENTRY glad_stats_impl_glVertexP2ui(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexP2ui]++;
+	glad_stats_real_glVertexP2ui(arg0, arg1);
+}
+static PFNGLVERTEXP2UIVPROC glad_stats_real_glVertexP2uiv = 0;
+static void APIENTRY glad_stats_impl_glVertexP2uiv(GLenum arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexP2uiv]++;
+	glad_stats_real_glVertexP2uiv(arg0, arg1);
+}
+static PFNGLVERTEXP3UIPROC glad_stats_real_glVertexP3ui = 0;
+static void APIENTRY glad_stats_impl_glVertexP3ui(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexP3ui]++;
+	glad_stats_real_glVertexP3ui(arg0, arg1);
+}
+static PFNGLVERTEXP3UIVPROC glad_stats_real_glVertexP3uiv = 0;
+static void APIENTRY glad_stats_impl_glVertexP3uiv(GLenum arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexP3uiv]++;
+	glad_stats_real_glVertexP3uiv(arg0, arg1);
+}
+static PFNGLVERTEXP4UIPROC glad_stats_real_glVertexP4ui = 0;
+static void APIENTRY glad_stats_impl_glVertexP4ui(GLenum arg0, GLuint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexP4ui]++;
+	glad_stats_real_glVertexP4ui(arg0, arg1);
+}
+static PFNGLVERTEXP4UIVPROC glad_stats_real_glVertexP4uiv = 0;
+static void APIENTRY glad_stats_impl_glVertexP4uiv(GLenum arg0, const GLuint * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexP4uiv]++;
+	glad_stats_real_glVertexP4uiv(arg0, arg1);
+}
+static PFNGLVERTEXPOINTERPROC glad_stats_real_glVertexPointer = 0;
+static void APIENTRY glad_stats_impl_glVertexPointer(GLint arg0, GLenum arg1, GLsizei arg2, const void * arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glVertexPointer]++;
+	glad_stats_real_glVertexPointer(arg0, arg1, arg2, arg3);
+}
+static PFNGLVIEWPORTPROC glad_stats_real_glViewport = 0;
+static void APIENTRY glad_stats_impl_glViewport(GLint arg0, GLint arg1, GLsizei arg2, GLsizei arg3) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glViewport]++;
+	glad_stats_real_glViewport(arg0, arg1, arg2, arg3);
+}
+static PFNGLVIEWPORTARRAYVPROC glad_stats_real_glViewportArrayv = 0;
+static void APIENTRY glad_stats_impl_glViewportArrayv(GLuint arg0, GLsizei arg1, const GLfloat * arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glViewportArrayv]++;
+	glad_stats_real_glViewportArrayv(arg0, arg1, arg2);
+}
+static PFNGLVIEWPORTINDEXEDFPROC glad_stats_real_glViewportIndexedf = 0;
+static void APIENTRY glad_stats_impl_glViewportIndexedf(GLuint arg0, GLfloat arg1, GLfloat arg2, GLfloat arg3, GLfloat arg4) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glViewportIndexedf]++;
+	glad_stats_real_glViewportIndexedf(arg0, arg1, arg2, arg3, arg4);
+}
+static PFNGLVIEWPORTINDEXEDFVPROC glad_stats_real_glViewportIndexedfv = 0;
+static void APIENTRY glad_stats_impl_glViewportIndexedfv(GLuint arg0, const GLfloat * arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glViewportIndexedfv]++;
+	glad_stats_real_glViewportIndexedfv(arg0, arg1);
+}
+static PFNGLWAITSYNCPROC glad_stats_real_glWaitSync = 0;
+static void APIENTRY glad_stats_impl_glWaitSync(GLsync arg0, GLbitfield arg1, GLuint64 arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glWaitSync]++;
+	glad_stats_real_glWaitSync(arg0, arg1, arg2);
+}
+static PFNGLWINDOWPOS2DPROC glad_stats_real_glWindowPos2d = 0;
+static void APIENTRY glad_stats_impl_glWindowPos2d(GLdouble arg0, GLdouble arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glWindowPos2d]++;
+	glad_stats_real_glWindowPos2d(arg0, arg1);
+}
+static PFNGLWINDOWPOS2DVPROC glad_stats_real_glWindowPos2dv = 0;
+static void APIENTRY glad_stats_impl_glWindowPos2dv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glWindowPos2dv]++;
+	glad_stats_real_glWindowPos2dv(arg0);
+}
+static PFNGLWINDOWPOS2FPROC glad_stats_real_glWindowPos2f = 0;
+static void APIENTRY glad_stats_impl_glWindowPos2f(GLfloat arg0, GLfloat arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glWindowPos2f]++;
+	glad_stats_real_glWindowPos2f(arg0, arg1);
+}
+static PFNGLWINDOWPOS2FVPROC glad_stats_real_glWindowPos2fv = 0;
+static void APIENTRY glad_stats_impl_glWindowPos2fv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glWindowPos2fv]++;
+	glad_stats_real_glWindowPos2fv(arg0);
+}
+static PFNGLWINDOWPOS2IPROC glad_stats_real_glWindowPos2i = 0;
+static void APIENTRY glad_stats_impl_glWindowPos2i(GLint arg0, GLint arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glWindowPos2i]++;
+	glad_stats_real_glWindowPos2i(arg0, arg1);
+}
+static PFNGLWINDOWPOS2IVPROC glad_stats_real_glWindowPos2iv = 0;
+static void APIENTRY glad_stats_impl_glWindowPos2iv(const GLint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glWindowPos2iv]++;
+	glad_stats_real_glWindowPos2iv(arg0);
+}
+static PFNGLWINDOWPOS2SPROC glad_stats_real_glWindowPos2s = 0;
+static void APIENTRY glad_stats_impl_glWindowPos2s(GLshort arg0, GLshort arg1) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glWindowPos2s]++;
+	glad_stats_real_glWindowPos2s(arg0, arg1);
+}
+static PFNGLWINDOWPOS2SVPROC glad_stats_real_glWindowPos2sv = 0;
+static void APIENTRY glad_stats_impl_glWindowPos2sv(const GLshort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glWindowPos2sv]++;
+	glad_stats_real_glWindowPos2sv(arg0);
+}
+static PFNGLWINDOWPOS3DPROC glad_stats_real_glWindowPos3d = 0;
+static void APIENTRY glad_stats_impl_glWindowPos3d(GLdouble arg0, GLdouble arg1, GLdouble arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glWindowPos3d]++;
+	glad_stats_real_glWindowPos3d(arg0, arg1, arg2);
+}
+static PFNGLWINDOWPOS3DVPROC glad_stats_real_glWindowPos3dv = 0;
+static void APIENTRY glad_stats_impl_glWindowPos3dv(const GLdouble * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glWindowPos3dv]++;
+	glad_stats_real_glWindowPos3dv(arg0);
+}
+static PFNGLWINDOWPOS3FPROC glad_stats_real_glWindowPos3f = 0;
+static void APIENTRY glad_stats_impl_glWindowPos3f(GLfloat arg0, GLfloat arg1, GLfloat arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glWindowPos3f]++;
+	glad_stats_real_glWindowPos3f(arg0, arg1, arg2);
+}
+static PFNGLWINDOWPOS3FVPROC glad_stats_real_glWindowPos3fv = 0;
+static void APIENTRY glad_stats_impl_glWindowPos3fv(const GLfloat * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glWindowPos3fv]++;
+	glad_stats_real_glWindowPos3fv(arg0);
+}
+static PFNGLWINDOWPOS3IPROC glad_stats_real_glWindowPos3i = 0;
+static void APIENTRY glad_stats_impl_glWindowPos3i(GLint arg0, GLint arg1, GLint arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glWindowPos3i]++;
+	glad_stats_real_glWindowPos3i(arg0, arg1, arg2);
+}
+static PFNGLWINDOWPOS3IVPROC glad_stats_real_glWindowPos3iv = 0;
+static void APIENTRY glad_stats_impl_glWindowPos3iv(const GLint * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glWindowPos3iv]++;
+	glad_stats_real_glWindowPos3iv(arg0);
+}
+static PFNGLWINDOWPOS3SPROC glad_stats_real_glWindowPos3s = 0;
+static void APIENTRY glad_stats_impl_glWindowPos3s(GLshort arg0, GLshort arg1, GLshort arg2) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glWindowPos3s]++;
+	glad_stats_real_glWindowPos3s(arg0, arg1, arg2);
+}
+static PFNGLWINDOWPOS3SVPROC glad_stats_real_glWindowPos3sv = 0;
+static void APIENTRY glad_stats_impl_glWindowPos3sv(const GLshort * arg0) {
+	GLstatsCounters* c = gl_stats_counters();
+	c->calls[GL_STATS_glWindowPos3sv]++;
+	glad_stats_real_glWindowPos3sv(arg0);
+}
+
+const char* const gl_stats_function_names[GL_STATS_FUNCTION_COUNT] = {
+	"glAccum",
+	"glActiveShaderProgram",
+	"glActiveTexture",
+	"glAlphaFunc",
+	"glAreTexturesResident",
+	"glArrayElement",
+	"glAttachShader",
+	"glBegin",
+	"glBeginConditionalRender",
+	"glBeginQuery",
+	"glBeginQueryIndexed",
+	"glBeginTransformFeedback",
+	"glBindAttribLocation",
+	"glBindBuffer",
+	"glBindBufferBase",
+	"glBindBufferRange",
+	"glBindBuffersBase",
+	"glBindBuffersRange",
+	"glBindFragDataLocation",
+	"glBindFragDataLocationIndexed",
+	"glBindFramebuffer",
+	"glBindImageTexture",
+	"glBindImageTextures",
+	"glBindProgramPipeline",
+	"glBindRenderbuffer",
+	"glBindSampler",
+	"glBindSamplers",
+	"glBindTexture",
+	"glBindTextureUnit",
+	"glBindTextures",
+	"glBindTransformFeedback",
+	"glBindVertexArray",
+	"glBindVertexBuffer",
+	"glBindVertexBuffers",
+	"glBitmap",
+	"glBlendColor",
+	"glBlendEquation",
+	"glBlendEquationSeparate",
+	"glBlendEquationSeparatei",
+	"glBlendEquationi",
+	"glBlendFunc",
+	"glBlendFuncSeparate",
+	"glBlendFuncSeparatei",
+	"glBlendFunci",
+	"glBlitFramebuffer",
+	"glBlitNamedFramebuffer",
+	"glBufferData",
+	"glBufferStorage",
+	"glBufferSubData",
+	"glCallList",
+	"glCallLists",
+	"glCheckFramebufferStatus",
+	"glCheckNamedFramebufferStatus",
+	"glClampColor",
+	"glClear",
+	"glClearAccum",
+	"glClearBufferData",
+	"glClearBufferSubData",
+	"glClearBufferfi",
+	"glClearBufferfv",
+	"glClearBufferiv",
+	"glClearBufferuiv",
+	"glClearColor",
+	"glClearDepth",
+	"glClearDepthf",
+	"glClearIndex",
+	"glClearNamedBufferData",
+	"glClearNamedBufferSubData",
+	"glClearNamedFramebufferfi",
+	"glClearNamedFramebufferfv",
+	"glClearNamedFramebufferiv",
+	"glClearNamedFramebufferuiv",
+	"glClearStencil",
+	"glClearTexImage",
+	"glClearTexSubImage",
+	"glClientActiveTexture",
+	"glClientWaitSync",
+	"glClipControl",
+	"glClipPlane",
+	"glColor3b",
+	"glColor3bv",
+	"glColor3d",
+	"glColor3dv",
+	"glColor3f",
+	"glColor3fv",
+	"glColor3i",
+	"glColor3iv",
+	"glColor3s",
+	"glColor3sv",
+	"glColor3ub",
+	"glColor3ubv",
+	"glColor3ui",
+	"glColor3uiv",
+	"glColor3us",
+	"glColor3usv",
+	"glColor4b",
+	"glColor4bv",
+	"glColor4d",
+	"glColor4dv",
+	"glColor4f",
+	"glColor4fv",
+	"glColor4i",
+	"glColor4iv",
+	"glColor4s",
+	"glColor4sv",
+	"glColor4ub",
+	"glColor4ubv",
+	"glColor4ui",
+	"glColor4uiv",
+	"glColor4us",
+	"glColor4usv",
+	"glColorMask",
+	"glColorMaski",
+	"glColorMaterial",
+	"glColorP3ui",
+	"glColorP3uiv",
+	"glColorP4ui",
+	"glColorP4uiv",
+	"glColorPointer",
+	"glCompileShader",
+	"glCompressedTexImage1D",
+	"glCompressedTexImage2D",
+	"glCompressedTexImage3D",
+	"glCompressedTexSubImage1D",
+	"glCompressedTexSubImage2D",
+	"glCompressedTexSubImage3D",
+	"glCompressedTextureSubImage1D",
+	"glCompressedTextureSubImage2D",
+	"glCompressedTextureSubImage3D",
+	"glCopyBufferSubData",
+	"glCopyImageSubData",
+	"glCopyNamedBufferSubData",
+	"glCopyPixels",
+	"glCopyTexImage1D",
+	"glCopyTexImage2D",
+	"glCopyTexSubImage1D",
+	"glCopyTexSubImage2D",
+	"glCopyTexSubImage3D",
+	"glCopyTextureSubImage1D",
+	"glCopyTextureSubImage2D",
+	"glCopyTextureSubImage3D",
+	"glCreateBuffers",
+	"glCreateFramebuffers",
+	"glCreateProgram",
+	"glCreateProgramPipelines",
+	"glCreateQueries",
+	"glCreateRenderbuffers",
+	"glCreateSamplers",
+	"glCreateShader",
+	"glCreateShaderProgramv",
+	"glCreateTextures",
+	"glCreateTransformFeedbacks",
+	"glCreateVertexArrays",
+	"glCullFace",
+	"glDebugMessageCallback",
+	"glDebugMessageControl",
+	"glDebugMessageInsert",
+	"glDeleteBuffers",
+	"glDeleteFramebuffers",
+	"glDeleteLists",
+	"glDeleteProgram",
+	"glDeleteProgramPipelines",
+	"glDeleteQueries",
+	"glDeleteRenderbuffers",
+	"glDeleteSamplers",
+	"glDeleteShader",
+	"glDeleteSync",
+	"glDeleteTextures",
+	"glDeleteTransformFeedbacks",
+	"glDeleteVertexArrays",
+	"glDepthFunc",
+	"glDepthMask",
+	"glDepthRange",
+	"glDepthRangeArrayv",
+	"glDepthRangeIndexed",
+	"glDepthRangef",
+	"glDetachShader",
+	"glDisable",
+	"glDisableClientState",
+	"glDisableVertexArrayAttrib",
+	"glDisableVertexAttribArray",
+	"glDisablei",
+	"glDispatchCompute",
+	"glDispatchComputeIndirect",
+	"glDrawArrays",
+	"glDrawArraysIndirect",
+	"glDrawArraysInstanced",
+	"glDrawArraysInstancedBaseInstance",
+	"glDrawBuffer",
+	"glDrawBuffers",
+	"glDrawElements",
+	"glDrawElementsBaseVertex",
+	"glDrawElementsIndirect",
+	"glDrawElementsInstanced",
+	"glDrawElementsInstancedBaseInstance",
+	"glDrawElementsInstancedBaseVertex",
+	"glDrawElementsInstancedBaseVertexBaseInstance",
+	"glDrawPixels",
+	"glDrawRangeElements",
+	"glDrawRangeElementsBaseVertex",
+	"glDrawTransformFeedback",
+	"glDrawTransformFeedbackInstanced",
+	"glDrawTransformFeedbackStream",
+	"glDrawTransformFeedbackStreamInstanced",
+	"glEdgeFlag",
+	"glEdgeFlagPointer",
+	"glEdgeFlagv",
+	"glEnable",
+	"glEnableClientState",
+	"glEnableVertexArrayAttrib",
+	"glEnableVertexAttribArray",
+	"glEnablei",
+	"glEnd",
+	"glEndConditionalRender",
+	"glEndList",
+	"glEndQuery",
+	"glEndQueryIndexed",
+	"glEndTransformFeedback",
+	"glEvalCoord1d",
+	"glEvalCoord1dv",
+	"glEvalCoord1f",
+	"glEvalCoord1fv",
+	"glEvalCoord2d",
+	"glEvalCoord2dv",
+	"glEvalCoord2f",
+	"glEvalCoord2fv",
+	"glEvalMesh1",
+	"glEvalMesh2",
+	"glEvalPoint1",
+	"glEvalPoint2",
+	"glFeedbackBuffer",
+	"glFenceSync",
+	"glFinish",
+	"glFlush",
+	"glFlushMappedBufferRange",
+	"glFlushMappedNamedBufferRange",
+	"glFogCoordPointer",
+	"glFogCoordd",
+	"glFogCoorddv",
+	"glFogCoordf",
+	"glFogCoordfv",
+	"glFogf",
+	"glFogfv",
+	"glFogi",
+	"glFogiv",
+	"glFramebufferParameteri",
+	"glFramebufferRenderbuffer",
+	"glFramebufferTexture",
+	"glFramebufferTexture1D",
+	"glFramebufferTexture2D",
+	"glFramebufferTexture3D",
+	"glFramebufferTextureLayer",
+	"glFrontFace",
+	"glFrustum",
+	"glGenBuffers",
+	"glGenFramebuffers",
+	"glGenLists",
+	"glGenProgramPipelines",
+	"glGenQueries",
+	"glGenRenderbuffers",
+	"glGenSamplers",
+	"glGenTextures",
+	"glGenTransformFeedbacks",
+	"glGenVertexArrays",
+	"glGenerateMipmap",
+	"glGenerateTextureMipmap",
+	"glGetActiveAtomicCounterBufferiv",
+	"glGetActiveAttrib",
+	"glGetActiveSubroutineName",
+	"glGetActiveSubroutineUniformName",
+	"glGetActiveSubroutineUniformiv",
+	"glGetActiveUniform",
+	"glGetActiveUniformBlockName",
+	"glGetActiveUniformBlockiv",
+	"glGetActiveUniformName",
+	"glGetActiveUniformsiv",
+	"glGetAttachedShaders",
+	"glGetAttribLocation",
+	"glGetBooleani_v",
+	"glGetBooleanv",
+	"glGetBufferParameteri64v",
+	"glGetBufferParameteriv",
+	"glGetBufferPointerv",
+	"glGetBufferSubData",
+	"glGetClipPlane",
+	"glGetCompressedTexImage",
+	"glGetCompressedTextureImage",
+	"glGetCompressedTextureSubImage",
+	"glGetDebugMessageLog",
+	"glGetDoublei_v",
+	"glGetDoublev",
+	"glGetError",
+	"glGetFloati_v",
+	"glGetFloatv",
+	"glGetFragDataIndex",
+	"glGetFragDataLocation",
+	"glGetFramebufferAttachmentParameteriv",
+	"glGetFramebufferParameteriv",
+	"glGetGraphicsResetStatus",
+	"glGetImageHandleARB",
+	"glGetInteger64i_v",
+	"glGetInteger64v",
+	"glGetIntegeri_v",
+	"glGetIntegerv",
+	"glGetInternalformati64v",
+	"glGetInternalformativ",
+	"glGetLightfv",
+	"glGetLightiv",
+	"glGetMapdv",
+	"glGetMapfv",
+	"glGetMapiv",
+	"glGetMaterialfv",
+	"glGetMaterialiv",
+	"glGetMultisamplefv",
+	"glGetNamedBufferParameteri64v",
+	"glGetNamedBufferParameteriv",
+	"glGetNamedBufferPointerv",
+	"glGetNamedBufferSubData",
+	"glGetNamedFramebufferAttachmentParameteriv",
+	"glGetNamedFramebufferParameteriv",
+	"glGetNamedRenderbufferParameteriv",
+	"glGetObjectLabel",
+	"glGetObjectPtrLabel",
+	"glGetPixelMapfv",
+	"glGetPixelMapuiv",
+	"glGetPixelMapusv",
+	"glGetPointerv",
+	"glGetPolygonStipple",
+	"glGetProgramBinary",
+	"glGetProgramInfoLog",
+	"glGetProgramInterfaceiv",
+	"glGetProgramPipelineInfoLog",
+	"glGetProgramPipelineiv",
+	"glGetProgramResourceIndex",
+	"glGetProgramResourceLocation",
+	"glGetProgramResourceLocationIndex",
+	"glGetProgramResourceName",
+	"glGetProgramResourceiv",
+	"glGetProgramStageiv",
+	"glGetProgramiv",
+	"glGetQueryBufferObjecti64v",
+	"glGetQueryBufferObjectiv",
+	"glGetQueryBufferObjectui64v",
+	"glGetQueryBufferObjectuiv",
+	"glGetQueryIndexediv",
+	"glGetQueryObjecti64v",
+	"glGetQueryObjectiv",
+	"glGetQueryObjectui64v",
+	"glGetQueryObjectuiv",
+	"glGetQueryiv",
+	"glGetRenderbufferParameteriv",
+	"glGetSamplerParameterIiv",
+	"glGetSamplerParameterIuiv",
+	"glGetSamplerParameterfv",
+	"glGetSamplerParameteriv",
+	"glGetShaderInfoLog",
+	"glGetShaderPrecisionFormat",
+	"glGetShaderSource",
+	"glGetShaderiv",
+	"glGetString",
+	"glGetStringi",
+	"glGetSubroutineIndex",
+	"glGetSubroutineUniformLocation",
+	"glGetSynciv",
+	"glGetTexEnvfv",
+	"glGetTexEnviv",
+	"glGetTexGendv",
+	"glGetTexGenfv",
+	"glGetTexGeniv",
+	"glGetTexImage",
+	"glGetTexLevelParameterfv",
+	"glGetTexLevelParameteriv",
+	"glGetTexParameterIiv",
+	"glGetTexParameterIuiv",
+	"glGetTexParameterfv",
+	"glGetTexParameteriv",
+	"glGetTextureHandleARB",
+	"glGetTextureImage",
+	"glGetTextureLevelParameterfv",
+	"glGetTextureLevelParameteriv",
+	"glGetTextureParameterIiv",
+	"glGetTextureParameterIuiv",
+	"glGetTextureParameterfv",
+	"glGetTextureParameteriv",
+	"glGetTextureSamplerHandleARB",
+	"glGetTextureSubImage",
+	"glGetTransformFeedbackVarying",
+	"glGetTransformFeedbacki64_v",
+	"glGetTransformFeedbacki_v",
+	"glGetTransformFeedbackiv",
+	"glGetUniformBlockIndex",
+	"glGetUniformIndices",
+	"glGetUniformLocation",
+	"glGetUniformSubroutineuiv",
+	"glGetUniformdv",
+	"glGetUniformfv",
+	"glGetUniformiv",
+	"glGetUniformuiv",
+	"glGetVertexArrayIndexed64iv",
+	"glGetVertexArrayIndexediv",
+	"glGetVertexArrayiv",
+	"glGetVertexAttribIiv",
+	"glGetVertexAttribIuiv",
+	"glGetVertexAttribLdv",
+	"glGetVertexAttribLui64vARB",
+	"glGetVertexAttribPointerv",
+	"glGetVertexAttribdv",
+	"glGetVertexAttribfv",
+	"glGetVertexAttribiv",
+	"glGetnColorTable",
+	"glGetnCompressedTexImage",
+	"glGetnConvolutionFilter",
+	"glGetnHistogram",
+	"glGetnMapdv",
+	"glGetnMapfv",
+	"glGetnMapiv",
+	"glGetnMinmax",
+	"glGetnPixelMapfv",
+	"glGetnPixelMapuiv",
+	"glGetnPixelMapusv",
+	"glGetnPolygonStipple",
+	"glGetnSeparableFilter",
+	"glGetnTexImage",
+	"glGetnUniformdv",
+	"glGetnUniformfv",
+	"glGetnUniformiv",
+	"glGetnUniformuiv",
+	"glHint",
+	"glIndexMask",
+	"glIndexPointer",
+	"glIndexd",
+	"glIndexdv",
+	"glIndexf",
+	"glIndexfv",
+	"glIndexi",
+	"glIndexiv",
+	"glIndexs",
+	"glIndexsv",
+	"glIndexub",
+	"glIndexubv",
+	"glInitNames",
+	"glInterleavedArrays",
+	"glInvalidateBufferData",
+	"glInvalidateBufferSubData",
+	"glInvalidateFramebuffer",
+	"glInvalidateNamedFramebufferData",
+	"glInvalidateNamedFramebufferSubData",
+	"glInvalidateSubFramebuffer",
+	"glInvalidateTexImage",
+	"glInvalidateTexSubImage",
+	"glIsBuffer",
+	"glIsEnabled",
+	"glIsEnabledi",
+	"glIsFramebuffer",
+	"glIsImageHandleResidentARB",
+	"glIsList",
+	"glIsProgram",
+	"glIsProgramPipeline",
+	"glIsQuery",
+	"glIsRenderbuffer",
+	"glIsSampler",
+	"glIsShader",
+	"glIsSync",
+	"glIsTexture",
+	"glIsTextureHandleResidentARB",
+	"glIsTransformFeedback",
+	"glIsVertexArray",
+	"glLightModelf",
+	"glLightModelfv",
+	"glLightModeli",
+	"glLightModeliv",
+	"glLightf",
+	"glLightfv",
+	"glLighti",
+	"glLightiv",
+	"glLineStipple",
+	"glLineWidth",
+	"glLinkProgram",
+	"glListBase",
+	"glLoadIdentity",
+	"glLoadMatrixd",
+	"glLoadMatrixf",
+	"glLoadName",
+	"glLoadTransposeMatrixd",
+	"glLoadTransposeMatrixf",
+	"glLogicOp",
+	"glMakeImageHandleNonResidentARB",
+	"glMakeImageHandleResidentARB",
+	"glMakeTextureHandleNonResidentARB",
+	"glMakeTextureHandleResidentARB",
+	"glMap1d",
+	"glMap1f",
+	"glMap2d",
+	"glMap2f",
+	"glMapBuffer",
+	"glMapBufferRange",
+	"glMapGrid1d",
+	"glMapGrid1f",
+	"glMapGrid2d",
+	"glMapGrid2f",
+	"glMapNamedBuffer",
+	"glMapNamedBufferRange",
+	"glMaterialf",
+	"glMaterialfv",
+	"glMateriali",
+	"glMaterialiv",
+	"glMatrixMode",
+	"glMaxShaderCompilerThreadsKHR",
+	"glMemoryBarrier",
+	"glMemoryBarrierByRegion",
+	"glMinSampleShading",
+	"glMultMatrixd",
+	"glMultMatrixf",
+	"glMultTransposeMatrixd",
+	"glMultTransposeMatrixf",
+	"glMultiDrawArrays",
+	"glMultiDrawArraysIndirect",
+	"glMultiDrawArraysIndirectCount",
+	"glMultiDrawElements",
+	"glMultiDrawElementsBaseVertex",
+	"glMultiDrawElementsIndirect",
+	"glMultiDrawElementsIndirectCount",
+	"glMultiTexCoord1d",
+	"glMultiTexCoord1dv",
+	"glMultiTexCoord1f",
+	"glMultiTexCoord1fv",
+	"glMultiTexCoord1i",
+	"glMultiTexCoord1iv",
+	"glMultiTexCoord1s",
+	"glMultiTexCoord1sv",
+	"glMultiTexCoord2d",
+	"glMultiTexCoord2dv",
+	"glMultiTexCoord2f",
+	"glMultiTexCoord2fv",
+	"glMultiTexCoord2i",
+	"glMultiTexCoord2iv",
+	"glMultiTexCoord2s",
+	"glMultiTexCoord2sv",
+	"glMultiTexCoord3d",
+	"glMultiTexCoord3dv",
+	"glMultiTexCoord3f",
+	"glMultiTexCoord3fv",
+	"glMultiTexCoord3i",
+	"glMultiTexCoord3iv",
+	"glMultiTexCoord3s",
+	"glMultiTexCoord3sv",
+	"glMultiTexCoord4d",
+	"glMultiTexCoord4dv",
+	"glMultiTexCoord4f",
+	"glMultiTexCoord4fv",
+	"glMultiTexCoord4i",
+	"glMultiTexCoord4iv",
+	"glMultiTexCoord4s",
+	"glMultiTexCoord4sv",
+	"glMultiTexCoordP1ui",
+	"glMultiTexCoordP1uiv",
+	"glMultiTexCoordP2ui",
+	"glMultiTexCoordP2uiv",
+	"glMultiTexCoordP3ui",
+	"glMultiTexCoordP3uiv",
+	"glMultiTexCoordP4ui",
+	"glMultiTexCoordP4uiv",
+	"glNamedBufferData",
+	"glNamedBufferStorage",
+	"glNamedBufferStorageEXT",
+	"glNamedBufferSubData",
+	"glNamedFramebufferDrawBuffer",
+	"glNamedFramebufferDrawBuffers",
+	"glNamedFramebufferParameteri",
+	"glNamedFramebufferReadBuffer",
+	"glNamedFramebufferRenderbuffer",
+	"glNamedFramebufferTexture",
+	"glNamedFramebufferTextureLayer",
+	"glNamedRenderbufferStorage",
+	"glNamedRenderbufferStorageMultisample",
+	"glNewList",
+	"glNormal3b",
+	"glNormal3bv",
+	"glNormal3d",
+	"glNormal3dv",
+	"glNormal3f",
+	"glNormal3fv",
+	"glNormal3i",
+	"glNormal3iv",
+	"glNormal3s",
+	"glNormal3sv",
+	"glNormalP3ui",
+	"glNormalP3uiv",
+	"glNormalPointer",
+	"glObjectLabel",
+	"glObjectPtrLabel",
+	"glOrtho",
+	"glPassThrough",
+	"glPatchParameterfv",
+	"glPatchParameteri",
+	"glPauseTransformFeedback",
+	"glPixelMapfv",
+	"glPixelMapuiv",
+	"glPixelMapusv",
+	"glPixelStoref",
+	"glPixelStorei",
+	"glPixelTransferf",
+	"glPixelTransferi",
+	"glPixelZoom",
+	"glPointParameterf",
+	"glPointParameterfv",
+	"glPointParameteri",
+	"glPointParameteriv",
+	"glPointSize",
+	"glPolygonMode",
+	"glPolygonOffset",
+	"glPolygonOffsetClamp",
+	"glPolygonStipple",
+	"glPopAttrib",
+	"glPopClientAttrib",
+	"glPopDebugGroup",
+	"glPopMatrix",
+	"glPopName",
+	"glPrimitiveRestartIndex",
+	"glPrioritizeTextures",
+	"glProgramBinary",
+	"glProgramParameteri",
+	"glProgramUniform1d",
+	"glProgramUniform1dv",
+	"glProgramUniform1f",
+	"glProgramUniform1fv",
+	"glProgramUniform1i",
+	"glProgramUniform1iv",
+	"glProgramUniform1ui",
+	"glProgramUniform1uiv",
+	"glProgramUniform2d",
+	"glProgramUniform2dv",
+	"glProgramUniform2f",
+	"glProgramUniform2fv",
+	"glProgramUniform2i",
+	"glProgramUniform2iv",
+	"glProgramUniform2ui",
+	"glProgramUniform2uiv",
+	"glProgramUniform3d",
+	"glProgramUniform3dv",
+	"glProgramUniform3f",
+	"glProgramUniform3fv",
+	"glProgramUniform3i",
+	"glProgramUniform3iv",
+	"glProgramUniform3ui",
+	"glProgramUniform3uiv",
+	"glProgramUniform4d",
+	"glProgramUniform4dv",
+	"glProgramUniform4f",
+	"glProgramUniform4fv",
+	"glProgramUniform4i",
+	"glProgramUniform4iv",
+	"glProgramUniform4ui",
+	"glProgramUniform4uiv",
+	"glProgramUniformHandleui64ARB",
+	"glProgramUniformHandleui64vARB",
+	"glProgramUniformMatrix2dv",
+	"glProgramUniformMatrix2fv",
+	"glProgramUniformMatrix2x3dv",
+	"glProgramUniformMatrix2x3fv",
+	"glProgramUniformMatrix2x4dv",
+	"glProgramUniformMatrix2x4fv",
+	"glProgramUniformMatrix3dv",
+	"glProgramUniformMatrix3fv",
+	"glProgramUniformMatrix3x2dv",
+	"glProgramUniformMatrix3x2fv",
+	"glProgramUniformMatrix3x4dv",
+	"glProgramUniformMatrix3x4fv",
+	"glProgramUniformMatrix4dv",
+	"glProgramUniformMatrix4fv",
+	"glProgramUniformMatrix4x2dv",
+	"glProgramUniformMatrix4x2fv",
+	"glProgramUniformMatrix4x3dv",
+	"glProgramUniformMatrix4x3fv",
+	"glProvokingVertex",
+	"glPushAttrib",
+	"glPushClientAttrib",
+	"glPushDebugGroup",
+	"glPushMatrix",
+	"glPushName",
+	"glQueryCounter",
+	"glRasterPos2d",
+	"glRasterPos2dv",
+	"glRasterPos2f",
+	"glRasterPos2fv",
+	"glRasterPos2i",
+	"glRasterPos2iv",
+	"glRasterPos2s",
+	"glRasterPos2sv",
+	"glRasterPos3d",
+	"glRasterPos3dv",
+	"glRasterPos3f",
+	"glRasterPos3fv",
+	"glRasterPos3i",
+	"glRasterPos3iv",
+	"glRasterPos3s",
+	"glRasterPos3sv",
+	"glRasterPos4d",
+	"glRasterPos4dv",
+	"glRasterPos4f",
+	"glRasterPos4fv",
+	"glRasterPos4i",
+	"glRasterPos4iv",
+	"glRasterPos4s",
+	"glRasterPos4sv",
+	"glReadBuffer",
+	"glReadPixels",
+	"glReadnPixels",
+	"glRectd",
+	"glRectdv",
+	"glRectf",
+	"glRectfv",
+	"glRecti",
+	"glRectiv",
+	"glRects",
+	"glRectsv",
+	"glReleaseShaderCompiler",
+	"glRenderMode",
+	"glRenderbufferStorage",
+	"glRenderbufferStorageMultisample",
+	"glResumeTransformFeedback",
+	"glRotated",
+	"glRotatef",
+	"glSampleCoverage",
+	"glSampleMaski",
+	"glSamplerParameterIiv",
+	"glSamplerParameterIuiv",
+	"glSamplerParameterf",
+	"glSamplerParameterfv",
+	"glSamplerParameteri",
+	"glSamplerParameteriv",
+	"glScaled",
+	"glScalef",
+	"glScissor",
+	"glScissorArrayv",
+	"glScissorIndexed",
+	"glScissorIndexedv",
+	"glSecondaryColor3b",
+	"glSecondaryColor3bv",
+	"glSecondaryColor3d",
+	"glSecondaryColor3dv",
+	"glSecondaryColor3f",
+	"glSecondaryColor3fv",
+	"glSecondaryColor3i",
+	"glSecondaryColor3iv",
+	"glSecondaryColor3s",
+	"glSecondaryColor3sv",
+	"glSecondaryColor3ub",
+	"glSecondaryColor3ubv",
+	"glSecondaryColor3ui",
+	"glSecondaryColor3uiv",
+	"glSecondaryColor3us",
+	"glSecondaryColor3usv",
+	"glSecondaryColorP3ui",
+	"glSecondaryColorP3uiv",
+	"glSecondaryColorPointer",
+	"glSelectBuffer",
+	"glShadeModel",
+	"glShaderBinary",
+	"glShaderSource",
+	"glShaderStorageBlockBinding",
+	"glSpecializeShader",
+	"glSpecializeShaderARB",
+	"glStencilFunc",
+	"glStencilFuncSeparate",
+	"glStencilMask",
+	"glStencilMaskSeparate",
+	"glStencilOp",
+	"glStencilOpSeparate",
+	"glTexBuffer",
+	"glTexBufferRange",
+	"glTexCoord1d",
+	"glTexCoord1dv",
+	"glTexCoord1f",
+	"glTexCoord1fv",
+	"glTexCoord1i",
+	"glTexCoord1iv",
+	"glTexCoord1s",
+	"glTexCoord1sv",
+	"glTexCoord2d",
+	"glTexCoord2dv",
+	"glTexCoord2f",
+	"glTexCoord2fv",
+	"glTexCoord2i",
+	"glTexCoord2iv",
+	"glTexCoord2s",
+	"glTexCoord2sv",
+	"glTexCoord3d",
+	"glTexCoord3dv",
+	"glTexCoord3f",
+	"glTexCoord3fv",
+	"glTexCoord3i",
+	"glTexCoord3iv",
+	"glTexCoord3s",
+	"glTexCoord3sv",
+	"glTexCoord4d",
+	"glTexCoord4dv",
+	"glTexCoord4f",
+	"glTexCoord4fv",
+	"glTexCoord4i",
+	"glTexCoord4iv",
+	"glTexCoord4s",
+	"glTexCoord4sv",
+	"glTexCoordP1ui",
+	"glTexCoordP1uiv",
+	"glTexCoordP2ui",
+	"glTexCoordP2uiv",
+	"glTexCoordP3ui",
+	"glTexCoordP3uiv",
+	"glTexCoordP4ui",
+	"glTexCoordP4uiv",
+	"glTexCoordPointer",
+	"glTexEnvf",
+	"glTexEnvfv",
+	"glTexEnvi",
+	"glTexEnviv",
+	"glTexGend",
+	"glTexGendv",
+	"glTexGenf",
+	"glTexGenfv",
+	"glTexGeni",
+	"glTexGeniv",
+	"glTexImage1D",
+	"glTexImage2D",
+	"glTexImage2DMultisample",
+	"glTexImage3D",
+	"glTexImage3DMultisample",
+	"glTexParameterIiv",
+	"glTexParameterIuiv",
+	"glTexParameterf",
+	"glTexParameterfv",
+	"glTexParameteri",
+	"glTexParameteriv",
+	"glTexStorage1D",
+	"glTexStorage2D",
+	"glTexStorage2DMultisample",
+	"glTexStorage3D",
+	"glTexStorage3DMultisample",
+	"glTexSubImage1D",
+	"glTexSubImage2D",
+	"glTexSubImage3D",
+	"glTextureBarrier",
+	"glTextureBuffer",
+	"glTextureBufferRange",
+	"glTextureParameterIiv",
+	"glTextureParameterIuiv",
+	"glTextureParameterf",
+	"glTextureParameterfv",
+	"glTextureParameteri",
+	"glTextureParameteriv",
+	"glTextureStorage1D",
+	"glTextureStorage2D",
+	"glTextureStorage2DMultisample",
+	"glTextureStorage3D",
+	"glTextureStorage3DMultisample",
+	"glTextureSubImage1D",
+	"glTextureSubImage2D",
+	"glTextureSubImage3D",
+	"glTextureView",
+	"glTransformFeedbackBufferBase",
+	"glTransformFeedbackBufferRange",
+	"glTransformFeedbackVaryings",
+	"glTranslated",
+	"glTranslatef",
+	"glUniform1d",
+	"glUniform1dv",
+	"glUniform1f",
+	"glUniform1fv",
+	"glUniform1i",
+	"glUniform1iv",
+	"glUniform1ui",
+	"glUniform1uiv",
+	"glUniform2d",
+	"glUniform2dv",
+	"glUniform2f",
+	"glUniform2fv",
+	"glUniform2i",
+	"glUniform2iv",
+	"glUniform2ui",
+	"glUniform2uiv",
+	"glUniform3d",
+	"glUniform3dv",
+	"glUniform3f",
+	"glUniform3fv",
+	"glUniform3i",
+	"glUniform3iv",
+	"glUniform3ui",
+	"glUniform3uiv",
+	"glUniform4d",
+	"glUniform4dv",
+	"glUniform4f",
+	"glUniform4fv",
+	"glUniform4i",
+	"glUniform4iv",
+	"glUniform4ui",
+	"glUniform4uiv",
+	"glUniformBlockBinding",
+	"glUniformHandleui64ARB",
+	"glUniformHandleui64vARB",
+	"glUniformMatrix2dv",
+	"glUniformMatrix2fv",
+	"glUniformMatrix2x3dv",
+	"glUniformMatrix2x3fv",
+	"glUniformMatrix2x4dv",
+	"glUniformMatrix2x4fv",
+	"glUniformMatrix3dv",
+	"glUniformMatrix3fv",
+	"glUniformMatrix3x2dv",
+	"glUniformMatrix3x2fv",
+	"glUniformMatrix3x4dv",
+	"glUniformMatrix3x4fv",
+	"glUniformMatrix4dv",
+	"glUniformMatrix4fv",
+	"glUniformMatrix4x2dv",
+	"glUniformMatrix4x2fv",
+	"glUniformMatrix4x3dv",
+	"glUniformMatrix4x3fv",
+	"glUniformSubroutinesuiv",
+	"glUnmapBuffer",
+	"glUnmapNamedBuffer",
+	"glUseProgram",
+	"glUseProgramStages",
+	"glValidateProgram",
+	"glValidateProgramPipeline",
+	"glVertex2d",
+	"glVertex2dv",
+	"glVertex2f",
+	"glVertex2fv",
+	"glVertex2i",
+	"glVertex2iv",
+	"glVertex2s",
+	"glVertex2sv",
+	"glVertex3d",
+	"glVertex3dv",
+	"glVertex3f",
+	"glVertex3fv",
+	"glVertex3i",
+	"glVertex3iv",
+	"glVertex3s",
+	"glVertex3sv",
+	"glVertex4d",
+	"glVertex4dv",
+	"glVertex4f",
+	"glVertex4fv",
+	"glVertex4i",
+	"glVertex4iv",
+	"glVertex4s",
+	"glVertex4sv",
+	"glVertexArrayAttribBinding",
+	"glVertexArrayAttribFormat",
+	"glVertexArrayAttribIFormat",
+	"glVertexArrayAttribLFormat",
+	"glVertexArrayBindingDivisor",
+	"glVertexArrayElementBuffer",
+	"glVertexArrayVertexBuffer",
+	"glVertexArrayVertexBuffers",
+	"glVertexAttrib1d",
+	"glVertexAttrib1dv",
+	"glVertexAttrib1f",
+	"glVertexAttrib1fv",
+	"glVertexAttrib1s",
+	"glVertexAttrib1sv",
+	"glVertexAttrib2d",
+	"glVertexAttrib2dv",
+	"glVertexAttrib2f",
+	"glVertexAttrib2fv",
+	"glVertexAttrib2s",
+	"glVertexAttrib2sv",
+	"glVertexAttrib3d",
+	"glVertexAttrib3dv",
+	"glVertexAttrib3f",
+	"glVertexAttrib3fv",
+	"glVertexAttrib3s",
+	"glVertexAttrib3sv",
+	"glVertexAttrib4Nbv",
+	"glVertexAttrib4Niv",
+	"glVertexAttrib4Nsv",
+	"glVertexAttrib4Nub",
+	"glVertexAttrib4Nubv",
+	"glVertexAttrib4Nuiv",
+	"glVertexAttrib4Nusv",
+	"glVertexAttrib4bv",
+	"glVertexAttrib4d",
+	"glVertexAttrib4dv",
+	"glVertexAttrib4f",
+	"glVertexAttrib4fv",
+	"glVertexAttrib4iv",
+	"glVertexAttrib4s",
+	"glVertexAttrib4sv",
+	"glVertexAttrib4ubv",
+	"glVertexAttrib4uiv",
+	"glVertexAttrib4usv",
+	"glVertexAttribBinding",
+	"glVertexAttribDivisor",
+	"glVertexAttribFormat",
+	"glVertexAttribI1i",
+	"glVertexAttribI1iv",
+	"glVertexAttribI1ui",
+	"glVertexAttribI1uiv",
+	"glVertexAttribI2i",
+	"glVertexAttribI2iv",
+	"glVertexAttribI2ui",
+	"glVertexAttribI2uiv",
+	"glVertexAttribI3i",
+	"glVertexAttribI3iv",
+	"glVertexAttribI3ui",
+	"glVertexAttribI3uiv",
+	"glVertexAttribI4bv",
+	"glVertexAttribI4i",
+	"glVertexAttribI4iv",
+	"glVertexAttribI4sv",
+	"glVertexAttribI4ubv",
+	"glVertexAttribI4ui",
+	"glVertexAttribI4uiv",
+	"glVertexAttribI4usv",
+	"glVertexAttribIFormat",
+	"glVertexAttribIPointer",
+	"glVertexAttribL1d",
+	"glVertexAttribL1dv",
+	"glVertexAttribL1ui64ARB",
+	"glVertexAttribL1ui64vARB",
+	"glVertexAttribL2d",
+	"glVertexAttribL2dv",
+	"glVertexAttribL3d",
+	"glVertexAttribL3dv",
+	"glVertexAttribL4d",
+	"glVertexAttribL4dv",
+	"glVertexAttribLFormat",
+	"glVertexAttribLPointer",
+	"glVertexAttribP1ui",
+	"glVertexAttribP1uiv",
+	"glVertexAttribP2ui",
+	"glVertexAttribP2uiv",
+	"glVertexAttribP3ui",
+	"glVertexAttribP3uiv",
+	"glVertexAttribP4ui",
+	"glVertexAttribP4uiv",
+	"glVertexAttribPointer",
+	"glVertexBindingDivisor",
+	"glVertexP2ui",
+	"glVertexP2uiv",
+	"glVertexP3ui",
+	"glVertexP3uiv",
+	"glVertexP4ui",
+	"glVertexP4uiv",
+	"glVertexPointer",
+	"glViewport",
+	"glViewportArrayv",
+	"glViewportIndexedf",
+	"glViewportIndexedfv",
+	"glWaitSync",
+	"glWindowPos2d",
+	"glWindowPos2dv",
+	"glWindowPos2f",
+	"glWindowPos2fv",
+	"glWindowPos2i",
+	"glWindowPos2iv",
+	"glWindowPos2s",
+	"glWindowPos2sv",
+	"glWindowPos3d",
+	"glWindowPos3dv",
+	"glWindowPos3f",
+	"glWindowPos3fv",
+	"glWindowPos3i",
+	"glWindowPos3iv",
+	"glWindowPos3s",
+	"glWindowPos3sv",
+};
+
+const unsigned char gl_stats_function_categories[GL_STATS_FUNCTION_COUNT] = {
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_SYNC,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_DISPATCH,
+	GL_STATS_CATEGORY_DISPATCH,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_SYNC,
+	GL_STATS_CATEGORY_SYNC,
+	GL_STATS_CATEGORY_SYNC,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_SYNC,
+	GL_STATS_CATEGORY_SYNC,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_DRAW,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_SYNC,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_SYNC,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_OTHER,
+};
+
+void gl_stats_layer_install(int count) {
+	if (count && glad_glAccum && glad_glAccum != glad_stats_impl_glAccum) { glad_stats_real_glAccum = glad_glAccum; glad_glAccum = glad_stats_impl_glAccum; }
+	else if (!count && glad_stats_real_glAccum) { glad_glAccum = glad_stats_real_glAccum; glad_stats_real_glAccum = 0; }
+	if (count && glad_glActiveShaderProgram && glad_glActiveShaderProgram != glad_stats_impl_glActiveShaderProgram) { glad_stats_real_glActiveShaderProgram = glad_glActiveShaderProgram; glad_glActiveShaderProgram = glad_stats_impl_glActiveShaderProgram; }
+	else if (!count && glad_stats_real_glActiveShaderProgram) { glad_glActiveShaderProgram = glad_stats_real_glActiveShaderProgram; glad_stats_real_glActiveShaderProgram = 0; }
+	if (count && glad_glActiveTexture && glad_glActiveTexture != glad_stats_impl_glActiveTexture) { glad_stats_real_glActiveTexture = glad_glActiveTexture; glad_glActiveTexture = glad_stats_impl_glActiveTexture; }
+	else if (!count && glad_stats_real_glActiveTexture) { glad_glActiveTexture = glad_stats_real_glActiveTexture; glad_stats_real_glActiveTexture = 0; }
+	if (count && glad_glAlphaFunc && glad_glAlphaFunc != glad_stats_impl_glAlphaFunc) { glad_stats_real_glAlphaFunc = glad_glAlphaFunc; glad_glAlphaFunc = glad_stats_impl_glAlphaFunc; }
+	else if (!count && glad_stats_real_glAlphaFunc) { glad_glAlphaFunc = glad_stats_real_glAlphaFunc; glad_stats_real_glAlphaFunc = 0; }
+	if (count && glad_glAreTexturesResident && glad_glAreTexturesResident != glad_stats_impl_glAreTexturesResident) { glad_stats_real_glAreTexturesResident = glad_glAreTexturesResident; glad_glAreTexturesResident = glad_stats_impl_glAreTexturesResident; }
+	else if (!count && glad_stats_real_glAreTexturesResident) { glad_glAreTexturesResident = glad_stats_real_glAreTexturesResident; glad_stats_real_glAreTexturesResident = 0; }
+	if (count && glad_glArrayElement && glad_glArrayElement != glad_stats_impl_glArrayElement) { glad_stats_real_glArrayElement = glad_glArrayElement; glad_glArrayElement = glad_stats_impl_glArrayElement; }
+	else if (!count && glad_stats_real_glArrayElement) { glad_glArrayElement = glad_stats_real_glArrayElement; glad_stats_real_glArrayElement = 0; }
+	if (count && glad_glAttachShader && glad_glAttachShader != glad_stats_impl_glAttachShader) { glad_stats_real_glAttachShader = glad_glAttachShader; glad_glAttachShader = glad_stats_impl_glAttachShader; }
+	else if (!count && glad_stats_real_glAttachShader) { glad_glAttachShader = glad_stats_real_glAttachShader; glad_stats_real_glAttachShader = 0; }
+	if (count && glad_glBegin && glad_glBegin != glad_stats_impl_glBegin) { glad_stats_real_glBegin = glad_glBegin; glad_glBegin = glad_stats_impl_glBegin; }
+	else if (!count && glad_stats_real_glBegin) { glad_glBegin = glad_stats_real_glBegin; glad_stats_real_glBegin = 0; }
+	if (count && glad_glBeginConditionalRender && glad_glBeginConditionalRender != glad_stats_impl_glBeginConditionalRender) { glad_stats_real_glBeginConditionalRender = glad_glBeginConditionalRender; glad_glBeginConditionalRender = glad_stats_impl_glBeginConditionalRender; }
+	else if (!count && glad_stats_real_glBeginConditionalRender) { glad_glBeginConditionalRender = glad_stats_real_glBeginConditionalRender; glad_stats_real_glBeginConditionalRender = 0; }
+	if (count && glad_glBeginQuery && glad_glBeginQuery != glad_stats_impl_glBeginQuery) { glad_stats_real_glBeginQuery = glad_glBeginQuery; glad_glBeginQuery = glad_stats_impl_glBeginQuery; }
+	else if (!count && glad_stats_real_glBeginQuery) { glad_glBeginQuery = glad_stats_real_glBeginQuery; glad_stats_real_glBeginQuery = 0; }
+	if (count && glad_glBeginQueryIndexed && glad_glBeginQueryIndexed != glad_stats_impl_glBeginQueryIndexed) { glad_stats_real_glBeginQueryIndexed = glad_glBeginQueryIndexed; glad_glBeginQueryIndexed = glad_stats_impl_glBeginQueryIndexed; }
+	else if (!count && glad_stats_real_glBeginQueryIndexed) { glad_glBeginQueryIndexed = glad_stats_real_glBeginQueryIndexed; glad_stats_real_glBeginQueryIndexed = 0; }
+	if (count && glad_glBeginTransformFeedback && glad_glBeginTransformFeedback != glad_stats_impl_glBeginTransformFeedback) { glad_stats_real_glBeginTransformFeedback = glad_glBeginTransformFeedback; glad_glBeginTransformFeedback = glad_stats_impl_glBeginTransformFeedback; }
+	else if (!count && glad_stats_real_glBeginTransformFeedback) { glad_glBeginTransformFeedback = glad_stats_real_glBeginTransformFeedback; glad_stats_real_glBeginTransformFeedback = 0; }
+	if (count && glad_glBindAttribLocation && glad_glBindAttribLocation != glad_stats_impl_glBindAttribLocation) { glad_stats_real_glBindAttribLocation = glad_glBindAttribLocation; glad_glBindAttribLocation = glad_stats_impl_glBindAttribLocation; }
+	else if (!count && glad_stats_real_glBindAttribLocation) { glad_glBindAttribLocation = glad_stats_real_glBindAttribLocation; glad_stats_real_glBindAttribLocation = 0; }
+	if (count && glad_glBindBuffer && glad_glBindBuffer != glad_stats_impl_glBindBuffer) { glad_stats_real_glBindBuffer = glad_glBindBuffer; glad_glBindBuffer = glad_stats_impl_glBindBuffer; }
+	else if (!count && glad_stats_real_glBindBuffer) { glad_glBindBuffer = glad_stats_real_glBindBuffer; glad_stats_real_glBindBuffer = 0; }
+	if (count && glad_glBindBufferBase && glad_glBindBufferBase != glad_stats_impl_glBindBufferBase) { glad_stats_real_glBindBufferBase = glad_glBindBufferBase; glad_glBindBufferBase = glad_stats_impl_glBindBufferBase; }
+	else if (!count && glad_stats_real_glBindBufferBase) { glad_glBindBufferBase = glad_stats_real_glBindBufferBase; glad_stats_real_glBindBufferBase = 0; }
+	if (count && glad_glBindBufferRange && glad_glBindBufferRange != glad_stats_impl_glBindBufferRange) { glad_stats_real_glBindBufferRange = glad_glBindBufferRange; glad_glBindBufferRange = glad_stats_impl_glBindBufferRange; }
+	else if (!count && glad_stats_real_glBindBufferRange) { glad_glBindBufferRange = glad_stats_real_glBindBufferRange; glad_stats_real_glBindBufferRange = 0; }
+	if (count && glad_glBindBuffersBase && glad_glBindBuffersBase != glad_stats_impl_glBindBuffersBase) { glad_stats_real_glBindBuffersBase = glad_glBindBuffersBase; glad_glBindBuffersBase = glad_stats_impl_glBindBuffersBase; }
+	else if (!count && glad_stats_real_glBindBuffersBase) { glad_glBindBuffersBase = glad_stats_real_glBindBuffersBase; glad_stats_real_glBindBuffersBase = 0; }
+	if (count && glad_glBindBuffersRange && glad_glBindBuffersRange != glad_stats_impl_glBindBuffersRange) { glad_stats_real_glBindBuffersRange = glad_glBindBuffersRange; glad_glBindBuffersRange = glad_stats_impl_glBindBuffersRange; }
+	else if (!count && glad_stats_real_glBindBuffersRange) { glad_glBindBuffersRange = glad_stats_real_glBindBuffersRange; glad_stats_real_glBindBuffersRange = 0; }
+	if (count && glad_glBindFragDataLocation && glad_glBindFragDataLocation != glad_stats_impl_glBindFragDataLocation) { glad_stats_real_glBindFragDataLocation = glad_glBindFragDataLocation; glad_glBindFragDataLocation = glad_stats_impl_glBindFragDataLocation; }
+	else if (!count && glad_stats_real_glBindFragDataLocation) { glad_glBindFragDataLocation = glad_stats_real_glBindFragDataLocation; glad_stats_real_glBindFragDataLocation = 0; }
+	if (count && glad_glBindFragDataLocationIndexed && glad_glBindFragDataLocationIndexed != glad_stats_impl_glBindFragDataLocationIndexed) { glad_stats_real_glBindFragDataLocationIndexed = glad_glBindFragDataLocationIndexed; glad_glBindFragDataLocationIndexed = glad_stats_impl_glBindFragDataLocationIndexed; }
+	else if (!count && glad_stats_real_glBindFragDataLocationIndexed) { glad_glBindFragDataLocationIndexed = glad_stats_real_glBindFragDataLocationIndexed; glad_stats_real_glBindFragDataLocationIndexed = 0; }
+	if (count && glad_glBindFramebuffer && glad_glBindFramebuffer != glad_stats_impl_glBindFramebuffer) { glad_stats_real_glBindFramebuffer = glad_glBindFramebuffer; glad_glBindFramebuffer = glad_stats_impl_glBindFramebuffer; }
+	else if (!count && glad_stats_real_glBindFramebuffer) { glad_glBindFramebuffer = glad_stats_real_glBindFramebuffer; glad_stats_real_glBindFramebuffer = 0; }
+	if (count && glad_glBindImageTexture && glad_glBindImageTexture != glad_stats_impl_glBindImageTexture) { glad_stats_real_glBindImageTexture = glad_glBindImageTexture; glad_glBindImageTexture = glad_stats_impl_glBindImageTexture; }
+	else if (!count && glad_stats_real_glBindImageTexture) { glad_glBindImageTexture = glad_stats_real_glBindImageTexture; glad_stats_real_glBindImageTexture = 0; }
+	if (count && glad_glBindImageTextures && glad_glBindImageTextures != glad_stats_impl_glBindImageTextures) { glad_stats_real_glBindImageTextures = glad_glBindImageTextures; glad_glBindImageTextures = glad_stats_impl_glBindImageTextures; }
+	else if (!count && glad_stats_real_glBindImageTextures) { glad_glBindImageTextures = glad_stats_real_glBindImageTextures; glad_stats_real_glBindImageTextures = 0; }
+	if (count && glad_glBindProgramPipeline && glad_glBindProgramPipeline != glad_stats_impl_glBindProgramPipeline) { glad_stats_real_glBindProgramPipeline = glad_glBindProgramPipeline; glad_glBindProgramPipeline = glad_stats_impl_glBindProgramPipeline; }
+	else if (!count && glad_stats_real_glBindProgramPipeline) { glad_glBindProgramPipeline = glad_stats_real_glBindProgramPipeline; glad_stats_real_glBindProgramPipeline = 0; }
+	if (count && glad_glBindRenderbuffer && glad_glBindRenderbuffer != glad_stats_impl_glBindRenderbuffer) { glad_stats_real_glBindRenderbuffer = glad_glBindRenderbuffer; glad_glBindRenderbuffer = glad_stats_impl_glBindRenderbuffer; }
+	else if (!count && glad_stats_real_glBindRenderbuffer) { glad_glBindRenderbuffer = glad_stats_real_glBindRenderbuffer; glad_stats_real_glBindRenderbuffer = 0; }
+	if (count && glad_glBindSampler && glad_glBindSampler != glad_stats_impl_glBindSampler) { glad_stats_real_glBindSampler = glad_glBindSampler; glad_glBindSampler = glad_stats_impl_glBindSampler; }
+	else if (!count && glad_stats_real_glBindSampler) { glad_glBindSampler = glad_stats_real_glBindSampler; glad_stats_real_glBindSampler = 0; }
+	if (count && glad_glBindSamplers && glad_glBindSamplers != glad_stats_impl_glBindSamplers) { glad_stats_real_glBindSamplers = glad_glBindSamplers; glad_glBindSamplers = glad_stats_impl_glBindSamplers; }
+	else if (!count && glad_stats_real_glBindSamplers) { glad_glBindSamplers = glad_stats_real_glBindSamplers; glad_stats_real_glBindSamplers = 0; }
+	if (count && glad_glBindTexture && glad_glBindTexture != glad_stats_impl_glBindTexture) { glad_stats_real_glBindTexture = glad_glBindTexture; glad_glBindTexture = glad_stats_impl_glBindTexture; }
+	else if (!count && glad_stats_real_glBindTexture) { glad_glBindTexture = glad_stats_real_glBindTexture; glad_stats_real_glBindTexture = 0; }
+	if (count && glad_glBindTextureUnit && glad_glBindTextureUnit != glad_stats_impl_glBindTextureUnit) { glad_stats_real_glBindTextureUnit = glad_glBindTextureUnit; glad_glBindTextureUnit = glad_stats_impl_glBindTextureUnit; }
+	else if (!count && glad_stats_real_glBindTextureUnit) { glad_glBindTextureUnit = glad_stats_real_glBindTextureUnit; glad_stats_real_glBindTextureUnit = 0; }
+	if (count && glad_glBindTextures && glad_glBindTextures != glad_stats_impl_glBindTextures) { glad_stats_real_glBindTextures = glad_glBindTextures; glad_glBindTextures = glad_stats_impl_glBindTextures; }
+	else if (!count && glad_stats_real_glBindTextures) { glad_glBindTextures = glad_stats_real_glBindTextures; glad_stats_real_glBindTextures = 0; }
+	if (count && glad_glBindTransformFeedback && glad_glBindTransformFeedback != glad_stats_impl_glBindTransformFeedback) { glad_stats_real_glBindTransformFeedback = glad_glBindTransformFeedback; glad_glBindTransformFeedback = glad_stats_impl_glBindTransformFeedback; }
+	else if (!count && glad_stats_real_glBindTransformFeedback) { glad_glBindTransformFeedback = glad_stats_real_glBindTransformFeedback; glad_stats_real_glBindTransformFeedback = 0; }
+	if (count && glad_glBindVertexArray && glad_glBindVertexArray != glad_stats_impl_glBindVertexArray) { glad_stats_real_glBindVertexArray = glad_glBindVertexArray; glad_glBindVertexArray = glad_stats_impl_glBindVertexArray; }
+	else if (!count && glad_stats_real_glBindVertexArray) { glad_glBindVertexArray = glad_stats_real_glBindVertexArray; glad_stats_real_glBindVertexArray = 0; }
+	if (count && glad_glBindVertexBuffer && glad_glBindVertexBuffer != glad_stats_impl_glBindVertexBuffer) { glad_stats_real_glBindVertexBuffer = glad_glBindVertexBuffer; glad_glBindVertexBuffer = glad_stats_impl_glBindVertexBuffer; }
+	else if (!count && glad_stats_real_glBindVertexBuffer) { glad_glBindVertexBuffer = glad_stats_real_glBindVertexBuffer; glad_stats_real_glBindVertexBuffer = 0; }
+	if (count && glad_glBindVertexBuffers && glad_glBindVertexBuffers != glad_stats_impl_glBindVertexBuffers) { glad_stats_real_glBindVertexBuffers = glad_glBindVertexBuffers; glad_glBindVertexBuffers = glad_stats_impl_glBindVertexBuffers; }
+	else if (!count && glad_stats_real_glBindVertexBuffers) { glad_glBindVertexBuffers = glad_stats_real_glBindVertexBuffers; glad_stats_real_glBindVertexBuffers = 0; }
+	if (count && glad_glBitmap && glad_glBitmap != glad_stats_impl_glBitmap) { glad_stats_real_glBitmap = glad_glBitmap; glad_glBitmap = glad_stats_impl_glBitmap; }
+	else if (!count && glad_stats_real_glBitmap) { glad_glBitmap = glad_stats_real_glBitmap; glad_stats_real_glBitmap = 0; }
+	if (count && glad_glBlendColor && glad_glBlendColor != glad_stats_impl_glBlendColor) { glad_stats_real_glBlendColor = glad_glBlendColor; glad_glBlendColor = glad_stats_impl_glBlendColor; }
+	else if (!count && glad_stats_real_glBlendColor) { glad_glBlendColor = glad_stats_real_glBlendColor; glad_stats_real_glBlendColor = 0; }
+	if (count && glad_glBlendEquation && glad_glBlendEquation != glad_stats_impl_glBlendEquation) { glad_stats_real_glBlendEquation = glad_glBlendEquation; glad_glBlendEquation = glad_stats_impl_glBlendEquation; }
+	else if (!count && glad_stats_real_glBlendEquation) { glad_glBlendEquation = glad_stats_real_glBlendEquation; glad_stats_real_glBlendEquation = 0; }
+	if (count && glad_glBlendEquationSeparate && glad_glBlendEquationSeparate != glad_stats_impl_glBlendEquationSeparate) { glad_stats_real_glBlendEquationSeparate = glad_glBlendEquationSeparate; glad_glBlendEquationSeparate = glad_stats_impl_glBlendEquationSeparate; }
+	else if (!count && glad_stats_real_glBlendEquationSeparate) { glad_glBlendEquationSeparate = glad_stats_real_glBlendEquationSeparate; glad_stats_real_glBlendEquationSeparate = 0; }
+	if (count && glad_glBlendEquationSeparatei && glad_glBlendEquationSeparatei != glad_stats_impl_glBlendEquationSeparatei) { glad_stats_real_glBlendEquationSeparatei = glad_glBlendEquationSeparatei; glad_glBlendEquationSeparatei = glad_stats_impl_glBlendEquationSeparatei; }
+	else if (!count && glad_stats_real_glBlendEquationSeparatei) { glad_glBlendEquationSeparatei = glad_stats_real_glBlendEquationSeparatei; glad_stats_real_glBlendEquationSeparatei = 0; }
+	if (count && glad_glBlendEquationi && glad_glBlendEquationi != glad_stats_impl_glBlendEquationi) { glad_stats_real_glBlendEquationi = glad_glBlendEquationi; glad_glBlendEquationi = glad_stats_impl_glBlendEquationi; }
+	else if (!count && glad_stats_real_glBlendEquationi) { glad_glBlendEquationi = glad_stats_real_glBlendEquationi; glad_stats_real_glBlendEquationi = 0; }
+	if (count && glad_glBlendFunc && glad_glBlendFunc != glad_stats_impl_glBlendFunc) { glad_stats_real_glBlendFunc = glad_glBlendFunc; glad_glBlendFunc = glad_stats_impl_glBlendFunc; }
+	else if (!count && glad_stats_real_glBlendFunc) { glad_glBlendFunc = glad_stats_real_glBlendFunc; glad_stats_real_glBlendFunc = 0; }
+	if (count && glad_glBlendFuncSeparate && glad_glBlendFuncSeparate != glad_stats_impl_glBlendFuncSeparate) { glad_stats_real_glBlendFuncSeparate = glad_glBlendFuncSeparate; glad_glBlendFuncSeparate = glad_stats_impl_glBlendFuncSeparate; }
+	else if (!count && glad_stats_real_glBlendFuncSeparate) { glad_glBlendFuncSeparate = glad_stats_real_glBlendFuncSeparate; glad_stats_real_glBlendFuncSeparate = 0; }
+	if (count && glad_glBlendFuncSeparatei && glad_glBlendFuncSeparatei != glad_stats_impl_glBlendFuncSeparatei) { glad_stats_real_glBlendFuncSeparatei = glad_glBlendFuncSeparatei; glad_glBlendFuncSeparatei = glad_stats_impl_glBlendFuncSeparatei; }
+	else if (!count && glad_stats_real_glBlendFuncSeparatei) { glad_glBlendFuncSeparatei = glad_stats_real_glBlendFuncSeparatei; glad_stats_real_glBlendFuncSeparatei = 0; }
+	if (count && glad_glBlendFunci && glad_glBlendFunci != glad_stats_impl_glBlendFunci) { glad_stats_real_glBlendFunci = glad_glBlendFunci; glad_glBlendFunci = glad_stats_impl_glBlendFunci; }
+	else if (!count && glad_stats_real_glBlendFunci) { glad_glBlendFunci = glad_stats_real_glBlendFunci; glad_stats_real_glBlendFunci = 0; }
+	if (count && glad_glBlitFramebuffer && glad_glBlitFramebuffer != glad_stats_impl_glBlitFramebuffer) { glad_stats_real_glBlitFramebuffer = glad_glBlitFramebuffer; glad_glBlitFramebuffer = glad_stats_impl_glBlitFramebuffer; }
+	else if (!count && glad_stats_real_glBlitFramebuffer) { glad_glBlitFramebuffer = glad_stats_real_glBlitFramebuffer; glad_stats_real_glBlitFramebuffer = 0; }
+	if (count && glad_glBlitNamedFramebuffer && glad_glBlitNamedFramebuffer != glad_stats_impl_glBlitNamedFramebuffer) { glad_stats_real_glBlitNamedFramebuffer = glad_glBlitNamedFramebuffer; glad_glBlitNamedFramebuffer = glad_stats_impl_glBlitNamedFramebuffer; }
+	else if (!count && glad_stats_real_glBlitNamedFramebuffer) { glad_glBlitNamedFramebuffer = glad_stats_real_glBlitNamedFramebuffer; glad_stats_real_glBlitNamedFramebuffer = 0; }
+	if (count && glad_glBufferData && glad_glBufferData != glad_stats_impl_glBufferData) { glad_stats_real_glBufferData = glad_glBufferData; glad_glBufferData = glad_stats_impl_glBufferData; }
+	else if (!count && glad_stats_real_glBufferData) { glad_glBufferData = glad_stats_real_glBufferData; glad_stats_real_glBufferData = 0; }
+	if (count && glad_glBufferStorage && glad_glBufferStorage != glad_stats_impl_glBufferStorage) { glad_stats_real_glBufferStorage = glad_glBufferStorage; glad_glBufferStorage = glad_stats_impl_glBufferStorage; }
+	else if (!count && glad_stats_real_glBufferStorage) { glad_glBufferStorage = glad_stats_real_glBufferStorage; glad_stats_real_glBufferStorage = 0; }
+	if (count && glad_glBufferSubData && glad_glBufferSubData != glad_stats_impl_glBufferSubData) { glad_stats_real_glBufferSubData = glad_glBufferSubData; glad_glBufferSubData = glad_stats_impl_glBufferSubData; }
+	else if (!count && glad_stats_real_glBufferSubData) { glad_glBufferSubData = glad_stats_real_glBufferSubData; glad_stats_real_glBufferSubData = 0; }
+	if (count && glad_glCallList && glad_glCallList != glad_stats_impl_glCallList) { glad_stats_real_glCallList = glad_glCallList; glad_glCallList = glad_stats_impl_glCallList; }
+	else if (!count && glad_stats_real_glCallList) { glad_glCallList = glad_stats_real_glCallList; glad_stats_real_glCallList = 0; }
+	if (count && glad_glCallLists && glad_glCallLists != glad_stats_impl_glCallLists) { glad_stats_real_glCallLists = glad_glCallLists; glad_glCallLists = glad_stats_impl_glCallLists; }
+	else if (!count && glad_stats_real_glCallLists) { glad_glCallLists = glad_stats_real_glCallLists; glad_stats_real_glCallLists = 0; }
+	if (count && glad_glCheckFramebufferStatus && glad_glCheckFramebufferStatus != glad_stats_impl_glCheckFramebufferStatus) { glad_stats_real_glCheckFramebufferStatus = glad_glCheckFramebufferStatus; glad_glCheckFramebufferStatus = glad_stats_impl_glCheckFramebufferStatus; }
+	else if (!count && glad_stats_real_glCheckFramebufferStatus) { glad_glCheckFramebufferStatus = glad_stats_real_glCheckFramebufferStatus; glad_stats_real_glCheckFramebufferStatus = 0; }
+	if (count && glad_glCheckNamedFramebufferStatus && glad_glCheckNamedFramebufferStatus != glad_stats_impl_glCheckNamedFramebufferStatus) { glad_stats_real_glCheckNamedFramebufferStatus = glad_glCheckNamedFramebufferStatus; glad_glCheckNamedFramebufferStatus = glad_stats_impl_glCheckNamedFramebufferStatus; }
+	else if (!count && glad_stats_real_glCheckNamedFramebufferStatus) { glad_glCheckNamedFramebufferStatus = glad_stats_real_glCheckNamedFramebufferStatus; glad_stats_real_glCheckNamedFramebufferStatus = 0; }
+	if (count && glad_glClampColor && glad_glClampColor != glad_stats_impl_glClampColor) { glad_stats_real_glClampColor = glad_glClampColor; glad_glClampColor = glad_stats_impl_glClampColor; }
+	else if (!count && glad_stats_real_glClampColor) { glad_glClampColor = glad_stats_real_glClampColor; glad_stats_real_glClampColor = 0; }
+	if (count && glad_glClear && glad_glClear != glad_stats_impl_glClear) { glad_stats_real_glClear = glad_glClear; glad_glClear = glad_stats_impl_glClear; }
+	else if (!count && glad_stats_real_glClear) { glad_glClear = glad_stats_real_glClear; glad_stats_real_glClear = 0; }
+	if (count && glad_glClearAccum && glad_glClearAccum != glad_stats_impl_glClearAccum) { glad_stats_real_glClearAccum = glad_glClearAccum; glad_glClearAccum = glad_stats_impl_glClearAccum; }
+	else if (!count && glad_stats_real_glClearAccum) { glad_glClearAccum = glad_stats_real_glClearAccum; glad_stats_real_glClearAccum = 0; }
+	if (count && glad_glClearBufferData && glad_glClearBufferData != glad_stats_impl_glClearBufferData) { glad_stats_real_glClearBufferData = glad_glClearBufferData; glad_glClearBufferData = glad_stats_impl_glClearBufferData; }
+	else if (!count && glad_stats_real_glClearBufferData) { glad_glClearBufferData = glad_stats_real_glClearBufferData; glad_stats_real_glClearBufferData = 0; }
+	if (count && glad_glClearBufferSubData && glad_glClearBufferSubData != glad_stats_impl_glClearBufferSubData) { glad_stats_real_glClearBufferSubData = glad_glClearBufferSubData; glad_glClearBufferSubData = glad_stats_impl_glClearBufferSubData; }
+	else if (!count && glad_stats_real_glClearBufferSubData) { glad_glClearBufferSubData = glad_stats_real_glClearBufferSubData; glad_stats_real_glClearBufferSubData = 0; }
+	if (count && glad_glClearBufferfi && glad_glClearBufferfi != glad_stats_impl_glClearBufferfi) { glad_stats_real_glClearBufferfi = glad_glClearBufferfi; glad_glClearBufferfi = glad_stats_impl_glClearBufferfi; }
+	else if (!count && glad_stats_real_glClearBufferfi) { glad_glClearBufferfi = glad_stats_real_glClearBufferfi; glad_stats_real_glClearBufferfi = 0; }
+	if (count && glad_glClearBufferfv && glad_glClearBufferfv != glad_stats_impl_glClearBufferfv) { glad_stats_real_glClearBufferfv = glad_glClearBufferfv; glad_glClearBufferfv = glad_stats_impl_glClearBufferfv; }
+	else if (!count && glad_stats_real_glClearBufferfv) { glad_glClearBufferfv = glad_stats_real_glClearBufferfv; glad_stats_real_glClearBufferfv = 0; }
+	if (count && glad_glClearBufferiv && glad_glClearBufferiv != glad_stats_impl_glClearBufferiv) { glad_stats_real_glClearBufferiv = glad_glClearBufferiv; glad_glClearBufferiv = glad_stats_impl_glClearBufferiv; }
+	else if (!count && glad_stats_real_glClearBufferiv) { glad_glClearBufferiv = glad_stats_real_glClearBufferiv; glad_stats_real_glClearBufferiv = 0; }
+	if (count && glad_glClearBufferuiv && glad_glClearBufferuiv != glad_stats_impl_glClearBufferuiv) { glad_stats_real_glClearBufferuiv = glad_glClearBufferuiv; glad_glClearBufferuiv = glad_stats_impl_glClearBufferuiv; }
+	else if (!count && glad_stats_real_glClearBufferuiv) { glad_glClearBufferuiv = glad_stats_real_glClearBufferuiv; glad_stats_real_glClearBufferuiv = 0; }
+	if (count && glad_glClearColor && glad_glClearColor != glad_stats_impl_glClearColor) { glad_stats_real_glClearColor = glad_glClearColor; glad_glClearColor = glad_stats_impl_glClearColor; }
+	else if (!count && glad_stats_real_glClearColor) { glad_glClearColor = glad_stats_real_glClearColor; glad_stats_real_glClearColor = 0; }
+	if (count && glad_glClearDepth && glad_glClearDepth != glad_stats_impl_glClearDepth) { glad_stats_real_glClearDepth = glad_glClearDepth; glad_glClearDepth = glad_stats_impl_glClearDepth; }
+	else if (!count && glad_stats_real_glClearDepth) { glad_glClearDepth = glad_stats_real_glClearDepth; glad_stats_real_glClearDepth = 0; }
+	if (count && glad_glClearDepthf && glad_glClearDepthf != glad_stats_impl_glClearDepthf) { glad_stats_real_glClearDepthf = glad_glClearDepthf; glad_glClearDepthf = glad_stats_impl_glClearDepthf; }
+	else if (!count && glad_stats_real_glClearDepthf) { glad_glClearDepthf = glad_stats_real_glClearDepthf; glad_stats_real_glClearDepthf = 0; }
+	if (count && glad_glClearIndex && glad_glClearIndex != glad_stats_impl_glClearIndex) { glad_stats_real_glClearIndex = glad_glClearIndex; glad_glClearIndex = glad_stats_impl_glClearIndex; }
+	else if (!count && glad_stats_real_glClearIndex) { glad_glClearIndex = glad_stats_real_glClearIndex; glad_stats_real_glClearIndex = 0; }
+	if (count && glad_glClearNamedBufferData && glad_glClearNamedBufferData != glad_stats_impl_glClearNamedBufferData) { glad_stats_real_glClearNamedBufferData = glad_glClearNamedBufferData; glad_glClearNamedBufferData = glad_stats_impl_glClearNamedBufferData; }
+	else if (!count && glad_stats_real_glClearNamedBufferData) { glad_glClearNamedBufferData = glad_stats_real_glClearNamedBufferData; glad_stats_real_glClearNamedBufferData = 0; }
+	if (count && glad_glClearNamedBufferSubData && glad_glClearNamedBufferSubData != glad_stats_impl_glClearNamedBufferSubData) { glad_stats_real_glClearNamedBufferSubData = glad_glClearNamedBufferSubData; glad_glClearNamedBufferSubData = glad_stats_impl_glClearNamedBufferSubData; }
+	else if (!count && glad_stats_real_glClearNamedBufferSubData) { glad_glClearNamedBufferSubData = glad_stats_real_glClearNamedBufferSubData; glad_stats_real_glClearNamedBufferSubData = 0; }
+	if (count && glad_glClearNamedFramebufferfi && glad_glClearNamedFramebufferfi != glad_stats_impl_glClearNamedFramebufferfi) { glad_stats_real_glClearNamedFramebufferfi = glad_glClearNamedFramebufferfi; glad_glClearNamedFramebufferfi = glad_stats_impl_glClearNamedFramebufferfi; }
+	else if (!count && glad_stats_real_glClearNamedFramebufferfi) { glad_glClearNamedFramebufferfi = glad_stats_real_glClearNamedFramebufferfi; glad_stats_real_glClearNamedFramebufferfi = 0; }
+	if (count && glad_glClearNamedFramebufferfv && glad_glClearNamedFramebufferfv != glad_stats_impl_glClearNamedFramebufferfv) { glad_stats_real_glClearNamedFramebufferfv = glad_glClearNamedFramebufferfv; glad_glClearNamedFramebufferfv = glad_stats_impl_glClearNamedFramebufferfv; }
+	else if (!count && glad_stats_real_glClearNamedFramebufferfv) { glad_glClearNamedFramebufferfv = glad_stats_real_glClearNamedFramebufferfv; glad_stats_real_glClearNamedFramebufferfv = 0; }
+	if (count && glad_glClearNamedFramebufferiv && glad_glClearNamedFramebufferiv != glad_stats_impl_glClearNamedFramebufferiv) { glad_stats_real_glClearNamedFramebufferiv = glad_glClearNamedFramebufferiv; glad_glClearNamedFramebufferiv = glad_stats_impl_glClearNamedFramebufferiv; }
+	else if (!count && glad_stats_real_glClearNamedFramebufferiv) { glad_glClearNamedFramebufferiv = glad_stats_real_glClearNamedFramebufferiv; glad_stats_real_glClearNamedFramebufferiv = 0; }
+	if (count && glad_glClearNamedFramebufferuiv && glad_glClearNamedFramebufferuiv != glad_stats_impl_glClearNamedFramebufferuiv) { glad_stats_real_glClearNamedFramebufferuiv = glad_glClearNamedFramebufferuiv; glad_glClearNamedFramebufferuiv = glad_stats_impl_glClearNamedFramebufferuiv; }
+	else if (!count && glad_stats_real_glClearNamedFramebufferuiv) { glad_glClearNamedFramebufferuiv = glad_stats_real_glClearNamedFramebufferuiv; glad_stats_real_glClearNamedFramebufferuiv = 0; }
+	if (count && glad_glClearStencil && glad_glClearStencil != glad_stats_impl_glClearStencil) { glad_stats_real_glClearStencil = glad_glClearStencil; glad_glClearStencil = glad_stats_impl_glClearStencil; }
+	else if (!count && glad_stats_real_glClearStencil) { glad_glClearStencil = glad_stats_real_glClearStencil; glad_stats_real_glClearStencil = 0; }
+	if (count && glad_glClearTexImage && glad_glClearTexImage != glad_stats_impl_glClearTexImage) { glad_stats_real_glClearTexImage = glad_glClearTexImage; glad_glClearTexImage = glad_stats_impl_glClearTexImage; }
+	else if (!count && glad_stats_real_glClearTexImage) { glad_glClearTexImage = glad_stats_real_glClearTexImage; glad_stats_real_glClearTexImage = 0; }
+	if (count && glad_glClearTexSubImage && glad_glClearTexSubImage != glad_stats_impl_glClearTexSubImage) { glad_stats_real_glClearTexSubImage = glad_glClearTexSubImage; glad_glClearTexSubImage = glad_stats_impl_glClearTexSubImage; }
+	else if (!count && glad_stats_real_glClearTexSubImage) { glad_glClearTexSubImage = glad_stats_real_glClearTexSubImage; glad_stats_real_glClearTexSubImage = 0; }
+	if (count && glad_glClientActiveTexture && glad_glClientActiveTexture != glad_stats_impl_glClientActiveTexture) { glad_stats_real_glClientActiveTexture = glad_glClientActiveTexture; glad_glClientActiveTexture = glad_stats_impl_glClientActiveTexture; }
+	else if (!count && glad_stats_real_glClientActiveTexture) { glad_glClientActiveTexture = glad_stats_real_glClientActiveTexture; glad_stats_real_glClientActiveTexture = 0; }
+	if (count && glad_glClientWaitSync && glad_glClientWaitSync != glad_stats_impl_glClientWaitSync) { glad_stats_real_glClientWaitSync = glad_glClientWaitSync; glad_glClientWaitSync = glad_stats_impl_glClientWaitSync; }
+	else if (!count && glad_stats_real_glClientWaitSync) { glad_glClientWaitSync = glad_stats_real_glClientWaitSync; glad_stats_real_glClientWaitSync = 0; }
+	if (count && glad_glClipControl && glad_glClipControl != glad_stats_impl_glClipControl) { glad_stats_real_glClipControl = glad_glClipControl; glad_glClipControl = glad_stats_impl_glClipControl; }
+	else if (!count && glad_stats_real_glClipControl) { glad_glClipControl = glad_stats_real_glClipControl; glad_stats_real_glClipControl = 0; }
+	if (count && glad_glClipPlane && glad_glClipPlane != glad_stats_impl_glClipPlane) { glad_stats_real_glClipPlane = glad_glClipPlane; glad_glClipPlane = glad_stats_impl_glClipPlane; }
+	else if (!count && glad_stats_real_glClipPlane) { glad_glClipPlane = glad_stats_real_glClipPlane; glad_stats_real_glClipPlane = 0; }
+	if (count && glad_glColor3b && glad_glColor3b != glad_stats_impl_glColor3b) { glad_stats_real_glColor3b = glad_glColor3b; glad_glColor3b = glad_stats_impl_glColor3b; }
+	else if (!count && glad_stats_real_glColor3b) { glad_glColor3b = glad_stats_real_glColor3b; glad_stats_real_glColor3b = 0; }
+	if (count && glad_glColor3bv && glad_glColor3bv != glad_stats_impl_glColor3bv) { glad_stats_real_glColor3bv = glad_glColor3bv; glad_glColor3bv = glad_stats_impl_glColor3bv; }
+	else if (!count && glad_stats_real_glColor3bv) { glad_glColor3bv = glad_stats_real_glColor3bv; glad_stats_real_glColor3bv = 0; }
+	if (count && glad_glColor3d && glad_glColor3d != glad_stats_impl_glColor3d) { glad_stats_real_glColor3d = glad_glColor3d; glad_glColor3d = glad_stats_impl_glColor3d; }
+	else if (!count && glad_stats_real_glColor3d) { glad_glColor3d = glad_stats_real_glColor3d; glad_stats_real_glColor3d = 0; }
+	if (count && glad_glColor3dv && glad_glColor3dv != glad_stats_impl_glColor3dv) { glad_stats_real_glColor3dv = glad_glColor3dv; glad_glColor3dv = glad_stats_impl_glColor3dv; }
+	else if (!count && glad_stats_real_glColor3dv) { glad_glColor3dv = glad_stats_real_glColor3dv; glad_stats_real_glColor3dv = 0; }
+	if (count && glad_glColor3f && glad_glColor3f != glad_stats_impl_glColor3f) { glad_stats_real_glColor3f = glad_glColor3f; glad_glColor3f = glad_stats_impl_glColor3f; }
+	else if (!count && glad_stats_real_glColor3f) { glad_glColor3f = glad_stats_real_glColor3f; glad_stats_real_glColor3f = 0; }
+	if (count && glad_glColor3fv && glad_glColor3fv != glad_stats_impl_glColor3fv) { glad_stats_real_glColor3fv = glad_glColor3fv; glad_glColor3fv = glad_stats_impl_glColor3fv; }
+	else if (!count && glad_stats_real_glColor3fv) { glad_glColor3fv = glad_stats_real_glColor3fv; glad_stats_real_glColor3fv = 0; }
+	if (count && glad_glColor3i && glad_glColor3i != glad_stats_impl_glColor3i) { glad_stats_real_glColor3i = glad_glColor3i; glad_glColor3i = glad_stats_impl_glColor3i; }
+	else if (!count && glad_stats_real_glColor3i) { glad_glColor3i = glad_stats_real_glColor3i; glad_stats_real_glColor3i = 0; }
+	if (count && glad_glColor3iv && glad_glColor3iv != glad_stats_impl_glColor3iv) { glad_stats_real_glColor3iv = glad_glColor3iv; glad_glColor3iv = glad_stats_impl_glColor3iv; }
+	else if (!count && glad_stats_real_glColor3iv) { glad_glColor3iv = glad_stats_real_glColor3iv; glad_stats_real_glColor3iv = 0; }
+	if (count && glad_glColor3s && glad_glColor3s != glad_stats_impl_glColor3s) { glad_stats_real_glColor3s = glad_glColor3s; glad_glColor3s = glad_stats_impl_glColor3s; }
+	else if (!count && glad_stats_real_glColor3s) { glad_glColor3s = glad_stats_real_glColor3s; glad_stats_real_glColor3s = 0; }
+	if (count && glad_glColor3sv && glad_glColor3sv != glad_stats_impl_glColor3sv) { glad_stats_real_glColor3sv = glad_glColor3sv; glad_glColor3sv = glad_stats_impl_glColor3sv; }
+	else if (!count && glad_stats_real_glColor3sv) { glad_glColor3sv = glad_stats_real_glColor3sv; glad_stats_real_glColor3sv = 0; }
+	if (count && glad_glColor3ub && glad_glColor3ub != glad_stats_impl_glColor3ub) { glad_stats_real_glColor3ub = glad_glColor3ub; glad_glColor3ub = glad_stats_impl_glColor3ub; }
+	else if (!count && glad_stats_real_glColor3ub) { glad_glColor3ub = glad_stats_real_glColor3ub; glad_stats_real_glColor3ub = 0; }
+	if (count && glad_glColor3ubv && glad_glColor3ubv != glad_stats_impl_glColor3ubv) { glad_stats_real_glColor3ubv = glad_glColor3ubv; glad_glColor3ubv = glad_stats_impl_glColor3ubv; }
+	else if (!count && glad_stats_real_glColor3ubv) { glad_glColor3ubv = glad_stats_real_glColor3ubv; glad_stats_real_glColor3ubv = 0; }
+	if (count && glad_glColor3ui && glad_glColor3ui != glad_stats_impl_glColor3ui) { glad_stats_real_glColor3ui = glad_glColor3ui; glad_glColor3ui = glad_stats_impl_glColor3ui; }
+	else if (!count && glad_stats_real_glColor3ui) { glad_glColor3ui = glad_stats_real_glColor3ui; glad_stats_real_glColor3ui = 0; }
+	if (count && glad_glColor3uiv && glad_glColor3uiv != glad_stats_impl_glColor3uiv) { glad_stats_real_glColor3uiv = glad_glColor3uiv; glad_glColor3uiv = glad_stats_impl_glColor3uiv; }
+	else if (!count && glad_stats_real_glColor3uiv) { glad_glColor3uiv = glad_stats_real_glColor3uiv; glad_stats_real_glColor3uiv = 0; }
+	if (count && glad_glColor3us && glad_glColor3us != glad_stats_impl_glColor3us) { glad_stats_real_glColor3us = glad_glColor3us; glad_glColor3us = glad_stats_impl_glColor3us; }
+	else if (!count && glad_stats_real_glColor3us) { glad_glColor3us = glad_stats_real_glColor3us; glad_stats_real_glColor3us = 0; }
+	if (count && glad_glColor3usv && glad_glColor3usv != glad_stats_impl_glColor3usv) { glad_stats_real_glColor3usv = glad_glColor3usv; glad_glColor3usv = glad_stats_impl_glColor3usv; }
+	else if (!count && glad_stats_real_glColor3usv) { glad_glColor3usv = glad_stats_real_glColor3usv; glad_stats_real_glColor3usv = 0; }
+	if (count && glad_glColor4b && glad_glColor4b != glad_stats_impl_glColor4b) { glad_stats_real_glColor4b = glad_glColor4b; glad_glColor4b = glad_stats_impl_glColor4b; }
+	else if (!count && glad_stats_real_glColor4b) { glad_glColor4b = glad_stats_real_glColor4b; glad_stats_real_glColor4b = 0; }
+	if (count && glad_glColor4bv && glad_glColor4bv != glad_stats_impl_glColor4bv) { glad_stats_real_glColor4bv = glad_glColor4bv; glad_glColor4bv = glad_stats_impl_glColor4bv; }
+	else if (!count && glad_stats_real_glColor4bv) { glad_glColor4bv = glad_stats_real_glColor4bv; glad_stats_real_glColor4bv = 0; }
+	if (count && glad_glColor4d && glad_glColor4d != glad_stats_impl_glColor4d) { glad_stats_real_glColor4d = glad_glColor4d; glad_glColor4d = glad_stats_impl_glColor4d; }
+	else if (!count && glad_stats_real_glColor4d) { glad_glColor4d = glad_stats_real_glColor4d; glad_stats_real_glColor4d = 0; }
+	if (count && glad_glColor4dv && glad_glColor4dv != glad_stats_impl_glColor4dv) { glad_stats_real_glColor4dv = glad_glColor4dv; glad_glColor4dv = glad_stats_impl_glColor4dv; }
+	else if (!count && glad_stats_real_glColor4dv) { glad_glColor4dv = glad_stats_real_glColor4dv; glad_stats_real_glColor4dv = 0; }
+	if (count && glad_glColor4f && glad_glColor4f != glad_stats_impl_glColor4f) { glad_stats_real_glColor4f = glad_glColor4f; glad_glColor4f = glad_stats_impl_glColor4f; }
+	else if (!count && glad_stats_real_glColor4f) { glad_glColor4f = glad_stats_real_glColor4f; glad_stats_real_glColor4f = 0; }
+	if (count && glad_glColor4fv && glad_glColor4fv != glad_stats_impl_glColor4fv) { glad_stats_real_glColor4fv = glad_glColor4fv; glad_glColor4fv = glad_stats_impl_glColor4fv; }
+	else if (!count && glad_stats_real_glColor4fv) { glad_glColor4fv = glad_stats_real_glColor4fv; glad_stats_real_glColor4fv = 0; }
+	if (count && glad_glColor4i && glad_glColor4i != glad_stats_impl_glColor4i) { glad_stats_real_glColor4i = glad_glColor4i; glad_glColor4i = glad_stats_impl_glColor4i; }
+	else if (!count && glad_stats_real_glColor4i) { glad_glColor4i = glad_stats_real_glColor4i; glad_stats_real_glColor4i = 0; }
+	if (count && glad_glColor4iv && glad_glColor4iv != glad_stats_impl_glColor4iv) { glad_stats_real_glColor4iv = glad_glColor4iv; glad_glColor4iv = glad_stats_impl_glColor4iv; }
+	else if (!count && glad_stats_real_glColor4iv) { glad_glColor4iv = glad_stats_real_glColor4iv; glad_stats_real_glColor4iv = 0; }
+	if (count && glad_glColor4s && glad_glColor4s != glad_stats_impl_glColor4s) { glad_stats_real_glColor4s = glad_glColor4s; glad_glColor4s = glad_stats_impl_glColor4s; }
+	else if (!count && glad_stats_real_glColor4s) { glad_glColor4s = glad_stats_real_glColor4s; glad_stats_real_glColor4s = 0; }
+	if (count && glad_glColor4sv && glad_glColor4sv != glad_stats_impl_glColor4sv) { glad_stats_real_glColor4sv = glad_glColor4sv; glad_glColor4sv = glad_stats_impl_glColor4sv; }
+	else if (!count && glad_stats_real_glColor4sv) { glad_glColor4sv = glad_stats_real_glColor4sv; glad_stats_real_glColor4sv = 0; }
+	if (count && glad_glColor4ub && glad_glColor4ub != glad_stats_impl_glColor4ub) { glad_stats_real_glColor4ub = glad_glColor4ub; glad_glColor4ub = glad_stats_impl_glColor4ub; }
+	else if (!count && glad_stats_real_glColor4ub) { glad_glColor4ub = glad_stats_real_glColor4ub; glad_stats_real_glColor4ub = 0; }
+	if (count && glad_glColor4ubv && glad_glColor4ubv != glad_stats_impl_glColor4ubv) { glad_stats_real_glColor4ubv = glad_glColor4ubv; glad_glColor4ubv = glad_stats_impl_glColor4ubv; }
+	else if (!count && glad_stats_real_glColor4ubv) { glad_glColor4ubv = glad_stats_real_glColor4ubv; glad_stats_real_glColor4ubv = 0; }
+	if (count && glad_glColor4ui && glad_glColor4ui != glad_stats_impl_glColor4ui) { glad_stats_real_glColor4ui = glad_glColor4ui; glad_glColor4ui = glad_stats_impl_glColor4ui; }
+	else if (!count && glad_stats_real_glColor4ui) { glad_glColor4ui = glad_stats_real_glColor4ui; glad_stats_real_glColor4ui = 0; }
+	if (count && glad_glColor4uiv && glad_glColor4uiv != glad_stats_impl_glColor4uiv) { glad_stats_real_glColor4uiv = glad_glColor4uiv; glad_glColor4uiv = glad_stats_impl_glColor4uiv; }
+	else if (!count && glad_stats_real_glColor4uiv) { glad_glColor4uiv = glad_stats_real_glColor4uiv; glad_stats_real_glColor4uiv = 0; }
+	if (count && glad_glColor4us && glad_glColor4us != glad_stats_impl_glColor4us) { glad_stats_real_glColor4us = glad_glColor4us; glad_glColor4us = glad_stats_impl_glColor4us; }
+	else if (!count && glad_stats_real_glColor4us) { glad_glColor4us = glad_stats_real_glColor4us; glad_stats_real_glColor4us = 0; }
+	if (count && glad_glColor4usv && glad_glColor4usv != glad_stats_impl_glColor4usv) { glad_stats_real_glColor4usv = glad_glColor4usv; glad_glColor4usv = glad_stats_impl_glColor4usv; }
+	else if (!count && glad_stats_real_glColor4usv) { glad_glColor4usv = glad_stats_real_glColor4usv; glad_stats_real_glColor4usv = 0; }
+	if (count && glad_glColorMask && glad_glColorMask != glad_stats_impl_glColorMask) { glad_stats_real_glColorMask = glad_glColorMask; glad_glColorMask = glad_stats_impl_glColorMask; }
+	else if (!count && glad_stats_real_glColorMask) { glad_glColorMask = glad_stats_real_glColorMask; glad_stats_real_glColorMask = 0; }
+	if (count && glad_glColorMaski && glad_glColorMaski != glad_stats_impl_glColorMaski) { glad_stats_real_glColorMaski = glad_glColorMaski; glad_glColorMaski = glad_stats_impl_glColorMaski; }
+	else if (!count && glad_stats_real_glColorMaski) { glad_glColorMaski = glad_stats_real_glColorMaski; glad_stats_real_glColorMaski = 0; }
+	if (count && glad_glColorMaterial && glad_glColorMaterial != glad_stats_impl_glColorMaterial) { glad_stats_real_glColorMaterial = glad_glColorMaterial; glad_glColorMaterial = glad_stats_impl_glColorMaterial; }
+	else if (!count && glad_stats_real_glColorMaterial) { glad_glColorMaterial = glad_stats_real_glColorMaterial; glad_stats_real_glColorMaterial = 0; }
+	if (count && glad_glColorP3ui && glad_glColorP3ui != glad_stats_impl_glColorP3ui) { glad_stats_real_glColorP3ui = glad_glColorP3ui; glad_glColorP3ui = glad_stats_impl_glColorP3ui; }
+	else if (!count && glad_stats_real_glColorP3ui) { glad_glColorP3ui = glad_stats_real_glColorP3ui; glad_stats_real_glColorP3ui = 0; }
+	if (count && glad_glColorP3uiv && glad_glColorP3uiv != glad_stats_impl_glColorP3uiv) { glad_stats_real_glColorP3uiv = glad_glColorP3uiv; glad_glColorP3uiv = glad_stats_impl_glColorP3uiv; }
+	else if (!count && glad_stats_real_glColorP3uiv) { glad_glColorP3uiv = glad_stats_real_glColorP3uiv; glad_stats_real_glColorP3uiv = 0; }
+	if (count && glad_glColorP4ui && glad_glColorP4ui != glad_stats_impl_glColorP4ui) { glad_stats_real_glColorP4ui = glad_glColorP4ui; glad_glColorP4ui = glad_stats_impl_glColorP4ui; }
+	else if (!count && glad_stats_real_glColorP4ui) { glad_glColorP4ui = glad_stats_real_glColorP4ui; glad_stats_real_glColorP4ui = 0; }
+	if (count && glad_glColorP4uiv && glad_glColorP4uiv != glad_stats_impl_glColorP4uiv) { glad_stats_real_glColorP4uiv = glad_glColorP4uiv; glad_glColorP4uiv = glad_stats_impl_glColorP4uiv; }
+	else if (!count && glad_stats_real_glColorP4uiv) { glad_glColorP4uiv = glad_stats_real_glColorP4uiv; glad_stats_real_glColorP4uiv = 0; }
+	if (count && glad_glColorPointer && glad_glColorPointer != glad_stats_impl_glColorPointer) { glad_stats_real_glColorPointer = glad_glColorPointer; glad_glColorPointer = glad_stats_impl_glColorPointer; }
+	else if (!count && glad_stats_real_glColorPointer) { glad_glColorPointer = glad_stats_real_glColorPointer; glad_stats_real_glColorPointer = 0; }
+	if (count && glad_glCompileShader && glad_glCompileShader != glad_stats_impl_glCompileShader) { glad_stats_real_glCompileShader = glad_glCompileShader; glad_glCompileShader = glad_stats_impl_glCompileShader; }
+	else if (!count && glad_stats_real_glCompileShader) { glad_glCompileShader = glad_stats_real_glCompileShader; glad_stats_real_glCompileShader = 0; }
+	if (count && glad_glCompressedTexImage1D && glad_glCompressedTexImage1D != glad_stats_impl_glCompressedTexImage1D) { glad_stats_real_glCompressedTexImage1D = glad_glCompressedTexImage1D; glad_glCompressedTexImage1D = glad_stats_impl_glCompressedTexImage1D; }
+	else if (!count && glad_stats_real_glCompressedTexImage1D) { glad_glCompressedTexImage1D = glad_stats_real_glCompressedTexImage1D; glad_stats_real_glCompressedTexImage1D = 0; }
+	if (count && glad_glCompressedTexImage2D && glad_glCompressedTexImage2D != glad_stats_impl_glCompressedTexImage2D) { glad_stats_real_glCompressedTexImage2D = glad_glCompressedTexImage2D; glad_glCompressedTexImage2D = glad_stats_impl_glCompressedTexImage2D; }
+	else if (!count && glad_stats_real_glCompressedTexImage2D) { glad_glCompressedTexImage2D = glad_stats_real_glCompressedTexImage2D; glad_stats_real_glCompressedTexImage2D = 0; }
+	if (count && glad_glCompressedTexImage3D && glad_glCompressedTexImage3D != glad_stats_impl_glCompressedTexImage3D) { glad_stats_real_glCompressedTexImage3D = glad_glCompressedTexImage3D; glad_glCompressedTexImage3D = glad_stats_impl_glCompressedTexImage3D; }
+	else if (!count && glad_stats_real_glCompressedTexImage3D) { glad_glCompressedTexImage3D = glad_stats_real_glCompressedTexImage3D; glad_stats_real_glCompressedTexImage3D = 0; }
+	if (count && glad_glCompressedTexSubImage1D && glad_glCompressedTexSubImage1D != glad_stats_impl_glCompressedTexSubImage1D) { glad_stats_real_glCompressedTexSubImage1D = glad_glCompressedTexSubImage1D; glad_glCompressedTexSubImage1D = glad_stats_impl_glCompressedTexSubImage1D; }
+	else if (!count && glad_stats_real_glCompressedTexSubImage1D) { glad_glCompressedTexSubImage1D = glad_stats_real_glCompressedTexSubImage1D; glad_stats_real_glCompressedTexSubImage1D = 0; }
+	if (count && glad_glCompressedTexSubImage2D && glad_glCompressedTexSubImage2D != glad_stats_impl_glCompressedTexSubImage2D) { glad_stats_real_glCompressedTexSubImage2D = glad_glCompressedTexSubImage2D; glad_glCompressedTexSubImage2D = glad_stats_impl_glCompressedTexSubImage2D; }
+	else if (!count && glad_stats_real_glCompressedTexSubImage2D) { glad_glCompressedTexSubImage2D = glad_stats_real_glCompressedTexSubImage2D; glad_stats_real_glCompressedTexSubImage2D = 0; }
+	if (count && glad_glCompressedTexSubImage3D && glad_glCompressedTexSubImage3D != glad_stats_impl_glCompressedTexSubImage3D) { glad_stats_real_glCompressedTexSubImage3D = glad_glCompressedTexSubImage3D; glad_glCompressedTexSubImage3D = glad_stats_impl_glCompressedTexSubImage3D; }
+	else if (!count && glad_stats_real_glCompressedTexSubImage3D) { glad_glCompressedTexSubImage3D = glad_stats_real_glCompressedTexSubImage3D; glad_stats_real_glCompressedTexSubImage3D = 0; }
+	if (count && glad_glCompressedTextureSubImage1D && glad_glCompressedTextureSubImage1D != glad_stats_impl_glCompressedTextureSubImage1D) { glad_stats_real_glCompressedTextureSubImage1D = glad_glCompressedTextureSubImage1D; glad_glCompressedTextureSubImage1D = glad_stats_impl_glCompressedTextureSubImage1D; }
+	else if (!count && glad_stats_real_glCompressedTextureSubImage1D) { glad_glCompressedTextureSubImage1D = glad_stats_real_glCompressedTextureSubImage1D; glad_stats_real_glCompressedTextureSubImage1D = 0; }
+	if (count && glad_glCompressedTextureSubImage2D && glad_glCompressedTextureSubImage2D != glad_stats_impl_glCompressedTextureSubImage2D) { glad_stats_real_glCompressedTextureSubImage2D = glad_glCompressedTextureSubImage2D; glad_glCompressedTextureSubImage2D = glad_stats_impl_glCompressedTextureSubImage2D; }
+	else if (!count && glad_stats_real_glCompressedTextureSubImage2D) { glad_glCompressedTextureSubImage2D = glad_stats_real_glCompressedTextureSubImage2D; glad_stats_real_glCompressedTextureSubImage2D = 0; }
+	if (count && glad_glCompressedTextureSubImage3D && glad_glCompressedTextureSubImage3D != glad_stats_impl_glCompressedTextureSubImage3D) { glad_stats_real_glCompressedTextureSubImage3D = glad_glCompressedTextureSubImage3D; glad_glCompressedTextureSubImage3D = glad_stats_impl_glCompressedTextureSubImage3D; }
+	else if (!count && glad_stats_real_glCompressedTextureSubImage3D) { glad_glCompressedTextureSubImage3D = glad_stats_real_glCompressedTextureSubImage3D; glad_stats_real_glCompressedTextureSubImage3D = 0; }
+	if (count && glad_glCopyBufferSubData && glad_glCopyBufferSubData != glad_stats_impl_glCopyBufferSubData) { glad_stats_real_glCopyBufferSubData = glad_glCopyBufferSubData; glad_glCopyBufferSubData = glad_stats_impl_glCopyBufferSubData; }
+	else if (!count && glad_stats_real_glCopyBufferSubData) { glad_glCopyBufferSubData = glad_stats_real_glCopyBufferSubData; glad_stats_real_glCopyBufferSubData = 0; }
+	if (count && glad_glCopyImageSubData && glad_glCopyImageSubData != glad_stats_impl_glCopyImageSubData) { glad_stats_real_glCopyImageSubData = glad_glCopyImageSubData; glad_glCopyImageSubData = glad_stats_impl_glCopyImageSubData; }
+	else if (!count && glad_stats_real_glCopyImageSubData) { glad_glCopyImageSubData = glad_stats_real_glCopyImageSubData; glad_stats_real_glCopyImageSubData = 0; }
+	if (count && glad_glCopyNamedBufferSubData && glad_glCopyNamedBufferSubData != glad_stats_impl_glCopyNamedBufferSubData) { glad_stats_real_glCopyNamedBufferSubData = glad_glCopyNamedBufferSubData; glad_glCopyNamedBufferSubData = glad_stats_impl_glCopyNamedBufferSubData; }
+	else if (!count && glad_stats_real_glCopyNamedBufferSubData) { glad_glCopyNamedBufferSubData = glad_stats_real_glCopyNamedBufferSubData; glad_stats_real_glCopyNamedBufferSubData = 0; }
+	if (count && glad_glCopyPixels && glad_glCopyPixels != glad_stats_impl_glCopyPixels) { glad_stats_real_glCopyPixels = glad_glCopyPixels; glad_glCopyPixels = glad_stats_impl_glCopyPixels; }
+	else if (!count && glad_stats_real_glCopyPixels) { glad_glCopyPixels = glad_stats_real_glCopyPixels; glad_stats_real_glCopyPixels = 0; }
+	if (count && glad_glCopyTexImage1D && glad_glCopyTexImage1D != glad_stats_impl_glCopyTexImage1D) { glad_stats_real_glCopyTexImage1D = glad_glCopyTexImage1D; glad_glCopyTexImage1D = glad_stats_impl_glCopyTexImage1D; }
+	else if (!count && glad_stats_real_glCopyTexImage1D) { glad_glCopyTexImage1D = glad_stats_real_glCopyTexImage1D; glad_stats_real_glCopyTexImage1D = 0; }
+	if (count && glad_glCopyTexImage2D && glad_glCopyTexImage2D != glad_stats_impl_glCopyTexImage2D) { glad_stats_real_glCopyTexImage2D = glad_glCopyTexImage2D; glad_glCopyTexImage2D = glad_stats_impl_glCopyTexImage2D; }
+	else if (!count && glad_stats_real_glCopyTexImage2D) { glad_glCopyTexImage2D = glad_stats_real_glCopyTexImage2D; glad_stats_real_glCopyTexImage2D = 0; }
+	if (count && glad_glCopyTexSubImage1D && glad_glCopyTexSubImage1D != glad_stats_impl_glCopyTexSubImage1D) { glad_stats_real_glCopyTexSubImage1D = glad_glCopyTexSubImage1D; glad_glCopyTexSubImage1D = glad_stats_impl_glCopyTexSubImage1D; }
+	else if (!count && glad_stats_real_glCopyTexSubImage1D) { glad_glCopyTexSubImage1D = glad_stats_real_glCopyTexSubImage1D; glad_stats_real_glCopyTexSubImage1D = 0; }
+	if (count && glad_glCopyTexSubImage2D && glad_glCopyTexSubImage2D != glad_stats_impl_glCopyTexSubImage2D) { glad_stats_real_glCopyTexSubImage2D = glad_glCopyTexSubImage2D; glad_glCopyTexSubImage2D = glad_stats_impl_glCopyTexSubImage2D; }
+	else if (!count && glad_stats_real_glCopyTexSubImage2D) { glad_glCopyTexSubImage2D = glad_stats_real_glCopyTexSubImage2D; glad_stats_real_glCopyTexSubImage2D = 0; }
+	if (count && glad_glCopyTexSubImage3D && glad_glCopyTexSubImage3D != glad_stats_impl_glCopyTexSubImage3D) { glad_stats_real_glCopyTexSubImage3D = glad_glCopyTexSubImage3D; glad_glCopyTexSubImage3D = glad_stats_impl_glCopyTexSubImage3D; }
+	else if (!count && glad_stats_real_glCopyTexSubImage3D) { glad_glCopyTexSubImage3D = glad_stats_real_glCopyTexSubImage3D; glad_stats_real_glCopyTexSubImage3D = 0; }
+	if (count && glad_glCopyTextureSubImage1D && glad_glCopyTextureSubImage1D != glad_stats_impl_glCopyTextureSubImage1D) { glad_stats_real_glCopyTextureSubImage1D = glad_glCopyTextureSubImage1D; glad_glCopyTextureSubImage1D = glad_stats_impl_glCopyTextureSubImage1D; }
+	else if (!count && glad_stats_real_glCopyTextureSubImage1D) { glad_glCopyTextureSubImage1D = glad_stats_real_glCopyTextureSubImage1D; glad_stats_real_glCopyTextureSubImage1D = 0; }
+	if (count && glad_glCopyTextureSubImage2D && glad_glCopyTextureSubImage2D != glad_stats_impl_glCopyTextureSubImage2D) { glad_stats_real_glCopyTextureSubImage2D = glad_glCopyTextureSubImage2D; glad_glCopyTextureSubImage2D = glad_stats_impl_glCopyTextureSubImage2D; }
+	else if (!count && glad_stats_real_glCopyTextureSubImage2D) { glad_glCopyTextureSubImage2D = glad_stats_real_glCopyTextureSubImage2D; glad_stats_real_glCopyTextureSubImage2D = 0; }
+	if (count && glad_glCopyTextureSubImage3D && glad_glCopyTextureSubImage3D != glad_stats_impl_glCopyTextureSubImage3D) { glad_stats_real_glCopyTextureSubImage3D = glad_glCopyTextureSubImage3D; glad_glCopyTextureSubImage3D = glad_stats_impl_glCopyTextureSubImage3D; }
+	else if (!count && glad_stats_real_glCopyTextureSubImage3D) { glad_glCopyTextureSubImage3D = glad_stats_real_glCopyTextureSubImage3D; glad_stats_real_glCopyTextureSubImage3D = 0; }
+	if (count && glad_glCreateBuffers && glad_glCreateBuffers != glad_stats_impl_glCreateBuffers) { glad_stats_real_glCreateBuffers = glad_glCreateBuffers; glad_glCreateBuffers = glad_stats_impl_glCreateBuffers; }
+	else if (!count && glad_stats_real_glCreateBuffers) { glad_glCreateBuffers = glad_stats_real_glCreateBuffers; glad_stats_real_glCreateBuffers = 0; }
+	if (count && glad_glCreateFramebuffers && glad_glCreateFramebuffers != glad_stats_impl_glCreateFramebuffers) { glad_stats_real_glCreateFramebuffers = glad_glCreateFramebuffers; glad_glCreateFramebuffers = glad_stats_impl_glCreateFramebuffers; }
+	else if (!count && glad_stats_real_glCreateFramebuffers) { glad_glCreateFramebuffers = glad_stats_real_glCreateFramebuffers; glad_stats_real_glCreateFramebuffers = 0; }
+	if (count && glad_glCreateProgram && glad_glCreateProgram != glad_stats_impl_glCreateProgram) { glad_stats_real_glCreateProgram = glad_glCreateProgram; glad_glCreateProgram = glad_stats_impl_glCreateProgram; }
+	else if (!count && glad_stats_real_glCreateProgram) { glad_glCreateProgram = glad_stats_real_glCreateProgram; glad_stats_real_glCreateProgram = 0; }
+	if (count && glad_glCreateProgramPipelines && glad_glCreateProgramPipelines != glad_stats_impl_glCreateProgramPipelines) { glad_stats_real_glCreateProgramPipelines = glad_glCreateProgramPipelines; glad_glCreateProgramPipelines = glad_stats_impl_glCreateProgramPipelines; }
+	else if (!count && glad_stats_real_glCreateProgramPipelines) { glad_glCreateProgramPipelines = glad_stats_real_glCreateProgramPipelines; glad_stats_real_glCreateProgramPipelines = 0; }
+	if (count && glad_glCreateQueries && glad_glCreateQueries != glad_stats_impl_glCreateQueries) { glad_stats_real_glCreateQueries = glad_glCreateQueries; glad_glCreateQueries = glad_stats_impl_glCreateQueries; }
+	else if (!count && glad_stats_real_glCreateQueries) { glad_glCreateQueries = glad_stats_real_glCreateQueries; glad_stats_real_glCreateQueries = 0; }
+	if (count && glad_glCreateRenderbuffers && glad_glCreateRenderbuffers != glad_stats_impl_glCreateRenderbuffers) { glad_stats_real_glCreateRenderbuffers = glad_glCreateRenderbuffers; glad_glCreateRenderbuffers = glad_stats_impl_glCreateRenderbuffers; }
+	else if (!count && glad_stats_real_glCreateRenderbuffers) { glad_glCreateRenderbuffers = glad_stats_real_glCreateRenderbuffers; glad_stats_real_glCreateRenderbuffers = 0; }
+	if (count && glad_glCreateSamplers && glad_glCreateSamplers != glad_stats_impl_glCreateSamplers) { glad_stats_real_glCreateSamplers = glad_glCreateSamplers; glad_glCreateSamplers = glad_stats_impl_glCreateSamplers; }
+	else if (!count && glad_stats_real_glCreateSamplers) { glad_glCreateSamplers = glad_stats_real_glCreateSamplers; glad_stats_real_glCreateSamplers = 0; }
+	if (count && glad_glCreateShader && glad_glCreateShader != glad_stats_impl_glCreateShader) { glad_stats_real_glCreateShader = glad_glCreateShader; glad_glCreateShader = glad_stats_impl_glCreateShader; }
+	else if (!count && glad_stats_real_glCreateShader) { glad_glCreateShader = glad_stats_real_glCreateShader; glad_stats_real_glCreateShader = 0; }
+	if (count && glad_glCreateShaderProgramv && glad_glCreateShaderProgramv != glad_stats_impl_glCreateShaderProgramv) { glad_stats_real_glCreateShaderProgramv = glad_glCreateShaderProgramv; glad_glCreateShaderProgramv = glad_stats_impl_glCreateShaderProgramv; }
+	else if (!count && glad_stats_real_glCreateShaderProgramv) { glad_glCreateShaderProgramv = glad_stats_real_glCreateShaderProgramv; glad_stats_real_glCreateShaderProgramv = 0; }
+	if (count && glad_glCreateTextures && glad_glCreateTextures != glad_stats_impl_glCreateTextures) { glad_stats_real_glCreateTextures = glad_glCreateTextures; glad_glCreateTextures = glad_stats_impl_glCreateTextures; }
+	else if (!count && glad_stats_real_glCreateTextures) { glad_glCreateTextures = glad_stats_real_glCreateTextures; glad_stats_real_glCreateTextures = 0; }
+	if (count && glad_glCreateTransformFeedbacks && glad_glCreateTransformFeedbacks != glad_stats_impl_glCreateTransformFeedbacks) { glad_stats_real_glCreateTransformFeedbacks = glad_glCreateTransformFeedbacks; glad_glCreateTransformFeedbacks = glad_stats_impl_glCreateTransformFeedbacks; }
+	else if (!count && glad_stats_real_glCreateTransformFeedbacks) { glad_glCreateTransformFeedbacks = glad_stats_real_glCreateTransformFeedbacks; glad_stats_real_glCreateTransformFeedbacks = 0; }
+	if (count && glad_glCreateVertexArrays && glad_glCreateVertexArrays != glad_stats_impl_glCreateVertexArrays) { glad_stats_real_glCreateVertexArrays = glad_glCreateVertexArrays; glad_glCreateVertexArrays = glad_stats_impl_glCreateVertexArrays; }
+	else if (!count && glad_stats_real_glCreateVertexArrays) { glad_glCreateVertexArrays = glad_stats_real_glCreateVertexArrays; glad_stats_real_glCreateVertexArrays = 0; }
+	if (count && glad_glCullFace && glad_glCullFace != glad_stats_impl_glCullFace) { glad_stats_real_glCullFace = glad_glCullFace; glad_glCullFace = glad_stats_impl_glCullFace; }
+	else if (!count && glad_stats_real_glCullFace) { glad_glCullFace = glad_stats_real_glCullFace; glad_stats_real_glCullFace = 0; }
+	if (count && glad_glDebugMessageCallback && glad_glDebugMessageCallback != glad_stats_impl_glDebugMessageCallback) { glad_stats_real_glDebugMessageCallback = glad_glDebugMessageCallback; glad_glDebugMessageCallback = glad_stats_impl_glDebugMessageCallback; }
+	else if (!count && glad_stats_real_glDebugMessageCallback) { glad_glDebugMessageCallback = glad_stats_real_glDebugMessageCallback; glad_stats_real_glDebugMessageCallback = 0; }
+	if (count && glad_glDebugMessageControl && glad_glDebugMessageControl != glad_stats_impl_glDebugMessageControl) { glad_stats_real_glDebugMessageControl = glad_glDebugMessageControl; glad_glDebugMessageControl = glad_stats_impl_glDebugMessageControl; }
+	else if (!count && glad_stats_real_glDebugMessageControl) { glad_glDebugMessageControl = glad_stats_real_glDebugMessageControl; glad_stats_real_glDebugMessageControl = 0; }
+	if (count && glad_glDebugMessageInsert && glad_glDebugMessageInsert != glad_stats_impl_glDebugMessageInsert) { glad_stats_real_glDebugMessageInsert = glad_glDebugMessageInsert; glad_glDebugMessageInsert = glad_stats_impl_glDebugMessageInsert; }
+	else if (!count && glad_stats_real_glDebugMessageInsert) { glad_glDebugMessageInsert = glad_stats_real_glDebugMessageInsert; glad_stats_real_glDebugMessageInsert = 0; }
+	if (count && glad_glDeleteBuffers && glad_glDeleteBuffers != glad_stats_impl_glDeleteBuffers) { glad_stats_real_glDeleteBuffers = glad_glDeleteBuffers; glad_glDeleteBuffers = glad_stats_impl_glDeleteBuffers; }
+	else if (!count && glad_stats_real_glDeleteBuffers) { glad_glDeleteBuffers = glad_stats_real_glDeleteBuffers; glad_stats_real_glDeleteBuffers = 0; }
+	if (count && glad_glDeleteFramebuffers && glad_glDeleteFramebuffers != glad_stats_impl_glDeleteFramebuffers) { glad_stats_real_glDeleteFramebuffers = glad_glDeleteFramebuffers; glad_glDeleteFramebuffers = glad_stats_impl_glDeleteFramebuffers; }
+	else if (!count && glad_stats_real_glDeleteFramebuffers) { glad_glDeleteFramebuffers = glad_stats_real_glDeleteFramebuffers; glad_stats_real_glDeleteFramebuffers = 0; }
+	if (count && glad_glDeleteLists && glad_glDeleteLists != glad_stats_impl_glDeleteLists) { glad_stats_real_glDeleteLists = glad_glDeleteLists; glad_glDeleteLists = glad_stats_impl_glDeleteLists; }
+	else if (!count && glad_stats_real_glDeleteLists) { glad_glDeleteLists = glad_stats_real_glDeleteLists; glad_stats_real_glDeleteLists = 0; }
+	if (count && glad_glDeleteProgram && glad_glDeleteProgram != glad_stats_impl_glDeleteProgram) { glad_stats_real_glDeleteProgram = glad_glDeleteProgram; glad_glDeleteProgram = glad_stats_impl_glDeleteProgram; }
+	else if (!count && glad_stats_real_glDeleteProgram) { glad_glDeleteProgram = glad_stats_real_glDeleteProgram; glad_stats_real_glDeleteProgram = 0; }
+	if (count && glad_glDeleteProgramPipelines && glad_glDeleteProgramPipelines != glad_stats_impl_glDeleteProgramPipelines) { glad_stats_real_glDeleteProgramPipelines = glad_glDeleteProgramPipelines; glad_glDeleteProgramPipelines = glad_stats_impl_glDeleteProgramPipelines; }
+	else if (!count && glad_stats_real_glDeleteProgramPipelines) { glad_glDeleteProgramPipelines = glad_stats_real_glDeleteProgramPipelines; glad_stats_real_glDeleteProgramPipelines = 0; }
+	if (count && glad_glDeleteQueries && glad_glDeleteQueries != glad_stats_impl_glDeleteQueries) { glad_stats_real_glDeleteQueries = glad_glDeleteQueries; glad_glDeleteQueries = glad_stats_impl_glDeleteQueries; }
+	else if (!count && glad_stats_real_glDeleteQueries) { glad_glDeleteQueries = glad_stats_real_glDeleteQueries; glad_stats_real_glDeleteQueries = 0; }
+	if (count && glad_glDeleteRenderbuffers && glad_glDeleteRenderbuffers != glad_stats_impl_glDeleteRenderbuffers) { glad_stats_real_glDeleteRenderbuffers = glad_glDeleteRenderbuffers; glad_glDeleteRenderbuffers = glad_stats_impl_glDeleteRenderbuffers; }
+	else if (!count && glad_stats_real_glDeleteRenderbuffers) { glad_glDeleteRenderbuffers = glad_stats_real_glDeleteRenderbuffers; glad_stats_real_glDeleteRenderbuffers = 0; }
+	if (count && glad_glDeleteSamplers && glad_glDeleteSamplers != glad_stats_impl_glDeleteSamplers) { glad_stats_real_glDeleteSamplers = glad_glDeleteSamplers; glad_glDeleteSamplers = glad_stats_impl_glDeleteSamplers; }
+	else if (!count && glad_stats_real_glDeleteSamplers) { glad_glDeleteSamplers = glad_stats_real_glDeleteSamplers; glad_stats_real_glDeleteSamplers = 0; }
+	if (count && glad_glDeleteShader && glad_glDeleteShader != glad_stats_impl_glDeleteShader) { glad_stats_real_glDeleteShader = glad_glDeleteShader; glad_glDeleteShader = glad_stats_impl_glDeleteShader; }
+	else if (!count && glad_stats_real_glDeleteShader) { glad_glDeleteShader = glad_stats_real_glDeleteShader; glad_stats_real_glDeleteShader = 0; }
+	if (count && glad_glDeleteSync && glad_glDeleteSync != glad_stats_impl_glDeleteSync) { glad_stats_real_glDeleteSync = glad_glDeleteSync; glad_glDeleteSync = glad_stats_impl_glDeleteSync; }
+	else if (!count && glad_stats_real_glDeleteSync) { glad_glDeleteSync = glad_stats_real_glDeleteSync; glad_stats_real_glDeleteSync = 0; }
+	if (count && glad_glDeleteTextures && glad_glDeleteTextures != glad_stats_impl_glDeleteTextures) { glad_stats_real_glDeleteTextures = glad_glDeleteTextures; glad_glDeleteTextures = glad_stats_impl_glDeleteTextures; }
+	else if (!count && glad_stats_real_glDeleteTextures) { glad_glDeleteTextures = glad_stats_real_glDeleteTextures; glad_stats_real_glDeleteTextures = 0; }
+	if (count && glad_glDeleteTransformFeedbacks && glad_glDeleteTransformFeedbacks != glad_stats_impl_glDeleteTransformFeedbacks) { glad_stats_real_glDeleteTransformFeedbacks = glad_glDeleteTransformFeedbacks; glad_glDeleteTransformFeedbacks = glad_stats_impl_glDeleteTransformFeedbacks; }
+	else if (!count && glad_stats_real_glDeleteTransformFeedbacks) { glad_glDeleteTransformFeedbacks = glad_stats_real_glDeleteTransformFeedbacks; glad_stats_real_glDeleteTransformFeedbacks = 0; }
+	if (count && glad_glDeleteVertexArrays && glad_glDeleteVertexArrays != glad_stats_impl_glDeleteVertexArrays) { glad_stats_real_glDeleteVertexArrays = glad_glDeleteVertexArrays; glad_glDeleteVertexArrays = glad_stats_impl_glDeleteVertexArrays; }
+	else if (!count && glad_stats_real_glDeleteVertexArrays) { glad_glDeleteVertexArrays = glad_stats_real_glDeleteVertexArrays; glad_stats_real_glDeleteVertexArrays = 0; }
+	if (count && glad_glDepthFunc && glad_glDepthFunc != glad_stats_impl_glDepthFunc) { glad_stats_real_glDepthFunc = glad_glDepthFunc; glad_glDepthFunc = glad_stats_impl_glDepthFunc; }
+	else if (!count && glad_stats_real_glDepthFunc) { glad_glDepthFunc = glad_stats_real_glDepthFunc; glad_stats_real_glDepthFunc = 0; }
+	if (count && glad_glDepthMask && glad_glDepthMask != glad_stats_impl_glDepthMask) { glad_stats_real_glDepthMask = glad_glDepthMask; glad_glDepthMask = glad_stats_impl_glDepthMask; }
+	else if (!count && glad_stats_real_glDepthMask) { glad_glDepthMask = glad_stats_real_glDepthMask; glad_stats_real_glDepthMask = 0; }
+	if (count && glad_glDepthRange && glad_glDepthRange != glad_stats_impl_glDepthRange) { glad_stats_real_glDepthRange = glad_glDepthRange; glad_glDepthRange = glad_stats_impl_glDepthRange; }
+	else if (!count && glad_stats_real_glDepthRange) { glad_glDepthRange = glad_stats_real_glDepthRange; glad_stats_real_glDepthRange = 0; }
+	if (count && glad_glDepthRangeArrayv && glad_glDepthRangeArrayv != glad_stats_impl_glDepthRangeArrayv) { glad_stats_real_glDepthRangeArrayv = glad_glDepthRangeArrayv; glad_glDepthRangeArrayv = glad_stats_impl_glDepthRangeArrayv; }
+	else if (!count && glad_stats_real_glDepthRangeArrayv) { glad_glDepthRangeArrayv = glad_stats_real_glDepthRangeArrayv; glad_stats_real_glDepthRangeArrayv = 0; }
+	if (count && glad_glDepthRangeIndexed && glad_glDepthRangeIndexed != glad_stats_impl_glDepthRangeIndexed) { glad_stats_real_glDepthRangeIndexed = glad_glDepthRangeIndexed; glad_glDepthRangeIndexed = glad_stats_impl_glDepthRangeIndexed; }
+	else if (!count && glad_stats_real_glDepthRangeIndexed) { glad_glDepthRangeIndexed = glad_stats_real_glDepthRangeIndexed; glad_stats_real_glDepthRangeIndexed = 0; }
+	if (count && glad_glDepthRangef && glad_glDepthRangef != glad_stats_impl_glDepthRangef) { glad_stats_real_glDepthRangef = glad_glDepthRangef; glad_glDepthRangef = glad_stats_impl_glDepthRangef; }
+	else if (!count && glad_stats_real_glDepthRangef) { glad_glDepthRangef = glad_stats_real_glDepthRangef; glad_stats_real_glDepthRangef = 0; }
+	if (count && glad_glDetachShader && glad_glDetachShader != glad_stats_impl_glDetachShader) { glad_stats_real_glDetachShader = glad_glDetachShader; glad_glDetachShader = glad_stats_impl_glDetachShader; }
+	else if (!count && glad_stats_real_glDetachShader) { glad_glDetachShader = glad_stats_real_glDetachShader; glad_stats_real_glDetachShader = 0; }
+	if (count && glad_glDisable && glad_glDisable != glad_stats_impl_glDisable) { glad_stats_real_glDisable = glad_glDisable; glad_glDisable = glad_stats_impl_glDisable; }
+	else if (!count && glad_stats_real_glDisable) { glad_glDisable = glad_stats_real_glDisable; glad_stats_real_glDisable = 0; }
+	if (count && glad_glDisableClientState && glad_glDisableClientState != glad_stats_impl_glDisableClientState) { glad_stats_real_glDisableClientState = glad_glDisableClientState; glad_glDisableClientState = glad_stats_impl_glDisableClientState; }
+	else if (!count && glad_stats_real_glDisableClientState) { glad_glDisableClientState = glad_stats_real_glDisableClientState; glad_stats_real_glDisableClientState = 0; }
+	if (count && glad_glDisableVertexArrayAttrib && glad_glDisableVertexArrayAttrib != glad_stats_impl_glDisableVertexArrayAttrib) { glad_stats_real_glDisableVertexArrayAttrib = glad_glDisableVertexArrayAttrib; glad_glDisableVertexArrayAttrib = glad_stats_impl_glDisableVertexArrayAttrib; }
+	else if (!count && glad_stats_real_glDisableVertexArrayAttrib) { glad_glDisableVertexArrayAttrib = glad_stats_real_glDisableVertexArrayAttrib; glad_stats_real_glDisableVertexArrayAttrib = 0; }
+	if (count && glad_glDisableVertexAttribArray && glad_glDisableVertexAttribArray != glad_stats_impl_glDisableVertexAttribArray) { glad_stats_real_glDisableVertexAttribArray = glad_glDisableVertexAttribArray; glad_glDisableVertexAttribArray = glad_stats_impl_glDisableVertexAttribArray; }
+	else if (!count && glad_stats_real_glDisableVertexAttribArray) { glad_glDisableVertexAttribArray = glad_stats_real_glDisableVertexAttribArray; glad_stats_real_glDisableVertexAttribArray = 0; }
+	if (count && glad_glDisablei && glad_glDisablei != glad_stats_impl_glDisablei) { glad_stats_real_glDisablei = glad_glDisablei; glad_glDisablei = glad_stats_impl_glDisablei; }
+	else if (!count && glad_stats_real_glDisablei) { glad_glDisablei = glad_stats_real_glDisablei; glad_stats_real_glDisablei = 0; }
+	if (count && glad_glDispatchCompute && glad_glDispatchCompute != glad_stats_impl_glDispatchCompute) { glad_stats_real_glDispatchCompute = glad_glDispatchCompute; glad_glDispatchCompute = glad_stats_impl_glDispatchCompute; }
+	else if (!count && glad_stats_real_glDispatchCompute) { glad_glDispatchCompute = glad_stats_real_glDispatchCompute; glad_stats_real_glDispatchCompute = 0; }
+	if (count && glad_glDispatchComputeIndirect && glad_glDispatchComputeIndirect != glad_stats_impl_glDispatchComputeIndirect) { glad_stats_real_glDispatchComputeIndirect = glad_glDispatchComputeIndirect; glad_glDispatchComputeIndirect = glad_stats_impl_glDispatchComputeIndirect; }
+	else if (!count && glad_stats_real_glDispatchComputeIndirect) { glad_glDispatchComputeIndirect = glad_stats_real_glDispatchComputeIndirect; glad_stats_real_glDispatchComputeIndirect = 0; }
+	if (count && glad_glDrawArrays && glad_glDrawArrays != glad_stats_impl_glDrawArrays) { glad_stats_real_glDrawArrays = glad_glDrawArrays; glad_glDrawArrays = glad_stats_impl_glDrawArrays; }
+	else if (!count && glad_stats_real_glDrawArrays) { glad_glDrawArrays = glad_stats_real_glDrawArrays; glad_stats_real_glDrawArrays = 0; }
+	if (count && glad_glDrawArraysIndirect && glad_glDrawArraysIndirect != glad_stats_impl_glDrawArraysIndirect) { glad_stats_real_glDrawArraysIndirect = glad_glDrawArraysIndirect; glad_glDrawArraysIndirect = glad_stats_impl_glDrawArraysIndirect; }
+	else if (!count && glad_stats_real_glDrawArraysIndirect) { glad_glDrawArraysIndirect = glad_stats_real_glDrawArraysIndirect; glad_stats_real_glDrawArraysIndirect = 0; }
+	if (count && glad_glDrawArraysInstanced && glad_glDrawArraysInstanced != glad_stats_impl_glDrawArraysInstanced) { glad_stats_real_glDrawArraysInstanced = glad_glDrawArraysInstanced; glad_glDrawArraysInstanced = glad_stats_impl_glDrawArraysInstanced; }
+	else if (!count && glad_stats_real_glDrawArraysInstanced) { glad_glDrawArraysInstanced = glad_stats_real_glDrawArraysInstanced; glad_stats_real_glDrawArraysInstanced = 0; }
+	if (count && glad_glDrawArraysInstancedBaseInstance && glad_glDrawArraysInstancedBaseInstance != glad_stats_impl_glDrawArraysInstancedBaseInstance) { glad_stats_real_glDrawArraysInstancedBaseInstance = glad_glDrawArraysInstancedBaseInstance; glad_glDrawArraysInstancedBaseInstance = glad_stats_impl_glDrawArraysInstancedBaseInstance; }
+	else if (!count && glad_stats_real_glDrawArraysInstancedBaseInstance) { glad_glDrawArraysInstancedBaseInstance = glad_stats_real_glDrawArraysInstancedBaseInstance; glad_stats_real_glDrawArraysInstancedBaseInstance = 0; }
+	if (count && glad_glDrawBuffer && glad_glDrawBuffer != glad_stats_impl_glDrawBuffer) { glad_stats_real_glDrawBuffer = glad_glDrawBuffer; glad_glDrawBuffer = glad_stats_impl_glDrawBuffer; }
+	else if (!count && glad_stats_real_glDrawBuffer) { glad_glDrawBuffer = glad_stats_real_glDrawBuffer; glad_stats_real_glDrawBuffer = 0; }
+	if (count && glad_glDrawBuffers && glad_glDrawBuffers != glad_stats_impl_glDrawBuffers) { glad_stats_real_glDrawBuffers = glad_glDrawBuffers; glad_glDrawBuffers = glad_stats_impl_glDrawBuffers; }
+	else if (!count && glad_stats_real_glDrawBuffers) { glad_glDrawBuffers = glad_stats_real_glDrawBuffers; glad_stats_real_glDrawBuffers = 0; }
+	if (count && glad_glDrawElements && glad_glDrawElements != glad_stats_impl_glDrawElements) { glad_stats_real_glDrawElements = glad_glDrawElements; glad_glDrawElements = glad_stats_impl_glDrawElements; }
+	else if (!count && glad_stats_real_glDrawElements) { glad_glDrawElements = glad_stats_real_glDrawElements; glad_stats_real_glDrawElements = 0; }
+	if (count && glad_glDrawElementsBaseVertex && glad_glDrawElementsBaseVertex != glad_stats_impl_glDrawElementsBaseVertex) { glad_stats_real_glDrawElementsBaseVertex = glad_glDrawElementsBaseVertex; glad_glDrawElementsBaseVertex = glad_stats_impl_glDrawElementsBaseVertex; }
+	else if (!count && glad_stats_real_glDrawElementsBaseVertex) { glad_glDrawElementsBaseVertex = glad_stats_real_glDrawElementsBaseVertex; glad_stats_real_glDrawElementsBaseVertex = 0; }
+	if (count && glad_glDrawElementsIndirect && glad_glDrawElementsIndirect != glad_stats_impl_glDrawElementsIndirect) { glad_stats_real_glDrawElementsIndirect = glad_glDrawElementsIndirect; glad_glDrawElementsIndirect = glad_stats_impl_glDrawElementsIndirect; }
+	else if (!count && glad_stats_real_glDrawElementsIndirect) { glad_glDrawElementsIndirect = glad_stats_real_glDrawElementsIndirect; glad_stats_real_glDrawElementsIndirect = 0; }
+	if (count && glad_glDrawElementsInstanced && glad_glDrawElementsInstanced != glad_stats_impl_glDrawElementsInstanced) { glad_stats_real_glDrawElementsInstanced = glad_glDrawElementsInstanced; glad_glDrawElementsInstanced = glad_stats_impl_glDrawElementsInstanced; }
+	else if (!count && glad_stats_real_glDrawElementsInstanced) { glad_glDrawElementsInstanced = glad_stats_real_glDrawElementsInstanced; glad_stats_real_glDrawElementsInstanced = 0; }
+	if (count && glad_glDrawElementsInstancedBaseInstance && glad_glDrawElementsInstancedBaseInstance != glad_stats_impl_glDrawElementsInstancedBaseInstance) { glad_stats_real_glDrawElementsInstancedBaseInstance = glad_glDrawElementsInstancedBaseInstance; glad_glDrawElementsInstancedBaseInstance = glad_stats_impl_glDrawElementsInstancedBaseInstance; }
+	else if (!count && glad_stats_real_glDrawElementsInstancedBaseInstance) { glad_glDrawElementsInstancedBaseInstance = glad_stats_real_glDrawElementsInstancedBaseInstance; glad_stats_real_glDrawElementsInstancedBaseInstance = 0; }
+	if (count && glad_glDrawElementsInstancedBaseVertex && glad_glDrawElementsInstancedBaseVertex != glad_stats_impl_glDrawElementsInstancedBaseVertex) { glad_stats_real_glDrawElementsInstancedBaseVertex = glad_glDrawElementsInstancedBaseVertex; glad_glDrawElementsInstancedBaseVertex = glad_stats_impl_glDrawElementsInstancedBaseVertex; }
+	else if (!count && glad_stats_real_glDrawElementsInstancedBaseVertex) { glad_glDrawElementsInstancedBaseVertex = glad_stats_real_glDrawElementsInstancedBaseVertex; glad_stats_real_glDrawElementsInstancedBaseVertex = 0; }
+	if (count && glad_glDrawElementsInstancedBaseVertexBaseInstance && glad_glDrawElementsInstancedBaseVertexBaseInstance != glad_stats_impl_glDrawElementsInstancedBaseVertexBaseInstance) { glad_stats_real_glDrawElementsInstancedBaseVertexBaseInstance = glad_glDrawElementsInstancedBaseVertexBaseInstance; glad_glDrawElementsInstancedBaseVertexBaseInstance = glad_stats_impl_glDrawElementsInstancedBaseVertexBaseInstance; }
+	else if (!count && glad_stats_real_glDrawElementsInstancedBaseVertexBaseInstance) { glad_glDrawElementsInstancedBaseVertexBaseInstance = glad_stats_real_glDrawElementsInstancedBaseVertexBaseInstance; glad_stats_real_glDrawElementsInstancedBaseVertexBaseInstance = 0; }
+	if (count && glad_glDrawPixels && glad_glDrawPixels != glad_stats_impl_glDrawPixels) { glad_stats_real_glDrawPixels = glad_glDrawPixels; glad_glDrawPixels = glad_stats_impl_glDrawPixels; }
+	else if (!count && glad_stats_real_glDrawPixels) { glad_glDrawPixels = glad_stats_real_glDrawPixels; glad_stats_real_glDrawPixels = 0; }
+	if (count && glad_glDrawRangeElements && glad_glDrawRangeElements != glad_stats_impl_glDrawRangeElements) { glad_stats_real_glDrawRangeElements = glad_glDrawRangeElements; glad_glDrawRangeElements = glad_stats_impl_glDrawRangeElements; }
+	else if (!count && glad_stats_real_glDrawRangeElements) { glad_glDrawRangeElements = glad_stats_real_glDrawRangeElements; glad_stats_real_glDrawRangeElements = 0; }
+	if (count && glad_glDrawRangeElementsBaseVertex && glad_glDrawRangeElementsBaseVertex != glad_stats_impl_glDrawRangeElementsBaseVertex) { glad_stats_real_glDrawRangeElementsBaseVertex = glad_glDrawRangeElementsBaseVertex; glad_glDrawRangeElementsBaseVertex = glad_stats_impl_glDrawRangeElementsBaseVertex; }
+	else if (!count && glad_stats_real_glDrawRangeElementsBaseVertex) { glad_glDrawRangeElementsBaseVertex = glad_stats_real_glDrawRangeElementsBaseVertex; glad_stats_real_glDrawRangeElementsBaseVertex = 0; }
+	if (count && glad_glDrawTransformFeedback && glad_glDrawTransformFeedback != glad_stats_impl_glDrawTransformFeedback) { glad_stats_real_glDrawTransformFeedback = glad_glDrawTransformFeedback; glad_glDrawTransformFeedback = glad_stats_impl_glDrawTransformFeedback; }
+	else if (!count && glad_stats_real_glDrawTransformFeedback) { glad_glDrawTransformFeedback = glad_stats_real_glDrawTransformFeedback; glad_stats_real_glDrawTransformFeedback = 0; }
+	if (count && glad_glDrawTransformFeedbackInstanced && glad_glDrawTransformFeedbackInstanced != glad_stats_impl_glDrawTransformFeedbackInstanced) { glad_stats_real_glDrawTransformFeedbackInstanced = glad_glDrawTransformFeedbackInstanced; glad_glDrawTransformFeedbackInstanced = glad_stats_impl_glDrawTransformFeedbackInstanced; }
+	else if (!count && glad_stats_real_glDrawTransformFeedbackInstanced) { glad_glDrawTransformFeedbackInstanced = glad_stats_real_glDrawTransformFeedbackInstanced; glad_stats_real_glDrawTransformFeedbackInstanced = 0; }
+	if (count && glad_glDrawTransformFeedbackStream && glad_glDrawTransformFeedbackStream != glad_stats_impl_glDrawTransformFeedbackStream) { glad_stats_real_glDrawTransformFeedbackStream = glad_glDrawTransformFeedbackStream; glad_glDrawTransformFeedbackStream = glad_stats_impl_glDrawTransformFeedbackStream; }
+	else if (!count && glad_stats_real_glDrawTransformFeedbackStream) { glad_glDrawTransformFeedbackStream = glad_stats_real_glDrawTransformFeedbackStream; glad_stats_real_glDrawTransformFeedbackStream = 0; }
+	if (count && glad_glDrawTransformFeedbackStreamInstanced && glad_glDrawTransformFeedbackStreamInstanced != glad_stats_impl_glDrawTransformFeedbackStreamInstanced) { glad_stats_real_glDrawTransformFeedbackStreamInstanced = glad_glDrawTransformFeedbackStreamInstanced; glad_glDrawTransformFeedbackStreamInstanced = glad_stats_impl_glDrawTransformFeedbackStreamInstanced; }
+	else if (!count && glad_stats_real_glDrawTransformFeedbackStreamInstanced) { glad_glDrawTransformFeedbackStreamInstanced = glad_stats_real_glDrawTransformFeedbackStreamInstanced; glad_stats_real_glDrawTransformFeedbackStreamInstanced = 0; }
+	if (count && glad_glEdgeFlag && glad_glEdgeFlag != glad_stats_impl_glEdgeFlag) { glad_stats_real_glEdgeFlag = glad_glEdgeFlag; glad_glEdgeFlag = glad_stats_impl_glEdgeFlag; }
+	else if (!count && glad_stats_real_glEdgeFlag) { glad_glEdgeFlag = glad_stats_real_glEdgeFlag; glad_stats_real_glEdgeFlag = 0; }
+	if (count && glad_glEdgeFlagPointer && glad_glEdgeFlagPointer != glad_stats_impl_glEdgeFlagPointer) { glad_stats_real_glEdgeFlagPointer = glad_glEdgeFlagPointer; glad_glEdgeFlagPointer = glad_stats_impl_glEdgeFlagPointer; }
+	else if (!count && glad_stats_real_glEdgeFlagPointer) { glad_glEdgeFlagPointer = glad_stats_real_glEdgeFlagPointer; glad_stats_real_glEdgeFlagPointer = 0; }
+	if (count && glad_glEdgeFlagv && glad_glEdgeFlagv != glad_stats_impl_glEdgeFlagv) { glad_stats_real_glEdgeFlagv = glad_glEdgeFlagv; glad_glEdgeFlagv = glad_stats_impl_glEdgeFlagv; }
+	else if (!count && glad_stats_real_glEdgeFlagv) { glad_glEdgeFlagv = glad_stats_real_glEdgeFlagv; glad_stats_real_glEdgeFlagv = 0; }
+	if (count && glad_glEnable && glad_glEnable != glad_stats_impl_glEnable) { glad_stats_real_glEnable = glad_glEnable; glad_glEnable = glad_stats_impl_glEnable; }
+	else if (!count && glad_stats_real_glEnable) { glad_glEnable = glad_stats_real_glEnable; glad_stats_real_glEnable = 0; }
+	if (count && glad_glEnableClientState && glad_glEnableClientState != glad_stats_impl_glEnableClientState) { glad_stats_real_glEnableClientState = glad_glEnableClientState; glad_glEnableClientState = glad_stats_impl_glEnableClientState; }
+	else if (!count && glad_stats_real_glEnableClientState) { glad_glEnableClientState = glad_stats_real_glEnableClientState; glad_stats_real_glEnableClientState = 0; }
+	if (count && glad_glEnableVertexArrayAttrib && glad_glEnableVertexArrayAttrib != glad_stats_impl_glEnableVertexArrayAttrib) { glad_stats_real_glEnableVertexArrayAttrib = glad_glEnableVertexArrayAttrib; glad_glEnableVertexArrayAttrib = glad_stats_impl_glEnableVertexArrayAttrib; }
+	else if (!count && glad_stats_real_glEnableVertexArrayAttrib) { glad_glEnableVertexArrayAttrib = glad_stats_real_glEnableVertexArrayAttrib; glad_stats_real_glEnableVertexArrayAttrib = 0; }
+	if (count && glad_glEnableVertexAttribArray && glad_glEnableVertexAttribArray != glad_stats_impl_glEnableVertexAttribArray) { glad_stats_real_glEnableVertexAttribArray = glad_glEnableVertexAttribArray; glad_glEnableVertexAttribArray = glad_stats_impl_glEnableVertexAttribArray; }
+	else if (!count && glad_stats_real_glEnableVertexAttribArray) { glad_glEnableVertexAttribArray = glad_stats_real_glEnableVertexAttribArray; glad_stats_real_glEnableVertexAttribArray = 0; }
+	if (count && glad_glEnablei && glad_glEnablei != glad_stats_impl_glEnablei) { glad_stats_real_glEnablei = glad_glEnablei; glad_glEnablei = glad_stats_impl_glEnablei; }
+	else if (!count && glad_stats_real_glEnablei) { glad_glEnablei = glad_stats_real_glEnablei; glad_stats_real_glEnablei = 0; }
+	if (count && glad_glEnd && glad_glEnd != glad_stats_impl_glEnd) { glad_stats_real_glEnd = glad_glEnd; glad_glEnd = glad_stats_impl_glEnd; }
+	else if (!count && glad_stats_real_glEnd) { glad_glEnd = glad_stats_real_glEnd; glad_stats_real_glEnd = 0; }
+	if (count && glad_glEndConditionalRender && glad_glEndConditionalRender != glad_stats_impl_glEndConditionalRender) { glad_stats_real_glEndConditionalRender = glad_glEndConditionalRender; glad_glEndConditionalRender = glad_stats_impl_glEndConditionalRender; }
+	else if (!count && glad_stats_real_glEndConditionalRender) { glad_glEndConditionalRender = glad_stats_real_glEndConditionalRender; glad_stats_real_glEndConditionalRender = 0; }
+	if (count && glad_glEndList && glad_glEndList != glad_stats_impl_glEndList) { glad_stats_real_glEndList = glad_glEndList; glad_glEndList = glad_stats_impl_glEndList; }
+	else if (!count && glad_stats_real_glEndList) { glad_glEndList = glad_stats_real_glEndList; glad_stats_real_glEndList = 0; }
+	if (count && glad_glEndQuery && glad_glEndQuery != glad_stats_impl_glEndQuery) { glad_stats_real_glEndQuery = glad_glEndQuery; glad_glEndQuery = glad_stats_impl_glEndQuery; }
+	else if (!count && glad_stats_real_glEndQuery) { glad_glEndQuery = glad_stats_real_glEndQuery; glad_stats_real_glEndQuery = 0; }
+	if (count && glad_glEndQueryIndexed && glad_glEndQueryIndexed != glad_stats_impl_glEndQueryIndexed) { glad_stats_real_glEndQueryIndexed = glad_glEndQueryIndexed; glad_glEndQueryIndexed = glad_stats_impl_glEndQueryIndexed; }
+	else if (!count && glad_stats_real_glEndQueryIndexed) { glad_glEndQueryIndexed = glad_stats_real_glEndQueryIndexed; glad_stats_real_glEndQueryIndexed = 0; }
+	if (count && glad_glEndTransformFeedback && glad_glEndTransformFeedback != glad_stats_impl_glEndTransformFeedback) { glad_stats_real_glEndTransformFeedback = glad_glEndTransformFeedback; glad_glEndTransformFeedback = glad_stats_impl_glEndTransformFeedback; }
+	else if (!count && glad_stats_real_glEndTransformFeedback) { glad_glEndTransformFeedback = glad_stats_real_glEndTransformFeedback; glad_stats_real_glEndTransformFeedback = 0; }
+	if (count && glad_glEvalCoord1d && glad_glEvalCoord1d != glad_stats_impl_glEvalCoord1d) { glad_stats_real_glEvalCoord1d = glad_glEvalCoord1d; glad_glEvalCoord1d = glad_stats_impl_glEvalCoord1d; }
+	else if (!count && glad_stats_real_glEvalCoord1d) { glad_glEvalCoord1d = glad_stats_real_glEvalCoord1d; glad_stats_real_glEvalCoord1d = 0; }
+	if (count && glad_glEvalCoord1dv && glad_glEvalCoord1dv != glad_stats_impl_glEvalCoord1dv) { glad_stats_real_glEvalCoord1dv = glad_glEvalCoord1dv; glad_glEvalCoord1dv = glad_stats_impl_glEvalCoord1dv; }
+	else if (!count && glad_stats_real_glEvalCoord1dv) { glad_glEvalCoord1dv = glad_stats_real_glEvalCoord1dv; glad_stats_real_glEvalCoord1dv = 0; }
+	if (count && glad_glEvalCoord1f && glad_glEvalCoord1f != glad_stats_impl_glEvalCoord1f) { glad_stats_real_glEvalCoord1f = glad_glEvalCoord1f; glad_glEvalCoord1f = glad_stats_impl_glEvalCoord1f; }
+	else if (!count && glad_stats_real_glEvalCoord1f) { glad_glEvalCoord1f = glad_stats_real_glEvalCoord1f; glad_stats_real_glEvalCoord1f = 0; }
+	if (count && glad_glEvalCoord1fv && glad_glEvalCoord1fv != glad_stats_impl_glEvalCoord1fv) { glad_stats_real_glEvalCoord1fv = glad_glEvalCoord1fv; glad_glEvalCoord1fv = glad_stats_impl_glEvalCoord1fv; }
+	else if (!count && glad_stats_real_glEvalCoord1fv) { glad_glEvalCoord1fv = glad_stats_real_glEvalCoord1fv; glad_stats_real_glEvalCoord1fv = 0; }
+	if (count && glad_glEvalCoord2d && glad_glEvalCoord2d != glad_stats_impl_glEvalCoord2d) { glad_stats_real_glEvalCoord2d = glad_glEvalCoord2d; glad_glEvalCoord2d = glad_stats_impl_glEvalCoord2d; }
+	else if (!count && glad_stats_real_glEvalCoord2d) { glad_glEvalCoord2d = glad_stats_real_glEvalCoord2d; glad_stats_real_glEvalCoord2d = 0; }
+	if (count && glad_glEvalCoord2dv && glad_glEvalCoord2dv != glad_stats_impl_glEvalCoord2dv) { glad_stats_real_glEvalCoord2dv = glad_glEvalCoord2dv; glad_glEvalCoord2dv = glad_stats_impl_glEvalCoord2dv; }
+	else if (!count && glad_stats_real_glEvalCoord2dv) { glad_glEvalCoord2dv = glad_stats_real_glEvalCoord2dv; glad_stats_real_glEvalCoord2dv = 0; }
+	if (count && glad_glEvalCoord2f && glad_glEvalCoord2f != glad_stats_impl_glEvalCoord2f) { glad_stats_real_glEvalCoord2f = glad_glEvalCoord2f; glad_glEvalCoord2f = glad_stats_impl_glEvalCoord2f; }
+	else if (!count && glad_stats_real_glEvalCoord2f) { glad_glEvalCoord2f = glad_stats_real_glEvalCoord2f; glad_stats_real_glEvalCoord2f = 0; }
+	if (count && glad_glEvalCoord2fv && glad_glEvalCoord2fv != glad_stats_impl_glEvalCoord2fv) { glad_stats_real_glEvalCoord2fv = glad_glEvalCoord2fv; glad_glEvalCoord2fv = glad_stats_impl_glEvalCoord2fv; }
+	else if (!count && glad_stats_real_glEvalCoord2fv) { glad_glEvalCoord2fv = glad_stats_real_glEvalCoord2fv; glad_stats_real_glEvalCoord2fv = 0; }
+	if (count && glad_glEvalMesh1 && glad_glEvalMesh1 != glad_stats_impl_glEvalMesh1) { glad_stats_real_glEvalMesh1 = glad_glEvalMesh1; glad_glEvalMesh1 = glad_stats_impl_glEvalMesh1; }
+	else if (!count && glad_stats_real_glEvalMesh1) { glad_glEvalMesh1 = glad_stats_real_glEvalMesh1; glad_stats_real_glEvalMesh1 = 0; }
+	if (count && glad_glEvalMesh2 && glad_glEvalMesh2 != glad_stats_impl_glEvalMesh2) { glad_stats_real_glEvalMesh2 = glad_glEvalMesh2; glad_glEvalMesh2 = glad_stats_impl_glEvalMesh2; }
+	else if (!count && glad_stats_real_glEvalMesh2) { glad_glEvalMesh2 = glad_stats_real_glEvalMesh2; glad_stats_real_glEvalMesh2 = 0; }
+	if (count && glad_glEvalPoint1 && glad_glEvalPoint1 != glad_stats_impl_glEvalPoint1) { glad_stats_real_glEvalPoint1 = glad_glEvalPoint1; glad_glEvalPoint1 = glad_stats_impl_glEvalPoint1; }
+	else if (!count && glad_stats_real_glEvalPoint1) { glad_glEvalPoint1 = glad_stats_real_glEvalPoint1; glad_stats_real_glEvalPoint1 = 0; }
+	if (count && glad_glEvalPoint2 && glad_glEvalPoint2 != glad_stats_impl_glEvalPoint2) { glad_stats_real_glEvalPoint2 = glad_glEvalPoint2; glad_glEvalPoint2 = glad_stats_impl_glEvalPoint2; }
+	else if (!count && glad_stats_real_glEvalPoint2) { glad_glEvalPoint2 = glad_stats_real_glEvalPoint2; glad_stats_real_glEvalPoint2 = 0; }
+	if (count && glad_glFeedbackBuffer && glad_glFeedbackBuffer != glad_stats_impl_glFeedbackBuffer) { glad_stats_real_glFeedbackBuffer = glad_glFeedbackBuffer; glad_glFeedbackBuffer = glad_stats_impl_glFeedbackBuffer; }
+	else if (!count && glad_stats_real_glFeedbackBuffer) { glad_glFeedbackBuffer = glad_stats_real_glFeedbackBuffer; glad_stats_real_glFeedbackBuffer = 0; }
+	if (count && glad_glFenceSync && glad_glFenceSync != glad_stats_impl_glFenceSync) { glad_stats_real_glFenceSync = glad_glFenceSync; glad_glFenceSync = glad_stats_impl_glFenceSync; }
+	else if (!count && glad_stats_real_glFenceSync) { glad_glFenceSync = glad_stats_real_glFenceSync; glad_stats_real_glFenceSync = 0; }
+	if (count && glad_glFinish && glad_glFinish != glad_stats_impl_glFinish) { glad_stats_real_glFinish = glad_glFinish; glad_glFinish = glad_stats_impl_glFinish; }
+	else if (!count && glad_stats_real_glFinish) { glad_glFinish = glad_stats_real_glFinish; glad_stats_real_glFinish = 0; }
+	if (count && glad_glFlush && glad_glFlush != glad_stats_impl_glFlush) { glad_stats_real_glFlush = glad_glFlush; glad_glFlush = glad_stats_impl_glFlush; }
+	else if (!count && glad_stats_real_glFlush) { glad_glFlush = glad_stats_real_glFlush; glad_stats_real_glFlush = 0; }
+	if (count && glad_glFlushMappedBufferRange && glad_glFlushMappedBufferRange != glad_stats_impl_glFlushMappedBufferRange) { glad_stats_real_glFlushMappedBufferRange = glad_glFlushMappedBufferRange; glad_glFlushMappedBufferRange = glad_stats_impl_glFlushMappedBufferRange; }
+	else if (!count && glad_stats_real_glFlushMappedBufferRange) { glad_glFlushMappedBufferRange = glad_stats_real_glFlushMappedBufferRange; glad_stats_real_glFlushMappedBufferRange = 0; }
+	if (count && glad_glFlushMappedNamedBufferRange && glad_glFlushMappedNamedBufferRange != glad_stats_impl_glFlushMappedNamedBufferRange) { glad_stats_real_glFlushMappedNamedBufferRange = glad_glFlushMappedNamedBufferRange; glad_glFlushMappedNamedBufferRange = glad_stats_impl_glFlushMappedNamedBufferRange; }
+	else if (!count && glad_stats_real_glFlushMappedNamedBufferRange) { glad_glFlushMappedNamedBufferRange = glad_stats_real_glFlushMappedNamedBufferRange; glad_stats_real_glFlushMappedNamedBufferRange = 0; }
+	if (count && glad_glFogCoordPointer && glad_glFogCoordPointer != glad_stats_impl_glFogCoordPointer) { glad_stats_real_glFogCoordPointer = glad_glFogCoordPointer; glad_glFogCoordPointer = glad_stats_impl_glFogCoordPointer; }
+	else if (!count && glad_stats_real_glFogCoordPointer) { glad_glFogCoordPointer = glad_stats_real_glFogCoordPointer; glad_stats_real_glFogCoordPointer = 0; }
+	if (count && glad_glFogCoordd && glad_glFogCoordd != glad_stats_impl_glFogCoordd) { glad_stats_real_glFogCoordd = glad_glFogCoordd; glad_glFogCoordd = glad_stats_impl_glFogCoordd; }
+	else if (!count && glad_stats_real_glFogCoordd) { glad_glFogCoordd = glad_stats_real_glFogCoordd; glad_stats_real_glFogCoordd = 0; }
+	if (count && glad_glFogCoorddv && glad_glFogCoorddv != glad_stats_impl_glFogCoorddv) { glad_stats_real_glFogCoorddv = glad_glFogCoorddv; glad_glFogCoorddv = glad_stats_impl_glFogCoorddv; }
+	else if (!count && glad_stats_real_glFogCoorddv) { glad_glFogCoorddv = glad_stats_real_glFogCoorddv; glad_stats_real_glFogCoorddv = 0; }
+	if (count && glad_glFogCoordf && glad_glFogCoordf != glad_stats_impl_glFogCoordf) { glad_stats_real_glFogCoordf = glad_glFogCoordf; glad_glFogCoordf = glad_stats_impl_glFogCoordf; }
+	else if (!count && glad_stats_real_glFogCoordf) { glad_glFogCoordf = glad_stats_real_glFogCoordf; glad_stats_real_glFogCoordf = 0; }
+	if (count && glad_glFogCoordfv && glad_glFogCoordfv != glad_stats_impl_glFogCoordfv) { glad_stats_real_glFogCoordfv = glad_glFogCoordfv; glad_glFogCoordfv = glad_stats_impl_glFogCoordfv; }
+	else if (!count && glad_stats_real_glFogCoordfv) { glad_glFogCoordfv = glad_stats_real_glFogCoordfv; glad_stats_real_glFogCoordfv = 0; }
+	if (count && glad_glFogf && glad_glFogf != glad_stats_impl_glFogf) { glad_stats_real_glFogf = glad_glFogf; glad_glFogf = glad_stats_impl_glFogf; }
+	else if (!count && glad_stats_real_glFogf) { glad_glFogf = glad_stats_real_glFogf; glad_stats_real_glFogf = 0; }
+	if (count && glad_glFogfv && glad_glFogfv != glad_stats_impl_glFogfv) { glad_stats_real_glFogfv = glad_glFogfv; glad_glFogfv = glad_stats_impl_glFogfv; }
+	else if (!count && glad_stats_real_glFogfv) { glad_glFogfv = glad_stats_real_glFogfv; glad_stats_real_glFogfv = 0; }
+	if (count && glad_glFogi && glad_glFogi != glad_stats_impl_glFogi) { glad_stats_real_glFogi = glad_glFogi; glad_glFogi = glad_stats_impl_glFogi; }
+	else if (!count && glad_stats_real_glFogi) { glad_glFogi = glad_stats_real_glFogi; glad_stats_real_glFogi = 0; }
+	if (count && glad_glFogiv && glad_glFogiv != glad_stats_impl_glFogiv) { glad_stats_real_glFogiv = glad_glFogiv; glad_glFogiv = glad_stats_impl_glFogiv; }
+	else if (!count && glad_stats_real_glFogiv) { glad_glFogiv = glad_stats_real_glFogiv; glad_stats_real_glFogiv = 0; }
+	if (count && glad_glFramebufferParameteri && glad_glFramebufferParameteri != glad_stats_impl_glFramebufferParameteri) { glad_stats_real_glFramebufferParameteri = glad_glFramebufferParameteri; glad_glFramebufferParameteri = glad_stats_impl_glFramebufferParameteri; }
+	else if (!count && glad_stats_real_glFramebufferParameteri) { glad_glFramebufferParameteri = glad_stats_real_glFramebufferParameteri; glad_stats_real_glFramebufferParameteri = 0; }
+	if (count && glad_glFramebufferRenderbuffer && glad_glFramebufferRenderbuffer != glad_stats_impl_glFramebufferRenderbuffer) { glad_stats_real_glFramebufferRenderbuffer = glad_glFramebufferRenderbuffer; glad_glFramebufferRenderbuffer = glad_stats_impl_glFramebufferRenderbuffer; }
+	else if (!count && glad_stats_real_glFramebufferRenderbuffer) { glad_glFramebufferRenderbuffer = glad_stats_real_glFramebufferRenderbuffer; glad_stats_real_glFramebufferRenderbuffer = 0; }
+	if (count && glad_glFramebufferTexture && glad_glFramebufferTexture != glad_stats_impl_glFramebufferTexture) { glad_stats_real_glFramebufferTexture = glad_glFramebufferTexture; glad_glFramebufferTexture = glad_stats_impl_glFramebufferTexture; }
+	else if (!count && glad_stats_real_glFramebufferTexture) { glad_glFramebufferTexture = glad_stats_real_glFramebufferTexture; glad_stats_real_glFramebufferTexture = 0; }
+	if (count && glad_glFramebufferTexture1D && glad_glFramebufferTexture1D != glad_stats_impl_glFramebufferTexture1D) { glad_stats_real_glFramebufferTexture1D = glad_glFramebufferTexture1D; glad_glFramebufferTexture1D = glad_stats_impl_glFramebufferTexture1D; }
+	else if (!count && glad_stats_real_glFramebufferTexture1D) { glad_glFramebufferTexture1D = glad_stats_real_glFramebufferTexture1D; glad_stats_real_glFramebufferTexture1D = 0; }
+	if (count && glad_glFramebufferTexture2D && glad_glFramebufferTexture2D != glad_stats_impl_glFramebufferTexture2D) { glad_stats_real_glFramebufferTexture2D = glad_glFramebufferTexture2D; glad_glFramebufferTexture2D = glad_stats_impl_glFramebufferTexture2D; }
+	else if (!count && glad_stats_real_glFramebufferTexture2D) { glad_glFramebufferTexture2D = glad_stats_real_glFramebufferTexture2D; glad_stats_real_glFramebufferTexture2D = 0; }
+	if (count && glad_glFramebufferTexture3D && glad_glFramebufferTexture3D != glad_stats_impl_glFramebufferTexture3D) { glad_stats_real_glFramebufferTexture3D = glad_glFramebufferTexture3D; glad_glFramebufferTexture3D = glad_stats_impl_glFramebufferTexture3D; }
+	else if (!count && glad_stats_real_glFramebufferTexture3D) { glad_glFramebufferTexture3D = glad_stats_real_glFramebufferTexture3D; glad_stats_real_glFramebufferTexture3D = 0; }
+	if (count && glad_glFramebufferTextureLayer && glad_glFramebufferTextureLayer != glad_stats_impl_glFramebufferTextureLayer) { glad_stats_real_glFramebufferTextureLayer = glad_glFramebufferTextureLayer; glad_glFramebufferTextureLayer = glad_stats_impl_glFramebufferTextureLayer; }
+	else if (!count && glad_stats_real_glFramebufferTextureLayer) { glad_glFramebufferTextureLayer = glad_stats_real_glFramebufferTextureLayer; glad_stats_real_glFramebufferTextureLayer = 0; }
+	if (count && glad_glFrontFace && glad_glFrontFace != glad_stats_impl_glFrontFace) { glad_stats_real_glFrontFace = glad_glFrontFace; glad_glFrontFace = glad_stats_impl_glFrontFace; }
+	else if (!count && glad_stats_real_glFrontFace) { glad_glFrontFace = glad_stats_real_glFrontFace; glad_stats_real_glFrontFace = 0; }
+	if (count && glad_glFrustum && glad_glFrustum != glad_stats_impl_glFrustum) { glad_stats_real_glFrustum = glad_glFrustum; glad_glFrustum = glad_stats_impl_glFrustum; }
+	else if (!count && glad_stats_real_glFrustum) { glad_glFrustum = glad_stats_real_glFrustum; glad_stats_real_glFrustum = 0; }
+	if (count && glad_glGenBuffers && glad_glGenBuffers != glad_stats_impl_glGenBuffers) { glad_stats_real_glGenBuffers = glad_glGenBuffers; glad_glGenBuffers = glad_stats_impl_glGenBuffers; }
+	else if (!count && glad_stats_real_glGenBuffers) { glad_glGenBuffers = glad_stats_real_glGenBuffers; glad_stats_real_glGenBuffers = 0; }
+	if (count && glad_glGenFramebuffers && glad_glGenFramebuffers != glad_stats_impl_glGenFramebuffers) { glad_stats_real_glGenFramebuffers = glad_glGenFramebuffers; glad_glGenFramebuffers = glad_stats_impl_glGenFramebuffers; }
+	else if (!count && glad_stats_real_glGenFramebuffers) { glad_glGenFramebuffers = glad_stats_real_glGenFramebuffers; glad_stats_real_glGenFramebuffers = 0; }
+	if (count && glad_glGenLists && glad_glGenLists != glad_stats_impl_glGenLists) { glad_stats_real_glGenLists = glad_glGenLists; glad_glGenLists = glad_stats_impl_glGenLists; }
+	else if (!count && glad_stats_real_glGenLists) { glad_glGenLists = glad_stats_real_glGenLists; glad_stats_real_glGenLists = 0; }
+	if (count && glad_glGenProgramPipelines && glad_glGenProgramPipelines != glad_stats_impl_glGenProgramPipelines) { glad_stats_real_glGenProgramPipelines = glad_glGenProgramPipelines; glad_glGenProgramPipelines = glad_stats_impl_glGenProgramPipelines; }
+	else if (!count && glad_stats_real_glGenProgramPipelines) { glad_glGenProgramPipelines = glad_stats_real_glGenProgramPipelines; glad_stats_real_glGenProgramPipelines = 0; }
+	if (count && glad_glGenQueries && glad_glGenQueries != glad_stats_impl_glGenQueries) { glad_stats_real_glGenQueries = glad_glGenQueries; glad_glGenQueries = glad_stats_impl_glGenQueries; }
+	else if (!count && glad_stats_real_glGenQueries) { glad_glGenQueries = glad_stats_real_glGenQueries; glad_stats_real_glGenQueries = 0; }
+	if (count && glad_glGenRenderbuffers && glad_glGenRenderbuffers != glad_stats_impl_glGenRenderbuffers) { glad_stats_real_glGenRenderbuffers = glad_glGenRenderbuffers; glad_glGenRenderbuffers = glad_stats_impl_glGenRenderbuffers; }
+	else if (!count && glad_stats_real_glGenRenderbuffers) { glad_glGenRenderbuffers = glad_stats_real_glGenRenderbuffers; glad_stats_real_glGenRenderbuffers = 0; }
+	if (count && glad_glGenSamplers && glad_glGenSamplers != glad_stats_impl_glGenSamplers) { glad_stats_real_glGenSamplers = glad_glGenSamplers; glad_glGenSamplers = glad_stats_impl_glGenSamplers; }
+	else if (!count && glad_stats_real_glGenSamplers) { glad_glGenSamplers = glad_stats_real_glGenSamplers; glad_stats_real_glGenSamplers = 0; }
+	if (count && glad_glGenTextures && glad_glGenTextures != glad_stats_impl_glGenTextures) { glad_stats_real_glGenTextures = glad_glGenTextures; glad_glGenTextures = glad_stats_impl_glGenTextures; }
+	else if (!count && glad_stats_real_glGenTextures) { glad_glGenTextures = glad_stats_real_glGenTextures; glad_stats_real_glGenTextures = 0; }
+	if (count && glad_glGenTransformFeedbacks && glad_glGenTransformFeedbacks != glad_stats_impl_glGenTransformFeedbacks) { glad_stats_real_glGenTransformFeedbacks = glad_glGenTransformFeedbacks; glad_glGenTransformFeedbacks = glad_stats_impl_glGenTransformFeedbacks; }
+	else if (!count && glad_stats_real_glGenTransformFeedbacks) { glad_glGenTransformFeedbacks = glad_stats_real_glGenTransformFeedbacks; glad_stats_real_glGenTransformFeedbacks = 0; }
+	if (count && glad_glGenVertexArrays && glad_glGenVertexArrays != glad_stats_impl_glGenVertexArrays) { glad_stats_real_glGenVertexArrays = glad_glGenVertexArrays; glad_glGenVertexArrays = glad_stats_impl_glGenVertexArrays; }
+	else if (!count && glad_stats_real_glGenVertexArrays) { glad_glGenVertexArrays = glad_stats_real_glGenVertexArrays; glad_stats_real_glGenVertexArrays = 0; }
+	if (count && glad_glGenerateMipmap && glad_glGenerateMipmap != glad_stats_impl_glGenerateMipmap) { glad_stats_real_glGenerateMipmap = glad_glGenerateMipmap; glad_glGenerateMipmap = glad_stats_impl_glGenerateMipmap; }
+	else if (!count && glad_stats_real_glGenerateMipmap) { glad_glGenerateMipmap = glad_stats_real_glGenerateMipmap; glad_stats_real_glGenerateMipmap = 0; }
+	if (count && glad_glGenerateTextureMipmap && glad_glGenerateTextureMipmap != glad_stats_impl_glGenerateTextureMipmap) { glad_stats_real_glGenerateTextureMipmap = glad_glGenerateTextureMipmap; glad_glGenerateTextureMipmap = glad_stats_impl_glGenerateTextureMipmap; }
+	else if (!count && glad_stats_real_glGenerateTextureMipmap) { glad_glGenerateTextureMipmap = glad_stats_real_glGenerateTextureMipmap; glad_stats_real_glGenerateTextureMipmap = 0; }
+	if (count && glad_glGetActiveAtomicCounterBufferiv && glad_glGetActiveAtomicCounterBufferiv != glad_stats_impl_glGetActiveAtomicCounterBufferiv) { glad_stats_real_glGetActiveAtomicCounterBufferiv = glad_glGetActiveAtomicCounterBufferiv; glad_glGetActiveAtomicCounterBufferiv = glad_stats_impl_glGetActiveAtomicCounterBufferiv; }
+	else if (!count && glad_stats_real_glGetActiveAtomicCounterBufferiv) { glad_glGetActiveAtomicCounterBufferiv = glad_stats_real_glGetActiveAtomicCounterBufferiv; glad_stats_real_glGetActiveAtomicCounterBufferiv = 0; }
+	if (count && glad_glGetActiveAttrib && glad_glGetActiveAttrib != glad_stats_impl_glGetActiveAttrib) { glad_stats_real_glGetActiveAttrib = glad_glGetActiveAttrib; glad_glGetActiveAttrib = glad_stats_impl_glGetActiveAttrib; }
+	else if (!count && glad_stats_real_glGetActiveAttrib) { glad_glGetActiveAttrib = glad_stats_real_glGetActiveAttrib; glad_stats_real_glGetActiveAttrib = 0; }
+	if (count && glad_glGetActiveSubroutineName && glad_glGetActiveSubroutineName != glad_stats_impl_glGetActiveSubroutineName) { glad_stats_real_glGetActiveSubroutineName = glad_glGetActiveSubroutineName; glad_glGetActiveSubroutineName = glad_stats_impl_glGetActiveSubroutineName; }
+	else if (!count && glad_stats_real_glGetActiveSubroutineName) { glad_glGetActiveSubroutineName = glad_stats_real_glGetActiveSubroutineName; glad_stats_real_glGetActiveSubroutineName = 0; }
+	if (count && glad_glGetActiveSubroutineUniformName && glad_glGetActiveSubroutineUniformName != glad_stats_impl_glGetActiveSubroutineUniformName) { glad_stats_real_glGetActiveSubroutineUniformName = glad_glGetActiveSubroutineUniformName; glad_glGetActiveSubroutineUniformName = glad_stats_impl_glGetActiveSubroutineUniformName; }
+	else if (!count && glad_stats_real_glGetActiveSubroutineUniformName) { glad_glGetActiveSubroutineUniformName = glad_stats_real_glGetActiveSubroutineUniformName; glad_stats_real_glGetActiveSubroutineUniformName = 0; }
+	if (count && glad_glGetActiveSubroutineUniformiv && glad_glGetActiveSubroutineUniformiv != glad_stats_impl_glGetActiveSubroutineUniformiv) { glad_stats_real_glGetActiveSubroutineUniformiv = glad_glGetActiveSubroutineUniformiv; glad_glGetActiveSubroutineUniformiv = glad_stats_impl_glGetActiveSubroutineUniformiv; }
+	else if (!count && glad_stats_real_glGetActiveSubroutineUniformiv) { glad_glGetActiveSubroutineUniformiv = glad_stats_real_glGetActiveSubroutineUniformiv; glad_stats_real_glGetActiveSubroutineUniformiv = 0; }
+	if (count && glad_glGetActiveUniform && glad_glGetActiveUniform != glad_stats_impl_glGetActiveUniform) { glad_stats_real_glGetActiveUniform = glad_glGetActiveUniform; glad_glGetActiveUniform = glad_stats_impl_glGetActiveUniform; }
+	else if (!count && glad_stats_real_glGetActiveUniform) { glad_glGetActiveUniform = glad_stats_real_glGetActiveUniform; glad_stats_real_glGetActiveUniform = 0; }
+	if (count && glad_glGetActiveUniformBlockName && glad_glGetActiveUniformBlockName != glad_stats_impl_glGetActiveUniformBlockName) { glad_stats_real_glGetActiveUniformBlockName = glad_glGetActiveUniformBlockName; glad_glGetActiveUniformBlockName = glad_stats_impl_glGetActiveUniformBlockName; }
+	else if (!count && glad_stats_real_glGetActiveUniformBlockName) { glad_glGetActiveUniformBlockName = glad_stats_real_glGetActiveUniformBlockName; glad_stats_real_glGetActiveUniformBlockName = 0; }
+	if (count && glad_glGetActiveUniformBlockiv && glad_glGetActiveUniformBlockiv != glad_stats_impl_glGetActiveUniformBlockiv) { glad_stats_real_glGetActiveUniformBlockiv = glad_glGetActiveUniformBlockiv; glad_glGetActiveUniformBlockiv = glad_stats_impl_glGetActiveUniformBlockiv; }
+	else if (!count && glad_stats_real_glGetActiveUniformBlockiv) { glad_glGetActiveUniformBlockiv = glad_stats_real_glGetActiveUniformBlockiv; glad_stats_real_glGetActiveUniformBlockiv = 0; }
+	if (count && glad_glGetActiveUniformName && glad_glGetActiveUniformName != glad_stats_impl_glGetActiveUniformName) { glad_stats_real_glGetActiveUniformName = glad_glGetActiveUniformName; glad_glGetActiveUniformName = glad_stats_impl_glGetActiveUniformName; }
+	else if (!count && glad_stats_real_glGetActiveUniformName) { glad_glGetActiveUniformName = glad_stats_real_glGetActiveUniformName; glad_stats_real_glGetActiveUniformName = 0; }
+	if (count && glad_glGetActiveUniformsiv && glad_glGetActiveUniformsiv != glad_stats_impl_glGetActiveUniformsiv) { glad_stats_real_glGetActiveUniformsiv = glad_glGetActiveUniformsiv; glad_glGetActiveUniformsiv = glad_stats_impl_glGetActiveUniformsiv; }
+	else if (!count && glad_stats_real_glGetActiveUniformsiv) { glad_glGetActiveUniformsiv = glad_stats_real_glGetActiveUniformsiv; glad_stats_real_glGetActiveUniformsiv = 0; }
+	if (count && glad_glGetAttachedShaders && glad_glGetAttachedShaders != glad_stats_impl_glGetAttachedShaders) { glad_stats_real_glGetAttachedShaders = glad_glGetAttachedShaders; glad_glGetAttachedShaders = glad_stats_impl_glGetAttachedShaders; }
+	else if (!count && glad_stats_real_glGetAttachedShaders) { glad_glGetAttachedShaders = glad_stats_real_glGetAttachedShaders; glad_stats_real_glGetAttachedShaders = 0; }
+	if (count && glad_glGetAttribLocation && glad_glGetAttribLocation != glad_stats_impl_glGetAttribLocation) { glad_stats_real_glGetAttribLocation = glad_glGetAttribLocation; glad_glGetAttribLocation = glad_stats_impl_glGetAttribLocation; }
+	else if (!count && glad_stats_real_glGetAttribLocation) { glad_glGetAttribLocation = glad_stats_real_glGetAttribLocation; glad_stats_real_glGetAttribLocation = 0; }
+	if (count && glad_glGetBooleani_v && glad_glGetBooleani_v != glad_stats_impl_glGetBooleani_v) { glad_stats_real_glGetBooleani_v = glad_glGetBooleani_v; glad_glGetBooleani_v = glad_stats_impl_glGetBooleani_v; }
+	else if (!count && glad_stats_real_glGetBooleani_v) { glad_glGetBooleani_v = glad_stats_real_glGetBooleani_v; glad_stats_real_glGetBooleani_v = 0; }
+	if (count && glad_glGetBooleanv && glad_glGetBooleanv != glad_stats_impl_glGetBooleanv) { glad_stats_real_glGetBooleanv = glad_glGetBooleanv; glad_glGetBooleanv = glad_stats_impl_glGetBooleanv; }
+	else if (!count && glad_stats_real_glGetBooleanv) { glad_glGetBooleanv = glad_stats_real_glGetBooleanv; glad_stats_real_glGetBooleanv = 0; }
+	if (count && glad_glGetBufferParameteri64v && glad_glGetBufferParameteri64v != glad_stats_impl_glGetBufferParameteri64v) { glad_stats_real_glGetBufferParameteri64v = glad_glGetBufferParameteri64v; glad_glGetBufferParameteri64v = glad_stats_impl_glGetBufferParameteri64v; }
+	else if (!count && glad_stats_real_glGetBufferParameteri64v) { glad_glGetBufferParameteri64v = glad_stats_real_glGetBufferParameteri64v; glad_stats_real_glGetBufferParameteri64v = 0; }
+	if (count && glad_glGetBufferParameteriv && glad_glGetBufferParameteriv != glad_stats_impl_glGetBufferParameteriv) { glad_stats_real_glGetBufferParameteriv = glad_glGetBufferParameteriv; glad_glGetBufferParameteriv = glad_stats_impl_glGetBufferParameteriv; }
+	else if (!count && glad_stats_real_glGetBufferParameteriv) { glad_glGetBufferParameteriv = glad_stats_real_glGetBufferParameteriv; glad_stats_real_glGetBufferParameteriv = 0; }
+	if (count && glad_glGetBufferPointerv && glad_glGetBufferPointerv != glad_stats_impl_glGetBufferPointerv) { glad_stats_real_glGetBufferPointerv = glad_glGetBufferPointerv; glad_glGetBufferPointerv = glad_stats_impl_glGetBufferPointerv; }
+	else if (!count && glad_stats_real_glGetBufferPointerv) { glad_glGetBufferPointerv = glad_stats_real_glGetBufferPointerv; glad_stats_real_glGetBufferPointerv = 0; }
+	if (count && glad_glGetBufferSubData && glad_glGetBufferSubData != glad_stats_impl_glGetBufferSubData) { glad_stats_real_glGetBufferSubData = glad_glGetBufferSubData; glad_glGetBufferSubData = glad_stats_impl_glGetBufferSubData; }
+	else if (!count && glad_stats_real_glGetBufferSubData) { glad_glGetBufferSubData = glad_stats_real_glGetBufferSubData; glad_stats_real_glGetBufferSubData = 0; }
+	if (count && glad_glGetClipPlane && glad_glGetClipPlane != glad_stats_impl_glGetClipPlane) { glad_stats_real_glGetClipPlane = glad_glGetClipPlane; glad_glGetClipPlane = glad_stats_impl_glGetClipPlane; }
+	else if (!count && glad_stats_real_glGetClipPlane) { glad_glGetClipPlane = glad_stats_real_glGetClipPlane; glad_stats_real_glGetClipPlane = 0; }
+	if (count && glad_glGetCompressedTexImage && glad_glGetCompressedTexImage != glad_stats_impl_glGetCompressedTexImage) { glad_stats_real_glGetCompressedTexImage = glad_glGetCompressedTexImage; glad_glGetCompressedTexImage = glad_stats_impl_glGetCompressedTexImage; }
+	else if (!count && glad_stats_real_glGetCompressedTexImage) { glad_glGetCompressedTexImage = glad_stats_real_glGetCompressedTexImage; glad_stats_real_glGetCompressedTexImage = 0; }
+	if (count && glad_glGetCompressedTextureImage && glad_glGetCompressedTextureImage != glad_stats_impl_glGetCompressedTextureImage) { glad_stats_real_glGetCompressedTextureImage = glad_glGetCompressedTextureImage; glad_glGetCompressedTextureImage = glad_stats_impl_glGetCompressedTextureImage; }
+	else if (!count && glad_stats_real_glGetCompressedTextureImage) { glad_glGetCompressedTextureImage = glad_stats_real_glGetCompressedTextureImage; glad_stats_real_glGetCompressedTextureImage = 0; }
+	if (count && glad_glGetCompressedTextureSubImage && glad_glGetCompressedTextureSubImage != glad_stats_impl_glGetCompressedTextureSubImage) { glad_stats_real_glGetCompressedTextureSubImage = glad_glGetCompressedTextureSubImage; glad_glGetCompressedTextureSubImage = glad_stats_impl_glGetCompressedTextureSubImage; }
+	else if (!count && glad_stats_real_glGetCompressedTextureSubImage) { glad_glGetCompressedTextureSubImage = glad_stats_real_glGetCompressedTextureSubImage; glad_stats_real_glGetCompressedTextureSubImage = 0; }
+	if (count && glad_glGetDebugMessageLog && glad_glGetDebugMessageLog != glad_stats_impl_glGetDebugMessageLog) { glad_stats_real_glGetDebugMessageLog = glad_glGetDebugMessageLog; glad_glGetDebugMessageLog = glad_stats_impl_glGetDebugMessageLog; }
+	else if (!count && glad_stats_real_glGetDebugMessageLog) { glad_glGetDebugMessageLog = glad_stats_real_glGetDebugMessageLog; glad_stats_real_glGetDebugMessageLog = 0; }
+	if (count && glad_glGetDoublei_v && glad_glGetDoublei_v != glad_stats_impl_glGetDoublei_v) { glad_stats_real_glGetDoublei_v = glad_glGetDoublei_v; glad_glGetDoublei_v = glad_stats_impl_glGetDoublei_v; }
+	else if (!count && glad_stats_real_glGetDoublei_v) { glad_glGetDoublei_v = glad_stats_real_glGetDoublei_v; glad_stats_real_glGetDoublei_v = 0; }
+	if (count && glad_glGetDoublev && glad_glGetDoublev != glad_stats_impl_glGetDoublev) { glad_stats_real_glGetDoublev = glad_glGetDoublev; glad_glGetDoublev = glad_stats_impl_glGetDoublev; }
+	else if (!count && glad_stats_real_glGetDoublev) { glad_glGetDoublev = glad_stats_real_glGetDoublev; glad_stats_real_glGetDoublev = 0; }
+	if (count && glad_glGetError && glad_glGetError != glad_stats_impl_glGetError) { glad_stats_real_glGetError = glad_glGetError; glad_glGetError = glad_stats_impl_glGetError; }
+	else if (!count && glad_stats_real_glGetError) { glad_glGetError = glad_stats_real_glGetError; glad_stats_real_glGetError = 0; }
+	if (count && glad_glGetFloati_v && glad_glGetFloati_v != glad_stats_impl_glGetFloati_v) { glad_stats_real_glGetFloati_v = glad_glGetFloati_v; glad_glGetFloati_v = glad_stats_impl_glGetFloati_v; }
+	else if (!count && glad_stats_real_glGetFloati_v) { glad_glGetFloati_v = glad_stats_real_glGetFloati_v; glad_stats_real_glGetFloati_v = 0; }
+	if (count && glad_glGetFloatv && glad_glGetFloatv != glad_stats_impl_glGetFloatv) { glad_stats_real_glGetFloatv = glad_glGetFloatv; glad_glGetFloatv = glad_stats_impl_glGetFloatv; }
+	else if (!count && glad_stats_real_glGetFloatv) { glad_glGetFloatv = glad_stats_real_glGetFloatv; glad_stats_real_glGetFloatv = 0; }
+	if (count && glad_glGetFragDataIndex && glad_glGetFragDataIndex != glad_stats_impl_glGetFragDataIndex) { glad_stats_real_glGetFragDataIndex = glad_glGetFragDataIndex; glad_glGetFragDataIndex = glad_stats_impl_glGetFragDataIndex; }
+	else if (!count && glad_stats_real_glGetFragDataIndex) { glad_glGetFragDataIndex = glad_stats_real_glGetFragDataIndex; glad_stats_real_glGetFragDataIndex = 0; }
+	if (count && glad_glGetFragDataLocation && glad_glGetFragDataLocation != glad_stats_impl_glGetFragDataLocation) { glad_stats_real_glGetFragDataLocation = glad_glGetFragDataLocation; glad_glGetFragDataLocation = glad_stats_impl_glGetFragDataLocation; }
+	else if (!count && glad_stats_real_glGetFragDataLocation) { glad_glGetFragDataLocation = glad_stats_real_glGetFragDataLocation; glad_stats_real_glGetFragDataLocation = 0; }
+	if (count && glad_glGetFramebufferAttachmentParameteriv && glad_glGetFramebufferAttachmentParameteriv != glad_stats_impl_glGetFramebufferAttachmentParameteriv) { glad_stats_real_glGetFramebufferAttachmentParameteriv = glad_glGetFramebufferAttachmentParameteriv; glad_glGetFramebufferAttachmentParameteriv = glad_stats_impl_glGetFramebufferAttachmentParameteriv; }
+	else if (!count && glad_stats_real_glGetFramebufferAttachmentParameteriv) { glad_glGetFramebufferAttachmentParameteriv = glad_stats_real_glGetFramebufferAttachmentParameteriv; glad_stats_real_glGetFramebufferAttachmentParameteriv = 0; }
+	if (count && glad_glGetFramebufferParameteriv && glad_glGetFramebufferParameteriv != glad_stats_impl_glGetFramebufferParameteriv) { glad_stats_real_glGetFramebufferParameteriv = glad_glGetFramebufferParameteriv; glad_glGetFramebufferParameteriv = glad_stats_impl_glGetFramebufferParameteriv; }
+	else if (!count && glad_stats_real_glGetFramebufferParameteriv) { glad_glGetFramebufferParameteriv = glad_stats_real_glGetFramebufferParameteriv; glad_stats_real_glGetFramebufferParameteriv = 0; }
+	if (count && glad_glGetGraphicsResetStatus && glad_glGetGraphicsResetStatus != glad_stats_impl_glGetGraphicsResetStatus) { glad_stats_real_glGetGraphicsResetStatus = glad_glGetGraphicsResetStatus; glad_glGetGraphicsResetStatus = glad_stats_impl_glGetGraphicsResetStatus; }
+	else if (!count && glad_stats_real_glGetGraphicsResetStatus) { glad_glGetGraphicsResetStatus = glad_stats_real_glGetGraphicsResetStatus; glad_stats_real_glGetGraphicsResetStatus = 0; }
+	if (count && glad_glGetImageHandleARB && glad_glGetImageHandleARB != glad_stats_impl_glGetImageHandleARB) { glad_stats_real_glGetImageHandleARB = glad_glGetImageHandleARB; glad_glGetImageHandleARB = glad_stats_impl_glGetImageHandleARB; }
+	else if (!count && glad_stats_real_glGetImageHandleARB) { glad_glGetImageHandleARB = glad_stats_real_glGetImageHandleARB; glad_stats_real_glGetImageHandleARB = 0; }
+	if (count && glad_glGetInteger64i_v && glad_glGetInteger64i_v != glad_stats_impl_glGetInteger64i_v) { glad_stats_real_glGetInteger64i_v = glad_glGetInteger64i_v; glad_glGetInteger64i_v = glad_stats_impl_glGetInteger64i_v; }
+	else if (!count && glad_stats_real_glGetInteger64i_v) { glad_glGetInteger64i_v = glad_stats_real_glGetInteger64i_v; glad_stats_real_glGetInteger64i_v = 0; }
+	if (count && glad_glGetInteger64v && glad_glGetInteger64v != glad_stats_impl_glGetInteger64v) { glad_stats_real_glGetInteger64v = glad_glGetInteger64v; glad_glGetInteger64v = glad_stats_impl_glGetInteger64v; }
+	else if (!count && glad_stats_real_glGetInteger64v) { glad_glGetInteger64v = glad_stats_real_glGetInteger64v; glad_stats_real_glGetInteger64v = 0; }
+	if (count && glad_glGetIntegeri_v && glad_glGetIntegeri_v != glad_stats_impl_glGetIntegeri_v) { glad_stats_real_glGetIntegeri_v = glad_glGetIntegeri_v; glad_glGetIntegeri_v = glad_stats_impl_glGetIntegeri_v; }
+	else if (!count && glad_stats_real_glGetIntegeri_v) { glad_glGetIntegeri_v = glad_stats_real_glGetIntegeri_v; glad_stats_real_glGetIntegeri_v = 0; }
+	if (count && glad_glGetIntegerv && glad_glGetIntegerv != glad_stats_impl_glGetIntegerv) { glad_stats_real_glGetIntegerv = glad_glGetIntegerv; glad_glGetIntegerv = glad_stats_impl_glGetIntegerv; }
+	else if (!count && glad_stats_real_glGetIntegerv) { glad_glGetIntegerv = glad_stats_real_glGetIntegerv; glad_stats_real_glGetIntegerv = 0; }
+	if (count && glad_glGetInternalformati64v && glad_glGetInternalformati64v != glad_stats_impl_glGetInternalformati64v) { glad_stats_real_glGetInternalformati64v = glad_glGetInternalformati64v; glad_glGetInternalformati64v = glad_stats_impl_glGetInternalformati64v; }
+	else if (!count && glad_stats_real_glGetInternalformati64v) { glad_glGetInternalformati64v = glad_stats_real_glGetInternalformati64v; glad_stats_real_glGetInternalformati64v = 0; }
+	if (count && glad_glGetInternalformativ && glad_glGetInternalformativ != glad_stats_impl_glGetInternalformativ) { glad_stats_real_glGetInternalformativ = glad_glGetInternalformativ; glad_glGetInternalformativ = glad_stats_impl_glGetInternalformativ; }
+	else if (!count && glad_stats_real_glGetInternalformativ) { glad_glGetInternalformativ = glad_stats_real_glGetInternalformativ; glad_stats_real_glGetInternalformativ = 0; }
+	if (count && glad_glGetLightfv && glad_glGetLightfv != glad_stats_impl_glGetLightfv) { glad_stats_real_glGetLightfv = glad_glGetLightfv; glad_glGetLightfv = glad_stats_impl_glGetLightfv; }
+	else if (!count && glad_stats_real_glGetLightfv) { glad_glGetLightfv = glad_stats_real_glGetLightfv; glad_stats_real_glGetLightfv = 0; }
+	if (count && glad_glGetLightiv && glad_glGetLightiv != glad_stats_impl_glGetLightiv) { glad_stats_real_glGetLightiv = glad_glGetLightiv; glad_glGetLightiv = glad_stats_impl_glGetLightiv; }
+	else if (!count && glad_stats_real_glGetLightiv) { glad_glGetLightiv = glad_stats_real_glGetLightiv; glad_stats_real_glGetLightiv = 0; }
+	if (count && glad_glGetMapdv && glad_glGetMapdv != glad_stats_impl_glGetMapdv) { glad_stats_real_glGetMapdv = glad_glGetMapdv; glad_glGetMapdv = glad_stats_impl_glGetMapdv; }
+	else if (!count && glad_stats_real_glGetMapdv) { glad_glGetMapdv = glad_stats_real_glGetMapdv; glad_stats_real_glGetMapdv = 0; }
+	if (count && glad_glGetMapfv && glad_glGetMapfv != glad_stats_impl_glGetMapfv) { glad_stats_real_glGetMapfv = glad_glGetMapfv; glad_glGetMapfv = glad_stats_impl_glGetMapfv; }
+	else if (!count && glad_stats_real_glGetMapfv) { glad_glGetMapfv = glad_stats_real_glGetMapfv; glad_stats_real_glGetMapfv = 0; }
+	if (count && glad_glGetMapiv && glad_glGetMapiv != glad_stats_impl_glGetMapiv) { glad_stats_real_glGetMapiv = glad_glGetMapiv; glad_glGetMapiv = glad_stats_impl_glGetMapiv; }
+	else if (!count && glad_stats_real_glGetMapiv) { glad_glGetMapiv = glad_stats_real_glGetMapiv; glad_stats_real_glGetMapiv = 0; }
+	if (count && glad_glGetMaterialfv && glad_glGetMaterialfv != glad_stats_impl_glGetMaterialfv) { glad_stats_real_glGetMaterialfv = glad_glGetMaterialfv; glad_glGetMaterialfv = glad_stats_impl_glGetMaterialfv; }
+	else if (!count && glad_stats_real_glGetMaterialfv) { glad_glGetMaterialfv = glad_stats_real_glGetMaterialfv; glad_stats_real_glGetMaterialfv = 0; }
+	if (count && glad_glGetMaterialiv && glad_glGetMaterialiv != glad_stats_impl_glGetMaterialiv) { glad_stats_real_glGetMaterialiv = glad_glGetMaterialiv; glad_glGetMaterialiv = glad_stats_impl_glGetMaterialiv; }
+	else if (!count && glad_stats_real_glGetMaterialiv) { glad_glGetMaterialiv = glad_stats_real_glGetMaterialiv; glad_stats_real_glGetMaterialiv = 0; }
+	if (count && glad_glGetMultisamplefv && glad_glGetMultisamplefv != glad_stats_impl_glGetMultisamplefv) { glad_stats_real_glGetMultisamplefv = glad_glGetMultisamplefv; glad_glGetMultisamplefv = glad_stats_impl_glGetMultisamplefv; }
+	else if (!count && glad_stats_real_glGetMultisamplefv) { glad_glGetMultisamplefv = glad_stats_real_glGetMultisamplefv; glad_stats_real_glGetMultisamplefv = 0; }
+	if (count && glad_glGetNamedBufferParameteri64v && glad_glGetNamedBufferParameteri64v != glad_stats_impl_glGetNamedBufferParameteri64v) { glad_stats_real_glGetNamedBufferParameteri64v = glad_glGetNamedBufferParameteri64v; glad_glGetNamedBufferParameteri64v = glad_stats_impl_glGetNamedBufferParameteri64v; }
+	else if (!count && glad_stats_real_glGetNamedBufferParameteri64v) { glad_glGetNamedBufferParameteri64v = glad_stats_real_glGetNamedBufferParameteri64v; glad_stats_real_glGetNamedBufferParameteri64v = 0; }
+	if (count && glad_glGetNamedBufferParameteriv && glad_glGetNamedBufferParameteriv != glad_stats_impl_glGetNamedBufferParameteriv) { glad_stats_real_glGetNamedBufferParameteriv = glad_glGetNamedBufferParameteriv; glad_glGetNamedBufferParameteriv = glad_stats_impl_glGetNamedBufferParameteriv; }
+	else if (!count && glad_stats_real_glGetNamedBufferParameteriv) { glad_glGetNamedBufferParameteriv = glad_stats_real_glGetNamedBufferParameteriv; glad_stats_real_glGetNamedBufferParameteriv = 0; }
+	if (count && glad_glGetNamedBufferPointerv && glad_glGetNamedBufferPointerv != glad_stats_impl_glGetNamedBufferPointerv) { glad_stats_real_glGetNamedBufferPointerv = glad_glGetNamedBufferPointerv; glad_glGetNamedBufferPointerv = glad_stats_impl_glGetNamedBufferPointerv; }
+	else if (!count && glad_stats_real_glGetNamedBufferPointerv) { glad_glGetNamedBufferPointerv = glad_stats_real_glGetNamedBufferPointerv; glad_stats_real_glGetNamedBufferPointerv = 0; }
+	if (count && glad_glGetNamedBufferSubData && glad_glGetNamedBufferSubData != glad_stats_impl_glGetNamedBufferSubData) { glad_stats_real_glGetNamedBufferSubData = glad_glGetNamedBufferSubData; glad_glGetNamedBufferSubData = glad_stats_impl_glGetNamedBufferSubData; }
+	else if (!count && glad_stats_real_glGetNamedBufferSubData) { glad_glGetNamedBufferSubData = glad_stats_real_glGetNamedBufferSubData; glad_stats_real_glGetNamedBufferSubData = 0; }
+	if (count && glad_glGetNamedFramebufferAttachmentParameteriv && glad_glGetNamedFramebufferAttachmentParameteriv != glad_stats_impl_glGetNamedFramebufferAttachmentParameteriv) { glad_stats_real_glGetNamedFramebufferAttachmentParameteriv = glad_glGetNamedFramebufferAttachmentParameteriv; glad_glGetNamedFramebufferAttachmentParameteriv = glad_stats_impl_glGetNamedFramebufferAttachmentParameteriv; }
+	else if (!count && glad_stats_real_glGetNamedFramebufferAttachmentParameteriv) { glad_glGetNamedFramebufferAttachmentParameteriv = glad_stats_real_glGetNamedFramebufferAttachmentParameteriv; glad_stats_real_glGetNamedFramebufferAttachmentParameteriv = 0; }
+	if (count && glad_glGetNamedFramebufferParameteriv && glad_glGetNamedFramebufferParameteriv != glad_stats_impl_glGetNamedFramebufferParameteriv) { glad_stats_real_glGetNamedFramebufferParameteriv = glad_glGetNamedFramebufferParameteriv; glad_glGetNamedFramebufferParameteriv = glad_stats_impl_glGetNamedFramebufferParameteriv; }
+	else if (!count && glad_stats_real_glGetNamedFramebufferParameteriv) { glad_glGetNamedFramebufferParameteriv = glad_stats_real_glGetNamedFramebufferParameteriv; glad_stats_real_glGetNamedFramebufferParameteriv = 0; }
+	if (count && glad_glGetNamedRenderbufferParameteriv && glad_glGetNamedRenderbufferParameteriv != glad_stats_impl_glGetNamedRenderbufferParameteriv) { glad_stats_real_glGetNamedRenderbufferParameteriv = glad_glGetNamedRenderbufferParameteriv; glad_glGetNamedRenderbufferParameteriv = glad_stats_impl_glGetNamedRenderbufferParameteriv; }
+	else if (!count && glad_stats_real_glGetNamedRenderbufferParameteriv) { glad_glGetNamedRenderbufferParameteriv = glad_stats_real_glGetNamedRenderbufferParameteriv; glad_stats_real_glGetNamedRenderbufferParameteriv = 0; }
+	if (count && glad_glGetObjectLabel && glad_glGetObjectLabel != glad_stats_impl_glGetObjectLabel) { glad_stats_real_glGetObjectLabel = glad_glGetObjectLabel; glad_glGetObjectLabel = glad_stats_impl_glGetObjectLabel; }
+	else if (!count && glad_stats_real_glGetObjectLabel) { glad_glGetObjectLabel = glad_stats_real_glGetObjectLabel; glad_stats_real_glGetObjectLabel = 0; }
+	if (count && glad_glGetObjectPtrLabel && glad_glGetObjectPtrLabel != glad_stats_impl_glGetObjectPtrLabel) { glad_stats_real_glGetObjectPtrLabel = glad_glGetObjectPtrLabel; glad_glGetObjectPtrLabel = glad_stats_impl_glGetObjectPtrLabel; }
+	else if (!count && glad_stats_real_glGetObjectPtrLabel) { glad_glGetObjectPtrLabel = glad_stats_real_glGetObjectPtrLabel; glad_stats_real_glGetObjectPtrLabel = 0; }
+	if (count && glad_glGetPixelMapfv && glad_glGetPixelMapfv != glad_stats_impl_glGetPixelMapfv) { glad_stats_real_glGetPixelMapfv = glad_glGetPixelMapfv; glad_glGetPixelMapfv = glad_stats_impl_glGetPixelMapfv; }
+	else if (!count && glad_stats_real_glGetPixelMapfv) { glad_glGetPixelMapfv = glad_stats_real_glGetPixelMapfv; glad_stats_real_glGetPixelMapfv = 0; }
+	if (count && glad_glGetPixelMapuiv && glad_glGetPixelMapuiv != glad_stats_impl_glGetPixelMapuiv) { glad_stats_real_glGetPixelMapuiv = glad_glGetPixelMapuiv; glad_glGetPixelMapuiv = glad_stats_impl_glGetPixelMapuiv; }
+	else if (!count && glad_stats_real_glGetPixelMapuiv) { glad_glGetPixelMapuiv = glad_stats_real_glGetPixelMapuiv; glad_stats_real_glGetPixelMapuiv = 0; }
+	if (count && glad_glGetPixelMapusv && glad_glGetPixelMapusv != glad_stats_impl_glGetPixelMapusv) { glad_stats_real_glGetPixelMapusv = glad_glGetPixelMapusv; glad_glGetPixelMapusv = glad_stats_impl_glGetPixelMapusv; }
+	else if (!count && glad_stats_real_glGetPixelMapusv) { glad_glGetPixelMapusv = glad_stats_real_glGetPixelMapusv; glad_stats_real_glGetPixelMapusv = 0; }
+	if (count && glad_glGetPointerv && glad_glGetPointerv != glad_stats_impl_glGetPointerv) { glad_stats_real_glGetPointerv = glad_glGetPointerv; glad_glGetPointerv = glad_stats_impl_glGetPointerv; }
+	else if (!count && glad_stats_real_glGetPointerv) { glad_glGetPointerv = glad_stats_real_glGetPointerv; glad_stats_real_glGetPointerv = 0; }
+	if (count && glad_glGetPolygonStipple && glad_glGetPolygonStipple != glad_stats_impl_glGetPolygonStipple) { glad_stats_real_glGetPolygonStipple = glad_glGetPolygonStipple; glad_glGetPolygonStipple = glad_stats_impl_glGetPolygonStipple; }
+	else if (!count && glad_stats_real_glGetPolygonStipple) { glad_glGetPolygonStipple = glad_stats_real_glGetPolygonStipple; glad_stats_real_glGetPolygonStipple = 0; }
+	if (count && glad_glGetProgramBinary && glad_glGetProgramBinary != glad_stats_impl_glGetProgramBinary) { glad_stats_real_glGetProgramBinary = glad_glGetProgramBinary; glad_glGetProgramBinary = glad_stats_impl_glGetProgramBinary; }
+	else if (!count && glad_stats_real_glGetProgramBinary) { glad_glGetProgramBinary = glad_stats_real_glGetProgramBinary; glad_stats_real_glGetProgramBinary = 0; }
+	if (count && glad_glGetProgramInfoLog && glad_glGetProgramInfoLog != glad_stats_impl_glGetProgramInfoLog) { glad_stats_real_glGetProgramInfoLog = glad_glGetProgramInfoLog; glad_glGetProgramInfoLog = glad_stats_impl_glGetProgramInfoLog; }
+	else if (!count && glad_stats_real_glGetProgramInfoLog) { glad_glGetProgramInfoLog = glad_stats_real_glGetProgramInfoLog; glad_stats_real_glGetProgramInfoLog = 0; }
+	if (count && glad_glGetProgramInterfaceiv && glad_glGetProgramInterfaceiv != glad_stats_impl_glGetProgramInterfaceiv) { glad_stats_real_glGetProgramInterfaceiv = glad_glGetProgramInterfaceiv; glad_glGetProgramInterfaceiv = glad_stats_impl_glGetProgramInterfaceiv; }
+	else if (!count && glad_stats_real_glGetProgramInterfaceiv) { glad_glGetProgramInterfaceiv = glad_stats_real_glGetProgramInterfaceiv; glad_stats_real_glGetProgramInterfaceiv = 0; }
+	if (count && glad_glGetProgramPipelineInfoLog && glad_glGetProgramPipelineInfoLog != glad_stats_impl_glGetProgramPipelineInfoLog) { glad_stats_real_glGetProgramPipelineInfoLog = glad_glGetProgramPipelineInfoLog; glad_glGetProgramPipelineInfoLog = glad_stats_impl_glGetProgramPipelineInfoLog; }
+	else if (!count && glad_stats_real_glGetProgramPipelineInfoLog) { glad_glGetProgramPipelineInfoLog = glad_stats_real_glGetProgramPipelineInfoLog; glad_stats_real_glGetProgramPipelineInfoLog = 0; }
+	if (count && glad_glGetProgramPipelineiv && glad_glGetProgramPipelineiv != glad_stats_impl_glGetProgramPipelineiv) { glad_stats_real_glGetProgramPipelineiv = glad_glGetProgramPipelineiv; glad_glGetProgramPipelineiv = glad_stats_impl_glGetProgramPipelineiv; }
+	else if (!count && glad_stats_real_glGetProgramPipelineiv) { glad_glGetProgramPipelineiv = glad_stats_real_glGetProgramPipelineiv; glad_stats_real_glGetProgramPipelineiv = 0; }
+	if (count && glad_glGetProgramResourceIndex && glad_glGetProgramResourceIndex != glad_stats_impl_glGetProgramResourceIndex) { glad_stats_real_glGetProgramResourceIndex = glad_glGetProgramResourceIndex; glad_glGetProgramResourceIndex = glad_stats_impl_glGetProgramResourceIndex; }
+	else if (!count && glad_stats_real_glGetProgramResourceIndex) { glad_glGetProgramResourceIndex = glad_stats_real_glGetProgramResourceIndex; glad_stats_real_glGetProgramResourceIndex = 0; }
+	if (count && glad_glGetProgramResourceLocation && glad_glGetProgramResourceLocation != glad_stats_impl_glGetProgramResourceLocation) { glad_stats_real_glGetProgramResourceLocation = glad_glGetProgramResourceLocation; glad_glGetProgramResourceLocation = glad_stats_impl_glGetProgramResourceLocation; }
+	else if (!count && glad_stats_real_glGetProgramResourceLocation) { glad_glGetProgramResourceLocation = glad_stats_real_glGetProgramResourceLocation; glad_stats_real_glGetProgramResourceLocation = 0; }
+	if (count && glad_glGetProgramResourceLocationIndex && glad_glGetProgramResourceLocationIndex != glad_stats_impl_glGetProgramResourceLocationIndex) { glad_stats_real_glGetProgramResourceLocationIndex = glad_glGetProgramResourceLocationIndex; glad_glGetProgramResourceLocationIndex = glad_stats_impl_glGetProgramResourceLocationIndex; }
+	else if (!count && glad_stats_real_glGetProgramResourceLocationIndex) { glad_glGetProgramResourceLocationIndex = glad_stats_real_glGetProgramResourceLocationIndex; glad_stats_real_glGetProgramResourceLocationIndex = 0; }
+	if (count && glad_glGetProgramResourceName && glad_glGetProgramResourceName != glad_stats_impl_glGetProgramResourceName) { glad_stats_real_glGetProgramResourceName = glad_glGetProgramResourceName; glad_glGetProgramResourceName = glad_stats_impl_glGetProgramResourceName; }
+	else if (!count && glad_stats_real_glGetProgramResourceName) { glad_glGetProgramResourceName = glad_stats_real_glGetProgramResourceName; glad_stats_real_glGetProgramResourceName = 0; }
+	if (count && glad_glGetProgramResourceiv && glad_glGetProgramResourceiv != glad_stats_impl_glGetProgramResourceiv) { glad_stats_real_glGetProgramResourceiv = glad_glGetProgramResourceiv; glad_glGetProgramResourceiv = glad_stats_impl_glGetProgramResourceiv; }
+	else if (!count && glad_stats_real_glGetProgramResourceiv) { glad_glGetProgramResourceiv = glad_stats_real_glGetProgramResourceiv; glad_stats_real_glGetProgramResourceiv = 0; }
+	if (count && glad_glGetProgramStageiv && glad_glGetProgramStageiv != glad_stats_impl_glGetProgramStageiv) { glad_stats_real_glGetProgramStageiv = glad_glGetProgramStageiv; glad_glGetProgramStageiv = glad_stats_impl_glGetProgramStageiv; }
+	else if (!count && glad_stats_real_glGetProgramStageiv) { glad_glGetProgramStageiv = glad_stats_real_glGetProgramStageiv; glad_stats_real_glGetProgramStageiv = 0; }
+	if (count && glad_glGetProgramiv && glad_glGetProgramiv != glad_stats_impl_glGetProgramiv) { glad_stats_real_glGetProgramiv = glad_glGetProgramiv; glad_glGetProgramiv = glad_stats_impl_glGetProgramiv; }
+	else if (!count && glad_stats_real_glGetProgramiv) { glad_glGetProgramiv = glad_stats_real_glGetProgramiv; glad_stats_real_glGetProgramiv = 0; }
+	if (count && glad_glGetQueryBufferObjecti64v && glad_glGetQueryBufferObjecti64v != glad_stats_impl_glGetQueryBufferObjecti64v) { glad_stats_real_glGetQueryBufferObjecti64v = glad_glGetQueryBufferObjecti64v; glad_glGetQueryBufferObjecti64v = glad_stats_impl_glGetQueryBufferObjecti64v; }
+	else if (!count && glad_stats_real_glGetQueryBufferObjecti64v) { glad_glGetQueryBufferObjecti64v = glad_stats_real_glGetQueryBufferObjecti64v; glad_stats_real_glGetQueryBufferObjecti64v = 0; }
+	if (count && glad_glGetQueryBufferObjectiv && glad_glGetQueryBufferObjectiv != glad_stats_impl_glGetQueryBufferObjectiv) { glad_stats_real_glGetQueryBufferObjectiv = glad_glGetQueryBufferObjectiv; glad_glGetQueryBufferObjectiv = glad_stats_impl_glGetQueryBufferObjectiv; }
+	else if (!count && glad_stats_real_glGetQueryBufferObjectiv) { glad_glGetQueryBufferObjectiv = glad_stats_real_glGetQueryBufferObjectiv; glad_stats_real_glGetQueryBufferObjectiv = 0; }
+	if (count && glad_glGetQueryBufferObjectui64v && glad_glGetQueryBufferObjectui64v != glad_stats_impl_glGetQueryBufferObjectui64v) { glad_stats_real_glGetQueryBufferObjectui64v = glad_glGetQueryBufferObjectui64v; glad_glGetQueryBufferObjectui64v = glad_stats_impl_glGetQueryBufferObjectui64v; }
+	else if (!count && glad_stats_real_glGetQueryBufferObjectui64v) { glad_glGetQueryBufferObjectui64v = glad_stats_real_glGetQueryBufferObjectui64v; glad_stats_real_glGetQueryBufferObjectui64v = 0; }
+	if (count && glad_glGetQueryBufferObjectuiv && glad_glGetQueryBufferObjectuiv != glad_stats_impl_glGetQueryBufferObjectuiv) { glad_stats_real_glGetQueryBufferObjectuiv = glad_glGetQueryBufferObjectuiv; glad_glGetQueryBufferObjectuiv = glad_stats_impl_glGetQueryBufferObjectuiv; }
+	else if (!count && glad_stats_real_glGetQueryBufferObjectuiv) { glad_glGetQueryBufferObjectuiv = glad_stats_real_glGetQueryBufferObjectuiv; glad_stats_real_glGetQueryBufferObjectuiv = 0; }
+	if (count && glad_glGetQueryIndexediv && glad_glGetQueryIndexediv != glad_stats_impl_glGetQueryIndexediv) { glad_stats_real_glGetQueryIndexediv = glad_glGetQueryIndexediv; glad_glGetQueryIndexediv = glad_stats_impl_glGetQueryIndexediv; }
+	else if (!count && glad_stats_real_glGetQueryIndexediv) { glad_glGetQueryIndexediv = glad_stats_real_glGetQueryIndexediv; glad_stats_real_glGetQueryIndexediv = 0; }
+	if (count && glad_glGetQueryObjecti64v && glad_glGetQueryObjecti64v != glad_stats_impl_glGetQueryObjecti64v) { glad_stats_real_glGetQueryObjecti64v = glad_glGetQueryObjecti64v; glad_glGetQueryObjecti64v = glad_stats_impl_glGetQueryObjecti64v; }
+	else if (!count && glad_stats_real_glGetQueryObjecti64v) { glad_glGetQueryObjecti64v = glad_stats_real_glGetQueryObjecti64v; glad_stats_real_glGetQueryObjecti64v = 0; }
+	if (count && glad_glGetQueryObjectiv && glad_glGetQueryObjectiv != glad_stats_impl_glGetQueryObjectiv) { glad_stats_real_glGetQueryObjectiv = glad_glGetQueryObjectiv; glad_glGetQueryObjectiv = glad_stats_impl_glGetQueryObjectiv; }
+	else if (!count && glad_stats_real_glGetQueryObjectiv) { glad_glGetQueryObjectiv = glad_stats_real_glGetQueryObjectiv; glad_stats_real_glGetQueryObjectiv = 0; }
+	if (count && glad_glGetQueryObjectui64v && glad_glGetQueryObjectui64v != glad_stats_impl_glGetQueryObjectui64v) { glad_stats_real_glGetQueryObjectui64v = glad_glGetQueryObjectui64v; glad_glGetQueryObjectui64v = glad_stats_impl_glGetQueryObjectui64v; }
+	else if (!count && glad_stats_real_glGetQueryObjectui64v) { glad_glGetQueryObjectui64v = glad_stats_real_glGetQueryObjectui64v; glad_stats_real_glGetQueryObjectui64v = 0; }
+	if (count && glad_glGetQueryObjectuiv && glad_glGetQueryObjectuiv != glad_stats_impl_glGetQueryObjectuiv) { glad_stats_real_glGetQueryObjectuiv = glad_glGetQueryObjectuiv; glad_glGetQueryObjectuiv = glad_stats_impl_glGetQueryObjectuiv; }
+	else if (!count && glad_stats_real_glGetQueryObjectuiv) { glad_glGetQueryObjectuiv = glad_stats_real_glGetQueryObjectuiv; glad_stats_real_glGetQueryObjectuiv = 0; }
+	if (count && glad_glGetQueryiv && glad_glGetQueryiv != glad_stats_impl_glGetQueryiv) { glad_stats_real_glGetQueryiv = glad_glGetQueryiv; glad_glGetQueryiv = glad_stats_impl_glGetQueryiv; }
+	else if (!count && glad_stats_real_glGetQueryiv) { glad_glGetQueryiv = glad_stats_real_glGetQueryiv; glad_stats_real_glGetQueryiv = 0; }
+	if (count && glad_glGetRenderbufferParameteriv && glad_glGetRenderbufferParameteriv != glad_stats_impl_glGetRenderbufferParameteriv) { glad_stats_real_glGetRenderbufferParameteriv = glad_glGetRenderbufferParameteriv; glad_glGetRenderbufferParameteriv = glad_stats_impl_glGetRenderbufferParameteriv; }
+	else if (!count && glad_stats_real_glGetRenderbufferParameteriv) { glad_glGetRenderbufferParameteriv = glad_stats_real_glGetRenderbufferParameteriv; glad_stats_real_glGetRenderbufferParameteriv = 0; }
+	if (count && glad_glGetSamplerParameterIiv && glad_glGetSamplerParameterIiv != glad_stats_impl_glGetSamplerParameterIiv) { glad_stats_real_glGetSamplerParameterIiv = glad_glGetSamplerParameterIiv; glad_glGetSamplerParameterIiv = glad_stats_impl_glGetSamplerParameterIiv; }
+	else if (!count && glad_stats_real_glGetSamplerParameterIiv) { glad_glGetSamplerParameterIiv = glad_stats_real_glGetSamplerParameterIiv; glad_stats_real_glGetSamplerParameterIiv = 0; }
+	if (count && glad_glGetSamplerParameterIuiv && glad_glGetSamplerParameterIuiv != glad_stats_impl_glGetSamplerParameterIuiv) { glad_stats_real_glGetSamplerParameterIuiv = glad_glGetSamplerParameterIuiv; glad_glGetSamplerParameterIuiv = glad_stats_impl_glGetSamplerParameterIuiv; }
+	else if (!count && glad_stats_real_glGetSamplerParameterIuiv) { glad_glGetSamplerParameterIuiv = glad_stats_real_glGetSamplerParameterIuiv; glad_stats_real_glGetSamplerParameterIuiv = 0; }
+	if (count && glad_glGetSamplerParameterfv && glad_glGetSamplerParameterfv != glad_stats_impl_glGetSamplerParameterfv) { glad_stats_real_glGetSamplerParameterfv = glad_glGetSamplerParameterfv; glad_glGetSamplerParameterfv = glad_stats_impl_glGetSamplerParameterfv; }
+	else if (!count && glad_stats_real_glGetSamplerParameterfv) { glad_glGetSamplerParameterfv = glad_stats_real_glGetSamplerParameterfv; glad_stats_real_glGetSamplerParameterfv = 0; }
+	if (count && glad_glGetSamplerParameteriv && glad_glGetSamplerParameteriv != glad_stats_impl_glGetSamplerParameteriv) { glad_stats_real_glGetSamplerParameteriv = glad_glGetSamplerParameteriv; glad_glGetSamplerParameteriv = glad_stats_impl_glGetSamplerParameteriv; }
+	else if (!count && glad_stats_real_glGetSamplerParameteriv) { glad_glGetSamplerParameteriv = glad_stats_real_glGetSamplerParameteriv; glad_stats_real_glGetSamplerParameteriv = 0; }
+	if (count && glad_glGetShaderInfoLog && glad_glGetShaderInfoLog != glad_stats_impl_glGetShaderInfoLog) { glad_stats_real_glGetShaderInfoLog = glad_glGetShaderInfoLog; glad_glGetShaderInfoLog = glad_stats_impl_glGetShaderInfoLog; }
+	else if (!count && glad_stats_real_glGetShaderInfoLog) { glad_glGetShaderInfoLog = glad_stats_real_glGetShaderInfoLog; glad_stats_real_glGetShaderInfoLog = 0; }
+	if (count && glad_glGetShaderPrecisionFormat && glad_glGetShaderPrecisionFormat != glad_stats_impl_glGetShaderPrecisionFormat) { glad_stats_real_glGetShaderPrecisionFormat = glad_glGetShaderPrecisionFormat; glad_glGetShaderPrecisionFormat = glad_stats_impl_glGetShaderPrecisionFormat; }
+	else if (!count && glad_stats_real_glGetShaderPrecisionFormat) { glad_glGetShaderPrecisionFormat = glad_stats_real_glGetShaderPrecisionFormat; glad_stats_real_glGetShaderPrecisionFormat = 0; }
+	if (count && glad_glGetShaderSource && glad_glGetShaderSource != glad_stats_impl_glGetShaderSource) { glad_stats_real_glGetShaderSource = glad_glGetShaderSource; glad_glGetShaderSource = glad_stats_impl_glGetShaderSource; }
+	else if (!count && glad_stats_real_glGetShaderSource) { glad_glGetShaderSource = glad_stats_real_glGetShaderSource; glad_stats_real_glGetShaderSource = 0; }
+	if (count && glad_glGetShaderiv && glad_glGetShaderiv != glad_stats_impl_glGetShaderiv) { glad_stats_real_glGetShaderiv = glad_glGetShaderiv; glad_glGetShaderiv = glad_stats_impl_glGetShaderiv; }
+	else if (!count && glad_stats_real_glGetShaderiv) { glad_glGetShaderiv = glad_stats_real_glGetShaderiv; glad_stats_real_glGetShaderiv = 0; }
+	if (count && glad_glGetString && glad_glGetString != glad_stats_impl_glGetString) { glad_stats_real_glGetString = glad_glGetString; glad_glGetString = glad_stats_impl_glGetString; }
+	else if (!count && glad_stats_real_glGetString) { glad_glGetString = glad_stats_real_glGetString; glad_stats_real_glGetString = 0; }
+	if (count && glad_glGetStringi && glad_glGetStringi != glad_stats_impl_glGetStringi) { glad_stats_real_glGetStringi = glad_glGetStringi; glad_glGetStringi = glad_stats_impl_glGetStringi; }
+	else if (!count && glad_stats_real_glGetStringi) { glad_glGetStringi = glad_stats_real_glGetStringi; glad_stats_real_glGetStringi = 0; }
+	if (count && glad_glGetSubroutineIndex && glad_glGetSubroutineIndex != glad_stats_impl_glGetSubroutineIndex) { glad_stats_real_glGetSubroutineIndex = glad_glGetSubroutineIndex; glad_glGetSubroutineIndex = glad_stats_impl_glGetSubroutineIndex; }
+	else if (!count && glad_stats_real_glGetSubroutineIndex) { glad_glGetSubroutineIndex = glad_stats_real_glGetSubroutineIndex; glad_stats_real_glGetSubroutineIndex = 0; }
+	if (count && glad_glGetSubroutineUniformLocation && glad_glGetSubroutineUniformLocation != glad_stats_impl_glGetSubroutineUniformLocation) { glad_stats_real_glGetSubroutineUniformLocation = glad_glGetSubroutineUniformLocation; glad_glGetSubroutineUniformLocation = glad_stats_impl_glGetSubroutineUniformLocation; }
+	else if (!count && glad_stats_real_glGetSubroutineUniformLocation) { glad_glGetSubroutineUniformLocation = glad_stats_real_glGetSubroutineUniformLocation; glad_stats_real_glGetSubroutineUniformLocation = 0; }
+	if (count && glad_glGetSynciv && glad_glGetSynciv != glad_stats_impl_glGetSynciv) { glad_stats_real_glGetSynciv = glad_glGetSynciv; glad_glGetSynciv = glad_stats_impl_glGetSynciv; }
+	else if (!count && glad_stats_real_glGetSynciv) { glad_glGetSynciv = glad_stats_real_glGetSynciv; glad_stats_real_glGetSynciv = 0; }
+	if (count && glad_glGetTexEnvfv && glad_glGetTexEnvfv != glad_stats_impl_glGetTexEnvfv) { glad_stats_real_glGetTexEnvfv = glad_glGetTexEnvfv; glad_glGetTexEnvfv = glad_stats_impl_glGetTexEnvfv; }
+	else if (!count && glad_stats_real_glGetTexEnvfv) { glad_glGetTexEnvfv = glad_stats_real_glGetTexEnvfv; glad_stats_real_glGetTexEnvfv = 0; }
+	if (count && glad_glGetTexEnviv && glad_glGetTexEnviv != glad_stats_impl_glGetTexEnviv) { glad_stats_real_glGetTexEnviv = glad_glGetTexEnviv; glad_glGetTexEnviv = glad_stats_impl_glGetTexEnviv; }
+	else if (!count && glad_stats_real_glGetTexEnviv) { glad_glGetTexEnviv = glad_stats_real_glGetTexEnviv; glad_stats_real_glGetTexEnviv = 0; }
+	if (count && glad_glGetTexGendv && glad_glGetTexGendv != glad_stats_impl_glGetTexGendv) { glad_stats_real_glGetTexGendv = glad_glGetTexGendv; glad_glGetTexGendv = glad_stats_impl_glGetTexGendv; }
+	else if (!count && glad_stats_real_glGetTexGendv) { glad_glGetTexGendv = glad_stats_real_glGetTexGendv; glad_stats_real_glGetTexGendv = 0; }
+	if (count && glad_glGetTexGenfv && glad_glGetTexGenfv != glad_stats_impl_glGetTexGenfv) { glad_stats_real_glGetTexGenfv = glad_glGetTexGenfv; glad_glGetTexGenfv = glad_stats_impl_glGetTexGenfv; }
+	else if (!count && glad_stats_real_glGetTexGenfv) { glad_glGetTexGenfv = glad_stats_real_glGetTexGenfv; glad_stats_real_glGetTexGenfv = 0; }
+	if (count && glad_glGetTexGeniv && glad_glGetTexGeniv != glad_stats_impl_glGetTexGeniv) { glad_stats_real_glGetTexGeniv = glad_glGetTexGeniv; glad_glGetTexGeniv = glad_stats_impl_glGetTexGeniv; }
+	else if (!count && glad_stats_real_glGetTexGeniv) { glad_glGetTexGeniv = glad_stats_real_glGetTexGeniv; glad_stats_real_glGetTexGeniv = 0; }
+	if (count && glad_glGetTexImage && glad_glGetTexImage != glad_stats_impl_glGetTexImage) { glad_stats_real_glGetTexImage = glad_glGetTexImage; glad_glGetTexImage = glad_stats_impl_glGetTexImage; }
+	else if (!count && glad_stats_real_glGetTexImage) { glad_glGetTexImage = glad_stats_real_glGetTexImage; glad_stats_real_glGetTexImage = 0; }
+	if (count && glad_glGetTexLevelParameterfv && glad_glGetTexLevelParameterfv != glad_stats_impl_glGetTexLevelParameterfv) { glad_stats_real_glGetTexLevelParameterfv = glad_glGetTexLevelParameterfv; glad_glGetTexLevelParameterfv = glad_stats_impl_glGetTexLevelParameterfv; }
+	else if (!count && glad_stats_real_glGetTexLevelParameterfv) { glad_glGetTexLevelParameterfv = glad_stats_real_glGetTexLevelParameterfv; glad_stats_real_glGetTexLevelParameterfv = 0; }
+	if (count && glad_glGetTexLevelParameteriv && glad_glGetTexLevelParameteriv != glad_stats_impl_glGetTexLevelParameteriv) { glad_stats_real_glGetTexLevelParameteriv = glad_glGetTexLevelParameteriv; glad_glGetTexLevelParameteriv = glad_stats_impl_glGetTexLevelParameteriv; }
+	else if (!count && glad_stats_real_glGetTexLevelParameteriv) { glad_glGetTexLevelParameteriv = glad_stats_real_glGetTexLevelParameteriv; glad_stats_real_glGetTexLevelParameteriv = 0; }
+	if (count && glad_glGetTexParameterIiv && glad_glGetTexParameterIiv != glad_stats_impl_glGetTexParameterIiv) { glad_stats_real_glGetTexParameterIiv = glad_glGetTexParameterIiv; glad_glGetTexParameterIiv = glad_stats_impl_glGetTexParameterIiv; }
+	else if (!count && glad_stats_real_glGetTexParameterIiv) { glad_glGetTexParameterIiv = glad_stats_real_glGetTexParameterIiv; glad_stats_real_glGetTexParameterIiv = 0; }
+	if (count && glad_glGetTexParameterIuiv && glad_glGetTexParameterIuiv != glad_stats_impl_glGetTexParameterIuiv) { glad_stats_real_glGetTexParameterIuiv = glad_glGetTexParameterIuiv; glad_glGetTexParameterIuiv = glad_stats_impl_glGetTexParameterIuiv; }
+	else if (!count && glad_stats_real_glGetTexParameterIuiv) { glad_glGetTexParameterIuiv = glad_stats_real_glGetTexParameterIuiv; glad_stats_real_glGetTexParameterIuiv = 0; }
+	if (count && glad_glGetTexParameterfv && glad_glGetTexParameterfv != glad_stats_impl_glGetTexParameterfv) { glad_stats_real_glGetTexParameterfv = glad_glGetTexParameterfv; glad_glGetTexParameterfv = glad_stats_impl_glGetTexParameterfv; }
+	else if (!count && glad_stats_real_glGetTexParameterfv) { glad_glGetTexParameterfv = glad_stats_real_glGetTexParameterfv; glad_stats_real_glGetTexParameterfv = 0; }
+	if (count && glad_glGetTexParameteriv && glad_glGetTexParameteriv != glad_stats_impl_glGetTexParameteriv) { glad_stats_real_glGetTexParameteriv = glad_glGetTexParameteriv; glad_glGetTexParameteriv = glad_stats_impl_glGetTexParameteriv; }
+	else if (!count && glad_stats_real_glGetTexParameteriv) { glad_glGetTexParameteriv = glad_stats_real_glGetTexParameteriv; glad_stats_real_glGetTexParameteriv = 0; }
+	if (count && glad_glGetTextureHandleARB && glad_glGetTextureHandleARB != glad_stats_impl_glGetTextureHandleARB) { glad_stats_real_glGetTextureHandleARB = glad_glGetTextureHandleARB; glad_glGetTextureHandleARB = glad_stats_impl_glGetTextureHandleARB; }
+	else if (!count && glad_stats_real_glGetTextureHandleARB) { glad_glGetTextureHandleARB = glad_stats_real_glGetTextureHandleARB; glad_stats_real_glGetTextureHandleARB = 0; }
+	if (count && glad_glGetTextureImage && glad_glGetTextureImage != glad_stats_impl_glGetTextureImage) { glad_stats_real_glGetTextureImage = glad_glGetTextureImage; glad_glGetTextureImage = glad_stats_impl_glGetTextureImage; }
+	else if (!count && glad_stats_real_glGetTextureImage) { glad_glGetTextureImage = glad_stats_real_glGetTextureImage; glad_stats_real_glGetTextureImage = 0; }
+	if (count && glad_glGetTextureLevelParameterfv && glad_glGetTextureLevelParameterfv != glad_stats_impl_glGetTextureLevelParameterfv) { glad_stats_real_glGetTextureLevelParameterfv = glad_glGetTextureLevelParameterfv; glad_glGetTextureLevelParameterfv = glad_stats_impl_glGetTextureLevelParameterfv; }
+	else if (!count && glad_stats_real_glGetTextureLevelParameterfv) { glad_glGetTextureLevelParameterfv = glad_stats_real_glGetTextureLevelParameterfv; glad_stats_real_glGetTextureLevelParameterfv = 0; }
+	if (count && glad_glGetTextureLevelParameteriv && glad_glGetTextureLevelParameteriv != glad_stats_impl_glGetTextureLevelParameteriv) { glad_stats_real_glGetTextureLevelParameteriv = glad_glGetTextureLevelParameteriv; glad_glGetTextureLevelParameteriv = glad_stats_impl_glGetTextureLevelParameteriv; }
+	else if (!count && glad_stats_real_glGetTextureLevelParameteriv) { glad_glGetTextureLevelParameteriv = glad_stats_real_glGetTextureLevelParameteriv; glad_stats_real_glGetTextureLevelParameteriv = 0; }
+	if (count && glad_glGetTextureParameterIiv && glad_glGetTextureParameterIiv != glad_stats_impl_glGetTextureParameterIiv) { glad_stats_real_glGetTextureParameterIiv = glad_glGetTextureParameterIiv; glad_glGetTextureParameterIiv = glad_stats_impl_glGetTextureParameterIiv; }
+	else if (!count && glad_stats_real_glGetTextureParameterIiv) { glad_glGetTextureParameterIiv = glad_stats_real_glGetTextureParameterIiv; glad_stats_real_glGetTextureParameterIiv = 0; }
+	if (count && glad_glGetTextureParameterIuiv && glad_glGetTextureParameterIuiv != glad_stats_impl_glGetTextureParameterIuiv) { glad_stats_real_glGetTextureParameterIuiv = glad_glGetTextureParameterIuiv; glad_glGetTextureParameterIuiv = glad_stats_impl_glGetTextureParameterIuiv; }
+	else if (!count && glad_stats_real_glGetTextureParameterIuiv) { glad_glGetTextureParameterIuiv = glad_stats_real_glGetTextureParameterIuiv; glad_stats_real_glGetTextureParameterIuiv = 0; }
+	if (count && glad_glGetTextureParameterfv && glad_glGetTextureParameterfv != glad_stats_impl_glGetTextureParameterfv) { glad_stats_real_glGetTextureParameterfv = glad_glGetTextureParameterfv; glad_glGetTextureParameterfv = glad_stats_impl_glGetTextureParameterfv; }
+	else if (!count && glad_stats_real_glGetTextureParameterfv) { glad_glGetTextureParameterfv = glad_stats_real_glGetTextureParameterfv; glad_stats_real_glGetTextureParameterfv = 0; }
+	if (count && glad_glGetTextureParameteriv && glad_glGetTextureParameteriv != glad_stats_impl_glGetTextureParameteriv) { glad_stats_real_glGetTextureParameteriv = glad_glGetTextureParameteriv; glad_glGetTextureParameteriv = glad_stats_impl_glGetTextureParameteriv; }
+	else if (!count && glad_stats_real_glGetTextureParameteriv) { glad_glGetTextureParameteriv = glad_stats_real_glGetTextureParameteriv; glad_stats_real_glGetTextureParameteriv = 0; }
+	if (count && glad_glGetTextureSamplerHandleARB && glad_glGetTextureSamplerHandleARB != glad_stats_impl_glGetTextureSamplerHandleARB) { glad_stats_real_glGetTextureSamplerHandleARB = glad_glGetTextureSamplerHandleARB; glad_glGetTextureSamplerHandleARB = glad_stats_impl_glGetTextureSamplerHandleARB; }
+	else if (!count && glad_stats_real_glGetTextureSamplerHandleARB) { glad_glGetTextureSamplerHandleARB = glad_stats_real_glGetTextureSamplerHandleARB; glad_stats_real_glGetTextureSamplerHandleARB = 0; }
+	if (count && glad_glGetTextureSubImage && glad_glGetTextureSubImage != glad_stats_impl_glGetTextureSubImage) { glad_stats_real_glGetTextureSubImage = glad_glGetTextureSubImage; glad_glGetTextureSubImage = glad_stats_impl_glGetTextureSubImage; }
+	else if (!count && glad_stats_real_glGetTextureSubImage) { glad_glGetTextureSubImage = glad_stats_real_glGetTextureSubImage; glad_stats_real_glGetTextureSubImage = 0; }
+	if (count && glad_glGetTransformFeedbackVarying && glad_glGetTransformFeedbackVarying != glad_stats_impl_glGetTransformFeedbackVarying) { glad_stats_real_glGetTransformFeedbackVarying = glad_glGetTransformFeedbackVarying; glad_glGetTransformFeedbackVarying = glad_stats_impl_glGetTransformFeedbackVarying; }
+	else if (!count && glad_stats_real_glGetTransformFeedbackVarying) { glad_glGetTransformFeedbackVarying = glad_stats_real_glGetTransformFeedbackVarying; glad_stats_real_glGetTransformFeedbackVarying = 0; }
+	if (count && glad_glGetTransformFeedbacki64_v && glad_glGetTransformFeedbacki64_v != glad_stats_impl_glGetTransformFeedbacki64_v) { glad_stats_real_glGetTransformFeedbacki64_v = glad_glGetTransformFeedbacki64_v; glad_glGetTransformFeedbacki64_v = glad_stats_impl_glGetTransformFeedbacki64_v; }
+	else if (!count && glad_stats_real_glGetTransformFeedbacki64_v) { glad_glGetTransformFeedbacki64_v = glad_stats_real_glGetTransformFeedbacki64_v; glad_stats_real_glGetTransformFeedbacki64_v = 0; }
+	if (count && glad_glGetTransformFeedbacki_v && glad_glGetTransformFeedbacki_v != glad_stats_impl_glGetTransformFeedbacki_v) { glad_stats_real_glGetTransformFeedbacki_v = glad_glGetTransformFeedbacki_v; glad_glGetTransformFeedbacki_v = glad_stats_impl_glGetTransformFeedbacki_v; }
+	else if (!count && glad_stats_real_glGetTransformFeedbacki_v) { glad_glGetTransformFeedbacki_v = glad_stats_real_glGetTransformFeedbacki_v; glad_stats_real_glGetTransformFeedbacki_v = 0; }
+	if (count && glad_glGetTransformFeedbackiv && glad_glGetTransformFeedbackiv != glad_stats_impl_glGetTransformFeedbackiv) { glad_stats_real_glGetTransformFeedbackiv = glad_glGetTransformFeedbackiv; glad_glGetTransformFeedbackiv = glad_stats_impl_glGetTransformFeedbackiv; }
+	else if (!count && glad_stats_real_glGetTransformFeedbackiv) { glad_glGetTransformFeedbackiv = glad_stats_real_glGetTransformFeedbackiv; glad_stats_real_glGetTransformFeedbackiv = 0; }
+	if (count && glad_glGetUniformBlockIndex && glad_glGetUniformBlockIndex != glad_stats_impl_glGetUniformBlockIndex) { glad_stats_real_glGetUniformBlockIndex = glad_glGetUniformBlockIndex; glad_glGetUniformBlockIndex = glad_stats_impl_glGetUniformBlockIndex; }
+	else if (!count && glad_stats_real_glGetUniformBlockIndex) { glad_glGetUniformBlockIndex = glad_stats_real_glGetUniformBlockIndex; glad_stats_real_glGetUniformBlockIndex = 0; }
+	if (count && glad_glGetUniformIndices && glad_glGetUniformIndices != glad_stats_impl_glGetUniformIndices) { glad_stats_real_glGetUniformIndices = glad_glGetUniformIndices; glad_glGetUniformIndices = glad_stats_impl_glGetUniformIndices; }
+	else if (!count && glad_stats_real_glGetUniformIndices) { glad_glGetUniformIndices = glad_stats_real_glGetUniformIndices; glad_stats_real_glGetUniformIndices = 0; }
+	if (count && glad_glGetUniformLocation && glad_glGetUniformLocation != glad_stats_impl_glGetUniformLocation) { glad_stats_real_glGetUniformLocation = glad_glGetUniformLocation; glad_glGetUniformLocation = glad_stats_impl_glGetUniformLocation; }
+	else if (!count && glad_stats_real_glGetUniformLocation) { glad_glGetUniformLocation = glad_stats_real_glGetUniformLocation; glad_stats_real_glGetUniformLocation = 0; }
+	if (count && glad_glGetUniformSubroutineuiv && glad_glGetUniformSubroutineuiv != glad_stats_impl_glGetUniformSubroutineuiv) { glad_stats_real_glGetUniformSubroutineuiv = glad_glGetUniformSubroutineuiv; glad_glGetUniformSubroutineuiv = glad_stats_impl_glGetUniformSubroutineuiv; }
+	else if (!count && glad_stats_real_glGetUniformSubroutineuiv) { glad_glGetUniformSubroutineuiv = glad_stats_real_glGetUniformSubroutineuiv; glad_stats_real_glGetUniformSubroutineuiv = 0; }
+	if (count && glad_glGetUniformdv && glad_glGetUniformdv != glad_stats_impl_glGetUniformdv) { glad_stats_real_glGetUniformdv = glad_glGetUniformdv; glad_glGetUniformdv = glad_stats_impl_glGetUniformdv; }
+	else if (!count && glad_stats_real_glGetUniformdv) { glad_glGetUniformdv = glad_stats_real_glGetUniformdv; glad_stats_real_glGetUniformdv = 0; }
+	if (count && glad_glGetUniformfv && glad_glGetUniformfv != glad_stats_impl_glGetUniformfv) { glad_stats_real_glGetUniformfv = glad_glGetUniformfv; glad_glGetUniformfv = glad_stats_impl_glGetUniformfv; }
+	else if (!count && glad_stats_real_glGetUniformfv) { glad_glGetUniformfv = glad_stats_real_glGetUniformfv; glad_stats_real_glGetUniformfv = 0; }
+	if (count && glad_glGetUniformiv && glad_glGetUniformiv != glad_stats_impl_glGetUniformiv) { glad_stats_real_glGetUniformiv = glad_glGetUniformiv; glad_glGetUniformiv = glad_stats_impl_glGetUniformiv; }
+	else if (!count && glad_stats_real_glGetUniformiv) { glad_glGetUniformiv = glad_stats_real_glGetUniformiv; glad_stats_real_glGetUniformiv = 0; }
+	if (count && glad_glGetUniformuiv && glad_glGetUniformuiv != glad_stats_impl_glGetUniformuiv) { glad_stats_real_glGetUniformuiv = glad_glGetUniformuiv; glad_glGetUniformuiv = glad_stats_impl_glGetUniformuiv; }
+	else if (!count && glad_stats_real_glGetUniformuiv) { glad_glGetUniformuiv = glad_stats_real_glGetUniformuiv; glad_stats_real_glGetUniformuiv = 0; }
+	if (count && glad_glGetVertexArrayIndexed64iv && glad_glGetVertexArrayIndexed64iv != glad_stats_impl_glGetVertexArrayIndexed64iv) { glad_stats_real_glGetVertexArrayIndexed64iv = glad_glGetVertexArrayIndexed64iv; glad_glGetVertexArrayIndexed64iv = glad_stats_impl_glGetVertexArrayIndexed64iv; }
+	else if (!count && glad_stats_real_glGetVertexArrayIndexed64iv) { glad_glGetVertexArrayIndexed64iv = glad_stats_real_glGetVertexArrayIndexed64iv; glad_stats_real_glGetVertexArrayIndexed64iv = 0; }
+	if (count && glad_glGetVertexArrayIndexediv && glad_glGetVertexArrayIndexediv != glad_stats_impl_glGetVertexArrayIndexediv) { glad_stats_real_glGetVertexArrayIndexediv = glad_glGetVertexArrayIndexediv; glad_glGetVertexArrayIndexediv = glad_stats_impl_glGetVertexArrayIndexediv; }
+	else if (!count && glad_stats_real_glGetVertexArrayIndexediv) { glad_glGetVertexArrayIndexediv = glad_stats_real_glGetVertexArrayIndexediv; glad_stats_real_glGetVertexArrayIndexediv = 0; }
+	if (count && glad_glGetVertexArrayiv && glad_glGetVertexArrayiv != glad_stats_impl_glGetVertexArrayiv) { glad_stats_real_glGetVertexArrayiv = glad_glGetVertexArrayiv; glad_glGetVertexArrayiv = glad_stats_impl_glGetVertexArrayiv; }
+	else if (!count && glad_stats_real_glGetVertexArrayiv) { glad_glGetVertexArrayiv = glad_stats_real_glGetVertexArrayiv; glad_stats_real_glGetVertexArrayiv = 0; }
+	if (count && glad_glGetVertexAttribIiv && glad_glGetVertexAttribIiv != glad_stats_impl_glGetVertexAttribIiv) { glad_stats_real_glGetVertexAttribIiv = glad_glGetVertexAttribIiv; glad_glGetVertexAttribIiv = glad_stats_impl_glGetVertexAttribIiv; }
+	else if (!count && glad_stats_real_glGetVertexAttribIiv) { glad_glGetVertexAttribIiv = glad_stats_real_glGetVertexAttribIiv; glad_stats_real_glGetVertexAttribIiv = 0; }
+	if (count && glad_glGetVertexAttribIuiv && glad_glGetVertexAttribIuiv != glad_stats_impl_glGetVertexAttribIuiv) { glad_stats_real_glGetVertexAttribIuiv = glad_glGetVertexAttribIuiv; glad_glGetVertexAttribIuiv = glad_stats_impl_glGetVertexAttribIuiv; }
+	else if (!count && glad_stats_real_glGetVertexAttribIuiv) { glad_glGetVertexAttribIuiv = glad_stats_real_glGetVertexAttribIuiv; glad_stats_real_glGetVertexAttribIuiv = 0; }
+	if (count && glad_glGetVertexAttribLdv && glad_glGetVertexAttribLdv != glad_stats_impl_glGetVertexAttribLdv) { glad_stats_real_glGetVertexAttribLdv = glad_glGetVertexAttribLdv; glad_glGetVertexAttribLdv = glad_stats_impl_glGetVertexAttribLdv; }
+	else if (!count && glad_stats_real_glGetVertexAttribLdv) { glad_glGetVertexAttribLdv = glad_stats_real_glGetVertexAttribLdv; glad_stats_real_glGetVertexAttribLdv = 0; }
+	if (count && glad_glGetVertexAttribLui64vARB && glad_glGetVertexAttribLui64vARB != glad_stats_impl_glGetVertexAttribLui64vARB) { glad_stats_real_glGetVertexAttribLui64vARB = glad_glGetVertexAttribLui64vARB; glad_glGetVertexAttribLui64vARB = glad_stats_impl_glGetVertexAttribLui64vARB; }
+	else if (!count && glad_stats_real_glGetVertexAttribLui64vARB) { glad_glGetVertexAttribLui64vARB = glad_stats_real_glGetVertexAttribLui64vARB; glad_stats_real_glGetVertexAttribLui64vARB = 0; }
+	if (count && glad_glGetVertexAttribPointerv && glad_glGetVertexAttribPointerv != glad_stats_impl_glGetVertexAttribPointerv) { glad_stats_real_glGetVertexAttribPointerv = glad_glGetVertexAttribPointerv; glad_glGetVertexAttribPointerv = glad_stats_impl_glGetVertexAttribPointerv; }
+	else if (!count && glad_stats_real_glGetVertexAttribPointerv) { glad_glGetVertexAttribPointerv = glad_stats_real_glGetVertexAttribPointerv; glad_stats_real_glGetVertexAttribPointerv = 0; }
+	if (count && glad_glGetVertexAttribdv && glad_glGetVertexAttribdv != glad_stats_impl_glGetVertexAttribdv) { glad_stats_real_glGetVertexAttribdv = glad_glGetVertexAttribdv; glad_glGetVertexAttribdv = glad_stats_impl_glGetVertexAttribdv; }
+	else if (!count && glad_stats_real_glGetVertexAttribdv) { glad_glGetVertexAttribdv = glad_stats_real_glGetVertexAttribdv; glad_stats_real_glGetVertexAttribdv = 0; }
+	if (count && glad_glGetVertexAttribfv && glad_glGetVertexAttribfv != glad_stats_impl_glGetVertexAttribfv) { glad_stats_real_glGetVertexAttribfv = glad_glGetVertexAttribfv; glad_glGetVertexAttribfv = glad_stats_impl_glGetVertexAttribfv; }
+	else if (!count && glad_stats_real_glGetVertexAttribfv) { glad_glGetVertexAttribfv = glad_stats_real_glGetVertexAttribfv; glad_stats_real_glGetVertexAttribfv = 0; }
+	if (count && glad_glGetVertexAttribiv && glad_glGetVertexAttribiv != glad_stats_impl_glGetVertexAttribiv) { glad_stats_real_glGetVertexAttribiv = glad_glGetVertexAttribiv; glad_glGetVertexAttribiv = glad_stats_impl_glGetVertexAttribiv; }
+	else if (!count && glad_stats_real_glGetVertexAttribiv) { glad_glGetVertexAttribiv = glad_stats_real_glGetVertexAttribiv; glad_stats_real_glGetVertexAttribiv = 0; }
+	if (count && glad_glGetnColorTable && glad_glGetnColorTable != glad_stats_impl_glGetnColorTable) { glad_stats_real_glGetnColorTable = glad_glGetnColorTable; glad_glGetnColorTable = glad_stats_impl_glGetnColorTable; }
+	else if (!count && glad_stats_real_glGetnColorTable) { glad_glGetnColorTable = glad_stats_real_glGetnColorTable; glad_stats_real_glGetnColorTable = 0; }
+	if (count && glad_glGetnCompressedTexImage && glad_glGetnCompressedTexImage != glad_stats_impl_glGetnCompressedTexImage) { glad_stats_real_glGetnCompressedTexImage = glad_glGetnCompressedTexImage; glad_glGetnCompressedTexImage = glad_stats_impl_glGetnCompressedTexImage; }
+	else if (!count && glad_stats_real_glGetnCompressedTexImage) { glad_glGetnCompressedTexImage = glad_stats_real_glGetnCompressedTexImage; glad_stats_real_glGetnCompressedTexImage = 0; }
+	if (count && glad_glGetnConvolutionFilter && glad_glGetnConvolutionFilter != glad_stats_impl_glGetnConvolutionFilter) { glad_stats_real_glGetnConvolutionFilter = glad_glGetnConvolutionFilter; glad_glGetnConvolutionFilter = glad_stats_impl_glGetnConvolutionFilter; }
+	else if (!count && glad_stats_real_glGetnConvolutionFilter) { glad_glGetnConvolutionFilter = glad_stats_real_glGetnConvolutionFilter; glad_stats_real_glGetnConvolutionFilter = 0; }
+	if (count && glad_glGetnHistogram && glad_glGetnHistogram != glad_stats_impl_glGetnHistogram) { glad_stats_real_glGetnHistogram = glad_glGetnHistogram; glad_glGetnHistogram = glad_stats_impl_glGetnHistogram; }
+	else if (!count && glad_stats_real_glGetnHistogram) { glad_glGetnHistogram = glad_stats_real_glGetnHistogram; glad_stats_real_glGetnHistogram = 0; }
+	if (count && glad_glGetnMapdv && glad_glGetnMapdv != glad_stats_impl_glGetnMapdv) { glad_stats_real_glGetnMapdv = glad_glGetnMapdv; glad_glGetnMapdv = glad_stats_impl_glGetnMapdv; }
+	else if (!count && glad_stats_real_glGetnMapdv) { glad_glGetnMapdv = glad_stats_real_glGetnMapdv; glad_stats_real_glGetnMapdv = 0; }
+	if (count && glad_glGetnMapfv && glad_glGetnMapfv != glad_stats_impl_glGetnMapfv) { glad_stats_real_glGetnMapfv = glad_glGetnMapfv; glad_glGetnMapfv = glad_stats_impl_glGetnMapfv; }
+	else if (!count && glad_stats_real_glGetnMapfv) { glad_glGetnMapfv = glad_stats_real_glGetnMapfv; glad_stats_real_glGetnMapfv = 0; }
+	if (count && glad_glGetnMapiv && glad_glGetnMapiv != glad_stats_impl_glGetnMapiv) { glad_stats_real_glGetnMapiv = glad_glGetnMapiv; glad_glGetnMapiv = glad_stats_impl_glGetnMapiv; }
+	else if (!count && glad_stats_real_glGetnMapiv) { glad_glGetnMapiv = glad_stats_real_glGetnMapiv; glad_stats_real_glGetnMapiv = 0; }
+	if (count && glad_glGetnMinmax && glad_glGetnMinmax != glad_stats_impl_glGetnMinmax) { glad_stats_real_glGetnMinmax = glad_glGetnMinmax; glad_glGetnMinmax = glad_stats_impl_glGetnMinmax; }
+	else if (!count && glad_stats_real_glGetnMinmax) { glad_glGetnMinmax = glad_stats_real_glGetnMinmax; glad_stats_real_glGetnMinmax = 0; }
+	if (count && glad_glGetnPixelMapfv && glad_glGetnPixelMapfv != glad_stats_impl_glGetnPixelMapfv) { glad_stats_real_glGetnPixelMapfv = glad_glGetnPixelMapfv; glad_glGetnPixelMapfv = glad_stats_impl_glGetnPixelMapfv; }
+	else if (!count && glad_stats_real_glGetnPixelMapfv) { glad_glGetnPixelMapfv = glad_stats_real_glGetnPixelMapfv; glad_stats_real_glGetnPixelMapfv = 0; }
+	if (count && glad_glGetnPixelMapuiv && glad_glGetnPixelMapuiv != glad_stats_impl_glGetnPixelMapuiv) { glad_stats_real_glGetnPixelMapuiv = glad_glGetnPixelMapuiv; glad_glGetnPixelMapuiv = glad_stats_impl_glGetnPixelMapuiv; }
+	else if (!count && glad_stats_real_glGetnPixelMapuiv) { glad_glGetnPixelMapuiv = glad_stats_real_glGetnPixelMapuiv; glad_stats_real_glGetnPixelMapuiv = 0; }
+	if (count && glad_glGetnPixelMapusv && glad_glGetnPixelMapusv != glad_stats_impl_glGetnPixelMapusv) { glad_stats_real_glGetnPixelMapusv = glad_glGetnPixelMapusv; glad_glGetnPixelMapusv = glad_stats_impl_glGetnPixelMapusv; }
+	else if (!count && glad_stats_real_glGetnPixelMapusv) { glad_glGetnPixelMapusv = glad_stats_real_glGetnPixelMapusv; glad_stats_real_glGetnPixelMapusv = 0; }
+	if (count && glad_glGetnPolygonStipple && glad_glGetnPolygonStipple != glad_stats_impl_glGetnPolygonStipple) { glad_stats_real_glGetnPolygonStipple = glad_glGetnPolygonStipple; glad_glGetnPolygonStipple = glad_stats_impl_glGetnPolygonStipple; }
+	else if (!count && glad_stats_real_glGetnPolygonStipple) { glad_glGetnPolygonStipple = glad_stats_real_glGetnPolygonStipple; glad_stats_real_glGetnPolygonStipple = 0; }
+	if (count && glad_glGetnSeparableFilter && glad_glGetnSeparableFilter != glad_stats_impl_glGetnSeparableFilter) { glad_stats_real_glGetnSeparableFilter = glad_glGetnSeparableFilter; glad_glGetnSeparableFilter = glad_stats_impl_glGetnSeparableFilter; }
+	else if (!count && glad_stats_real_glGetnSeparableFilter) { glad_glGetnSeparableFilter = glad_stats_real_glGetnSeparableFilter; glad_stats_real_glGetnSeparableFilter = 0; }
+	if (count && glad_glGetnTexImage && glad_glGetnTexImage != glad_stats_impl_glGetnTexImage) { glad_stats_real_glGetnTexImage = glad_glGetnTexImage; glad_glGetnTexImage = glad_stats_impl_glGetnTexImage; }
+	else if (!count && glad_stats_real_glGetnTexImage) { glad_glGetnTexImage = glad_stats_real_glGetnTexImage; glad_stats_real_glGetnTexImage = 0; }
+	if (count && glad_glGetnUniformdv && glad_glGetnUniformdv != glad_stats_impl_glGetnUniformdv) { glad_stats_real_glGetnUniformdv = glad_glGetnUniformdv; glad_glGetnUniformdv = glad_stats_impl_glGetnUniformdv; }
+	else if (!count && glad_stats_real_glGetnUniformdv) { glad_glGetnUniformdv = glad_stats_real_glGetnUniformdv; glad_stats_real_glGetnUniformdv = 0; }
+	if (count && glad_glGetnUniformfv && glad_glGetnUniformfv != glad_stats_impl_glGetnUniformfv) { glad_stats_real_glGetnUniformfv = glad_glGetnUniformfv; glad_glGetnUniformfv = glad_stats_impl_glGetnUniformfv; }
+	else if (!count && glad_stats_real_glGetnUniformfv) { glad_glGetnUniformfv = glad_stats_real_glGetnUniformfv; glad_stats_real_glGetnUniformfv = 0; }
+	if (count && glad_glGetnUniformiv && glad_glGetnUniformiv != glad_stats_impl_glGetnUniformiv) { glad_stats_real_glGetnUniformiv = glad_glGetnUniformiv; glad_glGetnUniformiv = glad_stats_impl_glGetnUniformiv; }
+	else if (!count && glad_stats_real_glGetnUniformiv) { glad_glGetnUniformiv = glad_stats_real_glGetnUniformiv; glad_stats_real_glGetnUniformiv = 0; }
+	if (count && glad_glGetnUniformuiv && glad_glGetnUniformuiv != glad_stats_impl_glGetnUniformuiv) { glad_stats_real_glGetnUniformuiv = glad_glGetnUniformuiv; glad_glGetnUniformuiv = glad_stats_impl_glGetnUniformuiv; }
+	else if (!count && glad_stats_real_glGetnUniformuiv) { glad_glGetnUniformuiv = glad_stats_real_glGetnUniformuiv; glad_stats_real_glGetnUniformuiv = 0; }
+	if (count && glad_glHint && glad_glHint != glad_stats_impl_glHint) { glad_stats_real_glHint = glad_glHint; glad_glHint = glad_stats_impl_glHint; }
+	else if (!count && glad_stats_real_glHint) { glad_glHint = glad_stats_real_glHint; glad_stats_real_glHint = 0; }
+	if (count && glad_glIndexMask && glad_glIndexMask != glad_stats_impl_glIndexMask) { glad_stats_real_glIndexMask = glad_glIndexMask; glad_glIndexMask = glad_stats_impl_glIndexMask; }
+	else if (!count && glad_stats_real_glIndexMask) { glad_glIndexMask = glad_stats_real_glIndexMask; glad_stats_real_glIndexMask = 0; }
+	if (count && glad_glIndexPointer && glad_glIndexPointer != glad_stats_impl_glIndexPointer) { glad_stats_real_glIndexPointer = glad_glIndexPointer; glad_glIndexPointer = glad_stats_impl_glIndexPointer; }
+	else if (!count && glad_stats_real_glIndexPointer) { glad_glIndexPointer = glad_stats_real_glIndexPointer; glad_stats_real_glIndexPointer = 0; }
+	if (count && glad_glIndexd && glad_glIndexd != glad_stats_impl_glIndexd) { glad_stats_real_glIndexd = glad_glIndexd; glad_glIndexd = glad_stats_impl_glIndexd; }
+	else if (!count && glad_stats_real_glIndexd) { glad_glIndexd = glad_stats_real_glIndexd; glad_stats_real_glIndexd = 0; }
+	if (count && glad_glIndexdv && glad_glIndexdv != glad_stats_impl_glIndexdv) { glad_stats_real_glIndexdv = glad_glIndexdv; glad_glIndexdv = glad_stats_impl_glIndexdv; }
+	else if (!count && glad_stats_real_glIndexdv) { glad_glIndexdv = glad_stats_real_glIndexdv; glad_stats_real_glIndexdv = 0; }
+	if (count && glad_glIndexf && glad_glIndexf != glad_stats_impl_glIndexf) { glad_stats_real_glIndexf = glad_glIndexf; glad_glIndexf = glad_stats_impl_glIndexf; }
+	else if (!count && glad_stats_real_glIndexf) { glad_glIndexf = glad_stats_real_glIndexf; glad_stats_real_glIndexf = 0; }
+	if (count && glad_glIndexfv && glad_glIndexfv != glad_stats_impl_glIndexfv) { glad_stats_real_glIndexfv = glad_glIndexfv; glad_glIndexfv = glad_stats_impl_glIndexfv; }
+	else if (!count && glad_stats_real_glIndexfv) { glad_glIndexfv = glad_stats_real_glIndexfv; glad_stats_real_glIndexfv = 0; }
+	if (count && glad_glIndexi && glad_glIndexi != glad_stats_impl_glIndexi) { glad_stats_real_glIndexi = glad_glIndexi; glad_glIndexi = glad_stats_impl_glIndexi; }
+	else if (!count && glad_stats_real_glIndexi) { glad_glIndexi = glad_stats_real_glIndexi; glad_stats_real_glIndexi = 0; }
+	if (count && glad_glIndexiv && glad_glIndexiv != glad_stats_impl_glIndexiv) { glad_stats_real_glIndexiv = glad_glIndexiv; glad_glIndexiv = glad_stats_impl_glIndexiv; }
+	else if (!count && glad_stats_real_glIndexiv) { glad_glIndexiv = glad_stats_real_glIndexiv; glad_stats_real_glIndexiv = 0; }
+	if (count && glad_glIndexs && glad_glIndexs != glad_stats_impl_glIndexs) { glad_stats_real_glIndexs = glad_glIndexs; glad_glIndexs = glad_stats_impl_glIndexs; }
+	else if (!count && glad_stats_real_glIndexs) { glad_glIndexs = glad_stats_real_glIndexs; glad_stats_real_glIndexs = 0; }
+	if (count && glad_glIndexsv && glad_glIndexsv != glad_stats_impl_glIndexsv) { glad_stats_real_glIndexsv = glad_glIndexsv; glad_glIndexsv = glad_stats_impl_glIndexsv; }
+	else if (!count && glad_stats_real_glIndexsv) { glad_glIndexsv = glad_stats_real_glIndexsv; glad_stats_real_glIndexsv = 0; }
+	if (count && glad_glIndexub && glad_glIndexub != glad_stats_impl_glIndexub) { glad_stats_real_glIndexub = glad_glIndexub; glad_glIndexub = glad_stats_impl_glIndexub; }
+	else if (!count && glad_stats_real_glIndexub) { glad_glIndexub = glad_stats_real_glIndexub; glad_stats_real_glIndexub = 0; }
+	if (count && glad_glIndexubv && glad_glIndexubv != glad_stats_impl_glIndexubv) { glad_stats_real_glIndexubv = glad_glIndexubv; glad_glIndexubv = glad_stats_impl_glIndexubv; }
+	else if (!count && glad_stats_real_glIndexubv) { glad_glIndexubv = glad_stats_real_glIndexubv; glad_stats_real_glIndexubv = 0; }
+	if (count && glad_glInitNames && glad_glInitNames != glad_stats_impl_glInitNames) { glad_stats_real_glInitNames = glad_glInitNames; glad_glInitNames = glad_stats_impl_glInitNames; }
+	else if (!count && glad_stats_real_glInitNames) { glad_glInitNames = glad_stats_real_glInitNames; glad_stats_real_glInitNames = 0; }
+	if (count && glad_glInterleavedArrays && glad_glInterleavedArrays != glad_stats_impl_glInterleavedArrays) { glad_stats_real_glInterleavedArrays = glad_glInterleavedArrays; glad_glInterleavedArrays = glad_stats_impl_glInterleavedArrays; }
+	else if (!count && glad_stats_real_glInterleavedArrays) { glad_glInterleavedArrays = glad_stats_real_glInterleavedArrays; glad_stats_real_glInterleavedArrays = 0; }
+	if (count && glad_glInvalidateBufferData && glad_glInvalidateBufferData != glad_stats_impl_glInvalidateBufferData) { glad_stats_real_glInvalidateBufferData = glad_glInvalidateBufferData; glad_glInvalidateBufferData = glad_stats_impl_glInvalidateBufferData; }
+	else if (!count && glad_stats_real_glInvalidateBufferData) { glad_glInvalidateBufferData = glad_stats_real_glInvalidateBufferData; glad_stats_real_glInvalidateBufferData = 0; }
+	if (count && glad_glInvalidateBufferSubData && glad_glInvalidateBufferSubData != glad_stats_impl_glInvalidateBufferSubData) { glad_stats_real_glInvalidateBufferSubData = glad_glInvalidateBufferSubData; glad_glInvalidateBufferSubData = glad_stats_impl_glInvalidateBufferSubData; }
+	else if (!count && glad_stats_real_glInvalidateBufferSubData) { glad_glInvalidateBufferSubData = glad_stats_real_glInvalidateBufferSubData; glad_stats_real_glInvalidateBufferSubData = 0; }
+	if (count && glad_glInvalidateFramebuffer && glad_glInvalidateFramebuffer != glad_stats_impl_glInvalidateFramebuffer) { glad_stats_real_glInvalidateFramebuffer = glad_glInvalidateFramebuffer; glad_glInvalidateFramebuffer = glad_stats_impl_glInvalidateFramebuffer; }
+	else if (!count && glad_stats_real_glInvalidateFramebuffer) { glad_glInvalidateFramebuffer = glad_stats_real_glInvalidateFramebuffer; glad_stats_real_glInvalidateFramebuffer = 0; }
+	if (count && glad_glInvalidateNamedFramebufferData && glad_glInvalidateNamedFramebufferData != glad_stats_impl_glInvalidateNamedFramebufferData) { glad_stats_real_glInvalidateNamedFramebufferData = glad_glInvalidateNamedFramebufferData; glad_glInvalidateNamedFramebufferData = glad_stats_impl_glInvalidateNamedFramebufferData; }
+	else if (!count && glad_stats_real_glInvalidateNamedFramebufferData) { glad_glInvalidateNamedFramebufferData = glad_stats_real_glInvalidateNamedFramebufferData; glad_stats_real_glInvalidateNamedFramebufferData = 0; }
+	if (count && glad_glInvalidateNamedFramebufferSubData && glad_glInvalidateNamedFramebufferSubData != glad_stats_impl_glInvalidateNamedFramebufferSubData) { glad_stats_real_glInvalidateNamedFramebufferSubData = glad_glInvalidateNamedFramebufferSubData; glad_glInvalidateNamedFramebufferSubData = glad_stats_impl_glInvalidateNamedFramebufferSubData; }
+	else if (!count && glad_stats_real_glInvalidateNamedFramebufferSubData) { glad_glInvalidateNamedFramebufferSubData = glad_stats_real_glInvalidateNamedFramebufferSubData; glad_stats_real_glInvalidateNamedFramebufferSubData = 0; }
+	if (count && glad_glInvalidateSubFramebuffer && glad_glInvalidateSubFramebuffer != glad_stats_impl_glInvalidateSubFramebuffer) { glad_stats_real_glInvalidateSubFramebuffer = glad_glInvalidateSubFramebuffer; glad_glInvalidateSubFramebuffer = glad_stats_impl_glInvalidateSubFramebuffer; }
+	else if (!count && glad_stats_real_glInvalidateSubFramebuffer) { glad_glInvalidateSubFramebuffer = glad_stats_real_glInvalidateSubFramebuffer; glad_stats_real_glInvalidateSubFramebuffer = 0; }
+	if (count && glad_glInvalidateTexImage && glad_glInvalidateTexImage != glad_stats_impl_glInvalidateTexImage) { glad_stats_real_glInvalidateTexImage = glad_glInvalidateTexImage; glad_glInvalidateTexImage = glad_stats_impl_glInvalidateTexImage; }
+	else if (!count && glad_stats_real_glInvalidateTexImage) { glad_glInvalidateTexImage = glad_stats_real_glInvalidateTexImage; glad_stats_real_glInvalidateTexImage = 0; }
+	if (count && glad_glInvalidateTexSubImage && glad_glInvalidateTexSubImage != glad_stats_impl_glInvalidateTexSubImage) { glad_stats_real_glInvalidateTexSubImage = glad_glInvalidateTexSubImage; glad_glInvalidateTexSubImage = glad_stats_impl_glInvalidateTexSubImage; }
+	else if (!count && glad_stats_real_glInvalidateTexSubImage) { glad_glInvalidateTexSubImage = glad_stats_real_glInvalidateTexSubImage; glad_stats_real_glInvalidateTexSubImage = 0; }
+	if (count && glad_glIsBuffer && glad_glIsBuffer != glad_stats_impl_glIsBuffer) { glad_stats_real_glIsBuffer = glad_glIsBuffer; glad_glIsBuffer = glad_stats_impl_glIsBuffer; }
+	else if (!count && glad_stats_real_glIsBuffer) { glad_glIsBuffer = glad_stats_real_glIsBuffer; glad_stats_real_glIsBuffer = 0; }
+	if (count && glad_glIsEnabled && glad_glIsEnabled != glad_stats_impl_glIsEnabled) { glad_stats_real_glIsEnabled = glad_glIsEnabled; glad_glIsEnabled = glad_stats_impl_glIsEnabled; }
+	else if (!count && glad_stats_real_glIsEnabled) { glad_glIsEnabled = glad_stats_real_glIsEnabled; glad_stats_real_glIsEnabled = 0; }
+	if (count && glad_glIsEnabledi && glad_glIsEnabledi != glad_stats_impl_glIsEnabledi) { glad_stats_real_glIsEnabledi = glad_glIsEnabledi; glad_glIsEnabledi = glad_stats_impl_glIsEnabledi; }
+	else if (!count && glad_stats_real_glIsEnabledi) { glad_glIsEnabledi = glad_stats_real_glIsEnabledi; glad_stats_real_glIsEnabledi = 0; }
+	if (count && glad_glIsFramebuffer && glad_glIsFramebuffer != glad_stats_impl_glIsFramebuffer) { glad_stats_real_glIsFramebuffer = glad_glIsFramebuffer; glad_glIsFramebuffer = glad_stats_impl_glIsFramebuffer; }
+	else if (!count && glad_stats_real_glIsFramebuffer) { glad_glIsFramebuffer = glad_stats_real_glIsFramebuffer; glad_stats_real_glIsFramebuffer = 0; }
+	if (count && glad_glIsImageHandleResidentARB && glad_glIsImageHandleResidentARB != glad_stats_impl_glIsImageHandleResidentARB) { glad_stats_real_glIsImageHandleResidentARB = glad_glIsImageHandleResidentARB; glad_glIsImageHandleResidentARB = glad_stats_impl_glIsImageHandleResidentARB; }
+	else if (!count && glad_stats_real_glIsImageHandleResidentARB) { glad_glIsImageHandleResidentARB = glad_stats_real_glIsImageHandleResidentARB; glad_stats_real_glIsImageHandleResidentARB = 0; }
+	if (count && glad_glIsList && glad_glIsList != glad_stats_impl_glIsList) { glad_stats_real_glIsList = glad_glIsList; glad_glIsList = glad_stats_impl_glIsList; }
+	else if (!count && glad_stats_real_glIsList) { glad_glIsList = glad_stats_real_glIsList; glad_stats_real_glIsList = 0; }
+	if (count && glad_glIsProgram && glad_glIsProgram != glad_stats_impl_glIsProgram) { glad_stats_real_glIsProgram = glad_glIsProgram; glad_glIsProgram = glad_stats_impl_glIsProgram; }
+	else if (!count && glad_stats_real_glIsProgram) { glad_glIsProgram = glad_stats_real_glIsProgram; glad_stats_real_glIsProgram = 0; }
+	if (count && glad_glIsProgramPipeline && glad_glIsProgramPipeline != glad_stats_impl_glIsProgramPipeline) { glad_stats_real_glIsProgramPipeline = glad_glIsProgramPipeline; glad_glIsProgramPipeline = glad_stats_impl_glIsProgramPipeline; }
+	else if (!count && glad_stats_real_glIsProgramPipeline) { glad_glIsProgramPipeline = glad_stats_real_glIsProgramPipeline; glad_stats_real_glIsProgramPipeline = 0; }
+	if (count && glad_glIsQuery && glad_glIsQuery != glad_stats_impl_glIsQuery) { glad_stats_real_glIsQuery = glad_glIsQuery; glad_glIsQuery = glad_stats_impl_glIsQuery; }
+	else if (!count && glad_stats_real_glIsQuery) { glad_glIsQuery = glad_stats_real_glIsQuery; glad_stats_real_glIsQuery = 0; }
+	if (count && glad_glIsRenderbuffer && glad_glIsRenderbuffer != glad_stats_impl_glIsRenderbuffer) { glad_stats_real_glIsRenderbuffer = glad_glIsRenderbuffer; glad_glIsRenderbuffer = glad_stats_impl_glIsRenderbuffer; }
+	else if (!count && glad_stats_real_glIsRenderbuffer) { glad_glIsRenderbuffer = glad_stats_real_glIsRenderbuffer; glad_stats_real_glIsRenderbuffer = 0; }
+	if (count && glad_glIsSampler && glad_glIsSampler != glad_stats_impl_glIsSampler) { glad_stats_real_glIsSampler = glad_glIsSampler; glad_glIsSampler = glad_stats_impl_glIsSampler; }
+	else if (!count && glad_stats_real_glIsSampler) { glad_glIsSampler = glad_stats_real_glIsSampler; glad_stats_real_glIsSampler = 0; }
+	if (count && glad_glIsShader && glad_glIsShader != glad_stats_impl_glIsShader) { glad_stats_real_glIsShader = glad_glIsShader; glad_glIsShader = glad_stats_impl_glIsShader; }
+	else if (!count && glad_stats_real_glIsShader) { glad_glIsShader = glad_stats_real_glIsShader; glad_stats_real_glIsShader = 0; }
+	if (count && glad_glIsSync && glad_glIsSync != glad_stats_impl_glIsSync) { glad_stats_real_glIsSync = glad_glIsSync; glad_glIsSync = glad_stats_impl_glIsSync; }
+	else if (!count && glad_stats_real_glIsSync) { glad_glIsSync = glad_stats_real_glIsSync; glad_stats_real_glIsSync = 0; }
+	if (count && glad_glIsTexture && glad_glIsTexture != glad_stats_impl_glIsTexture) { glad_stats_real_glIsTexture = glad_glIsTexture; glad_glIsTexture = glad_stats_impl_glIsTexture; }
+	else if (!count && glad_stats_real_glIsTexture) { glad_glIsTexture = glad_stats_real_glIsTexture; glad_stats_real_glIsTexture = 0; }
+	if (count && glad_glIsTextureHandleResidentARB && glad_glIsTextureHandleResidentARB != glad_stats_impl_glIsTextureHandleResidentARB) { glad_stats_real_glIsTextureHandleResidentARB = glad_glIsTextureHandleResidentARB; glad_glIsTextureHandleResidentARB = glad_stats_impl_glIsTextureHandleResidentARB; }
+	else if (!count && glad_stats_real_glIsTextureHandleResidentARB) { glad_glIsTextureHandleResidentARB = glad_stats_real_glIsTextureHandleResidentARB; glad_stats_real_glIsTextureHandleResidentARB = 0; }
+	if (count && glad_glIsTransformFeedback && glad_glIsTransformFeedback != glad_stats_impl_glIsTransformFeedback) { glad_stats_real_glIsTransformFeedback = glad_glIsTransformFeedback; glad_glIsTransformFeedback = glad_stats_impl_glIsTransformFeedback; }
+	else if (!count && glad_stats_real_glIsTransformFeedback) { glad_glIsTransformFeedback = glad_stats_real_glIsTransformFeedback; glad_stats_real_glIsTransformFeedback = 0; }
+	if (count && glad_glIsVertexArray && glad_glIsVertexArray != glad_stats_impl_glIsVertexArray) { glad_stats_real_glIsVertexArray = glad_glIsVertexArray; glad_glIsVertexArray = glad_stats_impl_glIsVertexArray; }
+	else if (!count && glad_stats_real_glIsVertexArray) { glad_glIsVertexArray = glad_stats_real_glIsVertexArray; glad_stats_real_glIsVertexArray = 0; }
+	if (count && glad_glLightModelf && glad_glLightModelf != glad_stats_impl_glLightModelf) { glad_stats_real_glLightModelf = glad_glLightModelf; glad_glLightModelf = glad_stats_impl_glLightModelf; }
+	else if (!count && glad_stats_real_glLightModelf) { glad_glLightModelf = glad_stats_real_glLightModelf; glad_stats_real_glLightModelf = 0; }
+	if (count && glad_glLightModelfv && glad_glLightModelfv != glad_stats_impl_glLightModelfv) { glad_stats_real_glLightModelfv = glad_glLightModelfv; glad_glLightModelfv = glad_stats_impl_glLightModelfv; }
+	else if (!count && glad_stats_real_glLightModelfv) { glad_glLightModelfv = glad_stats_real_glLightModelfv; glad_stats_real_glLightModelfv = 0; }
+	if (count && glad_glLightModeli && glad_glLightModeli != glad_stats_impl_glLightModeli) { glad_stats_real_glLightModeli = glad_glLightModeli; glad_glLightModeli = glad_stats_impl_glLightModeli; }
+	else if (!count && glad_stats_real_glLightModeli) { glad_glLightModeli = glad_stats_real_glLightModeli; glad_stats_real_glLightModeli = 0; }
+	if (count && glad_glLightModeliv && glad_glLightModeliv != glad_stats_impl_glLightModeliv) { glad_stats_real_glLightModeliv = glad_glLightModeliv; glad_glLightModeliv = glad_stats_impl_glLightModeliv; }
+	else if (!count && glad_stats_real_glLightModeliv) { glad_glLightModeliv = glad_stats_real_glLightModeliv; glad_stats_real_glLightModeliv = 0; }
+	if (count && glad_glLightf && glad_glLightf != glad_stats_impl_glLightf) { glad_stats_real_glLightf = glad_glLightf; glad_glLightf = glad_stats_impl_glLightf; }
+	else if (!count && glad_stats_real_glLightf) { glad_glLightf = glad_stats_real_glLightf; glad_stats_real_glLightf = 0; }
+	if (count && glad_glLightfv && glad_glLightfv != glad_stats_impl_glLightfv) { glad_stats_real_glLightfv = glad_glLightfv; glad_glLightfv = glad_stats_impl_glLightfv; }
+	else if (!count && glad_stats_real_glLightfv) { glad_glLightfv = glad_stats_real_glLightfv; glad_stats_real_glLightfv = 0; }
+	if (count && glad_glLighti && glad_glLighti != glad_stats_impl_glLighti) { glad_stats_real_glLighti = glad_glLighti; glad_glLighti = glad_stats_impl_glLighti; }
+	else if (!count && glad_stats_real_glLighti) { glad_glLighti = glad_stats_real_glLighti; glad_stats_real_glLighti = 0; }
+	if (count && glad_glLightiv && glad_glLightiv != glad_stats_impl_glLightiv) { glad_stats_real_glLightiv = glad_glLightiv; glad_glLightiv = glad_stats_impl_glLightiv; }
+	else if (!count && glad_stats_real_glLightiv) { glad_glLightiv = glad_stats_real_glLightiv; glad_stats_real_glLightiv = 0; }
+	if (count && glad_glLineStipple && glad_glLineStipple != glad_stats_impl_glLineStipple) { glad_stats_real_glLineStipple = glad_glLineStipple; glad_glLineStipple = glad_stats_impl_glLineStipple; }
+	else if (!count && glad_stats_real_glLineStipple) { glad_glLineStipple = glad_stats_real_glLineStipple; glad_stats_real_glLineStipple = 0; }
+	if (count && glad_glLineWidth && glad_glLineWidth != glad_stats_impl_glLineWidth) { glad_stats_real_glLineWidth = glad_glLineWidth; glad_glLineWidth = glad_stats_impl_glLineWidth; }
+	else if (!count && glad_stats_real_glLineWidth) { glad_glLineWidth = glad_stats_real_glLineWidth; glad_stats_real_glLineWidth = 0; }
+	if (count && glad_glLinkProgram && glad_glLinkProgram != glad_stats_impl_glLinkProgram) { glad_stats_real_glLinkProgram = glad_glLinkProgram; glad_glLinkProgram = glad_stats_impl_glLinkProgram; }
+	else if (!count && glad_stats_real_glLinkProgram) { glad_glLinkProgram = glad_stats_real_glLinkProgram; glad_stats_real_glLinkProgram = 0; }
+	if (count && glad_glListBase && glad_glListBase != glad_stats_impl_glListBase) { glad_stats_real_glListBase = glad_glListBase; glad_glListBase = glad_stats_impl_glListBase; }
+	else if (!count && glad_stats_real_glListBase) { glad_glListBase = glad_stats_real_glListBase; glad_stats_real_glListBase = 0; }
+	if (count && glad_glLoadIdentity && glad_glLoadIdentity != glad_stats_impl_glLoadIdentity) { glad_stats_real_glLoadIdentity = glad_glLoadIdentity; glad_glLoadIdentity = glad_stats_impl_glLoadIdentity; }
+	else if (!count && glad_stats_real_glLoadIdentity) { glad_glLoadIdentity = glad_stats_real_glLoadIdentity; glad_stats_real_glLoadIdentity = 0; }
+	if (count && glad_glLoadMatrixd && glad_glLoadMatrixd != glad_stats_impl_glLoadMatrixd) { glad_stats_real_glLoadMatrixd = glad_glLoadMatrixd; glad_glLoadMatrixd = glad_stats_impl_glLoadMatrixd; }
+	else if (!count && glad_stats_real_glLoadMatrixd) { glad_glLoadMatrixd = glad_stats_real_glLoadMatrixd; glad_stats_real_glLoadMatrixd = 0; }
+	if (count && glad_glLoadMatrixf && glad_glLoadMatrixf != glad_stats_impl_glLoadMatrixf) { glad_stats_real_glLoadMatrixf = glad_glLoadMatrixf; glad_glLoadMatrixf = glad_stats_impl_glLoadMatrixf; }
+	else if (!count && glad_stats_real_glLoadMatrixf) { glad_glLoadMatrixf = glad_stats_real_glLoadMatrixf; glad_stats_real_glLoadMatrixf = 0; }
+	if (count && glad_glLoadName && glad_glLoadName != glad_stats_impl_glLoadName) { glad_stats_real_glLoadName = glad_glLoadName; glad_glLoadName = glad_stats_impl_glLoadName; }
+	else if (!count && glad_stats_real_glLoadName) { glad_glLoadName = glad_stats_real_glLoadName; glad_stats_real_glLoadName = 0; }
+	if (count && glad_glLoadTransposeMatrixd && glad_glLoadTransposeMatrixd != glad_stats_impl_glLoadTransposeMatrixd) { glad_stats_real_glLoadTransposeMatrixd = glad_glLoadTransposeMatrixd; glad_glLoadTransposeMatrixd = glad_stats_impl_glLoadTransposeMatrixd; }
+	else if (!count && glad_stats_real_glLoadTransposeMatrixd) { glad_glLoadTransposeMatrixd = glad_stats_real_glLoadTransposeMatrixd; glad_stats_real_glLoadTransposeMatrixd = 0; }
+	if (count && glad_glLoadTransposeMatrixf && glad_glLoadTransposeMatrixf != glad_stats_impl_glLoadTransposeMatrixf) { glad_stats_real_glLoadTransposeMatrixf = glad_glLoadTransposeMatrixf; glad_glLoadTransposeMatrixf = glad_stats_impl_glLoadTransposeMatrixf; }
+	else if (!count && glad_stats_real_glLoadTransposeMatrixf) { glad_glLoadTransposeMatrixf = glad_stats_real_glLoadTransposeMatrixf; glad_stats_real_glLoadTransposeMatrixf = 0; }
+	if (count && glad_glLogicOp && glad_glLogicOp != glad_stats_impl_glLogicOp) { glad_stats_real_glLogicOp = glad_glLogicOp; glad_glLogicOp = glad_stats_impl_glLogicOp; }
+	else if (!count && glad_stats_real_glLogicOp) { glad_glLogicOp = glad_stats_real_glLogicOp; glad_stats_real_glLogicOp = 0; }
+	if (count && glad_glMakeImageHandleNonResidentARB && glad_glMakeImageHandleNonResidentARB != glad_stats_impl_glMakeImageHandleNonResidentARB) { glad_stats_real_glMakeImageHandleNonResidentARB = glad_glMakeImageHandleNonResidentARB; glad_glMakeImageHandleNonResidentARB = glad_stats_impl_glMakeImageHandleNonResidentARB; }
+	else if (!count && glad_stats_real_glMakeImageHandleNonResidentARB) { glad_glMakeImageHandleNonResidentARB = glad_stats_real_glMakeImageHandleNonResidentARB; glad_stats_real_glMakeImageHandleNonResidentARB = 0; }
+	if (count && glad_glMakeImageHandleResidentARB && glad_glMakeImageHandleResidentARB != glad_stats_impl_glMakeImageHandleResidentARB) { glad_stats_real_glMakeImageHandleResidentARB = glad_glMakeImageHandleResidentARB; glad_glMakeImageHandleResidentARB = glad_stats_impl_glMakeImageHandleResidentARB; }
+	else if (!count && glad_stats_real_glMakeImageHandleResidentARB) { glad_glMakeImageHandleResidentARB = glad_stats_real_glMakeImageHandleResidentARB; glad_stats_real_glMakeImageHandleResidentARB = 0; }
+	if (count && glad_glMakeTextureHandleNonResidentARB && glad_glMakeTextureHandleNonResidentARB != glad_stats_impl_glMakeTextureHandleNonResidentARB) { glad_stats_real_glMakeTextureHandleNonResidentARB = glad_glMakeTextureHandleNonResidentARB; glad_glMakeTextureHandleNonResidentARB = glad_stats_impl_glMakeTextureHandleNonResidentARB; }
+	else if (!count && glad_stats_real_glMakeTextureHandleNonResidentARB) { glad_glMakeTextureHandleNonResidentARB = glad_stats_real_glMakeTextureHandleNonResidentARB; glad_stats_real_glMakeTextureHandleNonResidentARB = 0; }
+	if (count && glad_glMakeTextureHandleResidentARB && glad_glMakeTextureHandleResidentARB != glad_stats_impl_glMakeTextureHandleResidentARB) { glad_stats_real_glMakeTextureHandleResidentARB = glad_glMakeTextureHandleResidentARB; glad_glMakeTextureHandleResidentARB = glad_stats_impl_glMakeTextureHandleResidentARB; }
+	else if (!count && glad_stats_real_glMakeTextureHandleResidentARB) { glad_glMakeTextureHandleResidentARB = glad_stats_real_glMakeTextureHandleResidentARB; glad_stats_real_glMakeTextureHandleResidentARB = 0; }
+	if (count && glad_glMap1d && glad_glMap1d != glad_stats_impl_glMap1d) { glad_stats_real_glMap1d = glad_glMap1d; glad_glMap1d = glad_stats_impl_glMap1d; }
+	else if (!count && glad_stats_real_glMap1d) { glad_glMap1d = glad_stats_real_glMap1d; glad_stats_real_glMap1d = 0; }
+	if (count && glad_glMap1f && glad_glMap1f != glad_stats_impl_glMap1f) { glad_stats_real_glMap1f = glad_glMap1f; glad_glMap1f = glad_stats_impl_glMap1f; }
+	else if (!count && glad_stats_real_glMap1f) { glad_glMap1f = glad_stats_real_glMap1f; glad_stats_real_glMap1f = 0; }
+	if (count && glad_glMap2d && glad_glMap2d != glad_stats_impl_glMap2d) { glad_stats_real_glMap2d = glad_glMap2d; glad_glMap2d = glad_stats_impl_glMap2d; }
+	else if (!count && glad_stats_real_glMap2d) { glad_glMap2d = glad_stats_real_glMap2d; glad_stats_real_glMap2d = 0; }
+	if (count && glad_glMap2f && glad_glMap2f != glad_stats_impl_glMap2f) { glad_stats_real_glMap2f = glad_glMap2f; glad_glMap2f = glad_stats_impl_glMap2f; }
+	else if (!count && glad_stats_real_glMap2f) { glad_glMap2f = glad_stats_real_glMap2f; glad_stats_real_glMap2f = 0; }
+	if (count && glad_glMapBuffer && glad_glMapBuffer != glad_stats_impl_glMapBuffer) { glad_stats_real_glMapBuffer = glad_glMapBuffer; glad_glMapBuffer = glad_stats_impl_glMapBuffer; }
+	else if (!count && glad_stats_real_glMapBuffer) { glad_glMapBuffer = glad_stats_real_glMapBuffer; glad_stats_real_glMapBuffer = 0; }
+	if (count && glad_glMapBufferRange && glad_glMapBufferRange != glad_stats_impl_glMapBufferRange) { glad_stats_real_glMapBufferRange = glad_glMapBufferRange; glad_glMapBufferRange = glad_stats_impl_glMapBufferRange; }
+	else if (!count && glad_stats_real_glMapBufferRange) { glad_glMapBufferRange = glad_stats_real_glMapBufferRange; glad_stats_real_glMapBufferRange = 0; }
+	if (count && glad_glMapGrid1d && glad_glMapGrid1d != glad_stats_impl_glMapGrid1d) { glad_stats_real_glMapGrid1d = glad_glMapGrid1d; glad_glMapGrid1d = glad_stats_impl_glMapGrid1d; }
+	else if (!count && glad_stats_real_glMapGrid1d) { glad_glMapGrid1d = glad_stats_real_glMapGrid1d; glad_stats_real_glMapGrid1d = 0; }
+	if (count && glad_glMapGrid1f && glad_glMapGrid1f != glad_stats_impl_glMapGrid1f) { glad_stats_real_glMapGrid1f = glad_glMapGrid1f; glad_glMapGrid1f = glad_stats_impl_glMapGrid1f; }
+	else if (!count && glad_stats_real_glMapGrid1f) { glad_glMapGrid1f = glad_stats_real_glMapGrid1f; glad_stats_real_glMapGrid1f = 0; }
+	if (count && glad_glMapGrid2d && glad_glMapGrid2d != glad_stats_impl_glMapGrid2d) { glad_stats_real_glMapGrid2d = glad_glMapGrid2d; glad_glMapGrid2d = glad_stats_impl_glMapGrid2d; }
+	else if (!count && glad_stats_real_glMapGrid2d) { glad_glMapGrid2d = glad_stats_real_glMapGrid2d; glad_stats_real_glMapGrid2d = 0; }
+	if (count && glad_glMapGrid2f && glad_glMapGrid2f != glad_stats_impl_glMapGrid2f) { glad_stats_real_glMapGrid2f = glad_glMapGrid2f; glad_glMapGrid2f = glad_stats_impl_glMapGrid2f; }
+	else if (!count && glad_stats_real_glMapGrid2f) { glad_glMapGrid2f = glad_stats_real_glMapGrid2f; glad_stats_real_glMapGrid2f = 0; }
+	if (count && glad_glMapNamedBuffer && glad_glMapNamedBuffer != glad_stats_impl_glMapNamedBuffer) { glad_stats_real_glMapNamedBuffer = glad_glMapNamedBuffer; glad_glMapNamedBuffer = glad_stats_impl_glMapNamedBuffer; }
+	else if (!count && glad_stats_real_glMapNamedBuffer) { glad_glMapNamedBuffer = glad_stats_real_glMapNamedBuffer; glad_stats_real_glMapNamedBuffer = 0; }
+	if (count && glad_glMapNamedBufferRange && glad_glMapNamedBufferRange != glad_stats_impl_glMapNamedBufferRange) { glad_stats_real_glMapNamedBufferRange = glad_glMapNamedBufferRange; glad_glMapNamedBufferRange = glad_stats_impl_glMapNamedBufferRange; }
+	else if (!count && glad_stats_real_glMapNamedBufferRange) { glad_glMapNamedBufferRange = glad_stats_real_glMapNamedBufferRange; glad_stats_real_glMapNamedBufferRange = 0; }
+	if (count && glad_glMaterialf && glad_glMaterialf != glad_stats_impl_glMaterialf) { glad_stats_real_glMaterialf = glad_glMaterialf; glad_glMaterialf = glad_stats_impl_glMaterialf; }
+	else if (!count && glad_stats_real_glMaterialf) { glad_glMaterialf = glad_stats_real_glMaterialf; glad_stats_real_glMaterialf = 0; }
+	if (count && glad_glMaterialfv && glad_glMaterialfv != glad_stats_impl_glMaterialfv) { glad_stats_real_glMaterialfv = glad_glMaterialfv; glad_glMaterialfv = glad_stats_impl_glMaterialfv; }
+	else if (!count && glad_stats_real_glMaterialfv) { glad_glMaterialfv = glad_stats_real_glMaterialfv; glad_stats_real_glMaterialfv = 0; }
+	if (count && glad_glMateriali && glad_glMateriali != glad_stats_impl_glMateriali) { glad_stats_real_glMateriali = glad_glMateriali; glad_glMateriali = glad_stats_impl_glMateriali; }
+	else if (!count && glad_stats_real_glMateriali) { glad_glMateriali = glad_stats_real_glMateriali; glad_stats_real_glMateriali = 0; }
+	if (count && glad_glMaterialiv && glad_glMaterialiv != glad_stats_impl_glMaterialiv) { glad_stats_real_glMaterialiv = glad_glMaterialiv; glad_glMaterialiv = glad_stats_impl_glMaterialiv; }
+	else if (!count && glad_stats_real_glMaterialiv) { glad_glMaterialiv = glad_stats_real_glMaterialiv; glad_stats_real_glMaterialiv = 0; }
+	if (count && glad_glMatrixMode && glad_glMatrixMode != glad_stats_impl_glMatrixMode) { glad_stats_real_glMatrixMode = glad_glMatrixMode; glad_glMatrixMode = glad_stats_impl_glMatrixMode; }
+	else if (!count && glad_stats_real_glMatrixMode) { glad_glMatrixMode = glad_stats_real_glMatrixMode; glad_stats_real_glMatrixMode = 0; }
+	if (count && glad_glMaxShaderCompilerThreadsKHR && glad_glMaxShaderCompilerThreadsKHR != glad_stats_impl_glMaxShaderCompilerThreadsKHR) { glad_stats_real_glMaxShaderCompilerThreadsKHR = glad_glMaxShaderCompilerThreadsKHR; glad_glMaxShaderCompilerThreadsKHR = glad_stats_impl_glMaxShaderCompilerThreadsKHR; }
+	else if (!count && glad_stats_real_glMaxShaderCompilerThreadsKHR) { glad_glMaxShaderCompilerThreadsKHR = glad_stats_real_glMaxShaderCompilerThreadsKHR; glad_stats_real_glMaxShaderCompilerThreadsKHR = 0; }
+	if (count && glad_glMemoryBarrier && glad_glMemoryBarrier != glad_stats_impl_glMemoryBarrier) { glad_stats_real_glMemoryBarrier = glad_glMemoryBarrier; glad_glMemoryBarrier = glad_stats_impl_glMemoryBarrier; }
+	else if (!count && glad_stats_real_glMemoryBarrier) { glad_glMemoryBarrier = glad_stats_real_glMemoryBarrier; glad_stats_real_glMemoryBarrier = 0; }
+	if (count && glad_glMemoryBarrierByRegion && glad_glMemoryBarrierByRegion != glad_stats_impl_glMemoryBarrierByRegion) { glad_stats_real_glMemoryBarrierByRegion = glad_glMemoryBarrierByRegion; glad_glMemoryBarrierByRegion = glad_stats_impl_glMemoryBarrierByRegion; }
+	else if (!count && glad_stats_real_glMemoryBarrierByRegion) { glad_glMemoryBarrierByRegion = glad_stats_real_glMemoryBarrierByRegion; glad_stats_real_glMemoryBarrierByRegion = 0; }
+	if (count && glad_glMinSampleShading && glad_glMinSampleShading != glad_stats_impl_glMinSampleShading) { glad_stats_real_glMinSampleShading = glad_glMinSampleShading; glad_glMinSampleShading = glad_stats_impl_glMinSampleShading; }
+	else if (!count && glad_stats_real_glMinSampleShading) { glad_glMinSampleShading = glad_stats_real_glMinSampleShading; glad_stats_real_glMinSampleShading = 0; }
+	if (count && glad_glMultMatrixd && glad_glMultMatrixd != glad_stats_impl_glMultMatrixd) { glad_stats_real_glMultMatrixd = glad_glMultMatrixd; glad_glMultMatrixd = glad_stats_impl_glMultMatrixd; }
+	else if (!count && glad_stats_real_glMultMatrixd) { glad_glMultMatrixd = glad_stats_real_glMultMatrixd; glad_stats_real_glMultMatrixd = 0; }
+	if (count && glad_glMultMatrixf && glad_glMultMatrixf != glad_stats_impl_glMultMatrixf) { glad_stats_real_glMultMatrixf = glad_glMultMatrixf; glad_glMultMatrixf = glad_stats_impl_glMultMatrixf; }
+	else if (!count && glad_stats_real_glMultMatrixf) { glad_glMultMatrixf = glad_stats_real_glMultMatrixf; glad_stats_real_glMultMatrixf = 0; }
+	if (count && glad_glMultTransposeMatrixd && glad_glMultTransposeMatrixd != glad_stats_impl_glMultTransposeMatrixd) { glad_stats_real_glMultTransposeMatrixd = glad_glMultTransposeMatrixd; glad_glMultTransposeMatrixd = glad_stats_impl_glMultTransposeMatrixd; }
+	else if (!count && glad_stats_real_glMultTransposeMatrixd) { glad_glMultTransposeMatrixd = glad_stats_real_glMultTransposeMatrixd; glad_stats_real_glMultTransposeMatrixd = 0; }
+	if (count && glad_glMultTransposeMatrixf && glad_glMultTransposeMatrixf != glad_stats_impl_glMultTransposeMatrixf) { glad_stats_real_glMultTransposeMatrixf = glad_glMultTransposeMatrixf; glad_glMultTransposeMatrixf = glad_stats_impl_glMultTransposeMatrixf; }
+	else if (!count && glad_stats_real_glMultTransposeMatrixf) { glad_glMultTransposeMatrixf = glad_stats_real_glMultTransposeMatrixf; glad_stats_real_glMultTransposeMatrixf = 0; }
+	if (count && glad_glMultiDrawArrays && glad_glMultiDrawArrays != glad_stats_impl_glMultiDrawArrays) { glad_stats_real_glMultiDrawArrays = glad_glMultiDrawArrays; glad_glMultiDrawArrays = glad_stats_impl_glMultiDrawArrays; }
+	else if (!count && glad_stats_real_glMultiDrawArrays) { glad_glMultiDrawArrays = glad_stats_real_glMultiDrawArrays; glad_stats_real_glMultiDrawArrays = 0; }
+	if (count && glad_glMultiDrawArraysIndirect && glad_glMultiDrawArraysIndirect != glad_stats_impl_glMultiDrawArraysIndirect) { glad_stats_real_glMultiDrawArraysIndirect = glad_glMultiDrawArraysIndirect; glad_glMultiDrawArraysIndirect = glad_stats_impl_glMultiDrawArraysIndirect; }
+	else if (!count && glad_stats_real_glMultiDrawArraysIndirect) { glad_glMultiDrawArraysIndirect = glad_stats_real_glMultiDrawArraysIndirect; glad_stats_real_glMultiDrawArraysIndirect = 0; }
+	if (count && glad_glMultiDrawArraysIndirectCount && glad_glMultiDrawArraysIndirectCount != glad_stats_impl_glMultiDrawArraysIndirectCount) { glad_stats_real_glMultiDrawArraysIndirectCount = glad_glMultiDrawArraysIndirectCount; glad_glMultiDrawArraysIndirectCount = glad_stats_impl_glMultiDrawArraysIndirectCount; }
+	else if (!count && glad_stats_real_glMultiDrawArraysIndirectCount) { glad_glMultiDrawArraysIndirectCount = glad_stats_real_glMultiDrawArraysIndirectCount; glad_stats_real_glMultiDrawArraysIndirectCount = 0; }
+	if (count && glad_glMultiDrawElements && glad_glMultiDrawElements != glad_stats_impl_glMultiDrawElements) { glad_stats_real_glMultiDrawElements = glad_glMultiDrawElements; glad_glMultiDrawElements = glad_stats_impl_glMultiDrawElements; }
+	else if (!count && glad_stats_real_glMultiDrawElements) { glad_glMultiDrawElements = glad_stats_real_glMultiDrawElements; glad_stats_real_glMultiDrawElements = 0; }
+	if (count && glad_glMultiDrawElementsBaseVertex && glad_glMultiDrawElementsBaseVertex != glad_stats_impl_glMultiDrawElementsBaseVertex) { glad_stats_real_glMultiDrawElementsBaseVertex = glad_glMultiDrawElementsBaseVertex; glad_glMultiDrawElementsBaseVertex = glad_stats_impl_glMultiDrawElementsBaseVertex; }
+	else if (!count && glad_stats_real_glMultiDrawElementsBaseVertex) { glad_glMultiDrawElementsBaseVertex = glad_stats_real_glMultiDrawElementsBaseVertex; glad_stats_real_glMultiDrawElementsBaseVertex = 0; }
+	if (count && glad_glMultiDrawElementsIndirect && glad_glMultiDrawElementsIndirect != glad_stats_impl_glMultiDrawElementsIndirect) { glad_stats_real_glMultiDrawElementsIndirect = glad_glMultiDrawElementsIndirect; glad_glMultiDrawElementsIndirect = glad_stats_impl_glMultiDrawElementsIndirect; }
+	else if (!count && glad_stats_real_glMultiDrawElementsIndirect) { glad_glMultiDrawElementsIndirect = glad_stats_real_glMultiDrawElementsIndirect; glad_stats_real_glMultiDrawElementsIndirect = 0; }
+	if (count && glad_glMultiDrawElementsIndirectCount && glad_glMultiDrawElementsIndirectCount != glad_stats_impl_glMultiDrawElementsIndirectCount) { glad_stats_real_glMultiDrawElementsIndirectCount = glad_glMultiDrawElementsIndirectCount; glad_glMultiDrawElementsIndirectCount = glad_stats_impl_glMultiDrawElementsIndirectCount; }
+	else if (!count && glad_stats_real_glMultiDrawElementsIndirectCount) { glad_glMultiDrawElementsIndirectCount = glad_stats_real_glMultiDrawElementsIndirectCount; glad_stats_real_glMultiDrawElementsIndirectCount = 0; }
+	if (count && glad_glMultiTexCoord1d && glad_glMultiTexCoord1d != glad_stats_impl_glMultiTexCoord1d) { glad_stats_real_glMultiTexCoord1d = glad_glMultiTexCoord1d; glad_glMultiTexCoord1d = glad_stats_impl_glMultiTexCoord1d; }
+	else if (!count && glad_stats_real_glMultiTexCoord1d) { glad_glMultiTexCoord1d = glad_stats_real_glMultiTexCoord1d; glad_stats_real_glMultiTexCoord1d = 0; }
+	if (count && glad_glMultiTexCoord1dv && glad_glMultiTexCoord1dv != glad_stats_impl_glMultiTexCoord1dv) { glad_stats_real_glMultiTexCoord1dv = glad_glMultiTexCoord1dv; glad_glMultiTexCoord1dv = glad_stats_impl_glMultiTexCoord1dv; }
+	else if (!count && glad_stats_real_glMultiTexCoord1dv) { glad_glMultiTexCoord1dv = glad_stats_real_glMultiTexCoord1dv; glad_stats_real_glMultiTexCoord1dv = 0; }
+	if (count && glad_glMultiTexCoord1f && glad_glMultiTexCoord1f != glad_stats_impl_glMultiTexCoord1f) { glad_stats_real_glMultiTexCoord1f = glad_glMultiTexCoord1f; glad_glMultiTexCoord1f = glad_stats_impl_glMultiTexCoord1f; }
+	else if (!count && glad_stats_real_glMultiTexCoord1f) { glad_glMultiTexCoord1f = glad_stats_real_glMultiTexCoord1f; glad_stats_real_glMultiTexCoord1f = 0; }
+	if (count && glad_glMultiTexCoord1fv && glad_glMultiTexCoord1fv != glad_stats_impl_glMultiTexCoord1fv) { glad_stats_real_glMultiTexCoord1fv = glad_glMultiTexCoord1fv; glad_glMultiTexCoord1fv = glad_stats_impl_glMultiTexCoord1fv; }
+	else if (!count && glad_stats_real_glMultiTexCoord1fv) { glad_glMultiTexCoord1fv = glad_stats_real_glMultiTexCoord1fv; glad_stats_real_glMultiTexCoord1fv = 0; }
+	if (count && glad_glMultiTexCoord1i && glad_glMultiTexCoord1i != glad_stats_impl_glMultiTexCoord1i) { glad_stats_real_glMultiTexCoord1i = glad_glMultiTexCoord1i; glad_glMultiTexCoord1i = glad_stats_impl_glMultiTexCoord1i; }
+	else if (!count && glad_stats_real_glMultiTexCoord1i) { glad_glMultiTexCoord1i = glad_stats_real_glMultiTexCoord1i; glad_stats_real_glMultiTexCoord1i = 0; }
+	if (count && glad_glMultiTexCoord1iv && glad_glMultiTexCoord1iv != glad_stats_impl_glMultiTexCoord1iv) { glad_stats_real_glMultiTexCoord1iv = glad_glMultiTexCoord1iv; glad_glMultiTexCoord1iv = glad_stats_impl_glMultiTexCoord1iv; }
+	else if (!count && glad_stats_real_glMultiTexCoord1iv) { glad_glMultiTexCoord1iv = glad_stats_real_glMultiTexCoord1iv; glad_stats_real_glMultiTexCoord1iv = 0; }
+	if (count && glad_glMultiTexCoord1s && glad_glMultiTexCoord1s != glad_stats_impl_glMultiTexCoord1s) { glad_stats_real_glMultiTexCoord1s = glad_glMultiTexCoord1s; glad_glMultiTexCoord1s = glad_stats_impl_glMultiTexCoord1s; }
+	else if (!count && glad_stats_real_glMultiTexCoord1s) { glad_glMultiTexCoord1s = glad_stats_real_glMultiTexCoord1s; glad_stats_real_glMultiTexCoord1s = 0; }
+	if (count && glad_glMultiTexCoord1sv && glad_glMultiTexCoord1sv != glad_stats_impl_glMultiTexCoord1sv) { glad_stats_real_glMultiTexCoord1sv = glad_glMultiTexCoord1sv; glad_glMultiTexCoord1sv = glad_stats_impl_glMultiTexCoord1sv; }
+	else if (!count && glad_stats_real_glMultiTexCoord1sv) { glad_glMultiTexCoord1sv = glad_stats_real_glMultiTexCoord1sv; glad_stats_real_glMultiTexCoord1sv = 0; }
+	if (count && glad_glMultiTexCoord2d && glad_glMultiTexCoord2d != glad_stats_impl_glMultiTexCoord2d) { glad_stats_real_glMultiTexCoord2d = glad_glMultiTexCoord2d; glad_glMultiTexCoord2d = glad_stats_impl_glMultiTexCoord2d; }
+	else if (!count && glad_stats_real_glMultiTexCoord2d) { glad_glMultiTexCoord2d = glad_stats_real_glMultiTexCoord2d; glad_stats_real_glMultiTexCoord2d = 0; }
+	if (count && glad_glMultiTexCoord2dv && glad_glMultiTexCoord2dv != glad_stats_impl_glMultiTexCoord2dv) { glad_stats_real_glMultiTexCoord2dv = glad_glMultiTexCoord2dv; glad_glMultiTexCoord2dv = glad_stats_impl_glMultiTexCoord2dv; }
+	else if (!count && glad_stats_real_glMultiTexCoord2dv) { glad_glMultiTexCoord2dv = glad_stats_real_glMultiTexCoord2dv; glad_stats_real_glMultiTexCoord2dv = 0; }
+	if (count && glad_glMultiTexCoord2f && glad_glMultiTexCoord2f != glad_stats_impl_glMultiTexCoord2f) { glad_stats_real_glMultiTexCoord2f = glad_glMultiTexCoord2f; glad_glMultiTexCoord2f = glad_stats_impl_glMultiTexCoord2f; }
+	else if (!count && glad_stats_real_glMultiTexCoord2f) { glad_glMultiTexCoord2f = glad_stats_real_glMultiTexCoord2f; glad_stats_real_glMultiTexCoord2f = 0; }
+	if (count && glad_glMultiTexCoord2fv && glad_glMultiTexCoord2fv != glad_stats_impl_glMultiTexCoord2fv) { glad_stats_real_glMultiTexCoord2fv = glad_glMultiTexCoord2fv; glad_glMultiTexCoord2fv = glad_stats_impl_glMultiTexCoord2fv; }
+	else if (!count && glad_stats_real_glMultiTexCoord2fv) { glad_glMultiTexCoord2fv = glad_stats_real_glMultiTexCoord2fv; glad_stats_real_glMultiTexCoord2fv = 0; }
+	if (count && glad_glMultiTexCoord2i && glad_glMultiTexCoord2i != glad_stats_impl_glMultiTexCoord2i) { glad_stats_real_glMultiTexCoord2i = glad_glMultiTexCoord2i; glad_glMultiTexCoord2i = glad_stats_impl_glMultiTexCoord2i; }
+	else if (!count && glad_stats_real_glMultiTexCoord2i) { glad_glMultiTexCoord2i = glad_stats_real_glMultiTexCoord2i; glad_stats_real_glMultiTexCoord2i = 0; }
+	if (count && glad_glMultiTexCoord2iv && glad_glMultiTexCoord2iv != glad_stats_impl_glMultiTexCoord2iv) { glad_stats_real_glMultiTexCoord2iv = glad_glMultiTexCoord2iv; glad_glMultiTexCoord2iv = glad_stats_impl_glMultiTexCoord2iv; }
+	else if (!count && glad_stats_real_glMultiTexCoord2iv) { glad_glMultiTexCoord2iv = glad_stats_real_glMultiTexCoord2iv; glad_stats_real_glMultiTexCoord2iv = 0; }
+	if (count && glad_glMultiTexCoord2s && glad_glMultiTexCoord2s != glad_stats_impl_glMultiTexCoord2s) { glad_stats_real_glMultiTexCoord2s = glad_glMultiTexCoord2s; glad_glMultiTexCoord2s = glad_stats_impl_glMultiTexCoord2s; }
+	else if (!count && glad_stats_real_glMultiTexCoord2s) { glad_glMultiTexCoord2s = glad_stats_real_glMultiTexCoord2s; glad_stats_real_glMultiTexCoord2s = 0; }
+	if (count && glad_glMultiTexCoord2sv && glad_glMultiTexCoord2sv != glad_stats_impl_glMultiTexCoord2sv) { glad_stats_real_glMultiTexCoord2sv = glad_glMultiTexCoord2sv; glad_glMultiTexCoord2sv = glad_stats_impl_glMultiTexCoord2sv; }
+	else if (!count && glad_stats_real_glMultiTexCoord2sv) { glad_glMultiTexCoord2sv = glad_stats_real_glMultiTexCoord2sv; glad_stats_real_glMultiTexCoord2sv = 0; }
+	if (count && glad_glMultiTexCoord3d && glad_glMultiTexCoord3d != glad_stats_impl_glMultiTexCoord3d) { glad_stats_real_glMultiTexCoord3d = glad_glMultiTexCoord3d; glad_glMultiTexCoord3d = glad_stats_impl_glMultiTexCoord3d; }
+	else if (!count && glad_stats_real_glMultiTexCoord3d) { glad_glMultiTexCoord3d = glad_stats_real_glMultiTexCoord3d; glad_stats_real_glMultiTexCoord3d = 0; }
+	if (count && glad_glMultiTexCoord3dv && glad_glMultiTexCoord3dv != glad_stats_impl_glMultiTexCoord3dv) { glad_stats_real_glMultiTexCoord3dv = glad_glMultiTexCoord3dv; glad_glMultiTexCoord3dv = glad_stats_impl_glMultiTexCoord3dv; }
+	else if (!count && glad_stats_real_glMultiTexCoord3dv) { glad_glMultiTexCoord3dv = glad_stats_real_glMultiTexCoord3dv; glad_stats_real_glMultiTexCoord3dv = 0; }
+	if (count && glad_glMultiTexCoord3f && glad_glMultiTexCoord3f != glad_stats_impl_glMultiTexCoord3f) { glad_stats_real_glMultiTexCoord3f = glad_glMultiTexCoord3f; glad_glMultiTexCoord3f = glad_stats_impl_glMultiTexCoord3f; }
+	else if (!count && glad_stats_real_glMultiTexCoord3f) { glad_glMultiTexCoord3f = glad_stats_real_glMultiTexCoord3f; glad_stats_real_glMultiTexCoord3f = 0; }
+	if (count && glad_glMultiTexCoord3fv && glad_glMultiTexCoord3fv != glad_stats_impl_glMultiTexCoord3fv) { glad_stats_real_glMultiTexCoord3fv = glad_glMultiTexCoord3fv; glad_glMultiTexCoord3fv = glad_stats_impl_glMultiTexCoord3fv; }
+	else if (!count && glad_stats_real_glMultiTexCoord3fv) { glad_glMultiTexCoord3fv = glad_stats_real_glMultiTexCoord3fv; glad_stats_real_glMultiTexCoord3fv = 0; }
+	if (count && glad_glMultiTexCoord3i && glad_glMultiTexCoord3i != glad_stats_impl_glMultiTexCoord3i) { glad_stats_real_glMultiTexCoord3i = glad_glMultiTexCoord3i; glad_glMultiTexCoord3i = glad_stats_impl_glMultiTexCoord3i; }
+	else if (!count && glad_stats_real_glMultiTexCoord3i) { glad_glMultiTexCoord3i = glad_stats_real_glMultiTexCoord3i; glad_stats_real_glMultiTexCoord3i = 0; }
+	if (count && glad_glMultiTexCoord3iv && glad_glMultiTexCoord3iv != glad_stats_impl_glMultiTexCoord3iv) { glad_stats_real_glMultiTexCoord3iv = glad_glMultiTexCoord3iv; glad_glMultiTexCoord3iv = glad_stats_impl_glMultiTexCoord3iv; }
+	else if (!count && glad_stats_real_glMultiTexCoord3iv) { glad_glMultiTexCoord3iv = glad_stats_real_glMultiTexCoord3iv; glad_stats_real_glMultiTexCoord3iv = 0; }
+	if (count && glad_glMultiTexCoord3s && glad_glMultiTexCoord3s != glad_stats_impl_glMultiTexCoord3s) { glad_stats_real_glMultiTexCoord3s = glad_glMultiTexCoord3s; glad_glMultiTexCoord3s = glad_stats_impl_glMultiTexCoord3s; }
+	else if (!count && glad_stats_real_glMultiTexCoord3s) { glad_glMultiTexCoord3s = glad_stats_real_glMultiTexCoord3s; glad_stats_real_glMultiTexCoord3s = 0; }
+	if (count && glad_glMultiTexCoord3sv && glad_glMultiTexCoord3sv != glad_stats_impl_glMultiTexCoord3sv) { glad_stats_real_glMultiTexCoord3sv = glad_glMultiTexCoord3sv; glad_glMultiTexCoord3sv = glad_stats_impl_glMultiTexCoord3sv; }
+	else if (!count && glad_stats_real_glMultiTexCoord3sv) { glad_glMultiTexCoord3sv = glad_stats_real_glMultiTexCoord3sv; glad_stats_real_glMultiTexCoord3sv = 0; }
+	if (count && glad_glMultiTexCoord4d && glad_glMultiTexCoord4d != glad_stats_impl_glMultiTexCoord4d) { glad_stats_real_glMultiTexCoord4d = glad_glMultiTexCoord4d; glad_glMultiTexCoord4d = glad_stats_impl_glMultiTexCoord4d; }
+	else if (!count && glad_stats_real_glMultiTexCoord4d) { glad_glMultiTexCoord4d = glad_stats_real_glMultiTexCoord4d; glad_stats_real_glMultiTexCoord4d = 0; }
+	if (count && glad_glMultiTexCoord4dv && glad_glMultiTexCoord4dv != glad_stats_impl_glMultiTexCoord4dv) { glad_stats_real_glMultiTexCoord4dv = glad_glMultiTexCoord4dv; glad_glMultiTexCoord4dv = glad_stats_impl_glMultiTexCoord4dv; }
+	else if (!count && glad_stats_real_glMultiTexCoord4dv) { glad_glMultiTexCoord4dv = glad_stats_real_glMultiTexCoord4dv; glad_stats_real_glMultiTexCoord4dv = 0; }
+	if (count && glad_glMultiTexCoord4f && glad_glMultiTexCoord4f != glad_stats_impl_glMultiTexCoord4f) { glad_stats_real_glMultiTexCoord4f = glad_glMultiTexCoord4f; glad_glMultiTexCoord4f = glad_stats_impl_glMultiTexCoord4f; }
+	else if (!count && glad_stats_real_glMultiTexCoord4f) { glad_glMultiTexCoord4f = glad_stats_real_glMultiTexCoord4f; glad_stats_real_glMultiTexCoord4f = 0; }
+	if (count && glad_glMultiTexCoord4fv && glad_glMultiTexCoord4fv != glad_stats_impl_glMultiTexCoord4fv) { glad_stats_real_glMultiTexCoord4fv = glad_glMultiTexCoord4fv; glad_glMultiTexCoord4fv = glad_stats_impl_glMultiTexCoord4fv; }
+	else if (!count && glad_stats_real_glMultiTexCoord4fv) { glad_glMultiTexCoord4fv = glad_stats_real_glMultiTexCoord4fv; glad_stats_real_glMultiTexCoord4fv = 0; }
+	if (count && glad_glMultiTexCoord4i && glad_glMultiTexCoord4i != glad_stats_impl_glMultiTexCoord4i) { glad_stats_real_glMultiTexCoord4i = glad_glMultiTexCoord4i; glad_glMultiTexCoord4i = glad_stats_impl_glMultiTexCoord4i; }
+	else if (!count && glad_stats_real_glMultiTexCoord4i) { glad_glMultiTexCoord4i = glad_stats_real_glMultiTexCoord4i; glad_stats_real_glMultiTexCoord4i = 0; }
+	if (count && glad_glMultiTexCoord4iv && glad_glMultiTexCoord4iv != glad_stats_impl_glMultiTexCoord4iv) { glad_stats_real_glMultiTexCoord4iv = glad_glMultiTexCoord4iv; glad_glMultiTexCoord4iv = glad_stats_impl_glMultiTexCoord4iv; }
+	else if (!count && glad_stats_real_glMultiTexCoord4iv) { glad_glMultiTexCoord4iv = glad_stats_real_glMultiTexCoord4iv; glad_stats_real_glMultiTexCoord4iv = 0; }
+	if (count && glad_glMultiTexCoord4s && glad_glMultiTexCoord4s != glad_stats_impl_glMultiTexCoord4s) { glad_stats_real_glMultiTexCoord4s = glad_glMultiTexCoord4s; glad_glMultiTexCoord4s = glad_stats_impl_glMultiTexCoord4s; }
+	else if (!count && glad_stats_real_glMultiTexCoord4s) { glad_glMultiTexCoord4s = glad_stats_real_glMultiTexCoord4s; glad_stats_real_glMultiTexCoord4s = 0; }
+	if (count && glad_glMultiTexCoord4sv && glad_glMultiTexCoord4sv != glad_stats_impl_glMultiTexCoord4sv) { glad_stats_real_glMultiTexCoord4sv = glad_glMultiTexCoord4sv; glad_glMultiTexCoord4sv = glad_stats_impl_glMultiTexCoord4sv; }
+	else if (!count && glad_stats_real_glMultiTexCoord4sv) { glad_glMultiTexCoord4sv = glad_stats_real_glMultiTexCoord4sv; glad_stats_real_glMultiTexCoord4sv = 0; }
+	if (count && glad_glMultiTexCoordP1ui && glad_glMultiTexCoordP1ui != glad_stats_impl_glMultiTexCoordP1ui) { glad_stats_real_glMultiTexCoordP1ui = glad_glMultiTexCoordP1ui; glad_glMultiTexCoordP1ui = glad_stats_impl_glMultiTexCoordP1ui; }
+	else if (!count && glad_stats_real_glMultiTexCoordP1ui) { glad_glMultiTexCoordP1ui = glad_stats_real_glMultiTexCoordP1ui; glad_stats_real_glMultiTexCoordP1ui = 0; }
+	if (count && glad_glMultiTexCoordP1uiv && glad_glMultiTexCoordP1uiv != glad_stats_impl_glMultiTexCoordP1uiv) { glad_stats_real_glMultiTexCoordP1uiv = glad_glMultiTexCoordP1uiv; glad_glMultiTexCoordP1uiv = glad_stats_impl_glMultiTexCoordP1uiv; }
+	else if (!count && glad_stats_real_glMultiTexCoordP1uiv) { glad_glMultiTexCoordP1uiv = glad_stats_real_glMultiTexCoordP1uiv; glad_stats_real_glMultiTexCoordP1uiv = 0; }
+	if (count && glad_glMultiTexCoordP2ui && glad_glMultiTexCoordP2ui != glad_stats_impl_glMultiTexCoordP2ui) { glad_stats_real_glMultiTexCoordP2ui = glad_glMultiTexCoordP2ui; glad_glMultiTexCoordP2ui = glad_stats_impl_glMultiTexCoordP2ui; }
+	else if (!count && glad_stats_real_glMultiTexCoordP2ui) { glad_glMultiTexCoordP2ui = glad_stats_real_glMultiTexCoordP2ui; glad_stats_real_glMultiTexCoordP2ui = 0; }
+	if (count && glad_glMultiTexCoordP2uiv && glad_glMultiTexCoordP2uiv != glad_stats_impl_glMultiTexCoordP2uiv) { glad_stats_real_glMultiTexCoordP2uiv = glad_glMultiTexCoordP2uiv; glad_glMultiTexCoordP2uiv = glad_stats_impl_glMultiTexCoordP2uiv; }
+	else if (!count && glad_stats_real_glMultiTexCoordP2uiv) { glad_glMultiTexCoordP2uiv = glad_stats_real_glMultiTexCoordP2uiv; glad_stats_real_glMultiTexCoordP2uiv = 0; }
+	if (count && glad_glMultiTexCoordP3ui && glad_glMultiTexCoordP3ui != glad_stats_impl_glMultiTexCoordP3ui) { glad_stats_real_glMultiTexCoordP3ui = glad_glMultiTexCoordP3ui; glad_glMultiTexCoordP3ui = glad_stats_impl_glMultiTexCoordP3ui; }
+	else if (!count && glad_stats_real_glMultiTexCoordP3ui) { glad_glMultiTexCoordP3ui = glad_stats_real_glMultiTexCoordP3ui; glad_stats_real_glMultiTexCoordP3ui = 0; }
+	if (count && glad_glMultiTexCoordP3uiv && glad_glMultiTexCoordP3uiv != glad_stats_impl_glMultiTexCoordP3uiv) { glad_stats_real_glMultiTexCoordP3uiv = glad_glMultiTexCoordP3uiv; glad_glMultiTexCoordP3uiv = glad_stats_impl_glMultiTexCoordP3uiv; }
+	else if (!count && glad_stats_real_glMultiTexCoordP3uiv) { glad_glMultiTexCoordP3uiv = glad_stats_real_glMultiTexCoordP3uiv; glad_stats_real_glMultiTexCoordP3uiv = 0; }
+	if (count && glad_glMultiTexCoordP4ui && glad_glMultiTexCoordP4ui != glad_stats_impl_glMultiTexCoordP4ui) { glad_stats_real_glMultiTexCoordP4ui = glad_glMultiTexCoordP4ui; glad_glMultiTexCoordP4ui = glad_stats_impl_glMultiTexCoordP4ui; }
+	else if (!count && glad_stats_real_glMultiTexCoordP4ui) { glad_glMultiTexCoordP4ui = glad_stats_real_glMultiTexCoordP4ui; glad_stats_real_glMultiTexCoordP4ui = 0; }
+	if (count && glad_glMultiTexCoordP4uiv && glad_glMultiTexCoordP4uiv != glad_stats_impl_glMultiTexCoordP4uiv) { glad_stats_real_glMultiTexCoordP4uiv = glad_glMultiTexCoordP4uiv; glad_glMultiTexCoordP4uiv = glad_stats_impl_glMultiTexCoordP4uiv; }
+	else if (!count && glad_stats_real_glMultiTexCoordP4uiv) { glad_glMultiTexCoordP4uiv = glad_stats_real_glMultiTexCoordP4uiv; glad_stats_real_glMultiTexCoordP4uiv = 0; }
+	if (count && glad_glNamedBufferData && glad_glNamedBufferData != glad_stats_impl_glNamedBufferData) { glad_stats_real_glNamedBufferData = glad_glNamedBufferData; glad_glNamedBufferData = glad_stats_impl_glNamedBufferData; }
+	else if (!count && glad_stats_real_glNamedBufferData) { glad_glNamedBufferData = glad_stats_real_glNamedBufferData; glad_stats_real_glNamedBufferData = 0; }
+	if (count && glad_glNamedBufferStorage && glad_glNamedBufferStorage != glad_stats_impl_glNamedBufferStorage) { glad_stats_real_glNamedBufferStorage = glad_glNamedBufferStorage; glad_glNamedBufferStorage = glad_stats_impl_glNamedBufferStorage; }
+	else if (!count && glad_stats_real_glNamedBufferStorage) { glad_glNamedBufferStorage = glad_stats_real_glNamedBufferStorage; glad_stats_real_glNamedBufferStorage = 0; }
+	if (count && glad_glNamedBufferStorageEXT && glad_glNamedBufferStorageEXT != glad_stats_impl_glNamedBufferStorageEXT) { glad_stats_real_glNamedBufferStorageEXT = glad_glNamedBufferStorageEXT; glad_glNamedBufferStorageEXT = glad_stats_impl_glNamedBufferStorageEXT; }
+	else if (!count && glad_stats_real_glNamedBufferStorageEXT) { glad_glNamedBufferStorageEXT = glad_stats_real_glNamedBufferStorageEXT; glad_stats_real_glNamedBufferStorageEXT = 0; }
+	if (count && glad_glNamedBufferSubData && glad_glNamedBufferSubData != glad_stats_impl_glNamedBufferSubData) { glad_stats_real_glNamedBufferSubData = glad_glNamedBufferSubData; glad_glNamedBufferSubData = glad_stats_impl_glNamedBufferSubData; }
+	else if (!count && glad_stats_real_glNamedBufferSubData) { glad_glNamedBufferSubData = glad_stats_real_glNamedBufferSubData; glad_stats_real_glNamedBufferSubData = 0; }
+	if (count && glad_glNamedFramebufferDrawBuffer && glad_glNamedFramebufferDrawBuffer != glad_stats_impl_glNamedFramebufferDrawBuffer) { glad_stats_real_glNamedFramebufferDrawBuffer = glad_glNamedFramebufferDrawBuffer; glad_glNamedFramebufferDrawBuffer = glad_stats_impl_glNamedFramebufferDrawBuffer; }
+	else if (!count && glad_stats_real_glNamedFramebufferDrawBuffer) { glad_glNamedFramebufferDrawBuffer = glad_stats_real_glNamedFramebufferDrawBuffer; glad_stats_real_glNamedFramebufferDrawBuffer = 0; }
+	if (count && glad_glNamedFramebufferDrawBuffers && glad_glNamedFramebufferDrawBuffers != glad_stats_impl_glNamedFramebufferDrawBuffers) { glad_stats_real_glNamedFramebufferDrawBuffers = glad_glNamedFramebufferDrawBuffers; glad_glNamedFramebufferDrawBuffers = glad_stats_impl_glNamedFramebufferDrawBuffers; }
+	else if (!count && glad_stats_real_glNamedFramebufferDrawBuffers) { glad_glNamedFramebufferDrawBuffers = glad_stats_real_glNamedFramebufferDrawBuffers; glad_stats_real_glNamedFramebufferDrawBuffers = 0; }
+	if (count && glad_glNamedFramebufferParameteri && glad_glNamedFramebufferParameteri != glad_stats_impl_glNamedFramebufferParameteri) { glad_stats_real_glNamedFramebufferParameteri = glad_glNamedFramebufferParameteri; glad_glNamedFramebufferParameteri = glad_stats_impl_glNamedFramebufferParameteri; }
+	else if (!count && glad_stats_real_glNamedFramebufferParameteri) { glad_glNamedFramebufferParameteri = glad_stats_real_glNamedFramebufferParameteri; glad_stats_real_glNamedFramebufferParameteri = 0; }
+	if (count && glad_glNamedFramebufferReadBuffer && glad_glNamedFramebufferReadBuffer != glad_stats_impl_glNamedFramebufferReadBuffer) { glad_stats_real_glNamedFramebufferReadBuffer = glad_glNamedFramebufferReadBuffer; glad_glNamedFramebufferReadBuffer = glad_stats_impl_glNamedFramebufferReadBuffer; }
+	else if (!count && glad_stats_real_glNamedFramebufferReadBuffer) { glad_glNamedFramebufferReadBuffer = glad_stats_real_glNamedFramebufferReadBuffer; glad_stats_real_glNamedFramebufferReadBuffer = 0; }
+	if (count && glad_glNamedFramebufferRenderbuffer && glad_glNamedFramebufferRenderbuffer != glad_stats_impl_glNamedFramebufferRenderbuffer) { glad_stats_real_glNamedFramebufferRenderbuffer = glad_glNamedFramebufferRenderbuffer; glad_glNamedFramebufferRenderbuffer = glad_stats_impl_glNamedFramebufferRenderbuffer; }
+	else if (!count && glad_stats_real_glNamedFramebufferRenderbuffer) { glad_glNamedFramebufferRenderbuffer = glad_stats_real_glNamedFramebufferRenderbuffer; glad_stats_real_glNamedFramebufferRenderbuffer = 0; }
+	if (count && glad_glNamedFramebufferTexture && glad_glNamedFramebufferTexture != glad_stats_impl_glNamedFramebufferTexture) { glad_stats_real_glNamedFramebufferTexture = glad_glNamedFramebufferTexture; glad_glNamedFramebufferTexture = glad_stats_impl_glNamedFramebufferTexture; }
+	else if (!count && glad_stats_real_glNamedFramebufferTexture) { glad_glNamedFramebufferTexture = glad_stats_real_glNamedFramebufferTexture; glad_stats_real_glNamedFramebufferTexture = 0; }
+	if (count && glad_glNamedFramebufferTextureLayer && glad_glNamedFramebufferTextureLayer != glad_stats_impl_glNamedFramebufferTextureLayer) { glad_stats_real_glNamedFramebufferTextureLayer = glad_glNamedFramebufferTextureLayer; glad_glNamedFramebufferTextureLayer = glad_stats_impl_glNamedFramebufferTextureLayer; }
+	else if (!count && glad_stats_real_glNamedFramebufferTextureLayer) { glad_glNamedFramebufferTextureLayer = glad_stats_real_glNamedFramebufferTextureLayer; glad_stats_real_glNamedFramebufferTextureLayer = 0; }
+	if (count && glad_glNamedRenderbufferStorage && glad_glNamedRenderbufferStorage != glad_stats_impl_glNamedRenderbufferStorage) { glad_stats_real_glNamedRenderbufferStorage = glad_glNamedRenderbufferStorage; glad_glNamedRenderbufferStorage = glad_stats_impl_glNamedRenderbufferStorage; }
+	else if (!count && glad_stats_real_glNamedRenderbufferStorage) { glad_glNamedRenderbufferStorage = glad_stats_real_glNamedRenderbufferStorage; glad_stats_real_glNamedRenderbufferStorage = 0; }
+	if (count && glad_glNamedRenderbufferStorageMultisample && glad_glNamedRenderbufferStorageMultisample != glad_stats_impl_glNamedRenderbufferStorageMultisample) { glad_stats_real_glNamedRenderbufferStorageMultisample = glad_glNamedRenderbufferStorageMultisample; glad_glNamedRenderbufferStorageMultisample = glad_stats_impl_glNamedRenderbufferStorageMultisample; }
+	else if (!count && glad_stats_real_glNamedRenderbufferStorageMultisample) { glad_glNamedRenderbufferStorageMultisample = glad_stats_real_glNamedRenderbufferStorageMultisample; glad_stats_real_glNamedRenderbufferStorageMultisample = 0; }
+	if (count && glad_glNewList && glad_glNewList != glad_stats_impl_glNewList) { glad_stats_real_glNewList = glad_glNewList; glad_glNewList = glad_stats_impl_glNewList; }
+	else if (!count && glad_stats_real_glNewList) { glad_glNewList = glad_stats_real_glNewList; glad_stats_real_glNewList = 0; }
+	if (count && glad_glNormal3b && glad_glNormal3b != glad_stats_impl_glNormal3b) { glad_stats_real_glNormal3b = glad_glNormal3b; glad_glNormal3b = glad_stats_impl_glNormal3b; }
+	else if (!count && glad_stats_real_glNormal3b) { glad_glNormal3b = glad_stats_real_glNormal3b; glad_stats_real_glNormal3b = 0; }
+	if (count && glad_glNormal3bv && glad_glNormal3bv != glad_stats_impl_glNormal3bv) { glad_stats_real_glNormal3bv = glad_glNormal3bv; glad_glNormal3bv = glad_stats_impl_glNormal3bv; }
+	else if (!count && glad_stats_real_glNormal3bv) { glad_glNormal3bv = glad_stats_real_glNormal3bv; glad_stats_real_glNormal3bv = 0; }
+	if (count && glad_glNormal3d && glad_glNormal3d != glad_stats_impl_glNormal3d) { glad_stats_real_glNormal3d = glad_glNormal3d; glad_glNormal3d = glad_stats_impl_glNormal3d; }
+	else if (!count && glad_stats_real_glNormal3d) { glad_glNormal3d = glad_stats_real_glNormal3d; glad_stats_real_glNormal3d = 0; }
+	if (count && glad_glNormal3dv && glad_glNormal3dv != glad_stats_impl_glNormal3dv) { glad_stats_real_glNormal3dv = glad_glNormal3dv; glad_glNormal3dv = glad_stats_impl_glNormal3dv; }
+	else if (!count && glad_stats_real_glNormal3dv) { glad_glNormal3dv = glad_stats_real_glNormal3dv; glad_stats_real_glNormal3dv = 0; }
+	if (count && glad_glNormal3f && glad_glNormal3f != glad_stats_impl_glNormal3f) { glad_stats_real_glNormal3f = glad_glNormal3f; glad_glNormal3f = glad_stats_impl_glNormal3f; }
+	else if (!count && glad_stats_real_glNormal3f) { glad_glNormal3f = glad_stats_real_glNormal3f; glad_stats_real_glNormal3f = 0; }
+	if (count && glad_glNormal3fv && glad_glNormal3fv != glad_stats_impl_glNormal3fv) { glad_stats_real_glNormal3fv = glad_glNormal3fv; glad_glNormal3fv = glad_stats_impl_glNormal3fv; }
+	else if (!count && glad_stats_real_glNormal3fv) { glad_glNormal3fv = glad_stats_real_glNormal3fv; glad_stats_real_glNormal3fv = 0; }
+	if (count && glad_glNormal3i && glad_glNormal3i != glad_stats_impl_glNormal3i) { glad_stats_real_glNormal3i = glad_glNormal3i; glad_glNormal3i = glad_stats_impl_glNormal3i; }
+	else if (!count && glad_stats_real_glNormal3i) { glad_glNormal3i = glad_stats_real_glNormal3i; glad_stats_real_glNormal3i = 0; }
+	if (count && glad_glNormal3iv && glad_glNormal3iv != glad_stats_impl_glNormal3iv) { glad_stats_real_glNormal3iv = glad_glNormal3iv; glad_glNormal3iv = glad_stats_impl_glNormal3iv; }
+	else if (!count && glad_stats_real_glNormal3iv) { glad_glNormal3iv = glad_stats_real_glNormal3iv; glad_stats_real_glNormal3iv = 0; }
+	if (count && glad_glNormal3s && glad_glNormal3s != glad_stats_impl_glNormal3s) { glad_stats_real_glNormal3s = glad_glNormal3s; glad_glNormal3s = glad_stats_impl_glNormal3s; }
+	else if (!count && glad_stats_real_glNormal3s) { glad_glNormal3s = glad_stats_real_glNormal3s; glad_stats_real_glNormal3s = 0; }
+	if (count && glad_glNormal3sv && glad_glNormal3sv != glad_stats_impl_glNormal3sv) { glad_stats_real_glNormal3sv = glad_glNormal3sv; glad_glNormal3sv = glad_stats_impl_glNormal3sv; }
+	else if (!count && glad_stats_real_glNormal3sv) { glad_glNormal3sv = glad_stats_real_glNormal3sv; glad_stats_real_glNormal3sv = 0; }
+	if (count && glad_glNormalP3ui && glad_glNormalP3ui != glad_stats_impl_glNormalP3ui) { glad_stats_real_glNormalP3ui = glad_glNormalP3ui; glad_glNormalP3ui = glad_stats_impl_glNormalP3ui; }
+	else if (!count && glad_stats_real_glNormalP3ui) { glad_glNormalP3ui = glad_stats_real_glNormalP3ui; glad_stats_real_glNormalP3ui = 0; }
+	if (count && glad_glNormalP3uiv && glad_glNormalP3uiv != glad_stats_impl_glNormalP3uiv) { glad_stats_real_glNormalP3uiv = glad_glNormalP3uiv; glad_glNormalP3uiv = glad_stats_impl_glNormalP3uiv; }
+	else if (!count && glad_stats_real_glNormalP3uiv) { glad_glNormalP3uiv = glad_stats_real_glNormalP3uiv; glad_stats_real_glNormalP3uiv = 0; }
+	if (count && glad_glNormalPointer && glad_glNormalPointer != glad_stats_impl_glNormalPointer) { glad_stats_real_glNormalPointer = glad_glNormalPointer; glad_glNormalPointer = glad_stats_impl_glNormalPointer; }
+	else if (!count && glad_stats_real_glNormalPointer) { glad_glNormalPointer = glad_stats_real_glNormalPointer; glad_stats_real_glNormalPointer = 0; }
+	if (count && glad_glObjectLabel && glad_glObjectLabel != glad_stats_impl_glObjectLabel) { glad_stats_real_glObjectLabel = glad_glObjectLabel; glad_glObjectLabel = glad_stats_impl_glObjectLabel; }
+	else if (!count && glad_stats_real_glObjectLabel) { glad_glObjectLabel = glad_stats_real_glObjectLabel; glad_stats_real_glObjectLabel = 0; }
+	if (count && glad_glObjectPtrLabel && glad_glObjectPtrLabel != glad_stats_impl_glObjectPtrLabel) { glad_stats_real_glObjectPtrLabel = glad_glObjectPtrLabel; glad_glObjectPtrLabel = glad_stats_impl_glObjectPtrLabel; }
+	else if (!count && glad_stats_real_glObjectPtrLabel) { glad_glObjectPtrLabel = glad_stats_real_glObjectPtrLabel; glad_stats_real_glObjectPtrLabel = 0; }
+	if (count && glad_glOrtho && glad_glOrtho != glad_stats_impl_glOrtho) { glad_stats_real_glOrtho = glad_glOrtho; glad_glOrtho = glad_stats_impl_glOrtho; }
+	else if (!count && glad_stats_real_glOrtho) { glad_glOrtho = glad_stats_real_glOrtho; glad_stats_real_glOrtho = 0; }
+	if (count && glad_glPassThrough && glad_glPassThrough != glad_stats_impl_glPassThrough) { glad_stats_real_glPassThrough = glad_glPassThrough; glad_glPassThrough = glad_stats_impl_glPassThrough; }
+	else if (!count && glad_stats_real_glPassThrough) { glad_glPassThrough = glad_stats_real_glPassThrough; glad_stats_real_glPassThrough = 0; }
+	if (count && glad_glPatchParameterfv && glad_glPatchParameterfv != glad_stats_impl_glPatchParameterfv) { glad_stats_real_glPatchParameterfv = glad_glPatchParameterfv; glad_glPatchParameterfv = glad_stats_impl_glPatchParameterfv; }
+	else if (!count && glad_stats_real_glPatchParameterfv) { glad_glPatchParameterfv = glad_stats_real_glPatchParameterfv; glad_stats_real_glPatchParameterfv = 0; }
+	if (count && glad_glPatchParameteri && glad_glPatchParameteri != glad_stats_impl_glPatchParameteri) { glad_stats_real_glPatchParameteri = glad_glPatchParameteri; glad_glPatchParameteri = glad_stats_impl_glPatchParameteri; }
+	else if (!count && glad_stats_real_glPatchParameteri) { glad_glPatchParameteri = glad_stats_real_glPatchParameteri; glad_stats_real_glPatchParameteri = 0; }
+	if (count && glad_glPauseTransformFeedback && glad_glPauseTransformFeedback != glad_stats_impl_glPauseTransformFeedback) { glad_stats_real_glPauseTransformFeedback = glad_glPauseTransformFeedback; glad_glPauseTransformFeedback = glad_stats_impl_glPauseTransformFeedback; }
+	else if (!count && glad_stats_real_glPauseTransformFeedback) { glad_glPauseTransformFeedback = glad_stats_real_glPauseTransformFeedback; glad_stats_real_glPauseTransformFeedback = 0; }
+	if (count && glad_glPixelMapfv && glad_glPixelMapfv != glad_stats_impl_glPixelMapfv) { glad_stats_real_glPixelMapfv = glad_glPixelMapfv; glad_glPixelMapfv = glad_stats_impl_glPixelMapfv; }
+	else if (!count && glad_stats_real_glPixelMapfv) { glad_glPixelMapfv = glad_stats_real_glPixelMapfv; glad_stats_real_glPixelMapfv = 0; }
+	if (count && glad_glPixelMapuiv && glad_glPixelMapuiv != glad_stats_impl_glPixelMapuiv) { glad_stats_real_glPixelMapuiv = glad_glPixelMapuiv; glad_glPixelMapuiv = glad_stats_impl_glPixelMapuiv; }
+	else if (!count && glad_stats_real_glPixelMapuiv) { glad_glPixelMapuiv = glad_stats_real_glPixelMapuiv; glad_stats_real_glPixelMapuiv = 0; }
+	if (count && glad_glPixelMapusv && glad_glPixelMapusv != glad_stats_impl_glPixelMapusv) { glad_stats_real_glPixelMapusv = glad_glPixelMapusv; glad_glPixelMapusv = glad_stats_impl_glPixelMapusv; }
+	else if (!count && glad_stats_real_glPixelMapusv) { glad_glPixelMapusv = glad_stats_real_glPixelMapusv; glad_stats_real_glPixelMapusv = 0; }
+	if (count && glad_glPixelStoref && glad_glPixelStoref != glad_stats_impl_glPixelStoref) { glad_stats_real_glPixelStoref = glad_glPixelStoref; glad_glPixelStoref = glad_stats_impl_glPixelStoref; }
+	else if (!count && glad_stats_real_glPixelStoref) { glad_glPixelStoref = glad_stats_real_glPixelStoref; glad_stats_real_glPixelStoref = 0; }
+	if (count && glad_glPixelStorei && glad_glPixelStorei != glad_stats_impl_glPixelStorei) { glad_stats_real_glPixelStorei = glad_glPixelStorei; glad_glPixelStorei = glad_stats_impl_glPixelStorei; }
+	else if (!count && glad_stats_real_glPixelStorei) { glad_glPixelStorei = glad_stats_real_glPixelStorei; glad_stats_real_glPixelStorei = 0; }
+	if (count && glad_glPixelTransferf && glad_glPixelTransferf != glad_stats_impl_glPixelTransferf) { glad_stats_real_glPixelTransferf = glad_glPixelTransferf; glad_glPixelTransferf = glad_stats_impl_glPixelTransferf; }
+	else if (!count && glad_stats_real_glPixelTransferf) { glad_glPixelTransferf = glad_stats_real_glPixelTransferf; glad_stats_real_glPixelTransferf = 0; }
+	if (count && glad_glPixelTransferi && glad_glPixelTransferi != glad_stats_impl_glPixelTransferi) { glad_stats_real_glPixelTransferi = glad_glPixelTransferi; glad_glPixelTransferi = glad_stats_impl_glPixelTransferi; }
+	else if (!count && glad_stats_real_glPixelTransferi) { glad_glPixelTransferi = glad_stats_real_glPixelTransferi; glad_stats_real_glPixelTransferi = 0; }
+	if (count && glad_glPixelZoom && glad_glPixelZoom != glad_stats_impl_glPixelZoom) { glad_stats_real_glPixelZoom = glad_glPixelZoom; glad_glPixelZoom = glad_stats_impl_glPixelZoom; }
+	else if (!count && glad_stats_real_glPixelZoom) { glad_glPixelZoom = glad_stats_real_glPixelZoom; glad_stats_real_glPixelZoom = 0; }
+	if (count && glad_glPointParameterf && glad_glPointParameterf != glad_stats_impl_glPointParameterf) { glad_stats_real_glPointParameterf = glad_glPointParameterf; glad_glPointParameterf = glad_stats_impl_glPointParameterf; }
+	else if (!count && glad_stats_real_glPointParameterf) { glad_glPointParameterf = glad_stats_real_glPointParameterf; glad_stats_real_glPointParameterf = 0; }
+	if (count && glad_glPointParameterfv && glad_glPointParameterfv != glad_stats_impl_glPointParameterfv) { glad_stats_real_glPointParameterfv = glad_glPointParameterfv; glad_glPointParameterfv = glad_stats_impl_glPointParameterfv; }
+	else if (!count && glad_stats_real_glPointParameterfv) { glad_glPointParameterfv = glad_stats_real_glPointParameterfv; glad_stats_real_glPointParameterfv = 0; }
+	if (count && glad_glPointParameteri && glad_glPointParameteri != glad_stats_impl_glPointParameteri) { glad_stats_real_glPointParameteri = glad_glPointParameteri; glad_glPointParameteri = glad_stats_impl_glPointParameteri; }
+	else if (!count && glad_stats_real_glPointParameteri) { glad_glPointParameteri = glad_stats_real_glPointParameteri; glad_stats_real_glPointParameteri = 0; }
+	if (count && glad_glPointParameteriv && glad_glPointParameteriv != glad_stats_impl_glPointParameteriv) { glad_stats_real_glPointParameteriv = glad_glPointParameteriv; glad_glPointParameteriv = glad_stats_impl_glPointParameteriv; }
+	else if (!count && glad_stats_real_glPointParameteriv) { glad_glPointParameteriv = glad_stats_real_glPointParameteriv; glad_stats_real_glPointParameteriv = 0; }
+	if (count && glad_glPointSize && glad_glPointSize != glad_stats_impl_glPointSize) { glad_stats_real_glPointSize = glad_glPointSize; glad_glPointSize = glad_stats_impl_glPointSize; }
+	else if (!count && glad_stats_real_glPointSize) { glad_glPointSize = glad_stats_real_glPointSize; glad_stats_real_glPointSize = 0; }
+	if (count && glad_glPolygonMode && glad_glPolygonMode != glad_stats_impl_glPolygonMode) { glad_stats_real_glPolygonMode = glad_glPolygonMode; glad_glPolygonMode = glad_stats_impl_glPolygonMode; }
+	else if (!count && glad_stats_real_glPolygonMode) { glad_glPolygonMode = glad_stats_real_glPolygonMode; glad_stats_real_glPolygonMode = 0; }
+	if (count && glad_glPolygonOffset && glad_glPolygonOffset != glad_stats_impl_glPolygonOffset) { glad_stats_real_glPolygonOffset = glad_glPolygonOffset; glad_glPolygonOffset = glad_stats_impl_glPolygonOffset; }
+	else if (!count && glad_stats_real_glPolygonOffset) { glad_glPolygonOffset = glad_stats_real_glPolygonOffset; glad_stats_real_glPolygonOffset = 0; }
+	if (count && glad_glPolygonOffsetClamp && glad_glPolygonOffsetClamp != glad_stats_impl_glPolygonOffsetClamp) { glad_stats_real_glPolygonOffsetClamp = glad_glPolygonOffsetClamp; glad_glPolygonOffsetClamp = glad_stats_impl_glPolygonOffsetClamp; }
+	else if (!count && glad_stats_real_glPolygonOffsetClamp) { glad_glPolygonOffsetClamp = glad_stats_real_glPolygonOffsetClamp; glad_stats_real_glPolygonOffsetClamp = 0; }
+	if (count && glad_glPolygonStipple && glad_glPolygonStipple != glad_stats_impl_glPolygonStipple) { glad_stats_real_glPolygonStipple = glad_glPolygonStipple; glad_glPolygonStipple = glad_stats_impl_glPolygonStipple; }
+	else if (!count && glad_stats_real_glPolygonStipple) { glad_glPolygonStipple = glad_stats_real_glPolygonStipple; glad_stats_real_glPolygonStipple = 0; }
+	if (count && glad_glPopAttrib && glad_glPopAttrib != glad_stats_impl_glPopAttrib) { glad_stats_real_glPopAttrib = glad_glPopAttrib; glad_glPopAttrib = glad_stats_impl_glPopAttrib; }
+	else if (!count && glad_stats_real_glPopAttrib) { glad_glPopAttrib = glad_stats_real_glPopAttrib; glad_stats_real_glPopAttrib = 0; }
+	if (count && glad_glPopClientAttrib && glad_glPopClientAttrib != glad_stats_impl_glPopClientAttrib) { glad_stats_real_glPopClientAttrib = glad_glPopClientAttrib; glad_glPopClientAttrib = glad_stats_impl_glPopClientAttrib; }
+	else if (!count && glad_stats_real_glPopClientAttrib) { glad_glPopClientAttrib = glad_stats_real_glPopClientAttrib; glad_stats_real_glPopClientAttrib = 0; }
+	if (count && glad_glPopDebugGroup && glad_glPopDebugGroup != glad_stats_impl_glPopDebugGroup) { glad_stats_real_glPopDebugGroup = glad_glPopDebugGroup; glad_glPopDebugGroup = glad_stats_impl_glPopDebugGroup; }
+	else if (!count && glad_stats_real_glPopDebugGroup) { glad_glPopDebugGroup = glad_stats_real_glPopDebugGroup; glad_stats_real_glPopDebugGroup = 0; }
+	if (count && glad_glPopMatrix && glad_glPopMatrix != glad_stats_impl_glPopMatrix) { glad_stats_real_glPopMatrix = glad_glPopMatrix; glad_glPopMatrix = glad_stats_impl_glPopMatrix; }
+	else if (!count && glad_stats_real_glPopMatrix) { glad_glPopMatrix = glad_stats_real_glPopMatrix; glad_stats_real_glPopMatrix = 0; }
+	if (count && glad_glPopName && glad_glPopName != glad_stats_impl_glPopName) { glad_stats_real_glPopName = glad_glPopName; glad_glPopName = glad_stats_impl_glPopName; }
+	else if (!count && glad_stats_real_glPopName) { glad_glPopName = glad_stats_real_glPopName; glad_stats_real_glPopName = 0; }
+	if (count && glad_glPrimitiveRestartIndex && glad_glPrimitiveRestartIndex != glad_stats_impl_glPrimitiveRestartIndex) { glad_stats_real_glPrimitiveRestartIndex = glad_glPrimitiveRestartIndex; glad_glPrimitiveRestartIndex = glad_stats_impl_glPrimitiveRestartIndex; }
+	else if (!count && glad_stats_real_glPrimitiveRestartIndex) { glad_glPrimitiveRestartIndex = glad_stats_real_glPrimitiveRestartIndex; glad_stats_real_glPrimitiveRestartIndex = 0; }
+	if (count && glad_glPrioritizeTextures && glad_glPrioritizeTextures != glad_stats_impl_glPrioritizeTextures) { glad_stats_real_glPrioritizeTextures = glad_glPrioritizeTextures; glad_glPrioritizeTextures = glad_stats_impl_glPrioritizeTextures; }
+	else if (!count && glad_stats_real_glPrioritizeTextures) { glad_glPrioritizeTextures = glad_stats_real_glPrioritizeTextures; glad_stats_real_glPrioritizeTextures = 0; }
+	if (count && glad_glProgramBinary && glad_glProgramBinary != glad_stats_impl_glProgramBinary) { glad_stats_real_glProgramBinary = glad_glProgramBinary; glad_glProgramBinary = glad_stats_impl_glProgramBinary; }
+	else if (!count && glad_stats_real_glProgramBinary) { glad_glProgramBinary = glad_stats_real_glProgramBinary; glad_stats_real_glProgramBinary = 0; }
+	if (count && glad_glProgramParameteri && glad_glProgramParameteri != glad_stats_impl_glProgramParameteri) { glad_stats_real_glProgramParameteri = glad_glProgramParameteri; glad_glProgramParameteri = glad_stats_impl_glProgramParameteri; }
+	else if (!count && glad_stats_real_glProgramParameteri) { glad_glProgramParameteri = glad_stats_real_glProgramParameteri; glad_stats_real_glProgramParameteri = 0; }
+	if (count && glad_glProgramUniform1d && glad_glProgramUniform1d != glad_stats_impl_glProgramUniform1d) { glad_stats_real_glProgramUniform1d = glad_glProgramUniform1d; glad_glProgramUniform1d = glad_stats_impl_glProgramUniform1d; }
+	else if (!count && glad_stats_real_glProgramUniform1d) { glad_glProgramUniform1d = glad_stats_real_glProgramUniform1d; glad_stats_real_glProgramUniform1d = 0; }
+	if (count && glad_glProgramUniform1dv && glad_glProgramUniform1dv != glad_stats_impl_glProgramUniform1dv) { glad_stats_real_glProgramUniform1dv = glad_glProgramUniform1dv; glad_glProgramUniform1dv = glad_stats_impl_glProgramUniform1dv; }
+	else if (!count && glad_stats_real_glProgramUniform1dv) { glad_glProgramUniform1dv = glad_stats_real_glProgramUniform1dv; glad_stats_real_glProgramUniform1dv = 0; }
+	if (count && glad_glProgramUniform1f && glad_glProgramUniform1f != glad_stats_impl_glProgramUniform1f) { glad_stats_real_glProgramUniform1f = glad_glProgramUniform1f; glad_glProgramUniform1f = glad_stats_impl_glProgramUniform1f; }
+	else if (!count && glad_stats_real_glProgramUniform1f) { glad_glProgramUniform1f = glad_stats_real_glProgramUniform1f; glad_stats_real_glProgramUniform1f = 0; }
+	if (count && glad_glProgramUniform1fv && glad_glProgramUniform1fv != glad_stats_impl_glProgramUniform1fv) { glad_stats_real_glProgramUniform1fv = glad_glProgramUniform1fv; glad_glProgramUniform1fv = glad_stats_impl_glProgramUniform1fv; }
+	else if (!count && glad_stats_real_glProgramUniform1fv) { glad_glProgramUniform1fv = glad_stats_real_glProgramUniform1fv; glad_stats_real_glProgramUniform1fv = 0; }
+	if (count && glad_glProgramUniform1i && glad_glProgramUniform1i != glad_stats_impl_glProgramUniform1i) { glad_stats_real_glProgramUniform1i = glad_glProgramUniform1i; glad_glProgramUniform1i = glad_stats_impl_glProgramUniform1i; }
+	else if (!count && glad_stats_real_glProgramUniform1i) { glad_glProgramUniform1i = glad_stats_real_glProgramUniform1i; glad_stats_real_glProgramUniform1i = 0; }
+	if (count && glad_glProgramUniform1iv && glad_glProgramUniform1iv != glad_stats_impl_glProgramUniform1iv) { glad_stats_real_glProgramUniform1iv = glad_glProgramUniform1iv; glad_glProgramUniform1iv = glad_stats_impl_glProgramUniform1iv; }
+	else if (!count && glad_stats_real_glProgramUniform1iv) { glad_glProgramUniform1iv = glad_stats_real_glProgramUniform1iv; glad_stats_real_glProgramUniform1iv = 0; }
+	if (count && glad_glProgramUniform1ui && glad_glProgramUniform1ui != glad_stats_impl_glProgramUniform1ui) { glad_stats_real_glProgramUniform1ui = glad_glProgramUniform1ui; glad_glProgramUniform1ui = glad_stats_impl_glProgramUniform1ui; }
+	else if (!count && glad_stats_real_glProgramUniform1ui) { glad_glProgramUniform1ui = glad_stats_real_glProgramUniform1ui; glad_stats_real_glProgramUniform1ui = 0; }
+	if (count && glad_glProgramUniform1uiv && glad_glProgramUniform1uiv != glad_stats_impl_glProgramUniform1uiv) { glad_stats_real_glProgramUniform1uiv = glad_glProgramUniform1uiv; glad_glProgramUniform1uiv = glad_stats_impl_glProgramUniform1uiv; }
+	else if (!count && glad_stats_real_glProgramUniform1uiv) { glad_glProgramUniform1uiv = glad_stats_real_glProgramUniform1uiv; glad_stats_real_glProgramUniform1uiv = 0; }
+	if (count && glad_glProgramUniform2d && glad_glProgramUniform2d != glad_stats_impl_glProgramUniform2d) { glad_stats_real_glProgramUniform2d = glad_glProgramUniform2d; glad_glProgramUniform2d = glad_stats_impl_glProgramUniform2d; }
+	else if (!count && glad_stats_real_glProgramUniform2d) { glad_glProgramUniform2d = glad_stats_real_glProgramUniform2d; glad_stats_real_glProgramUniform2d = 0; }
+	if (count && glad_glProgramUniform2dv && glad_glProgramUniform2dv != glad_stats_impl_glProgramUniform2dv) { glad_stats_real_glProgramUniform2dv = glad_glProgramUniform2dv; glad_glProgramUniform2dv = glad_stats_impl_glProgramUniform2dv; }
+	else if (!count && glad_stats_real_glProgramUniform2dv) { glad_glProgramUniform2dv = glad_stats_real_glProgramUniform2dv; glad_stats_real_glProgramUniform2dv = 0; }
+	if (count && glad_glProgramUniform2f && glad_glProgramUniform2f != glad_stats_impl_glProgramUniform2f) { glad_stats_real_glProgramUniform2f = glad_glProgramUniform2f; glad_glProgramUniform2f = glad_stats_impl_glProgramUniform2f; }
+	else if (!count && glad_stats_real_glProgramUniform2f) { glad_glProgramUniform2f = glad_stats_real_glProgramUniform2f; glad_stats_real_glProgramUniform2f = 0; }
+	if (count && glad_glProgramUniform2fv && glad_glProgramUniform2fv != glad_stats_impl_glProgramUniform2fv) { glad_stats_real_glProgramUniform2fv = glad_glProgramUniform2fv; glad_glProgramUniform2fv = glad_stats_impl_glProgramUniform2fv; }
+	else if (!count && glad_stats_real_glProgramUniform2fv) { glad_glProgramUniform2fv = glad_stats_real_glProgramUniform2fv; glad_stats_real_glProgramUniform2fv = 0; }
+	if (count && glad_glProgramUniform2i && glad_glProgramUniform2i != glad_stats_impl_glProgramUniform2i) { glad_stats_real_glProgramUniform2i = glad_glProgramUniform2i; glad_glProgramUniform2i = glad_stats_impl_glProgramUniform2i; }
+	else if (!count && glad_stats_real_glProgramUniform2i) { glad_glProgramUniform2i = glad_stats_real_glProgramUniform2i; glad_stats_real_glProgramUniform2i = 0; }
+	if (count && glad_glProgramUniform2iv && glad_glProgramUniform2iv != glad_stats_impl_glProgramUniform2iv) { glad_stats_real_glProgramUniform2iv = glad_glProgramUniform2iv; glad_glProgramUniform2iv = glad_stats_impl_glProgramUniform2iv; }
+	else if (!count && glad_stats_real_glProgramUniform2iv) { glad_glProgramUniform2iv = glad_stats_real_glProgramUniform2iv; glad_stats_real_glProgramUniform2iv = 0; }
+	if (count && glad_glProgramUniform2ui && glad_glProgramUniform2ui != glad_stats_impl_glProgramUniform2ui) { glad_stats_real_glProgramUniform2ui = glad_glProgramUniform2ui; glad_glProgramUniform2ui = glad_stats_impl_glProgramUniform2ui; }
+	else if (!count && glad_stats_real_glProgramUniform2ui) { glad_glProgramUniform2ui = glad_stats_real_glProgramUniform2ui; glad_stats_real_glProgramUniform2ui = 0; }
+	if (count && glad_glProgramUniform2uiv && glad_glProgramUniform2uiv != glad_stats_impl_glProgramUniform2uiv) { glad_stats_real_glProgramUniform2uiv = glad_glProgramUniform2uiv; glad_glProgramUniform2uiv = glad_stats_impl_glProgramUniform2uiv; }
+	else if (!count && glad_stats_real_glProgramUniform2uiv) { glad_glProgramUniform2uiv = glad_stats_real_glProgramUniform2uiv; glad_stats_real_glProgramUniform2uiv = 0; }
+	if (count && glad_glProgramUniform3d && glad_glProgramUniform3d != glad_stats_impl_glProgramUniform3d) { glad_stats_real_glProgramUniform3d = glad_glProgramUniform3d; glad_glProgramUniform3d = glad_stats_impl_glProgramUniform3d; }
+	else if (!count && glad_stats_real_glProgramUniform3d) { glad_glProgramUniform3d = glad_stats_real_glProgramUniform3d; glad_stats_real_glProgramUniform3d = 0; }
+	if (count && glad_glProgramUniform3dv && glad_glProgramUniform3dv != glad_stats_impl_glProgramUniform3dv) { glad_stats_real_glProgramUniform3dv = glad_glProgramUniform3dv; glad_glProgramUniform3dv = glad_stats_impl_glProgramUniform3dv; }
+	else if (!count && glad_stats_real_glProgramUniform3dv) { glad_glProgramUniform3dv = glad_stats_real_glProgramUniform3dv; glad_stats_real_glProgramUniform3dv = 0; }
+	if (count && glad_glProgramUniform3f && glad_glProgramUniform3f != glad_stats_impl_glProgramUniform3f) { glad_stats_real_glProgramUniform3f = glad_glProgramUniform3f; glad_glProgramUniform3f = glad_stats_impl_glProgramUniform3f; }
+	else if (!count && glad_stats_real_glProgramUniform3f) { glad_glProgramUniform3f = glad_stats_real_glProgramUniform3f; glad_stats_real_glProgramUniform3f = 0; }
+	if (count && glad_glProgramUniform3fv && glad_glProgramUniform3fv != glad_stats_impl_glProgramUniform3fv) { glad_stats_real_glProgramUniform3fv = glad_glProgramUniform3fv; glad_glProgramUniform3fv = glad_stats_impl_glProgramUniform3fv; }
+	else if (!count && glad_stats_real_glProgramUniform3fv) { glad_glProgramUniform3fv = glad_stats_real_glProgramUniform3fv; glad_stats_real_glProgramUniform3fv = 0; }
+	if (count && glad_glProgramUniform3i && glad_glProgramUniform3i != glad_stats_impl_glProgramUniform3i) { glad_stats_real_glProgramUniform3i = glad_glProgramUniform3i; glad_glProgramUniform3i = glad_stats_impl_glProgramUniform3i; }
+	else if (!count && glad_stats_real_glProgramUniform3i) { glad_glProgramUniform3i = glad_stats_real_glProgramUniform3i; glad_stats_real_glProgramUniform3i = 0; }
+	if (count && glad_glProgramUniform3iv && glad_glProgramUniform3iv != glad_stats_impl_glProgramUniform3iv) { glad_stats_real_glProgramUniform3iv = glad_glProgramUniform3iv; glad_glProgramUniform3iv = glad_stats_impl_glProgramUniform3iv; }
+	else if (!count && glad_stats_real_glProgramUniform3iv) { glad_glProgramUniform3iv = glad_stats_real_glProgramUniform3iv; glad_stats_real_glProgramUniform3iv = 0; }
+	if (count && glad_glProgramUniform3ui && glad_glProgramUniform3ui != glad_stats_impl_glProgramUniform3ui) { glad_stats_real_glProgramUniform3ui = glad_glProgramUniform3ui; glad_glProgramUniform3ui = glad_stats_impl_glProgramUniform3ui; }
+	else if (!count && glad_stats_real_glProgramUniform3ui) { glad_glProgramUniform3ui = glad_stats_real_glProgramUniform3ui; glad_stats_real_glProgramUniform3ui = 0; }
+	if (count && glad_glProgramUniform3uiv && glad_glProgramUniform3uiv != glad_stats_impl_glProgramUniform3uiv) { glad_stats_real_glProgramUniform3uiv = glad_glProgramUniform3uiv; glad_glProgramUniform3uiv = glad_stats_impl_glProgramUniform3uiv; }
+	else if (!count && glad_stats_real_glProgramUniform3uiv) { glad_glProgramUniform3uiv = glad_stats_real_glProgramUniform3uiv; glad_stats_real_glProgramUniform3uiv = 0; }
+	if (count && glad_glProgramUniform4d && glad_glProgramUniform4d != glad_stats_impl_glProgramUniform4d) { glad_stats_real_glProgramUniform4d = glad_glProgramUniform4d; glad_glProgramUniform4d = glad_stats_impl_glProgramUniform4d; }
+	else if (!count && glad_stats_real_glProgramUniform4d) { glad_glProgramUniform4d = glad_stats_real_glProgramUniform4d; glad_stats_real_glProgramUniform4d = 0; }
+	if (count && glad_glProgramUniform4dv && glad_glProgramUniform4dv != glad_stats_impl_glProgramUniform4dv) { glad_stats_real_glProgramUniform4dv = glad_glProgramUniform4dv; glad_glProgramUniform4dv = glad_stats_impl_glProgramUniform4dv; }
+	else if (!count && glad_stats_real_glProgramUniform4dv) { glad_glProgramUniform4dv = glad_stats_real_glProgramUniform4dv; glad_stats_real_glProgramUniform4dv = 0; }
+	if (count && glad_glProgramUniform4f && glad_glProgramUniform4f != glad_stats_impl_glProgramUniform4f) { glad_stats_real_glProgramUniform4f = glad_glProgramUniform4f; glad_glProgramUniform4f = glad_stats_impl_glProgramUniform4f; }
+	else if (!count && glad_stats_real_glProgramUniform4f) { glad_glProgramUniform4f = glad_stats_real_glProgramUniform4f; glad_stats_real_glProgramUniform4f = 0; }
+	if (count && glad_glProgramUniform4fv && glad_glProgramUniform4fv != glad_stats_impl_glProgramUniform4fv) { glad_stats_real_glProgramUniform4fv = glad_glProgramUniform4fv; glad_glProgramUniform4fv = glad_stats_impl_glProgramUniform4fv; }
+	else if (!count && glad_stats_real_glProgramUniform4fv) { glad_glProgramUniform4fv = glad_stats_real_glProgramUniform4fv; glad_stats_real_glProgramUniform4fv = 0; }
+	if (count && glad_glProgramUniform4i && glad_glProgramUniform4i != glad_stats_impl_glProgramUniform4i) { glad_stats_real_glProgramUniform4i = glad_glProgramUniform4i; glad_glProgramUniform4i = glad_stats_impl_glProgramUniform4i; }
+	else if (!count && glad_stats_real_glProgramUniform4i) { glad_glProgramUniform4i = glad_stats_real_glProgramUniform4i; glad_stats_real_glProgramUniform4i = 0; }
+	if (count && glad_glProgramUniform4iv && glad_glProgramUniform4iv != glad_stats_impl_glProgramUniform4iv) { glad_stats_real_glProgramUniform4iv = glad_glProgramUniform4iv; glad_glProgramUniform4iv = glad_stats_impl_glProgramUniform4iv; }
+	else if (!count && glad_stats_real_glProgramUniform4iv) { glad_glProgramUniform4iv = glad_stats_real_glProgramUniform4iv; glad_stats_real_glProgramUniform4iv = 0; }
+	if (count && glad_glProgramUniform4ui && glad_glProgramUniform4ui != glad_stats_impl_glProgramUniform4ui) { glad_stats_real_glProgramUniform4ui = glad_glProgramUniform4ui; glad_glProgramUniform4ui = glad_stats_impl_glProgramUniform4ui; }
+	else if (!count && glad_stats_real_glProgramUniform4ui) { glad_glProgramUniform4ui = glad_stats_real_glProgramUniform4ui; glad_stats_real_glProgramUniform4ui = 0; }
+	if (count && glad_glProgramUniform4uiv && glad_glProgramUniform4uiv != glad_stats_impl_glProgramUniform4uiv) { glad_stats_real_glProgramUniform4uiv = glad_glProgramUniform4uiv; glad_glProgramUniform4uiv = glad_stats_impl_glProgramUniform4uiv; }
+	else if (!count && glad_stats_real_glProgramUniform4uiv) { glad_glProgramUniform4uiv = glad_stats_real_glProgramUniform4uiv; glad_stats_real_glProgramUniform4uiv = 0; }
+	if (count && glad_glProgramUniformHandleui64ARB && glad_glProgramUniformHandleui64ARB != glad_stats_impl_glProgramUniformHandleui64ARB) { glad_stats_real_glProgramUniformHandleui64ARB = glad_glProgramUniformHandleui64ARB; glad_glProgramUniformHandleui64ARB = glad_stats_impl_glProgramUniformHandleui64ARB; }
+	else if (!count && glad_stats_real_glProgramUniformHandleui64ARB) { glad_glProgramUniformHandleui64ARB = glad_stats_real_glProgramUniformHandleui64ARB; glad_stats_real_glProgramUniformHandleui64ARB = 0; }
+	if (count && glad_glProgramUniformHandleui64vARB && glad_glProgramUniformHandleui64vARB != glad_stats_impl_glProgramUniformHandleui64vARB) { glad_stats_real_glProgramUniformHandleui64vARB = glad_glProgramUniformHandleui64vARB; glad_glProgramUniformHandleui64vARB = glad_stats_impl_glProgramUniformHandleui64vARB; }
+	else if (!count && glad_stats_real_glProgramUniformHandleui64vARB) { glad_glProgramUniformHandleui64vARB = glad_stats_real_glProgramUniformHandleui64vARB; glad_stats_real_glProgramUniformHandleui64vARB = 0; }
+	if (count && glad_glProgramUniformMatrix2dv && glad_glProgramUniformMatrix2dv != glad_stats_impl_glProgramUniformMatrix2dv) { glad_stats_real_glProgramUniformMatrix2dv = glad_glProgramUniformMatrix2dv; glad_glProgramUniformMatrix2dv = glad_stats_impl_glProgramUniformMatrix2dv; }
+	else if (!count && glad_stats_real_glProgramUniformMatrix2dv) { glad_glProgramUniformMatrix2dv = glad_stats_real_glProgramUniformMatrix2dv; glad_stats_real_glProgramUniformMatrix2dv = 0; }
+	if (count && glad_glProgramUniformMatrix2fv && glad_glProgramUniformMatrix2fv != glad_stats_impl_glProgramUniformMatrix2fv) { glad_stats_real_glProgramUniformMatrix2fv = glad_glProgramUniformMatrix2fv; glad_glProgramUniformMatrix2fv = glad_stats_impl_glProgramUniformMatrix2fv; }
+	else if (!count && glad_stats_real_glProgramUniformMatrix2fv) { glad_glProgramUniformMatrix2fv = glad_stats_real_glProgramUniformMatrix2fv; glad_stats_real_glProgramUniformMatrix2fv = 0; }
+	if (count && glad_glProgramUniformMatrix2x3dv && glad_glProgramUniformMatrix2x3dv != glad_stats_impl_glProgramUniformMatrix2x3dv) { glad_stats_real_glProgramUniformMatrix2x3dv = glad_glProgramUniformMatrix2x3dv; glad_glProgramUniformMatrix2x3dv = glad_stats_impl_glProgramUniformMatrix2x3dv; }
+	else if (!count && glad_stats_real_glProgramUniformMatrix2x3dv) { glad_glProgramUniformMatrix2x3dv = glad_stats_real_glProgramUniformMatrix2x3dv; glad_stats_real_glProgramUniformMatrix2x3dv = 0; }
+	if (count && glad_glProgramUniformMatrix2x3fv && glad_glProgramUniformMatrix2x3fv != glad_stats_impl_glProgramUniformMatrix2x3fv) { glad_stats_real_glProgramUniformMatrix2x3fv = glad_glProgramUniformMatrix2x3fv; glad_glProgramUniformMatrix2x3fv = glad_stats_impl_glProgramUniformMatrix2x3fv; }
+	else if (!count && glad_stats_real_glProgramUniformMatrix2x3fv) { glad_glProgramUniformMatrix2x3fv = glad_stats_real_glProgramUniformMatrix2x3fv; glad_stats_real_glProgramUniformMatrix2x3fv = 0; }
+	if (count && glad_glProgramUniformMatrix2x4dv && glad_glProgramUniformMatrix2x4dv != glad_stats_impl_glProgramUniformMatrix2x4dv) { glad_stats_real_glProgramUniformMatrix2x4dv = glad_glProgramUniformMatrix2x4dv; glad_glProgramUniformMatrix2x4dv = glad_stats_impl_glProgramUniformMatrix2x4dv; }
+	else if (!count && glad_stats_real_glProgramUniformMatrix2x4dv) { glad_glProgramUniformMatrix2x4dv = glad_stats_real_glProgramUniformMatrix2x4dv; glad_stats_real_glProgramUniformMatrix2x4dv = 0; }
+	if (count && glad_glProgramUniformMatrix2x4fv && glad_glProgramUniformMatrix2x4fv != glad_stats_impl_glProgramUniformMatrix2x4fv) { glad_stats_real_glProgramUniformMatrix2x4fv = glad_glProgramUniformMatrix2x4fv; glad_glProgramUniformMatrix2x4fv = glad_stats_impl_glProgramUniformMatrix2x4fv; }
+	else if (!count && glad_stats_real_glProgramUniformMatrix2x4fv) { glad_glProgramUniformMatrix2x4fv = glad_stats_real_glProgramUniformMatrix2x4fv; glad_stats_real_glProgramUniformMatrix2x4fv = 0; }
+	if (count && glad_glProgramUniformMatrix3dv && glad_glProgramUniformMatrix3dv != glad_stats_impl_glProgramUniformMatrix3dv) { glad_stats_real_glProgramUniformMatrix3dv = glad_glProgramUniformMatrix3dv; glad_glProgramUniformMatrix3dv = glad_stats_impl_glProgramUniformMatrix3dv; }
+	else if (!count && glad_stats_real_glProgramUniformMatrix3dv) { glad_glProgramUniformMatrix3dv = glad_stats_real_glProgramUniformMatrix3dv; glad_stats_real_glProgramUniformMatrix3dv = 0; }
+	if (count && glad_glProgramUniformMatrix3fv && glad_glProgramUniformMatrix3fv != glad_stats_impl_glProgramUniformMatrix3fv) { glad_stats_real_glProgramUniformMatrix3fv = glad_glProgramUniformMatrix3fv; glad_glProgramUniformMatrix3fv = glad_stats_impl_glProgramUniformMatrix3fv; }
+	else if (!count && glad_stats_real_glProgramUniformMatrix3fv) { glad_glProgramUniformMatrix3fv = glad_stats_real_glProgramUniformMatrix3fv; glad_stats_real_glProgramUniformMatrix3fv = 0; }
+	if (count && glad_glProgramUniformMatrix3x2dv && glad_glProgramUniformMatrix3x2dv != glad_stats_impl_glProgramUniformMatrix3x2dv) { glad_stats_real_glProgramUniformMatrix3x2dv = glad_glProgramUniformMatrix3x2dv; glad_glProgramUniformMatrix3x2dv = glad_stats_impl_glProgramUniformMatrix3x2dv; }
+	else if (!count && glad_stats_real_glProgramUniformMatrix3x2dv) { glad_glProgramUniformMatrix3x2dv = glad_stats_real_glProgramUniformMatrix3x2dv; glad_stats_real_glProgramUniformMatrix3x2dv = 0; }
+	if (count && glad_glProgramUniformMatrix3x2fv && glad_glProgramUniformMatrix3x2fv != glad_stats_impl_glProgramUniformMatrix3x2fv) { glad_stats_real_glProgramUniformMatrix3x2fv = glad_glProgramUniformMatrix3x2fv; glad_glProgramUniformMatrix3x2fv = glad_stats_impl_glProgramUniformMatrix3x2fv; }
+	else if (!count && glad_stats_real_glProgramUniformMatrix3x2fv) { glad_glProgramUniformMatrix3x2fv = glad_stats_real_glProgramUniformMatrix3x2fv; glad_stats_real_glProgramUniformMatrix3x2fv = 0; }
+	if (count && glad_glProgramUniformMatrix3x4dv && glad_glProgramUniformMatrix3x4dv != glad_stats_impl_glProgramUniformMatrix3x4dv) { glad_stats_real_glProgramUniformMatrix3x4dv = glad_glProgramUniformMatrix3x4dv; glad_glProgramUniformMatrix3x4dv = glad_stats_impl_glProgramUniformMatrix3x4dv; }
+	else if (!count && glad_stats_real_glProgramUniformMatrix3x4dv) { glad_glProgramUniformMatrix3x4dv = glad_stats_real_glProgramUniformMatrix3x4dv; glad_stats_real_glProgramUniformMatrix3x4dv = 0; }
+	if (count && glad_glProgramUniformMatrix3x4fv && glad_glProgramUniformMatrix3x4fv != glad_stats_impl_glProgramUniformMatrix3x4fv) { glad_stats_real_glProgramUniformMatrix3x4fv = glad_glProgramUniformMatrix3x4fv; glad_glProgramUniformMatrix3x4fv = glad_stats_impl_glProgramUniformMatrix3x4fv; }
+	else if (!count && glad_stats_real_glProgramUniformMatrix3x4fv) { glad_glProgramUniformMatrix3x4fv = glad_stats_real_glProgramUniformMatrix3x4fv; glad_stats_real_glProgramUniformMatrix3x4fv = 0; }
+	if (count && glad_glProgramUniformMatrix4dv && glad_glProgramUniformMatrix4dv != glad_stats_impl_glProgramUniformMatrix4dv) { glad_stats_real_glProgramUniformMatrix4dv = glad_glProgramUniformMatrix4dv; glad_glProgramUniformMatrix4dv = glad_stats_impl_glProgramUniformMatrix4dv; }
+	else if (!count && glad_stats_real_glProgramUniformMatrix4dv) { glad_glProgramUniformMatrix4dv = glad_stats_real_glProgramUniformMatrix4dv; glad_stats_real_glProgramUniformMatrix4dv = 0; }
+	if (count && glad_glProgramUniformMatrix4fv && glad_glProgramUniformMatrix4fv != glad_stats_impl_glProgramUniformMatrix4fv) { glad_stats_real_glProgramUniformMatrix4fv = glad_glProgramUniformMatrix4fv; glad_glProgramUniformMatrix4fv = glad_stats_impl_glProgramUniformMatrix4fv; }
+	else if (!count && glad_stats_real_glProgramUniformMatrix4fv) { glad_glProgramUniformMatrix4fv = glad_stats_real_glProgramUniformMatrix4fv; glad_stats_real_glProgramUniformMatrix4fv = 0; }
+	if (count && glad_glProgramUniformMatrix4x2dv && glad_glProgramUniformMatrix4x2dv != glad_stats_impl_glProgramUniformMatrix4x2dv) { glad_stats_real_glProgramUniformMatrix4x2dv = glad_glProgramUniformMatrix4x2dv; glad_glProgramUniformMatrix4x2dv = glad_stats_impl_glProgramUniformMatrix4x2dv; }
+	else if (!count && glad_stats_real_glProgramUniformMatrix4x2dv) { glad_glProgramUniformMatrix4x2dv = glad_stats_real_glProgramUniformMatrix4x2dv; glad_stats_real_glProgramUniformMatrix4x2dv = 0; }
+	if (count && glad_glProgramUniformMatrix4x2fv && glad_glProgramUniformMatrix4x2fv != glad_stats_impl_glProgramUniformMatrix4x2fv) { glad_stats_real_glProgramUniformMatrix4x2fv = glad_glProgramUniformMatrix4x2fv; glad_glProgramUniformMatrix4x2fv = glad_stats_impl_glProgramUniformMatrix4x2fv; }
+	else if (!count && glad_stats_real_glProgramUniformMatrix4x2fv) { glad_glProgramUniformMatrix4x2fv = glad_stats_real_glProgramUniformMatrix4x2fv; glad_stats_real_glProgramUniformMatrix4x2fv = 0; }
+	if (count && glad_glProgramUniformMatrix4x3dv && glad_glProgramUniformMatrix4x3dv != glad_stats_impl_glProgramUniformMatrix4x3dv) { glad_stats_real_glProgramUniformMatrix4x3dv = glad_glProgramUniformMatrix4x3dv; glad_glProgramUniformMatrix4x3dv = glad_stats_impl_glProgramUniformMatrix4x3dv; }
+	else if (!count && glad_stats_real_glProgramUniformMatrix4x3dv) { glad_glProgramUniformMatrix4x3dv = glad_stats_real_glProgramUniformMatrix4x3dv; glad_stats_real_glProgramUniformMatrix4x3dv = 0; }
+	if (count && glad_glProgramUniformMatrix4x3fv && glad_glProgramUniformMatrix4x3fv != glad_stats_impl_glProgramUniformMatrix4x3fv) { glad_stats_real_glProgramUniformMatrix4x3fv = glad_glProgramUniformMatrix4x3fv; glad_glProgramUniformMatrix4x3fv = glad_stats_impl_glProgramUniformMatrix4x3fv; }
+	else if (!count && glad_stats_real_glProgramUniformMatrix4x3fv) { glad_glProgramUniformMatrix4x3fv = glad_stats_real_glProgramUniformMatrix4x3fv; glad_stats_real_glProgramUniformMatrix4x3fv = 0; }
+	if (count && glad_glProvokingVertex && glad_glProvokingVertex != glad_stats_impl_glProvokingVertex) { glad_stats_real_glProvokingVertex = glad_glProvokingVertex; glad_glProvokingVertex = glad_stats_impl_glProvokingVertex; }
+	else if (!count && glad_stats_real_glProvokingVertex) { glad_glProvokingVertex = glad_stats_real_glProvokingVertex; glad_stats_real_glProvokingVertex = 0; }
+	if (count && glad_glPushAttrib && glad_glPushAttrib != glad_stats_impl_glPushAttrib) { glad_stats_real_glPushAttrib = glad_glPushAttrib; glad_glPushAttrib = glad_stats_impl_glPushAttrib; }
+	else if (!count && glad_stats_real_glPushAttrib) { glad_glPushAttrib = glad_stats_real_glPushAttrib; glad_stats_real_glPushAttrib = 0; }
+	if (count && glad_glPushClientAttrib && glad_glPushClientAttrib != glad_stats_impl_glPushClientAttrib) { glad_stats_real_glPushClientAttrib = glad_glPushClientAttrib; glad_glPushClientAttrib = glad_stats_impl_glPushClientAttrib; }
+	else if (!count && glad_stats_real_glPushClientAttrib) { glad_glPushClientAttrib = glad_stats_real_glPushClientAttrib; glad_stats_real_glPushClientAttrib = 0; }
+	if (count && glad_glPushDebugGroup && glad_glPushDebugGroup != glad_stats_impl_glPushDebugGroup) { glad_stats_real_glPushDebugGroup = glad_glPushDebugGroup; glad_glPushDebugGroup = glad_stats_impl_glPushDebugGroup; }
+	else if (!count && glad_stats_real_glPushDebugGroup) { glad_glPushDebugGroup = glad_stats_real_glPushDebugGroup; glad_stats_real_glPushDebugGroup = 0; }
+	if (count && glad_glPushMatrix && glad_glPushMatrix != glad_stats_impl_glPushMatrix) { glad_stats_real_glPushMatrix = glad_glPushMatrix; glad_glPushMatrix = glad_stats_impl_glPushMatrix; }
+	else if (!count && glad_stats_real_glPushMatrix) { glad_glPushMatrix = glad_stats_real_glPushMatrix; glad_stats_real_glPushMatrix = 0; }
+	if (count && glad_glPushName && glad_glPushName != glad_stats_impl_glPushName) { glad_stats_real_glPushName = glad_glPushName; glad_glPushName = glad_stats_impl_glPushName; }
+	else if (!count && glad_stats_real_glPushName) { glad_glPushName = glad_stats_real_glPushName; glad_stats_real_glPushName = 0; }
+	if (count && glad_glQueryCounter && glad_glQueryCounter != glad_stats_impl_glQueryCounter) { glad_stats_real_glQueryCounter = glad_glQueryCounter; glad_glQueryCounter = glad_stats_impl_glQueryCounter; }
+	else if (!count && glad_stats_real_glQueryCounter) { glad_glQueryCounter = glad_stats_real_glQueryCounter; glad_stats_real_glQueryCounter = 0; }
+	if (count && glad_glRasterPos2d && glad_glRasterPos2d != glad_stats_impl_glRasterPos2d) { glad_stats_real_glRasterPos2d = glad_glRasterPos2d; glad_glRasterPos2d = glad_stats_impl_glRasterPos2d; }
+	else if (!count && glad_stats_real_glRasterPos2d) { glad_glRasterPos2d = glad_stats_real_glRasterPos2d; glad_stats_real_glRasterPos2d = 0; }
+	if (count && glad_glRasterPos2dv && glad_glRasterPos2dv != glad_stats_impl_glRasterPos2dv) { glad_stats_real_glRasterPos2dv = glad_glRasterPos2dv; glad_glRasterPos2dv = glad_stats_impl_glRasterPos2dv; }
+	else if (!count && glad_stats_real_glRasterPos2dv) { glad_glRasterPos2dv = glad_stats_real_glRasterPos2dv; glad_stats_real_glRasterPos2dv = 0; }
+	if (count && glad_glRasterPos2f && glad_glRasterPos2f != glad_stats_impl_glRasterPos2f) { glad_stats_real_glRasterPos2f = glad_glRasterPos2f; glad_glRasterPos2f = glad_stats_impl_glRasterPos2f; }
+	else if (!count && glad_stats_real_glRasterPos2f) { glad_glRasterPos2f = glad_stats_real_glRasterPos2f; glad_stats_real_glRasterPos2f = 0; }
+	if (count && glad_glRasterPos2fv && glad_glRasterPos2fv != glad_stats_impl_glRasterPos2fv) { glad_stats_real_glRasterPos2fv = glad_glRasterPos2fv; glad_glRasterPos2fv = glad_stats_impl_glRasterPos2fv; }
+	else if (!count && glad_stats_real_glRasterPos2fv) { glad_glRasterPos2fv = glad_stats_real_glRasterPos2fv; glad_stats_real_glRasterPos2fv = 0; }
+	if (count && glad_glRasterPos2i && glad_glRasterPos2i != glad_stats_impl_glRasterPos2i) { glad_stats_real_glRasterPos2i = glad_glRasterPos2i; glad_glRasterPos2i = glad_stats_impl_glRasterPos2i; }
+	else if (!count && glad_stats_real_glRasterPos2i) { glad_glRasterPos2i = glad_stats_real_glRasterPos2i; glad_stats_real_glRasterPos2i = 0; }
+	if (count && glad_glRasterPos2iv && glad_glRasterPos2iv != glad_stats_impl_glRasterPos2iv) { glad_stats_real_glRasterPos2iv = glad_glRasterPos2iv; glad_glRasterPos2iv = glad_stats_impl_glRasterPos2iv; }
+	else if (!count && glad_stats_real_glRasterPos2iv) { glad_glRasterPos2iv = glad_stats_real_glRasterPos2iv; glad_stats_real_glRasterPos2iv = 0; }
+	if (count && glad_glRasterPos2s && glad_glRasterPos2s != glad_stats_impl_glRasterPos2s) { glad_stats_real_glRasterPos2s = glad_glRasterPos2s; glad_glRasterPos2s = glad_stats_impl_glRasterPos2s; }
+	else if (!count && glad_stats_real_glRasterPos2s) { glad_glRasterPos2s = glad_stats_real_glRasterPos2s; glad_stats_real_glRasterPos2s = 0; }
+	if (count && glad_glRasterPos2sv && glad_glRasterPos2sv != glad_stats_impl_glRasterPos2sv) { glad_stats_real_glRasterPos2sv = glad_glRasterPos2sv; glad_glRasterPos2sv = glad_stats_impl_glRasterPos2sv; }
+	else if (!count && glad_stats_real_glRasterPos2sv) { glad_glRasterPos2sv = glad_stats_real_glRasterPos2sv; glad_stats_real_glRasterPos2sv = 0; }
+	if (count && glad_glRasterPos3d && glad_glRasterPos3d != glad_stats_impl_glRasterPos3d) { glad_stats_real_glRasterPos3d = glad_glRasterPos3d; glad_glRasterPos3d = glad_stats_impl_glRasterPos3d; }
+	else if (!count && glad_stats_real_glRasterPos3d) { glad_glRasterPos3d = glad_stats_real_glRasterPos3d; glad_stats_real_glRasterPos3d = 0; }
+	if (count && glad_glRasterPos3dv && glad_glRasterPos3dv != glad_stats_impl_glRasterPos3dv) { glad_stats_real_glRasterPos3dv = glad_glRasterPos3dv; glad_glRasterPos3dv = glad_stats_impl_glRasterPos3dv; }
+	else if (!count && glad_stats_real_glRasterPos3dv) { glad_glRasterPos3dv = glad_stats_real_glRasterPos3dv; glad_stats_real_glRasterPos3dv = 0; }
+	if (count && glad_glRasterPos3f && glad_glRasterPos3f != glad_stats_impl_glRasterPos3f) { glad_stats_real_glRasterPos3f = glad_glRasterPos3f; glad_glRasterPos3f = glad_stats_impl_glRasterPos3f; }
+	else if (!count && glad_stats_real_glRasterPos3f) { glad_glRasterPos3f = glad_stats_real_glRasterPos3f; glad_stats_real_glRasterPos3f = 0; }
+	if (count && glad_glRasterPos3fv && glad_glRasterPos3fv != glad_stats_impl_glRasterPos3fv) { glad_stats_real_glRasterPos3fv = glad_glRasterPos3fv; glad_glRasterPos3fv = glad_stats_impl_glRasterPos3fv; }
+	else if (!count && glad_stats_real_glRasterPos3fv) { glad_glRasterPos3fv = glad_stats_real_glRasterPos3fv; glad_stats_real_glRasterPos3fv = 0; }
+	if (count && glad_glRasterPos3i && glad_glRasterPos3i != glad_stats_impl_glRasterPos3i) { glad_stats_real_glRasterPos3i = glad_glRasterPos3i; glad_glRasterPos3i = glad_stats_impl_glRasterPos3i; }
+	else if (!count && glad_stats_real_glRasterPos3i) { glad_glRasterPos3i = glad_stats_real_glRasterPos3i; glad_stats_real_glRasterPos3i = 0; }
+	if (count && glad_glRasterPos3iv && glad_glRasterPos3iv != glad_stats_impl_glRasterPos3iv) { glad_stats_real_glRasterPos3iv = glad_glRasterPos3iv; glad_glRasterPos3iv = glad_stats_impl_glRasterPos3iv; }
+	else if (!count && glad_stats_real_glRasterPos3iv) { glad_glRasterPos3iv = glad_stats_real_glRasterPos3iv; glad_stats_real_glRasterPos3iv = 0; }
+	if (count && glad_glRasterPos3s && glad_glRasterPos3s != glad_stats_impl_glRasterPos3s) { glad_stats_real_glRasterPos3s = glad_glRasterPos3s; glad_glRasterPos3s = glad_stats_impl_glRasterPos3s; }
+	else if (!count && glad_stats_real_glRasterPos3s) { glad_glRasterPos3s = glad_stats_real_glRasterPos3s; glad_stats_real_glRasterPos3s = 0; }
+	if (count && glad_glRasterPos3sv && glad_glRasterPos3sv != glad_stats_impl_glRasterPos3sv) { glad_stats_real_glRasterPos3sv = glad_glRasterPos3sv; glad_glRasterPos3sv = glad_stats_impl_glRasterPos3sv; }
+	else if (!count && glad_stats_real_glRasterPos3sv) { glad_glRasterPos3sv = glad_stats_real_glRasterPos3sv; glad_stats_real_glRasterPos3sv = 0; }
+	if (count && glad_glRasterPos4d && glad_glRasterPos4d != glad_stats_impl_glRasterPos4d) { glad_stats_real_glRasterPos4d = glad_glRasterPos4d; glad_glRasterPos4d = glad_stats_impl_glRasterPos4d; }
+	else if (!count && glad_stats_real_glRasterPos4d) { glad_glRasterPos4d = glad_stats_real_glRasterPos4d; glad_stats_real_glRasterPos4d = 0; }
+	if (count && glad_glRasterPos4dv && glad_glRasterPos4dv != glad_stats_impl_glRasterPos4dv) { glad_stats_real_glRasterPos4dv = glad_glRasterPos4dv; glad_glRasterPos4dv = glad_stats_impl_glRasterPos4dv; }
+	else if (!count && glad_stats_real_glRasterPos4dv) { glad_glRasterPos4dv = glad_stats_real_glRasterPos4dv; glad_stats_real_glRasterPos4dv = 0; }
+	if (count && glad_glRasterPos4f && glad_glRasterPos4f != glad_stats_impl_glRasterPos4f) { glad_stats_real_glRasterPos4f = glad_glRasterPos4f; glad_glRasterPos4f = glad_stats_impl_glRasterPos4f; }
+	else if (!count && glad_stats_real_glRasterPos4f) { glad_glRasterPos4f = glad_stats_real_glRasterPos4f; glad_stats_real_glRasterPos4f = 0; }
+	if (count && glad_glRasterPos4fv && glad_glRasterPos4fv != glad_stats_impl_glRasterPos4fv) { glad_stats_real_glRasterPos4fv = glad_glRasterPos4fv; glad_glRasterPos4fv = glad_stats_impl_glRasterPos4fv; }
+	else if (!count && glad_stats_real_glRasterPos4fv) { glad_glRasterPos4fv = glad_stats_real_glRasterPos4fv; glad_stats_real_glRasterPos4fv = 0; }
+	if (count && glad_glRasterPos4i && glad_glRasterPos4i != glad_stats_impl_glRasterPos4i) { glad_stats_real_glRasterPos4i = glad_glRasterPos4i; glad_glRasterPos4i = glad_stats_impl_glRasterPos4i; }
+	else if (!count && glad_stats_real_glRasterPos4i) { glad_glRasterPos4i = glad_stats_real_glRasterPos4i; glad_stats_real_glRasterPos4i = 0; }
+	if (count && glad_glRasterPos4iv && glad_glRasterPos4iv != glad_stats_impl_glRasterPos4iv) { glad_stats_real_glRasterPos4iv = glad_glRasterPos4iv; glad_glRasterPos4iv = glad_stats_impl_glRasterPos4iv; }
+	else if (!count && glad_stats_real_glRasterPos4iv) { glad_glRasterPos4iv = glad_stats_real_glRasterPos4iv; glad_stats_real_glRasterPos4iv = 0; }
+	if (count && glad_glRasterPos4s && glad_glRasterPos4s != glad_stats_impl_glRasterPos4s) { glad_stats_real_glRasterPos4s = glad_glRasterPos4s; glad_glRasterPos4s = glad_stats_impl_glRasterPos4s; }
+	else if (!count && glad_stats_real_glRasterPos4s) { glad_glRasterPos4s = glad_stats_real_glRasterPos4s; glad_stats_real_glRasterPos4s = 0; }
+	if (count && glad_glRasterPos4sv && glad_glRasterPos4sv != glad_stats_impl_glRasterPos4sv) { glad_stats_real_glRasterPos4sv = glad_glRasterPos4sv; glad_glRasterPos4sv = glad_stats_impl_glRasterPos4sv; }
+	else if (!count && glad_stats_real_glRasterPos4sv) { glad_glRasterPos4sv = glad_stats_real_glRasterPos4sv; glad_stats_real_glRasterPos4sv = 0; }
+	if (count && glad_glReadBuffer && glad_glReadBuffer != glad_stats_impl_glReadBuffer) { glad_stats_real_glReadBuffer = glad_glReadBuffer; glad_glReadBuffer = glad_stats_impl_glReadBuffer; }
+	else if (!count && glad_stats_real_glReadBuffer) { glad_glReadBuffer = glad_stats_real_glReadBuffer; glad_stats_real_glReadBuffer = 0; }
+	if (count && glad_glReadPixels && glad_glReadPixels != glad_stats_impl_glReadPixels) { glad_stats_real_glReadPixels = glad_glReadPixels; glad_glReadPixels = glad_stats_impl_glReadPixels; }
+	else if (!count && glad_stats_real_glReadPixels) { glad_glReadPixels = glad_stats_real_glReadPixels; glad_stats_real_glReadPixels = 0; }
+	if (count && glad_glReadnPixels && glad_glReadnPixels != glad_stats_impl_glReadnPixels) { glad_stats_real_glReadnPixels = glad_glReadnPixels; glad_glReadnPixels = glad_stats_impl_glReadnPixels; }
+	else if (!count && glad_stats_real_glReadnPixels) { glad_glReadnPixels = glad_stats_real_glReadnPixels; glad_stats_real_glReadnPixels = 0; }
+	if (count && glad_glRectd && glad_glRectd != glad_stats_impl_glRectd) { glad_stats_real_glRectd = glad_glRectd; glad_glRectd = glad_stats_impl_glRectd; }
+	else if (!count && glad_stats_real_glRectd) { glad_glRectd = glad_stats_real_glRectd; glad_stats_real_glRectd = 0; }
+	if (count && glad_glRectdv && glad_glRectdv != glad_stats_impl_glRectdv) { glad_stats_real_glRectdv = glad_glRectdv; glad_glRectdv = glad_stats_impl_glRectdv; }
+	else if (!count && glad_stats_real_glRectdv) { glad_glRectdv = glad_stats_real_glRectdv; glad_stats_real_glRectdv = 0; }
+	if (count && glad_glRectf && glad_glRectf != glad_stats_impl_glRectf) { glad_stats_real_glRectf = glad_glRectf; glad_glRectf = glad_stats_impl_glRectf; }
+	else if (!count && glad_stats_real_glRectf) { glad_glRectf = glad_stats_real_glRectf; glad_stats_real_glRectf = 0; }
+	if (count && glad_glRectfv && glad_glRectfv != glad_stats_impl_glRectfv) { glad_stats_real_glRectfv = glad_glRectfv; glad_glRectfv = glad_stats_impl_glRectfv; }
+	else if (!count && glad_stats_real_glRectfv) { glad_glRectfv = glad_stats_real_glRectfv; glad_stats_real_glRectfv = 0; }
+	if (count && glad_glRecti && glad_glRecti != glad_stats_impl_glRecti) { glad_stats_real_glRecti = glad_glRecti; glad_glRecti = glad_stats_impl_glRecti; }
+	else if (!count && glad_stats_real_glRecti) { glad_glRecti = glad_stats_real_glRecti; glad_stats_real_glRecti = 0; }
+	if (count && glad_glRectiv && glad_glRectiv != glad_stats_impl_glRectiv) { glad_stats_real_glRectiv = glad_glRectiv; glad_glRectiv = glad_stats_impl_glRectiv; }
+	else if (!count && glad_stats_real_glRectiv) { glad_glRectiv = glad_stats_real_glRectiv; glad_stats_real_glRectiv = 0; }
+	if (count && glad_glRects && glad_glRects != glad_stats_impl_glRects) { glad_stats_real_glRects = glad_glRects; glad_glRects = glad_stats_impl_glRects; }
+	else if (!count && glad_stats_real_glRects) { glad_glRects = glad_stats_real_glRects; glad_stats_real_glRects = 0; }
+	if (count && glad_glRectsv && glad_glRectsv != glad_stats_impl_glRectsv) { glad_stats_real_glRectsv = glad_glRectsv; glad_glRectsv = glad_stats_impl_glRectsv; }
+	else if (!count && glad_stats_real_glRectsv) { glad_glRectsv = glad_stats_real_glRectsv; glad_stats_real_glRectsv = 0; }
+	if (count && glad_glReleaseShaderCompiler && glad_glReleaseShaderCompiler != glad_stats_impl_glReleaseShaderCompiler) { glad_stats_real_glReleaseShaderCompiler = glad_glReleaseShaderCompiler; glad_glReleaseShaderCompiler = glad_stats_impl_glReleaseShaderCompiler; }
+	else if (!count && glad_stats_real_glReleaseShaderCompiler) { glad_glReleaseShaderCompiler = glad_stats_real_glReleaseShaderCompiler; glad_stats_real_glReleaseShaderCompiler = 0; }
+	if (count && glad_glRenderMode && glad_glRenderMode != glad_stats_impl_glRenderMode) { glad_stats_real_glRenderMode = glad_glRenderMode; glad_glRenderMode = glad_stats_impl_glRenderMode; }
+	else if (!count && glad_stats_real_glRenderMode) { glad_glRenderMode = glad_stats_real_glRenderMode; glad_stats_real_glRenderMode = 0; }
+	if (count && glad_glRenderbufferStorage && glad_glRenderbufferStorage != glad_stats_impl_glRenderbufferStorage) { glad_stats_real_glRenderbufferStorage = glad_glRenderbufferStorage; glad_glRenderbufferStorage = glad_stats_impl_glRenderbufferStorage; }
+	else if (!count && glad_stats_real_glRenderbufferStorage) { glad_glRenderbufferStorage = glad_stats_real_glRenderbufferStorage; glad_stats_real_glRenderbufferStorage = 0; }
+	if (count && glad_glRenderbufferStorageMultisample && glad_glRenderbufferStorageMultisample != glad_stats_impl_glRenderbufferStorageMultisample) { glad_stats_real_glRenderbufferStorageMultisample = glad_glRenderbufferStorageMultisample; glad_glRenderbufferStorageMultisample = glad_stats_impl_glRenderbufferStorageMultisample; }
+	else if (!count && glad_stats_real_glRenderbufferStorageMultisample) { glad_glRenderbufferStorageMultisample = glad_stats_real_glRenderbufferStorageMultisample; glad_stats_real_glRenderbufferStorageMultisample = 0; }
+	if (count && glad_glResumeTransformFeedback && glad_glResumeTransformFeedback != glad_stats_impl_glResumeTransformFeedback) { glad_stats_real_glResumeTransformFeedback = glad_glResumeTransformFeedback; glad_glResumeTransformFeedback = glad_stats_impl_glResumeTransformFeedback; }
+	else if (!count && glad_stats_real_glResumeTransformFeedback) { glad_glResumeTransformFeedback = glad_stats_real_glResumeTransformFeedback; glad_stats_real_glResumeTransformFeedback = 0; }
+	if (count && glad_glRotated && glad_glRotated != glad_stats_impl_glRotated) { glad_stats_real_glRotated = glad_glRotated; glad_glRotated = glad_stats_impl_glRotated; }
+	else if (!count && glad_stats_real_glRotated) { glad_glRotated = glad_stats_real_glRotated; glad_stats_real_glRotated = 0; }
+	if (count && glad_glRotatef && glad_glRotatef != glad_stats_impl_glRotatef) { glad_stats_real_glRotatef = glad_glRotatef; glad_glRotatef = glad_stats_impl_glRotatef; }
+	else if (!count && glad_stats_real_glRotatef) { glad_glRotatef = glad_stats_real_glRotatef; glad_stats_real_glRotatef = 0; }
+	if (count && glad_glSampleCoverage && glad_glSampleCoverage != glad_stats_impl_glSampleCoverage) { glad_stats_real_glSampleCoverage = glad_glSampleCoverage; glad_glSampleCoverage = glad_stats_impl_glSampleCoverage; }
+	else if (!count && glad_stats_real_glSampleCoverage) { glad_glSampleCoverage = glad_stats_real_glSampleCoverage; glad_stats_real_glSampleCoverage = 0; }
+	if (count && glad_glSampleMaski && glad_glSampleMaski != glad_stats_impl_glSampleMaski) { glad_stats_real_glSampleMaski = glad_glSampleMaski; glad_glSampleMaski = glad_stats_impl_glSampleMaski; }
+	else if (!count && glad_stats_real_glSampleMaski) { glad_glSampleMaski = glad_stats_real_glSampleMaski; glad_stats_real_glSampleMaski = 0; }
+	if (count && glad_glSamplerParameterIiv && glad_glSamplerParameterIiv != glad_stats_impl_glSamplerParameterIiv) { glad_stats_real_glSamplerParameterIiv = glad_glSamplerParameterIiv; glad_glSamplerParameterIiv = glad_stats_impl_glSamplerParameterIiv; }
+	else if (!count && glad_stats_real_glSamplerParameterIiv) { glad_glSamplerParameterIiv = glad_stats_real_glSamplerParameterIiv; glad_stats_real_glSamplerParameterIiv = 0; }
+	if (count && glad_glSamplerParameterIuiv && glad_glSamplerParameterIuiv != glad_stats_impl_glSamplerParameterIuiv) { glad_stats_real_glSamplerParameterIuiv = glad_glSamplerParameterIuiv; glad_glSamplerParameterIuiv = glad_stats_impl_glSamplerParameterIuiv; }
+	else if (!count && glad_stats_real_glSamplerParameterIuiv) { glad_glSamplerParameterIuiv = glad_stats_real_glSamplerParameterIuiv; glad_stats_real_glSamplerParameterIuiv = 0; }
+	if (count && glad_glSamplerParameterf && glad_glSamplerParameterf != glad_stats_impl_glSamplerParameterf) { glad_stats_real_glSamplerParameterf = glad_glSamplerParameterf; glad_glSamplerParameterf = glad_stats_impl_glSamplerParameterf; }
+	else if (!count && glad_stats_real_glSamplerParameterf) { glad_glSamplerParameterf = glad_stats_real_glSamplerParameterf; glad_stats_real_glSamplerParameterf = 0; }
+	if (count && glad_glSamplerParameterfv && glad_glSamplerParameterfv != glad_stats_impl_glSamplerParameterfv) { glad_stats_real_glSamplerParameterfv = glad_glSamplerParameterfv; glad_glSamplerParameterfv = glad_stats_impl_glSamplerParameterfv; }
+	else if (!count && glad_stats_real_glSamplerParameterfv) { glad_glSamplerParameterfv = glad_stats_real_glSamplerParameterfv; glad_stats_real_glSamplerParameterfv = 0; }
+	if (count && glad_glSamplerParameteri && glad_glSamplerParameteri != glad_stats_impl_glSamplerParameteri) { glad_stats_real_glSamplerParameteri = glad_glSamplerParameteri; glad_glSamplerParameteri = glad_stats_impl_glSamplerParameteri; }
+	else if (!count && glad_stats_real_glSamplerParameteri) { glad_glSamplerParameteri = glad_stats_real_glSamplerParameteri; glad_stats_real_glSamplerParameteri = 0; }
+	if (count && glad_glSamplerParameteriv && glad_glSamplerParameteriv != glad_stats_impl_glSamplerParameteriv) { glad_stats_real_glSamplerParameteriv = glad_glSamplerParameteriv; glad_glSamplerParameteriv = glad_stats_impl_glSamplerParameteriv; }
+	else if (!count && glad_stats_real_glSamplerParameteriv) { glad_glSamplerParameteriv = glad_stats_real_glSamplerParameteriv; glad_stats_real_glSamplerParameteriv = 0; }
+	if (count && glad_glScaled && glad_glScaled != glad_stats_impl_glScaled) { glad_stats_real_glScaled = glad_glScaled; glad_glScaled = glad_stats_impl_glScaled; }
+	else if (!count && glad_stats_real_glScaled) { glad_glScaled = glad_stats_real_glScaled; glad_stats_real_glScaled = 0; }
+	if (count && glad_glScalef && glad_glScalef != glad_stats_impl_glScalef) { glad_stats_real_glScalef = glad_glScalef; glad_glScalef = glad_stats_impl_glScalef; }
+	else if (!count && glad_stats_real_glScalef) { glad_glScalef = glad_stats_real_glScalef; glad_stats_real_glScalef = 0; }
+	if (count && glad_glScissor && glad_glScissor != glad_stats_impl_glScissor) { glad_stats_real_glScissor = glad_glScissor; glad_glScissor = glad_stats_impl_glScissor; }
+	else if (!count && glad_stats_real_glScissor) { glad_glScissor = glad_stats_real_glScissor; glad_stats_real_glScissor = 0; }
+	if (count && glad_glScissorArrayv && glad_glScissorArrayv != glad_stats_impl_glScissorArrayv) { glad_stats_real_glScissorArrayv = glad_glScissorArrayv; glad_glScissorArrayv = glad_stats_impl_glScissorArrayv; }
+	else if (!count && glad_stats_real_glScissorArrayv) { glad_glScissorArrayv = glad_stats_real_glScissorArrayv; glad_stats_real_glScissorArrayv = 0; }
+	if (count && glad_glScissorIndexed && glad_glScissorIndexed != glad_stats_impl_glScissorIndexed) { glad_stats_real_glScissorIndexed = glad_glScissorIndexed; glad_glScissorIndexed = glad_stats_impl_glScissorIndexed; }
+	else if (!count && glad_stats_real_glScissorIndexed) { glad_glScissorIndexed = glad_stats_real_glScissorIndexed; glad_stats_real_glScissorIndexed = 0; }
+	if (count && glad_glScissorIndexedv && glad_glScissorIndexedv != glad_stats_impl_glScissorIndexedv) { glad_stats_real_glScissorIndexedv = glad_glScissorIndexedv; glad_glScissorIndexedv = glad_stats_impl_glScissorIndexedv; }
+	else if (!count && glad_stats_real_glScissorIndexedv) { glad_glScissorIndexedv = glad_stats_real_glScissorIndexedv; glad_stats_real_glScissorIndexedv = 0; }
+	if (count && glad_glSecondaryColor3b && glad_glSecondaryColor3b != glad_stats_impl_glSecondaryColor3b) { glad_stats_real_glSecondaryColor3b = glad_glSecondaryColor3b; glad_glSecondaryColor3b = glad_stats_impl_glSecondaryColor3b; }
+	else if (!count && glad_stats_real_glSecondaryColor3b) { glad_glSecondaryColor3b = glad_stats_real_glSecondaryColor3b; glad_stats_real_glSecondaryColor3b = 0; }
+	if (count && glad_glSecondaryColor3bv && glad_glSecondaryColor3bv != glad_stats_impl_glSecondaryColor3bv) { glad_stats_real_glSecondaryColor3bv = glad_glSecondaryColor3bv; glad_glSecondaryColor3bv = glad_stats_impl_glSecondaryColor3bv; }
+	else if (!count && glad_stats_real_glSecondaryColor3bv) { glad_glSecondaryColor3bv = glad_stats_real_glSecondaryColor3bv; glad_stats_real_glSecondaryColor3bv = 0; }
+	if (count && glad_glSecondaryColor3d && glad_glSecondaryColor3d != glad_stats_impl_glSecondaryColor3d) { glad_stats_real_glSecondaryColor3d = glad_glSecondaryColor3d; glad_glSecondaryColor3d = glad_stats_impl_glSecondaryColor3d; }
+	else if (!count && glad_stats_real_glSecondaryColor3d) { glad_glSecondaryColor3d = glad_stats_real_glSecondaryColor3d; glad_stats_real_glSecondaryColor3d = 0; }
+	if (count && glad_glSecondaryColor3dv && glad_glSecondaryColor3dv != glad_stats_impl_glSecondaryColor3dv) { glad_stats_real_glSecondaryColor3dv = glad_glSecondaryColor3dv; glad_glSecondaryColor3dv = glad_stats_impl_glSecondaryColor3dv; }
+	else if (!count && glad_stats_real_glSecondaryColor3dv) { glad_glSecondaryColor3dv = glad_stats_real_glSecondaryColor3dv; glad_stats_real_glSecondaryColor3dv = 0; }
+	if (count && glad_glSecondaryColor3f && glad_glSecondaryColor3f != glad_stats_impl_glSecondaryColor3f) { glad_stats_real_glSecondaryColor3f = glad_glSecondaryColor3f; glad_glSecondaryColor3f = glad_stats_impl_glSecondaryColor3f; }
+	else if (!count && glad_stats_real_glSecondaryColor3f) { glad_glSecondaryColor3f = glad_stats_real_glSecondaryColor3f; glad_stats_real_glSecondaryColor3f = 0; }
+	if (count && glad_glSecondaryColor3fv && glad_glSecondaryColor3fv != glad_stats_impl_glSecondaryColor3fv) { glad_stats_real_glSecondaryColor3fv = glad_glSecondaryColor3fv; glad_glSecondaryColor3fv = glad_stats_impl_glSecondaryColor3fv; }
+	else if (!count && glad_stats_real_glSecondaryColor3fv) { glad_glSecondaryColor3fv = glad_stats_real_glSecondaryColor3fv; glad_stats_real_glSecondaryColor3fv = 0; }
+	if (count && glad_glSecondaryColor3i && glad_glSecondaryColor3i != glad_stats_impl_glSecondaryColor3i) { glad_stats_real_glSecondaryColor3i = glad_glSecondaryColor3i; glad_glSecondaryColor3i = glad_stats_impl_glSecondaryColor3i; }
+	else if (!count && glad_stats_real_glSecondaryColor3i) { glad_glSecondaryColor3i = glad_stats_real_glSecondaryColor3i; glad_stats_real_glSecondaryColor3i = 0; }
+	if (count && glad_glSecondaryColor3iv && glad_glSecondaryColor3iv != glad_stats_impl_glSecondaryColor3iv) { glad_stats_real_glSecondaryColor3iv = glad_glSecondaryColor3iv; glad_glSecondaryColor3iv = glad_stats_impl_glSecondaryColor3iv; }
+	else if (!count && glad_stats_real_glSecondaryColor3iv) { glad_glSecondaryColor3iv = glad_stats_real_glSecondaryColor3iv; glad_stats_real_glSecondaryColor3iv = 0; }
+	if (count && glad_glSecondaryColor3s && glad_glSecondaryColor3s != glad_stats_impl_glSecondaryColor3s) { glad_stats_real_glSecondaryColor3s = glad_glSecondaryColor3s; glad_glSecondaryColor3s = glad_stats_impl_glSecondaryColor3s; }
+	else if (!count && glad_stats_real_glSecondaryColor3s) { glad_glSecondaryColor3s = glad_stats_real_glSecondaryColor3s; glad_stats_real_glSecondaryColor3s = 0; }
+	if (count && glad_glSecondaryColor3sv && glad_glSecondaryColor3sv != glad_stats_impl_glSecondaryColor3sv) { glad_stats_real_glSecondaryColor3sv = glad_glSecondaryColor3sv; glad_glSecondaryColor3sv = glad_stats_impl_glSecondaryColor3sv; }
+	else if (!count && glad_stats_real_glSecondaryColor3sv) { glad_glSecondaryColor3sv = glad_stats_real_glSecondaryColor3sv; glad_stats_real_glSecondaryColor3sv = 0; }
+	if (count && glad_glSecondaryColor3ub && glad_glSecondaryColor3ub != glad_stats_impl_glSecondaryColor3ub) { glad_stats_real_glSecondaryColor3ub = glad_glSecondaryColor3ub; glad_glSecondaryColor3ub = glad_stats_impl_glSecondaryColor3ub; }
+	else if (!count && glad_stats_real_glSecondaryColor3ub) { glad_glSecondaryColor3ub = glad_stats_real_glSecondaryColor3ub; glad_stats_real_glSecondaryColor3ub = 0; }
+	if (count && glad_glSecondaryColor3ubv && glad_glSecondaryColor3ubv != glad_stats_impl_glSecondaryColor3ubv) { glad_stats_real_glSecondaryColor3ubv = glad_glSecondaryColor3ubv; glad_glSecondaryColor3ubv = glad_stats_impl_glSecondaryColor3ubv; }
+	else if (!count && glad_stats_real_glSecondaryColor3ubv) { glad_glSecondaryColor3ubv = glad_stats_real_glSecondaryColor3ubv; glad_stats_real_glSecondaryColor3ubv = 0; }
+	if (count && glad_glSecondaryColor3ui && glad_glSecondaryColor3ui != glad_stats_impl_glSecondaryColor3ui) { glad_stats_real_glSecondaryColor3ui = glad_glSecondaryColor3ui; glad_glSecondaryColor3ui = glad_stats_impl_glSecondaryColor3ui; }
+	else if (!count && glad_stats_real_glSecondaryColor3ui) { glad_glSecondaryColor3ui = glad_stats_real_glSecondaryColor3ui; glad_stats_real_glSecondaryColor3ui = 0; }
+	if (count && glad_glSecondaryColor3uiv && glad_glSecondaryColor3uiv != glad_stats_impl_glSecondaryColor3uiv) { glad_stats_real_glSecondaryColor3uiv = glad_glSecondaryColor3uiv; glad_glSecondaryColor3uiv = glad_stats_impl_glSecondaryColor3uiv; }
+	else if (!count && glad_stats_real_glSecondaryColor3uiv) { glad_glSecondaryColor3uiv = glad_stats_real_glSecondaryColor3uiv; glad_stats_real_glSecondaryColor3uiv = 0; }
+	if (count && glad_glSecondaryColor3us && glad_glSecondaryColor3us != glad_stats_impl_glSecondaryColor3us) { glad_stats_real_glSecondaryColor3us = glad_glSecondaryColor3us; glad_glSecondaryColor3us = glad_stats_impl_glSecondaryColor3us; }
+	else if (!count && glad_stats_real_glSecondaryColor3us) { glad_glSecondaryColor3us = glad_stats_real_glSecondaryColor3us; glad_stats_real_glSecondaryColor3us = 0; }
+	if (count && glad_glSecondaryColor3usv && glad_glSecondaryColor3usv != glad_stats_impl_glSecondaryColor3usv) { glad_stats_real_glSecondaryColor3usv = glad_glSecondaryColor3usv; glad_glSecondaryColor3usv = glad_stats_impl_glSecondaryColor3usv; }
+	else if (!count && glad_stats_real_glSecondaryColor3usv) { glad_glSecondaryColor3usv = glad_stats_real_glSecondaryColor3usv; glad_stats_real_glSecondaryColor3usv = 0; }
+	if (count && glad_glSecondaryColorP3ui && glad_glSecondaryColorP3ui != glad_stats_impl_glSecondaryColorP3ui) { glad_stats_real_glSecondaryColorP3ui = glad_glSecondaryColorP3ui; glad_glSecondaryColorP3ui = glad_stats_impl_glSecondaryColorP3ui; }
+	else if (!count && glad_stats_real_glSecondaryColorP3ui) { glad_glSecondaryColorP3ui = glad_stats_real_glSecondaryColorP3ui; glad_stats_real_glSecondaryColorP3ui = 0; }
+	if (count && glad_glSecondaryColorP3uiv && glad_glSecondaryColorP3uiv != glad_stats_impl_glSecondaryColorP3uiv) { glad_stats_real_glSecondaryColorP3uiv = glad_glSecondaryColorP3uiv; glad_glSecondaryColorP3uiv = glad_stats_impl_glSecondaryColorP3uiv; }
+	else if (!count && glad_stats_real_glSecondaryColorP3uiv) { glad_glSecondaryColorP3uiv = glad_stats_real_glSecondaryColorP3uiv; glad_stats_real_glSecondaryColorP3uiv = 0; }
+	if (count && glad_glSecondaryColorPointer && glad_glSecondaryColorPointer != glad_stats_impl_glSecondaryColorPointer) { glad_stats_real_glSecondaryColorPointer = glad_glSecondaryColorPointer; glad_glSecondaryColorPointer = glad_stats_impl_glSecondaryColorPointer; }
+	else if (!count && glad_stats_real_glSecondaryColorPointer) { glad_glSecondaryColorPointer = glad_stats_real_glSecondaryColorPointer; glad_stats_real_glSecondaryColorPointer = 0; }
+	if (count && glad_glSelectBuffer && glad_glSelectBuffer != glad_stats_impl_glSelectBuffer) { glad_stats_real_glSelectBuffer = glad_glSelectBuffer; glad_glSelectBuffer = glad_stats_impl_glSelectBuffer; }
+	else if (!count && glad_stats_real_glSelectBuffer) { glad_glSelectBuffer = glad_stats_real_glSelectBuffer; glad_stats_real_glSelectBuffer = 0; }
+	if (count && glad_glShadeModel && glad_glShadeModel != glad_stats_impl_glShadeModel) { glad_stats_real_glShadeModel = glad_glShadeModel; glad_glShadeModel = glad_stats_impl_glShadeModel; }
+	else if (!count && glad_stats_real_glShadeModel) { glad_glShadeModel = glad_stats_real_glShadeModel; glad_stats_real_glShadeModel = 0; }
+	if (count && glad_glShaderBinary && glad_glShaderBinary != glad_stats_impl_glShaderBinary) { glad_stats_real_glShaderBinary = glad_glShaderBinary; glad_glShaderBinary = glad_stats_impl_glShaderBinary; }
+	else if (!count && glad_stats_real_glShaderBinary) { glad_glShaderBinary = glad_stats_real_glShaderBinary; glad_stats_real_glShaderBinary = 0; }
+	if (count && glad_glShaderSource && glad_glShaderSource != glad_stats_impl_glShaderSource) { glad_stats_real_glShaderSource = glad_glShaderSource; glad_glShaderSource = glad_stats_impl_glShaderSource; }
+	else if (!count && glad_stats_real_glShaderSource) { glad_glShaderSource = glad_stats_real_glShaderSource; glad_stats_real_glShaderSource = 0; }
+	if (count && glad_glShaderStorageBlockBinding && glad_glShaderStorageBlockBinding != glad_stats_impl_glShaderStorageBlockBinding) { glad_stats_real_glShaderStorageBlockBinding = glad_glShaderStorageBlockBinding; glad_glShaderStorageBlockBinding = glad_stats_impl_glShaderStorageBlockBinding; }
+	else if (!count && glad_stats_real_glShaderStorageBlockBinding) { glad_glShaderStorageBlockBinding = glad_stats_real_glShaderStorageBlockBinding; glad_stats_real_glShaderStorageBlockBinding = 0; }
+	if (count && glad_glSpecializeShader && glad_glSpecializeShader != glad_stats_impl_glSpecializeShader) { glad_stats_real_glSpecializeShader = glad_glSpecializeShader; glad_glSpecializeShader = glad_stats_impl_glSpecializeShader; }
+	else if (!count && glad_stats_real_glSpecializeShader) { glad_glSpecializeShader = glad_stats_real_glSpecializeShader; glad_stats_real_glSpecializeShader = 0; }
+	if (count && glad_glSpecializeShaderARB && glad_glSpecializeShaderARB != glad_stats_impl_glSpecializeShaderARB) { glad_stats_real_glSpecializeShaderARB = glad_glSpecializeShaderARB; glad_glSpecializeShaderARB = glad_stats_impl_glSpecializeShaderARB; }
+	else if (!count && glad_stats_real_glSpecializeShaderARB) { glad_glSpecializeShaderARB = glad_stats_real_glSpecializeShaderARB; glad_stats_real_glSpecializeShaderARB = 0; }
+	if (count && glad_glStencilFunc && glad_glStencilFunc != glad_stats_impl_glStencilFunc) { glad_stats_real_glStencilFunc = glad_glStencilFunc; glad_glStencilFunc = glad_stats_impl_glStencilFunc; }
+	else if (!count && glad_stats_real_glStencilFunc) { glad_glStencilFunc = glad_stats_real_glStencilFunc; glad_stats_real_glStencilFunc = 0; }
+	if (count && glad_glStencilFuncSeparate && glad_glStencilFuncSeparate != glad_stats_impl_glStencilFuncSeparate) { glad_stats_real_glStencilFuncSeparate = glad_glStencilFuncSeparate; glad_glStencilFuncSeparate = glad_stats_impl_glStencilFuncSeparate; }
+	else if (!count && glad_stats_real_glStencilFuncSeparate) { glad_glStencilFuncSeparate = glad_stats_real_glStencilFuncSeparate; glad_stats_real_glStencilFuncSeparate = 0; }
+	if (count && glad_glStencilMask && glad_glStencilMask != glad_stats_impl_glStencilMask) { glad_stats_real_glStencilMask = glad_glStencilMask; glad_glStencilMask = glad_stats_impl_glStencilMask; }
+	else if (!count && glad_stats_real_glStencilMask) { glad_glStencilMask = glad_stats_real_glStencilMask; glad_stats_real_glStencilMask = 0; }
+	if (count && glad_glStencilMaskSeparate && glad_glStencilMaskSeparate != glad_stats_impl_glStencilMaskSeparate) { glad_stats_real_glStencilMaskSeparate = glad_glStencilMaskSeparate; glad_glStencilMaskSeparate = glad_stats_impl_glStencilMaskSeparate; }
+	else if (!count && glad_stats_real_glStencilMaskSeparate) { glad_glStencilMaskSeparate = glad_stats_real_glStencilMaskSeparate; glad_stats_real_glStencilMaskSeparate = 0; }
+	if (count && glad_glStencilOp && glad_glStencilOp != glad_stats_impl_glStencilOp) { glad_stats_real_glStencilOp = glad_glStencilOp; glad_glStencilOp = glad_stats_impl_glStencilOp; }
+	else if (!count && glad_stats_real_glStencilOp) { glad_glStencilOp = glad_stats_real_glStencilOp; glad_stats_real_glStencilOp = 0; }
+	if (count && glad_glStencilOpSeparate && glad_glStencilOpSeparate != glad_stats_impl_glStencilOpSeparate) { glad_stats_real_glStencilOpSeparate = glad_glStencilOpSeparate; glad_glStencilOpSeparate = glad_stats_impl_glStencilOpSeparate; }
+	else if (!count && glad_stats_real_glStencilOpSeparate) { glad_glStencilOpSeparate = glad_stats_real_glStencilOpSeparate; glad_stats_real_glStencilOpSeparate = 0; }
+	if (count && glad_glTexBuffer && glad_glTexBuffer != glad_stats_impl_glTexBuffer) { glad_stats_real_glTexBuffer = glad_glTexBuffer; glad_glTexBuffer = glad_stats_impl_glTexBuffer; }
+	else if (!count && glad_stats_real_glTexBuffer) { glad_glTexBuffer = glad_stats_real_glTexBuffer; glad_stats_real_glTexBuffer = 0; }
+	if (count && glad_glTexBufferRange && glad_glTexBufferRange != glad_stats_impl_glTexBufferRange) { glad_stats_real_glTexBufferRange = glad_glTexBufferRange; glad_glTexBufferRange = glad_stats_impl_glTexBufferRange; }
+	else if (!count && glad_stats_real_glTexBufferRange) { glad_glTexBufferRange = glad_stats_real_glTexBufferRange; glad_stats_real_glTexBufferRange = 0; }
+	if (count && glad_glTexCoord1d && glad_glTexCoord1d != glad_stats_impl_glTexCoord1d) { glad_stats_real_glTexCoord1d = glad_glTexCoord1d; glad_glTexCoord1d = glad_stats_impl_glTexCoord1d; }
+	else if (!count && glad_stats_real_glTexCoord1d) { glad_glTexCoord1d = glad_stats_real_glTexCoord1d; glad_stats_real_glTexCoord1d = 0; }
+	if (count && glad_glTexCoord1dv && glad_glTexCoord1dv != glad_stats_impl_glTexCoord1dv) { glad_stats_real_glTexCoord1dv = glad_glTexCoord1dv; glad_glTexCoord1dv = glad_stats_impl_glTexCoord1dv; }
+	else if (!count && glad_stats_real_glTexCoord1dv) { glad_glTexCoord1dv = glad_stats_real_glTexCoord1dv; glad_stats_real_glTexCoord1dv = 0; }
+	if (count && glad_glTexCoord1f && glad_glTexCoord1f != glad_stats_impl_glTexCoord1f) { glad_stats_real_glTexCoord1f = glad_glTexCoord1f; glad_glTexCoord1f = glad_stats_impl_glTexCoord1f; }
+	else if (!count && glad_stats_real_glTexCoord1f) { glad_glTexCoord1f = glad_stats_real_glTexCoord1f; glad_stats_real_glTexCoord1f = 0; }
+	if (count && glad_glTexCoord1fv && glad_glTexCoord1fv != glad_stats_impl_glTexCoord1fv) { glad_stats_real_glTexCoord1fv = glad_glTexCoord1fv; glad_glTexCoord1fv = glad_stats_impl_glTexCoord1fv; }
+	else if (!count && glad_stats_real_glTexCoord1fv) { glad_glTexCoord1fv = glad_stats_real_glTexCoord1fv; glad_stats_real_glTexCoord1fv = 0; }
+	if (count && glad_glTexCoord1i && glad_glTexCoord1i != glad_stats_impl_glTexCoord1i) { glad_stats_real_glTexCoord1i = glad_glTexCoord1i; glad_glTexCoord1i = glad_stats_impl_glTexCoord1i; }
+	else if (!count && glad_stats_real_glTexCoord1i) { glad_glTexCoord1i = glad_stats_real_glTexCoord1i; glad_stats_real_glTexCoord1i = 0; }
+	if (count && glad_glTexCoord1iv && glad_glTexCoord1iv != glad_stats_impl_glTexCoord1iv) { glad_stats_real_glTexCoord1iv = glad_glTexCoord1iv; glad_glTexCoord1iv = glad_stats_impl_glTexCoord1iv; }
+	else if (!count && glad_stats_real_glTexCoord1iv) { glad_glTexCoord1iv = glad_stats_real_glTexCoord1iv; glad_stats_real_glTexCoord1iv = 0; }
+	if (count && glad_glTexCoord1s && glad_glTexCoord1s != glad_stats_impl_glTexCoord1s) { glad_stats_real_glTexCoord1s = glad_glTexCoord1s; glad_glTexCoord1s = glad_stats_impl_glTexCoord1s; }
+	else if (!count && glad_stats_real_glTexCoord1s) { glad_glTexCoord1s = glad_stats_real_glTexCoord1s; glad_stats_real_glTexCoord1s = 0; }
+	if (count && glad_glTexCoord1sv && glad_glTexCoord1sv != glad_stats_impl_glTexCoord1sv) { glad_stats_real_glTexCoord1sv = glad_glTexCoord1sv; glad_glTexCoord1sv = glad_stats_impl_glTexCoord1sv; }
+	else if (!count && glad_stats_real_glTexCoord1sv) { glad_glTexCoord1sv = glad_stats_real_glTexCoord1sv; glad_stats_real_glTexCoord1sv = 0; }
+	if (count && glad_glTexCoord2d && glad_glTexCoord2d != glad_stats_impl_glTexCoord2d) { glad_stats_real_glTexCoord2d = glad_glTexCoord2d; glad_glTexCoord2d = glad_stats_impl_glTexCoord2d; }
+	else if (!count && glad_stats_real_glTexCoord2d) { glad_glTexCoord2d = glad_stats_real_glTexCoord2d; glad_stats_real_glTexCoord2d = 0; }
+	if (count && glad_glTexCoord2dv && glad_glTexCoord2dv != glad_stats_impl_glTexCoord2dv) { glad_stats_real_glTexCoord2dv = glad_glTexCoord2dv; glad_glTexCoord2dv = glad_stats_impl_glTexCoord2dv; }
+	else if (!count && glad_stats_real_glTexCoord2dv) { glad_glTexCoord2dv = glad_stats_real_glTexCoord2dv; glad_stats_real_glTexCoord2dv = 0; }
+	if (count && glad_glTexCoord2f && glad_glTexCoord2f != glad_stats_impl_glTexCoord2f) { glad_stats_real_glTexCoord2f = glad_glTexCoord2f; glad_glTexCoord2f = glad_stats_impl_glTexCoord2f; }
+	else if (!count && glad_stats_real_glTexCoord2f) { glad_glTexCoord2f = glad_stats_real_glTexCoord2f; glad_stats_real_glTexCoord2f = 0; }
+	if (count && glad_glTexCoord2fv && glad_glTexCoord2fv != glad_stats_impl_glTexCoord2fv) { glad_stats_real_glTexCoord2fv = glad_glTexCoord2fv; glad_glTexCoord2fv = glad_stats_impl_glTexCoord2fv; }
+	else if (!count && glad_stats_real_glTexCoord2fv) { glad_glTexCoord2fv = glad_stats_real_glTexCoord2fv; glad_stats_real_glTexCoord2fv = 0; }
+	if (count && glad_glTexCoord2i && glad_glTexCoord2i != glad_stats_impl_glTexCoord2i) { glad_stats_real_glTexCoord2i = glad_glTexCoord2i; glad_glTexCoord2i = glad_stats_impl_glTexCoord2i; }
+	else if (!count && glad_stats_real_glTexCoord2i) { glad_glTexCoord2i = glad_stats_real_glTexCoord2i; glad_stats_real_glTexCoord2i = 0; }
+	if (count && glad_glTexCoord2iv && glad_glTexCoord2iv != glad_stats_impl_glTexCoord2iv) { glad_stats_real_glTexCoord2iv = glad_glTexCoord2iv; glad_glTexCoord2iv = glad_stats_impl_glTexCoord2iv; }
+	else if (!count && glad_stats_real_glTexCoord2iv) { glad_glTexCoord2iv = glad_stats_real_glTexCoord2iv; glad_stats_real_glTexCoord2iv = 0; }
+	if (count && glad_glTexCoord2s && glad_glTexCoord2s != glad_stats_impl_glTexCoord2s) { glad_stats_real_glTexCoord2s = glad_glTexCoord2s; glad_glTexCoord2s = glad_stats_impl_glTexCoord2s; }
+	else if (!count && glad_stats_real_glTexCoord2s) { glad_glTexCoord2s = glad_stats_real_glTexCoord2s; glad_stats_real_glTexCoord2s = 0; }
+	if (count && glad_glTexCoord2sv && glad_glTexCoord2sv != glad_stats_impl_glTexCoord2sv) { glad_stats_real_glTexCoord2sv = glad_glTexCoord2sv; glad_glTexCoord2sv = glad_stats_impl_glTexCoord2sv; }
+	else if (!count && glad_stats_real_glTexCoord2sv) { glad_glTexCoord2sv = glad_stats_real_glTexCoord2sv; glad_stats_real_glTexCoord2sv = 0; }
+	if (count && glad_glTexCoord3d && glad_glTexCoord3d != glad_stats_impl_glTexCoord3d) { glad_stats_real_glTexCoord3d = glad_glTexCoord3d; glad_glTexCoord3d = glad_stats_impl_glTexCoord3d; }
+	else if (!count && glad_stats_real_glTexCoord3d) { glad_glTexCoord3d = glad_stats_real_glTexCoord3d; glad_stats_real_glTexCoord3d = 0; }
+	if (count && glad_glTexCoord3dv && glad_glTexCoord3dv != glad_stats_impl_glTexCoord3dv) { glad_stats_real_glTexCoord3dv = glad_glTexCoord3dv; glad_glTexCoord3dv = glad_stats_impl_glTexCoord3dv; }
+	else if (!count && glad_stats_real_glTexCoord3dv) { glad_glTexCoord3dv = glad_stats_real_glTexCoord3dv; glad_stats_real_glTexCoord3dv = 0; }
+	if (count && glad_glTexCoord3f && glad_glTexCoord3f != glad_stats_impl_glTexCoord3f) { glad_stats_real_glTexCoord3f = glad_glTexCoord3f; glad_glTexCoord3f = glad_stats_impl_glTexCoord3f; }
+	else if (!count && glad_stats_real_glTexCoord3f) { glad_glTexCoord3f = glad_stats_real_glTexCoord3f; glad_stats_real_glTexCoord3f = 0; }
+	if (count && glad_glTexCoord3fv && glad_glTexCoord3fv != glad_stats_impl_glTexCoord3fv) { glad_stats_real_glTexCoord3fv = glad_glTexCoord3fv; glad_glTexCoord3fv = glad_stats_impl_glTexCoord3fv; }
+	else if (!count && glad_stats_real_glTexCoord3fv) { glad_glTexCoord3fv = glad_stats_real_glTexCoord3fv; glad_stats_real_glTexCoord3fv = 0; }
+	if (count && glad_glTexCoord3i && glad_glTexCoord3i != glad_stats_impl_glTexCoord3i) { glad_stats_real_glTexCoord3i = glad_glTexCoord3i; glad_glTexCoord3i = glad_stats_impl_glTexCoord3i; }
+	else if (!count && glad_stats_real_glTexCoord3i) { glad_glTexCoord3i = glad_stats_real_glTexCoord3i; glad_stats_real_glTexCoord3i = 0; }
+	if (count && glad_glTexCoord3iv && glad_glTexCoord3iv != glad_stats_impl_glTexCoord3iv) { glad_stats_real_glTexCoord3iv = glad_glTexCoord3iv; glad_glTexCoord3iv = glad_stats_impl_glTexCoord3iv; }
+	else if (!count && glad_stats_real_glTexCoord3iv) { glad_glTexCoord3iv = glad_stats_real_glTexCoord3iv; glad_stats_real_glTexCoord3iv = 0; }
+	if (count && glad_glTexCoord3s && glad_glTexCoord3s != glad_stats_impl_glTexCoord3s) { glad_stats_real_glTexCoord3s = glad_glTexCoord3s; glad_glTexCoord3s = glad_stats_impl_glTexCoord3s; }
+	else if (!count && glad_stats_real_glTexCoord3s) { glad_glTexCoord3s = glad_stats_real_glTexCoord3s; glad_stats_real_glTexCoord3s = 0; }
+	if (count && glad_glTexCoord3sv && glad_glTexCoord3sv != glad_stats_impl_glTexCoord3sv) { glad_stats_real_glTexCoord3sv = glad_glTexCoord3sv; glad_glTexCoord3sv = glad_stats_impl_glTexCoord3sv; }
+	else if (!count && glad_stats_real_glTexCoord3sv) { glad_glTexCoord3sv = glad_stats_real_glTexCoord3sv; glad_stats_real_glTexCoord3sv = 0; }
+	if (count && glad_glTexCoord4d && glad_glTexCoord4d != glad_stats_impl_glTexCoord4d) { glad_stats_real_glTexCoord4d = glad_glTexCoord4d; glad_glTexCoord4d = glad_stats_impl_glTexCoord4d; }
+	else if (!count && glad_stats_real_glTexCoord4d) { glad_glTexCoord4d = glad_stats_real_glTexCoord4d; glad_stats_real_glTexCoord4d = 0; }
+	if (count && glad_glTexCoord4dv && glad_glTexCoord4dv != glad_stats_impl_glTexCoord4dv) { glad_stats_real_glTexCoord4dv = glad_glTexCoord4dv; glad_glTexCoord4dv = glad_stats_impl_glTexCoord4dv; }
+	else if (!count && glad_stats_real_glTexCoord4dv) { glad_glTexCoord4dv = glad_stats_real_glTexCoord4dv; glad_stats_real_glTexCoord4dv = 0; }
+	if (count && glad_glTexCoord4f && glad_glTexCoord4f != glad_stats_impl_glTexCoord4f) { glad_stats_real_glTexCoord4f = glad_glTexCoord4f; glad_glTexCoord4f = glad_stats_impl_glTexCoord4f; }
+	else if (!count && glad_stats_real_glTexCoord4f) { glad_glTexCoord4f = glad_stats_real_glTexCoord4f; glad_stats_real_glTexCoord4f = 0; }
+	if (count && glad_glTexCoord4fv && glad_glTexCoord4fv != glad_stats_impl_glTexCoord4fv) { glad_stats_real_glTexCoord4fv = glad_glTexCoord4fv; glad_glTexCoord4fv = glad_stats_impl_glTexCoord4fv; }
+	else if (!count && glad_stats_real_glTexCoord4fv) { glad_glTexCoord4fv = glad_stats_real_glTexCoord4fv; glad_stats_real_glTexCoord4fv = 0; }
+	if (count && glad_glTexCoord4i && glad_glTexCoord4i != glad_stats_impl_glTexCoord4i) { glad_stats_real_glTexCoord4i = glad_glTexCoord4i; glad_glTexCoord4i = glad_stats_impl_glTexCoord4i; }
+	else if (!count && glad_stats_real_glTexCoord4i) { glad_glTexCoord4i = glad_stats_real_glTexCoord4i; glad_stats_real_glTexCoord4i = 0; }
+	if (count && glad_glTexCoord4iv && glad_glTexCoord4iv != glad_stats_impl_glTexCoord4iv) { glad_stats_real_glTexCoord4iv = glad_glTexCoord4iv; glad_glTexCoord4iv = glad_stats_impl_glTexCoord4iv; }
+	else if (!count && glad_stats_real_glTexCoord4iv) { glad_glTexCoord4iv = glad_stats_real_glTexCoord4iv; glad_stats_real_glTexCoord4iv = 0; }
+	if (count && glad_glTexCoord4s && glad_glTexCoord4s != glad_stats_impl_glTexCoord4s) { glad_stats_real_glTexCoord4s = glad_glTexCoord4s; glad_glTexCoord4s = glad_stats_impl_glTexCoord4s; }
+	else if (!count && glad_stats_real_glTexCoord4s) { glad_glTexCoord4s = glad_stats_real_glTexCoord4s; glad_stats_real_glTexCoord4s = 0; }
+	if (count && glad_glTexCoord4sv && glad_glTexCoord4sv != glad_stats_impl_glTexCoord4sv) { glad_stats_real_glTexCoord4sv = glad_glTexCoord4sv; glad_glTexCoord4sv = glad_stats_impl_glTexCoord4sv; }
+	else if (!count && glad_stats_real_glTexCoord4sv) { glad_glTexCoord4sv = glad_stats_real_glTexCoord4sv; glad_stats_real_glTexCoord4sv = 0; }
+	if (count && glad_glTexCoordP1ui && glad_glTexCoordP1ui != glad_stats_impl_glTexCoordP1ui) { glad_stats_real_glTexCoordP1ui = glad_glTexCoordP1ui; glad_glTexCoordP1ui = glad_stats_impl_glTexCoordP1ui; }
+	else if (!count && glad_stats_real_glTexCoordP1ui) { glad_glTexCoordP1ui = glad_stats_real_glTexCoordP1ui; glad_stats_real_glTexCoordP1ui = 0; }
+	if (count && glad_glTexCoordP1uiv && glad_glTexCoordP1uiv != glad_stats_impl_glTexCoordP1uiv) { glad_stats_real_glTexCoordP1uiv = glad_glTexCoordP1uiv; glad_glTexCoordP1uiv = glad_stats_impl_glTexCoordP1uiv; }
+	else if (!count && glad_stats_real_glTexCoordP1uiv) { glad_glTexCoordP1uiv = glad_stats_real_glTexCoordP1uiv; glad_stats_real_glTexCoordP1uiv = 0; }
+	if (count && glad_glTexCoordP2ui && glad_glTexCoordP2ui != glad_stats_impl_glTexCoordP2ui) { glad_stats_real_glTexCoordP2ui = glad_glTexCoordP2ui; glad_glTexCoordP2ui = glad_stats_impl_glTexCoordP2ui; }
+	else if (!count && glad_stats_real_glTexCoordP2ui) { glad_glTexCoordP2ui = glad_stats_real_glTexCoordP2ui; glad_stats_real_glTexCoordP2ui = 0; }
+	if (count && glad_glTexCoordP2uiv && glad_glTexCoordP2uiv != glad_stats_impl_glTexCoordP2uiv) { glad_stats_real_glTexCoordP2uiv = glad_glTexCoordP2uiv; glad_glTexCoordP2uiv = glad_stats_impl_glTexCoordP2uiv; }
+	else if (!count && glad_stats_real_glTexCoordP2uiv) { glad_glTexCoordP2uiv = glad_stats_real_glTexCoordP2uiv; glad_stats_real_glTexCoordP2uiv = 0; }
+	if (count && glad_glTexCoordP3ui && glad_glTexCoordP3ui != glad_stats_impl_glTexCoordP3ui) { glad_stats_real_glTexCoordP3ui = glad_glTexCoordP3ui; glad_glTexCoordP3ui = glad_stats_impl_glTexCoordP3ui; }
+	else if (!count && glad_stats_real_glTexCoordP3ui) { glad_glTexCoordP3ui = glad_stats_real_glTexCoordP3ui; glad_stats_real_glTexCoordP3ui = 0; }
+	if (count && glad_glTexCoordP3uiv && glad_glTexCoordP3uiv != glad_stats_impl_glTexCoordP3uiv) { glad_stats_real_glTexCoordP3uiv = glad_glTexCoordP3uiv; glad_glTexCoordP3uiv = glad_stats_impl_glTexCoordP3uiv; }
+	else if (!count && glad_stats_real_glTexCoordP3uiv) { glad_glTexCoordP3uiv = glad_stats_real_glTexCoordP3uiv; glad_stats_real_glTexCoordP3uiv = 0; }
+	if (count && glad_glTexCoordP4ui && glad_glTexCoordP4ui != glad_stats_impl_glTexCoordP4ui) { glad_stats_real_glTexCoordP4ui = glad_glTexCoordP4ui; glad_glTexCoordP4ui = glad_stats_impl_glTexCoordP4ui; }
+	else if (!count && glad_stats_real_glTexCoordP4ui) { glad_glTexCoordP4ui = glad_stats_real_glTexCoordP4ui; glad_stats_real_glTexCoordP4ui = 0; }
+	if (count && glad_glTexCoordP4uiv && glad_glTexCoordP4uiv != glad_stats_impl_glTexCoordP4uiv) { glad_stats_real_glTexCoordP4uiv = glad_glTexCoordP4uiv; glad_glTexCoordP4uiv = glad_stats_impl_glTexCoordP4uiv; }
+	else if (!count && glad_stats_real_glTexCoordP4uiv) { glad_glTexCoordP4uiv = glad_stats_real_glTexCoordP4uiv; glad_stats_real_glTexCoordP4uiv = 0; }
+	if (count && glad_glTexCoordPointer && glad_glTexCoordPointer != glad_stats_impl_glTexCoordPointer) { glad_stats_real_glTexCoordPointer = glad_glTexCoordPointer; glad_glTexCoordPointer = glad_stats_impl_glTexCoordPointer; }
+	else if (!count && glad_stats_real_glTexCoordPointer) { glad_glTexCoordPointer = glad_stats_real_glTexCoordPointer; glad_stats_real_glTexCoordPointer = 0; }
+	if (count && glad_glTexEnvf && glad_glTexEnvf != glad_stats_impl_glTexEnvf) { glad_stats_real_glTexEnvf = glad_glTexEnvf; glad_glTexEnvf = glad_stats_impl_glTexEnvf; }
+	else if (!count && glad_stats_real_glTexEnvf) { glad_glTexEnvf = glad_stats_real_glTexEnvf; glad_stats_real_glTexEnvf = 0; }
+	if (count && glad_glTexEnvfv && glad_glTexEnvfv != glad_stats_impl_glTexEnvfv) { glad_stats_real_glTexEnvfv = glad_glTexEnvfv; glad_glTexEnvfv = glad_stats_impl_glTexEnvfv; }
+	else if (!count && glad_stats_real_glTexEnvfv) { glad_glTexEnvfv = glad_stats_real_glTexEnvfv; glad_stats_real_glTexEnvfv = 0; }
+	if (count && glad_glTexEnvi && glad_glTexEnvi != glad_stats_impl_glTexEnvi) { glad_stats_real_glTexEnvi = glad_glTexEnvi; glad_glTexEnvi = glad_stats_impl_glTexEnvi; }
+	else if (!count && glad_stats_real_glTexEnvi) { glad_glTexEnvi = glad_stats_real_glTexEnvi; glad_stats_real_glTexEnvi = 0; }
+	if (count && glad_glTexEnviv && glad_glTexEnviv != glad_stats_impl_glTexEnviv) { glad_stats_real_glTexEnviv = glad_glTexEnviv; glad_glTexEnviv = glad_stats_impl_glTexEnviv; }
+	else if (!count && glad_stats_real_glTexEnviv) { glad_glTexEnviv = glad_stats_real_glTexEnviv; glad_stats_real_glTexEnviv = 0; }
+	if (count && glad_glTexGend && glad_glTexGend != glad_stats_impl_glTexGend) { glad_stats_real_glTexGend = glad_glTexGend; glad_glTexGend = glad_stats_impl_glTexGend; }
+	else if (!count && glad_stats_real_glTexGend) { glad_glTexGend = glad_stats_real_glTexGend; glad_stats_real_glTexGend = 0; }
+	if (count && glad_glTexGendv && glad_glTexGendv != glad_stats_impl_glTexGendv) { glad_stats_real_glTexGendv = glad_glTexGendv; glad_glTexGendv = glad_stats_impl_glTexGendv; }
+	else if (!count && glad_stats_real_glTexGendv) { glad_glTexGendv = glad_stats_real_glTexGendv; glad_stats_real_glTexGendv = 0; }
+	if (count && glad_glTexGenf && glad_glTexGenf != glad_stats_impl_glTexGenf) { glad_stats_real_glTexGenf = glad_glTexGenf; glad_glTexGenf = glad_stats_impl_glTexGenf; }
+	else if (!count && glad_stats_real_glTexGenf) { glad_glTexGenf = glad_stats_real_glTexGenf; glad_stats_real_glTexGenf = 0; }
+	if (count && glad_glTexGenfv && glad_glTexGenfv != glad_stats_impl_glTexGenfv) { glad_stats_real_glTexGenfv = glad_glTexGenfv; glad_glTexGenfv = glad_stats_impl_glTexGenfv; }
+	else if (!count && glad_stats_real_glTexGenfv) { glad_glTexGenfv = glad_stats_real_glTexGenfv; glad_stats_real_glTexGenfv = 0; }
+	if (count && glad_glTexGeni && glad_glTexGeni != glad_stats_impl_glTexGeni) { glad_stats_real_glTexGeni = glad_glTexGeni; glad_glTexGeni = glad_stats_impl_glTexGeni; }
+	else if (!count && glad_stats_real_glTexGeni) { glad_glTexGeni = glad_stats_real_glTexGeni; glad_stats_real_glTexGeni = 0; }
+	if (count && glad_glTexGeniv && glad_glTexGeniv != glad_stats_impl_glTexGeniv) { glad_stats_real_glTexGeniv = glad_glTexGeniv; glad_glTexGeniv = glad_stats_impl_glTexGeniv; }
+	else if (!count && glad_stats_real_glTexGeniv) { glad_glTexGeniv = glad_stats_real_glTexGeniv; glad_stats_real_glTexGeniv = 0; }
+	if (count && glad_glTexImage1D && glad_glTexImage1D != glad_stats_impl_glTexImage1D) { glad_stats_real_glTexImage1D = glad_glTexImage1D; glad_glTexImage1D = glad_stats_impl_glTexImage1D; }
+	else if (!count && glad_stats_real_glTexImage1D) { glad_glTexImage1D = glad_stats_real_glTexImage1D; glad_stats_real_glTexImage1D = 0; }
+	if (count && glad_glTexImage2D && glad_glTexImage2D != glad_stats_impl_glTexImage2D) { glad_stats_real_glTexImage2D = glad_glTexImage2D; glad_glTexImage2D = glad_stats_impl_glTexImage2D; }
+	else if (!count && glad_stats_real_glTexImage2D) { glad_glTexImage2D = glad_stats_real_glTexImage2D; glad_stats_real_glTexImage2D = 0; }
+	if (count && glad_glTexImage2DMultisample && glad_glTexImage2DMultisample != glad_stats_impl_glTexImage2DMultisample) { glad_stats_real_glTexImage2DMultisample = glad_glTexImage2DMultisample; glad_glTexImage2DMultisample = glad_stats_impl_glTexImage2DMultisample; }
+	else if (!count && glad_stats_real_glTexImage2DMultisample) { glad_glTexImage2DMultisample = glad_stats_real_glTexImage2DMultisample; glad_stats_real_glTexImage2DMultisample = 0; }
+	if (count && glad_glTexImage3D && glad_glTexImage3D != glad_stats_impl_glTexImage3D) { glad_stats_real_glTexImage3D = glad_glTexImage3D; glad_glTexImage3D = glad_stats_impl_glTexImage3D; }
+	else if (!count && glad_stats_real_glTexImage3D) { glad_glTexImage3D = glad_stats_real_glTexImage3D; glad_stats_real_glTexImage3D = 0; }
+	if (count && glad_glTexImage3DMultisample && glad_glTexImage3DMultisample != glad_stats_impl_glTexImage3DMultisample) { glad_stats_real_glTexImage3DMultisample = glad_glTexImage3DMultisample; glad_glTexImage3DMultisample = glad_stats_impl_glTexImage3DMultisample; }
+	else if (!count && glad_stats_real_glTexImage3DMultisample) { glad_glTexImage3DMultisample = glad_stats_real_glTexImage3DMultisample; glad_stats_real_glTexImage3DMultisample = 0; }
+	if (count && glad_glTexParameterIiv && glad_glTexParameterIiv != glad_stats_impl_glTexParameterIiv) { glad_stats_real_glTexParameterIiv = glad_glTexParameterIiv; glad_glTexParameterIiv = glad_stats_impl_glTexParameterIiv; }
+	else if (!count && glad_stats_real_glTexParameterIiv) { glad_glTexParameterIiv = glad_stats_real_glTexParameterIiv; glad_stats_real_glTexParameterIiv = 0; }
+	if (count && glad_glTexParameterIuiv && glad_glTexParameterIuiv != glad_stats_impl_glTexParameterIuiv) { glad_stats_real_glTexParameterIuiv = glad_glTexParameterIuiv; glad_glTexParameterIuiv = glad_stats_impl_glTexParameterIuiv; }
+	else if (!count && glad_stats_real_glTexParameterIuiv) { glad_glTexParameterIuiv = glad_stats_real_glTexParameterIuiv; glad_stats_real_glTexParameterIuiv = 0; }
+	if (count && glad_glTexParameterf && glad_glTexParameterf != glad_stats_impl_glTexParameterf) { glad_stats_real_glTexParameterf = glad_glTexParameterf; glad_glTexParameterf = glad_stats_impl_glTexParameterf; }
+	else if (!count && glad_stats_real_glTexParameterf) { glad_glTexParameterf = glad_stats_real_glTexParameterf; glad_stats_real_glTexParameterf = 0; }
+	if (count && glad_glTexParameterfv && glad_glTexParameterfv != glad_stats_impl_glTexParameterfv) { glad_stats_real_glTexParameterfv = glad_glTexParameterfv; glad_glTexParameterfv = glad_stats_impl_glTexParameterfv; }
+	else if (!count && glad_stats_real_glTexParameterfv) { glad_glTexParameterfv = glad_stats_real_glTexParameterfv; glad_stats_real_glTexParameterfv = 0; }
+	if (count && glad_glTexParameteri && glad_glTexParameteri != glad_stats_impl_glTexParameteri) { glad_stats_real_glTexParameteri = glad_glTexParameteri; glad_glTexParameteri = glad_stats_impl_glTexParameteri; }
+	else if (!count && glad_stats_real_glTexParameteri) { glad_glTexParameteri = glad_stats_real_glTexParameteri; glad_stats_real_glTexParameteri = 0; }
+	if (count && glad_glTexParameteriv && glad_glTexParameteriv != glad_stats_impl_glTexParameteriv) { glad_stats_real_glTexParameteriv = glad_glTexParameteriv; glad_glTexParameteriv = glad_stats_impl_glTexParameteriv; }
+	else if (!count && glad_stats_real_glTexParameteriv) { glad_glTexParameteriv = glad_stats_real_glTexParameteriv; glad_stats_real_glTexParameteriv = 0; }
+	if (count && glad_glTexStorage1D && glad_glTexStorage1D != glad_stats_impl_glTexStorage1D) { glad_stats_real_glTexStorage1D = glad_glTexStorage1D; glad_glTexStorage1D = glad_stats_impl_glTexStorage1D; }
+	else if (!count && glad_stats_real_glTexStorage1D) { glad_glTexStorage1D = glad_stats_real_glTexStorage1D; glad_stats_real_glTexStorage1D = 0; }
+	if (count && glad_glTexStorage2D && glad_glTexStorage2D != glad_stats_impl_glTexStorage2D) { glad_stats_real_glTexStorage2D = glad_glTexStorage2D; glad_glTexStorage2D = glad_stats_impl_glTexStorage2D; }
+	else if (!count && glad_stats_real_glTexStorage2D) { glad_glTexStorage2D = glad_stats_real_glTexStorage2D; glad_stats_real_glTexStorage2D = 0; }
+	if (count && glad_glTexStorage2DMultisample && glad_glTexStorage2DMultisample != glad_stats_impl_glTexStorage2DMultisample) { glad_stats_real_glTexStorage2DMultisample = glad_glTexStorage2DMultisample; glad_glTexStorage2DMultisample = glad_stats_impl_glTexStorage2DMultisample; }
+	else if (!count && glad_stats_real_glTexStorage2DMultisample) { glad_glTexStorage2DMultisample = glad_stats_real_glTexStorage2DMultisample; glad_stats_real_glTexStorage2DMultisample = 0; }
+	if (count && glad_glTexStorage3D && glad_glTexStorage3D != glad_stats_impl_glTexStorage3D) { glad_stats_real_glTexStorage3D = glad_glTexStorage3D; glad_glTexStorage3D = glad_stats_impl_glTexStorage3D; }
+	else if (!count && glad_stats_real_glTexStorage3D) { glad_glTexStorage3D = glad_stats_real_glTexStorage3D; glad_stats_real_glTexStorage3D = 0; }
+	if (count && glad_glTexStorage3DMultisample && glad_glTexStorage3DMultisample != glad_stats_impl_glTexStorage3DMultisample) { glad_stats_real_glTexStorage3DMultisample = glad_glTexStorage3DMultisample; glad_glTexStorage3DMultisample = glad_stats_impl_glTexStorage3DMultisample; }
+	else if (!count && glad_stats_real_glTexStorage3DMultisample) { glad_glTexStorage3DMultisample = glad_stats_real_glTexStorage3DMultisample; glad_stats_real_glTexStorage3DMultisample = 0; }
+	if (count && glad_glTexSubImage1D && glad_glTexSubImage1D != glad_stats_impl_glTexSubImage1D) { glad_stats_real_glTexSubImage1D = glad_glTexSubImage1D; glad_glTexSubImage1D = glad_stats_impl_glTexSubImage1D; }
+	else if (!count && glad_stats_real_glTexSubImage1D) { glad_glTexSubImage1D = glad_stats_real_glTexSubImage1D; glad_stats_real_glTexSubImage1D = 0; }
+	if (count && glad_glTexSubImage2D && glad_glTexSubImage2D != glad_stats_impl_glTexSubImage2D) { glad_stats_real_glTexSubImage2D = glad_glTexSubImage2D; glad_glTexSubImage2D = glad_stats_impl_glTexSubImage2D; }
+	else if (!count && glad_stats_real_glTexSubImage2D) { glad_glTexSubImage2D = glad_stats_real_glTexSubImage2D; glad_stats_real_glTexSubImage2D = 0; }
+	if (count && glad_glTexSubImage3D && glad_glTexSubImage3D != glad_stats_impl_glTexSubImage3D) { glad_stats_real_glTexSubImage3D = glad_glTexSubImage3D; glad_glTexSubImage3D = glad_stats_impl_glTexSubImage3D; }
+	else if (!count && glad_stats_real_glTexSubImage3D) { glad_glTexSubImage3D = glad_stats_real_glTexSubImage3D; glad_stats_real_glTexSubImage3D = 0; }
+	if (count && glad_glTextureBarrier && glad_glTextureBarrier != glad_stats_impl_glTextureBarrier) { glad_stats_real_glTextureBarrier = glad_glTextureBarrier; glad_glTextureBarrier = glad_stats_impl_glTextureBarrier; }
+	else if (!count && glad_stats_real_glTextureBarrier) { glad_glTextureBarrier = glad_stats_real_glTextureBarrier; glad_stats_real_glTextureBarrier = 0; }
+	if (count && glad_glTextureBuffer && glad_glTextureBuffer != glad_stats_impl_glTextureBuffer) { glad_stats_real_glTextureBuffer = glad_glTextureBuffer; glad_glTextureBuffer = glad_stats_impl_glTextureBuffer; }
+	else if (!count && glad_stats_real_glTextureBuffer) { glad_glTextureBuffer = glad_stats_real_glTextureBuffer; glad_stats_real_glTextureBuffer = 0; }
+	if (count && glad_glTextureBufferRange && glad_glTextureBufferRange != glad_stats_impl_glTextureBufferRange) { glad_stats_real_glTextureBufferRange = glad_glTextureBufferRange; glad_glTextureBufferRange = glad_stats_impl_glTextureBufferRange; }
+	else if (!count && glad_stats_real_glTextureBufferRange) { glad_glTextureBufferRange = glad_stats_real_glTextureBufferRange; glad_stats_real_glTextureBufferRange = 0; }
+	if (count && glad_glTextureParameterIiv && glad_glTextureParameterIiv != glad_stats_impl_glTextureParameterIiv) { glad_stats_real_glTextureParameterIiv = glad_glTextureParameterIiv; glad_glTextureParameterIiv = glad_stats_impl_glTextureParameterIiv; }
+	else if (!count && glad_stats_real_glTextureParameterIiv) { glad_glTextureParameterIiv = glad_stats_real_glTextureParameterIiv; glad_stats_real_glTextureParameterIiv = 0; }
+	if (count && glad_glTextureParameterIuiv && glad_glTextureParameterIuiv != glad_stats_impl_glTextureParameterIuiv) { glad_stats_real_glTextureParameterIuiv = glad_glTextureParameterIuiv; glad_glTextureParameterIuiv = glad_stats_impl_glTextureParameterIuiv; }
+	else if (!count && glad_stats_real_glTextureParameterIuiv) { glad_glTextureParameterIuiv = glad_stats_real_glTextureParameterIuiv; glad_stats_real_glTextureParameterIuiv = 0; }
+	if (count && glad_glTextureParameterf && glad_glTextureParameterf != glad_stats_impl_glTextureParameterf) { glad_stats_real_glTextureParameterf = glad_glTextureParameterf; glad_glTextureParameterf = glad_stats_impl_glTextureParameterf; }
+	else if (!count && glad_stats_real_glTextureParameterf) { glad_glTextureParameterf = glad_stats_real_glTextureParameterf; glad_stats_real_glTextureParameterf = 0; }
+	if (count && glad_glTextureParameterfv && glad_glTextureParameterfv != glad_stats_impl_glTextureParameterfv) { glad_stats_real_glTextureParameterfv = glad_glTextureParameterfv; glad_glTextureParameterfv = glad_stats_impl_glTextureParameterfv; }
+	else if (!count && glad_stats_real_glTextureParameterfv) { glad_glTextureParameterfv = glad_stats_real_glTextureParameterfv; glad_stats_real_glTextureParameterfv = 0; }
+	if (count && glad_glTextureParameteri && glad_glTextureParameteri != glad_stats_impl_glTextureParameteri) { glad_stats_real_glTextureParameteri = glad_glTextureParameteri; glad_glTextureParameteri = glad_stats_impl_glTextureParameteri; }
+	else if (!count && glad_stats_real_glTextureParameteri) { glad_glTextureParameteri = glad_stats_real_glTextureParameteri; glad_stats_real_glTextureParameteri = 0; }
+	if (count && glad_glTextureParameteriv && glad_glTextureParameteriv != glad_stats_impl_glTextureParameteriv) { glad_stats_real_glTextureParameteriv = glad_glTextureParameteriv; glad_glTextureParameteriv = glad_stats_impl_glTextureParameteriv; }
+	else if (!count && glad_stats_real_glTextureParameteriv) { glad_glTextureParameteriv = glad_stats_real_glTextureParameteriv; glad_stats_real_glTextureParameteriv = 0; }
+	if (count && glad_glTextureStorage1D && glad_glTextureStorage1D != glad_stats_impl_glTextureStorage1D) { glad_stats_real_glTextureStorage1D = glad_glTextureStorage1D; glad_glTextureStorage1D = glad_stats_impl_glTextureStorage1D; }
+	else if (!count && glad_stats_real_glTextureStorage1D) { glad_glTextureStorage1D = glad_stats_real_glTextureStorage1D; glad_stats_real_glTextureStorage1D = 0; }
+	if (count && glad_glTextureStorage2D && glad_glTextureStorage2D != glad_stats_impl_glTextureStorage2D) { glad_stats_real_glTextureStorage2D = glad_glTextureStorage2D; glad_glTextureStorage2D = glad_stats_impl_glTextureStorage2D; }
+	else if (!count && glad_stats_real_glTextureStorage2D) { glad_glTextureStorage2D = glad_stats_real_glTextureStorage2D; glad_stats_real_glTextureStorage2D = 0; }
+	if (count && glad_glTextureStorage2DMultisample && glad_glTextureStorage2DMultisample != glad_stats_impl_glTextureStorage2DMultisample) { glad_stats_real_glTextureStorage2DMultisample = glad_glTextureStorage2DMultisample; glad_glTextureStorage2DMultisample = glad_stats_impl_glTextureStorage2DMultisample; }
+	else if (!count && glad_stats_real_glTextureStorage2DMultisample) { glad_glTextureStorage2DMultisample = glad_stats_real_glTextureStorage2DMultisample; glad_stats_real_glTextureStorage2DMultisample = 0; }
+	if (count && glad_glTextureStorage3D && glad_glTextureStorage3D != glad_stats_impl_glTextureStorage3D) { glad_stats_real_glTextureStorage3D = glad_glTextureStorage3D; glad_glTextureStorage3D = glad_stats_impl_glTextureStorage3D; }
+	else if (!count && glad_stats_real_glTextureStorage3D) { glad_glTextureStorage3D = glad_stats_real_glTextureStorage3D; glad_stats_real_glTextureStorage3D = 0; }
+	if (count && glad_glTextureStorage3DMultisample && glad_glTextureStorage3DMultisample != glad_stats_impl_glTextureStorage3DMultisample) { glad_stats_real_glTextureStorage3DMultisample = glad_glTextureStorage3DMultisample; glad_glTextureStorage3DMultisample = glad_stats_impl_glTextureStorage3DMultisample; }
+	else if (!count && glad_stats_real_glTextureStorage3DMultisample) { glad_glTextureStorage3DMultisample = glad_stats_real_glTextureStorage3DMultisample; glad_stats_real_glTextureStorage3DMultisample = 0; }
+	if (count && glad_glTextureSubImage1D && glad_glTextureSubImage1D != glad_stats_impl_glTextureSubImage1D) { glad_stats_real_glTextureSubImage1D = glad_glTextureSubImage1D; glad_glTextureSubImage1D = glad_stats_impl_glTextureSubImage1D; }
+	else if (!count && glad_stats_real_glTextureSubImage1D) { glad_glTextureSubImage1D = glad_stats_real_glTextureSubImage1D; glad_stats_real_glTextureSubImage1D = 0; }
+	if (count && glad_glTextureSubImage2D && glad_glTextureSubImage2D != glad_stats_impl_glTextureSubImage2D) { glad_stats_real_glTextureSubImage2D = glad_glTextureSubImage2D; glad_glTextureSubImage2D = glad_stats_impl_glTextureSubImage2D; }
+	else if (!count && glad_stats_real_glTextureSubImage2D) { glad_glTextureSubImage2D = glad_stats_real_glTextureSubImage2D; glad_stats_real_glTextureSubImage2D = 0; }
+	if (count && glad_glTextureSubImage3D && glad_glTextureSubImage3D != glad_stats_impl_glTextureSubImage3D) { glad_stats_real_glTextureSubImage3D = glad_glTextureSubImage3D; glad_glTextureSubImage3D = glad_stats_impl_glTextureSubImage3D; }
+	else if (!count && glad_stats_real_glTextureSubImage3D) { glad_glTextureSubImage3D = glad_stats_real_glTextureSubImage3D; glad_stats_real_glTextureSubImage3D = 0; }
+	if (count && glad_glTextureView && glad_glTextureView != glad_stats_impl_glTextureView) { glad_stats_real_glTextureView = glad_glTextureView; glad_glTextureView = glad_stats_impl_glTextureView; }
+	else if (!count && glad_stats_real_glTextureView) { glad_glTextureView = glad_stats_real_glTextureView; glad_stats_real_glTextureView = 0; }
+	if (count && glad_glTransformFeedbackBufferBase && glad_glTransformFeedbackBufferBase != glad_stats_impl_glTransformFeedbackBufferBase) { glad_stats_real_glTransformFeedbackBufferBase = glad_glTransformFeedbackBufferBase; glad_glTransformFeedbackBufferBase = glad_stats_impl_glTransformFeedbackBufferBase; }
+	else if (!count && glad_stats_real_glTransformFeedbackBufferBase) { glad_glTransformFeedbackBufferBase = glad_stats_real_glTransformFeedbackBufferBase; glad_stats_real_glTransformFeedbackBufferBase = 0; }
+	if (count && glad_glTransformFeedbackBufferRange && glad_glTransformFeedbackBufferRange != glad_stats_impl_glTransformFeedbackBufferRange) { glad_stats_real_glTransformFeedbackBufferRange = glad_glTransformFeedbackBufferRange; glad_glTransformFeedbackBufferRange = glad_stats_impl_glTransformFeedbackBufferRange; }
+	else if (!count && glad_stats_real_glTransformFeedbackBufferRange) { glad_glTransformFeedbackBufferRange = glad_stats_real_glTransformFeedbackBufferRange; glad_stats_real_glTransformFeedbackBufferRange = 0; }
+	if (count && glad_glTransformFeedbackVaryings && glad_glTransformFeedbackVaryings != glad_stats_impl_glTransformFeedbackVaryings) { glad_stats_real_glTransformFeedbackVaryings = glad_glTransformFeedbackVaryings; glad_glTransformFeedbackVaryings = glad_stats_impl_glTransformFeedbackVaryings; }
+	else if (!count && glad_stats_real_glTransformFeedbackVaryings) { glad_glTransformFeedbackVaryings = glad_stats_real_glTransformFeedbackVaryings; glad_stats_real_glTransformFeedbackVaryings = 0; }
+	if (count && glad_glTranslated && glad_glTranslated != glad_stats_impl_glTranslated) { glad_stats_real_glTranslated = glad_glTranslated; glad_glTranslated = glad_stats_impl_glTranslated; }
+	else if (!count && glad_stats_real_glTranslated) { glad_glTranslated = glad_stats_real_glTranslated; glad_stats_real_glTranslated = 0; }
+	if (count && glad_glTranslatef && glad_glTranslatef != glad_stats_impl_glTranslatef) { glad_stats_real_glTranslatef = glad_glTranslatef; glad_glTranslatef = glad_stats_impl_glTranslatef; }
+	else if (!count && glad_stats_real_glTranslatef) { glad_glTranslatef = glad_stats_real_glTranslatef; glad_stats_real_glTranslatef = 0; }
+	if (count && glad_glUniform1d && glad_glUniform1d != glad_stats_impl_glUniform1d) { glad_stats_real_glUniform1d = glad_glUniform1d; glad_glUniform1d = glad_stats_impl_glUniform1d; }
+	else if (!count && glad_stats_real_glUniform1d) { glad_glUniform1d = glad_stats_real_glUniform1d; glad_stats_real_glUniform1d = 0; }
+	if (count && glad_glUniform1dv && glad_glUniform1dv != glad_stats_impl_glUniform1dv) { glad_stats_real_glUniform1dv = glad_glUniform1dv; glad_glUniform1dv = glad_stats_impl_glUniform1dv; }
+	else if (!count && glad_stats_real_glUniform1dv) { glad_glUniform1dv = glad_stats_real_glUniform1dv; glad_stats_real_glUniform1dv = 0; }
+	if (count && glad_glUniform1f && glad_glUniform1f != glad_stats_impl_glUniform1f) { glad_stats_real_glUniform1f = glad_glUniform1f; glad_glUniform1f = glad_stats_impl_glUniform1f; }
+	else if (!count && glad_stats_real_glUniform1f) { glad_glUniform1f = glad_stats_real_glUniform1f; glad_stats_real_glUniform1f = 0; }
+	if (count && glad_glUniform1fv && glad_glUniform1fv != glad_stats_impl_glUniform1fv) { glad_stats_real_glUniform1fv = glad_glUniform1fv; glad_glUniform1fv = glad_stats_impl_glUniform1fv; }
+	else if (!count && glad_stats_real_glUniform1fv) { glad_glUniform1fv = glad_stats_real_glUniform1fv; glad_stats_real_glUniform1fv = 0; }
+	if (count && glad_glUniform1i && glad_glUniform1i != glad_stats_impl_glUniform1i) { glad_stats_real_glUniform1i = glad_glUniform1i; glad_glUniform1i = glad_stats_impl_glUniform1i; }
+	else if (!count && glad_stats_real_glUniform1i) { glad_glUniform1i = glad_stats_real_glUniform1i; glad_stats_real_glUniform1i = 0; }
+	if (count && glad_glUniform1iv && glad_glUniform1iv != glad_stats_impl_glUniform1iv) { glad_stats_real_glUniform1iv = glad_glUniform1iv; glad_glUniform1iv = glad_stats_impl_glUniform1iv; }
+	else if (!count && glad_stats_real_glUniform1iv) { glad_glUniform1iv = glad_stats_real_glUniform1iv; glad_stats_real_glUniform1iv = 0; }
+	if (count && glad_glUniform1ui && glad_glUniform1ui != glad_stats_impl_glUniform1ui) { glad_stats_real_glUniform1ui = glad_glUniform1ui; glad_glUniform1ui = glad_stats_impl_glUniform1ui; }
+	else if (!count && glad_stats_real_glUniform1ui) { glad_glUniform1ui = glad_stats_real_glUniform1ui; glad_stats_real_glUniform1ui = 0; }
+	if (count && glad_glUniform1uiv && glad_glUniform1uiv != glad_stats_impl_glUniform1uiv) { glad_stats_real_glUniform1uiv = glad_glUniform1uiv; glad_glUniform1uiv = glad_stats_impl_glUniform1uiv; }
+	else if (!count && glad_stats_real_glUniform1uiv) { glad_glUniform1uiv = glad_stats_real_glUniform1uiv; glad_stats_real_glUniform1uiv = 0; }
+	if (count && glad_glUniform2d && glad_glUniform2d != glad_stats_impl_glUniform2d) { glad_stats_real_glUniform2d = glad_glUniform2d; glad_glUniform2d = glad_stats_impl_glUniform2d; }
+	else if (!count && glad_stats_real_glUniform2d) { glad_glUniform2d = glad_stats_real_glUniform2d; glad_stats_real_glUniform2d = 0; }
+	if (count && glad_glUniform2dv && glad_glUniform2dv != glad_stats_impl_glUniform2dv) { glad_stats_real_glUniform2dv = glad_glUniform2dv; glad_glUniform2dv = glad_stats_impl_glUniform2dv; }
+	else if (!count && glad_stats_real_glUniform2dv) { glad_glUniform2dv = glad_stats_real_glUniform2dv; glad_stats_real_glUniform2dv = 0; }
+	if (count && glad_glUniform2f && glad_glUniform2f != glad_stats_impl_glUniform2f) { glad_stats_real_glUniform2f = glad_glUniform2f; glad_glUniform2f = glad_stats_impl_glUniform2f; }
+	else if (!count && glad_stats_real_glUniform2f) { glad_glUniform2f = glad_stats_real_glUniform2f; glad_stats_real_glUniform2f = 0; }
+	if (count && glad_glUniform2fv && glad_glUniform2fv != glad_stats_impl_glUniform2fv) { glad_stats_real_glUniform2fv = glad_glUniform2fv; glad_glUniform2fv = glad_stats_impl_glUniform2fv; }
+	else if (!count && glad_stats_real_glUniform2fv) { glad_glUniform2fv = glad_stats_real_glUniform2fv; glad_stats_real_glUniform2fv = 0; }
+	if (count && glad_glUniform2i && glad_glUniform2i != glad_stats_impl_glUniform2i) { glad_stats_real_glUniform2i = glad_glUniform2i; glad_glUniform2i = glad_stats_impl_glUniform2i; }
+	else if (!count && glad_stats_real_glUniform2i) { glad_glUniform2i = glad_stats_real_glUniform2i; glad_stats_real_glUniform2i = 0; }
+	if (count && glad_glUniform2iv && glad_glUniform2iv != glad_stats_impl_glUniform2iv) { glad_stats_real_glUniform2iv = glad_glUniform2iv; glad_glUniform2iv = glad_stats_impl_glUniform2iv; }
+	else if (!count && glad_stats_real_glUniform2iv) { glad_glUniform2iv = glad_stats_real_glUniform2iv; glad_stats_real_glUniform2iv = 0; }
+	if (count && glad_glUniform2ui && glad_glUniform2ui != glad_stats_impl_glUniform2ui) { glad_stats_real_glUniform2ui = glad_glUniform2ui; glad_glUniform2ui = glad_stats_impl_glUniform2ui; }
+	else if (!count && glad_stats_real_glUniform2ui) { glad_glUniform2ui = glad_stats_real_glUniform2ui; glad_stats_real_glUniform2ui = 0; }
+	if (count && glad_glUniform2uiv && glad_glUniform2uiv != glad_stats_impl_glUniform2uiv) { glad_stats_real_glUniform2uiv = glad_glUniform2uiv; glad_glUniform2uiv = glad_stats_impl_glUniform2uiv; }
+	else if (!count && glad_stats_real_glUniform2uiv) { glad_glUniform2uiv = glad_stats_real_glUniform2uiv; glad_stats_real_glUniform2uiv = 0; }
+	if (count && glad_glUniform3d && glad_glUniform3d != glad_stats_impl_glUniform3d) { glad_stats_real_glUniform3d = glad_glUniform3d; glad_glUniform3d = glad_stats_impl_glUniform3d; }
+	else if (!count && glad_stats_real_glUniform3d) { glad_glUniform3d = glad_stats_real_glUniform3d; glad_stats_real_glUniform3d = 0; }
+	if (count && glad_glUniform3dv && glad_glUniform3dv != glad_stats_impl_glUniform3dv) { glad_stats_real_glUniform3dv = glad_glUniform3dv; glad_glUniform3dv = glad_stats_impl_glUniform3dv; }
+	else if (!count && glad_stats_real_glUniform3dv) { glad_glUniform3dv = glad_stats_real_glUniform3dv; glad_stats_real_glUniform3dv = 0; }
+	if (count && glad_glUniform3f && glad_glUniform3f != glad_stats_impl_glUniform3f) { glad_stats_real_glUniform3f = glad_glUniform3f; glad_glUniform3f = glad_stats_impl_glUniform3f; }
+	else if (!count && glad_stats_real_glUniform3f) { glad_glUniform3f = glad_stats_real_glUniform3f; glad_stats_real_glUniform3f = 0; }
+	if (count && glad_glUniform3fv && glad_glUniform3fv != glad_stats_impl_glUniform3fv) { glad_stats_real_glUniform3fv = glad_glUniform3fv; glad_glUniform3fv = glad_stats_impl_glUniform3fv; }
+	else if (!count && glad_stats_real_glUniform3fv) { glad_glUniform3fv = glad_stats_real_glUniform3fv; glad_stats_real_glUniform3fv = 0; }
+	if (count && glad_glUniform3i && glad_glUniform3i != glad_stats_impl_glUniform3i) { glad_stats_real_glUniform3i = glad_glUniform3i; glad_glUniform3i = glad_stats_impl_glUniform3i; }
+	else if (!count && glad_stats_real_glUniform3i) { glad_glUniform3i = glad_stats_real_glUniform3i; glad_stats_real_glUniform3i = 0; }
+	if (count && glad_glUniform3iv && glad_glUniform3iv != glad_stats_impl_glUniform3iv) { glad_stats_real_glUniform3iv = glad_glUniform3iv; glad_glUniform3iv = glad_stats_impl_glUniform3iv; }
+	else if (!count && glad_stats_real_glUniform3iv) { glad_glUniform3iv = glad_stats_real_glUniform3iv; glad_stats_real_glUniform3iv = 0; }
+	if (count && glad_glUniform3ui && glad_glUniform3ui != glad_stats_impl_glUniform3ui) { glad_stats_real_glUniform3ui = glad_glUniform3ui; glad_glUniform3ui = glad_stats_impl_glUniform3ui; }
+	else if (!count && glad_stats_real_glUniform3ui) { glad_glUniform3ui = glad_stats_real_glUniform3ui; glad_stats_real_glUniform3ui = 0; }
+	if (count && glad_glUniform3uiv && glad_glUniform3uiv != glad_stats_impl_glUniform3uiv) { glad_stats_real_glUniform3uiv = glad_glUniform3uiv; glad_glUniform3uiv = glad_stats_impl_glUniform3uiv; }
+	else if (!count && glad_stats_real_glUniform3uiv) { glad_glUniform3uiv = glad_stats_real_glUniform3uiv; glad_stats_real_glUniform3uiv = 0; }
+	if (count && glad_glUniform4d && glad_glUniform4d != glad_stats_impl_glUniform4d) { glad_stats_real_glUniform4d = glad_glUniform4d; glad_glUniform4d = glad_stats_impl_glUniform4d; }
+	else if (!count && glad_stats_real_glUniform4d) { glad_glUniform4d = glad_stats_real_glUniform4d; glad_stats_real_glUniform4d = 0; }
+	if (count && glad_glUniform4dv && glad_glUniform4dv != glad_stats_impl_glUniform4dv) { glad_stats_real_glUniform4dv = glad_glUniform4dv; glad_glUniform4dv = glad_stats_impl_glUniform4dv; }
+	else if (!count && glad_stats_real_glUniform4dv) { glad_glUniform4dv = glad_stats_real_glUniform4dv; glad_stats_real_glUniform4dv = 0; }
+	if (count && glad_glUniform4f && glad_glUniform4f != glad_stats_impl_glUniform4f) { glad_stats_real_glUniform4f = glad_glUniform4f; glad_glUniform4f = glad_stats_impl_glUniform4f; }
+	else if (!count && glad_stats_real_glUniform4f) { glad_glUniform4f = glad_stats_real_glUniform4f; glad_stats_real_glUniform4f = 0; }
+	if (count && glad_glUniform4fv && glad_glUniform4fv != glad_stats_impl_glUniform4fv) { glad_stats_real_glUniform4fv = glad_glUniform4fv; glad_glUniform4fv = glad_stats_impl_glUniform4fv; }
+	else if (!count && glad_stats_real_glUniform4fv) { glad_glUniform4fv = glad_stats_real_glUniform4fv; glad_stats_real_glUniform4fv = 0; }
+	if (count && glad_glUniform4i && glad_glUniform4i != glad_stats_impl_glUniform4i) { glad_stats_real_glUniform4i = glad_glUniform4i; glad_glUniform4i = glad_stats_impl_glUniform4i; }
+	else if (!count && glad_stats_real_glUniform4i) { glad_glUniform4i = glad_stats_real_glUniform4i; glad_stats_real_glUniform4i = 0; }
+	if (count && glad_glUniform4iv && glad_glUniform4iv != glad_stats_impl_glUniform4iv) { glad_stats_real_glUniform4iv = glad_glUniform4iv; glad_glUniform4iv = glad_stats_impl_glUniform4iv; }
+	else if (!count && glad_stats_real_glUniform4iv) { glad_glUniform4iv = glad_stats_real_glUniform4iv; glad_stats_real_glUniform4iv = 0; }
+	if (count && glad_glUniform4ui && glad_glUniform4ui != glad_stats_impl_glUniform4ui) { glad_stats_real_glUniform4ui = glad_glUniform4ui; glad_glUniform4ui = glad_stats_impl_glUniform4ui; }
+	else if (!count && glad_stats_real_glUniform4ui) { glad_glUniform4ui = glad_stats_real_glUniform4ui; glad_stats_real_glUniform4ui = 0; }
+	if (count && glad_glUniform4uiv && glad_glUniform4uiv != glad_stats_impl_glUniform4uiv) { glad_stats_real_glUniform4uiv = glad_glUniform4uiv; glad_glUniform4uiv = glad_stats_impl_glUniform4uiv; }
+	else if (!count && glad_stats_real_glUniform4uiv) { glad_glUniform4uiv = glad_stats_real_glUniform4uiv; glad_stats_real_glUniform4uiv = 0; }
+	if (count && glad_glUniformBlockBinding && glad_glUniformBlockBinding != glad_stats_impl_glUniformBlockBinding) { glad_stats_real_glUniformBlockBinding = glad_glUniformBlockBinding; glad_glUniformBlockBinding = glad_stats_impl_glUniformBlockBinding; }
+	else if (!count && glad_stats_real_glUniformBlockBinding) { glad_glUniformBlockBinding = glad_stats_real_glUniformBlockBinding; glad_stats_real_glUniformBlockBinding = 0; }
+	if (count && glad_glUniformHandleui64ARB && glad_glUniformHandleui64ARB != glad_stats_impl_glUniformHandleui64ARB) { glad_stats_real_glUniformHandleui64ARB = glad_glUniformHandleui64ARB; glad_glUniformHandleui64ARB = glad_stats_impl_glUniformHandleui64ARB; }
+	else if (!count && glad_stats_real_glUniformHandleui64ARB) { glad_glUniformHandleui64ARB = glad_stats_real_glUniformHandleui64ARB; glad_stats_real_glUniformHandleui64ARB = 0; }
+	if (count && glad_glUniformHandleui64vARB && glad_glUniformHandleui64vARB != glad_stats_impl_glUniformHandleui64vARB) { glad_stats_real_glUniformHandleui64vARB = glad_glUniformHandleui64vARB; glad_glUniformHandleui64vARB = glad_stats_impl_glUniformHandleui64vARB; }
+	else if (!count && glad_stats_real_glUniformHandleui64vARB) { glad_glUniformHandleui64vARB = glad_stats_real_glUniformHandleui64vARB; glad_stats_real_glUniformHandleui64vARB = 0; }
+	if (count && glad_glUniformMatrix2dv && glad_glUniformMatrix2dv != glad_stats_impl_glUniformMatrix2dv) { glad_stats_real_glUniformMatrix2dv = glad_glUniformMatrix2dv; glad_glUniformMatrix2dv = glad_stats_impl_glUniformMatrix2dv; }
+	else if (!count && glad_stats_real_glUniformMatrix2dv) { glad_glUniformMatrix2dv = glad_stats_real_glUniformMatrix2dv; glad_stats_real_glUniformMatrix2dv = 0; }
+	if (count && glad_glUniformMatrix2fv && glad_glUniformMatrix2fv != glad_stats_impl_glUniformMatrix2fv) { glad_stats_real_glUniformMatrix2fv = glad_glUniformMatrix2fv; glad_glUniformMatrix2fv = glad_stats_impl_glUniformMatrix2fv; }
+	else if (!count && glad_stats_real_glUniformMatrix2fv) { glad_glUniformMatrix2fv = glad_stats_real_glUniformMatrix2fv; glad_stats_real_glUniformMatrix2fv = 0; }
+	if (count && glad_glUniformMatrix2x3dv && glad_glUniformMatrix2x3dv != glad_stats_impl_glUniformMatrix2x3dv) { glad_stats_real_glUniformMatrix2x3dv = glad_glUniformMatrix2x3dv; glad_glUniformMatrix2x3dv = glad_stats_impl_glUniformMatrix2x3dv; }
+	else if (!count && glad_stats_real_glUniformMatrix2x3dv) { glad_glUniformMatrix2x3dv = glad_stats_real_glUniformMatrix2x3dv; glad_stats_real_glUniformMatrix2x3dv = 0; }
+	if (count && glad_glUniformMatrix2x3fv && glad_glUniformMatrix2x3fv != glad_stats_impl_glUniformMatrix2x3fv) { glad_stats_real_glUniformMatrix2x3fv = glad_glUniformMatrix2x3fv; glad_glUniformMatrix2x3fv = glad_stats_impl_glUniformMatrix2x3fv; }
+	else if (!count && glad_stats_real_glUniformMatrix2x3fv) { glad_glUniformMatrix2x3fv = glad_stats_real_glUniformMatrix2x3fv; glad_stats_real_glUniformMatrix2x3fv = 0; }
+	if (count && glad_glUniformMatrix2x4dv && glad_glUniformMatrix2x4dv != glad_stats_impl_glUniformMatrix2x4dv) { glad_stats_real_glUniformMatrix2x4dv = glad_glUniformMatrix2x4dv; glad_glUniformMatrix2x4dv = glad_stats_impl_glUniformMatrix2x4dv; }
+	else if (!count && glad_stats_real_glUniformMatrix2x4dv) { glad_glUniformMatrix2x4dv = glad_stats_real_glUniformMatrix2x4dv; glad_stats_real_glUniformMatrix2x4dv = 0; }
+	if (count && glad_glUniformMatrix2x4fv && glad_glUniformMatrix2x4fv != glad_stats_impl_glUniformMatrix2x4fv) { glad_stats_real_glUniformMatrix2x4fv = glad_glUniformMatrix2x4fv; glad_glUniformMatrix2x4fv = glad_stats_impl_glUniformMatrix2x4fv; }
+	else if (!count && glad_stats_real_glUniformMatrix2x4fv) { glad_glUniformMatrix2x4fv = glad_stats_real_glUniformMatrix2x4fv; glad_stats_real_glUniformMatrix2x4fv = 0; }
+	if (count && glad_glUniformMatrix3dv && glad_glUniformMatrix3dv != glad_stats_impl_glUniformMatrix3dv) { glad_stats_real_glUniformMatrix3dv = glad_glUniformMatrix3dv; glad_glUniformMatrix3dv = glad_stats_impl_glUniformMatrix3dv; }
+	else if (!count && glad_stats_real_glUniformMatrix3dv) { glad_glUniformMatrix3dv = glad_stats_real_glUniformMatrix3dv; glad_stats_real_glUniformMatrix3dv = 0; }
+	if (count && glad_glUniformMatrix3fv && glad_glUniformMatrix3fv != glad_stats_impl_glUniformMatrix3fv) { glad_stats_real_glUniformMatrix3fv = glad_glUniformMatrix3fv; glad_glUniformMatrix3fv = glad_stats_impl_glUniformMatrix3fv; }
+	else if (!count && glad_stats_real_glUniformMatrix3fv) { glad_glUniformMatrix3fv = glad_stats_real_glUniformMatrix3fv; glad_stats_real_glUniformMatrix3fv = 0; }
+	if (count && glad_glUniformMatrix3x2dv && glad_glUniformMatrix3x2dv != glad_stats_impl_glUniformMatrix3x2dv) { glad_stats_real_glUniformMatrix3x2dv = glad_glUniformMatrix3x2dv; glad_glUniformMatrix3x2dv = glad_stats_impl_glUniformMatrix3x2dv; }
+	else if (!count && glad_stats_real_glUniformMatrix3x2dv) { glad_glUniformMatrix3x2dv = glad_stats_real_glUniformMatrix3x2dv; glad_stats_real_glUniformMatrix3x2dv = 0; }
+	if (count && glad_glUniformMatrix3x2fv && glad_glUniformMatrix3x2fv != glad_stats_impl_glUniformMatrix3x2fv) { glad_stats_real_glUniformMatrix3x2fv = glad_glUniformMatrix3x2fv; glad_glUniformMatrix3x2fv = glad_stats_impl_glUniformMatrix3x2fv; }
+	else if (!count && glad_stats_real_glUniformMatrix3x2fv) { glad_glUniformMatrix3x2fv = glad_stats_real_glUniformMatrix3x2fv; glad_stats_real_glUniformMatrix3x2fv = 0; }
+	if (count && glad_glUniformMatrix3x4dv && glad_glUniformMatrix3x4dv != glad_stats_impl_glUniformMatrix3x4dv) { glad_stats_real_glUniformMatrix3x4dv = glad_glUniformMatrix3x4dv; glad_glUniformMatrix3x4dv = glad_stats_impl_glUniformMatrix3x4dv; }
+	else if (!count && glad_stats_real_glUniformMatrix3x4dv) { glad_glUniformMatrix3x4dv = glad_stats_real_glUniformMatrix3x4dv; glad_stats_real_glUniformMatrix3x4dv = 0; }
+	if (count && glad_glUniformMatrix3x4fv && glad_glUniformMatrix3x4fv != glad_stats_impl_glUniformMatrix3x4fv) { glad_stats_real_glUniformMatrix3x4fv = glad_glUniformMatrix3x4fv; glad_glUniformMatrix3x4fv = glad_stats_impl_glUniformMatrix3x4fv; }
+	else if (!count && glad_stats_real_glUniformMatrix3x4fv) { glad_glUniformMatrix3x4fv = glad_stats_real_glUniformMatrix3x4fv; glad_stats_real_glUniformMatrix3x4fv = 0; }
+	if (count && glad_glUniformMatrix4dv && glad_glUniformMatrix4dv != glad_stats_impl_glUniformMatrix4dv) { glad_stats_real_glUniformMatrix4dv = glad_glUniformMatrix4dv; glad_glUniformMatrix4dv = glad_stats_impl_glUniformMatrix4dv; }
+	else if (!count && glad_stats_real_glUniformMatrix4dv) { glad_glUniformMatrix4dv = glad_stats_real_glUniformMatrix4dv; glad_stats_real_glUniformMatrix4dv = 0; }
+	if (count && glad_glUniformMatrix4fv && glad_glUniformMatrix4fv != glad_stats_impl_glUniformMatrix4fv) { glad_stats_real_glUniformMatrix4fv = glad_glUniformMatrix4fv; glad_glUniformMatrix4fv = glad_stats_impl_glUniformMatrix4fv; }
+	else if (!count && glad_stats_real_glUniformMatrix4fv) { glad_glUniformMatrix4fv = glad_stats_real_glUniformMatrix4fv; glad_stats_real_glUniformMatrix4fv = 0; }
+	if (count && glad_glUniformMatrix4x2dv && glad_glUniformMatrix4x2dv != glad_stats_impl_glUniformMatrix4x2dv) { glad_stats_real_glUniformMatrix4x2dv = glad_glUniformMatrix4x2dv; glad_glUniformMatrix4x2dv = glad_stats_impl_glUniformMatrix4x2dv; }
+	else if (!count && glad_stats_real_glUniformMatrix4x2dv) { glad_glUniformMatrix4x2dv = glad_stats_real_glUniformMatrix4x2dv; glad_stats_real_glUniformMatrix4x2dv = 0; }
+	if (count && glad_glUniformMatrix4x2fv && glad_glUniformMatrix4x2fv != glad_stats_impl_glUniformMatrix4x2fv) { glad_stats_real_glUniformMatrix4x2fv = glad_glUniformMatrix4x2fv; glad_glUniformMatrix4x2fv = glad_stats_impl_glUniformMatrix4x2fv; }
+	else if (!count && glad_stats_real_glUniformMatrix4x2fv) { glad_glUniformMatrix4x2fv = glad_stats_real_glUniformMatrix4x2fv; glad_stats_real_glUniformMatrix4x2fv = 0; }
+	if (count && glad_glUniformMatrix4x3dv && glad_glUniformMatrix4x3dv != glad_stats_impl_glUniformMatrix4x3dv) { glad_stats_real_glUniformMatrix4x3dv = glad_glUniformMatrix4x3dv; glad_glUniformMatrix4x3dv = glad_stats_impl_glUniformMatrix4x3dv; }
+	else if (!count && glad_stats_real_glUniformMatrix4x3dv) { glad_glUniformMatrix4x3dv = glad_stats_real_glUniformMatrix4x3dv; glad_stats_real_glUniformMatrix4x3dv = 0; }
+	if (count && glad_glUniformMatrix4x3fv && glad_glUniformMatrix4x3fv != glad_stats_impl_glUniformMatrix4x3fv) { glad_stats_real_glUniformMatrix4x3fv = glad_glUniformMatrix4x3fv; glad_glUniformMatrix4x3fv = glad_stats_impl_glUniformMatrix4x3fv; }
+	else if (!count && glad_stats_real_glUniformMatrix4x3fv) { glad_glUniformMatrix4x3fv = glad_stats_real_glUniformMatrix4x3fv; glad_stats_real_glUniformMatrix4x3fv = 0; }
+	if (count && glad_glUniformSubroutinesuiv && glad_glUniformSubroutinesuiv != glad_stats_impl_glUniformSubroutinesuiv) { glad_stats_real_glUniformSubroutinesuiv = glad_glUniformSubroutinesuiv; glad_glUniformSubroutinesuiv = glad_stats_impl_glUniformSubroutinesuiv; }
+	else if (!count && glad_stats_real_glUniformSubroutinesuiv) { glad_glUniformSubroutinesuiv = glad_stats_real_glUniformSubroutinesuiv; glad_stats_real_glUniformSubroutinesuiv = 0; }
+	if (count && glad_glUnmapBuffer && glad_glUnmapBuffer != glad_stats_impl_glUnmapBuffer) { glad_stats_real_glUnmapBuffer = glad_glUnmapBuffer; glad_glUnmapBuffer = glad_stats_impl_glUnmapBuffer; }
+	else if (!count && glad_stats_real_glUnmapBuffer) { glad_glUnmapBuffer = glad_stats_real_glUnmapBuffer; glad_stats_real_glUnmapBuffer = 0; }
+	if (count && glad_glUnmapNamedBuffer && glad_glUnmapNamedBuffer != glad_stats_impl_glUnmapNamedBuffer) { glad_stats_real_glUnmapNamedBuffer = glad_glUnmapNamedBuffer; glad_glUnmapNamedBuffer = glad_stats_impl_glUnmapNamedBuffer; }
+	else if (!count && glad_stats_real_glUnmapNamedBuffer) { glad_glUnmapNamedBuffer = glad_stats_real_glUnmapNamedBuffer; glad_stats_real_glUnmapNamedBuffer = 0; }
+	if (count && glad_glUseProgram && glad_glUseProgram != glad_stats_impl_glUseProgram) { glad_stats_real_glUseProgram = glad_glUseProgram; glad_glUseProgram = glad_stats_impl_glUseProgram; }
+	else if (!count && glad_stats_real_glUseProgram) { glad_glUseProgram = glad_stats_real_glUseProgram; glad_stats_real_glUseProgram = 0; }
+	if (count && glad_glUseProgramStages && glad_glUseProgramStages != glad_stats_impl_glUseProgramStages) { glad_stats_real_glUseProgramStages = glad_glUseProgramStages; glad_glUseProgramStages = glad_stats_impl_glUseProgramStages; }
+	else if (!count && glad_stats_real_glUseProgramStages) { glad_glUseProgramStages = glad_stats_real_glUseProgramStages; glad_stats_real_glUseProgramStages = 0; }
+	if (count && glad_glValidateProgram && glad_glValidateProgram != glad_stats_impl_glValidateProgram) { glad_stats_real_glValidateProgram = glad_glValidateProgram; glad_glValidateProgram = glad_stats_impl_glValidateProgram; }
+	else if (!count && glad_stats_real_glValidateProgram) { glad_glValidateProgram = glad_stats_real_glValidateProgram; glad_stats_real_glValidateProgram = 0; }
+	if (count && glad_glValidateProgramPipeline && glad_glValidateProgramPipeline != glad_stats_impl_glValidateProgramPipeline) { glad_stats_real_glValidateProgramPipeline = glad_glValidateProgramPipeline; glad_glValidateProgramPipeline = glad_stats_impl_glValidateProgramPipeline; }
+	else if (!count && glad_stats_real_glValidateProgramPipeline) { glad_glValidateProgramPipeline = glad_stats_real_glValidateProgramPipeline; glad_stats_real_glValidateProgramPipeline = 0; }
+	if (count && glad_glVertex2d && glad_glVertex2d != glad_stats_impl_glVertex2d) { glad_stats_real_glVertex2d = glad_glVertex2d; glad_glVertex2d = glad_stats_impl_glVertex2d; }
+	else if (!count && glad_stats_real_glVertex2d) { glad_glVertex2d = glad_stats_real_glVertex2d; glad_stats_real_glVertex2d = 0; }
+	if (count && glad_glVertex2dv && glad_glVertex2dv != glad_stats_impl_glVertex2dv) { glad_stats_real_glVertex2dv = glad_glVertex2dv; glad_glVertex2dv = glad_stats_impl_glVertex2dv; }
+	else if (!count && glad_stats_real_glVertex2dv) { glad_glVertex2dv = glad_stats_real_glVertex2dv; glad_stats_real_glVertex2dv = 0; }
+	if (count && glad_glVertex2f && glad_glVertex2f != glad_stats_impl_glVertex2f) { glad_stats_real_glVertex2f = glad_glVertex2f; glad_glVertex2f = glad_stats_impl_glVertex2f; }
+	else if (!count && glad_stats_real_glVertex2f) { glad_glVertex2f = glad_stats_real_glVertex2f; glad_stats_real_glVertex2f = 0; }
+	if (count && glad_glVertex2fv && glad_glVertex2fv != glad_stats_impl_glVertex2fv) { glad_stats_real_glVertex2fv = glad_glVertex2fv; glad_glVertex2fv = glad_stats_impl_glVertex2fv; }
+	else if (!count && glad_stats_real_glVertex2fv) { glad_glVertex2fv = glad_stats_real_glVertex2fv; glad_stats_real_glVertex2fv = 0; }
+	if (count && glad_glVertex2i && glad_glVertex2i != glad_stats_impl_glVertex2i) { glad_stats_real_glVertex2i = glad_glVertex2i; glad_glVertex2i = glad_stats_impl_glVertex2i; }
+	else if (!count && glad_stats_real_glVertex2i) { glad_glVertex2i = glad_stats_real_glVertex2i; glad_stats_real_glVertex2i = 0; }
+	if (count && glad_glVertex2iv && glad_glVertex2iv != glad_stats_impl_glVertex2iv) { glad_stats_real_glVertex2iv = glad_glVertex2iv; glad_glVertex2iv = glad_stats_impl_glVertex2iv; }
+	else if (!count && glad_stats_real_glVertex2iv) { glad_glVertex2iv = glad_stats_real_glVertex2iv; glad_stats_real_glVertex2iv = 0; }
+	if (count && glad_glVertex2s && glad_glVertex2s != glad_stats_impl_glVertex2s) { glad_stats_real_glVertex2s = glad_glVertex2s; glad_glVertex2s = glad_stats_impl_glVertex2s; }
+	else if (!count && glad_stats_real_glVertex2s) { glad_glVertex2s = glad_stats_real_glVertex2s; glad_stats_real_glVertex2s = 0; }
+	if (count && glad_glVertex2sv && glad_glVertex2sv != glad_stats_impl_glVertex2sv) { glad_stats_real_glVertex2sv = glad_glVertex2sv; glad_glVertex2sv = glad_stats_impl_glVertex2sv; }
+	else if (!count && glad_stats_real_glVertex2sv) { glad_glVertex2sv = glad_stats_real_glVertex2sv; glad_stats_real_glVertex2sv = 0; }
+	if (count && glad_glVertex3d && glad_glVertex3d != glad_stats_impl_glVertex3d) { glad_stats_real_glVertex3d = glad_glVertex3d; glad_glVertex3d = glad_stats_impl_glVertex3d; }
+	else if (!count && glad_stats_real_glVertex3d) { glad_glVertex3d = glad_stats_real_glVertex3d; glad_stats_real_glVertex3d = 0; }
+	if (count && glad_glVertex3dv && glad_glVertex3dv != glad_stats_impl_glVertex3dv) { glad_stats_real_glVertex3dv = glad_glVertex3dv; glad_glVertex3dv = glad_stats_impl_glVertex3dv; }
+	else if (!count && glad_stats_real_glVertex3dv) { glad_glVertex3dv = glad_stats_real_glVertex3dv; glad_stats_real_glVertex3dv = 0; }
+	if (count && glad_glVertex3f && glad_glVertex3f != glad_stats_impl_glVertex3f) { glad_stats_real_glVertex3f = glad_glVertex3f; glad_glVertex3f = glad_stats_impl_glVertex3f; }
+	else if (!count && glad_stats_real_glVertex3f) { glad_glVertex3f = glad_stats_real_glVertex3f; glad_stats_real_glVertex3f = 0; }
+	if (count && glad_glVertex3fv && glad_glVertex3fv != glad_stats_impl_glVertex3fv) { glad_stats_real_glVertex3fv = glad_glVertex3fv; glad_glVertex3fv = glad_stats_impl_glVertex3fv; }
+	else if (!count && glad_stats_real_glVertex3fv) { glad_glVertex3fv = glad_stats_real_glVertex3fv; glad_stats_real_glVertex3fv = 0; }
+	if (count && glad_glVertex3i && glad_glVertex3i != glad_stats_impl_glVertex3i) { glad_stats_real_glVertex3i = glad_glVertex3i; glad_glVertex3i = glad_stats_impl_glVertex3i; }
+	else if (!count && glad_stats_real_glVertex3i) { glad_glVertex3i = glad_stats_real_glVertex3i; glad_stats_real_glVertex3i = 0; }
+	if (count && glad_glVertex3iv && glad_glVertex3iv != glad_stats_impl_glVertex3iv) { glad_stats_real_glVertex3iv = glad_glVertex3iv; glad_glVertex3iv = glad_stats_impl_glVertex3iv; }
+	else if (!count && glad_stats_real_glVertex3iv) { glad_glVertex3iv = glad_stats_real_glVertex3iv; glad_stats_real_glVertex3iv = 0; }
+	if (count && glad_glVertex3s && glad_glVertex3s != glad_stats_impl_glVertex3s) { glad_stats_real_glVertex3s = glad_glVertex3s; glad_glVertex3s = glad_stats_impl_glVertex3s; }
+	else if (!count && glad_stats_real_glVertex3s) { glad_glVertex3s = glad_stats_real_glVertex3s; glad_stats_real_glVertex3s = 0; }
+	if (count && glad_glVertex3sv && glad_glVertex3sv != glad_stats_impl_glVertex3sv) { glad_stats_real_glVertex3sv = glad_glVertex3sv; glad_glVertex3sv = glad_stats_impl_glVertex3sv; }
+	else if (!count && glad_stats_real_glVertex3sv) { glad_glVertex3sv = glad_stats_real_glVertex3sv; glad_stats_real_glVertex3sv = 0; }
+	if (count && glad_glVertex4d && glad_glVertex4d != glad_stats_impl_glVertex4d) { glad_stats_real_glVertex4d = glad_glVertex4d; glad_glVertex4d = glad_stats_impl_glVertex4d; }
+	else if (!count && glad_stats_real_glVertex4d) { glad_glVertex4d = glad_stats_real_glVertex4d; glad_stats_real_glVertex4d = 0; }
+	if (count && glad_glVertex4dv && glad_glVertex4dv != glad_stats_impl_glVertex4dv) { glad_stats_real_glVertex4dv = glad_glVertex4dv; glad_glVertex4dv = glad_stats_impl_glVertex4dv; }
+	else if (!count && glad_stats_real_glVertex4dv) { glad_glVertex4dv = glad_stats_real_glVertex4dv; glad_stats_real_glVertex4dv = 0; }
+	if (count && glad_glVertex4f && glad_glVertex4f != glad_stats_impl_glVertex4f) { glad_stats_real_glVertex4f = glad_glVertex4f; glad_glVertex4f = glad_stats_impl_glVertex4f; }
+	else if (!count && glad_stats_real_glVertex4f) { glad_glVertex4f = glad_stats_real_glVertex4f; glad_stats_real_glVertex4f = 0; }
+	if (count && glad_glVertex4fv && glad_glVertex4fv != glad_stats_impl_glVertex4fv) { glad_stats_real_glVertex4fv = glad_glVertex4fv; glad_glVertex4fv = glad_stats_impl_glVertex4fv; }
+	else if (!count && glad_stats_real_glVertex4fv) { glad_glVertex4fv = glad_stats_real_glVertex4fv; glad_stats_real_glVertex4fv = 0; }
+	if (count && glad_glVertex4i && glad_glVertex4i != glad_stats_impl_glVertex4i) { glad_stats_real_glVertex4i = glad_glVertex4i; glad_glVertex4i = glad_stats_impl_glVertex4i; }
+	else if (!count && glad_stats_real_glVertex4i) { glad_glVertex4i = glad_stats_real_glVertex4i; glad_stats_real_glVertex4i = 0; }
+	if (count && glad_glVertex4iv && glad_glVertex4iv != glad_stats_impl_glVertex4iv) { glad_stats_real_glVertex4iv = glad_glVertex4iv; glad_glVertex4iv = glad_stats_impl_glVertex4iv; }
+	else if (!count && glad_stats_real_glVertex4iv) { glad_glVertex4iv = glad_stats_real_glVertex4iv; glad_stats_real_glVertex4iv = 0; }
+	if (count && glad_glVertex4s && glad_glVertex4s != glad_stats_impl_glVertex4s) { glad_stats_real_glVertex4s = glad_glVertex4s; glad_glVertex4s = glad_stats_impl_glVertex4s; }
+	else if (!count && glad_stats_real_glVertex4s) { glad_glVertex4s = glad_stats_real_glVertex4s; glad_stats_real_glVertex4s = 0; }
+	if (count && glad_glVertex4sv && glad_glVertex4sv != glad_stats_impl_glVertex4sv) { glad_stats_real_glVertex4sv = glad_glVertex4sv; glad_glVertex4sv = glad_stats_impl_glVertex4sv; }
+	else if (!count && glad_stats_real_glVertex4sv) { glad_glVertex4sv = glad_stats_real_glVertex4sv; glad_stats_real_glVertex4sv = 0; }
+	if (count && glad_glVertexArrayAttribBinding && glad_glVertexArrayAttribBinding != glad_stats_impl_glVertexArrayAttribBinding) { glad_stats_real_glVertexArrayAttribBinding = glad_glVertexArrayAttribBinding; glad_glVertexArrayAttribBinding = glad_stats_impl_glVertexArrayAttribBinding; }
+	else if (!count && glad_stats_real_glVertexArrayAttribBinding) { glad_glVertexArrayAttribBinding = glad_stats_real_glVertexArrayAttribBinding; glad_stats_real_glVertexArrayAttribBinding = 0; }
+	if (count && glad_glVertexArrayAttribFormat && glad_glVertexArrayAttribFormat != glad_stats_impl_glVertexArrayAttribFormat) { glad_stats_real_glVertexArrayAttribFormat = glad_glVertexArrayAttribFormat; glad_glVertexArrayAttribFormat = glad_stats_impl_glVertexArrayAttribFormat; }
+	else if (!count && glad_stats_real_glVertexArrayAttribFormat) { glad_glVertexArrayAttribFormat = glad_stats_real_glVertexArrayAttribFormat; glad_stats_real_glVertexArrayAttribFormat = 0; }
+	if (count && glad_glVertexArrayAttribIFormat && glad_glVertexArrayAttribIFormat != glad_stats_impl_glVertexArrayAttribIFormat) { glad_stats_real_glVertexArrayAttribIFormat = glad_glVertexArrayAttribIFormat; glad_glVertexArrayAttribIFormat = glad_stats_impl_glVertexArrayAttribIFormat; }
+	else if (!count && glad_stats_real_glVertexArrayAttribIFormat) { glad_glVertexArrayAttribIFormat = glad_stats_real_glVertexArrayAttribIFormat; glad_stats_real_glVertexArrayAttribIFormat = 0; }
+	if (count && glad_glVertexArrayAttribLFormat && glad_glVertexArrayAttribLFormat != glad_stats_impl_glVertexArrayAttribLFormat) { glad_stats_real_glVertexArrayAttribLFormat = glad_glVertexArrayAttribLFormat; glad_glVertexArrayAttribLFormat = glad_stats_impl_glVertexArrayAttribLFormat; }
+	else if (!count && glad_stats_real_glVertexArrayAttribLFormat) { glad_glVertexArrayAttribLFormat = glad_stats_real_glVertexArrayAttribLFormat; glad_stats_real_glVertexArrayAttribLFormat = 0; }
+	if (count && glad_glVertexArrayBindingDivisor && glad_glVertexArrayBindingDivisor != glad_stats_impl_glVertexArrayBindingDivisor) { glad_stats_real_glVertexArrayBindingDivisor = glad_glVertexArrayBindingDivisor; glad_glVertexArrayBindingDivisor = glad_stats_impl_glVertexArrayBindingDivisor; }
+	else if (!count && glad_stats_real_glVertexArrayBindingDivisor) { glad_glVertexArrayBindingDivisor = glad_stats_real_glVertexArrayBindingDivisor; glad_stats_real_glVertexArrayBindingDivisor = 0; }
+	if (count && glad_glVertexArrayElementBuffer && glad_glVertexArrayElementBuffer != glad_stats_impl_glVertexArrayElementBuffer) { glad_stats_real_glVertexArrayElementBuffer = glad_glVertexArrayElementBuffer; glad_glVertexArrayElementBuffer = glad_stats_impl_glVertexArrayElementBuffer; }
+	else if (!count && glad_stats_real_glVertexArrayElementBuffer) { glad_glVertexArrayElementBuffer = glad_stats_real_glVertexArrayElementBuffer; glad_stats_real_glVertexArrayElementBuffer = 0; }
+	if (count && glad_glVertexArrayVertexBuffer && glad_glVertexArrayVertexBuffer != glad_stats_impl_glVertexArrayVertexBuffer) { glad_stats_real_glVertexArrayVertexBuffer = glad_glVertexArrayVertexBuffer; glad_glVertexArrayVertexBuffer = glad_stats_impl_glVertexArrayVertexBuffer; }
+	else if (!count && glad_stats_real_glVertexArrayVertexBuffer) { glad_glVertexArrayVertexBuffer = glad_stats_real_glVertexArrayVertexBuffer; glad_stats_real_glVertexArrayVertexBuffer = 0; }
+	if (count && glad_glVertexArrayVertexBuffers && glad_glVertexArrayVertexBuffers != glad_stats_impl_glVertexArrayVertexBuffers) { glad_stats_real_glVertexArrayVertexBuffers = glad_glVertexArrayVertexBuffers; glad_glVertexArrayVertexBuffers = glad_stats_impl_glVertexArrayVertexBuffers; }
+	else if (!count && glad_stats_real_glVertexArrayVertexBuffers) { glad_glVertexArrayVertexBuffers = glad_stats_real_glVertexArrayVertexBuffers; glad_stats_real_glVertexArrayVertexBuffers = 0; }
+	if (count && glad_glVertexAttrib1d && glad_glVertexAttrib1d != glad_stats_impl_glVertexAttrib1d) { glad_stats_real_glVertexAttrib1d = glad_glVertexAttrib1d; glad_glVertexAttrib1d = glad_stats_impl_glVertexAttrib1d; }
+	else if (!count && glad_stats_real_glVertexAttrib1d) { glad_glVertexAttrib1d = glad_stats_real_glVertexAttrib1d; glad_stats_real_glVertexAttrib1d = 0; }
+	if (count && glad_glVertexAttrib1dv && glad_glVertexAttrib1dv != glad_stats_impl_glVertexAttrib1dv) { glad_stats_real_glVertexAttrib1dv = glad_glVertexAttrib1dv; glad_glVertexAttrib1dv = glad_stats_impl_glVertexAttrib1dv; }
+	else if (!count && glad_stats_real_glVertexAttrib1dv) { glad_glVertexAttrib1dv = glad_stats_real_glVertexAttrib1dv; glad_stats_real_glVertexAttrib1dv = 0; }
+	if (count && glad_glVertexAttrib1f && glad_glVertexAttrib1f != glad_stats_impl_glVertexAttrib1f) { glad_stats_real_glVertexAttrib1f = glad_glVertexAttrib1f; glad_glVertexAttrib1f = glad_stats_impl_glVertexAttrib1f; }
+	else if (!count && glad_stats_real_glVertexAttrib1f) { glad_glVertexAttrib1f = glad_stats_real_glVertexAttrib1f; glad_stats_real_glVertexAttrib1f = 0; }
+	if (count && glad_glVertexAttrib1fv && glad_glVertexAttrib1fv != glad_stats_impl_glVertexAttrib1fv) { glad_stats_real_glVertexAttrib1fv = glad_glVertexAttrib1fv; glad_glVertexAttrib1fv = glad_stats_impl_glVertexAttrib1fv; }
+	else if (!count && glad_stats_real_glVertexAttrib1fv) { glad_glVertexAttrib1fv = glad_stats_real_glVertexAttrib1fv; glad_stats_real_glVertexAttrib1fv = 0; }
+	if (count && glad_glVertexAttrib1s && glad_glVertexAttrib1s != glad_stats_impl_glVertexAttrib1s) { glad_stats_real_glVertexAttrib1s = glad_glVertexAttrib1s; glad_glVertexAttrib1s = glad_stats_impl_glVertexAttrib1s; }
+	else if (!count && glad_stats_real_glVertexAttrib1s) { glad_glVertexAttrib1s = glad_stats_real_glVertexAttrib1s; glad_stats_real_glVertexAttrib1s = 0; }
+	if (count && glad_glVertexAttrib1sv && glad_glVertexAttrib1sv != glad_stats_impl_glVertexAttrib1sv) { glad_stats_real_glVertexAttrib1sv = glad_glVertexAttrib1sv; glad_glVertexAttrib1sv = glad_stats_impl_glVertexAttrib1sv; }
+	else if (!count && glad_stats_real_glVertexAttrib1sv) { glad_glVertexAttrib1sv = glad_stats_real_glVertexAttrib1sv; glad_stats_real_glVertexAttrib1sv = 0; }
+	if (count && glad_glVertexAttrib2d && glad_glVertexAttrib2d != glad_stats_impl_glVertexAttrib2d) { glad_stats_real_glVertexAttrib2d = glad_glVertexAttrib2d; glad_glVertexAttrib2d = glad_stats_impl_glVertexAttrib2d; }
+	else if (!count && glad_stats_real_glVertexAttrib2d) { glad_glVertexAttrib2d = glad_stats_real_glVertexAttrib2d; glad_stats_real_glVertexAttrib2d = 0; }
+	if (count && glad_glVertexAttrib2dv && glad_glVertexAttrib2dv != glad_stats_impl_glVertexAttrib2dv) { glad_stats_real_glVertexAttrib2dv = glad_glVertexAttrib2dv; glad_glVertexAttrib2dv = glad_stats_impl_glVertexAttrib2dv; }
+	else if (!count && glad_stats_real_glVertexAttrib2dv) { glad_glVertexAttrib2dv = glad_stats_real_glVertexAttrib2dv; glad_stats_real_glVertexAttrib2dv = 0; }
+	if (count && glad_glVertexAttrib2f && glad_glVertexAttrib2f != glad_stats_impl_glVertexAttrib2f) { glad_stats_real_glVertexAttrib2f = glad_glVertexAttrib2f; glad_glVertexAttrib2f = glad_stats_impl_glVertexAttrib2f; }
+	else if (!count && glad_stats_real_glVertexAttrib2f) { glad_glVertexAttrib2f = glad_stats_real_glVertexAttrib2f; glad_stats_real_glVertexAttrib2f = 0; }
+	if (count && glad_glVertexAttrib2fv && glad_glVertexAttrib2fv != glad_stats_impl_glVertexAttrib2fv) { glad_stats_real_glVertexAttrib2fv = glad_glVertexAttrib2fv; glad_glVertexAttrib2fv = glad_stats_impl_glVertexAttrib2fv; }
+	else if (!count && glad_stats_real_glVertexAttrib2fv) { glad_glVertexAttrib2fv = glad_stats_real_glVertexAttrib2fv; glad_stats_real_glVertexAttrib2fv = 0; }
+	if (count && glad_glVertexAttrib2s && glad_glVertexAttrib2s != glad_stats_impl_glVertexAttrib2s) { glad_stats_real_glVertexAttrib2s = glad_glVertexAttrib2s; glad_glVertexAttrib2s = glad_stats_impl_glVertexAttrib2s; }
+	else if (!count && glad_stats_real_glVertexAttrib2s) { glad_glVertexAttrib2s = glad_stats_real_glVertexAttrib2s; glad_stats_real_glVertexAttrib2s = 0; }
+	if (count && glad_glVertexAttrib2sv && glad_glVertexAttrib2sv != glad_stats_impl_glVertexAttrib2sv) { glad_stats_real_glVertexAttrib2sv = glad_glVertexAttrib2sv; glad_glVertexAttrib2sv = glad_stats_impl_glVertexAttrib2sv; }
+	else if (!count && glad_stats_real_glVertexAttrib2sv) { glad_glVertexAttrib2sv = glad_stats_real_glVertexAttrib2sv; glad_stats_real_glVertexAttrib2sv = 0; }
+	if (count && glad_glVertexAttrib3d && glad_glVertexAttrib3d != glad_stats_impl_glVertexAttrib3d) { glad_stats_real_glVertexAttrib3d = glad_glVertexAttrib3d; glad_glVertexAttrib3d = glad_stats_impl_glVertexAttrib3d; }
+	else if (!count && glad_stats_real_glVertexAttrib3d) { glad_glVertexAttrib3d = glad_stats_real_glVertexAttrib3d; glad_stats_real_glVertexAttrib3d = 0; }
+	if (count && glad_glVertexAttrib3dv && glad_glVertexAttrib3dv != glad_stats_impl_glVertexAttrib3dv) { glad_stats_real_glVertexAttrib3dv = glad_glVertexAttrib3dv; glad_glVertexAttrib3dv = glad_stats_impl_glVertexAttrib3dv; }
+	else if (!count && glad_stats_real_glVertexAttrib3dv) { glad_glVertexAttrib3dv = glad_stats_real_glVertexAttrib3dv; glad_stats_real_glVertexAttrib3dv = 0; }
+	if (count && glad_glVertexAttrib3f && glad_glVertexAttrib3f != glad_stats_impl_glVertexAttrib3f) { glad_stats_real_glVertexAttrib3f = glad_glVertexAttrib3f; glad_glVertexAttrib3f = glad_stats_impl_glVertexAttrib3f; }
+	else if (!count && glad_stats_real_glVertexAttrib3f) { glad_glVertexAttrib3f = glad_stats_real_glVertexAttrib3f; glad_stats_real_glVertexAttrib3f = 0; }
+	if (count && glad_glVertexAttrib3fv && glad_glVertexAttrib3fv != glad_stats_impl_glVertexAttrib3fv) { glad_stats_real_glVertexAttrib3fv = glad_glVertexAttrib3fv; glad_glVertexAttrib3fv = glad_stats_impl_glVertexAttrib3fv; }
+	else if (!count && glad_stats_real_glVertexAttrib3fv) { glad_glVertexAttrib3fv = glad_stats_real_glVertexAttrib3fv; glad_stats_real_glVertexAttrib3fv = 0; }
+	if (count && glad_glVertexAttrib3s && glad_glVertexAttrib3s != glad_stats_impl_glVertexAttrib3s) { glad_stats_real_glVertexAttrib3s = glad_glVertexAttrib3s; glad_glVertexAttrib3s = glad_stats_impl_glVertexAttrib3s; }
+	else if (!count && glad_stats_real_glVertexAttrib3s) { glad_glVertexAttrib3s = glad_stats_real_glVertexAttrib3s; glad_stats_real_glVertexAttrib3s = 0; }
+	if (count && glad_glVertexAttrib3sv && glad_glVertexAttrib3sv != glad_stats_impl_glVertexAttrib3sv) { glad_stats_real_glVertexAttrib3sv = glad_glVertexAttrib3sv; glad_glVertexAttrib3sv = glad_stats_impl_glVertexAttrib3sv; }
+	else if (!count && glad_stats_real_glVertexAttrib3sv) { glad_glVertexAttrib3sv = glad_stats_real_glVertexAttrib3sv; glad_stats_real_glVertexAttrib3sv = 0; }
+	if (count && glad_glVertexAttrib4Nbv && glad_glVertexAttrib4Nbv != glad_stats_impl_glVertexAttrib4Nbv) { glad_stats_real_glVertexAttrib4Nbv = glad_glVertexAttrib4Nbv; glad_glVertexAttrib4Nbv = glad_stats_impl_glVertexAttrib4Nbv; }
+	else if (!count && glad_stats_real_glVertexAttrib4Nbv) { glad_glVertexAttrib4Nbv = glad_stats_real_glVertexAttrib4Nbv; glad_stats_real_glVertexAttrib4Nbv = 0; }
+	if (count && glad_glVertexAttrib4Niv && glad_glVertexAttrib4Niv != glad_stats_impl_glVertexAttrib4Niv) { glad_stats_real_glVertexAttrib4Niv = glad_glVertexAttrib4Niv; glad_glVertexAttrib4Niv = glad_stats_impl_glVertexAttrib4Niv; }
+	else if (!count && glad_stats_real_glVertexAttrib4Niv) { glad_glVertexAttrib4Niv = glad_stats_real_glVertexAttrib4Niv; glad_stats_real_glVertexAttrib4Niv = 0; }
+	if (count && glad_glVertexAttrib4Nsv && glad_glVertexAttrib4Nsv != glad_stats_impl_glVertexAttrib4Nsv) { glad_stats_real_glVertexAttrib4Nsv = glad_glVertexAttrib4Nsv; glad_glVertexAttrib4Nsv = glad_stats_impl_glVertexAttrib4Nsv; }
+	else if (!count && glad_stats_real_glVertexAttrib4Nsv) { glad_glVertexAttrib4Nsv = glad_stats_real_glVertexAttrib4Nsv; glad_stats_real_glVertexAttrib4Nsv = 0; }
+	if (count && glad_glVertexAttrib4Nub && glad_glVertexAttrib4Nub != glad_stats_impl_glVertexAttrib4Nub) { glad_stats_real_glVertexAttrib4Nub = glad_glVertexAttrib4Nub; glad_glVertexAttrib4Nub = glad_stats_impl_glVertexAttrib4Nub; }
+	else if (!count && glad_stats_real_glVertexAttrib4Nub) { glad_glVertexAttrib4Nub = glad_stats_real_glVertexAttrib4Nub; glad_stats_real_glVertexAttrib4Nub = 0; }
+	if (count && glad_glVertexAttrib4Nubv && glad_glVertexAttrib4Nubv != glad_stats_impl_glVertexAttrib4Nubv) { glad_stats_real_glVertexAttrib4Nubv = glad_glVertexAttrib4Nubv; glad_glVertexAttrib4Nubv = glad_stats_impl_glVertexAttrib4Nubv; }
+	else if (!count && glad_stats_real_glVertexAttrib4Nubv) { glad_glVertexAttrib4Nubv = glad_stats_real_glVertexAttrib4Nubv; glad_stats_real_glVertexAttrib4Nubv = 0; }
+	if (count && glad_glVertexAttrib4Nuiv && glad_glVertexAttrib4Nuiv != glad_stats_impl_glVertexAttrib4Nuiv) { glad_stats_real_glVertexAttrib4Nuiv = glad_glVertexAttrib4Nuiv; glad_glVertexAttrib4Nuiv = glad_stats_impl_glVertexAttrib4Nuiv; }
+	else if (!count && glad_stats_real_glVertexAttrib4Nuiv) { glad_glVertexAttrib4Nuiv = glad_stats_real_glVertexAttrib4Nuiv; glad_stats_real_glVertexAttrib4Nuiv = 0; }
+	if (count && glad_glVertexAttrib4Nusv && glad_glVertexAttrib4Nusv != glad_stats_impl_glVertexAttrib4Nusv) { glad_stats_real_glVertexAttrib4Nusv = glad_glVertexAttrib4Nusv; glad_glVertexAttrib4Nusv = glad_stats_impl_glVertexAttrib4Nusv; }
+	else if (!count && glad_stats_real_glVertexAttrib4Nusv) { glad_glVertexAttrib4Nusv = glad_stats_real_glVertexAttrib4Nusv; glad_stats_real_glVertexAttrib4Nusv = 0; }
+	if (count && glad_glVertexAttrib4bv && glad_glVertexAttrib4bv != glad_stats_impl_glVertexAttrib4bv) { glad_stats_real_glVertexAttrib4bv = glad_glVertexAttrib4bv; glad_glVertexAttrib4bv = glad_stats_impl_glVertexAttrib4bv; }
+	else if (!count && glad_stats_real_glVertexAttrib4bv) { glad_glVertexAttrib4bv = glad_stats_real_glVertexAttrib4bv; glad_stats_real_glVertexAttrib4bv = 0; }
+	if (count && glad_glVertexAttrib4d && glad_glVertexAttrib4d != glad_stats_impl_glVertexAttrib4d) { glad_stats_real_glVertexAttrib4d = glad_glVertexAttrib4d; glad_glVertexAttrib4d = glad_stats_impl_glVertexAttrib4d; }
+	else if (!count && glad_stats_real_glVertexAttrib4d) { glad_glVertexAttrib4d = glad_stats_real_glVertexAttrib4d; glad_stats_real_glVertexAttrib4d = 0; }
+	if (count && glad_glVertexAttrib4dv && glad_glVertexAttrib4dv != glad_stats_impl_glVertexAttrib4dv) { glad_stats_real_glVertexAttrib4dv = glad_glVertexAttrib4dv; glad_glVertexAttrib4dv = glad_stats_impl_glVertexAttrib4dv; }
+	else if (!count && glad_stats_real_glVertexAttrib4dv) { glad_glVertexAttrib4dv = glad_stats_real_glVertexAttrib4dv; glad_stats_real_glVertexAttrib4dv = 0; }
+	if (count && glad_glVertexAttrib4f && glad_glVertexAttrib4f != glad_stats_impl_glVertexAttrib4f) { glad_stats_real_glVertexAttrib4f = glad_glVertexAttrib4f; glad_glVertexAttrib4f = glad_stats_impl_glVertexAttrib4f; }
+	else if (!count && glad_stats_real_glVertexAttrib4f) { glad_glVertexAttrib4f = glad_stats_real_glVertexAttrib4f; glad_stats_real_glVertexAttrib4f = 0; }
+	if (count && glad_glVertexAttrib4fv && glad_glVertexAttrib4fv != glad_stats_impl_glVertexAttrib4fv) { glad_stats_real_glVertexAttrib4fv = glad_glVertexAttrib4fv; glad_glVertexAttrib4fv = glad_stats_impl_glVertexAttrib4fv; }
+	else if (!count && glad_stats_real_glVertexAttrib4fv) { glad_glVertexAttrib4fv = glad_stats_real_glVertexAttrib4fv; glad_stats_real_glVertexAttrib4fv = 0; }
+	if (count && glad_glVertexAttrib4iv && glad_glVertexAttrib4iv != glad_stats_impl_glVertexAttrib4iv) { glad_stats_real_glVertexAttrib4iv = glad_glVertexAttrib4iv; glad_glVertexAttrib4iv = glad_stats_impl_glVertexAttrib4iv; }
+	else if (!count && glad_stats_real_glVertexAttrib4iv) { glad_glVertexAttrib4iv = glad_stats_real_glVertexAttrib4iv; glad_stats_real_glVertexAttrib4iv = 0; }
+	if (count && glad_glVertexAttrib4s && glad_glVertexAttrib4s != glad_stats_impl_glVertexAttrib4s) { glad_stats_real_glVertexAttrib4s = glad_glVertexAttrib4s; glad_glVertexAttrib4s = glad_stats_impl_glVertexAttrib4s; }
+	else if (!count && glad_stats_real_glVertexAttrib4s) { glad_glVertexAttrib4s = glad_stats_real_glVertexAttrib4s; glad_stats_real_glVertexAttrib4s = 0; }
+	if (count && glad_glVertexAttrib4sv && glad_glVertexAttrib4sv != glad_stats_impl_glVertexAttrib4sv) { glad_stats_real_glVertexAttrib4sv = glad_glVertexAttrib4sv; glad_glVertexAttrib4sv = glad_stats_impl_glVertexAttrib4sv; }
+	else if (!count && glad_stats_real_glVertexAttrib4sv) { glad_glVertexAttrib4sv = glad_stats_real_glVertexAttrib4sv; glad_stats_real_glVertexAttrib4sv = 0; }
+	if (count && glad_glVertexAttrib4ubv && glad_glVertexAttrib4ubv != glad_stats_impl_glVertexAttrib4ubv) { glad_stats_real_glVertexAttrib4ubv = glad_glVertexAttrib4ubv; glad_glVertexAttrib4ubv = glad_stats_impl_glVertexAttrib4ubv; }
+	else if (!count && glad_stats_real_glVertexAttrib4ubv) { glad_glVertexAttrib4ubv = glad_stats_real_glVertexAttrib4ubv; glad_stats_real_glVertexAttrib4ubv = 0; }
+	if (count && glad_glVertexAttrib4uiv && glad_glVertexAttrib4uiv != glad_stats_impl_glVertexAttrib4uiv) { glad_stats_real_glVertexAttrib4uiv = glad_glVertexAttrib4uiv; glad_glVertexAttrib4uiv = glad_stats_impl_glVertexAttrib4uiv; }
+	else if (!count && glad_stats_real_glVertexAttrib4uiv) { glad_glVertexAttrib4uiv = glad_stats_real_glVertexAttrib4uiv; glad_stats_real_glVertexAttrib4uiv = 0; }
+	if (count && glad_glVertexAttrib4usv && glad_glVertexAttrib4usv != glad_stats_impl_glVertexAttrib4usv) { glad_stats_real_glVertexAttrib4usv = glad_glVertexAttrib4usv; glad_glVertexAttrib4usv = glad_stats_impl_glVertexAttrib4usv; }
+	else if (!count && glad_stats_real_glVertexAttrib4usv) { glad_glVertexAttrib4usv = glad_stats_real_glVertexAttrib4usv; glad_stats_real_glVertexAttrib4usv = 0; }
+	if (count && glad_glVertexAttribBinding && glad_glVertexAttribBinding != glad_stats_impl_glVertexAttribBinding) { glad_stats_real_glVertexAttribBinding = glad_glVertexAttribBinding; glad_glVertexAttribBinding = glad_stats_impl_glVertexAttribBinding; }
+	else if (!count && glad_stats_real_glVertexAttribBinding) { glad_glVertexAttribBinding = glad_stats_real_glVertexAttribBinding; glad_stats_real_glVertexAttribBinding = 0; }
+	if (count && glad_glVertexAttribDivisor && glad_glVertexAttribDivisor != glad_stats_impl_glVertexAttribDivisor) { glad_stats_real_glVertexAttribDivisor = glad_glVertexAttribDivisor; glad_glVertexAttribDivisor = glad_stats_impl_glVertexAttribDivisor; }
+	else if (!count && glad_stats_real_glVertexAttribDivisor) { glad_glVertexAttribDivisor = glad_stats_real_glVertexAttribDivisor; glad_stats_real_glVertexAttribDivisor = 0; }
+	if (count && glad_glVertexAttribFormat && glad_glVertexAttribFormat != glad_stats_impl_glVertexAttribFormat) { glad_stats_real_glVertexAttribFormat = glad_glVertexAttribFormat; glad_glVertexAttribFormat = glad_stats_impl_glVertexAttribFormat; }
+	else if (!count && glad_stats_real_glVertexAttribFormat) { glad_glVertexAttribFormat = glad_stats_real_glVertexAttribFormat; glad_stats_real_glVertexAttribFormat = 0; }
+	if (count && glad_glVertexAttribI1i && glad_glVertexAttribI1i != glad_stats_impl_glVertexAttribI1i) { glad_stats_real_glVertexAttribI1i = glad_glVertexAttribI1i; glad_glVertexAttribI1i = glad_stats_impl_glVertexAttribI1i; }
+	else if (!count && glad_stats_real_glVertexAttribI1i) { glad_glVertexAttribI1i = glad_stats_real_glVertexAttribI1i; glad_stats_real_glVertexAttribI1i = 0; }
+	if (count && glad_glVertexAttribI1iv && glad_glVertexAttribI1iv != glad_stats_impl_glVertexAttribI1iv) { glad_stats_real_glVertexAttribI1iv = glad_glVertexAttribI1iv; glad_glVertexAttribI1iv = glad_stats_impl_glVertexAttribI1iv; }
+	else if (!count && glad_stats_real_glVertexAttribI1iv) { glad_glVertexAttribI1iv = glad_stats_real_glVertexAttribI1iv; glad_stats_real_glVertexAttribI1iv = 0; }
+	if (count && glad_glVertexAttribI1ui && glad_glVertexAttribI1ui != glad_stats_impl_glVertexAttribI1ui) { glad_stats_real_glVertexAttribI1ui = glad_glVertexAttribI1ui; glad_glVertexAttribI1ui = glad_stats_impl_glVertexAttribI1ui; }
+	else if (!count && glad_stats_real_glVertexAttribI1ui) { glad_glVertexAttribI1ui = glad_stats_real_glVertexAttribI1ui; glad_stats_real_glVertexAttribI1ui = 0; }
+	if (count && glad_glVertexAttribI1uiv && glad_glVertexAttribI1uiv != glad_stats_impl_glVertexAttribI1uiv) { glad_stats_real_glVertexAttribI1uiv = glad_glVertexAttribI1uiv; glad_glVertexAttribI1uiv = glad_stats_impl_glVertexAttribI1uiv; }
+	else if (!count && glad_stats_real_glVertexAttribI1uiv) { glad_glVertexAttribI1uiv = glad_stats_real_glVertexAttribI1uiv; glad_stats_real_glVertexAttribI1uiv = 0; }
+	if (count && glad_glVertexAttribI2i && glad_glVertexAttribI2i != glad_stats_impl_glVertexAttribI2i) { glad_stats_real_glVertexAttribI2i = glad_glVertexAttribI2i; glad_glVertexAttribI2i = glad_stats_impl_glVertexAttribI2i; }
+	else if (!count && glad_stats_real_glVertexAttribI2i) { glad_glVertexAttribI2i = glad_stats_real_glVertexAttribI2i; glad_stats_real_glVertexAttribI2i = 0; }
+	if (count && glad_glVertexAttribI2iv && glad_glVertexAttribI2iv != glad_stats_impl_glVertexAttribI2iv) { glad_stats_real_glVertexAttribI2iv = glad_glVertexAttribI2iv; glad_glVertexAttribI2iv = glad_stats_impl_glVertexAttribI2iv; }
+	else if (!count && glad_stats_real_glVertexAttribI2iv) { glad_glVertexAttribI2iv = glad_stats_real_glVertexAttribI2iv; glad_stats_real_glVertexAttribI2iv = 0; }
+	if (count && glad_glVertexAttribI2ui && glad_glVertexAttribI2ui != glad_stats_impl_glVertexAttribI2ui) { glad_stats_real_glVertexAttribI2ui = glad_glVertexAttribI2ui; glad_glVertexAttribI2ui = glad_stats_impl_glVertexAttribI2ui; }
+	else if (!count && glad_stats_real_glVertexAttribI2ui) { glad_glVertexAttribI2ui = glad_stats_real_glVertexAttribI2ui; glad_stats_real_glVertexAttribI2ui = 0; }
+	if (count && glad_glVertexAttribI2uiv && glad_glVertexAttribI2uiv != glad_stats_impl_glVertexAttribI2uiv) { glad_stats_real_glVertexAttribI2uiv = glad_glVertexAttribI2uiv; glad_glVertexAttribI2uiv = glad_stats_impl_glVertexAttribI2uiv; }
+	else if (!count && glad_stats_real_glVertexAttribI2uiv) { glad_glVertexAttribI2uiv = glad_stats_real_glVertexAttribI2uiv; glad_stats_real_glVertexAttribI2uiv = 0; }
+	if (count && glad_glVertexAttribI3i && glad_glVertexAttribI3i != glad_stats_impl_glVertexAttribI3i) { glad_stats_real_glVertexAttribI3i = glad_glVertexAttribI3i; glad_glVertexAttribI3i = glad_stats_impl_glVertexAttribI3i; }
+	else if (!count && glad_stats_real_glVertexAttribI3i) { glad_glVertexAttribI3i = glad_stats_real_glVertexAttribI3i; glad_stats_real_glVertexAttribI3i = 0; }
+	if (count && glad_glVertexAttribI3iv && glad_glVertexAttribI3iv != glad_stats_impl_glVertexAttribI3iv) { glad_stats_real_glVertexAttribI3iv = glad_glVertexAttribI3iv; glad_glVertexAttribI3iv = glad_stats_impl_glVertexAttribI3iv; }
+	else if (!count && glad_stats_real_glVertexAttribI3iv) { glad_glVertexAttribI3iv = glad_stats_real_glVertexAttribI3iv; glad_stats_real_glVertexAttribI3iv = 0; }
+	if (count && glad_glVertexAttribI3ui && glad_glVertexAttribI3ui != glad_stats_impl_glVertexAttribI3ui) { glad_stats_real_glVertexAttribI3ui = glad_glVertexAttribI3ui; glad_glVertexAttribI3ui = glad_stats_impl_glVertexAttribI3ui; }
+	else if (!count && glad_stats_real_glVertexAttribI3ui) { glad_glVertexAttribI3ui = glad_stats_real_glVertexAttribI3ui; glad_stats_real_glVertexAttribI3ui = 0; }
+	if (count && glad_glVertexAttribI3uiv && glad_glVertexAttribI3uiv != glad_stats_impl_glVertexAttribI3uiv) { glad_stats_real_glVertexAttribI3uiv = glad_glVertexAttribI3uiv; glad_glVertexAttribI3uiv = glad_stats_impl_glVertexAttribI3uiv; }
+	else if (!count && glad_stats_real_glVertexAttribI3uiv) { glad_glVertexAttribI3uiv = glad_stats_real_glVertexAttribI3uiv; glad_stats_real_glVertexAttribI3uiv = 0; }
+	if (count && glad_glVertexAttribI4bv && glad_glVertexAttribI4bv != glad_stats_impl_glVertexAttribI4bv) { glad_stats_real_glVertexAttribI4bv = glad_glVertexAttribI4bv; glad_glVertexAttribI4bv = glad_stats_impl_glVertexAttribI4bv; }
+	else if (!count && glad_stats_real_glVertexAttribI4bv) { glad_glVertexAttribI4bv = glad_stats_real_glVertexAttribI4bv; glad_stats_real_glVertexAttribI4bv = 0; }
+	if (count && glad_glVertexAttribI4i && glad_glVertexAttribI4i != glad_stats_impl_glVertexAttribI4i) { glad_stats_real_glVertexAttribI4i = glad_glVertexAttribI4i; glad_glVertexAttribI4i = glad_stats_impl_glVertexAttribI4i; }
+	else if (!count && glad_stats_real_glVertexAttribI4i) { glad_glVertexAttribI4i = glad_stats_real_glVertexAttribI4i; glad_stats_real_glVertexAttribI4i = 0; }
+	if (count && glad_glVertexAttribI4iv && glad_glVertexAttribI4iv != glad_stats_impl_glVertexAttribI4iv) { glad_stats_real_glVertexAttribI4iv = glad_glVertexAttribI4iv; glad_glVertexAttribI4iv = glad_stats_impl_glVertexAttribI4iv; }
+	else if (!count && glad_stats_real_glVertexAttribI4iv) { glad_glVertexAttribI4iv = glad_stats_real_glVertexAttribI4iv; glad_stats_real_glVertexAttribI4iv = 0; }
+	if (count && glad_glVertexAttribI4sv && glad_glVertexAttribI4sv != glad_stats_impl_glVertexAttribI4sv) { glad_stats_real_glVertexAttribI4sv = glad_glVertexAttribI4sv; glad_glVertexAttribI4sv = glad_stats_impl_glVertexAttribI4sv; }
+	else if (!count && glad_stats_real_glVertexAttribI4sv) { glad_glVertexAttribI4sv = glad_stats_real_glVertexAttribI4sv; glad_stats_real_glVertexAttribI4sv = 0; }
+	if (count && glad_glVertexAttribI4ubv && glad_glVertexAttribI4ubv != glad_stats_impl_glVertexAttribI4ubv) { glad_stats_real_glVertexAttribI4ubv = glad_glVertexAttribI4ubv; glad_glVertexAttribI4ubv = glad_stats_impl_glVertexAttribI4ubv; }
+	else if (!count && glad_stats_real_glVertexAttribI4ubv) { glad_glVertexAttribI4ubv = glad_stats_real_glVertexAttribI4ubv; glad_stats_real_glVertexAttribI4ubv = 0; }
+	if (count && glad_glVertexAttribI4ui && glad_glVertexAttribI4ui != glad_stats_impl_glVertexAttribI4ui) { glad_stats_real_glVertexAttribI4ui = glad_glVertexAttribI4ui; glad_glVertexAttribI4ui = glad_stats_impl_glVertexAttribI4ui; }
+	else if (!count && glad_stats_real_glVertexAttribI4ui) { glad_glVertexAttribI4ui = glad_stats_real_glVertexAttribI4ui; glad_stats_real_glVertexAttribI4ui = 0; }
+	if (count && glad_glVertexAttribI4uiv && glad_glVertexAttribI4uiv != glad_stats_impl_glVertexAttribI4uiv) { glad_stats_real_glVertexAttribI4uiv = glad_glVertexAttribI4uiv; glad_glVertexAttribI4uiv = glad_stats_impl_glVertexAttribI4uiv; }
+	else if (!count && glad_stats_real_glVertexAttribI4uiv) { glad_glVertexAttribI4uiv = glad_stats_real_glVertexAttribI4uiv; glad_stats_real_glVertexAttribI4uiv = 0; }
+	if (count && glad_glVertexAttribI4usv && glad_glVertexAttribI4usv != glad_stats_impl_glVertexAttribI4usv) { glad_stats_real_glVertexAttribI4usv = glad_glVertexAttribI4usv; glad_glVertexAttribI4usv = glad_stats_impl_glVertexAttribI4usv; }
+	else if (!count && glad_stats_real_glVertexAttribI4usv) { glad_glVertexAttribI4usv = glad_stats_real_glVertexAttribI4usv; glad_stats_real_glVertexAttribI4usv = 0; }
+	if (count && glad_glVertexAttribIFormat && glad_glVertexAttribIFormat != glad_stats_impl_glVertexAttribIFormat) { glad_stats_real_glVertexAttribIFormat = glad_glVertexAttribIFormat; glad_glVertexAttribIFormat = glad_stats_impl_glVertexAttribIFormat; }
+	else if (!count && glad_stats_real_glVertexAttribIFormat) { glad_glVertexAttribIFormat = glad_stats_real_glVertexAttribIFormat; glad_stats_real_glVertexAttribIFormat = 0; }
+	if (count && glad_glVertexAttribIPointer && glad_glVertexAttribIPointer != glad_stats_impl_glVertexAttribIPointer) { glad_stats_real_glVertexAttribIPointer = glad_glVertexAttribIPointer; glad_glVertexAttribIPointer = glad_stats_impl_glVertexAttribIPointer; }
+	else if (!count && glad_stats_real_glVertexAttribIPointer) { glad_glVertexAttribIPointer = glad_stats_real_glVertexAttribIPointer; glad_stats_real_glVertexAttribIPointer = 0; }
+	if (count && glad_glVertexAttribL1d && glad_glVertexAttribL1d != glad_stats_impl_glVertexAttribL1d) { glad_stats_real_glVertexAttribL1d = glad_glVertexAttribL1d; glad_glVertexAttribL1d = glad_stats_impl_glVertexAttribL1d; }
+	else if (!count && glad_stats_real_glVertexAttribL1d) { glad_glVertexAttribL1d = glad_stats_real_glVertexAttribL1d; glad_stats_real_glVertexAttribL1d = 0; }
+	if (count && glad_glVertexAttribL1dv && glad_glVertexAttribL1dv != glad_stats_impl_glVertexAttribL1dv) { glad_stats_real_glVertexAttribL1dv = glad_glVertexAttribL1dv; glad_glVertexAttribL1dv = glad_stats_impl_glVertexAttribL1dv; }
+	else if (!count && glad_stats_real_glVertexAttribL1dv) { glad_glVertexAttribL1dv = glad_stats_real_glVertexAttribL1dv; glad_stats_real_glVertexAttribL1dv = 0; }
+	if (count && glad_glVertexAttribL1ui64ARB && glad_glVertexAttribL1ui64ARB != glad_stats_impl_glVertexAttribL1ui64ARB) { glad_stats_real_glVertexAttribL1ui64ARB = glad_glVertexAttribL1ui64ARB; glad_glVertexAttribL1ui64ARB = glad_stats_impl_glVertexAttribL1ui64ARB; }
+	else if (!count && glad_stats_real_glVertexAttribL1ui64ARB) { glad_glVertexAttribL1ui64ARB = glad_stats_real_glVertexAttribL1ui64ARB; glad_stats_real_glVertexAttribL1ui64ARB = 0; }
+	if (count && glad_glVertexAttribL1ui64vARB && glad_glVertexAttribL1ui64vARB != glad_stats_impl_glVertexAttribL1ui64vARB) { glad_stats_real_glVertexAttribL1ui64vARB = glad_glVertexAttribL1ui64vARB; glad_glVertexAttribL1ui64vARB = glad_stats_impl_glVertexAttribL1ui64vARB; }
+	else if (!count && glad_stats_real_glVertexAttribL1ui64vARB) { glad_glVertexAttribL1ui64vARB = glad_stats_real_glVertexAttribL1ui64vARB; glad_stats_real_glVertexAttribL1ui64vARB = 0; }
+	if (count && glad_glVertexAttribL2d && glad_glVertexAttribL2d != glad_stats_impl_glVertexAttribL2d) { glad_stats_real_glVertexAttribL2d = glad_glVertexAttribL2d; glad_glVertexAttribL2d = glad_stats_impl_glVertexAttribL2d; }
+	else if (!count && glad_stats_real_glVertexAttribL2d) { glad_glVertexAttribL2d = glad_stats_real_glVertexAttribL2d; glad_stats_real_glVertexAttribL2d = 0; }
+	if (count && glad_glVertexAttribL2dv && glad_glVertexAttribL2dv != glad_stats_impl_glVertexAttribL2dv) { glad_stats_real_glVertexAttribL2dv = glad_glVertexAttribL2dv; glad_glVertexAttribL2dv = glad_stats_impl_glVertexAttribL2dv; }
+	else if (!count && glad_stats_real_glVertexAttribL2dv) { glad_glVertexAttribL2dv = glad_stats_real_glVertexAttribL2dv; glad_stats_real_glVertexAttribL2dv = 0; }
+	if (count && glad_glVertexAttribL3d && glad_glVertexAttribL3d != glad_stats_impl_glVertexAttribL3d) { glad_stats_real_glVertexAttribL3d = glad_glVertexAttribL3d; glad_glVertexAttribL3d = glad_stats_impl_glVertexAttribL3d; }
+	else if (!count && glad_stats_real_glVertexAttribL3d) { glad_glVertexAttribL3d = glad_stats_real_glVertexAttribL3d; glad_stats_real_glVertexAttribL3d = 0; }
+	if (count && glad_glVertexAttribL3dv && glad_glVertexAttribL3dv != glad_stats_impl_glVertexAttribL3dv) { glad_stats_real_glVertexAttribL3dv = glad_glVertexAttribL3dv; glad_glVertexAttribL3dv = glad_stats_impl_glVertexAttribL3dv; }
+	else if (!count && glad_stats_real_glVertexAttribL3dv) { glad_glVertexAttribL3dv = glad_stats_real_glVertexAttribL3dv; glad_stats_real_glVertexAttribL3dv = 0; }
+	if (count && glad_glVertexAttribL4d && glad_glVertexAttribL4d != glad_stats_impl_glVertexAttribL4d) { glad_stats_real_glVertexAttribL4d = glad_glVertexAttribL4d; glad_glVertexAttribL4d = glad_stats_impl_glVertexAttribL4d; }
+	else if (!count && glad_stats_real_glVertexAttribL4d) { glad_glVertexAttribL4d = glad_stats_real_glVertexAttribL4d; glad_stats_real_glVertexAttribL4d = 0; }
+	if (count && glad_glVertexAttribL4dv && glad_glVertexAttribL4dv != glad_stats_impl_glVertexAttribL4dv) { glad_stats_real_glVertexAttribL4dv = glad_glVertexAttribL4dv; glad_glVertexAttribL4dv = glad_stats_impl_glVertexAttribL4dv; }
+	else if (!count && glad_stats_real_glVertexAttribL4dv) { glad_glVertexAttribL4dv = glad_stats_real_glVertexAttribL4dv; glad_stats_real_glVertexAttribL4dv = 0; }
+	if (count && glad_glVertexAttribLFormat && glad_glVertexAttribLFormat != glad_stats_impl_glVertexAttribLFormat) { glad_stats_real_glVertexAttribLFormat = glad_glVertexAttribLFormat; glad_glVertexAttribLFormat = glad_stats_impl_glVertexAttribLFormat; }
+	else if (!count && glad_stats_real_glVertexAttribLFormat) { glad_glVertexAttribLFormat = glad_stats_real_glVertexAttribLFormat; glad_stats_real_glVertexAttribLFormat = 0; }
+	if (count && glad_glVertexAttribLPointer && glad_glVertexAttribLPointer != glad_stats_impl_glVertexAttribLPointer) { glad_stats_real_glVertexAttribLPointer = glad_glVertexAttribLPointer; glad_glVertexAttribLPointer = glad_stats_impl_glVertexAttribLPointer; }
+	else if (!count && glad_stats_real_glVertexAttribLPointer) { glad_glVertexAttribLPointer = glad_stats_real_glVertexAttribLPointer; glad_stats_real_glVertexAttribLPointer = 0; }
+	if (count && glad_glVertexAttribP1ui && glad_glVertexAttribP1ui != glad_stats_impl_glVertexAttribP1ui) { glad_stats_real_glVertexAttribP1ui = glad_glVertexAttribP1ui; glad_glVertexAttribP1ui = glad_stats_impl_glVertexAttribP1ui; }
+	else if (!count && glad_stats_real_glVertexAttribP1ui) { glad_glVertexAttribP1ui = glad_stats_real_glVertexAttribP1ui; glad_stats_real_glVertexAttribP1ui = 0; }
+	if (count && glad_glVertexAttribP1uiv && glad_glVertexAttribP1uiv != glad_stats_impl_glVertexAttribP1uiv) { glad_stats_real_glVertexAttribP1uiv = glad_glVertexAttribP1uiv; glad_glVertexAttribP1uiv = glad_stats_impl_glVertexAttribP1uiv; }
+	else if (!count && glad_stats_real_glVertexAttribP1uiv) { glad_glVertexAttribP1uiv = glad_stats_real_glVertexAttribP1uiv; glad_stats_real_glVertexAttribP1uiv = 0; }
+	if (count && glad_glVertexAttribP2ui && glad_glVertexAttribP2ui != glad_stats_impl_glVertexAttribP2ui) { glad_stats_real_glVertexAttribP2ui = glad_glVertexAttribP2ui; glad_glVertexAttribP2ui = glad_stats_impl_glVertexAttribP2ui; }
+	else if (!count && glad_stats_real_glVertexAttribP2ui) { glad_glVertexAttribP2ui = glad_stats_real_glVertexAttribP2ui; glad_stats_real_glVertexAttribP2ui = 0; }
+	if (count && glad_glVertexAttribP2uiv && glad_glVertexAttribP2uiv != glad_stats_impl_glVertexAttribP2uiv) { glad_stats_real_glVertexAttribP2uiv = glad_glVertexAttribP2uiv; glad_glVertexAttribP2uiv = glad_stats_impl_glVertexAttribP2uiv; }
+	else if (!count && glad_stats_real_glVertexAttribP2uiv) { glad_glVertexAttribP2uiv = glad_stats_real_glVertexAttribP2uiv; glad_stats_real_glVertexAttribP2uiv = 0; }
+	if (count && glad_glVertexAttribP3ui && glad_glVertexAttribP3ui != glad_stats_impl_glVertexAttribP3ui) { glad_stats_real_glVertexAttribP3ui = glad_glVertexAttribP3ui; glad_glVertexAttribP3ui = glad_stats_impl_glVertexAttribP3ui; }
+	else if (!count && glad_stats_real_glVertexAttribP3ui) { glad_glVertexAttribP3ui = glad_stats_real_glVertexAttribP3ui; glad_stats_real_glVertexAttribP3ui = 0; }
+	if (count && glad_glVertexAttribP3uiv && glad_glVertexAttribP3uiv != glad_stats_impl_glVertexAttribP3uiv) { glad_stats_real_glVertexAttribP3uiv = glad_glVertexAttribP3uiv; glad_glVertexAttribP3uiv = glad_stats_impl_glVertexAttribP3uiv; }
+	else if (!count && glad_stats_real_glVertexAttribP3uiv) { glad_glVertexAttribP3uiv = glad_stats_real_glVertexAttribP3uiv; glad_stats_real_glVertexAttribP3uiv = 0; }
+	if (count && glad_glVertexAttribP4ui && glad_glVertexAttribP4ui != glad_stats_impl_glVertexAttribP4ui) { glad_stats_real_glVertexAttribP4ui = glad_glVertexAttribP4ui; glad_glVertexAttribP4ui = glad_stats_impl_glVertexAttribP4ui; }
+	else if (!count && glad_stats_real_glVertexAttribP4ui) { glad_glVertexAttribP4ui = glad_stats_real_glVertexAttribP4ui; glad_stats_real_glVertexAttribP4ui = 0; }
+	if (count && glad_glVertexAttribP4uiv && glad_glVertexAttribP4uiv != glad_stats_impl_glVertexAttribP4uiv) { glad_stats_real_glVertexAttribP4uiv = glad_glVertexAttribP4uiv; glad_glVertexAttribP4uiv = glad_stats_impl_glVertexAttribP4uiv; }
+	else if (!count && glad_stats_real_glVertexAttribP4uiv) { glad_glVertexAttribP4uiv = glad_stats_real_glVertexAttribP4uiv; glad_stats_real_glVertexAttribP4uiv = 0; }
+	if (count && glad_glVertexAttribPointer && glad_glVertexAttribPointer != glad_stats_impl_glVertexAttribPointer) { glad_stats_real_glVertexAttribPointer = glad_glVertexAttribPointer; glad_glVertexAttribPointer = glad_stats_impl_glVertexAttribPointer; }
+	else if (!count && glad_stats_real_glVertexAttribPointer) { glad_glVertexAttribPointer = glad_stats_real_glVertexAttribPointer; glad_stats_real_glVertexAttribPointer = 0; }
+	if (count && glad_glVertexBindingDivisor && glad_glVertexBindingDivisor != glad_stats_impl_glVertexBindingDivisor) { glad_stats_real_glVertexBindingDivisor = glad_glVertexBindingDivisor; glad_glVertexBindingDivisor = glad_stats_impl_glVertexBindingDivisor; }
+	else if (!count && glad_stats_real_glVertexBindingDivisor) { glad_glVertexBindingDivisor = glad_stats_real_glVertexBindingDivisor; glad_stats_real_glVertexBindingDivisor = 0; }
+	if (count && glad_glVertexP2ui && glad_glVertexP2ui != glad_stats_impl_glVertexP2ui) { glad_stats_real_glVertexP2ui = glad_glVertexP2ui; glad_glVertexP2ui = glad_stats_impl_glVertexP2ui; }
+	else if (!count && glad_stats_real_glVertexP2ui) { glad_glVertexP2ui = glad_stats_real_glVertexP2ui; glad_stats_real_glVertexP2ui = 0; }
+	if (count && glad_glVertexP2uiv && glad_glVertexP2uiv != glad_stats_impl_glVertexP2uiv) { glad_stats_real_glVertexP2uiv = glad_glVertexP2uiv; glad_glVertexP2uiv = glad_stats_impl_glVertexP2uiv; }
+	else if (!count && glad_stats_real_glVertexP2uiv) { glad_glVertexP2uiv = glad_stats_real_glVertexP2uiv; glad_stats_real_glVertexP2uiv = 0; }
+	if (count && glad_glVertexP3ui && glad_glVertexP3ui != glad_stats_impl_glVertexP3ui) { glad_stats_real_glVertexP3ui = glad_glVertexP3ui; glad_glVertexP3ui = glad_stats_impl_glVertexP3ui; }
+	else if (!count && glad_stats_real_glVertexP3ui) { glad_glVertexP3ui = glad_stats_real_glVertexP3ui; glad_stats_real_glVertexP3ui = 0; }
+	if (count && glad_glVertexP3uiv && glad_glVertexP3uiv != glad_stats_impl_glVertexP3uiv) { glad_stats_real_glVertexP3uiv = glad_glVertexP3uiv; glad_glVertexP3uiv = glad_stats_impl_glVertexP3uiv; }
+	else if (!count && glad_stats_real_glVertexP3uiv) { glad_glVertexP3uiv = glad_stats_real_glVertexP3uiv; glad_stats_real_glVertexP3uiv = 0; }
+	if (count && glad_glVertexP4ui && glad_glVertexP4ui != glad_stats_impl_glVertexP4ui) { glad_stats_real_glVertexP4ui = glad_glVertexP4ui; glad_glVertexP4ui = glad_stats_impl_glVertexP4ui; }
+	else if (!count && glad_stats_real_glVertexP4ui) { glad_glVertexP4ui = glad_stats_real_glVertexP4ui; glad_stats_real_glVertexP4ui = 0; }
+	if (count && glad_glVertexP4uiv && glad_glVertexP4uiv != glad_stats_impl_glVertexP4uiv) { glad_stats_real_glVertexP4uiv = glad_glVertexP4uiv; glad_glVertexP4uiv = glad_stats_impl_glVertexP4uiv; }
+	else if (!count && glad_stats_real_glVertexP4uiv) { glad_glVertexP4uiv = glad_stats_real_glVertexP4uiv; glad_stats_real_glVertexP4uiv = 0; }
+	if (count && glad_glVertexPointer && glad_glVertexPointer != glad_stats_impl_glVertexPointer) { glad_stats_real_glVertexPointer = glad_glVertexPointer; glad_glVertexPointer = glad_stats_impl_glVertexPointer; }
+	else if (!count && glad_stats_real_glVertexPointer) { glad_glVertexPointer = glad_stats_real_glVertexPointer; glad_stats_real_glVertexPointer = 0; }
+	if (count && glad_glViewport && glad_glViewport != glad_stats_impl_glViewport) { glad_stats_real_glViewport = glad_glViewport; glad_glViewport = glad_stats_impl_glViewport; }
+	else if (!count && glad_stats_real_glViewport) { glad_glViewport = glad_stats_real_glViewport; glad_stats_real_glViewport = 0; }
+	if (count && glad_glViewportArrayv && glad_glViewportArrayv != glad_stats_impl_glViewportArrayv) { glad_stats_real_glViewportArrayv = glad_glViewportArrayv; glad_glViewportArrayv = glad_stats_impl_glViewportArrayv; }
+	else if (!count && glad_stats_real_glViewportArrayv) { glad_glViewportArrayv = glad_stats_real_glViewportArrayv; glad_stats_real_glViewportArrayv = 0; }
+	if (count && glad_glViewportIndexedf && glad_glViewportIndexedf != glad_stats_impl_glViewportIndexedf) { glad_stats_real_glViewportIndexedf = glad_glViewportIndexedf; glad_glViewportIndexedf = glad_stats_impl_glViewportIndexedf; }
+	else if (!count && glad_stats_real_glViewportIndexedf) { glad_glViewportIndexedf = glad_stats_real_glViewportIndexedf; glad_stats_real_glViewportIndexedf = 0; }
+	if (count && glad_glViewportIndexedfv && glad_glViewportIndexedfv != glad_stats_impl_glViewportIndexedfv) { glad_stats_real_glViewportIndexedfv = glad_glViewportIndexedfv; glad_glViewportIndexedfv = glad_stats_impl_glViewportIndexedfv; }
+	else if (!count && glad_stats_real_glViewportIndexedfv) { glad_glViewportIndexedfv = glad_stats_real_glViewportIndexedfv; glad_stats_real_glViewportIndexedfv = 0; }
+	if (count && glad_glWaitSync && glad_glWaitSync != glad_stats_impl_glWaitSync) { glad_stats_real_glWaitSync = glad_glWaitSync; glad_glWaitSync = glad_stats_impl_glWaitSync; }
+	else if (!count && glad_stats_real_glWaitSync) { glad_glWaitSync = glad_stats_real_glWaitSync; glad_stats_real_glWaitSync = 0; }
+	if (count && glad_glWindowPos2d && glad_glWindowPos2d != glad_stats_impl_glWindowPos2d) { glad_stats_real_glWindowPos2d = glad_glWindowPos2d; glad_glWindowPos2d = glad_stats_impl_glWindowPos2d; }
+	else if (!count && glad_stats_real_glWindowPos2d) { glad_glWindowPos2d = glad_stats_real_glWindowPos2d; glad_stats_real_glWindowPos2d = 0; }
+	if (count && glad_glWindowPos2dv && glad_glWindowPos2dv != glad_stats_impl_glWindowPos2dv) { glad_stats_real_glWindowPos2dv = glad_glWindowPos2dv; glad_glWindowPos2dv = glad_stats_impl_glWindowPos2dv; }
+	else if (!count && glad_stats_real_glWindowPos2dv) { glad_glWindowPos2dv = glad_stats_real_glWindowPos2dv; glad_stats_real_glWindowPos2dv = 0; }
+	if (count && glad_glWindowPos2f && glad_glWindowPos2f != glad_stats_impl_glWindowPos2f) { glad_stats_real_glWindowPos2f = glad_glWindowPos2f; glad_glWindowPos2f = glad_stats_impl_glWindowPos2f; }
+	else if (!count && glad_stats_real_glWindowPos2f) { glad_glWindowPos2f = glad_stats_real_glWindowPos2f; glad_stats_real_glWindowPos2f = 0; }
+	if (count && glad_glWindowPos2fv && glad_glWindowPos2fv != glad_stats_impl_glWindowPos2fv) { glad_stats_real_glWindowPos2fv = glad_glWindowPos2fv; glad_glWindowPos2fv = glad_stats_impl_glWindowPos2fv; }
+	else if (!count && glad_stats_real_glWindowPos2fv) { glad_glWindowPos2fv = glad_stats_real_glWindowPos2fv; glad_stats_real_glWindowPos2fv = 0; }
+	if (count && glad_glWindowPos2i && glad_glWindowPos2i != glad_stats_impl_glWindowPos2i) { glad_stats_real_glWindowPos2i = glad_glWindowPos2i; glad_glWindowPos2i = glad_stats_impl_glWindowPos2i; }
+	else if (!count && glad_stats_real_glWindowPos2i) { glad_glWindowPos2i = glad_stats_real_glWindowPos2i; glad_stats_real_glWindowPos2i = 0; }
+	if (count && glad_glWindowPos2iv && glad_glWindowPos2iv != glad_stats_impl_glWindowPos2iv) { glad_stats_real_glWindowPos2iv = glad_glWindowPos2iv; glad_glWindowPos2iv = glad_stats_impl_glWindowPos2iv; }
+	else if (!count && glad_stats_real_glWindowPos2iv) { glad_glWindowPos2iv = glad_stats_real_glWindowPos2iv; glad_stats_real_glWindowPos2iv = 0; }
+	if (count && glad_glWindowPos2s && glad_glWindowPos2s != glad_stats_impl_glWindowPos2s) { glad_stats_real_glWindowPos2s = glad_glWindowPos2s; glad_glWindowPos2s = glad_stats_impl_glWindowPos2s; }
+	else if (!count && glad_stats_real_glWindowPos2s) { glad_glWindowPos2s = glad_stats_real_glWindowPos2s; glad_stats_real_glWindowPos2s = 0; }
+	if (count && glad_glWindowPos2sv && glad_glWindowPos2sv != glad_stats_impl_glWindowPos2sv) { glad_stats_real_glWindowPos2sv = glad_glWindowPos2sv; glad_glWindowPos2sv = glad_stats_impl_glWindowPos2sv; }
+	else if (!count && glad_stats_real_glWindowPos2sv) { glad_glWindowPos2sv = glad_stats_real_glWindowPos2sv; glad_stats_real_glWindowPos2sv = 0; }
+	if (count && glad_glWindowPos3d && glad_glWindowPos3d != glad_stats_impl_glWindowPos3d) { glad_stats_real_glWindowPos3d = glad_glWindowPos3d; glad_glWindowPos3d = glad_stats_impl_glWindowPos3d; }
+	else if (!count && glad_stats_real_glWindowPos3d) { glad_glWindowPos3d = glad_stats_real_glWindowPos3d; glad_stats_real_glWindowPos3d = 0; }
+	if (count && glad_glWindowPos3dv && glad_glWindowPos3dv != glad_stats_impl_glWindowPos3dv) { glad_stats_real_glWindowPos3dv = glad_glWindowPos3dv; glad_glWindowPos3dv = glad_stats_impl_glWindowPos3dv; }
+	else if (!count && glad_stats_real_glWindowPos3dv) { glad_glWindowPos3dv = glad_stats_real_glWindowPos3dv; glad_stats_real_glWindowPos3dv = 0; }
+	if (count && glad_glWindowPos3f && glad_glWindowPos3f != glad_stats_impl_glWindowPos3f) { glad_stats_real_glWindowPos3f = glad_glWindowPos3f; glad_glWindowPos3f = glad_stats_impl_glWindowPos3f; }
+	else if (!count && glad_stats_real_glWindowPos3f) { glad_glWindowPos3f = glad_stats_real_glWindowPos3f; glad_stats_real_glWindowPos3f = 0; }
+	if (count && glad_glWindowPos3fv && glad_glWindowPos3fv != glad_stats_impl_glWindowPos3fv) { glad_stats_real_glWindowPos3fv = glad_glWindowPos3fv; glad_glWindowPos3fv = glad_stats_impl_glWindowPos3fv; }
+	else if (!count && glad_stats_real_glWindowPos3fv) { glad_glWindowPos3fv = glad_stats_real_glWindowPos3fv; glad_stats_real_glWindowPos3fv = 0; }
+	if (count && glad_glWindowPos3i && glad_glWindowPos3i != glad_stats_impl_glWindowPos3i) { glad_stats_real_glWindowPos3i = glad_glWindowPos3i; glad_glWindowPos3i = glad_stats_impl_glWindowPos3i; }
+	else if (!count && glad_stats_real_glWindowPos3i) { glad_glWindowPos3i = glad_stats_real_glWindowPos3i; glad_stats_real_glWindowPos3i = 0; }
+	if (count && glad_glWindowPos3iv && glad_glWindowPos3iv != glad_stats_impl_glWindowPos3iv) { glad_stats_real_glWindowPos3iv = glad_glWindowPos3iv; glad_glWindowPos3iv = glad_stats_impl_glWindowPos3iv; }
+	else if (!count && glad_stats_real_glWindowPos3iv) { glad_glWindowPos3iv = glad_stats_real_glWindowPos3iv; glad_stats_real_glWindowPos3iv = 0; }
+	if (count && glad_glWindowPos3s && glad_glWindowPos3s != glad_stats_impl_glWindowPos3s) { glad_stats_real_glWindowPos3s = glad_glWindowPos3s; glad_glWindowPos3s = glad_stats_impl_glWindowPos3s; }
+	else if (!count && glad_stats_real_glWindowPos3s) { glad_glWindowPos3s = glad_stats_real_glWindowPos3s; glad_stats_real_glWindowPos3s = 0; }
+	if (count && glad_glWindowPos3sv && glad_glWindowPos3sv != glad_stats_impl_glWindowPos3sv) { glad_stats_real_glWindowPos3sv = glad_glWindowPos3sv; glad_glWindowPos3sv = glad_stats_impl_glWindowPos3sv; }
+	else if (!count && glad_stats_real_glWindowPos3sv) { glad_glWindowPos3sv = glad_stats_real_glWindowPos3sv; glad_stats_real_glWindowPos3sv = 0; }
+}
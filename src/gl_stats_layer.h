@@ -0,0 +1,1128 @@
+/*
+
+    Per thread call counters for the OpenGL loader generated by glad 0.1.34.
+
+    APIs: gl=4.6
+    Extensions: GL_ARB_bindless_texture,GL_ARB_buffer_storage,GL_ARB_direct_state_access,GL_ARB_gl_spirv,GL_ARB_invalidate_subdata,GL_ARB_multi_draw_indirect,GL_ATI_meminfo,GL_KHR_debug,GL_KHR_parallel_shader_compile,GL_NVX_gpu_memory_info
+
+    Generated by tools/gen_gl_layers.py from the function list of src/glad.c, do not edit. After regenerating the loader:
+        python tools/gen_gl_layers.py
+    Used by gl_stats.h.
+*/
+
+#ifndef __gl_stats_layer_h_
+#define __gl_stats_layer_h_
+
+#include <glad/glad.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+	GL_STATS_glAccum = 0,
+	GL_STATS_glActiveShaderProgram,
+	GL_STATS_glActiveTexture,
+	GL_STATS_glAlphaFunc,
+	GL_STATS_glAreTexturesResident,
+	GL_STATS_glArrayElement,
+	GL_STATS_glAttachShader,
+	GL_STATS_glBegin,
+	GL_STATS_glBeginConditionalRender,
+	GL_STATS_glBeginQuery,
+	GL_STATS_glBeginQueryIndexed,
+	GL_STATS_glBeginTransformFeedback,
+	GL_STATS_glBindAttribLocation,
+	GL_STATS_glBindBuffer,
+	GL_STATS_glBindBufferBase,
+	GL_STATS_glBindBufferRange,
+	GL_STATS_glBindBuffersBase,
+	GL_STATS_glBindBuffersRange,
+	GL_STATS_glBindFragDataLocation,
+	GL_STATS_glBindFragDataLocationIndexed,
+	GL_STATS_glBindFramebuffer,
+	GL_STATS_glBindImageTexture,
+	GL_STATS_glBindImageTextures,
+	GL_STATS_glBindProgramPipeline,
+	GL_STATS_glBindRenderbuffer,
+	GL_STATS_glBindSampler,
+	GL_STATS_glBindSamplers,
+	GL_STATS_glBindTexture,
+	GL_STATS_glBindTextureUnit,
+	GL_STATS_glBindTextures,
+	GL_STATS_glBindTransformFeedback,
+	GL_STATS_glBindVertexArray,
+	GL_STATS_glBindVertexBuffer,
+	GL_STATS_glBindVertexBuffers,
+	GL_STATS_glBitmap,
+	GL_STATS_glBlendColor,
+	GL_STATS_glBlendEquation,
+	GL_STATS_glBlendEquationSeparate,
+	GL_STATS_glBlendEquationSeparatei,
+	GL_STATS_glBlendEquationi,
+	GL_STATS_glBlendFunc,
+	GL_STATS_glBlendFuncSeparate,
+	GL_STATS_glBlendFuncSeparatei,
+	GL_STATS_glBlendFunci,
+	GL_STATS_glBlitFramebuffer,
+	GL_STATS_glBlitNamedFramebuffer,
+	GL_STATS_glBufferData,
+	GL_STATS_glBufferStorage,
+	GL_STATS_glBufferSubData,
+	GL_STATS_glCallList,
+	GL_STATS_glCallLists,
+	GL_STATS_glCheckFramebufferStatus,
+	GL_STATS_glCheckNamedFramebufferStatus,
+	GL_STATS_glClampColor,
+	GL_STATS_glClear,
+	GL_STATS_glClearAccum,
+	GL_STATS_glClearBufferData,
+	GL_STATS_glClearBufferSubData,
+	GL_STATS_glClearBufferfi,
+	GL_STATS_glClearBufferfv,
+	GL_STATS_glClearBufferiv,
+	GL_STATS_glClearBufferuiv,
+	GL_STATS_glClearColor,
+	GL_STATS_glClearDepth,
+	GL_STATS_glClearDepthf,
+	GL_STATS_glClearIndex,
+	GL_STATS_glClearNamedBufferData,
+	GL_STATS_glClearNamedBufferSubData,
+	GL_STATS_glClearNamedFramebufferfi,
+	GL_STATS_glClearNamedFramebufferfv,
+	GL_STATS_glClearNamedFramebufferiv,
+	GL_STATS_glClearNamedFramebufferuiv,
+	GL_STATS_glClearStencil,
+	GL_STATS_glClearTexImage,
+	GL_STATS_glClearTexSubImage,
+	GL_STATS_glClientActiveTexture,
+	GL_STATS_glClientWaitSync,
+	GL_STATS_glClipControl,
+	GL_STATS_glClipPlane,
+	GL_STATS_glColor3b,
+	GL_STATS_glColor3bv,
+	GL_STATS_glColor3d,
+	GL_STATS_glColor3dv,
+	GL_STATS_glColor3f,
+	GL_STATS_glColor3fv,
+	GL_STATS_glColor3i,
+	GL_STATS_glColor3iv,
+	GL_STATS_glColor3s,
+	GL_STATS_glColor3sv,
+	GL_STATS_glColor3ub,
+	GL_STATS_glColor3ubv,
+	GL_STATS_glColor3ui,
+	GL_STATS_glColor3uiv,
+	GL_STATS_glColor3us,
+	GL_STATS_glColor3usv,
+	GL_STATS_glColor4b,
+	GL_STATS_glColor4bv,
+	GL_STATS_glColor4d,
+	GL_STATS_glColor4dv,
+	GL_STATS_glColor4f,
+	GL_STATS_glColor4fv,
+	GL_STATS_glColor4i,
+	GL_STATS_glColor4iv,
+	GL_STATS_glColor4s,
+	GL_STATS_glColor4sv,
+	GL_STATS_glColor4ub,
+	GL_STATS_glColor4ubv,
+	GL_STATS_glColor4ui,
+	GL_STATS_glColor4uiv,
+	GL_STATS_glColor4us,
+	GL_STATS_glColor4usv,
+	GL_STATS_glColorMask,
+	GL_STATS_glColorMaski,
+	GL_STATS_glColorMaterial,
+	GL_STATS_glColorP3ui,
+	GL_STATS_glColorP3uiv,
+	GL_STATS_glColorP4ui,
+	GL_STATS_glColorP4uiv,
+	GL_STATS_glColorPointer,
+	GL_STATS_glCompileShader,
+	GL_STATS_glCompressedTexImage1D,
+	GL_STATS_glCompressedTexImage2D,
+	GL_STATS_glCompressedTexImage3D,
+	GL_STATS_glCompressedTexSubImage1D,
+	GL_STATS_glCompressedTexSubImage2D,
+	GL_STATS_glCompressedTexSubImage3D,
+	GL_STATS_glCompressedTextureSubImage1D,
+	GL_STATS_glCompressedTextureSubImage2D,
+	GL_STATS_glCompressedTextureSubImage3D,
+	GL_STATS_glCopyBufferSubData,
+	GL_STATS_glCopyImageSubData,
+	GL_STATS_glCopyNamedBufferSubData,
+	GL_STATS_glCopyPixels,
+	GL_STATS_glCopyTexImage1D,
+	GL_STATS_glCopyTexImage2D,
+	GL_STATS_glCopyTexSubImage1D,
+	GL_STATS_glCopyTexSubImage2D,
+	GL_STATS_glCopyTexSubImage3D,
+	GL_STATS_glCopyTextureSubImage1D,
+	GL_STATS_glCopyTextureSubImage2D,
+	GL_STATS_glCopyTextureSubImage3D,
+	GL_STATS_glCreateBuffers,
+	GL_STATS_glCreateFramebuffers,
+	GL_STATS_glCreateProgram,
+	GL_STATS_glCreateProgramPipelines,
+	GL_STATS_glCreateQueries,
+	GL_STATS_glCreateRenderbuffers,
+	GL_STATS_glCreateSamplers,
+	GL_STATS_glCreateShader,
+	GL_STATS_glCreateShaderProgramv,
+	GL_STATS_glCreateTextures,
+	GL_STATS_glCreateTransformFeedbacks,
+	GL_STATS_glCreateVertexArrays,
+	GL_STATS_glCullFace,
+	GL_STATS_glDebugMessageCallback,
+	GL_STATS_glDebugMessageControl,
+	GL_STATS_glDebugMessageInsert,
+	GL_STATS_glDeleteBuffers,
+	GL_STATS_glDeleteFramebuffers,
+	GL_STATS_glDeleteLists,
+	GL_STATS_glDeleteProgram,
+	GL_STATS_glDeleteProgramPipelines,
+	GL_STATS_glDeleteQueries,
+	GL_STATS_glDeleteRenderbuffers,
+	GL_STATS_glDeleteSamplers,
+	GL_STATS_glDeleteShader,
+	GL_STATS_glDeleteSync,
+	GL_STATS_glDeleteTextures,
+	GL_STATS_glDeleteTransformFeedbacks,
+	GL_STATS_glDeleteVertexArrays,
+	GL_STATS_glDepthFunc,
+	GL_STATS_glDepthMask,
+	GL_STATS_glDepthRange,
+	GL_STATS_glDepthRangeArrayv,
+	GL_STATS_glDepthRangeIndexed,
+	GL_STATS_glDepthRangef,
+	GL_STATS_glDetachShader,
+	GL_STATS_glDisable,
+	GL_STATS_glDisableClientState,
+	GL_STATS_glDisableVertexArrayAttrib,
+	GL_STATS_glDisableVertexAttribArray,
+	GL_STATS_glDisablei,
+	GL_STATS_glDispatchCompute,
+	GL_STATS_glDispatchComputeIndirect,
+	GL_STATS_glDrawArrays,
+	GL_STATS_glDrawArraysIndirect,
+	GL_STATS_glDrawArraysInstanced,
+	GL_STATS_glDrawArraysInstancedBaseInstance,
+	GL_STATS_glDrawBuffer,
+	GL_STATS_glDrawBuffers,
+	GL_STATS_glDrawElements,
+	GL_STATS_glDrawElementsBaseVertex,
+	GL_STATS_glDrawElementsIndirect,
+	GL_STATS_glDrawElementsInstanced,
+	GL_STATS_glDrawElementsInstancedBaseInstance,
+	GL_STATS_glDrawElementsInstancedBaseVertex,
+	GL_STATS_glDrawElementsInstancedBaseVertexBaseInstance,
+	GL_STATS_glDrawPixels,
+	GL_STATS_glDrawRangeElements,
+	GL_STATS_glDrawRangeElementsBaseVertex,
+	GL_STATS_glDrawTransformFeedback,
+	GL_STATS_glDrawTransformFeedbackInstanced,
+	GL_STATS_glDrawTransformFeedbackStream,
+	GL_STATS_glDrawTransformFeedbackStreamInstanced,
+	GL_STATS_glEdgeFlag,
+	GL_STATS_glEdgeFlagPointer,
+	GL_STATS_glEdgeFlagv,
+	GL_STATS_glEnable,
+	GL_STATS_glEnableClientState,
+	GL_STATS_glEnableVertexArrayAttrib,
+	GL_STATS_glEnableVertexAttribArray,
+	GL_STATS_glEnablei,
+	GL_STATS_glEnd,
+	GL_STATS_glEndConditionalRender,
+	GL_STATS_glEndList,
+	GL_STATS_glEndQuery,
+	GL_STATS_glEndQueryIndexed,
+	GL_STATS_glEndTransformFeedback,
+	GL_STATS_glEvalCoord1d,
+	GL_STATS_glEvalCoord1dv,
+	GL_STATS_glEvalCoord1f,
+	GL_STATS_glEvalCoord1fv,
+	GL_STATS_glEvalCoord2d,
+	GL_STATS_glEvalCoord2dv,
+	GL_STATS_glEvalCoord2f,
+	GL_STATS_glEvalCoord2fv,
+	GL_STATS_glEvalMesh1,
+	GL_STATS_glEvalMesh2,
+	GL_STATS_glEvalPoint1,
+	GL_STATS_glEvalPoint2,
+	GL_STATS_glFeedbackBuffer,
+	GL_STATS_glFenceSync,
+	GL_STATS_glFinish,
+	GL_STATS_glFlush,
+	GL_STATS_glFlushMappedBufferRange,
+	GL_STATS_glFlushMappedNamedBufferRange,
+	GL_STATS_glFogCoordPointer,
+	GL_STATS_glFogCoordd,
+	GL_STATS_glFogCoorddv,
+	GL_STATS_glFogCoordf,
+	GL_STATS_glFogCoordfv,
+	GL_STATS_glFogf,
+	GL_STATS_glFogfv,
+	GL_STATS_glFogi,
+	GL_STATS_glFogiv,
+	GL_STATS_glFramebufferParameteri,
+	GL_STATS_glFramebufferRenderbuffer,
+	GL_STATS_glFramebufferTexture,
+	GL_STATS_glFramebufferTexture1D,
+	GL_STATS_glFramebufferTexture2D,
+	GL_STATS_glFramebufferTexture3D,
+	GL_STATS_glFramebufferTextureLayer,
+	GL_STATS_glFrontFace,
+	GL_STATS_glFrustum,
+	GL_STATS_glGenBuffers,
+	GL_STATS_glGenFramebuffers,
+	GL_STATS_glGenLists,
+	GL_STATS_glGenProgramPipelines,
+	GL_STATS_glGenQueries,
+	GL_STATS_glGenRenderbuffers,
+	GL_STATS_glGenSamplers,
+	GL_STATS_glGenTextures,
+	GL_STATS_glGenTransformFeedbacks,
+	GL_STATS_glGenVertexArrays,
+	GL_STATS_glGenerateMipmap,
+	GL_STATS_glGenerateTextureMipmap,
+	GL_STATS_glGetActiveAtomicCounterBufferiv,
+	GL_STATS_glGetActiveAttrib,
+	GL_STATS_glGetActiveSubroutineName,
+	GL_STATS_glGetActiveSubroutineUniformName,
+	GL_STATS_glGetActiveSubroutineUniformiv,
+	GL_STATS_glGetActiveUniform,
+	GL_STATS_glGetActiveUniformBlockName,
+	GL_STATS_glGetActiveUniformBlockiv,
+	GL_STATS_glGetActiveUniformName,
+	GL_STATS_glGetActiveUniformsiv,
+	GL_STATS_glGetAttachedShaders,
+	GL_STATS_glGetAttribLocation,
+	GL_STATS_glGetBooleani_v,
+	GL_STATS_glGetBooleanv,
+	GL_STATS_glGetBufferParameteri64v,
+	GL_STATS_glGetBufferParameteriv,
+	GL_STATS_glGetBufferPointerv,
+	GL_STATS_glGetBufferSubData,
+	GL_STATS_glGetClipPlane,
+	GL_STATS_glGetCompressedTexImage,
+	GL_STATS_glGetCompressedTextureImage,
+	GL_STATS_glGetCompressedTextureSubImage,
+	GL_STATS_glGetDebugMessageLog,
+	GL_STATS_glGetDoublei_v,
+	GL_STATS_glGetDoublev,
+	GL_STATS_glGetError,
+	GL_STATS_glGetFloati_v,
+	GL_STATS_glGetFloatv,
+	GL_STATS_glGetFragDataIndex,
+	GL_STATS_glGetFragDataLocation,
+	GL_STATS_glGetFramebufferAttachmentParameteriv,
+	GL_STATS_glGetFramebufferParameteriv,
+	GL_STATS_glGetGraphicsResetStatus,
+	GL_STATS_glGetImageHandleARB,
+	GL_STATS_glGetInteger64i_v,
+	GL_STATS_glGetInteger64v,
+	GL_STATS_glGetIntegeri_v,
+	GL_STATS_glGetIntegerv,
+	GL_STATS_glGetInternalformati64v,
+	GL_STATS_glGetInternalformativ,
+	GL_STATS_glGetLightfv,
+	GL_STATS_glGetLightiv,
+	GL_STATS_glGetMapdv,
+	GL_STATS_glGetMapfv,
+	GL_STATS_glGetMapiv,
+	GL_STATS_glGetMaterialfv,
+	GL_STATS_glGetMaterialiv,
+	GL_STATS_glGetMultisamplefv,
+	GL_STATS_glGetNamedBufferParameteri64v,
+	GL_STATS_glGetNamedBufferParameteriv,
+	GL_STATS_glGetNamedBufferPointerv,
+	GL_STATS_glGetNamedBufferSubData,
+	GL_STATS_glGetNamedFramebufferAttachmentParameteriv,
+	GL_STATS_glGetNamedFramebufferParameteriv,
+	GL_STATS_glGetNamedRenderbufferParameteriv,
+	GL_STATS_glGetObjectLabel,
+	GL_STATS_glGetObjectPtrLabel,
+	GL_STATS_glGetPixelMapfv,
+	GL_STATS_glGetPixelMapuiv,
+	GL_STATS_glGetPixelMapusv,
+	GL_STATS_glGetPointerv,
+	GL_STATS_glGetPolygonStipple,
+	GL_STATS_glGetProgramBinary,
+	GL_STATS_glGetProgramInfoLog,
+	GL_STATS_glGetProgramInterfaceiv,
+	GL_STATS_glGetProgramPipelineInfoLog,
+	GL_STATS_glGetProgramPipelineiv,
+	GL_STATS_glGetProgramResourceIndex,
+	GL_STATS_glGetProgramResourceLocation,
+	GL_STATS_glGetProgramResourceLocationIndex,
+	GL_STATS_glGetProgramResourceName,
+	GL_STATS_glGetProgramResourceiv,
+	GL_STATS_glGetProgramStageiv,
+	GL_STATS_glGetProgramiv,
+	GL_STATS_glGetQueryBufferObjecti64v,
+	GL_STATS_glGetQueryBufferObjectiv,
+	GL_STATS_glGetQueryBufferObjectui64v,
+	GL_STATS_glGetQueryBufferObjectuiv,
+	GL_STATS_glGetQueryIndexediv,
+	GL_STATS_glGetQueryObjecti64v,
+	GL_STATS_glGetQueryObjectiv,
+	GL_STATS_glGetQueryObjectui64v,
+	GL_STATS_glGetQueryObjectuiv,
+	GL_STATS_glGetQueryiv,
+	GL_STATS_glGetRenderbufferParameteriv,
+	GL_STATS_glGetSamplerParameterIiv,
+	GL_STATS_glGetSamplerParameterIuiv,
+	GL_STATS_glGetSamplerParameterfv,
+	GL_STATS_glGetSamplerParameteriv,
+	GL_STATS_glGetShaderInfoLog,
+	GL_STATS_glGetShaderPrecisionFormat,
+	GL_STATS_glGetShaderSource,
+	GL_STATS_glGetShaderiv,
+	GL_STATS_glGetString,
+	GL_STATS_glGetStringi,
+	GL_STATS_glGetSubroutineIndex,
+	GL_STATS_glGetSubroutineUniformLocation,
+	GL_STATS_glGetSynciv,
+	GL_STATS_glGetTexEnvfv,
+	GL_STATS_glGetTexEnviv,
+	GL_STATS_glGetTexGendv,
+	GL_STATS_glGetTexGenfv,
+	GL_STATS_glGetTexGeniv,
+	GL_STATS_glGetTexImage,
+	GL_STATS_glGetTexLevelParameterfv,
+	GL_STATS_glGetTexLevelParameteriv,
+	GL_STATS_glGetTexParameterIiv,
+	GL_STATS_glGetTexParameterIuiv,
+	GL_STATS_glGetTexParameterfv,
+	GL_STATS_glGetTexParameteriv,
+	GL_STATS_glGetTextureHandleARB,
+	GL_STATS_glGetTextureImage,
+	GL_STATS_glGetTextureLevelParameterfv,
+	GL_STATS_glGetTextureLevelParameteriv,
+	GL_STATS_glGetTextureParameterIiv,
+	GL_STATS_glGetTextureParameterIuiv,
+	GL_STATS_glGetTextureParameterfv,
+	GL_STATS_glGetTextureParameteriv,
+	GL_STATS_glGetTextureSamplerHandleARB,
+	GL_STATS_glGetTextureSubImage,
+	GL_STATS_glGetTransformFeedbackVarying,
+	GL_STATS_glGetTransformFeedbacki64_v,
+	GL_STATS_glGetTransformFeedbacki_v,
+	GL_STATS_glGetTransformFeedbackiv,
+	GL_STATS_glGetUniformBlockIndex,
+	GL_STATS_glGetUniformIndices,
+	GL_STATS_glGetUniformLocation,
+	GL_STATS_glGetUniformSubroutineuiv,
+	GL_STATS_glGetUniformdv,
+	GL_STATS_glGetUniformfv,
+	GL_STATS_glGetUniformiv,
+	GL_STATS_glGetUniformuiv,
+	GL_STATS_glGetVertexArrayIndexed64iv,
+	GL_STATS_glGetVertexArrayIndexediv,
+	GL_STATS_glGetVertexArrayiv,
+	GL_STATS_glGetVertexAttribIiv,
+	GL_STATS_glGetVertexAttribIuiv,
+	GL_STATS_glGetVertexAttribLdv,
+	GL_STATS_glGetVertexAttribLui64vARB,
+	GL_STATS_glGetVertexAttribPointerv,
+	GL_STATS_glGetVertexAttribdv,
+	GL_STATS_glGetVertexAttribfv,
+	GL_STATS_glGetVertexAttribiv,
+	GL_STATS_glGetnColorTable,
+	GL_STATS_glGetnCompressedTexImage,
+	GL_STATS_glGetnConvolutionFilter,
+	GL_STATS_glGetnHistogram,
+	GL_STATS_glGetnMapdv,
+	GL_STATS_glGetnMapfv,
+	GL_STATS_glGetnMapiv,
+	GL_STATS_glGetnMinmax,
+	GL_STATS_glGetnPixelMapfv,
+	GL_STATS_glGetnPixelMapuiv,
+	GL_STATS_glGetnPixelMapusv,
+	GL_STATS_glGetnPolygonStipple,
+	GL_STATS_glGetnSeparableFilter,
+	GL_STATS_glGetnTexImage,
+	GL_STATS_glGetnUniformdv,
+	GL_STATS_glGetnUniformfv,
+	GL_STATS_glGetnUniformiv,
+	GL_STATS_glGetnUniformuiv,
+	GL_STATS_glHint,
+	GL_STATS_glIndexMask,
+	GL_STATS_glIndexPointer,
+	GL_STATS_glIndexd,
+	GL_STATS_glIndexdv,
+	GL_STATS_glIndexf,
+	GL_STATS_glIndexfv,
+	GL_STATS_glIndexi,
+	GL_STATS_glIndexiv,
+	GL_STATS_glIndexs,
+	GL_STATS_glIndexsv,
+	GL_STATS_glIndexub,
+	GL_STATS_glIndexubv,
+	GL_STATS_glInitNames,
+	GL_STATS_glInterleavedArrays,
+	GL_STATS_glInvalidateBufferData,
+	GL_STATS_glInvalidateBufferSubData,
+	GL_STATS_glInvalidateFramebuffer,
+	GL_STATS_glInvalidateNamedFramebufferData,
+	GL_STATS_glInvalidateNamedFramebufferSubData,
+	GL_STATS_glInvalidateSubFramebuffer,
+	GL_STATS_glInvalidateTexImage,
+	GL_STATS_glInvalidateTexSubImage,
+	GL_STATS_glIsBuffer,
+	GL_STATS_glIsEnabled,
+	GL_STATS_glIsEnabledi,
+	GL_STATS_glIsFramebuffer,
+	GL_STATS_glIsImageHandleResidentARB,
+	GL_STATS_glIsList,
+	GL_STATS_glIsProgram,
+	GL_STATS_glIsProgramPipeline,
+	GL_STATS_glIsQuery,
+	GL_STATS_glIsRenderbuffer,
+	GL_STATS_glIsSampler,
+	GL_STATS_glIsShader,
+	GL_STATS_glIsSync,
+	GL_STATS_glIsTexture,
+	GL_STATS_glIsTextureHandleResidentARB,
+	GL_STATS_glIsTransformFeedback,
+	GL_STATS_glIsVertexArray,
+	GL_STATS_glLightModelf,
+	GL_STATS_glLightModelfv,
+	GL_STATS_glLightModeli,
+	GL_STATS_glLightModeliv,
+	GL_STATS_glLightf,
+	GL_STATS_glLightfv,
+	GL_STATS_glLighti,
+	GL_STATS_glLightiv,
+	GL_STATS_glLineStipple,
+	GL_STATS_glLineWidth,
+	GL_STATS_glLinkProgram,
+	GL_STATS_glListBase,
+	GL_STATS_glLoadIdentity,
+	GL_STATS_glLoadMatrixd,
+	GL_STATS_glLoadMatrixf,
+	GL_STATS_glLoadName,
+	GL_STATS_glLoadTransposeMatrixd,
+	GL_STATS_glLoadTransposeMatrixf,
+	GL_STATS_glLogicOp,
+	GL_STATS_glMakeImageHandleNonResidentARB,
+	GL_STATS_glMakeImageHandleResidentARB,
+	GL_STATS_glMakeTextureHandleNonResidentARB,
+	GL_STATS_glMakeTextureHandleResidentARB,
+	GL_STATS_glMap1d,
+	GL_STATS_glMap1f,
+	GL_STATS_glMap2d,
+	GL_STATS_glMap2f,
+	GL_STATS_glMapBuffer,
+	GL_STATS_glMapBufferRange,
+	GL_STATS_glMapGrid1d,
+	GL_STATS_glMapGrid1f,
+	GL_STATS_glMapGrid2d,
+	GL_STATS_glMapGrid2f,
+	GL_STATS_glMapNamedBuffer,
+	GL_STATS_glMapNamedBufferRange,
+	GL_STATS_glMaterialf,
+	GL_STATS_glMaterialfv,
+	GL_STATS_glMateriali,
+	GL_STATS_glMaterialiv,
+	GL_STATS_glMatrixMode,
+	GL_STATS_glMaxShaderCompilerThreadsKHR,
+	GL_STATS_glMemoryBarrier,
+	GL_STATS_glMemoryBarrierByRegion,
+	GL_STATS_glMinSampleShading,
+	GL_STATS_glMultMatrixd,
+	GL_STATS_glMultMatrixf,
+	GL_STATS_glMultTransposeMatrixd,
+	GL_STATS_glMultTransposeMatrixf,
+	GL_STATS_glMultiDrawArrays,
+	GL_STATS_glMultiDrawArraysIndirect,
+	GL_STATS_glMultiDrawArraysIndirectCount,
+	GL_STATS_glMultiDrawElements,
+	GL_STATS_glMultiDrawElementsBaseVertex,
+	GL_STATS_glMultiDrawElementsIndirect,
+	GL_STATS_glMultiDrawElementsIndirectCount,
+	GL_STATS_glMultiTexCoord1d,
+	GL_STATS_glMultiTexCoord1dv,
+	GL_STATS_glMultiTexCoord1f,
+	GL_STATS_glMultiTexCoord1fv,
+	GL_STATS_glMultiTexCoord1i,
+	GL_STATS_glMultiTexCoord1iv,
+	GL_STATS_glMultiTexCoord1s,
+	GL_STATS_glMultiTexCoord1sv,
+	GL_STATS_glMultiTexCoord2d,
+	GL_STATS_glMultiTexCoord2dv,
+	GL_STATS_glMultiTexCoord2f,
+	GL_STATS_glMultiTexCoord2fv,
+	GL_STATS_glMultiTexCoord2i,
+	GL_STATS_glMultiTexCoord2iv,
+	GL_STATS_glMultiTexCoord2s,
+	GL_STATS_glMultiTexCoord2sv,
+	GL_STATS_glMultiTexCoord3d,
+	GL_STATS_glMultiTexCoord3dv,
+	GL_STATS_glMultiTexCoord3f,
+	GL_STATS_glMultiTexCoord3fv,
+	GL_STATS_glMultiTexCoord3i,
+	GL_STATS_glMultiTexCoord3iv,
+	GL_STATS_glMultiTexCoord3s,
+	GL_STATS_glMultiTexCoord3sv,
+	GL_STATS_glMultiTexCoord4d,
+	GL_STATS_glMultiTexCoord4dv,
+	GL_STATS_glMultiTexCoord4f,
+	GL_STATS_glMultiTexCoord4fv,
+	GL_STATS_glMultiTexCoord4i,
+	GL_STATS_glMultiTexCoord4iv,
+	GL_STATS_glMultiTexCoord4s,
+	GL_STATS_glMultiTexCoord4sv,
+	GL_STATS_glMultiTexCoordP1ui,
+	GL_STATS_glMultiTexCoordP1uiv,
+	GL_STATS_glMultiTexCoordP2ui,
+	GL_STATS_glMultiTexCoordP2uiv,
+	GL_STATS_glMultiTexCoordP3ui,
+	GL_STATS_glMultiTexCoordP3uiv,
+	GL_STATS_glMultiTexCoordP4ui,
+	GL_STATS_glMultiTexCoordP4uiv,
+	GL_STATS_glNamedBufferData,
+	GL_STATS_glNamedBufferStorage,
+	GL_STATS_glNamedBufferStorageEXT,
+	GL_STATS_glNamedBufferSubData,
+	GL_STATS_glNamedFramebufferDrawBuffer,
+	GL_STATS_glNamedFramebufferDrawBuffers,
+	GL_STATS_glNamedFramebufferParameteri,
+	GL_STATS_glNamedFramebufferReadBuffer,
+	GL_STATS_glNamedFramebufferRenderbuffer,
+	GL_STATS_glNamedFramebufferTexture,
+	GL_STATS_glNamedFramebufferTextureLayer,
+	GL_STATS_glNamedRenderbufferStorage,
+	GL_STATS_glNamedRenderbufferStorageMultisample,
+	GL_STATS_glNewList,
+	GL_STATS_glNormal3b,
+	GL_STATS_glNormal3bv,
+	GL_STATS_glNormal3d,
+	GL_STATS_glNormal3dv,
+	GL_STATS_glNormal3f,
+	GL_STATS_glNormal3fv,
+	GL_STATS_glNormal3i,
+	GL_STATS_glNormal3iv,
+	GL_STATS_glNormal3s,
+	GL_STATS_glNormal3sv,
+	GL_STATS_glNormalP3ui,
+	GL_STATS_glNormalP3uiv,
+	GL_STATS_glNormalPointer,
+	GL_STATS_glObjectLabel,
+	GL_STATS_glObjectPtrLabel,
+	GL_STATS_glOrtho,
+	GL_STATS_glPassThrough,
+	GL_STATS_glPatchParameterfv,
+	GL_STATS_glPatchParameteri,
+	GL_STATS_glPauseTransformFeedback,
+	GL_STATS_glPixelMapfv,
+	GL_STATS_glPixelMapuiv,
+	GL_STATS_glPixelMapusv,
+	GL_STATS_glPixelStoref,
+	GL_STATS_glPixelStorei,
+	GL_STATS_glPixelTransferf,
+	GL_STATS_glPixelTransferi,
+	GL_STATS_glPixelZoom,
+	GL_STATS_glPointParameterf,
+	GL_STATS_glPointParameterfv,
+	GL_STATS_glPointParameteri,
+	GL_STATS_glPointParameteriv,
+	GL_STATS_glPointSize,
+	GL_STATS_glPolygonMode,
+	GL_STATS_glPolygonOffset,
+	GL_STATS_glPolygonOffsetClamp,
+	GL_STATS_glPolygonStipple,
+	GL_STATS_glPopAttrib,
+	GL_STATS_glPopClientAttrib,
+	GL_STATS_glPopDebugGroup,
+	GL_STATS_glPopMatrix,
+	GL_STATS_glPopName,
+	GL_STATS_glPrimitiveRestartIndex,
+	GL_STATS_glPrioritizeTextures,
+	GL_STATS_glProgramBinary,
+	GL_STATS_glProgramParameteri,
+	GL_STATS_glProgramUniform1d,
+	GL_STATS_glProgramUniform1dv,
+	GL_STATS_glProgramUniform1f,
+	GL_STATS_glProgramUniform1fv,
+	GL_STATS_glProgramUniform1i,
+	GL_STATS_glProgramUniform1iv,
+	GL_STATS_glProgramUniform1ui,
+	GL_STATS_glProgramUniform1uiv,
+	GL_STATS_glProgramUniform2d,
+	GL_STATS_glProgramUniform2dv,
+	GL_STATS_glProgramUniform2f,
+	GL_STATS_glProgramUniform2fv,
+	GL_STATS_glProgramUniform2i,
+	GL_STATS_glProgramUniform2iv,
+	GL_STATS_glProgramUniform2ui,
+	GL_STATS_glProgramUniform2uiv,
+	GL_STATS_glProgramUniform3d,
+	GL_STATS_glProgramUniform3dv,
+	GL_STATS_glProgramUniform3f,
+	GL_STATS_glProgramUniform3fv,
+	GL_STATS_glProgramUniform3i,
+	GL_STATS_glProgramUniform3iv,
+	GL_STATS_glProgramUniform3ui,
+	GL_STATS_glProgramUniform3uiv,
+	GL_STATS_glProgramUniform4d,
+	GL_STATS_glProgramUniform4dv,
+	GL_STATS_glProgramUniform4f,
+	GL_STATS_glProgramUniform4fv,
+	GL_STATS_glProgramUniform4i,
+	GL_STATS_glProgramUniform4iv,
+	GL_STATS_glProgramUniform4ui,
+	GL_STATS_glProgramUniform4uiv,
+	GL_STATS_glProgramUniformHandleui64ARB,
+	GL_STATS_glProgramUniformHandleui64vARB,
+	GL_STATS_glProgramUniformMatrix2dv,
+	GL_STATS_glProgramUniformMatrix2fv,
+	GL_STATS_glProgramUniformMatrix2x3dv,
+	GL_STATS_glProgramUniformMatrix2x3fv,
+	GL_STATS_glProgramUniformMatrix2x4dv,
+	GL_STATS_glProgramUniformMatrix2x4fv,
+	GL_STATS_glProgramUniformMatrix3dv,
+	GL_STATS_glProgramUniformMatrix3fv,
+	GL_STATS_glProgramUniformMatrix3x2dv,
+	GL_STATS_glProgramUniformMatrix3x2fv,
+	GL_STATS_glProgramUniformMatrix3x4dv,
+	GL_STATS_glProgramUniformMatrix3x4fv,
+	GL_STATS_glProgramUniformMatrix4dv,
+	GL_STATS_glProgramUniformMatrix4fv,
+	GL_STATS_glProgramUniformMatrix4x2dv,
+	GL_STATS_glProgramUniformMatrix4x2fv,
+	GL_STATS_glProgramUniformMatrix4x3dv,
+	GL_STATS_glProgramUniformMatrix4x3fv,
+	GL_STATS_glProvokingVertex,
+	GL_STATS_glPushAttrib,
+	GL_STATS_glPushClientAttrib,
+	GL_STATS_glPushDebugGroup,
+	GL_STATS_glPushMatrix,
+	GL_STATS_glPushName,
+	GL_STATS_glQueryCounter,
+	GL_STATS_glRasterPos2d,
+	GL_STATS_glRasterPos2dv,
+	GL_STATS_glRasterPos2f,
+	GL_STATS_glRasterPos2fv,
+	GL_STATS_glRasterPos2i,
+	GL_STATS_glRasterPos2iv,
+	GL_STATS_glRasterPos2s,
+	GL_STATS_glRasterPos2sv,
+	GL_STATS_glRasterPos3d,
+	GL_STATS_glRasterPos3dv,
+	GL_STATS_glRasterPos3f,
+	GL_STATS_glRasterPos3fv,
+	GL_STATS_glRasterPos3i,
+	GL_STATS_glRasterPos3iv,
+	GL_STATS_glRasterPos3s,
+	GL_STATS_glRasterPos3sv,
+	GL_STATS_glRasterPos4d,
+	GL_STATS_glRasterPos4dv,
+	GL_STATS_glRasterPos4f,
+	GL_STATS_glRasterPos4fv,
+	GL_STATS_glRasterPos4i,
+	GL_STATS_glRasterPos4iv,
+	GL_STATS_glRasterPos4s,
+	GL_STATS_glRasterPos4sv,
+	GL_STATS_glReadBuffer,
+	GL_STATS_glReadPixels,
+	GL_STATS_glReadnPixels,
+	GL_STATS_glRectd,
+	GL_STATS_glRectdv,
+	GL_STATS_glRectf,
+	GL_STATS_glRectfv,
+	GL_STATS_glRecti,
+	GL_STATS_glRectiv,
+	GL_STATS_glRects,
+	GL_STATS_glRectsv,
+	GL_STATS_glReleaseShaderCompiler,
+	GL_STATS_glRenderMode,
+	GL_STATS_glRenderbufferStorage,
+	GL_STATS_glRenderbufferStorageMultisample,
+	GL_STATS_glResumeTransformFeedback,
+	GL_STATS_glRotated,
+	GL_STATS_glRotatef,
+	GL_STATS_glSampleCoverage,
+	GL_STATS_glSampleMaski,
+	GL_STATS_glSamplerParameterIiv,
+	GL_STATS_glSamplerParameterIuiv,
+	GL_STATS_glSamplerParameterf,
+	GL_STATS_glSamplerParameterfv,
+	GL_STATS_glSamplerParameteri,
+	GL_STATS_glSamplerParameteriv,
+	GL_STATS_glScaled,
+	GL_STATS_glScalef,
+	GL_STATS_glScissor,
+	GL_STATS_glScissorArrayv,
+	GL_STATS_glScissorIndexed,
+	GL_STATS_glScissorIndexedv,
+	GL_STATS_glSecondaryColor3b,
+	GL_STATS_glSecondaryColor3bv,
+	GL_STATS_glSecondaryColor3d,
+	GL_STATS_glSecondaryColor3dv,
+	GL_STATS_glSecondaryColor3f,
+	GL_STATS_glSecondaryColor3fv,
+	GL_STATS_glSecondaryColor3i,
+	GL_STATS_glSecondaryColor3iv,
+	GL_STATS_glSecondaryColor3s,
+	GL_STATS_glSecondaryColor3sv,
+	GL_STATS_glSecondaryColor3ub,
+	GL_STATS_glSecondaryColor3ubv,
+	GL_STATS_glSecondaryColor3ui,
+	GL_STATS_glSecondaryColor3uiv,
+	GL_STATS_glSecondaryColor3us,
+	GL_STATS_glSecondaryColor3usv,
+	GL_STATS_glSecondaryColorP3ui,
+	GL_STATS_glSecondaryColorP3uiv,
+	GL_STATS_glSecondaryColorPointer,
+	GL_STATS_glSelectBuffer,
+	GL_STATS_glShadeModel,
+	GL_STATS_glShaderBinary,
+	GL_STATS_glShaderSource,
+	GL_STATS_glShaderStorageBlockBinding,
+	GL_STATS_glSpecializeShader,
+	GL_STATS_glSpecializeShaderARB,
+	GL_STATS_glStencilFunc,
+	GL_STATS_glStencilFuncSeparate,
+	GL_STATS_glStencilMask,
+	GL_STATS_glStencilMaskSeparate,
+	GL_STATS_glStencilOp,
+	GL_STATS_glStencilOpSeparate,
+	GL_STATS_glTexBuffer,
+	GL_STATS_glTexBufferRange,
+	GL_STATS_glTexCoord1d,
+	GL_STATS_glTexCoord1dv,
+	GL_STATS_glTexCoord1f,
+	GL_STATS_glTexCoord1fv,
+	GL_STATS_glTexCoord1i,
+	GL_STATS_glTexCoord1iv,
+	GL_STATS_glTexCoord1s,
+	GL_STATS_glTexCoord1sv,
+	GL_STATS_glTexCoord2d,
+	GL_STATS_glTexCoord2dv,
+	GL_STATS_glTexCoord2f,
+	GL_STATS_glTexCoord2fv,
+	GL_STATS_glTexCoord2i,
+	GL_STATS_glTexCoord2iv,
+	GL_STATS_glTexCoord2s,
+	GL_STATS_glTexCoord2sv,
+	GL_STATS_glTexCoord3d,
+	GL_STATS_glTexCoord3dv,
+	GL_STATS_glTexCoord3f,
+	GL_STATS_glTexCoord3fv,
+	GL_STATS_glTexCoord3i,
+	GL_STATS_glTexCoord3iv,
+	GL_STATS_glTexCoord3s,
+	GL_STATS_glTexCoord3sv,
+	GL_STATS_glTexCoord4d,
+	GL_STATS_glTexCoord4dv,
+	GL_STATS_glTexCoord4f,
+	GL_STATS_glTexCoord4fv,
+	GL_STATS_glTexCoord4i,
+	GL_STATS_glTexCoord4iv,
+	GL_STATS_glTexCoord4s,
+	GL_STATS_glTexCoord4sv,
+	GL_STATS_glTexCoordP1ui,
+	GL_STATS_glTexCoordP1uiv,
+	GL_STATS_glTexCoordP2ui,
+	GL_STATS_glTexCoordP2uiv,
+	GL_STATS_glTexCoordP3ui,
+	GL_STATS_glTexCoordP3uiv,
+	GL_STATS_glTexCoordP4ui,
+	GL_STATS_glTexCoordP4uiv,
+	GL_STATS_glTexCoordPointer,
+	GL_STATS_glTexEnvf,
+	GL_STATS_glTexEnvfv,
+	GL_STATS_glTexEnvi,
+	GL_STATS_glTexEnviv,
+	GL_STATS_glTexGend,
+	GL_STATS_glTexGendv,
+	GL_STATS_glTexGenf,
+	GL_STATS_glTexGenfv,
+	GL_STATS_glTexGeni,
+	GL_STATS_glTexGeniv,
+	GL_STATS_glTexImage1D,
+	GL_STATS_glTexImage2D,
+	GL_STATS_glTexImage2DMultisample,
+	GL_STATS_glTexImage3D,
+	GL_STATS_glTexImage3DMultisample,
+	GL_STATS_glTexParameterIiv,
+	GL_STATS_glTexParameterIuiv,
+	GL_STATS_glTexParameterf,
+	GL_STATS_glTexParameterfv,
+	GL_STATS_glTexParameteri,
+	GL_STATS_glTexParameteriv,
+	GL_STATS_glTexStorage1D,
+	GL_STATS_glTexStorage2D,
+	GL_STATS_glTexStorage2DMultisample,
+	GL_STATS_glTexStorage3D,
+	GL_STATS_glTexStorage3DMultisample,
+	GL_STATS_glTexSubImage1D,
+	GL_STATS_glTexSubImage2D,
+	GL_STATS_glTexSubImage3D,
+	GL_STATS_glTextureBarrier,
+	GL_STATS_glTextureBuffer,
+	GL_STATS_glTextureBufferRange,
+	GL_STATS_glTextureParameterIiv,
+	GL_STATS_glTextureParameterIuiv,
+	GL_STATS_glTextureParameterf,
+	GL_STATS_glTextureParameterfv,
+	GL_STATS_glTextureParameteri,
+	GL_STATS_glTextureParameteriv,
+	GL_STATS_glTextureStorage1D,
+	GL_STATS_glTextureStorage2D,
+	GL_STATS_glTextureStorage2DMultisample,
+	GL_STATS_glTextureStorage3D,
+	GL_STATS_glTextureStorage3DMultisample,
+	GL_STATS_glTextureSubImage1D,
+	GL_STATS_glTextureSubImage2D,
+	GL_STATS_glTextureSubImage3D,
+	GL_STATS_glTextureView,
+	GL_STATS_glTransformFeedbackBufferBase,
+	GL_STATS_glTransformFeedbackBufferRange,
+	GL_STATS_glTransformFeedbackVaryings,
+	GL_STATS_glTranslated,
+	GL_STATS_glTranslatef,
+	GL_STATS_glUniform1d,
+	GL_STATS_glUniform1dv,
+	GL_STATS_glUniform1f,
+	GL_STATS_glUniform1fv,
+	GL_STATS_glUniform1i,
+	GL_STATS_glUniform1iv,
+	GL_STATS_glUniform1ui,
+	GL_STATS_glUniform1uiv,
+	GL_STATS_glUniform2d,
+	GL_STATS_glUniform2dv,
+	GL_STATS_glUniform2f,
+	GL_STATS_glUniform2fv,
+	GL_STATS_glUniform2i,
+	GL_STATS_glUniform2iv,
+	GL_STATS_glUniform2ui,
+	GL_STATS_glUniform2uiv,
+	GL_STATS_glUniform3d,
+	GL_STATS_glUniform3dv,
+	GL_STATS_glUniform3f,
+	GL_STATS_glUniform3fv,
+	GL_STATS_glUniform3i,
+	GL_STATS_glUniform3iv,
+	GL_STATS_glUniform3ui,
+	GL_STATS_glUniform3uiv,
+	GL_STATS_glUniform4d,
+	GL_STATS_glUniform4dv,
+	GL_STATS_glUniform4f,
+	GL_STATS_glUniform4fv,
+	GL_STATS_glUniform4i,
+	GL_STATS_glUniform4iv,
+	GL_STATS_glUniform4ui,
+	GL_STATS_glUniform4uiv,
+	GL_STATS_glUniformBlockBinding,
+	GL_STATS_glUniformHandleui64ARB,
+	GL_STATS_glUniformHandleui64vARB,
+	GL_STATS_glUniformMatrix2dv,
+	GL_STATS_glUniformMatrix2fv,
+	GL_STATS_glUniformMatrix2x3dv,
+	GL_STATS_glUniformMatrix2x3fv,
+	GL_STATS_glUniformMatrix2x4dv,
+	GL_STATS_glUniformMatrix2x4fv,
+	GL_STATS_glUniformMatrix3dv,
+	GL_STATS_glUniformMatrix3fv,
+	GL_STATS_glUniformMatrix3x2dv,
+	GL_STATS_glUniformMatrix3x2fv,
+	GL_STATS_glUniformMatrix3x4dv,
+	GL_STATS_glUniformMatrix3x4fv,
+	GL_STATS_glUniformMatrix4dv,
+	GL_STATS_glUniformMatrix4fv,
+	GL_STATS_glUniformMatrix4x2dv,
+	GL_STATS_glUniformMatrix4x2fv,
+	GL_STATS_glUniformMatrix4x3dv,
+	GL_STATS_glUniformMatrix4x3fv,
+	GL_STATS_glUniformSubroutinesuiv,
+	GL_STATS_glUnmapBuffer,
+	GL_STATS_glUnmapNamedBuffer,
+	GL_STATS_glUseProgram,
+	GL_STATS_glUseProgramStages,
+	GL_STATS_glValidateProgram,
+	GL_STATS_glValidateProgramPipeline,
+	GL_STATS_glVertex2d,
+	GL_STATS_glVertex2dv,
+	GL_STATS_glVertex2f,
+	GL_STATS_glVertex2fv,
+	GL_STATS_glVertex2i,
+	GL_STATS_glVertex2iv,
+	GL_STATS_glVertex2s,
+	GL_STATS_glVertex2sv,
+	GL_STATS_glVertex3d,
+	GL_STATS_glVertex3dv,
+	GL_STATS_glVertex3f,
+	GL_STATS_glVertex3fv,
+	GL_STATS_glVertex3i,
+	GL_STATS_glVertex3iv,
+	GL_STATS_glVertex3s,
+	GL_STATS_glVertex3sv,
+	GL_STATS_glVertex4d,
+	GL_STATS_glVertex4dv,
+	GL_STATS_glVertex4f,
+	GL_STATS_glVertex4fv,
+	GL_STATS_glVertex4i,
+	GL_STATS_glVertex4iv,
+	GL_STATS_glVertex4s,
+	GL_STATS_glVertex4sv,
+	GL_STATS_glVertexArrayAttribBinding,
+	GL_STATS_glVertexArrayAttribFormat,
+	GL_STATS_glVertexArrayAttribIFormat,
+	GL_STATS_glVertexArrayAttribLFormat,
+	GL_STATS_glVertexArrayBindingDivisor,
+	GL_STATS_glVertexArrayElementBuffer,
+	GL_STATS_glVertexArrayVertexBuffer,
+	GL_STATS_glVertexArrayVertexBuffers,
+	GL_STATS_glVertexAttrib1d,
+	GL_STATS_glVertexAttrib1dv,
+	GL_STATS_glVertexAttrib1f,
+	GL_STATS_glVertexAttrib1fv,
+	GL_STATS_glVertexAttrib1s,
+	GL_STATS_glVertexAttrib1sv,
+	GL_STATS_glVertexAttrib2d,
+	GL_STATS_glVertexAttrib2dv,
+	GL_STATS_glVertexAttrib2f,
+	GL_STATS_glVertexAttrib2fv,
+	GL_STATS_glVertexAttrib2s,
+	GL_STATS_glVertexAttrib2sv,
+	GL_STATS_glVertexAttrib3d,
+	GL_STATS_glVertexAttrib3dv,
+	GL_STATS_glVertexAttrib3f,
+	GL_STATS_glVertexAttrib3fv,
+	GL_STATS_glVertexAttrib3s,
+	GL_STATS_glVertexAttrib3sv,
+	GL_STATS_glVertexAttrib4Nbv,
+	GL_STATS_glVertexAttrib4Niv,
+	GL_STATS_glVertexAttrib4Nsv,
+	GL_STATS_glVertexAttrib4Nub,
+	GL_STATS_glVertexAttrib4Nubv,
+	GL_STATS_glVertexAttrib4Nuiv,
+	GL_STATS_glVertexAttrib4Nusv,
+	GL_STATS_glVertexAttrib4bv,
+	GL_STATS_glVertexAttrib4d,
+	GL_STATS_glVertexAttrib4dv,
+	GL_STATS_glVertexAttrib4f,
+	GL_STATS_glVertexAttrib4fv,
+	GL_STATS_glVertexAttrib4iv,
+	GL_STATS_glVertexAttrib4s,
+	GL_STATS_glVertexAttrib4sv,
+	GL_STATS_glVertexAttrib4ubv,
+	GL_STATS_glVertexAttrib4uiv,
+	GL_STATS_glVertexAttrib4usv,
+	GL_STATS_glVertexAttribBinding,
+	GL_STATS_glVertexAttribDivisor,
+	GL_STATS_glVertexAttribFormat,
+	GL_STATS_glVertexAttribI1i,
+	GL_STATS_glVertexAttribI1iv,
+	GL_STATS_glVertexAttribI1ui,
+	GL_STATS_glVertexAttribI1uiv,
+	GL_STATS_glVertexAttribI2i,
+	GL_STATS_glVertexAttribI2iv,
+	GL_STATS_glVertexAttribI2ui,
+	GL_STATS_glVertexAttribI2uiv,
+	GL_STATS_glVertexAttribI3i,
+	GL_STATS_glVertexAttribI3iv,
+	GL_STATS_glVertexAttribI3ui,
+	GL_STATS_glVertexAttribI3uiv,
+	GL_STATS_glVertexAttribI4bv,
+	GL_STATS_glVertexAttribI4i,
+	GL_STATS_glVertexAttribI4iv,
+	GL_STATS_glVertexAttribI4sv,
+	GL_STATS_glVertexAttribI4ubv,
+	GL_STATS_glVertexAttribI4ui,
+	GL_STATS_glVertexAttribI4uiv,
+	GL_STATS_glVertexAttribI4usv,
+	GL_STATS_glVertexAttribIFormat,
+	GL_STATS_glVertexAttribIPointer,
+	GL_STATS_glVertexAttribL1d,
+	GL_STATS_glVertexAttribL1dv,
+	GL_STATS_glVertexAttribL1ui64ARB,
+	GL_STATS_glVertexAttribL1ui64vARB,
+	GL_STATS_glVertexAttribL2d,
+	GL_STATS_glVertexAttribL2dv,
+	GL_STATS_glVertexAttribL3d,
+	GL_STATS_glVertexAttribL3dv,
+	GL_STATS_glVertexAttribL4d,
+	GL_STATS_glVertexAttribL4dv,
+	GL_STATS_glVertexAttribLFormat,
+	GL_STATS_glVertexAttribLPointer,
+	GL_STATS_glVertexAttribP1ui,
+	GL_STATS_glVertexAttribP1uiv,
+	GL_STATS_glVertexAttribP2ui,
+	GL_STATS_glVertexAttribP2uiv,
+	GL_STATS_glVertexAttribP3ui,
+	GL_STATS_glVertexAttribP3uiv,
+	GL_STATS_glVertexAttribP4ui,
+	GL_STATS_glVertexAttribP4uiv,
+	GL_STATS_glVertexAttribPointer,
+	GL_STATS_glVertexBindingDivisor,
+	GL_STATS_glVertexP2ui,
+	GL_STATS_glVertexP2uiv,
+	GL_STATS_glVertexP3ui,
+	GL_STATS_glVertexP3uiv,
+	GL_STATS_glVertexP4ui,
+	GL_STATS_glVertexP4uiv,
+	GL_STATS_glVertexPointer,
+	GL_STATS_glViewport,
+	GL_STATS_glViewportArrayv,
+	GL_STATS_glViewportIndexedf,
+	GL_STATS_glViewportIndexedfv,
+	GL_STATS_glWaitSync,
+	GL_STATS_glWindowPos2d,
+	GL_STATS_glWindowPos2dv,
+	GL_STATS_glWindowPos2f,
+	GL_STATS_glWindowPos2fv,
+	GL_STATS_glWindowPos2i,
+	GL_STATS_glWindowPos2iv,
+	GL_STATS_glWindowPos2s,
+	GL_STATS_glWindowPos2sv,
+	GL_STATS_glWindowPos3d,
+	GL_STATS_glWindowPos3dv,
+	GL_STATS_glWindowPos3f,
+	GL_STATS_glWindowPos3fv,
+	GL_STATS_glWindowPos3i,
+	GL_STATS_glWindowPos3iv,
+	GL_STATS_glWindowPos3s,
+	GL_STATS_glWindowPos3sv,
+	GL_STATS_FUNCTION_COUNT
+};
+
+/* what a call does, in the order of GlCallCategory (gl_stats.h) */
+enum {
+	GL_STATS_CATEGORY_DRAW = 0,
+	GL_STATS_CATEGORY_DISPATCH,
+	GL_STATS_CATEGORY_CLEAR,
+	GL_STATS_CATEGORY_STATE,
+	GL_STATS_CATEGORY_BIND,
+	GL_STATS_CATEGORY_UPLOAD,
+	GL_STATS_CATEGORY_UNIFORM,
+	GL_STATS_CATEGORY_QUERY,
+	GL_STATS_CATEGORY_OBJECT,
+	GL_STATS_CATEGORY_SYNC,
+	GL_STATS_CATEGORY_OTHER,
+	GL_STATS_CATEGORY_COUNT
+};
+
+/* what the wrappers count, one per thread making GL calls. Only that thread writes it, the counts only grow (and wrap around). */
+typedef struct GLstatsCounters {
+	unsigned int calls[GL_STATS_FUNCTION_COUNT];
+	unsigned long long draws;		/* draw commands, a multi draw counts every draw it makes (when the count isn't in a buffer) */
+	unsigned long long vertices;	/* vertices, or indices, of direct draws times their instances */
+	unsigned long long uploadBytes;	/* buffer data and texture images handed to the driver */
+	unsigned long long mappedBytes;	/* buffer ranges mapped for writing */
+} GLstatsCounters;
+
+extern const char* const gl_stats_function_names[GL_STATS_FUNCTION_COUNT];
+extern const unsigned char gl_stats_function_categories[GL_STATS_FUNCTION_COUNT];
+
+/* 1: glad's pointers are replaced by the counting wrappers, 0: the previous pointers are put back. Only loaded functions are wrapped. */
+void gl_stats_layer_install(int count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,1132 @@
+/*
+
+    Multi-context dispatch for the OpenGL loader generated by glad 0.1.34, see glad_mx.h.
+
+    APIs: gl=4.6
+    Extensions: GL_ARB_bindless_texture,GL_ARB_buffer_storage,GL_ARB_direct_state_access,GL_ARB_gl_spirv,GL_ARB_invalidate_subdata,GL_ARB_multi_draw_indirect,GL_ATI_meminfo,GL_KHR_debug,GL_KHR_parallel_shader_compile,GL_NVX_gpu_memory_info
+
+    Generated by tools/gen_gl_layers.py from the function list of src/glad.c, do not edit. After regenerating the loader:
+        python tools/gen_gl_layers.py
+*/
+
+#ifdef GLAD_MULTI_CONTEXT
+
+#include <stddef.h>
+#include <glad/glad.h>
+#define GLAD_MX_NO_REDIRECT
+#include "glad_mx.h"
+
+GLAD_THREAD_LOCAL struct GladGLContext* gladCurrentContext = NULL;
+
+int gladLoadGLContext(struct GladGLContext* context, GLADloadproc load) {
+	int status = gladLoadGLLoader(load);
+	context->major = GLVersion.major;
+	context->minor = GLVersion.minor;
+	context->VERSION_1_0 = GLAD_GL_VERSION_1_0;
+	context->VERSION_1_1 = GLAD_GL_VERSION_1_1;
+	context->VERSION_1_2 = GLAD_GL_VERSION_1_2;
+	context->VERSION_1_3 = GLAD_GL_VERSION_1_3;
+	context->VERSION_1_4 = GLAD_GL_VERSION_1_4;
+	context->VERSION_1_5 = GLAD_GL_VERSION_1_5;
+	context->VERSION_2_0 = GLAD_GL_VERSION_2_0;
+	context->VERSION_2_1 = GLAD_GL_VERSION_2_1;
+	context->VERSION_3_0 = GLAD_GL_VERSION_3_0;
+	context->VERSION_3_1 = GLAD_GL_VERSION_3_1;
+	context->VERSION_3_2 = GLAD_GL_VERSION_3_2;
+	context->VERSION_3_3 = GLAD_GL_VERSION_3_3;
+	context->VERSION_4_0 = GLAD_GL_VERSION_4_0;
+	context->VERSION_4_1 = GLAD_GL_VERSION_4_1;
+	context->VERSION_4_2 = GLAD_GL_VERSION_4_2;
+	context->VERSION_4_3 = GLAD_GL_VERSION_4_3;
+	context->VERSION_4_4 = GLAD_GL_VERSION_4_4;
+	context->VERSION_4_5 = GLAD_GL_VERSION_4_5;
+	context->VERSION_4_6 = GLAD_GL_VERSION_4_6;
+	context->ARB_bindless_texture = GLAD_GL_ARB_bindless_texture;
+	context->ARB_buffer_storage = GLAD_GL_ARB_buffer_storage;
+	context->ARB_direct_state_access = GLAD_GL_ARB_direct_state_access;
+	context->ARB_gl_spirv = GLAD_GL_ARB_gl_spirv;
+	context->ARB_invalidate_subdata = GLAD_GL_ARB_invalidate_subdata;
+	context->ARB_multi_draw_indirect = GLAD_GL_ARB_multi_draw_indirect;
+	context->ATI_meminfo = GLAD_GL_ATI_meminfo;
+	context->KHR_debug = GLAD_GL_KHR_debug;
+	context->KHR_parallel_shader_compile = GLAD_GL_KHR_parallel_shader_compile;
+	context->NVX_gpu_memory_info = GLAD_GL_NVX_gpu_memory_info;
+	context->Accum = glad_glAccum;
+	context->ActiveShaderProgram = glad_glActiveShaderProgram;
+	context->ActiveTexture = glad_glActiveTexture;
+	context->AlphaFunc = glad_glAlphaFunc;
+	context->AreTexturesResident = glad_glAreTexturesResident;
+	context->ArrayElement = glad_glArrayElement;
+	context->AttachShader = glad_glAttachShader;
+	context->Begin = glad_glBegin;
+	context->BeginConditionalRender = glad_glBeginConditionalRender;
+	context->BeginQuery = glad_glBeginQuery;
+	context->BeginQueryIndexed = glad_glBeginQueryIndexed;
+	context->BeginTransformFeedback = glad_glBeginTransformFeedback;
+	context->BindAttribLocation = glad_glBindAttribLocation;
+	context->BindBuffer = glad_glBindBuffer;
+	context->BindBufferBase = glad_glBindBufferBase;
+	context->BindBufferRange = glad_glBindBufferRange;
+	context->BindBuffersBase = glad_glBindBuffersBase;
+	context->BindBuffersRange = glad_glBindBuffersRange;
+	context->BindFragDataLocation = glad_glBindFragDataLocation;
+	context->BindFragDataLocationIndexed = glad_glBindFragDataLocationIndexed;
+	context->BindFramebuffer = glad_glBindFramebuffer;
+	context->BindImageTexture = glad_glBindImageTexture;
+	context->BindImageTextures = glad_glBindImageTextures;
+	context->BindProgramPipeline = glad_glBindProgramPipeline;
+	context->BindRenderbuffer = glad_glBindRenderbuffer;
+	context->BindSampler = glad_glBindSampler;
+	context->BindSamplers = glad_glBindSamplers;
+	context->BindTexture = glad_glBindTexture;
+	context->BindTextureUnit = glad_glBindTextureUnit;
+	context->BindTextures = glad_glBindTextures;
+	context->BindTransformFeedback = glad_glBindTransformFeedback;
+	context->BindVertexArray = glad_glBindVertexArray;
+	context->BindVertexBuffer = glad_glBindVertexBuffer;
+	context->BindVertexBuffers = glad_glBindVertexBuffers;
+	context->Bitmap = glad_glBitmap;
+	context->BlendColor = glad_glBlendColor;
+	context->BlendEquation = glad_glBlendEquation;
+	context->BlendEquationSeparate = glad_glBlendEquationSeparate;
+	context->BlendEquationSeparatei = glad_glBlendEquationSeparatei;
+	context->BlendEquationi = glad_glBlendEquationi;
+	context->BlendFunc = glad_glBlendFunc;
+	context->BlendFuncSeparate = glad_glBlendFuncSeparate;
+	context->BlendFuncSeparatei = glad_glBlendFuncSeparatei;
+	context->BlendFunci = glad_glBlendFunci;
+	context->BlitFramebuffer = glad_glBlitFramebuffer;
+	context->BlitNamedFramebuffer = glad_glBlitNamedFramebuffer;
+	context->BufferData = glad_glBufferData;
+	context->BufferStorage = glad_glBufferStorage;
+	context->BufferSubData = glad_glBufferSubData;
+	context->CallList = glad_glCallList;
+	context->CallLists = glad_glCallLists;
+	context->CheckFramebufferStatus = glad_glCheckFramebufferStatus;
+	context->CheckNamedFramebufferStatus = glad_glCheckNamedFramebufferStatus;
+	context->ClampColor = glad_glClampColor;
+	context->Clear = glad_glClear;
+	context->ClearAccum = glad_glClearAccum;
+	context->ClearBufferData = glad_glClearBufferData;
+	context->ClearBufferSubData = glad_glClearBufferSubData;
+	context->ClearBufferfi = glad_glClearBufferfi;
+	context->ClearBufferfv = glad_glClearBufferfv;
+	context->ClearBufferiv = glad_glClearBufferiv;
+	context->ClearBufferuiv = glad_glClearBufferuiv;
+	context->ClearColor = glad_glClearColor;
+	context->ClearDepth = glad_glClearDepth;
+	context->ClearDepthf = glad_glClearDepthf;
+	context->ClearIndex = glad_glClearIndex;
+	context->ClearNamedBufferData = glad_glClearNamedBufferData;
+	context->ClearNamedBufferSubData = glad_glClearNamedBufferSubData;
+	context->ClearNamedFramebufferfi = glad_glClearNamedFramebufferfi;
+	context->ClearNamedFramebufferfv = glad_glClearNamedFramebufferfv;
+	context->ClearNamedFramebufferiv = glad_glClearNamedFramebufferiv;
+	context->ClearNamedFramebufferuiv = glad_glClearNamedFramebufferuiv;
+	context->ClearStencil = glad_glClearStencil;
+	context->ClearTexImage = glad_glClearTexImage;
+	context->ClearTexSubImage = glad_glClearTexSubImage;
+	context->ClientActiveTexture = glad_glClientActiveTexture;
+	context->ClientWaitSync = glad_glClientWaitSync;
+	context->ClipControl = glad_glClipControl;
+	context->ClipPlane = glad_glClipPlane;
+	context->Color3b = glad_glColor3b;
+	context->Color3bv = glad_glColor3bv;
+	context->Color3d = glad_glColor3d;
+	context->Color3dv = glad_glColor3dv;
+	context->Color3f = glad_glColor3f;
+	context->Color3fv = glad_glColor3fv;
+	context->Color3i = glad_glColor3i;
+	context->Color3iv = glad_glColor3iv;
+	context->Color3s = glad_glColor3s;
+	context->Color3sv = glad_glColor3sv;
+	context->Color3ub = glad_glColor3ub;
+	context->Color3ubv = glad_glColor3ubv;
+	context->Color3ui = glad_glColor3ui;
+	context->Color3uiv = glad_glColor3uiv;
+	context->Color3us = glad_glColor3us;
+	context->Color3usv = glad_glColor3usv;
+	context->Color4b = glad_glColor4b;
+	context->Color4bv = glad_glColor4bv;
+	context->Color4d = glad_glColor4d;
+	context->Color4dv = glad_glColor4dv;
+	context->Color4f = glad_glColor4f;
+	context->Color4fv = glad_glColor4fv;
+	context->Color4i = glad_glColor4i;
+	context->Color4iv = glad_glColor4iv;
+	context->Color4s = glad_glColor4s;
+	context->Color4sv = glad_glColor4sv;
+	context->Color4ub = glad_glColor4ub;
+	context->Color4ubv = glad_glColor4ubv;
+	context->Color4ui = glad_glColor4ui;
+	context->Color4uiv = glad_glColor4uiv;
+	context->Color4us = glad_glColor4us;
+	context->Color4usv = glad_glColor4usv;
+	context->ColorMask = glad_glColorMask;
+	context->ColorMaski = glad_glColorMaski;
+	context->ColorMaterial = glad_glColorMaterial;
+	context->ColorP3ui = glad_glColorP3ui;
+	context->ColorP3uiv = glad_glColorP3uiv;
+	context->ColorP4ui = glad_glColorP4ui;
+	context->ColorP4uiv = glad_glColorP4uiv;
+	context->ColorPointer = glad_glColorPointer;
+	context->CompileShader = glad_glCompileShader;
+	context->CompressedTexImage1D = glad_glCompressedTexImage1D;
+	context->CompressedTexImage2D = glad_glCompressedTexImage2D;
+	context->CompressedTexImage3D = glad_glCompressedTexImage3D;
+	context->CompressedTexSubImage1D = glad_glCompressedTexSubImage1D;
+	context->CompressedTexSubImage2D = glad_glCompressedTexSubImage2D;
+	context->CompressedTexSubImage3D = glad_glCompressedTexSubImage3D;
+	context->CompressedTextureSubImage1D = glad_glCompressedTextureSubImage1D;
+	context->CompressedTextureSubImage2D = glad_glCompressedTextureSubImage2D;
+	context->CompressedTextureSubImage3D = glad_glCompressedTextureSubImage3D;
+	context->CopyBufferSubData = glad_glCopyBufferSubData;
+	context->CopyImageSubData = glad_glCopyImageSubData;
+	context->CopyNamedBufferSubData = glad_glCopyNamedBufferSubData;
+	context->CopyPixels = glad_glCopyPixels;
+	context->CopyTexImage1D = glad_glCopyTexImage1D;
+	context->CopyTexImage2D = glad_glCopyTexImage2D;
+	context->CopyTexSubImage1D = glad_glCopyTexSubImage1D;
+	context->CopyTexSubImage2D = glad_glCopyTexSubImage2D;
+	context->CopyTexSubImage3D = glad_glCopyTexSubImage3D;
+	context->CopyTextureSubImage1D = glad_glCopyTextureSubImage1D;
+	context->CopyTextureSubImage2D = glad_glCopyTextureSubImage2D;
+	context->CopyTextureSubImage3D = glad_glCopyTextureSubImage3D;
+	context->CreateBuffers = glad_glCreateBuffers;
+	context->CreateFramebuffers = glad_glCreateFramebuffers;
+	context->CreateProgram = glad_glCreateProgram;
+	context->CreateProgramPipelines = glad_glCreateProgramPipelines;
+	context->CreateQueries = glad_glCreateQueries;
+	context->CreateRenderbuffers = glad_glCreateRenderbuffers;
+	context->CreateSamplers = glad_glCreateSamplers;
+	context->CreateShader = glad_glCreateShader;
+	context->CreateShaderProgramv = glad_glCreateShaderProgramv;
+	context->CreateTextures = glad_glCreateTextures;
+	context->CreateTransformFeedbacks = glad_glCreateTransformFeedbacks;
+	context->CreateVertexArrays = glad_glCreateVertexArrays;
+	context->CullFace = glad_glCullFace;
+	context->DebugMessageCallback = glad_glDebugMessageCallback;
+	context->DebugMessageControl = glad_glDebugMessageControl;
+	context->DebugMessageInsert = glad_glDebugMessageInsert;
+	context->DeleteBuffers = glad_glDeleteBuffers;
+	context->DeleteFramebuffers = glad_glDeleteFramebuffers;
+	context->DeleteLists = glad_glDeleteLists;
+	context->DeleteProgram = glad_glDeleteProgram;
+	context->DeleteProgramPipelines = glad_glDeleteProgramPipelines;
+	context->DeleteQueries = glad_glDeleteQueries;
+	context->DeleteRenderbuffers = glad_glDeleteRenderbuffers;
+	context->DeleteSamplers = glad_glDeleteSamplers;
+	context->DeleteShader = glad_glDeleteShader;
+	context->DeleteSync = glad_glDeleteSync;
+	context->DeleteTextures = glad_glDeleteTextures;
+	context->DeleteTransformFeedbacks = glad_glDeleteTransformFeedbacks;
+	context->DeleteVertexArrays = glad_glDeleteVertexArrays;
+	context->DepthFunc = glad_glDepthFunc;
+	context->DepthMask = glad_glDepthMask;
+	context->DepthRange = glad_glDepthRange;
+	context->DepthRangeArrayv = glad_glDepthRangeArrayv;
+	context->DepthRangeIndexed = glad_glDepthRangeIndexed;
+	context->DepthRangef = glad_glDepthRangef;
+	context->DetachShader = glad_glDetachShader;
+	context->Disable = glad_glDisable;
+	context->DisableClientState = glad_glDisableClientState;
+	context->DisableVertexArrayAttrib = glad_glDisableVertexArrayAttrib;
+	context->DisableVertexAttribArray = glad_glDisableVertexAttribArray;
+	context->Disablei = glad_glDisablei;
+	context->DispatchCompute = glad_glDispatchCompute;
+	context->DispatchComputeIndirect = glad_glDispatchComputeIndirect;
+	context->DrawArrays = glad_glDrawArrays;
+	context->DrawArraysIndirect = glad_glDrawArraysIndirect;
+	context->DrawArraysInstanced = glad_glDrawArraysInstanced;
+	context->DrawArraysInstancedBaseInstance = glad_glDrawArraysInstancedBaseInstance;
+	context->DrawBuffer = glad_glDrawBuffer;
+	context->DrawBuffers = glad_glDrawBuffers;
+	context->DrawElements = glad_glDrawElements;
+	context->DrawElementsBaseVertex = glad_glDrawElementsBaseVertex;
+	context->DrawElementsIndirect = glad_glDrawElementsIndirect;
+	context->DrawElementsInstanced = glad_glDrawElementsInstanced;
+	context->DrawElementsInstancedBaseInstance = glad_glDrawElementsInstancedBaseInstance;
+	context->DrawElementsInstancedBaseVertex = glad_glDrawElementsInstancedBaseVertex;
+	context->DrawElementsInstancedBaseVertexBaseInstance = glad_glDrawElementsInstancedBaseVertexBaseInstance;
+	context->DrawPixels = glad_glDrawPixels;
+	context->DrawRangeElements = glad_glDrawRangeElements;
+	context->DrawRangeElementsBaseVertex = glad_glDrawRangeElementsBaseVertex;
+	context->DrawTransformFeedback = glad_glDrawTransformFeedback;
+	context->DrawTransformFeedbackInstanced = glad_glDrawTransformFeedbackInstanced;
+	context->DrawTransformFeedbackStream = glad_glDrawTransformFeedbackStream;
+	context->DrawTransformFeedbackStreamInstanced = glad_glDrawTransformFeedbackStreamInstanced;
+	context->EdgeFlag = glad_glEdgeFlag;
+	context->EdgeFlagPointer = glad_glEdgeFlagPointer;
+	context->EdgeFlagv = glad_glEdgeFlagv;
+	context->Enable = glad_glEnable;
+	context->EnableClientState = glad_glEnableClientState;
+	context->EnableVertexArrayAttrib = glad_glEnableVertexArrayAttrib;
+	context->EnableVertexAttribArray = glad_glEnableVertexAttribArray;
+	context->Enablei = glad_glEnablei;
+	context->End = glad_glEnd;
+	context->EndConditionalRender = glad_glEndConditionalRender;
+	context->EndList = glad_glEndList;
+	context->EndQuery = glad_glEndQuery;
+	context->EndQueryIndexed = glad_glEndQueryIndexed;
+	context->EndTransformFeedback = glad_glEndTransformFeedback;
+	context->EvalCoord1d = glad_glEvalCoord1d;
+	context->EvalCoord1dv = glad_glEvalCoord1dv;
+	context->EvalCoord1f = glad_glEvalCoord1f;
+	context->EvalCoord1fv = glad_glEvalCoord1fv;
+	context->EvalCoord2d = glad_glEvalCoord2d;
+	context->EvalCoord2dv = glad_glEvalCoord2dv;
+	context->EvalCoord2f = glad_glEvalCoord2f;
+	context->EvalCoord2fv = glad_glEvalCoord2fv;
+	context->EvalMesh1 = glad_glEvalMesh1;
+	context->EvalMesh2 = glad_glEvalMesh2;
+	context->EvalPoint1 = glad_glEvalPoint1;
+	context->EvalPoint2 = glad_glEvalPoint2;
+	context->FeedbackBuffer = glad_glFeedbackBuffer;
+	context->FenceSync = glad_glFenceSync;
+	context->Finish = glad_glFinish;
+	context->Flush = glad_glFlush;
+	context->FlushMappedBufferRange = glad_glFlushMappedBufferRange;
+	context->FlushMappedNamedBufferRange = glad_glFlushMappedNamedBufferRange;
+	context->FogCoordPointer = glad_glFogCoordPointer;
+	context->FogCoordd = glad_glFogCoordd;
+	context->FogCoorddv = glad_glFogCoorddv;
+	context->FogCoordf = glad_glFogCoordf;
+	context->FogCoordfv = glad_glFogCoordfv;
+	context->Fogf = glad_glFogf;
+	context->Fogfv = glad_glFogfv;
+	context->Fogi = glad_glFogi;
+	context->Fogiv = glad_glFogiv;
+	context->FramebufferParameteri = glad_glFramebufferParameteri;
+	context->FramebufferRenderbuffer = glad_glFramebufferRenderbuffer;
+	context->FramebufferTexture = glad_glFramebufferTexture;
+	context->FramebufferTexture1D = glad_glFramebufferTexture1D;
+	context->FramebufferTexture2D = glad_glFramebufferTexture2D;
+	context->FramebufferTexture3D = glad_glFramebufferTexture3D;
+	context->FramebufferTextureLayer = glad_glFramebufferTextureLayer;
+	context->FrontFace = glad_glFrontFace;
+	context->Frustum = glad_glFrustum;
+	context->GenBuffers = glad_glGenBuffers;
+	context->GenFramebuffers = glad_glGenFramebuffers;
+	context->GenLists = glad_glGenLists;
+	context->GenProgramPipelines = glad_glGenProgramPipelines;
+	context->GenQueries = glad_glGenQueries;
+	context->GenRenderbuffers = glad_glGenRenderbuffers;
+	context->GenSamplers = glad_glGenSamplers;
+	context->GenTextures = glad_glGenTextures;
+	context->GenTransformFeedbacks = glad_glGenTransformFeedbacks;
+	context->GenVertexArrays = glad_glGenVertexArrays;
+	context->GenerateMipmap = glad_glGenerateMipmap;
+	context->GenerateTextureMipmap = glad_glGenerateTextureMipmap;
+	context->GetActiveAtomicCounterBufferiv = glad_glGetActiveAtomicCounterBufferiv;
+	context->GetActiveAttrib = glad_glGetActiveAttrib;
+	context->GetActiveSubroutineName = glad_glGetActiveSubroutineName;
+	context->GetActiveSubroutineUniformName = glad_glGetActiveSubroutineUniformName;
+	context->GetActiveSubroutineUniformiv = glad_glGetActiveSubroutineUniformiv;
+	context->GetActiveUniform = glad_glGetActiveUniform;
+	context->GetActiveUniformBlockName = glad_glGetActiveUniformBlockName;
+	context->GetActiveUniformBlockiv = glad_glGetActiveUniformBlockiv;
+	context->GetActiveUniformName = glad_glGetActiveUniformName;
+	context->GetActiveUniformsiv = glad_glGetActiveUniformsiv;
+	context->GetAttachedShaders = glad_glGetAttachedShaders;
+	context->GetAttribLocation = glad_glGetAttribLocation;
+	context->GetBooleani_v = glad_glGetBooleani_v;
+	context->GetBooleanv = glad_glGetBooleanv;
+	context->GetBufferParameteri64v = glad_glGetBufferParameteri64v;
+	context->GetBufferParameteriv = glad_glGetBufferParameteriv;
+	context->GetBufferPointerv = glad_glGetBufferPointerv;
+	context->GetBufferSubData = glad_glGetBufferSubData;
+	context->GetClipPlane = glad_glGetClipPlane;
+	context->GetCompressedTexImage = glad_glGetCompressedTexImage;
+	context->GetCompressedTextureImage = glad_glGetCompressedTextureImage;
+	context->GetCompressedTextureSubImage = glad_glGetCompressedTextureSubImage;
+	context->GetDebugMessageLog = glad_glGetDebugMessageLog;
+	context->GetDoublei_v = glad_glGetDoublei_v;
+	context->GetDoublev = glad_glGetDoublev;
+	context->GetError = glad_glGetError;
+	context->GetFloati_v = glad_glGetFloati_v;
+	context->GetFloatv = glad_glGetFloatv;
+	context->GetFragDataIndex = glad_glGetFragDataIndex;
+	context->GetFragDataLocation = glad_glGetFragDataLocation;
+	context->GetFramebufferAttachmentParameteriv = glad_glGetFramebufferAttachmentParameteriv;
+	context->GetFramebufferParameteriv = glad_glGetFramebufferParameteriv;
+	context->GetGraphicsResetStatus = glad_glGetGraphicsResetStatus;
+	context->GetImageHandleARB = glad_glGetImageHandleARB;
+	context->GetInteger64i_v = glad_glGetInteger64i_v;
+	context->GetInteger64v = glad_glGetInteger64v;
+	context->GetIntegeri_v = glad_glGetIntegeri_v;
+	context->GetIntegerv = glad_glGetIntegerv;
+	context->GetInternalformati64v = glad_glGetInternalformati64v;
+	context->GetInternalformativ = glad_glGetInternalformativ;
+	context->GetLightfv = glad_glGetLightfv;
+	context->GetLightiv = glad_glGetLightiv;
+	context->GetMapdv = glad_glGetMapdv;
+	context->GetMapfv = glad_glGetMapfv;
+	context->GetMapiv = glad_glGetMapiv;
+	context->GetMaterialfv = glad_glGetMaterialfv;
+	context->GetMaterialiv = glad_glGetMaterialiv;
+	context->GetMultisamplefv = glad_glGetMultisamplefv;
+	context->GetNamedBufferParameteri64v = glad_glGetNamedBufferParameteri64v;
+	context->GetNamedBufferParameteriv = glad_glGetNamedBufferParameteriv;
+	context->GetNamedBufferPointerv = glad_glGetNamedBufferPointerv;
+	context->GetNamedBufferSubData = glad_glGetNamedBufferSubData;
+	context->GetNamedFramebufferAttachmentParameteriv = glad_glGetNamedFramebufferAttachmentParameteriv;
+	context->GetNamedFramebufferParameteriv = glad_glGetNamedFramebufferParameteriv;
+	context->GetNamedRenderbufferParameteriv = glad_glGetNamedRenderbufferParameteriv;
+	context->GetObjectLabel = glad_glGetObjectLabel;
+	context->GetObjectPtrLabel = glad_glGetObjectPtrLabel;
+	context->GetPixelMapfv = glad_glGetPixelMapfv;
+	context->GetPixelMapuiv = glad_glGetPixelMapuiv;
+	context->GetPixelMapusv = glad_glGetPixelMapusv;
+	context->GetPointerv = glad_glGetPointerv;
+	context->GetPolygonStipple = glad_glGetPolygonStipple;
+	context->GetProgramBinary = glad_glGetProgramBinary;
+	context->GetProgramInfoLog = glad_glGetProgramInfoLog;
+	context->GetProgramInterfaceiv = glad_glGetProgramInterfaceiv;
+	context->GetProgramPipelineInfoLog = glad_glGetProgramPipelineInfoLog;
+	context->GetProgramPipelineiv = glad_glGetProgramPipelineiv;
+	context->GetProgramResourceIndex = glad_glGetProgramResourceIndex;
+	context->GetProgramResourceLocation = glad_glGetProgramResourceLocation;
+	context->GetProgramResourceLocationIndex = glad_glGetProgramResourceLocationIndex;
+	context->GetProgramResourceName = glad_glGetProgramResourceName;
+	context->GetProgramResourceiv = glad_glGetProgramResourceiv;
+	context->GetProgramStageiv = glad_glGetProgramStageiv;
+	context->GetProgramiv = glad_glGetProgramiv;
+	context->GetQueryBufferObjecti64v = glad_glGetQueryBufferObjecti64v;
+	context->GetQueryBufferObjectiv = glad_glGetQueryBufferObjectiv;
+	context->GetQueryBufferObjectui64v = glad_glGetQueryBufferObjectui64v;
+	context->GetQueryBufferObjectuiv = glad_glGetQueryBufferObjectuiv;
+	context->GetQueryIndexediv = glad_glGetQueryIndexediv;
+	context->GetQueryObjecti64v = glad_glGetQueryObjecti64v;
+	context->GetQueryObjectiv = glad_glGetQueryObjectiv;
+	context->GetQueryObjectui64v = glad_glGetQueryObjectui64v;
+	context->GetQueryObjectuiv = glad_glGetQueryObjectuiv;
+	context->GetQueryiv = glad_glGetQueryiv;
+	context->GetRenderbufferParameteriv = glad_glGetRenderbufferParameteriv;
+	context->GetSamplerParameterIiv = glad_glGetSamplerParameterIiv;
+	context->GetSamplerParameterIuiv = glad_glGetSamplerParameterIuiv;
+	context->GetSamplerParameterfv = glad_glGetSamplerParameterfv;
+	context->GetSamplerParameteriv = glad_glGetSamplerParameteriv;
+	context->GetShaderInfoLog = glad_glGetShaderInfoLog;
+	context->GetShaderPrecisionFormat = glad_glGetShaderPrecisionFormat;
+	context->GetShaderSource = glad_glGetShaderSource;
+	context->GetShaderiv = glad_glGetShaderiv;
+	context->GetString = glad_glGetString;
+	context->GetStringi = glad_glGetStringi;
+	context->GetSubroutineIndex = glad_glGetSubroutineIndex;
+	context->GetSubroutineUniformLocation = glad_glGetSubroutineUniformLocation;
+	context->GetSynciv = glad_glGetSynciv;
+	context->GetTexEnvfv = glad_glGetTexEnvfv;
+	context->GetTexEnviv = glad_glGetTexEnviv;
+	context->GetTexGendv = glad_glGetTexGendv;
+	context->GetTexGenfv = glad_glGetTexGenfv;
+	context->GetTexGeniv = glad_glGetTexGeniv;
+	context->GetTexImage = glad_glGetTexImage;
+	context->GetTexLevelParameterfv = glad_glGetTexLevelParameterfv;
+	context->GetTexLevelParameteriv = glad_glGetTexLevelParameteriv;
+	context->GetTexParameterIiv = glad_glGetTexParameterIiv;
+	context->GetTexParameterIuiv = glad_glGetTexParameterIuiv;
+	context->GetTexParameterfv = glad_glGetTexParameterfv;
+	context->GetTexParameteriv = glad_glGetTexParameteriv;
+	context->GetTextureHandleARB = glad_glGetTextureHandleARB;
+	context->GetTextureImage = glad_glGetTextureImage;
+	context->GetTextureLevelParameterfv = glad_glGetTextureLevelParameterfv;
+	context->GetTextureLevelParameteriv = glad_glGetTextureLevelParameteriv;
+	context->GetTextureParameterIiv = glad_glGetTextureParameterIiv;
+	context->GetTextureParameterIuiv = glad_glGetTextureParameterIuiv;
+	context->GetTextureParameterfv = glad_glGetTextureParameterfv;
+	context->GetTextureParameteriv = glad_glGetTextureParameteriv;
+	context->GetTextureSamplerHandleARB = glad_glGetTextureSamplerHandleARB;
+	context->GetTextureSubImage = glad_glGetTextureSubImage;
+	context->GetTransformFeedbackVarying = glad_glGetTransformFeedbackVarying;
+	context->GetTransformFeedbacki64_v = glad_glGetTransformFeedbacki64_v;
+	context->GetTransformFeedbacki_v = glad_glGetTransformFeedbacki_v;
+	context->GetTransformFeedbackiv = glad_glGetTransformFeedbackiv;
+	context->GetUniformBlockIndex = glad_glGetUniformBlockIndex;
+	context->GetUniformIndices = glad_glGetUniformIndices;
+	context->GetUniformLocation = glad_glGetUniformLocation;
+	context->GetUniformSubroutineuiv = glad_glGetUniformSubroutineuiv;
+	context->GetUniformdv = glad_glGetUniformdv;
+	context->GetUniformfv = glad_glGetUniformfv;
+	context->GetUniformiv = glad_glGetUniformiv;
+	context->GetUniformuiv = glad_glGetUniformuiv;
+	context->GetVertexArrayIndexed64iv = glad_glGetVertexArrayIndexed64iv;
+	context->GetVertexArrayIndexediv = glad_glGetVertexArrayIndexediv;
+	context->GetVertexArrayiv = glad_glGetVertexArrayiv;
+	context->GetVertexAttribIiv = glad_glGetVertexAttribIiv;
+	context->GetVertexAttribIuiv = glad_glGetVertexAttribIuiv;
+	context->GetVertexAttribLdv = glad_glGetVertexAttribLdv;
+	context->GetVertexAttribLui64vARB = glad_glGetVertexAttribLui64vARB;
+	context->GetVertexAttribPointerv = glad_glGetVertexAttribPointerv;
+	context->GetVertexAttribdv = glad_glGetVertexAttribdv;
+	context->GetVertexAttribfv = glad_glGetVertexAttribfv;
+	context->GetVertexAttribiv = glad_glGetVertexAttribiv;
+	context->GetnColorTable = glad_glGetnColorTable;
+	context->GetnCompressedTexImage = glad_glGetnCompressedTexImage;
+	context->GetnConvolutionFilter = glad_glGetnConvolutionFilter;
+	context->GetnHistogram = glad_glGetnHistogram;
+	context->GetnMapdv = glad_glGetnMapdv;
+	context->GetnMapfv = glad_glGetnMapfv;
+	context->GetnMapiv = glad_glGetnMapiv;
+	context->GetnMinmax = glad_glGetnMinmax;
+	context->GetnPixelMapfv = glad_glGetnPixelMapfv;
+	context->GetnPixelMapuiv = glad_glGetnPixelMapuiv;
+	context->GetnPixelMapusv = glad_glGetnPixelMapusv;
+	context->GetnPolygonStipple = glad_glGetnPolygonStipple;
+	context->GetnSeparableFilter = glad_glGetnSeparableFilter;
+	context->GetnTexImage = glad_glGetnTexImage;
+	context->GetnUniformdv = glad_glGetnUniformdv;
+	context->GetnUniformfv = glad_glGetnUniformfv;
+	context->GetnUniformiv = glad_glGetnUniformiv;
+	context->GetnUniformuiv = glad_glGetnUniformuiv;
+	context->Hint = glad_glHint;
+	context->IndexMask = glad_glIndexMask;
+	context->IndexPointer = glad_glIndexPointer;
+	context->Indexd = glad_glIndexd;
+	context->Indexdv = glad_glIndexdv;
+	context->Indexf = glad_glIndexf;
+	context->Indexfv = glad_glIndexfv;
+	context->Indexi = glad_glIndexi;
+	context->Indexiv = glad_glIndexiv;
+	context->Indexs = glad_glIndexs;
+	context->Indexsv = glad_glIndexsv;
+	context->Indexub = glad_glIndexub;
+	context->Indexubv = glad_glIndexubv;
+	context->InitNames = glad_glInitNames;
+	context->InterleavedArrays = glad_glInterleavedArrays;
+	context->InvalidateBufferData = glad_glInvalidateBufferData;
+	context->InvalidateBufferSubData = glad_glInvalidateBufferSubData;
+	context->InvalidateFramebuffer = glad_glInvalidateFramebuffer;
+	context->InvalidateNamedFramebufferData = glad_glInvalidateNamedFramebufferData;
+	context->InvalidateNamedFramebufferSubData = glad_glInvalidateNamedFramebufferSubData;
+	context->InvalidateSubFramebuffer = glad_glInvalidateSubFramebuffer;
+	context->InvalidateTexImage = glad_glInvalidateTexImage;
+	context->InvalidateTexSubImage = glad_glInvalidateTexSubImage;
+	context->IsBuffer = glad_glIsBuffer;
+	context->IsEnabled = glad_glIsEnabled;
+	context->IsEnabledi = glad_glIsEnabledi;
+	context->IsFramebuffer = glad_glIsFramebuffer;
+	context->IsImageHandleResidentARB = glad_glIsImageHandleResidentARB;
+	context->IsList = glad_glIsList;
+	context->IsProgram = glad_glIsProgram;
+	context->IsProgramPipeline = glad_glIsProgramPipeline;
+	context->IsQuery = glad_glIsQuery;
+	context->IsRenderbuffer = glad_glIsRenderbuffer;
+	context->IsSampler = glad_glIsSampler;
+	context->IsShader = glad_glIsShader;
+	context->IsSync = glad_glIsSync;
+	context->IsTexture = glad_glIsTexture;
+	context->IsTextureHandleResidentARB = glad_glIsTextureHandleResidentARB;
+	context->IsTransformFeedback = glad_glIsTransformFeedback;
+	context->IsVertexArray = glad_glIsVertexArray;
+	context->LightModelf = glad_glLightModelf;
+	context->LightModelfv = glad_glLightModelfv;
+	context->LightModeli = glad_glLightModeli;
+	context->LightModeliv = glad_glLightModeliv;
+	context->Lightf = glad_glLightf;
+	context->Lightfv = glad_glLightfv;
+	context->Lighti = glad_glLighti;
+	context->Lightiv = glad_glLightiv;
+	context->LineStipple = glad_glLineStipple;
+	context->LineWidth = glad_glLineWidth;
+	context->LinkProgram = glad_glLinkProgram;
+	context->ListBase = glad_glListBase;
+	context->LoadIdentity = glad_glLoadIdentity;
+	context->LoadMatrixd = glad_glLoadMatrixd;
+	context->LoadMatrixf = glad_glLoadMatrixf;
+	context->LoadName = glad_glLoadName;
+	context->LoadTransposeMatrixd = glad_glLoadTransposeMatrixd;
+	context->LoadTransposeMatrixf = glad_glLoadTransposeMatrixf;
+	context->LogicOp = glad_glLogicOp;
+	context->MakeImageHandleNonResidentARB = glad_glMakeImageHandleNonResidentARB;
+	context->MakeImageHandleResidentARB = glad_glMakeImageHandleResidentARB;
+	context->MakeTextureHandleNonResidentARB = glad_glMakeTextureHandleNonResidentARB;
+	context->MakeTextureHandleResidentARB = glad_glMakeTextureHandleResidentARB;
+	context->Map1d = glad_glMap1d;
+	context->Map1f = glad_glMap1f;
+	context->Map2d = glad_glMap2d;
+	context->Map2f = glad_glMap2f;
+	context->MapBuffer = glad_glMapBuffer;
+	context->MapBufferRange = glad_glMapBufferRange;
+	context->MapGrid1d = glad_glMapGrid1d;
+	context->MapGrid1f = glad_glMapGrid1f;
+	context->MapGrid2d = glad_glMapGrid2d;
+	context->MapGrid2f = glad_glMapGrid2f;
+	context->MapNamedBuffer = glad_glMapNamedBuffer;
+	context->MapNamedBufferRange = glad_glMapNamedBufferRange;
+	context->Materialf = glad_glMaterialf;
+	context->Materialfv = glad_glMaterialfv;
+	context->Materiali = glad_glMateriali;
+	context->Materialiv = glad_glMaterialiv;
+	context->MatrixMode = glad_glMatrixMode;
+	context->MaxShaderCompilerThreadsKHR = glad_glMaxShaderCompilerThreadsKHR;
+	context->MemoryBarrier = glad_glMemoryBarrier;
+	context->MemoryBarrierByRegion = glad_glMemoryBarrierByRegion;
+	context->MinSampleShading = glad_glMinSampleShading;
+	context->MultMatrixd = glad_glMultMatrixd;
+	context->MultMatrixf = glad_glMultMatrixf;
+	context->MultTransposeMatrixd = glad_glMultTransposeMatrixd;
+	context->MultTransposeMatrixf = glad_glMultTransposeMatrixf;
+	context->MultiDrawArrays = glad_glMultiDrawArrays;
+	context->MultiDrawArraysIndirect = glad_glMultiDrawArraysIndirect;
+	context->MultiDrawArraysIndirectCount = glad_glMultiDrawArraysIndirectCount;
+	context->MultiDrawElements = glad_glMultiDrawElements;
+	context->MultiDrawElementsBaseVertex = glad_glMultiDrawElementsBaseVertex;
+	context->MultiDrawElementsIndirect = glad_glMultiDrawElementsIndirect;
+	context->MultiDrawElementsIndirectCount = glad_glMultiDrawElementsIndirectCount;
+	context->MultiTexCoord1d = glad_glMultiTexCoord1d;
+	context->MultiTexCoord1dv = glad_glMultiTexCoord1dv;
+	context->MultiTexCoord1f = glad_glMultiTexCoord1f;
+	context->MultiTexCoord1fv = glad_glMultiTexCoord1fv;
+	context->MultiTexCoord1i = glad_glMultiTexCoord1i;
+	context->MultiTexCoord1iv = glad_glMultiTexCoord1iv;
+	context->MultiTexCoord1s = glad_glMultiTexCoord1s;
+	context->MultiTexCoord1sv = glad_glMultiTexCoord1sv;
+	context->MultiTexCoord2d = glad_glMultiTexCoord2d;
+	context->MultiTexCoord2dv = glad_glMultiTexCoord2dv;
+	context->MultiTexCoord2f = glad_glMultiTexCoord2f;
+	context->MultiTexCoord2fv = glad_glMultiTexCoord2fv;
+	context->MultiTexCoord2i = glad_glMultiTexCoord2i;
+	context->MultiTexCoord2iv = glad_glMultiTexCoord2iv;
+	context->MultiTexCoord2s = glad_glMultiTexCoord2s;
+	context->MultiTexCoord2sv = glad_glMultiTexCoord2sv;
+	context->MultiTexCoord3d = glad_glMultiTexCoord3d;
+	context->MultiTexCoord3dv = glad_glMultiTexCoord3dv;
+	context->MultiTexCoord3f = glad_glMultiTexCoord3f;
+	context->MultiTexCoord3fv = glad_glMultiTexCoord3fv;
+	context->MultiTexCoord3i = glad_glMultiTexCoord3i;
+	context->MultiTexCoord3iv = glad_glMultiTexCoord3iv;
+	context->MultiTexCoord3s = glad_glMultiTexCoord3s;
+	context->MultiTexCoord3sv = glad_glMultiTexCoord3sv;
+	context->MultiTexCoord4d = glad_glMultiTexCoord4d;
+	context->MultiTexCoord4dv = glad_glMultiTexCoord4dv;
+	context->MultiTexCoord4f = glad_glMultiTexCoord4f;
+	context->MultiTexCoord4fv = glad_glMultiTexCoord4fv;
+	context->MultiTexCoord4i = glad_glMultiTexCoord4i;
+	context->MultiTexCoord4iv = glad_glMultiTexCoord4iv;
+	context->MultiTexCoord4s = glad_glMultiTexCoord4s;
+	context->MultiTexCoord4sv = glad_glMultiTexCoord4sv;
+	context->MultiTexCoordP1ui = glad_glMultiTexCoordP1ui;
+	context->MultiTexCoordP1uiv = glad_glMultiTexCoordP1uiv;
+	context->MultiTexCoordP2ui = glad_glMultiTexCoordP2ui;
+	context->MultiTexCoordP2uiv = glad_glMultiTexCoordP2uiv;
+	context->MultiTexCoordP3ui = glad_glMultiTexCoordP3ui;
+	context->MultiTexCoordP3uiv = glad_glMultiTexCoordP3uiv;
+	context->MultiTexCoordP4ui = glad_glMultiTexCoordP4ui;
+	context->MultiTexCoordP4uiv = glad_glMultiTexCoordP4uiv;
+	context->NamedBufferData = glad_glNamedBufferData;
+	context->NamedBufferStorage = glad_glNamedBufferStorage;
+	context->NamedBufferStorageEXT = glad_glNamedBufferStorageEXT;
+	context->NamedBufferSubData = glad_glNamedBufferSubData;
+	context->NamedFramebufferDrawBuffer = glad_glNamedFramebufferDrawBuffer;
+	context->NamedFramebufferDrawBuffers = glad_glNamedFramebufferDrawBuffers;
+	context->NamedFramebufferParameteri = glad_glNamedFramebufferParameteri;
+	context->NamedFramebufferReadBuffer = glad_glNamedFramebufferReadBuffer;
+	context->NamedFramebufferRenderbuffer = glad_glNamedFramebufferRenderbuffer;
+	context->NamedFramebufferTexture = glad_glNamedFramebufferTexture;
+	context->NamedFramebufferTextureLayer = glad_glNamedFramebufferTextureLayer;
+	context->NamedRenderbufferStorage = glad_glNamedRenderbufferStorage;
+	context->NamedRenderbufferStorageMultisample = glad_glNamedRenderbufferStorageMultisample;
+	context->NewList = glad_glNewList;
+	context->Normal3b = glad_glNormal3b;
+	context->Normal3bv = glad_glNormal3bv;
+	context->Normal3d = glad_glNormal3d;
+	context->Normal3dv = glad_glNormal3dv;
+	context->Normal3f = glad_glNormal3f;
+	context->Normal3fv = glad_glNormal3fv;
+	context->Normal3i = glad_glNormal3i;
+	context->Normal3iv = glad_glNormal3iv;
+	context->Normal3s = glad_glNormal3s;
+	context->Normal3sv = glad_glNormal3sv;
+	context->NormalP3ui = glad_glNormalP3ui;
+	context->NormalP3uiv = glad_glNormalP3uiv;
+	context->NormalPointer = glad_glNormalPointer;
+	context->ObjectLabel = glad_glObjectLabel;
+	context->ObjectPtrLabel = glad_glObjectPtrLabel;
+	context->Ortho = glad_glOrtho;
+	context->PassThrough = glad_glPassThrough;
+	context->PatchParameterfv = glad_glPatchParameterfv;
+	context->PatchParameteri = glad_glPatchParameteri;
+	context->PauseTransformFeedback = glad_glPauseTransformFeedback;
+	context->PixelMapfv = glad_glPixelMapfv;
+	context->PixelMapuiv = glad_glPixelMapuiv;
+	context->PixelMapusv = glad_glPixelMapusv;
+	context->PixelStoref = glad_glPixelStoref;
+	context->PixelStorei = glad_glPixelStorei;
+	context->PixelTransferf = glad_glPixelTransferf;
+	context->PixelTransferi = glad_glPixelTransferi;
+	context->PixelZoom = glad_glPixelZoom;
+	context->PointParameterf = glad_glPointParameterf;
+	context->PointParameterfv = glad_glPointParameterfv;
+	context->PointParameteri = glad_glPointParameteri;
+	context->PointParameteriv = glad_glPointParameteriv;
+	context->PointSize = glad_glPointSize;
+	context->PolygonMode = glad_glPolygonMode;
+	context->PolygonOffset = glad_glPolygonOffset;
+	context->PolygonOffsetClamp = glad_glPolygonOffsetClamp;
+	context->PolygonStipple = glad_glPolygonStipple;
+	context->PopAttrib = glad_glPopAttrib;
+	context->PopClientAttrib = glad_glPopClientAttrib;
+	context->PopDebugGroup = glad_glPopDebugGroup;
+	context->PopMatrix = glad_glPopMatrix;
+	context->PopName = glad_glPopName;
+	context->PrimitiveRestartIndex = glad_glPrimitiveRestartIndex;
+	context->PrioritizeTextures = glad_glPrioritizeTextures;
+	context->ProgramBinary = glad_glProgramBinary;
+	context->ProgramParameteri = glad_glProgramParameteri;
+	context->ProgramUniform1d = glad_glProgramUniform1d;
+	context->ProgramUniform1dv = glad_glProgramUniform1dv;
+	context->ProgramUniform1f = glad_glProgramUniform1f;
+	context->ProgramUniform1fv = glad_glProgramUniform1fv;
+	context->ProgramUniform1i = glad_glProgramUniform1i;
+	context->ProgramUniform1iv = glad_glProgramUniform1iv;
+	context->ProgramUniform1ui = glad_glProgramUniform1ui;
+	context->ProgramUniform1uiv = glad_glProgramUniform1uiv;
+	context->ProgramUniform2d = glad_glProgramUniform2d;
+	context->ProgramUniform2dv = glad_glProgramUniform2dv;
+	context->ProgramUniform2f = glad_glProgramUniform2f;
+	context->ProgramUniform2fv = glad_glProgramUniform2fv;
+	context->ProgramUniform2i = glad_glProgramUniform2i;
+	context->ProgramUniform2iv = glad_glProgramUniform2iv;
+	context->ProgramUniform2ui = glad_glProgramUniform2ui;
+	context->ProgramUniform2uiv = glad_glProgramUniform2uiv;
+	context->ProgramUniform3d = glad_glProgramUniform3d;
+	context->ProgramUniform3dv = glad_glProgramUniform3dv;
+	context->ProgramUniform3f = glad_glProgramUniform3f;
+	context->ProgramUniform3fv = glad_glProgramUniform3fv;
+	context->ProgramUniform3i = glad_glProgramUniform3i;
+	context->ProgramUniform3iv = glad_glProgramUniform3iv;
+	context->ProgramUniform3ui = glad_glProgramUniform3ui;
+	context->ProgramUniform3uiv = glad_glProgramUniform3uiv;
+	context->ProgramUniform4d = glad_glProgramUniform4d;
+	context->ProgramUniform4dv = glad_glProgramUniform4dv;
+	context->ProgramUniform4f = glad_glProgramUniform4f;
+	context->ProgramUniform4fv = glad_glProgramUniform4fv;
+	context->ProgramUniform4i = glad_glProgramUniform4i;
+	context->ProgramUniform4iv = glad_glProgramUniform4iv;
+	context->ProgramUniform4ui = glad_glProgramUniform4ui;
+	context->ProgramUniform4uiv = glad_glProgramUniform4uiv;
+	context->ProgramUniformHandleui64ARB = glad_glProgramUniformHandleui64ARB;
+	context->ProgramUniformHandleui64vARB = glad_glProgramUniformHandleui64vARB;
+	context->ProgramUniformMatrix2dv = glad_glProgramUniformMatrix2dv;
+	context->ProgramUniformMatrix2fv = glad_glProgramUniformMatrix2fv;
+	context->ProgramUniformMatrix2x3dv = glad_glProgramUniformMatrix2x3dv;
+	context->ProgramUniformMatrix2x3fv = glad_glProgramUniformMatrix2x3fv;
+	context->ProgramUniformMatrix2x4dv = glad_glProgramUniformMatrix2x4dv;
+	context->ProgramUniformMatrix2x4fv = glad_glProgramUniformMatrix2x4fv;
+	context->ProgramUniformMatrix3dv = glad_glProgramUniformMatrix3dv;
+	context->ProgramUniformMatrix3fv = glad_glProgramUniformMatrix3fv;
+	context->ProgramUniformMatrix3x2dv = glad_glProgramUniformMatrix3x2dv;
+	context->ProgramUniformMatrix3x2fv = glad_glProgramUniformMatrix3x2fv;
+	context->ProgramUniformMatrix3x4dv = glad_glProgramUniformMatrix3x4dv;
+	context->ProgramUniformMatrix3x4fv = glad_glProgramUniformMatrix3x4fv;
+	context->ProgramUniformMatrix4dv = glad_glProgramUniformMatrix4dv;
+	context->ProgramUniformMatrix4fv = glad_glProgramUniformMatrix4fv;
+	context->ProgramUniformMatrix4x2dv = glad_glProgramUniformMatrix4x2dv;
+	context->ProgramUniformMatrix4x2fv = glad_glProgramUniformMatrix4x2fv;
+	context->ProgramUniformMatrix4x3dv = glad_glProgramUniformMatrix4x3dv;
+	context->ProgramUniformMatrix4x3fv = glad_glProgramUniformMatrix4x3fv;
+	context->ProvokingVertex = glad_glProvokingVertex;
+	context->PushAttrib = glad_glPushAttrib;
+	context->PushClientAttrib = glad_glPushClientAttrib;
+	context->PushDebugGroup = glad_glPushDebugGroup;
+	context->PushMatrix = glad_glPushMatrix;
+	context->PushName = glad_glPushName;
+	context->QueryCounter = glad_glQueryCounter;
+	context->RasterPos2d = glad_glRasterPos2d;
+	context->RasterPos2dv = glad_glRasterPos2dv;
+	context->RasterPos2f = glad_glRasterPos2f;
+	context->RasterPos2fv = glad_glRasterPos2fv;
+	context->RasterPos2i = glad_glRasterPos2i;
+	context->RasterPos2iv = glad_glRasterPos2iv;
+	context->RasterPos2s = glad_glRasterPos2s;
+	context->RasterPos2sv = glad_glRasterPos2sv;
+	context->RasterPos3d = glad_glRasterPos3d;
+	context->RasterPos3dv = glad_glRasterPos3dv;
+	context->RasterPos3f = glad_glRasterPos3f;
+	context->RasterPos3fv = glad_glRasterPos3fv;
+	context->RasterPos3i = glad_glRasterPos3i;
+	context->RasterPos3iv = glad_glRasterPos3iv;
+	context->RasterPos3s = glad_glRasterPos3s;
+	context->RasterPos3sv = glad_glRasterPos3sv;
+	context->RasterPos4d = glad_glRasterPos4d;
+	context->RasterPos4dv = glad_glRasterPos4dv;
+	context->RasterPos4f = glad_glRasterPos4f;
+	context->RasterPos4fv = glad_glRasterPos4fv;
+	context->RasterPos4i = glad_glRasterPos4i;
+	context->RasterPos4iv = glad_glRasterPos4iv;
+	context->RasterPos4s = glad_glRasterPos4s;
+	context->RasterPos4sv = glad_glRasterPos4sv;
+	context->ReadBuffer = glad_glReadBuffer;
+	context->ReadPixels = glad_glReadPixels;
+	context->ReadnPixels = glad_glReadnPixels;
+	context->Rectd = glad_glRectd;
+	context->Rectdv = glad_glRectdv;
+	context->Rectf = glad_glRectf;
+	context->Rectfv = glad_glRectfv;
+	context->Recti = glad_glRecti;
+	context->Rectiv = glad_glRectiv;
+	context->Rects = glad_glRects;
+	context->Rectsv = glad_glRectsv;
+	context->ReleaseShaderCompiler = glad_glReleaseShaderCompiler;
+	context->RenderMode = glad_glRenderMode;
+	context->RenderbufferStorage = glad_glRenderbufferStorage;
+	context->RenderbufferStorageMultisample = glad_glRenderbufferStorageMultisample;
+	context->ResumeTransformFeedback = glad_glResumeTransformFeedback;
+	context->Rotated = glad_glRotated;
+	context->Rotatef = glad_glRotatef;
+	context->SampleCoverage = glad_glSampleCoverage;
+	context->SampleMaski = glad_glSampleMaski;
+	context->SamplerParameterIiv = glad_glSamplerParameterIiv;
+	context->SamplerParameterIuiv = glad_glSamplerParameterIuiv;
+	context->SamplerParameterf = glad_glSamplerParameterf;
+	context->SamplerParameterfv = glad_glSamplerParameterfv;
+	context->SamplerParameteri = glad_glSamplerParameteri;
+	context->SamplerParameteriv = glad_glSamplerParameteriv;
+	context->Scaled = glad_glScaled;
+	context->Scalef = glad_glScalef;
+	context->Scissor = glad_glScissor;
+	context->ScissorArrayv = glad_glScissorArrayv;
+	context->ScissorIndexed = glad_glScissorIndexed;
+	context->ScissorIndexedv = glad_glScissorIndexedv;
+	context->SecondaryColor3b = glad_glSecondaryColor3b;
+	context->SecondaryColor3bv = glad_glSecondaryColor3bv;
+	context->SecondaryColor3d = glad_glSecondaryColor3d;
+	context->SecondaryColor3dv = glad_glSecondaryColor3dv;
+	context->SecondaryColor3f = glad_glSecondaryColor3f;
+	context->SecondaryColor3fv = glad_glSecondaryColor3fv;
+	context->SecondaryColor3i = glad_glSecondaryColor3i;
+	context->SecondaryColor3iv = glad_glSecondaryColor3iv;
+	context->SecondaryColor3s = glad_glSecondaryColor3s;
+	context->SecondaryColor3sv = glad_glSecondaryColor3sv;
+	context->SecondaryColor3ub = glad_glSecondaryColor3ub;
+	context->SecondaryColor3ubv = glad_glSecondaryColor3ubv;
+	context->SecondaryColor3ui = glad_glSecondaryColor3ui;
+	context->SecondaryColor3uiv = glad_glSecondaryColor3uiv;
+	context->SecondaryColor3us = glad_glSecondaryColor3us;
+	context->SecondaryColor3usv = glad_glSecondaryColor3usv;
+	context->SecondaryColorP3ui = glad_glSecondaryColorP3ui;
+	context->SecondaryColorP3uiv = glad_glSecondaryColorP3uiv;
+	context->SecondaryColorPointer = glad_glSecondaryColorPointer;
+	context->SelectBuffer = glad_glSelectBuffer;
+	context->ShadeModel = glad_glShadeModel;
+	context->ShaderBinary = glad_glShaderBinary;
+	context->ShaderSource = glad_glShaderSource;
+	context->ShaderStorageBlockBinding = glad_glShaderStorageBlockBinding;
+	context->SpecializeShader = glad_glSpecializeShader;
+	context->SpecializeShaderARB = glad_glSpecializeShaderARB;
+	context->StencilFunc = glad_glStencilFunc;
+	context->StencilFuncSeparate = glad_glStencilFuncSeparate;
+	context->StencilMask = glad_glStencilMask;
+	context->StencilMaskSeparate = glad_glStencilMaskSeparate;
+	context->StencilOp = glad_glStencilOp;
+	context->StencilOpSeparate = glad_glStencilOpSeparate;
+	context->TexBuffer = glad_glTexBuffer;
+	context->TexBufferRange = glad_glTexBufferRange;
+	context->TexCoord1d = glad_glTexCoord1d;
+	context->TexCoord1dv = glad_glTexCoord1dv;
+	context->TexCoord1f = glad_glTexCoord1f;
+	context->TexCoord1fv = glad_glTexCoord1fv;
+	context->TexCoord1i = glad_glTexCoord1i;
+	context->TexCoord1iv = glad_glTexCoord1iv;
+	context->TexCoord1s = glad_glTexCoord1s;
+	context->TexCoord1sv = glad_glTexCoord1sv;
+	context->TexCoord2d = glad_glTexCoord2d;
+	context->TexCoord2dv = glad_glTexCoord2dv;
+	context->TexCoord2f = glad_glTexCoord2f;
+	context->TexCoord2fv = glad_glTexCoord2fv;
+	context->TexCoord2i = glad_glTexCoord2i;
+	context->TexCoord2iv = glad_glTexCoord2iv;
+	context->TexCoord2s = glad_glTexCoord2s;
+	context->TexCoord2sv = glad_glTexCoord2sv;
+	context->TexCoord3d = glad_glTexCoord3d;
+	context->TexCoord3dv = glad_glTexCoord3dv;
+	context->TexCoord3f = glad_glTexCoord3f;
+	context->TexCoord3fv = glad_glTexCoord3fv;
+	context->TexCoord3i = glad_glTexCoord3i;
+	context->TexCoord3iv = glad_glTexCoord3iv;
+	context->TexCoord3s = glad_glTexCoord3s;
+	context->TexCoord3sv = glad_glTexCoord3sv;
+	context->TexCoord4d = glad_glTexCoord4d;
+	context->TexCoord4dv = glad_glTexCoord4dv;
+	context->TexCoord4f = glad_glTexCoord4f;
+	context->TexCoord4fv = glad_glTexCoord4fv;
+	context->TexCoord4i = glad_glTexCoord4i;
+	context->TexCoord4iv = glad_glTexCoord4iv;
+	context->TexCoord4s = glad_glTexCoord4s;
+	context->TexCoord4sv = glad_glTexCoord4sv;
+	context->TexCoordP1ui = glad_glTexCoordP1ui;
+	context->TexCoordP1uiv = glad_glTexCoordP1uiv;
+	context->TexCoordP2ui = glad_glTexCoordP2ui;
+	context->TexCoordP2uiv = glad_glTexCoordP2uiv;
+	context->TexCoordP3ui = glad_glTexCoordP3ui;
+	context->TexCoordP3uiv = glad_glTexCoordP3uiv;
+	context->TexCoordP4ui = glad_glTexCoordP4ui;
+	context->TexCoordP4uiv = glad_glTexCoordP4uiv;
+	context->TexCoordPointer = glad_glTexCoordPointer;
+	context->TexEnvf = glad_glTexEnvf;
+	context->TexEnvfv = glad_glTexEnvfv;
+	context->TexEnvi = glad_glTexEnvi;
+	context->TexEnviv = glad_glTexEnviv;
+	context->TexGend = glad_glTexGend;
+	context->TexGendv = glad_glTexGendv;
+	context->TexGenf = glad_glTexGenf;
+	context->TexGenfv = glad_glTexGenfv;
+	context->TexGeni = glad_glTexGeni;
+	context->TexGeniv = glad_glTexGeniv;
+	context->TexImage1D = glad_glTexImage1D;
+	context->TexImage2D = glad_glTexImage2D;
+	context->TexImage2DMultisample = glad_glTexImage2DMultisample;
+	context->TexImage3D = glad_glTexImage3D;
+	context->TexImage3DMultisample = glad_glTexImage3DMultisample;
+	context->TexParameterIiv = glad_glTexParameterIiv;
+	context->TexParameterIuiv = glad_glTexParameterIuiv;
+	context->TexParameterf = glad_glTexParameterf;
+	context->TexParameterfv = glad_glTexParameterfv;
+	context->TexParameteri = glad_glTexParameteri;
+	context->TexParameteriv = glad_glTexParameteriv;
+	context->TexStorage1D = glad_glTexStorage1D;
+	context->TexStorage2D = glad_glTexStorage2D;
+	context->TexStorage2DMultisample = glad_glTexStorage2DMultisample;
+	context->TexStorage3D = glad_glTexStorage3D;
+	context->TexStorage3DMultisample = glad_glTexStorage3DMultisample;
+	context->TexSubImage1D = glad_glTexSubImage1D;
+	context->TexSubImage2D = glad_glTexSubImage2D;
+	context->TexSubImage3D = glad_glTexSubImage3D;
+	context->TextureBarrier = glad_glTextureBarrier;
+	context->TextureBuffer = glad_glTextureBuffer;
+	context->TextureBufferRange = glad_glTextureBufferRange;
+	context->TextureParameterIiv = glad_glTextureParameterIiv;
+	context->TextureParameterIuiv = glad_glTextureParameterIuiv;
+	context->TextureParameterf = glad_glTextureParameterf;
+	context->TextureParameterfv = glad_glTextureParameterfv;
+	context->TextureParameteri = glad_glTextureParameteri;
+	context->TextureParameteriv = glad_glTextureParameteriv;
+	context->TextureStorage1D = glad_glTextureStorage1D;
+	context->TextureStorage2D = glad_glTextureStorage2D;
+	context->TextureStorage2DMultisample = glad_glTextureStorage2DMultisample;
+	context->TextureStorage3D = glad_glTextureStorage3D;
+	context->TextureStorage3DMultisample = glad_glTextureStorage3DMultisample;
+	context->TextureSubImage1D = glad_glTextureSubImage1D;
+	context->TextureSubImage2D = glad_glTextureSubImage2D;
+	context->TextureSubImage3D = glad_glTextureSubImage3D;
+	context->TextureView = glad_glTextureView;
+	context->TransformFeedbackBufferBase = glad_glTransformFeedbackBufferBase;
+	context->TransformFeedbackBufferRange = glad_glTransformFeedbackBufferRange;
+	context->TransformFeedbackVaryings = glad_glTransformFeedbackVaryings;
+	context->Translated = glad_glTranslated;
+	context->Translatef = glad_glTranslatef;
+	context->Uniform1d = glad_glUniform1d;
+	context->Uniform1dv = glad_glUniform1dv;
+	context->Uniform1f = glad_glUniform1f;
+	context->Uniform1fv = glad_glUniform1fv;
+	context->Uniform1i = glad_glUniform1i;
+	context->Uniform1iv = glad_glUniform1iv;
+	context->Uniform1ui = glad_glUniform1ui;
+	context->Uniform1uiv = glad_glUniform1uiv;
+	context->Uniform2d = glad_glUniform2d;
+	context->Uniform2dv = glad_glUniform2dv;
+	context->Uniform2f = glad_glUniform2f;
+	context->Uniform2fv = glad_glUniform2fv;
+	context->Uniform2i = glad_glUniform2i;
+	context->Uniform2iv = glad_glUniform2iv;
+	context->Uniform2ui = glad_glUniform2ui;
+	context->Uniform2uiv = glad_glUniform2uiv;
+	context->Uniform3d = glad_glUniform3d;
+	context->Uniform3dv = glad_glUniform3dv;
+	context->Uniform3f = glad_glUniform3f;
+	context->Uniform3fv = glad_glUniform3fv;
+	context->Uniform3i = glad_glUniform3i;
+	context->Uniform3iv = glad_glUniform3iv;
+	context->Uniform3ui = glad_glUniform3ui;
+	context->Uniform3uiv = glad_glUniform3uiv;
+	context->Uniform4d = glad_glUniform4d;
+	context->Uniform4dv = glad_glUniform4dv;
+	context->Uniform4f = glad_glUniform4f;
+	context->Uniform4fv = glad_glUniform4fv;
+	context->Uniform4i = glad_glUniform4i;
+	context->Uniform4iv = glad_glUniform4iv;
+	context->Uniform4ui = glad_glUniform4ui;
+	context->Uniform4uiv = glad_glUniform4uiv;
+	context->UniformBlockBinding = glad_glUniformBlockBinding;
+	context->UniformHandleui64ARB = glad_glUniformHandleui64ARB;
+	context->UniformHandleui64vARB = glad_glUniformHandleui64vARB;
+	context->UniformMatrix2dv = glad_glUniformMatrix2dv;
+	context->UniformMatrix2fv = glad_glUniformMatrix2fv;
+	context->UniformMatrix2x3dv = glad_glUniformMatrix2x3dv;
+	context->UniformMatrix2x3fv = glad_glUniformMatrix2x3fv;
+	context->UniformMatrix2x4dv = glad_glUniformMatrix2x4dv;
+	context->UniformMatrix2x4fv = glad_glUniformMatrix2x4fv;
+	context->UniformMatrix3dv = glad_glUniformMatrix3dv;
+	context->UniformMatrix3fv = glad_glUniformMatrix3fv;
+	context->UniformMatrix3x2dv = glad_glUniformMatrix3x2dv;
+	context->UniformMatrix3x2fv = glad_glUniformMatrix3x2fv;
+	context->UniformMatrix3x4dv = glad_glUniformMatrix3x4dv;
+	context->UniformMatrix3x4fv = glad_glUniformMatrix3x4fv;
+	context->UniformMatrix4dv = glad_glUniformMatrix4dv;
+	context->UniformMatrix4fv = glad_glUniformMatrix4fv;
+	context->UniformMatrix4x2dv = glad_glUniformMatrix4x2dv;
+	context->UniformMatrix4x2fv = glad_glUniformMatrix4x2fv;
+	context->UniformMatrix4x3dv = glad_glUniformMatrix4x3dv;
+	context->UniformMatrix4x3fv = glad_glUniformMatrix4x3fv;
+	context->UniformSubroutinesuiv = glad_glUniformSubroutinesuiv;
+	context->UnmapBuffer = glad_glUnmapBuffer;
+	context->UnmapNamedBuffer = glad_glUnmapNamedBuffer;
+	context->UseProgram = glad_glUseProgram;
+	context->UseProgramStages = glad_glUseProgramStages;
+	context->ValidateProgram = glad_glValidateProgram;
+	context->ValidateProgramPipeline = glad_glValidateProgramPipeline;
+	context->Vertex2d = glad_glVertex2d;
+	context->Vertex2dv = glad_glVertex2dv;
+	context->Vertex2f = glad_glVertex2f;
+	context->Vertex2fv = glad_glVertex2fv;
+	context->Vertex2i = glad_glVertex2i;
+	context->Vertex2iv = glad_glVertex2iv;
+	context->Vertex2s = glad_glVertex2s;
+	context->Vertex2sv = glad_glVertex2sv;
+	context->Vertex3d = glad_glVertex3d;
+	context->Vertex3dv = glad_glVertex3dv;
+	context->Vertex3f = glad_glVertex3f;
+	context->Vertex3fv = glad_glVertex3fv;
+	context->Vertex3i = glad_glVertex3i;
+	context->Vertex3iv = glad_glVertex3iv;
+	context->Vertex3s = glad_glVertex3s;
+	context->Vertex3sv = glad_glVertex3sv;
+	context->Vertex4d = glad_glVertex4d;
+	context->Vertex4dv = glad_glVertex4dv;
+	context->Vertex4f = glad_glVertex4f;
+	context->Vertex4fv = glad_glVertex4fv;
+	context->Vertex4i = glad_glVertex4i;
+	context->Vertex4iv = glad_glVertex4iv;
+	context->Vertex4s = glad_glVertex4s;
+	context->Vertex4sv = glad_glVertex4sv;
+	context->VertexArrayAttribBinding = glad_glVertexArrayAttribBinding;
+	context->VertexArrayAttribFormat = glad_glVertexArrayAttribFormat;
+	context->VertexArrayAttribIFormat = glad_glVertexArrayAttribIFormat;
+	context->VertexArrayAttribLFormat = glad_glVertexArrayAttribLFormat;
+	context->VertexArrayBindingDivisor = glad_glVertexArrayBindingDivisor;
+	context->VertexArrayElementBuffer = glad_glVertexArrayElementBuffer;
+	context->VertexArrayVertexBuffer = glad_glVertexArrayVertexBuffer;
+	context->VertexArrayVertexBuffers = glad_glVertexArrayVertexBuffers;
+	context->VertexAttrib1d = glad_glVertexAttrib1d;
+	context->VertexAttrib1dv = glad_glVertexAttrib1dv;
+	context->VertexAttrib1f = glad_glVertexAttrib1f;
+	context->VertexAttrib1fv = glad_glVertexAttrib1fv;
+	context->VertexAttrib1s = glad_glVertexAttrib1s;
+	context->VertexAttrib1sv = glad_glVertexAttrib1sv;
+	context->VertexAttrib2d = glad_glVertexAttrib2d;
+	context->VertexAttrib2dv = glad_glVertexAttrib2dv;
+	context->VertexAttrib2f = glad_glVertexAttrib2f;
+	context->VertexAttrib2fv = glad_glVertexAttrib2fv;
+	context->VertexAttrib2s = glad_glVertexAttrib2s;
+	context->VertexAttrib2sv = glad_glVertexAttrib2sv;
+	context->VertexAttrib3d = glad_glVertexAttrib3d;
+	context->VertexAttrib3dv = glad_glVertexAttrib3dv;
+	context->VertexAttrib3f = glad_glVertexAttrib3f;
+	context->VertexAttrib3fv = glad_glVertexAttrib3fv;
+	context->VertexAttrib3s = glad_glVertexAttrib3s;
+	context->VertexAttrib3sv = glad_glVertexAttrib3sv;
+	context->VertexAttrib4Nbv = glad_glVertexAttrib4Nbv;
+	context->VertexAttrib4Niv = glad_glVertexAttrib4Niv;
+	context->VertexAttrib4Nsv = glad_glVertexAttrib4Nsv;
+	context->VertexAttrib4Nub = glad_glVertexAttrib4Nub;
+	context->VertexAttrib4Nubv = glad_glVertexAttrib4Nubv;
+	context->VertexAttrib4Nuiv = glad_glVertexAttrib4Nuiv;
+	context->VertexAttrib4Nusv = glad_glVertexAttrib4Nusv;
+	context->VertexAttrib4bv = glad_glVertexAttrib4bv;
+	context->VertexAttrib4d = glad_glVertexAttrib4d;
+	context->VertexAttrib4dv = glad_glVertexAttrib4dv;
+	context->VertexAttrib4f = glad_glVertexAttrib4f;
+	context->VertexAttrib4fv = glad_glVertexAttrib4fv;
+	context->VertexAttrib4iv = glad_glVertexAttrib4iv;
+	context->VertexAttrib4s = glad_glVertexAttrib4s;
+	context->VertexAttrib4sv = glad_glVertexAttrib4sv;
+	context->VertexAttrib4ubv = glad_glVertexAttrib4ubv;
+	context->VertexAttrib4uiv = glad_glVertexAttrib4uiv;
+	context->VertexAttrib4usv = glad_glVertexAttrib4usv;
+	context->VertexAttribBinding = glad_glVertexAttribBinding;
+	context->VertexAttribDivisor = glad_glVertexAttribDivisor;
+	context->VertexAttribFormat = glad_glVertexAttribFormat;
+	context->VertexAttribI1i = glad_glVertexAttribI1i;
+	context->VertexAttribI1iv = glad_glVertexAttribI1iv;
+	context->VertexAttribI1ui = glad_glVertexAttribI1ui;
+	context->VertexAttribI1uiv = glad_glVertexAttribI1uiv;
+	context->VertexAttribI2i = glad_glVertexAttribI2i;
+	context->VertexAttribI2iv = glad_glVertexAttribI2iv;
+	context->VertexAttribI2ui = glad_glVertexAttribI2ui;
+	context->VertexAttribI2uiv = glad_glVertexAttribI2uiv;
+	context->VertexAttribI3i = glad_glVertexAttribI3i;
+	context->VertexAttribI3iv = glad_glVertexAttribI3iv;
+	context->VertexAttribI3ui = glad_glVertexAttribI3ui;
+	context->VertexAttribI3uiv = glad_glVertexAttribI3uiv;
+	context->VertexAttribI4bv = glad_glVertexAttribI4bv;
+	context->VertexAttribI4i = glad_glVertexAttribI4i;
+	context->VertexAttribI4iv = glad_glVertexAttribI4iv;
+	context->VertexAttribI4sv = glad_glVertexAttribI4sv;
+	context->VertexAttribI4ubv = glad_glVertexAttribI4ubv;
+	context->VertexAttribI4ui = glad_glVertexAttribI4ui;
+	context->VertexAttribI4uiv = glad_glVertexAttribI4uiv;
+	context->VertexAttribI4usv = glad_glVertexAttribI4usv;
+	context->VertexAttribIFormat = glad_glVertexAttribIFormat;
+	context->VertexAttribIPointer = glad_glVertexAttribIPointer;
+	context->VertexAttribL1d = glad_glVertexAttribL1d;
+	context->VertexAttribL1dv = glad_glVertexAttribL1dv;
+	context->VertexAttribL1ui64ARB = glad_glVertexAttribL1ui64ARB;
+	context->VertexAttribL1ui64vARB = glad_glVertexAttribL1ui64vARB;
+	context->VertexAttribL2d = glad_glVertexAttribL2d;
+	context->VertexAttribL2dv = glad_glVertexAttribL2dv;
+	context->VertexAttribL3d = glad_glVertexAttribL3d;
+	context->VertexAttribL3dv = glad_glVertexAttribL3dv;
+	context->VertexAttribL4d = glad_glVertexAttribL4d;
+	context->VertexAttribL4dv = glad_glVertexAttribL4dv;
+	context->VertexAttribLFormat = glad_glVertexAttribLFormat;
+	context->VertexAttribLPointer = glad_glVertexAttribLPointer;
+	context->VertexAttribP1ui = glad_glVertexAttribP1ui;
+	context->VertexAttribP1uiv = glad_glVertexAttribP1uiv;
+	context->VertexAttribP2ui = glad_glVertexAttribP2ui;
+	context->VertexAttribP2uiv = glad_glVertexAttribP2uiv;
+	context->VertexAttribP3ui = glad_glVertexAttribP3ui;
+	context->VertexAttribP3uiv = glad_glVertexAttribP3uiv;
+	context->VertexAttribP4ui = glad_glVertexAttribP4ui;
+	context->VertexAttribP4uiv = glad_glVertexAttribP4uiv;
+	context->VertexAttribPointer = glad_glVertexAttribPointer;
+	context->VertexBindingDivisor = glad_glVertexBindingDivisor;
+	context->VertexP2ui = glad_glVertexP2ui;
+	context->VertexP2uiv = glad_glVertexP2uiv;
+	context->VertexP3ui = glad_glVertexP3ui;
+	context->VertexP3uiv = glad_glVertexP3uiv;
+	context->VertexP4ui = glad_glVertexP4ui;
+	context->VertexP4uiv = glad_glVertexP4uiv;
+	context->VertexPointer = glad_glVertexPointer;
+	context->Viewport = glad_glViewport;
+	context->ViewportArrayv = glad_glViewportArrayv;
+	context->ViewportIndexedf = glad_glViewportIndexedf;
+	context->ViewportIndexedfv = glad_glViewportIndexedfv;
+	context->WaitSync = glad_glWaitSync;
+	context->WindowPos2d = glad_glWindowPos2d;
+	context->WindowPos2dv = glad_glWindowPos2dv;
+	context->WindowPos2f = glad_glWindowPos2f;
+	context->WindowPos2fv = glad_glWindowPos2fv;
+	context->WindowPos2i = glad_glWindowPos2i;
+	context->WindowPos2iv = glad_glWindowPos2iv;
+	context->WindowPos2s = glad_glWindowPos2s;
+	context->WindowPos2sv = glad_glWindowPos2sv;
+	context->WindowPos3d = glad_glWindowPos3d;
+	context->WindowPos3dv = glad_glWindowPos3dv;
+	context->WindowPos3f = glad_glWindowPos3f;
+	context->WindowPos3fv = glad_glWindowPos3fv;
+	context->WindowPos3i = glad_glWindowPos3i;
+	context->WindowPos3iv = glad_glWindowPos3iv;
+	context->WindowPos3s = glad_glWindowPos3s;
+	context->WindowPos3sv = glad_glWindowPos3sv;
+	return status;
+}
+
+void gladMakeContextCurrent(struct GladGLContext* context) {
+	gladCurrentContext = context;
+}
+
+struct GladGLContext* gladGetCurrentContext(void) {
+	return gladCurrentContext;
+}
+
+#endif /* GLAD_MULTI_CONTEXT */
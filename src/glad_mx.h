@@ -0,0 +1,3342 @@
+/*
+
+    Multi-context dispatch for the OpenGL loader generated by glad 0.1.34.
+
+    APIs: gl=4.6
+    Extensions: GL_ARB_bindless_texture,GL_ARB_buffer_storage,GL_ARB_direct_state_access,GL_ARB_gl_spirv,GL_ARB_invalidate_subdata,GL_ARB_multi_draw_indirect,GL_ATI_meminfo,GL_KHR_debug,GL_KHR_parallel_shader_compile,GL_NVX_gpu_memory_info
+
+    Generated by tools/gen_gl_layers.py from the function list of src/glad.c, do not edit. After regenerating the loader:
+        python tools/gen_gl_layers.py
+    Only used when GLAD_MULTI_CONTEXT is defined, see gl_api.h.
+*/
+
+#ifndef __glad_mx_h_
+#define __glad_mx_h_
+
+#ifdef GLAD_MULTI_CONTEXT
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__cplusplus)
+#define GLAD_THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+#define GLAD_THREAD_LOCAL __declspec(thread)
+#else
+#define GLAD_THREAD_LOCAL _Thread_local
+#endif
+
+struct GladGLContext {
+	int major;
+	int minor;
+	int VERSION_1_0;
+	int VERSION_1_1;
+	int VERSION_1_2;
+	int VERSION_1_3;
+	int VERSION_1_4;
+	int VERSION_1_5;
+	int VERSION_2_0;
+	int VERSION_2_1;
+	int VERSION_3_0;
+	int VERSION_3_1;
+	int VERSION_3_2;
+	int VERSION_3_3;
+	int VERSION_4_0;
+	int VERSION_4_1;
+	int VERSION_4_2;
+	int VERSION_4_3;
+	int VERSION_4_4;
+	int VERSION_4_5;
+	int VERSION_4_6;
+	int ARB_bindless_texture;
+	int ARB_buffer_storage;
+	int ARB_direct_state_access;
+	int ARB_gl_spirv;
+	int ARB_invalidate_subdata;
+	int ARB_multi_draw_indirect;
+	int ATI_meminfo;
+	int KHR_debug;
+	int KHR_parallel_shader_compile;
+	int NVX_gpu_memory_info;
+	PFNGLACCUMPROC Accum;
+	PFNGLACTIVESHADERPROGRAMPROC ActiveShaderProgram;
+	PFNGLACTIVETEXTUREPROC ActiveTexture;
+	PFNGLALPHAFUNCPROC AlphaFunc;
+	PFNGLARETEXTURESRESIDENTPROC AreTexturesResident;
+	PFNGLARRAYELEMENTPROC ArrayElement;
+	PFNGLATTACHSHADERPROC AttachShader;
+	PFNGLBEGINPROC Begin;
+	PFNGLBEGINCONDITIONALRENDERPROC BeginConditionalRender;
+	PFNGLBEGINQUERYPROC BeginQuery;
+	PFNGLBEGINQUERYINDEXEDPROC BeginQueryIndexed;
+	PFNGLBEGINTRANSFORMFEEDBACKPROC BeginTransformFeedback;
+	PFNGLBINDATTRIBLOCATIONPROC BindAttribLocation;
+	PFNGLBINDBUFFERPROC BindBuffer;
+	PFNGLBINDBUFFERBASEPROC BindBufferBase;
+	PFNGLBINDBUFFERRANGEPROC BindBufferRange;
+	PFNGLBINDBUFFERSBASEPROC BindBuffersBase;
+	PFNGLBINDBUFFERSRANGEPROC BindBuffersRange;
+	PFNGLBINDFRAGDATALOCATIONPROC BindFragDataLocation;
+	PFNGLBINDFRAGDATALOCATIONINDEXEDPROC BindFragDataLocationIndexed;
+	PFNGLBINDFRAMEBUFFERPROC BindFramebuffer;
+	PFNGLBINDIMAGETEXTUREPROC BindImageTexture;
+	PFNGLBINDIMAGETEXTURESPROC BindImageTextures;
+	PFNGLBINDPROGRAMPIPELINEPROC BindProgramPipeline;
+	PFNGLBINDRENDERBUFFERPROC BindRenderbuffer;
+	PFNGLBINDSAMPLERPROC BindSampler;
+	PFNGLBINDSAMPLERSPROC BindSamplers;
+	PFNGLBINDTEXTUREPROC BindTexture;
+	PFNGLBINDTEXTUREUNITPROC BindTextureUnit;
+	PFNGLBINDTEXTURESPROC BindTextures;
+	PFNGLBINDTRANSFORMFEEDBACKPROC BindTransformFeedback;
+	PFNGLBINDVERTEXARRAYPROC BindVertexArray;
+	PFNGLBINDVERTEXBUFFERPROC BindVertexBuffer;
+	PFNGLBINDVERTEXBUFFERSPROC BindVertexBuffers;
+	PFNGLBITMAPPROC Bitmap;
+	PFNGLBLENDCOLORPROC BlendColor;
+	PFNGLBLENDEQUATIONPROC BlendEquation;
+	PFNGLBLENDEQUATIONSEPARATEPROC BlendEquationSeparate;
+	PFNGLBLENDEQUATIONSEPARATEIPROC BlendEquationSeparatei;
+	PFNGLBLENDEQUATIONIPROC BlendEquationi;
+	PFNGLBLENDFUNCPROC BlendFunc;
+	PFNGLBLENDFUNCSEPARATEPROC BlendFuncSeparate;
+	PFNGLBLENDFUNCSEPARATEIPROC BlendFuncSeparatei;
+	PFNGLBLENDFUNCIPROC BlendFunci;
+	PFNGLBLITFRAMEBUFFERPROC BlitFramebuffer;
+	PFNGLBLITNAMEDFRAMEBUFFERPROC BlitNamedFramebuffer;
+	PFNGLBUFFERDATAPROC BufferData;
+	PFNGLBUFFERSTORAGEPROC BufferStorage;
+	PFNGLBUFFERSUBDATAPROC BufferSubData;
+	PFNGLCALLLISTPROC CallList;
+	PFNGLCALLLISTSPROC CallLists;
+	PFNGLCHECKFRAMEBUFFERSTATUSPROC CheckFramebufferStatus;
+	PFNGLCHECKNAMEDFRAMEBUFFERSTATUSPROC CheckNamedFramebufferStatus;
+	PFNGLCLAMPCOLORPROC ClampColor;
+	PFNGLCLEARPROC Clear;
+	PFNGLCLEARACCUMPROC ClearAccum;
+	PFNGLCLEARBUFFERDATAPROC ClearBufferData;
+	PFNGLCLEARBUFFERSUBDATAPROC ClearBufferSubData;
+	PFNGLCLEARBUFFERFIPROC ClearBufferfi;
+	PFNGLCLEARBUFFERFVPROC ClearBufferfv;
+	PFNGLCLEARBUFFERIVPROC ClearBufferiv;
+	PFNGLCLEARBUFFERUIVPROC ClearBufferuiv;
+	PFNGLCLEARCOLORPROC ClearColor;
+	PFNGLCLEARDEPTHPROC ClearDepth;
+	PFNGLCLEARDEPTHFPROC ClearDepthf;
+	PFNGLCLEARINDEXPROC ClearIndex;
+	PFNGLCLEARNAMEDBUFFERDATAPROC ClearNamedBufferData;
+	PFNGLCLEARNAMEDBUFFERSUBDATAPROC ClearNamedBufferSubData;
+	PFNGLCLEARNAMEDFRAMEBUFFERFIPROC ClearNamedFramebufferfi;
+	PFNGLCLEARNAMEDFRAMEBUFFERFVPROC ClearNamedFramebufferfv;
+	PFNGLCLEARNAMEDFRAMEBUFFERIVPROC ClearNamedFramebufferiv;
+	PFNGLCLEARNAMEDFRAMEBUFFERUIVPROC ClearNamedFramebufferuiv;
+	PFNGLCLEARSTENCILPROC ClearStencil;
+	PFNGLCLEARTEXIMAGEPROC ClearTexImage;
+	PFNGLCLEARTEXSUBIMAGEPROC ClearTexSubImage;
+	PFNGLCLIENTACTIVETEXTUREPROC ClientActiveTexture;
+	PFNGLCLIENTWAITSYNCPROC ClientWaitSync;
+	PFNGLCLIPCONTROLPROC ClipControl;
+	PFNGLCLIPPLANEPROC ClipPlane;
+	PFNGLCOLOR3BPROC Color3b;
+	PFNGLCOLOR3BVPROC Color3bv;
+	PFNGLCOLOR3DPROC Color3d;
+	PFNGLCOLOR3DVPROC Color3dv;
+	PFNGLCOLOR3FPROC Color3f;
+	PFNGLCOLOR3FVPROC Color3fv;
+	PFNGLCOLOR3IPROC Color3i;
+	PFNGLCOLOR3IVPROC Color3iv;
+	PFNGLCOLOR3SPROC Color3s;
+	PFNGLCOLOR3SVPROC Color3sv;
+	PFNGLCOLOR3UBPROC Color3ub;
+	PFNGLCOLOR3UBVPROC Color3ubv;
+	PFNGLCOLOR3UIPROC Color3ui;
+	PFNGLCOLOR3UIVPROC Color3uiv;
+	PFNGLCOLOR3USPROC Color3us;
+	PFNGLCOLOR3USVPROC Color3usv;
+	PFNGLCOLOR4BPROC Color4b;
+	PFNGLCOLOR4BVPROC Color4bv;
+	PFNGLCOLOR4DPROC Color4d;
+	PFNGLCOLOR4DVPROC Color4dv;
+	PFNGLCOLOR4FPROC Color4f;
+	PFNGLCOLOR4FVPROC Color4fv;
+	PFNGLCOLOR4IPROC Color4i;
+	PFNGLCOLOR4IVPROC Color4iv;
+	PFNGLCOLOR4SPROC Color4s;
+	PFNGLCOLOR4SVPROC Color4sv;
+	PFNGLCOLOR4UBPROC Color4ub;
+	PFNGLCOLOR4UBVPROC Color4ubv;
+	PFNGLCOLOR4UIPROC Color4ui;
+	PFNGLCOLOR4UIVPROC Color4uiv;
+	PFNGLCOLOR4USPROC Color4us;
+	PFNGLCOLOR4USVPROC Color4usv;
+	PFNGLCOLORMASKPROC ColorMask;
+	PFNGLCOLORMASKIPROC ColorMaski;
+	PFNGLCOLORMATERIALPROC ColorMaterial;
+	PFNGLCOLORP3UIPROC ColorP3ui;
+	PFNGLCOLORP3UIVPROC ColorP3uiv;
+	PFNGLCOLORP4UIPROC ColorP4ui;
+	PFNGLCOLORP4UIVPROC ColorP4uiv;
+	PFNGLCOLORPOINTERPROC ColorPointer;
+	PFNGLCOMPILESHADERPROC CompileShader;
+	PFNGLCOMPRESSEDTEXIMAGE1DPROC CompressedTexImage1D;
+	PFNGLCOMPRESSEDTEXIMAGE2DPROC CompressedTexImage2D;
+	PFNGLCOMPRESSEDTEXIMAGE3DPROC CompressedTexImage3D;
+	PFNGLCOMPRESSEDTEXSUBIMAGE1DPROC CompressedTexSubImage1D;
+	PFNGLCOMPRESSEDTEXSUBIMAGE2DPROC CompressedTexSubImage2D;
+	PFNGLCOMPRESSEDTEXSUBIMAGE3DPROC CompressedTexSubImage3D;
+	PFNGLCOMPRESSEDTEXTURESUBIMAGE1DPROC CompressedTextureSubImage1D;
+	PFNGLCOMPRESSEDTEXTURESUBIMAGE2DPROC CompressedTextureSubImage2D;
+	PFNGLCOMPRESSEDTEXTURESUBIMAGE3DPROC CompressedTextureSubImage3D;
+	PFNGLCOPYBUFFERSUBDATAPROC CopyBufferSubData;
+	PFNGLCOPYIMAGESUBDATAPROC CopyImageSubData;
+	PFNGLCOPYNAMEDBUFFERSUBDATAPROC CopyNamedBufferSubData;
+	PFNGLCOPYPIXELSPROC CopyPixels;
+	PFNGLCOPYTEXIMAGE1DPROC CopyTexImage1D;
+	PFNGLCOPYTEXIMAGE2DPROC CopyTexImage2D;
+	PFNGLCOPYTEXSUBIMAGE1DPROC CopyTexSubImage1D;
+	PFNGLCOPYTEXSUBIMAGE2DPROC CopyTexSubImage2D;
+	PFNGLCOPYTEXSUBIMAGE3DPROC CopyTexSubImage3D;
+	PFNGLCOPYTEXTURESUBIMAGE1DPROC CopyTextureSubImage1D;
+	PFNGLCOPYTEXTURESUBIMAGE2DPROC CopyTextureSubImage2D;
+	PFNGLCOPYTEXTURESUBIMAGE3DPROC CopyTextureSubImage3D;
+	PFNGLCREATEBUFFERSPROC CreateBuffers;
+	PFNGLCREATEFRAMEBUFFERSPROC CreateFramebuffers;
+	PFNGLCREATEPROGRAMPROC CreateProgram;
+	PFNGLCREATEPROGRAMPIPELINESPROC CreateProgramPipelines;
+	PFNGLCREATEQUERIESPROC CreateQueries;
+	PFNGLCREATERENDERBUFFERSPROC CreateRenderbuffers;
+	PFNGLCREATESAMPLERSPROC CreateSamplers;
+	PFNGLCREATESHADERPROC CreateShader;
+	PFNGLCREATESHADERPROGRAMVPROC CreateShaderProgramv;
+	PFNGLCREATETEXTURESPROC CreateTextures;
+	PFNGLCREATETRANSFORMFEEDBACKSPROC CreateTransformFeedbacks;
+	PFNGLCREATEVERTEXARRAYSPROC CreateVertexArrays;
+	PFNGLCULLFACEPROC CullFace;
+	PFNGLDEBUGMESSAGECALLBACKPROC DebugMessageCallback;
+	PFNGLDEBUGMESSAGECONTROLPROC DebugMessageControl;
+	PFNGLDEBUGMESSAGEINSERTPROC DebugMessageInsert;
+	PFNGLDELETEBUFFERSPROC DeleteBuffers;
+	PFNGLDELETEFRAMEBUFFERSPROC DeleteFramebuffers;
+	PFNGLDELETELISTSPROC DeleteLists;
+	PFNGLDELETEPROGRAMPROC DeleteProgram;
+	PFNGLDELETEPROGRAMPIPELINESPROC DeleteProgramPipelines;
+	PFNGLDELETEQUERIESPROC DeleteQueries;
+	PFNGLDELETERENDERBUFFERSPROC DeleteRenderbuffers;
+	PFNGLDELETESAMPLERSPROC DeleteSamplers;
+	PFNGLDELETESHADERPROC DeleteShader;
+	PFNGLDELETESYNCPROC DeleteSync;
+	PFNGLDELETETEXTURESPROC DeleteTextures;
+	PFNGLDELETETRANSFORMFEEDBACKSPROC DeleteTransformFeedbacks;
+	PFNGLDELETEVERTEXARRAYSPROC DeleteVertexArrays;
+	PFNGLDEPTHFUNCPROC DepthFunc;
+	PFNGLDEPTHMASKPROC DepthMask;
+	PFNGLDEPTHRANGEPROC DepthRange;
+	PFNGLDEPTHRANGEARRAYVPROC DepthRangeArrayv;
+	PFNGLDEPTHRANGEINDEXEDPROC DepthRangeIndexed;
+	PFNGLDEPTHRANGEFPROC DepthRangef;
+	PFNGLDETACHSHADERPROC DetachShader;
+	PFNGLDISABLEPROC Disable;
+	PFNGLDISABLECLIENTSTATEPROC DisableClientState;
+	PFNGLDISABLEVERTEXARRAYATTRIBPROC DisableVertexArrayAttrib;
+	PFNGLDISABLEVERTEXATTRIBARRAYPROC DisableVertexAttribArray;
+	PFNGLDISABLEIPROC Disablei;
+	PFNGLDISPATCHCOMPUTEPROC DispatchCompute;
+	PFNGLDISPATCHCOMPUTEINDIRECTPROC DispatchComputeIndirect;
+	PFNGLDRAWARRAYSPROC DrawArrays;
+	PFNGLDRAWARRAYSINDIRECTPROC DrawArraysIndirect;
+	PFNGLDRAWARRAYSINSTANCEDPROC DrawArraysInstanced;
+	PFNGLDRAWARRAYSINSTANCEDBASEINSTANCEPROC DrawArraysInstancedBaseInstance;
+	PFNGLDRAWBUFFERPROC DrawBuffer;
+	PFNGLDRAWBUFFERSPROC DrawBuffers;
+	PFNGLDRAWELEMENTSPROC DrawElements;
+	PFNGLDRAWELEMENTSBASEVERTEXPROC DrawElementsBaseVertex;
+	PFNGLDRAWELEMENTSINDIRECTPROC DrawElementsIndirect;
+	PFNGLDRAWELEMENTSINSTANCEDPROC DrawElementsInstanced;
+	PFNGLDRAWELEMENTSINSTANCEDBASEINSTANCEPROC DrawElementsInstancedBaseInstance;
+	PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXPROC DrawElementsInstancedBaseVertex;
+	PFNGLDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEPROC DrawElementsInstancedBaseVertexBaseInstance;
+	PFNGLDRAWPIXELSPROC DrawPixels;
+	PFNGLDRAWRANGEELEMENTSPROC DrawRangeElements;
+	PFNGLDRAWRANGEELEMENTSBASEVERTEXPROC DrawRangeElementsBaseVertex;
+	PFNGLDRAWTRANSFORMFEEDBACKPROC DrawTransformFeedback;
+	PFNGLDRAWTRANSFORMFEEDBACKINSTANCEDPROC DrawTransformFeedbackInstanced;
+	PFNGLDRAWTRANSFORMFEEDBACKSTREAMPROC DrawTransformFeedbackStream;
+	PFNGLDRAWTRANSFORMFEEDBACKSTREAMINSTANCEDPROC DrawTransformFeedbackStreamInstanced;
+	PFNGLEDGEFLAGPROC EdgeFlag;
+	PFNGLEDGEFLAGPOINTERPROC EdgeFlagPointer;
+	PFNGLEDGEFLAGVPROC EdgeFlagv;
+	PFNGLENABLEPROC Enable;
+	PFNGLENABLECLIENTSTATEPROC EnableClientState;
+	PFNGLENABLEVERTEXARRAYATTRIBPROC EnableVertexArrayAttrib;
+	PFNGLENABLEVERTEXATTRIBARRAYPROC EnableVertexAttribArray;
+	PFNGLENABLEIPROC Enablei;
+	PFNGLENDPROC End;
+	PFNGLENDCONDITIONALRENDERPROC EndConditionalRender;
+	PFNGLENDLISTPROC EndList;
+	PFNGLENDQUERYPROC EndQuery;
+	PFNGLENDQUERYINDEXEDPROC EndQueryIndexed;
+	PFNGLENDTRANSFORMFEEDBACKPROC EndTransformFeedback;
+	PFNGLEVALCOORD1DPROC EvalCoord1d;
+	PFNGLEVALCOORD1DVPROC EvalCoord1dv;
+	PFNGLEVALCOORD1FPROC EvalCoord1f;
+	PFNGLEVALCOORD1FVPROC EvalCoord1fv;
+	PFNGLEVALCOORD2DPROC EvalCoord2d;
+	PFNGLEVALCOORD2DVPROC EvalCoord2dv;
+	PFNGLEVALCOORD2FPROC EvalCoord2f;
+	PFNGLEVALCOORD2FVPROC EvalCoord2fv;
+	PFNGLEVALMESH1PROC EvalMesh1;
+	PFNGLEVALMESH2PROC EvalMesh2;
+	PFNGLEVALPOINT1PROC EvalPoint1;
+	PFNGLEVALPOINT2PROC EvalPoint2;
+	PFNGLFEEDBACKBUFFERPROC FeedbackBuffer;
+	PFNGLFENCESYNCPROC FenceSync;
+	PFNGLFINISHPROC Finish;
+	PFNGLFLUSHPROC Flush;
+	PFNGLFLUSHMAPPEDBUFFERRANGEPROC FlushMappedBufferRange;
+	PFNGLFLUSHMAPPEDNAMEDBUFFERRANGEPROC FlushMappedNamedBufferRange;
+	PFNGLFOGCOORDPOINTERPROC FogCoordPointer;
+	PFNGLFOGCOORDDPROC FogCoordd;
+	PFNGLFOGCOORDDVPROC FogCoorddv;
+	PFNGLFOGCOORDFPROC FogCoordf;
+	PFNGLFOGCOORDFVPROC FogCoordfv;
+	PFNGLFOGFPROC Fogf;
+	PFNGLFOGFVPROC Fogfv;
+	PFNGLFOGIPROC Fogi;
+	PFNGLFOGIVPROC Fogiv;
+	PFNGLFRAMEBUFFERPARAMETERIPROC FramebufferParameteri;
+	PFNGLFRAMEBUFFERRENDERBUFFERPROC FramebufferRenderbuffer;
+	PFNGLFRAMEBUFFERTEXTUREPROC FramebufferTexture;
+	PFNGLFRAMEBUFFERTEXTURE1DPROC FramebufferTexture1D;
+	PFNGLFRAMEBUFFERTEXTURE2DPROC FramebufferTexture2D;
+	PFNGLFRAMEBUFFERTEXTURE3DPROC FramebufferTexture3D;
+	PFNGLFRAMEBUFFERTEXTURELAYERPROC FramebufferTextureLayer;
+	PFNGLFRONTFACEPROC FrontFace;
+	PFNGLFRUSTUMPROC Frustum;
+	PFNGLGENBUFFERSPROC GenBuffers;
+	PFNGLGENFRAMEBUFFERSPROC GenFramebuffers;
+	PFNGLGENLISTSPROC GenLists;
+	PFNGLGENPROGRAMPIPELINESPROC GenProgramPipelines;
+	PFNGLGENQUERIESPROC GenQueries;
+	PFNGLGENRENDERBUFFERSPROC GenRenderbuffers;
+	PFNGLGENSAMPLERSPROC GenSamplers;
+	PFNGLGENTEXTURESPROC GenTextures;
+	PFNGLGENTRANSFORMFEEDBACKSPROC GenTransformFeedbacks;
+	PFNGLGENVERTEXARRAYSPROC GenVertexArrays;
+	PFNGLGENERATEMIPMAPPROC GenerateMipmap;
+	PFNGLGENERATETEXTUREMIPMAPPROC GenerateTextureMipmap;
+	PFNGLGETACTIVEATOMICCOUNTERBUFFERIVPROC GetActiveAtomicCounterBufferiv;
+	PFNGLGETACTIVEATTRIBPROC GetActiveAttrib;
+	PFNGLGETACTIVESUBROUTINENAMEPROC GetActiveSubroutineName;
+	PFNGLGETACTIVESUBROUTINEUNIFORMNAMEPROC GetActiveSubroutineUniformName;
+	PFNGLGETACTIVESUBROUTINEUNIFORMIVPROC GetActiveSubroutineUniformiv;
+	PFNGLGETACTIVEUNIFORMPROC GetActiveUniform;
+	PFNGLGETACTIVEUNIFORMBLOCKNAMEPROC GetActiveUniformBlockName;
+	PFNGLGETACTIVEUNIFORMBLOCKIVPROC GetActiveUniformBlockiv;
+	PFNGLGETACTIVEUNIFORMNAMEPROC GetActiveUniformName;
+	PFNGLGETACTIVEUNIFORMSIVPROC GetActiveUniformsiv;
+	PFNGLGETATTACHEDSHADERSPROC GetAttachedShaders;
+	PFNGLGETATTRIBLOCATIONPROC GetAttribLocation;
+	PFNGLGETBOOLEANI_VPROC GetBooleani_v;
+	PFNGLGETBOOLEANVPROC GetBooleanv;
+	PFNGLGETBUFFERPARAMETERI64VPROC GetBufferParameteri64v;
+	PFNGLGETBUFFERPARAMETERIVPROC GetBufferParameteriv;
+	PFNGLGETBUFFERPOINTERVPROC GetBufferPointerv;
+	PFNGLGETBUFFERSUBDATAPROC GetBufferSubData;
+	PFNGLGETCLIPPLANEPROC GetClipPlane;
+	PFNGLGETCOMPRESSEDTEXIMAGEPROC GetCompressedTexImage;
+	PFNGLGETCOMPRESSEDTEXTUREIMAGEPROC GetCompressedTextureImage;
+	PFNGLGETCOMPRESSEDTEXTURESUBIMAGEPROC GetCompressedTextureSubImage;
+	PFNGLGETDEBUGMESSAGELOGPROC GetDebugMessageLog;
+	PFNGLGETDOUBLEI_VPROC GetDoublei_v;
+	PFNGLGETDOUBLEVPROC GetDoublev;
+	PFNGLGETERRORPROC GetError;
+	PFNGLGETFLOATI_VPROC GetFloati_v;
+	PFNGLGETFLOATVPROC GetFloatv;
+	PFNGLGETFRAGDATAINDEXPROC GetFragDataIndex;
+	PFNGLGETFRAGDATALOCATIONPROC GetFragDataLocation;
+	PFNGLGETFRAMEBUFFERATTACHMENTPARAMETERIVPROC GetFramebufferAttachmentParameteriv;
+	PFNGLGETFRAMEBUFFERPARAMETERIVPROC GetFramebufferParameteriv;
+	PFNGLGETGRAPHICSRESETSTATUSPROC GetGraphicsResetStatus;
+	PFNGLGETIMAGEHANDLEARBPROC GetImageHandleARB;
+	PFNGLGETINTEGER64I_VPROC GetInteger64i_v;
+	PFNGLGETINTEGER64VPROC GetInteger64v;
+	PFNGLGETINTEGERI_VPROC GetIntegeri_v;
+	PFNGLGETINTEGERVPROC GetIntegerv;
+	PFNGLGETINTERNALFORMATI64VPROC GetInternalformati64v;
+	PFNGLGETINTERNALFORMATIVPROC GetInternalformativ;
+	PFNGLGETLIGHTFVPROC GetLightfv;
+	PFNGLGETLIGHTIVPROC GetLightiv;
+	PFNGLGETMAPDVPROC GetMapdv;
+	PFNGLGETMAPFVPROC GetMapfv;
+	PFNGLGETMAPIVPROC GetMapiv;
+	PFNGLGETMATERIALFVPROC GetMaterialfv;
+	PFNGLGETMATERIALIVPROC GetMaterialiv;
+	PFNGLGETMULTISAMPLEFVPROC GetMultisamplefv;
+	PFNGLGETNAMEDBUFFERPARAMETERI64VPROC GetNamedBufferParameteri64v;
+	PFNGLGETNAMEDBUFFERPARAMETERIVPROC GetNamedBufferParameteriv;
+	PFNGLGETNAMEDBUFFERPOINTERVPROC GetNamedBufferPointerv;
+	PFNGLGETNAMEDBUFFERSUBDATAPROC GetNamedBufferSubData;
+	PFNGLGETNAMEDFRAMEBUFFERATTACHMENTPARAMETERIVPROC GetNamedFramebufferAttachmentParameteriv;
+	PFNGLGETNAMEDFRAMEBUFFERPARAMETERIVPROC GetNamedFramebufferParameteriv;
+	PFNGLGETNAMEDRENDERBUFFERPARAMETERIVPROC GetNamedRenderbufferParameteriv;
+	PFNGLGETOBJECTLABELPROC GetObjectLabel;
+	PFNGLGETOBJECTPTRLABELPROC GetObjectPtrLabel;
+	PFNGLGETPIXELMAPFVPROC GetPixelMapfv;
+	PFNGLGETPIXELMAPUIVPROC GetPixelMapuiv;
+	PFNGLGETPIXELMAPUSVPROC GetPixelMapusv;
+	PFNGLGETPOINTERVPROC GetPointerv;
+	PFNGLGETPOLYGONSTIPPLEPROC GetPolygonStipple;
+	PFNGLGETPROGRAMBINARYPROC GetProgramBinary;
+	PFNGLGETPROGRAMINFOLOGPROC GetProgramInfoLog;
+	PFNGLGETPROGRAMINTERFACEIVPROC GetProgramInterfaceiv;
+	PFNGLGETPROGRAMPIPELINEINFOLOGPROC GetProgramPipelineInfoLog;
+	PFNGLGETPROGRAMPIPELINEIVPROC GetProgramPipelineiv;
+	PFNGLGETPROGRAMRESOURCEINDEXPROC GetProgramResourceIndex;
+	PFNGLGETPROGRAMRESOURCELOCATIONPROC GetProgramResourceLocation;
+	PFNGLGETPROGRAMRESOURCELOCATIONINDEXPROC GetProgramResourceLocationIndex;
+	PFNGLGETPROGRAMRESOURCENAMEPROC GetProgramResourceName;
+	PFNGLGETPROGRAMRESOURCEIVPROC GetProgramResourceiv;
+	PFNGLGETPROGRAMSTAGEIVPROC GetProgramStageiv;
+	PFNGLGETPROGRAMIVPROC GetProgramiv;
+	PFNGLGETQUERYBUFFEROBJECTI64VPROC GetQueryBufferObjecti64v;
+	PFNGLGETQUERYBUFFEROBJECTIVPROC GetQueryBufferObjectiv;
+	PFNGLGETQUERYBUFFEROBJECTUI64VPROC GetQueryBufferObjectui64v;
+	PFNGLGETQUERYBUFFEROBJECTUIVPROC GetQueryBufferObjectuiv;
+	PFNGLGETQUERYINDEXEDIVPROC GetQueryIndexediv;
+	PFNGLGETQUERYOBJECTI64VPROC GetQueryObjecti64v;
+	PFNGLGETQUERYOBJECTIVPROC GetQueryObjectiv;
+	PFNGLGETQUERYOBJECTUI64VPROC GetQueryObjectui64v;
+	PFNGLGETQUERYOBJECTUIVPROC GetQueryObjectuiv;
+	PFNGLGETQUERYIVPROC GetQueryiv;
+	PFNGLGETRENDERBUFFERPARAMETERIVPROC GetRenderbufferParameteriv;
+	PFNGLGETSAMPLERPARAMETERIIVPROC GetSamplerParameterIiv;
+	PFNGLGETSAMPLERPARAMETERIUIVPROC GetSamplerParameterIuiv;
+	PFNGLGETSAMPLERPARAMETERFVPROC GetSamplerParameterfv;
+	PFNGLGETSAMPLERPARAMETERIVPROC GetSamplerParameteriv;
+	PFNGLGETSHADERINFOLOGPROC GetShaderInfoLog;
+	PFNGLGETSHADERPRECISIONFORMATPROC GetShaderPrecisionFormat;
+	PFNGLGETSHADERSOURCEPROC GetShaderSource;
+	PFNGLGETSHADERIVPROC GetShaderiv;
+	PFNGLGETSTRINGPROC GetString;
+	PFNGLGETSTRINGIPROC GetStringi;
+	PFNGLGETSUBROUTINEINDEXPROC GetSubroutineIndex;
+	PFNGLGETSUBROUTINEUNIFORMLOCATIONPROC GetSubroutineUniformLocation;
+	PFNGLGETSYNCIVPROC GetSynciv;
+	PFNGLGETTEXENVFVPROC GetTexEnvfv;
+	PFNGLGETTEXENVIVPROC GetTexEnviv;
+	PFNGLGETTEXGENDVPROC GetTexGendv;
+	PFNGLGETTEXGENFVPROC GetTexGenfv;
+	PFNGLGETTEXGENIVPROC GetTexGeniv;
+	PFNGLGETTEXIMAGEPROC GetTexImage;
+	PFNGLGETTEXLEVELPARAMETERFVPROC GetTexLevelParameterfv;
+	PFNGLGETTEXLEVELPARAMETERIVPROC GetTexLevelParameteriv;
+	PFNGLGETTEXPARAMETERIIVPROC GetTexParameterIiv;
+	PFNGLGETTEXPARAMETERIUIVPROC GetTexParameterIuiv;
+	PFNGLGETTEXPARAMETERFVPROC GetTexParameterfv;
+	PFNGLGETTEXPARAMETERIVPROC GetTexParameteriv;
+	PFNGLGETTEXTUREHANDLEARBPROC GetTextureHandleARB;
+	PFNGLGETTEXTUREIMAGEPROC GetTextureImage;
+	PFNGLGETTEXTURELEVELPARAMETERFVPROC GetTextureLevelParameterfv;
+	PFNGLGETTEXTURELEVELPARAMETERIVPROC GetTextureLevelParameteriv;
+	PFNGLGETTEXTUREPARAMETERIIVPROC GetTextureParameterIiv;
+	PFNGLGETTEXTUREPARAMETERIUIVPROC GetTextureParameterIuiv;
+	PFNGLGETTEXTUREPARAMETERFVPROC GetTextureParameterfv;
+	PFNGLGETTEXTUREPARAMETERIVPROC GetTextureParameteriv;
+	PFNGLGETTEXTURESAMPLERHANDLEARBPROC GetTextureSamplerHandleARB;
+	PFNGLGETTEXTURESUBIMAGEPROC GetTextureSubImage;
+	PFNGLGETTRANSFORMFEEDBACKVARYINGPROC GetTransformFeedbackVarying;
+	PFNGLGETTRANSFORMFEEDBACKI64_VPROC GetTransformFeedbacki64_v;
+	PFNGLGETTRANSFORMFEEDBACKI_VPROC GetTransformFeedbacki_v;
+	PFNGLGETTRANSFORMFEEDBACKIVPROC GetTransformFeedbackiv;
+	PFNGLGETUNIFORMBLOCKINDEXPROC GetUniformBlockIndex;
+	PFNGLGETUNIFORMINDICESPROC GetUniformIndices;
+	PFNGLGETUNIFORMLOCATIONPROC GetUniformLocation;
+	PFNGLGETUNIFORMSUBROUTINEUIVPROC GetUniformSubroutineuiv;
+	PFNGLGETUNIFORMDVPROC GetUniformdv;
+	PFNGLGETUNIFORMFVPROC GetUniformfv;
+	PFNGLGETUNIFORMIVPROC GetUniformiv;
+	PFNGLGETUNIFORMUIVPROC GetUniformuiv;
+	PFNGLGETVERTEXARRAYINDEXED64IVPROC GetVertexArrayIndexed64iv;
+	PFNGLGETVERTEXARRAYINDEXEDIVPROC GetVertexArrayIndexediv;
+	PFNGLGETVERTEXARRAYIVPROC GetVertexArrayiv;
+	PFNGLGETVERTEXATTRIBIIVPROC GetVertexAttribIiv;
+	PFNGLGETVERTEXATTRIBIUIVPROC GetVertexAttribIuiv;
+	PFNGLGETVERTEXATTRIBLDVPROC GetVertexAttribLdv;
+	PFNGLGETVERTEXATTRIBLUI64VARBPROC GetVertexAttribLui64vARB;
+	PFNGLGETVERTEXATTRIBPOINTERVPROC GetVertexAttribPointerv;
+	PFNGLGETVERTEXATTRIBDVPROC GetVertexAttribdv;
+	PFNGLGETVERTEXATTRIBFVPROC GetVertexAttribfv;
+	PFNGLGETVERTEXATTRIBIVPROC GetVertexAttribiv;
+	PFNGLGETNCOLORTABLEPROC GetnColorTable;
+	PFNGLGETNCOMPRESSEDTEXIMAGEPROC GetnCompressedTexImage;
+	PFNGLGETNCONVOLUTIONFILTERPROC GetnConvolutionFilter;
+	PFNGLGETNHISTOGRAMPROC GetnHistogram;
+	PFNGLGETNMAPDVPROC GetnMapdv;
+	PFNGLGETNMAPFVPROC GetnMapfv;
+	PFNGLGETNMAPIVPROC GetnMapiv;
+	PFNGLGETNMINMAXPROC GetnMinmax;
+	PFNGLGETNPIXELMAPFVPROC GetnPixelMapfv;
+	PFNGLGETNPIXELMAPUIVPROC GetnPixelMapuiv;
+	PFNGLGETNPIXELMAPUSVPROC GetnPixelMapusv;
+	PFNGLGETNPOLYGONSTIPPLEPROC GetnPolygonStipple;
+	PFNGLGETNSEPARABLEFILTERPROC GetnSeparableFilter;
+	PFNGLGETNTEXIMAGEPROC GetnTexImage;
+	PFNGLGETNUNIFORMDVPROC GetnUniformdv;
+	PFNGLGETNUNIFORMFVPROC GetnUniformfv;
+	PFNGLGETNUNIFORMIVPROC GetnUniformiv;
+	PFNGLGETNUNIFORMUIVPROC GetnUniformuiv;
+	PFNGLHINTPROC Hint;
+	PFNGLINDEXMASKPROC IndexMask;
+	PFNGLINDEXPOINTERPROC IndexPointer;
+	PFNGLINDEXDPROC Indexd;
+	PFNGLINDEXDVPROC Indexdv;
+	PFNGLINDEXFPROC Indexf;
+	PFNGLINDEXFVPROC Indexfv;
+	PFNGLINDEXIPROC Indexi;
+	PFNGLINDEXIVPROC Indexiv;
+	PFNGLINDEXSPROC Indexs;
+	PFNGLINDEXSVPROC Indexsv;
+	PFNGLINDEXUBPROC Indexub;
+	PFNGLINDEXUBVPROC Indexubv;
+	PFNGLINITNAMESPROC InitNames;
+	PFNGLINTERLEAVEDARRAYSPROC InterleavedArrays;
+	PFNGLINVALIDATEBUFFERDATAPROC InvalidateBufferData;
+	PFNGLINVALIDATEBUFFERSUBDATAPROC InvalidateBufferSubData;
+	PFNGLINVALIDATEFRAMEBUFFERPROC InvalidateFramebuffer;
+	PFNGLINVALIDATENAMEDFRAMEBUFFERDATAPROC InvalidateNamedFramebufferData;
+	PFNGLINVALIDATENAMEDFRAMEBUFFERSUBDATAPROC InvalidateNamedFramebufferSubData;
+	PFNGLINVALIDATESUBFRAMEBUFFERPROC InvalidateSubFramebuffer;
+	PFNGLINVALIDATETEXIMAGEPROC InvalidateTexImage;
+	PFNGLINVALIDATETEXSUBIMAGEPROC InvalidateTexSubImage;
+	PFNGLISBUFFERPROC IsBuffer;
+	PFNGLISENABLEDPROC IsEnabled;
+	PFNGLISENABLEDIPROC IsEnabledi;
+	PFNGLISFRAMEBUFFERPROC IsFramebuffer;
+	PFNGLISIMAGEHANDLERESIDENTARBPROC IsImageHandleResidentARB;
+	PFNGLISLISTPROC IsList;
+	PFNGLISPROGRAMPROC IsProgram;
+	PFNGLISPROGRAMPIPELINEPROC IsProgramPipeline;
+	PFNGLISQUERYPROC IsQuery;
+	PFNGLISRENDERBUFFERPROC IsRenderbuffer;
+	PFNGLISSAMPLERPROC IsSampler;
+	PFNGLISSHADERPROC IsShader;
+	PFNGLISSYNCPROC IsSync;
+	PFNGLISTEXTUREPROC IsTexture;
+	PFNGLISTEXTUREHANDLERESIDENTARBPROC IsTextureHandleResidentARB;
+	PFNGLISTRANSFORMFEEDBACKPROC IsTransformFeedback;
+	PFNGLISVERTEXARRAYPROC IsVertexArray;
+	PFNGLLIGHTMODELFPROC LightModelf;
+	PFNGLLIGHTMODELFVPROC LightModelfv;
+	PFNGLLIGHTMODELIPROC LightModeli;
+	PFNGLLIGHTMODELIVPROC LightModeliv;
+	PFNGLLIGHTFPROC Lightf;
+	PFNGLLIGHTFVPROC Lightfv;
+	PFNGLLIGHTIPROC Lighti;
+	PFNGLLIGHTIVPROC Lightiv;
+	PFNGLLINESTIPPLEPROC LineStipple;
+	PFNGLLINEWIDTHPROC LineWidth;
+	PFNGLLINKPROGRAMPROC LinkProgram;
+	PFNGLLISTBASEPROC ListBase;
+	PFNGLLOADIDENTITYPROC LoadIdentity;
+	PFNGLLOADMATRIXDPROC LoadMatrixd;
+	PFNGLLOADMATRIXFPROC LoadMatrixf;
+	PFNGLLOADNAMEPROC LoadName;
+	PFNGLLOADTRANSPOSEMATRIXDPROC LoadTransposeMatrixd;
+	PFNGLLOADTRANSPOSEMATRIXFPROC LoadTransposeMatrixf;
+	PFNGLLOGICOPPROC LogicOp;
+	PFNGLMAKEIMAGEHANDLENONRESIDENTARBPROC MakeImageHandleNonResidentARB;
+	PFNGLMAKEIMAGEHANDLERESIDENTARBPROC MakeImageHandleResidentARB;
+	PFNGLMAKETEXTUREHANDLENONRESIDENTARBPROC MakeTextureHandleNonResidentARB;
+	PFNGLMAKETEXTUREHANDLERESIDENTARBPROC MakeTextureHandleResidentARB;
+	PFNGLMAP1DPROC Map1d;
+	PFNGLMAP1FPROC Map1f;
+	PFNGLMAP2DPROC Map2d;
+	PFNGLMAP2FPROC Map2f;
+	PFNGLMAPBUFFERPROC MapBuffer;
+	PFNGLMAPBUFFERRANGEPROC MapBufferRange;
+	PFNGLMAPGRID1DPROC MapGrid1d;
+	PFNGLMAPGRID1FPROC MapGrid1f;
+	PFNGLMAPGRID2DPROC MapGrid2d;
+	PFNGLMAPGRID2FPROC MapGrid2f;
+	PFNGLMAPNAMEDBUFFERPROC MapNamedBuffer;
+	PFNGLMAPNAMEDBUFFERRANGEPROC MapNamedBufferRange;
+	PFNGLMATERIALFPROC Materialf;
+	PFNGLMATERIALFVPROC Materialfv;
+	PFNGLMATERIALIPROC Materiali;
+	PFNGLMATERIALIVPROC Materialiv;
+	PFNGLMATRIXMODEPROC MatrixMode;
+	PFNGLMAXSHADERCOMPILERTHREADSKHRPROC MaxShaderCompilerThreadsKHR;
+	PFNGLMEMORYBARRIERPROC MemoryBarrier;
+	PFNGLMEMORYBARRIERBYREGIONPROC MemoryBarrierByRegion;
+	PFNGLMINSAMPLESHADINGPROC MinSampleShading;
+	PFNGLMULTMATRIXDPROC MultMatrixd;
+	PFNGLMULTMATRIXFPROC MultMatrixf;
+	PFNGLMULTTRANSPOSEMATRIXDPROC MultTransposeMatrixd;
+	PFNGLMULTTRANSPOSEMATRIXFPROC MultTransposeMatrixf;
+	PFNGLMULTIDRAWARRAYSPROC MultiDrawArrays;
+	PFNGLMULTIDRAWARRAYSINDIRECTPROC MultiDrawArraysIndirect;
+	PFNGLMULTIDRAWARRAYSINDIRECTCOUNTPROC MultiDrawArraysIndirectCount;
+	PFNGLMULTIDRAWELEMENTSPROC MultiDrawElements;
+	PFNGLMULTIDRAWELEMENTSBASEVERTEXPROC MultiDrawElementsBaseVertex;
+	PFNGLMULTIDRAWELEMENTSINDIRECTPROC MultiDrawElementsIndirect;
+	PFNGLMULTIDRAWELEMENTSINDIRECTCOUNTPROC MultiDrawElementsIndirectCount;
+	PFNGLMULTITEXCOORD1DPROC MultiTexCoord1d;
+	PFNGLMULTITEXCOORD1DVPROC MultiTexCoord1dv;
+	PFNGLMULTITEXCOORD1FPROC MultiTexCoord1f;
+	PFNGLMULTITEXCOORD1FVPROC MultiTexCoord1fv;
+	PFNGLMULTITEXCOORD1IPROC MultiTexCoord1i;
+	PFNGLMULTITEXCOORD1IVPROC MultiTexCoord1iv;
+	PFNGLMULTITEXCOORD1SPROC MultiTexCoord1s;
+	PFNGLMULTITEXCOORD1SVPROC MultiTexCoord1sv;
+	PFNGLMULTITEXCOORD2DPROC MultiTexCoord2d;
+	PFNGLMULTITEXCOORD2DVPROC MultiTexCoord2dv;
+	PFNGLMULTITEXCOORD2FPROC MultiTexCoord2f;
+	PFNGLMULTITEXCOORD2FVPROC MultiTexCoord2fv;
+	PFNGLMULTITEXCOORD2IPROC MultiTexCoord2i;
+	PFNGLMULTITEXCOORD2IVPROC MultiTexCoord2iv;
+	PFNGLMULTITEXCOORD2SPROC MultiTexCoord2s;
+	PFNGLMULTITEXCOORD2SVPROC MultiTexCoord2sv;
+	PFNGLMULTITEXCOORD3DPROC MultiTexCoord3d;
+	PFNGLMULTITEXCOORD3DVPROC MultiTexCoord3dv;
+	PFNGLMULTITEXCOORD3FPROC MultiTexCoord3f;
+	PFNGLMULTITEXCOORD3FVPROC MultiTexCoord3fv;
+	PFNGLMULTITEXCOORD3IPROC MultiTexCoord3i;
+	PFNGLMULTITEXCOORD3IVPROC MultiTexCoord3iv;
+	PFNGLMULTITEXCOORD3SPROC MultiTexCoord3s;
+	PFNGLMULTITEXCOORD3SVPROC MultiTexCoord3sv;
+	PFNGLMULTITEXCOORD4DPROC MultiTexCoord4d;
+	PFNGLMULTITEXCOORD4DVPROC MultiTexCoord4dv;
+	PFNGLMULTITEXCOORD4FPROC MultiTexCoord4f;
+	PFNGLMULTITEXCOORD4FVPROC MultiTexCoord4fv;
+	PFNGLMULTITEXCOORD4IPROC MultiTexCoord4i;
+	PFNGLMULTITEXCOORD4IVPROC MultiTexCoord4iv;
+	PFNGLMULTITEXCOORD4SPROC MultiTexCoord4s;
+	PFNGLMULTITEXCOORD4SVPROC MultiTexCoord4sv;
+	PFNGLMULTITEXCOORDP1UIPROC MultiTexCoordP1ui;
+	PFNGLMULTITEXCOORDP1UIVPROC MultiTexCoordP1uiv;
+	PFNGLMULTITEXCOORDP2UIPROC MultiTexCoordP2ui;
+	PFNGLMULTITEXCOORDP2UIVPROC MultiTexCoordP2uiv;
+	PFNGLMULTITEXCOORDP3UIPROC MultiTexCoordP3ui;
+	PFNGLMULTITEXCOORDP3UIVPROC MultiTexCoordP3uiv;
+	PFNGLMULTITEXCOORDP4UIPROC MultiTexCoordP4ui;
+	PFNGLMULTITEXCOORDP4UIVPROC MultiTexCoordP4uiv;
+	PFNGLNAMEDBUFFERDATAPROC NamedBufferData;
+	PFNGLNAMEDBUFFERSTORAGEPROC NamedBufferStorage;
+	PFNGLNAMEDBUFFERSTORAGEEXTPROC NamedBufferStorageEXT;
+	PFNGLNAMEDBUFFERSUBDATAPROC NamedBufferSubData;
+	PFNGLNAMEDFRAMEBUFFERDRAWBUFFERPROC NamedFramebufferDrawBuffer;
+	PFNGLNAMEDFRAMEBUFFERDRAWBUFFERSPROC NamedFramebufferDrawBuffers;
+	PFNGLNAMEDFRAMEBUFFERPARAMETERIPROC NamedFramebufferParameteri;
+	PFNGLNAMEDFRAMEBUFFERREADBUFFERPROC NamedFramebufferReadBuffer;
+	PFNGLNAMEDFRAMEBUFFERRENDERBUFFERPROC NamedFramebufferRenderbuffer;
+	PFNGLNAMEDFRAMEBUFFERTEXTUREPROC NamedFramebufferTexture;
+	PFNGLNAMEDFRAMEBUFFERTEXTURELAYERPROC NamedFramebufferTextureLayer;
+	PFNGLNAMEDRENDERBUFFERSTORAGEPROC NamedRenderbufferStorage;
+	PFNGLNAMEDRENDERBUFFERSTORAGEMULTISAMPLEPROC NamedRenderbufferStorageMultisample;
+	PFNGLNEWLISTPROC NewList;
+	PFNGLNORMAL3BPROC Normal3b;
+	PFNGLNORMAL3BVPROC Normal3bv;
+	PFNGLNORMAL3DPROC Normal3d;
+	PFNGLNORMAL3DVPROC Normal3dv;
+	PFNGLNORMAL3FPROC Normal3f;
+	PFNGLNORMAL3FVPROC Normal3fv;
+	PFNGLNORMAL3IPROC Normal3i;
+	PFNGLNORMAL3IVPROC Normal3iv;
+	PFNGLNORMAL3SPROC Normal3s;
+	PFNGLNORMAL3SVPROC Normal3sv;
+	PFNGLNORMALP3UIPROC NormalP3ui;
+	PFNGLNORMALP3UIVPROC NormalP3uiv;
+	PFNGLNORMALPOINTERPROC NormalPointer;
+	PFNGLOBJECTLABELPROC ObjectLabel;
+	PFNGLOBJECTPTRLABELPROC ObjectPtrLabel;
+	PFNGLORTHOPROC Ortho;
+	PFNGLPASSTHROUGHPROC PassThrough;
+	PFNGLPATCHPARAMETERFVPROC PatchParameterfv;
+	PFNGLPATCHPARAMETERIPROC PatchParameteri;
+	PFNGLPAUSETRANSFORMFEEDBACKPROC PauseTransformFeedback;
+	PFNGLPIXELMAPFVPROC PixelMapfv;
+	PFNGLPIXELMAPUIVPROC PixelMapuiv;
+	PFNGLPIXELMAPUSVPROC PixelMapusv;
+	PFNGLPIXELSTOREFPROC PixelStoref;
+	PFNGLPIXELSTOREIPROC PixelStorei;
+	PFNGLPIXELTRANSFERFPROC PixelTransferf;
+	PFNGLPIXELTRANSFERIPROC PixelTransferi;
+	PFNGLPIXELZOOMPROC PixelZoom;
+	PFNGLPOINTPARAMETERFPROC PointParameterf;
+	PFNGLPOINTPARAMETERFVPROC PointParameterfv;
+	PFNGLPOINTPARAMETERIPROC PointParameteri;
+	PFNGLPOINTPARAMETERIVPROC PointParameteriv;
+	PFNGLPOINTSIZEPROC PointSize;
+	PFNGLPOLYGONMODEPROC PolygonMode;
+	PFNGLPOLYGONOFFSETPROC PolygonOffset;
+	PFNGLPOLYGONOFFSETCLAMPPROC PolygonOffsetClamp;
+	PFNGLPOLYGONSTIPPLEPROC PolygonStipple;
+	PFNGLPOPATTRIBPROC PopAttrib;
+	PFNGLPOPCLIENTATTRIBPROC PopClientAttrib;
+	PFNGLPOPDEBUGGROUPPROC PopDebugGroup;
+	PFNGLPOPMATRIXPROC PopMatrix;
+	PFNGLPOPNAMEPROC PopName;
+	PFNGLPRIMITIVERESTARTINDEXPROC PrimitiveRestartIndex;
+	PFNGLPRIORITIZETEXTURESPROC PrioritizeTextures;
+	PFNGLPROGRAMBINARYPROC ProgramBinary;
+	PFNGLPROGRAMPARAMETERIPROC ProgramParameteri;
+	PFNGLPROGRAMUNIFORM1DPROC ProgramUniform1d;
+	PFNGLPROGRAMUNIFORM1DVPROC ProgramUniform1dv;
+	PFNGLPROGRAMUNIFORM1FPROC ProgramUniform1f;
+	PFNGLPROGRAMUNIFORM1FVPROC ProgramUniform1fv;
+	PFNGLPROGRAMUNIFORM1IPROC ProgramUniform1i;
+	PFNGLPROGRAMUNIFORM1IVPROC ProgramUniform1iv;
+	PFNGLPROGRAMUNIFORM1UIPROC ProgramUniform1ui;
+	PFNGLPROGRAMUNIFORM1UIVPROC ProgramUniform1uiv;
+	PFNGLPROGRAMUNIFORM2DPROC ProgramUniform2d;
+	PFNGLPROGRAMUNIFORM2DVPROC ProgramUniform2dv;
+	PFNGLPROGRAMUNIFORM2FPROC ProgramUniform2f;
+	PFNGLPROGRAMUNIFORM2FVPROC ProgramUniform2fv;
+	PFNGLPROGRAMUNIFORM2IPROC ProgramUniform2i;
+	PFNGLPROGRAMUNIFORM2IVPROC ProgramUniform2iv;
+	PFNGLPROGRAMUNIFORM2UIPROC ProgramUniform2ui;
+	PFNGLPROGRAMUNIFORM2UIVPROC ProgramUniform2uiv;
+	PFNGLPROGRAMUNIFORM3DPROC ProgramUniform3d;
+	PFNGLPROGRAMUNIFORM3DVPROC ProgramUniform3dv;
+	PFNGLPROGRAMUNIFORM3FPROC ProgramUniform3f;
+	PFNGLPROGRAMUNIFORM3FVPROC ProgramUniform3fv;
+	PFNGLPROGRAMUNIFORM3IPROC ProgramUniform3i;
+	PFNGLPROGRAMUNIFORM3IVPROC ProgramUniform3iv;
+	PFNGLPROGRAMUNIFORM3UIPROC ProgramUniform3ui;
+	PFNGLPROGRAMUNIFORM3UIVPROC ProgramUniform3uiv;
+	PFNGLPROGRAMUNIFORM4DPROC ProgramUniform4d;
+	PFNGLPROGRAMUNIFORM4DVPROC ProgramUniform4dv;
+	PFNGLPROGRAMUNIFORM4FPROC ProgramUniform4f;
+	PFNGLPROGRAMUNIFORM4FVPROC ProgramUniform4fv;
+	PFNGLPROGRAMUNIFORM4IPROC ProgramUniform4i;
+	PFNGLPROGRAMUNIFORM4IVPROC ProgramUniform4iv;
+	PFNGLPROGRAMUNIFORM4UIPROC ProgramUniform4ui;
+	PFNGLPROGRAMUNIFORM4UIVPROC ProgramUniform4uiv;
+	PFNGLPROGRAMUNIFORMHANDLEUI64ARBPROC ProgramUniformHandleui64ARB;
+	PFNGLPROGRAMUNIFORMHANDLEUI64VARBPROC ProgramUniformHandleui64vARB;
+	PFNGLPROGRAMUNIFORMMATRIX2DVPROC ProgramUniformMatrix2dv;
+	PFNGLPROGRAMUNIFORMMATRIX2FVPROC ProgramUniformMatrix2fv;
+	PFNGLPROGRAMUNIFORMMATRIX2X3DVPROC ProgramUniformMatrix2x3dv;
+	PFNGLPROGRAMUNIFORMMATRIX2X3FVPROC ProgramUniformMatrix2x3fv;
+	PFNGLPROGRAMUNIFORMMATRIX2X4DVPROC ProgramUniformMatrix2x4dv;
+	PFNGLPROGRAMUNIFORMMATRIX2X4FVPROC ProgramUniformMatrix2x4fv;
+	PFNGLPROGRAMUNIFORMMATRIX3DVPROC ProgramUniformMatrix3dv;
+	PFNGLPROGRAMUNIFORMMATRIX3FVPROC ProgramUniformMatrix3fv;
+	PFNGLPROGRAMUNIFORMMATRIX3X2DVPROC ProgramUniformMatrix3x2dv;
+	PFNGLPROGRAMUNIFORMMATRIX3X2FVPROC ProgramUniformMatrix3x2fv;
+	PFNGLPROGRAMUNIFORMMATRIX3X4DVPROC ProgramUniformMatrix3x4dv;
+	PFNGLPROGRAMUNIFORMMATRIX3X4FVPROC ProgramUniformMatrix3x4fv;
+	PFNGLPROGRAMUNIFORMMATRIX4DVPROC ProgramUniformMatrix4dv;
+	PFNGLPROGRAMUNIFORMMATRIX4FVPROC ProgramUniformMatrix4fv;
+	PFNGLPROGRAMUNIFORMMATRIX4X2DVPROC ProgramUniformMatrix4x2dv;
+	PFNGLPROGRAMUNIFORMMATRIX4X2FVPROC ProgramUniformMatrix4x2fv;
+	PFNGLPROGRAMUNIFORMMATRIX4X3DVPROC ProgramUniformMatrix4x3dv;
+	PFNGLPROGRAMUNIFORMMATRIX4X3FVPROC ProgramUniformMatrix4x3fv;
+	PFNGLPROVOKINGVERTEXPROC ProvokingVertex;
+	PFNGLPUSHATTRIBPROC PushAttrib;
+	PFNGLPUSHCLIENTATTRIBPROC PushClientAttrib;
+	PFNGLPUSHDEBUGGROUPPROC PushDebugGroup;
+	PFNGLPUSHMATRIXPROC PushMatrix;
+	PFNGLPUSHNAMEPROC PushName;
+	PFNGLQUERYCOUNTERPROC QueryCounter;
+	PFNGLRASTERPOS2DPROC RasterPos2d;
+	PFNGLRASTERPOS2DVPROC RasterPos2dv;
+	PFNGLRASTERPOS2FPROC RasterPos2f;
+	PFNGLRASTERPOS2FVPROC RasterPos2fv;
+	PFNGLRASTERPOS2IPROC RasterPos2i;
+	PFNGLRASTERPOS2IVPROC RasterPos2iv;
+	PFNGLRASTERPOS2SPROC RasterPos2s;
+	PFNGLRASTERPOS2SVPROC RasterPos2sv;
+	PFNGLRASTERPOS3DPROC RasterPos3d;
+	PFNGLRASTERPOS3DVPROC RasterPos3dv;
+	PFNGLRASTERPOS3FPROC RasterPos3f;
+	PFNGLRASTERPOS3FVPROC RasterPos3fv;
+	PFNGLRASTERPOS3IPROC RasterPos3i;
+	PFNGLRASTERPOS3IVPROC RasterPos3iv;
+	PFNGLRASTERPOS3SPROC RasterPos3s;
+	PFNGLRASTERPOS3SVPROC RasterPos3sv;
+	PFNGLRASTERPOS4DPROC RasterPos4d;
+	PFNGLRASTERPOS4DVPROC RasterPos4dv;
+	PFNGLRASTERPOS4FPROC RasterPos4f;
+	PFNGLRASTERPOS4FVPROC RasterPos4fv;
+	PFNGLRASTERPOS4IPROC RasterPos4i;
+	PFNGLRASTERPOS4IVPROC RasterPos4iv;
+	PFNGLRASTERPOS4SPROC RasterPos4s;
+	PFNGLRASTERPOS4SVPROC RasterPos4sv;
+	PFNGLREADBUFFERPROC ReadBuffer;
+	PFNGLREADPIXELSPROC ReadPixels;
+	PFNGLREADNPIXELSPROC ReadnPixels;
+	PFNGLRECTDPROC Rectd;
+	PFNGLRECTDVPROC Rectdv;
+	PFNGLRECTFPROC Rectf;
+	PFNGLRECTFVPROC Rectfv;
+	PFNGLRECTIPROC Recti;
+	PFNGLRECTIVPROC Rectiv;
+	PFNGLRECTSPROC Rects;
+	PFNGLRECTSVPROC Rectsv;
+	PFNGLRELEASESHADERCOMPILERPROC ReleaseShaderCompiler;
+	PFNGLRENDERMODEPROC RenderMode;
+	PFNGLRENDERBUFFERSTORAGEPROC RenderbufferStorage;
+	PFNGLRENDERBUFFERSTORAGEMULTISAMPLEPROC RenderbufferStorageMultisample;
+	PFNGLRESUMETRANSFORMFEEDBACKPROC ResumeTransformFeedback;
+	PFNGLROTATEDPROC Rotated;
+	PFNGLROTATEFPROC Rotatef;
+	PFNGLSAMPLECOVERAGEPROC SampleCoverage;
+	PFNGLSAMPLEMASKIPROC SampleMaski;
+	PFNGLSAMPLERPARAMETERIIVPROC SamplerParameterIiv;
+	PFNGLSAMPLERPARAMETERIUIVPROC SamplerParameterIuiv;
+	PFNGLSAMPLERPARAMETERFPROC SamplerParameterf;
+	PFNGLSAMPLERPARAMETERFVPROC SamplerParameterfv;
+	PFNGLSAMPLERPARAMETERIPROC SamplerParameteri;
+	PFNGLSAMPLERPARAMETERIVPROC SamplerParameteriv;
+	PFNGLSCALEDPROC Scaled;
+	PFNGLSCALEFPROC Scalef;
+	PFNGLSCISSORPROC Scissor;
+	PFNGLSCISSORARRAYVPROC ScissorArrayv;
+	PFNGLSCISSORINDEXEDPROC ScissorIndexed;
+	PFNGLSCISSORINDEXEDVPROC ScissorIndexedv;
+	PFNGLSECONDARYCOLOR3BPROC SecondaryColor3b;
+	PFNGLSECONDARYCOLOR3BVPROC SecondaryColor3bv;
+	PFNGLSECONDARYCOLOR3DPROC SecondaryColor3d;
+	PFNGLSECONDARYCOLOR3DVPROC SecondaryColor3dv;
+	PFNGLSECONDARYCOLOR3FPROC SecondaryColor3f;
+	PFNGLSECONDARYCOLOR3FVPROC SecondaryColor3fv;
+	PFNGLSECONDARYCOLOR3IPROC SecondaryColor3i;
+	PFNGLSECONDARYCOLOR3IVPROC SecondaryColor3iv;
+	PFNGLSECONDARYCOLOR3SPROC SecondaryColor3s;
+	PFNGLSECONDARYCOLOR3SVPROC SecondaryColor3sv;
+	PFNGLSECONDARYCOLOR3UBPROC SecondaryColor3ub;
+	PFNGLSECONDARYCOLOR3UBVPROC SecondaryColor3ubv;
+	PFNGLSECONDARYCOLOR3UIPROC SecondaryColor3ui;
+	PFNGLSECONDARYCOLOR3UIVPROC SecondaryColor3uiv;
+	PFNGLSECONDARYCOLOR3USPROC SecondaryColor3us;
+	PFNGLSECONDARYCOLOR3USVPROC SecondaryColor3usv;
+	PFNGLSECONDARYCOLORP3UIPROC SecondaryColorP3ui;
+	PFNGLSECONDARYCOLORP3UIVPROC SecondaryColorP3uiv;
+	PFNGLSECONDARYCOLORPOINTERPROC SecondaryColorPointer;
+	PFNGLSELECTBUFFERPROC SelectBuffer;
+	PFNGLSHADEMODELPROC ShadeModel;
+	PFNGLSHADERBINARYPROC ShaderBinary;
+	PFNGLSHADERSOURCEPROC ShaderSource;
+	PFNGLSHADERSTORAGEBLOCKBINDINGPROC ShaderStorageBlockBinding;
+	PFNGLSPECIALIZESHADERPROC SpecializeShader;
+	PFNGLSPECIALIZESHADERARBPROC SpecializeShaderARB;
+	PFNGLSTENCILFUNCPROC StencilFunc;
+	PFNGLSTENCILFUNCSEPARATEPROC StencilFuncSeparate;
+	PFNGLSTENCILMASKPROC StencilMask;
+	PFNGLSTENCILMASKSEPARATEPROC StencilMaskSeparate;
+	PFNGLSTENCILOPPROC StencilOp;
+	PFNGLSTENCILOPSEPARATEPROC StencilOpSeparate;
+	PFNGLTEXBUFFERPROC TexBuffer;
+	PFNGLTEXBUFFERRANGEPROC TexBufferRange;
+	PFNGLTEXCOORD1DPROC TexCoord1d;
+	PFNGLTEXCOORD1DVPROC TexCoord1dv;
+	PFNGLTEXCOORD1FPROC TexCoord1f;
+	PFNGLTEXCOORD1FVPROC TexCoord1fv;
+	PFNGLTEXCOORD1IPROC TexCoord1i;
+	PFNGLTEXCOORD1IVPROC TexCoord1iv;
+	PFNGLTEXCOORD1SPROC TexCoord1s;
+	PFNGLTEXCOORD1SVPROC TexCoord1sv;
+	PFNGLTEXCOORD2DPROC TexCoord2d;
+	PFNGLTEXCOORD2DVPROC TexCoord2dv;
+	PFNGLTEXCOORD2FPROC TexCoord2f;
+	PFNGLTEXCOORD2FVPROC TexCoord2fv;
+	PFNGLTEXCOORD2IPROC TexCoord2i;
+	PFNGLTEXCOORD2IVPROC TexCoord2iv;
+	PFNGLTEXCOORD2SPROC TexCoord2s;
+	PFNGLTEXCOORD2SVPROC TexCoord2sv;
+	PFNGLTEXCOORD3DPROC TexCoord3d;
+	PFNGLTEXCOORD3DVPROC TexCoord3dv;
+	PFNGLTEXCOORD3FPROC TexCoord3f;
+	PFNGLTEXCOORD3FVPROC TexCoord3fv;
+	PFNGLTEXCOORD3IPROC TexCoord3i;
+	PFNGLTEXCOORD3IVPROC TexCoord3iv;
+	PFNGLTEXCOORD3SPROC TexCoord3s;
+	PFNGLTEXCOORD3SVPROC TexCoord3sv;
+	PFNGLTEXCOORD4DPROC TexCoord4d;
+	PFNGLTEXCOORD4DVPROC TexCoord4dv;
+	PFNGLTEXCOORD4FPROC TexCoord4f;
+	PFNGLTEXCOORD4FVPROC TexCoord4fv;
+	PFNGLTEXCOORD4IPROC TexCoord4i;
+	PFNGLTEXCOORD4IVPROC TexCoord4iv;
+	PFNGLTEXCOORD4SPROC TexCoord4s;
+	PFNGLTEXCOORD4SVPROC TexCoord4sv;
+	PFNGLTEXCOORDP1UIPROC TexCoordP1ui;
+	PFNGLTEXCOORDP1UIVPROC TexCoordP1uiv;
+	PFNGLTEXCOORDP2UIPROC TexCoordP2ui;
+	PFNGLTEXCOORDP2UIVPROC TexCoordP2uiv;
+	PFNGLTEXCOORDP3UIPROC TexCoordP3ui;
+	PFNGLTEXCOORDP3UIVPROC TexCoordP3uiv;
+	PFNGLTEXCOORDP4UIPROC TexCoordP4ui;
+	PFNGLTEXCOORDP4UIVPROC TexCoordP4uiv;
+	PFNGLTEXCOORDPOINTERPROC TexCoordPointer;
+	PFNGLTEXENVFPROC TexEnvf;
+	PFNGLTEXENVFVPROC TexEnvfv;
+	PFNGLTEXENVIPROC TexEnvi;
+	PFNGLTEXENVIVPROC TexEnviv;
+	PFNGLTEXGENDPROC TexGend;
+	PFNGLTEXGENDVPROC TexGendv;
+	PFNGLTEXGENFPROC TexGenf;
+	PFNGLTEXGENFVPROC TexGenfv;
+	PFNGLTEXGENIPROC TexGeni;
+	PFNGLTEXGENIVPROC TexGeniv;
+	PFNGLTEXIMAGE1DPROC TexImage1D;
+	PFNGLTEXIMAGE2DPROC TexImage2D;
+	PFNGLTEXIMAGE2DMULTISAMPLEPROC TexImage2DMultisample;
+	PFNGLTEXIMAGE3DPROC TexImage3D;
+	PFNGLTEXIMAGE3DMULTISAMPLEPROC TexImage3DMultisample;
+	PFNGLTEXPARAMETERIIVPROC TexParameterIiv;
+	PFNGLTEXPARAMETERIUIVPROC TexParameterIuiv;
+	PFNGLTEXPARAMETERFPROC TexParameterf;
+	PFNGLTEXPARAMETERFVPROC TexParameterfv;
+	PFNGLTEXPARAMETERIPROC TexParameteri;
+	PFNGLTEXPARAMETERIVPROC TexParameteriv;
+	PFNGLTEXSTORAGE1DPROC TexStorage1D;
+	PFNGLTEXSTORAGE2DPROC TexStorage2D;
+	PFNGLTEXSTORAGE2DMULTISAMPLEPROC TexStorage2DMultisample;
+	PFNGLTEXSTORAGE3DPROC TexStorage3D;
+	PFNGLTEXSTORAGE3DMULTISAMPLEPROC TexStorage3DMultisample;
+	PFNGLTEXSUBIMAGE1DPROC TexSubImage1D;
+	PFNGLTEXSUBIMAGE2DPROC TexSubImage2D;
+	PFNGLTEXSUBIMAGE3DPROC TexSubImage3D;
+	PFNGLTEXTUREBARRIERPROC TextureBarrier;
+	PFNGLTEXTUREBUFFERPROC TextureBuffer;
+	PFNGLTEXTUREBUFFERRANGEPROC TextureBufferRange;
+	PFNGLTEXTUREPARAMETERIIVPROC TextureParameterIiv;
+	PFNGLTEXTUREPARAMETERIUIVPROC TextureParameterIuiv;
+	PFNGLTEXTUREPARAMETERFPROC TextureParameterf;
+	PFNGLTEXTUREPARAMETERFVPROC TextureParameterfv;
+	PFNGLTEXTUREPARAMETERIPROC TextureParameteri;
+	PFNGLTEXTUREPARAMETERIVPROC TextureParameteriv;
+	PFNGLTEXTURESTORAGE1DPROC TextureStorage1D;
+	PFNGLTEXTURESTORAGE2DPROC TextureStorage2D;
+	PFNGLTEXTURESTORAGE2DMULTISAMPLEPROC TextureStorage2DMultisample;
+	PFNGLTEXTURESTORAGE3DPROC TextureStorage3D;
+	PFNGLTEXTURESTORAGE3DMULTISAMPLEPROC TextureStorage3DMultisample;
+	PFNGLTEXTURESUBIMAGE1DPROC TextureSubImage1D;
+	PFNGLTEXTURESUBIMAGE2DPROC TextureSubImage2D;
+	PFNGLTEXTURESUBIMAGE3DPROC TextureSubImage3D;
+	PFNGLTEXTUREVIEWPROC TextureView;
+	PFNGLTRANSFORMFEEDBACKBUFFERBASEPROC TransformFeedbackBufferBase;
+	PFNGLTRANSFORMFEEDBACKBUFFERRANGEPROC TransformFeedbackBufferRange;
+	PFNGLTRANSFORMFEEDBACKVARYINGSPROC TransformFeedbackVaryings;
+	PFNGLTRANSLATEDPROC Translated;
+	PFNGLTRANSLATEFPROC Translatef;
+	PFNGLUNIFORM1DPROC Uniform1d;
+	PFNGLUNIFORM1DVPROC Uniform1dv;
+	PFNGLUNIFORM1FPROC Uniform1f;
+	PFNGLUNIFORM1FVPROC Uniform1fv;
+	PFNGLUNIFORM1IPROC Uniform1i;
+	PFNGLUNIFORM1IVPROC Uniform1iv;
+	PFNGLUNIFORM1UIPROC Uniform1ui;
+	PFNGLUNIFORM1UIVPROC Uniform1uiv;
+	PFNGLUNIFORM2DPROC Uniform2d;
+	PFNGLUNIFORM2DVPROC Uniform2dv;
+	PFNGLUNIFORM2FPROC Uniform2f;
+	PFNGLUNIFORM2FVPROC Uniform2fv;
+	PFNGLUNIFORM2IPROC Uniform2i;
+	PFNGLUNIFORM2IVPROC Uniform2iv;
+	PFNGLUNIFORM2UIPROC Uniform2ui;
+	PFNGLUNIFORM2UIVPROC Uniform2uiv;
+	PFNGLUNIFORM3DPROC Uniform3d;
+	PFNGLUNIFORM3DVPROC Uniform3dv;
+	PFNGLUNIFORM3FPROC Uniform3f;
+	PFNGLUNIFORM3FVPROC Uniform3fv;
+	PFNGLUNIFORM3IPROC Uniform3i;
+	PFNGLUNIFORM3IVPROC Uniform3iv;
+	PFNGLUNIFORM3UIPROC Uniform3ui;
+	PFNGLUNIFORM3UIVPROC Uniform3uiv;
+	PFNGLUNIFORM4DPROC Uniform4d;
+	PFNGLUNIFORM4DVPROC Uniform4dv;
+	PFNGLUNIFORM4FPROC Uniform4f;
+	PFNGLUNIFORM4FVPROC Uniform4fv;
+	PFNGLUNIFORM4IPROC Uniform4i;
+	PFNGLUNIFORM4IVPROC Uniform4iv;
+	PFNGLUNIFORM4UIPROC Uniform4ui;
+	PFNGLUNIFORM4UIVPROC Uniform4uiv;
+	PFNGLUNIFORMBLOCKBINDINGPROC UniformBlockBinding;
+	PFNGLUNIFORMHANDLEUI64ARBPROC UniformHandleui64ARB;
+	PFNGLUNIFORMHANDLEUI64VARBPROC UniformHandleui64vARB;
+	PFNGLUNIFORMMATRIX2DVPROC UniformMatrix2dv;
+	PFNGLUNIFORMMATRIX2FVPROC UniformMatrix2fv;
+	PFNGLUNIFORMMATRIX2X3DVPROC UniformMatrix2x3dv;
+	PFNGLUNIFORMMATRIX2X3FVPROC UniformMatrix2x3fv;
+	PFNGLUNIFORMMATRIX2X4DVPROC UniformMatrix2x4dv;
+	PFNGLUNIFORMMATRIX2X4FVPROC UniformMatrix2x4fv;
+	PFNGLUNIFORMMATRIX3DVPROC UniformMatrix3dv;
+	PFNGLUNIFORMMATRIX3FVPROC UniformMatrix3fv;
+	PFNGLUNIFORMMATRIX3X2DVPROC UniformMatrix3x2dv;
+	PFNGLUNIFORMMATRIX3X2FVPROC UniformMatrix3x2fv;
+	PFNGLUNIFORMMATRIX3X4DVPROC UniformMatrix3x4dv;
+	PFNGLUNIFORMMATRIX3X4FVPROC UniformMatrix3x4fv;
+	PFNGLUNIFORMMATRIX4DVPROC UniformMatrix4dv;
+	PFNGLUNIFORMMATRIX4FVPROC UniformMatrix4fv;
+	PFNGLUNIFORMMATRIX4X2DVPROC UniformMatrix4x2dv;
+	PFNGLUNIFORMMATRIX4X2FVPROC UniformMatrix4x2fv;
+	PFNGLUNIFORMMATRIX4X3DVPROC UniformMatrix4x3dv;
+	PFNGLUNIFORMMATRIX4X3FVPROC UniformMatrix4x3fv;
+	PFNGLUNIFORMSUBROUTINESUIVPROC UniformSubroutinesuiv;
+	PFNGLUNMAPBUFFERPROC UnmapBuffer;
+	PFNGLUNMAPNAMEDBUFFERPROC UnmapNamedBuffer;
+	PFNGLUSEPROGRAMPROC UseProgram;
+	PFNGLUSEPROGRAMSTAGESPROC UseProgramStages;
+	PFNGLVALIDATEPROGRAMPROC ValidateProgram;
+	PFNGLVALIDATEPROGRAMPIPELINEPROC ValidateProgramPipeline;
+	PFNGLVERTEX2DPROC Vertex2d;
+	PFNGLVERTEX2DVPROC Vertex2dv;
+	PFNGLVERTEX2FPROC Vertex2f;
+	PFNGLVERTEX2FVPROC Vertex2fv;
+	PFNGLVERTEX2IPROC Vertex2i;
+	PFNGLVERTEX2IVPROC Vertex2iv;
+	PFNGLVERTEX2SPROC Vertex2s;
+	PFNGLVERTEX2SVPROC Vertex2sv;
+	PFNGLVERTEX3DPROC Vertex3d;
+	PFNGLVERTEX3DVPROC Vertex3dv;
+	PFNGLVERTEX3FPROC Vertex3f;
+	PFNGLVERTEX3FVPROC Vertex3fv;
+	PFNGLVERTEX3IPROC Vertex3i;
+	PFNGLVERTEX3IVPROC Vertex3iv;
+	PFNGLVERTEX3SPROC Vertex3s;
+	PFNGLVERTEX3SVPROC Vertex3sv;
+	PFNGLVERTEX4DPROC Vertex4d;
+	PFNGLVERTEX4DVPROC Vertex4dv;
+	PFNGLVERTEX4FPROC Vertex4f;
+	PFNGLVERTEX4FVPROC Vertex4fv;
+	PFNGLVERTEX4IPROC Vertex4i;
+	PFNGLVERTEX4IVPROC Vertex4iv;
+	PFNGLVERTEX4SPROC Vertex4s;
+	PFNGLVERTEX4SVPROC Vertex4sv;
+	PFNGLVERTEXARRAYATTRIBBINDINGPROC VertexArrayAttribBinding;
+	PFNGLVERTEXARRAYATTRIBFORMATPROC VertexArrayAttribFormat;
+	PFNGLVERTEXARRAYATTRIBIFORMATPROC VertexArrayAttribIFormat;
+	PFNGLVERTEXARRAYATTRIBLFORMATPROC VertexArrayAttribLFormat;
+	PFNGLVERTEXARRAYBINDINGDIVISORPROC VertexArrayBindingDivisor;
+	PFNGLVERTEXARRAYELEMENTBUFFERPROC VertexArrayElementBuffer;
+	PFNGLVERTEXARRAYVERTEXBUFFERPROC VertexArrayVertexBuffer;
+	PFNGLVERTEXARRAYVERTEXBUFFERSPROC VertexArrayVertexBuffers;
+	PFNGLVERTEXATTRIB1DPROC VertexAttrib1d;
+	PFNGLVERTEXATTRIB1DVPROC VertexAttrib1dv;
+	PFNGLVERTEXATTRIB1FPROC VertexAttrib1f;
+	PFNGLVERTEXATTRIB1FVPROC VertexAttrib1fv;
+	PFNGLVERTEXATTRIB1SPROC VertexAttrib1s;
+	PFNGLVERTEXATTRIB1SVPROC VertexAttrib1sv;
+	PFNGLVERTEXATTRIB2DPROC VertexAttrib2d;
+	PFNGLVERTEXATTRIB2DVPROC VertexAttrib2dv;
+	PFNGLVERTEXATTRIB2FPROC VertexAttrib2f;
+	PFNGLVERTEXATTRIB2FVPROC VertexAttrib2fv;
+	PFNGLVERTEXATTRIB2SPROC VertexAttrib2s;
+	PFNGLVERTEXATTRIB2SVPROC VertexAttrib2sv;
+	PFNGLVERTEXATTRIB3DPROC VertexAttrib3d;
+	PFNGLVERTEXATTRIB3DVPROC VertexAttrib3dv;
+	PFNGLVERTEXATTRIB3FPROC VertexAttrib3f;
+	PFNGLVERTEXATTRIB3FVPROC VertexAttrib3fv;
+	PFNGLVERTEXATTRIB3SPROC VertexAttrib3s;
+	PFNGLVERTEXATTRIB3SVPROC VertexAttrib3sv;
+	PFNGLVERTEXATTRIB4NBVPROC VertexAttrib4Nbv;
+	PFNGLVERTEXATTRIB4NIVPROC VertexAttrib4Niv;
+	PFNGLVERTEXATTRIB4NSVPROC VertexAttrib4Nsv;
+	PFNGLVERTEXATTRIB4NUBPROC VertexAttrib4Nub;
+	PFNGLVERTEXATTRIB4NUBVPROC VertexAttrib4Nubv;
+	PFNGLVERTEXATTRIB4NUIVPROC VertexAttrib4Nuiv;
+	PFNGLVERTEXATTRIB4NUSVPROC VertexAttrib4Nusv;
+	PFNGLVERTEXATTRIB4BVPROC VertexAttrib4bv;
+	PFNGLVERTEXATTRIB4DPROC VertexAttrib4d;
+	PFNGLVERTEXATTRIB4DVPROC VertexAttrib4dv;
+	PFNGLVERTEXATTRIB4FPROC VertexAttrib4f;
+	PFNGLVERTEXATTRIB4FVPROC VertexAttrib4fv;
+	PFNGLVERTEXATTRIB4IVPROC VertexAttrib4iv;
+	PFNGLVERTEXATTRIB4SPROC VertexAttrib4s;
+	PFNGLVERTEXATTRIB4SVPROC VertexAttrib4sv;
+	PFNGLVERTEXATTRIB4UBVPROC VertexAttrib4ubv;
+	PFNGLVERTEXATTRIB4UIVPROC VertexAttrib4uiv;
+	PFNGLVERTEXATTRIB4USVPROC VertexAttrib4usv;
+	PFNGLVERTEXATTRIBBINDINGPROC VertexAttribBinding;
+	PFNGLVERTEXATTRIBDIVISORPROC VertexAttribDivisor;
+	PFNGLVERTEXATTRIBFORMATPROC VertexAttribFormat;
+	PFNGLVERTEXATTRIBI1IPROC VertexAttribI1i;
+	PFNGLVERTEXATTRIBI1IVPROC VertexAttribI1iv;
+	PFNGLVERTEXATTRIBI1UIPROC VertexAttribI1ui;
+	PFNGLVERTEXATTRIBI1UIVPROC VertexAttribI1uiv;
+	PFNGLVERTEXATTRIBI2IPROC VertexAttribI2i;
+	PFNGLVERTEXATTRIBI2IVPROC VertexAttribI2iv;
+	PFNGLVERTEXATTRIBI2UIPROC VertexAttribI2ui;
+	PFNGLVERTEXATTRIBI2UIVPROC VertexAttribI2uiv;
+	PFNGLVERTEXATTRIBI3IPROC VertexAttribI3i;
+	PFNGLVERTEXATTRIBI3IVPROC VertexAttribI3iv;
+	PFNGLVERTEXATTRIBI3UIPROC VertexAttribI3ui;
+	PFNGLVERTEXATTRIBI3UIVPROC VertexAttribI3uiv;
+	PFNGLVERTEXATTRIBI4BVPROC VertexAttribI4bv;
+	PFNGLVERTEXATTRIBI4IPROC VertexAttribI4i;
+	PFNGLVERTEXATTRIBI4IVPROC VertexAttribI4iv;
+	PFNGLVERTEXATTRIBI4SVPROC VertexAttribI4sv;
+	PFNGLVERTEXATTRIBI4UBVPROC VertexAttribI4ubv;
+	PFNGLVERTEXATTRIBI4UIPROC VertexAttribI4ui;
+	PFNGLVERTEXATTRIBI4UIVPROC VertexAttribI4uiv;
+	PFNGLVERTEXATTRIBI4USVPROC VertexAttribI4usv;
+	PFNGLVERTEXATTRIBIFORMATPROC VertexAttribIFormat;
+	PFNGLVERTEXATTRIBIPOINTERPROC VertexAttribIPointer;
+	PFNGLVERTEXATTRIBL1DPROC VertexAttribL1d;
+	PFNGLVERTEXATTRIBL1DVPROC VertexAttribL1dv;
+	PFNGLVERTEXATTRIBL1UI64ARBPROC VertexAttribL1ui64ARB;
+	PFNGLVERTEXATTRIBL1UI64VARBPROC VertexAttribL1ui64vARB;
+	PFNGLVERTEXATTRIBL2DPROC VertexAttribL2d;
+	PFNGLVERTEXATTRIBL2DVPROC VertexAttribL2dv;
+	PFNGLVERTEXATTRIBL3DPROC VertexAttribL3d;
+	PFNGLVERTEXATTRIBL3DVPROC VertexAttribL3dv;
+	PFNGLVERTEXATTRIBL4DPROC VertexAttribL4d;
+	PFNGLVERTEXATTRIBL4DVPROC VertexAttribL4dv;
+	PFNGLVERTEXATTRIBLFORMATPROC VertexAttribLFormat;
+	PFNGLVERTEXATTRIBLPOINTERPROC VertexAttribLPointer;
+	PFNGLVERTEXATTRIBP1UIPROC VertexAttribP1ui;
+	PFNGLVERTEXATTRIBP1UIVPROC VertexAttribP1uiv;
+	PFNGLVERTEXATTRIBP2UIPROC VertexAttribP2ui;
+	PFNGLVERTEXATTRIBP2UIVPROC VertexAttribP2uiv;
+	PFNGLVERTEXATTRIBP3UIPROC VertexAttribP3ui;
+	PFNGLVERTEXATTRIBP3UIVPROC VertexAttribP3uiv;
+	PFNGLVERTEXATTRIBP4UIPROC VertexAttribP4ui;
+	PFNGLVERTEXATTRIBP4UIVPROC VertexAttribP4uiv;
+	PFNGLVERTEXATTRIBPOINTERPROC VertexAttribPointer;
+	PFNGLVERTEXBINDINGDIVISORPROC VertexBindingDivisor;
+	PFNGLVERTEXP2UIPROC VertexP2ui;
+	PFNGLVERTEXP2UIVPROC VertexP2uiv;
+	PFNGLVERTEXP3UIPROC VertexP3ui;
+	PFNGLVERTEXP3UIVPROC VertexP3uiv;
+	PFNGLVERTEXP4UIPROC VertexP4ui;
+	PFNGLVERTEXP4UIVPROC VertexP4uiv;
+	PFNGLVERTEXPOINTERPROC VertexPointer;
+	PFNGLVIEWPORTPROC Viewport;
+	PFNGLVIEWPORTARRAYVPROC ViewportArrayv;
+	PFNGLVIEWPORTINDEXEDFPROC ViewportIndexedf;
+	PFNGLVIEWPORTINDEXEDFVPROC ViewportIndexedfv;
+	PFNGLWAITSYNCPROC WaitSync;
+	PFNGLWINDOWPOS2DPROC WindowPos2d;
+	PFNGLWINDOWPOS2DVPROC WindowPos2dv;
+	PFNGLWINDOWPOS2FPROC WindowPos2f;
+	PFNGLWINDOWPOS2FVPROC WindowPos2fv;
+	PFNGLWINDOWPOS2IPROC WindowPos2i;
+	PFNGLWINDOWPOS2IVPROC WindowPos2iv;
+	PFNGLWINDOWPOS2SPROC WindowPos2s;
+	PFNGLWINDOWPOS2SVPROC WindowPos2sv;
+	PFNGLWINDOWPOS3DPROC WindowPos3d;
+	PFNGLWINDOWPOS3DVPROC WindowPos3dv;
+	PFNGLWINDOWPOS3FPROC WindowPos3f;
+	PFNGLWINDOWPOS3FVPROC WindowPos3fv;
+	PFNGLWINDOWPOS3IPROC WindowPos3i;
+	PFNGLWINDOWPOS3IVPROC WindowPos3iv;
+	PFNGLWINDOWPOS3SPROC WindowPos3s;
+	PFNGLWINDOWPOS3SVPROC WindowPos3sv;
+};
+
+extern GLAD_THREAD_LOCAL struct GladGLContext* gladCurrentContext;
+
+/* loads the entry points of the context current on the calling thread into context, returns 0 on failure.
+   Goes through the process-wide loader, load one context at a time. */
+int gladLoadGLContext(struct GladGLContext* context, GLADloadproc load);
+/* selects the table the gl* calls of the calling thread go through, call after making the context current */
+void gladMakeContextCurrent(struct GladGLContext* context);
+struct GladGLContext* gladGetCurrentContext(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifndef GLAD_MX_NO_REDIRECT
+
+#undef GLAD_GL_VERSION_1_0
+#define GLAD_GL_VERSION_1_0 (gladCurrentContext->VERSION_1_0)
+#undef GLAD_GL_VERSION_1_1
+#define GLAD_GL_VERSION_1_1 (gladCurrentContext->VERSION_1_1)
+#undef GLAD_GL_VERSION_1_2
+#define GLAD_GL_VERSION_1_2 (gladCurrentContext->VERSION_1_2)
+#undef GLAD_GL_VERSION_1_3
+#define GLAD_GL_VERSION_1_3 (gladCurrentContext->VERSION_1_3)
+#undef GLAD_GL_VERSION_1_4
+#define GLAD_GL_VERSION_1_4 (gladCurrentContext->VERSION_1_4)
+#undef GLAD_GL_VERSION_1_5
+#define GLAD_GL_VERSION_1_5 (gladCurrentContext->VERSION_1_5)
+#undef GLAD_GL_VERSION_2_0
+#define GLAD_GL_VERSION_2_0 (gladCurrentContext->VERSION_2_0)
+#undef GLAD_GL_VERSION_2_1
+#define GLAD_GL_VERSION_2_1 (gladCurrentContext->VERSION_2_1)
+#undef GLAD_GL_VERSION_3_0
+#define GLAD_GL_VERSION_3_0 (gladCurrentContext->VERSION_3_0)
+#undef GLAD_GL_VERSION_3_1
+#define GLAD_GL_VERSION_3_1 (gladCurrentContext->VERSION_3_1)
+#undef GLAD_GL_VERSION_3_2
+#define GLAD_GL_VERSION_3_2 (gladCurrentContext->VERSION_3_2)
+#undef GLAD_GL_VERSION_3_3
+#define GLAD_GL_VERSION_3_3 (gladCurrentContext->VERSION_3_3)
+#undef GLAD_GL_VERSION_4_0
+#define GLAD_GL_VERSION_4_0 (gladCurrentContext->VERSION_4_0)
+#undef GLAD_GL_VERSION_4_1
+#define GLAD_GL_VERSION_4_1 (gladCurrentContext->VERSION_4_1)
+#undef GLAD_GL_VERSION_4_2
+#define GLAD_GL_VERSION_4_2 (gladCurrentContext->VERSION_4_2)
+#undef GLAD_GL_VERSION_4_3
+#define GLAD_GL_VERSION_4_3 (gladCurrentContext->VERSION_4_3)
+#undef GLAD_GL_VERSION_4_4
+#define GLAD_GL_VERSION_4_4 (gladCurrentContext->VERSION_4_4)
+#undef GLAD_GL_VERSION_4_5
+#define GLAD_GL_VERSION_4_5 (gladCurrentContext->VERSION_4_5)
+#undef GLAD_GL_VERSION_4_6
+#define GLAD_GL_VERSION_4_6 (gladCurrentContext->VERSION_4_6)
+#undef GLAD_GL_ARB_bindless_texture
+#define GLAD_GL_ARB_bindless_texture (gladCurrentContext->ARB_bindless_texture)
+#undef GLAD_GL_ARB_buffer_storage
+#define GLAD_GL_ARB_buffer_storage (gladCurrentContext->ARB_buffer_storage)
+#undef GLAD_GL_ARB_direct_state_access
+#define GLAD_GL_ARB_direct_state_access (gladCurrentContext->ARB_direct_state_access)
+#undef GLAD_GL_ARB_gl_spirv
+#define GLAD_GL_ARB_gl_spirv (gladCurrentContext->ARB_gl_spirv)
+#undef GLAD_GL_ARB_invalidate_subdata
+#define GLAD_GL_ARB_invalidate_subdata (gladCurrentContext->ARB_invalidate_subdata)
+#undef GLAD_GL_ARB_multi_draw_indirect
+#define GLAD_GL_ARB_multi_draw_indirect (gladCurrentContext->ARB_multi_draw_indirect)
+#undef GLAD_GL_ATI_meminfo
+#define GLAD_GL_ATI_meminfo (gladCurrentContext->ATI_meminfo)
+#undef GLAD_GL_KHR_debug
+#define GLAD_GL_KHR_debug (gladCurrentContext->KHR_debug)
+#undef GLAD_GL_KHR_parallel_shader_compile
+#define GLAD_GL_KHR_parallel_shader_compile (gladCurrentContext->KHR_parallel_shader_compile)
+#undef GLAD_GL_NVX_gpu_memory_info
+#define GLAD_GL_NVX_gpu_memory_info (gladCurrentContext->NVX_gpu_memory_info)
+#undef glAccum
+#define glAccum (gladCurrentContext->Accum)
+#undef glActiveShaderProgram
+#define glActiveShaderProgram (gladCurrentContext->ActiveShaderProgram)
+#undef glActiveTexture
+#define glActiveTexture (gladCurrentContext->ActiveTexture)
+#undef glAlphaFunc
+#define glAlphaFunc (gladCurrentContext->AlphaFunc)
+#undef glAreTexturesResident
+#define glAreTexturesResident (gladCurrentContext->AreTexturesResident)
+#undef glArrayElement
+#define glArrayElement (gladCurrentContext->ArrayElement)
+#undef glAttachShader
+#define glAttachShader (gladCurrentContext->AttachShader)
+#undef glBegin
+#define glBegin (gladCurrentContext->Begin)
+#undef glBeginConditionalRender
+#define glBeginConditionalRender (gladCurrentContext->BeginConditionalRender)
+#undef glBeginQuery
+#define glBeginQuery (gladCurrentContext->BeginQuery)
+#undef glBeginQueryIndexed
+#define glBeginQueryIndexed (gladCurrentContext->BeginQueryIndexed)
+#undef glBeginTransformFeedback
+#define glBeginTransformFeedback (gladCurrentContext->BeginTransformFeedback)
+#undef glBindAttribLocation
+#define glBindAttribLocation (gladCurrentContext->BindAttribLocation)
+#undef glBindBuffer
+#define glBindBuffer (gladCurrentContext->BindBuffer)
+#undef glBindBufferBase
+#define glBindBufferBase (gladCurrentContext->BindBufferBase)
+#undef glBindBufferRange
+#define glBindBufferRange (gladCurrentContext->BindBufferRange)
+#undef glBindBuffersBase
+#define glBindBuffersBase (gladCurrentContext->BindBuffersBase)
+#undef glBindBuffersRange
+#define glBindBuffersRange (gladCurrentContext->BindBuffersRange)
+#undef glBindFragDataLocation
+#define glBindFragDataLocation (gladCurrentContext->BindFragDataLocation)
+#undef glBindFragDataLocationIndexed
+#define glBindFragDataLocationIndexed (gladCurrentContext->BindFragDataLocationIndexed)
+#undef glBindFramebuffer
+#define glBindFramebuffer (gladCurrentContext->BindFramebuffer)
+#undef glBindImageTexture
+#define glBindImageTexture (gladCurrentContext->BindImageTexture)
+#undef glBindImageTextures
+#define glBindImageTextures (gladCurrentContext->BindImageTextures)
+#undef glBindProgramPipeline
+#define glBindProgramPipeline (gladCurrentContext->BindProgramPipeline)
+#undef glBindRenderbuffer
+#define glBindRenderbuffer (gladCurrentContext->BindRenderbuffer)
+#undef glBindSampler
+#define glBindSampler (gladCurrentContext->BindSampler)
+#undef glBindSamplers
+#define glBindSamplers (gladCurrentContext->BindSamplers)
+#undef glBindTexture
+#define glBindTexture (gladCurrentContext->BindTexture)
+#undef glBindTextureUnit
+#define glBindTextureUnit (gladCurrentContext->BindTextureUnit)
+#undef glBindTextures
+#define glBindTextures (gladCurrentContext->BindTextures)
+#undef glBindTransformFeedback
+#define glBindTransformFeedback (gladCurrentContext->BindTransformFeedback)
+#undef glBindVertexArray
+#define glBindVertexArray (gladCurrentContext->BindVertexArray)
+#undef glBindVertexBuffer
+#define glBindVertexBuffer (gladCurrentContext->BindVertexBuffer)
+#undef glBindVertexBuffers
+#define glBindVertexBuffers (gladCurrentContext->BindVertexBuffers)
+#undef glBitmap
+#define glBitmap (gladCurrentContext->Bitmap)
+#undef glBlendColor
+#define glBlendColor (gladCurrentContext->BlendColor)
+#undef glBlendEquation
+#define glBlendEquation (gladCurrentContext->BlendEquation)
+#undef glBlendEquationSeparate
+#define glBlendEquationSeparate (gladCurrentContext->BlendEquationSeparate)
+#undef glBlendEquationSeparatei
+#define glBlendEquationSeparatei (gladCurrentContext->BlendEquationSeparatei)
+#undef glBlendEquationi
+#define glBlendEquationi (gladCurrentContext->BlendEquationi)
+#undef glBlendFunc
+#define glBlendFunc (gladCurrentContext->BlendFunc)
+#undef glBlendFuncSeparate
+#define glBlendFuncSeparate (gladCurrentContext->BlendFuncSeparate)
+#undef glBlendFuncSeparatei
+#define glBlendFuncSeparatei (gladCurrentContext->BlendFuncSeparatei)
+#undef glBlendFunci
+#define glBlendFunci (gladCurrentContext->BlendFunci)
+#undef glBlitFramebuffer
+#define glBlitFramebuffer (gladCurrentContext->BlitFramebuffer)
+#undef glBlitNamedFramebuffer
+#define glBlitNamedFramebuffer (gladCurrentContext->BlitNamedFramebuffer)
+#undef glBufferData
+#define glBufferData (gladCurrentContext->BufferData)
+#undef glBufferStorage
+#define glBufferStorage (gladCurrentContext->BufferStorage)
+#undef glBufferSubData
+#define glBufferSubData (gladCurrentContext->BufferSubData)
+#undef glCallList
+#define glCallList (gladCurrentContext->CallList)
+#undef glCallLists
+#define glCallLists (gladCurrentContext->CallLists)
+#undef glCheckFramebufferStatus
+#define glCheckFramebufferStatus (gladCurrentContext->CheckFramebufferStatus)
+#undef glCheckNamedFramebufferStatus
+#define glCheckNamedFramebufferStatus (gladCurrentContext->CheckNamedFramebufferStatus)
+#undef glClampColor
+#define glClampColor (gladCurrentContext->ClampColor)
+#undef glClear
+#define glClear (gladCurrentContext->Clear)
+#undef glClearAccum
+#define glClearAccum (gladCurrentContext->ClearAccum)
+#undef glClearBufferData
+#define glClearBufferData (gladCurrentContext->ClearBufferData)
+#undef glClearBufferSubData
+#define glClearBufferSubData (gladCurrentContext->ClearBufferSubData)
+#undef glClearBufferfi
+#define glClearBufferfi (gladCurrentContext->ClearBufferfi)
+#undef glClearBufferfv
+#define glClearBufferfv (gladCurrentContext->ClearBufferfv)
+#undef glClearBufferiv
+#define glClearBufferiv (gladCurrentContext->ClearBufferiv)
+#undef glClearBufferuiv
+#define glClearBufferuiv (gladCurrentContext->ClearBufferuiv)
+#undef glClearColor
+#define glClearColor (gladCurrentContext->ClearColor)
+#undef glClearDepth
+#define glClearDepth (gladCurrentContext->ClearDepth)
+#undef glClearDepthf
+#define glClearDepthf (gladCurrentContext->ClearDepthf)
+#undef glClearIndex
+#define glClearIndex (gladCurrentContext->ClearIndex)
+#undef glClearNamedBufferData
+#define glClearNamedBufferData (gladCurrentContext->ClearNamedBufferData)
+#undef glClearNamedBufferSubData
+#define glClearNamedBufferSubData (gladCurrentContext->ClearNamedBufferSubData)
+#undef glClearNamedFramebufferfi
+#define glClearNamedFramebufferfi (gladCurrentContext->ClearNamedFramebufferfi)
+#undef glClearNamedFramebufferfv
+#define glClearNamedFramebufferfv (gladCurrentContext->ClearNamedFramebufferfv)
+#undef glClearNamedFramebufferiv
+#define glClearNamedFramebufferiv (gladCurrentContext->ClearNamedFramebufferiv)
+#undef glClearNamedFramebufferuiv
+#define glClearNamedFramebufferuiv (gladCurrentContext->ClearNamedFramebufferuiv)
+#undef glClearStencil
+#define glClearStencil (gladCurrentContext->ClearStencil)
+#undef glClearTexImage
+#define glClearTexImage (gladCurrentContext->ClearTexImage)
+#undef glClearTexSubImage
+#define glClearTexSubImage (gladCurrentContext->ClearTexSubImage)
+#undef glClientActiveTexture
+#define glClientActiveTexture (gladCurrentContext->ClientActiveTexture)
+#undef glClientWaitSync
+#define glClientWaitSync (gladCurrentContext->ClientWaitSync)
+#undef glClipControl
+#define glClipControl (gladCurrentContext->ClipControl)
+#undef glClipPlane
+#define glClipPlane (gladCurrentContext->ClipPlane)
+#undef glColor3b
+#define glColor3b (gladCurrentContext->Color3b)
+#undef glColor3bv
+#define glColor3bv (gladCurrentContext->Color3bv)
+#undef glColor3d
+#define glColor3d (gladCurrentContext->Color3d)
+#undef glColor3dv
+#define glColor3dv (gladCurrentContext->Color3dv)
+#undef glColor3f
+#define glColor3f (gladCurrentContext->Color3f)
+#undef glColor3fv
+#define glColor3fv (gladCurrentContext->Color3fv)
+#undef glColor3i
+#define glColor3i (gladCurrentContext->Color3i)
+#undef glColor3iv
+#define glColor3iv (gladCurrentContext->Color3iv)
+#undef glColor3s
+#define glColor3s (gladCurrentContext->Color3s)
+#undef glColor3sv
+#define glColor3sv (gladCurrentContext->Color3sv)
+#undef glColor3ub
+#define glColor3ub (gladCurrentContext->Color3ub)
+#undef glColor3ubv
+#define glColor3ubv (gladCurrentContext->Color3ubv)
+#undef glColor3ui
+#define glColor3ui (gladCurrentContext->Color3ui)
+#undef glColor3uiv
+#define glColor3uiv (gladCurrentContext->Color3uiv)
+#undef glColor3us
+#define glColor3us (gladCurrentContext->Color3us)
+#undef glColor3usv
+#define glColor3usv (gladCurrentContext->Color3usv)
+#undef glColor4b
+#define glColor4b (gladCurrentContext->Color4b)
+#undef glColor4bv
+#define glColor4bv (gladCurrentContext->Color4bv)
+#undef glColor4d
+#define glColor4d (gladCurrentContext->Color4d)
+#undef glColor4dv
+#define glColor4dv (gladCurrentContext->Color4dv)
+#undef glColor4f
+#define glColor4f (gladCurrentContext->Color4f)
+#undef glColor4fv
+#define glColor4fv (gladCurrentContext->Color4fv)
+#undef glColor4i
+#define glColor4i (gladCurrentContext->Color4i)
+#undef glColor4iv
+#define glColor4iv (gladCurrentContext->Color4iv)
+#undef glColor4s
+#define glColor4s (gladCurrentContext->Color4s)
+#undef glColor4sv
+#define glColor4sv (gladCurrentContext->Color4sv)
+#undef glColor4ub
+#define glColor4ub (gladCurrentContext->Color4ub)
+#undef glColor4ubv
+#define glColor4ubv (gladCurrentContext->Color4ubv)
+#undef glColor4ui
+#define glColor4ui (gladCurrentContext->Color4ui)
+#undef glColor4uiv
+#define glColor4uiv (gladCurrentContext->Color4uiv)
+#undef glColor4us
+#define glColor4us (gladCurrentContext->Color4us)
+#undef glColor4usv
+#define glColor4usv (gladCurrentContext->Color4usv)
+#undef glColorMask
+#define glColorMask (gladCurrentContext->ColorMask)
+#undef glColorMaski
+#define glColorMaski (gladCurrentContext->ColorMaski)
+#undef glColorMaterial
+#define glColorMaterial (gladCurrentContext->ColorMaterial)
+#undef glColorP3ui
+#define glColorP3ui (gladCurrentContext->ColorP3ui)
+#undef glColorP3uiv
+#define glColorP3uiv (gladCurrentContext->ColorP3uiv)
+#undef glColorP4ui
+#define glColorP4ui (gladCurrentContext->ColorP4ui)
+#undef glColorP4uiv
+#define glColorP4uiv (gladCurrentContext->ColorP4uiv)
+#undef glColorPointer
+#define glColorPointer (gladCurrentContext->ColorPointer)
+#undef glCompileShader
+#define glCompileShader (gladCurrentContext->CompileShader)
+#undef glCompressedTexImage1D
+#define glCompressedTexImage1D (gladCurrentContext->CompressedTexImage1D)
+#undef glCompressedTexImage2D
+#define glCompressedTexImage2D (gladCurrentContext->CompressedTexImage2D)
+#undef glCompressedTexImage3D
+#define glCompressedTexImage3D (gladCurrentContext->CompressedTexImage3D)
+#undef glCompressedTexSubImage1D
+#define glCompressedTexSubImage1D (gladCurrentContext->CompressedTexSubImage1D)
+#undef glCompressedTexSubImage2D
+#define glCompressedTexSubImage2D (gladCurrentContext->CompressedTexSubImage2D)
+#undef glCompressedTexSubImage3D
+#define glCompressedTexSubImage3D (gladCurrentContext->CompressedTexSubImage3D)
+#undef glCompressedTextureSubImage1D
+#define glCompressedTextureSubImage1D (gladCurrentContext->CompressedTextureSubImage1D)
+#undef glCompressedTextureSubImage2D
+#define glCompressedTextureSubImage2D (gladCurrentContext->CompressedTextureSubImage2D)
+#undef glCompressedTextureSubImage3D
+#define glCompressedTextureSubImage3D (gladCurrentContext->CompressedTextureSubImage3D)
+#undef glCopyBufferSubData
+#define glCopyBufferSubData (gladCurrentContext->CopyBufferSubData)
+#undef glCopyImageSubData
+#define glCopyImageSubData (gladCurrentContext->CopyImageSubData)
+#undef glCopyNamedBufferSubData
+#define glCopyNamedBufferSubData (gladCurrentContext->CopyNamedBufferSubData)
+#undef glCopyPixels
+#define glCopyPixels (gladCurrentContext->CopyPixels)
+#undef glCopyTexImage1D
+#define glCopyTexImage1D (gladCurrentContext->CopyTexImage1D)
+#undef glCopyTexImage2D
+#define glCopyTexImage2D (gladCurrentContext->CopyTexImage2D)
+#undef glCopyTexSubImage1D
+#define glCopyTexSubImage1D (gladCurrentContext->CopyTexSubImage1D)
+#undef glCopyTexSubImage2D
+#define glCopyTexSubImage2D (gladCurrentContext->CopyTexSubImage2D)
+#undef glCopyTexSubImage3D
+#define glCopyTexSubImage3D (gladCurrentContext->CopyTexSubImage3D)
+#undef glCopyTextureSubImage1D
+#define glCopyTextureSubImage1D (gladCurrentContext->CopyTextureSubImage1D)
+#undef glCopyTextureSubImage2D
+#define glCopyTextureSubImage2D (gladCurrentContext->CopyTextureSubImage2D)
+#undef glCopyTextureSubImage3D
+#define glCopyTextureSubImage3D (gladCurrentContext->CopyTextureSubImage3D)
+#undef glCreateBuffers
+#define glCreateBuffers (gladCurrentContext->CreateBuffers)
+#undef glCreateFramebuffers
+#define glCreateFramebuffers (gladCurrentContext->CreateFramebuffers)
+#undef glCreateProgram
+#define glCreateProgram (gladCurrentContext->CreateProgram)
+#undef glCreateProgramPipelines
+#define glCreateProgramPipelines (gladCurrentContext->CreateProgramPipelines)
+#undef glCreateQueries
+#define glCreateQueries (gladCurrentContext->CreateQueries)
+#undef glCreateRenderbuffers
+#define glCreateRenderbuffers (gladCurrentContext->CreateRenderbuffers)
+#undef glCreateSamplers
+#define glCreateSamplers (gladCurrentContext->CreateSamplers)
+#undef glCreateShader
+#define glCreateShader (gladCurrentContext->CreateShader)
+#undef glCreateShaderProgramv
+#define glCreateShaderProgramv (gladCurrentContext->CreateShaderProgramv)
+#undef glCreateTextures
+#define glCreateTextures (gladCurrentContext->CreateTextures)
+#undef glCreateTransformFeedbacks
+#define glCreateTransformFeedbacks (gladCurrentContext->CreateTransformFeedbacks)
+#undef glCreateVertexArrays
+#define glCreateVertexArrays (gladCurrentContext->CreateVertexArrays)
+#undef glCullFace
+#define glCullFace (gladCurrentContext->CullFace)
+#undef glDebugMessageCallback
+#define glDebugMessageCallback (gladCurrentContext->DebugMessageCallback)
+#undef glDebugMessageControl
+#define glDebugMessageControl (gladCurrentContext->DebugMessageControl)
+#undef glDebugMessageInsert
+#define glDebugMessageInsert (gladCurrentContext->DebugMessageInsert)
+#undef glDeleteBuffers
+#define glDeleteBuffers (gladCurrentContext->DeleteBuffers)
+#undef glDeleteFramebuffers
+#define glDeleteFramebuffers (gladCurrentContext->DeleteFramebuffers)
+#undef glDeleteLists
+#define glDeleteLists (gladCurrentContext->DeleteLists)
+#undef glDeleteProgram
+#define glDeleteProgram (gladCurrentContext->DeleteProgram)
+#undef glDeleteProgramPipelines
+#define glDeleteProgramPipelines (gladCurrentContext->DeleteProgramPipelines)
+#undef glDeleteQueries
+#define glDeleteQueries (gladCurrentContext->DeleteQueries)
+#undef glDeleteRenderbuffers
+#define glDeleteRenderbuffers (gladCurrentContext->DeleteRenderbuffers)
+#undef glDeleteSamplers
+#define glDeleteSamplers (gladCurrentContext->DeleteSamplers)
+#undef glDeleteShader
+#define glDeleteShader (gladCurrentContext->DeleteShader)
+#undef glDeleteSync
+#define glDeleteSync (gladCurrentContext->DeleteSync)
+#undef glDeleteTextures
+#define glDeleteTextures (gladCurrentContext->DeleteTextures)
+#undef glDeleteTransformFeedbacks
+#define glDeleteTransformFeedbacks (gladCurrentContext->DeleteTransformFeedbacks)
+#undef glDeleteVertexArrays
+#define glDeleteVertexArrays (gladCurrentContext->DeleteVertexArrays)
+#undef glDepthFunc
+#define glDepthFunc (gladCurrentContext->DepthFunc)
+#undef glDepthMask
+#define glDepthMask (gladCurrentContext->DepthMask)
+#undef glDepthRange
+#define glDepthRange (gladCurrentContext->DepthRange)
+#undef glDepthRangeArrayv
+#define glDepthRangeArrayv (gladCurrentContext->DepthRangeArrayv)
+#undef glDepthRangeIndexed
+#define glDepthRangeIndexed (gladCurrentContext->DepthRangeIndexed)
+#undef glDepthRangef
+#define glDepthRangef (gladCurrentContext->DepthRangef)
+#undef glDetachShader
+#define glDetachShader (gladCurrentContext->DetachShader)
+#undef glDisable
+#define glDisable (gladCurrentContext->Disable)
+#undef glDisableClientState
+#define glDisableClientState (gladCurrentContext->DisableClientState)
+#undef glDisableVertexArrayAttrib
+#define glDisableVertexArrayAttrib (gladCurrentContext->DisableVertexArrayAttrib)
+#undef glDisableVertexAttribArray
+#define glDisableVertexAttribArray (gladCurrentContext->DisableVertexAttribArray)
+#undef glDisablei
+#define glDisablei (gladCurrentContext->Disablei)
+#undef glDispatchCompute
+#define glDispatchCompute (gladCurrentContext->DispatchCompute)
+#undef glDispatchComputeIndirect
+#define glDispatchComputeIndirect (gladCurrentContext->DispatchComputeIndirect)
+#undef glDrawArrays
+#define glDrawArrays (gladCurrentContext->DrawArrays)
+#undef glDrawArraysIndirect
+#define glDrawArraysIndirect (gladCurrentContext->DrawArraysIndirect)
+#undef glDrawArraysInstanced
+#define glDrawArraysInstanced (gladCurrentContext->DrawArraysInstanced)
+#undef glDrawArraysInstancedBaseInstance
+#define glDrawArraysInstancedBaseInstance (gladCurrentContext->DrawArraysInstancedBaseInstance)
+#undef glDrawBuffer
+#define glDrawBuffer (gladCurrentContext->DrawBuffer)
+#undef glDrawBuffers
+#define glDrawBuffers (gladCurrentContext->DrawBuffers)
+#undef glDrawElements
+#define glDrawElements (gladCurrentContext->DrawElements)
+#undef glDrawElementsBaseVertex
+#define glDrawElementsBaseVertex (gladCurrentContext->DrawElementsBaseVertex)
+#undef glDrawElementsIndirect
+#define glDrawElementsIndirect (gladCurrentContext->DrawElementsIndirect)
+#undef glDrawElementsInstanced
+#define glDrawElementsInstanced (gladCurrentContext->DrawElementsInstanced)
+#undef glDrawElementsInstancedBaseInstance
+#define glDrawElementsInstancedBaseInstance (gladCurrentContext->DrawElementsInstancedBaseInstance)
+#undef glDrawElementsInstancedBaseVertex
+#define glDrawElementsInstancedBaseVertex (gladCurrentContext->DrawElementsInstancedBaseVertex)
+#undef glDrawElementsInstancedBaseVertexBaseInstance
+#define glDrawElementsInstancedBaseVertexBaseInstance (gladCurrentContext->DrawElementsInstancedBaseVertexBaseInstance)
+#undef glDrawPixels
+#define glDrawPixels (gladCurrentContext->DrawPixels)
+#undef glDrawRangeElements
+#define glDrawRangeElements (gladCurrentContext->DrawRangeElements)
+#undef glDrawRangeElementsBaseVertex
+#define glDrawRangeElementsBaseVertex (gladCurrentContext->DrawRangeElementsBaseVertex)
+#undef glDrawTransformFeedback
+#define glDrawTransformFeedback (gladCurrentContext->DrawTransformFeedback)
+#undef glDrawTransformFeedbackInstanced
+#define glDrawTransformFeedbackInstanced (gladCurrentContext->DrawTransformFeedbackInstanced)
+#undef glDrawTransformFeedbackStream
+#define glDrawTransformFeedbackStream (gladCurrentContext->DrawTransformFeedbackStream)
+#undef glDrawTransformFeedbackStreamInstanced
+#define glDrawTransformFeedbackStreamInstanced (gladCurrentContext->DrawTransformFeedbackStreamInstanced)
+#undef glEdgeFlag
+#define glEdgeFlag (gladCurrentContext->EdgeFlag)
+#undef glEdgeFlagPointer
+#define glEdgeFlagPointer (gladCurrentContext->EdgeFlagPointer)
+#undef glEdgeFlagv
+#define glEdgeFlagv (gladCurrentContext->EdgeFlagv)
+#undef glEnable
+#define glEnable (gladCurrentContext->Enable)
+#undef glEnableClientState
+#define glEnableClientState (gladCurrentContext->EnableClientState)
+#undef glEnableVertexArrayAttrib
+#define glEnableVertexArrayAttrib (gladCurrentContext->EnableVertexArrayAttrib)
+#undef glEnableVertexAttribArray
+#define glEnableVertexAttribArray (gladCurrentContext->EnableVertexAttribArray)
+#undef glEnablei
+#define glEnablei (gladCurrentContext->Enablei)
+#undef glEnd
+#define glEnd (gladCurrentContext->End)
+#undef glEndConditionalRender
+#define glEndConditionalRender (gladCurrentContext->EndConditionalRender)
+#undef glEndList
+#define glEndList (gladCurrentContext->EndList)
+#undef glEndQuery
+#define glEndQuery (gladCurrentContext->EndQuery)
+#undef glEndQueryIndexed
+#define glEndQueryIndexed (gladCurrentContext->EndQueryIndexed)
+#undef glEndTransformFeedback
+#define glEndTransformFeedback (gladCurrentContext->EndTransformFeedback)
+#undef glEvalCoord1d
+#define glEvalCoord1d (gladCurrentContext->EvalCoord1d)
+#undef glEvalCoord1dv
+#define glEvalCoord1dv (gladCurrentContext->EvalCoord1dv)
+#undef glEvalCoord1f
+#define glEvalCoord1f (gladCurrentContext->EvalCoord1f)
+#undef glEvalCoord1fv
+#define glEvalCoord1fv (gladCurrentContext->EvalCoord1fv)
+#undef glEvalCoord2d
+#define glEvalCoord2d (gladCurrentContext->EvalCoord2d)
+#undef glEvalCoord2dv
+#define glEvalCoord2dv (gladCurrentContext->EvalCoord2dv)
+#undef glEvalCoord2f
+#define glEvalCoord2f (gladCurrentContext->EvalCoord2f)
+#undef glEvalCoord2fv
+#define glEvalCoord2fv (gladCurrentContext->EvalCoord2fv)
+#undef glEvalMesh1
+#define glEvalMesh1 (gladCurrentContext->EvalMesh1)
+#undef glEvalMesh2
+#define glEvalMesh2 (gladCurrentContext->EvalMesh2)
+#undef glEvalPoint1
+#define glEvalPoint1 (gladCurrentContext->EvalPoint1)
+#undef glEvalPoint2
+#define glEvalPoint2 (gladCurrentContext->EvalPoint2)
+#undef glFeedbackBuffer
+#define glFeedbackBuffer (gladCurrentContext->FeedbackBuffer)
+#undef glFenceSync
+#define glFenceSync (gladCurrentContext->FenceSync)
+#undef glFinish
+#define glFinish (gladCurrentContext->Finish)
+#undef glFlush
+#define glFlush (gladCurrentContext->Flush)
+#undef glFlushMappedBufferRange
+#define glFlushMappedBufferRange (gladCurrentContext->FlushMappedBufferRange)
+#undef glFlushMappedNamedBufferRange
+#define glFlushMappedNamedBufferRange (gladCurrentContext->FlushMappedNamedBufferRange)
+#undef glFogCoordPointer
+#define glFogCoordPointer (gladCurrentContext->FogCoordPointer)
+#undef glFogCoordd
+#define glFogCoordd (gladCurrentContext->FogCoordd)
+#undef glFogCoorddv
+#define glFogCoorddv (gladCurrentContext->FogCoorddv)
+#undef glFogCoordf
+#define glFogCoordf (gladCurrentContext->FogCoordf)
+#undef glFogCoordfv
+#define glFogCoordfv (gladCurrentContext->FogCoordfv)
+#undef glFogf
+#define glFogf (gladCurrentContext->Fogf)
+#undef glFogfv
+#define glFogfv (gladCurrentContext->Fogfv)
+#undef glFogi
+#define glFogi (gladCurrentContext->Fogi)
+#undef glFogiv
+#define glFogiv (gladCurrentContext->Fogiv)
+#undef glFramebufferParameteri
+#define glFramebufferParameteri (gladCurrentContext->FramebufferParameteri)
+#undef glFramebufferRenderbuffer
+#define glFramebufferRenderbuffer (gladCurrentContext->FramebufferRenderbuffer)
+#undef glFramebufferTexture
+#define glFramebufferTexture (gladCurrentContext->FramebufferTexture)
+#undef glFramebufferTexture1D
+#define glFramebufferTexture1D (gladCurrentContext->FramebufferTexture1D)
+#undef glFramebufferTexture2D
+#define glFramebufferTexture2D (gladCurrentContext->FramebufferTexture2D)
+#undef glFramebufferTexture3D
+#define glFramebufferTexture3D (gladCurrentContext->FramebufferTexture3D)
+#undef glFramebufferTextureLayer
+#define glFramebufferTextureLayer (gladCurrentContext->FramebufferTextureLayer)
+#undef glFrontFace
+#define glFrontFace (gladCurrentContext->FrontFace)
+#undef glFrustum
+#define glFrustum (gladCurrentContext->Frustum)
+#undef glGenBuffers
+#define glGenBuffers (gladCurrentContext->GenBuffers)
+#undef glGenFramebuffers
+#define glGenFramebuffers (gladCurrentContext->GenFramebuffers)
+#undef glGenLists
+#define glGenLists (gladCurrentContext->GenLists)
+#undef glGenProgramPipelines
+#define glGenProgramPipelines (gladCurrentContext->GenProgramPipelines)
+#undef glGenQueries
+#define glGenQueries (gladCurrentContext->GenQueries)
+#undef glGenRenderbuffers
+#define glGenRenderbuffers (gladCurrentContext->GenRenderbuffers)
+#undef glGenSamplers
+#define glGenSamplers (gladCurrentContext->GenSamplers)
+#undef glGenTextures
+#define glGenTextures (gladCurrentContext->GenTextures)
+#undef glGenTransformFeedbacks
+#define glGenTransformFeedbacks (gladCurrentContext->GenTransformFeedbacks)
+#undef glGenVertexArrays
+#define glGenVertexArrays (gladCurrentContext->GenVertexArrays)
+#undef glGenerateMipmap
+#define glGenerateMipmap (gladCurrentContext->GenerateMipmap)
+#undef glGenerateTextureMipmap
+#define glGenerateTextureMipmap (gladCurrentContext->GenerateTextureMipmap)
+#undef glGetActiveAtomicCounterBufferiv
+#define glGetActiveAtomicCounterBufferiv (gladCurrentContext->GetActiveAtomicCounterBufferiv)
+#undef glGetActiveAttrib
+#define glGetActiveAttrib (gladCurrentContext->GetActiveAttrib)
+#undef glGetActiveSubroutineName
+#define glGetActiveSubroutineName (gladCurrentContext->GetActiveSubroutineName)
+#undef glGetActiveSubroutineUniformName
+#define glGetActiveSubroutineUniformName (gladCurrentContext->GetActiveSubroutineUniformName)
+#undef glGetActiveSubroutineUniformiv
+#define glGetActiveSubroutineUniformiv (gladCurrentContext->GetActiveSubroutineUniformiv)
+#undef glGetActiveUniform
+#define glGetActiveUniform (gladCurrentContext->GetActiveUniform)
+#undef glGetActiveUniformBlockName
+#define glGetActiveUniformBlockName (gladCurrentContext->GetActiveUniformBlockName)
+#undef glGetActiveUniformBlockiv
+#define glGetActiveUniformBlockiv (gladCurrentContext->GetActiveUniformBlockiv)
+#undef glGetActiveUniformName
+#define glGetActiveUniformName (gladCurrentContext->GetActiveUniformName)
+#undef glGetActiveUniformsiv
+#define glGetActiveUniformsiv (gladCurrentContext->GetActiveUniformsiv)
+#undef glGetAttachedShaders
+#define glGetAttachedShaders (gladCurrentContext->GetAttachedShaders)
+#undef glGetAttribLocation
+#define glGetAttribLocation (gladCurrentContext->GetAttribLocation)
+#undef glGetBooleani_v
+#define glGetBooleani_v (gladCurrentContext->GetBooleani_v)
+#undef glGetBooleanv
+#define glGetBooleanv (gladCurrentContext->GetBooleanv)
+#undef glGetBufferParameteri64v
+#define glGetBufferParameteri64v (gladCurrentContext->GetBufferParameteri64v)
+#undef glGetBufferParameteriv
+#define glGetBufferParameteriv (gladCurrentContext->GetBufferParameteriv)
+#undef glGetBufferPointerv
+#define glGetBufferPointerv (gladCurrentContext->GetBufferPointerv)
+#undef glGetBufferSubData
+#define glGetBufferSubData (gladCurrentContext->GetBufferSubData)
+#undef glGetClipPlane
+#define glGetClipPlane (gladCurrentContext->GetClipPlane)
+#undef glGetCompressedTexImage
+#define glGetCompressedTexImage (gladCurrentContext->GetCompressedTexImage)
+#undef glGetCompressedTextureImage
+#define glGetCompressedTextureImage (gladCurrentContext->GetCompressedTextureImage)
+#undef glGetCompressedTextureSubImage
+#define glGetCompressedTextureSubImage (gladCurrentContext->GetCompressedTextureSubImage)
+#undef glGetDebugMessageLog
+#define glGetDebugMessageLog (gladCurrentContext->GetDebugMessageLog)
+#undef glGetDoublei_v
+#define glGetDoublei_v (gladCurrentContext->GetDoublei_v)
+#undef glGetDoublev
+#define glGetDoublev (gladCurrentContext->GetDoublev)
+#undef glGetError
+#define glGetError (gladCurrentContext->GetError)
+#undef glGetFloati_v
+#define glGetFloati_v (gladCurrentContext->GetFloati_v)
+#undef glGetFloatv
+#define glGetFloatv (gladCurrentContext->GetFloatv)
+#undef glGetFragDataIndex
+#define glGetFragDataIndex (gladCurrentContext->GetFragDataIndex)
+#undef glGetFragDataLocation
+#define glGetFragDataLocation (gladCurrentContext->GetFragDataLocation)
+#undef glGetFramebufferAttachmentParameteriv
+#define glGetFramebufferAttachmentParameteriv (gladCurrentContext->GetFramebufferAttachmentParameteriv)
+#undef glGetFramebufferParameteriv
+#define glGetFramebufferParameteriv (gladCurrentContext->GetFramebufferParameteriv)
+#undef glGetGraphicsResetStatus
+#define glGetGraphicsResetStatus (gladCurrentContext->GetGraphicsResetStatus)
+#undef glGetImageHandleARB
+#define glGetImageHandleARB (gladCurrentContext->GetImageHandleARB)
+#undef glGetInteger64i_v
+#define glGetInteger64i_v (gladCurrentContext->GetInteger64i_v)
+#undef glGetInteger64v
+#define glGetInteger64v (gladCurrentContext->GetInteger64v)
+#undef glGetIntegeri_v
+#define glGetIntegeri_v (gladCurrentContext->GetIntegeri_v)
+#undef glGetIntegerv
+#define glGetIntegerv (gladCurrentContext->GetIntegerv)
+#undef glGetInternalformati64v
+#define glGetInternalformati64v (gladCurrentContext->GetInternalformati64v)
+#undef glGetInternalformativ
+#define glGetInternalformativ (gladCurrentContext->GetInternalformativ)
+#undef glGetLightfv
+#define glGetLightfv (gladCurrentContext->GetLightfv)
+#undef glGetLightiv
+#define glGetLightiv (gladCurrentContext->GetLightiv)
+#undef glGetMapdv
+#define glGetMapdv (gladCurrentContext->GetMapdv)
+#undef glGetMapfv
+#define glGetMapfv (gladCurrentContext->GetMapfv)
+#undef glGetMapiv
+#define glGetMapiv (gladCurrentContext->GetMapiv)
+#undef glGetMaterialfv
+#define glGetMaterialfv (gladCurrentContext->GetMaterialfv)
+#undef glGetMaterialiv
+#define glGetMaterialiv (gladCurrentContext->GetMaterialiv)
+#undef glGetMultisamplefv
+#define glGetMultisamplefv (gladCurrentContext->GetMultisamplefv)
+#undef glGetNamedBufferParameteri64v
+#define glGetNamedBufferParameteri64v (gladCurrentContext->GetNamedBufferParameteri64v)
+#undef glGetNamedBufferParameteriv
+#define glGetNamedBufferParameteriv (gladCurrentContext->GetNamedBufferParameteriv)
+#undef glGetNamedBufferPointerv
+#define glGetNamedBufferPointerv (gladCurrentContext->GetNamedBufferPointerv)
+#undef glGetNamedBufferSubData
+#define glGetNamedBufferSubData (gladCurrentContext->GetNamedBufferSubData)
+#undef glGetNamedFramebufferAttachmentParameteriv
+#define glGetNamedFramebufferAttachmentParameteriv (gladCurrentContext->GetNamedFramebufferAttachmentParameteriv)
+#undef glGetNamedFramebufferParameteriv
+#define glGetNamedFramebufferParameteriv (gladCurrentContext->GetNamedFramebufferParameteriv)
+#undef glGetNamedRenderbufferParameteriv
+#define glGetNamedRenderbufferParameteriv (gladCurrentContext->GetNamedRenderbufferParameteriv)
+#undef glGetObjectLabel
+#define glGetObjectLabel (gladCurrentContext->GetObjectLabel)
+#undef glGetObjectPtrLabel
+#define glGetObjectPtrLabel (gladCurrentContext->GetObjectPtrLabel)
+#undef glGetPixelMapfv
+#define glGetPixelMapfv (gladCurrentContext->GetPixelMapfv)
+#undef glGetPixelMapuiv
+#define glGetPixelMapuiv (gladCurrentContext->GetPixelMapuiv)
+#undef glGetPixelMapusv
+#define glGetPixelMapusv (gladCurrentContext->GetPixelMapusv)
+#undef glGetPointerv
+#define glGetPointerv (gladCurrentContext->GetPointerv)
+#undef glGetPolygonStipple
+#define glGetPolygonStipple (gladCurrentContext->GetPolygonStipple)
+#undef glGetProgramBinary
+#define glGetProgramBinary (gladCurrentContext->GetProgramBinary)
+#undef glGetProgramInfoLog
+#define glGetProgramInfoLog (gladCurrentContext->GetProgramInfoLog)
+#undef glGetProgramInterfaceiv
+#define glGetProgramInterfaceiv (gladCurrentContext->GetProgramInterfaceiv)
+#undef glGetProgramPipelineInfoLog
+#define glGetProgramPipelineInfoLog (gladCurrentContext->GetProgramPipelineInfoLog)
+#undef glGetProgramPipelineiv
+#define glGetProgramPipelineiv (gladCurrentContext->GetProgramPipelineiv)
+#undef glGetProgramResourceIndex
+#define glGetProgramResourceIndex (gladCurrentContext->GetProgramResourceIndex)
+#undef glGetProgramResourceLocation
+#define glGetProgramResourceLocation (gladCurrentContext->GetProgramResourceLocation)
+#undef glGetProgramResourceLocationIndex
+#define glGetProgramResourceLocationIndex (gladCurrentContext->GetProgramResourceLocationIndex)
+#undef glGetProgramResourceName
+#define glGetProgramResourceName (gladCurrentContext->GetProgramResourceName)
+#undef glGetProgramResourceiv
+#define glGetProgramResourceiv (gladCurrentContext->GetProgramResourceiv)
+#undef glGetProgramStageiv
+#define glGetProgramStageiv (gladCurrentContext->GetProgramStageiv)
+#undef glGetProgramiv
+#define glGetProgramiv (gladCurrentContext->GetProgramiv)
+#undef glGetQueryBufferObjecti64v
+#define glGetQueryBufferObjecti64v (gladCurrentContext->GetQueryBufferObjecti64v)
+#undef glGetQueryBufferObjectiv
+#define glGetQueryBufferObjectiv (gladCurrentContext->GetQueryBufferObjectiv)
+#undef glGetQueryBufferObjectui64v
+#define glGetQueryBufferObjectui64v (gladCurrentContext->GetQueryBufferObjectui64v)
+#undef glGetQueryBufferObjectuiv
+#define glGetQueryBufferObjectuiv (gladCurrentContext->GetQueryBufferObjectuiv)
+#undef glGetQueryIndexediv
+#define glGetQueryIndexediv (gladCurrentContext->GetQueryIndexediv)
+#undef glGetQueryObjecti64v
+#define glGetQueryObjecti64v (gladCurrentContext->GetQueryObjecti64v)
+#undef glGetQueryObjectiv
+#define glGetQueryObjectiv (gladCurrentContext->GetQueryObjectiv)
+#undef glGetQueryObjectui64v
+#define glGetQueryObjectui64v (gladCurrentContext->GetQueryObjectui64v)
+#undef glGetQueryObjectuiv
+#define glGetQueryObjectuiv (gladCurrentContext->GetQueryObjectuiv)
+#undef glGetQueryiv
+#define glGetQueryiv (gladCurrentContext->GetQueryiv)
+#undef glGetRenderbufferParameteriv
+#define glGetRenderbufferParameteriv (gladCurrentContext->GetRenderbufferParameteriv)
+#undef glGetSamplerParameterIiv
+#define glGetSamplerParameterIiv (gladCurrentContext->GetSamplerParameterIiv)
+#undef glGetSamplerParameterIuiv
+#define glGetSamplerParameterIuiv (gladCurrentContext->GetSamplerParameterIuiv)
+#undef glGetSamplerParameterfv
+#define glGetSamplerParameterfv (gladCurrentContext->GetSamplerParameterfv)
+#undef glGetSamplerParameteriv
+#define glGetSamplerParameteriv (gladCurrentContext->GetSamplerParameteriv)
+#undef glGetShaderInfoLog
+#define glGetShaderInfoLog (gladCurrentContext->GetShaderInfoLog)
+#undef glGetShaderPrecisionFormat
+#define glGetShaderPrecisionFormat (gladCurrentContext->GetShaderPrecisionFormat)
+#undef glGetShaderSource
+#define glGetShaderSource (gladCurrentContext->GetShaderSource)
+#undef glGetShaderiv
+#define glGetShaderiv (gladCurrentContext->GetShaderiv)
+#undef glGetString
+#define glGetString (gladCurrentContext->GetString)
+#undef glGetStringi
+#define glGetStringi (gladCurrentContext->GetStringi)
+#undef glGetSubroutineIndex
+#define glGetSubroutineIndex (gladCurrentContext->GetSubroutineIndex)
+#undef glGetSubroutineUniformLocation
+#define glGetSubroutineUniformLocation (gladCurrentContext->GetSubroutineUniformLocation)
+#undef glGetSynciv
+#define glGetSynciv (gladCurrentContext->GetSynciv)
+#undef glGetTexEnvfv
+#define glGetTexEnvfv (gladCurrentContext->GetTexEnvfv)
+#undef glGetTexEnviv
+#define glGetTexEnviv (gladCurrentContext->GetTexEnviv)
+#undef glGetTexGendv
+#define glGetTexGendv (gladCurrentContext->GetTexGendv)
+#undef glGetTexGenfv
+#define glGetTexGenfv (gladCurrentContext->GetTexGenfv)
+#undef glGetTexGeniv
+#define glGetTexGeniv (gladCurrentContext->GetTexGeniv)
+#undef glGetTexImage
+#define glGetTexImage (gladCurrentContext->GetTexImage)
+#undef glGetTexLevelParameterfv
+#define glGetTexLevelParameterfv (gladCurrentContext->GetTexLevelParameterfv)
+#undef glGetTexLevelParameteriv
+#define glGetTexLevelParameteriv (gladCurrentContext->GetTexLevelParameteriv)
+#undef glGetTexParameterIiv
+#define glGetTexParameterIiv (gladCurrentContext->GetTexParameterIiv)
+#undef glGetTexParameterIuiv
+#define glGetTexParameterIuiv (gladCurrentContext->GetTexParameterIuiv)
+#undef glGetTexParameterfv
+#define glGetTexParameterfv (gladCurrentContext->GetTexParameterfv)
+#undef glGetTexParameteriv
+#define glGetTexParameteriv (gladCurrentContext->GetTexParameteriv)
+#undef glGetTextureHandleARB
+#define glGetTextureHandleARB (gladCurrentContext->GetTextureHandleARB)
+#undef glGetTextureImage
+#define glGetTextureImage (gladCurrentContext->GetTextureImage)
+#undef glGetTextureLevelParameterfv
+#define glGetTextureLevelParameterfv (gladCurrentContext->GetTextureLevelParameterfv)
+#undef glGetTextureLevelParameteriv
+#define glGetTextureLevelParameteriv (gladCurrentContext->GetTextureLevelParameteriv)
+#undef glGetTextureParameterIiv
+#define glGetTextureParameterIiv (gladCurrentContext->GetTextureParameterIiv)
+#undef glGetTextureParameterIuiv
+#define glGetTextureParameterIuiv (gladCurrentContext->GetTextureParameterIuiv)
+#undef glGetTextureParameterfv
+#define glGetTextureParameterfv (gladCurrentContext->GetTextureParameterfv)
+#undef glGetTextureParameteriv
+#define glGetTextureParameteriv (gladCurrentContext->GetTextureParameteriv)
+#undef glGetTextureSamplerHandleARB
+#define glGetTextureSamplerHandleARB (gladCurrentContext->GetTextureSamplerHandleARB)
+#undef glGetTextureSubImage
+#define glGetTextureSubImage (gladCurrentContext->GetTextureSubImage)
+#undef glGetTransformFeedbackVarying
+#define glGetTransformFeedbackVarying (gladCurrentContext->GetTransformFeedbackVarying)
+#undef glGetTransformFeedbacki64_v
+#define glGetTransformFeedbacki64_v (gladCurrentContext->GetTransformFeedbacki64_v)
+#undef glGetTransformFeedbacki_v
+#define glGetTransformFeedbacki_v (gladCurrentContext->GetTransformFeedbacki_v)
+#undef glGetTransformFeedbackiv
+#define glGetTransformFeedbackiv (gladCurrentContext->GetTransformFeedbackiv)
+#undef glGetUniformBlockIndex
+#define glGetUniformBlockIndex (gladCurrentContext->GetUniformBlockIndex)
+#undef glGetUniformIndices
+#define glGetUniformIndices (gladCurrentContext->GetUniformIndices)
+#undef glGetUniformLocation
+#define glGetUniformLocation (gladCurrentContext->GetUniformLocation)
+#undef glGetUniformSubroutineuiv
+#define glGetUniformSubroutineuiv (gladCurrentContext->GetUniformSubroutineuiv)
+#undef glGetUniformdv
+#define glGetUniformdv (gladCurrentContext->GetUniformdv)
+#undef glGetUniformfv
+#define glGetUniformfv (gladCurrentContext->GetUniformfv)
+#undef glGetUniformiv
+#define glGetUniformiv (gladCurrentContext->GetUniformiv)
+#undef glGetUniformuiv
+#define glGetUniformuiv (gladCurrentContext->GetUniformuiv)
+#undef glGetVertexArrayIndexed64iv
+#define glGetVertexArrayIndexed64iv (gladCurrentContext->GetVertexArrayIndexed64iv)
+#undef glGetVertexArrayIndexediv
+#define glGetVertexArrayIndexediv (gladCurrentContext->GetVertexArrayIndexediv)
+#undef glGetVertexArrayiv
+#define glGetVertexArrayiv (gladCurrentContext->GetVertexArrayiv)
+#undef glGetVertexAttribIiv
+#define glGetVertexAttribIiv (gladCurrentContext->GetVertexAttribIiv)
+#undef glGetVertexAttribIuiv
+#define glGetVertexAttribIuiv (gladCurrentContext->GetVertexAttribIuiv)
+#undef glGetVertexAttribLdv
+#define glGetVertexAttribLdv (gladCurrentContext->GetVertexAttribLdv)
+#undef glGetVertexAttribLui64vARB
+#define glGetVertexAttribLui64vARB (gladCurrentContext->GetVertexAttribLui64vARB)
+#undef glGetVertexAttribPointerv
+#define glGetVertexAttribPointerv (gladCurrentContext->GetVertexAttribPointerv)
+#undef glGetVertexAttribdv
+#define glGetVertexAttribdv (gladCurrentContext->GetVertexAttribdv)
+#undef glGetVertexAttribfv
+#define glGetVertexAttribfv (gladCurrentContext->GetVertexAttribfv)
+#undef glGetVertexAttribiv
+#define glGetVertexAttribiv (gladCurrentContext->GetVertexAttribiv)
+#undef glGetnColorTable
+#define glGetnColorTable (gladCurrentContext->GetnColorTable)
+#undef glGetnCompressedTexImage
+#define glGetnCompressedTexImage (gladCurrentContext->GetnCompressedTexImage)
+#undef glGetnConvolutionFilter
+#define glGetnConvolutionFilter (gladCurrentContext->GetnConvolutionFilter)
+#undef glGetnHistogram
+#define glGetnHistogram (gladCurrentContext->GetnHistogram)
+#undef glGetnMapdv
+#define glGetnMapdv (gladCurrentContext->GetnMapdv)
+#undef glGetnMapfv
+#define glGetnMapfv (gladCurrentContext->GetnMapfv)
+#undef glGetnMapiv
+#define glGetnMapiv (gladCurrentContext->GetnMapiv)
+#undef glGetnMinmax
+#define glGetnMinmax (gladCurrentContext->GetnMinmax)
+#undef glGetnPixelMapfv
+#define glGetnPixelMapfv (gladCurrentContext->GetnPixelMapfv)
+#undef glGetnPixelMapuiv
+#define glGetnPixelMapuiv (gladCurrentContext->GetnPixelMapuiv)
+#undef glGetnPixelMapusv
+#define glGetnPixelMapusv (gladCurrentContext->GetnPixelMapusv)
+#undef glGetnPolygonStipple
+#define glGetnPolygonStipple (gladCurrentContext->GetnPolygonStipple)
+#undef glGetnSeparableFilter
+#define glGetnSeparableFilter (gladCurrentContext->GetnSeparableFilter)
+#undef glGetnTexImage
+#define glGetnTexImage (gladCurrentContext->GetnTexImage)
+#undef glGetnUniformdv
+#define glGetnUniformdv (gladCurrentContext->GetnUniformdv)
+#undef glGetnUniformfv
+#define glGetnUniformfv (gladCurrentContext->GetnUniformfv)
+#undef glGetnUniformiv
+#define glGetnUniformiv (gladCurrentContext->GetnUniformiv)
+#undef glGetnUniformuiv
+#define glGetnUniformuiv (gladCurrentContext->GetnUniformuiv)
+#undef glHint
+#define glHint (gladCurrentContext->Hint)
+#undef glIndexMask
+#define glIndexMask (gladCurrentContext->IndexMask)
+#undef glIndexPointer
+#define glIndexPointer (gladCurrentContext->IndexPointer)
+#undef glIndexd
+#define glIndexd (gladCurrentContext->Indexd)
+#undef glIndexdv
+#define glIndexdv (gladCurrentContext->Indexdv)
+#undef glIndexf
+#define glIndexf (gladCurrentContext->Indexf)
+#undef glIndexfv
+#define glIndexfv (gladCurrentContext->Indexfv)
+#undef glIndexi
+#define glIndexi (gladCurrentContext->Indexi)
+#undef glIndexiv
+#define glIndexiv (gladCurrentContext->Indexiv)
+#undef glIndexs
+#define glIndexs (gladCurrentContext->Indexs)
+#undef glIndexsv
+#define glIndexsv (gladCurrentContext->Indexsv)
+#undef glIndexub
+#define glIndexub (gladCurrentContext->Indexub)
+#undef glIndexubv
+#define glIndexubv (gladCurrentContext->Indexubv)
+#undef glInitNames
+#define glInitNames (gladCurrentContext->InitNames)
+#undef glInterleavedArrays
+#define glInterleavedArrays (gladCurrentContext->InterleavedArrays)
+#undef glInvalidateBufferData
+#define glInvalidateBufferData (gladCurrentContext->InvalidateBufferData)
+#undef glInvalidateBufferSubData
+#define glInvalidateBufferSubData (gladCurrentContext->InvalidateBufferSubData)
+#undef glInvalidateFramebuffer
+#define glInvalidateFramebuffer (gladCurrentContext->InvalidateFramebuffer)
+#undef glInvalidateNamedFramebufferData
+#define glInvalidateNamedFramebufferData (gladCurrentContext->InvalidateNamedFramebufferData)
+#undef glInvalidateNamedFramebufferSubData
+#define glInvalidateNamedFramebufferSubData (gladCurrentContext->InvalidateNamedFramebufferSubData)
+#undef glInvalidateSubFramebuffer
+#define glInvalidateSubFramebuffer (gladCurrentContext->InvalidateSubFramebuffer)
+#undef glInvalidateTexImage
+#define glInvalidateTexImage (gladCurrentContext->InvalidateTexImage)
+#undef glInvalidateTexSubImage
+#define glInvalidateTexSubImage (gladCurrentContext->InvalidateTexSubImage)
+#undef glIsBuffer
+#define glIsBuffer (gladCurrentContext->IsBuffer)
+#undef glIsEnabled
+#define glIsEnabled (gladCurrentContext->IsEnabled)
+#undef glIsEnabledi
+#define glIsEnabledi (gladCurrentContext->IsEnabledi)
+#undef glIsFramebuffer
+#define glIsFramebuffer (gladCurrentContext->IsFramebuffer)
+#undef glIsImageHandleResidentARB
+#define glIsImageHandleResidentARB (gladCurrentContext->IsImageHandleResidentARB)
+#undef glIsList
+#define glIsList (gladCurrentContext->IsList)
+#undef glIsProgram
+#define glIsProgram (gladCurrentContext->IsProgram)
+#undef glIsProgramPipeline
+#define glIsProgramPipeline (gladCurrentContext->IsProgramPipeline)
+#undef glIsQuery
+#define glIsQuery (gladCurrentContext->IsQuery)
+#undef glIsRenderbuffer
+#define glIsRenderbuffer (gladCurrentContext->IsRenderbuffer)
+#undef glIsSampler
+#define glIsSampler (gladCurrentContext->IsSampler)
+#undef glIsShader
+#define glIsShader (gladCurrentContext->IsShader)
+#undef glIsSync
+#define glIsSync (gladCurrentContext->IsSync)
+#undef glIsTexture
+#define glIsTexture (gladCurrentContext->IsTexture)
+#undef glIsTextureHandleResidentARB
+#define glIsTextureHandleResidentARB (gladCurrentContext->IsTextureHandleResidentARB)
+#undef glIsTransformFeedback
+#define glIsTransformFeedback (gladCurrentContext->IsTransformFeedback)
+#undef glIsVertexArray
+#define glIsVertexArray (gladCurrentContext->IsVertexArray)
+#undef glLightModelf
+#define glLightModelf (gladCurrentContext->LightModelf)
+#undef glLightModelfv
+#define glLightModelfv (gladCurrentContext->LightModelfv)
+#undef glLightModeli
+#define glLightModeli (gladCurrentContext->LightModeli)
+#undef glLightModeliv
+#define glLightModeliv (gladCurrentContext->LightModeliv)
+#undef glLightf
+#define glLightf (gladCurrentContext->Lightf)
+#undef glLightfv
+#define glLightfv (gladCurrentContext->Lightfv)
+#undef glLighti
+#define glLighti (gladCurrentContext->Lighti)
+#undef glLightiv
+#define glLightiv (gladCurrentContext->Lightiv)
+#undef glLineStipple
+#define glLineStipple (gladCurrentContext->LineStipple)
+#undef glLineWidth
+#define glLineWidth (gladCurrentContext->LineWidth)
+#undef glLinkProgram
+#define glLinkProgram (gladCurrentContext->LinkProgram)
+#undef glListBase
+#define glListBase (gladCurrentContext->ListBase)
+#undef glLoadIdentity
+#define glLoadIdentity (gladCurrentContext->LoadIdentity)
+#undef glLoadMatrixd
+#define glLoadMatrixd (gladCurrentContext->LoadMatrixd)
+#undef glLoadMatrixf
+#define glLoadMatrixf (gladCurrentContext->LoadMatrixf)
+#undef glLoadName
+#define glLoadName (gladCurrentContext->LoadName)
+#undef glLoadTransposeMatrixd
+#define glLoadTransposeMatrixd (gladCurrentContext->LoadTransposeMatrixd)
+#undef glLoadTransposeMatrixf
+#define glLoadTransposeMatrixf (gladCurrentContext->LoadTransposeMatrixf)
+#undef glLogicOp
+#define glLogicOp (gladCurrentContext->LogicOp)
+#undef glMakeImageHandleNonResidentARB
+#define glMakeImageHandleNonResidentARB (gladCurrentContext->MakeImageHandleNonResidentARB)
+#undef glMakeImageHandleResidentARB
+#define glMakeImageHandleResidentARB (gladCurrentContext->MakeImageHandleResidentARB)
+#undef glMakeTextureHandleNonResidentARB
+#define glMakeTextureHandleNonResidentARB (gladCurrentContext->MakeTextureHandleNonResidentARB)
+#undef glMakeTextureHandleResidentARB
+#define glMakeTextureHandleResidentARB (gladCurrentContext->MakeTextureHandleResidentARB)
+#undef glMap1d
+#define glMap1d (gladCurrentContext->Map1d)
+#undef glMap1f
+#define glMap1f (gladCurrentContext->Map1f)
+#undef glMap2d
+#define glMap2d (gladCurrentContext->Map2d)
+#undef glMap2f
+#define glMap2f (gladCurrentContext->Map2f)
+#undef glMapBuffer
+#define glMapBuffer (gladCurrentContext->MapBuffer)
+#undef glMapBufferRange
+#define glMapBufferRange (gladCurrentContext->MapBufferRange)
+#undef glMapGrid1d
+#define glMapGrid1d (gladCurrentContext->MapGrid1d)
+#undef glMapGrid1f
+#define glMapGrid1f (gladCurrentContext->MapGrid1f)
+#undef glMapGrid2d
+#define glMapGrid2d (gladCurrentContext->MapGrid2d)
+#undef glMapGrid2f
+#define glMapGrid2f (gladCurrentContext->MapGrid2f)
+#undef glMapNamedBuffer
+#define glMapNamedBuffer (gladCurrentContext->MapNamedBuffer)
+#undef glMapNamedBufferRange
+#define glMapNamedBufferRange (gladCurrentContext->MapNamedBufferRange)
+#undef glMaterialf
+#define glMaterialf (gladCurrentContext->Materialf)
+#undef glMaterialfv
+#define glMaterialfv (gladCurrentContext->Materialfv)
+#undef glMateriali
+#define glMateriali (gladCurrentContext->Materiali)
+#undef glMaterialiv
+#define glMaterialiv (gladCurrentContext->Materialiv)
+#undef glMatrixMode
+#define glMatrixMode (gladCurrentContext->MatrixMode)
+#undef glMaxShaderCompilerThreadsKHR
+#define glMaxShaderCompilerThreadsKHR (gladCurrentContext->MaxShaderCompilerThreadsKHR)
+#undef glMemoryBarrier
+#define glMemoryBarrier (gladCurrentContext->MemoryBarrier)
+#undef glMemoryBarrierByRegion
+#define glMemoryBarrierByRegion (gladCurrentContext->MemoryBarrierByRegion)
+#undef glMinSampleShading
+#define glMinSampleShading (gladCurrentContext->MinSampleShading)
+#undef glMultMatrixd
+#define glMultMatrixd (gladCurrentContext->MultMatrixd)
+#undef glMultMatrixf
+#define glMultMatrixf (gladCurrentContext->MultMatrixf)
+#undef glMultTransposeMatrixd
+#define glMultTransposeMatrixd (gladCurrentContext->MultTransposeMatrixd)
+#undef glMultTransposeMatrixf
+#define glMultTransposeMatrixf (gladCurrentContext->MultTransposeMatrixf)
+#undef glMultiDrawArrays
+#define glMultiDrawArrays (gladCurrentContext->MultiDrawArrays)
+#undef glMultiDrawArraysIndirect
+#define glMultiDrawArraysIndirect (gladCurrentContext->MultiDrawArraysIndirect)
+#undef glMultiDrawArraysIndirectCount
+#define glMultiDrawArraysIndirectCount (gladCurrentContext->MultiDrawArraysIndirectCount)
+#undef glMultiDrawElements
+#define glMultiDrawElements (gladCurrentContext->MultiDrawElements)
+#undef glMultiDrawElementsBaseVertex
+#define glMultiDrawElementsBaseVertex (gladCurrentContext->MultiDrawElementsBaseVertex)
+#undef glMultiDrawElementsIndirect
+#define glMultiDrawElementsIndirect (gladCurrentContext->MultiDrawElementsIndirect)
+#undef glMultiDrawElementsIndirectCount
+#define glMultiDrawElementsIndirectCount (gladCurrentContext->MultiDrawElementsIndirectCount)
+#undef glMultiTexCoord1d
+#define glMultiTexCoord1d (gladCurrentContext->MultiTexCoord1d)
+#undef glMultiTexCoord1dv
+#define glMultiTexCoord1dv (gladCurrentContext->MultiTexCoord1dv)
+#undef glMultiTexCoord1f
+#define glMultiTexCoord1f (gladCurrentContext->MultiTexCoord1f)
+#undef glMultiTexCoord1fv
+#define glMultiTexCoord1fv (gladCurrentContext->MultiTexCoord1fv)
+#undef glMultiTexCoord1i
+#define glMultiTexCoord1i (gladCurrentContext->MultiTexCoord1i)
+#undef glMultiTexCoord1iv
+#define glMultiTexCoord1iv (gladCurrentContext->MultiTexCoord1iv)
+#undef glMultiTexCoord1s
+#define glMultiTexCoord1s (gladCurrentContext->MultiTexCoord1s)
+#undef glMultiTexCoord1sv
+#define glMultiTexCoord1sv (gladCurrentContext->MultiTexCoord1sv)
+#undef glMultiTexCoord2d
+#define glMultiTexCoord2d (gladCurrentContext->MultiTexCoord2d)
+#undef glMultiTexCoord2dv
+#define glMultiTexCoord2dv (gladCurrentContext->MultiTexCoord2dv)
+#undef glMultiTexCoord2f
+#define glMultiTexCoord2f (gladCurrentContext->MultiTexCoord2f)
+#undef glMultiTexCoord2fv
+#define glMultiTexCoord2fv (gladCurrentContext->MultiTexCoord2fv)
+#undef glMultiTexCoord2i
+#define glMultiTexCoord2i (gladCurrentContext->MultiTexCoord2i)
+#undef glMultiTexCoord2iv
+#define glMultiTexCoord2iv (gladCurrentContext->MultiTexCoord2iv)
+#undef glMultiTexCoord2s
+#define glMultiTexCoord2s (gladCurrentContext->MultiTexCoord2s)
+#undef glMultiTexCoord2sv
+#define glMultiTexCoord2sv (gladCurrentContext->MultiTexCoord2sv)
+#undef glMultiTexCoord3d
+#define glMultiTexCoord3d (gladCurrentContext->MultiTexCoord3d)
+#undef glMultiTexCoord3dv
+#define glMultiTexCoord3dv (gladCurrentContext->MultiTexCoord3dv)
+#undef glMultiTexCoord3f
+#define glMultiTexCoord3f (gladCurrentContext->MultiTexCoord3f)
+#undef glMultiTexCoord3fv
+#define glMultiTexCoord3fv (gladCurrentContext->MultiTexCoord3fv)
+#undef glMultiTexCoord3i
+#define glMultiTexCoord3i (gladCurrentContext->MultiTexCoord3i)
+#undef glMultiTexCoord3iv
+#define glMultiTexCoord3iv (gladCurrentContext->MultiTexCoord3iv)
+#undef glMultiTexCoord3s
+#define glMultiTexCoord3s (gladCurrentContext->MultiTexCoord3s)
+#undef glMultiTexCoord3sv
+#define glMultiTexCoord3sv (gladCurrentContext->MultiTexCoord3sv)
+#undef glMultiTexCoord4d
+#define glMultiTexCoord4d (gladCurrentContext->MultiTexCoord4d)
+#undef glMultiTexCoord4dv
+#define glMultiTexCoord4dv (gladCurrentContext->MultiTexCoord4dv)
+#undef glMultiTexCoord4f
+#define glMultiTexCoord4f (gladCurrentContext->MultiTexCoord4f)
+#undef glMultiTexCoord4fv
+#define glMultiTexCoord4fv (gladCurrentContext->MultiTexCoord4fv)
+#undef glMultiTexCoord4i
+#define glMultiTexCoord4i (gladCurrentContext->MultiTexCoord4i)
+#undef glMultiTexCoord4iv
+#define glMultiTexCoord4iv (gladCurrentContext->MultiTexCoord4iv)
+#undef glMultiTexCoord4s
+#define glMultiTexCoord4s (gladCurrentContext->MultiTexCoord4s)
+#undef glMultiTexCoord4sv
+#define glMultiTexCoord4sv (gladCurrentContext->MultiTexCoord4sv)
+#undef glMultiTexCoordP1ui
+#define glMultiTexCoordP1ui (gladCurrentContext->MultiTexCoordP1ui)
+#undef glMultiTexCoordP1uiv
+#define glMultiTexCoordP1uiv (gladCurrentContext->MultiTexCoordP1uiv)
+#undef glMultiTexCoordP2ui
+#define glMultiTexCoordP2ui (gladCurrentContext->MultiTexCoordP2ui)
+#undef glMultiTexCoordP2uiv
+#define glMultiTexCoordP2uiv (gladCurrentContext->MultiTexCoordP2uiv)
+#undef glMultiTexCoordP3ui
+#define glMultiTexCoordP3ui (gladCurrentContext->MultiTexCoordP3ui)
+#undef glMultiTexCoordP3uiv
+#define glMultiTexCoordP3uiv (gladCurrentContext->MultiTexCoordP3uiv)
+#undef glMultiTexCoordP4ui
+#define glMultiTexCoordP4ui (gladCurrentContext->MultiTexCoordP4ui)
+#undef glMultiTexCoordP4uiv
+#define glMultiTexCoordP4uiv (gladCurrentContext->MultiTexCoordP4uiv)
+#undef glNamedBufferData
+#define glNamedBufferData (gladCurrentContext->NamedBufferData)
+#undef glNamedBufferStorage
+#define glNamedBufferStorage (gladCurrentContext->NamedBufferStorage)
+#undef glNamedBufferStorageEXT
+#define glNamedBufferStorageEXT (gladCurrentContext->NamedBufferStorageEXT)
+#undef glNamedBufferSubData
+#define glNamedBufferSubData (gladCurrentContext->NamedBufferSubData)
+#undef glNamedFramebufferDrawBuffer
+#define glNamedFramebufferDrawBuffer (gladCurrentContext->NamedFramebufferDrawBuffer)
+#undef glNamedFramebufferDrawBuffers
+#define glNamedFramebufferDrawBuffers (gladCurrentContext->NamedFramebufferDrawBuffers)
+#undef glNamedFramebufferParameteri
+#define glNamedFramebufferParameteri (gladCurrentContext->NamedFramebufferParameteri)
+#undef glNamedFramebufferReadBuffer
+#define glNamedFramebufferReadBuffer (gladCurrentContext->NamedFramebufferReadBuffer)
+#undef glNamedFramebufferRenderbuffer
+#define glNamedFramebufferRenderbuffer (gladCurrentContext->NamedFramebufferRenderbuffer)
+#undef glNamedFramebufferTexture
+#define glNamedFramebufferTexture (gladCurrentContext->NamedFramebufferTexture)
+#undef glNamedFramebufferTextureLayer
+#define glNamedFramebufferTextureLayer (gladCurrentContext->NamedFramebufferTextureLayer)
+#undef glNamedRenderbufferStorage
+#define glNamedRenderbufferStorage (gladCurrentContext->NamedRenderbufferStorage)
+#undef glNamedRenderbufferStorageMultisample
+#define glNamedRenderbufferStorageMultisample (gladCurrentContext->NamedRenderbufferStorageMultisample)
+#undef glNewList
+#define glNewList (gladCurrentContext->NewList)
+#undef glNormal3b
+#define glNormal3b (gladCurrentContext->Normal3b)
+#undef glNormal3bv
+#define glNormal3bv (gladCurrentContext->Normal3bv)
+#undef glNormal3d
+#define glNormal3d (gladCurrentContext->Normal3d)
+#undef glNormal3dv
+#define glNormal3dv (gladCurrentContext->Normal3dv)
+#undef glNormal3f
+#define glNormal3f (gladCurrentContext->Normal3f)
+#undef glNormal3fv
+#define glNormal3fv (gladCurrentContext->Normal3fv)
+#undef glNormal3i
+#define glNormal3i (gladCurrentContext->Normal3i)
+#undef glNormal3iv
+#define glNormal3iv (gladCurrentContext->Normal3iv)
+#undef glNormal3s
+#define glNormal3s (gladCurrentContext->Normal3s)
+#undef glNormal3sv
+#define glNormal3sv (gladCurrentContext->Normal3sv)
+#undef glNormalP3ui
+#define glNormalP3ui (gladCurrentContext->NormalP3ui)
+#undef glNormalP3uiv
+#define glNormalP3uiv (gladCurrentContext->NormalP3uiv)
+#undef glNormalPointer
+#define glNormalPointer (gladCurrentContext->NormalPointer)
+#undef glObjectLabel
+#define glObjectLabel (gladCurrentContext->ObjectLabel)
+#undef glObjectPtrLabel
+#define glObjectPtrLabel (gladCurrentContext->ObjectPtrLabel)
+#undef glOrtho
+#define glOrtho (gladCurrentContext->Ortho)
+#undef glPassThrough
+#define glPassThrough (gladCurrentContext->PassThrough)
+#undef glPatchParameterfv
+#define glPatchParameterfv (gladCurrentContext->PatchParameterfv)
+#undef glPatchParameteri
+#define glPatchParameteri (gladCurrentContext->PatchParameteri)
+#undef glPauseTransformFeedback
+#define glPauseTransformFeedback (gladCurrentContext->PauseTransformFeedback)
+#undef glPixelMapfv
+#define glPixelMapfv (gladCurrentContext->PixelMapfv)
+#undef glPixelMapuiv
+#define glPixelMapuiv (gladCurrentContext->PixelMapuiv)
+#undef glPixelMapusv
+#define glPixelMapusv (gladCurrentContext->PixelMapusv)
+#undef glPixelStoref
+#define glPixelStoref (gladCurrentContext->PixelStoref)
+#undef glPixelStorei
+#define glPixelStorei (gladCurrentContext->PixelStorei)
+#undef glPixelTransferf
+#define glPixelTransferf (gladCurrentContext->PixelTransferf)
+#undef glPixelTransferi
+#define glPixelTransferi (gladCurrentContext->PixelTransferi)
+#undef glPixelZoom
+#define glPixelZoom (gladCurrentContext->PixelZoom)
+#undef glPointParameterf
+#define glPointParameterf (gladCurrentContext->PointParameterf)
+#undef glPointParameterfv
+#define glPointParameterfv (gladCurrentContext->PointParameterfv)
+#undef glPointParameteri
+#define glPointParameteri (gladCurrentContext->PointParameteri)
+#undef glPointParameteriv
+#define glPointParameteriv (gladCurrentContext->PointParameteriv)
+#undef glPointSize
+#define glPointSize (gladCurrentContext->PointSize)
+#undef glPolygonMode
+#define glPolygonMode (gladCurrentContext->PolygonMode)
+#undef glPolygonOffset
+#define glPolygonOffset (gladCurrentContext->PolygonOffset)
+#undef glPolygonOffsetClamp
+#define glPolygonOffsetClamp (gladCurrentContext->PolygonOffsetClamp)
+#undef glPolygonStipple
+#define glPolygonStipple (gladCurrentContext->PolygonStipple)
+#undef glPopAttrib
+#define glPopAttrib (gladCurrentContext->PopAttrib)
+#undef glPopClientAttrib
+#define glPopClientAttrib (gladCurrentContext->PopClientAttrib)
+#undef glPopDebugGroup
+#define glPopDebugGroup (gladCurrentContext->PopDebugGroup)
+#undef glPopMatrix
+#define glPopMatrix (gladCurrentContext->PopMatrix)
+#undef glPopName
+#define glPopName (gladCurrentContext->PopName)
+#undef glPrimitiveRestartIndex
+#define glPrimitiveRestartIndex (gladCurrentContext->PrimitiveRestartIndex)
+#undef glPrioritizeTextures
+#define glPrioritizeTextures (gladCurrentContext->PrioritizeTextures)
+#undef glProgramBinary
+#define glProgramBinary (gladCurrentContext->ProgramBinary)
+#undef glProgramParameteri
+#define glProgramParameteri (gladCurrentContext->ProgramParameteri)
+#undef glProgramUniform1d
+#define glProgramUniform1d (gladCurrentContext->ProgramUniform1d)
+#undef glProgramUniform1dv
+#define glProgramUniform1dv (gladCurrentContext->ProgramUniform1dv)
+#undef glProgramUniform1f
+#define glProgramUniform1f (gladCurrentContext->ProgramUniform1f)
+#undef glProgramUniform1fv
+#define glProgramUniform1fv (gladCurrentContext->ProgramUniform1fv)
+#undef glProgramUniform1i
+#define glProgramUniform1i (gladCurrentContext->ProgramUniform1i)
+#undef glProgramUniform1iv
+#define glProgramUniform1iv (gladCurrentContext->ProgramUniform1iv)
+#undef glProgramUniform1ui
+#define glProgramUniform1ui (gladCurrentContext->ProgramUniform1ui)
+#undef glProgramUniform1uiv
+#define glProgramUniform1uiv (gladCurrentContext->ProgramUniform1uiv)
+#undef glProgramUniform2d
+#define glProgramUniform2d (gladCurrentContext->ProgramUniform2d)
+#undef glProgramUniform2dv
+#define glProgramUniform2dv (gladCurrentContext->ProgramUniform2dv)
+#undef glProgramUniform2f
+#define glProgramUniform2f (gladCurrentContext->ProgramUniform2f)
+#undef glProgramUniform2fv
+#define glProgramUniform2fv (gladCurrentContext->ProgramUniform2fv)
+#undef glProgramUniform2i
+#define glProgramUniform2i (gladCurrentContext->ProgramUniform2i)
+#undef glProgramUniform2iv
+#define glProgramUniform2iv (gladCurrentContext->ProgramUniform2iv)
+#undef glProgramUniform2ui
+#define glProgramUniform2ui (gladCurrentContext->ProgramUniform2ui)
+#undef glProgramUniform2uiv
+#define glProgramUniform2uiv (gladCurrentContext->ProgramUniform2uiv)
+#undef glProgramUniform3d
+#define glProgramUniform3d (gladCurrentContext->ProgramUniform3d)
+#undef glProgramUniform3dv
+#define glProgramUniform3dv (gladCurrentContext->ProgramUniform3dv)
+#undef glProgramUniform3f
+#define glProgramUniform3f (gladCurrentContext->ProgramUniform3f)
+#undef glProgramUniform3fv
+#define glProgramUniform3fv (gladCurrentContext->ProgramUniform3fv)
+#undef glProgramUniform3i
+#define glProgramUniform3i (gladCurrentContext->ProgramUniform3i)
+#undef glProgramUniform3iv
+#define glProgramUniform3iv (gladCurrentContext->ProgramUniform3iv)
+#undef glProgramUniform3ui
+#define glProgramUniform3ui (gladCurrentContext->ProgramUniform3ui)
+#undef glProgramUniform3uiv
+#define glProgramUniform3uiv (gladCurrentContext->ProgramUniform3uiv)
+#undef glProgramUniform4d
+#define glProgramUniform4d (gladCurrentContext->ProgramUniform4d)
+#undef glProgramUniform4dv
+#define glProgramUniform4dv (gladCurrentContext->ProgramUniform4dv)
+#undef glProgramUniform4f
+#define glProgramUniform4f (gladCurrentContext->ProgramUniform4f)
+#undef glProgramUniform4fv
+#define glProgramUniform4fv (gladCurrentContext->ProgramUniform4fv)
+#undef glProgramUniform4i
+#define glProgramUniform4i (gladCurrentContext->ProgramUniform4i)
+#undef glProgramUniform4iv
+#define glProgramUniform4iv (gladCurrentContext->ProgramUniform4iv)
+#undef glProgramUniform4ui
+#define glProgramUniform4ui (gladCurrentContext->ProgramUniform4ui)
+#undef glProgramUniform4uiv
+#define glProgramUniform4uiv (gladCurrentContext->ProgramUniform4uiv)
+#undef glProgramUniformHandleui64ARB
+#define glProgramUniformHandleui64ARB (gladCurrentContext->ProgramUniformHandleui64ARB)
+#undef glProgramUniformHandleui64vARB
+#define glProgramUniformHandleui64vARB (gladCurrentContext->ProgramUniformHandleui64vARB)
+#undef glProgramUniformMatrix2dv
+#define glProgramUniformMatrix2dv (gladCurrentContext->ProgramUniformMatrix2dv)
+#undef glProgramUniformMatrix2fv
+#define glProgramUniformMatrix2fv (gladCurrentContext->ProgramUniformMatrix2fv)
+#undef glProgramUniformMatrix2x3dv
+#define glProgramUniformMatrix2x3dv (gladCurrentContext->ProgramUniformMatrix2x3dv)
+#undef glProgramUniformMatrix2x3fv
+#define glProgramUniformMatrix2x3fv (gladCurrentContext->ProgramUniformMatrix2x3fv)
+#undef glProgramUniformMatrix2x4dv
+#define glProgramUniformMatrix2x4dv (gladCurrentContext->ProgramUniformMatrix2x4dv)
+#undef glProgramUniformMatrix2x4fv
+#define glProgramUniformMatrix2x4fv (gladCurrentContext->ProgramUniformMatrix2x4fv)
+#undef glProgramUniformMatrix3dv
+#define glProgramUniformMatrix3dv (gladCurrentContext->ProgramUniformMatrix3dv)
+#undef glProgramUniformMatrix3fv
+#define glProgramUniformMatrix3fv (gladCurrentContext->ProgramUniformMatrix3fv)
+#undef glProgramUniformMatrix3x2dv
+#define glProgramUniformMatrix3x2dv (gladCurrentContext->ProgramUniformMatrix3x2dv)
+#undef glProgramUniformMatrix3x2fv
+#define glProgramUniformMatrix3x2fv (gladCurrentContext->ProgramUniformMatrix3x2fv)
+#undef glProgramUniformMatrix3x4dv
+#define glProgramUniformMatrix3x4dv (gladCurrentContext->ProgramUniformMatrix3x4dv)
+#undef glProgramUniformMatrix3x4fv
+#define glProgramUniformMatrix3x4fv (gladCurrentContext->ProgramUniformMatrix3x4fv)
+#undef glProgramUniformMatrix4dv
+#define glProgramUniformMatrix4dv (gladCurrentContext->ProgramUniformMatrix4dv)
+#undef glProgramUniformMatrix4fv
+#define glProgramUniformMatrix4fv (gladCurrentContext->ProgramUniformMatrix4fv)
+#undef glProgramUniformMatrix4x2dv
+#define glProgramUniformMatrix4x2dv (gladCurrentContext->ProgramUniformMatrix4x2dv)
+#undef glProgramUniformMatrix4x2fv
+#define glProgramUniformMatrix4x2fv (gladCurrentContext->ProgramUniformMatrix4x2fv)
+#undef glProgramUniformMatrix4x3dv
+#define glProgramUniformMatrix4x3dv (gladCurrentContext->ProgramUniformMatrix4x3dv)
+#undef glProgramUniformMatrix4x3fv
+#define glProgramUniformMatrix4x3fv (gladCurrentContext->ProgramUniformMatrix4x3fv)
+#undef glProvokingVertex
+#define glProvokingVertex (gladCurrentContext->ProvokingVertex)
+#undef glPushAttrib
+#define glPushAttrib (gladCurrentContext->PushAttrib)
+#undef glPushClientAttrib
+#define glPushClientAttrib (gladCurrentContext->PushClientAttrib)
+#undef glPushDebugGroup
+#define glPushDebugGroup (gladCurrentContext->PushDebugGroup)
+#undef glPushMatrix
+#define glPushMatrix (gladCurrentContext->PushMatrix)
+#undef glPushName
+#define glPushName (gladCurrentContext->PushName)
+#undef glQueryCounter
+#define glQueryCounter (gladCurrentContext->QueryCounter)
+#undef glRasterPos2d
+#define glRasterPos2d (gladCurrentContext->RasterPos2d)
+#undef glRasterPos2dv
+#define glRasterPos2dv (gladCurrentContext->RasterPos2dv)
+#undef glRasterPos2f
+#define glRasterPos2f (gladCurrentContext->RasterPos2f)
+#undef glRasterPos2fv
+#define glRasterPos2fv (gladCurrentContext->RasterPos2fv)
+#undef glRasterPos2i
+#define glRasterPos2i (gladCurrentContext->RasterPos2i)
+#undef glRasterPos2iv
+#define glRasterPos2iv (gladCurrentContext->RasterPos2iv)
+#undef glRasterPos2s
+#define glRasterPos2s (gladCurrentContext->RasterPos2s)
+#undef glRasterPos2sv
+#define glRasterPos2sv (gladCurrentContext->RasterPos2sv)
+#undef glRasterPos3d
+#define glRasterPos3d (gladCurrentContext->RasterPos3d)
+#undef glRasterPos3dv
+#define glRasterPos3dv (gladCurrentContext->RasterPos3dv)
+#undef glRasterPos3f
+#define glRasterPos3f (gladCurrentContext->RasterPos3f)
+#undef glRasterPos3fv
+#define glRasterPos3fv (gladCurrentContext->RasterPos3fv)
+#undef glRasterPos3i
+#define glRasterPos3i (gladCurrentContext->RasterPos3i)
+#undef glRasterPos3iv
+#define glRasterPos3iv (gladCurrentContext->RasterPos3iv)
+#undef glRasterPos3s
+#define glRasterPos3s (gladCurrentContext->RasterPos3s)
+#undef glRasterPos3sv
+#define glRasterPos3sv (gladCurrentContext->RasterPos3sv)
+#undef glRasterPos4d
+#define glRasterPos4d (gladCurrentContext->RasterPos4d)
+#undef glRasterPos4dv
+#define glRasterPos4dv (gladCurrentContext->RasterPos4dv)
+#undef glRasterPos4f
+#define glRasterPos4f (gladCurrentContext->RasterPos4f)
+#undef glRasterPos4fv
+#define glRasterPos4fv (gladCurrentContext->RasterPos4fv)
+#undef glRasterPos4i
+#define glRasterPos4i (gladCurrentContext->RasterPos4i)
+#undef glRasterPos4iv
+#define glRasterPos4iv (gladCurrentContext->RasterPos4iv)
+#undef glRasterPos4s
+#define glRasterPos4s (gladCurrentContext->RasterPos4s)
+#undef glRasterPos4sv
+#define glRasterPos4sv (gladCurrentContext->RasterPos4sv)
+#undef glReadBuffer
+#define glReadBuffer (gladCurrentContext->ReadBuffer)
+#undef glReadPixels
+#define glReadPixels (gladCurrentContext->ReadPixels)
+#undef glReadnPixels
+#define glReadnPixels (gladCurrentContext->ReadnPixels)
+#undef glRectd
+#define glRectd (gladCurrentContext->Rectd)
+#undef glRectdv
+#define glRectdv (gladCurrentContext->Rectdv)
+#undef glRectf
+#define glRectf (gladCurrentContext->Rectf)
+#undef glRectfv
+#define glRectfv (gladCurrentContext->Rectfv)
+#undef glRecti
+#define glRecti (gladCurrentContext->Recti)
+#undef glRectiv
+#define glRectiv (gladCurrentContext->Rectiv)
+#undef glRects
+#define glRects (gladCurrentContext->Rects)
+#undef glRectsv
+#define glRectsv (gladCurrentContext->Rectsv)
+#undef glReleaseShaderCompiler
+#define glReleaseShaderCompiler (gladCurrentContext->ReleaseShaderCompiler)
+#undef glRenderMode
+#define glRenderMode (gladCurrentContext->RenderMode)
+#undef glRenderbufferStorage
+#define glRenderbufferStorage (gladCurrentContext->RenderbufferStorage)
+#undef glRenderbufferStorageMultisample
+#define glRenderbufferStorageMultisample (gladCurrentContext->RenderbufferStorageMultisample)
+#undef glResumeTransformFeedback
+#define glResumeTransformFeedback (gladCurrentContext->ResumeTransformFeedback)
+#undef glRotated
+#define glRotated (gladCurrentContext->Rotated)
+#undef glRotatef
+#define glRotatef (gladCurrentContext->Rotatef)
+#undef glSampleCoverage
+#define glSampleCoverage (gladCurrentContext->SampleCoverage)
+#undef glSampleMaski
+#define glSampleMaski (gladCurrentContext->SampleMaski)
+#undef glSamplerParameterIiv
+#define glSamplerParameterIiv (gladCurrentContext->SamplerParameterIiv)
+#undef glSamplerParameterIuiv
+#define glSamplerParameterIuiv (gladCurrentContext->SamplerParameterIuiv)
+#undef glSamplerParameterf
+#define glSamplerParameterf (gladCurrentContext->SamplerParameterf)
+#undef glSamplerParameterfv
+#define glSamplerParameterfv (gladCurrentContext->SamplerParameterfv)
+#undef glSamplerParameteri
+#define glSamplerParameteri (gladCurrentContext->SamplerParameteri)
+#undef glSamplerParameteriv
+#define glSamplerParameteriv (gladCurrentContext->SamplerParameteriv)
+#undef glScaled
+#define glScaled (gladCurrentContext->Scaled)
+#undef glScalef
+#define glScalef (gladCurrentContext->Scalef)
+#undef glScissor
+#define glScissor (gladCurrentContext->Scissor)
+#undef glScissorArrayv
+#define glScissorArrayv (gladCurrentContext->ScissorArrayv)
+#undef glScissorIndexed
+#define glScissorIndexed (gladCurrentContext->ScissorIndexed)
+#undef glScissorIndexedv
+#define glScissorIndexedv (gladCurrentContext->ScissorIndexedv)
+#undef glSecondaryColor3b
+#define glSecondaryColor3b (gladCurrentContext->SecondaryColor3b)
+#undef glSecondaryColor3bv
+#define glSecondaryColor3bv (gladCurrentContext->SecondaryColor3bv)
+#undef glSecondaryColor3d
+#define glSecondaryColor3d (gladCurrentContext->SecondaryColor3d)
+#undef glSecondaryColor3dv
+#define glSecondaryColor3dv (gladCurrentContext->SecondaryColor3dv)
+#undef glSecondaryColor3f
+#define glSecondaryColor3f (gladCurrentContext->SecondaryColor3f)
+#undef glSecondaryColor3fv
+#define glSecondaryColor3fv (gladCurrentContext->SecondaryColor3fv)
+#undef glSecondaryColor3i
+#define glSecondaryColor3i (gladCurrentContext->SecondaryColor3i)
+#undef glSecondaryColor3iv
+#define glSecondaryColor3iv (gladCurrentContext->SecondaryColor3iv)
+#undef glSecondaryColor3s
+#define glSecondaryColor3s (gladCurrentContext->SecondaryColor3s)
+#undef glSecondaryColor3sv
+#define glSecondaryColor3sv (gladCurrentContext->SecondaryColor3sv)
+#undef glSecondaryColor3ub
+#define glSecondaryColor3ub (gladCurrentContext->SecondaryColor3ub)
+#undef glSecondaryColor3ubv
+#define glSecondaryColor3ubv (gladCurrentContext->SecondaryColor3ubv)
+#undef glSecondaryColor3ui
+#define glSecondaryColor3ui (gladCurrentContext->SecondaryColor3ui)
+#undef glSecondaryColor3uiv
+#define glSecondaryColor3uiv (gladCurrentContext->SecondaryColor3uiv)
+#undef glSecondaryColor3us
+#define glSecondaryColor3us (gladCurrentContext->SecondaryColor3us)
+#undef glSecondaryColor3usv
+#define glSecondaryColor3usv (gladCurrentContext->SecondaryColor3usv)
+#undef glSecondaryColorP3ui
+#define glSecondaryColorP3ui (gladCurrentContext->SecondaryColorP3ui)
+#undef glSecondaryColorP3uiv
+#define glSecondaryColorP3uiv (gladCurrentContext->SecondaryColorP3uiv)
+#undef glSecondaryColorPointer
+#define glSecondaryColorPointer (gladCurrentContext->SecondaryColorPointer)
+#undef glSelectBuffer
+#define glSelectBuffer (gladCurrentContext->SelectBuffer)
+#undef glShadeModel
+#define glShadeModel (gladCurrentContext->ShadeModel)
+#undef glShaderBinary
+#define glShaderBinary (gladCurrentContext->ShaderBinary)
+#undef glShaderSource
+#define glShaderSource (gladCurrentContext->ShaderSource)
+#undef glShaderStorageBlockBinding
+#define glShaderStorageBlockBinding (gladCurrentContext->ShaderStorageBlockBinding)
+#undef glSpecializeShader
+#define glSpecializeShader (gladCurrentContext->SpecializeShader)
+#undef glSpecializeShaderARB
+#define glSpecializeShaderARB (gladCurrentContext->SpecializeShaderARB)
+#undef glStencilFunc
+#define glStencilFunc (gladCurrentContext->StencilFunc)
+#undef glStencilFuncSeparate
+#define glStencilFuncSeparate (gladCurrentContext->StencilFuncSeparate)
+#undef glStencilMask
+#define glStencilMask (gladCurrentContext->StencilMask)
+#undef glStencilMaskSeparate
+#define glStencilMaskSeparate (gladCurrentContext->StencilMaskSeparate)
+#undef glStencilOp
+#define glStencilOp (gladCurrentContext->StencilOp)
+#undef glStencilOpSeparate
+#define glStencilOpSeparate (gladCurrentContext->StencilOpSeparate)
+#undef glTexBuffer
+#define glTexBuffer (gladCurrentContext->TexBuffer)
+#undef glTexBufferRange
+#define glTexBufferRange (gladCurrentContext->TexBufferRange)
+#undef glTexCoord1d
+#define glTexCoord1d (gladCurrentContext->TexCoord1d)
+#undef glTexCoord1dv
+#define glTexCoord1dv (gladCurrentContext->TexCoord1dv)
+#undef glTexCoord1f
+#define glTexCoord1f (gladCurrentContext->TexCoord1f)
+#undef glTexCoord1fv
+#define glTexCoord1fv (gladCurrentContext->TexCoord1fv)
+#undef glTexCoord1i
+#define glTexCoord1i (gladCurrentContext->TexCoord1i)
+#undef glTexCoord1iv
+#define glTexCoord1iv (gladCurrentContext->TexCoord1iv)
+#undef glTexCoord1s
+#define glTexCoord1s (gladCurrentContext->TexCoord1s)
+#undef glTexCoord1sv
+#define glTexCoord1sv (gladCurrentContext->TexCoord1sv)
+#undef glTexCoord2d
+#define glTexCoord2d (gladCurrentContext->TexCoord2d)
+#undef glTexCoord2dv
+#define glTexCoord2dv (gladCurrentContext->TexCoord2dv)
+#undef glTexCoord2f
+#define glTexCoord2f (gladCurrentContext->TexCoord2f)
+#undef glTexCoord2fv
+#define glTexCoord2fv (gladCurrentContext->TexCoord2fv)
+#undef glTexCoord2i
+#define glTexCoord2i (gladCurrentContext->TexCoord2i)
+#undef glTexCoord2iv
+#define glTexCoord2iv (gladCurrentContext->TexCoord2iv)
+#undef glTexCoord2s
+#define glTexCoord2s (gladCurrentContext->TexCoord2s)
+#undef glTexCoord2sv
+#define glTexCoord2sv (gladCurrentContext->TexCoord2sv)
+#undef glTexCoord3d
+#define glTexCoord3d (gladCurrentContext->TexCoord3d)
+#undef glTexCoord3dv
+#define glTexCoord3dv (gladCurrentContext->TexCoord3dv)
+#undef glTexCoord3f
+#define glTexCoord3f (gladCurrentContext->TexCoord3f)
+#undef glTexCoord3fv
+#define glTexCoord3fv (gladCurrentContext->TexCoord3fv)
+#undef glTexCoord3i
+#define glTexCoord3i (gladCurrentContext->TexCoord3i)
+#undef glTexCoord3iv
+#define glTexCoord3iv (gladCurrentContext->TexCoord3iv)
+#undef glTexCoord3s
+#define glTexCoord3s (gladCurrentContext->TexCoord3s)
+#undef glTexCoord3sv
+#define glTexCoord3sv (gladCurrentContext->TexCoord3sv)
+#undef glTexCoord4d
+#define glTexCoord4d (gladCurrentContext->TexCoord4d)
+#undef glTexCoord4dv
+#define glTexCoord4dv (gladCurrentContext->TexCoord4dv)
+#undef glTexCoord4f
+#define glTexCoord4f (gladCurrentContext->TexCoord4f)
+#undef glTexCoord4fv
+#define glTexCoord4fv (gladCurrentContext->TexCoord4fv)
+#undef glTexCoord4i
+#define glTexCoord4i (gladCurrentContext->TexCoord4i)
+#undef glTexCoord4iv
+#define glTexCoord4iv (gladCurrentContext->TexCoord4iv)
+#undef glTexCoord4s
+#define glTexCoord4s (gladCurrentContext->TexCoord4s)
+#undef glTexCoord4sv
+#define glTexCoord4sv (gladCurrentContext->TexCoord4sv)
+#undef glTexCoordP1ui
+#define glTexCoordP1ui (gladCurrentContext->TexCoordP1ui)
+#undef glTexCoordP1uiv
+#define glTexCoordP1uiv (gladCurrentContext->TexCoordP1uiv)
+#undef glTexCoordP2ui
+#define glTexCoordP2ui (gladCurrentContext->TexCoordP2ui)
+#undef glTexCoordP2uiv
+#define glTexCoordP2uiv (gladCurrentContext->TexCoordP2uiv)
+#undef glTexCoordP3ui
+#define glTexCoordP3ui (gladCurrentContext->TexCoordP3ui)
+#undef glTexCoordP3uiv
+#define glTexCoordP3uiv (gladCurrentContext->TexCoordP3uiv)
+#undef glTexCoordP4ui
+#define glTexCoordP4ui (gladCurrentContext->TexCoordP4ui)
+#undef glTexCoordP4uiv
+#define glTexCoordP4uiv (gladCurrentContext->TexCoordP4uiv)
+#undef glTexCoordPointer
+#define glTexCoordPointer (gladCurrentContext->TexCoordPointer)
+#undef glTexEnvf
+#define glTexEnvf (gladCurrentContext->TexEnvf)
+#undef glTexEnvfv
+#define glTexEnvfv (gladCurrentContext->TexEnvfv)
+#undef glTexEnvi
+#define glTexEnvi (gladCurrentContext->TexEnvi)
+#undef glTexEnviv
+#define glTexEnviv (gladCurrentContext->TexEnviv)
+#undef glTexGend
+#define glTexGend (gladCurrentContext->TexGend)
+#undef glTexGendv
+#define glTexGendv (gladCurrentContext->TexGendv)
+#undef glTexGenf
+#define glTexGenf (gladCurrentContext->TexGenf)
+#undef glTexGenfv
+#define glTexGenfv (gladCurrentContext->TexGenfv)
+#undef glTexGeni
+#define glTexGeni (gladCurrentContext->TexGeni)
+#undef glTexGeniv
+#define glTexGeniv (gladCurrentContext->TexGeniv)
+#undef glTexImage1D
+#define glTexImage1D (gladCurrentContext->TexImage1D)
+#undef glTexImage2D
+#define glTexImage2D (gladCurrentContext->TexImage2D)
+#undef glTexImage2DMultisample
+#define glTexImage2DMultisample (gladCurrentContext->TexImage2DMultisample)
+#undef glTexImage3D
+#define glTexImage3D (gladCurrentContext->TexImage3D)
+#undef glTexImage3DMultisample
+#define glTexImage3DMultisample (gladCurrentContext->TexImage3DMultisample)
+#undef glTexParameterIiv
+#define glTexParameterIiv (gladCurrentContext->TexParameterIiv)
+#undef glTexParameterIuiv
+#define glTexParameterIuiv (gladCurrentContext->TexParameterIuiv)
+#undef glTexParameterf
+#define glTexParameterf (gladCurrentContext->TexParameterf)
+#undef glTexParameterfv
+#define glTexParameterfv (gladCurrentContext->TexParameterfv)
+#undef glTexParameteri
+#define glTexParameteri (gladCurrentContext->TexParameteri)
+#undef glTexParameteriv
+#define glTexParameteriv (gladCurrentContext->TexParameteriv)
+#undef glTexStorage1D
+#define glTexStorage1D (gladCurrentContext->TexStorage1D)
+#undef glTexStorage2D
+#define glTexStorage2D (gladCurrentContext->TexStorage2D)
+#undef glTexStorage2DMultisample
+#define glTexStorage2DMultisample (gladCurrentContext->TexStorage2DMultisample)
+#undef glTexStorage3D
+#define glTexStorage3D (gladCurrentContext->TexStorage3D)
+#undef glTexStorage3DMultisample
+#define glTexStorage3DMultisample (gladCurrentContext->TexStorage3DMultisample)
+#undef glTexSubImage1D
+#define glTexSubImage1D (gladCurrentContext->TexSubImage1D)
+#undef glTexSubImage2D
+#define glTexSubImage2D (gladCurrentContext->TexSubImage2D)
+#undef glTexSubImage3D
+#define glTexSubImage3D (gladCurrentContext->TexSubImage3D)
+#undef glTextureBarrier
+#define glTextureBarrier (gladCurrentContext->TextureBarrier)
+#undef glTextureBuffer
+#define glTextureBuffer (gladCurrentContext->TextureBuffer)
+#undef glTextureBufferRange
+#define glTextureBufferRange (gladCurrentContext->TextureBufferRange)
+#undef glTextureParameterIiv
+#define glTextureParameterIiv (gladCurrentContext->TextureParameterIiv)
+#undef glTextureParameterIuiv
+#define glTextureParameterIuiv (gladCurrentContext->TextureParameterIuiv)
+#undef glTextureParameterf
+#define glTextureParameterf (gladCurrentContext->TextureParameterf)
+#undef glTextureParameterfv
+#define glTextureParameterfv (gladCurrentContext->TextureParameterfv)
+#undef glTextureParameteri
+#define glTextureParameteri (gladCurrentContext->TextureParameteri)
+#undef glTextureParameteriv
+#define glTextureParameteriv (gladCurrentContext->TextureParameteriv)
+#undef glTextureStorage1D
+#define glTextureStorage1D (gladCurrentContext->TextureStorage1D)
+#undef glTextureStorage2D
+#define glTextureStorage2D (gladCurrentContext->TextureStorage2D)
+#undef glTextureStorage2DMultisample
+#define glTextureStorage2DMultisample (gladCurrentContext->TextureStorage2DMultisample)
+#undef glTextureStorage3D
+#define glTextureStorage3D (gladCurrentContext->TextureStorage3D)
+#undef glTextureStorage3DMultisample
+#define glTextureStorage3DMultisample (gladCurrentContext->TextureStorage3DMultisample)
+#undef glTextureSubImage1D
+#define glTextureSubImage1D (gladCurrentContext->TextureSubImage1D)
+#undef glTextureSubImage2D
+#define glTextureSubImage2D (gladCurrentContext->TextureSubImage2D)
+#undef glTextureSubImage3D
+#define glTextureSubImage3D (gladCurrentContext->TextureSubImage3D)
+#undef glTextureView
+#define glTextureView (gladCurrentContext->TextureView)
+#undef glTransformFeedbackBufferBase
+#define glTransformFeedbackBufferBase (gladCurrentContext->TransformFeedbackBufferBase)
+#undef glTransformFeedbackBufferRange
+#define glTransformFeedbackBufferRange (gladCurrentContext->TransformFeedbackBufferRange)
+#undef glTransformFeedbackVaryings
+#define glTransformFeedbackVaryings (gladCurrentContext->TransformFeedbackVaryings)
+#undef glTranslated
+#define glTranslated (gladCurrentContext->Translated)
+#undef glTranslatef
+#define glTranslatef (gladCurrentContext->Translatef)
+#undef glUniform1d
+#define glUniform1d (gladCurrentContext->Uniform1d)
+#undef glUniform1dv
+#define glUniform1dv (gladCurrentContext->Uniform1dv)
+#undef glUniform1f
+#define glUniform1f (gladCurrentContext->Uniform1f)
+#undef glUniform1fv
+#define glUniform1fv (gladCurrentContext->Uniform1fv)
+#undef glUniform1i
+#define glUniform1i (gladCurrentContext->Uniform1i)
+#undef glUniform1iv
+#define glUniform1iv (gladCurrentContext->Uniform1iv)
+#undef glUniform1ui
+#define glUniform1ui (gladCurrentContext->Uniform1ui)
+#undef glUniform1uiv
+#define glUniform1uiv (gladCurrentContext->Uniform1uiv)
+#undef glUniform2d
+#define glUniform2d (gladCurrentContext->Uniform2d)
+#undef glUniform2dv
+#define glUniform2dv (gladCurrentContext->Uniform2dv)
+#undef glUniform2f
+#define glUniform2f (gladCurrentContext->Uniform2f)
+#undef glUniform2fv
+#define glUniform2fv (gladCurrentContext->Uniform2fv)
+#undef glUniform2i
+#define glUniform2i (gladCurrentContext->Uniform2i)
+#undef glUniform2iv
+#define glUniform2iv (gladCurrentContext->Uniform2iv)
+#undef glUniform2ui
+#define glUniform2ui (gladCurrentContext->Uniform2ui)
+#undef glUniform2uiv
+#define glUniform2uiv (gladCurrentContext->Uniform2uiv)
+#undef glUniform3d
+#define glUniform3d (gladCurrentContext->Uniform3d)
+#undef glUniform3dv
+#define glUniform3dv (gladCurrentContext->Uniform3dv)
+#undef glUniform3f
+#define glUniform3f (gladCurrentContext->Uniform3f)
+#undef glUniform3fv
+#define glUniform3fv (gladCurrentContext->Uniform3fv)
+#undef glUniform3i
+#define glUniform3i (gladCurrentContext->Uniform3i)
+#undef glUniform3iv
+#define glUniform3iv (gladCurrentContext->Uniform3iv)
+#undef glUniform3ui
+#define glUniform3ui (gladCurrentContext->Uniform3ui)
+#undef glUniform3uiv
+#define glUniform3uiv (gladCurrentContext->Uniform3uiv)
+#undef glUniform4d
+#define glUniform4d (gladCurrentContext->Uniform4d)
+#undef glUniform4dv
+#define glUniform4dv (gladCurrentContext->Uniform4dv)
+#undef glUniform4f
+#define glUniform4f (gladCurrentContext->Uniform4f)
+#undef glUniform4fv
+#define glUniform4fv (gladCurrentContext->Uniform4fv)
+#undef glUniform4i
+#define glUniform4i (gladCurrentContext->Uniform4i)
+#undef glUniform4iv
+#define glUniform4iv (gladCurrentContext->Uniform4iv)
+#undef glUniform4ui
+#define glUniform4ui (gladCurrentContext->Uniform4ui)
+#undef glUniform4uiv
+#define glUniform4uiv (gladCurrentContext->Uniform4uiv)
+#undef glUniformBlockBinding
+#define glUniformBlockBinding (gladCurrentContext->UniformBlockBinding)
+#undef glUniformHandleui64ARB
+#define glUniformHandleui64ARB (gladCurrentContext->UniformHandleui64ARB)
+#undef glUniformHandleui64vARB
+#define glUniformHandleui64vARB (gladCurrentContext->UniformHandleui64vARB)
+#undef glUniformMatrix2dv
+#define glUniformMatrix2dv (gladCurrentContext->UniformMatrix2dv)
+#undef glUniformMatrix2fv
+#define glUniformMatrix2fv (gladCurrentContext->UniformMatrix2fv)
+#undef glUniformMatrix2x3dv
+#define glUniformMatrix2x3dv (gladCurrentContext->UniformMatrix2x3dv)
+#undef glUniformMatrix2x3fv
+#define glUniformMatrix2x3fv (gladCurrentContext->UniformMatrix2x3fv)
+#undef glUniformMatrix2x4dv
+#define glUniformMatrix2x4dv (gladCurrentContext->UniformMatrix2x4dv)
+#undef glUniformMatrix2x4fv
+#define glUniformMatrix2x4fv (gladCurrentContext->UniformMatrix2x4fv)
+#undef glUniformMatrix3dv
+#define glUniformMatrix3dv (gladCurrentContext->UniformMatrix3dv)
+#undef glUniformMatrix3fv
+#define glUniformMatrix3fv (gladCurrentContext->UniformMatrix3fv)
+#undef glUniformMatrix3x2dv
+#define glUniformMatrix3x2dv (gladCurrentContext->UniformMatrix3x2dv)
+#undef glUniformMatrix3x2fv
+#define glUniformMatrix3x2fv (gladCurrentContext->UniformMatrix3x2fv)
+#undef glUniformMatrix3x4dv
+#define glUniformMatrix3x4dv (gladCurrentContext->UniformMatrix3x4dv)
+#undef glUniformMatrix3x4fv
+#define glUniformMatrix3x4fv (gladCurrentContext->UniformMatrix3x4fv)
+#undef glUniformMatrix4dv
+#define glUniformMatrix4dv (gladCurrentContext->UniformMatrix4dv)
+#undef glUniformMatrix4fv
+#define glUniformMatrix4fv (gladCurrentContext->UniformMatrix4fv)
+#undef glUniformMatrix4x2dv
+#define glUniformMatrix4x2dv (gladCurrentContext->UniformMatrix4x2dv)
+#undef glUniformMatrix4x2fv
+#define glUniformMatrix4x2fv (gladCurrentContext->UniformMatrix4x2fv)
+#undef glUniformMatrix4x3dv
+#define glUniformMatrix4x3dv (gladCurrentContext->UniformMatrix4x3dv)
+#undef glUniformMatrix4x3fv
+#define glUniformMatrix4x3fv (gladCurrentContext->UniformMatrix4x3fv)
+#undef glUniformSubroutinesuiv
+#define glUniformSubroutinesuiv (gladCurrentContext->UniformSubroutinesuiv)
+#undef glUnmapBuffer
+#define glUnmapBuffer (gladCurrentContext->UnmapBuffer)
+#undef glUnmapNamedBuffer
+#define glUnmapNamedBuffer (gladCurrentContext->UnmapNamedBuffer)
+#undef glUseProgram
+#define glUseProgram (gladCurrentContext->UseProgram)
+#undef glUseProgramStages
+#define glUseProgramStages (gladCurrentContext->UseProgramStages)
+#undef glValidateProgram
+#define glValidateProgram (gladCurrentContext->ValidateProgram)
+#undef glValidateProgramPipeline
+#define glValidateProgramPipeline (gladCurrentContext->ValidateProgramPipeline)
+#undef glVertex2d
+#define glVertex2d (gladCurrentContext->Vertex2d)
+#undef glVertex2dv
+#define glVertex2dv (gladCurrentContext->Vertex2dv)
+#undef glVertex2f
+#define glVertex2f (gladCurrentContext->Vertex2f)
+#undef glVertex2fv
+#define glVertex2fv (gladCurrentContext->Vertex2fv)
+#undef glVertex2i
+#define glVertex2i (gladCurrentContext->Vertex2i)
+#undef glVertex2iv
+#define glVertex2iv (gladCurrentContext->Vertex2iv)
+#undef glVertex2s
+#define glVertex2s (gladCurrentContext->Vertex2s)
+#undef glVertex2sv
+#define glVertex2sv (gladCurrentContext->Vertex2sv)
+#undef glVertex3d
+#define glVertex3d (gladCurrentContext->Vertex3d)
+#undef glVertex3dv
+#define glVertex3dv (gladCurrentContext->Vertex3dv)
+#undef glVertex3f
+#define glVertex3f (gladCurrentContext->Vertex3f)
+#undef glVertex3fv
+#define glVertex3fv (gladCurrentContext->Vertex3fv)
+#undef glVertex3i
+#define glVertex3i (gladCurrentContext->Vertex3i)
+#undef glVertex3iv
+#define glVertex3iv (gladCurrentContext->Vertex3iv)
+#undef glVertex3s
+#define glVertex3s (gladCurrentContext->Vertex3s)
+#undef glVertex3sv
+#define glVertex3sv (gladCurrentContext->Vertex3sv)
+#undef glVertex4d
+#define glVertex4d (gladCurrentContext->Vertex4d)
+#undef glVertex4dv
+#define glVertex4dv (gladCurrentContext->Vertex4dv)
+#undef glVertex4f
+#define glVertex4f (gladCurrentContext->Vertex4f)
+#undef glVertex4fv
+#define glVertex4fv (gladCurrentContext->Vertex4fv)
+#undef glVertex4i
+#define glVertex4i (gladCurrentContext->Vertex4i)
+#undef glVertex4iv
+#define glVertex4iv (gladCurrentContext->Vertex4iv)
+#undef glVertex4s
+#define glVertex4s (gladCurrentContext->Vertex4s)
+#undef glVertex4sv
+#define glVertex4sv (gladCurrentContext->Vertex4sv)
+#undef glVertexArrayAttribBinding
+#define glVertexArrayAttribBinding (gladCurrentContext->VertexArrayAttribBinding)
+#undef glVertexArrayAttribFormat
+#define glVertexArrayAttribFormat (gladCurrentContext->VertexArrayAttribFormat)
+#undef glVertexArrayAttribIFormat
+#define glVertexArrayAttribIFormat (gladCurrentContext->VertexArrayAttribIFormat)
+#undef glVertexArrayAttribLFormat
+#define glVertexArrayAttribLFormat (gladCurrentContext->VertexArrayAttribLFormat)
+#undef glVertexArrayBindingDivisor
+#define glVertexArrayBindingDivisor (gladCurrentContext->VertexArrayBindingDivisor)
+#undef glVertexArrayElementBuffer
+#define glVertexArrayElementBuffer (gladCurrentContext->VertexArrayElementBuffer)
+#undef glVertexArrayVertexBuffer
+#define glVertexArrayVertexBuffer (gladCurrentContext->VertexArrayVertexBuffer)
+#undef glVertexArrayVertexBuffers
+#define glVertexArrayVertexBuffers (gladCurrentContext->VertexArrayVertexBuffers)
+#undef glVertexAttrib1d
+#define glVertexAttrib1d (gladCurrentContext->VertexAttrib1d)
+#undef glVertexAttrib1dv
+#define glVertexAttrib1dv (gladCurrentContext->VertexAttrib1dv)
+#undef glVertexAttrib1f
+#define glVertexAttrib1f (gladCurrentContext->VertexAttrib1f)
+#undef glVertexAttrib1fv
+#define glVertexAttrib1fv (gladCurrentContext->VertexAttrib1fv)
+#undef glVertexAttrib1s
+#define glVertexAttrib1s (gladCurrentContext->VertexAttrib1s)
+#undef glVertexAttrib1sv
+#define glVertexAttrib1sv (gladCurrentContext->VertexAttrib1sv)
+#undef glVertexAttrib2d
+#define glVertexAttrib2d (gladCurrentContext->VertexAttrib2d)
+#undef glVertexAttrib2dv
+#define glVertexAttrib2dv (gladCurrentContext->VertexAttrib2dv)
+#undef glVertexAttrib2f
+#define glVertexAttrib2f (gladCurrentContext->VertexAttrib2f)
+#undef glVertexAttrib2fv
+#define glVertexAttrib2fv (gladCurrentContext->VertexAttrib2fv)
+#undef glVertexAttrib2s
+#define glVertexAttrib2s (gladCurrentContext->VertexAttrib2s)
+#undef glVertexAttrib2sv
+#define glVertexAttrib2sv (gladCurrentContext->VertexAttrib2sv)
+#undef glVertexAttrib3d
+#define glVertexAttrib3d (gladCurrentContext->VertexAttrib3d)
+#undef glVertexAttrib3dv
+#define glVertexAttrib3dv (gladCurrentContext->VertexAttrib3dv)
+#undef glVertexAttrib3f
+#define glVertexAttrib3f (gladCurrentContext->VertexAttrib3f)
+#undef glVertexAttrib3fv
+#define glVertexAttrib3fv (gladCurrentContext->VertexAttrib3fv)
+#undef glVertexAttrib3s
+#define glVertexAttrib3s (gladCurrentContext->VertexAttrib3s)
+#undef glVertexAttrib3sv
+#define glVertexAttrib3sv (gladCurrentContext->VertexAttrib3sv)
+#undef glVertexAttrib4Nbv
+#define glVertexAttrib4Nbv (gladCurrentContext->VertexAttrib4Nbv)
+#undef glVertexAttrib4Niv
+#define glVertexAttrib4Niv (gladCurrentContext->VertexAttrib4Niv)
+#undef glVertexAttrib4Nsv
+#define glVertexAttrib4Nsv (gladCurrentContext->VertexAttrib4Nsv)
+#undef glVertexAttrib4Nub
+#define glVertexAttrib4Nub (gladCurrentContext->VertexAttrib4Nub)
+#undef glVertexAttrib4Nubv
+#define glVertexAttrib4Nubv (gladCurrentContext->VertexAttrib4Nubv)
+#undef glVertexAttrib4Nuiv
+#define glVertexAttrib4Nuiv (gladCurrentContext->VertexAttrib4Nuiv)
+#undef glVertexAttrib4Nusv
+#define glVertexAttrib4Nusv (gladCurrentContext->VertexAttrib4Nusv)
+#undef glVertexAttrib4bv
+#define glVertexAttrib4bv (gladCurrentContext->VertexAttrib4bv)
+#undef glVertexAttrib4d
+#define glVertexAttrib4d (gladCurrentContext->VertexAttrib4d)
+#undef glVertexAttrib4dv
+#define glVertexAttrib4dv (gladCurrentContext->VertexAttrib4dv)
+#undef glVertexAttrib4f
+#define glVertexAttrib4f (gladCurrentContext->VertexAttrib4f)
+#undef glVertexAttrib4fv
+#define glVertexAttrib4fv (gladCurrentContext->VertexAttrib4fv)
+#undef glVertexAttrib4iv
+#define glVertexAttrib4iv (gladCurrentContext->VertexAttrib4iv)
+#undef glVertexAttrib4s
+#define glVertexAttrib4s (gladCurrentContext->VertexAttrib4s)
+#undef glVertexAttrib4sv
+#define glVertexAttrib4sv (gladCurrentContext->VertexAttrib4sv)
+#undef glVertexAttrib4ubv
+#define glVertexAttrib4ubv (gladCurrentContext->VertexAttrib4ubv)
+#undef glVertexAttrib4uiv
+#define glVertexAttrib4uiv (gladCurrentContext->VertexAttrib4uiv)
+#undef glVertexAttrib4usv
+#define glVertexAttrib4usv (gladCurrentContext->VertexAttrib4usv)
+#undef glVertexAttribBinding
+#define glVertexAttribBinding (gladCurrentContext->VertexAttribBinding)
+#undef glVertexAttribDivisor
+#define glVertexAttribDivisor (gladCurrentContext->VertexAttribDivisor)
+#undef glVertexAttribFormat
+#define glVertexAttribFormat (gladCurrentContext->VertexAttribFormat)
+#undef glVertexAttribI1i
+#define glVertexAttribI1i (gladCurrentContext->VertexAttribI1i)
+#undef glVertexAttribI1iv
+#define glVertexAttribI1iv (gladCurrentContext->VertexAttribI1iv)
+#undef glVertexAttribI1ui
+#define glVertexAttribI1ui (gladCurrentContext->VertexAttribI1ui)
+#undef glVertexAttribI1uiv
+#define glVertexAttribI1uiv (gladCurrentContext->VertexAttribI1uiv)
+#undef glVertexAttribI2i
+#define glVertexAttribI2i (gladCurrentContext->VertexAttribI2i)
+#undef glVertexAttribI2iv
+#define glVertexAttribI2iv (gladCurrentContext->VertexAttribI2iv)
+#undef glVertexAttribI2ui
+#define glVertexAttribI2ui (gladCurrentContext->VertexAttribI2ui)
+#undef glVertexAttribI2uiv
+#define glVertexAttribI2uiv (gladCurrentContext->VertexAttribI2uiv)
+#undef glVertexAttribI3i
+#define glVertexAttribI3i (gladCurrentContext->VertexAttribI3i)
+#undef glVertexAttribI3iv
+#define glVertexAttribI3iv (gladCurrentContext->VertexAttribI3iv)
+#undef glVertexAttribI3ui
+#define glVertexAttribI3ui (gladCurrentContext->VertexAttribI3ui)
+#undef glVertexAttribI3uiv
+#define glVertexAttribI3uiv (gladCurrentContext->VertexAttribI3uiv)
+#undef glVertexAttribI4bv
+#define glVertexAttribI4bv (gladCurrentContext->VertexAttribI4bv)
+#undef glVertexAttribI4i
+#define glVertexAttribI4i (gladCurrentContext->VertexAttribI4i)
+#undef glVertexAttribI4iv
+#define glVertexAttribI4iv (gladCurrentContext->VertexAttribI4iv)
+#undef glVertexAttribI4sv
+#define glVertexAttribI4sv (gladCurrentContext->VertexAttribI4sv)
+#undef glVertexAttribI4ubv
+#define glVertexAttribI4ubv (gladCurrentContext->VertexAttribI4ubv)
+#undef glVertexAttribI4ui
+#define glVertexAttribI4ui (gladCurrentContext->VertexAttribI4ui)
+#undef glVertexAttribI4uiv
+#define glVertexAttribI4uiv (gladCurrentContext->VertexAttribI4uiv)
+#undef glVertexAttribI4usv
+#define glVertexAttribI4usv (gladCurrentContext->VertexAttribI4usv)
+#undef glVertexAttribIFormat
+#define glVertexAttribIFormat (gladCurrentContext->VertexAttribIFormat)
+#undef glVertexAttribIPointer
+#define glVertexAttribIPointer (gladCurrentContext->VertexAttribIPointer)
+#undef glVertexAttribL1d
+#define glVertexAttribL1d (gladCurrentContext->VertexAttribL1d)
+#undef glVertexAttribL1dv
+#define glVertexAttribL1dv (gladCurrentContext->VertexAttribL1dv)
+#undef glVertexAttribL1ui64ARB
+#define glVertexAttribL1ui64ARB (gladCurrentContext->VertexAttribL1ui64ARB)
+#undef glVertexAttribL1ui64vARB
+#define glVertexAttribL1ui64vARB (gladCurrentContext->VertexAttribL1ui64vARB)
+#undef glVertexAttribL2d
+#define glVertexAttribL2d (gladCurrentContext->VertexAttribL2d)
+#undef glVertexAttribL2dv
+#define glVertexAttribL2dv (gladCurrentContext->VertexAttribL2dv)
+#undef glVertexAttribL3d
+#define glVertexAttribL3d (gladCurrentContext->VertexAttribL3d)
+#undef glVertexAttribL3dv
+#define glVertexAttribL3dv (gladCurrentContext->VertexAttribL3dv)
+#undef glVertexAttribL4d
+#define glVertexAttribL4d (gladCurrentContext->VertexAttribL4d)
+#undef glVertexAttribL4dv
+#define glVertexAttribL4dv (gladCurrentContext->VertexAttribL4dv)
+#undef glVertexAttribLFormat
+#define glVertexAttribLFormat (gladCurrentContext->VertexAttribLFormat)
+#undef glVertexAttribLPointer
+#define glVertexAttribLPointer (gladCurrentContext->VertexAttribLPointer)
+#undef glVertexAttribP1ui
+#define glVertexAttribP1ui (gladCurrentContext->VertexAttribP1ui)
+#undef glVertexAttribP1uiv
+#define glVertexAttribP1uiv (gladCurrentContext->VertexAttribP1uiv)
+#undef glVertexAttribP2ui
+#define glVertexAttribP2ui (gladCurrentContext->VertexAttribP2ui)
+#undef glVertexAttribP2uiv
+#define glVertexAttribP2uiv (gladCurrentContext->VertexAttribP2uiv)
+#undef glVertexAttribP3ui
+#define glVertexAttribP3ui (gladCurrentContext->VertexAttribP3ui)
+#undef glVertexAttribP3uiv
+#define glVertexAttribP3uiv (gladCurrentContext->VertexAttribP3uiv)
+#undef glVertexAttribP4ui
+#define glVertexAttribP4ui (gladCurrentContext->VertexAttribP4ui)
+#undef glVertexAttribP4uiv
+#define glVertexAttribP4uiv (gladCurrentContext->VertexAttribP4uiv)
+#undef glVertexAttribPointer
+#define glVertexAttribPointer (gladCurrentContext->VertexAttribPointer)
+#undef glVertexBindingDivisor
+#define glVertexBindingDivisor (gladCurrentContext->VertexBindingDivisor)
+#undef glVertexP2ui
+#define glVertexP2ui (gladCurrentContext->VertexP2ui)
+#undef glVertexP2uiv
+#define glVertexP2uiv (gladCurrentContext->VertexP2uiv)
+#undef glVertexP3ui
+#define glVertexP3ui (gladCurrentContext->VertexP3ui)
+#undef glVertexP3uiv
+#define glVertexP3uiv (gladCurrentContext->VertexP3uiv)
+#undef glVertexP4ui
+#define glVertexP4ui (gladCurrentContext->VertexP4ui)
+#undef glVertexP4uiv
+#define glVertexP4uiv (gladCurrentContext->VertexP4uiv)
+#undef glVertexPointer
+#define glVertexPointer (gladCurrentContext->VertexPointer)
+#undef glViewport
+#define glViewport (gladCurrentContext->Viewport)
+#undef glViewportArrayv
+#define glViewportArrayv (gladCurrentContext->ViewportArrayv)
+#undef glViewportIndexedf
+#define glViewportIndexedf (gladCurrentContext->ViewportIndexedf)
+#undef glViewportIndexedfv
+#define glViewportIndexedfv (gladCurrentContext->ViewportIndexedfv)
+#undef glWaitSync
+#define glWaitSync (gladCurrentContext->WaitSync)
+#undef glWindowPos2d
+#define glWindowPos2d (gladCurrentContext->WindowPos2d)
+#undef glWindowPos2dv
+#define glWindowPos2dv (gladCurrentContext->WindowPos2dv)
+#undef glWindowPos2f
+#define glWindowPos2f (gladCurrentContext->WindowPos2f)
+#undef glWindowPos2fv
+#define glWindowPos2fv (gladCurrentContext->WindowPos2fv)
+#undef glWindowPos2i
+#define glWindowPos2i (gladCurrentContext->WindowPos2i)
+#undef glWindowPos2iv
+#define glWindowPos2iv (gladCurrentContext->WindowPos2iv)
+#undef glWindowPos2s
+#define glWindowPos2s (gladCurrentContext->WindowPos2s)
+#undef glWindowPos2sv
+#define glWindowPos2sv (gladCurrentContext->WindowPos2sv)
+#undef glWindowPos3d
+#define glWindowPos3d (gladCurrentContext->WindowPos3d)
+#undef glWindowPos3dv
+#define glWindowPos3dv (gladCurrentContext->WindowPos3dv)
+#undef glWindowPos3f
+#define glWindowPos3f (gladCurrentContext->WindowPos3f)
+#undef glWindowPos3fv
+#define glWindowPos3fv (gladCurrentContext->WindowPos3fv)
+#undef glWindowPos3i
+#define glWindowPos3i (gladCurrentContext->WindowPos3i)
+#undef glWindowPos3iv
+#define glWindowPos3iv (gladCurrentContext->WindowPos3iv)
+#undef glWindowPos3s
+#define glWindowPos3s (gladCurrentContext->WindowPos3s)
+#undef glWindowPos3sv
+#define glWindowPos3sv (gladCurrentContext->WindowPos3sv)
+#endif /* GLAD_MX_NO_REDIRECT */
+
+#endif /* GLAD_MULTI_CONTEXT */
+
+#endif
@@ -0,0 +1,291 @@
+/*
+ *	GPU memory accounting, see gpu_memory.h
+ */
+
+#include "gpu_memory.h"
+#include "alloc_tracker.h"
+#include "gl_resources.h"
+
+#include <unordered_map>
+
+// tokens of the memory info extensions, in case the glad header was generated without them
+#ifndef GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX
+#define GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX			0x9047
+#define GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX	0x9048
+#define GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX	0x9049
+#define GL_GPU_MEMORY_INFO_EVICTION_COUNT_NVX			0x904A
+#define GL_GPU_MEMORY_INFO_EVICTED_MEMORY_NVX			0x904B
+#endif
+#ifndef GL_VBO_FREE_MEMORY_ATI
+#define GL_VBO_FREE_MEMORY_ATI							0x87FB
+#define GL_TEXTURE_FREE_MEMORY_ATI						0x87FC
+#define GL_RENDERBUFFER_FREE_MEMORY_ATI					0x87FD
+#endif
+
+namespace
+{
+	// what we know about one live object
+	struct Record
+	{
+		GpuMemoryCategory category;
+		GLenum internalFormat;
+		long long bytes;
+	};
+
+	const int timelineLength = 240;	// a few seconds of frames
+
+	std::unordered_map<unsigned long long, Record> records;
+	GpuMemoryTotals liveTotals;
+	GpuMemoryFrame current;
+	GpuMemoryFrame history[timelineLength];		// ring buffer, next points at the oldest entry once full
+	GpuMemoryFrame ordered[timelineLength];		// history unrolled oldest to newest for timeline()
+	int next = 0;
+	int filled = 0;
+
+	const char* const categoryNames[(int)GpuMemoryCategory::Count] = {
+		"VertexBuffer", "IndexBuffer", "UniformBuffer", "Texture", "RenderTarget", "Other"
+	};
+
+	// objects of different kinds can share a name, the kind goes in the upper half of the key
+	unsigned long long key(GLenum kind, unsigned int name)
+	{
+		return ((unsigned long long)kind << 32) | name;
+	}
+
+	void recordAllocation(unsigned long long k, GpuMemoryCategory category, GLenum internalFormat, long long bytes)
+	{
+		AllocScope scope(AllocTag::Resources);	// the record table grows with every new object
+		auto found = records.find(k);
+		if (found != records.end())	// re-specified storage (glBufferData on an existing buffer), the old storage is released
+		{
+			GpuMemory::trackFree((GLenum)(k >> 32), (unsigned int)k);
+		}
+
+		records[k] = Record{ category, internalFormat, bytes };
+		liveTotals.bytes[(int)category] += bytes;
+		liveTotals.objects[(int)category]++;
+		liveTotals.totalBytes += bytes;
+		if (liveTotals.totalBytes > liveTotals.peakBytes)
+		{
+			liveTotals.peakBytes = liveTotals.totalBytes;
+		}
+		current.allocatedBytes += bytes;
+		current.allocations++;
+	}
+}
+
+namespace GpuMemory
+{
+	unsigned int createBuffer(GpuMemoryCategory category, GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+	{
+		unsigned int buffer = GlResources::createBuffer(target, size, data, usage);
+		recordAllocation(key(GL_BUFFER, buffer), category, 0, (long long)size);
+		return buffer;
+	}
+
+	unsigned int createImmutableBuffer(GpuMemoryCategory category, GLenum target, GLsizeiptr size, const void* data, GLbitfield flags)
+	{
+		unsigned int buffer = GlResources::createImmutableBuffer(target, size, data, flags);
+		recordAllocation(key(GL_BUFFER, buffer), category, 0, (long long)size);
+		return buffer;
+	}
+
+	void resizeBuffer(unsigned int buffer, GLenum target, GLsizeiptr size, const void* data, GLenum usage)
+	{
+		auto found = records.find(key(GL_BUFFER, buffer));
+		GpuMemoryCategory category = found != records.end() ? found->second.category : GpuMemoryCategory::Other;
+
+		GlResources::bufferData(buffer, target, size, data, usage);
+		recordAllocation(key(GL_BUFFER, buffer), category, 0, (long long)size);
+	}
+
+	void deleteBuffer(unsigned int buffer)
+	{
+		trackFree(GL_BUFFER, buffer);
+		GlResources::deleteBuffer(buffer);
+	}
+
+	unsigned int createTexture2D(GpuMemoryCategory category, GLenum internalFormat, int width, int height, int levels,
+		GLenum format, GLenum type, const void* data)
+	{
+		unsigned int texture = GlResources::createTexture2D(internalFormat, width, height, levels, format, type, data);
+
+		// every mip level is half the size of the previous one (at least 1 texel)
+		long long bytes = 0;
+		int w = width, h = height;
+		for (int level = 0; level < levels; level++)
+		{
+			bytes += (long long)w * h * bytesPerPixel(internalFormat);
+			w = w > 1 ? w / 2 : 1;
+			h = h > 1 ? h / 2 : 1;
+		}
+
+		recordAllocation(key(GL_TEXTURE, texture), category, internalFormat, bytes);
+		return texture;
+	}
+
+	unsigned int createTexture3D(GpuMemoryCategory category, GLenum internalFormat, int width, int height, int depth,
+		GLenum format, GLenum type, const void* data)
+	{
+		unsigned int texture = GlResources::createTexture3D(internalFormat, width, height, depth, format, type, data);
+		recordAllocation(key(GL_TEXTURE, texture), category, internalFormat, (long long)width * height * depth * bytesPerPixel(internalFormat));
+		return texture;
+	}
+
+	void deleteTexture(unsigned int texture)
+	{
+		trackFree(GL_TEXTURE, texture);
+		glDeleteTextures(1, &texture);
+	}
+
+	unsigned int createRenderbuffer(GpuMemoryCategory category, GLenum internalFormat, int width, int height, int samples)
+	{
+		unsigned int renderbuffer = GlResources::createRenderbuffer(internalFormat, width, height, samples);
+
+		long long bytes = (long long)width * height * bytesPerPixel(internalFormat) * (samples > 0 ? samples : 1);
+		recordAllocation(key(GL_RENDERBUFFER, renderbuffer), category, internalFormat, bytes);
+		return renderbuffer;
+	}
+
+	void deleteRenderbuffer(unsigned int renderbuffer)
+	{
+		trackFree(GL_RENDERBUFFER, renderbuffer);
+		glDeleteRenderbuffers(1, &renderbuffer);
+	}
+
+	void trackAllocation(GLenum kind, unsigned int name, GpuMemoryCategory category, GLenum internalFormat, long long bytes)
+	{
+		recordAllocation(key(kind, name), category, internalFormat, bytes);
+	}
+
+	void trackFree(GLenum kind, unsigned int name)
+	{
+		auto found = records.find(key(kind, name));
+		if (found == records.end())
+		{
+			return;
+		}
+
+		const Record& record = found->second;
+		liveTotals.bytes[(int)record.category] -= record.bytes;
+		liveTotals.objects[(int)record.category]--;
+		liveTotals.totalBytes -= record.bytes;
+		current.freedBytes += record.bytes;
+		current.frees++;
+		records.erase(found);
+	}
+
+	long long bytesPerPixel(GLenum internalFormat)
+	{
+		switch (internalFormat)
+		{
+		case GL_R8: case GL_STENCIL_INDEX8:
+			return 1;
+		case GL_RG8: case GL_R16: case GL_R16F: case GL_DEPTH_COMPONENT16:
+			return 2;
+		case GL_RGB: case GL_RGB8: case GL_SRGB8:	// 3 byte formats are padded to 4 by practically every driver
+		case GL_RGBA: case GL_RGBA8: case GL_SRGB8_ALPHA8: case GL_RGB10_A2: case GL_R11F_G11F_B10F:
+		case GL_RG16: case GL_RG16F: case GL_R32F: case GL_R32UI: case GL_R32I:
+		case GL_DEPTH_COMPONENT24: case GL_DEPTH_COMPONENT32: case GL_DEPTH_COMPONENT32F: case GL_DEPTH24_STENCIL8:
+			return 4;
+		case GL_RGB16F: case GL_RGBA16: case GL_RGBA16F: case GL_RG32F: case GL_DEPTH32F_STENCIL8:
+			return 8;
+		case GL_RGB32F: case GL_RGBA32F: case GL_RGBA32UI:
+			return 16;
+		default:
+			return 4;
+		}
+	}
+
+	const GpuMemoryTotals& totals()
+	{
+		return liveTotals;
+	}
+
+	GpuDriverMemoryInfo queryDriver()
+	{
+		GpuDriverMemoryInfo info;
+		if (GLAD_GL_NVX_gpu_memory_info)
+		{
+			GLint value = 0;
+			info.source = "GL_NVX_gpu_memory_info";
+			glGetIntegerv(GL_GPU_MEMORY_INFO_DEDICATED_VIDMEM_NVX, &value);			info.dedicatedKB = value;
+			glGetIntegerv(GL_GPU_MEMORY_INFO_TOTAL_AVAILABLE_MEMORY_NVX, &value);	info.totalAvailableKB = value;
+			glGetIntegerv(GL_GPU_MEMORY_INFO_CURRENT_AVAILABLE_VIDMEM_NVX, &value);	info.currentAvailableKB = value;
+			glGetIntegerv(GL_GPU_MEMORY_INFO_EVICTION_COUNT_NVX, &value);			info.evictionCount = value;
+			glGetIntegerv(GL_GPU_MEMORY_INFO_EVICTED_MEMORY_NVX, &value);			info.evictedKB = value;
+		}
+		else if (GLAD_GL_ATI_meminfo)
+		{
+			GLint values[4] = {};	// total free, largest free block, total auxiliary free, largest auxiliary free block
+			info.source = "GL_ATI_meminfo";
+			glGetIntegerv(GL_TEXTURE_FREE_MEMORY_ATI, values);		info.currentAvailableKB = values[0];
+			glGetIntegerv(GL_VBO_FREE_MEMORY_ATI, values);			info.freeBufferKB = values[0];
+			glGetIntegerv(GL_RENDERBUFFER_FREE_MEMORY_ATI, values);	info.freeRenderbufferKB = values[0];
+		}
+		return info;
+	}
+
+	void endFrame()
+	{
+		current.liveBytes = liveTotals.totalBytes;
+		history[next] = current;
+		next = (next + 1) % timelineLength;
+		if (filled < timelineLength)
+		{
+			filled++;
+		}
+
+		unsigned long long frame = current.frame + 1;
+		current = GpuMemoryFrame();
+		current.frame = frame;
+	}
+
+	int timeline(const GpuMemoryFrame** frames)
+	{
+		int oldest = filled < timelineLength ? 0 : next;
+		for (int i = 0; i < filled; i++)
+		{
+			ordered[i] = history[(oldest + i) % timelineLength];
+		}
+		*frames = ordered;
+		return filled;
+	}
+
+	void report(std::ostream& out)
+	{
+		out << "GPU memory (estimated): " << liveTotals.totalBytes / 1024 << " kB live, " << liveTotals.peakBytes / 1024 << " kB peak\n";
+		for (int i = 0; i < (int)GpuMemoryCategory::Count; i++)
+		{
+			if (liveTotals.objects[i] > 0)
+			{
+				out << "\t" << categoryNames[i] << ": " << liveTotals.objects[i] << " objects, " << liveTotals.bytes[i] / 1024 << " kB\n";
+			}
+		}
+
+		GpuDriverMemoryInfo driver = queryDriver();
+		out << "driver memory info (" << driver.source << ")";
+		if (driver.dedicatedKB >= 0)		out << " dedicated " << driver.dedicatedKB << " kB";
+		if (driver.currentAvailableKB >= 0)	out << " available " << driver.currentAvailableKB << " kB";
+		if (driver.evictionCount >= 0)		out << " evictions " << driver.evictionCount << " (" << driver.evictedKB << " kB)";
+		if (driver.freeBufferKB >= 0)		out << " free buffer pool " << driver.freeBufferKB << " kB";
+		out << "\n";
+
+		// frames where something was allocated or freed, steady state should have none
+		const GpuMemoryFrame* frames;
+		int count = timeline(&frames);
+		for (int i = 0; i < count; i++)
+		{
+			if (frames[i].allocations > 0 || frames[i].frees > 0)
+			{
+				out << "\tframe " << frames[i].frame << ": +" << frames[i].allocatedBytes << " bytes (" << frames[i].allocations << "), -"
+					<< frames[i].freedBytes << " bytes (" << frames[i].frees << "), live " << frames[i].liveBytes << "\n";
+			}
+		}
+	}
+
+	const char* categoryName(GpuMemoryCategory category)
+	{
+		return categoryNames[(int)category];
+	}
+}
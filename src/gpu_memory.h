@@ -0,0 +1,114 @@
+#ifndef GPU_MEMORY_H
+#define GPU_MEMORY_H
+
+/*
+ * NOTES:
+ * GPU memory accounting.
+ *
+ * OpenGL never tells us how much video memory our objects use, glBufferData/glTexImage2D just hand data to the driver. To know where
+ * the VRAM goes every buffer, texture and renderbuffer is created through the functions below, which record the size (computed from the
+ * size/format/dimensions we pass in) under a category. The numbers are estimates: drivers pad rows, round allocations up to pages and
+ * store GL_RGB8 as 4 bytes per pixel, so we count the way the driver most likely stores it.
+ *
+ * On top of our own accounting two vendor extensions report what the driver sees (values in kB):
+ *	*GL_NVX_gpu_memory_info (NVIDIA): dedicated, total available and currently available memory, plus evictions.
+ *	*GL_ATI_meminfo (AMD): free memory in the VBO, texture and renderbuffer pools.
+ * Both are plain glGetIntegerv queries, glad tells us if they exist through GLAD_GL_NVX_gpu_memory_info / GLAD_GL_ATI_meminfo.
+ *
+ * The objects themselves are created through GlResources (direct state access when available), this layer only adds the bookkeeping.
+ *
+ * Every frame GpuMemory::endFrame() closes a timeline entry with the bytes allocated and freed during the frame. A live total that keeps
+ * growing, or allocations and frees every frame (churn, which fragments driver memory), are both easy to see in the timeline.
+ */
+
+#include "gl_api.h"
+
+#include <ostream>
+
+#ifndef GL_BUFFER
+#define GL_BUFFER 0x82E0	// the object kind of buffers, a GL 4.3 (KHR_debug) enum the 3.3 loader doesn't have
+#endif
+
+// what a piece of GPU memory is used for
+enum class GpuMemoryCategory
+{
+	VertexBuffer,
+	IndexBuffer,
+	UniformBuffer,
+	Texture,
+	RenderTarget,
+	Other,
+	Count
+};
+
+// live totals per category
+struct GpuMemoryTotals
+{
+	long long bytes[(int)GpuMemoryCategory::Count] = {};
+	long long objects[(int)GpuMemoryCategory::Count] = {};
+	long long totalBytes = 0;
+	long long peakBytes = 0;
+};
+
+// one frame of the allocation timeline
+struct GpuMemoryFrame
+{
+	unsigned long long frame = 0;
+	long long allocatedBytes = 0;
+	long long freedBytes = 0;
+	int allocations = 0;
+	int frees = 0;
+	long long liveBytes = 0;	// total at the end of the frame
+};
+
+// what the driver reports through GL_NVX_gpu_memory_info or GL_ATI_meminfo, in kB, -1 when unknown
+struct GpuDriverMemoryInfo
+{
+	const char* source = "none";
+	long long dedicatedKB = -1;			// NVX: dedicated video memory
+	long long totalAvailableKB = -1;	// NVX: total memory available for allocations
+	long long currentAvailableKB = -1;	// NVX: currently free memory, ATI: free texture pool
+	long long evictionCount = -1;		// NVX: number of evictions since the context was created
+	long long evictedKB = -1;			// NVX: memory evicted to system memory
+	long long freeBufferKB = -1;		// ATI: free memory in the VBO pool
+	long long freeRenderbufferKB = -1;	// ATI: free memory in the renderbuffer pool
+};
+
+namespace GpuMemory
+{
+	// creates a buffer and uploads size bytes (data may be NULL), bindings are left as they were (see gl_resources.h)
+	unsigned int createBuffer(GpuMemoryCategory category, GLenum target, GLsizeiptr size, const void* data, GLenum usage);
+	// same with immutable storage, flags as for glBufferStorage (falls back to glBufferData before GL 4.4)
+	unsigned int createImmutableBuffer(GpuMemoryCategory category, GLenum target, GLsizeiptr size, const void* data, GLbitfield flags);
+	void resizeBuffer(unsigned int buffer, GLenum target, GLsizeiptr size, const void* data, GLenum usage);	// glBufferData on an existing buffer
+	void deleteBuffer(unsigned int buffer);
+
+	// creates a 2D texture with the given number of mip levels and uploads level 0 (data may be NULL), bindings are left as they were
+	unsigned int createTexture2D(GpuMemoryCategory category, GLenum internalFormat, int width, int height, int levels,
+		GLenum format, GLenum type, const void* data);
+	// creates a 3D texture of one level and uploads it (data may be NULL)
+	unsigned int createTexture3D(GpuMemoryCategory category, GLenum internalFormat, int width, int height, int depth,
+		GLenum format, GLenum type, const void* data);
+	void deleteTexture(unsigned int texture);
+
+	// generates a renderbuffer (multisampled when samples > 0)
+	unsigned int createRenderbuffer(GpuMemoryCategory category, GLenum internalFormat, int width, int height, int samples);
+	void deleteRenderbuffer(unsigned int renderbuffer);
+
+	// for objects created by other means, kind is GL_BUFFER, GL_TEXTURE or GL_RENDERBUFFER
+	void trackAllocation(GLenum kind, unsigned int name, GpuMemoryCategory category, GLenum internalFormat, long long bytes);
+	void trackFree(GLenum kind, unsigned int name);
+
+	long long bytesPerPixel(GLenum internalFormat);	// estimated storage size of one texel of internalFormat
+
+	const GpuMemoryTotals& totals();
+	GpuDriverMemoryInfo queryDriver();				// glGetIntegerv on the vendor extension, empty when neither is supported
+
+	void endFrame();								// close the current timeline entry
+	int timeline(const GpuMemoryFrame** frames);	// frames in order oldest to newest, returns the count
+
+	void report(std::ostream& out);					// totals per category, driver information and the recent timeline
+	const char* categoryName(GpuMemoryCategory category);
+}
+
+#endif
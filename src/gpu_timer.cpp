@@ -0,0 +1,225 @@
+/*
+ *	GPU frame time with timer queries, see gpu_timer.h
+ */
+
+#include "gpu_timer.h"
+#include "gl_api.h"
+
+namespace
+{
+	// the timestamps of one frame's scopes, two per scope
+	struct FrameScopes
+	{
+		GLuint queries[GpuTimer::maxScopes * 2];
+		const char* names[GpuTimer::maxScopes];
+		int count;
+	};
+
+	// a scope name's total over every measured frame
+	struct ScopeTotal
+	{
+		const char* name;
+		double milliseconds;
+		int frames;
+	};
+
+	GLuint queries[GpuTimer::queryCount] = {};
+	FrameScopes frameScopes[GpuTimer::queryCount] = {};
+	GpuScopeStats lastScopes[GpuTimer::maxScopes];
+	int lastScopeCount = 0;
+	ScopeTotal totals[GpuTimer::maxScopes * 2] = {};
+	int totalCount = 0;
+	bool scopeOpen = false;
+	unsigned long long dropped = 0;		// beginScope() calls past maxScopes
+	unsigned long long issued = 0;		// frames with a query started
+	unsigned long long collected = 0;	// frames whose result was read
+	bool running = false;
+	bool supported = false;
+	double lastMilliseconds = -1.0;
+}
+
+namespace GpuTimer
+{
+	bool init()
+	{
+		supported = GLAD_GL_VERSION_3_3 != 0;
+		if (!supported)
+		{
+			return false;
+		}
+		glGenQueries(queryCount, queries);
+		for (FrameScopes& scopes : frameScopes)
+		{
+			glGenQueries(maxScopes * 2, scopes.queries);
+			scopes.count = 0;
+		}
+		lastScopeCount = 0;
+		totalCount = 0;
+		dropped = 0;
+		issued = 0;
+		collected = 0;
+		lastMilliseconds = -1.0;
+		return true;
+	}
+
+	void beginFrame()
+	{
+		if (!supported || running)
+		{
+			return;
+		}
+		if (issued - collected == queryCount)
+		{
+			return;	// every query still in flight, this frame goes unmeasured rather than waiting
+		}
+		glBeginQuery(GL_TIME_ELAPSED, queries[issued % queryCount]);
+		frameScopes[issued % queryCount].count = 0;
+		running = true;
+	}
+
+	void endFrame()
+	{
+		if (!supported)
+		{
+			return;
+		}
+		if (running)
+		{
+			if (scopeOpen)
+			{
+				endScope();
+			}
+			glEndQuery(GL_TIME_ELAPSED);
+			running = false;
+			issued++;
+		}
+
+		// results arrive in order, read everything that is done
+		while (collected < issued)
+		{
+			GLuint query = queries[collected % queryCount];
+			GLint available = 0;
+			glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+			if (!available)
+			{
+				break;
+			}
+			GLuint64 nanoseconds = 0;
+			glGetQueryObjectui64v(query, GL_QUERY_RESULT, &nanoseconds);
+			lastMilliseconds = nanoseconds / 1000000.0;
+
+			// the timestamps were all issued before the frame's query ended, so they are done too
+			const FrameScopes& scopes = frameScopes[collected % queryCount];
+			lastScopeCount = scopes.count;
+			for (int i = 0; i < scopes.count; i++)
+			{
+				GLuint64 begin = 0, end = 0;
+				glGetQueryObjectui64v(scopes.queries[i * 2], GL_QUERY_RESULT, &begin);
+				glGetQueryObjectui64v(scopes.queries[i * 2 + 1], GL_QUERY_RESULT, &end);
+				lastScopes[i].name = scopes.names[i];
+				lastScopes[i].milliseconds = (end - begin) / 1000000.0;
+
+				int t = 0;
+				while (t < totalCount && totals[t].name != scopes.names[i])
+				{
+					t++;
+				}
+				if (t == totalCount && totalCount < maxScopes * 2)
+				{
+					totals[totalCount++] = { scopes.names[i], 0.0, 0 };
+				}
+				if (t < totalCount)
+				{
+					totals[t].milliseconds += lastScopes[i].milliseconds;
+					totals[t].frames++;
+				}
+			}
+			collected++;
+		}
+	}
+
+	double lastFrameMilliseconds()
+	{
+		return lastMilliseconds;
+	}
+
+	void beginScope(const char* name)
+	{
+		FrameScopes& scopes = frameScopes[issued % queryCount];
+		if (!running || scopeOpen)
+		{
+			return;
+		}
+		if (scopes.count == maxScopes)
+		{
+			dropped++;
+			return;
+		}
+		scopes.names[scopes.count] = name;
+		glQueryCounter(scopes.queries[scopes.count * 2], GL_TIMESTAMP);
+		scopeOpen = true;
+	}
+
+	void endScope()
+	{
+		if (!scopeOpen)
+		{
+			return;
+		}
+		FrameScopes& scopes = frameScopes[issued % queryCount];
+		glQueryCounter(scopes.queries[scopes.count * 2 + 1], GL_TIMESTAMP);
+		scopes.count++;
+		scopeOpen = false;
+	}
+
+	int lastFrameScopes(const GpuScopeStats** scopes)
+	{
+		*scopes = lastScopes;
+		return lastScopeCount;
+	}
+
+	double averageMilliseconds(const char* name)
+	{
+		for (int t = 0; t < totalCount; t++)
+		{
+			if (totals[t].name == name)
+			{
+				return totals[t].milliseconds / totals[t].frames;
+			}
+		}
+		return -1.0;
+	}
+
+	unsigned long long droppedScopes()
+	{
+		return dropped;
+	}
+
+	void report(std::ostream& out)
+	{
+		out << "GPU_TIMER::FRAME " << lastMilliseconds << " ms\n";
+		if (dropped > 0)
+		{
+			out << "GPU_TIMER::DROPPED " << dropped << " scopes past " << maxScopes << " per frame were not timed\n";
+		}
+		for (int t = 0; t < totalCount; t++)
+		{
+			out << "  " << totals[t].name << ": " << totals[t].milliseconds / totals[t].frames << " ms average (" << totals[t].frames << " frames)\n";
+		}
+	}
+
+	void destroy()
+	{
+		if (supported)
+		{
+			glDeleteQueries(queryCount, queries);
+			for (FrameScopes& scopes : frameScopes)
+			{
+				glDeleteQueries(maxScopes * 2, scopes.queries);
+			}
+			supported = false;
+			running = false;
+			scopeOpen = false;
+		}
+	}
+}
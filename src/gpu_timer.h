@@ -0,0 +1,52 @@
+#ifndef GPU_TIMER_H
+#define GPU_TIMER_H
+
+/*
+ * NOTES:
+ * GPU time of a whole frame, measured with GL_TIME_ELAPSED queries.
+ *
+ * The CPU side of a frame (Profiler) says nothing about the GPU: draw calls only queue work, the GPU runs it later, and a frame can be
+ * cheap to submit and still take the GPU 30ms. A timer query measures the GPU time between glBeginQuery and glEndQuery, but its result
+ * is only there once the GPU got that far, a frame or two later. Asking for it right away (GL_QUERY_RESULT) waits for the GPU and throws
+ * away the overlap between CPU and GPU.
+ *
+ * So every frame uses the next query of a small ring, and at the end of a frame the oldest query is read only if
+ * GL_QUERY_RESULT_AVAILABLE says it is done. lastFrameMilliseconds() is the latest result, a few frames behind the CPU.
+ *
+ * Queries of one target don't nest: nothing else may use GL_TIME_ELAPSED between beginFrame() and endFrame().
+ *
+ * Parts of a frame are timed with scopes, a GL_TIMESTAMP (glQueryCounter) at beginScope() and at endScope(). Timestamps are not
+ * GL_TIME_ELAPSED queries, so they can run inside the frame's query. They go through the same ring and are read together with their
+ * frame. The render graph puts one around every pass, so two ways of drawing the same frame can be compared pass by pass: report()
+ * prints every scope's average over the frames it ran in, and how many scopes a full frame had to drop. Scopes don't nest, names are
+ * stored by pointer (string literals).
+ */
+
+#include <ostream>
+
+struct GpuScopeStats
+{
+	const char* name = nullptr;
+	double milliseconds = 0.0;
+};
+
+namespace GpuTimer
+{
+	const int queryCount = 4;	// frames in flight, more than the driver queues ahead
+	const int maxScopes = 32;	// timed scopes per frame, more are counted as dropped and not timed
+
+	bool init();				// false (and every call below does nothing) before GL 3.3, which brought timer queries
+	void beginFrame();
+	void endFrame();			// collects the oldest finished frame, never waits
+	double lastFrameMilliseconds();	// -1 until the first result arrived
+
+	void beginScope(const char* name);	// between beginFrame() and endFrame()
+	void endScope();
+	int lastFrameScopes(const GpuScopeStats** scopes);	// scopes of the latest measured frame, returns the count
+	double averageMilliseconds(const char* name);		// over every measured frame the scope ran in, -1 when never
+	unsigned long long droppedScopes();					// scopes not timed because their frame already had maxScopes
+	void report(std::ostream& out);
+	void destroy();
+}
+
+#endif
@@ -0,0 +1,152 @@
+/*
+ *	Worker threads for parallel loops, see job_system.h
+ */
+
+#include "job_system.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	const int maxWorkers = 63;
+
+	std::vector<std::thread> workers;
+	std::mutex mutex;
+	std::condition_variable wake;		// workers wait for a new batch
+	std::condition_variable finished;	// the caller waits for the workers to finish the batch
+	unsigned long long generation = 0;	// batches started, under mutex
+	bool stopping = false;
+
+	// the current batch
+	JobFunction batchFunction = nullptr;
+	void* batchUser = nullptr;
+	int batchCount = 0;
+	std::atomic<int> nextIndex(0);
+	int done = 0;	// workers through with the current batch, under mutex. The next batch waits for all of them: a worker late to
+					// wake up would otherwise take indices of the next batch while running the function of the previous one
+
+	// runs indices of the batch until none are left, the batch is copied under the mutex
+	void work(JobFunction function, void* user, int count)
+	{
+		for (;;)
+		{
+			int index = nextIndex.fetch_add(1);
+			if (index >= count)
+			{
+				return;
+			}
+			function(index, user);
+		}
+	}
+
+	void workerMain()
+	{
+		unsigned long long seen = 0;
+		for (;;)
+		{
+			JobFunction function;
+			void* user;
+			int count;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				wake.wait(lock, [&] { return stopping || generation != seen; });
+				if (stopping)
+				{
+					return;
+				}
+				seen = generation;
+				function = batchFunction;
+				user = batchUser;
+				count = batchCount;
+			}
+			work(function, user, count);
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				done++;
+			}
+			finished.notify_one();
+		}
+	}
+}
+
+namespace JobSystem
+{
+	void init()
+	{
+		if (!workers.empty())
+		{
+			return;
+		}
+		int count = (int)std::thread::hardware_concurrency() - 1;
+		const char* setting = std::getenv("LEARNOPENGL_JOBS");
+		if (setting != nullptr && setting[0] != '\0')
+		{
+			count = std::atoi(setting);
+		}
+		count = count < 0 ? 0 : count > maxWorkers ? maxWorkers : count;
+
+		stopping = false;
+		workers.reserve(count);
+		for (int i = 0; i < count; i++)
+		{
+			workers.emplace_back(workerMain);
+		}
+	}
+
+	void shutdown()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			stopping = true;
+		}
+		wake.notify_all();
+		for (std::thread& worker : workers)
+		{
+			worker.join();
+		}
+		workers.clear();
+	}
+
+	int workerCount()
+	{
+		return (int)workers.size();
+	}
+
+	void parallelFor(int count, JobFunction function, void* user)
+	{
+		if (count <= 0)
+		{
+			return;
+		}
+		if (workers.empty() || count == 1)
+		{
+			for (int i = 0; i < count; i++)
+			{
+				function(i, user);
+			}
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			batchFunction = function;
+			batchUser = user;
+			batchCount = count;
+			nextIndex.store(0);
+			done = 0;
+			generation++;
+		}
+		wake.notify_all();
+
+		work(function, user, count);	// the caller helps instead of waiting idle
+
+		// the caller ran out of indices, the batch is over once every worker finished the ones it took
+		std::unique_lock<std::mutex> lock(mutex);
+		finished.wait(lock, [] { return done == (int)workers.size(); });
+	}
+}
@@ -0,0 +1,31 @@
+#ifndef JOB_SYSTEM_H
+#define JOB_SYSTEM_H
+
+/*
+ * NOTES:
+ * Worker threads for splitting per frame CPU work (light assignment, culling, ...) over the cores.
+ *
+ * parallelFor(count, function, user) calls function(index, user) once for every index in 0..count-1, spread over the workers and the
+ * calling thread, and returns when all of them are done. Indices are handed out one at a time from an atomic counter, so a slow index
+ * doesn't hold up the others; make each index a decent chunk of work (a depth slice, a cascade), not a single light.
+ *
+ * The workers are started once by init() and sleep on a condition variable between batches. A batch is a function pointer, a user
+ * pointer and a count: nothing is allocated per call, so it is fine in the render loop. The calling thread works on the batch too and
+ * with zero workers (a single core, or LEARNOPENGL_JOBS=0) parallelFor() is a plain loop.
+ *
+ * One batch at a time, from one thread (the render thread): parallelFor() is not reentrant and a job must not call it.
+ *
+ * LEARNOPENGL_JOBS=<n> sets the number of worker threads, by default one less than the hardware threads.
+ */
+
+typedef void (*JobFunction)(int index, void* user);
+
+namespace JobSystem
+{
+	void init();						// starts the workers
+	void shutdown();					// joins them
+	int workerCount();					// threads besides the caller, 0 before init()
+	void parallelFor(int count, JobFunction function, void* user);
+}
+
+#endif
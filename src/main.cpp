@@ -2,12 +2,45 @@
  *	Code with copious notes following learnopengl.com
  */
 
-#include <glad/glad.h>		// OpenGL library for providing driver functions for specific system, because OpenGL is a specification not a library.
+#include "gl_api.h"			// glad: OpenGL library for providing driver functions for specific system, because OpenGL is a specification not a library.
 							// Glad must be included before GLFW https://gamedev.stackexchange.com/questions/148453/getting-error-when-following-learnopengl-com-hello-window-tutorial-how-can-i
 #include <GLFW/glfw3.h>		// OpenGL library for providing a simple API for creating windows, contexts and surfaces, receiving input and events.
 
 #include <iostream>
 
+#include "alloc_tracker.h"	// counts heap allocations per frame, enforces no allocations in the render loop (Debug builds)
+#include "gl_capture.h"		// records every GL call into a trace file for tools/gl_replay (LEARNOPENGL_GL_CAPTURE=<file>)
+#include "gl_debug.h"		// glGetError checking / call tracing layer, compiled into Debug builds only
+#include "gl_debug_output.h"	// driver messages (KHR_debug): errors, performance warnings, filtered and rate limited
+#include "gl_stats.h"		// GL calls per frame by function and category (LEARNOPENGL_GL_STATS=on|stdout|title)
+#include "gl_resources.h"	// creates and edits GL objects with direct state access (GL 4.5) or bind-to-edit as fallback
+#include "gpu_timer.h"		// GPU time of a frame, timer queries read a few frames later
+#include "gpu_memory.h"		// creates buffers/textures through a tracker that knows how much GPU memory we use
+#include "render_target.h"	// offscreen framebuffers: MSAA resolve, transient attachments discarded, pooled targets shared between passes
+#include "render_graph.h"	// the frame's passes with the targets they read and write: culled, ordered, transient targets aliased
+#include "render_queue.h"	// draws sorted per pass: front to back for early-Z, depth prepass then GL_EQUAL colour pass
+#include "overdraw_meter.h"	// samples shaded per sample of the target, counted by occlusion queries
+#include "clustered_lighting.h"	// point lights binned into view frustum clusters on the CPU, looped over per fragment
+#include "cascaded_shadows.h"	// the sun's shadow: stable cascades in one depth atlas, the far ones cached
+#include "post_process.h"		// HDR post chain: bloom pyramid, tonemapping and colour grading fused into few passes
+#include "temporal_aa.h"		// temporal anti-aliasing: jittered frames blended into a reprojected history, instead of MSAA
+#include "particle_system.h"	// GPU particles: simulated by transform feedback, drawn as instanced quads
+#include "job_system.h"			// worker threads for parallel loops over per frame work
+#include "transform.h"			// camera and model matrices
+#include "pipeline_state.h"	// pipeline state objects: program, vertex layout, blend/depth/raster state baked and applied as a diff
+#include "uniform_buffer.h"	// uniform blocks (std140) sub-allocated per frame from one streaming uniform buffer
+#include "shader_reflection.h"	// uniform locations and block indices of a program, looked up by a compile time hash of the name
+#include "shader_cache.h"		// preprocesses (#include, defines, permutations), compiles and links shaders, each unique variant once
+#include "shader_permutations.h"	// the shader programs and their feature bits
+#include "profiler.h"				// named CPU scopes timed per frame
+#include "metrics_exporter.h"		// frame metrics in the Prometheus text format, served by a background thread (LEARNOPENGL_METRICS)
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
 /*
  * NOTES:
  * OpenGL is by itself a large state machine: a collection of variables that define how OpenGL should currently operate. 
@@ -65,21 +98,32 @@
 void framebuffer_size_callback(GLFWwindow* window, int width, int height);  // callback function used to resize viewport when window is resized
 void processInput(GLFWwindow* window); // used to process input
 
-// basic vertex shader
-const char* vertexShaderSource = "#version 330 core\n"
-"layout (location = 0) in vec3 aPos;\n"
-"void main()\n"
-"{\n"
-"   gl_Position = vec4(aPos.x, aPos.y, aPos.z, 1.0);\n"
-"}\0";
-
-// basic fragment shader
-const char* fragmentShaderSource =  "#version 330 core\n"
-"out vec4 FragColor;\n"
-"void main()\n"
-"{\n"
-"	FragColor = vec4(1.0f, 0.5f, 0.2f, 1.0f);\n"
-"}\0";
+// what the frame graph's passes need from the render loop, filled every frame before the graph runs
+struct SceneFrame
+{
+	PipelineCache* pipelines = nullptr;
+	UniformStream* uniforms = nullptr;
+	RenderQueue* queue = nullptr;
+	RenderQueue* shadowQueues = nullptr;	// one per cascade
+	CascadedShadows* shadows = nullptr;
+	UniformAllocation cascadeViews[CascadedShadows::cascadeCount];
+	UniformAllocation cameraView;
+	RenderGraphResource shadowAtlas = 0;	// imported into both graphs
+	RenderGraphResource sceneColor = 0;
+	RenderGraphResource gbuffer = 0;		// of the deferred graph
+	RenderGraphResource litColor = 0;
+	PipelineHandle deferredLighting = 0;	// full screen triangle
+	bool deferred = false;			// G toggles
+	bool temporalAA = false;		// T toggles, MSAA otherwise
+	bool depthPrepass = true;		// P toggles
+	bool showOverdraw = false;		// O toggles
+	long long targetSamples = 0;	// samples in the scene target, for the overdraw meter
+};
+void drawShadows(const RenderGraph& graph, void* user);			// the cascades that need it, depth only into their square of the atlas
+void drawDepthPrepass(const RenderGraph& graph, void* user);	// the opaque draws' depth, front to back
+void drawScene(const RenderGraph& graph, void* user);			// the triangles, into the scene target
+void drawGBuffer(const RenderGraph& graph, void* user);			// deferred: the triangles' surfaces, front to back
+void drawDeferredLighting(const RenderGraph& graph, void* user);	// deferred: every pixel lit once from the G-buffer
 
 int main()
 {
@@ -90,6 +134,9 @@ int main()
 	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
 	glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE); // don't use backward compatible features
 	//glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE); // only for mac
+#ifdef _DEBUG
+	glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE); // drivers send most of their debug and performance messages only to debug contexts
+#endif
 
 
 	// create window object
@@ -105,67 +152,182 @@ int main()
 	glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
 
 	// Initialise glad with required function pointers
+#ifdef GLAD_MULTI_CONTEXT
+	// into this context's own dispatch table, gl* calls on this thread go through it (see gl_api.h)
+	static GladGLContext glContext;
+	if (!gladLoadGLContext(&glContext, (GLADloadproc)glfwGetProcAddress))
+	{
+		std::cout << "Failed to initialize GLAD" << std::endl;
+		return -1;
+	}
+	gladMakeContextCurrent(&glContext);
+#else
 	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
 	{
 		std::cout << "Failed to initialize GLAD" << std::endl;
 		return -1;
 	}
+#endif
+	GlDebug::saveDriverEntryPoints();	// the driver's glGetError for the debug layer's checks, before the layers below wrap it
+
+	// record every GL call from here on when LEARNOPENGL_GL_CAPTURE names a trace file, replayed by tools/gl_replay without the application.
+	// The replay window is the size of the default framebuffer, which is not the window size on high DPI displays.
+	int framebufferWidth = 800, framebufferHeight = 600;
+	glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+	GlCapture::init(framebufferWidth, framebufferHeight);
+
+	// count every GL call per frame (draws, state changes, binds, uploaded bytes, ...) when LEARNOPENGL_GL_STATS asks for it
+	GlStats::init();
+
+	// glGetError after every call (and call tracing) in Debug builds, LEARNOPENGL_GL_DEBUG=off|errors|trace picks the mode
+	GlDebug::init();
+
+	// log what the driver reports through KHR_debug, printed once a frame and tagged with the profiler scope that caused it
+	GlDebugOutput::install();
+
+	// create and edit objects with direct state access (GL 4.5) when the driver has it, bind-to-edit otherwise
+	GlResources::init();
+
+	// GPU time of every frame, read back without waiting a few frames later
+	GpuTimer::init();
+
+	// start counting heap allocations, from here on every frame of the render loop is checked once the warm-up frames have passed
+	AllocTracker::install();
 
 	// SETUP
 	// graphics pipeline
 
-	// vertex shader (process 3D data, typically transforms it into normalised device coordinates)
-	unsigned int vertexShader;
-	vertexShader = glCreateShader(GL_VERTEX_SHADER);			// generate vertex shader object
-	glShaderSource(vertexShader, 1, &vertexShaderSource, NULL); // attach vertex shader source code to shader object
-	glCompileShader(vertexShader);								// compile vertex shader
+	// shaders live in files under shaders/ and are compiled through the preprocessor (#include, feature defines) and the shader cache,
+	// which compiles every unique preprocessed source only once. See shader_cache.cpp for the compile and link steps.
+	ShaderFileSystem shaderFiles;
+	shaderFiles.mountDirectory("shaders");
+	ShaderPreprocessor shaderPreprocessor(shaderFiles);
+	shaderPreprocessor.setFeatures(shaderFeatures, shaderFeatureCount);
+	ShaderCache shaders(shaderPreprocessor);
 
-	// check for any issues with compilation of shader
-	int  success;												// store state
-	char infoLog[512];											// storage container for error messages
-	glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
+	// request every program first and check them together, the driver can compile while we submit the next one
+	unsigned int shaderProgram = shaders.program("triangle.vert", "triangle.frag", SHADER_FEATURE_CLUSTERED_LIGHTING);	// lit by the point lights
+	unsigned int depthProgram = shaders.program("triangle.vert", "depth.frag", 0);			// depth prepass, same vertex shader
+	unsigned int overdrawProgram = shaders.program("triangle.vert", "overdraw.frag", 0);	// overdraw view
+	unsigned int gbufferProgram = shaders.program("triangle.vert", "gbuffer.frag", 0);		// deferred shading: surfaces into the G-buffer
+	unsigned int deferredLightingProgram = shaders.program("fullscreen.vert", "deferred_lighting.frag", 0);	// and lit from it
+	unsigned int bloomPrefilterProgram = shaders.program("fullscreen.vert", "bloom_downsample.frag", SHADER_FEATURE_BLOOM_PREFILTER);
+	unsigned int bloomDownsampleProgram = shaders.program("fullscreen.vert", "bloom_downsample.frag", 0);	// post chain
+	unsigned int bloomUpsampleProgram = shaders.program("fullscreen.vert", "bloom_upsample.frag", 0);
+	unsigned int tonemapProgram = shaders.program("fullscreen.vert", "tonemap.frag", 0);
+	unsigned int taaResolveProgram = shaders.program("fullscreen.vert", "taa_resolve.frag", 0);	// temporal anti-aliasing
+	// particles: the update's vertex outputs are captured into a buffer (its fragment shader never runs), the quads are drawn depth
+	// tested or, on the deferred path, soft against the G-buffer's depth
+	unsigned int particleUpdateProgram = shaders.feedbackProgram("particle_update.vert", "depth.frag", 0, particleUpdateVaryings,
+		particleUpdateVaryingCount);
+	unsigned int particleProgram = shaders.program("particle.vert", "particle.frag", 0);
+	unsigned int softParticleProgram = shaders.program("particle.vert", "particle.frag", SHADER_FEATURE_SOFT_PARTICLES);
+	if (!shaders.finish() || !shaders.linked(shaderProgram) || !shaders.linked(depthProgram) || !shaders.linked(overdrawProgram) ||
+		!shaders.linked(gbufferProgram) || !shaders.linked(deferredLightingProgram) || !shaders.linked(bloomPrefilterProgram) ||
+		!shaders.linked(bloomDownsampleProgram) || !shaders.linked(bloomUpsampleProgram) ||
+		!shaders.linked(tonemapProgram) || !shaders.linked(taaResolveProgram) || !shaders.linked(particleUpdateProgram) ||
+		!shaders.linked(particleProgram) || !shaders.linked(softParticleProgram))	// errors are printed as file(line) of the real file
+	{
+		glfwTerminate();
+		return -1;
+	}
 
-	if (!success) // if error with compilation of shader
+	// what the offline shader compiler found out about every permutation (written at build time, may be missing)
+	ShaderManifest shaderManifest;
+	bool manifestLoaded;
 	{
-		glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);	// get error message
-		std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n" << infoLog << std::endl; // output error message
+		AllocScope manifestScope(AllocTag::Shaders);
+		manifestLoaded = shaderManifest.load("shaders/shader_manifest.txt");
 	}
+	glUseProgram(shaderProgram);	// activate the shader program
+									// Every shader and rendering call after glUseProgram will now use this program object (and thus the shaders). 
 
-	// fragment shader (colours the pixels after they have been rasterised)
-	unsigned int fragmentShader;
-	fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);				// generate fragment shader object
-	glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);		// attach fragment shader source code to shader object
-	glCompileShader(fragmentShader);									// complies fragment shader
+	// ask the linked program once for its active uniforms and uniform blocks, from now on they are found by name hash instead of strings
+	// (or take them from the manifest when the program is in it, saving the enumeration queries)
+	const unsigned int programs[] = { shaderProgram, depthProgram, overdrawProgram, gbufferProgram, deferredLightingProgram,
+		bloomPrefilterProgram, bloomDownsampleProgram, bloomUpsampleProgram, tonemapProgram, taaResolveProgram, particleUpdateProgram,
+		particleProgram, softParticleProgram };
+	// every uniform block a shader may declare: its shared binding point and the size of the std140 struct the C++ side fills
+	// (uniform_buffer.h), which is the size of the range the uniform stream binds for it
+	const struct { unsigned int hash; UniformBinding binding; GLint size; } uniformBlocks[] = {
+		{ UNIFORM_HASH("PerFrame"), UniformBinding::PerFrame, (GLint)sizeof(PerFrameBlock) },
+		{ UNIFORM_HASH("PerView"), UniformBinding::PerView, (GLint)sizeof(PerViewBlock) },
+		{ UNIFORM_HASH("PerDraw"), UniformBinding::PerDraw, (GLint)sizeof(PerDrawBlock) },
+		{ UNIFORM_HASH("Lighting"), UniformBinding::Lighting, (GLint)sizeof(LightingBlock) },
+		{ UNIFORM_HASH("Shadows"), UniformBinding::Shadows, (GLint)sizeof(ShadowBlock) },
+		{ UNIFORM_HASH("Post"), UniformBinding::Post, (GLint)sizeof(PostBlock) },
+		{ UNIFORM_HASH("Temporal"), UniformBinding::Temporal, (GLint)sizeof(TemporalBlock) },
+		{ UNIFORM_HASH("Particles"), UniformBinding::Particles, (GLint)sizeof(ParticleBlock) },
+	};
+	// the pipelines keep every program's reflection, the loose uniforms below go through its cached setters
+	PipelineCache pipelines;
+	for (unsigned int program : programs)
+	{
+		// every program the app builds is listed in shader_permutations.h, so a miss means the manifest is stale (shaders edited since the
+		// shader compiler ran) or the runtime hashes the program differently than the compiler. Still works, the driver is asked instead
+		const ShaderManifestProgram* manifestEntry = shaderManifest.find(shaders.hashOf(program));
+		if (manifestLoaded && manifestEntry == nullptr)
+		{
+			std::cout << "WARNING::SHADER::NOT_IN_MANIFEST program " << program << " (hash " << std::hex << shaders.hashOf(program) << std::dec
+				<< ")" << std::endl;
+		}
+		ProgramReflection* reflection = pipelines.reflect(program, manifestEntry);
+		if (reflection == nullptr)
+		{
+			glfwTerminate();	// two uniform names with the same hash, printed by the reflection
+			return -1;
+		}
 
-	// check for any issues with compilation of shader
-	glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
+		// connect the blocks the program actually has (the reflection's list, nothing is looked up by name) to their shared binding
+		// points. A block the table doesn't know, or one bigger than its struct, would read outside the range bound to it: the shader
+		// and uniform_buffer.h disagree, it stays unbound and is reported
+		for (const ProgramReflection::Block& block : reflection->blocks())
+		{
+			const auto* known = std::find_if(std::begin(uniformBlocks), std::end(uniformBlocks),
+				[&block](const auto& entry) { return entry.hash == block.hash; });
+			if (known == std::end(uniformBlocks))
+			{
+				std::cout << "ERROR::SHADER::UNKNOWN_UNIFORM_BLOCK (hash " << block.hash << ") in program " << program << std::endl;
+			}
+			else if (block.dataSize > known->size)
+			{
+				std::cout << "ERROR::SHADER::UNIFORM_BLOCK_SIZE (hash " << block.hash << ") in program " << program << " is "
+					<< block.dataSize << " bytes, its struct " << known->size << std::endl;
+			}
+			else
+			{
+				reflection->bindBlock(block.hash, known->binding);
+			}
+		}
 
-	if (!success) // if error with compilation of shader
-	{
-		glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);	// get error message
-		std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n" << infoLog << std::endl; // output error message
+		// samplers can't name their texture unit in GLSL 3.30 either, the lighting texture buffers, the G-buffer, the shadow atlas and
+		// the inputs of the post chain, the TAA resolve and the soft particles always sit on the same units
+		const struct { unsigned int hash; GLuint unit; } samplers[] = {
+			{ UNIFORM_HASH("clusterLists"), (GLuint)LightingTextureUnit::Clusters },
+			{ UNIFORM_HASH("lightIndices"), (GLuint)LightingTextureUnit::LightIndices },
+			{ UNIFORM_HASH("lights"), (GLuint)LightingTextureUnit::Lights },
+			{ UNIFORM_HASH("gbuffer0"), 0 },
+			{ UNIFORM_HASH("gbuffer1"), 1 },
+			{ UNIFORM_HASH("gbufferDepth"), 2 },
+			{ UNIFORM_HASH("shadowAtlas"), shadowAtlasUnit },
+			{ UNIFORM_HASH("postSource"), (GLuint)PostTextureUnit::Source },
+			{ UNIFORM_HASH("postBloom"), (GLuint)PostTextureUnit::Bloom },
+			{ UNIFORM_HASH("gradingLut"), (GLuint)PostTextureUnit::GradingLut },
+			{ UNIFORM_HASH("taaCurrent"), (GLuint)TemporalTextureUnit::Current },
+			{ UNIFORM_HASH("taaDepth"), (GLuint)TemporalTextureUnit::Depth },
+			{ UNIFORM_HASH("taaHistory"), (GLuint)TemporalTextureUnit::History },
+			{ UNIFORM_HASH("particleDepth"), (GLuint)ParticleTextureUnit::Depth },
+		};
+		glUseProgram(program);
+		for (const auto& sampler : samplers)
+		{
+			reflection->setInt(sampler.hash, (GLint)sampler.unit);	// false (nothing set) when the program has no such sampler
+		}
 	}
+	glUseProgram(shaderProgram);
 
-	// link compiled shaders to a shader program that is activated when rendering objects
-	unsigned int shaderProgram;
-	shaderProgram = glCreateProgram();				// generate shader program object
-	glAttachShader(shaderProgram, vertexShader);	// attached compiled vertex shader
-	glAttachShader(shaderProgram, fragmentShader);	// attach compiled fragment shader
-	glLinkProgram(shaderProgram);					// link shader program together
-	glUseProgram(shaderProgram);					// activate the shader program
-													// Every shader and rendering call after glUseProgram will now use this program object (and thus the shaders). 
-
-	// delete shader programs now that they have been copied and linked in the shader program
-	glDeleteShader(vertexShader);
-	glDeleteShader(fragmentShader);
-
-	// check for any issues with the shader program
-	glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-	if (!success) {
-		glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);	// get error message
-		std::cout << "ERROR::SHADER::PROGRAM:: Linking failed\n" << infoLog << std::endl; // output error message
-	}
-	
+	// streaming uniform buffer with 3 frames in flight, created below once the number of blocks a frame allocates is known
+	UniformStream uniforms;
 
 	// Initialise TRIANGLE object
 	// vertex data, current defined within normalized device coordinates, -1.0 and 1.0 on all 3 axes (x, y and z)
@@ -179,8 +341,9 @@ int main()
 	// create memory on the GPU to store vertex information
 	// memory managed by vertex buffer objects (VBO), batch send information from CPU to GPU slow, want to send as much data as possible at once
 	// OpenGL object...
-	unsigned int VBO;
-	glGenBuffers(1, &VBO);	// generate buffer id
+	// generate buffer id and copy the vertex data into it (see below), created through the GPU memory tracker so the size is counted
+	// immutable storage (flags 0: never written again), the size and contents are fixed at creation like GL_STATIC_DRAW promised
+	unsigned int VBO = GpuMemory::createImmutableBuffer(GpuMemoryCategory::VertexBuffer, GL_ARRAY_BUFFER, sizeof(vertices), vertices, 0);
 
 	/* PROVIDED AS INFORMATION
 	glBindBuffer(GL_ARRAY_BUFFER, VBO); // bind that buffer object by its id to the GL_ARRAY_BUFFER type target
@@ -222,60 +385,722 @@ int main()
 
 	// typical -> VAO -> VBO -> vertex data -> define/enable vertex attributes 
 
-	// VAO initialisation code
-	unsigned int VAO;
-	glGenVertexArrays(1, &VAO); // generate voa
-	glBindVertexArray(VAO); // bind voa
-	glBindBuffer(GL_ARRAY_BUFFER, VBO);
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);		// bind and copy vbo
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 3 * sizeof(float), (void*)0);
-	glEnableVertexAttribArray(0);													// set vertex attributes
-	
-	
-	glBindBuffer(GL_ARRAY_BUFFER, 0);	// unbind buffer
-	// note that this is allowed, the call to glVertexAttribPointer registered VBO as the vertex attribute's bound vertex buffer object so 
-	//afterwards we can safely unbind
-	glBindVertexArray(0);				//unbind vertex array
+	// VAO initialisation code, done by the pipeline: it owns a VAO for its vertex layout and points the attributes at the VBO the
+	// first time the VBO is attached (glBindBuffer + glVertexAttribPointer + glEnableVertexAttribArray as above)
+	// the pipeline also bakes the rest of the state the draw depends on (blending, depth, culling, polygon mode), see pipeline_state.h
+	PipelineDesc triangleDesc;
+	triangleDesc.program = shaderProgram;
+	triangleDesc.layout.add(0, 3, GL_FLOAT, 0);			// location 0: vec3 position, 3 floats at the start of the vertex
+	triangleDesc.layout.stride = 3 * sizeof(float);		// tightly packed
+	triangleDesc.blend = BlendState::opaque();
+	// one pipeline per pass of the render queue: depth tested colour, depth prepass, GL_EQUAL colour after it, the overdraw view and
+	// the G-buffer
+	DrawMaterial triangleMaterial = createMaterial(pipelines, triangleDesc, depthProgram, overdrawProgram, gbufferProgram);
+	for (PipelineHandle pipeline : triangleMaterial.pipelines)
+	{
+		if (pipeline == 0)
+		{
+			glfwTerminate();
+			return -1;
+		}
+	}
+
+	// a stack of large overlapping triangles at different depths in front of the camera, listed back to front: drawn in this order
+	// every layer would be shaded, the render queue sorts them front to back
+	const int triangleCount = 32;
+	RenderQueue queue;
+	queue.reserve(triangleCount);
+	std::vector<DrawItem> sceneItems(triangleCount);	// the frame's draws, copied into the shadow queues of the cascades they fall in
+
+	// every block the render loop allocates in a frame: PerFrame, PerView, Temporal, Lighting, Shadow, Post and Particles once, a PerView
+	// per cascade and a PerDraw per triangle. A region that holds them all can't run out, allocate() never returns NULL below.
+	const int uniformBlocksPerFrame = 7 + CascadedShadows::cascadeCount + triangleCount;
+	const GLsizeiptr uniformBytesPerFrame = sizeof(PerFrameBlock) + sizeof(PerViewBlock) + sizeof(TemporalBlock) + sizeof(LightingBlock) +
+		sizeof(ShadowBlock) + sizeof(PostBlock) + sizeof(ParticleBlock) + CascadedShadows::cascadeCount * sizeof(PerViewBlock) +
+		triangleCount * sizeof(PerDrawBlock);
+	if (!uniforms.create(uniformBytesPerFrame, 3, uniformBlocksPerFrame))
+	{
+		std::cout << "Failed to create the uniform buffer" << std::endl;
+		glfwTerminate();
+		return -1;
+	}
+
+	// every triangle casts a shadow, its bounding sphere is what the cascades cull (the triangle is 2.5 units wide around its centre)
+	std::vector<ShadowCaster> casters(triangleCount);
+	for (int i = 0; i < triangleCount; i++)
+	{
+		float t = (float)i / (float)(triangleCount - 1);
+		casters[i].center[0] = 0.3f * (t - 0.5f);
+		casters[i].center[1] = 0.2f * (0.5f - t);
+		casters[i].center[2] = -0.9f + 1.8f * t;	// back to front in submission order
+		casters[i].radius = 2.5f * 0.70710678f;
+	}
+	RenderQueue shadowQueues[CascadedShadows::cascadeCount];
+	for (RenderQueue& shadowQueue : shadowQueues)
+	{
+		shadowQueue.reserve(triangleCount);
+	}
 
 	// of note can also set element buffer object (EBO) to define incides to draw a combination of object from the same vertices
 	// look up if required
 
+	// the frame as a graph of passes: the scene is drawn into an offscreen target instead of the window (4x multisampled HDR colour,
+	// resolved into a texture that later passes can sample, and a depth/stencil buffer that is only needed while drawing, transient
+	// and discarded at the end of the pass), then post-processed into the window. The graph owns the scene target and sizes it to the
+	// window.
+	RenderTargetPool renderTargets;
+	RenderGraph frameGraph(renderTargets, pipelines);	// after the pool and the pipeline cache, destroyed before them
+	RenderGraph taaGraph(renderTargets, pipelines);	// the same frame with temporal anti-aliasing instead of MSAA, see below
+	SceneFrame sceneFrame;
+	sceneFrame.pipelines = &pipelines;
+	sceneFrame.uniforms = &uniforms;
+	sceneFrame.queue = &queue;
+	sceneFrame.shadowQueues = shadowQueues;
+
+	// SHADOWS: the sun shadows the scene through 4 cascades up to 12 units from the camera, all in one 2048 x 2048 depth atlas that
+	// lives across frames (the cached cascades are drawn only now and then). Every graph imports it, their Shadows pass draws the
+	// cascades that need it and the lit passes read it.
+	CascadedShadows shadows;
+	if (!shadows.create(renderTargets, triangleCount))
+	{
+		glfwTerminate();
+		return -1;
+	}
+	sceneFrame.shadows = &shadows;
+
+	RenderTargetDesc sceneDesc;				// width and height 0: the size of the frame
+	sceneDesc.samples = 4;
+	sceneDesc.addColor(GL_R11F_G11F_B10F).setDepthStencil(GL_DEPTH24_STENCIL8, true);
+
+	// TEMPORAL ANTI-ALIASING, T switches between 4x MSAA and TAA on either path
+	// 4x MSAA draws, stores and resolves 4 samples per pixel. TAA draws one, at a different sub-pixel position every frame, and blends
+	// the frames in one full screen pass (see temporal_aa.h). Its graphs draw the same passes into a single sampled scene target whose
+	// depth is kept for the resolve, the resolve writes the history the post chain reads.
+	RenderTargetDesc taaSceneDesc;
+	taaSceneDesc.addColor(GL_R11F_G11F_B10F).setDepthStencil(GL_DEPTH24_STENCIL8);	// both sampled
+	TemporalAA temporalAA;
+
+	// POST-PROCESSING: every path lights into an HDR target, the post chain blooms, tonemaps and grades it into the window
+	PostChain postChain;
+	if (!temporalAA.create(renderTargets, pipelines, taaResolveProgram, framebufferWidth, framebufferHeight) ||
+		!postChain.create(pipelines, bloomPrefilterProgram, bloomDownsampleProgram, bloomUpsampleProgram, tonemapProgram))
+	{
+		glfwTerminate();
+		return -1;
+	}
+
+	// PARTICLES: fountains of sparks in front of the triangles (LEARNOPENGL_PARTICLES=<n>, a million by default). Their state never
+	// leaves the GPU, see particle_system.h. They are added onto the lit HDR scene before the post chain, the young ones are bright
+	// enough to bloom. With TAA they are drawn after the resolve, onto a copy of its output, and soft against the scene's depth: they
+	// write no depth (nor motion) for the reprojection, in the history they would smear into trails behind every spark.
+	int particleCapacity = 1 << 20;
+	if (const char* value = std::getenv("LEARNOPENGL_PARTICLES"))
+	{
+		particleCapacity = std::max(1, std::min(std::atoi(value), 1 << 24));
+	}
+	ParticleSystem particles;
+	if (!particles.create(pipelines, particleUpdateProgram, particleProgram, softParticleProgram, particleCapacity))
+	{
+		glfwTerminate();
+		return -1;
+	}
+
+	// start of frame you want to clear the screen previous rendering would still be visable, the graph clears the scene target
+	// (colour blueish green, black in the overdraw view) when the first pass starts, clearing every attachment also tells the driver
+	// the old contents are not needed. The depth prepass fills the depth buffer, the colour pass draws on top of it (Load).
+	// Both forward graphs are declared in the same order, so the resource handles kept in sceneFrame are the same in either.
+	const float clearColor[4] = { 0.2f, 0.3f, 0.3f, 1.0f };
+	const float overdrawClearColor[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+	RenderGraph* forwardGraphs[2] = { &frameGraph, &taaGraph };
+	RenderGraphPass prepassPasses[2] = {};
+	for (int i = 0; i < 2; i++)
+	{
+		RenderGraph& graph = *forwardGraphs[i];
+		bool temporal = i == 1;
+		sceneFrame.sceneColor = graph.createTarget("Scene", temporal ? taaSceneDesc : sceneDesc);
+		sceneFrame.shadowAtlas = graph.importTarget("ShadowAtlas", shadows.target());
+		RenderGraphPass shadowPass = graph.addPass("Shadows", drawShadows, &sceneFrame);
+		graph.write(shadowPass, sceneFrame.shadowAtlas, RenderGraphLoad::Load);	// cached cascades keep their depths
+		prepassPasses[i] = graph.addPass("DepthPrepass", drawDepthPrepass, &sceneFrame);
+		graph.write(prepassPasses[i], sceneFrame.sceneColor, RenderGraphLoad::Clear);
+		graph.setClearValues(prepassPasses[i], clearColor, 1.0f, 0);
+		RenderGraphPass scenePass = graph.addPass("Triangles", drawScene, &sceneFrame);
+		graph.write(scenePass, sceneFrame.sceneColor, RenderGraphLoad::Load);
+		graph.read(scenePass, sceneFrame.shadowAtlas);
+
+		RenderGraphResource postInput = temporal ? temporalAA.addPass(graph, sceneFrame.sceneColor, sceneFrame.sceneColor, true) :
+			sceneFrame.sceneColor;
+		if (postInput != 0)
+		{
+			// without TAA depth tested against the scene's depth buffer, still bound. The resolved image has no depth, the particles
+			// are soft against the scene's sampled one.
+			particles.addPass(graph, postInput, temporal ? sceneFrame.sceneColor : 0);
+		}
+		graph.setFrameSize(framebufferWidth, framebufferHeight);
+		if (postInput == 0 || !postChain.addPasses(graph, postInput) || !graph.compile())
+		{
+			glfwTerminate();
+			return -1;
+		}
+	}
+
+	// DEFERRED SHADING, G toggles between the two at runtime
+	// Forward shading lights every fragment the rasteriser produces, with overdraw a pixel is lit several times (the prepass helps,
+	// at the price of drawing everything twice). Deferred shading splits the work: the GBuffer pass only writes what lighting needs
+	// per pixel, the DeferredLighting pass then lights every pixel exactly once with a full screen triangle. It loops over the same
+	// cluster lists as the forward shader, so the lights a pixel pays for don't change, only how often.
+	// The price is bandwidth: every pixel's surface is written and read back. The G-buffer is kept to two RGBA8 targets and depth,
+	// 12 bytes per pixel:
+	//	*target 0	albedo.rgb, metalness
+	//	*target 1	view space normal in octahedral form (two 12 bit values over rgb, about 0.06 degrees of error), roughness
+	//	*depth		24 bit, the view space position is rebuilt from it and the projection
+	// There is no MSAA on this path (lighting every sample would undo the savings), TAA works on it like on the forward path. Which
+	// path wins depends on the scene, so both run through the GPU timer: every pass is timed and the averages are printed at exit.
+	RenderGraph deferredGraph(renderTargets, pipelines);
+	RenderGraph deferredTaaGraph(renderTargets, pipelines);
+	RenderTargetDesc gbufferDesc;
+	gbufferDesc.addColor(GL_RGBA8).addColor(GL_RGBA8).setDepthStencil(GL_DEPTH_COMPONENT24);	// all sampled, none transient
+	RenderTargetDesc litDesc;
+	litDesc.addColor(GL_R11F_G11F_B10F);
+
+	PipelineDesc deferredLightingDesc;	// no vertex attributes, the vertex shader makes the triangle from gl_VertexID
+	deferredLightingDesc.program = deferredLightingProgram;
+	deferredLightingDesc.depth.test = false;
+	deferredLightingDesc.depth.write = false;
+	sceneFrame.deferredLighting = pipelines.create(deferredLightingDesc);
+	if (sceneFrame.deferredLighting == 0)
+	{
+		glfwTerminate();
+		return -1;
+	}
+
+	const float gbufferClear[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+	RenderGraph* deferredGraphs[2] = { &deferredGraph, &deferredTaaGraph };	// declared in the same order, like the forward ones
+	for (int i = 0; i < 2; i++)
+	{
+		RenderGraph& graph = *deferredGraphs[i];
+		sceneFrame.gbuffer = graph.createTarget("GBuffer", gbufferDesc);
+		sceneFrame.litColor = graph.createTarget("Lit", litDesc);
+		RenderGraphResource deferredShadowAtlas = graph.importTarget("ShadowAtlas", shadows.target());	// the same in every graph
+		RenderGraphPass deferredShadowPass = graph.addPass("Shadows", drawShadows, &sceneFrame);
+		graph.write(deferredShadowPass, deferredShadowAtlas, RenderGraphLoad::Load);
+		RenderGraphPass gbufferPass = graph.addPass("GBuffer", drawGBuffer, &sceneFrame);
+		graph.write(gbufferPass, sceneFrame.gbuffer, RenderGraphLoad::Clear);
+		graph.setClearValues(gbufferPass, gbufferClear, 1.0f, 0);	// depth 1 marks the pixels nothing was drawn into
+		RenderGraphPass lightingPass = graph.addPass("DeferredLighting", drawDeferredLighting, &sceneFrame);
+		graph.read(lightingPass, sceneFrame.gbuffer);
+		graph.read(lightingPass, deferredShadowAtlas);
+		graph.write(lightingPass, sceneFrame.litColor, RenderGraphLoad::Clear);
+		graph.setClearValues(lightingPass, clearColor, 1.0f, 0);	// the background, lighting skips those pixels
+
+		// the lit target has no depth, soft against the G-buffer's. With TAA onto the resolved image, like the forward path.
+		RenderGraphResource postInput = i == 1 ? temporalAA.addPass(graph, sceneFrame.litColor, sceneFrame.gbuffer, true) : sceneFrame.litColor;
+		if (postInput != 0)
+		{
+			particles.addPass(graph, postInput, sceneFrame.gbuffer);
+		}
+		graph.setFrameSize(framebufferWidth, framebufferHeight);
+		if (postInput == 0 || !postChain.addPasses(graph, postInput) || !graph.compile())
+		{
+			glfwTerminate();
+			return -1;
+		}
+	}
+	bool deferredKeyDown = false, temporalKeyDown = false;
+	int frameWidth = framebufferWidth, frameHeight = framebufferHeight;
+
+	// how many samples the colour pass shades per sample of the scene target, P switches the depth prepass, O the overdraw view
+	OverdrawMeter::init();
+	bool prepassKeyDown = false, overdrawKeyDown = false;
+
+	// the camera: 3 units in front of the triangle stack looking at it, swaying slowly from side to side so the shadows have to stay
+	// stable under a moving view
+	const float fieldOfView = 60.0f * 3.14159265f / 180.0f, nearPlane = 0.1f, farPlane = 100.0f;
+	float eye[3] = { 0.0f, 0.0f, 3.0f };
+	const float target[3] = { 0.0f, 0.0f, 0.0f }, up[3] = { 0.0f, 1.0f, 0.0f };
+	float viewMatrix[16], projectionMatrix[16];
+	Transform::lookAt(viewMatrix, eye, target, up);
+
+	// the sun shines down from the upper left behind the camera
+	float sunDirection[3] = { 0.35f, -0.5f, -0.8f };
+	float sunLength = std::sqrt(sunDirection[0] * sunDirection[0] + sunDirection[1] * sunDirection[1] + sunDirection[2] * sunDirection[2]);
+	for (float& component : sunDirection)
+	{
+		component /= sunLength;
+	}
+	shadows.setSplits(nearPlane, 12.0f);
+
+	// point lights drifting around the triangles (LEARNOPENGL_LIGHTS=<n>, 1024 by default), binned into clusters every frame with the
+	// work split over the job system's threads
+	JobSystem::init();
+	int lightCount = 1024;
+	if (const char* value = std::getenv("LEARNOPENGL_LIGHTS"))
+	{
+		lightCount = std::max(1, std::min(std::atoi(value), 65535));
+	}
+	std::vector<PointLight> lights(lightCount);
+	std::vector<float> lightOrbits((size_t)lightCount * 4);	// centre x, y, z and phase, the lights circle around them
+	unsigned int seed = 12345u;
+	auto nextRandom = [&seed]() { seed = seed * 1664525u + 1013904223u; return (float)(seed >> 8) / 16777216.0f; };	// LCG, 0..1
+	for (int i = 0; i < lightCount; i++)
+	{
+		lightOrbits[i * 4 + 0] = nextRandom() * 4.0f - 2.0f;
+		lightOrbits[i * 4 + 1] = nextRandom() * 3.0f - 1.5f;
+		lightOrbits[i * 4 + 2] = nextRandom() * 2.4f - 1.2f;
+		lightOrbits[i * 4 + 3] = nextRandom() * 6.2831853f;
+		lights[i].radius = 0.25f + 0.5f * nextRandom();
+		lights[i].color[0] = nextRandom();
+		lights[i].color[1] = nextRandom();
+		lights[i].color[2] = nextRandom();
+		lights[i].intensity = 1.5f;
+	}
+	ClusteredLights clusteredLights;
+	if (!clusteredLights.create(lightCount))
+	{
+		glfwTerminate();
+		return -1;
+	}
+	Transform::perspective(projectionMatrix, fieldOfView, (float)frameWidth / frameHeight, nearPlane, farPlane);
+	clusteredLights.setView(frameWidth, frameHeight, fieldOfView, nearPlane, farPlane);
+
+	// four fountains below the triangles, together they start as many particles per second as the buffers hold over the longest
+	// lifetime, so the ring only ever overwrites dead ones
+	ParticleEmitter fountains[4];
+	for (int i = 0; i < 4; i++)
+	{
+		fountains[i].position[0] = -1.5f + (float)i;
+		fountains[i].position[1] = -1.2f;
+		fountains[i].position[2] = 1.0f;
+		fountains[i].radius = 0.05f;
+		fountains[i].velocity[1] = 4.0f;
+		fountains[i].spread = 1.2f;
+		fountains[i].lifetimeMin = 1.0f;
+		fountains[i].lifetimeMax = 2.0f;
+	}
+	const float particlesPerSecond = (float)particles.capacity() / fountains[0].lifetimeMax;
+	float particleBacklog = 0.0f;	// the fraction of a particle not started yet
+	float previousTime = (float)glfwGetTime();
+
 	// render loop, keep running until told to stop, keeps window open
 	// each iteration of the render loop is a "frame"
+	// publish frame times, GPU time, uploads, shader cache, VRAM and allocation counts for scraping when LEARNOPENGL_METRICS asks for it
+	MetricsExporter::init();
+	unsigned long long frameNumber = 0;
+	long long driverAvailableKB = -1;
+
 	while (!glfwWindowShouldClose(window))
 	{
-		// input
-		processInput(window);		// process input (keyboard, mouse, etc)
+		// follow the window size before the frame starts, compiling the graph again allocates (0 x 0 while minimised, keep the old size)
+		glfwGetFramebufferSize(window, &framebufferWidth, &framebufferHeight);
+		if (framebufferWidth > 0 && framebufferHeight > 0 && (framebufferWidth != frameWidth || framebufferHeight != frameHeight))
+		{
+			frameWidth = framebufferWidth;
+			frameHeight = framebufferHeight;
+			bool compiled = true;
+			for (int i = 0; i < 2; i++)
+			{
+				forwardGraphs[i]->setFrameSize(frameWidth, frameHeight);
+				compiled = forwardGraphs[i]->compile() && compiled;
+				deferredGraphs[i]->setFrameSize(frameWidth, frameHeight);
+				compiled = deferredGraphs[i]->compile() && compiled;
+			}
+			if (!compiled)	// the pool couldn't create the targets of the new size, a graph that didn't compile draws nothing
+			{
+				std::cout << "Failed to resize the frame to " << frameWidth << " x " << frameHeight << std::endl;
+				glfwTerminate();
+				return -1;
+			}
+			temporalAA.setFrameSize(frameWidth, frameHeight);
+			renderTargets.trim();	// the targets of the old size, a window being dragged would otherwise pile them up
+			Transform::perspective(projectionMatrix, fieldOfView, (float)frameWidth / frameHeight, nearPlane, farPlane);
+			clusteredLights.setView(frameWidth, frameHeight, fieldOfView, nearPlane, farPlane);	// the cluster grid follows the size
+		}
+
+		// input, before the frame: the toggles print with std::cout, which may allocate, that is the platform's and not the render loop's
+		{
+			AllocScope inputScope(AllocTag::Platform);
+			processInput(window);		// process input (keyboard, mouse, etc)
+			bool prepassKey = glfwGetKey(window, GLFW_KEY_P) == GLFW_PRESS;
+			bool overdrawKey = glfwGetKey(window, GLFW_KEY_O) == GLFW_PRESS;
+			if ((prepassKey && !prepassKeyDown) || (overdrawKey && !overdrawKeyDown))
+			{
+				std::cout << "depth prepass " << (sceneFrame.depthPrepass ? "on" : "off") << ": " << OverdrawMeter::lastSamplesShaded()
+					<< " samples shaded per sample\n";
+				sceneFrame.depthPrepass = prepassKey && !prepassKeyDown ? !sceneFrame.depthPrepass : sceneFrame.depthPrepass;
+				sceneFrame.showOverdraw = overdrawKey && !overdrawKeyDown ? !sceneFrame.showOverdraw : sceneFrame.showOverdraw;
+				for (int i = 0; i < 2; i++)
+				{
+					forwardGraphs[i]->setClearValues(prepassPasses[i], sceneFrame.showOverdraw ? overdrawClearColor : clearColor, 1.0f, 0);
+				}
+			}
+			prepassKeyDown = prepassKey;
+			overdrawKeyDown = overdrawKey;
+			bool deferredKey = glfwGetKey(window, GLFW_KEY_G) == GLFW_PRESS;
+			if (deferredKey && !deferredKeyDown)
+			{
+				sceneFrame.deferred = !sceneFrame.deferred;
+				std::cout << (sceneFrame.deferred ? "deferred" : "forward") << " shading, GPU frame " << GpuTimer::lastFrameMilliseconds()
+					<< " ms before the switch\n";
+			}
+			deferredKeyDown = deferredKey;
+			bool temporalKey = glfwGetKey(window, GLFW_KEY_T) == GLFW_PRESS;
+			if (temporalKey && !temporalKeyDown)
+			{
+				sceneFrame.temporalAA = !sceneFrame.temporalAA;
+				temporalAA.reset();		// the history is from before TAA was switched off
+				std::cout << (sceneFrame.temporalAA ? "TAA" : "4x MSAA") << ", GPU frame " << GpuTimer::lastFrameMilliseconds()
+					<< " ms before the switch\n";
+			}
+			temporalKeyDown = temporalKey;
+		}
+
+		AllocTracker::beginFrame();	// no heap allocations allowed from here to endFrame (after warm-up)
+		AllocScope renderScope(AllocTag::Render);
+		Profiler::beginFrame();
+		GpuTimer::beginFrame();
 
 		// rendering commands here
 
-		// start of frame you want to clear the screen previous rendering would still be visable
-		glClearColor(0.2f, 0.3f, 0.3f, 1.0f);		// state setting function, colour blueish green
-		glClear(GL_COLOR_BUFFER_BIT);				// state using function
-													// clear entire framebuffer	of the current framebuffer, GL_COLOR_BUFFER_BIT clear to color as specificed in glClearColor
-													// possible GL_COLOR_BUFFER_BIT, GL_DEPTH_BUFFER_BIT and GL_STENCIL_BUFFER_BIT
+		float time = (float)glfwGetTime();
+		float deltaTime = std::min(time - previousTime, 0.1f);	// a stall (breakpoint, dragged window) doesn't throw the particles
+		previousTime = time;
+		eye[0] = 0.6f * std::sin(time * 0.25f);
+		eye[1] = 0.2f * std::sin(time * 0.17f);
+		Transform::lookAt(viewMatrix, eye, target, up);
+
+		// move the lights and sort them into the clusters of this view, then refill the texture buffers the shader reads them from
+		{
+			PROFILE_SCOPE("LightAssign");
+			for (int i = 0; i < lightCount; i++)
+			{
+				const float* orbit = &lightOrbits[i * 4];
+				float angle = orbit[3] + time * 0.7f;
+				lights[i].position[0] = orbit[0] + 0.4f * std::cos(angle);
+				lights[i].position[1] = orbit[1] + 0.4f * std::sin(angle);
+				lights[i].position[2] = orbit[2] + 0.2f * std::sin(angle * 1.3f);
+			}
+			clusteredLights.assign(lights.data(), lightCount, viewMatrix);
+			clusteredLights.upload();
+			clusteredLights.bind();
+		}
+
+		// fit the cascades to this view and find the casters of the ones that are drawn this frame
+		{
+			PROFILE_SCOPE("ShadowCull");
+			shadows.update(viewMatrix, fieldOfView, (float)frameWidth / frameHeight, sunDirection);
+			shadows.cull(casters.data(), triangleCount);
+		}
+
+		// fill this frame's uniform blocks, written to a CPU copy and sent to the GPU in one go by upload()
+		uniforms.beginFrame();
+		UniformAllocation frameBlock, viewBlock, lightingBlock, shadowBlock;
+		PerFrameBlock* perFrame = uniforms.allocate<PerFrameBlock>(&frameBlock);
+		perFrame->time = time;
+		perFrame->deltaTime = deltaTime;
+		perFrame->resolution[0] = (float)frameWidth;
+		perFrame->resolution[1] = (float)frameHeight;
+
+		// with TAA the frame is drawn with this frame's sub-pixel jitter in the projection
+		PerViewBlock* perView = uniforms.allocate<PerViewBlock>(&viewBlock);
+		std::memcpy(perView->view, viewMatrix, sizeof(viewMatrix));
+		std::memcpy(perView->projection, projectionMatrix, sizeof(projectionMatrix));
+		UniformAllocation temporalBlock;
+		if (sceneFrame.temporalAA)
+		{
+			temporalAA.beginFrame(projectionMatrix, viewMatrix, perView->projection);
+			temporalAA.fillBlock(uniforms.allocate<TemporalBlock>(&temporalBlock));
+		}
+		Transform::multiply(perView->viewProjection, perView->projection, viewMatrix);
+
+		LightingBlock* lighting = uniforms.allocate<LightingBlock>(&lightingBlock);
+		clusteredLights.fillBlock(lighting);
+		lighting->ambientColor[0] = 0.08f; lighting->ambientColor[1] = 0.08f; lighting->ambientColor[2] = 0.1f; lighting->ambientColor[3] = 0.0f;
+		for (int i = 0; i < 3; i++)
+		{
+			// towards the sun, in view space (the view matrix only rotates directions)
+			lighting->sunDirection[i] = -(viewMatrix[i] * sunDirection[0] + viewMatrix[4 + i] * sunDirection[1] + viewMatrix[8 + i] * sunDirection[2]);
+		}
+		lighting->sunDirection[3] = 0.0f;
+		lighting->sunColor[0] = 1.0f; lighting->sunColor[1] = 0.95f; lighting->sunColor[2] = 0.85f; lighting->sunColor[3] = 0.0f;
+
+		shadows.fillBlock(uniforms.allocate<ShadowBlock>(&shadowBlock), viewMatrix);
+		for (int i = 0; i < CascadedShadows::cascadeCount; i++)
+		{
+			if (shadows.drawn(i))
+			{
+				shadows.fillView(i, uniforms.allocate<PerViewBlock>(&sceneFrame.cascadeViews[i]));
+			}
+		}
+		sceneFrame.cameraView = viewBlock;
+
+		// one PerDraw block per triangle, handed to the render queue with the draw
+		queue.clear();
+		for (int i = 0; i < triangleCount; i++)
+		{
+			float t = (float)i / (float)(triangleCount - 1);
+			DrawItem item;
+			item.material = &triangleMaterial;
+			item.vertexBuffer = VBO;
+			item.count = 3;
+			item.depth = eye[2] - casters[i].center[2];		// distance along the view direction
+			PerDrawBlock* perDraw = uniforms.allocate<PerDrawBlock>(&item.drawBlock);
+			const float* center = casters[i].center;
+			Transform::scaleTranslation(perDraw->model, 2.5f, center[0], center[1], center[2]);
+			perDraw->color[0] = 1.0f; perDraw->color[1] = 0.5f * t; perDraw->color[2] = 0.2f + 0.6f * (1.0f - t); perDraw->color[3] = 1.0f;
+			perDraw->material[0] = 0.2f + 0.7f * t;			// roughness
+			perDraw->material[1] = i % 4 == 0 ? 1.0f : 0.0f;	// every fourth triangle is metal
+			perDraw->material[2] = 0.0f; perDraw->material[3] = 0.0f;
+			queue.submit(item);
+			sceneItems[i] = item;
+		}
+
+		// the same draws for each cascade that is redrawn, only the casters inside its box, sorted by their distance from the sun
+		for (int i = 0; i < CascadedShadows::cascadeCount; i++)
+		{
+			shadowQueues[i].clear();
+			const int* visible = shadows.visibleCasterIndices(i);
+			for (int n = 0; n < shadows.visibleCasters(i); n++)
+			{
+				DrawItem item = sceneItems[visible[n]];
+				item.depth = shadows.casterDepth(visible[n]);
+				shadowQueues[i].submit(item);
+			}
+		}
+		UniformAllocation postBlock;
+		postChain.fillBlock(uniforms.allocate<PostBlock>(&postBlock));
+
+		// this frame's new particles, each fountain sprays a quarter
+		particleBacklog += particlesPerSecond * deltaTime;
+		int particlesToStart = (int)particleBacklog;
+		particleBacklog -= (float)particlesToStart;
+		for (int i = 0; i < 4; i++)
+		{
+			particles.emit(fountains[i], (particlesToStart + i) / 4);
+		}
+		UniformAllocation particleBlock;
+		particles.fillBlock(uniforms.allocate<ParticleBlock>(&particleBlock), deltaTime);
+		uniforms.upload();
+
+		uniforms.bind(UniformBinding::PerFrame, frameBlock);	// glBindBufferRange, the blocks are offsets in the same buffer
+		uniforms.bind(UniformBinding::PerView, viewBlock);
+		uniforms.bind(UniformBinding::Lighting, lightingBlock);
+		uniforms.bind(UniformBinding::Shadows, shadowBlock);
+		uniforms.bind(UniformBinding::Post, postBlock);
+		uniforms.bind(UniformBinding::Particles, particleBlock);
+		if (sceneFrame.temporalAA)
+		{
+			uniforms.bind(UniformBinding::Temporal, temporalBlock);
+		}
+		GlResources::bindTexture(shadowAtlasUnit, GL_TEXTURE_2D, shadows.texture());	// the depth passes don't sample it
+
+		// advance the particles, outside the graph: the simulation draws into a buffer, not a target
+		{
+			PROFILE_SCOPE("ParticleSimulate");
+			GpuTimer::beginScope("ParticleSimulate");
+			particles.simulate();
+			GpuTimer::endScope();
+		}
 
-		// draw triangle
-		glUseProgram(shaderProgram);		// set active shader program
-		glBindVertexArray(VAO);				// bind active vao (VBO and Vertex attributes)
-		glDrawArrays(GL_TRIANGLES, 0, 3);	// draw!
+		// run the passes: draw the triangles into the scene target, resolve it (MSAA or TAA), drop what is not needed anymore and
+		// post-process it into the window
+		sceneFrame.targetSamples = (long long)frameWidth * frameHeight * (sceneFrame.temporalAA ? 1 : sceneDesc.samples);
+		postChain.setWindowSize(framebufferWidth, framebufferHeight);
+		RenderGraph** graphs = sceneFrame.deferred ? deferredGraphs : forwardGraphs;
+		graphs[sceneFrame.temporalAA ? 1 : 0]->execute();
+
+		uniforms.endFrame();				// fence this frame's part of the uniform buffer
+		renderTargets.endFrame();
 
 
 		// check and call events and swap the buffers
+		AllocScope platformScope(AllocTag::Platform);	// GLFW and the driver may allocate, we don't control that code
+		GpuTimer::endFrame();		// before the swap, which may wait for the GPU
+		GlCapture::frame();			// end of the frame in the trace (if capturing)
 		glfwSwapBuffers(window);	// swap the color buffer (a large 2D buffer that contains color values for each pixel in GLFW's window) that
 									// is used to render to during this render iteration and show it as output to the screen/
 									// This is because a double buffer is being used, one that should be drawn on screen (front) and one for 
 									// rendering (back), then back buffer is swaped to the front when it is done to prevent artifacts (flickering) while rendering
 		glfwPollEvents();			// checks if any events are triggered (like keyboard input or mouse movement events), updates the window state, 
 									// and calls the corresponding functions (which we can register via callback methods)
+
+		GpuMemory::endFrame();		// close this frame in the GPU memory timeline
+		Profiler::endFrame();
+		GlStats::endFrame();		// this frame's GL calls, the overlay shows them every 60 frames
+		if (GlStats::overlayDue() && GlStats::overlay() == GlStatsOverlay::Title)
+		{
+			glfwSetWindowTitle(window, GlStats::summary());
+		}
+		GlDebugOutput::flush(std::cout);	// driver messages queued during the frame
+		AllocTracker::endFrame();
+
+		// the frame's numbers for the exporter thread, publish() only copies them into its queue
+		if (MetricsExporter::running())
+		{
+			if (frameNumber % 60 == 0)
+			{
+				driverAvailableKB = GpuMemory::queryDriver().currentAvailableKB;	// a driver query, not every frame
+			}
+			const GlFrameStats& calls = GlStats::lastFrame();
+			const AllocFrameStats& allocations = AllocTracker::lastFrame();
+			MetricsFrame metrics;
+			metrics.cpuMilliseconds = Profiler::lastFrameMilliseconds();
+			metrics.gpuMilliseconds = GpuTimer::lastFrameMilliseconds();
+			metrics.glCalls = calls.calls;
+			metrics.draws = calls.draws;
+			metrics.uploadBytes = calls.uploadBytes;
+			for (int i = 0; i < (int)AllocTag::Count; i++)
+			{
+				metrics.heapAllocations += allocations.count[i];
+			}
+			metrics.vramBytes = GpuMemory::totals().totalBytes;
+			metrics.vramPeakBytes = GpuMemory::totals().peakBytes;
+			metrics.vramDriverAvailableKB = driverAvailableKB;
+			metrics.heapAllocationsTotal = AllocTracker::totalAllocations();
+			metrics.shadersCompiled = shaders.stats().shadersCompiled;
+			metrics.shadersReused = shaders.stats().shadersReused;
+			metrics.programsLinked = shaders.stats().programsLinked;
+			metrics.programsReused = shaders.stats().programsReused;
+			MetricsExporter::publish(metrics);
+		}
+		frameNumber++;
 	}
 
+	MetricsExporter::stop();	// serves (or writes) the final numbers once more
+
+	// how much GPU memory we used and whether anything was allocated/freed while rendering
+	GpuMemory::report(std::cout);
+	Profiler::report(std::cout);
+	GlStats::report(std::cout);
+	std::cout << "Overdraw: " << OverdrawMeter::lastSamplesShaded() << " samples shaded per sample (depth prepass "
+		<< (sceneFrame.depthPrepass ? "on" : "off") << ")\n";
+	frameGraph.report(std::cout);
+	taaGraph.report(std::cout);
+	deferredGraph.report(std::cout);
+	deferredTaaGraph.report(std::cout);
+	GpuTimer::report(std::cout);	// the passes of every path, for whichever ran
+	const ClusteredLights::Stats& lightStats = clusteredLights.stats();
+	std::cout << "Clustered lights: " << lightStats.visibleLights << " of " << lightStats.lights << " visible, " << lightStats.occupiedClusters
+		<< " of " << lightStats.clusters << " clusters lit, " << lightStats.lightIndices << " list entries, at most "
+		<< lightStats.mostLightsInCluster << " per cluster, " << lightStats.droppedLights << " dropped (" << JobSystem::workerCount()
+		<< " worker threads)\n";
+	const CascadedShadows::Stats& shadowStats = shadows.stats();
+	std::cout << "Shadow cascades drawn in " << shadowStats.frames << " frames:";
+	for (int i = 0; i < CascadedShadows::cascadeCount; i++)
+	{
+		std::cout << " " << shadowStats.cascadesDrawn[i];
+	}
+	std::cout << ", " << shadowStats.castersDrawn << " caster draws\n";
+	const ParticleSystem::Stats& particleStats = particles.stats();
+	std::cout << "Particles: " << particles.capacity() << " slots (" << particleStats.stateBytes / 1024 << " kB of state), "
+		<< particleStats.emitted << " started in " << particleStats.frames << " frames, " << particleStats.droppedEmits << " emits and "
+		<< particleStats.droppedParticles << " particles dropped\n";
+
+	GlDebugOutput::uninstall();
+
+	// de-allocate all resources once they've outlived their purpose
+	postChain.destroy();	// the grading LUT
+	particles.destroy();	// the state buffers
+	pipelines.destroy();	// deletes the vaos
+	frameGraph.clear();			// gives the scene target back to the pool
+	taaGraph.clear();
+	deferredGraph.clear();
+	deferredTaaGraph.clear();
+	shadows.destroy();			// the atlas, imported by the graphs but owned here
+	temporalAA.destroy();		// the history targets, imported like the atlas
+	renderTargets.destroy();	// framebuffers and their attachments
+	GpuTimer::destroy();
+	OverdrawMeter::destroy();
+	clusteredLights.destroy();
+	JobSystem::shutdown();
+	GpuMemory::deleteBuffer(VBO);
+	shaders.destroy();	// deletes the programs and shaders
+	uniforms.destroy();
+
+	GlStats::stop();	// the layers stack, stop them in the reverse order of starting
+	GlCapture::stop();
 	glfwTerminate(); // clean up any GLFW resources before terminating. Good practice
 	return 0; // successful run
 }
 
+// each cascade that isn't cached draws its casters depth only into its square of the atlas, with its light view bound as PerView, then
+// the camera's view is bound again for the passes after
+void drawShadows(const RenderGraph& /*graph*/, void* user)
+{
+	SceneFrame* frame = (SceneFrame*)user;
+	for (int i = 0; i < CascadedShadows::cascadeCount; i++)
+	{
+		if (!frame->shadows->drawn(i))
+		{
+			continue;
+		}
+		frame->shadows->beginCascade(i, *frame->pipelines);
+		frame->uniforms->bind(UniformBinding::PerView, frame->cascadeViews[i]);
+		frame->shadowQueues[i].sort(RenderQueueOrder::FrontToBack, RenderQueuePass::Shadow);
+		frame->shadowQueues[i].draw(RenderQueuePass::Shadow, *frame->pipelines, *frame->uniforms);
+	}
+	frame->shadows->endCascades();
+	frame->uniforms->bind(UniformBinding::PerView, frame->cameraView);
+}
+
+// depth only, front to back so the prepass itself rejects as much as it can, the graph has bound the scene target and cleared it
+void drawDepthPrepass(const RenderGraph& /*graph*/, void* user)
+{
+	SceneFrame* frame = (SceneFrame*)user;
+	if (!frame->depthPrepass || frame->showOverdraw)
+	{
+		return;
+	}
+	frame->queue->sort(RenderQueueOrder::FrontToBack, RenderQueuePass::DepthOnly);
+	frame->queue->draw(RenderQueuePass::DepthOnly, *frame->pipelines, *frame->uniforms);
+}
+
+// draw triangles: per draw the queue binds the pipeline (shader program, vao and raster state, only what changed since the last bind),
+// attaches the vertex data the vao reads and binds the per object uniform block, then glDrawArrays. Draw!
+void drawScene(const RenderGraph& /*graph*/, void* user)
+{
+	SceneFrame* frame = (SceneFrame*)user;
+	OverdrawMeter::begin();
+	if (frame->showOverdraw)
+	{
+		// every layer adds up with the depth test off, how many times each pixel would be shaded drawn back to front
+		frame->queue->sort(RenderQueueOrder::ByState, RenderQueuePass::Overdraw);
+		frame->queue->draw(RenderQueuePass::Overdraw, *frame->pipelines, *frame->uniforms);
+	}
+	else if (frame->depthPrepass)
+	{
+		// only the nearest surface passes GL_EQUAL, the order no longer matters for overdraw so fewest pipeline changes wins
+		frame->queue->sort(RenderQueueOrder::ByState, RenderQueuePass::ColorDepthEqual);
+		frame->queue->draw(RenderQueuePass::ColorDepthEqual, *frame->pipelines, *frame->uniforms);
+	}
+	else
+	{
+		frame->queue->sort(RenderQueueOrder::FrontToBack, RenderQueuePass::Color);
+		frame->queue->draw(RenderQueuePass::Color, *frame->pipelines, *frame->uniforms);
+	}
+	OverdrawMeter::end(frame->targetSamples);
+}
+
+// deferred shading: the surfaces into the G-buffer (colour attachments 0 and 1, see gbuffer.frag), the graph has bound and cleared it
+void drawGBuffer(const RenderGraph& /*graph*/, void* user)
+{
+	SceneFrame* frame = (SceneFrame*)user;
+	frame->queue->sort(RenderQueueOrder::FrontToBack, RenderQueuePass::GBuffer);
+	frame->queue->draw(RenderQueuePass::GBuffer, *frame->pipelines, *frame->uniforms);
+}
+
+// one full screen triangle reading the G-buffer, the cluster lists and the Lighting block are bound for the frame already
+void drawDeferredLighting(const RenderGraph& graph, void* user)
+{
+	SceneFrame* frame = (SceneFrame*)user;
+	GlResources::bindTexture(0, GL_TEXTURE_2D, graph.texture(frame->gbuffer, 0));
+	GlResources::bindTexture(1, GL_TEXTURE_2D, graph.texture(frame->gbuffer, 1));
+	GlResources::bindTexture(2, GL_TEXTURE_2D, graph.depthTexture(frame->gbuffer));
+	frame->pipelines->bind(frame->deferredLighting);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
 // callback function used to resize viewport when window is resized
-void framebuffer_size_callback(GLFWwindow* window, int width, int height)
+void framebuffer_size_callback(GLFWwindow* /*window*/, int width, int height)
 {
 	// set opengl viewport size, for now same as GLFW window, but could be smaller to have other elements
 	glViewport(0, 0, width, height);
@@ -0,0 +1,471 @@
+/*
+ *	Prometheus text format exporter, see metrics_exporter.h
+ */
+
+#include "metrics_exporter.h"
+#include "alloc_tracker.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <windows.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdarg>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+namespace
+{
+#ifdef _WIN32
+	typedef SOCKET SocketHandle;
+	const SocketHandle invalidSocket = INVALID_SOCKET;
+	void closeSocket(SocketHandle socket) { closesocket(socket); }
+#else
+	typedef int SocketHandle;
+	const SocketHandle invalidSocket = -1;
+	void closeSocket(SocketHandle socket) { close(socket); }
+#endif
+
+	// frame time buckets in seconds, 60 Hz is 0.0167, 30 Hz 0.0333
+	const double bucketBounds[] = { 0.001, 0.002, 0.004, 0.008, 0.0125, 0.0167, 0.025, 0.0333, 0.05, 0.1, 0.25, 1.0 };
+	const int bucketCount = sizeof(bucketBounds) / sizeof(bucketBounds[0]);
+
+	struct Histogram
+	{
+		unsigned long long buckets[bucketCount] = {};	// not cumulative, format() sums them up
+		unsigned long long count = 0;
+		double sum = 0.0;
+
+		void add(double seconds)
+		{
+			for (int i = 0; i < bucketCount; i++)
+			{
+				if (seconds <= bucketBounds[i])
+				{
+					buckets[i]++;
+					break;
+				}
+			}
+			count++;
+			sum += seconds;
+		}
+	};
+
+	// single producer (publish, render thread), single consumer (drain, exporter thread)
+	MetricsFrame queue[MetricsExporter::queueSize];
+	std::atomic<unsigned long long> queueHead(0);	// next slot publish() writes
+	std::atomic<unsigned long long> queueTail(0);	// next slot drain() reads
+	std::atomic<unsigned long long> dropped(0);
+
+	// aggregated by the exporter thread
+	Histogram frameTimes;
+	Histogram gpuTimes;
+	unsigned long long frames = 0;
+	unsigned long long glCalls = 0;
+	unsigned long long draws = 0;
+	unsigned long long uploadBytes = 0;
+	MetricsFrame latest;
+
+	SocketHandle listener = invalidSocket;
+	char filePath[260] = "";
+	int fileInterval = 1000;
+	std::thread worker;
+	std::atomic<bool> quit(false);
+	bool active = false;
+
+	char body[32 * 1024];	// the formatted metrics, exporter thread only
+
+	void drain()
+	{
+		unsigned long long tail = queueTail.load(std::memory_order_relaxed);
+		unsigned long long head = queueHead.load(std::memory_order_acquire);
+		for (; tail != head; tail++)
+		{
+			const MetricsFrame& frame = queue[tail & (MetricsExporter::queueSize - 1)];
+			frames++;
+			frameTimes.add(frame.cpuMilliseconds / 1000.0);
+			if (frame.gpuMilliseconds >= 0.0)
+			{
+				gpuTimes.add(frame.gpuMilliseconds / 1000.0);
+			}
+			glCalls += frame.glCalls;
+			draws += frame.draws;
+			uploadBytes += frame.uploadBytes;
+			latest = frame;
+		}
+		queueTail.store(tail, std::memory_order_release);	// the slots are free for publish() again
+	}
+
+	// appends to a fixed buffer, silently cut at its end
+	struct TextBuffer
+	{
+		char* data;
+		size_t capacity;
+		size_t used;
+
+		void print(const char* format, ...)
+		{
+			if (used + 1 >= capacity)
+			{
+				return;
+			}
+			va_list args;
+			va_start(args, format);
+			int written = std::vsnprintf(data + used, capacity - used, format, args);
+			va_end(args);
+			if (written > 0)
+			{
+				used += (size_t)written < capacity - used ? (size_t)written : capacity - used - 1;
+			}
+		}
+	};
+
+	void printMetric(TextBuffer& text, const char* name, const char* type, const char* help)
+	{
+		text.print("# HELP learnopengl_%s %s\n# TYPE learnopengl_%s %s\n", name, help, name, type);
+	}
+
+	void printHistogram(TextBuffer& text, const char* name, const char* help, const Histogram& histogram)
+	{
+		printMetric(text, name, "histogram", help);
+		unsigned long long cumulative = 0;
+		for (int i = 0; i < bucketCount; i++)
+		{
+			cumulative += histogram.buckets[i];
+			text.print("learnopengl_%s_bucket{le=\"%g\"} %llu\n", name, bucketBounds[i], cumulative);
+		}
+		text.print("learnopengl_%s_bucket{le=\"+Inf\"} %llu\n", name, histogram.count);
+		text.print("learnopengl_%s_sum %.6f\nlearnopengl_%s_count %llu\n", name, histogram.sum, name, histogram.count);
+	}
+
+	void printValue(TextBuffer& text, const char* name, const char* type, const char* help, long long value)
+	{
+		printMetric(text, name, type, help);
+		text.print("learnopengl_%s %lld\n", name, value);
+	}
+
+	bool sendAll(SocketHandle client, const char* data, size_t size)
+	{
+#ifdef MSG_NOSIGNAL
+		const int flags = MSG_NOSIGNAL;	// a client that hung up is an error code, not SIGPIPE
+#else
+		const int flags = 0;
+#endif
+		while (size > 0)
+		{
+			int sent = (int)send(client, data, (int)size, flags);
+			if (sent <= 0)
+			{
+				return false;
+			}
+			data += sent;
+			size -= (size_t)sent;
+		}
+		return true;
+	}
+
+	void serveClient(SocketHandle client)
+	{
+		// read the request head, its content doesn't matter: every request gets the metrics
+		char request[2048];
+		size_t received = 0;
+		while (received < sizeof(request) - 1)
+		{
+			fd_set readable;
+			FD_ZERO(&readable);
+			FD_SET(client, &readable);
+			timeval timeout = { 1, 0 };
+			if (select((int)client + 1, &readable, NULL, NULL, &timeout) <= 0)
+			{
+				break;
+			}
+			int count = (int)recv(client, request + received, (int)(sizeof(request) - 1 - received), 0);
+			if (count <= 0)
+			{
+				break;
+			}
+			received += (size_t)count;
+			request[received] = '\0';
+			if (std::strstr(request, "\r\n\r\n") != nullptr || std::strstr(request, "\n\n") != nullptr)
+			{
+				break;
+			}
+		}
+
+		size_t length = MetricsExporter::format(body, sizeof(body));
+		char head[256];
+		int headLength = std::snprintf(head, sizeof(head),
+			"HTTP/1.0 200 OK\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: %zu\r\nConnection: close\r\n\r\n", length);
+		if (sendAll(client, head, (size_t)headLength))
+		{
+			sendAll(client, body, length);
+		}
+		closeSocket(client);
+	}
+
+	void writeMetricsFile()
+	{
+		char temporary[sizeof(filePath) + 8];
+		std::snprintf(temporary, sizeof(temporary), "%s.tmp", filePath);
+		std::FILE* file = std::fopen(temporary, "wb");
+		if (file == nullptr)
+		{
+			return;
+		}
+		size_t length = MetricsExporter::format(body, sizeof(body));
+		bool written = std::fwrite(body, 1, length, file) == length;
+		written = std::fclose(file) == 0 && written;
+		if (!written)
+		{
+			std::remove(temporary);
+			return;
+		}
+#ifdef _WIN32
+		MoveFileExA(temporary, filePath, MOVEFILE_REPLACE_EXISTING);	// rename() doesn't replace an existing file on Windows
+#else
+		std::rename(temporary, filePath);
+#endif
+	}
+
+	void run()
+	{
+		AllocScope scope(AllocTag::Platform);	// socket and file calls, never inside the render loop's allocations
+		std::chrono::steady_clock::time_point nextWrite = std::chrono::steady_clock::now();
+		while (!quit.load())
+		{
+			drain();
+
+			if (listener != invalidSocket)
+			{
+				fd_set readable;
+				FD_ZERO(&readable);
+				FD_SET(listener, &readable);
+				timeval timeout = { 0, 10000 };	// 10ms, also how often stop() is noticed
+				if (select((int)listener + 1, &readable, NULL, NULL, &timeout) > 0)
+				{
+					SocketHandle client = accept(listener, NULL, NULL);
+					if (client != invalidSocket)
+					{
+						drain();	// answer with everything published up to now
+						serveClient(client);
+					}
+				}
+			}
+			else
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(10));
+			}
+
+			if (filePath[0] != '\0' && std::chrono::steady_clock::now() >= nextWrite)
+			{
+				writeMetricsFile();
+				nextWrite += std::chrono::milliseconds(fileInterval);
+			}
+		}
+
+		drain();
+		if (filePath[0] != '\0')
+		{
+			writeMetricsFile();	// the final numbers
+		}
+	}
+}
+
+namespace MetricsExporter
+{
+	bool init()
+	{
+		const char* setting = std::getenv("LEARNOPENGL_METRICS");
+		if (setting == nullptr || setting[0] == '\0')
+		{
+			return false;
+		}
+
+		bool any = false;
+		const char* entry = setting;
+		while (*entry != '\0')
+		{
+			const char* end = std::strchr(entry, ',');
+			size_t length = end != nullptr ? (size_t)(end - entry) : std::strlen(entry);
+			if (length > 5 && std::strncmp(entry, "http:", 5) == 0)
+			{
+				any = serveHttp((unsigned short)std::atoi(entry + 5)) || any;
+			}
+			else if (length > 5 && std::strncmp(entry, "file:", 5) == 0 && length - 5 < sizeof(filePath))
+			{
+				char path[sizeof(filePath)];
+				std::memcpy(path, entry + 5, length - 5);
+				path[length - 5] = '\0';
+				any = writeFile(path, 1000) || any;
+			}
+			else
+			{
+				std::cout << "ERROR::METRICS::UNKNOWN_SETTING " << setting << " (http:<port> or file:<path>, separated by ',')" << std::endl;
+			}
+			entry += length;
+			if (*entry == ',')
+			{
+				entry++;
+			}
+		}
+		return any && start();
+	}
+
+	bool serveHttp(unsigned short port)
+	{
+		if (active || listener != invalidSocket)
+		{
+			return false;
+		}
+#ifdef _WIN32
+		WSADATA data;
+		if (WSAStartup(MAKEWORD(2, 2), &data) != 0)
+		{
+			std::cout << "ERROR::METRICS::WSA_STARTUP" << std::endl;
+			return false;
+		}
+#endif
+		SocketHandle socketHandle = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+		if (socketHandle == invalidSocket)
+		{
+			std::cout << "ERROR::METRICS::SOCKET" << std::endl;
+			return false;
+		}
+		int reuse = 1;
+		setsockopt(socketHandle, SOL_SOCKET, SO_REUSEADDR, (const char*)&reuse, sizeof(reuse));	// restart without waiting for TIME_WAIT
+
+		sockaddr_in address;
+		std::memset(&address, 0, sizeof(address));
+		address.sin_family = AF_INET;
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);	// local only, the metrics are not meant for the network
+		address.sin_port = htons(port);
+		if (bind(socketHandle, (const sockaddr*)&address, sizeof(address)) != 0 || listen(socketHandle, 4) != 0)
+		{
+			std::cout << "ERROR::METRICS::LISTEN port " << port << std::endl;
+			closeSocket(socketHandle);
+			return false;
+		}
+		listener = socketHandle;
+		std::cout << "METRICS::SERVING http://127.0.0.1:" << port << "/metrics" << std::endl;
+		return true;
+	}
+
+	bool writeFile(const char* path, int intervalMilliseconds)
+	{
+		if (active || std::strlen(path) >= sizeof(filePath))
+		{
+			return false;
+		}
+		std::strcpy(filePath, path);
+		fileInterval = intervalMilliseconds > 0 ? intervalMilliseconds : 1000;
+		std::cout << "METRICS::WRITING " << filePath << std::endl;
+		return true;
+	}
+
+	bool start()
+	{
+		if (active || (listener == invalidSocket && filePath[0] == '\0'))
+		{
+			return false;
+		}
+		quit = false;
+		worker = std::thread(run);
+		active = true;
+		return true;
+	}
+
+	void stop()
+	{
+		if (!active)
+		{
+			return;
+		}
+		quit = true;
+		worker.join();
+		active = false;
+		if (listener != invalidSocket)
+		{
+			closeSocket(listener);
+			listener = invalidSocket;
+#ifdef _WIN32
+			WSACleanup();
+#endif
+		}
+		filePath[0] = '\0';
+	}
+
+	bool running()
+	{
+		return active;
+	}
+
+	void publish(const MetricsFrame& frame)
+	{
+		unsigned long long head = queueHead.load(std::memory_order_relaxed);
+		if (head - queueTail.load(std::memory_order_acquire) == queueSize)
+		{
+			dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		queue[head & (queueSize - 1)] = frame;
+		queueHead.store(head + 1, std::memory_order_release);
+	}
+
+	size_t format(char* out, size_t capacity)
+	{
+		if (capacity == 0)
+		{
+			return 0;
+		}
+		if (!active)
+		{
+			drain();	// nobody else consumes, see the header
+		}
+		TextBuffer text = { out, capacity, 0 };
+		out[0] = '\0';
+
+		printHistogram(text, "frame_seconds", "CPU time of a frame.", frameTimes);
+		printHistogram(text, "gpu_frame_seconds", "GPU time of a frame (timer queries, a few frames behind).", gpuTimes);
+		printValue(text, "frames_total", "counter", "Frames rendered.", (long long)frames);
+		printValue(text, "metrics_dropped_frames_total", "counter", "Frames not exported because the exporter fell behind.",
+			(long long)dropped.load());
+		printValue(text, "gl_calls_total", "counter", "OpenGL calls (counted when LEARNOPENGL_GL_STATS is on).", (long long)glCalls);
+		printValue(text, "gl_draws_total", "counter", "Draw commands (counted when LEARNOPENGL_GL_STATS is on).", (long long)draws);
+		printValue(text, "upload_bytes_total", "counter", "Buffer and texture bytes handed to the driver.", (long long)uploadBytes);
+
+		printMetric(text, "shader_cache_requests_total", "counter", "Shader and program requests answered from the cache (hit) or compiled (miss).");
+		text.print("learnopengl_shader_cache_requests_total{kind=\"shader\",result=\"hit\"} %d\n", latest.shadersReused);
+		text.print("learnopengl_shader_cache_requests_total{kind=\"shader\",result=\"miss\"} %d\n", latest.shadersCompiled);
+		text.print("learnopengl_shader_cache_requests_total{kind=\"program\",result=\"hit\"} %d\n", latest.programsReused);
+		text.print("learnopengl_shader_cache_requests_total{kind=\"program\",result=\"miss\"} %d\n", latest.programsLinked);
+
+		printValue(text, "vram_estimated_bytes", "gauge", "GPU memory of our buffers, textures and renderbuffers (estimated).", latest.vramBytes);
+		printValue(text, "vram_peak_bytes", "gauge", "Highest vram_estimated_bytes so far.", latest.vramPeakBytes);
+		if (latest.vramDriverAvailableKB >= 0)
+		{
+			printValue(text, "vram_driver_available_bytes", "gauge", "Free GPU memory reported by the driver.", latest.vramDriverAvailableKB * 1024);
+		}
+		printValue(text, "heap_allocations_total", "counter", "Heap allocations (counted with LEARNOPENGL_TRACK_ALLOCATIONS).",
+			(long long)latest.heapAllocationsTotal);
+		printValue(text, "frame_heap_allocations", "gauge", "Heap allocations during the last frame.", (long long)latest.heapAllocations);
+		return text.used;
+	}
+}
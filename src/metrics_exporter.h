@@ -0,0 +1,73 @@
+#ifndef METRICS_EXPORTER_H
+#define METRICS_EXPORTER_H
+
+/*
+ * NOTES:
+ * Exports frame metrics in the Prometheus text format, for long running render jobs that are watched from outside.
+ *
+ * The render thread only hands over one small MetricsFrame per frame: publish() copies it into a single producer / single consumer ring
+ * and returns, no lock, no allocation, no system call. Everything else happens on the exporter's own thread:
+ *	*it drains the ring every few milliseconds into histograms (frame time, GPU time) and running totals
+ *	*it serves the text format over HTTP on 127.0.0.1 (any request gets the metrics, e.g. curl http://127.0.0.1:9100/metrics)
+ *	*and/or it rewrites a file every interval (written to path.tmp and renamed over path, so a reader never sees half a file),
+ *	 for node_exporter's textfile collector or anything that tails files
+ * When the ring is full (the exporter thread didn't get CPU time) frames are dropped and counted, the render thread never waits.
+ *
+ * The exporter thread formats into fixed buffers and tags itself AllocTag::Platform, the sockets belong to the operating system like
+ * the driver belongs to GLFW (see alloc_tracker.h).
+ *
+ * The environment variable LEARNOPENGL_METRICS starts it from init():
+ *	*http:<port>		serve on 127.0.0.1:<port>
+ *	*file:<path>		rewrite <path> once a second
+ * several separated by ',' e.g. "http:9100,file:metrics.prom".
+ *
+ * Exported (all prefixed learnopengl_):
+ *	frame_seconds, gpu_frame_seconds				histograms of the CPU frame time and the GPU time (GpuTimer)
+ *	frames_total, metrics_dropped_frames_total
+ *	gl_calls_total, gl_draws_total, upload_bytes_total	from GlStats (zero unless it counts)
+ *	shader_cache_requests_total{kind,result}		shaders/programs reused (hit) or compiled/linked (miss)
+ *	vram_estimated_bytes, vram_peak_bytes, vram_driver_available_bytes	GpuMemory's accounting and the vendor extension (when known)
+ *	heap_allocations_total, frame_heap_allocations	AllocTracker (zero unless LEARNOPENGL_TRACK_ALLOCATIONS)
+ */
+
+#include <cstddef>
+
+// what the render thread reports once a frame, counters are per frame unless noted
+struct MetricsFrame
+{
+	double cpuMilliseconds = 0.0;
+	double gpuMilliseconds = -1.0;		// -1 when unknown
+	unsigned long long glCalls = 0;
+	unsigned long long draws = 0;
+	unsigned long long uploadBytes = 0;
+	unsigned long long heapAllocations = 0;
+	// totals since startup
+	long long vramBytes = 0;
+	long long vramPeakBytes = 0;
+	long long vramDriverAvailableKB = -1;	// -1 when the driver doesn't say
+	unsigned long long heapAllocationsTotal = 0;
+	int shadersCompiled = 0;
+	int shadersReused = 0;
+	int programsLinked = 0;
+	int programsReused = 0;
+};
+
+namespace MetricsExporter
+{
+	const int queueSize = 256;	// frames, power of two
+
+	bool init();										// reads LEARNOPENGL_METRICS, false when not set or nothing started
+	bool serveHttp(unsigned short port);				// before start(), listens on 127.0.0.1 only
+	bool writeFile(const char* path, int intervalMilliseconds);	// before start()
+	bool start();										// starts the exporter thread
+	void stop();										// joins the thread, closes the socket, writes the file a last time
+	bool running();
+
+	void publish(const MetricsFrame& frame);			// render thread, once per frame
+
+	// the current metrics in the text format, returns the length (output is cut at capacity - 1 and terminated). For the exporter
+	// thread and tests, call it on the render thread only while the exporter is stopped.
+	size_t format(char* out, size_t capacity);
+}
+
+#endif
@@ -0,0 +1,85 @@
+/*
+ *	Overdraw measured with occlusion queries, see overdraw_meter.h
+ */
+
+#include "overdraw_meter.h"
+#include "gl_api.h"
+
+namespace
+{
+	GLuint queries[OverdrawMeter::queryCount] = {};
+	long long samples[OverdrawMeter::queryCount] = {};	// target samples of each query's frame
+	unsigned long long issued = 0;
+	unsigned long long collected = 0;
+	bool running = false;
+	bool created = false;
+	double lastRatio = -1.0;
+}
+
+namespace OverdrawMeter
+{
+	void init()
+	{
+		glGenQueries(queryCount, queries);
+		created = true;
+		issued = 0;
+		collected = 0;
+		lastRatio = -1.0;
+	}
+
+	void begin()
+	{
+		if (!created || running || issued - collected == queryCount)
+		{
+			return;	// every query still in flight, this frame goes unmeasured
+		}
+		glBeginQuery(GL_SAMPLES_PASSED, queries[issued % queryCount]);
+		running = true;
+	}
+
+	void end(long long targetSamples)
+	{
+		if (!created)
+		{
+			return;
+		}
+		if (running)
+		{
+			glEndQuery(GL_SAMPLES_PASSED);
+			samples[issued % queryCount] = targetSamples;
+			running = false;
+			issued++;
+		}
+
+		while (collected < issued)
+		{
+			GLuint query = queries[collected % queryCount];
+			GLint available = 0;
+			glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+			if (!available)
+			{
+				break;
+			}
+			GLuint64 passed = 0;
+			glGetQueryObjectui64v(query, GL_QUERY_RESULT, &passed);
+			long long total = samples[collected % queryCount];
+			lastRatio = total > 0 ? (double)passed / (double)total : 0.0;
+			collected++;
+		}
+	}
+
+	double lastSamplesShaded()
+	{
+		return lastRatio;
+	}
+
+	void destroy()
+	{
+		if (created)
+		{
+			glDeleteQueries(queryCount, queries);
+			created = false;
+			running = false;
+		}
+	}
+}
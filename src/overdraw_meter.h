@@ -0,0 +1,29 @@
+#ifndef OVERDRAW_METER_H
+#define OVERDRAW_METER_H
+
+/*
+ * NOTES:
+ * Overdraw measured on the GPU: how many fragments (samples, with multisampling) passed the depth test and were shaded, per sample
+ * of the target.
+ *
+ * A GL_SAMPLES_PASSED occlusion query around the colour pass counts the samples that passed the depth and stencil tests, which are the
+ * ones the fragment shader ran for (with early-Z). Divided by the samples in the target that is the average shading work per sample:
+ * 1.0 means every sample was shaded once, 2.5 that the average sample was shaded two and a half times. With a depth prepass and
+ * GL_EQUAL it can't go above 1 (it is the fraction of the target covered); without one it shows what the draw order costs.
+ *
+ * Like GpuTimer the queries go round a small ring and are read when GL_QUERY_RESULT_AVAILABLE says so, a few frames late, never waiting.
+ * Queries of one target don't nest: nothing else may use GL_SAMPLES_PASSED between begin() and end().
+ */
+
+namespace OverdrawMeter
+{
+	const int queryCount = 4;
+
+	void init();
+	void begin();
+	void end(long long targetSamples);	// width * height * max(samples, 1) of the target drawn into
+	double lastSamplesShaded();			// per sample of the target, -1 until the first result arrived
+	void destroy();
+}
+
+#endif
@@ -0,0 +1,196 @@
+/*
+ *	GPU particles, see particle_system.h
+ */
+
+#include "particle_system.h"
+#include "gl_resources.h"
+#include "gpu_memory.h"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+ParticleSystem::~ParticleSystem()
+{
+	destroy();
+}
+
+bool ParticleSystem::create(PipelineCache& cache, GLuint updateProgram, GLuint renderProgram, GLuint softProgram, int capacity)
+{
+	destroy();
+
+	// one particle: vec4 position and age, vec4 velocity and lifetime
+	PipelineDesc desc;
+	desc.layout.add(0, 4, GL_FLOAT, 0).add(1, 4, GL_FLOAT, 4 * sizeof(float));
+	desc.layout.stride = (GLsizei)bytesPerParticle;
+	desc.program = updateProgram;	// per vertex, rasteriser discarded
+	desc.depth.test = false;
+	desc.depth.write = false;
+	update = cache.create(desc);
+
+	desc.layout.divisor = 1;		// per instance of the quad
+	desc.blend = BlendState::additive();
+	desc.program = softProgram;		// fades against the sampled depth instead of a depth test
+	soft = cache.create(desc);
+	desc.program = renderProgram;
+	desc.depth.test = true;
+	render = cache.create(desc);
+	if (update == 0 || render == 0 || soft == 0 || capacity <= 0)
+	{
+		std::cout << "ERROR::PARTICLE_SYSTEM::CREATE" << std::endl;
+		return false;
+	}
+
+	// zeroed: lifetime 0, every slot starts dead
+	GLsizeiptr size = (GLsizeiptr)capacity * bytesPerParticle;
+	std::vector<unsigned char> zeros((size_t)size, 0);
+	for (GLuint& buffer : buffers)
+	{
+		buffer = GpuMemory::createBuffer(GpuMemoryCategory::VertexBuffer, GL_ARRAY_BUFFER, size, zeros.data(), GL_DYNAMIC_COPY);
+	}
+	pipelines = &cache;
+	slots = capacity;
+	counters.stateBytes = 2 * size;
+	return true;
+}
+
+void ParticleSystem::destroy()
+{
+	for (GLuint& buffer : buffers)
+	{
+		if (buffer != 0)
+		{
+			GpuMemory::deleteBuffer(buffer);
+			buffer = 0;
+		}
+	}
+	pipelines = nullptr;	// the pipelines belong to the cache
+	update = render = soft = 0;
+	slots = 0;
+	cursor = 0;
+	queuedCount = 0;
+	queuedParticles = 0;
+	graphCount = 0;
+}
+
+RenderGraphPass ParticleSystem::addPass(RenderGraph& graph, RenderGraphResource target, RenderGraphResource depthSource)
+{
+	if (graphCount == maxGraphs || pipelines == nullptr)
+	{
+		std::cout << "ERROR::PARTICLE_SYSTEM::ADD_PASS " << (pipelines == nullptr ? "not created" : "too many graphs") << std::endl;
+		return 0;
+	}
+	GraphResources& resources = graphs[graphCount++];
+	resources.system = this;
+	resources.depthSource = depthSource;
+
+	RenderGraphPass pass = graph.addPass("Particles", drawParticles, &resources);
+	if (depthSource != 0)
+	{
+		graph.read(pass, depthSource);
+	}
+	graph.write(pass, target, RenderGraphLoad::Load);	// added onto the scene
+	return pass;
+}
+
+void ParticleSystem::emit(const ParticleEmitter& emitter, int count)
+{
+	if (slots == 0 || count <= 0)
+	{
+		return;
+	}
+	if (queuedCount == maxEmitters)
+	{
+		counters.droppedEmits++;
+		return;
+	}
+	// the frame's ranges must not overlap (the update shader restarts a slot from the first range holding it), together they cover
+	// at most every slot once. What doesn't fit any more is dropped, not wrapped onto a range of the same frame
+	int fits = std::min(count, slots - queuedParticles);
+	counters.droppedParticles += count - fits;
+	count = fits;
+	if (count == 0)
+	{
+		counters.droppedEmits++;
+		return;
+	}
+	ParticleEmitterGpu& range = queued[queuedCount++];
+	range.range[0] = (unsigned int)cursor;
+	range.range[1] = (unsigned int)count;
+	range.range[2] = range.range[3] = 0;
+	for (int i = 0; i < 3; i++)
+	{
+		range.positionRadius[i] = emitter.position[i];
+		range.velocitySpread[i] = emitter.velocity[i];
+	}
+	range.positionRadius[3] = emitter.radius;
+	range.velocitySpread[3] = emitter.spread;
+	range.lifetime[0] = emitter.lifetimeMin;
+	range.lifetime[1] = std::max(emitter.lifetimeMax, emitter.lifetimeMin);
+	range.lifetime[2] = range.lifetime[3] = 0.0f;
+	cursor = (cursor + count) % slots;	// the next range starts after this one, wrapping over the oldest
+	queuedParticles += count;
+	counters.emitted += count;
+}
+
+void ParticleSystem::fillBlock(ParticleBlock* block, float deltaTime)
+{
+	block->simulation[0] = deltaTime;
+	block->simulation[1] = settings.gravity;
+	block->simulation[2] = settings.drag;
+	block->simulation[3] = 0.0f;
+	block->render[0] = settings.size;
+	block->render[1] = std::max(settings.softness, 1e-4f);
+	block->render[2] = block->render[3] = 0.0f;
+	block->emit[0] = (unsigned int)queuedCount;
+	block->emit[1] = (unsigned int)slots;
+	block->emit[2] = seed++;
+	block->emit[3] = 0;
+	for (int i = 0; i < 3; i++)
+	{
+		block->startColor[i] = settings.startColor[i];
+		block->endColor[i] = settings.endColor[i];
+	}
+	block->startColor[3] = block->endColor[3] = 1.0f;
+	std::copy(queued, queued + queuedCount, block->emitters);
+	queuedCount = 0;	// started by this frame's simulate()
+	queuedParticles = 0;
+}
+
+void ParticleSystem::simulate()
+{
+	if (pipelines == nullptr)
+	{
+		return;
+	}
+	GLuint source = buffers[latest], destination = buffers[1 - latest];
+	pipelines->bind(update);
+	pipelines->setVertexBuffer(source);
+	glEnable(GL_RASTERIZER_DISCARD);
+	GlResources::bindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, destination);
+	glBeginTransformFeedback(GL_POINTS);
+	glDrawArrays(GL_POINTS, 0, slots);
+	glEndTransformFeedback();
+	GlResources::bindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, 0);
+	glDisable(GL_RASTERIZER_DISCARD);
+	latest = 1 - latest;
+	counters.frames++;
+}
+
+// the graph has bound the target, the state simulate() wrote this frame is in buffers[latest]
+void ParticleSystem::drawParticles(const RenderGraph& graph, void* user)
+{
+	const GraphResources* resources = (const GraphResources*)user;
+	ParticleSystem* system = resources->system;
+	if (resources->depthSource != 0)
+	{
+		GlResources::bindTexture((GLuint)ParticleTextureUnit::Depth, GL_TEXTURE_2D, graph.depthTexture(resources->depthSource));
+		system->pipelines->bind(system->soft);
+	}
+	else
+	{
+		system->pipelines->bind(system->render);
+	}
+	system->pipelines->setVertexBuffer(system->buffers[system->latest]);
+	glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, system->slots);
+}
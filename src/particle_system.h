@@ -0,0 +1,134 @@
+#ifndef PARTICLE_SYSTEM_H
+#define PARTICLE_SYSTEM_H
+
+/*
+ * NOTES:
+ * GPU particles: the particles never leave the GPU, a frame costs one draw to simulate them and one to draw them, whatever their number.
+ *
+ * Simulating on the CPU means touching every particle every frame and uploading all of them again (32 bytes each, 32 MB a frame for a
+ * million). Here their state lives in two vertex buffers of capacity slots each and is advanced by transform feedback:
+ *	*simulate		the update program runs its vertex shader once per slot over last frame's buffer (glDrawArrays(GL_POINTS) with
+ *					GL_RASTERIZER_DISCARD, nothing reaches the rasteriser) and the outputs are captured into the other buffer. The two
+ *					swap every frame (ping-pong), a buffer can't be read and captured into by the same draw.
+ *	*emit			the CPU only says how many particles to start where: emit() takes a range of slots from a ring cursor, the ranges
+ *					of the frame (up to maxEmitters, together at most capacity slots so they never overlap) go into the Particles
+ *					uniform block from the UniformStream. The update shader restarts the slots in a range with random values hashed
+ *					from the slot and the frame, so a burst of 10000 costs the CPU 64 bytes. The ring overwrites the oldest
+ *					particles: with capacity >= rate x longest lifetime nothing alive is taken.
+ *	*draw			one instanced draw of a 4 vertex triangle strip per slot (glDrawArraysInstanced), the slot's state comes in as
+ *					per instance attributes (VertexLayout::divisor 1) from the buffer just written. The vertex shader turns the
+ *					quad to face the camera and moves dead slots outside the clip volume.
+ *
+ * The particles are emissive and additively blended, the order doesn't matter and nothing is sorted. They don't write depth. Against
+ * the scene they are either depth tested (a target with a depth buffer, the forward path) or, with FEATURE_SOFT_PARTICLES, fade out
+ * by the distance to the depth of a sampled target (the deferred path's G-buffer), which also hides the hard line where a sprite cuts
+ * into a surface. With TAA they are added after the resolve (TemporalAA::addPass drawnOver), soft against the scene's depth: without
+ * depth or motion of their own the reprojection would drag them through the history.
+ *
+ * The simulation is not a pass of the render graph, it draws into no target: simulate() runs before the graph executes.
+ *
+ *	ParticleSystem particles;
+ *	particles.create(pipelines, updateProgram, renderProgram, softProgram, 1 << 20);
+ *	particles.addPass(graph, sceneColor, 0);	// after the scene is drawn, before post-processing
+ *	... per frame: particles.emit(emitter, count); particles.fillBlock(particleBlock, dt) into the Particles uniform block,
+ *	particles.simulate(), graph.execute() ...
+ */
+
+#include "gl_api.h"
+#include "pipeline_state.h"
+#include "render_graph.h"
+#include "uniform_buffer.h"
+
+// texture unit of the soft particles' depth sampler
+enum class ParticleTextureUnit : GLuint
+{
+	Depth = 2
+};
+
+// where and how particles start, the values of each particle are random within these
+struct ParticleEmitter
+{
+	float position[3] = {};
+	float radius = 0.0f;			// of the sphere around position they start in
+	float velocity[3] = {};
+	float spread = 0.0f;			// largest random velocity added
+	float lifetimeMin = 1.0f;		// seconds
+	float lifetimeMax = 2.0f;
+};
+
+struct ParticleSettings
+{
+	float gravity = 9.81f;
+	float drag = 0.2f;				// fraction of the velocity lost per second
+	float size = 0.01f;				// half the width of a sprite, world units
+	float softness = 0.1f;			// soft particles: view distance to the surface behind over which they fade in
+	float startColor[3] = { 4.0f, 1.6f, 0.4f };	// HDR, a young particle blooms
+	float endColor[3] = { 0.6f, 0.1f, 0.02f };
+};
+
+class ParticleSystem
+{
+public:
+	static const int maxEmitters = 8;				// ranges per frame, the Particles block's array
+	static const int maxGraphs = 4;					// graphs the draw can be added to
+	static const GLsizeiptr bytesPerParticle = 32;	// position and age, velocity and lifetime
+
+	ParticleSystem() = default;
+	~ParticleSystem();
+
+	ParticleSystem(const ParticleSystem&) = delete;
+	ParticleSystem& operator=(const ParticleSystem&) = delete;
+
+	// the two state buffers of capacity particles and the pipelines. The update program is linked with the varyings outPositionAge and
+	// outVelocityLifetime (ShaderCache::feedbackProgram), the soft program is the render program with FEATURE_SOFT_PARTICLES
+	bool create(PipelineCache& pipelines, GLuint updateProgram, GLuint renderProgram, GLuint softProgram, int capacity);
+	void destroy();
+
+	// the draw after the passes drawing target. depthSource 0: depth tested against target's depth buffer, otherwise soft particles
+	// against the sampled depth of depthSource
+	RenderGraphPass addPass(RenderGraph& graph, RenderGraphResource target, RenderGraphResource depthSource);
+
+	// started by the next simulate(). Beyond maxEmitters a frame, or beyond capacity particles a frame in total, are dropped
+	void emit(const ParticleEmitter& emitter, int count);
+	void fillBlock(ParticleBlock* block, float deltaTime);	// the settings and this frame's emitters, which are then taken
+	void simulate();										// the Particles block is bound
+
+	ParticleSettings settings;
+
+	int capacity() const { return slots; }
+
+	struct Stats
+	{
+		long long frames = 0;			// simulated
+		long long emitted = 0;			// particles started
+		long long droppedEmits = 0;		// emit() calls beyond maxEmitters in a frame, or with the frame's slots all taken
+		long long droppedParticles = 0;	// particles beyond capacity in a frame, their slots were already taken that frame
+		long long stateBytes = 0;		// both buffers
+	};
+	const Stats& stats() const { return counters; }
+
+private:
+	struct GraphResources
+	{
+		ParticleSystem* system;
+		RenderGraphResource depthSource;
+	};
+
+	static void drawParticles(const RenderGraph& graph, void* user);
+
+	PipelineCache* pipelines = nullptr;
+	PipelineHandle update = 0, render = 0, soft = 0;
+	GLuint buffers[2] = {};
+	int latest = 0;					// the buffer holding the current state, the next simulate() captures into the other
+	int slots = 0;
+	int cursor = 0;					// the ring's next slot
+	unsigned int seed = 0;			// the frame's, for the random values of the new particles
+	ParticleEmitterGpu queued[maxEmitters] = {};
+	int queuedCount = 0;
+	int queuedParticles = 0;		// the sum of the queued ranges, never more than slots
+	GraphResources graphs[maxGraphs] = {};
+	int graphCount = 0;
+	Stats counters;
+};
+
+#endif
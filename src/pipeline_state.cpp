@@ -0,0 +1,509 @@
+/*
+ *	Pipeline state objects, see pipeline_state.h
+ */
+
+#include "pipeline_state.h"
+#include "alloc_tracker.h"
+#include "gl_resources.h"
+
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+	// FNV-1a over the values of the fields (not the bytes of the struct, the padding between fields is undefined)
+	struct Hasher
+	{
+		unsigned int hash = 2166136261u;
+
+		void add(unsigned int value)
+		{
+			for (int i = 0; i < 4; i++)
+			{
+				hash ^= (value >> (i * 8)) & 0xFFu;
+				hash *= 16777619u;
+			}
+		}
+
+		void addFloat(float value)
+		{
+			unsigned int bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			add(bits);
+		}
+	};
+
+	unsigned int hashDesc(const PipelineDesc& desc)
+	{
+		Hasher h;
+		h.add(desc.program);
+		h.add((unsigned int)desc.layout.attributeCount);
+		h.add((unsigned int)desc.layout.stride);
+		h.add(desc.layout.divisor);
+		for (int i = 0; i < desc.layout.attributeCount; i++)
+		{
+			const VertexAttribute& a = desc.layout.attributes[i];
+			h.add(a.location);
+			h.add((unsigned int)a.components);
+			h.add(a.type);
+			h.add(a.normalized);
+			h.add(a.offset);
+		}
+		h.add(desc.blend.enabled);
+		h.add(desc.blend.sourceColor);
+		h.add(desc.blend.destinationColor);
+		h.add(desc.blend.sourceAlpha);
+		h.add(desc.blend.destinationAlpha);
+		h.add(desc.blend.equation);
+		for (int i = 0; i < 4; i++)
+		{
+			h.add(desc.blend.colorWrite[i]);
+		}
+		h.add(desc.depth.test);
+		h.add(desc.depth.write);
+		h.add(desc.depth.compare);
+		h.add(desc.raster.cull);
+		h.add(desc.raster.cullFace);
+		h.add(desc.raster.frontFace);
+		h.add(desc.raster.polygonMode);
+		h.addFloat(desc.raster.depthBiasSlope);
+		h.addFloat(desc.raster.depthBiasConstant);
+		return h.hash;
+	}
+
+	bool sameLayout(const VertexLayout& a, const VertexLayout& b)
+	{
+		if (a.attributeCount != b.attributeCount || a.stride != b.stride || a.divisor != b.divisor)
+		{
+			return false;
+		}
+		for (int i = 0; i < a.attributeCount; i++)
+		{
+			const VertexAttribute& x = a.attributes[i];
+			const VertexAttribute& y = b.attributes[i];
+			if (x.location != y.location || x.components != y.components || x.type != y.type || x.normalized != y.normalized ||
+				x.offset != y.offset)
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool sameBlendFactors(const BlendState& a, const BlendState& b)
+	{
+		return a.sourceColor == b.sourceColor && a.destinationColor == b.destinationColor && a.sourceAlpha == b.sourceAlpha &&
+			a.destinationAlpha == b.destinationAlpha;
+	}
+
+	bool sameDesc(const PipelineDesc& a, const PipelineDesc& b)
+	{
+		return a.program == b.program && sameLayout(a.layout, b.layout) &&
+			a.blend.enabled == b.blend.enabled && sameBlendFactors(a.blend, b.blend) && a.blend.equation == b.blend.equation &&
+			std::memcmp(a.blend.colorWrite, b.blend.colorWrite, sizeof(a.blend.colorWrite)) == 0 &&
+			a.depth.test == b.depth.test && a.depth.write == b.depth.write && a.depth.compare == b.depth.compare &&
+			a.raster.cull == b.raster.cull && a.raster.cullFace == b.raster.cullFace && a.raster.frontFace == b.raster.frontFace &&
+			a.raster.polygonMode == b.raster.polygonMode && a.raster.depthBiasSlope == b.raster.depthBiasSlope &&
+			a.raster.depthBiasConstant == b.raster.depthBiasConstant;
+	}
+
+	bool isBlendFactor(GLenum factor)
+	{
+		switch (factor)
+		{
+		case GL_ZERO: case GL_ONE:
+		case GL_SRC_COLOR: case GL_ONE_MINUS_SRC_COLOR: case GL_DST_COLOR: case GL_ONE_MINUS_DST_COLOR:
+		case GL_SRC_ALPHA: case GL_ONE_MINUS_SRC_ALPHA: case GL_DST_ALPHA: case GL_ONE_MINUS_DST_ALPHA:
+		case GL_CONSTANT_COLOR: case GL_ONE_MINUS_CONSTANT_COLOR: case GL_CONSTANT_ALPHA: case GL_ONE_MINUS_CONSTANT_ALPHA:
+		case GL_SRC_ALPHA_SATURATE:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	bool isAttributeType(GLenum type)
+	{
+		switch (type)
+		{
+		case GL_FLOAT: case GL_HALF_FLOAT: case GL_BYTE: case GL_UNSIGNED_BYTE: case GL_SHORT: case GL_UNSIGNED_SHORT:
+		case GL_INT: case GL_UNSIGNED_INT: case GL_INT_2_10_10_10_REV: case GL_UNSIGNED_INT_2_10_10_10_REV:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	// everything the driver would otherwise check at every draw, checked once
+	bool validate(const PipelineDesc& desc)
+	{
+		GLint linked = GL_FALSE;
+		if (desc.program != 0)
+		{
+			glGetProgramiv(desc.program, GL_LINK_STATUS, &linked);
+		}
+		if (!linked)
+		{
+			std::cout << "ERROR::PIPELINE::PROGRAM_NOT_LINKED (" << desc.program << ")" << std::endl;
+			return false;
+		}
+
+		GLint maxAttributes = 16;
+		glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, &maxAttributes);
+		for (int i = 0; i < desc.layout.attributeCount; i++)
+		{
+			const VertexAttribute& a = desc.layout.attributes[i];
+			if ((GLint)a.location >= maxAttributes || a.components < 1 || a.components > 4 || !isAttributeType(a.type) ||
+				(GLsizei)a.offset >= desc.layout.stride)
+			{
+				std::cout << "ERROR::PIPELINE::INVALID_VERTEX_ATTRIBUTE (location " << a.location << ")" << std::endl;
+				return false;
+			}
+		}
+
+		const BlendState& b = desc.blend;
+		bool equation = b.equation == GL_FUNC_ADD || b.equation == GL_FUNC_SUBTRACT || b.equation == GL_FUNC_REVERSE_SUBTRACT ||
+			b.equation == GL_MIN || b.equation == GL_MAX;
+		if (!isBlendFactor(b.sourceColor) || !isBlendFactor(b.destinationColor) || !isBlendFactor(b.sourceAlpha) ||
+			!isBlendFactor(b.destinationAlpha) || !equation)
+		{
+			std::cout << "ERROR::PIPELINE::INVALID_BLEND_STATE" << std::endl;
+			return false;
+		}
+
+		if (desc.depth.compare < GL_NEVER || desc.depth.compare > GL_ALWAYS)	// GL_NEVER ... GL_ALWAYS are consecutive
+		{
+			std::cout << "ERROR::PIPELINE::INVALID_DEPTH_COMPARE" << std::endl;
+			return false;
+		}
+
+		const RasterState& r = desc.raster;
+		if ((r.cullFace != GL_BACK && r.cullFace != GL_FRONT && r.cullFace != GL_FRONT_AND_BACK) ||
+			(r.frontFace != GL_CCW && r.frontFace != GL_CW) ||
+			(r.polygonMode != GL_FILL && r.polygonMode != GL_LINE && r.polygonMode != GL_POINT))
+		{
+			std::cout << "ERROR::PIPELINE::INVALID_RASTER_STATE" << std::endl;
+			return false;
+		}
+		return true;
+	}
+
+	void setCapability(GLenum capability, bool enabled)
+	{
+		if (enabled)
+		{
+			glEnable(capability);
+		}
+		else
+		{
+			glDisable(capability);
+		}
+	}
+}
+
+VertexLayout& VertexLayout::add(GLuint location, GLint components, GLenum type, GLuint offset, GLboolean normalized)
+{
+	if (attributeCount < maxVertexAttributes)
+	{
+		VertexAttribute& a = attributes[attributeCount++];
+		a.location = location;
+		a.components = components;
+		a.type = type;
+		a.normalized = normalized;
+		a.offset = offset;
+	}
+	return *this;
+}
+
+BlendState BlendState::alpha()
+{
+	BlendState state;
+	state.enabled = true;
+	state.sourceColor = GL_SRC_ALPHA;
+	state.destinationColor = GL_ONE_MINUS_SRC_ALPHA;
+	state.sourceAlpha = GL_ONE;
+	state.destinationAlpha = GL_ONE_MINUS_SRC_ALPHA;
+	return state;
+}
+
+BlendState BlendState::additive()
+{
+	BlendState state;
+	state.enabled = true;
+	state.sourceColor = GL_ONE;
+	state.destinationColor = GL_ONE;
+	state.sourceAlpha = GL_ONE;
+	state.destinationAlpha = GL_ONE;
+	return state;
+}
+
+PipelineCache::~PipelineCache()
+{
+	destroy();
+}
+
+PipelineHandle PipelineCache::create(const PipelineDesc& desc)
+{
+	AllocScope scope(AllocTag::Resources);	// the VAO and the pipeline table
+	unsigned int hash = hashDesc(desc);
+	for (size_t i = 0; i < pipelines.size(); i++)
+	{
+		if (pipelines[i].hash == hash && sameDesc(pipelines[i].desc, desc))
+		{
+			return (PipelineHandle)(i + 1);	// created before
+		}
+	}
+
+	if (!validate(desc))
+	{
+		return 0;
+	}
+
+	GLuint vertexArray;
+	if (GlResources::directStateAccess())
+	{
+		// with DSA the attribute format is separate from the buffer: every attribute reads from buffer binding 0, the buffer is
+		// attached to that binding later without touching the format
+		glCreateVertexArrays(1, &vertexArray);
+		for (int i = 0; i < desc.layout.attributeCount; i++)
+		{
+			const VertexAttribute& a = desc.layout.attributes[i];
+			glEnableVertexArrayAttrib(vertexArray, a.location);
+			glVertexArrayAttribFormat(vertexArray, a.location, a.components, a.type, a.normalized, a.offset);
+			glVertexArrayAttribBinding(vertexArray, a.location, 0);
+		}
+		glVertexArrayBindingDivisor(vertexArray, 0, desc.layout.divisor);
+	}
+	else
+	{
+		// the VAO remembers which attributes are enabled, the pointers are set when a vertex buffer is attached
+		glGenVertexArrays(1, &vertexArray);
+		glBindVertexArray(vertexArray);
+		for (int i = 0; i < desc.layout.attributeCount; i++)
+		{
+			glEnableVertexAttribArray(desc.layout.attributes[i].location);
+			glVertexAttribDivisor(desc.layout.attributes[i].location, desc.layout.divisor);
+		}
+		glBindVertexArray(current != 0 ? pipelines[current - 1].vertexArray : 0);	// creating must not change what is bound
+	}
+
+	pipelines.push_back(Pipeline{ desc, hash, vertexArray, 0, 0 });
+	return (PipelineHandle)pipelines.size();
+}
+
+const PipelineDesc* PipelineCache::desc(PipelineHandle pipeline) const
+{
+	return pipeline != 0 && pipeline <= pipelines.size() ? &pipelines[pipeline - 1].desc : nullptr;
+}
+
+void PipelineCache::bind(PipelineHandle pipeline)
+{
+	counters.binds++;
+	if (pipeline == current && stateKnown)
+	{
+		counters.redundantBinds++;
+		return;
+	}
+	if (pipeline == 0 || pipeline > pipelines.size())
+	{
+		return;
+	}
+
+	const Pipeline& next = pipelines[pipeline - 1];
+	apply(next.desc, !stateKnown);
+	if (pipeline != current || !stateKnown)
+	{
+		glBindVertexArray(next.vertexArray);
+		counters.stateChanges++;
+	}
+	current = pipeline;
+	applied = next.desc;
+	stateKnown = true;
+}
+
+void PipelineCache::apply(const PipelineDesc& desc, bool force)
+{
+	// program
+	if (force || desc.program != applied.program)
+	{
+		glUseProgram(desc.program);
+		counters.stateChanges++;
+	}
+
+	// blend
+	const BlendState& b = desc.blend;
+	if (force || b.enabled != applied.blend.enabled)
+	{
+		setCapability(GL_BLEND, b.enabled);
+		counters.stateChanges++;
+	}
+	if (force || !sameBlendFactors(b, applied.blend))
+	{
+		glBlendFuncSeparate(b.sourceColor, b.destinationColor, b.sourceAlpha, b.destinationAlpha);
+		counters.stateChanges++;
+	}
+	if (force || b.equation != applied.blend.equation)
+	{
+		glBlendEquation(b.equation);
+		counters.stateChanges++;
+	}
+	if (force || std::memcmp(b.colorWrite, applied.blend.colorWrite, sizeof(b.colorWrite)) != 0)
+	{
+		glColorMask(b.colorWrite[0], b.colorWrite[1], b.colorWrite[2], b.colorWrite[3]);
+		counters.stateChanges++;
+	}
+
+	// depth
+	const DepthState& d = desc.depth;
+	if (force || d.test != applied.depth.test)
+	{
+		setCapability(GL_DEPTH_TEST, d.test);
+		counters.stateChanges++;
+	}
+	if (force || d.write != applied.depth.write)
+	{
+		glDepthMask(d.write ? GL_TRUE : GL_FALSE);
+		counters.stateChanges++;
+	}
+	if (force || d.compare != applied.depth.compare)
+	{
+		glDepthFunc(d.compare);
+		counters.stateChanges++;
+	}
+
+	// raster
+	const RasterState& r = desc.raster;
+	if (force || r.cull != applied.raster.cull)
+	{
+		setCapability(GL_CULL_FACE, r.cull);
+		counters.stateChanges++;
+	}
+	if (force || r.cullFace != applied.raster.cullFace)
+	{
+		glCullFace(r.cullFace);
+		counters.stateChanges++;
+	}
+	if (force || r.frontFace != applied.raster.frontFace)
+	{
+		glFrontFace(r.frontFace);
+		counters.stateChanges++;
+	}
+	if (force || r.polygonMode != applied.raster.polygonMode)
+	{
+		glPolygonMode(GL_FRONT_AND_BACK, r.polygonMode);
+		counters.stateChanges++;
+	}
+	bool bias = r.depthBiasSlope != 0.0f || r.depthBiasConstant != 0.0f;
+	bool appliedBias = applied.raster.depthBiasSlope != 0.0f || applied.raster.depthBiasConstant != 0.0f;
+	if (force || bias != appliedBias)
+	{
+		setCapability(GL_POLYGON_OFFSET_FILL, bias);
+		counters.stateChanges++;
+	}
+	if (bias && (force || r.depthBiasSlope != applied.raster.depthBiasSlope || r.depthBiasConstant != applied.raster.depthBiasConstant))
+	{
+		glPolygonOffset(r.depthBiasSlope, r.depthBiasConstant);
+		counters.stateChanges++;
+	}
+}
+
+void PipelineCache::setVertexBuffer(GLuint buffer, GLintptr offset)
+{
+	if (current == 0)
+	{
+		return;
+	}
+	Pipeline& pipeline = pipelines[current - 1];
+	if (pipeline.vertexBuffer == buffer && pipeline.vertexOffset == offset)
+	{
+		return;	// the VAO still points at it
+	}
+
+	const VertexLayout& layout = pipeline.desc.layout;
+	if (GlResources::directStateAccess())
+	{
+		glVertexArrayVertexBuffer(pipeline.vertexArray, 0, buffer, offset, layout.stride);	// one call, whatever the number of attributes
+	}
+	else
+	{
+		// glVertexAttribPointer takes the buffer bound to GL_ARRAY_BUFFER, the VAO keeps it after the binding changes
+		GlResources::bindBuffer(GL_ARRAY_BUFFER, buffer);
+		for (int i = 0; i < layout.attributeCount; i++)
+		{
+			const VertexAttribute& a = layout.attributes[i];
+			glVertexAttribPointer(a.location, a.components, a.type, a.normalized, layout.stride, (void*)(offset + (GLintptr)a.offset));
+		}
+	}
+	pipeline.vertexBuffer = buffer;
+	pipeline.vertexOffset = offset;
+}
+
+void PipelineCache::invalidate()
+{
+	stateKnown = false;
+}
+
+void PipelineCache::openWriteMasks()
+{
+	// glClear follows the write masks. The cache knows what it set, only the masks that are closed are opened, without asking OpenGL
+	static const GLboolean open[4] = { GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE };
+	bool changed = false;
+	if (!stateKnown || std::memcmp(applied.blend.colorWrite, open, sizeof(open)) != 0)
+	{
+		glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+		std::memcpy(applied.blend.colorWrite, open, sizeof(open));
+		counters.stateChanges++;
+		changed = true;
+	}
+	if (!stateKnown || !applied.depth.write)
+	{
+		glDepthMask(GL_TRUE);
+		applied.depth.write = true;
+		counters.stateChanges++;
+		changed = true;
+	}
+	if (changed)
+	{
+		current = 0;	// binding the same pipeline again is not redundant any more, its masks have to go back
+	}
+}
+
+void PipelineCache::destroy()
+{
+	for (const Pipeline& pipeline : pipelines)
+	{
+		glDeleteVertexArrays(1, &pipeline.vertexArray);
+	}
+	pipelines.clear();
+	reflections.clear();
+	current = 0;
+	stateKnown = false;
+}
+
+ProgramReflection* PipelineCache::reflect(GLuint program, const ShaderManifestProgram* manifest)
+{
+	ProgramReflection* known = reflection(program);
+	if (known != nullptr)
+	{
+		return known;
+	}
+	reflections.emplace_back();
+	if (!reflections.back().build(program, manifest))
+	{
+		reflections.pop_back();
+		return nullptr;
+	}
+	return &reflections.back();
+}
+
+ProgramReflection* PipelineCache::reflection(GLuint program)
+{
+	for (ProgramReflection& reflection : reflections)
+	{
+		if (reflection.program() == program)
+		{
+			return &reflection;
+		}
+	}
+	return nullptr;
+}
@@ -0,0 +1,159 @@
+#ifndef PIPELINE_STATE_H
+#define PIPELINE_STATE_H
+
+/*
+ * NOTES:
+ * Pipeline state objects (PSO), everything a draw needs besides its buffers and uniforms, decided once.
+ *
+ * OpenGL is a state machine: glUseProgram, glEnable(GL_BLEND), glBlendFunc, glDepthFunc, glCullFace, ... each change one piece of
+ * global state and the driver checks the whole combination again at the next draw. Set piecemeal, every draw pays for state that did not
+ * change, and it is easy to forget a piece (the previous object's blending leaks into the next one).
+ *
+ * A PipelineDesc describes the full combination:
+ *	*program			the linked shader program
+ *	*vertex layout		which attributes the vertex buffer has and where (what glVertexAttribPointer describes)
+ *	*blend				on/off, factors, equation and which colour channels are written
+ *	*depth				test on/off, compare function, depth writes on/off
+ *	*raster				face culling, front face winding, polygon mode (fill / line for wireframe), depth bias
+ *
+ * PipelineCache::create() checks the description once (valid enums, attribute limits, program linked), builds the vertex array object for
+ * the layout and returns a handle. Identical descriptions get the same handle (they are hashed), so asking twice costs nothing.
+ *
+ * PipelineCache::bind() compares the pipeline with the one applied last and only calls OpenGL for what differs. Drawing many objects with
+ * the same pipeline is one bind, switching between two pipelines that only differ in blending is one glBlendFunc. Because of that the cache
+ * must be the only code changing this state, after anything else touched it call invalidate() and the next bind applies everything.
+ *
+ * GL 3.3 stores the vertex buffer in the VAO together with the attribute format (glVertexAttribPointer reads GL_ARRAY_BUFFER), so the
+ * buffer is attached separately with setVertexBuffer() after bind; the attributes are only pointed again when the buffer changes. With
+ * direct state access (see gl_resources.h) the format is set once at creation and attaching a buffer is one glVertexArrayVertexBuffer.
+ *
+ * The cache also keeps the uniform table (ProgramReflection, see shader_reflection.h) of every program its pipelines use, reflect() builds
+ * it once at load time and reflection() finds it again, so the loose uniforms (sampler units) go through the hashed, cached setters.
+ *
+ *	PipelineHandle pipeline = pipelines.create(desc);	// at load time
+ *	pipelines.bind(pipeline);							// per draw
+ *	pipelines.setVertexBuffer(VBO);
+ *	glDrawArrays(GL_TRIANGLES, 0, 3);
+ */
+
+#include "gl_api.h"
+
+#include <vector>
+
+#include "shader_reflection.h"
+
+const int maxVertexAttributes = 8;
+
+struct VertexAttribute
+{
+	GLuint location = 0;		// layout (location = n) in the vertex shader
+	GLint components = 0;		// 1 to 4
+	GLenum type = GL_FLOAT;
+	GLboolean normalized = GL_FALSE;
+	GLuint offset = 0;			// bytes from the start of a vertex
+};
+
+struct VertexLayout
+{
+	VertexAttribute attributes[maxVertexAttributes];
+	int attributeCount = 0;
+	GLsizei stride = 0;			// bytes from one vertex to the next
+	GLuint divisor = 0;			// 0 = a vertex per vertex, n = per n instances (glDrawArraysInstanced), e.g. particles drawn as quads
+
+	VertexLayout& add(GLuint location, GLint components, GLenum type, GLuint offset, GLboolean normalized = GL_FALSE);
+};
+
+struct BlendState
+{
+	bool enabled = false;
+	GLenum sourceColor = GL_ONE, destinationColor = GL_ZERO;
+	GLenum sourceAlpha = GL_ONE, destinationAlpha = GL_ZERO;
+	GLenum equation = GL_FUNC_ADD;
+	GLboolean colorWrite[4] = { GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE };	// glColorMask
+
+	static BlendState opaque() { return BlendState(); }
+	static BlendState alpha();			// src * a + dst * (1 - a)
+	static BlendState additive();		// src + dst
+};
+
+struct DepthState
+{
+	bool test = false;
+	bool write = true;
+	GLenum compare = GL_LESS;
+};
+
+struct RasterState
+{
+	bool cull = false;
+	GLenum cullFace = GL_BACK;
+	GLenum frontFace = GL_CCW;
+	GLenum polygonMode = GL_FILL;	// GL_LINE for wireframe
+	float depthBiasSlope = 0.0f;	// glPolygonOffset(slope, constant) on filled polygons, both 0 = off. Shadow maps use it against acne
+	float depthBiasConstant = 0.0f;
+};
+
+struct PipelineDesc
+{
+	GLuint program = 0;
+	VertexLayout layout;
+	BlendState blend;
+	DepthState depth;
+	RasterState raster;
+};
+
+typedef unsigned int PipelineHandle;	// 0 is no pipeline
+
+class PipelineCache
+{
+public:
+	PipelineCache() = default;
+	~PipelineCache();
+
+	PipelineCache(const PipelineCache&) = delete;
+	PipelineCache& operator=(const PipelineCache&) = delete;
+
+	// validates the description and builds its VAO, returns the existing handle for a description created before, 0 if invalid
+	PipelineHandle create(const PipelineDesc& desc);
+	const PipelineDesc* desc(PipelineHandle pipeline) const;
+
+	void bind(PipelineHandle pipeline);						// applies what differs from the pipeline bound before
+	void setVertexBuffer(GLuint buffer, GLintptr offset = 0);	// vertex buffer of the bound pipeline's layout
+	void invalidate();										// state was changed behind the cache's back, the next bind applies everything
+	void openWriteMasks();									// colour and depth writes on for a glClear, the next bind puts back its own
+	void destroy();											// deletes the VAOs, the programs belong to whoever created them
+
+	// the program's uniform table, built on the first call (from the manifest entry when there is one). nullptr if two names collide.
+	// Pointers stay valid until the next reflect() of a new program
+	ProgramReflection* reflect(GLuint program, const ShaderManifestProgram* manifest = nullptr);
+	ProgramReflection* reflection(GLuint program);			// nullptr when the program was never reflected
+
+	struct Stats
+	{
+		int binds = 0;
+		int redundantBinds = 0;		// same pipeline as before, nothing to do
+		int stateChanges = 0;		// OpenGL state calls made by bind()
+	};
+	const Stats& stats() const { return counters; }
+
+private:
+	struct Pipeline
+	{
+		PipelineDesc desc;
+		unsigned int hash;
+		GLuint vertexArray;
+		GLuint vertexBuffer;		// attached to vertexArray, 0 = none yet
+		GLintptr vertexOffset;
+	};
+
+	void apply(const PipelineDesc& desc, bool force);
+
+	std::vector<Pipeline> pipelines;	// handle - 1
+	std::vector<ProgramReflection> reflections;
+	PipelineHandle current = 0;
+	bool stateKnown = false;			// applied holds what OpenGL has
+	PipelineDesc applied;
+	Stats counters;
+};
+
+#endif
@@ -0,0 +1,194 @@
+/*
+ *	HDR post-processing, see post_process.h
+ */
+
+#include "post_process.h"
+#include "gl_resources.h"
+#include "gpu_memory.h"
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+	// pass and target names are kept by the graph as pointers
+	const char* const downsampleNames[] = { "BloomPrefilter", "BloomDown1", "BloomDown2", "BloomDown3", "BloomDown4" };
+	const char* const upsampleNames[] = { "BloomUp0", "BloomUp1", "BloomUp2", "BloomUp3" };
+	const char* const levelNames[] = { "Bloom0", "Bloom1", "Bloom2", "Bloom3", "Bloom4" };
+	static_assert(sizeof(levelNames) / sizeof(levelNames[0]) == PostChain::bloomLevels, "a name per bloom level");
+
+	// the default grade in display (sRGB) space: a little contrast, warmer, a little more saturated
+	void grade(const float* in, float* out)
+	{
+		float luma = 0.2126f * in[0] + 0.7152f * in[1] + 0.0722f * in[2];
+		const float tint[3] = { 1.03f, 1.0f, 0.96f };
+		for (int i = 0; i < 3; i++)
+		{
+			float c = luma + (in[i] - luma) * 1.1f;		// saturation
+			c = std::min(std::max(c, 0.0f), 1.0f);
+			c += (c * c * (3.0f - 2.0f * c) - c) * 0.3f;	// towards smoothstep: an S curve, darker shadows and brighter highlights
+			out[i] = std::min(std::max(c * tint[i], 0.0f), 1.0f);
+		}
+	}
+}
+
+PostChain::~PostChain()
+{
+	destroy();
+}
+
+bool PostChain::create(PipelineCache& cache, GLuint prefilterProgram, GLuint downsampleProgram, GLuint upsampleProgram, GLuint tonemapProgram)
+{
+	destroy();
+
+	// full screen triangles: no vertex attributes, no depth
+	PipelineDesc desc;
+	desc.depth.test = false;
+	desc.depth.write = false;
+	desc.program = prefilterProgram;
+	prefilter = cache.create(desc);
+	desc.program = downsampleProgram;
+	downsample = cache.create(desc);
+	desc.program = tonemapProgram;
+	tonemap = cache.create(desc);
+	desc.program = upsampleProgram;
+	desc.blend = BlendState::additive();	// onto the level's own downsample
+	upsample = cache.create(desc);
+	if (prefilter == 0 || downsample == 0 || upsample == 0 || tonemap == 0)
+	{
+		std::cout << "ERROR::POST_PROCESS::PIPELINES" << std::endl;
+		return false;
+	}
+	pipelines = &cache;
+
+	// the grading LUT: every texel is the graded colour of its centre, red along x, green along y, blue along z
+	std::vector<unsigned char> texels((size_t)lutSize * lutSize * lutSize * 4);
+	for (int b = 0; b < lutSize; b++)
+	{
+		for (int g = 0; g < lutSize; g++)
+		{
+			for (int r = 0; r < lutSize; r++)
+			{
+				const float in[3] = { (float)r / (lutSize - 1), (float)g / (lutSize - 1), (float)b / (lutSize - 1) };
+				float out[3];
+				grade(in, out);
+				unsigned char* texel = &texels[(((size_t)b * lutSize + g) * lutSize + r) * 4];
+				for (int i = 0; i < 3; i++)
+				{
+					texel[i] = (unsigned char)(out[i] * 255.0f + 0.5f);
+				}
+				texel[3] = 255;
+			}
+		}
+	}
+	gradingLut = GpuMemory::createTexture3D(GpuMemoryCategory::Texture, GL_RGBA8, lutSize, lutSize, lutSize, GL_RGBA, GL_UNSIGNED_BYTE,
+		texels.data());
+	return true;
+}
+
+void PostChain::destroy()
+{
+	if (gradingLut != 0)
+	{
+		GpuMemory::deleteTexture(gradingLut);
+		gradingLut = 0;
+	}
+	pipelines = nullptr;	// the pipelines belong to the cache
+	prefilter = downsample = upsample = tonemap = 0;
+	graphCount = 0;
+}
+
+bool PostChain::addPasses(RenderGraph& graph, RenderGraphResource hdrScene)
+{
+	if (graphCount == maxGraphs || pipelines == nullptr)
+	{
+		std::cout << "ERROR::POST_PROCESS::ADD_PASSES " << (pipelines == nullptr ? "not created" : "too many graphs") << std::endl;
+		return false;
+	}
+	Step* graphSteps = steps[graphCount++];
+
+	// the pyramid: level i is 1 / 2^(i + 1) of the frame
+	RenderTargetDesc levelDesc;
+	levelDesc.addColor(GL_R11F_G11F_B10F);
+	RenderGraphResource levels[bloomLevels];
+	for (int i = 0; i < bloomLevels; i++)
+	{
+		levels[i] = graph.createTarget(levelNames[i], levelDesc, 2 << i);
+	}
+
+	// down: every level filtered from the one above, the first from the scene with the prefilter
+	for (int i = 0; i < bloomLevels; i++)
+	{
+		Step& step = graphSteps[i];
+		step.chain = this;
+		step.pipeline = i == 0 ? prefilter : downsample;
+		step.source = i == 0 ? hdrScene : levels[i - 1];
+		RenderGraphPass pass = graph.addPass(downsampleNames[i], drawStep, &step);
+		graph.read(pass, step.source);
+		graph.write(pass, levels[i], RenderGraphLoad::DontCare);	// every texel is written
+	}
+
+	// up: from the smallest level, each added onto the next bigger one, which ends up holding the sum of every level
+	for (int i = bloomLevels - 2; i >= 0; i--)
+	{
+		Step& step = graphSteps[bloomLevels + i];
+		step.chain = this;
+		step.pipeline = upsample;
+		step.source = levels[i + 1];
+		RenderGraphPass pass = graph.addPass(upsampleNames[i], drawStep, &step);
+		graph.read(pass, step.source);
+		graph.write(pass, levels[i], RenderGraphLoad::Load);
+	}
+
+	// the final pass draws into the window, which the graph doesn't know about
+	Step& last = graphSteps[2 * bloomLevels - 1];
+	last.chain = this;
+	last.pipeline = tonemap;
+	last.source = hdrScene;
+	last.bloom = levels[0];
+	RenderGraphPass pass = graph.addPass("Tonemap", drawFinal, &last);
+	graph.read(pass, hdrScene);
+	graph.read(pass, levels[0]);
+	graph.setSideEffect(pass);
+	return true;
+}
+
+void PostChain::setWindowSize(int width, int height)
+{
+	windowWidth = width;
+	windowHeight = height;
+}
+
+void PostChain::fillBlock(PostBlock* block) const
+{
+	block->bloomParams[0] = settings.bloomThreshold;
+	block->bloomParams[1] = std::max(settings.bloomKnee, 1e-4f);
+	block->bloomParams[2] = settings.bloomIntensity;
+	block->bloomParams[3] = settings.bloomRadius;
+	block->toneParams[0] = settings.exposure;
+	block->toneParams[1] = (float)lutSize;
+	block->toneParams[2] = 0.0f;
+	block->toneParams[3] = 0.0f;
+}
+
+// one level of the pyramid, the graph has bound the level's target and set the viewport to its size
+void PostChain::drawStep(const RenderGraph& graph, void* user)
+{
+	const Step* step = (const Step*)user;
+	GlResources::bindTexture((GLuint)PostTextureUnit::Source, GL_TEXTURE_2D, graph.texture(step->source));
+	step->chain->pipelines->bind(step->pipeline);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+}
+
+void PostChain::drawFinal(const RenderGraph& graph, void* user)
+{
+	const Step* step = (const Step*)user;
+	const PostChain* chain = step->chain;
+	glViewport(0, 0, chain->windowWidth, chain->windowHeight);	// the default framebuffer is bound, the viewport is the last target's
+	GlResources::bindTexture((GLuint)PostTextureUnit::Source, GL_TEXTURE_2D, graph.texture(step->source));
+	GlResources::bindTexture((GLuint)PostTextureUnit::Bloom, GL_TEXTURE_2D, graph.texture(step->bloom));
+	GlResources::bindTexture((GLuint)PostTextureUnit::GradingLut, GL_TEXTURE_3D, chain->gradingLut);
+	chain->pipelines->bind(step->pipeline);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+}
@@ -0,0 +1,102 @@
+#ifndef POST_PROCESS_H
+#define POST_PROCESS_H
+
+/*
+ * NOTES:
+ * HDR post-processing: the lit scene is rendered in a floating point target and only turned into displayable colours at the very end.
+ *
+ * Lighting happily produces values above 1 (a highlight, a bright light nearby), an 8 bit target clips them and every overexposed area
+ * turns into the same flat white. Keeping the scene in GL_R11F_G11F_B10F (floats with 6 and 5 bit mantissas, 4 bytes per pixel like
+ * RGBA8, half of RGBA16F) keeps that range for the post chain:
+ *	*bloom			light bleeding around bright areas. The scene is filtered down a pyramid of bloomLevels targets (half to 1/32 of
+ *					the frame) and back up, every level adding its blurred copy onto the next bigger one. The pyramid gives a wide,
+ *					smooth glow from small filters: 13 taps down (no texel is skipped, so nothing shimmers), a 3 x 3 tent up.
+ *	*tonemapping	exposure, then a filmic curve (ACES fitted) maps the open range onto 0..1 with a soft shoulder instead of a clip
+ *	*grading		a 3D lookup table (lutSize^3) from display colour to graded colour, any per colour adjustment an artist makes
+ *					(contrast, tint, saturation curves) for the cost of one filtered lookup
+ *
+ * The passes are laid out for bandwidth, which is what full screen passes are bound by:
+ *	*the prefilter (threshold and firefly filter) is fused into the first downsample, the scene is read once for bloom at half size
+ *	*the upsample adds onto the level's downsample by blending (GL_ONE, GL_ONE, Load) instead of writing a combined copy
+ *	*bloom, exposure, tonemapping, sRGB encoding, grading and dithering are one pass that reads the scene once and draws straight into
+ *	 the window, nothing full size is written but the window (no blit at the end)
+ *	*the bloom targets are half resolution and smaller, the levels below the half size one add up to a third of its pixels
+ * Per frame that is one full size read, one half size write and a pyramid of small passes. The render graph times every pass with the
+ * GPU timer (GpuTimer::report at exit), that is where the cost of the chain shows.
+ *
+ * The MSAA scene is resolved by glBlitFramebuffer before the chain, averaging HDR samples: an edge between a very bright and a dark
+ * surface stays harder than it would with a tonemapped resolve.
+ *
+ *	PostChain post;
+ *	post.create(pipelines, prefilterProgram, downsampleProgram, upsampleProgram, tonemapProgram);
+ *	post.addPasses(graph, hdrScene);	// after the passes that draw hdrScene, then compile the graph
+ *	... per frame: post.setWindowSize(w, h); post.fillBlock(postBlock) into the Post uniform block, graph.execute() ...
+ */
+
+#include "gl_api.h"
+#include "pipeline_state.h"
+#include "render_graph.h"
+#include "uniform_buffer.h"
+
+// texture units of the post passes' samplers
+enum class PostTextureUnit : GLuint
+{
+	Source = 0,		// the level or scene a pass filters
+	Bloom = 1,		// the bloom pyramid's largest level, for the final pass
+	GradingLut = 2
+};
+
+struct PostSettings
+{
+	float bloomThreshold = 1.0f;	// scene brightness where bloom starts
+	float bloomKnee = 0.5f;			// width of the soft ramp around the threshold
+	float bloomIntensity = 0.05f;	// of the summed pyramid added onto the scene
+	float bloomRadius = 1.0f;		// of the upsample tent, in texels of the smaller level
+	float exposure = 1.0f;
+};
+
+class PostChain
+{
+public:
+	static const int bloomLevels = 5;		// half to 1/32 of the frame
+	static const int lutSize = 16;
+	static const int maxGraphs = 4;			// graphs the chain can be added to
+
+	PostChain() = default;
+	~PostChain();
+
+	PostChain(const PostChain&) = delete;
+	PostChain& operator=(const PostChain&) = delete;
+
+	// the pipelines of the passes and the grading LUT, the prefilter program is the downsample with FEATURE_BLOOM_PREFILTER
+	bool create(PipelineCache& pipelines, GLuint prefilterProgram, GLuint downsampleProgram, GLuint upsampleProgram, GLuint tonemapProgram);
+	void destroy();
+
+	// the chain's passes after the ones drawing hdrScene (a sampled colour target), the last one draws into the window
+	bool addPasses(RenderGraph& graph, RenderGraphResource hdrScene);
+	void setWindowSize(int width, int height);
+	void fillBlock(PostBlock* block) const;
+
+	PostSettings settings;
+
+private:
+	struct Step
+	{
+		const PostChain* chain;
+		PipelineHandle pipeline;
+		RenderGraphResource source;
+		RenderGraphResource bloom;	// the final pass only
+	};
+
+	static void drawStep(const RenderGraph& graph, void* user);
+	static void drawFinal(const RenderGraph& graph, void* user);
+
+	PipelineCache* pipelines = nullptr;
+	PipelineHandle prefilter = 0, downsample = 0, upsample = 0, tonemap = 0;
+	GLuint gradingLut = 0;
+	int windowWidth = 0, windowHeight = 0;
+	Step steps[maxGraphs][2 * bloomLevels] = {};	// per graph: the downsamples, the upsamples and the final pass
+	int graphCount = 0;
+};
+
+#endif
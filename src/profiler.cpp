@@ -0,0 +1,128 @@
+/*
+ *	CPU profiler, see profiler.h
+ */
+
+#include "profiler.h"
+
+#include <chrono>
+#include <mutex>
+
+namespace
+{
+	typedef std::chrono::steady_clock Clock;
+
+	const int maxDepth = 32;
+
+	// open scopes of one thread
+	struct ScopeStack
+	{
+		const char* names[maxDepth];
+		Clock::time_point starts[maxDepth];
+		int depth = 0;
+	};
+	thread_local ScopeStack stack;
+
+	// scopes of the current frame, written by every thread that closes a scope
+	std::mutex frameMutex;
+	ProfileScopeStats current[Profiler::maxScopes];
+	int currentCount = 0;
+	ProfileScopeStats finished[Profiler::maxScopes];
+	int finishedCount = 0;
+
+	Clock::time_point frameStart;
+	double frameMilliseconds = 0.0;
+
+	void record(const char* name, double milliseconds)
+	{
+		std::lock_guard<std::mutex> lock(frameMutex);
+		for (int i = 0; i < currentCount; i++)
+		{
+			if (current[i].name == name)
+			{
+				current[i].milliseconds += milliseconds;
+				current[i].calls++;
+				return;
+			}
+		}
+		if (currentCount < Profiler::maxScopes)
+		{
+			ProfileScopeStats& entry = current[currentCount++];
+			entry.name = name;
+			entry.milliseconds = milliseconds;
+			entry.calls = 1;
+		}
+	}
+}
+
+namespace Profiler
+{
+	void beginFrame()
+	{
+		frameStart = Clock::now();
+	}
+
+	void endFrame()
+	{
+		frameMilliseconds = std::chrono::duration<double, std::milli>(Clock::now() - frameStart).count();
+
+		std::lock_guard<std::mutex> lock(frameMutex);
+		for (int i = 0; i < currentCount; i++)
+		{
+			finished[i] = current[i];
+		}
+		finishedCount = currentCount;
+		currentCount = 0;
+	}
+
+	void push(const char* name)
+	{
+		if (stack.depth < maxDepth)
+		{
+			stack.names[stack.depth] = name;
+			stack.starts[stack.depth] = Clock::now();
+		}
+		stack.depth++;	// counted past maxDepth so pops stay balanced
+	}
+
+	void pop()
+	{
+		if (stack.depth == 0)
+		{
+			return;
+		}
+		stack.depth--;
+		if (stack.depth < maxDepth)
+		{
+			record(stack.names[stack.depth], std::chrono::duration<double, std::milli>(Clock::now() - stack.starts[stack.depth]).count());
+		}
+	}
+
+	const char* currentScope()
+	{
+		if (stack.depth == 0)
+		{
+			return "";
+		}
+		return stack.names[(stack.depth < maxDepth ? stack.depth : maxDepth) - 1];
+	}
+
+	int lastFrame(const ProfileScopeStats** scopes)
+	{
+		*scopes = finished;
+		return finishedCount;
+	}
+
+	double lastFrameMilliseconds()
+	{
+		return frameMilliseconds;
+	}
+
+	void report(std::ostream& out)
+	{
+		out << "PROFILE::FRAME " << frameMilliseconds << " ms\n";
+		for (int i = 0; i < finishedCount; i++)
+		{
+			out << "  " << finished[i].name << ": " << finished[i].milliseconds << " ms (" << finished[i].calls << " calls)\n";
+		}
+	}
+}
@@ -0,0 +1,59 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+/*
+ * NOTES:
+ * Minimal CPU profiler: named scopes timed per frame.
+ *
+ *	{
+ *		PROFILE_SCOPE("Shadows");	// timed until the end of the block
+ *		...
+ *	}
+ *
+ * Scopes nest, every thread has its own stack of open scopes so currentScope() tells what the calling thread is doing right now. That is
+ * what other systems tag their events with (e.g. a driver performance warning arriving in the middle of "Shadows", see gl_debug_output.h).
+ *
+ * Names must be string literals (or live as long as the program), they are stored and compared by pointer. Per frame the time and number
+ * of calls of every scope name is summed in a fixed table, nothing is allocated while profiling.
+ */
+
+#include <ostream>
+
+struct ProfileScopeStats
+{
+	const char* name = nullptr;
+	double milliseconds = 0.0;	// summed over every call this frame
+	int calls = 0;
+};
+
+namespace Profiler
+{
+	const int maxScopes = 64;	// distinct scope names per frame, more are not timed
+
+	void beginFrame();
+	void endFrame();			// the frame's scopes become lastFrame()
+
+	void push(const char* name);
+	void pop();
+	const char* currentScope();	// innermost open scope of the calling thread, "" when none
+
+	int lastFrame(const ProfileScopeStats** scopes);	// scopes of the last finished frame, returns the count
+	double lastFrameMilliseconds();						// beginFrame to endFrame
+	void report(std::ostream& out);
+}
+
+class ProfileScope
+{
+public:
+	explicit ProfileScope(const char* name) { Profiler::push(name); }
+	~ProfileScope() { Profiler::pop(); }
+
+	ProfileScope(const ProfileScope&) = delete;
+	ProfileScope& operator=(const ProfileScope&) = delete;
+};
+
+#define PROFILE_SCOPE_JOIN2(a, b) a##b
+#define PROFILE_SCOPE_JOIN(a, b) PROFILE_SCOPE_JOIN2(a, b)
+#define PROFILE_SCOPE(name) ProfileScope PROFILE_SCOPE_JOIN(profileScope, __LINE__)(name)
+
+#endif
@@ -0,0 +1,598 @@
+/*
+ *	Render graph: pass culling, ordering, transient target lifetimes and aliasing, see render_graph.h
+ */
+
+#include "render_graph.h"
+#include "gl_resources.h"
+#include "gpu_memory.h"
+#include "gpu_timer.h"
+#include "profiler.h"
+
+#include <iostream>
+
+namespace
+{
+	long long attachmentBytes(const RenderTargetDesc& desc, const AttachmentDesc& attachment)
+	{
+		if (attachment.format == GL_NONE)
+		{
+			return 0;
+		}
+		long long image = (long long)desc.width * desc.height * GpuMemory::bytesPerPixel(attachment.format);
+		if (desc.samples == 0)
+		{
+			return image;
+		}
+		return image * desc.samples + (attachment.transient ? 0 : image);	// plus the resolved texture
+	}
+
+	long long targetBytes(const RenderTargetDesc& desc)
+	{
+		long long bytes = attachmentBytes(desc, desc.depthStencil);
+		for (int i = 0; i < maxColorAttachments; i++)
+		{
+			bytes += attachmentBytes(desc, desc.color[i]);
+		}
+		return bytes;
+	}
+
+	GLbitfield clearBits(const RenderTargetDesc& desc)
+	{
+		GLbitfield bits = desc.color[0].format != GL_NONE ? GL_COLOR_BUFFER_BIT : 0;
+		switch (desc.depthStencil.format)
+		{
+		case GL_NONE:
+			break;
+		case GL_DEPTH24_STENCIL8: case GL_DEPTH32F_STENCIL8:
+			bits |= GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT;
+			break;
+		case GL_STENCIL_INDEX8:
+			bits |= GL_STENCIL_BUFFER_BIT;
+			break;
+		default:
+			bits |= GL_DEPTH_BUFFER_BIT;
+			break;
+		}
+		return bits;
+	}
+}
+
+RenderGraph::~RenderGraph()
+{
+	releasePhysicals();
+}
+
+RenderGraphResource RenderGraph::createTarget(const char* name, const RenderTargetDesc& desc, int frameDivisor)
+{
+	Resource resource = {};
+	resource.name = name;
+	resource.desc = desc;
+	resource.frameDivisor = frameDivisor > 1 ? frameDivisor : 1;
+	resource.physical = -1;
+	resources.push_back(resource);
+	compiled = false;
+	return (RenderGraphResource)resources.size();
+}
+
+RenderGraphResource RenderGraph::importTarget(const char* name, RenderTargetHandle target)
+{
+	const RenderTargetDesc* desc = pool.desc(target);
+	if (desc == nullptr)
+	{
+		std::cout << "ERROR::RENDER_GRAPH::UNKNOWN_TARGET " << name << std::endl;
+		return 0;
+	}
+	Resource resource = {};
+	resource.name = name;
+	resource.desc = *desc;
+	resource.imported = target;
+	resource.frameDivisor = 1;
+	resource.physical = -1;
+	resources.push_back(resource);
+	compiled = false;
+	return (RenderGraphResource)resources.size();
+}
+
+void RenderGraph::setImportedTarget(RenderGraphResource resource, RenderTargetHandle target)
+{
+	if (resource == 0 || resource > resources.size() || resources[resource - 1].imported == 0 || pool.desc(target) == nullptr)
+	{
+		std::cout << "ERROR::RENDER_GRAPH::NOT_IMPORTED " << resource << std::endl;
+		return;
+	}
+	resources[resource - 1].imported = target;
+}
+
+RenderGraphPass RenderGraph::addPass(const char* name, RenderPassFunction function, void* user)
+{
+	Pass pass = {};
+	pass.name = name;
+	pass.function = function;
+	pass.user = user;
+	pass.load = RenderGraphLoad::DontCare;
+	pass.clearDepth = 1.0f;
+	passes.push_back(pass);
+	compiled = false;
+	return (RenderGraphPass)passes.size();
+}
+
+void RenderGraph::write(RenderGraphPass pass, RenderGraphResource target, RenderGraphLoad load)
+{
+	if (pass == 0 || pass > passes.size() || target == 0 || target > resources.size())
+	{
+		return;
+	}
+	Pass& p = passes[pass - 1];
+	if (p.write != 0 && p.write != target)
+	{
+		std::cout << "ERROR::RENDER_GRAPH::SECOND_WRITE pass " << p.name << " already draws into " << resources[p.write - 1].name << std::endl;
+		return;
+	}
+	p.write = target;
+	p.load = load;
+	compiled = false;
+}
+
+void RenderGraph::read(RenderGraphPass pass, RenderGraphResource target)
+{
+	if (pass == 0 || pass > passes.size() || target == 0 || target > resources.size())
+	{
+		return;
+	}
+	Pass& p = passes[pass - 1];
+	if (p.readCount == maxPassReads)
+	{
+		std::cout << "ERROR::RENDER_GRAPH::TOO_MANY_READS pass " << p.name << " reads at most " << maxPassReads << " targets" << std::endl;
+		return;
+	}
+	p.reads[p.readCount++] = target;
+	compiled = false;
+}
+
+void RenderGraph::setSideEffect(RenderGraphPass pass)
+{
+	if (pass != 0 && pass <= passes.size())
+	{
+		passes[pass - 1].sideEffect = true;
+		compiled = false;
+	}
+}
+
+void RenderGraph::setClearValues(RenderGraphPass pass, const float color[4], float depth, int stencil)
+{
+	if (pass == 0 || pass > passes.size())
+	{
+		return;
+	}
+	Pass& p = passes[pass - 1];
+	for (int i = 0; i < 4; i++)
+	{
+		p.clearColor[i] = color[i];
+	}
+	p.clearDepth = depth;
+	p.clearStencil = stencil;
+}
+
+void RenderGraph::setFrameSize(int width, int height)
+{
+	if (width != frameWidth || height != frameHeight)
+	{
+		frameWidth = width;
+		frameHeight = height;
+		compiled = false;
+	}
+}
+
+void RenderGraph::clear()
+{
+	releasePhysicals();
+	resources.clear();
+	passes.clear();
+	order.clear();
+	compiled = false;
+	counters = Stats();
+}
+
+bool RenderGraph::compile()
+{
+	releasePhysicals();
+	counters = Stats();
+	compiled = false;
+
+	cull();
+	if (!sort())
+	{
+		std::cout << "ERROR::RENDER_GRAPH::CYCLE the passes' reads and writes depend on each other" << std::endl;
+		return false;
+	}
+
+	// lifetimes, in positions of the final order
+	for (Resource& resource : resources)
+	{
+		resource.firstUse = -1;
+		resource.lastUse = -1;
+		resource.physical = -1;
+	}
+	for (int position = 0; position < (int)order.size(); position++)
+	{
+		const Pass& pass = passes[order[position]];
+		RenderGraphResource used[maxPassReads + 1];
+		int usedCount = 0;
+		if (pass.write != 0)
+		{
+			used[usedCount++] = pass.write;
+		}
+		for (int i = 0; i < pass.readCount; i++)
+		{
+			used[usedCount++] = pass.reads[i];
+		}
+		for (int i = 0; i < usedCount; i++)
+		{
+			Resource& resource = resources[used[i] - 1];
+			if (resource.firstUse < 0)
+			{
+				resource.firstUse = position;
+			}
+			resource.lastUse = position;
+		}
+	}
+
+	for (const Resource& resource : resources)
+	{
+		if (resource.imported == 0 && resource.firstUse >= 0)
+		{
+			RenderTargetDesc desc = frameDesc(resource);
+			if (desc.width <= 0 || desc.height <= 0)
+			{
+				std::cout << "ERROR::RENDER_GRAPH::NO_FRAME_SIZE target " << resource.name << " is frame sized, call setFrameSize first" << std::endl;
+				return false;
+			}
+			counters.transientTargets++;
+			counters.transientBytes += targetBytes(desc);
+		}
+	}
+
+	allocate();
+	for (const Physical& physical : physicals)
+	{
+		if (physical.target == 0)
+		{
+			releasePhysicals();
+			return false;
+		}
+		counters.aliasedBytes += targetBytes(*pool.desc(physical.target));
+	}
+	counters.physicalTargets = (int)physicals.size();
+
+	std::vector<int> declared;
+	for (int i = 0; i < (int)passes.size(); i++)
+	{
+		if (!passes[i].culled)
+		{
+			declared.push_back(i);
+		}
+	}
+	counters.passes = (int)order.size();
+	counters.culledPasses = (int)(passes.size() - order.size());
+	counters.framebufferSwitches = countSwitches(order);
+	counters.framebufferSwitchesUnordered = countSwitches(declared);
+	compiled = true;
+	return true;
+}
+
+void RenderGraph::execute()
+{
+	if (!compiled)
+	{
+		return;
+	}
+
+	// passes into the default framebuffer don't bind it, and creating targets without DSA leaves one of theirs bound
+	GlResources::bindFramebuffer(GL_FRAMEBUFFER, 0);
+	RenderGraphResource bound = 0;
+	RenderTargetHandle boundTarget = 0;
+	for (int index : order)
+	{
+		const Pass& pass = passes[index];
+		if (pass.write != bound)
+		{
+			if (boundTarget != 0)
+			{
+				pool.end(boundTarget);	// resolves and invalidates, binds the default framebuffer
+			}
+			bound = pass.write;
+			boundTarget = target(bound);
+			if (boundTarget != 0)
+			{
+				pool.begin(boundTarget);
+			}
+		}
+		GpuTimer::beginScope(pass.name);	// GPU time of the clear and the pass
+		if (boundTarget != 0 && pass.load == RenderGraphLoad::Clear)
+		{
+			clearTarget(pass);
+		}
+
+		ProfileScope scope(pass.name);
+		pass.function(*this, pass.user);
+		GpuTimer::endScope();
+	}
+	if (boundTarget != 0)
+	{
+		pool.end(boundTarget);
+	}
+}
+
+RenderTargetHandle RenderGraph::target(RenderGraphResource resource) const
+{
+	if (resource == 0 || resource > resources.size())
+	{
+		return 0;
+	}
+	const Resource& r = resources[resource - 1];
+	if (r.imported != 0)
+	{
+		return r.imported;
+	}
+	return r.physical >= 0 ? physicals[r.physical].target : 0;
+}
+
+GLuint RenderGraph::texture(RenderGraphResource resource, int index) const
+{
+	return pool.texture(target(resource), index);
+}
+
+GLuint RenderGraph::depthTexture(RenderGraphResource resource) const
+{
+	return pool.depthTexture(target(resource));
+}
+
+void RenderGraph::report(std::ostream& out) const
+{
+	if (!compiled)
+	{
+		return;
+	}
+	out << "Render graph: " << counters.passes << " passes (" << counters.culledPasses << " culled), " << counters.framebufferSwitches
+		<< " framebuffer switches (" << counters.framebufferSwitchesUnordered << " in declaration order), " << counters.transientTargets
+		<< " transient targets in " << counters.physicalTargets << " physical, " << counters.aliasedBytes / 1024 << " kB instead of "
+		<< counters.transientBytes / 1024 << " kB\n";
+	for (int position = 0; position < (int)order.size(); position++)
+	{
+		const Pass& pass = passes[order[position]];
+		out << "\t" << position << " " << pass.name;
+		if (pass.write != 0)
+		{
+			out << " -> " << resources[pass.write - 1].name;
+		}
+		for (int i = 0; i < pass.readCount; i++)
+		{
+			out << (i == 0 ? " reads " : ", ") << resources[pass.reads[i] - 1].name;
+		}
+		out << "\n";
+	}
+	for (const Pass& pass : passes)
+	{
+		if (pass.culled)
+		{
+			out << "\tculled " << pass.name << "\n";
+		}
+	}
+	for (const Resource& resource : resources)
+	{
+		if (resource.imported == 0 && resource.firstUse >= 0)
+		{
+			out << "\t" << resource.name << ": passes " << resource.firstUse << " to " << resource.lastUse << ", physical target "
+				<< resource.physical << "\n";
+		}
+	}
+}
+
+RenderTargetDesc RenderGraph::frameDesc(const Resource& resource) const
+{
+	RenderTargetDesc sized = resource.desc;
+	int divisor = resource.frameDivisor;
+	if (sized.width == 0)
+	{
+		sized.width = (frameWidth + divisor - 1) / divisor;
+	}
+	if (sized.height == 0)
+	{
+		sized.height = (frameHeight + divisor - 1) / divisor;
+	}
+	return sized;
+}
+
+void RenderGraph::cull()
+{
+	// backwards from the end of the frame: a resource is needed when a later kept pass reads it (or it is imported), a pass is kept when
+	// it writes something needed. A Clear or DontCare write overwrites everything, so earlier writers of that resource aren't needed
+	// unless something in between read it.
+	std::vector<bool> needed(resources.size());
+	for (size_t i = 0; i < resources.size(); i++)
+	{
+		needed[i] = resources[i].imported != 0;
+	}
+	for (int i = (int)passes.size() - 1; i >= 0; i--)
+	{
+		Pass& pass = passes[i];
+		pass.culled = !(pass.sideEffect || (pass.write != 0 && needed[pass.write - 1]));
+		if (pass.culled)
+		{
+			continue;
+		}
+		if (pass.write != 0)
+		{
+			needed[pass.write - 1] = pass.load == RenderGraphLoad::Load;
+		}
+		for (int r = 0; r < pass.readCount; r++)
+		{
+			needed[pass.reads[r] - 1] = true;
+		}
+	}
+}
+
+bool RenderGraph::sort()
+{
+	// dependencies between the kept passes, from declaration order: read after write, write after write and write after read
+	size_t count = passes.size();
+	std::vector<std::vector<int>> dependents(count);
+	std::vector<int> waitingFor(count, 0);
+	std::vector<int> lastWriter(resources.size(), -1);
+	std::vector<std::vector<int>> readers(resources.size());
+	for (int i = 0; i < (int)count; i++)
+	{
+		const Pass& pass = passes[i];
+		if (pass.culled)
+		{
+			continue;
+		}
+		for (int r = 0; r < pass.readCount; r++)
+		{
+			int resource = (int)pass.reads[r] - 1;
+			if (lastWriter[resource] >= 0)
+			{
+				dependents[lastWriter[resource]].push_back(i);
+				waitingFor[i]++;
+			}
+			readers[resource].push_back(i);
+		}
+		if (pass.write != 0)
+		{
+			int resource = (int)pass.write - 1;
+			if (lastWriter[resource] >= 0)
+			{
+				dependents[lastWriter[resource]].push_back(i);
+				waitingFor[i]++;
+			}
+			for (int reader : readers[resource])
+			{
+				if (reader != i)
+				{
+					dependents[reader].push_back(i);
+					waitingFor[i]++;
+				}
+			}
+			readers[resource].clear();
+			lastWriter[resource] = i;
+		}
+	}
+
+	// Kahn's algorithm: of the passes whose dependencies ran, prefer one drawing into the bound target, otherwise the first declared
+	order.clear();
+	std::vector<bool> done(count, false);
+	size_t kept = 0;
+	for (const Pass& pass : passes)
+	{
+		kept += pass.culled ? 0 : 1;
+	}
+	RenderGraphResource bound = 0;
+	while (order.size() < kept)
+	{
+		int next = -1;
+		for (int i = 0; i < (int)count; i++)
+		{
+			if (passes[i].culled || done[i] || waitingFor[i] > 0)
+			{
+				continue;
+			}
+			if (next < 0)
+			{
+				next = i;
+			}
+			if (bound != 0 && passes[i].write == bound)
+			{
+				next = i;
+				break;
+			}
+		}
+		if (next < 0)
+		{
+			return false;
+		}
+		done[next] = true;
+		order.push_back(next);
+		bound = passes[next].write;
+		for (int dependent : dependents[next])
+		{
+			waitingFor[dependent]--;
+		}
+	}
+	return true;
+}
+
+void RenderGraph::allocate()
+{
+	// transient resources by first use, each takes the first physical target of the same description that is free by then
+	physicals.clear();
+	for (int position = 0; position < (int)order.size(); position++)
+	{
+		for (size_t r = 0; r < resources.size(); r++)
+		{
+			Resource& resource = resources[r];
+			if (resource.imported != 0 || resource.firstUse != position)
+			{
+				continue;
+			}
+			RenderTargetDesc desc = frameDesc(resource);
+			for (int p = 0; p < (int)physicals.size() && resource.physical < 0; p++)
+			{
+				Physical& physical = physicals[p];
+				if (physical.target != 0 && physical.freeFrom < position && *pool.desc(physical.target) == desc)
+				{
+					resource.physical = p;
+					physical.freeFrom = resource.lastUse;
+				}
+			}
+			if (resource.physical < 0)
+			{
+				Physical physical;
+				physical.target = pool.acquire(desc);
+				physical.freeFrom = resource.lastUse;
+				resource.physical = (int)physicals.size();
+				physicals.push_back(physical);
+			}
+		}
+	}
+}
+
+void RenderGraph::releasePhysicals()
+{
+	for (const Physical& physical : physicals)
+	{
+		pool.release(physical.target);
+	}
+	physicals.clear();
+	for (Resource& resource : resources)
+	{
+		resource.physical = -1;
+	}
+}
+
+int RenderGraph::countSwitches(const std::vector<int>& passOrder) const
+{
+	int switches = 0;
+	RenderGraphResource bound = 0;
+	for (int index : passOrder)
+	{
+		if (passes[index].write != bound)
+		{
+			switches++;
+			bound = passes[index].write;
+		}
+	}
+	return switches;
+}
+
+void RenderGraph::clearTarget(const Pass& pass) const
+{
+	// glClear follows the write masks, a pipeline that turned off depth writes (glDepthMask) would leave the depth buffer as it was.
+	// The pipeline cache opens them (it knows what it set, nothing is read back from OpenGL, which can stall) and the pass's first bind
+	// closes them again. The stencil mask is never changed, it is OpenGL's default of all bits.
+	const RenderTargetDesc* desc = pool.desc(target(pass.write));
+	pipelines.openWriteMasks();
+	glClearColor(pass.clearColor[0], pass.clearColor[1], pass.clearColor[2], pass.clearColor[3]);
+	glClearDepth(pass.clearDepth);
+	glClearStencil(pass.clearStencil);
+	glClear(clearBits(*desc));
+}
@@ -0,0 +1,165 @@
+#ifndef RENDER_GRAPH_H
+#define RENDER_GRAPH_H
+
+/*
+ * NOTES:
+ * Render graph (frame graph): the passes of a frame declared up front with the render targets they read and write, so the frame can be
+ * planned as a whole instead of one glBindFramebuffer at a time.
+ *
+ * Every pass names the target it draws into (write) and the targets whose textures it samples (read). Targets are either transient,
+ * created by the graph for this frame only (createTarget), or imported, owned by someone else and still needed after the frame
+ * (importTarget). Passes that draw into no target but do something visible (present to the window, read back) are marked side effect.
+ *
+ * compile() then works out, once:
+ *	*culling		walking back from the imported targets and side effect passes, a pass whose output nobody reads is dropped,
+ *					together with everything only it needed. Debug views and half removed effects cost nothing when unused.
+ *	*ordering		passes keep their dependencies (read after write, write after read, write after write) but among the passes that
+ *					are ready, one that draws into the target already bound goes first. Every framebuffer switch is a resolve, a flush
+ *					of the tile memory on mobile GPUs and a full pipeline drain on some drivers, so fewer is better.
+ *	*lifetimes		each transient target lives from the first to the last pass that uses it in the final order
+ *	*aliasing		transient targets whose lifetimes don't overlap share one physical target. OpenGL can't place two textures of
+ *					different formats in the same memory (there are no heaps like in Vulkan or D3D12), so only targets with the same
+ *					description share, e.g. the ping-pong buffers of a blur or two effects' intermediates of the same size.
+ *
+ * Physical targets are acquired from the RenderTargetPool at compile() and kept until the next compile(), execute() only binds them
+ * and calls the passes, it doesn't allocate and is fine to run every frame. Compile again when the passes change or setFrameSize()
+ * changed the size of frame sized targets (width/height 0 in their description).
+ *
+ * A write says what happens to the previous contents:
+ *	*Clear			cleared to the pass's clear values when the pass starts
+ *	*Load			kept, the pass draws over the previous pass's output (so that pass is needed too)
+ *	*DontCare		undefined, the pass covers every pixel anyway
+ *
+ *	RenderGraphResource scene = graph.createTarget("Scene", sceneDesc);
+ *	RenderGraphPass draw = graph.addPass("Scene", drawScene, &frameData);
+ *	graph.write(draw, scene, RenderGraphLoad::Clear);
+ *	RenderGraphPass present = graph.addPass("Present", presentScene, &frameData);
+ *	graph.read(present, scene);
+ *	graph.setSideEffect(present);
+ *	graph.compile();
+ *	...
+ *	graph.execute();	// per frame
+ *
+ * Pass and resource names are kept as pointers (they name the passes' profiler and GPU timer scopes), pass string literals.
+ */
+
+#include "pipeline_state.h"
+#include "render_target.h"
+
+#include <ostream>
+#include <vector>
+
+typedef unsigned int RenderGraphResource;	// 0 is no resource
+typedef unsigned int RenderGraphPass;		// 0 is no pass
+
+enum class RenderGraphLoad
+{
+	Clear,
+	Load,
+	DontCare
+};
+
+class RenderGraph;
+typedef void (*RenderPassFunction)(const RenderGraph& graph, void* user);
+
+class RenderGraph
+{
+public:
+	static const int maxPassReads = 8;
+
+	// the pipeline cache opens the write masks for the clears of Clear writes
+	RenderGraph(RenderTargetPool& targets, PipelineCache& pipelineCache) : pool(targets), pipelines(pipelineCache) {}
+	~RenderGraph();
+
+	RenderGraph(const RenderGraph&) = delete;
+	RenderGraph& operator=(const RenderGraph&) = delete;
+
+	// declaring, in submission order
+	// width/height 0 = frame size divided by frameDivisor (rounded up), e.g. 2 for a half resolution effect
+	RenderGraphResource createTarget(const char* name, const RenderTargetDesc& desc, int frameDivisor = 1);
+	RenderGraphResource importTarget(const char* name, RenderTargetHandle target);
+	// another target behind an imported resource, e.g. ping-pong buffers swapped every frame, without compiling again
+	void setImportedTarget(RenderGraphResource resource, RenderTargetHandle target);
+	RenderGraphPass addPass(const char* name, RenderPassFunction function, void* user);
+	void write(RenderGraphPass pass, RenderGraphResource target, RenderGraphLoad load);	// one target per pass
+	void read(RenderGraphPass pass, RenderGraphResource target);
+	void setSideEffect(RenderGraphPass pass);		// never culled
+	void setClearValues(RenderGraphPass pass, const float color[4], float depth, int stencil);
+	void setFrameSize(int width, int height);
+	void clear();									// forget every pass and resource, releases the physical targets
+
+	bool compile();									// false on a dependency cycle or a target the pool couldn't create
+	void execute();									// binds the default framebuffer again at the end
+
+	// for the pass functions
+	RenderTargetHandle target(RenderGraphResource resource) const;	// the physical target, 0 if culled or not compiled
+	GLuint texture(RenderGraphResource resource, int index = 0) const;
+	GLuint depthTexture(RenderGraphResource resource) const;
+
+	struct Stats
+	{
+		int passes = 0;
+		int culledPasses = 0;
+		int transientTargets = 0;		// used by the remaining passes
+		int physicalTargets = 0;		// after aliasing
+		int framebufferSwitches = 0;	// per execute()
+		int framebufferSwitchesUnordered = 0;	// what declaration order would have needed
+		long long transientBytes = 0;	// every transient target on its own
+		long long aliasedBytes = 0;		// what the physical targets take
+	};
+	const Stats& stats() const { return counters; }
+	void report(std::ostream& out) const;	// the compiled order with lifetimes and aliasing
+
+private:
+	struct Resource
+	{
+		const char* name;
+		RenderTargetDesc desc;
+		RenderTargetHandle imported;	// 0 for transient targets
+		int frameDivisor;				// of frame sized targets
+		int physical;					// index into physicals, -1 when not allocated
+		int firstUse, lastUse;			// positions in order, -1 when unused
+	};
+
+	struct Pass
+	{
+		const char* name;
+		RenderPassFunction function;
+		void* user;
+		RenderGraphResource write;
+		RenderGraphLoad load;
+		RenderGraphResource reads[maxPassReads];
+		int readCount;
+		bool sideEffect;
+		bool culled;
+		float clearColor[4];
+		float clearDepth;
+		int clearStencil;
+	};
+
+	struct Physical
+	{
+		RenderTargetHandle target;
+		int freeFrom;		// position in order after which it can be reused
+	};
+
+	RenderTargetDesc frameDesc(const Resource& resource) const;
+	void cull();
+	bool sort();
+	void allocate();
+	void releasePhysicals();
+	int countSwitches(const std::vector<int>& passOrder) const;
+	void clearTarget(const Pass& pass) const;
+
+	RenderTargetPool& pool;
+	PipelineCache& pipelines;
+	std::vector<Resource> resources;	// handle - 1
+	std::vector<Pass> passes;			// handle - 1
+	std::vector<int> order;				// compiled execution order, pass indices
+	std::vector<Physical> physicals;
+	int frameWidth = 0, frameHeight = 0;
+	bool compiled = false;
+	Stats counters;
+};
+
+#endif
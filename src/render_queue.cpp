@@ -0,0 +1,148 @@
+/*
+ *	Render queue: draw sorting for early-Z and the depth prepass, see render_queue.h
+ */
+
+#include "render_queue.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+	// the float's bits as an unsigned value that sorts like the float: flip every bit of negative numbers, only the sign of positive ones
+	unsigned int depthBits(float depth)
+	{
+		unsigned int bits;
+		std::memcpy(&bits, &depth, sizeof(bits));
+		return (bits & 0x80000000u) != 0 ? ~bits : bits | 0x80000000u;
+	}
+}
+
+DrawMaterial createMaterial(PipelineCache& pipelines, const PipelineDesc& color, GLuint depthProgram, GLuint overdrawProgram,
+	GLuint gbufferProgram)
+{
+	DrawMaterial material;
+
+	PipelineDesc desc = color;
+	desc.depth.test = true;
+	desc.depth.write = true;
+	desc.depth.compare = GL_LESS;
+	material.pipelines[(int)RenderQueuePass::Color] = pipelines.create(desc);
+
+	desc.depth.write = false;	// the prepass wrote exactly these depths
+	desc.depth.compare = GL_EQUAL;
+	material.pipelines[(int)RenderQueuePass::ColorDepthEqual] = pipelines.create(desc);
+
+	if (depthProgram != 0)
+	{
+		desc = color;
+		desc.program = depthProgram;
+		desc.blend = BlendState::opaque();
+		for (int i = 0; i < 4; i++)
+		{
+			desc.blend.colorWrite[i] = GL_FALSE;
+		}
+		desc.depth.test = true;
+		desc.depth.write = true;
+		desc.depth.compare = GL_LESS;
+		material.pipelines[(int)RenderQueuePass::DepthOnly] = pipelines.create(desc);
+
+		desc.raster.depthBiasSlope = 2.0f;		// in units of the depth slope of the polygon
+		desc.raster.depthBiasConstant = 2.0f;	// in units of the depth buffer's smallest step
+		material.pipelines[(int)RenderQueuePass::Shadow] = pipelines.create(desc);
+	}
+	if (overdrawProgram != 0)
+	{
+		desc = color;
+		desc.program = overdrawProgram;
+		desc.blend = BlendState::additive();
+		desc.depth.test = false;
+		desc.depth.write = false;
+		material.pipelines[(int)RenderQueuePass::Overdraw] = pipelines.create(desc);
+	}
+	if (gbufferProgram != 0)
+	{
+		desc = color;
+		desc.program = gbufferProgram;
+		desc.blend = BlendState::opaque();	// the G-buffer holds one surface per pixel, nothing blends into it
+		desc.depth.test = true;
+		desc.depth.write = true;
+		desc.depth.compare = GL_LESS;
+		material.pipelines[(int)RenderQueuePass::GBuffer] = pipelines.create(desc);
+	}
+	return material;
+}
+
+void RenderQueue::reserve(int count)
+{
+	items.reserve(count);
+	keys.reserve(count);
+}
+
+void RenderQueue::clear()
+{
+	items.clear();
+	keys.clear();
+	counters = Stats();
+}
+
+void RenderQueue::submit(const DrawItem& item)
+{
+	if (item.material == nullptr || (int)items.size() == maxItems)
+	{
+		return;
+	}
+	items.push_back(item);
+	counters.submitted++;
+}
+
+void RenderQueue::sort(RenderQueueOrder order, RenderQueuePass pass)
+{
+	// key: 24 bits of depth, 16 bits of pipeline and the 24 bit item index, the first two swapped for ByState. The top 24 bits of
+	// the sortable float are its sign, exponent and 15 bits of mantissa, plenty to order whole objects.
+	keys.clear();
+	for (size_t i = 0; i < items.size(); i++)
+	{
+		const DrawItem& item = items[i];
+		unsigned long long depth = depthBits(item.depth) >> 8;
+		if (order == RenderQueueOrder::BackToFront)
+		{
+			depth = ~depth & 0xFFFFFFull;
+		}
+		unsigned long long pipeline = item.material->pipelines[(int)pass] & 0xFFFFu;
+		unsigned long long key = order == RenderQueueOrder::ByState ? (pipeline << 48) | (depth << 24) : (depth << 40) | (pipeline << 24);
+		keys.push_back(key | i);
+	}
+	std::sort(keys.begin(), keys.end());
+}
+
+void RenderQueue::draw(RenderQueuePass pass, PipelineCache& pipelines, UniformStream& uniforms)
+{
+	if (keys.size() != items.size())
+	{
+		std::cout << "ERROR::RENDER_QUEUE::NOT_SORTED sort() after the last submit()" << std::endl;
+		return;
+	}
+
+	PipelineHandle bound = 0;
+	for (unsigned long long key : keys)
+	{
+		const DrawItem& item = items[key & 0xFFFFFFu];
+		PipelineHandle pipeline = item.material->pipelines[(int)pass];
+		if (pipeline == 0)
+		{
+			continue;
+		}
+		if (pipeline != bound)
+		{
+			pipelines.bind(pipeline);
+			bound = pipeline;
+			counters.pipelineChanges++;
+		}
+		pipelines.setVertexBuffer(item.vertexBuffer);
+		uniforms.bind(UniformBinding::PerDraw, item.drawBlock);
+		glDrawArrays(item.mode, item.first, item.count);
+		counters.drawn++;
+	}
+}
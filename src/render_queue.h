@@ -0,0 +1,112 @@
+#ifndef RENDER_QUEUE_H
+#define RENDER_QUEUE_H
+
+/*
+ * NOTES:
+ * Render queue: the frame's draws collected first, then sorted and submitted per pass.
+ *
+ * Drawing in the order the scene happens to be traversed leaves two things to chance: how often the pipeline changes, and how many
+ * fragments get shaded only to be covered by something nearer later (overdraw). The GPU tests depth before running the fragment shader
+ * (early-Z) whenever the shader doesn't write gl_FragDepth or discard, so a fragment behind what is already in the depth buffer costs
+ * next to nothing. Drawn front to back, most hidden fragments are rejected that way; drawn back to front, every layer is shaded.
+ *
+ * Each submitted DrawItem gets a 64 bit sort key and sort() orders the keys (the items don't move):
+ *	*FrontToBack	depth first, then pipeline: the most early-Z rejection, for opaque draws
+ *	*BackToFront	farthest first, for blended draws that must be composited in order
+ *	*ByState		pipeline first, then depth: fewest state changes, for passes where overdraw is already gone
+ *
+ * Depth prepass: pass DepthOnly draws the opaque items with colour writes masked off and a fragment shader that does nothing, which
+ * fills the depth buffer cheaply. The colour pass then tests with GL_EQUAL and doesn't write depth, so every pixel is shaded exactly
+ * once, by the nearest surface, whatever the order. Worth it when the fragment shader is expensive and the scene has depth complexity,
+ * not for a handful of cheap draws (every vertex is transformed twice). The vertex shader declares gl_Position invariant so both passes
+ * produce bit identical depths.
+ *
+ * Pass GBuffer is the first half of deferred shading: the surfaces (albedo, normal, roughness, metalness) go into the G-buffer, front to
+ * back like any depth tested pass, and are lit later per pixel.
+ *
+ * Pass Shadow draws the casters into a shadow map, depth only with the depth program like the prepass, plus a slope scaled depth bias
+ * (glPolygonOffset) so a lit surface doesn't shadow itself where its depth and the map's disagree by a rounding step.
+ *
+ * Every item points at a DrawMaterial holding one pipeline per pass (0 = not drawn in that pass), made by createMaterial() from the
+ * colour pipeline's description. Items and keys live in vectors reserved up front, submitting and sorting don't allocate after that.
+ *
+ *	queue.clear();
+ *	queue.submit(item);					// per visible object
+ *	queue.sort(RenderQueueOrder::FrontToBack, RenderQueuePass::DepthOnly);
+ *	queue.draw(RenderQueuePass::DepthOnly, pipelines, uniforms);
+ *	queue.sort(RenderQueueOrder::ByState, RenderQueuePass::ColorDepthEqual);
+ *	queue.draw(RenderQueuePass::ColorDepthEqual, pipelines, uniforms);
+ */
+
+#include "pipeline_state.h"
+#include "uniform_buffer.h"
+
+#include <vector>
+
+enum class RenderQueuePass
+{
+	DepthOnly,			// depth prepass: depth test and write, no colour
+	Color,				// depth test GL_LESS and write, without a prepass
+	ColorDepthEqual,	// after the prepass: GL_EQUAL, no depth write
+	Overdraw,			// overdraw view: no depth test, additive blending
+	GBuffer,			// deferred shading: the surface into the G-buffer, depth test GL_LESS and write
+	Shadow,				// shadow map: like DepthOnly with a depth bias
+	Count
+};
+
+enum class RenderQueueOrder
+{
+	FrontToBack,
+	BackToFront,
+	ByState
+};
+
+struct DrawMaterial
+{
+	PipelineHandle pipelines[(int)RenderQueuePass::Count] = {};
+};
+
+struct DrawItem
+{
+	const DrawMaterial* material = nullptr;
+	GLuint vertexBuffer = 0;
+	UniformAllocation drawBlock;	// PerDraw
+	GLenum mode = GL_TRIANGLES;
+	GLint first = 0;
+	GLsizei count = 0;
+	float depth = 0.0f;				// distance along the view direction, smaller is nearer
+};
+
+// the pipelines of every pass from the colour pass's description (its depth and blend state are replaced per pass), depthProgram draws
+// the prepass and the shadow maps, overdrawProgram the overdraw view and gbufferProgram the G-buffer, 0 leaves the item out of that pass
+DrawMaterial createMaterial(PipelineCache& pipelines, const PipelineDesc& color, GLuint depthProgram, GLuint overdrawProgram,
+	GLuint gbufferProgram = 0);
+
+class RenderQueue
+{
+public:
+	static const int maxItems = 1 << 24;	// the item index is the low 24 bits of the key
+
+	void reserve(int items);
+	void clear();
+	void submit(const DrawItem& item);
+	void sort(RenderQueueOrder order, RenderQueuePass pass);	// pass picks the pipeline that goes into the key
+	void draw(RenderQueuePass pass, PipelineCache& pipelines, UniformStream& uniforms);	// in the order of the last sort()
+
+	int size() const { return (int)items.size(); }
+
+	struct Stats
+	{
+		int submitted = 0;			// since clear()
+		int drawn = 0;
+		int pipelineChanges = 0;	// binds of a different pipeline by draw()
+	};
+	const Stats& stats() const { return counters; }
+
+private:
+	std::vector<DrawItem> items;
+	std::vector<unsigned long long> keys;	// sort key, item index in the low bits
+	Stats counters;
+};
+
+#endif
@@ -0,0 +1,568 @@
+/*
+ *	Offscreen render targets, see render_target.h
+ */
+
+#include "render_target.h"
+#include "gl_resources.h"
+#include "gpu_memory.h"
+
+#include <iostream>
+
+namespace
+{
+	bool isDepthStencilFormat(GLenum format)
+	{
+		switch (format)
+		{
+		case GL_DEPTH_COMPONENT16: case GL_DEPTH_COMPONENT24: case GL_DEPTH_COMPONENT32: case GL_DEPTH_COMPONENT32F:
+		case GL_DEPTH24_STENCIL8: case GL_DEPTH32F_STENCIL8: case GL_STENCIL_INDEX8:
+			return true;
+		}
+		return false;
+	}
+
+	GLenum depthStencilAttachment(GLenum format)
+	{
+		switch (format)
+		{
+		case GL_DEPTH24_STENCIL8: case GL_DEPTH32F_STENCIL8:
+			return GL_DEPTH_STENCIL_ATTACHMENT;
+		case GL_STENCIL_INDEX8:
+			return GL_STENCIL_ATTACHMENT;
+		}
+		return GL_DEPTH_ATTACHMENT;
+	}
+
+	GLbitfield depthStencilBits(GLenum format)
+	{
+		switch (format)
+		{
+		case GL_DEPTH24_STENCIL8: case GL_DEPTH32F_STENCIL8:
+			return GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT;
+		case GL_STENCIL_INDEX8:
+			return GL_STENCIL_BUFFER_BIT;
+		}
+		return GL_DEPTH_BUFFER_BIT;
+	}
+
+	// format and type of the (empty) upload, glTexImage2D checks them against the internal format even without data
+	void uploadFormat(GLenum internalFormat, GLenum* format, GLenum* type)
+	{
+		switch (internalFormat)
+		{
+		case GL_DEPTH24_STENCIL8:
+			*format = GL_DEPTH_STENCIL; *type = GL_UNSIGNED_INT_24_8;
+			return;
+		case GL_DEPTH32F_STENCIL8:
+			*format = GL_DEPTH_STENCIL; *type = GL_FLOAT_32_UNSIGNED_INT_24_8_REV;
+			return;
+		case GL_DEPTH_COMPONENT16: case GL_DEPTH_COMPONENT24: case GL_DEPTH_COMPONENT32: case GL_DEPTH_COMPONENT32F:
+			*format = GL_DEPTH_COMPONENT; *type = GL_FLOAT;
+			return;
+		case GL_STENCIL_INDEX8:
+			*format = GL_STENCIL_INDEX; *type = GL_UNSIGNED_BYTE;
+			return;
+		case GL_R8UI: case GL_R16UI: case GL_R32UI: case GL_RG8UI: case GL_RG16UI: case GL_RG32UI: case GL_RGBA8UI: case GL_RGBA16UI:
+		case GL_RGBA32UI:
+			*format = GL_RGBA_INTEGER; *type = GL_UNSIGNED_INT;
+			return;
+		case GL_R8I: case GL_R16I: case GL_R32I: case GL_RG8I: case GL_RG16I: case GL_RG32I: case GL_RGBA8I: case GL_RGBA16I: case GL_RGBA32I:
+			*format = GL_RGBA_INTEGER; *type = GL_INT;
+			return;
+		}
+		*format = GL_RGBA;
+		*type = GL_FLOAT;
+	}
+
+	// a texture drawn into directly, otherwise a renderbuffer (multisampled or transient)
+	bool drawsIntoTexture(const RenderTargetDesc& desc, const AttachmentDesc& attachment)
+	{
+		return desc.samples == 0 && !attachment.transient;
+	}
+
+	GLuint createImage(const RenderTargetDesc& desc, const AttachmentDesc& attachment, int samples)
+	{
+		if (samples == 0 && !attachment.transient)
+		{
+			GLenum format, type;
+			uploadFormat(attachment.format, &format, &type);
+			GLuint texture = GpuMemory::createTexture2D(GpuMemoryCategory::RenderTarget, attachment.format, desc.width, desc.height, 1, format,
+				type, NULL);
+			// sampled with plain texture() by the next pass, depth textures included (no shadow comparison)
+			GlResources::setTextureSampling(texture, isDepthStencilFormat(attachment.format) ? GL_NEAREST : GL_LINEAR, GL_CLAMP_TO_EDGE);
+			return texture;
+		}
+		return GpuMemory::createRenderbuffer(GpuMemoryCategory::RenderTarget, attachment.format, desc.width, desc.height, samples);
+	}
+
+	void attach(GLuint framebuffer, GLenum attachmentPoint, GLuint image, bool texture)
+	{
+		if (texture)
+		{
+			GlResources::framebufferTexture(framebuffer, attachmentPoint, image);
+		}
+		else
+		{
+			GlResources::framebufferRenderbuffer(framebuffer, attachmentPoint, image);
+		}
+	}
+
+	bool complete(GLuint framebuffer)
+	{
+		GLenum status = GlResources::checkFramebuffer(framebuffer);
+		if (status != GL_FRAMEBUFFER_COMPLETE)
+		{
+			std::cout << "ERROR::RENDER_TARGET::INCOMPLETE_FRAMEBUFFER status 0x" << std::hex << status << std::dec << std::endl;
+			return false;
+		}
+		return true;
+	}
+}
+
+RenderTargetDesc& RenderTargetDesc::addColor(GLenum format, bool transient)
+{
+	for (int i = 0; i < maxColorAttachments; i++)
+	{
+		if (color[i].format == GL_NONE)
+		{
+			color[i].format = format;
+			color[i].transient = transient;
+			return *this;
+		}
+	}
+	std::cout << "ERROR::RENDER_TARGET::TOO_MANY_COLOR_ATTACHMENTS at most " << maxColorAttachments << std::endl;
+	return *this;
+}
+
+RenderTargetDesc& RenderTargetDesc::setDepthStencil(GLenum format, bool transient)
+{
+	depthStencil.format = format;
+	depthStencil.transient = transient;
+	return *this;
+}
+
+bool RenderTargetDesc::operator==(const RenderTargetDesc& other) const
+{
+	if (width != other.width || height != other.height || samples != other.samples)
+	{
+		return false;
+	}
+	for (int i = 0; i < maxColorAttachments; i++)
+	{
+		if (color[i].format != other.color[i].format || color[i].transient != other.color[i].transient)
+		{
+			return false;
+		}
+	}
+	return depthStencil.format == other.depthStencil.format && depthStencil.transient == other.depthStencil.transient;
+}
+
+RenderTargetPool::~RenderTargetPool()
+{
+	destroy();
+}
+
+RenderTargetHandle RenderTargetPool::create(const RenderTargetDesc& desc)
+{
+	return add(desc, false);
+}
+
+RenderTargetHandle RenderTargetPool::acquire(const RenderTargetDesc& desc)
+{
+	for (size_t i = 0; i < targets.size(); i++)
+	{
+		Target& target = targets[i];
+		if (target.framebuffer != 0 && target.pooled && !target.acquired && target.desc == desc)
+		{
+			target.acquired = true;
+			target.lastUsedFrame = frame;
+			counters.reused++;
+			return (RenderTargetHandle)(i + 1);
+		}
+	}
+	return add(desc, true);
+}
+
+void RenderTargetPool::release(RenderTargetHandle target)
+{
+	Target* t = find(target);
+	if (t != nullptr && t->pooled)
+	{
+		t->acquired = false;
+		t->lastUsedFrame = frame;
+	}
+}
+
+void RenderTargetPool::destroy(RenderTargetHandle target)
+{
+	Target* t = find(target);
+	if (t != nullptr)
+	{
+		deleteObjects(*t);
+		counters.targets--;
+	}
+}
+
+bool RenderTargetPool::resize(RenderTargetHandle target, int width, int height)
+{
+	Target* t = find(target);
+	if (t == nullptr || width <= 0 || height <= 0)
+	{
+		return false;
+	}
+	if (t->desc.width == width && t->desc.height == height)
+	{
+		return true;
+	}
+	deleteObjects(*t);
+	t->desc.width = width;
+	t->desc.height = height;
+	if (!build(*t))
+	{
+		deleteObjects(*t);
+		counters.targets--;
+		return false;
+	}
+	return true;
+}
+
+void RenderTargetPool::begin(RenderTargetHandle target)
+{
+	const Target* t = find(target);
+	if (t == nullptr)
+	{
+		return;
+	}
+	GlResources::bindFramebuffer(GL_FRAMEBUFFER, t->framebuffer);
+	glViewport(0, 0, t->desc.width, t->desc.height);
+}
+
+void RenderTargetPool::end(RenderTargetHandle target)
+{
+	const Target* t = find(target);
+	if (t == nullptr)
+	{
+		return;
+	}
+	const RenderTargetDesc& desc = t->desc;
+
+	// average the samples of every sampled attachment into its texture, one blit per colour attachment: a blit copies the read buffer
+	// into every draw buffer, so the resolve FBO draws into the matching attachment only
+	if (t->resolveFramebuffer != 0)
+	{
+		GLenum drawBuffers[maxColorAttachments];
+		for (int i = 0; i < maxColorAttachments; i++)
+		{
+			drawBuffers[i] = GL_NONE;
+		}
+		for (int i = 0; i < maxColorAttachments && desc.color[i].format != GL_NONE; i++)
+		{
+			if (desc.color[i].transient)
+			{
+				continue;
+			}
+			drawBuffers[i] = GL_COLOR_ATTACHMENT0 + i;
+			GlResources::framebufferReadBuffer(t->framebuffer, GL_COLOR_ATTACHMENT0 + i);
+			GlResources::framebufferDrawBuffers(t->resolveFramebuffer, i + 1, drawBuffers);
+			GlResources::blitFramebuffer(t->framebuffer, t->resolveFramebuffer, desc.width, desc.height, desc.width, desc.height,
+				GL_COLOR_BUFFER_BIT, GL_NEAREST);
+			drawBuffers[i] = GL_NONE;
+			counters.resolves++;
+		}
+		GlResources::framebufferReadBuffer(t->framebuffer, desc.color[0].format != GL_NONE ? GL_COLOR_ATTACHMENT0 : GL_NONE);
+		if (desc.depthStencil.format != GL_NONE && !desc.depthStencil.transient)
+		{
+			// depth and stencil can't be averaged, GL_NEAREST takes one of the samples
+			GlResources::blitFramebuffer(t->framebuffer, t->resolveFramebuffer, desc.width, desc.height, desc.width, desc.height,
+				depthStencilBits(desc.depthStencil.format), GL_NEAREST);
+			counters.resolves++;
+		}
+	}
+
+	// nothing drawn into the framebuffer is needed anymore when it is transient or was resolved
+	GLenum discard[maxColorAttachments + 1];
+	GLsizei count = 0;
+	for (int i = 0; i < maxColorAttachments && desc.color[i].format != GL_NONE; i++)
+	{
+		if (desc.color[i].transient || desc.samples > 0)
+		{
+			discard[count++] = GL_COLOR_ATTACHMENT0 + i;
+		}
+	}
+	if (desc.depthStencil.format != GL_NONE && (desc.depthStencil.transient || desc.samples > 0))
+	{
+		discard[count++] = depthStencilAttachment(desc.depthStencil.format);
+	}
+	if (GlResources::invalidateFramebuffer(t->framebuffer, count, discard))
+	{
+		counters.invalidations++;
+	}
+
+	GlResources::bindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+void RenderTargetPool::blitToDefault(RenderTargetHandle target, int width, int height)
+{
+	const Target* t = find(target);
+	if (t == nullptr || t->colorTextures[0] == 0)
+	{
+		return;
+	}
+	GLuint source = t->resolveFramebuffer != 0 ? t->resolveFramebuffer : t->framebuffer;
+	GlResources::framebufferReadBuffer(source, GL_COLOR_ATTACHMENT0);
+	GlResources::blitFramebuffer(source, 0, t->desc.width, t->desc.height, width, height, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+}
+
+GLuint RenderTargetPool::texture(RenderTargetHandle target, int index) const
+{
+	const Target* t = find(target);
+	return t != nullptr && index >= 0 && index < maxColorAttachments ? t->colorTextures[index] : 0;
+}
+
+GLuint RenderTargetPool::depthTexture(RenderTargetHandle target) const
+{
+	const Target* t = find(target);
+	return t != nullptr ? t->depthStencilTexture : 0;
+}
+
+GLuint RenderTargetPool::framebuffer(RenderTargetHandle target) const
+{
+	const Target* t = find(target);
+	return t != nullptr ? t->framebuffer : 0;
+}
+
+const RenderTargetDesc* RenderTargetPool::desc(RenderTargetHandle target) const
+{
+	const Target* t = find(target);
+	return t != nullptr ? &t->desc : nullptr;
+}
+
+void RenderTargetPool::endFrame()
+{
+	for (Target& target : targets)
+	{
+		if (target.framebuffer != 0 && target.pooled && !target.acquired && frame - target.lastUsedFrame >= (unsigned long long)evictAfterFrames)
+		{
+			deleteObjects(target);
+			counters.targets--;
+			counters.evicted++;
+		}
+	}
+	frame++;
+}
+
+void RenderTargetPool::trim()
+{
+	for (Target& target : targets)
+	{
+		if (target.framebuffer != 0 && target.pooled && !target.acquired)
+		{
+			deleteObjects(target);
+			counters.targets--;
+			counters.evicted++;
+		}
+	}
+}
+
+void RenderTargetPool::destroy()
+{
+	for (Target& target : targets)
+	{
+		if (target.framebuffer != 0)
+		{
+			deleteObjects(target);
+		}
+	}
+	targets.clear();
+	counters.targets = 0;
+}
+
+RenderTargetPool::Target* RenderTargetPool::find(RenderTargetHandle target)
+{
+	if (target == 0 || target > targets.size() || targets[target - 1].framebuffer == 0)
+	{
+		return nullptr;
+	}
+	return &targets[target - 1];
+}
+
+const RenderTargetPool::Target* RenderTargetPool::find(RenderTargetHandle target) const
+{
+	if (target == 0 || target > targets.size() || targets[target - 1].framebuffer == 0)
+	{
+		return nullptr;
+	}
+	return &targets[target - 1];
+}
+
+RenderTargetHandle RenderTargetPool::add(const RenderTargetDesc& desc, bool pooled)
+{
+	if (desc.width <= 0 || desc.height <= 0 || desc.samples < 0)
+	{
+		std::cout << "ERROR::RENDER_TARGET::INVALID_SIZE " << desc.width << "x" << desc.height << " samples " << desc.samples << std::endl;
+		return 0;
+	}
+	for (int i = 0; i < maxColorAttachments; i++)
+	{
+		if (desc.color[i].format != GL_NONE && isDepthStencilFormat(desc.color[i].format))
+		{
+			std::cout << "ERROR::RENDER_TARGET::DEPTH_FORMAT_AS_COLOR attachment " << i << std::endl;
+			return 0;
+		}
+	}
+	if (desc.depthStencil.format != GL_NONE && !isDepthStencilFormat(desc.depthStencil.format))
+	{
+		std::cout << "ERROR::RENDER_TARGET::COLOR_FORMAT_AS_DEPTH" << std::endl;
+		return 0;
+	}
+
+	Target target = {};
+	target.desc = desc;
+	target.pooled = pooled;
+	target.acquired = pooled;
+	target.lastUsedFrame = frame;
+	if (!build(target))
+	{
+		deleteObjects(target);
+		return 0;
+	}
+
+	counters.targets++;
+	counters.created++;
+	for (size_t i = 0; i < targets.size(); i++)	// reuse the slot of a destroyed target
+	{
+		if (targets[i].framebuffer == 0)
+		{
+			targets[i] = target;
+			return (RenderTargetHandle)(i + 1);
+		}
+	}
+	targets.push_back(target);
+	return (RenderTargetHandle)targets.size();
+}
+
+bool RenderTargetPool::build(Target& target)
+{
+	const RenderTargetDesc& desc = target.desc;
+	target.framebuffer = GlResources::createFramebuffer();
+
+	GLenum drawBuffers[maxColorAttachments];
+	GLsizei colorCount = 0;
+	bool resolve = false;
+	for (int i = 0; i < maxColorAttachments && desc.color[i].format != GL_NONE; i++)
+	{
+		const AttachmentDesc& attachment = desc.color[i];
+		target.colorImages[i] = createImage(desc, attachment, desc.samples);
+		attach(target.framebuffer, GL_COLOR_ATTACHMENT0 + i, target.colorImages[i], drawsIntoTexture(desc, attachment));
+		drawBuffers[colorCount++] = GL_COLOR_ATTACHMENT0 + i;
+		if (drawsIntoTexture(desc, attachment))
+		{
+			target.colorTextures[i] = target.colorImages[i];
+		}
+		resolve = resolve || (desc.samples > 0 && !attachment.transient);
+	}
+	if (desc.depthStencil.format != GL_NONE)
+	{
+		target.depthStencilImage = createImage(desc, desc.depthStencil, desc.samples);
+		attach(target.framebuffer, depthStencilAttachment(desc.depthStencil.format), target.depthStencilImage,
+			drawsIntoTexture(desc, desc.depthStencil));
+		if (drawsIntoTexture(desc, desc.depthStencil))
+		{
+			target.depthStencilTexture = target.depthStencilImage;
+		}
+		resolve = resolve || (desc.samples > 0 && !desc.depthStencil.transient);
+	}
+
+	// without colour attachments the framebuffer draws depth only, GL_NONE keeps it complete on GL 3.3 drivers
+	if (colorCount > 0)
+	{
+		GlResources::framebufferDrawBuffers(target.framebuffer, colorCount, drawBuffers);
+	}
+	else
+	{
+		GLenum none = GL_NONE;
+		GlResources::framebufferDrawBuffers(target.framebuffer, 1, &none);
+		GlResources::framebufferReadBuffer(target.framebuffer, GL_NONE);
+	}
+	if (!complete(target.framebuffer))
+	{
+		return false;
+	}
+
+	// multisampled: single sampled textures to resolve the sampled attachments into
+	if (resolve)
+	{
+		target.resolveFramebuffer = GlResources::createFramebuffer();
+		for (int i = 0; i < maxColorAttachments && desc.color[i].format != GL_NONE; i++)
+		{
+			if (!desc.color[i].transient)
+			{
+				target.colorTextures[i] = createImage(desc, desc.color[i], 0);
+				GlResources::framebufferTexture(target.resolveFramebuffer, GL_COLOR_ATTACHMENT0 + i, target.colorTextures[i]);
+			}
+		}
+		if (desc.depthStencil.format != GL_NONE && !desc.depthStencil.transient)
+		{
+			target.depthStencilTexture = createImage(desc, desc.depthStencil, 0);
+			GlResources::framebufferTexture(target.resolveFramebuffer, depthStencilAttachment(desc.depthStencil.format), target.depthStencilTexture);
+		}
+		if (!complete(target.resolveFramebuffer))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void RenderTargetPool::deleteObjects(Target& target)
+{
+	const RenderTargetDesc& desc = target.desc;
+	for (int i = 0; i < maxColorAttachments; i++)
+	{
+		if (target.colorImages[i] != 0)
+		{
+			if (drawsIntoTexture(desc, desc.color[i]))
+			{
+				GpuMemory::deleteTexture(target.colorImages[i]);
+			}
+			else
+			{
+				GpuMemory::deleteRenderbuffer(target.colorImages[i]);
+			}
+		}
+		if (target.colorTextures[i] != 0 && target.colorTextures[i] != target.colorImages[i])
+		{
+			GpuMemory::deleteTexture(target.colorTextures[i]);
+		}
+		target.colorImages[i] = 0;
+		target.colorTextures[i] = 0;
+	}
+	if (target.depthStencilImage != 0)
+	{
+		if (drawsIntoTexture(desc, desc.depthStencil))
+		{
+			GpuMemory::deleteTexture(target.depthStencilImage);
+		}
+		else
+		{
+			GpuMemory::deleteRenderbuffer(target.depthStencilImage);
+		}
+	}
+	if (target.depthStencilTexture != 0 && target.depthStencilTexture != target.depthStencilImage)
+	{
+		GpuMemory::deleteTexture(target.depthStencilTexture);
+	}
+	target.depthStencilImage = 0;
+	target.depthStencilTexture = 0;
+
+	if (target.framebuffer != 0)
+	{
+		GlResources::deleteFramebuffer(target.framebuffer);
+		target.framebuffer = 0;
+	}
+	if (target.resolveFramebuffer != 0)
+	{
+		GlResources::deleteFramebuffer(target.resolveFramebuffer);
+		target.resolveFramebuffer = 0;
+	}
+}
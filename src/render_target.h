@@ -0,0 +1,134 @@
+#ifndef RENDER_TARGET_H
+#define RENDER_TARGET_H
+
+/*
+ * NOTES:
+ * Offscreen render targets: framebuffer objects (FBO) with their colour, depth and stencil attachments.
+ *
+ * Drawing goes to whatever framebuffer is bound to GL_DRAW_FRAMEBUFFER, 0 is the window's (the default framebuffer). An FBO is a
+ * framebuffer of our own: a list of images (attachments) to draw into, each a texture (can be sampled later, e.g. by a post-processing
+ * pass) or a renderbuffer (can only be drawn into, blitted and read back, but the driver may store it however suits the GPU best).
+ *
+ * A RenderTargetDesc describes the size, the sample count and the attachments (up to 4 colour plus one depth/stencil). Each attachment is:
+ *	*sampled		a texture, texture() returns it after end()
+ *	*transient		a renderbuffer whose contents are thrown away at end(), e.g. the depth buffer of a pass that is only needed while
+ *					drawing. glInvalidateFramebuffer (GL 4.3 or GL_ARB_invalidate_subdata) tells the driver so: a tiled GPU then never
+ *					writes it out to memory and a desktop GPU may skip the decompression or the copy. Without the extension nothing is
+ *					invalidated and the contents just stay around unused.
+ *
+ * Multisampling (samples > 0): every attachment is a multisampled renderbuffer, textures can't be filtered from those. end() resolves the
+ * sampled attachments with glBlitFramebuffer into single sampled textures of a second FBO and then invalidates the multisampled
+ * renderbuffers, the samples are not needed anymore once they are averaged.
+ *
+ * Targets come from a RenderTargetPool in two ways:
+ *	*create()		persistent, lives until destroy(), e.g. the scene colour buffer that is shown every frame
+ *	*acquire()		pooled, give it back with release() once the pass that reads it is done. The next acquire() of the same description
+ *					gets the same target back, so two passes that don't overlap (bloom's downsample and later the blur of the next
+ *					frame, ...) share one set of GPU memory instead of having one each. Pooled targets nobody acquired for
+ *					evictAfterFrames frames are deleted at endFrame().
+ *
+ *	RenderTargetHandle scene = targets.create(desc);
+ *	targets.begin(scene);		// binds the FBO and sets the viewport to its size
+ *	... draw ...
+ *	targets.end(scene);			// resolves and invalidates, the default framebuffer is bound again
+ *	targets.blitToDefault(scene, windowWidth, windowHeight);
+ *
+ * All textures and renderbuffers are created through GpuMemory under GpuMemoryCategory::RenderTarget, so they show up in its report.
+ */
+
+#include "gl_api.h"
+
+#include <vector>
+
+const int maxColorAttachments = 4;
+
+struct AttachmentDesc
+{
+	GLenum format = GL_NONE;	// internal format (GL_RGBA8, GL_RGBA16F, GL_DEPTH24_STENCIL8, ...), GL_NONE = not attached
+	bool transient = false;		// renderbuffer, contents discarded at end(), otherwise a texture that can be sampled
+};
+
+struct RenderTargetDesc
+{
+	int width = 0;
+	int height = 0;
+	int samples = 0;			// 0 = no multisampling
+	AttachmentDesc color[maxColorAttachments];	// GL_COLOR_ATTACHMENT0 + i, used ones first
+	AttachmentDesc depthStencil;				// depth, stencil or depth and stencil format
+
+	RenderTargetDesc& addColor(GLenum format, bool transient = false);
+	RenderTargetDesc& setDepthStencil(GLenum format, bool transient = false);
+	bool operator==(const RenderTargetDesc& other) const;
+};
+
+typedef unsigned int RenderTargetHandle;	// 0 is no target
+
+class RenderTargetPool
+{
+public:
+	static const int evictAfterFrames = 60;
+
+	RenderTargetPool() = default;
+	~RenderTargetPool();
+
+	RenderTargetPool(const RenderTargetPool&) = delete;
+	RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+	RenderTargetHandle create(const RenderTargetDesc& desc);	// persistent target, 0 if the description or the FBO is invalid
+	RenderTargetHandle acquire(const RenderTargetDesc& desc);	// pooled target, reused when a released one matches
+	void release(RenderTargetHandle target);					// the pooled target can be handed out again
+	void destroy(RenderTargetHandle target);
+	bool resize(RenderTargetHandle target, int width, int height);	// new attachments of the new size, the handle stays valid
+
+	void begin(RenderTargetHandle target);		// binds the FBO for drawing and sets the viewport
+	void end(RenderTargetHandle target);		// resolves multisampling, invalidates transient attachments, binds the default framebuffer
+	// copies colour attachment 0 (resolved) onto the default framebuffer, scaled to width x height
+	void blitToDefault(RenderTargetHandle target, int width, int height);
+
+	GLuint texture(RenderTargetHandle target, int index = 0) const;	// sampled colour attachment (the resolved one), 0 if none
+	GLuint depthTexture(RenderTargetHandle target) const;			// sampled depth/stencil attachment, 0 if none
+	GLuint framebuffer(RenderTargetHandle target) const;			// the FBO drawn into (multisampled when samples > 0)
+	const RenderTargetDesc* desc(RenderTargetHandle target) const;
+
+	void endFrame();		// deletes pooled targets that were not acquired for evictAfterFrames frames
+	void trim();			// deletes every pooled target that isn't acquired right now
+	void destroy();			// deletes every target
+
+	struct Stats
+	{
+		int targets = 0;			// live targets, persistent and pooled
+		int created = 0;
+		int reused = 0;				// acquire() calls served by a released target
+		int evicted = 0;
+		int resolves = 0;			// glBlitFramebuffer resolves this far
+		int invalidations = 0;		// glInvalidateFramebuffer calls this far
+	};
+	const Stats& stats() const { return counters; }
+
+private:
+	struct Target
+	{
+		RenderTargetDesc desc;
+		GLuint framebuffer;			// drawn into, 0 = free slot
+		GLuint resolveFramebuffer;	// single sampled copies of the sampled attachments, 0 without multisampling
+		GLuint colorImages[maxColorAttachments];	// attached to framebuffer: textures or renderbuffers
+		GLuint depthStencilImage;
+		GLuint colorTextures[maxColorAttachments];	// what texture() returns
+		GLuint depthStencilTexture;
+		bool pooled;
+		bool acquired;
+		unsigned long long lastUsedFrame;
+	};
+
+	Target* find(RenderTargetHandle target);
+	const Target* find(RenderTargetHandle target) const;
+	RenderTargetHandle add(const RenderTargetDesc& desc, bool pooled);
+	bool build(Target& target);
+	void deleteObjects(Target& target);
+
+	std::vector<Target> targets;	// handle - 1
+	unsigned long long frame = 0;
+	Stats counters;
+};
+
+#endif
@@ -0,0 +1,332 @@
+/*
+ *	Shader permutation compilation, see shader_cache.h
+ */
+
+#include "shader_cache.h"
+#include "alloc_tracker.h"
+#include "shader_manifest.h"
+
+#include <cstddef>
+#include <iostream>
+
+// token of GL_KHR_parallel_shader_compile, in case the glad header was generated without it
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR 0x91B1
+#endif
+
+ShaderCache::~ShaderCache()
+{
+	destroy();
+}
+
+GLuint ShaderCache::program(const std::string& vertexPath, const std::string& fragmentPath, ShaderPermutationKey key,
+	const std::vector<ShaderDefine>& defines)
+{
+	return link(vertexPath, fragmentPath, key, defines, nullptr, 0, GL_INTERLEAVED_ATTRIBS);
+}
+
+GLuint ShaderCache::feedbackProgram(const std::string& vertexPath, const std::string& fragmentPath, ShaderPermutationKey key,
+	const char* const* varyings, int varyingCount, GLenum bufferMode)
+{
+	return link(vertexPath, fragmentPath, key, std::vector<ShaderDefine>(), varyings, varyingCount, bufferMode);
+}
+
+GLuint ShaderCache::link(const std::string& vertexPath, const std::string& fragmentPath, ShaderPermutationKey key,
+	const std::vector<ShaderDefine>& defines, const char* const* varyings, int varyingCount, GLenum bufferMode)
+{
+	AllocScope scope(AllocTag::Shaders);	// preprocessed sources, shader and program objects, the caches
+	PreprocessedShader vertex, fragment;
+	std::string error;
+	if (!preprocessor.preprocess(vertexPath, key, defines, &vertex, &error) ||
+		!preprocessor.preprocess(fragmentPath, key, defines, &fragment, &error))
+	{
+		std::cout << "ERROR::SHADER::PREPROCESS_FAILED\n" << error << std::endl;
+		return 0;
+	}
+
+	// the program is identified by the text of both stages
+	unsigned long long programHash = shaderProgramHash(vertex.hash, fragment.hash);
+	if (varyingCount > 0)
+	{
+		// hashed like the offline compiler does, so a feedback program finds its manifest entry
+		programHash = shaderFeedbackProgramHash(programHash, varyings, varyingCount, bufferMode == GL_INTERLEAVED_ATTRIBS);
+	}
+	auto found = programs.find(programHash);
+	if (found != programs.end())
+	{
+		counters.programsReused++;
+		return found->second;
+	}
+
+	GLuint vertexShader = compile(GL_VERTEX_SHADER, vertex);
+	GLuint fragmentShader = compile(GL_FRAGMENT_SHADER, fragment);
+
+	// link compiled shaders to a shader program that is activated when rendering objects
+	GLuint shaderProgram = glCreateProgram();		// generate shader program object
+	glAttachShader(shaderProgram, vertexShader);	// attached compiled vertex shader
+	glAttachShader(shaderProgram, fragmentShader);	// attach compiled fragment shader
+	if (varyingCount > 0)
+	{
+		glTransformFeedbackVaryings(shaderProgram, varyingCount, varyings, bufferMode);	// which outputs go to the feedback buffers
+	}
+	glLinkProgram(shaderProgram);					// link shader program together
+
+	// the shaders stay alive in the cache (other permutations may use them), detaching lets the driver free them with the cache
+	glDetachShader(shaderProgram, vertexShader);
+	glDetachShader(shaderProgram, fragmentShader);
+
+	// the link status is checked in finish(), asking now would wait for both compiles and the link
+	pendingPrograms.push_back(PendingProgram{ shaderProgram, vertexShader, fragmentShader, programHash, vertexPath + " + " + fragmentPath });
+	programs[programHash] = shaderProgram;
+	return shaderProgram;
+}
+
+GLuint ShaderCache::compile(GLenum stage, const PreprocessedShader& shader)
+{
+	auto found = shaders.find(shader.hash);
+	if (found != shaders.end())
+	{
+		counters.shadersReused++;	// another permutation preprocessed to exactly the same text
+		return found->second;
+	}
+
+	// vertex shader (process 3D data, typically transforms it into normalised device coordinates)
+	// fragment shader (colours the pixels after they have been rasterised)
+	if (!compilerThreadsSet && GLAD_GL_KHR_parallel_shader_compile)
+	{
+		glMaxShaderCompilerThreadsKHR(0xFFFFFFFFu);	// as many threads as the driver likes, compiles return right away
+		compilerThreadsSet = true;
+	}
+
+	const char* source = shader.source.c_str();
+	GLuint id = glCreateShader(stage);			// generate shader object
+	glShaderSource(id, 1, &source, NULL);		// attach shader source code to shader object
+	glCompileShader(id);						// compile shader
+
+	pendingShaders.push_back(PendingShader{ id, stage, shader });
+	shaders[shader.hash] = id;
+	return id;
+}
+
+bool ShaderCache::finish()
+{
+	return collect(true);
+}
+
+int ShaderCache::poll()
+{
+	if (!GLAD_GL_KHR_parallel_shader_compile)
+	{
+		collect(true);	// no way to ask without waiting
+		return 0;
+	}
+	collect(false);
+	return (int)pendingPrograms.size();
+}
+
+bool ShaderCache::collect(bool wait)
+{
+	AllocScope scope(AllocTag::Shaders);	// logs and diagnostics
+	bool ok = true;
+	for (size_t i = 0; i < pendingShaders.size();)
+	{
+		if (!wait && !completed(pendingShaders[i].id, false))
+		{
+			i++;
+			continue;
+		}
+		ok = checkShader(pendingShaders[i]) && ok;
+		pendingShaders.erase(pendingShaders.begin() + (std::ptrdiff_t)i);
+	}
+	for (size_t i = 0; i < pendingPrograms.size();)
+	{
+		const PendingProgram& program = pendingPrograms[i];
+		if (!wait && (pending(program.vertex) || pending(program.fragment) || !completed(program.id, true)))
+		{
+			i++;
+			continue;
+		}
+		ok = checkProgram(program) && ok;
+		pendingPrograms.erase(pendingPrograms.begin() + (std::ptrdiff_t)i);
+	}
+	if (!pendingPrograms.empty())
+	{
+		return ok;	// the failed shaders are still needed to tell why those programs failed
+	}
+
+	// failed shaders leave the cache, the next request for the same text compiles it again (e.g. after the file was fixed)
+	for (GLuint id : failedShaders)
+	{
+		for (auto entry = shaders.begin(); entry != shaders.end(); ++entry)
+		{
+			if (entry->second == id)
+			{
+				shaders.erase(entry);
+				break;
+			}
+		}
+		glDeleteShader(id);
+	}
+	failedShaders.clear();
+	return ok;
+}
+
+bool ShaderCache::pending(GLuint shader) const
+{
+	for (const PendingShader& entry : pendingShaders)
+	{
+		if (entry.id == shader)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+bool ShaderCache::completed(GLuint object, bool program) const
+{
+	// GL_COMPLETION_STATUS_KHR never waits, it is GL_TRUE once the driver's compiler thread is done
+	GLint done = GL_TRUE;
+	if (program)
+	{
+		glGetProgramiv(object, GL_COMPLETION_STATUS_KHR, &done);
+	}
+	else
+	{
+		glGetShaderiv(object, GL_COMPLETION_STATUS_KHR, &done);
+	}
+	return done == GL_TRUE;
+}
+
+namespace
+{
+	// the whole log, however long it is
+	std::string shaderLog(GLuint shader)
+	{
+		GLint length = 0;
+		glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &length);	// includes the terminating null, 0 when there is no log
+		if (length <= 1)
+		{
+			return std::string();
+		}
+		std::string log((size_t)length, '\0');
+		glGetShaderInfoLog(shader, length, NULL, &log[0]);
+		log.resize((size_t)length - 1);
+		return log;
+	}
+
+	std::string programLog(GLuint program)
+	{
+		GLint length = 0;
+		glGetProgramiv(program, GL_INFO_LOG_LENGTH, &length);
+		if (length <= 1)
+		{
+			return std::string();
+		}
+		std::string log((size_t)length, '\0');
+		glGetProgramInfoLog(program, length, NULL, &log[0]);
+		log.resize((size_t)length - 1);
+		return log;
+	}
+
+	void print(const std::vector<ShaderDiagnostic>& diagnostics, size_t first)
+	{
+		for (size_t i = first; i < diagnostics.size(); i++)
+		{
+			printShaderDiagnostic(std::cout, diagnostics[i], "shaders");
+		}
+	}
+}
+
+bool ShaderCache::checkShader(const PendingShader& shader)
+{
+	// check for any issues with compilation of shader
+	int success;								// store state
+	glGetShaderiv(shader.id, GL_COMPILE_STATUS, &success);
+
+	size_t first = messages.size();
+	parseShaderLog(shaderLog(shader.id), &shader.source, shader.source.files[0], &messages);	// warnings are kept too
+	if (!success) // if error with compilation of shader
+	{
+		std::cout << "ERROR::SHADER::" << (shader.stage == GL_VERTEX_SHADER ? "VERTEX" : "FRAGMENT") << "::COMPILATION_FAILED ("
+			<< shader.source.files[0] << ")\n";
+		print(messages, first);
+		failedShaders.push_back(shader.id);
+		return false;
+	}
+
+	counters.shadersCompiled++;
+	return true;
+}
+
+bool ShaderCache::checkProgram(const PendingProgram& program)
+{
+	bool shadersFailed = false;
+	for (GLuint id : failedShaders)
+	{
+		shadersFailed = shadersFailed || id == program.vertex || id == program.fragment;
+	}
+
+	// check for any issues with the shader program
+	int success = 0;
+	if (!shadersFailed)
+	{
+		glGetProgramiv(program.id, GL_LINK_STATUS, &success);
+		size_t first = messages.size();
+		parseShaderLog(programLog(program.id), NULL, program.name, &messages);
+		if (!success)
+		{
+			std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED (" << program.name << ")\n";
+			print(messages, first);
+		}
+	}
+	if (!success)	// a shader did not compile (already reported) or the link failed
+	{
+		programs.erase(program.hash);
+		glDeleteProgram(program.id);
+		return false;
+	}
+
+	counters.programsLinked++;
+	return true;
+}
+
+bool ShaderCache::linked(GLuint program) const
+{
+	for (const PendingProgram& pending : pendingPrograms)
+	{
+		if (pending.id == program)
+		{
+			return false;
+		}
+	}
+	return program != 0 && hashOf(program) != 0;
+}
+
+unsigned long long ShaderCache::hashOf(GLuint program) const
+{
+	for (auto& entry : programs)
+	{
+		if (entry.second == program)
+		{
+			return entry.first;
+		}
+	}
+	return 0;
+}
+
+void ShaderCache::destroy()
+{
+	for (auto& entry : programs)
+	{
+		glDeleteProgram(entry.second);
+	}
+	for (auto& entry : shaders)
+	{
+		glDeleteShader(entry.second);
+	}
+	programs.clear();
+	shaders.clear();
+	pendingShaders.clear();
+	pendingPrograms.clear();
+}
@@ -0,0 +1,103 @@
+#ifndef SHADER_CACHE_H
+#define SHADER_CACHE_H
+
+/*
+ * NOTES:
+ * Compiles and links shader permutations, each unique source only once.
+ *
+ * Every shader goes through the ShaderPreprocessor first. The hash of the preprocessed text identifies the shader object: asking for a
+ * permutation whose text is identical to one compiled before (because the shader ignores the feature that differs) returns the existing
+ * shader object, nothing is compiled. Programs are identified by the hashes of their vertex and fragment shaders the same way, so a
+ * large permutation set only costs as many compiles and links as there are unique variants.
+ *
+ * The program hash is stable between runs (it only depends on the source text), which makes it the key to store program binaries under.
+ *
+ * Compile and link status are not asked for right away: glGetShaderiv(GL_COMPILE_STATUS) waits for the compile to finish, asking after
+ * every glCompileShader serialises all compiles on the calling thread. program() only submits the work, finish() collects the status
+ * and the logs of everything submitted since the last call, so drivers that compile on their own threads get to do so in parallel.
+ * With GL_KHR_parallel_shader_compile the driver is asked to use all its compiler threads and poll() collects only what has finished
+ * (GL_COMPLETION_STATUS_KHR), the render loop can keep drawing while new permutations compile.
+ * Logs are read with their real length and parsed into file / line / message entries (see shader_diagnostics.h).
+ */
+
+#include "gl_api.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "shader_diagnostics.h"
+#include "shader_preprocessor.h"
+
+class ShaderCache
+{
+public:
+	explicit ShaderCache(ShaderPreprocessor& preprocessor) : preprocessor(preprocessor) {}
+	~ShaderCache();
+
+	ShaderCache(const ShaderCache&) = delete;
+	ShaderCache& operator=(const ShaderCache&) = delete;
+
+	// preprocesses and submits compile and link, returns 0 when preprocessing failed (the error is printed). The program must not be
+	// used before finish() said it linked
+	GLuint program(const std::string& vertexPath, const std::string& fragmentPath, ShaderPermutationKey key,
+		const std::vector<ShaderDefine>& defines = std::vector<ShaderDefine>());
+	// like program(), with the vertex shader outputs named by varyings captured by transform feedback (glTransformFeedbackVaryings has to
+	// come before the link). Hashed with the varyings, the same stages without them are another program
+	GLuint feedbackProgram(const std::string& vertexPath, const std::string& fragmentPath, ShaderPermutationKey key,
+		const char* const* varyings, int varyingCount, GLenum bufferMode = GL_INTERLEAVED_ATTRIBS);
+
+	// waits for everything submitted, prints the diagnostics, deletes what failed. False if any shader or program failed
+	bool finish();
+	int poll();	// collects what finished without waiting (GL_KHR_parallel_shader_compile, else same as finish), returns programs still compiling
+	bool linked(GLuint program) const;												// linked and checked by finish() or poll()
+	const std::vector<ShaderDiagnostic>& diagnostics() const { return messages; }	// everything the driver reported, warnings included
+
+	unsigned long long hashOf(GLuint program) const;	// the program's hash (see shader_manifest.h), 0 if not created by this cache
+	void destroy();										// deletes every shader and program
+
+	struct Stats
+	{
+		int shadersCompiled = 0;
+		int shadersReused = 0;	// requests answered by a shader with the same preprocessed text
+		int programsLinked = 0;
+		int programsReused = 0;
+	};
+	const Stats& stats() const { return counters; }
+
+private:
+	struct PendingShader
+	{
+		GLuint id;
+		GLenum stage;
+		PreprocessedShader source;	// kept for the line map until the log is read
+	};
+	struct PendingProgram
+	{
+		GLuint id;
+		GLuint vertex, fragment;
+		unsigned long long hash;
+		std::string name;	// "vertex.vert + fragment.frag", link logs have no file of their own
+	};
+
+	GLuint link(const std::string& vertexPath, const std::string& fragmentPath, ShaderPermutationKey key,
+		const std::vector<ShaderDefine>& defines, const char* const* varyings, int varyingCount, GLenum bufferMode);
+	GLuint compile(GLenum stage, const PreprocessedShader& shader);
+	bool checkShader(const PendingShader& shader);
+	bool checkProgram(const PendingProgram& program);
+	bool collect(bool wait);
+	bool pending(GLuint shader) const;
+	bool completed(GLuint object, bool program) const;
+
+	ShaderPreprocessor& preprocessor;
+	std::unordered_map<unsigned long long, GLuint> shaders;		// preprocessed source hash -> shader object
+	std::unordered_map<unsigned long long, GLuint> programs;	// combined hash of the stages -> program object
+	std::vector<PendingShader> pendingShaders;					// submitted, status not checked yet
+	std::vector<PendingProgram> pendingPrograms;
+	std::vector<GLuint> failedShaders;							// deleted once no pending program links them
+	bool compilerThreadsSet = false;
+	std::vector<ShaderDiagnostic> messages;
+	Stats counters;
+};
+
+#endif
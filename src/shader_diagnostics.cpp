@@ -0,0 +1,180 @@
+/*
+ *	Shader log parsing, see shader_diagnostics.h
+ */
+
+#include "shader_diagnostics.h"
+
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+namespace
+{
+	// reads a decimal number at text, advances text past it, false if there is none
+	bool readNumber(const char** text, int* value)
+	{
+		if (!std::isdigit((unsigned char)**text))
+		{
+			return false;
+		}
+		char* end;
+		*value = (int)std::strtol(*text, &end, 10);
+		*text = end;
+		return true;
+	}
+
+	// expects literal at text, advances past it
+	bool expect(const char** text, const char* literal)
+	{
+		size_t length = std::strlen(literal);
+		if (std::strncmp(*text, literal, length) != 0)
+		{
+			return false;
+		}
+		*text += length;
+		return true;
+	}
+
+	ShaderDiagnosticSeverity severityOf(const std::string& word)
+	{
+		if (word.compare(0, 5, "error") == 0 || word.compare(0, 5, "ERROR") == 0)
+		{
+			return ShaderDiagnosticSeverity::Error;
+		}
+		if (word.compare(0, 7, "warning") == 0 || word.compare(0, 7, "WARNING") == 0)
+		{
+			return ShaderDiagnosticSeverity::Warning;
+		}
+		return ShaderDiagnosticSeverity::Info;
+	}
+
+	// "ERROR: 0:12: message" (AMD, Intel, glslang with a name instead of 0)
+	bool parsePrefixed(const char* text, ShaderDiagnostic* diagnostic, int* line)
+	{
+		if (expect(&text, "ERROR: "))
+		{
+			diagnostic->severity = ShaderDiagnosticSeverity::Error;
+		}
+		else if (expect(&text, "WARNING: "))
+		{
+			diagnostic->severity = ShaderDiagnosticSeverity::Warning;
+		}
+		else
+		{
+			return false;
+		}
+
+		const char* colon = std::strchr(text, ':');	// skip the string index or name
+		if (colon == NULL)
+		{
+			return false;
+		}
+		text = colon + 1;
+		if (!readNumber(&text, line) || !expect(&text, ":"))
+		{
+			return false;
+		}
+		while (*text == ' ')
+		{
+			text++;
+		}
+		diagnostic->message = text;
+		return true;
+	}
+
+	// "0:12(5): error: message" (Mesa)
+	bool parseMesa(const char* text, ShaderDiagnostic* diagnostic, int* line)
+	{
+		int source, column;
+		if (!readNumber(&text, &source) || !expect(&text, ":") || !readNumber(&text, line) || !expect(&text, "(") ||
+			!readNumber(&text, &column) || !expect(&text, "): "))
+		{
+			return false;
+		}
+		const char* colon = std::strchr(text, ':');
+		if (colon == NULL)
+		{
+			return false;
+		}
+		diagnostic->severity = severityOf(std::string(text, colon));
+		diagnostic->message = colon[1] == ' ' ? colon + 2 : colon + 1;
+		return true;
+	}
+
+	// "0(12) : error C1008: message" (NVIDIA)
+	bool parseNvidia(const char* text, ShaderDiagnostic* diagnostic, int* line)
+	{
+		int source;
+		if (!readNumber(&text, &source) || !expect(&text, "(") || !readNumber(&text, line) || !expect(&text, ") : "))
+		{
+			return false;
+		}
+		diagnostic->severity = severityOf(text);
+		diagnostic->message = text;	// keep "error C1008: ...", the code is useful to search for
+		return true;
+	}
+}
+
+int parseShaderLog(const std::string& log, const PreprocessedShader* source, const std::string& fallbackFile,
+	std::vector<ShaderDiagnostic>* out)
+{
+	int errors = 0;
+	std::istringstream lines(log);
+	std::string text;
+	while (std::getline(lines, text))
+	{
+		if (!text.empty() && text.back() == '\r')
+		{
+			text.pop_back();
+		}
+		if (text.empty() || text[0] == '\0')
+		{
+			continue;
+		}
+
+		ShaderDiagnostic diagnostic;
+		int line = 0;
+		if (parsePrefixed(text.c_str(), &diagnostic, &line) || parseMesa(text.c_str(), &diagnostic, &line) ||
+			parseNvidia(text.c_str(), &diagnostic, &line))
+		{
+			// the line is in the preprocessed text, find where it came from
+			if (source == NULL || !source->mapLine(line, &diagnostic.file, &diagnostic.line))
+			{
+				diagnostic.file = fallbackFile;
+				diagnostic.line = line;
+			}
+		}
+		else
+		{
+			diagnostic = ShaderDiagnostic();
+			diagnostic.severity = severityOf(text);
+			diagnostic.file = fallbackFile;
+			diagnostic.message = text;
+		}
+
+		if (diagnostic.severity == ShaderDiagnosticSeverity::Error)
+		{
+			errors++;
+		}
+		out->push_back(diagnostic);
+	}
+	return errors;
+}
+
+void printShaderDiagnostic(std::ostream& out, const ShaderDiagnostic& diagnostic, const std::string& directory)
+{
+	const char* severity = diagnostic.severity == ShaderDiagnosticSeverity::Error ? "error" :
+		diagnostic.severity == ShaderDiagnosticSeverity::Warning ? "warning" : "info";
+
+	if (!directory.empty())
+	{
+		out << directory << "/";
+	}
+	out << diagnostic.file;
+	if (diagnostic.line > 0)
+	{
+		out << "(" << diagnostic.line << ")";
+	}
+	out << ": " << severity << ": " << diagnostic.message << "\n";
+}
@@ -0,0 +1,50 @@
+#ifndef SHADER_DIAGNOSTICS_H
+#define SHADER_DIAGNOSTICS_H
+
+/*
+ * NOTES:
+ * Parsing of shader compiler and linker logs into file / line / message entries.
+ *
+ * Every driver formats its info log differently, the common ones are:
+ *	*Mesa:				0:12(5): error: `foo' undeclared
+ *	*NVIDIA:			0(12) : error C1008: undefined variable "foo"
+ *	*AMD, Intel, glslang:	ERROR: 0:12: 'foo' : undeclared identifier		(glslang puts the shader name where the 0 is)
+ * The first number is the source string index (we always pass one string), the second the line in the preprocessed source. That line
+ * means nothing to us after #include expansion, so it is mapped back to the file and line it came from with the preprocessor's line map.
+ *
+ * Lines we don't recognise are kept as a message without a location, nothing from the log is dropped.
+ *
+ * The log itself is read with its real length (GL_INFO_LOG_LENGTH), see ShaderCache. Nothing here calls OpenGL so the offline shader
+ * compiler uses the same parser.
+ */
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "shader_preprocessor.h"
+
+enum class ShaderDiagnosticSeverity
+{
+	Error,
+	Warning,
+	Info	// a line of the log we couldn't parse
+};
+
+struct ShaderDiagnostic
+{
+	ShaderDiagnosticSeverity severity = ShaderDiagnosticSeverity::Info;
+	std::string file;	// file the line came from (relative to the shader directory), or what was passed as fallbackFile
+	int line = 0;		// 0 when the log line has no location
+	std::string message;
+};
+
+// parses log and appends one entry per diagnostic to out. source (may be NULL, e.g. for link logs) maps lines back through the
+// includes, entries without a usable location get fallbackFile. Returns the number of errors found
+int parseShaderLog(const std::string& log, const PreprocessedShader* source, const std::string& fallbackFile,
+	std::vector<ShaderDiagnostic>* out);
+
+// "file(line): error: message", the format Visual Studio's output window understands (double click jumps to the line)
+void printShaderDiagnostic(std::ostream& out, const ShaderDiagnostic& diagnostic, const std::string& directory = std::string());
+
+#endif
@@ -0,0 +1,143 @@
+/*
+ *	Shader manifest reading and writing, see shader_manifest.h
+ */
+
+#include "shader_manifest.h"
+
+#include <fstream>
+#include <sstream>
+
+unsigned long long shaderProgramHash(unsigned long long vertexHash, unsigned long long fragmentHash)
+{
+	return shaderHash(std::to_string(vertexHash) + ":" + std::to_string(fragmentHash));
+}
+
+unsigned long long shaderFeedbackProgramHash(unsigned long long programHash, const char* const* varyings, int varyingCount, bool interleaved)
+{
+	std::string captured = interleaved ? "interleaved" : "separate";
+	for (int i = 0; i < varyingCount; i++)
+	{
+		captured += std::string(" ") + varyings[i];
+	}
+	return shaderProgramHash(programHash, shaderHash(captured));
+}
+
+bool ShaderManifest::load(const std::string& path)
+{
+	programs.clear();
+
+	std::ifstream file(path);
+	if (!file)
+	{
+		return false;
+	}
+
+	std::string line;
+	ShaderManifestProgram* current = nullptr;
+	while (std::getline(file, line))
+	{
+		std::istringstream words(line);
+		std::string kind;
+		if (!(words >> kind) || kind[0] == '#')
+		{
+			continue;	// empty line or comment
+		}
+
+		if (kind == "program")
+		{
+			programs.push_back(ShaderManifestProgram());
+			current = &programs.back();
+			words >> current->name >> std::hex >> current->key >> current->vertexHash >> current->fragmentHash >> current->programHash;
+		}
+		else if (current == nullptr)
+		{
+			return false;	// a block/uniform outside of a program
+		}
+		else if (kind == "block")
+		{
+			ShaderManifestBlock block;
+			words >> block.name >> block.dataSize;
+			current->blocks.push_back(block);
+		}
+		else if (kind == "uniform")
+		{
+			ShaderManifestUniform uniform;
+			words >> uniform.name >> std::hex >> uniform.type >> std::dec >> uniform.arraySize;
+			current->uniforms.push_back(uniform);
+		}
+		else if (kind == "varyings")
+		{
+			std::string name;
+			while (words >> name)
+			{
+				current->varyings.push_back(name);
+			}
+			words.clear();	// stopped at the end of the line, not a parse error
+		}
+		else if (kind == "spirv")
+		{
+			words >> current->vertexSpirv >> current->fragmentSpirv;
+		}
+		else if (kind == "end")
+		{
+			current = nullptr;
+		}
+
+		if (words.fail())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool ShaderManifest::save(const std::string& path) const
+{
+	std::ofstream file(path);
+	if (!file)
+	{
+		return false;
+	}
+
+	file << "# shader manifest, written by shader_compiler, do not edit\n";
+	for (const ShaderManifestProgram& program : programs)
+	{
+		file << std::hex << "program " << program.name << " " << program.key << " " << program.vertexHash << " " << program.fragmentHash
+			<< " " << program.programHash << std::dec << "\n";
+		for (const ShaderManifestBlock& block : program.blocks)
+		{
+			file << "block " << block.name << " " << block.dataSize << "\n";
+		}
+		for (const ShaderManifestUniform& uniform : program.uniforms)
+		{
+			file << "uniform " << uniform.name << " " << std::hex << uniform.type << std::dec << " " << uniform.arraySize << "\n";
+		}
+		if (!program.varyings.empty())
+		{
+			file << "varyings";
+			for (const std::string& varying : program.varyings)
+			{
+				file << " " << varying;
+			}
+			file << "\n";
+		}
+		if (!program.vertexSpirv.empty())
+		{
+			file << "spirv " << program.vertexSpirv << " " << program.fragmentSpirv << "\n";
+		}
+		file << "end\n";
+	}
+	return (bool)file;
+}
+
+const ShaderManifestProgram* ShaderManifest::find(unsigned long long programHash) const
+{
+	for (const ShaderManifestProgram& program : programs)
+	{
+		if (program.programHash == programHash)
+		{
+			return &program;
+		}
+	}
+	return nullptr;
+}
@@ -0,0 +1,77 @@
+#ifndef SHADER_MANIFEST_H
+#define SHADER_MANIFEST_H
+
+/*
+ * NOTES:
+ * Shader manifest: what the offline shader compiler (tools/shader_compiler.cpp) found out about every shader permutation.
+ *
+ * The offline compiler preprocesses and validates every permutation listed in shader_permutations.h at build time and writes one entry
+ * per permutation: the hashes of the preprocessed stages (the same hashes ShaderCache computes at runtime), the uniform blocks and
+ * loose uniforms with their types and sizes, the transform feedback varyings the program is linked with, and optionally the file names of
+ * the SPIR-V it generated.
+ *
+ * At runtime a program whose hash is in the manifest doesn't need to be enumerated with glGetActiveUniform & co, the names and types
+ * are already known (ProgramReflection::build with a manifest entry). If the shader files changed after the manifest was written the
+ * hashes don't match and the runtime falls back to asking the driver.
+ *
+ * The file is plain text so a diff shows what changed:
+ *
+ *	program <name> <permutation key> <vertex hash> <fragment hash> <program hash>
+ *	block <name> <data size>
+ *	uniform <name> <GL type> <array size>
+ *	varyings <name> <name> ...		only for transform feedback programs, captured interleaved
+ *	spirv <vertex file> <fragment file>
+ *	end
+ *
+ * No OpenGL calls, types are stored as the numeric GLenum values.
+ */
+
+#include <string>
+#include <vector>
+
+#include "shader_preprocessor.h"
+
+struct ShaderManifestBlock
+{
+	std::string name;
+	int dataSize = 0;
+};
+
+struct ShaderManifestUniform
+{
+	std::string name;
+	unsigned int type = 0;	// GLenum, e.g. 0x1406 GL_FLOAT
+	int arraySize = 1;
+};
+
+struct ShaderManifestProgram
+{
+	std::string name;
+	ShaderPermutationKey key = 0;
+	unsigned long long vertexHash = 0;
+	unsigned long long fragmentHash = 0;
+	unsigned long long programHash = 0;
+	std::vector<ShaderManifestBlock> blocks;
+	std::vector<ShaderManifestUniform> uniforms;
+	std::vector<std::string> varyings;	// transform feedback outputs, part of the program hash
+	std::string vertexSpirv;	// empty when no SPIR-V was generated
+	std::string fragmentSpirv;
+};
+
+class ShaderManifest
+{
+public:
+	bool load(const std::string& path);			// false when the file doesn't exist or can't be parsed
+	bool save(const std::string& path) const;
+
+	const ShaderManifestProgram* find(unsigned long long programHash) const;
+
+	std::vector<ShaderManifestProgram> programs;
+};
+
+// the hash ShaderCache and the manifest identify a program by, from the hashes of its preprocessed stages
+unsigned long long shaderProgramHash(unsigned long long vertexHash, unsigned long long fragmentHash);
+// the hash of a program linked with transform feedback varyings, the same stages without them are another program
+unsigned long long shaderFeedbackProgramHash(unsigned long long programHash, const char* const* varyings, int varyingCount, bool interleaved);
+
+#endif
@@ -0,0 +1,60 @@
+#ifndef SHADER_PERMUTATIONS_H
+#define SHADER_PERMUTATIONS_H
+
+/*
+ * NOTES:
+ * Every shader program of the application and the features it can be compiled with.
+ *
+ * Both the renderer and the offline shader tools read this list, so adding a program or feature here is enough for it to be built and
+ * validated. Files are relative to the shaders/ directory.
+ */
+
+#include "shader_preprocessor.h"
+
+// feature bits of a permutation key
+enum ShaderFeatureBits : ShaderPermutationKey
+{
+	SHADER_FEATURE_PULSE = 1u << 0,		// modulate the colour with time
+	SHADER_FEATURE_CLUSTERED_LIGHTING = 1u << 1,	// point lights from the cluster lists (clustered_lighting.h)
+	SHADER_FEATURE_BLOOM_PREFILTER = 1u << 2,		// the first bloom downsample: firefly filter and threshold (post_process.h)
+	SHADER_FEATURE_SOFT_PARTICLES = 1u << 3,		// particles fade against the scene's depth instead of a depth test (particle_system.h)
+};
+
+const ShaderFeature shaderFeatures[] = {
+	{ SHADER_FEATURE_PULSE, "FEATURE_PULSE" },
+	{ SHADER_FEATURE_CLUSTERED_LIGHTING, "FEATURE_CLUSTERED_LIGHTING" },
+	{ SHADER_FEATURE_BLOOM_PREFILTER, "FEATURE_BLOOM_PREFILTER" },
+	{ SHADER_FEATURE_SOFT_PARTICLES, "FEATURE_SOFT_PARTICLES" },
+};
+const int shaderFeatureCount = sizeof(shaderFeatures) / sizeof(shaderFeatures[0]);
+
+struct ShaderProgramDesc
+{
+	const char* name;
+	const char* vertex;
+	const char* fragment;
+	ShaderPermutationKey features;	// the feature bits this program can be compiled with, every combination is a permutation
+	const char* const* varyings;	// vertex outputs captured by transform feedback (interleaved), nullptr for a program that draws
+	int varyingCount;
+};
+
+// the particle state the update writes, in the layout of ParticleSystem's state buffers
+const char* const particleUpdateVaryings[] = { "outPositionAge", "outVelocityLifetime" };
+const int particleUpdateVaryingCount = sizeof(particleUpdateVaryings) / sizeof(particleUpdateVaryings[0]);
+
+const ShaderProgramDesc shaderPrograms[] = {
+	{ "triangle", "triangle.vert", "triangle.frag", SHADER_FEATURE_PULSE | SHADER_FEATURE_CLUSTERED_LIGHTING, nullptr, 0 },
+	{ "depth", "triangle.vert", "depth.frag", 0, nullptr, 0 },			// depth prepass of the triangles
+	{ "overdraw", "triangle.vert", "overdraw.frag", 0, nullptr, 0 },	// overdraw visualisation
+	{ "gbuffer", "triangle.vert", "gbuffer.frag", 0, nullptr, 0 },		// deferred shading: the triangles into the G-buffer
+	{ "deferred_lighting", "fullscreen.vert", "deferred_lighting.frag", 0, nullptr, 0 },	// deferred shading: lighting from the G-buffer
+	{ "bloom_downsample", "fullscreen.vert", "bloom_downsample.frag", SHADER_FEATURE_BLOOM_PREFILTER, nullptr, 0 },	// post: bloom pyramid down
+	{ "bloom_upsample", "fullscreen.vert", "bloom_upsample.frag", 0, nullptr, 0 },		// post: bloom pyramid up, added by blending
+	{ "tonemap", "fullscreen.vert", "tonemap.frag", 0, nullptr, 0 },					// post: bloom, exposure, tonemapping, grading
+	{ "taa_resolve", "fullscreen.vert", "taa_resolve.frag", 0, nullptr, 0 },			// temporal anti-aliasing: the frame into the history
+	{ "particle_update", "particle_update.vert", "depth.frag", 0, particleUpdateVaryings, particleUpdateVaryingCount },		// particles: simulated by transform feedback, nothing rasterised
+	{ "particle", "particle.vert", "particle.frag", SHADER_FEATURE_SOFT_PARTICLES, nullptr, 0 },	// particles: instanced quads
+};
+const int shaderProgramCount = sizeof(shaderPrograms) / sizeof(shaderPrograms[0]);
+
+#endif
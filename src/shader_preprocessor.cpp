@@ -0,0 +1,309 @@
+/*
+ *	GLSL preprocessing, see shader_preprocessor.h
+ */
+
+#include "shader_preprocessor.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace
+{
+	const int maxIncludeDepth = 32;	// deeper than this is an include cycle
+
+	// skips spaces and tabs, returns the rest of the line
+	const char* skipSpace(const char* text)
+	{
+		while (*text == ' ' || *text == '\t')
+		{
+			text++;
+		}
+		return text;
+	}
+
+	// true when line is the directive (e.g. "#include"), rest is set to what follows it
+	bool isDirective(const std::string& line, const char* directive, const char** rest)
+	{
+		const char* text = skipSpace(line.c_str());
+		if (*text != '#')
+		{
+			return false;
+		}
+		text = skipSpace(text + 1);	// "# include" is valid too
+		size_t length = std::strlen(directive);
+		if (std::strncmp(text, directive, length) != 0)
+		{
+			return false;
+		}
+		*rest = skipSpace(text + length);
+		return true;
+	}
+
+	// "a/b/../c.glsl" -> "a/c.glsl", backslashes become slashes
+	std::string normalisePath(const std::string& path)
+	{
+		std::string slashes = path;
+		std::replace(slashes.begin(), slashes.end(), '\\', '/');
+
+		std::vector<std::string> parts;
+		std::string part;
+		std::stringstream stream(slashes);
+		while (std::getline(stream, part, '/'))
+		{
+			if (part.empty() || part == ".")
+			{
+				continue;
+			}
+			if (part == ".." && !parts.empty() && parts.back() != "..")
+			{
+				parts.pop_back();
+				continue;
+			}
+			parts.push_back(part);
+		}
+
+		std::string result;
+		for (size_t i = 0; i < parts.size(); i++)
+		{
+			result += (i > 0 ? "/" : "") + parts[i];
+		}
+		return result;
+	}
+
+	std::string directoryOf(const std::string& path)
+	{
+		size_t slash = path.find_last_of('/');
+		return slash == std::string::npos ? std::string() : path.substr(0, slash + 1);
+	}
+
+	// splits text into lines without the line endings (handles \r\n)
+	std::vector<std::string> splitLines(const std::string& text)
+	{
+		std::vector<std::string> lines;
+		std::string line;
+		std::stringstream stream(text);
+		while (std::getline(stream, line))
+		{
+			if (!line.empty() && line.back() == '\r')
+			{
+				line.pop_back();
+			}
+			lines.push_back(line);
+		}
+		return lines;
+	}
+}
+
+unsigned long long shaderHash(const std::string& text, unsigned long long hash)
+{
+	for (unsigned char c : text)
+	{
+		hash ^= c;
+		hash *= 1099511628211ull;	// 64 bit FNV prime
+	}
+	return hash;
+}
+
+bool PreprocessedShader::mapLine(int outputLine, std::string* file, int* line) const
+{
+	if (outputLine < 1 || outputLine > (int)lines.size())
+	{
+		return false;
+	}
+	const ShaderSourceLine& origin = lines[outputLine - 1];
+	*file = files[origin.file];
+	*line = origin.line;
+	return true;
+}
+
+void ShaderFileSystem::addFile(const std::string& path, const std::string& source)
+{
+	files[normalisePath(path)] = source;
+}
+
+void ShaderFileSystem::mountDirectory(const std::string& directory)
+{
+	root = directory;
+	std::replace(root.begin(), root.end(), '\\', '/');
+	if (!root.empty() && root.back() != '/')
+	{
+		root += '/';
+	}
+}
+
+const std::string* ShaderFileSystem::read(const std::string& path)
+{
+	std::string key = normalisePath(path);
+	auto found = files.find(key);
+	if (found != files.end())
+	{
+		return &found->second;
+	}
+	if (root.empty())
+	{
+		return NULL;
+	}
+
+	std::ifstream file(root + key, std::ios::in | std::ios::binary);
+	if (!file)
+	{
+		return NULL;
+	}
+	std::stringstream contents;
+	contents << file.rdbuf();
+	return &(files[key] = contents.str());
+}
+
+void ShaderPreprocessor::setFeatures(const ShaderFeature* features, int count)
+{
+	featureTable = features;
+	featureCount = count;
+}
+
+bool ShaderPreprocessor::preprocess(const std::string& path, ShaderPermutationKey key, const std::vector<ShaderDefine>& defines,
+	PreprocessedShader* out, std::string* error)
+{
+	*out = PreprocessedShader();
+	once.clear();
+
+	// expand all includes into a list of lines
+	PreprocessedShader expanded;
+	if (!expand(normalisePath(path), 0, &expanded, error))
+	{
+		return false;
+	}
+	std::vector<std::string> lines = splitLines(expanded.source);
+
+	// #version must stay the first line, the defines go right after it
+	size_t version = lines.size();
+	const char* rest;
+	for (size_t i = 0; i < lines.size(); i++)
+	{
+		if (isDirective(lines[i], "version", &rest))
+		{
+			version = i;
+			break;
+		}
+	}
+	if (version == lines.size())
+	{
+		*error = path + ": no #version line";
+		return false;
+	}
+
+	out->files = expanded.files;
+	out->files.push_back("<defines>");	// origin of the injected lines
+	int definesFile = (int)out->files.size() - 1;
+	int definesLine = 0;
+
+	auto emit = [out](const std::string& line, ShaderSourceLine origin)
+	{
+		out->source += line;
+		out->source += '\n';
+		out->lines.push_back(origin);
+	};
+
+	// a feature define is only injected when the source mentions it, so permutations differing only in features this shader ignores
+	// produce identical text (and the same hash)
+	emit(lines[version], expanded.lines[version]);
+	for (int i = 0; i < featureCount; i++)
+	{
+		if ((key & featureTable[i].bit) && expanded.source.find(featureTable[i].define) != std::string::npos)
+		{
+			emit(std::string("#define ") + featureTable[i].define + " 1", ShaderSourceLine{ definesFile, ++definesLine });
+		}
+	}
+	for (const ShaderDefine& define : defines)
+	{
+		emit("#define " + define.name + " " + define.value, ShaderSourceLine{ definesFile, ++definesLine });
+	}
+	for (size_t i = 0; i < lines.size(); i++)
+	{
+		if (i != version)
+		{
+			emit(lines[i], expanded.lines[i]);
+		}
+	}
+
+	out->hash = shaderHash(out->source);
+	return true;
+}
+
+bool ShaderPreprocessor::expand(const std::string& path, int depth, PreprocessedShader* out, std::string* error)
+{
+	if (depth > maxIncludeDepth)
+	{
+		*error = path + ": includes nested too deep (include cycle?)";
+		return false;
+	}
+
+	const std::string* text = fileSystem.read(path);
+	if (text == NULL)
+	{
+		*error = path + ": file not found";
+		return false;
+	}
+	std::vector<std::string> lines = splitLines(*text);
+
+	// #pragma once: include the file only the first time
+	const char* rest;
+	for (const std::string& line : lines)
+	{
+		if (isDirective(line, "pragma", &rest) && std::strncmp(rest, "once", 4) == 0)
+		{
+			if (std::find(once.begin(), once.end(), path) != once.end())
+			{
+				return true;
+			}
+			once.push_back(path);
+			break;
+		}
+	}
+
+	int file = (int)(std::find(out->files.begin(), out->files.end(), path) - out->files.begin());
+	if (file == (int)out->files.size())
+	{
+		out->files.push_back(path);
+	}
+
+	for (size_t i = 0; i < lines.size(); i++)
+	{
+		const std::string& line = lines[i];
+		if (isDirective(line, "pragma", &rest) && std::strncmp(rest, "once", 4) == 0)
+		{
+			continue;	// not GLSL, drivers would warn about it
+		}
+
+		if (isDirective(line, "include", &rest))
+		{
+			const char* begin = std::strchr(rest, '"');
+			const char* end = begin != NULL ? std::strchr(begin + 1, '"') : NULL;
+			if (end == NULL)
+			{
+				*error = path + "(" + std::to_string(i + 1) + "): #include expects \"file\"";
+				return false;
+			}
+
+			// relative to the including file first, then relative to the root of the file system
+			std::string name(begin + 1, end);
+			std::string included = normalisePath(directoryOf(path) + name);
+			if (fileSystem.read(included) == NULL)
+			{
+				included = normalisePath(name);
+			}
+			if (!expand(included, depth + 1, out, error))
+			{
+				*error += "\n\tincluded from " + path + "(" + std::to_string(i + 1) + ")";
+				return false;
+			}
+			continue;
+		}
+
+		out->source += line;
+		out->source += '\n';
+		out->lines.push_back(ShaderSourceLine{ file, (int)i + 1 });
+	}
+	return true;
+}
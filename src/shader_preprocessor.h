@@ -0,0 +1,98 @@
+#ifndef SHADER_PREPROCESSOR_H
+#define SHADER_PREPROCESSOR_H
+
+/*
+ * NOTES:
+ * GLSL preprocessing: #include, injected #defines and permutation keys.
+ *
+ * GLSL has a preprocessor (#define, #ifdef, ...) but no #include, every shader is one self contained string. To share code (the uniform
+ * block declarations, lighting functions) between shaders we expand #include "file" ourselves before handing the source to OpenGL.
+ * Files come from a small virtual file system, either added from memory or read from a directory on disk the first time they are used.
+ *
+ * A permutation of a shader is the same source compiled with a different set of features turned on. A permutation key is a bitset, bit N
+ * set means the define registered for bit N is injected as "#define NAME 1" right after the #version line, the shader then uses #ifdef.
+ * Other defines (with values) can be injected the same way.
+ *
+ * The result is hashed (64 bit FNV-1a of the final text). A feature define is only injected if the shader (with its includes) mentions
+ * it, so two permutations differing only in features the shader doesn't look at end up with the same text and hash, and ShaderCache
+ * compiles them once. The hash is also the key of the program cache.
+ *
+ * Because includes change the line numbers, every output line remembers the file and line it came from so compiler errors can be
+ * reported against the real file.
+ *
+ * Nothing here calls OpenGL, so the offline shader tools can use it too.
+ */
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+typedef unsigned int ShaderPermutationKey;	// bit N set = feature N on
+
+// a feature bit and the define it turns on
+struct ShaderFeature
+{
+	ShaderPermutationKey bit;
+	const char* define;
+};
+
+// an extra #define NAME VALUE injected after the #version line
+struct ShaderDefine
+{
+	std::string name;
+	std::string value;
+};
+
+// origin of one line of preprocessed output
+struct ShaderSourceLine
+{
+	int file;	// index in PreprocessedShader::files
+	int line;	// 1 based line in that file
+};
+
+struct PreprocessedShader
+{
+	std::string source;						// what is given to glShaderSource
+	unsigned long long hash = 0;			// FNV-1a of source
+	std::vector<std::string> files;			// every file that was read, files[0] is the shader itself
+	std::vector<ShaderSourceLine> lines;	// lines[i] is the origin of output line i + 1
+
+	// maps a line of the preprocessed source (as reported by the compiler) back to a file and line, false if out of range
+	bool mapLine(int outputLine, std::string* file, int* line) const;
+};
+
+// in memory files plus an optional directory on disk
+class ShaderFileSystem
+{
+public:
+	void addFile(const std::string& path, const std::string& source);	// takes precedence over files on disk
+	void mountDirectory(const std::string& directory);					// look for files not added from memory in this directory
+	const std::string* read(const std::string& path);					// NULL if the file doesn't exist, read from disk once then cached
+
+private:
+	std::unordered_map<std::string, std::string> files;
+	std::string root;
+};
+
+class ShaderPreprocessor
+{
+public:
+	explicit ShaderPreprocessor(ShaderFileSystem& fileSystem) : fileSystem(fileSystem) {}
+
+	void setFeatures(const ShaderFeature* features, int count);	// the table permutation keys refer to
+
+	bool preprocess(const std::string& path, ShaderPermutationKey key, const std::vector<ShaderDefine>& defines,
+		PreprocessedShader* out, std::string* error);
+
+private:
+	bool expand(const std::string& path, int depth, PreprocessedShader* out, std::string* error);
+
+	ShaderFileSystem& fileSystem;
+	const ShaderFeature* featureTable = nullptr;
+	int featureCount = 0;
+	std::vector<std::string> once;	// files with #pragma once already included in the current shader
+};
+
+unsigned long long shaderHash(const std::string& text, unsigned long long hash = 14695981039346656037ull);	// 64 bit FNV-1a
+
+#endif
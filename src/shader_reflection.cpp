@@ -0,0 +1,250 @@
+/*
+ *	Uniform location / uniform block cache, see shader_reflection.h
+ */
+
+#include "shader_reflection.h"
+#include "alloc_tracker.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+	template <typename Entry>
+	bool sortAndCheck(std::vector<Entry>& table, const char* what)
+	{
+		std::sort(table.begin(), table.end(), [](const Entry& a, const Entry& b) { return a.hash < b.hash; });
+		for (size_t i = 1; i < table.size(); i++)
+		{
+			if (table[i].hash == table[i - 1].hash)
+			{
+				std::cout << "ERROR::SHADER::REFLECTION::HASH_COLLISION\ntwo " << what << " names hash to " << table[i].hash << std::endl;
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template <typename Entry>
+	const Entry* search(const std::vector<Entry>& table, unsigned int hash)
+	{
+		auto found = std::lower_bound(table.begin(), table.end(), hash, [](const Entry& entry, unsigned int h) { return entry.hash < h; });
+		return found != table.end() && found->hash == hash ? &*found : nullptr;
+	}
+}
+
+bool ProgramReflection::build(GLuint program, const ShaderManifestProgram* manifest)
+{
+	AllocScope scope(AllocTag::Shaders);
+	id = program;
+	uniformTable.clear();
+	blockTable.clear();
+
+	if (manifest != nullptr)
+	{
+		// reflected offline, names and types are known, only the driver assigned locations and indices are asked for
+		for (const ShaderManifestUniform& known : manifest->uniforms)
+		{
+			Uniform entry = {};
+			entry.hash = fnv1a(known.name.c_str());
+			entry.location = glGetUniformLocation(program, known.name.c_str());
+			entry.type = known.type;
+			entry.arraySize = known.arraySize;
+			uniformTable.push_back(entry);
+		}
+		for (const ShaderManifestBlock& known : manifest->blocks)
+		{
+			Block entry = {};
+			entry.hash = fnv1a(known.name.c_str());
+			entry.index = glGetUniformBlockIndex(program, known.name.c_str());
+			entry.dataSize = known.dataSize;
+			if (entry.index != GL_INVALID_INDEX)
+			{
+				blockTable.push_back(entry);
+			}
+		}
+		return sortAndCheck(uniformTable, "uniform") && sortAndCheck(blockTable, "uniform block");
+	}
+
+	// active uniforms, the ones the compiler did not remove because they are unused
+	GLint count = 0, maxLength = 0;
+	glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &count);
+	glGetProgramiv(program, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+	std::vector<char> name((size_t)std::max(maxLength, 1));
+
+	for (GLint i = 0; i < count; i++)
+	{
+		GLuint index = (GLuint)i;
+		GLint blockIndex = -1;
+		glGetActiveUniformsiv(program, 1, &index, GL_UNIFORM_BLOCK_INDEX, &blockIndex);
+		if (blockIndex != -1)
+		{
+			continue;	// member of a uniform block, its value comes from a buffer
+		}
+
+		Uniform entry = {};
+		GLsizei length = 0;
+		glGetActiveUniform(program, index, maxLength, &length, &entry.arraySize, &entry.type, name.data());
+
+		// arrays are reported as "lights[0]", look them up by the name without the index
+		char* bracket = std::strchr(name.data(), '[');
+		if (bracket != nullptr)
+		{
+			*bracket = '\0';
+		}
+		entry.hash = fnv1a(name.data());
+		entry.location = glGetUniformLocation(program, name.data());
+		uniformTable.push_back(entry);
+	}
+
+	// active uniform blocks
+	GLint blockCount = 0, maxBlockLength = 0;
+	glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCKS, &blockCount);
+	glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCK_MAX_NAME_LENGTH, &maxBlockLength);
+	std::vector<char> blockName((size_t)std::max(maxBlockLength, 1));
+
+	for (GLint i = 0; i < blockCount; i++)
+	{
+		Block entry = {};
+		entry.index = (GLuint)i;
+		glGetActiveUniformBlockName(program, entry.index, maxBlockLength, NULL, blockName.data());
+		glGetActiveUniformBlockiv(program, entry.index, GL_UNIFORM_BLOCK_DATA_SIZE, &entry.dataSize);
+		entry.hash = fnv1a(blockName.data());
+		blockTable.push_back(entry);
+	}
+
+	return sortAndCheck(uniformTable, "uniform") && sortAndCheck(blockTable, "uniform block");
+}
+
+GLint ProgramReflection::location(unsigned int hash) const
+{
+	const Uniform* entry = search(uniformTable, hash);
+	return entry != nullptr ? entry->location : -1;
+}
+
+const ProgramReflection::Uniform* ProgramReflection::uniform(unsigned int hash) const
+{
+	return search(uniformTable, hash);
+}
+
+const ProgramReflection::Block* ProgramReflection::block(unsigned int hash) const
+{
+	return search(blockTable, hash);
+}
+
+ProgramReflection::Uniform* ProgramReflection::find(unsigned int hash)
+{
+	return const_cast<Uniform*>(search(uniformTable, hash));
+}
+
+bool ProgramReflection::changed(Uniform* entry, const float* value, int count)
+{
+	if (entry->valueKnown && std::memcmp(entry->value, value, count * sizeof(float)) == 0)
+	{
+		return false;
+	}
+	std::memcpy(entry->value, value, count * sizeof(float));
+	entry->valueKnown = true;
+	return true;
+}
+
+bool ProgramReflection::setInt(unsigned int hash, int value)
+{
+	Uniform* entry = find(hash);
+	if (entry == nullptr)
+	{
+		return false;
+	}
+	float stored;
+	std::memcpy(&stored, &value, sizeof(float));	// compare the bits, an int is stored in the float slot unchanged
+	if (changed(entry, &stored, 1))
+	{
+		glUniform1i(entry->location, value);
+	}
+	return true;
+}
+
+bool ProgramReflection::setFloat(unsigned int hash, float value)
+{
+	Uniform* entry = find(hash);
+	if (entry == nullptr)
+	{
+		return false;
+	}
+	if (changed(entry, &value, 1))
+	{
+		glUniform1f(entry->location, value);
+	}
+	return true;
+}
+
+bool ProgramReflection::setVec2(unsigned int hash, float x, float y)
+{
+	Uniform* entry = find(hash);
+	if (entry == nullptr)
+	{
+		return false;
+	}
+	const float value[2] = { x, y };
+	if (changed(entry, value, 2))
+	{
+		glUniform2f(entry->location, x, y);
+	}
+	return true;
+}
+
+bool ProgramReflection::setVec3(unsigned int hash, float x, float y, float z)
+{
+	Uniform* entry = find(hash);
+	if (entry == nullptr)
+	{
+		return false;
+	}
+	const float value[3] = { x, y, z };
+	if (changed(entry, value, 3))
+	{
+		glUniform3f(entry->location, x, y, z);
+	}
+	return true;
+}
+
+bool ProgramReflection::setVec4(unsigned int hash, float x, float y, float z, float w)
+{
+	Uniform* entry = find(hash);
+	if (entry == nullptr)
+	{
+		return false;
+	}
+	const float value[4] = { x, y, z, w };
+	if (changed(entry, value, 4))
+	{
+		glUniform4f(entry->location, x, y, z, w);
+	}
+	return true;
+}
+
+bool ProgramReflection::setMat4(unsigned int hash, const float* columnMajor)
+{
+	Uniform* entry = find(hash);
+	if (entry == nullptr)
+	{
+		return false;
+	}
+	if (changed(entry, columnMajor, 16))
+	{
+		glUniformMatrix4fv(entry->location, 1, GL_FALSE, columnMajor);
+	}
+	return true;
+}
+
+bool ProgramReflection::bindBlock(unsigned int hash, UniformBinding binding) const
+{
+	const Block* entry = search(blockTable, hash);
+	if (entry == nullptr)
+	{
+		return false;
+	}
+	glUniformBlockBinding(id, entry->index, (GLuint)binding);
+	return true;
+}
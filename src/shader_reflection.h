@@ -0,0 +1,102 @@
+#ifndef SHADER_REFLECTION_H
+#define SHADER_REFLECTION_H
+
+/*
+ * NOTES:
+ * Uniform location / uniform block cache for a linked shader program.
+ *
+ * glGetUniformLocation(program, "model") makes the driver compare strings every time it is called, doing that per draw per frame is
+ * wasted time. The locations never change after linking, so right after glLinkProgram we ask the program for all of its active uniforms
+ * (glGetActiveUniform) and uniform blocks (glGetActiveUniformBlockName) once and store them in a small table sorted by the hash of the name.
+ *
+ * Names are hashed with FNV-1a, which is simple enough to be a constexpr function, so UNIFORM_HASH("model") is computed by the compiler
+ * and a lookup at runtime is a binary search over integers, no strings involved.
+ *
+ * The table also keeps the last value set for every uniform. Setting the same value again skips the glUniform* call, the value is
+ * already stored in the program object. Like glUniform* itself the setters act on the program currently in use (glUseProgram).
+ *
+ * When the offline shader compiler already reflected the program (a ShaderManifestProgram with the same hash) the enumeration is
+ * skipped, only the locations/indices of the known names are looked up.
+ *
+ *	ProgramReflection reflection;
+ *	reflection.build(shaderProgram);
+ *	glUseProgram(shaderProgram);
+ *	reflection.setFloat(UNIFORM_HASH("time"), (float)glfwGetTime());
+ */
+
+#include "gl_api.h"
+
+#include <type_traits>
+#include <vector>
+
+#include "shader_manifest.h"
+#include "uniform_buffer.h"
+
+// 32 bit FNV-1a hash of a zero terminated string, usable at compile time
+constexpr unsigned int fnv1a(const char* text)
+{
+	unsigned int hash = 2166136261u;	// FNV offset basis
+	while (*text)
+	{
+		hash ^= (unsigned char)*text++;
+		hash *= 16777619u;				// FNV prime
+	}
+	return hash;
+}
+
+// forces the hash to be computed at compile time (a template argument has to be a constant)
+#define UNIFORM_HASH(name) (std::integral_constant<unsigned int, fnv1a(name)>::value)
+
+class ProgramReflection
+{
+public:
+	// an active uniform outside of any uniform block
+	struct Uniform
+	{
+		unsigned int hash;
+		GLint location;
+		GLenum type;		// GL_FLOAT, GL_FLOAT_VEC4, GL_FLOAT_MAT4, GL_SAMPLER_2D, ...
+		GLint arraySize;
+		bool valueKnown;	// false until the first set, the program's initial values are not read back
+		float value[16];	// last value set, enough for a mat4
+	};
+
+	// an active uniform block
+	struct Block
+	{
+		unsigned int hash;
+		GLuint index;
+		GLint dataSize;		// size of the block in bytes, the buffer range bound to it must be at least this big
+	};
+
+	// queries the active uniforms and blocks (or takes them from the manifest entry), false if two names have the same hash
+	bool build(GLuint program, const ShaderManifestProgram* manifest = nullptr);
+
+	GLint location(unsigned int hash) const;		// -1 when the program has no such uniform (also true for glGetUniformLocation)
+	const Uniform* uniform(unsigned int hash) const;
+	const Block* block(unsigned int hash) const;
+
+	// glUniform* on the current program, skipped when the value is unchanged. false when the uniform does not exist
+	bool setInt(unsigned int hash, int value);
+	bool setFloat(unsigned int hash, float value);
+	bool setVec2(unsigned int hash, float x, float y);
+	bool setVec3(unsigned int hash, float x, float y, float z);
+	bool setVec4(unsigned int hash, float x, float y, float z, float w);
+	bool setMat4(unsigned int hash, const float* columnMajor);
+
+	bool bindBlock(unsigned int hash, UniformBinding binding) const;	// glUniformBlockBinding without glGetUniformBlockIndex
+
+	GLuint program() const { return id; }
+	const std::vector<Uniform>& uniforms() const { return uniformTable; }
+	const std::vector<Block>& blocks() const { return blockTable; }
+
+private:
+	Uniform* find(unsigned int hash);
+	bool changed(Uniform* entry, const float* value, int count);	// compares with the cached value and updates it
+
+	GLuint id = 0;
+	std::vector<Uniform> uniformTable;	// sorted by hash
+	std::vector<Block> blockTable;		// sorted by hash
+};
+
+#endif
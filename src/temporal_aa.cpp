@@ -0,0 +1,200 @@
+/*
+ *	Temporal anti-aliasing, see temporal_aa.h
+ */
+
+#include "temporal_aa.h"
+#include "gl_resources.h"
+#include "transform.h"
+
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+	// element index of the Halton sequence in the given base, 0..1
+	float halton(unsigned int index, unsigned int base)
+	{
+		float result = 0.0f, fraction = 1.0f;
+		while (index > 0)
+		{
+			fraction /= (float)base;
+			result += fraction * (float)(index % base);
+			index /= base;
+		}
+		return result;
+	}
+}
+
+TemporalAA::~TemporalAA()
+{
+	destroy();
+}
+
+bool TemporalAA::create(RenderTargetPool& targets, PipelineCache& cache, GLuint resolveProgram, int frameWidth, int frameHeight)
+{
+	destroy();
+
+	PipelineDesc desc;	// a full screen triangle, no vertex attributes and no depth
+	desc.program = resolveProgram;
+	desc.depth.test = false;
+	desc.depth.write = false;
+	resolve = cache.create(desc);
+
+	RenderTargetDesc historyDesc;
+	historyDesc.width = frameWidth;
+	historyDesc.height = frameHeight;
+	historyDesc.addColor(GL_RGBA16F);
+	histories[0] = targets.create(historyDesc);
+	histories[1] = targets.create(historyDesc);
+	pool = &targets;
+	if (resolve == 0 || histories[0] == 0 || histories[1] == 0)
+	{
+		std::cout << "ERROR::TEMPORAL_AA::CREATE" << std::endl;
+		destroy();
+		return false;
+	}
+	pipelines = &cache;
+	width = frameWidth;
+	height = frameHeight;
+	reset();
+	return true;
+}
+
+void TemporalAA::destroy()
+{
+	for (RenderTargetHandle& history : histories)
+	{
+		if (pool != nullptr && history != 0)
+		{
+			pool->destroy(history);
+		}
+		history = 0;
+	}
+	pool = nullptr;
+	pipelines = nullptr;	// the pipeline belongs to the cache
+	resolve = 0;
+	graphCount = 0;
+}
+
+RenderGraphResource TemporalAA::addPass(RenderGraph& graph, RenderGraphResource scene, RenderGraphResource depthSource, bool drawnOver)
+{
+	if (graphCount == maxGraphs || pool == nullptr)
+	{
+		std::cout << "ERROR::TEMPORAL_AA::ADD_PASS " << (pool == nullptr ? "not created" : "too many graphs") << std::endl;
+		return 0;
+	}
+	GraphResources& resources = graphs[graphCount++];
+	resources.graph = &graph;
+	resources.history = graph.importTarget("TaaHistory", histories[1 - latest]);
+	resources.resolved = graph.importTarget("TaaResolved", histories[latest]);
+	resources.scene = scene;
+	resources.depthSource = depthSource;
+	resources.taa = this;
+
+	RenderGraphPass pass = graph.addPass("TemporalResolve", drawResolve, &resources);
+	graph.read(pass, scene);
+	if (depthSource != scene)
+	{
+		graph.read(pass, depthSource);
+	}
+	graph.read(pass, resources.history);
+	graph.write(pass, resources.resolved, RenderGraphLoad::DontCare);	// every pixel is written
+	if (!drawnOver)
+	{
+		resources.output = 0;
+		return resources.resolved;
+	}
+
+	RenderTargetDesc outputDesc;	// frame sized, the history's precision is only needed while blending
+	outputDesc.addColor(GL_R11F_G11F_B10F);
+	resources.output = graph.createTarget("TaaOutput", outputDesc);
+	RenderGraphPass copy = graph.addPass("TaaCopy", copyResolved, &resources);
+	graph.read(copy, resources.resolved);
+	graph.write(copy, resources.output, RenderGraphLoad::DontCare);
+	return resources.output;
+}
+
+void TemporalAA::setFrameSize(int frameWidth, int frameHeight)
+{
+	if (pool == nullptr || (frameWidth == width && frameHeight == height))
+	{
+		return;
+	}
+	pool->resize(histories[0], frameWidth, frameHeight);
+	pool->resize(histories[1], frameWidth, frameHeight);
+	width = frameWidth;
+	height = frameHeight;
+	reset();
+}
+
+void TemporalAA::reset()
+{
+	historyValid = false;
+}
+
+void TemporalAA::beginFrame(const float* projection, const float* view, float* jitteredProjection)
+{
+	// the motion of the camera since the last frame, without the jitter on either side: unprojected with this frame's camera,
+	// projected with the last one's
+	float viewProjection[16], inverseViewProjection[16];
+	Transform::multiply(viewProjection, projection, view);
+	if (!historyValid || !Transform::inverse(inverseViewProjection, viewProjection))
+	{
+		Transform::identity(reprojection);
+	}
+	else
+	{
+		Transform::multiply(reprojection, previousViewProjection, inverseViewProjection);
+	}
+	std::memcpy(previousViewProjection, viewProjection, sizeof(previousViewProjection));
+
+	// the image moves by the jitter: elements 8 and 9 (x and y of column 2, the factors of view space z) lowered by 2d move normalised
+	// device x and y by +2d, since view space z is -w. d is in texture coordinates, 2d in normalised device coordinates
+	unsigned int phase = frameIndex++ % jitterPhases + 1;	// Halton index 0 is (0, 0)
+	jitter[0] = (halton(phase, 2) - 0.5f) / (float)width;
+	jitter[1] = (halton(phase, 3) - 0.5f) / (float)height;
+	if (jitteredProjection != projection)
+	{
+		std::memcpy(jitteredProjection, projection, 16 * sizeof(float));
+	}
+	jitteredProjection[8] -= 2.0f * jitter[0];
+	jitteredProjection[9] -= 2.0f * jitter[1];
+
+	// last frame's result becomes the history, this frame's goes into the other target
+	latest = 1 - latest;
+	for (int i = 0; i < graphCount; i++)
+	{
+		graphs[i].graph->setImportedTarget(graphs[i].history, histories[1 - latest]);
+		graphs[i].graph->setImportedTarget(graphs[i].resolved, histories[latest]);
+	}
+}
+
+void TemporalAA::fillBlock(TemporalBlock* block) const
+{
+	std::memcpy(block->reprojection, reprojection, sizeof(block->reprojection));
+	block->jitter[0] = jitter[0];
+	block->jitter[1] = jitter[1];
+	block->jitter[2] = currentFrameWeight;
+	block->jitter[3] = historyValid ? 1.0f : 0.0f;
+}
+
+void TemporalAA::drawResolve(const RenderGraph& graph, void* user)
+{
+	GraphResources* resources = (GraphResources*)user;
+	TemporalAA* taa = resources->taa;
+	GlResources::bindTexture((GLuint)TemporalTextureUnit::Current, GL_TEXTURE_2D, graph.texture(resources->scene));
+	GlResources::bindTexture((GLuint)TemporalTextureUnit::Depth, GL_TEXTURE_2D, graph.depthTexture(resources->depthSource));
+	GlResources::bindTexture((GLuint)TemporalTextureUnit::History, GL_TEXTURE_2D, graph.texture(resources->history));
+	taa->pipelines->bind(taa->resolve);
+	glDrawArrays(GL_TRIANGLES, 0, 3);
+	taa->historyValid = true;	// the next frame has one
+}
+
+void TemporalAA::copyResolved(const RenderGraph& graph, void* user)
+{
+	GraphResources* resources = (GraphResources*)user;
+	TemporalAA* taa = resources->taa;
+	GLuint source = taa->pool->framebuffer(graph.target(resources->resolved));
+	GLuint destination = taa->pool->framebuffer(graph.target(resources->output));
+	GlResources::blitFramebuffer(source, destination, taa->width, taa->height, taa->width, taa->height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+}
@@ -0,0 +1,108 @@
+#ifndef TEMPORAL_AA_H
+#define TEMPORAL_AA_H
+
+/*
+ * NOTES:
+ * Temporal anti-aliasing (TAA): the samples of MSAA spread over frames instead of stored side by side in every pixel.
+ *
+ * 4x MSAA keeps 4 colour and depth samples per pixel in the scene target and resolves them at the end of the pass: 4 times the memory
+ * and the bandwidth of every pass that draws into it, and deferred shading can't use it at all (lighting every sample undoes the savings).
+ * TAA renders one sample per pixel, but at a different sub-pixel position every frame, and averages the frames:
+ *	*jitter			the projection is shifted by a sub-pixel offset from a Halton (2, 3) sequence of jitterPhases positions, spread
+ *					evenly over the pixel. After jitterPhases frames of a still camera every pixel has seen that many positions.
+ *	*reprojection	the camera moves, so the history is read where the pixel's surface was last frame: the resolve rebuilds the surface's
+ *					position from the depth and projects it with the previous frame's camera (the motion vector). Only the camera
+ *					moves in this scene, moving objects would need their motion written by the scene pass (previous model matrix).
+ *	*clamping		what was behind a moving edge or newly on screen has no valid history. The history is clipped to the box of the
+ *					colours in the pixel's 3 x 3 neighbourhood this frame, a history that can't be right is pulled to one that can.
+ *	*blending		currentFrameWeight of the new frame, the rest from the history: an exponential average of about 10 frames
+ *
+ * The resolve is one full screen pass. It writes into the history for the next frame, which is also what the post chain reads, so
+ * there is no extra copy. The history lives in two RGBA16F targets from the render target pool (R11F_G11F_B10F drifts in hue when blended
+ * over many frames), the graphs import both and the pair is swapped every frame with RenderGraph::setImportedTarget.
+ * What is drawn over the resolved image must not end up in the history though: it would be blended into the next frames at the wrong
+ * place (the reprojection only knows the scene's depth). Particles write no depth and move fast, in the history they smear into trails.
+ * For such passes addPass(..., true) copies the resolved image into a target of its own (one blit) and returns that instead.
+ *
+ * The projection in the PerView block is the jittered one: everything drawn with it lands on the jittered grid, shaders that rebuild a
+ * position from a pixel take projection[2].xy out again (deferred_lighting.frag).
+ *
+ *	TemporalAA taa;
+ *	taa.create(pool, pipelines, resolveProgram, width, height);
+ *	RenderGraphResource resolved = taa.addPass(graph, scene, depthSource);	// then the post chain reads resolved
+ *	... per frame: taa.beginFrame(projection, view, jitteredProjection); taa.fillBlock(temporalBlock) into the Temporal uniform block ...
+ */
+
+#include "gl_api.h"
+#include "pipeline_state.h"
+#include "render_graph.h"
+#include "uniform_buffer.h"
+
+// texture units of the resolve pass's samplers
+enum class TemporalTextureUnit : GLuint
+{
+	Current = 0,
+	Depth = 1,
+	History = 2
+};
+
+class TemporalAA
+{
+public:
+	static const int jitterPhases = 8;
+	static const int maxGraphs = 2;		// graphs the resolve can be added to
+
+	TemporalAA() = default;
+	~TemporalAA();
+
+	TemporalAA(const TemporalAA&) = delete;
+	TemporalAA& operator=(const TemporalAA&) = delete;
+
+	// the history targets of width x height and the resolve's pipeline
+	bool create(RenderTargetPool& pool, PipelineCache& pipelines, GLuint resolveProgram, int width, int height);
+	void destroy();
+
+	// the resolve after the passes drawing scene (a sampled colour target) and depthSource (a target with a sampled depth attachment),
+	// returns the anti-aliased image for the passes after it. drawnOver: the passes after it draw into the image, it is a copy of the
+	// history rather than the history itself
+	RenderGraphResource addPass(RenderGraph& graph, RenderGraphResource scene, RenderGraphResource depthSource, bool drawnOver = false);
+	void setFrameSize(int width, int height);	// resizes the history, which starts over
+	void reset();								// the history is not used next frame (switched on again, a camera cut)
+
+	// this frame's jitter into jitteredProjection (may be projection), the motion from the last frame's camera and the history swap
+	void beginFrame(const float* projection, const float* view, float* jitteredProjection);
+	void fillBlock(TemporalBlock* block) const;
+
+	float currentFrameWeight = 0.1f;
+
+private:
+	struct GraphResources
+	{
+		RenderGraph* graph;
+		RenderGraphResource history;	// read by the resolve
+		RenderGraphResource resolved;	// written by it
+		RenderGraphResource output;		// the copy of resolved with drawnOver, otherwise 0
+		RenderGraphResource scene;
+		RenderGraphResource depthSource;
+		TemporalAA* taa;
+	};
+
+	static void drawResolve(const RenderGraph& graph, void* user);
+	static void copyResolved(const RenderGraph& graph, void* user);
+
+	RenderTargetPool* pool = nullptr;
+	PipelineCache* pipelines = nullptr;
+	PipelineHandle resolve = 0;
+	RenderTargetHandle histories[2] = {};
+	int latest = 0;					// the history the resolve writes this frame, the next frame reads it
+	bool historyValid = false;
+	int width = 0, height = 0;
+	unsigned int frameIndex = 0;
+	float jitter[2] = {};			// this frame's, in texture coordinates
+	float reprojection[16] = {};
+	float previousViewProjection[16] = {};
+	GraphResources graphs[maxGraphs] = {};
+	int graphCount = 0;
+};
+
+#endif
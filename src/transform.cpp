@@ -0,0 +1,179 @@
+/*
+ *	4x4 matrices, see transform.h
+ */
+
+#include "transform.h"
+
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+	void normalize(float* v)
+	{
+		float length = std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]);
+		if (length > 0.0f)
+		{
+			v[0] /= length;
+			v[1] /= length;
+			v[2] /= length;
+		}
+	}
+
+	void cross(float* out, const float* a, const float* b)
+	{
+		out[0] = a[1] * b[2] - a[2] * b[1];
+		out[1] = a[2] * b[0] - a[0] * b[2];
+		out[2] = a[0] * b[1] - a[1] * b[0];
+	}
+
+	float dot(const float* a, const float* b)
+	{
+		return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+	}
+}
+
+namespace Transform
+{
+	void identity(float* out)
+	{
+		std::memset(out, 0, 16 * sizeof(float));
+		out[0] = out[5] = out[10] = out[15] = 1.0f;
+	}
+
+	void multiply(float* out, const float* a, const float* b)
+	{
+		float result[16];
+		for (int column = 0; column < 4; column++)
+		{
+			for (int row = 0; row < 4; row++)
+			{
+				float sum = 0.0f;
+				for (int k = 0; k < 4; k++)
+				{
+					sum += a[k * 4 + row] * b[column * 4 + k];
+				}
+				result[column * 4 + row] = sum;
+			}
+		}
+		std::memcpy(out, result, sizeof(result));
+	}
+
+	void perspective(float* out, float fovYRadians, float aspect, float nearPlane, float farPlane)
+	{
+		float f = 1.0f / std::tan(fovYRadians * 0.5f);
+		std::memset(out, 0, 16 * sizeof(float));
+		out[0] = f / aspect;
+		out[5] = f;
+		out[10] = (farPlane + nearPlane) / (nearPlane - farPlane);
+		out[11] = -1.0f;
+		out[14] = 2.0f * farPlane * nearPlane / (nearPlane - farPlane);
+	}
+
+	void orthographic(float* out, float left, float right, float bottom, float top, float nearPlane, float farPlane)
+	{
+		std::memset(out, 0, 16 * sizeof(float));
+		out[0] = 2.0f / (right - left);
+		out[5] = 2.0f / (top - bottom);
+		out[10] = -2.0f / (farPlane - nearPlane);
+		out[12] = -(right + left) / (right - left);
+		out[13] = -(top + bottom) / (top - bottom);
+		out[14] = -(farPlane + nearPlane) / (farPlane - nearPlane);
+		out[15] = 1.0f;
+	}
+
+	void lookAt(float* out, const float* eye, const float* target, const float* up)
+	{
+		float forward[3] = { target[0] - eye[0], target[1] - eye[1], target[2] - eye[2] };
+		normalize(forward);
+		float side[3];
+		cross(side, forward, up);
+		normalize(side);
+		float trueUp[3];
+		cross(trueUp, side, forward);
+
+		// rows are the camera axes, the camera looks down -z
+		out[0] = side[0];	out[4] = side[1];	out[8] = side[2];
+		out[1] = trueUp[0];	out[5] = trueUp[1];	out[9] = trueUp[2];
+		out[2] = -forward[0];	out[6] = -forward[1];	out[10] = -forward[2];
+		out[3] = 0.0f;		out[7] = 0.0f;		out[11] = 0.0f;
+		out[12] = -dot(side, eye);
+		out[13] = -dot(trueUp, eye);
+		out[14] = dot(forward, eye);
+		out[15] = 1.0f;
+	}
+
+	void inverseRigid(float* out, const float* m)
+	{
+		// the rotation's inverse is its transpose, the translation goes through it negated
+		float result[16];
+		for (int column = 0; column < 3; column++)
+		{
+			for (int row = 0; row < 3; row++)
+			{
+				result[column * 4 + row] = m[row * 4 + column];
+			}
+			result[column * 4 + 3] = 0.0f;
+		}
+		for (int row = 0; row < 3; row++)
+		{
+			result[12 + row] = -(result[row] * m[12] + result[4 + row] * m[13] + result[8 + row] * m[14]);
+		}
+		result[15] = 1.0f;
+		std::memcpy(out, result, sizeof(result));
+	}
+
+	bool inverse(float* out, const float* m)
+	{
+		// the adjugate over the determinant, from the 2 x 2 determinants of the upper (columns 0, 1) and lower (columns 2, 3) halves
+		float s0 = m[0] * m[5] - m[4] * m[1], s1 = m[0] * m[6] - m[4] * m[2], s2 = m[0] * m[7] - m[4] * m[3];
+		float s3 = m[1] * m[6] - m[5] * m[2], s4 = m[1] * m[7] - m[5] * m[3], s5 = m[2] * m[7] - m[6] * m[3];
+		float c5 = m[10] * m[15] - m[14] * m[11], c4 = m[9] * m[15] - m[13] * m[11], c3 = m[9] * m[14] - m[13] * m[10];
+		float c2 = m[8] * m[15] - m[12] * m[11], c1 = m[8] * m[14] - m[12] * m[10], c0 = m[8] * m[13] - m[12] * m[9];
+		float determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+		if (std::fabs(determinant) < 1e-20f)
+		{
+			return false;
+		}
+		float d = 1.0f / determinant;
+		float result[16] = {
+			(m[5] * c5 - m[6] * c4 + m[7] * c3) * d,
+			(-m[1] * c5 + m[2] * c4 - m[3] * c3) * d,
+			(m[13] * s5 - m[14] * s4 + m[15] * s3) * d,
+			(-m[9] * s5 + m[10] * s4 - m[11] * s3) * d,
+			(-m[4] * c5 + m[6] * c2 - m[7] * c1) * d,
+			(m[0] * c5 - m[2] * c2 + m[3] * c1) * d,
+			(-m[12] * s5 + m[14] * s2 - m[15] * s1) * d,
+			(m[8] * s5 - m[10] * s2 + m[11] * s1) * d,
+			(m[4] * c4 - m[5] * c2 + m[7] * c0) * d,
+			(-m[0] * c4 + m[1] * c2 - m[3] * c0) * d,
+			(m[12] * s4 - m[13] * s2 + m[15] * s0) * d,
+			(-m[8] * s4 + m[9] * s2 - m[11] * s0) * d,
+			(-m[4] * c3 + m[5] * c1 - m[6] * c0) * d,
+			(m[0] * c3 - m[1] * c1 + m[2] * c0) * d,
+			(-m[12] * s3 + m[13] * s1 - m[14] * s0) * d,
+			(m[8] * s3 - m[9] * s1 + m[10] * s0) * d
+		};
+		std::memcpy(out, result, sizeof(result));
+		return true;
+	}
+
+	void scaleTranslation(float* out, float scale, float x, float y, float z)
+	{
+		identity(out);
+		out[0] = out[5] = out[10] = scale;
+		out[12] = x;
+		out[13] = y;
+		out[14] = z;
+	}
+
+	void transformPoint(float* out, const float* m, const float* point)
+	{
+		float result[3];
+		for (int row = 0; row < 3; row++)
+		{
+			result[row] = m[row] * point[0] + m[4 + row] * point[1] + m[8 + row] * point[2] + m[12 + row];
+		}
+		std::memcpy(out, result, sizeof(result));
+	}
+}
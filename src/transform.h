@@ -0,0 +1,28 @@
+#ifndef TRANSFORM_H
+#define TRANSFORM_H
+
+/*
+ * NOTES:
+ * 4x4 matrices for the camera and the objects, stored column major as float[16] (element [column * 4 + row]) like OpenGL and the
+ * std140 blocks expect, so they are copied into a PerView/PerDraw block as they are.
+ *
+ * View space is OpenGL's convention: the camera sits at the origin looking down -z, y up. perspective() maps view depths near..far
+ * to normalised device depth -1..1 (glClipControl and reversed depth are not used).
+ *
+ * No SIMD here: a few matrices per frame, the per light and per object work that matters lives in clustered_lighting.cpp.
+ */
+
+namespace Transform
+{
+	void identity(float* out);
+	void multiply(float* out, const float* a, const float* b);	// out = a * b, out may be a or b
+	void perspective(float* out, float fovYRadians, float aspect, float nearPlane, float farPlane);
+	void orthographic(float* out, float left, float right, float bottom, float top, float nearPlane, float farPlane);	// like glOrtho
+	void lookAt(float* out, const float* eye, const float* target, const float* up);	// view matrix, vectors are float[3]
+	void inverseRigid(float* out, const float* m);	// inverse of a rotation and translation (a view matrix), out may be m
+	bool inverse(float* out, const float* m);		// any invertible matrix (a view projection), false and out untouched if singular
+	void scaleTranslation(float* out, float scale, float x, float y, float z);
+	void transformPoint(float* out, const float* m, const float* point);	// out[3] = m * (point, 1), no perspective divide
+}
+
+#endif
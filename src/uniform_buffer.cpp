@@ -0,0 +1,137 @@
+/*
+ *	Uniform buffer streaming, see uniform_buffer.h
+ */
+
+#include "uniform_buffer.h"
+#include "gl_resources.h"
+#include "gpu_memory.h"
+
+#include <cstring>
+#include <iostream>
+
+UniformStream::~UniformStream()
+{
+	destroy();
+}
+
+bool UniformStream::create(GLsizeiptr bytesPerFrame, int framesInFlight, int blocksPerFrame)
+{
+	destroy();
+
+	GLint offsetAlignment = 256;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &offsetAlignment);	// every glBindBufferRange offset must be a multiple of this
+	alignment = offsetAlignment > 0 ? offsetAlignment : 256;
+
+	bytesPerFrame += (GLsizeiptr)blocksPerFrame * (alignment - 1);	// the padding between the blocks
+	regionSize = (bytesPerFrame + alignment - 1) / alignment * alignment;
+	regions = framesInFlight;
+	// size fixed for its lifetime: immutable storage, written only through mapping (and glBufferSubData in the fallback)
+	ubo = GpuMemory::createImmutableBuffer(GpuMemoryCategory::UniformBuffer, GL_UNIFORM_BUFFER, regionSize * regions, NULL,
+		GL_MAP_WRITE_BIT | GL_DYNAMIC_STORAGE_BIT);
+
+	staging.assign((size_t)regionSize, 0);	// all memory is reserved now, the render loop never allocates
+	fences.assign((size_t)regions, (GLsync)0);
+	region = 0;
+	used = 0;
+	uploaded = 0;
+	return ubo != 0;
+}
+
+void UniformStream::destroy()
+{
+	for (GLsync& fence : fences)
+	{
+		if (fence)
+		{
+			glDeleteSync(fence);
+			fence = 0;
+		}
+	}
+	if (ubo)
+	{
+		GpuMemory::deleteBuffer(ubo);
+		ubo = 0;
+	}
+}
+
+void UniformStream::beginFrame()
+{
+	// wait for the GPU to finish the frame that last used this region, with 3 regions that frame is 3 frames old so it is normally done
+	GLsync& fence = fences[region];
+	if (fence)
+	{
+		GLenum result = glClientWaitSync(fence, 0, 0);
+		if (result == GL_TIMEOUT_EXPIRED)
+		{
+			// the GPU is more than framesInFlight frames behind, flush the commands and wait for real
+			glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);	// 1 second, in nanoseconds
+		}
+		glDeleteSync(fence);
+		fence = 0;
+	}
+
+	used = 0;
+	uploaded = 0;
+	for (BoundRange& range : bound)
+	{
+		range = BoundRange();	// the offsets of the last frame are not valid anymore
+	}
+}
+
+void* UniformStream::allocate(GLsizeiptr size, UniformAllocation* allocation)
+{
+	GLsizeiptr start = (used + alignment - 1) / alignment * alignment;
+	if (start + size > regionSize)
+	{
+		std::cout << "ERROR::UNIFORM_STREAM::OUT_OF_MEMORY\n" << size << " bytes requested, " << regionSize - used << " left this frame" << std::endl;
+		return NULL;
+	}
+
+	used = start + size;
+	allocation->offset = region * regionSize + start;
+	allocation->size = size;
+	return &staging[(size_t)start];
+}
+
+void UniformStream::upload()
+{
+	if (uploaded == used)
+	{
+		return;
+	}
+
+	// GL_MAP_UNSYNCHRONIZED_BIT: don't wait for the GPU, the fence in beginFrame already did
+	// GL_MAP_INVALIDATE_RANGE_BIT: the old contents of the range are not needed, the driver doesn't have to read them back
+	void* destination = GlResources::mapBufferRange(ubo, GL_UNIFORM_BUFFER, region * regionSize + uploaded, used - uploaded,
+		GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+	if (destination != NULL)
+	{
+		std::memcpy(destination, &staging[(size_t)uploaded], (size_t)(used - uploaded));
+		GlResources::unmapBuffer(ubo, GL_UNIFORM_BUFFER);
+	}
+	else
+	{
+		GlResources::bufferSubData(ubo, GL_UNIFORM_BUFFER, region * regionSize + uploaded, used - uploaded, &staging[(size_t)uploaded]);	// fallback
+	}
+	uploaded = used;
+}
+
+void UniformStream::bind(UniformBinding binding, const UniformAllocation& allocation)
+{
+	BoundRange& range = bound[(int)binding];
+	if (range.offset == allocation.offset && range.size == allocation.size)
+	{
+		return;	// already bound, every skipped call is one less driver call
+	}
+
+	GlResources::bindBufferRange(GL_UNIFORM_BUFFER, (GLuint)binding, ubo, allocation.offset, allocation.size);
+	range.offset = allocation.offset;
+	range.size = allocation.size;
+}
+
+void UniformStream::endFrame()
+{
+	upload();	// in case anything was allocated after the last upload
+	fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	region = (region + 1) % regions;
+}
@@ -0,0 +1,198 @@
+#ifndef UNIFORM_BUFFER_H
+#define UNIFORM_BUFFER_H
+
+/*
+ * NOTES:
+ * Uniform buffer objects (UBO) and a per frame streaming allocator for them.
+ *
+ * Setting uniforms one at a time (glUniform4f, glUniformMatrix4fv, ...) is a driver call per value per draw. With many objects that is
+ * hundreds of calls per frame. Instead uniforms are grouped into uniform blocks in the shader:
+ *
+ *	layout (std140) uniform PerDraw
+ *	{
+ *		mat4 model;
+ *		vec4 color;
+ *	};
+ *
+ * and the values of a block come from a range of a buffer bound to a binding point with glBindBufferRange. Switching the data of a draw
+ * is then just binding a different offset of the same buffer.
+ *
+ * std140 is a layout with fixed rules so the C++ structs below can match the GLSL blocks byte for byte:
+ *	*float/int are 4 bytes, vec2 8 byte aligned, vec3 and vec4 16 byte aligned (a vec3 takes a full 16 bytes)
+ *	*a mat4 is 4 vec4 columns (64 bytes), arrays have every element padded to 16 bytes
+ *	*the whole block is padded to a multiple of 16 bytes
+ *
+ * UniformStream owns one large GL_UNIFORM_BUFFER split into one region per frame in flight (3 by default). Every frame the blocks of that
+ * frame are sub-allocated one after another in the frame's region (each start aligned to GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, typically
+ * 256 bytes). While the CPU fills frame N the GPU may still be reading frames N-1 and N-2 from the other regions, a fence per region tells
+ * us when the GPU is done with it. Because of the fences the region can be mapped with GL_MAP_UNSYNCHRONIZED_BIT, so the driver
+ * neither stalls nor makes a copy.
+ *
+ * Before GL 4.4 a buffer cannot stay mapped while drawing from it, so allocations are written to a CPU staging copy first and upload()
+ * copies everything allocated since the last upload into the buffer with one map/unmap. Typical frame:
+ *
+ *	stream.beginFrame();
+ *	PerDrawBlock* draw = stream.allocate<PerDrawBlock>(&allocation);	// for every object
+ *	...
+ *	stream.upload();
+ *	stream.bind(UniformBinding::PerDraw, allocation);					// for every object, then draw
+ *	stream.endFrame();
+ */
+
+#include "gl_api.h"
+
+#include <vector>
+
+// binding points of the uniform blocks, shared by every shader program
+enum class UniformBinding : GLuint
+{
+	PerFrame = 0,
+	PerView = 1,
+	PerDraw = 2,
+	Lighting = 3,
+	Shadows = 4,
+	Post = 5,
+	Temporal = 6,
+	Particles = 7,
+	Count
+};
+
+// std140 blocks, must match the declarations in the shaders
+
+// layout (std140) uniform PerFrame { float time; float deltaTime; vec2 resolution; };
+struct PerFrameBlock
+{
+	float time;
+	float deltaTime;
+	float resolution[2];
+};
+
+// layout (std140) uniform PerView { mat4 view; mat4 projection; mat4 viewProjection; };
+struct PerViewBlock
+{
+	float view[16];				// column major, like OpenGL expects
+	float projection[16];
+	float viewProjection[16];
+};
+
+// layout (std140) uniform PerDraw { mat4 model; vec4 color; vec4 material; };
+struct PerDrawBlock
+{
+	float model[16];
+	float color[4];
+	float material[4];			// roughness, metalness
+};
+
+// layout (std140) uniform Lighting { uvec4 clusterGrid; vec4 clusterParams; vec4 ambientColor; vec4 sunDirection; vec4 sunColor; };
+struct LightingBlock
+{
+	unsigned int clusterGrid[4];	// clusters in x, y and z, number of lights
+	float clusterParams[4];			// tile width and height in pixels, depth slice scale and bias (slice = log(depth) * scale + bias)
+	float ambientColor[4];
+	float sunDirection[4];			// view space, towards the sun
+	float sunColor[4];
+};
+
+// layout (std140) uniform Shadows { mat4 cascadeMatrices[4]; vec4 cascadeSplits; vec4 cascadeTexelSizes; };
+struct ShadowBlock
+{
+	float cascadeMatrices[4][16];	// view space to shadow atlas coordinates and depth
+	float cascadeSplits[4];			// view depth where each cascade ends
+	float cascadeTexelSizes[4];		// world size of a shadow map texel per cascade
+};
+
+// layout (std140) uniform Post { vec4 bloomParams; vec4 toneParams; };
+struct PostBlock
+{
+	float bloomParams[4];	// threshold, soft knee, intensity, upsample filter radius in texels
+	float toneParams[4];	// exposure, grading LUT size, unused, unused
+};
+
+// layout (std140) uniform Temporal { mat4 reprojection; vec4 taaJitter; };
+struct TemporalBlock
+{
+	float reprojection[16];	// this frame's clip space (unjittered) to the previous frame's, for the motion vectors
+	float jitter[4];		// this frame's jitter in texture coordinates (x, y), weight of the new frame, 1 when the history is valid
+};
+
+// struct ParticleEmitter { uvec4 range; vec4 positionRadius; vec4 velocitySpread; vec4 lifetime; };
+struct ParticleEmitterGpu
+{
+	unsigned int range[4];		// first slot and number of slots spawned this frame
+	float positionRadius[4];	// centre and radius of the sphere the particles start in
+	float velocitySpread[4];	// start velocity and the random part added to it
+	float lifetime[4];			// shortest and longest lifetime in seconds
+};
+
+// layout (std140) uniform Particles { vec4 particleSimulation; vec4 particleRender; uvec4 particleEmit; vec4 particleStartColor;
+//	vec4 particleEndColor; ParticleEmitter particleEmitters[8]; };
+struct ParticleBlock
+{
+	float simulation[4];		// time step, gravity, drag per second
+	float render[4];			// size, soft particle fade distance
+	unsigned int emit[4];		// emitters this frame, capacity, random seed of the frame
+	float startColor[4];
+	float endColor[4];
+	ParticleEmitterGpu emitters[8];
+};
+
+static_assert(sizeof(PerFrameBlock) == 16, "PerFrameBlock does not match the std140 layout");
+static_assert(sizeof(PerViewBlock) == 192, "PerViewBlock does not match the std140 layout");
+static_assert(sizeof(PerDrawBlock) == 96, "PerDrawBlock does not match the std140 layout");
+static_assert(sizeof(LightingBlock) == 80, "LightingBlock does not match the std140 layout");
+static_assert(sizeof(ShadowBlock) == 288, "ShadowBlock does not match the std140 layout");
+static_assert(sizeof(PostBlock) == 32, "PostBlock does not match the std140 layout");
+static_assert(sizeof(TemporalBlock) == 80, "TemporalBlock does not match the std140 layout");
+static_assert(sizeof(ParticleBlock) == 592, "ParticleBlock does not match the std140 layout");
+
+// a block sub-allocated from the stream for the current frame
+struct UniformAllocation
+{
+	GLintptr offset = 0;	// offset in the uniform buffer
+	GLsizeiptr size = 0;
+};
+
+class UniformStream
+{
+public:
+	UniformStream() = default;
+	~UniformStream();
+
+	UniformStream(const UniformStream&) = delete;
+	UniformStream& operator=(const UniformStream&) = delete;
+
+	// blocksPerFrame: how many blocks make up bytesPerFrame, each may start up to an offset alignment - 1 bytes after the last one ends
+	bool create(GLsizeiptr bytesPerFrame, int framesInFlight = 3, int blocksPerFrame = 0);
+	void destroy();
+
+	void beginFrame();													// waits until the GPU no longer reads this frame's region
+	void* allocate(GLsizeiptr size, UniformAllocation* allocation);		// returns where to write the data, NULL when the region is full
+	template <typename Block>
+	Block* allocate(UniformAllocation* allocation) { return static_cast<Block*>(allocate(sizeof(Block), allocation)); }
+	void upload();														// copies everything allocated since the last upload to the GPU
+	void bind(UniformBinding binding, const UniformAllocation& allocation);
+	void endFrame();													// fences the region so it is not overwritten while in use
+
+	GLuint buffer() const { return ubo; }
+	GLsizeiptr usedThisFrame() const { return used; }
+
+private:
+	GLuint ubo = 0;
+	GLsizeiptr regionSize = 0;
+	GLsizeiptr alignment = 256;
+	int regions = 0;
+	int region = 0;						// region of the current frame
+	GLsizeiptr used = 0;				// bytes allocated in the current region
+	GLsizeiptr uploaded = 0;			// bytes of the current region already copied to the GPU
+	std::vector<unsigned char> staging;	// CPU copy of the current region, sized once in create()
+	std::vector<GLsync> fences;			// one per region, signalled when the GPU finished the frame that used it
+
+	struct BoundRange
+	{
+		GLintptr offset = -1;
+		GLsizeiptr size = 0;
+	};
+	BoundRange bound[(int)UniformBinding::Count];	// to skip binding the same range again
+};
+
+#endif
@@ -0,0 +1,176 @@
+/*
+ *	GL capture test
+ *
+ *	Captures a few calls into a trace (src/gl_capture.h), loads the trace and replays it (tools/gl_trace.h), then checks that the
+ *	replay made the same calls with the same data. Uploads of 3 MB are larger than half the capture's buffer, so they go straight to
+ *	the file while the commands before them are still buffered: the trace only loads if they are written in order.
+ *
+ *	No window, no OpenGL: glad's pointers are set to small stand-ins for the driver that log every call with a hash of its data. The
+ *	capture wraps them like it wraps the driver, the replay calls them through glad's pointers again once the capture has stopped.
+ *	Exits 0 when every check passed, 1 otherwise, printing the failed checks.
+ *
+ *	usage: gl_capture_test [trace file]
+ */
+
+#include "gl_capture.h"
+#include "gl_trace.h"
+
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+	int failures = 0;
+
+	void check(bool passed, const char* what)
+	{
+		if (!passed)
+		{
+			std::cout << "FAILED: " << what << std::endl;
+			failures++;
+		}
+	}
+
+	// what the driver stand-ins were called with
+	struct DriverCall
+	{
+		std::string function;
+		unsigned long long target;
+		long long offset;
+		long long size;
+		unsigned long long dataHash;	// FNV-1a of the uploaded bytes
+	};
+	std::vector<DriverCall> driverCalls;
+	GLuint nextBuffer = 1;
+
+	unsigned long long hashBytes(const void* data, long long size)
+	{
+		unsigned long long hash = 14695981039346656037ull;
+		const unsigned char* bytes = (const unsigned char*)data;
+		for (long long i = 0; data != nullptr && i < size; i++)
+		{
+			hash = (hash ^ bytes[i]) * 1099511628211ull;
+		}
+		return hash;
+	}
+
+	void APIENTRY driverGetIntegerv(GLenum name, GLint* value)
+	{
+		*value = name == GL_MAJOR_VERSION ? 3 : name == GL_MINOR_VERSION ? 3 : 0;
+	}
+
+	void APIENTRY driverGenBuffers(GLsizei count, GLuint* buffers)
+	{
+		for (GLsizei i = 0; i < count; i++)
+		{
+			buffers[i] = nextBuffer++;
+		}
+		driverCalls.push_back(DriverCall{ "glGenBuffers", 0, 0, count, 0 });
+	}
+
+	void APIENTRY driverBindBuffer(GLenum target, GLuint buffer)
+	{
+		driverCalls.push_back(DriverCall{ "glBindBuffer", target, 0, buffer, 0 });
+	}
+
+	void APIENTRY driverBufferData(GLenum target, GLsizeiptr size, const void* data, GLenum)
+	{
+		driverCalls.push_back(DriverCall{ "glBufferData", target, 0, (long long)size, hashBytes(data, size) });
+	}
+
+	void APIENTRY driverBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
+	{
+		driverCalls.push_back(DriverCall{ "glBufferSubData", target, (long long)offset, (long long)size, hashBytes(data, size) });
+	}
+
+	std::vector<unsigned char> pattern(size_t size, unsigned int seed)
+	{
+		std::vector<unsigned char> bytes(size);
+		for (size_t i = 0; i < size; i++)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			bytes[i] = (unsigned char)(seed >> 24);
+		}
+		return bytes;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	std::string path = argc > 1 ? argv[1] : "gl_capture_test.trace";
+
+	glad_glGetIntegerv = driverGetIntegerv;
+	glad_glGenBuffers = driverGenBuffers;
+	glad_glBindBuffer = driverBindBuffer;
+	glad_glBufferData = driverBufferData;
+	glad_glBufferSubData = driverBufferSubData;
+
+	if (!GlCapture::start(path.c_str(), 64, 64))
+	{
+		std::cout << "Failed to start the capture" << std::endl;
+		return 1;
+	}
+
+	// small calls that stay in the capture's buffer around uploads too large for it, over two frames
+	const std::vector<unsigned char> small = pattern(256, 1);
+	const std::vector<unsigned char> large = pattern(3 << 20, 2);
+	const std::vector<unsigned char> larger = pattern((3 << 20) + 12345, 3);
+	GLuint buffer = 0;
+	glGenBuffers(1, &buffer);
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	glBufferSubData(GL_ARRAY_BUFFER, 16, (GLsizeiptr)small.size(), small.data());
+	glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)large.size(), large.data(), GL_STATIC_DRAW);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, (GLsizeiptr)small.size(), small.data());
+	GlCapture::frame();
+	glBindBuffer(GL_ARRAY_BUFFER, buffer);
+	glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)larger.size(), larger.data(), GL_STATIC_DRAW);
+	glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)large.size(), large.data(), GL_STATIC_DRAW);
+	GlCapture::frame();
+	GlCapture::stop();
+
+	const std::vector<DriverCall> captured = driverCalls;
+	check(captured.size() == 8, "8 calls reached the driver while capturing");
+	check(GlCapture::stats().frames == 2, "2 frames captured");
+
+	// replay through the same stand-ins, the capture put glad's pointers back
+	driverCalls.clear();
+	nextBuffer = 1;
+	GlTrace::Trace trace;
+	bool loaded = GlTrace::load(path, trace);
+	check(loaded, "the trace loads");
+	check(trace.frames == 2, "the trace has 2 complete frames");
+	check(trace.calls == captured.size(), "every captured call is in the trace");
+	if (loaded)
+	{
+		GlTrace::Replayer replayer(trace);
+		for (const GlTrace::Command& command : trace.commands)
+		{
+			replayer.execute(command);
+		}
+		check(replayer.skippedCount() == 0, "no call skipped");
+	}
+
+	check(driverCalls.size() == captured.size(), "the replay made as many calls");
+	for (size_t i = 0; i < captured.size() && i < driverCalls.size(); i++)
+	{
+		const DriverCall& a = captured[i];
+		const DriverCall& b = driverCalls[i];
+		if (a.function != b.function || a.target != b.target || a.offset != b.offset || a.size != b.size || a.dataHash != b.dataHash)
+		{
+			std::cout << "call " << i << ": captured " << a.function << " (" << a.size << " bytes), replayed " << b.function << " ("
+				<< b.size << " bytes)" << std::endl;
+			check(false, "the replayed call is the captured one, with the same data");
+		}
+	}
+	std::remove(path.c_str());
+
+	if (failures > 0)
+	{
+		std::cout << failures << " checks failed" << std::endl;
+		return 1;
+	}
+	std::cout << "gl capture: all checks passed, " << GlCapture::stats().bytes << " bytes captured" << std::endl;
+	return 0;
+}
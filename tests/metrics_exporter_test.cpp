@@ -0,0 +1,161 @@
+/*
+ *	Metrics exporter test
+ *
+ *	Starts the exporter (src/metrics_exporter.h) on a loopback port, publishes a few frames with known numbers, requests the metrics
+ *	over HTTP like a scraper would and checks the response: status line, frame count, histogram buckets and sums, the totals. The
+ *	exporter drains everything published before it answers, so the expected values are exact.
+ *
+ *	No window, no OpenGL. Exits 0 when every check passed, 1 otherwise, printing the failed checks and the response.
+ *
+ *	usage: metrics_exporter_test
+ */
+
+#include "metrics_exporter.h"
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+#include <iostream>
+#include <string>
+
+namespace
+{
+#ifdef _WIN32
+	typedef SOCKET SocketHandle;
+	const SocketHandle invalidSocket = INVALID_SOCKET;
+	void closeSocket(SocketHandle socket) { closesocket(socket); }
+#else
+	typedef int SocketHandle;
+	const SocketHandle invalidSocket = -1;
+	void closeSocket(SocketHandle socket) { close(socket); }
+#endif
+
+	int failures = 0;
+
+	void check(bool passed, const char* what)
+	{
+		if (!passed)
+		{
+			std::cout << "FAILED: " << what << std::endl;
+			failures++;
+		}
+	}
+
+	bool contains(const std::string& text, const char* line)
+	{
+		return text.find(line) != std::string::npos;
+	}
+
+	// GET /metrics on 127.0.0.1:port, the whole response (the exporter closes the connection after it), empty when nothing answered
+	std::string scrape(unsigned short port)
+	{
+		SocketHandle client = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+		if (client == invalidSocket)
+		{
+			return std::string();
+		}
+		sockaddr_in address;
+		std::memset(&address, 0, sizeof(address));
+		address.sin_family = AF_INET;
+		address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		address.sin_port = htons(port);
+		std::string response;
+		if (connect(client, (const sockaddr*)&address, sizeof(address)) == 0)
+		{
+			const char request[] = "GET /metrics HTTP/1.0\r\nHost: 127.0.0.1\r\n\r\n";
+			if (send(client, request, (int)(sizeof(request) - 1), 0) == (int)(sizeof(request) - 1))
+			{
+				char buffer[4096];
+				int count;
+				while ((count = (int)recv(client, buffer, (int)sizeof(buffer), 0)) > 0)
+				{
+					response.append(buffer, (size_t)count);
+				}
+			}
+		}
+		closeSocket(client);
+		return response;
+	}
+}
+
+int main()
+{
+	// a few ports in case one is taken, the exporter only ever listens on 127.0.0.1
+	unsigned short port = 0;
+	for (unsigned short candidate = 19100; candidate < 19110 && port == 0; candidate++)
+	{
+		port = MetricsExporter::serveHttp(candidate) ? candidate : 0;
+	}
+	if (port == 0 || !MetricsExporter::start())
+	{
+		std::cout << "Failed to start the metrics exporter" << std::endl;
+		return 1;
+	}
+
+	// three frames of 10, 20 and 30 ms, one with a GPU time, and a shader cache that compiled 2 and reused 5
+	const double cpuMilliseconds[] = { 10.0, 20.0, 30.0 };
+	for (int i = 0; i < 3; i++)
+	{
+		MetricsFrame frame;
+		frame.cpuMilliseconds = cpuMilliseconds[i];
+		frame.gpuMilliseconds = i == 1 ? 5.0 : -1.0;
+		frame.glCalls = 100;
+		frame.draws = 10;
+		frame.uploadBytes = 4096;
+		frame.vramBytes = 1 << 20;
+		frame.shadersCompiled = 2;
+		frame.shadersReused = 5;
+		MetricsExporter::publish(frame);
+	}
+
+	std::string response = scrape(port);
+	MetricsExporter::stop();
+
+	check(response.compare(0, 15, "HTTP/1.0 200 OK") == 0, "status line HTTP/1.0 200 OK");
+	check(contains(response, "Content-Type: text/plain; version=0.0.4\r\n"), "Prometheus text format content type");
+	size_t bodyStart = response.find("\r\n\r\n");
+	std::string body = bodyStart != std::string::npos ? response.substr(bodyStart + 4) : std::string();
+	check(contains(response, ("Content-Length: " + std::to_string(body.size()) + "\r\n").c_str()), "Content-Length is the body's");
+
+	check(contains(body, "# TYPE learnopengl_frames_total counter\n"), "frames_total declared as a counter");
+	check(contains(body, "\nlearnopengl_frames_total 3\n"), "frames_total 3");
+	check(contains(body, "\nlearnopengl_metrics_dropped_frames_total 0\n"), "no dropped frames");
+	check(contains(body, "# TYPE learnopengl_frame_seconds histogram\n"), "frame_seconds declared as a histogram");
+	check(contains(body, "\nlearnopengl_frame_seconds_bucket{le=\"0.008\"} 0\n"), "no frame up to 8 ms");
+	check(contains(body, "\nlearnopengl_frame_seconds_bucket{le=\"0.0125\"} 1\n"), "one frame up to 12.5 ms");
+	check(contains(body, "\nlearnopengl_frame_seconds_bucket{le=\"0.025\"} 2\n"), "two frames up to 25 ms");
+	check(contains(body, "\nlearnopengl_frame_seconds_bucket{le=\"0.0333\"} 3\n"), "three frames up to 33.3 ms");
+	check(contains(body, "\nlearnopengl_frame_seconds_bucket{le=\"+Inf\"} 3\n"), "three frames in +Inf");
+	check(contains(body, "\nlearnopengl_frame_seconds_sum 0.060000\n"), "frame_seconds_sum 0.06");
+	check(contains(body, "\nlearnopengl_frame_seconds_count 3\n"), "frame_seconds_count 3");
+	check(contains(body, "\nlearnopengl_gpu_frame_seconds_count 1\n"), "only the frame with a GPU time in gpu_frame_seconds");
+	check(contains(body, "\nlearnopengl_gl_calls_total 300\n"), "gl_calls_total 300");
+	check(contains(body, "\nlearnopengl_gl_draws_total 30\n"), "gl_draws_total 30");
+	check(contains(body, "\nlearnopengl_upload_bytes_total 12288\n"), "upload_bytes_total 12288");
+	check(contains(body, "\nlearnopengl_shader_cache_requests_total{kind=\"shader\",result=\"miss\"} 2\n"), "shader misses from the last frame");
+	check(contains(body, "\nlearnopengl_shader_cache_requests_total{kind=\"shader\",result=\"hit\"} 5\n"), "shader hits from the last frame");
+	check(contains(body, "\nlearnopengl_vram_estimated_bytes 1048576\n"), "vram_estimated_bytes from the last frame");
+	check(!MetricsExporter::running(), "stopped");
+
+	if (failures > 0)
+	{
+		std::cout << failures << " checks failed, the response was:\n" << response << std::endl;
+		return 1;
+	}
+	std::cout << "metrics exporter: all checks passed on port " << port << std::endl;
+	return 0;
+}
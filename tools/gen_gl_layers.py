@@ -0,0 +1,728 @@
+#!/usr/bin/env python3
+"""
+Generates the layers that sit on top of glad's function pointers, from the function list of src/glad.c and the
+prototypes in include/glad/glad.h:
+	src/glad_mx.h, src/glad_mx.c				per context dispatch tables (GLAD_MULTI_CONTEXT, see gl_api.h)
+	src/gl_debug_layer.h, src/gl_debug_layer.c	error checking and call tracing (LEARNOPENGL_GL_DEBUG_LAYER, see gl_debug.h)
+	src/gl_capture_layer.h, src/gl_capture_layer.c	call capture and replay thunks (gl_capture.h, tools/gl_replay.cpp)
+	src/gl_stats_layer.h, src/gl_stats_layer.c		per thread call counters (gl_stats.h)
+
+Run from the repository root after the loader was regenerated (README.md), every layer or the ones named:
+	python tools/gen_gl_layers.py [mx] [debug] [capture] [stats]
+"""
+
+import os
+import re
+import sys
+
+GENERATED = '''    Generated by tools/gen_gl_layers.py from the function list of src/glad.c, do not edit. After regenerating the loader:
+        python tools/gen_gl_layers.py'''
+
+
+class Loader:
+	"""what the layers are generated from: glad.c's functions and feature flags, glad.h's prototypes"""
+
+	def __init__(self, root):
+		source = open(os.path.join(root, 'src', 'glad.c')).read()
+		header = open(os.path.join(root, 'include', 'glad', 'glad.h')).read()
+		self.functions = re.findall(r'^PFN\w+PROC glad_(gl\w+) = NULL;', source, re.M)
+		self.flags = re.findall(r'^int GLAD_GL_(\w+) = 0;', source, re.M)
+		self.apis = re.search(r'    APIs: (.*)\n', source).group(1)
+		self.extensions = re.search(r'--extensions="([^"]*)"', source).group(1)
+
+		# typedef <return> (APIENTRYP PFNGLNAMEPROC)(<parameters>);
+		names = dict((f.upper(), f) for f in self.functions)
+		self.prototypes = {}
+		for ret, name, params in re.findall(r'^typedef (.+?) \(APIENTRYP PFN(\w+)PROC\)\((.*)\);$', header, re.M):
+			if name in names:
+				self.prototypes[names[name]] = (ret.strip(), ' '.join(params.split()))
+		missing = [f for f in self.functions if f not in self.prototypes]
+		if missing:
+			sys.exit('glad.h has no prototype for %s, regenerate glad.c and glad.h together' % ', '.join(missing))
+
+	def banner(self, title):
+		return '''/*
+
+    %s
+
+    APIs: %s
+    Extensions: %s
+
+%s''' % (title, self.apis, self.extensions, GENERATED)
+
+
+def split_params(params):
+	"""(type, name) of every parameter, arrays as pointers"""
+	if params.strip() in ('void', ''):
+		return []
+	out = []
+	for p in params.split(','):
+		p = p.strip()
+		m = re.match(r'(.*?)(\w+)\s*(\[[^\]]*\])?$', p)
+		typ, name, arr = m.group(1).strip(), m.group(2), m.group(3)
+		if arr:
+			typ += ' *'
+		out.append((typ, name))
+	return out
+
+
+def write(root, name, lines):
+	with open(os.path.join(root, 'src', name), 'w', newline='\n') as f:
+		f.write('\n'.join(lines))
+
+
+# ---------------------------------------------------------------------------------------------------------------------------------
+# glad_mx: a table of entry points per context, the gl* macros go through the calling thread's current one
+
+def generate_mx(root, loader):
+	funcs, flags = loader.functions, loader.flags
+	hdr = [loader.banner('Multi-context dispatch for the OpenGL loader generated by glad 0.1.34.') + '''
+    Only used when GLAD_MULTI_CONTEXT is defined, see gl_api.h.
+*/
+
+#ifndef __glad_mx_h_
+#define __glad_mx_h_
+
+#ifdef GLAD_MULTI_CONTEXT
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(__cplusplus)
+#define GLAD_THREAD_LOCAL thread_local
+#elif defined(_MSC_VER)
+#define GLAD_THREAD_LOCAL __declspec(thread)
+#else
+#define GLAD_THREAD_LOCAL _Thread_local
+#endif
+
+struct GladGLContext {
+	int major;
+	int minor;''']
+	for f in flags:
+		hdr.append('\tint %s;' % f)
+	for f in funcs:
+		hdr.append('\tPFN%sPROC %s;' % (f.upper(), f[2:]))
+	hdr.append('''};
+
+extern GLAD_THREAD_LOCAL struct GladGLContext* gladCurrentContext;
+
+/* loads the entry points of the context current on the calling thread into context, returns 0 on failure.
+   Goes through the process-wide loader, load one context at a time. */
+int gladLoadGLContext(struct GladGLContext* context, GLADloadproc load);
+/* selects the table the gl* calls of the calling thread go through, call after making the context current */
+void gladMakeContextCurrent(struct GladGLContext* context);
+struct GladGLContext* gladGetCurrentContext(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#ifndef GLAD_MX_NO_REDIRECT
+''')
+	for f in flags:
+		hdr.append('#undef GLAD_GL_%s\n#define GLAD_GL_%s (gladCurrentContext->%s)' % (f, f, f))
+	for f in funcs:
+		hdr.append('#undef %s\n#define %s (gladCurrentContext->%s)' % (f, f, f[2:]))
+	hdr.append('''#endif /* GLAD_MX_NO_REDIRECT */
+
+#endif /* GLAD_MULTI_CONTEXT */
+
+#endif
+''')
+	write(root, 'glad_mx.h', hdr)
+
+	src = [loader.banner('Multi-context dispatch for the OpenGL loader generated by glad 0.1.34, see glad_mx.h.') + '''
+*/
+
+#ifdef GLAD_MULTI_CONTEXT
+
+#include <stddef.h>
+#include <glad/glad.h>
+#define GLAD_MX_NO_REDIRECT
+#include "glad_mx.h"
+
+GLAD_THREAD_LOCAL struct GladGLContext* gladCurrentContext = NULL;
+
+int gladLoadGLContext(struct GladGLContext* context, GLADloadproc load) {
+	int status = gladLoadGLLoader(load);
+	context->major = GLVersion.major;
+	context->minor = GLVersion.minor;''']
+	for f in flags:
+		src.append('\tcontext->%s = GLAD_GL_%s;' % (f, f))
+	for f in funcs:
+		src.append('\tcontext->%s = glad_%s;' % (f[2:], f))
+	src.append('''	return status;
+}
+
+void gladMakeContextCurrent(struct GladGLContext* context) {
+	gladCurrentContext = context;
+}
+
+struct GladGLContext* gladGetCurrentContext(void) {
+	return gladCurrentContext;
+}
+
+#endif /* GLAD_MULTI_CONTEXT */
+''')
+	write(root, 'glad_mx.c', src)
+
+
+# ---------------------------------------------------------------------------------------------------------------------------------
+# gl_debug_layer: every call checked with glGetError and optionally traced with its arguments
+
+DEBUG_INT = {'GLint', 'GLsizei', 'GLbyte', 'GLshort', 'GLubyte', 'GLushort', 'GLfixed', 'GLclampx', 'GLhalfNV', 'GLchar', 'int'}
+DEBUG_UNS = {'GLuint', 'GLbitfield', 'GLhandleARB'}
+DEBUG_FLT = {'GLfloat', 'GLclampf', 'GLdouble', 'GLclampd'}
+DEBUG_I64 = {'GLintptr', 'GLsizeiptr', 'GLint64', 'GLintptrARB', 'GLsizeiptrARB', 'GLint64EXT', 'GLvdpauSurfaceNV'}
+DEBUG_U64 = {'GLuint64', 'GLuint64EXT'}
+DEBUG_PTR = {'GLsync', 'GLeglImageOES', 'GLeglClientBufferEXT', 'GLDEBUGPROC', 'GLDEBUGPROCARB', 'GLDEBUGPROCKHR', 'GLDEBUGPROCAMD',
+	'GLVULKANPROCNV'}
+
+
+def debug_code(typ):
+	"""signature character and cast of an argument for gl_debug_trace_call"""
+	t = typ.replace('const', '').strip()
+	if '*' in t:
+		return 'p', '(const void*)'
+	base = t.split()[-1]
+	if base == 'GLenum':
+		return 'e', '(unsigned int)'
+	if base == 'GLboolean':
+		return 'b', '(int)'
+	if base in DEBUG_INT:
+		return 'i', '(int)'
+	if base in DEBUG_UNS:
+		return 'u', '(unsigned int)'
+	if base in DEBUG_FLT:
+		return 'f', '(double)'
+	if base in DEBUG_I64:
+		return 'l', '(long long)'
+	if base in DEBUG_U64:
+		return 'L', '(unsigned long long)'
+	if base in DEBUG_PTR:
+		return 'p', '(const void*)'
+	raise Exception('no trace code for ' + typ)
+
+
+def generate_debug(root, loader):
+	funcs = loader.functions
+	hdr = [loader.banner('Error checking and call tracing wrappers for the OpenGL loader generated by glad 0.1.34.') + '''
+    Only used when LEARNOPENGL_GL_DEBUG_LAYER is defined, see gl_debug.h.
+*/
+
+#ifndef __gl_debug_layer_h_
+#define __gl_debug_layer_h_
+
+#ifdef LEARNOPENGL_GL_DEBUG_LAYER
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* 1: every gl* call goes through its wrapper, 0: straight to the driver entry point (same cost as without the layer) */
+void gl_debug_layer_install(int wrap);
+''']
+	for f in funcs:
+		hdr.append('extern PFN%sPROC glad_debug_%s;' % (f.upper(), f))
+	hdr.append('''
+#ifdef __cplusplus
+}
+#endif
+''')
+	for f in funcs:
+		hdr.append('#undef %s\n#define %s glad_debug_%s' % (f, f, f))
+	hdr.append('''
+#endif /* LEARNOPENGL_GL_DEBUG_LAYER */
+
+#endif
+''')
+	write(root, 'gl_debug_layer.h', hdr)
+
+	src = [loader.banner('Error checking and call tracing wrappers for the OpenGL loader generated by glad 0.1.34, see gl_debug_layer.h.') + '''
+*/
+
+#ifdef LEARNOPENGL_GL_DEBUG_LAYER
+
+#include <glad/glad.h>
+#include "gl_debug_layer.h"
+
+/* in gl_debug.cpp */
+extern int gl_debug_tracing;
+void gl_debug_trace_call(const char* name, const char* signature, ...);
+void gl_debug_check_error(const char* name);
+''']
+	for f in funcs:
+		ret, params = loader.prototypes[f]
+		ps = split_params(params)
+		args = ', '.join('%s arg%d' % (t, i) for i, (t, _) in enumerate(ps)) or 'void'
+		call = ', '.join('arg%d' % i for i in range(len(ps)))
+		sig = ''.join(debug_code(t)[0] for t, _ in ps)
+		traced = ''.join(', %sarg%d' % (debug_code(t)[1], i) for i, (t, _) in enumerate(ps))
+		body = []
+		if ret == 'void':
+			body.append('\tglad_%s(%s);' % (f, call))
+		else:
+			body.append('\t%s ret;' % ret)
+			body.append('\tret = glad_%s(%s);' % (f, call))
+		body.append('\tif (gl_debug_tracing) gl_debug_trace_call("%s", "%s"%s);' % (f, sig, traced))
+		if f != 'glGetError':
+			body.append('\tgl_debug_check_error("%s");' % f)
+		if ret != 'void':
+			body.append('\treturn ret;')
+		src.append('static %s APIENTRY glad_debug_impl_%s(%s) {\n%s\n}' % (ret, f, args, '\n'.join(body)))
+		src.append('PFN%sPROC glad_debug_%s = glad_debug_impl_%s;' % (f.upper(), f, f))
+	src.append('\nvoid gl_debug_layer_install(int wrap) {')
+	for f in funcs:
+		src.append('\tglad_debug_%s = wrap ? glad_debug_impl_%s : glad_%s;' % (f, f, f))
+	src.append('''}
+
+#endif /* LEARNOPENGL_GL_DEBUG_LAYER */
+''')
+	write(root, 'gl_debug_layer.c', src)
+
+# ---------------------------------------------------------------------------------------------------------------------------------
+# gl_capture_layer: every call recorded with its arguments (gl_capture.h), plus the signatures and replay thunks gl_replay uses
+
+CAP_INT = {'GLint', 'GLsizei', 'GLbyte', 'GLshort', 'GLfixed', 'GLclampx', 'GLchar', 'int'}
+CAP_UNS = {'GLuint', 'GLbitfield', 'GLubyte', 'GLushort', 'GLhalfNV', 'GLhandleARB'}
+CAP_FLT = {'GLfloat', 'GLclampf'}
+CAP_DBL = {'GLdouble', 'GLclampd'}
+CAP_I64 = {'GLintptr', 'GLsizeiptr', 'GLint64', 'GLintptrARB', 'GLsizeiptrARB', 'GLint64EXT', 'GLvdpauSurfaceNV'}
+CAP_U64 = {'GLuint64', 'GLuint64EXT'}
+CAP_PTR = {'GLeglImageOES', 'GLeglClientBufferEXT', 'GLDEBUGPROC', 'GLDEBUGPROCARB', 'GLDEBUGPROCKHR', 'GLDEBUGPROCAMD', 'GLVULKANPROCNV'}
+
+# parameter names that hold an object name, and the signature code of its kind
+CAP_NAMES = {
+	'buffer': 'B', 'buffers': 'B', 'readBuffer': 'B', 'writeBuffer': 'B',
+	'texture': 'T', 'textures': 'T', 'origtexture': 'T', 'srcName': 'T', 'dstName': 'T',
+	'program': 'P', 'shader': 'S', 'shaders': 'S',
+	'array': 'V', 'arrays': 'V', 'vaobj': 'V',
+	'framebuffer': 'F', 'framebuffers': 'F', 'readFramebuffer': 'F', 'drawFramebuffer': 'F',
+	'renderbuffer': 'R', 'renderbuffers': 'R',
+	'sampler': 'M', 'samplers': 'M',
+	'pipeline': 'G', 'pipelines': 'G',
+	'xfb': 'X',
+}
+
+# functions whose capture has to happen before the driver sees the call (the mapped memory is gone after it)
+CAP_BEFORE = {'glUnmapBuffer', 'glUnmapNamedBuffer', 'glFlushMappedBufferRange', 'glFlushMappedNamedBufferRange'}
+
+
+def name_kind(f, name):
+	if name in CAP_NAMES:
+		return CAP_NAMES[name]
+	if name in ('id', 'ids'):
+		if 'Quer' in f:
+			return 'Q'
+		if 'TransformFeedback' in f:
+			return 'X'
+	return None
+
+
+def capture_code(f, ps, i):
+	"""signature code of argument i, see gl_capture_layer.h"""
+	typ, name = ps[i]
+	t = typ.replace('const', '').strip()
+	const = typ.startswith('const')
+	if '*' in t:
+		base = t.replace('*', '').strip()
+		kind = name_kind(f, name)
+		if kind and base == 'GLuint' and t.count('*') == 1 and i > 0 and ps[i - 1][1] in ('n', 'count') and ps[i - 1][0] == 'GLsizei':
+			if const:
+				return '[' + kind
+			if f.startswith('glGen') or f.startswith('glCreate'):
+				return ']' + kind
+		if base == 'GLchar' and t.count('*') == 1 and const:
+			return 's'
+		if base == 'GLchar' and t.count('*') == 2 and const:
+			return 'a'
+		return 'p' if const else 'o'
+	base = t.split()[-1]
+	if base == 'GLsync':
+		return 'Y'
+	if base == 'GLenum':
+		return 'e'
+	if base == 'GLboolean':
+		return 'b'
+	if base == 'GLuint':
+		kind = name_kind(f, name)
+		if kind:
+			return kind
+	if base in CAP_U64 and 'Handle' in f and name in ('handle', 'value'):
+		return 'H'
+	if base == 'GLint' and name == 'location' and 'Uniform' in f:
+		return 'U'
+	if base in CAP_INT:
+		return 'i'
+	if base in CAP_UNS:
+		return 'u'
+	if base in CAP_FLT:
+		return 'f'
+	if base in CAP_DBL:
+		return 'd'
+	if base in CAP_I64:
+		return 'l'
+	if base in CAP_U64:
+		return 'L'
+	if base in CAP_PTR:
+		return 'p'
+	raise Exception('no signature code for ' + typ)
+
+
+def capture_ret_code(f, ret):
+	if ret == 'void':
+		return 'v'
+	if f in ('glCreateShader',):
+		return 'S'
+	if f in ('glCreateProgram', 'glCreateShaderProgramv'):
+		return 'P'
+	if ret == 'GLsync':
+		return 'Y'
+	if f == 'glGetUniformLocation':
+		return 'U'
+	if ret in CAP_U64 and 'Handle' in f:
+		return 'H'
+	if '*' in ret:
+		return 'p'
+	return capture_code(f, [(ret, 'ret')], 0)
+
+
+def capture_member(c):
+	"""member of GLcaptureArg an argument with this signature code is kept in"""
+	if c in ('i', 'l', 'U'):
+		return 'i'
+	if c == 'f':
+		return 'f'
+	if c == 'd':
+		return 'd'
+	if c in ('p', 'o', 's', 'a', 'Y') or c[0] in '[]':
+		return 'p'
+	return 'u'
+
+
+def generate_capture(root, loader):
+	entries = []
+	for f in loader.functions:
+		ret, params = loader.prototypes[f]
+		ps = split_params(params)
+		if len(ps) > 16:
+			sys.exit('%s has more arguments than a capture record holds' % f)
+		codes = [capture_code(f, ps, i) for i in range(len(ps))]
+		entries.append((f, ret, ps, codes, capture_ret_code(f, ret)))
+
+	hdr = [loader.banner('Call capture wrappers for the OpenGL loader generated by glad 0.1.34.') + '''
+    Used by gl_capture.h (recording) and tools/gl_replay.cpp (replaying).
+*/
+
+#ifndef __gl_capture_layer_h_
+#define __gl_capture_layer_h_
+
+#include <glad/glad.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* one argument or return value of a call, the member used follows the signature code */
+typedef union GLcaptureArg {
+	long long i;
+	unsigned long long u;
+	float f;
+	double d;
+	const void* p;
+} GLcaptureArg;
+
+/*
+ * signature codes, one per argument:
+ *	e enum, b boolean, i signed integer, u unsigned integer, l 64 bit signed, L 64 bit unsigned, f float, d double
+ *	B buffer, T texture, P program, S shader, V vertex array, F framebuffer, R renderbuffer, M sampler, Q query, G program pipeline,
+ *	X transform feedback, Y sync, H bindless handle, U uniform location (object names, remapped on replay)
+ *	p input pointer, o output pointer, s string, a array of strings
+ *	[ followed by a name code: array of names read by the call, ] followed by a name code: array of names written by the call
+ *	  (the length of both is the argument before)
+ * the return code uses the same letters, v for none
+ */
+/* makes the call through glad's pointer, returns 0 (and does nothing) when the driver doesn't have the function */
+typedef int (*GLcaptureReplayProc)(const GLcaptureArg* args, GLcaptureArg* ret);
+
+typedef struct GLcaptureFunction {
+	const char* name;
+	const char* signature;
+	char ret;
+	unsigned char argCount;
+	GLcaptureReplayProc replay;
+} GLcaptureFunction;
+
+enum {''']
+	for i, e in enumerate(entries):
+		hdr.append('\tGL_CAPTURE_%s%s,' % (e[0], ' = 0' if i == 0 else ''))
+	hdr.append('''	GL_CAPTURE_FUNCTION_COUNT
+};
+
+extern const GLcaptureFunction gl_capture_functions[GL_CAPTURE_FUNCTION_COUNT];
+
+/* 1: glad's pointers are replaced by the capture wrappers, 0: the driver entry points are put back. Only loaded functions are wrapped. */
+void gl_capture_layer_install(int capture);
+''')
+	for e in entries:
+		hdr.append('extern PFN%sPROC glad_capture_real_%s;' % (e[0].upper(), e[0]))
+	hdr.append('''
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+''')
+	write(root, 'gl_capture_layer.h', hdr)
+
+	src = [loader.banner('Call capture wrappers for the OpenGL loader generated by glad 0.1.34, see gl_capture_layer.h.') + '''
+*/
+
+#include "gl_capture_layer.h"
+
+/* in gl_capture.cpp, replay-only builds (tools/gl_replay.cpp) define them as no-ops */
+void gl_capture_record(int function, const GLcaptureArg* args, const GLcaptureArg* ret);
+void gl_capture_before(int function, const GLcaptureArg* args);
+''']
+	for f, ret, ps, codes, rc in entries:
+		args = ', '.join('%s arg%d' % (t, i) for i, (t, _) in enumerate(ps)) or 'void'
+		call = ', '.join('arg%d' % i for i in range(len(ps)))
+		body = ['\tGLcaptureArg a[%d];' % max(len(ps), 1)]
+		if ret != 'void':
+			body.append('\tGLcaptureArg r;')
+			body.append('\t%s ret;' % ret)
+		if not ps:
+			body.append('\ta[0].u = 0;')
+		for i, c in enumerate(codes):
+			m = capture_member(c)
+			body.append('\ta[%d].%s = %sarg%d;' % (i, m, '(const void*)' if m == 'p' else '', i))
+		if f in CAP_BEFORE:
+			body.append('\tgl_capture_before(GL_CAPTURE_%s, a);' % f)
+		if ret == 'void':
+			body.append('\tglad_capture_real_%s(%s);' % (f, call))
+			body.append('\tgl_capture_record(GL_CAPTURE_%s, a, 0);' % f)
+		else:
+			m = capture_member(rc) if rc != 'p' else 'p'
+			body.append('\tret = glad_capture_real_%s(%s);' % (f, call))
+			body.append('\tr.%s = %sret;' % (m, '(const void*)' if m == 'p' else ''))
+			body.append('\tgl_capture_record(GL_CAPTURE_%s, a, &r);' % f)
+			body.append('\treturn ret;')
+		src.append('PFN%sPROC glad_capture_real_%s = 0;' % (f.upper(), f))
+		src.append('static %s APIENTRY glad_capture_impl_%s(%s) {\n%s\n}' % (ret, f, args, '\n'.join(body)))
+
+		# replay thunk, calls through glad's pointer with the recorded arguments
+		rargs = ', '.join('(%s)a[%d].%s' % (t, i, capture_member(c)) for i, ((t, _), c) in enumerate(zip(ps, codes)))
+		replayed = 'glad_%s(%s)' % (f, rargs)
+		if ret == 'void':
+			rb = '\t(void)r;\n\t%s;' % replayed
+		else:
+			m = capture_member(rc) if rc != 'p' else 'p'
+			rb = '\tr->%s = %s%s;' % (m, '(const void*)' if m == 'p' else '', replayed)
+		if not ps:
+			rb = '\t(void)a;\n' + rb
+		rb = '\tif (glad_%s == 0) return 0;\n%s\n\treturn 1;' % (f, rb)
+		src.append('static int gl_replay_%s(const GLcaptureArg* a, GLcaptureArg* r) {\n%s\n}' % (f, rb))
+
+	src.append('\nconst GLcaptureFunction gl_capture_functions[GL_CAPTURE_FUNCTION_COUNT] = {')
+	for f, ret, ps, codes, rc in entries:
+		src.append('\t{"%s", "%s", \'%s\', %d, gl_replay_%s},' % (f, ''.join(codes), rc, len(ps), f))
+	src.append('};')
+	src.append('\nvoid gl_capture_layer_install(int capture) {')
+	for f, *_ in entries:
+		src.append('\tif (capture && glad_%s && glad_%s != glad_capture_impl_%s) { glad_capture_real_%s = glad_%s; glad_%s = glad_capture_impl_%s; }'
+			% (f, f, f, f, f, f, f))
+		src.append('\telse if (!capture && glad_capture_real_%s) { glad_%s = glad_capture_real_%s; glad_capture_real_%s = 0; }' % (f, f, f, f))
+	src.append('}\n')
+	write(root, 'gl_capture_layer.c', src)
+
+# ---------------------------------------------------------------------------------------------------------------------------------
+# gl_stats_layer: per thread call counts, plus draws, vertices and uploaded bytes worked out from the arguments (gl_stats.h)
+
+# what a call does, first match wins
+STATS_CATEGORIES = [
+	('SYNC', r'^gl(Finish|Flush|FenceSync|ClientWaitSync|WaitSync|MemoryBarrier\w*|TextureBarrier)$'),
+	('DRAW', r'^gl(Multi)?Draw(Arrays|Elements|RangeElements|TransformFeedback)\w*$'),
+	('DISPATCH', r'^glDispatchCompute\w*$'),
+	('CLEAR', r'^gl(Clear|ClearBuffer(fv|iv|uiv|fi)|Invalidate(Buffer|Tex)(Sub)?(Data|Image)|ClearNamedFramebuffer\w+|InvalidateFramebuffer|InvalidateSubFramebuffer|InvalidateNamedFramebuffer\w+|BlitFramebuffer|BlitNamedFramebuffer)$'),
+	('UPLOAD', r'^gl((Named)?Buffer(Sub)?Data|(Named)?BufferStorage(EXT)?|Tex(ture)?(Sub)?Image[123]D|CompressedTex(ture)?(Sub)?Image[123]D|(Map|Unmap)(Named)?Buffer\w*|FlushMapped(Named)?BufferRange|Clear(Named)?Buffer(Sub)?Data|ClearTex(Sub)?Image|Copy(Named)?BufferSubData|CopyImageSubData|CopyTex(ture)?(Sub)?Image[123]D)$'),
+	('BIND', r'^gl(Bind\w+|TransformFeedbackBuffer(Base|Range)|UseProgram|UseProgramStages|ActiveTexture|ActiveShaderProgram|VertexArray(VertexBuffers?|ElementBuffer))$'),
+	('UNIFORM', r'^gl(Program)?Uniform(?!BlockBinding)\w+$'),
+	('QUERY', r'^gl(Get\w+|Is\w+|(Begin|End)Query\w*|QueryCounter|ReadPixels|ReadnPixels|Check(Named)?FramebufferStatus)$'),
+	('OBJECT', r'^gl(Gen\w+|Create\w+|Delete\w+|Tex(ture)?Storage\w+|(Named)?RenderbufferStorage\w*|TextureView)$'),
+	('STATE', r'^gl(Enable\w*|Disable\w*|Blend\w+|Depth\w+|Stencil\w+|CullFace|FrontFace|Polygon\w+|ColorMask\w*|Viewport\w*|Scissor\w*|ClearColor|ClearDepthf?|ClearStencil|LineWidth|PointSize|PointParameter\w+|Sample\w+|MinSampleShading|LogicOp|PrimitiveRestartIndex|PatchParameter\w+|ProvokingVertex|ClipControl|Hint|PixelStore\w|(Tex|Texture|Sampler)Parameter\w+|Tex(ture)?Buffer(Range)?|VertexAttrib(I|L)?(Pointer|Format|Binding|Divisor)|VertexArrayAttrib\w+|VertexArrayBindingDivisor|VertexBindingDivisor|DrawBuffers?|ReadBuffer|NamedFramebuffer(DrawBuffers?|ReadBuffer|Texture\w*|Renderbuffer|Parameteri)|Framebuffer(Texture\w*|Renderbuffer|Parameteri)|UniformBlockBinding|ShaderStorageBlockBinding|VertexAttrib[1-4]\w+|VertexAttribI[1-4]\w+|VertexAttribL[1-4]\w+|VertexAttribP[1-4]\w+)$'),
+]
+
+# in the order of GlCallCategory (gl_stats.h)
+STATS_CATEGORY_ORDER = ['DRAW', 'DISPATCH', 'CLEAR', 'STATE', 'BIND', 'UPLOAD', 'UNIFORM', 'QUERY', 'OBJECT', 'SYNC', 'OTHER']
+
+
+def stats_category(f):
+	for c, pattern in STATS_CATEGORIES:
+		if re.match(pattern, f):
+			return c
+	return 'OTHER'
+
+
+def stats_counting(f, ps):
+	"""statements counting what a call draws or uploads, from its arguments"""
+	names = [n for _, n in ps]
+	types = dict((n, t) for t, n in ps)
+	arg = lambda n: 'arg%d' % names.index(n)
+	out = []
+	category = stats_category(f)
+	if category == 'DRAW':
+		if 'drawcount' in names and '*' not in types['drawcount'] and 'IndirectCount' not in f:
+			out.append('c->draws += (unsigned long long)%s;' % arg('drawcount'))
+		else:
+			out.append('c->draws++;')
+		if 'count' in names and 'Indirect' not in f:
+			instances = [n for n in ('instancecount', 'primcount') if n in names]
+			if '*' in types['count']:
+				out.append('{ GLsizei i; for (i = 0; i < %s; i++) c->vertices += (unsigned long long)%s[i]; }' % (arg('drawcount'), arg('count')))
+			elif instances:
+				out.append('c->vertices += (unsigned long long)%s * (unsigned long long)%s;' % (arg('count'), arg(instances[0])))
+			else:
+				out.append('c->vertices += (unsigned long long)%s;' % arg('count'))
+	elif category == 'UPLOAD':
+		if re.match(r'^gl(Named)?Buffer(Data|Storage|StorageEXT)$', f):
+			out.append('if (%s) c->uploadBytes += (unsigned long long)%s;' % (arg('data'), arg('size')))
+		elif re.match(r'^gl(Named)?BufferSubData$', f):
+			out.append('c->uploadBytes += (unsigned long long)%s;' % arg('size'))
+		elif 'imageSize' in names:
+			out.append('c->uploadBytes += (unsigned long long)%s;' % arg('imageSize'))
+		elif 'pixels' in names:
+			dims = ', '.join(arg(n) if n in names else '1' for n in ('width', 'height', 'depth'))
+			count = 'c->uploadBytes += gl_stats_image_bytes(%s, %s, %s);' % (arg('format'), arg('type'), dims)
+			out.append(count if 'Sub' in f else 'if (%s) %s' % (arg('pixels'), count))
+		elif re.match(r'^glMap(Named)?BufferRange$', f):
+			out.append('if (%s & GL_MAP_WRITE_BIT) c->mappedBytes += (unsigned long long)%s;' % (arg('access'), arg('length')))
+	return out
+
+
+def generate_stats(root, loader):
+	entries = [(f, loader.prototypes[f][0], split_params(loader.prototypes[f][1])) for f in loader.functions]
+
+	hdr = [loader.banner('Per thread call counters for the OpenGL loader generated by glad 0.1.34.') + '''
+    Used by gl_stats.h.
+*/
+
+#ifndef __gl_stats_layer_h_
+#define __gl_stats_layer_h_
+
+#include <glad/glad.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {''']
+	for i, (f, _, _) in enumerate(entries):
+		hdr.append('\tGL_STATS_%s%s,' % (f, ' = 0' if i == 0 else ''))
+	hdr.append('''	GL_STATS_FUNCTION_COUNT
+};
+
+/* what a call does, in the order of GlCallCategory (gl_stats.h) */
+enum {
+%s,
+	GL_STATS_CATEGORY_COUNT
+};
+
+/* what the wrappers count, one per thread making GL calls. Only that thread writes it, the counts only grow (and wrap around). */
+typedef struct GLstatsCounters {
+	unsigned int calls[GL_STATS_FUNCTION_COUNT];
+	unsigned long long draws;		/* draw commands, a multi draw counts every draw it makes (when the count isn't in a buffer) */
+	unsigned long long vertices;	/* vertices, or indices, of direct draws times their instances */
+	unsigned long long uploadBytes;	/* buffer data and texture images handed to the driver */
+	unsigned long long mappedBytes;	/* buffer ranges mapped for writing */
+} GLstatsCounters;
+
+extern const char* const gl_stats_function_names[GL_STATS_FUNCTION_COUNT];
+extern const unsigned char gl_stats_function_categories[GL_STATS_FUNCTION_COUNT];
+
+/* 1: glad's pointers are replaced by the counting wrappers, 0: the previous pointers are put back. Only loaded functions are wrapped. */
+void gl_stats_layer_install(int count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+''' % ',\n'.join('\tGL_STATS_CATEGORY_%s%s' % (c, ' = 0' if i == 0 else '') for i, c in enumerate(STATS_CATEGORY_ORDER)))
+	write(root, 'gl_stats_layer.h', hdr)
+
+	src = [loader.banner('Per thread call counters for the OpenGL loader generated by glad 0.1.34, see gl_stats_layer.h.') + '''
+*/
+
+#include "gl_stats_layer.h"
+
+#if defined(_MSC_VER)
+#define GL_STATS_THREAD_LOCAL __declspec(thread)
+#else
+#define GL_STATS_THREAD_LOCAL _Thread_local
+#endif
+
+/* in gl_stats.cpp: counters for the calling thread, called once per thread on its first GL call */
+GLstatsCounters* gl_stats_attach_thread(void);
+/* in gl_stats.cpp: size of an image read by glTexImage / glTexSubImage, tightly packed */
+unsigned long long gl_stats_image_bytes(GLenum format, GLenum type, GLsizei width, GLsizei height, GLsizei depth);
+
+static GL_STATS_THREAD_LOCAL GLstatsCounters* gl_stats_thread = 0;
+
+static GLstatsCounters* gl_stats_counters(void) {
+	GLstatsCounters* c = gl_stats_thread;
+	if (c == 0) {
+		c = gl_stats_thread = gl_stats_attach_thread();
+	}
+	return c;
+}
+''']
+	for f, ret, ps in entries:
+		args = ', '.join('%s arg%d' % (t, i) for i, (t, _) in enumerate(ps)) or 'void'
+		call = ', '.join('arg%d' % i for i in range(len(ps)))
+		body = ['\tGLstatsCounters* c = gl_stats_counters();', '\tc->calls[GL_STATS_%s]++;' % f]
+		body += ['\t' + line for line in stats_counting(f, ps)]
+		body.append('\t%sglad_stats_real_%s(%s);' % ('' if ret == 'void' else 'return ', f, call))
+		src.append('static PFN%sPROC glad_stats_real_%s = 0;' % (f.upper(), f))
+		src.append('static %s APIENTRY glad_stats_impl_%s(%s) {\n%s\n}' % (ret, f, args, '\n'.join(body)))
+
+	src.append('\nconst char* const gl_stats_function_names[GL_STATS_FUNCTION_COUNT] = {')
+	for f, _, _ in entries:
+		src.append('\t"%s",' % f)
+	src.append('};')
+	src.append('\nconst unsigned char gl_stats_function_categories[GL_STATS_FUNCTION_COUNT] = {')
+	for f, _, _ in entries:
+		src.append('\tGL_STATS_CATEGORY_%s,' % stats_category(f))
+	src.append('};')
+	src.append('\nvoid gl_stats_layer_install(int count) {')
+	for f, _, _ in entries:
+		src.append('\tif (count && glad_%s && glad_%s != glad_stats_impl_%s) { glad_stats_real_%s = glad_%s; glad_%s = glad_stats_impl_%s; }'
+			% (f, f, f, f, f, f, f))
+		src.append('\telse if (!count && glad_stats_real_%s) { glad_%s = glad_stats_real_%s; glad_stats_real_%s = 0; }' % (f, f, f, f))
+	src.append('}\n')
+	write(root, 'gl_stats_layer.c', src)
+
+
+LAYERS = {
+	'mx': generate_mx,
+	'debug': generate_debug,
+	'capture': generate_capture,
+	'stats': generate_stats,
+}
+
+
+def main():
+	root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+	names = sys.argv[1:] or list(LAYERS)
+	unknown = [n for n in names if n not in LAYERS]
+	if unknown:
+		sys.exit('unknown layer %s, the layers are %s' % (', '.join(unknown), ', '.join(LAYERS)))
+	loader = Loader(root)
+	for name in names:
+		LAYERS[name](root, loader)
+		print('%s: %d functions' % (name, len(loader.functions)))
+
+
+if __name__ == '__main__':
+	main()
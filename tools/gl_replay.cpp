@@ -0,0 +1,191 @@
+/*
+ *	OpenGL trace replayer (hidden window)
+ *
+ *	Replays a trace written by the call capture (src/gl_capture.h) without the application: every recorded call is made again, with the
+ *	recorded data, into a hidden GLFW window the size of the captured default framebuffer. It is not headless, creating the window still
+ *	needs a display (there is no surfaceless EGL or OSMesa context here). Nothing waits for vsync or input, so the time it takes is what
+ *	the driver and GPU need for exactly these frames, the same on every run.
+ *
+ *	The whole trace is decoded before the timer starts, the timed loop only remaps object names and calls the driver. Names, uniform
+ *	locations, syncs and bindless handles are remapped from the captured values to the ones this driver returns.
+ *
+ *	--software asks Mesa for llvmpipe (LIBGL_ALWAYS_SOFTWARE, GALLIUM_DRIVER), on Windows that needs Mesa's opengl32.dll next to the
+ *	executable. CPU only rendering is slow but the same on every machine, which is what comparing two builds needs.
+ *	--check calls glGetError after every call and prints the calls that failed, for checking a trace rather than timing it.
+ *
+ *	usage: gl_replay <trace> [--software] [--visible] [--check]
+ */
+
+#include "gl_trace.h"		// decodes the trace and makes its calls again, shared with the capture test
+#include <GLFW/glfw3.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// the capture wrappers are linked for their tables only, nothing is captured here
+extern "C" void gl_capture_record(int, const GLcaptureArg*, const GLcaptureArg*) {}
+extern "C" void gl_capture_before(int, const GLcaptureArg*) {}
+
+namespace
+{
+	struct Options
+	{
+		std::string trace;
+		bool software = false;
+		bool visible = false;
+		bool check = false;
+	};
+
+	// runs every command, presenting at the ends of frames, returns the CPU time of each frame in milliseconds
+	std::vector<double> run(GlTrace::Replayer& replayer, const GlTrace::Trace& trace, GLFWwindow* window, bool check, unsigned long long* errors)
+	{
+		typedef std::chrono::steady_clock Clock;
+		std::vector<double> frameTimes;
+		frameTimes.reserve((size_t)trace.frames);
+		Clock::time_point frameStart = Clock::now();
+
+		for (const GlTrace::Command& command : trace.commands)
+		{
+			if (command.function == GlTrace::frameEnd)
+			{
+				glfwSwapBuffers(window);
+				glfwPollEvents();
+				Clock::time_point now = Clock::now();
+				frameTimes.push_back(std::chrono::duration<double, std::milli>(now - frameStart).count());
+				frameStart = now;
+				continue;
+			}
+
+			replayer.execute(command);
+			if (check && command.function != GlTrace::mappedMemory)
+			{
+				GLenum error = glGetError();
+				if (error != GL_NO_ERROR)
+				{
+					if ((*errors)++ < 20)
+					{
+						std::cerr << "REPLAY::GL_ERROR 0x" << std::hex << error << std::dec << " in " << gl_capture_functions[command.function].name
+							<< "\n";
+					}
+				}
+			}
+		}
+		glFinish();
+		if (!frameTimes.empty())
+		{
+			frameTimes.back() += std::chrono::duration<double, std::milli>(Clock::now() - frameStart).count();
+		}
+		return frameTimes;
+	}
+
+	void setEnvironment(const char* name, const char* value)
+	{
+#ifdef _WIN32
+		_putenv_s(name, value);
+#else
+		setenv(name, value, 1);
+#endif
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Options options;
+	for (int i = 1; i < argc; i++)
+	{
+		if (std::strcmp(argv[i], "--software") == 0)		options.software = true;
+		else if (std::strcmp(argv[i], "--visible") == 0)	options.visible = true;
+		else if (std::strcmp(argv[i], "--check") == 0)		options.check = true;
+		else if (argv[i][0] != '-' && options.trace.empty())	options.trace = argv[i];
+		else
+		{
+			options.trace.clear();
+			break;
+		}
+	}
+	if (options.trace.empty())
+	{
+		std::cerr << "usage: gl_replay <trace> [--software] [--visible] [--check]\n";
+		return 2;
+	}
+
+	GlTrace::Trace trace;
+	if (!GlTrace::load(options.trace, trace))
+	{
+		return 1;
+	}
+	std::cout << "REPLAY::LOADED " << trace.frames << " frames, " << trace.calls << " calls, " << trace.data.size() << " bytes, captured on GL "
+		<< trace.major << "." << trace.minor << "\n";
+
+	if (options.software)
+	{
+		setEnvironment("LIBGL_ALWAYS_SOFTWARE", "1");
+		setEnvironment("GALLIUM_DRIVER", "llvmpipe");
+	}
+
+	glfwInit();
+	glfwWindowHint(GLFW_VISIBLE, options.visible ? GLFW_TRUE : GLFW_FALSE);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, trace.major);
+	glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, trace.minor);
+	if (trace.profile & GL_CONTEXT_CORE_PROFILE_BIT)
+	{
+		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+	}
+	GLFWwindow* window = glfwCreateWindow(trace.width, trace.height, "gl_replay", NULL, NULL);
+	if (window == NULL)
+	{
+		// the driver may not have the captured version (llvmpipe stops at 4.5), try whatever it has and let the calls fail
+		std::cout << "REPLAY::NO_GL_" << trace.major << "_" << trace.minor << " context, using the driver's default" << std::endl;
+		glfwDefaultWindowHints();
+		glfwWindowHint(GLFW_VISIBLE, options.visible ? GLFW_TRUE : GLFW_FALSE);
+		window = glfwCreateWindow(trace.width, trace.height, "gl_replay", NULL, NULL);
+	}
+	if (window == NULL)
+	{
+		std::cerr << "ERROR::REPLAY::NO_CONTEXT" << std::endl;
+		glfwTerminate();
+		return 1;
+	}
+	glfwMakeContextCurrent(window);
+	glfwSwapInterval(0);	// as fast as possible
+	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+	{
+		std::cerr << "ERROR::REPLAY::GLAD" << std::endl;
+		glfwTerminate();
+		return 1;
+	}
+	std::cout << "REPLAY::RENDERER " << glGetString(GL_RENDERER) << ", GL " << glGetString(GL_VERSION) << "\n";
+
+	GlTrace::Replayer replayer(trace);
+	unsigned long long errors = 0;
+	std::vector<double> frameTimes = run(replayer, trace, window, options.check, &errors);
+
+	double total = 0.0;
+	for (double time : frameTimes)
+	{
+		total += time;
+	}
+	std::sort(frameTimes.begin(), frameTimes.end());
+	if (!frameTimes.empty())
+	{
+		std::cout << "REPLAY::DONE " << frameTimes.size() << " frames in " << total << " ms, " << frameTimes.size() * 1000.0 / total << " fps\n"
+			<< "  frame ms: min " << frameTimes.front() << ", median " << frameTimes[frameTimes.size() / 2] << ", 95% "
+			<< frameTimes[frameTimes.size() * 95 / 100] << ", max " << frameTimes.back() << "\n";
+	}
+	if (replayer.skippedCount() > 0)
+	{
+		std::cout << "  " << replayer.skippedCount() << " calls skipped, not supported by this driver\n";
+	}
+	if (options.check)
+	{
+		std::cout << "  " << errors << " GL errors\n";
+	}
+
+	glfwTerminate();
+	return 0;
+}
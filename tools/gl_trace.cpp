@@ -0,0 +1,474 @@
+/*
+ *	Trace loading and replaying, see gl_trace.h
+ */
+
+#include "gl_trace.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+namespace
+{
+	// record types and pointer tags, see gl_capture.cpp
+	const unsigned long long frameEndRecord = 0, mappedMemoryRecord = 1, firstCallRecord = 2;
+	const int nullTag = 0, offsetTag = 1, payloadTag = 2, outputTag = 3;
+
+	int nameKind(char code)
+	{
+		const char* kind = std::strchr(GlTrace::nameKinds, code);
+		return kind != nullptr && code != '\0' ? (int)(kind - GlTrace::nameKinds) : -1;
+	}
+
+	struct Reader
+	{
+		const unsigned char* data;
+		size_t size;
+		size_t position = 0;
+		bool failed = false;
+
+		const unsigned char* bytes(size_t count)
+		{
+			if (failed || count > size - position)
+			{
+				failed = true;
+				return nullptr;
+			}
+			const unsigned char* start = data + position;
+			position += count;
+			return start;
+		}
+
+		unsigned long long varint()
+		{
+			unsigned long long value = 0;
+			for (int shift = 0; shift < 64; shift += 7)
+			{
+				const unsigned char* byte = bytes(1);
+				if (byte == nullptr)
+				{
+					return 0;
+				}
+				value |= (unsigned long long)(*byte & 0x7F) << shift;
+				if ((*byte & 0x80) == 0)
+				{
+					break;
+				}
+			}
+			return value;
+		}
+
+		long long signedVarint()
+		{
+			unsigned long long value = varint();
+			return (long long)(value >> 1) ^ -(long long)(value & 1);
+		}
+	};
+
+	std::vector<unsigned char> outputScratch(64 << 20);	// what glGet*, glReadPixels, ... write, nobody reads it
+
+	bool decodeCall(Reader& reader, GlTrace::Trace& trace, int function)
+	{
+		const GLcaptureFunction& f = gl_capture_functions[function];
+		GlTrace::Command command = { function, trace.args.size() };
+		size_t callNames = 0;
+		const char* code = f.signature;
+		for (int i = 0; i < f.argCount; i++, code++)
+		{
+			GLcaptureArg value;
+			value.u = 0;
+			switch (*code)
+			{
+			case 'i': case 'l': case 'U':
+				value.i = reader.signedVarint();
+				break;
+			case 'f':
+			{
+				const unsigned char* bytes = reader.bytes(sizeof(float));
+				if (bytes != nullptr)
+				{
+					std::memcpy(&value.f, bytes, sizeof(float));
+				}
+				break;
+			}
+			case 'd':
+			{
+				const unsigned char* bytes = reader.bytes(sizeof(double));
+				if (bytes != nullptr)
+				{
+					std::memcpy(&value.d, bytes, sizeof(double));
+				}
+				break;
+			}
+			case 'p': case 'o': case 's':
+			{
+				const unsigned char* tag = reader.bytes(1);
+				int pointer = tag != nullptr ? *tag : nullTag;
+				if (pointer == offsetTag)
+				{
+					value.p = (const void*)(uintptr_t)reader.varint();
+				}
+				else if (pointer == payloadTag)
+				{
+					size_t size = (size_t)reader.varint();
+					value.p = reader.bytes(size);
+				}
+				else if (pointer == outputTag)
+				{
+					value.p = outputScratch.data();
+				}
+				else
+				{
+					value.p = nullptr;
+				}
+				break;
+			}
+			case 'a':
+			{
+				GlTrace::ArrayRef array = { trace.strings.size(), (size_t)reader.varint() };
+				for (size_t s = 0; s < array.count && !reader.failed; s++)
+				{
+					size_t length = (size_t)reader.varint();
+					trace.strings.push_back((const char*)reader.bytes(length));	// stored with their terminating 0
+				}
+				value.u = trace.arrays.size();
+				trace.arrays.push_back(array);
+				break;
+			}
+			case '[': case ']':
+			{
+				code++;
+				GlTrace::ArrayRef array = { trace.names.size(), (size_t)reader.varint() };
+				for (size_t n = 0; n < array.count && !reader.failed; n++)
+				{
+					trace.names.push_back((GLuint)reader.varint());
+				}
+				callNames += array.count;
+				value.u = trace.arrays.size();
+				trace.arrays.push_back(array);
+				break;
+			}
+			default:
+				value.u = reader.varint();
+				break;
+			}
+			trace.args.push_back(value);
+		}
+
+		GLcaptureArg ret;
+		ret.u = 0;
+		switch (f.ret)
+		{
+		case 'S': case 'P': case 'H': case 'Y':
+			ret.u = reader.varint();
+			break;
+		case 'U':
+			ret.i = reader.signedVarint();
+			break;
+		}
+		trace.args.push_back(ret);
+
+		trace.commands.push_back(command);
+		trace.maxNamesPerCall = std::max(trace.maxNamesPerCall, callNames);
+		trace.calls++;
+		return !reader.failed;
+	}
+}
+
+namespace GlTrace
+{
+	bool load(const std::string& path, Trace& trace)
+	{
+		std::ifstream file(path, std::ios::in | std::ios::binary);
+		if (!file)
+		{
+			std::cerr << "ERROR::REPLAY::FILE_NOT_FOUND " << path << "\n";
+			return false;
+		}
+		trace.data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+		Reader reader = { trace.data.data(), trace.data.size() };
+		const unsigned char* magic = reader.bytes(8);
+		if (magic == nullptr || std::memcmp(magic, "GLTRACE", 7) != 0 || magic[7] != 1)
+		{
+			std::cerr << "ERROR::REPLAY::NOT_A_TRACE " << path << "\n";
+			return false;
+		}
+		trace.width = (int)reader.varint();
+		trace.height = (int)reader.varint();
+		trace.major = (int)reader.varint();
+		trace.minor = (int)reader.varint();
+		trace.profile = (int)reader.varint();
+
+		// the trace's function indices to ours, by name
+		std::unordered_map<std::string, int> byName;
+		for (int i = 0; i < GL_CAPTURE_FUNCTION_COUNT; i++)
+		{
+			byName[gl_capture_functions[i].name] = i;
+		}
+		std::vector<int> functions((size_t)reader.varint());
+		std::vector<std::string> functionNames(functions.size());
+		for (size_t i = 0; i < functions.size() && !reader.failed; i++)
+		{
+			size_t length = (size_t)reader.varint();
+			const unsigned char* name = reader.bytes(length);
+			if (name == nullptr)
+			{
+				break;
+			}
+			functionNames[i].assign((const char*)name, length);
+			auto found = byName.find(functionNames[i]);
+			functions[i] = found != byName.end() ? found->second : -1;
+		}
+
+		size_t completeCommands = 0, completeArgs = 0;	// up to the last end of frame, a trace cut short still replays whole frames
+		while (!reader.failed && reader.position < reader.size)
+		{
+			unsigned long long record = reader.varint();
+			if (record == frameEndRecord)
+			{
+				trace.commands.push_back({ frameEnd, trace.args.size() });
+				trace.frames++;
+				completeCommands = trace.commands.size();
+				completeArgs = trace.args.size();
+			}
+			else if (record == mappedMemoryRecord)
+			{
+				Command command = { mappedMemory, trace.args.size() };
+				GLcaptureArg value;
+				for (int i = 0; i < 4; i++)	// named, target or buffer, offset, size
+				{
+					value.u = reader.varint();
+					trace.args.push_back(value);
+				}
+				value.p = reader.bytes((size_t)value.u);
+				trace.args.push_back(value);
+				trace.commands.push_back(command);
+			}
+			else
+			{
+				unsigned long long traced = record - firstCallRecord;
+				if (traced >= functions.size() || functions[traced] < 0)
+				{
+					std::cerr << "ERROR::REPLAY::UNKNOWN_FUNCTION "
+						<< (traced < functionNames.size() ? functionNames[traced] : std::to_string(traced)) << "\n";
+					return false;
+				}
+				decodeCall(reader, trace, functions[traced]);
+			}
+		}
+		if (reader.failed)
+		{
+			std::cerr << "REPLAY::TRUNCATED the trace ends inside a frame, replaying the " << trace.frames << " complete ones\n";
+		}
+		trace.commands.resize(completeCommands);
+		trace.args.resize(completeArgs);
+		return true;
+	}
+
+	Replayer::Replayer(const Trace& trace) : trace(trace)
+	{
+		for (int f = 0; f < GL_CAPTURE_FUNCTION_COUNT; f++)
+		{
+			Signature& signature = signatures[f];
+			signature.programArg = -1;
+			const char* code = gl_capture_functions[f].signature;
+			for (int i = 0; i < gl_capture_functions[f].argCount; i++, code++)
+			{
+				signature.codes[i] = *code;
+				signature.kinds[i] = -1;
+				if (*code == '[' || *code == ']')
+				{
+					signature.kinds[i] = (signed char)nameKind(*++code);
+				}
+				else if (*code == 'P' && signature.programArg < 0)
+				{
+					signature.programArg = i;
+				}
+			}
+		}
+		nameScratch.resize(trace.maxNamesPerCall + 1);
+	}
+
+	GLuint Replayer::name(int kind, GLuint captured) const
+	{
+		const std::vector<GLuint>& table = names[kind];
+		return captured < table.size() && table[captured] != 0 ? table[captured] : captured;
+	}
+
+	void Replayer::setName(int kind, GLuint captured, GLuint replayed)
+	{
+		std::vector<GLuint>& table = names[kind];
+		if (captured >= table.size())
+		{
+			table.resize(std::max<size_t>(captured + 1, table.size() * 2));
+		}
+		table[captured] = replayed;
+	}
+
+	unsigned long long Replayer::locationKey(GLuint program, long long location)
+	{
+		return ((unsigned long long)program << 32) | (unsigned int)location;
+	}
+
+	unsigned long long Replayer::mappingKey(bool named, unsigned long long key)
+	{
+		return (named ? 1ull << 32 : 0) | key;
+	}
+
+	void Replayer::copyMappedMemory(const GLcaptureArg* a)
+	{
+		bool named = a[0].u != 0;
+		unsigned long long key = named ? name(0, (GLuint)a[1].u) : a[1].u;
+		auto mapping = mappings.find(mappingKey(named, key));
+		if (mapping != mappings.end() && mapping->second != nullptr && a[4].p != nullptr)
+		{
+			std::memcpy((unsigned char*)mapping->second + a[2].u, a[4].p, (size_t)a[3].u);
+		}
+	}
+
+	void Replayer::execute(const Command& command)
+	{
+		if (command.function == frameEnd)
+		{
+			return;	// presenting the frame is the caller's
+		}
+		if (command.function == mappedMemory)
+		{
+			copyMappedMemory(&trace.args[command.firstArg]);
+			return;
+		}
+
+		const GLcaptureFunction& f = gl_capture_functions[command.function];
+		const Signature& signature = signatures[command.function];
+		const GLcaptureArg* captured = &trace.args[command.firstArg];
+
+		GLcaptureArg a[16];
+		size_t scratchUsed = 0;
+		for (int i = 0; i < f.argCount; i++)
+		{
+			a[i] = captured[i];
+			char code = signature.codes[i];
+			switch (code)
+			{
+			case 'U':
+			{
+				GLuint program = signature.programArg >= 0 ? (GLuint)captured[signature.programArg].u : currentProgram;
+				auto location = locations.find(locationKey(program, captured[i].i));
+				if (location != locations.end())
+				{
+					a[i].i = location->second;
+				}
+				break;
+			}
+			case 'Y':
+			{
+				auto sync = syncs.find(captured[i].u);
+				a[i].p = sync != syncs.end() ? sync->second : nullptr;
+				break;
+			}
+			case 'H':
+			{
+				auto handle = handles.find(captured[i].u);
+				if (handle != handles.end())
+				{
+					a[i].u = handle->second;
+				}
+				break;
+			}
+			case 'a':
+				a[i].p = trace.strings.data() + trace.arrays[captured[i].u].first;
+				break;
+			case '[': case ']':
+			{
+				const ArrayRef& array = trace.arrays[captured[i].u];
+				GLuint* replayed = nameScratch.data() + scratchUsed;
+				scratchUsed += array.count;
+				if (code == '[')
+				{
+					for (size_t n = 0; n < array.count; n++)
+					{
+						replayed[n] = name(signature.kinds[i], trace.names[array.first + n]);
+					}
+				}
+				a[i].p = replayed;
+				break;
+			}
+			default:
+			{
+				int kind = nameKind(code);
+				if (kind >= 0)
+				{
+					a[i].u = name(kind, (GLuint)captured[i].u);
+				}
+				break;
+			}
+			}
+		}
+
+		GLcaptureArg ret;
+		ret.u = 0;
+		if (!f.replay(a, &ret))
+		{
+			skipped++;	// not there in this driver
+			return;
+		}
+
+		// names created by the call
+		for (int i = 0; i < f.argCount; i++)
+		{
+			if (signature.codes[i] == ']')
+			{
+				const ArrayRef& array = trace.arrays[captured[i].u];
+				const GLuint* replayed = (const GLuint*)a[i].p;
+				for (size_t n = 0; n < array.count; n++)
+				{
+					setName(signature.kinds[i], trace.names[array.first + n], replayed[n]);
+				}
+			}
+		}
+		const GLcaptureArg& capturedRet = captured[f.argCount];
+		switch (f.ret)
+		{
+		case 'S': case 'P':
+			setName(nameKind(f.ret), (GLuint)capturedRet.u, (GLuint)ret.u);
+			break;
+		case 'U':
+			if (capturedRet.i >= 0 && ret.i >= 0)
+			{
+				locations[locationKey((GLuint)captured[0].u, capturedRet.i)] = (GLint)ret.i;
+			}
+			break;
+		case 'Y':
+			syncs[capturedRet.u] = (GLsync)ret.p;
+			break;
+		case 'H':
+			handles[capturedRet.u] = ret.u;
+			break;
+		}
+
+		switch (command.function)
+		{
+		case GL_CAPTURE_glUseProgram:
+			currentProgram = (GLuint)captured[0].u;
+			break;
+		case GL_CAPTURE_glMapBuffer: case GL_CAPTURE_glMapBufferRange:
+			mappings[mappingKey(false, captured[0].u)] = (void*)ret.p;
+			break;
+		case GL_CAPTURE_glMapNamedBuffer: case GL_CAPTURE_glMapNamedBufferRange:
+			mappings[mappingKey(true, a[0].u)] = (void*)ret.p;
+			break;
+		case GL_CAPTURE_glUnmapBuffer:
+			mappings.erase(mappingKey(false, captured[0].u));
+			break;
+		case GL_CAPTURE_glUnmapNamedBuffer:
+			mappings.erase(mappingKey(true, a[0].u));
+			break;
+		case GL_CAPTURE_glDeleteSync:
+			syncs.erase(captured[0].u);
+			break;
+		}
+	}
+}
@@ -0,0 +1,94 @@
+#ifndef GL_TRACE_H
+#define GL_TRACE_H
+
+/*
+ * NOTES:
+ * Reading and replaying a trace written by the call capture (src/gl_capture.h), shared by tools/gl_replay.cpp and the capture test.
+ *
+ * load() decodes the whole file into commands and their arguments up front, payloads point into the loaded file. A trace cut short
+ * keeps its complete frames. Replayer::execute() makes one command again through glad's pointers with the recorded data, remapping
+ * object names, uniform locations, syncs and bindless handles from the captured values to the ones this driver returned.
+ *
+ * Neither creates a context nor presents frames: a frameEnd command does nothing, swapping buffers and timing is up to the caller.
+ */
+
+#include "gl_capture_layer.h"	// glad.h, the signatures and the replay function of every call
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace GlTrace
+{
+	const int frameEnd = -1;		// Command::function of an end of frame
+	const int mappedMemory = -2;	// of memory written into a mapped buffer: named, target or buffer, offset, size, bytes
+
+	const char nameKinds[] = "BTPSVFRMQGX";	// object name codes of gl_capture_layer.h, one remapping table each
+	const int nameKindCount = sizeof(nameKinds) - 1;
+
+	struct Command
+	{
+		int function;		// index into gl_capture_functions, or frameEnd / mappedMemory
+		size_t firstArg;	// the arguments, then the captured return value
+	};
+
+	struct ArrayRef
+	{
+		size_t first;
+		size_t count;
+	};
+
+	struct Trace
+	{
+		std::vector<unsigned char> data;	// payloads point into it
+		int width = 800, height = 600;
+		int major = 0, minor = 0, profile = 0;
+		std::vector<Command> commands;
+		std::vector<GLcaptureArg> args;
+		std::vector<ArrayRef> arrays;
+		std::vector<GLuint> names;			// [ ] arrays
+		std::vector<const char*> strings;	// a arrays
+		size_t maxNamesPerCall = 0;
+		unsigned long long frames = 0;
+		unsigned long long calls = 0;
+	};
+
+	bool load(const std::string& path, Trace& trace);	// false (and the reason printed) when the file is missing or not a trace
+
+	class Replayer
+	{
+	public:
+		explicit Replayer(const Trace& trace);
+
+		void execute(const Command& command);	// a call or mapped memory, frame ends are the caller's
+		unsigned long long skippedCount() const { return skipped; }	// calls this driver doesn't have
+
+	private:
+		// one argument code per argument (the kind of name of the [ ] arrays apart)
+		struct Signature
+		{
+			char codes[16];
+			signed char kinds[16];
+			int programArg;		// the program argument glProgramUniform* locations belong to, -1: the current program
+		};
+
+		const Trace& trace;
+		Signature signatures[GL_CAPTURE_FUNCTION_COUNT];
+		std::vector<GLuint> names[nameKindCount];	// captured name -> ours, 0 = not created in the trace (passed unchanged)
+		std::unordered_map<unsigned long long, GLint> locations;	// (captured program, captured location) -> ours
+		std::unordered_map<unsigned long long, GLsync> syncs;
+		std::unordered_map<unsigned long long, GLuint64> handles;
+		std::unordered_map<unsigned long long, void*> mappings;	// (named, target or captured buffer) -> mapped memory
+		std::vector<GLuint> nameScratch;
+		GLuint currentProgram = 0;	// captured name
+		unsigned long long skipped = 0;
+
+		GLuint name(int kind, GLuint captured) const;
+		void setName(int kind, GLuint captured, GLuint replayed);
+		static unsigned long long locationKey(GLuint program, long long location);
+		static unsigned long long mappingKey(bool named, unsigned long long key);
+		void copyMappedMemory(const GLcaptureArg* a);
+	};
+}
+
+#endif
@@ -0,0 +1,260 @@
+/*
+ *	Offline shader compiler and validator
+ *
+ *	Runs before the renderer is built (pre-build event of learning1) and goes through every permutation of every program listed in
+ *	src/shader_permutations.h:
+ *		*preprocesses it with the same ShaderPreprocessor the renderer uses, so the hashes match the ones computed at runtime
+ *		*compiles and links it with glslang (the Khronos reference compiler, used as a library), no GPU or OpenGL context needed
+ *		*collects the uniform blocks and uniforms (glslang reflection) and writes them to the shader manifest
+ *		*optionally writes SPIR-V for drivers with GL_ARB_gl_spirv
+ *
+ *	Any error fails the build and is printed as "file(line): error: message" with the line mapped back through the includes, so
+ *	Visual Studio lists it in the error list and jumps to the real file.
+ *
+ *	usage: shader_compiler --shaders <directory> --manifest <file> [--spirv <output directory>]
+ */
+
+#include <glslang/Public/ShaderLang.h>
+#include <glslang/Public/ResourceLimits.h>
+#include <glslang/SPIRV/GlslangToSpv.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "shader_diagnostics.h"
+#include "shader_manifest.h"
+#include "shader_permutations.h"
+
+namespace
+{
+	struct Options
+	{
+		std::string shaders = "shaders";
+		std::string manifest = "shaders/shader_manifest.txt";
+		std::string spirv;	// empty = no SPIR-V
+	};
+
+	const int glslVersion = 330;	// the #version every shader is written against
+
+	// glslang's "ERROR: <name>:<line>: message" lines as "file(line): error: message" with the real file and line
+	void printLog(const char* log, const PreprocessedShader& shader, const std::string& directory)
+	{
+		std::vector<ShaderDiagnostic> diagnostics;
+		parseShaderLog(log, &shader, shader.files[0], &diagnostics);
+		for (const ShaderDiagnostic& diagnostic : diagnostics)
+		{
+			printShaderDiagnostic(std::cerr, diagnostic, directory);
+		}
+	}
+
+	EShLanguage stageOf(int stage)
+	{
+		return stage == 0 ? EShLangVertex : EShLangFragment;
+	}
+
+	// parses one stage, for validation (plain OpenGL GLSL rules) or for SPIR-V generation (OpenGL SPIR-V rules)
+	bool parse(glslang::TShader& shader, const PreprocessedShader& source, bool forSpirv, const std::string& directory)
+	{
+		const char* text = source.source.c_str();
+		const char* name = source.files[0].c_str();
+		shader.setStringsWithLengthsAndNames(&text, NULL, &name, 1);
+		if (forSpirv)
+		{
+			// GLSL 3.30 has no layout(binding/location), let glslang assign them like the driver would
+			shader.setEnvInput(glslang::EShSourceGlsl, shader.getStage(), glslang::EShClientOpenGL, 100);
+			shader.setEnvClient(glslang::EShClientOpenGL, glslang::EShTargetOpenGL_450);
+			shader.setEnvTarget(glslang::EShTargetSpv, glslang::EShTargetSpv_1_0);
+			shader.setAutoMapBindings(true);
+			shader.setAutoMapLocations(true);
+		}
+
+		if (!shader.parse(GetDefaultResources(), glslVersion, ECoreProfile, false, false, EShMsgDefault))
+		{
+			printLog(shader.getInfoLog(), source, directory);
+			return false;
+		}
+		return true;
+	}
+
+	bool writeSpirv(const std::string& path, const std::vector<unsigned int>& words)
+	{
+		std::ofstream file(path, std::ios::out | std::ios::binary);
+		file.write((const char*)words.data(), words.size() * sizeof(unsigned int));
+		return (bool)file;
+	}
+
+	// compiles, links and reflects one permutation, fills entry, false on any error
+	bool buildPermutation(const ShaderProgramDesc& desc, ShaderPermutationKey key, ShaderPreprocessor& preprocessor, const Options& options,
+		ShaderManifestProgram* entry)
+	{
+		PreprocessedShader sources[2];
+		std::string error;
+		const char* paths[2] = { desc.vertex, desc.fragment };
+		for (int stage = 0; stage < 2; stage++)
+		{
+			if (!preprocessor.preprocess(paths[stage], key, std::vector<ShaderDefine>(), &sources[stage], &error))
+			{
+				std::cerr << options.shaders << "/" << paths[stage] << "(1): error: " << error << "\n";
+				return false;
+			}
+		}
+
+		entry->name = desc.name;
+		entry->key = key;
+		entry->vertexHash = sources[0].hash;
+		entry->fragmentHash = sources[1].hash;
+		entry->programHash = shaderProgramHash(sources[0].hash, sources[1].hash);
+		if (desc.varyingCount > 0)
+		{
+			// the runtime links these with glTransformFeedbackVaryings and hashes them into the program (ShaderCache::feedbackProgram)
+			entry->programHash = shaderFeedbackProgramHash(entry->programHash, desc.varyings, desc.varyingCount, true);
+			entry->varyings.assign(desc.varyings, desc.varyings + desc.varyingCount);
+		}
+
+		// validate: compile and link with the rules of OpenGL GLSL
+		glslang::TShader vertex(EShLangVertex), fragment(EShLangFragment);
+		glslang::TShader* stages[2] = { &vertex, &fragment };
+		glslang::TProgram program;
+		for (int stage = 0; stage < 2; stage++)
+		{
+			if (!parse(*stages[stage], sources[stage], false, options.shaders))
+			{
+				return false;
+			}
+			program.addShader(stages[stage]);
+		}
+		if (!program.link(EShMsgDefault))
+		{
+			std::cerr << options.shaders << "/" << desc.vertex << "(1): error: linking " << desc.name << " failed\n" << program.getInfoLog();
+			return false;
+		}
+
+		// reflection, what the runtime would otherwise query with glGetActiveUniform & co
+		program.buildReflection();
+		for (int i = 0; i < program.getNumUniformBlocks(); i++)
+		{
+			const glslang::TObjectReflection& block = program.getUniformBlock(i);
+			entry->blocks.push_back(ShaderManifestBlock{ block.name, block.size });
+		}
+		for (int i = 0; i < program.getNumUniformVariables(); i++)
+		{
+			const glslang::TObjectReflection& uniform = program.getUniform(i);
+			if (uniform.index >= 0)
+			{
+				continue;	// member of a uniform block
+			}
+			std::string name = uniform.name.substr(0, uniform.name.find('['));
+			entry->uniforms.push_back(ShaderManifestUniform{ name, (unsigned int)uniform.glDefineType, uniform.size });
+		}
+
+		if (options.spirv.empty())
+		{
+			return true;
+		}
+
+		// SPIR-V: parse again with the OpenGL SPIR-V rules and translate the linked intermediate representation
+		glslang::TShader spirvVertex(EShLangVertex), spirvFragment(EShLangFragment);
+		glslang::TShader* spirvStages[2] = { &spirvVertex, &spirvFragment };
+		glslang::TProgram spirvProgram;
+		for (int stage = 0; stage < 2; stage++)
+		{
+			if (!parse(*spirvStages[stage], sources[stage], true, options.shaders))
+			{
+				return false;
+			}
+			spirvProgram.addShader(spirvStages[stage]);
+		}
+		if (!spirvProgram.link(EShMsgDefault))
+		{
+			std::cerr << options.shaders << "/" << desc.vertex << "(1): error: SPIR-V link of " << desc.name << " failed\n" << spirvProgram.getInfoLog();
+			return false;
+		}
+
+		char suffix[32];
+		std::snprintf(suffix, sizeof(suffix), ".%x", key);
+		entry->vertexSpirv = std::string(desc.name) + suffix + ".vert.spv";
+		entry->fragmentSpirv = std::string(desc.name) + suffix + ".frag.spv";
+		const std::string* files[2] = { &entry->vertexSpirv, &entry->fragmentSpirv };
+		for (int stage = 0; stage < 2; stage++)
+		{
+			std::vector<unsigned int> words;
+			glslang::GlslangToSpv(*spirvProgram.getIntermediate(stageOf(stage)), words);
+			if (!writeSpirv(options.spirv + "/" + *files[stage], words))
+			{
+				std::cerr << "error: could not write " << options.spirv << "/" << *files[stage] << "\n";
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+int main(int argc, char** argv)
+{
+	Options options;
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		if (std::strcmp(argv[i], "--shaders") == 0)			options.shaders = argv[i + 1];
+		else if (std::strcmp(argv[i], "--manifest") == 0)	options.manifest = argv[i + 1];
+		else if (std::strcmp(argv[i], "--spirv") == 0)		options.spirv = argv[i + 1];
+		else
+		{
+			std::cerr << "usage: shader_compiler --shaders <directory> --manifest <file> [--spirv <output directory>]\n";
+			return 2;
+		}
+	}
+
+	ShaderFileSystem files;
+	files.mountDirectory(options.shaders);
+	ShaderPreprocessor preprocessor(files);
+	preprocessor.setFeatures(shaderFeatures, shaderFeatureCount);
+
+	glslang::InitializeProcess();
+
+	ShaderManifest manifest;
+	int failed = 0, permutations = 0;
+	for (int p = 0; p < shaderProgramCount; p++)
+	{
+		const ShaderProgramDesc& desc = shaderPrograms[p];
+
+		// every subset of the program's feature bits (walks all submasks of desc.features, 0 included)
+		ShaderPermutationKey key = desc.features;
+		while (true)
+		{
+			ShaderManifestProgram entry;
+			permutations++;
+			if (!buildPermutation(desc, key, preprocessor, options, &entry))
+			{
+				failed++;
+			}
+			else if (manifest.find(entry.programHash) == nullptr)	// identical text as another permutation, one entry is enough
+			{
+				manifest.programs.push_back(entry);
+			}
+
+			if (key == 0)
+			{
+				break;
+			}
+			key = (key - 1) & desc.features;
+		}
+	}
+
+	glslang::FinalizeProcess();
+
+	std::cout << "shader_compiler: " << permutations << " permutations, " << manifest.programs.size() << " unique, " << failed << " failed\n";
+	if (failed > 0)
+	{
+		return 1;
+	}
+	if (!manifest.save(options.manifest))
+	{
+		std::cerr << "error: could not write " << options.manifest << "\n";
+		return 1;
+	}
+	return 0;
+}